@@ -243,6 +243,10 @@ if(ARROW_DEFINE_OPTIONS)
 
   define_option(ARROW_FLIGHT_SQL "Build the Arrow Flight SQL extension" OFF)
 
+  define_option(ARROW_FLIGHT_SHM
+                "Build the shared-memory transport for Arrow Flight (not supported on Windows)"
+                OFF)
+
   define_option(ARROW_GANDIVA "Build the Gandiva libraries" OFF)
 
   define_option(ARROW_GCS
@@ -401,6 +405,10 @@ if(ARROW_DEFINE_OPTIONS)
                 "Build with UCX transport for Arrow Flight;(only used if ARROW_FLIGHT is ON)"
                 OFF)
 
+  define_option(ARROW_WITH_SIMDJSON
+                "Build the simdjson-based JSON parser backend (requires a system simdjson);(only used if ARROW_JSON is ON)"
+                OFF)
+
   define_option(ARROW_WITH_UTF8PROC
                 "Build with support for Unicode properties using the utf8proc library;(only used if ARROW_COMPUTE is ON or ARROW_GANDIVA is ON)"
                 ON)
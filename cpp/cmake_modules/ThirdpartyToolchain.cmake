@@ -329,6 +329,8 @@ endif()
 
 if(ARROW_JSON)
   set(ARROW_WITH_RAPIDJSON ON)
+else()
+  set(ARROW_WITH_SIMDJSON OFF)
 endif()
 
 if(ARROW_ORC
@@ -2180,6 +2182,18 @@ if(ARROW_WITH_RAPIDJSON)
   endif()
 endif()
 
+if(ARROW_WITH_SIMDJSON)
+  # simdjson isn't built from source: it must come from the system or a package manager
+  set(simdjson_SOURCE "SYSTEM")
+  # simdjson's package only matches its own minor version, so check the version here
+  resolve_dependency(simdjson USE_CONFIG TRUE PC_PACKAGE_NAMES simdjson)
+  if(simdjson_VERSION VERSION_LESS "3.0.0")
+    message(FATAL_ERROR "ARROW_WITH_SIMDJSON requires simdjson 3.0.0 or later, "
+                        "found ${simdjson_VERSION}")
+  endif()
+  add_definitions(-DARROW_WITH_SIMDJSON)
+endif()
+
 macro(build_xsimd)
   message(STATUS "Building xsimd from source")
   set(XSIMD_PREFIX "${CMAKE_CURRENT_BINARY_DIR}/xsimd_ep/src/xsimd_ep-install")
@@ -512,6 +512,53 @@ class ORCFileReader::Impl {
                                              pool_);
   }
 
+  Result<std::shared_ptr<RecordBatchReader>> GetStripeReader(
+      int64_t stripe, int64_t batch_size, const std::vector<std::string>& include_names) {
+    liborc::RowReaderOptions opts;
+    if (!include_names.empty()) {
+      RETURN_NOT_OK(SelectNames(&opts, include_names));
+    }
+    RETURN_NOT_OK(SelectStripe(&opts, stripe));
+    ARROW_ASSIGN_OR_RAISE(auto schema, ReadSchema(opts));
+    std::unique_ptr<liborc::RowReader> row_reader;
+
+    ORC_BEGIN_CATCH_NOT_OK
+    row_reader = reader_->createRowReader(opts);
+    ORC_END_CATCH_NOT_OK
+
+    return std::make_shared<OrcStripeReader>(std::move(row_reader), schema, batch_size,
+                                             pool_);
+  }
+
+  Result<ColumnStatistics> GetStripeColumnStatistics(int64_t stripe, int field_index) {
+    ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                    Status::Invalid("Out of bounds stripe: ", stripe));
+    const liborc::Type& type = reader_->getType();
+    ARROW_RETURN_IF(
+        field_index < 0 || static_cast<uint64_t>(field_index) >= type.getSubtypeCount(),
+        Status::Invalid("Out of bounds field index: ", field_index));
+
+    ColumnStatistics statistics{/*has_null=*/true,
+                                static_cast<int64_t>(stripes_[stripe].num_rows),
+                                nullptr, nullptr};
+    if (stripe >= GetNumberOfStripeStatistics()) {
+      return statistics;
+    }
+    std::unique_ptr<liborc::StripeStatistics> stripe_statistics;
+    ORC_CATCH_NOT_OK(stripe_statistics = reader_->getStripeStatistics(stripe));
+    auto column_id = static_cast<uint32_t>(type.getSubtype(field_index)->getColumnId());
+    const liborc::ColumnStatistics* column_statistics;
+    ORC_CATCH_NOT_OK(column_statistics =
+                         stripe_statistics->getColumnStatistics(column_id));
+    if (column_statistics == nullptr) {
+      return statistics;
+    }
+    statistics.has_null = column_statistics->hasNull();
+    statistics.num_values = static_cast<int64_t>(column_statistics->getNumberOfValues());
+    GetColumnStatisticsBounds(*column_statistics, &statistics.min, &statistics.max);
+    return statistics;
+  }
+
   Result<std::shared_ptr<RecordBatchReader>> NextStripeReader(int64_t batch_size) {
     std::vector<int> empty_vec;
     return NextStripeReader(batch_size, empty_vec);
@@ -618,6 +665,16 @@ int32_t ORCFileReader::GetWriterIdValue() { return impl_->GetWriterIdValue(); }
 
 WriterVersion ORCFileReader::GetWriterVersion() { return impl_->GetWriterVersion(); }
 
+Result<std::shared_ptr<RecordBatchReader>> ORCFileReader::GetStripeReader(
+    int64_t stripe, int64_t batch_size, const std::vector<std::string>& include_names) {
+  return impl_->GetStripeReader(stripe, batch_size, include_names);
+}
+
+Result<ColumnStatistics> ORCFileReader::GetStripeColumnStatistics(int64_t stripe,
+                                                                 int field_index) {
+  return impl_->GetStripeColumnStatistics(stripe, field_index);
+}
+
 int64_t ORCFileReader::GetNumberOfStripeStatistics() {
   return impl_->GetNumberOfStripeStatistics();
 }
@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "arrow/adapters/orc/options.h"
@@ -35,6 +36,20 @@ namespace arrow {
 namespace adapters {
 namespace orc {
 
+/// \brief Statistics of a column, with its bounds converted to Arrow scalars
+struct ARROW_EXPORT ColumnStatistics {
+  /// Whether the writer recorded null values in the column
+  bool has_null;
+  /// The number of non-null values
+  int64_t num_values;
+  /// The smallest and largest non-null values, or null if they are unknown
+  ///
+  /// Bounds are provided for integer (as int64), floating point (as double),
+  /// string and date columns.
+  std::shared_ptr<Scalar> min;
+  std::shared_ptr<Scalar> max;
+};
+
 /// \class ORCFileReader
 /// \brief Read an Arrow Table or RecordBatch from an ORC file.
 class ARROW_EXPORT ORCFileReader {
@@ -151,6 +166,20 @@ class ARROW_EXPORT ORCFileReader {
   Result<std::shared_ptr<RecordBatchReader>> NextStripeReader(
       int64_t batch_size, const std::vector<int>& include_indices);
 
+  /// \brief Get a record batch iterator for a single stripe.
+  ///
+  /// Each record batch will have up to `batch_size` rows. Unlike NextStripeReader
+  /// this doesn't depend on the position of the reader, so readers of different
+  /// stripes may be used at the same time.
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[in] batch_size the maximum number of rows in each record batch
+  /// \param[in] include_names the selected field names to read, if not empty
+  /// (otherwise all fields are read)
+  /// \return the stripe reader
+  Result<std::shared_ptr<RecordBatchReader>> GetStripeReader(
+      int64_t stripe, int64_t batch_size, const std::vector<std::string>& include_names);
+
   /// \brief Get a record batch iterator for the entire file.
   ///
   /// Each record batch will have up to `batch_size` rows.
@@ -215,6 +244,16 @@ class ARROW_EXPORT ORCFileReader {
   /// \return the number of stripe statistics
   int64_t GetNumberOfStripeStatistics();
 
+  /// \brief Get the statistics of a top-level field in a stripe.
+  ///
+  /// If the file has no statistics for the stripe, the bounds are unknown and
+  /// has_null is true.
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[in] field_index the index of the field in the schema
+  /// \return the statistics of the field's column in the stripe
+  Result<ColumnStatistics> GetStripeColumnStatistics(int64_t stripe, int field_index);
+
   /// \brief Get the length of the data stripes in the file.
   ///
   /// \return return the number of bytes in stripes
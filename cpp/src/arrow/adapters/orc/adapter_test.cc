@@ -28,6 +28,7 @@
 #include "arrow/compute/cast.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
@@ -402,6 +403,34 @@ TEST(TestAdapterRead, ReadIntAndStringFileMultipleStripes) {
   }
   EXPECT_EQ(num_rows, stripe_row_count * stripe_count);
   EXPECT_EQ(num_rows / reader_batch_size, batches);
+
+  // test GetStripeReader interface
+  EXPECT_OK_AND_ASSIGN(record_batch_reader,
+                       reader->GetStripeReader(3, reader_batch_size, {"col2"}));
+  ASSERT_EQ(record_batch_reader->schema()->num_fields(), 1);
+  num_rows = 0;
+  for (const auto maybe_batch : *record_batch_reader) {
+    ASSERT_OK_AND_ASSIGN(record_batch, maybe_batch);
+    auto str_array = checked_pointer_cast<StringArray>(record_batch->column(0));
+    for (int j = 0; j < record_batch->num_rows(); ++j) {
+      EXPECT_EQ(std::to_string(num_rows + j), str_array->GetString(j));
+    }
+    num_rows += record_batch->num_rows();
+  }
+  EXPECT_EQ(num_rows, stripe_row_count);
+  ASSERT_RAISES(Invalid, reader->GetStripeReader(stripe_count, reader_batch_size, {}));
+
+  // test GetStripeColumnStatistics interface
+  ASSERT_OK_AND_ASSIGN(auto statistics, reader->GetStripeColumnStatistics(2, 0));
+  EXPECT_FALSE(statistics.has_null);
+  EXPECT_EQ(statistics.num_values, stripe_row_count);
+  AssertScalarsEqual(Int64Scalar(0), *statistics.min, /*verbose=*/true);
+  AssertScalarsEqual(Int64Scalar(stripe_row_count - 1), *statistics.max,
+                     /*verbose=*/true);
+  ASSERT_OK_AND_ASSIGN(statistics, reader->GetStripeColumnStatistics(2, 1));
+  AssertScalarsEqual(StringScalar("0"), *statistics.min, /*verbose=*/true);
+  AssertScalarsEqual(StringScalar("9999"), *statistics.max, /*verbose=*/true);
+  ASSERT_RAISES(Invalid, reader->GetStripeColumnStatistics(2, 2));
 }
 
 // Trivial
@@ -224,13 +224,23 @@ Status AppendBinaryBatch(liborc::ColumnVectorBatch* column_vector_batch, int64_t
   auto builder = checked_cast<BuilderType*>(abuilder);
   auto batch = checked_cast<liborc::StringVectorBatch*>(column_vector_batch);
 
+  // Reserve both the offsets and the character data upfront, so that values are
+  // appended without checking capacity
   const bool has_nulls = batch->hasNulls;
+  int64_t data_length = 0;
   for (int64_t i = offset; i < length + offset; i++) {
     if (!has_nulls || batch->notNull[i]) {
-      RETURN_NOT_OK(
-          builder->Append(batch->data[i], static_cast<int32_t>(batch->length[i])));
+      data_length += batch->length[i];
+    }
+  }
+  RETURN_NOT_OK(builder->Reserve(length));
+  RETURN_NOT_OK(builder->ReserveData(data_length));
+
+  for (int64_t i = offset; i < length + offset; i++) {
+    if (!has_nulls || batch->notNull[i]) {
+      builder->UnsafeAppend(batch->data[i], static_cast<int32_t>(batch->length[i]));
     } else {
-      RETURN_NOT_OK(builder->AppendNull());
+      builder->UnsafeAppendNull();
     }
   }
   return Status::OK();
@@ -241,12 +251,13 @@ Status AppendFixedBinaryBatch(liborc::ColumnVectorBatch* column_vector_batch,
   auto builder = checked_cast<FixedSizeBinaryBuilder*>(abuilder);
   auto batch = checked_cast<liborc::StringVectorBatch*>(column_vector_batch);
 
+  RETURN_NOT_OK(builder->Reserve(length));
   const bool has_nulls = batch->hasNulls;
   for (int64_t i = offset; i < length + offset; i++) {
     if (!has_nulls || batch->notNull[i]) {
-      RETURN_NOT_OK(builder->Append(batch->data[i]));
+      builder->UnsafeAppend(batch->data[i]);
     } else {
-      RETURN_NOT_OK(builder->AppendNull());
+      builder->UnsafeAppendNull();
     }
   }
   return Status::OK();
@@ -257,24 +268,25 @@ Status AppendDecimalBatch(const liborc::Type* type,
                           int64_t length, ArrayBuilder* abuilder) {
   auto builder = checked_cast<Decimal128Builder*>(abuilder);
 
+  RETURN_NOT_OK(builder->Reserve(length));
   const bool has_nulls = column_vector_batch->hasNulls;
   if (type->getPrecision() == 0 || type->getPrecision() > 18) {
     auto batch = checked_cast<liborc::Decimal128VectorBatch*>(column_vector_batch);
     for (int64_t i = offset; i < length + offset; i++) {
       if (!has_nulls || batch->notNull[i]) {
-        RETURN_NOT_OK(builder->Append(
-            Decimal128(batch->values[i].getHighBits(), batch->values[i].getLowBits())));
+        builder->UnsafeAppend(
+            Decimal128(batch->values[i].getHighBits(), batch->values[i].getLowBits()));
       } else {
-        RETURN_NOT_OK(builder->AppendNull());
+        builder->UnsafeAppendNull();
       }
     }
   } else {
     auto batch = checked_cast<liborc::Decimal64VectorBatch*>(column_vector_batch);
     for (int64_t i = offset; i < length + offset; i++) {
       if (!has_nulls || batch->notNull[i]) {
-        RETURN_NOT_OK(builder->Append(Decimal128(batch->values[i])));
+        builder->UnsafeAppend(Decimal128(batch->values[i]));
       } else {
-        RETURN_NOT_OK(builder->AppendNull());
+        builder->UnsafeAppendNull();
       }
     }
   }
@@ -1030,6 +1042,40 @@ Result<std::shared_ptr<DataType>> GetArrowType(const liborc::Type* type) {
   }
 }
 
+void GetColumnStatisticsBounds(const liborc::ColumnStatistics& statistics,
+                               std::shared_ptr<Scalar>* min,
+                               std::shared_ptr<Scalar>* max) {
+  min->reset();
+  max->reset();
+  if (auto integer_statistics =
+          dynamic_cast<const liborc::IntegerColumnStatistics*>(&statistics)) {
+    if (integer_statistics->hasMinimum() && integer_statistics->hasMaximum()) {
+      *min = std::make_shared<Int64Scalar>(integer_statistics->getMinimum());
+      *max = std::make_shared<Int64Scalar>(integer_statistics->getMaximum());
+    }
+  } else if (auto double_statistics =
+                 dynamic_cast<const liborc::DoubleColumnStatistics*>(&statistics)) {
+    if (double_statistics->hasMinimum() && double_statistics->hasMaximum() &&
+        !std::isnan(double_statistics->getMinimum()) &&
+        !std::isnan(double_statistics->getMaximum())) {
+      *min = std::make_shared<DoubleScalar>(double_statistics->getMinimum());
+      *max = std::make_shared<DoubleScalar>(double_statistics->getMaximum());
+    }
+  } else if (auto string_statistics =
+                 dynamic_cast<const liborc::StringColumnStatistics*>(&statistics)) {
+    if (string_statistics->hasMinimum() && string_statistics->hasMaximum()) {
+      *min = std::make_shared<StringScalar>(std::string(string_statistics->getMinimum()));
+      *max = std::make_shared<StringScalar>(std::string(string_statistics->getMaximum()));
+    }
+  } else if (auto date_statistics =
+                 dynamic_cast<const liborc::DateColumnStatistics*>(&statistics)) {
+    if (date_statistics->hasMinimum() && date_statistics->hasMaximum()) {
+      *min = std::make_shared<Date32Scalar>(date_statistics->getMinimum());
+      *max = std::make_shared<Date32Scalar>(date_statistics->getMaximum());
+    }
+  }
+}
+
 Result<ORC_UNIQUE_PTR<liborc::Type>> GetOrcType(const Schema& schema) {
   int numFields = schema.num_fields();
   ORC_UNIQUE_PTR<liborc::Type> out_type = liborc::createStructType();
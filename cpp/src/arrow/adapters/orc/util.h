@@ -23,6 +23,7 @@
 #include "arrow/array/builder_base.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/type_fwd.h"
 #include "orc/OrcFile.hh"
 
 namespace liborc = orc;
@@ -38,6 +39,14 @@ Result<ORC_UNIQUE_PTR<liborc::Type>> GetOrcType(const Schema& schema);
 Status AppendBatch(const liborc::Type* type, liborc::ColumnVectorBatch* batch,
                    int64_t offset, int64_t length, arrow::ArrayBuilder* builder);
 
+/// \brief Convert the bounds of ORC column statistics to Arrow scalars
+///
+/// min and max are set to null when the bounds are unknown or the statistics
+/// are of an unsupported kind.
+void GetColumnStatisticsBounds(const liborc::ColumnStatistics& statistics,
+                               std::shared_ptr<Scalar>* min,
+                               std::shared_ptr<Scalar>* max);
+
 /// \brief Write a chunked array to an orc::ColumnVectorBatch
 ///
 /// \param[in] chunked_array the chunked array
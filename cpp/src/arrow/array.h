@@ -40,5 +40,6 @@
 #include "arrow/array/array_dict.h"       // IWYU pragma: keep
 #include "arrow/array/array_nested.h"     // IWYU pragma: keep
 #include "arrow/array/array_primitive.h"  // IWYU pragma: keep
+#include "arrow/array/array_run_end.h"    // IWYU pragma: keep
 #include "arrow/array/data.h"             // IWYU pragma: keep
 #include "arrow/array/util.h"             // IWYU pragma: keep
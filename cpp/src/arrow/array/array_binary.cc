@@ -89,6 +89,34 @@ LargeStringArray::LargeStringArray(int64_t length,
 
 Status LargeStringArray::ValidateUTF8() const { return internal::ValidateUTF8(*data_); }
 
+BinaryViewArray::BinaryViewArray(const std::shared_ptr<ArrayData>& data) {
+  ARROW_CHECK(is_binary_view_like(data->type->id()));
+  SetData(data);
+}
+
+BinaryViewArray::BinaryViewArray(int64_t length, const std::shared_ptr<Buffer>& views,
+                                 const std::shared_ptr<Buffer>& data,
+                                 const std::shared_ptr<Buffer>& null_bitmap,
+                                 int64_t null_count, int64_t offset) {
+  SetData(ArrayData::Make(binary_view(), length, {null_bitmap, views, data}, null_count,
+                          offset));
+}
+
+StringViewArray::StringViewArray(const std::shared_ptr<ArrayData>& data) {
+  ARROW_CHECK_EQ(data->type->id(), Type::STRING_VIEW);
+  SetData(data);
+}
+
+StringViewArray::StringViewArray(int64_t length, const std::shared_ptr<Buffer>& views,
+                                 const std::shared_ptr<Buffer>& data,
+                                 const std::shared_ptr<Buffer>& null_bitmap,
+                                 int64_t null_count, int64_t offset) {
+  SetData(ArrayData::Make(utf8_view(), length, {null_bitmap, views, data}, null_count,
+                          offset));
+}
+
+Status StringViewArray::ValidateUTF8() const { return internal::ValidateUTF8(*data_); }
+
 FixedSizeBinaryArray::FixedSizeBinaryArray(const std::shared_ptr<ArrayData>& data) {
   SetData(data);
 }
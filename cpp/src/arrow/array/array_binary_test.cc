@@ -17,7 +17,9 @@
 
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -43,6 +45,7 @@
 namespace arrow {
 
 using internal::checked_cast;
+using internal::checked_pointer_cast;
 
 // ----------------------------------------------------------------------
 // String / Binary tests
@@ -293,6 +296,21 @@ class TestStringArray : public ::testing::Test {
     ASSERT_RAISES(Invalid, ValidateFull(1, {0, -1, -1}, "data", 1));
     // Offsets non-monotonic
     ASSERT_RAISES(Invalid, ValidateFull(2, {0, 5, 4}, "some data"));
+
+    // Errors past the first block of offsets
+    const std::string long_data(3000, 'x');
+    std::vector<offset_type> long_offsets(long_data.size() + 1);
+    std::iota(long_offsets.begin(), long_offsets.end(), 0);
+    ASSERT_OK(ValidateFull(3000, long_offsets, long_data));
+    long_offsets[2500] = 2498;
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        Invalid, ::testing::HasSubstr("non-monotonic offset at slot 2500"),
+        ValidateFull(3000, long_offsets, long_data));
+    long_offsets[2500] = 2500;
+    long_offsets[2999] = 3001;
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        Invalid, ::testing::HasSubstr("offset for slot 2999 out of bounds"),
+        ValidateFull(2999, long_offsets, long_data));
   }
 
   void TestValidateData() {
@@ -309,15 +327,28 @@ class TestStringArray : public ::testing::Test {
     auto st2 = ValidateFull(1, {0, 4}, "\xf4\x90\x80\x80");
     // Single UTF8 character straddles two entries
     auto st3 = ValidateFull(2, {0, 1, 2}, "\xc3\xa9");
+    // Same, past the first block of offsets
+    const std::string long_data = std::string(2000, 'x') + "\xc3\xa9";
+    std::vector<offset_type> long_offsets(long_data.size() + 1);
+    std::iota(long_offsets.begin(), long_offsets.end(), 0);
+    auto st4 = ValidateFull(2002, long_offsets, long_data);
     if (T::is_utf8) {
       ASSERT_RAISES(Invalid, st1);
       ASSERT_RAISES(Invalid, st2);
       ASSERT_RAISES(Invalid, st3);
+      ASSERT_RAISES(Invalid, st4);
     } else {
       ASSERT_OK(st1);
       ASSERT_OK(st2);
       ASSERT_OK(st3);
+      ASSERT_OK(st4);
     }
+
+    // Invalid data behind a null slot is accepted
+    std::vector<offset_type> offsets = {0, 1, 2, 3};
+    ArrayType arr(3, Buffer::Wrap(offsets), std::make_shared<Buffer>("a\xff\x62"),
+                  /*null_bitmap=*/Buffer::FromString("\x05"), /*null_count=*/1);
+    ASSERT_OK(arr.ValidateFull());
   }
 
  protected:
@@ -600,6 +631,26 @@ class TestStringBuilder : public ::testing::Test {
     CheckStringArray(*result_, {"", "bb", "a", "", "ccc"}, {1, 1, 1, 0, 1}, reps);
   }
 
+  void TestAppendOffsetsAndData() {
+    // Values "bb", "a", null, "", "ccc" in the middle of a buffer; the null slot
+    // has two bytes of data, which are copied along
+    const std::string data = "xxbbaddccc";
+    const std::vector<offset_type> offsets = {2, 4, 5, 7, 7, 10};
+    const uint8_t bitmap[] = {0x6C};  // 01101100, the values start at bit 2
+    const auto values = reinterpret_cast<const uint8_t*>(data.data());
+
+    ASSERT_OK(builder_->Append("zz"));
+    ASSERT_OK(builder_->AppendValues(offsets.data(), values, 5, bitmap, 2));
+    ASSERT_OK(builder_->AppendValues(offsets.data(), values, 0));
+    ASSERT_OK(builder_->AppendValues(offsets.data() + 3, values, 2));
+    Done();
+
+    auto expected = ArrayFromJSON(TypeTraits<T>::type_singleton(),
+                                  R"(["zz", "bb", "a", null, "", "ccc", "", "ccc"])");
+    AssertArraysEqual(*expected, *result_);
+    ASSERT_EQ(14, result_->value_data()->size());
+  }
+
   void TestCapacityReserve() {
     std::vector<std::string> strings = {"aaaaa", "bbbbbbbbbb", "ccccccccccccccc",
                                         "dddddddddd"};
@@ -696,6 +747,10 @@ TYPED_TEST(TestStringBuilder, TestAppendCStringsWithoutValidBytes) {
   this->TestAppendCStringsWithoutValidBytes();
 }
 
+TYPED_TEST(TestStringBuilder, TestAppendOffsetsAndData) {
+  this->TestAppendOffsetsAndData();
+}
+
 TYPED_TEST(TestStringBuilder, TestCapacityReserve) { this->TestCapacityReserve(); }
 
 TYPED_TEST(TestStringBuilder, TestZeroLength) { this->TestZeroLength(); }
@@ -858,6 +913,113 @@ TEST(TestChunkedStringBuilder, BasicOperation) {
   }
 }
 
+// ----------------------------------------------------------------------
+// BinaryView / StringView tests
+
+class TestBinaryViewArray : public ::testing::Test {
+ protected:
+  using View = BinaryViewType::c_type;
+
+  const std::string long_value_ = "a value longer than twelve bytes";
+};
+
+TEST_F(TestBinaryViewArray, Basics) {
+  StringViewBuilder builder;
+  ASSERT_OK(builder.Append("short"));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Append(long_value_));
+  ASSERT_OK(builder.AppendEmptyValue());
+  ASSERT_EQ(4, builder.length());
+  ASSERT_EQ(long_value_.size(), builder.value_data_length());
+
+  std::shared_ptr<StringViewArray> array;
+  ASSERT_OK(builder.Finish(&array));
+  ASSERT_OK(array->ValidateFull());
+  AssertTypeEqual(*utf8_view(), *array->type());
+
+  ASSERT_EQ(1, array->null_count());
+  ASSERT_EQ("short", array->GetString(0));
+  ASSERT_TRUE(array->IsNull(1));
+  ASSERT_EQ(long_value_, array->GetString(2));
+  ASSERT_EQ("", array->GetString(3));
+
+  // Short values are inlined, only the long value is in the data buffer
+  const View* views = array->raw_views();
+  ASSERT_TRUE(views[0].is_inline());
+  ASSERT_FALSE(views[2].is_inline());
+  ASSERT_EQ(0, views[2].ref.offset);
+  ASSERT_EQ(static_cast<int64_t>(long_value_.size()), array->value_data()->size());
+
+  AssertArraysEqual(*ArrayFromJSON(utf8_view(), R"(["short", null,
+                                     "a value longer than twelve bytes", ""])"),
+                    *array);
+}
+
+TEST_F(TestBinaryViewArray, SliceAndEquals) {
+  auto array = ArrayFromJSON(binary_view(), R"(["a", "a value longer than twelve bytes",
+                                               null, "a value longer than twelve bytes"])");
+  ASSERT_OK(array->ValidateFull());
+  auto sliced = array->Slice(1, 2);
+  ASSERT_OK(sliced->ValidateFull());
+  AssertArraysEqual(
+      *ArrayFromJSON(binary_view(), R"(["a value longer than twelve bytes", null])"),
+      *sliced);
+  ASSERT_TRUE(array->RangeEquals(1, 2, 3, array));
+  ASSERT_FALSE(array->RangeEquals(0, 1, 1, array));
+
+  // Equal values are equal regardless of where the data buffer holds them
+  auto other = ArrayFromJSON(binary_view(), R"(["a value longer than twelve bytes"])");
+  ASSERT_TRUE(array->RangeEquals(3, 4, 0, other));
+}
+
+TEST_F(TestBinaryViewArray, ValidateFull) {
+  auto array = checked_pointer_cast<BinaryViewArray>(
+      ArrayFromJSON(binary_view(), R"(["abc", "a value longer than twelve bytes"])"));
+  ASSERT_OK(array->ValidateFull());
+
+  auto validate_corrupted = [&](std::function<void(View*)> mutate) {
+    auto data = array->data()->Copy();
+    auto views = *AllocateBuffer(data->buffers[1]->size());
+    std::memcpy(views->mutable_data(), data->buffers[1]->data(), views->size());
+    mutate(reinterpret_cast<View*>(views->mutable_data()));
+    data->buffers[1] = std::move(views);
+    return MakeArray(data)->ValidateFull();
+  };
+
+  // Out-of-line value beyond the end of the data buffer
+  ASSERT_RAISES(Invalid,
+                validate_corrupted([](View* views) { views[1].ref.offset = 10; }));
+  // Prefix differing from the data
+  ASSERT_RAISES(Invalid,
+                validate_corrupted([](View* views) { views[1].ref.prefix[0] = 'x'; }));
+  // Non-zero padding after an inline value
+  ASSERT_RAISES(Invalid,
+                validate_corrupted([](View* views) { views[0].inlined.data[5] = 'x'; }));
+  // Negative size
+  ASSERT_RAISES(Invalid,
+                validate_corrupted([](View* views) { views[0].inlined.size = -1; }));
+
+  StringViewBuilder builder;
+  ASSERT_OK(builder.Append("\xff"));
+  ASSERT_OK_AND_ASSIGN(auto invalid_utf8, builder.Finish());
+  ASSERT_OK(invalid_utf8->Validate());
+  ASSERT_RAISES(Invalid, invalid_utf8->ValidateFull());
+}
+
+TEST_F(TestBinaryViewArray, AppendArraySlice) {
+  auto array = ArrayFromJSON(
+      utf8_view(), R"(["x", null, "a value longer than twelve bytes", "y"])");
+  StringViewBuilder builder;
+  ASSERT_OK(builder.AppendArraySlice(*array->data(), 1, 3));
+  ASSERT_OK(builder.AppendArraySlice(*array->data(), 0, 1));
+  std::shared_ptr<Array> result;
+  ASSERT_OK(builder.Finish(&result));
+  ASSERT_OK(result->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(utf8_view(), R"([null,
+                      "a value longer than twelve bytes", "y", "x"])"),
+                    *result);
+}
+
 // ----------------------------------------------------------------------
 // ArraySpanVisitor<binary-like> tests
 
@@ -40,6 +40,8 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visit_type_inline.h"
 
 namespace arrow {
@@ -333,6 +335,9 @@ struct MakeUnifier {
   }
 };
 
+// Below this many indices and dictionary values, unification stays sequential
+constexpr int64_t kMinParallelUnifyLength = 1 << 16;
+
 struct RecursiveUnifier {
   MemoryPool* pool;
 
@@ -373,18 +378,31 @@ struct RecursiveUnifier {
       // XXX Ideally, we should unify dictionaries nested in value_type first,
       // but DictionaryUnifier doesn't supported nested dictionaries anyway,
       // so this will fail.
-      ARROW_ASSIGN_OR_RAISE(auto unifier,
-                            DictionaryUnifier::Make(dict_type.value_type(), this->pool));
+      const int num_chunks = static_cast<int>(chunks->size());
+      int64_t total_length = 0;
+      for (const auto& chunk : *chunks) {
+        DCHECK_NE(chunk->dictionary, nullptr);
+        total_length += chunk->length + chunk->dictionary->length;
+      }
+      const bool use_threads = internal::ShouldUseCpuThreadPool(
+          num_chunks, total_length, kMinParallelUnifyLength);
       // Unify all dictionary array chunks
       BufferVector transpose_maps(chunks->size());
-      for (size_t j = 0; j < chunks->size(); ++j) {
-        DCHECK_NE((*chunks)[j]->dictionary, nullptr);
+      std::shared_ptr<Array> dictionary;
+      if (use_threads) {
         RETURN_NOT_OK(
-            unifier->Unify(*MakeArray((*chunks)[j]->dictionary), &transpose_maps[j]));
+            UnifyInGroups(dict_type, *chunks, &transpose_maps, &dictionary));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(auto unifier, DictionaryUnifier::Make(
+                                                dict_type.value_type(), this->pool));
+        for (size_t j = 0; j < chunks->size(); ++j) {
+          RETURN_NOT_OK(
+              unifier->Unify(*MakeArray((*chunks)[j]->dictionary), &transpose_maps[j]));
+        }
+        RETURN_NOT_OK(
+            unifier->GetResultWithIndexType(dict_type.index_type(), &dictionary));
       }
-      std::shared_ptr<Array> dictionary;
-      RETURN_NOT_OK(unifier->GetResultWithIndexType(dict_type.index_type(), &dictionary));
-      for (size_t j = 0; j < chunks->size(); ++j) {
+      RETURN_NOT_OK(internal::OptionalParallelFor(use_threads, num_chunks, [&](int j) {
         ARROW_ASSIGN_OR_RAISE(
             (*chunks)[j],
             TransposeDictIndices(
@@ -393,12 +411,63 @@ struct RecursiveUnifier {
         if (ext_type) {
           (*chunks)[j]->type = ext_type;
         }
-      }
+        return Status::OK();
+      }));
       changed = true;
     }
 
     return changed;
   }
+
+  // Unify contiguous groups of chunks in parallel, then unify the group
+  // dictionaries in order.  This yields the same dictionary as unifying
+  // all chunks one after the other.
+  Status UnifyInGroups(const DictionaryType& dict_type, const ArrayDataVector& chunks,
+                       BufferVector* transpose_maps,
+                       std::shared_ptr<Array>* out_dictionary) {
+    const int num_chunks = static_cast<int>(chunks.size());
+    const int num_groups = std::min(num_chunks, GetCpuThreadPoolCapacity());
+    auto group_begin = [&](int group) {
+      return static_cast<int>(static_cast<int64_t>(group) * num_chunks / num_groups);
+    };
+
+    // Transpose each chunk's dictionary into its group's dictionary
+    BufferVector local_maps(chunks.size());
+    ArrayVector group_dictionaries(num_groups);
+    RETURN_NOT_OK(internal::ParallelFor(num_groups, [&](int group) {
+      ARROW_ASSIGN_OR_RAISE(auto unifier,
+                            DictionaryUnifier::Make(dict_type.value_type(), this->pool));
+      for (int j = group_begin(group); j < group_begin(group + 1); ++j) {
+        RETURN_NOT_OK(unifier->Unify(*MakeArray(chunks[j]->dictionary), &local_maps[j]));
+      }
+      return unifier->GetResultWithIndexType(int32(), &group_dictionaries[group]);
+    }));
+
+    // Transpose each group's dictionary into the final dictionary
+    ARROW_ASSIGN_OR_RAISE(auto unifier,
+                          DictionaryUnifier::Make(dict_type.value_type(), this->pool));
+    BufferVector group_maps(num_groups);
+    for (int group = 0; group < num_groups; ++group) {
+      RETURN_NOT_OK(unifier->Unify(*group_dictionaries[group], &group_maps[group]));
+    }
+    RETURN_NOT_OK(
+        unifier->GetResultWithIndexType(dict_type.index_type(), out_dictionary));
+
+    // Compose both transpositions
+    return internal::ParallelFor(num_groups, [&](int group) {
+      const auto group_map = reinterpret_cast<const int32_t*>(group_maps[group]->data());
+      for (int j = group_begin(group); j < group_begin(group + 1); ++j) {
+        const int64_t length = local_maps[j]->size() / sizeof(int32_t);
+        ARROW_ASSIGN_OR_RAISE((*transpose_maps)[j],
+                              AllocateBuffer(length * sizeof(int32_t), this->pool));
+        internal::TransposeInts(
+            reinterpret_cast<const int32_t*>(local_maps[j]->data()),
+            reinterpret_cast<int32_t*>((*transpose_maps)[j]->mutable_data()), length,
+            group_map);
+      }
+      return Status::OK();
+    });
+  }
 };
 
 }  // namespace
@@ -433,9 +502,14 @@ Result<std::shared_ptr<ChunkedArray>> DictionaryUnifier::UnifyChunkedArray(
 Result<std::shared_ptr<Table>> DictionaryUnifier::UnifyTable(const Table& table,
                                                              MemoryPool* pool) {
   ChunkedArrayVector columns = table.columns();
-  for (auto& col : columns) {
-    ARROW_ASSIGN_OR_RAISE(col, DictionaryUnifier::UnifyChunkedArray(col, pool));
-  }
+  const bool use_threads = internal::ShouldUseCpuThreadPool(
+      table.num_columns(), table.num_rows(), kMinParallelUnifyLength);
+  RETURN_NOT_OK(internal::OptionalParallelFor(
+      use_threads, table.num_columns(), [&](int i) -> Status {
+        ARROW_ASSIGN_OR_RAISE(columns[i],
+                              DictionaryUnifier::UnifyChunkedArray(columns[i], pool));
+        return Status::OK();
+      }));
   return Table::Make(table.schema(), std::move(columns), table.num_rows());
 }
 
@@ -172,7 +172,8 @@ class ARROW_EXPORT DictionaryUnifier {
 
   /// \brief Return a unified dictionary with the given index type.  If
   /// the index type is not large enough then an invalid status will be returned.
-  /// The unifier cannot be used after this is called
+  /// The unifier may still be used after this is called, unifying further
+  /// dictionaries whose values are appended to the unified dictionary
   virtual Status GetResultWithIndexType(const std::shared_ptr<DataType>& index_type,
                                         std::shared_ptr<Array>* out_dict) = 0;
 };
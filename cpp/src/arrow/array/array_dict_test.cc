@@ -1584,6 +1584,52 @@ TEST(TestDictionaryUnifier, ChunkedArraySimple) {
   CheckDictionaryArray(unified->chunk(3), expected_dict, ArrayFromJSON(int8(), "[]"));
 }
 
+TEST(TestDictionaryUnifier, ChunkedArrayManyChunks) {
+  // Enough data to unify chunks in parallel: the result should be the same
+  // as unifying the chunks one after the other
+  constexpr int kNumChunks = 16;
+  constexpr int kDictLength = 200;
+  constexpr int kLength = 8192;
+  auto type = dictionary(int16(), int64());
+  ArrayVector chunks;
+  ASSERT_OK_AND_ASSIGN(auto unifier, DictionaryUnifier::Make(int64()));
+  for (int c = 0; c < kNumChunks; ++c) {
+    std::vector<int64_t> dict_values(kDictLength);
+    for (int k = 0; k < kDictLength; ++k) {
+      dict_values[k] = (c * 37 + k * 7) % 1000;
+    }
+    std::vector<int16_t> indices(kLength);
+    for (int i = 0; i < kLength; ++i) {
+      indices[i] = static_cast<int16_t>((i * 13 + c) % kDictLength);
+    }
+    std::shared_ptr<Array> dict, index_array;
+    ArrayFromVector<Int64Type>(dict_values, &dict);
+    ArrayFromVector<Int16Type>(indices, &index_array);
+    ASSERT_OK(unifier->Unify(*dict));
+    chunks.push_back(std::make_shared<DictionaryArray>(type, index_array, dict));
+  }
+  std::shared_ptr<DataType> expected_type;
+  std::shared_ptr<Array> expected_dict;
+  ASSERT_OK(unifier->GetResult(&expected_type, &expected_dict));
+  ASSERT_OK_AND_ASSIGN(auto chunked, ChunkedArray::Make(chunks));
+
+  ASSERT_OK_AND_ASSIGN(auto unified, DictionaryUnifier::UnifyChunkedArray(chunked));
+  ASSERT_EQ(unified->num_chunks(), kNumChunks);
+  const auto& expected_values = checked_cast<const Int64Array&>(*expected_dict);
+  for (int c = 0; c < kNumChunks; ++c) {
+    const auto& original = checked_cast<const DictionaryArray&>(*chunks[c]);
+    const auto& actual = checked_cast<const DictionaryArray&>(*unified->chunk(c));
+    AssertArraysEqual(*expected_dict, *actual.dictionary());
+    const auto& original_dict = checked_cast<const Int64Array&>(*original.dictionary());
+    const auto& original_indices = checked_cast<const Int16Array&>(*original.indices());
+    const auto& actual_indices = checked_cast<const Int16Array&>(*actual.indices());
+    for (int i = 0; i < kLength; ++i) {
+      ASSERT_EQ(expected_values.Value(actual_indices.Value(i)),
+                original_dict.Value(original_indices.Value(i)));
+    }
+  }
+}
+
 TEST(TestDictionaryUnifier, ChunkedArrayZeroChunk) {
   auto type = dictionary(int8(), utf8());
   ASSERT_OK_AND_ASSIGN(auto chunked, ChunkedArray::Make(ArrayVector{}, type));
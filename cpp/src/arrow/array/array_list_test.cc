@@ -341,6 +341,45 @@ class TestListArray : public ::testing::Test {
     ValidateBasicListArray(result_.get(), values, is_valid);
   }
 
+  void TestBulkAppendBitmap() {
+    std::vector<int16_t> values = {0, 1, 2, 3, 4, 5, 6};
+    std::vector<offset_type> offsets = {0, 3, 3};
+    const uint8_t bitmap[] = {0x14};  // 00010100, the values start at bit 2
+
+    ASSERT_OK(builder_->ReserveValues(values.size()));
+    Int16Builder* vb = checked_cast<Int16Builder*>(builder_->value_builder());
+    ASSERT_GE(vb->capacity(), static_cast<int64_t>(values.size()));
+
+    ASSERT_OK(builder_->AppendValues(offsets.data(), offsets.size(), bitmap, 2));
+    ASSERT_OK(vb->AppendValues(values));
+    Done();
+    ValidateBasicListArray(result_.get(), values, {1, 0, 1});
+  }
+
+  void TestAppendArraySlice() {
+    // [[0], [1, 2], null, [5], [], [6, 7, 8], null, [9]], where the first null is
+    // backed by child values, which are copied along
+    auto values = ArrayFromJSON(value_type_, "[0, 1, 2, 3, 4, 5, 6, 7, 8, 9]");
+    std::vector<offset_type> offsets = {0, 1, 3, 5, 6, 6, 9, 9, 10};
+    std::vector<uint8_t> bitmap = {0xBB};
+    auto list_array = MakeArray(ArrayData::Make(
+        type_, 8, {Buffer::Wrap(bitmap), Buffer::Wrap(offsets)}, {values->data()}, 2));
+    ASSERT_OK(list_array->ValidateFull());
+    ArraySpan sliced(*list_array->Slice(1, 6)->data());
+
+    ASSERT_OK(builder_->AppendNull());
+    ASSERT_OK(builder_->AppendArraySlice(sliced, 1, 5));
+    ASSERT_OK(builder_->AppendArraySlice(sliced, 0, 0));
+    ASSERT_OK(builder_->AppendArraySlice(sliced, 0, 2));
+    Done();
+    ASSERT_OK(result_->ValidateFull());
+
+    auto expected =
+        ArrayFromJSON(type_, "[null, null, [5], [], [6, 7, 8], null, [1, 2], null]");
+    AssertArraysEqual(*expected, *result_);
+    ASSERT_EQ(10, result_->values()->length());
+  }
+
   void TestBulkAppendInvalid() {
     std::vector<int16_t> values = {0, 1, 2, 3, 4, 5, 6};
     std::vector<int> lengths = {3, 0, 4};
@@ -545,6 +584,10 @@ TYPED_TEST(TestListArray, AppendNulls) { this->TestAppendNulls(); }
 
 TYPED_TEST(TestListArray, BulkAppend) { this->TestBulkAppend(); }
 
+TYPED_TEST(TestListArray, BulkAppendBitmap) { this->TestBulkAppendBitmap(); }
+
+TYPED_TEST(TestListArray, AppendArraySlice) { this->TestAppendArraySlice(); }
+
 TYPED_TEST(TestListArray, BulkAppendInvalid) { this->TestBulkAppendInvalid(); }
 
 TYPED_TEST(TestListArray, ZeroLength) { this->TestZeroLength(); }
@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/data.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+// ----------------------------------------------------------------------
+// RunEndEncodedArray
+
+/// \brief Array type for run-end encoded data
+///
+/// A run-end encoded array stores each run of equal consecutive values once.
+/// For example, the array
+///
+///   ["foo", "foo", "foo", null, null, "bar"]
+///
+/// has run-end encoded representation
+///
+///   run_ends: [3, 5, 6]
+///   values: ["foo", null, "bar"]
+///
+/// The array offset and length are logical: they refer to positions in the
+/// decoded data, and the children are usually not sliced.
+class ARROW_EXPORT RunEndEncodedArray : public Array {
+ public:
+  using TypeClass = RunEndEncodedType;
+
+  explicit RunEndEncodedArray(const std::shared_ptr<ArrayData>& data);
+
+  RunEndEncodedArray(const std::shared_ptr<DataType>& type, int64_t length,
+                     const std::shared_ptr<Array>& run_ends,
+                     const std::shared_ptr<Array>& values, int64_t offset = 0);
+
+  /// \brief Construct a RunEndEncodedArray from run ends and values, checking
+  /// that they are consistent with each other and with the logical length
+  ///
+  /// \param[in] logical_length the logical length of the array
+  /// \param[in] run_ends an int16, int32 or int64 array without nulls
+  /// \param[in] values the run values, of the same length as run_ends
+  /// \param[in] logical_offset the logical offset into the runs
+  static Result<std::shared_ptr<RunEndEncodedArray>> Make(
+      int64_t logical_length, const std::shared_ptr<Array>& run_ends,
+      const std::shared_ptr<Array>& values, int64_t logical_offset = 0);
+
+  /// \brief The run ends, without the logical offset applied
+  const std::shared_ptr<Array>& run_ends() const { return run_ends_; }
+
+  /// \brief The run values, without the logical offset applied
+  const std::shared_ptr<Array>& values() const { return values_; }
+
+  /// \brief The physical index of the run containing the given logical index
+  int64_t FindPhysicalIndex(int64_t i) const;
+
+  /// \brief The physical index of the first run overlapping the logical range
+  int64_t FindPhysicalOffset() const;
+
+  /// \brief The number of runs overlapping the logical range
+  int64_t FindPhysicalLength() const;
+
+  const RunEndEncodedType* ree_type() const { return ree_type_; }
+
+ private:
+  void SetData(const std::shared_ptr<ArrayData>& data);
+
+  const RunEndEncodedType* ree_type_;
+  std::shared_ptr<Array> run_ends_;
+  std::shared_ptr<Array> values_;
+};
+
+}  // namespace arrow
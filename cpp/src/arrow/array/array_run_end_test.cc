@@ -0,0 +1,160 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/pretty_print.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+class TestRunEndEncodedArray
+    : public ::testing::TestWithParam<std::shared_ptr<DataType>> {
+ protected:
+  std::shared_ptr<RunEndEncodedArray> MakeArray(int64_t length,
+                                                const std::string& run_ends_json,
+                                                const std::string& values_json,
+                                                int64_t offset = 0) {
+    auto run_ends = ArrayFromJSON(GetParam(), run_ends_json);
+    auto values = ArrayFromJSON(utf8(), values_json);
+    EXPECT_OK_AND_ASSIGN(auto array,
+                         RunEndEncodedArray::Make(length, run_ends, values, offset));
+    return array;
+  }
+};
+
+TEST_P(TestRunEndEncodedArray, MakeAndAccessors) {
+  auto array = MakeArray(6, "[3, 5, 6]", R"(["foo", null, "bar"])");
+  ASSERT_OK(array->ValidateFull());
+  ASSERT_EQ(array->length(), 6);
+  ASSERT_EQ(array->null_count(), 0);
+  ASSERT_TRUE(array->type()->Equals(run_end_encoded(GetParam(), utf8())));
+  AssertArraysEqual(*array->run_ends(), *ArrayFromJSON(GetParam(), "[3, 5, 6]"));
+  ASSERT_EQ(array->FindPhysicalIndex(0), 0);
+  ASSERT_EQ(array->FindPhysicalIndex(3), 1);
+  ASSERT_EQ(array->FindPhysicalIndex(5), 2);
+  ASSERT_EQ(array->FindPhysicalOffset(), 0);
+  ASSERT_EQ(array->FindPhysicalLength(), 3);
+
+  // Run ends and values must be consistent
+  auto run_ends = ArrayFromJSON(GetParam(), "[3, 5, 6]");
+  auto values = ArrayFromJSON(utf8(), R"(["foo", null])");
+  ASSERT_RAISES(Invalid, RunEndEncodedArray::Make(6, run_ends, values));
+  ASSERT_RAISES(TypeError,
+                RunEndEncodedArray::Make(6, ArrayFromJSON(utf8(), R"(["a"])"), values));
+}
+
+TEST_P(TestRunEndEncodedArray, Slice) {
+  auto array = MakeArray(6, "[3, 5, 6]", R"(["foo", null, "bar"])");
+  auto slice = checked_pointer_cast<RunEndEncodedArray>(array->Slice(2, 3));
+  ASSERT_OK(slice->ValidateFull());
+  ASSERT_EQ(slice->FindPhysicalOffset(), 0);
+  ASSERT_EQ(slice->FindPhysicalLength(), 2);
+  ASSERT_EQ(slice->FindPhysicalIndex(1), 1);
+
+  ASSERT_TRUE(slice->Equals(*MakeArray(3, "[1, 3]", R"(["foo", null])")));
+  ASSERT_TRUE(array->RangeEquals(*slice, 2, 5, 0));
+  ASSERT_FALSE(array->RangeEquals(*slice, 1, 4, 0));
+}
+
+TEST_P(TestRunEndEncodedArray, EqualsWithDifferentRuns) {
+  // Equality is defined on logical values, independently of the split into runs
+  auto left = MakeArray(5, "[2, 5]", R"(["a", "b"])");
+  auto right = MakeArray(5, "[1, 2, 4, 5]", R"(["a", "a", "b", "b"])");
+  ASSERT_TRUE(left->Equals(*right));
+  auto other = MakeArray(5, "[2, 4, 5]", R"(["a", "b", "c"])");
+  ASSERT_FALSE(left->Equals(*other));
+}
+
+TEST_P(TestRunEndEncodedArray, GetScalar) {
+  auto array = MakeArray(6, "[3, 5, 6]", R"(["foo", null, "bar"])");
+  ASSERT_OK_AND_ASSIGN(auto scalar, array->GetScalar(4));
+  const auto& ree_scalar = checked_cast<const RunEndEncodedScalar&>(*scalar);
+  ASSERT_FALSE(ree_scalar.value->is_valid);
+  ASSERT_OK_AND_ASSIGN(scalar, array->GetScalar(5));
+  AssertScalarsEqual(*MakeScalar("bar"),
+                     *checked_cast<const RunEndEncodedScalar&>(*scalar).value);
+}
+
+TEST_P(TestRunEndEncodedArray, Validate) {
+  auto run_ends = ArrayFromJSON(GetParam(), "[3, 2, 6]");
+  auto values = ArrayFromJSON(utf8(), R"(["foo", null, "bar"])");
+  RunEndEncodedArray array(run_end_encoded(GetParam(), utf8()), 6, run_ends, values);
+  ASSERT_OK(array.Validate());
+  ASSERT_RAISES(Invalid, array.ValidateFull());
+
+  RunEndEncodedArray too_long(run_end_encoded(GetParam(), utf8()), 7,
+                              ArrayFromJSON(GetParam(), "[3, 5, 6]"), values);
+  ASSERT_RAISES(Invalid, too_long.Validate());
+}
+
+TEST_P(TestRunEndEncodedArray, Concatenate) {
+  auto first = MakeArray(4, "[2, 4]", R"(["a", "b"])");
+  auto second = MakeArray(3, "[1, 3]", R"(["c", null])");
+  ASSERT_OK_AND_ASSIGN(auto concatenated, Concatenate({first, second->Slice(1)}));
+  ASSERT_OK(concatenated->ValidateFull());
+  AssertArraysEqual(*MakeArray(6, "[2, 4, 6]", R"(["a", "b", null])"), *concatenated,
+                    /*verbose=*/true);
+}
+
+TEST_P(TestRunEndEncodedArray, MakeArrayOfNullAndFromScalar) {
+  auto type = run_end_encoded(GetParam(), utf8());
+  ASSERT_OK_AND_ASSIGN(auto nulls, MakeArrayOfNull(type, 5));
+  ASSERT_OK(nulls->ValidateFull());
+  ASSERT_EQ(nulls->null_count(), 0);
+  ASSERT_EQ(checked_cast<const RunEndEncodedArray&>(*nulls).values()->null_count(), 1);
+
+  auto scalar = std::make_shared<RunEndEncodedScalar>(MakeScalar("x"), type);
+  ASSERT_OK_AND_ASSIGN(auto repeated, MakeArrayFromScalar(*scalar, 4));
+  ASSERT_OK(repeated->ValidateFull());
+  AssertArraysEqual(*MakeArray(4, "[4]", R"(["x"])"), *repeated);
+}
+
+TEST_P(TestRunEndEncodedArray, PrettyPrint) {
+  auto array = MakeArray(6, "[3, 5, 6]", R"(["foo", null, "bar"])");
+  std::stringstream ss;
+  ASSERT_OK(PrettyPrint(*array, 0, &ss));
+  ASSERT_NE(ss.str().find("-- run_ends:"), std::string::npos);
+  ASSERT_NE(ss.str().find("-- values:"), std::string::npos);
+}
+
+INSTANTIATE_TEST_SUITE_P(RunEndTypes, TestRunEndEncodedArray,
+                         ::testing::Values(int16(), int32(), int64()));
+
+TEST(TestRunEndEncodedType, Basics) {
+  auto type = run_end_encoded(int32(), float64());
+  ASSERT_EQ(type->id(), Type::RUN_END_ENCODED);
+  ASSERT_EQ(type->ToString(), "run_end_encoded<run_ends: int32, values: double>");
+  ASSERT_TRUE(type->Equals(run_end_encoded(int32(), float64())));
+  ASSERT_FALSE(type->Equals(run_end_encoded(int64(), float64())));
+  ASSERT_FALSE(type->Equals(run_end_encoded(int32(), int64())));
+  ASSERT_RAISES(TypeError, RunEndEncodedType::Make(uint32(), float64()));
+}
+
+}  // namespace arrow
@@ -431,6 +431,32 @@ TEST_F(TestStructBuilder, BulkAppend) {
                            list_lengths, list_offsets, int_values);
 }
 
+TEST_F(TestStructBuilder, BulkAppendBitmap) {
+  const uint8_t struct_bitmap[] = {0x5A};  // 01011010, the values start at bit 1
+  const uint8_t list_bitmap[] = {0x0D};    // 00001101
+  std::vector<int> list_offsets = {0, 3, 3, 6};
+
+  ListBuilder* list_vb = checked_cast<ListBuilder*>(builder_->field_builder(0));
+  Int8Builder* char_vb = checked_cast<Int8Builder*>(list_vb->value_builder());
+  Int32Builder* int_vb = checked_cast<Int32Builder*>(builder_->field_builder(1));
+
+  ASSERT_OK(builder_->AppendValues(4, struct_bitmap, 1));
+  ASSERT_OK(list_vb->AppendValues(list_offsets.data(), list_offsets.size(), list_bitmap,
+                                  0));
+  ASSERT_OK(char_vb->AppendValues({'j', 'o', 'e', 'b', 'o', 'b', 'm', 'a', 'r', 'k'}));
+  ASSERT_OK(int_vb->AppendValues({1, 2, 3, 4}));
+  Done();
+  ASSERT_OK(result_->ValidateFull());
+
+  ASSERT_EQ(1, result_->null_count());
+  ASSERT_TRUE(result_->IsNull(1));
+  AssertArraysEqual(*ArrayFromJSON(list(int8()),
+                                   "[[106, 111, 101], null, [98, 111, 98], "
+                                   "[109, 97, 114, 107]]"),
+                    *result_->field(0));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2, 3, 4]"), *result_->field(1));
+}
+
 TEST_F(TestStructBuilder, BulkAppendInvalid) {
   std::vector<int32_t> int_values = {1, 2, 3, 4};
   std::vector<char> list_values = {'j', 'o', 'e', 'b', 'o', 'b', 'm', 'a', 'r', 'k'};
@@ -129,6 +129,85 @@ util::string_view FixedSizeBinaryBuilder::GetView(int64_t i) const {
                            byte_width_);
 }
 
+// ----------------------------------------------------------------------
+// BinaryViewBuilder
+
+Status BinaryViewBuilder::AppendNull() {
+  RETURN_NOT_OK(Reserve(1));
+  UnsafeAppendNull();
+  return Status::OK();
+}
+
+Status BinaryViewBuilder::AppendNulls(int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(length, false);
+  views_builder_.UnsafeAppend(length, binary_view_util::MakeView(nullptr, 0, 0));
+  return Status::OK();
+}
+
+Status BinaryViewBuilder::AppendEmptyValue() {
+  RETURN_NOT_OK(Reserve(1));
+  UnsafeAppendToBitmap(true);
+  views_builder_.UnsafeAppend(binary_view_util::MakeView(nullptr, 0, 0));
+  return Status::OK();
+}
+
+Status BinaryViewBuilder::AppendEmptyValues(int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(length, true);
+  views_builder_.UnsafeAppend(length, binary_view_util::MakeView(nullptr, 0, 0));
+  return Status::OK();
+}
+
+Status BinaryViewBuilder::AppendArraySlice(const ArraySpan& array, int64_t offset,
+                                           int64_t length) {
+  const auto* views = array.GetValues<BinaryViewType::c_type>(1) + offset;
+  const uint8_t* data = array.buffers[2].data;
+  const uint8_t* validity = array.MayHaveNulls() ? array.buffers[0].data : nullptr;
+  auto is_valid = [&](int64_t i) {
+    return validity == nullptr || bit_util::GetBit(validity, array.offset + offset + i);
+  };
+  RETURN_NOT_OK(Reserve(length));
+  int64_t out_of_line_bytes = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    if (is_valid(i) && !views[i].is_inline()) {
+      out_of_line_bytes += views[i].size();
+    }
+  }
+  RETURN_NOT_OK(ReserveData(out_of_line_bytes));
+  for (int64_t i = 0; i < length; ++i) {
+    if (is_valid(i)) {
+      UnsafeAppend(binary_view_util::FromView(views[i], data));
+    } else {
+      UnsafeAppendNull();
+    }
+  }
+  return Status::OK();
+}
+
+void BinaryViewBuilder::Reset() {
+  ArrayBuilder::Reset();
+  views_builder_.Reset();
+  value_data_builder_.Reset();
+}
+
+Status BinaryViewBuilder::Resize(int64_t capacity) {
+  RETURN_NOT_OK(CheckCapacity(capacity));
+  RETURN_NOT_OK(views_builder_.Resize(capacity));
+  return ArrayBuilder::Resize(capacity);
+}
+
+Status BinaryViewBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  std::shared_ptr<Buffer> views, data, null_bitmap;
+  RETURN_NOT_OK(views_builder_.Finish(&views));
+  RETURN_NOT_OK(value_data_builder_.Finish(&data));
+  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+  *out = ArrayData::Make(type(), length_, {null_bitmap, views, data}, null_count_);
+
+  capacity_ = length_ = null_count_ = 0;
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // ChunkedArray builders
 
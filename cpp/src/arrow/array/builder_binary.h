@@ -35,6 +35,7 @@
 #include "arrow/buffer_builder.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string_view.h"  // IWYU pragma: export
 #include "arrow/util/visibility.h"
@@ -278,23 +279,42 @@ class BaseBinaryBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
-  Status AppendArraySlice(const ArraySpan& array, int64_t offset,
-                          int64_t length) override {
-    auto bitmap = array.GetValues<uint8_t>(0, 0);
-    auto offsets = array.GetValues<offset_type>(1);
-    auto data = array.GetValues<uint8_t>(2, 0);
-    for (int64_t i = 0; i < length; i++) {
-      if (!bitmap || bit_util::GetBit(bitmap, array.offset + offset + i)) {
-        const offset_type start = offsets[offset + i];
-        const offset_type end = offsets[offset + i + 1];
-        ARROW_RETURN_NOT_OK(Append(data + start, end - start));
-      } else {
-        ARROW_RETURN_NOT_OK(AppendNull());
-      }
+  /// \brief Append a run of values laid out as offsets into contiguous data.
+  ///
+  /// Value i spans data[offsets[i], offsets[i + 1]).  The whole data range is
+  /// copied at once and the offsets are rebased, so there are no per-value
+  /// capacity checks.  The bytes of null values are copied as well.
+  ///
+  /// \param[in] offsets length + 1 non-decreasing offsets into data
+  /// \param[in] data the value bytes
+  /// \param[in] length the number of values to append
+  /// \param[in] bitmap an optional validity bitmap (all valid if null)
+  /// \param[in] bitmap_offset the offset of the first value in the bitmap
+  /// \return Status
+  Status AppendValues(const offset_type* offsets, const uint8_t* data, int64_t length,
+                      const uint8_t* bitmap = NULLPTR, int64_t bitmap_offset = 0) {
+    if (length == 0) {
+      return Status::OK();
     }
+    const int64_t data_length = static_cast<int64_t>(offsets[length]) - offsets[0];
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    ARROW_RETURN_NOT_OK(ReserveData(data_length));
+    const int64_t shift = value_data_builder_.length() - offsets[0];
+    for (int64_t i = 0; i < length; ++i) {
+      offsets_builder_.UnsafeAppend(static_cast<offset_type>(offsets[i] + shift));
+    }
+    value_data_builder_.UnsafeAppend(data + offsets[0], data_length);
+    UnsafeAppendToBitmap(bitmap, bitmap_offset, length);
     return Status::OK();
   }
 
+  Status AppendArraySlice(const ArraySpan& array, int64_t offset,
+                          int64_t length) override {
+    return AppendValues(array.GetValues<offset_type>(1) + offset,
+                        array.GetValues<uint8_t>(2, 0), length,
+                        array.GetValues<uint8_t>(0, 0), array.offset + offset);
+  }
+
   void Reset() override {
     ArrayBuilder::Reset();
     offsets_builder_.Reset();
@@ -456,6 +476,139 @@ class ARROW_EXPORT LargeStringBuilder : public LargeBinaryBuilder {
   std::shared_ptr<DataType> type() const override { return large_utf8(); }
 };
 
+// ----------------------------------------------------------------------
+// BinaryViewBuilder and StringViewBuilder
+
+/// \class BinaryViewBuilder
+/// \brief Builder class for variable-length binary view data
+///
+/// Values longer than BinaryViewType::kInlineSize are copied to a single
+/// data buffer, shorter ones are stored in their view.
+class ARROW_EXPORT BinaryViewBuilder : public ArrayBuilder {
+ public:
+  using TypeClass = BinaryViewType;
+
+  explicit BinaryViewBuilder(MemoryPool* pool = default_memory_pool())
+      : ArrayBuilder(pool), views_builder_(pool), value_data_builder_(pool) {}
+
+  BinaryViewBuilder(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : BinaryViewBuilder(pool) {}
+
+  Status Append(const uint8_t* value, int32_t length) {
+    ARROW_RETURN_NOT_OK(Reserve(1));
+    if (length > BinaryViewType::kInlineSize) {
+      ARROW_RETURN_NOT_OK(ReserveData(length));
+    }
+    UnsafeAppend(value, length);
+    return Status::OK();
+  }
+
+  Status Append(const char* value, int32_t length) {
+    return Append(reinterpret_cast<const uint8_t*>(value), length);
+  }
+
+  Status Append(util::string_view value) {
+    return Append(value.data(), static_cast<int32_t>(value.size()));
+  }
+
+  Status AppendNull() final;
+  Status AppendNulls(int64_t length) final;
+
+  Status AppendEmptyValue() final;
+  Status AppendEmptyValues(int64_t length) final;
+
+  Status AppendArraySlice(const ArraySpan& array, int64_t offset,
+                          int64_t length) override;
+
+  /// \brief Append without checking capacity
+  ///
+  /// Both Reserve() and ReserveData() (for values which are not inlined)
+  /// must have been called beforehand.
+  void UnsafeAppend(const uint8_t* value, int32_t length) {
+    UnsafeAppendToBitmap(true);
+    views_builder_.UnsafeAppend(binary_view_util::MakeView(
+        value, length, static_cast<int32_t>(value_data_builder_.length())));
+    if (length > BinaryViewType::kInlineSize) {
+      value_data_builder_.UnsafeAppend(value, length);
+    }
+  }
+
+  void UnsafeAppend(const char* value, int32_t length) {
+    UnsafeAppend(reinterpret_cast<const uint8_t*>(value), length);
+  }
+
+  void UnsafeAppend(util::string_view value) {
+    UnsafeAppend(value.data(), static_cast<int32_t>(value.size()));
+  }
+
+  void UnsafeAppendNull() {
+    UnsafeAppendToBitmap(false);
+    views_builder_.UnsafeAppend(binary_view_util::MakeView(NULLPTR, 0, 0));
+  }
+
+  Status ValidateOverflow(int64_t new_bytes) const {
+    auto new_size = value_data_builder_.length() + new_bytes;
+    if (ARROW_PREDICT_FALSE(new_size > memory_limit())) {
+      return Status::CapacityError("array cannot contain more than ", memory_limit(),
+                                   " bytes, have ", new_size);
+    } else {
+      return Status::OK();
+    }
+  }
+
+  /// \brief Ensures there is enough allocated capacity to append the indicated
+  /// number of bytes to the value data buffer without additional allocations
+  Status ReserveData(int64_t elements) {
+    ARROW_RETURN_NOT_OK(ValidateOverflow(elements));
+    return value_data_builder_.Reserve(elements);
+  }
+
+  void Reset() override;
+  Status Resize(int64_t capacity) override;
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+
+  /// \cond FALSE
+  using ArrayBuilder::Finish;
+  /// \endcond
+
+  Status Finish(std::shared_ptr<BinaryViewArray>* out) { return FinishTyped(out); }
+
+  /// \return size of the data buffer so far (inlined values excluded)
+  int64_t value_data_length() const { return value_data_builder_.length(); }
+
+  /// Temporary access to a value.
+  ///
+  /// This view becomes invalid on the next modifying operation.
+  util::string_view GetView(int64_t i) const {
+    return binary_view_util::FromView(views_builder_.data()[i],
+                                      value_data_builder_.data());
+  }
+
+  /// Data offsets in views are 32-bit
+  static constexpr int64_t memory_limit() { return kBinaryMemoryLimit; }
+
+  std::shared_ptr<DataType> type() const override { return binary_view(); }
+
+ protected:
+  TypedBufferBuilder<BinaryViewType::c_type> views_builder_;
+  TypedBufferBuilder<uint8_t> value_data_builder_;
+};
+
+/// \class StringViewBuilder
+/// \brief Builder class for UTF8 string views
+class ARROW_EXPORT StringViewBuilder : public BinaryViewBuilder {
+ public:
+  using BinaryViewBuilder::BinaryViewBuilder;
+
+  /// \cond FALSE
+  using ArrayBuilder::Finish;
+  /// \endcond
+
+  Status Finish(std::shared_ptr<StringViewArray>* out) { return FinishTyped(out); }
+
+  std::shared_ptr<DataType> type() const override { return utf8_view(); }
+};
+
 // ----------------------------------------------------------------------
 // FixedSizeBinaryBuilder
 
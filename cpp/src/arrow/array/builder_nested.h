@@ -90,6 +90,25 @@ class BaseListBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  /// \brief Vector append with a validity bitmap
+  ///
+  /// As above, but validity is read from bitmap starting at bitmap_offset
+  /// (all valid if bitmap is null).
+  Status AppendValues(const offset_type* offsets, int64_t length, const uint8_t* bitmap,
+                      int64_t bitmap_offset) {
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    UnsafeAppendToBitmap(bitmap, bitmap_offset, length);
+    offsets_builder_.UnsafeAppend(offsets, length);
+    return Status::OK();
+  }
+
+  /// \brief Ensure there is enough allocated capacity to append the indicated
+  /// number of child values without additional allocations
+  Status ReserveValues(int64_t elements) {
+    ARROW_RETURN_NOT_OK(ValidateOverflow(elements));
+    return value_builder_->Reserve(elements);
+  }
+
   /// \brief Start a new variable-length list slot
   ///
   /// This function should be called before beginning to append elements to the
@@ -128,18 +147,22 @@ class BaseListBuilder : public ArrayBuilder {
 
   Status AppendArraySlice(const ArraySpan& array, int64_t offset,
                           int64_t length) override {
-    const offset_type* offsets = array.GetValues<offset_type>(1);
+    if (length == 0) {
+      return Status::OK();
+    }
+    // Append the child values of the whole slice at once and rebase the offsets
+    const offset_type* offsets = array.GetValues<offset_type>(1) + offset;
     const uint8_t* validity = array.MayHaveNulls() ? array.buffers[0].data : NULLPTR;
-    for (int64_t row = offset; row < offset + length; row++) {
-      if (!validity || bit_util::GetBit(validity, array.offset + row)) {
-        ARROW_RETURN_NOT_OK(Append());
-        int64_t slot_length = offsets[row + 1] - offsets[row];
-        ARROW_RETURN_NOT_OK(value_builder_->AppendArraySlice(array.child_data[0],
-                                                             offsets[row], slot_length));
-      } else {
-        ARROW_RETURN_NOT_OK(AppendNull());
-      }
+    const int64_t num_values = offsets[length] - offsets[0];
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    ARROW_RETURN_NOT_OK(ValidateOverflow(num_values));
+    const int64_t shift = value_builder_->length() - offsets[0];
+    ARROW_RETURN_NOT_OK(
+        value_builder_->AppendArraySlice(array.child_data[0], offsets[0], num_values));
+    for (int64_t i = 0; i < length; ++i) {
+      offsets_builder_.UnsafeAppend(static_cast<offset_type>(offsets[i] + shift));
     }
+    UnsafeAppendToBitmap(validity, array.offset + offset, length);
     return Status::OK();
   }
 
@@ -488,6 +511,14 @@ class ARROW_EXPORT StructBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  /// As above, but validity is read from bitmap starting at bitmap_offset
+  /// (all valid if bitmap is null).
+  Status AppendValues(int64_t length, const uint8_t* bitmap, int64_t bitmap_offset) {
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    UnsafeAppendToBitmap(bitmap, bitmap_offset, length);
+    return Status::OK();
+  }
+
   /// Append an element to the Struct. All child-builders' Append method must
   /// be called independently to maintain data-structure consistency.
   Status Append(bool is_valid = true) {
@@ -539,9 +570,7 @@ class ARROW_EXPORT StructBuilder : public ArrayBuilder {
                                                          array.offset + offset, length));
     }
     const uint8_t* validity = array.MayHaveNulls() ? array.buffers[0].data : NULLPTR;
-    ARROW_RETURN_NOT_OK(Reserve(length));
-    UnsafeAppendToBitmap(validity, array.offset + offset, length);
-    return Status::OK();
+    return AppendValues(length, validity, array.offset + offset);
   }
 
   void Reset() override;
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -41,6 +42,8 @@
 #include "arrow/util/int_util.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/ree_util.h"
 #include "arrow/visit_type_inline.h"
 
 namespace arrow {
@@ -95,11 +98,56 @@ Status ConcatenateBitmaps(const std::vector<Bitmap>& bitmaps, MemoryPool* pool,
   return Status::OK();
 }
 
+// The total size of the buffers from which they are concatenated in parallel
+constexpr int64_t kMinParallelConcatenateBytes = 1 << 22;
+
+// Allocate a buffer and concatenate buffers into it, copying large inputs in
+// parallel on the CPU thread pool.
+Result<std::shared_ptr<Buffer>> ConcatenateValueBuffers(const BufferVector& buffers,
+                                                        MemoryPool* pool) {
+  int64_t out_length = 0;
+  for (const auto& buffer : buffers) {
+    out_length += buffer->size();
+  }
+  // The copies are split in pieces, so that a few large buffers are also copied
+  // by several threads
+  constexpr int64_t kPieceSize = 1 << 20;
+  const auto num_pieces = static_cast<int>(bit_util::CeilDiv(out_length, kPieceSize));
+  if (!internal::ShouldUseCpuThreadPool(num_pieces, out_length,
+                                        kMinParallelConcatenateBytes)) {
+    return ConcatenateBuffers(buffers, pool);
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> out, AllocateBuffer(out_length, pool));
+  uint8_t* out_data = out->mutable_data();
+  struct Piece {
+    const uint8_t* src;
+    uint8_t* dst;
+    int64_t size;
+  };
+  std::vector<Piece> pieces;
+  for (const auto& buffer : buffers) {
+    for (int64_t position = 0; position < buffer->size(); position += kPieceSize) {
+      const int64_t size = std::min(kPieceSize, buffer->size() - position);
+      pieces.push_back({buffer->data() + position, out_data, size});
+      out_data += size;
+    }
+  }
+  RETURN_NOT_OK(internal::ParallelFor(static_cast<int>(pieces.size()), [&](int i) {
+    std::memcpy(pieces[i].dst, pieces[i].src, static_cast<size_t>(pieces[i].size));
+    return Status::OK();
+  }));
+  return out;
+}
+
+// Compute the range of values spanned by the offsets in src, checking that they
+// can be adjusted such that first_offset is the first one.
+template <typename Offset>
+Status GetValuesRange(const Buffer& src, Offset first_offset, Range* values_range);
+
 // Write offsets in src into dst, adjusting them such that first_offset
 // will be the first offset written.
 template <typename Offset>
-Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset, Offset* dst,
-                  Range* values_range);
+void PutOffsets(const Buffer& src, Offset first_offset, Offset* dst);
 
 // Concatenate buffers holding offsets into a single buffer of offsets,
 // also computing the ranges of values spanned by each buffer of offsets.
@@ -117,26 +165,40 @@ Status ConcatenateOffsets(const BufferVector& buffers, MemoryPool* pool,
   ARROW_ASSIGN_OR_RAISE(*out, AllocateBuffer((out_length + 1) * sizeof(Offset), pool));
   auto dst = reinterpret_cast<Offset*>((*out)->mutable_data());
 
+  // Compute where the offsets of each buffer are written first, so that they can
+  // be written in parallel
+  std::vector<int64_t> elements_positions(buffers.size());
+  std::vector<Offset> first_offsets(buffers.size());
   int64_t elements_length = 0;
   Offset values_length = 0;
   for (size_t i = 0; i < buffers.size(); ++i) {
     // the first offset from buffers[i] will be adjusted to values_length
     // (the cumulative length of values spanned by offsets in previous buffers)
-    RETURN_NOT_OK(PutOffsets<Offset>(buffers[i], values_length, &dst[elements_length],
-                                     &values_ranges->at(i)));
+    RETURN_NOT_OK(
+        GetValuesRange<Offset>(*buffers[i], values_length, &values_ranges->at(i)));
+    elements_positions[i] = elements_length;
+    first_offsets[i] = values_length;
     elements_length += buffers[i]->size() / sizeof(Offset);
     values_length += static_cast<Offset>(values_ranges->at(i).length);
   }
 
+  const bool use_threads = internal::ShouldUseCpuThreadPool(
+      static_cast<int>(buffers.size()), out_length * static_cast<int64_t>(sizeof(Offset)),
+      kMinParallelConcatenateBytes);
+  RETURN_NOT_OK(internal::OptionalParallelFor(
+      use_threads, static_cast<int>(buffers.size()), [&](int i) {
+        PutOffsets<Offset>(*buffers[i], first_offsets[i], &dst[elements_positions[i]]);
+        return Status::OK();
+      }));
+
   // the final element in dst is the length of all values spanned by the offsets
   dst[out_length] = values_length;
   return Status::OK();
 }
 
 template <typename Offset>
-Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset, Offset* dst,
-                  Range* values_range) {
-  if (src->size() == 0) {
+Status GetValuesRange(const Buffer& src, Offset first_offset, Range* values_range) {
+  if (src.size() == 0) {
     // It's allowed to have an empty offsets buffer for a 0-length array
     // (see Array::Validate)
     values_range->offset = 0;
@@ -144,9 +206,8 @@ Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset, Offse
     return Status::OK();
   }
 
-  // Get the range of offsets to transfer from src
-  auto src_begin = reinterpret_cast<const Offset*>(src->data());
-  auto src_end = reinterpret_cast<const Offset*>(src->data() + src->size());
+  auto src_begin = reinterpret_cast<const Offset*>(src.data());
+  auto src_end = reinterpret_cast<const Offset*>(src.data() + src.size());
 
   // Compute the range of values which is spanned by this range of offsets
   values_range->offset = src_begin[0];
@@ -154,6 +215,18 @@ Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset, Offse
   if (first_offset > std::numeric_limits<Offset>::max() - values_range->length) {
     return Status::Invalid("offset overflow while concatenating arrays");
   }
+  return Status::OK();
+}
+
+template <typename Offset>
+void PutOffsets(const Buffer& src, Offset first_offset, Offset* dst) {
+  if (src.size() == 0) {
+    return;
+  }
+
+  // Get the range of offsets to transfer from src
+  auto src_begin = reinterpret_cast<const Offset*>(src.data());
+  auto src_end = reinterpret_cast<const Offset*>(src.data() + src.size());
 
   // Write offsets into dst, ensuring that the first offset written is
   // first_offset
@@ -164,7 +237,6 @@ Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset, Offse
   std::transform(src_begin, src_end, dst, [adjustment](Offset offset) {
     return SafeSignedAdd(offset, adjustment);
   });
-  return Status::OK();
 }
 
 class ConcatenateImpl {
@@ -206,7 +278,7 @@ class ConcatenateImpl {
   Status Visit(const FixedWidthType& fixed) {
     // Handles numbers, decimal128, decimal256, fixed_size_binary
     ARROW_ASSIGN_OR_RAISE(auto buffers, Buffers(1, fixed));
-    return ConcatenateBuffers(buffers, pool_).Value(&out_->buffers[1]);
+    return ConcatenateValueBuffers(buffers, pool_).Value(&out_->buffers[1]);
   }
 
   Status Visit(const BinaryType&) {
@@ -215,7 +287,7 @@ class ConcatenateImpl {
     RETURN_NOT_OK(ConcatenateOffsets<int32_t>(index_buffers, pool_, &out_->buffers[1],
                                               &value_ranges));
     ARROW_ASSIGN_OR_RAISE(auto value_buffers, Buffers(2, value_ranges));
-    return ConcatenateBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
+    return ConcatenateValueBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
   }
 
   Status Visit(const LargeBinaryType&) {
@@ -224,7 +296,40 @@ class ConcatenateImpl {
     RETURN_NOT_OK(ConcatenateOffsets<int64_t>(index_buffers, pool_, &out_->buffers[1],
                                               &value_ranges));
     ARROW_ASSIGN_OR_RAISE(auto value_buffers, Buffers(2, value_ranges));
-    return ConcatenateBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
+    return ConcatenateValueBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
+  }
+
+  Status Visit(const BinaryViewType&) {
+    // The data buffers are appended whole and the views referring to them
+    // are shifted accordingly
+    using View = BinaryViewType::c_type;
+    ARROW_ASSIGN_OR_RAISE(auto view_buffers, Buffers(1, BinaryViewType::kSize));
+    ARROW_ASSIGN_OR_RAISE(auto views_buffer,
+                          ConcatenateValueBuffers(view_buffers, pool_));
+    auto* views = reinterpret_cast<View*>(views_buffer->mutable_data());
+    BufferVector data_buffers;
+    int64_t data_offset = 0;
+    for (const auto& array_data : in_) {
+      if (data_offset > 0) {
+        const auto adjustment = static_cast<int32_t>(data_offset);
+        for (int64_t i = 0; i < array_data->length; ++i) {
+          if (!views[i].is_inline()) {
+            views[i].ref.offset = SafeSignedAdd(views[i].ref.offset, adjustment);
+          }
+        }
+      }
+      views += array_data->length;
+      const auto& data = array_data->buffers[2];
+      if (data != nullptr) {
+        data_buffers.push_back(data);
+        data_offset += data->size();
+        if (data_offset > std::numeric_limits<int32_t>::max()) {
+          return Status::Invalid("offset overflow while concatenating arrays");
+        }
+      }
+    }
+    out_->buffers[1] = std::move(views_buffer);
+    return ConcatenateValueBuffers(data_buffers, pool_).Value(&out_->buffers[2]);
   }
 
   Status Visit(const ListType&) {
@@ -340,7 +445,7 @@ class ConcatenateImpl {
     ARROW_ASSIGN_OR_RAISE(auto index_buffers, Buffers(1, *fixed));
     if (dictionaries_same) {
       out_->dictionary = in_[0]->dictionary;
-      return ConcatenateBuffers(index_buffers, pool_).Value(&out_->buffers[1]);
+      return ConcatenateValueBuffers(index_buffers, pool_).Value(&out_->buffers[1]);
     } else {
       ARROW_ASSIGN_OR_RAISE(auto index_lookup, UnifyDictionaries(d));
       ARROW_ASSIGN_OR_RAISE(out_->buffers[1],
@@ -355,7 +460,7 @@ class ConcatenateImpl {
 
     // Concatenate the type buffers.
     ARROW_ASSIGN_OR_RAISE(auto type_buffers, Buffers(1, sizeof(int8_t)));
-    RETURN_NOT_OK(ConcatenateBuffers(type_buffers, pool_).Value(&out_->buffers[1]));
+    RETURN_NOT_OK(ConcatenateValueBuffers(type_buffers, pool_).Value(&out_->buffers[1]));
 
     // Concatenate the child data. For sparse unions the child data is sliced
     // based on the offset and length of the array data. For dense unions the
@@ -436,11 +541,65 @@ class ConcatenateImpl {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    switch (type.run_end_type()->id()) {
+      case Type::INT16:
+        return ConcatenateRunEndEncoded<int16_t>(type);
+      case Type::INT32:
+        return ConcatenateRunEndEncoded<int32_t>(type);
+      default:
+        DCHECK_EQ(type.run_end_type()->id(), Type::INT64);
+        return ConcatenateRunEndEncoded<int64_t>(type);
+    }
+  }
+
   Status Visit(const ExtensionType& e) {
     // XXX can we just concatenate their storage?
     return Status::NotImplemented("concatenation of ", e);
   }
 
+  template <typename RunEndCType>
+  Status ConcatenateRunEndEncoded(const RunEndEncodedType& type) {
+    if (out_->length > std::numeric_limits<RunEndCType>::max()) {
+      return Status::Invalid("Length of concatenated run-end encoded array (",
+                             out_->length, ") overflows run end type ",
+                             *type.run_end_type());
+    }
+    // Only the runs overlapping each input's logical range are kept
+    ArrayDataVector values_data;
+    values_data.reserve(in_.size());
+    int64_t num_runs = 0;
+    for (const auto& array_data : in_) {
+      const ArraySpan span(*array_data);
+      const int64_t physical_offset = ree_util::FindPhysicalOffset(span);
+      const int64_t physical_length = ree_util::FindPhysicalLength(span);
+      ARROW_ASSIGN_OR_RAISE(auto values, array_data->child_data[1]->SliceSafe(
+                                             physical_offset, physical_length));
+      values_data.push_back(std::move(values));
+      num_runs += physical_length;
+    }
+
+    TypedBufferBuilder<RunEndCType> run_ends_builder(pool_);
+    RETURN_NOT_OK(run_ends_builder.Reserve(num_runs));
+    int64_t logical_base = 0;
+    for (const auto& array_data : in_) {
+      RETURN_NOT_OK(ree_util::VisitRuns<RunEndCType>(
+          ArraySpan(*array_data), [&](int64_t logical_begin, int64_t run_length, int64_t) {
+            run_ends_builder.UnsafeAppend(
+                static_cast<RunEndCType>(logical_base + logical_begin + run_length));
+            return Status::OK();
+          }));
+      logical_base += array_data->length;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto run_ends_buffer, run_ends_builder.Finish());
+
+    out_->null_count = 0;
+    out_->child_data[0] = ArrayData::Make(type.run_end_type(), num_runs,
+                                          {nullptr, std::move(run_ends_buffer)},
+                                          /*null_count=*/0);
+    return ConcatenateImpl(values_data, pool_).Concatenate(&out_->child_data[1]);
+  }
+
  private:
   // NOTE: Concatenate() can be called during IPC reads to append delta dictionaries
   // on non-validated input.  Therefore, the input-checking SliceBufferSafe and
@@ -141,6 +141,19 @@ TYPED_TEST(PrimitiveConcatenateTest, Primitives) {
   });
 }
 
+TEST_F(ConcatenateTest, LargeInputs) {
+  // Large enough to be concatenated in parallel
+  auto strings = rng_.String(300000, /*min_length =*/0, /*max_length =*/60, 0.1);
+  auto integers = rng_.Int64(1000000, 0, 1000, 0.1);
+  for (const auto& array : {strings, integers}) {
+    auto offsets = Offsets<int32_t>(static_cast<int32_t>(array->length()), 5);
+    auto expected = array->Slice(offsets.front(), offsets.back() - offsets.front());
+    ASSERT_OK_AND_ASSIGN(auto actual, Concatenate(Slices(array, offsets)));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*expected, *actual);
+  }
+}
+
 TEST_F(ConcatenateTest, NullType) {
   Check([](int32_t size, double null_probability, std::shared_ptr<Array>* out) {
     *out = std::make_shared<NullArray>(size);
@@ -217,11 +217,14 @@ int GetNumBuffers(const DataType& type) {
     case Type::NA:
     case Type::STRUCT:
     case Type::FIXED_SIZE_LIST:
+    case Type::RUN_END_ENCODED:
       return 1;
     case Type::BINARY:
     case Type::LARGE_BINARY:
     case Type::STRING:
     case Type::LARGE_STRING:
+    case Type::BINARY_VIEW:
+    case Type::STRING_VIEW:
     case Type::DENSE_UNION:
       return 3;
     case Type::EXTENSION:
@@ -31,6 +31,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
@@ -156,6 +157,49 @@ struct DictionaryTraits<T, enable_if_base_binary<T>> {
   }
 };
 
+template <typename T>
+struct DictionaryTraits<T, enable_if_binary_view_like<T>> {
+  using MemoTableType = typename HashTraits<T>::MemoTableType;
+
+  static Status GetDictionaryArrayData(MemoryPool* pool,
+                                       const std::shared_ptr<DataType>& type,
+                                       const MemoTableType& memo_table,
+                                       int64_t start_offset,
+                                       std::shared_ptr<ArrayData>* out) {
+    auto dict_length = static_cast<int64_t>(memo_table.size() - start_offset);
+    std::vector<int32_t> offsets(dict_length + 1);
+    memo_table.CopyOffsets(static_cast<int32_t>(start_offset), offsets.data());
+
+    // Create the data buffer, the views refer to it for the values that are
+    // too long to be inlined
+    auto values_size = memo_table.values_size();
+    ARROW_ASSIGN_OR_RAISE(auto dict_data, AllocateBuffer(values_size, pool));
+    if (values_size > 0) {
+      memo_table.CopyValues(static_cast<int32_t>(start_offset), dict_data->size(),
+                            dict_data->mutable_data());
+    }
+
+    // Create the views buffer
+    ARROW_ASSIGN_OR_RAISE(auto dict_views,
+                          AllocateBuffer(BinaryViewType::kSize * dict_length, pool));
+    auto raw_views = reinterpret_cast<BinaryViewType::c_type*>(dict_views->mutable_data());
+    for (int64_t i = 0; i < dict_length; ++i) {
+      raw_views[i] = binary_view_util::MakeView(dict_data->data() + offsets[i],
+                                                offsets[i + 1] - offsets[i], offsets[i]);
+    }
+
+    int64_t null_count = 0;
+    std::shared_ptr<Buffer> null_bitmap = nullptr;
+    RETURN_NOT_OK(
+        ComputeNullBitmap(pool, memo_table, start_offset, &null_count, &null_bitmap));
+
+    *out = ArrayData::Make(type, dict_length,
+                           {null_bitmap, std::move(dict_views), std::move(dict_data)},
+                           null_count);
+    return Status::OK();
+  }
+};
+
 template <typename T>
 struct DictionaryTraits<T, enable_if_fixed_size_binary<T>> {
   using MemoTableType = typename HashTraits<T>::MemoTableType;
@@ -38,6 +38,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
@@ -54,6 +55,17 @@ using internal::checked_cast;
 
 namespace {
 
+// Run ends of a run-end encoded array made of a single run (or of no run at all
+// if the length is 0)
+Result<std::shared_ptr<Array>> MakeSingleRunEnds(const RunEndEncodedType& type,
+                                                 int64_t length, MemoryPool* pool) {
+  if (length == 0) {
+    return MakeEmptyArray(type.run_end_type(), pool);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto run_end, MakeScalar(type.run_end_type(), length));
+  return MakeArrayFromScalar(*run_end, 1, pool);
+}
+
 class ArrayDataWrapper {
  public:
   ArrayDataWrapper(const std::shared_ptr<ArrayData>& data, std::shared_ptr<Array>* out)
@@ -264,6 +276,32 @@ class ArrayDataEndianSwapper {
     return Status::OK();
   }
 
+  Status Visit(const BinaryViewType& type) {
+    using View = BinaryViewType::c_type;
+    const auto& in_buffer = data_->buffers[1];
+    if (in_buffer == nullptr || in_buffer->size() == 0) {
+      out_->buffers[1] = in_buffer;
+    } else {
+      auto in_data = reinterpret_cast<const View*>(in_buffer->data());
+      ARROW_ASSIGN_OR_RAISE(auto out_buffer, AllocateBuffer(in_buffer->size()));
+      auto out_data = reinterpret_cast<View*>(out_buffer->mutable_data());
+      // NOTE: data_->length not trusted (see warning above)
+      int64_t length = in_buffer->size() / sizeof(View);
+      for (int64_t i = 0; i < length; i++) {
+        View view = in_data[i];
+        view.inlined.size = bit_util::ByteSwap(view.inlined.size);
+        if (!view.is_inline()) {
+          view.ref.buffer_index = bit_util::ByteSwap(view.ref.buffer_index);
+          view.ref.offset = bit_util::ByteSwap(view.ref.offset);
+        }
+        out_data[i] = view;
+      }
+      out_->buffers[1] = std::move(out_buffer);
+    }
+    out_->buffers[2] = data_->buffers[2];
+    return Status::OK();
+  }
+
   Status Visit(const ListType& type) {
     RETURN_NOT_OK(SwapOffsets<int32_t>(1));
     return Status::OK();
@@ -273,6 +311,11 @@ class ArrayDataEndianSwapper {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    // Only the children hold data
+    return Status::OK();
+  }
+
   Status Visit(const DictionaryType& type) {
     // dictionary was already swapped in ReadDictionary() in ipc/reader.cc
     RETURN_NOT_OK(SwapType(*type.index_type()));
@@ -347,6 +390,11 @@ class NullArrayFactory {
       return MaxOf(sizeof(typename T::offset_type) * (length_ + 1));
     }
 
+    Status Visit(const BinaryViewType&) {
+      // zeroed views are empty inlined values
+      return MaxOf(BinaryViewType::kSize * length_);
+    }
+
     Status Visit(const FixedSizeListType& type) {
       return MaxOf(GetBufferLength(type.value_type(), type.list_size() * length_));
     }
@@ -389,6 +437,11 @@ class NullArrayFactory {
       return MaxOf(GetBufferLength(type.index_type(), length_));
     }
 
+    Status Visit(const RunEndEncodedType& type) {
+      // will create a single null run
+      return MaxOf(GetBufferLength(type.value_type(), 1));
+    }
+
     Status Visit(const ExtensionType& type) {
       // XXX is an extension array's length always == storage length
       return MaxOf(GetBufferLength(type.storage_type(), length_));
@@ -455,6 +508,11 @@ class NullArrayFactory {
     return Status::OK();
   }
 
+  Status Visit(const BinaryViewType&) {
+    out_->buffers.resize(3, buffer_);
+    return Status::OK();
+  }
+
   template <typename T>
   enable_if_var_size_list<T, Status> Visit(const T& type) {
     out_->buffers.resize(2, buffer_);
@@ -512,6 +570,17 @@ class NullArrayFactory {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    // Run-end encoded arrays have no validity bitmap, nulls are null values
+    out_->buffers[0] = nullptr;
+    out_->null_count = 0;
+    ARROW_ASSIGN_OR_RAISE(auto run_ends, MakeSingleRunEnds(type, length_, pool_));
+    out_->child_data[0] = run_ends->data();
+    ARROW_ASSIGN_OR_RAISE(out_->child_data[1],
+                          CreateChild(type, 1, std::min<int64_t>(length_, 1)));
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionType& type) {
     out_->child_data.resize(type.storage_type()->num_fields());
     RETURN_NOT_OK(VisitTypeInline(*type.storage_type(), this));
@@ -596,6 +665,25 @@ class RepeatedArrayFactory {
     return Status::OK();
   }
 
+  template <typename T>
+  enable_if_binary_view_like<T, Status> Visit(const T&) {
+    // All views refer to the same single copy of the value
+    std::shared_ptr<Buffer> value =
+        checked_cast<const typename TypeTraits<T>::ScalarType&>(scalar_).value;
+    std::shared_ptr<Buffer> values_buffer;
+    RETURN_NOT_OK(CreateBufferOf(value->data(), value->size(), &values_buffer));
+    const auto view =
+        binary_view_util::MakeView(value->data(), static_cast<int32_t>(value->size()),
+                                   /*offset=*/0);
+    ARROW_ASSIGN_OR_RAISE(auto views_buffer,
+                          AllocateBuffer(length_ * BinaryViewType::kSize, pool_));
+    auto views = reinterpret_cast<BinaryViewType::c_type*>(views_buffer->mutable_data());
+    std::fill(views, views + length_, view);
+    out_ = std::make_shared<typename TypeTraits<T>::ArrayType>(
+        length_, std::move(views_buffer), std::move(values_buffer));
+    return Status::OK();
+  }
+
   template <typename T>
   enable_if_var_size_list<T, Status> Visit(const T& type) {
     using ScalarType = typename TypeTraits<T>::ScalarType;
@@ -731,6 +819,15 @@ class RepeatedArrayFactory {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    const auto& value = checked_cast<const RunEndEncodedScalar&>(scalar_).value;
+    ARROW_ASSIGN_OR_RAISE(auto run_ends, MakeSingleRunEnds(type, length_, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto values,
+                          MakeArrayFromScalar(*value, std::min<int64_t>(length_, 1), pool_));
+    out_ = std::make_shared<RunEndEncodedArray>(scalar_.type, length_, run_ends, values);
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionType& type) {
     return Status::NotImplemented("construction from scalar of type ", *scalar_.type);
   }
@@ -796,6 +893,10 @@ Result<std::shared_ptr<Array>> MakeArrayFromScalar(const Scalar& scalar, int64_t
 
 Result<std::shared_ptr<Array>> MakeEmptyArray(std::shared_ptr<DataType> type,
                                               MemoryPool* memory_pool) {
+  if (type->id() == Type::RUN_END_ENCODED) {
+    // There is no builder for run-end encoded data
+    return MakeArrayOfNull(type, 0, memory_pool);
+  }
   std::unique_ptr<ArrayBuilder> builder;
   RETURN_NOT_OK(MakeBuilder(memory_pool, type, &builder));
   RETURN_NOT_OK(builder->Resize(0));
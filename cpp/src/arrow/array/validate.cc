@@ -17,6 +17,8 @@
 
 #include "arrow/array/validate.h"
 
+#include <algorithm>
+#include <cstring>
 #include <vector>
 
 #include "arrow/array.h"  // IWYU pragma: keep
@@ -48,9 +50,16 @@ struct UTF8DataValidator {
   }
 
   template <typename StringType>
-  enable_if_string<StringType, Status> Visit(const StringType&) {
+  enable_if_t<is_string_type<StringType>::value ||
+                  std::is_same<StringType, StringViewType>::value,
+              Status>
+  Visit(const StringType& type) {
     util::InitializeUTF8();
 
+    if (ValidateContiguous(type)) {
+      return Status::OK();
+    }
+
     int64_t i = 0;
     return VisitArraySpanInline<StringType>(
         data,
@@ -66,6 +75,44 @@ struct UTF8DataValidator {
           return Status::OK();
         });
   }
+
+  // Fast path: if the whole range of values spanned by the offsets is valid and
+  // no offset points into the middle of a character, every string is valid.
+  // Returns false when the strings must be validated one by one (e.g. when the
+  // values behind null slots are not valid UTF8).
+  template <typename StringType>
+  enable_if_string<StringType, bool> ValidateContiguous(const StringType&) {
+    using offset_type = typename StringType::offset_type;
+    if (data.length == 0 || data.buffers[1] == nullptr || data.buffers[2] == nullptr) {
+      return false;
+    }
+    const offset_type* offsets = data.GetValues<offset_type>(1);
+    const uint8_t* values = data.buffers[2]->data();
+    const offset_type first_offset = offsets[0];
+    const offset_type last_offset = offsets[data.length];
+    if (first_offset < 0 || first_offset > last_offset ||
+        last_offset > data.buffers[2]->size()) {
+      return false;
+    }
+    // Branch-free, so that the comparisons are vectorized
+    bool in_range = true;
+    for (int64_t i = 1; i < data.length; ++i) {
+      in_range &= (offsets[i] >= first_offset) & (offsets[i] <= last_offset);
+    }
+    if (!in_range) {
+      return false;
+    }
+    bool at_boundaries = true;
+    for (int64_t i = 1; i < data.length; ++i) {
+      // The end of the values is always a boundary
+      const uint8_t byte = offsets[i] < last_offset ? values[offsets[i]] : 0;
+      at_boundaries &= (byte & 0xc0) != 0x80;
+    }
+    return at_boundaries &&
+           util::ValidateUTF8(values + first_offset, last_offset - first_offset);
+  }
+
+  bool ValidateContiguous(const StringViewType&) { return false; }
 };
 
 struct BoundsChecker {
@@ -82,22 +129,36 @@ struct BoundsChecker {
   enable_if_integer<IntegerType, Status> Visit(const IntegerType&) {
     using c_type = typename IntegerType::c_type;
 
-    int64_t i = 0;
-    return VisitArraySpanInline<IntegerType>(
-        data,
-        [&](c_type value) {
-          const auto v = static_cast<int64_t>(value);
-          if (ARROW_PREDICT_FALSE(v < min_value || v > max_value)) {
-            return Status::Invalid("Value at position ", i, " out of bounds: ", v,
-                                   " (should be in [", min_value, ", ", max_value, "])");
-          }
-          ++i;
-          return Status::OK();
-        },
-        [&]() {
-          ++i;
-          return Status::OK();
-        });
+    if (data.length == 0 || data.GetNullCount() == data.length) {
+      return Status::OK();
+    }
+    const c_type* values = data.GetValues<c_type>(1);
+    const uint8_t* validity =
+        data.buffers[0] != nullptr ? data.buffers[0]->data() : nullptr;
+    // The values are checked by blocks regardless of their validity, without
+    // branching, so that the comparisons are vectorized. Only the blocks holding
+    // an out-of-bounds value (possibly behind a null) are checked value by value.
+    constexpr int64_t kBlockSize = 1024;
+    for (int64_t block_start = 0; block_start < data.length; block_start += kBlockSize) {
+      const int64_t block_end = std::min(block_start + kBlockSize, data.length);
+      bool in_bounds = true;
+      for (int64_t i = block_start; i < block_end; ++i) {
+        const auto v = static_cast<int64_t>(values[i]);
+        in_bounds &= (v >= min_value) & (v <= max_value);
+      }
+      if (ARROW_PREDICT_TRUE(in_bounds)) continue;
+      for (int64_t i = block_start; i < block_end; ++i) {
+        if (validity != nullptr && !bit_util::GetBit(validity, data.offset + i)) {
+          continue;
+        }
+        const auto v = static_cast<int64_t>(values[i]);
+        if (v < min_value || v > max_value) {
+          return Status::Invalid("Value at position ", i, " out of bounds: ", v,
+                                 " (should be in [", min_value, ", ", max_value, "])");
+        }
+      }
+    }
+    return Status::OK();
   }
 };
 
@@ -168,6 +229,16 @@ struct ValidateArrayImpl {
     return Status::OK();
   }
 
+  Status Visit(const BinaryViewType& type) { return ValidateBinaryViews(); }
+
+  Status Visit(const StringViewType& type) {
+    RETURN_NOT_OK(ValidateBinaryViews());
+    if (full_validation) {
+      RETURN_NOT_OK(ValidateUTF8(data));
+    }
+    return Status::OK();
+  }
+
   Status Visit(const Date64Type& type) {
     RETURN_NOT_OK(ValidateFixedWidthBuffers());
 
@@ -413,6 +484,55 @@ struct ValidateArrayImpl {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    if (data.null_count != 0) {
+      return Status::Invalid("Run-end encoded array should not have nulls, ",
+                             "got null_count = ", data.null_count);
+    }
+    const ArrayData& run_ends = *data.child_data[0];
+    const ArrayData& values = *data.child_data[1];
+    if (!run_ends.type->Equals(*type.run_end_type())) {
+      return Status::Invalid("Run ends array type ", run_ends.type->ToString(),
+                             " does not match type field ",
+                             type.run_end_type()->ToString());
+    }
+    if (!values.type->Equals(*type.value_type())) {
+      return Status::Invalid("Values array type ", values.type->ToString(),
+                             " does not match type field ",
+                             type.value_type()->ToString());
+    }
+    const Status run_ends_valid = RecurseInto(run_ends);
+    if (!run_ends_valid.ok()) {
+      return Status::Invalid("Run ends array invalid: ", run_ends_valid.ToString());
+    }
+    const Status values_valid = RecurseInto(values);
+    if (!values_valid.ok()) {
+      return Status::Invalid("Values array invalid: ", values_valid.ToString());
+    }
+    if (run_ends.GetNullCount() != 0) {
+      return Status::Invalid("Run ends array should not have nulls");
+    }
+    if (values.length < run_ends.length) {
+      return Status::Invalid("Values array length (", values.length,
+                             ") is smaller than the run ends array length (",
+                             run_ends.length, ")");
+    }
+    if (data.length == 0) {
+      return Status::OK();
+    }
+    if (run_ends.length == 0) {
+      return Status::Invalid("Run ends array is empty in non-empty run-end encoded array");
+    }
+    switch (type.run_end_type()->id()) {
+      case Type::INT16:
+        return ValidateRunEnds<int16_t>(run_ends);
+      case Type::INT32:
+        return ValidateRunEnds<int32_t>(run_ends);
+      default:
+        return ValidateRunEnds<int64_t>(run_ends);
+    }
+  }
+
   Status Visit(const ExtensionType& type) {
     // Visit storage
     return ValidateWithType(*type.storage_type());
@@ -530,6 +650,28 @@ struct ValidateArrayImpl {
     return Status::OK();
   }
 
+  template <typename RunEndCType>
+  Status ValidateRunEnds(const ArrayData& run_ends_data) {
+    const RunEndCType* run_ends = run_ends_data.GetValues<RunEndCType>(1);
+    const int64_t last_run_end = run_ends[run_ends_data.length - 1];
+    if (last_run_end < data.offset + data.length) {
+      return Status::Invalid("Last run end is ", last_run_end,
+                             " but it should match or exceed the logical offset ",
+                             "plus length (", data.offset + data.length, ")");
+    }
+    if (full_validation) {
+      RunEndCType previous = 0;
+      for (int64_t i = 0; i < run_ends_data.length; ++i) {
+        if (run_ends[i] <= previous) {
+          return Status::Invalid("Run ends are not strictly increasing and positive ",
+                                 "at index ", i, ": ", run_ends[i]);
+        }
+        previous = run_ends[i];
+      }
+    }
+    return Status::OK();
+  }
+
   Status ValidateFixedWidthBuffers() {
     if (data.length > 0 && !IsBufferValid(1)) {
       return Status::Invalid("Missing values buffer in non-empty fixed-width array");
@@ -577,6 +719,55 @@ struct ValidateArrayImpl {
     return Status::OK();
   }
 
+  Status ValidateBinaryViews() {
+    RETURN_NOT_OK(ValidateFixedWidthBuffers());
+    if (!full_validation || data.length == 0 || !data.buffers[1]->is_cpu()) {
+      return Status::OK();
+    }
+    using View = BinaryViewType::c_type;
+    constexpr int kInlineSize = BinaryViewType::kInlineSize;
+    constexpr int kPrefixSize = BinaryViewType::kPrefixSize;
+
+    const auto* views = data.GetValues<View>(1);
+    const uint8_t* values = IsBufferValid(2) ? data.buffers[2]->data() : nullptr;
+    const int64_t values_length = IsBufferValid(2) ? data.buffers[2]->size() : 0;
+    const uint8_t* validity = IsBufferValid(0) ? data.buffers[0]->data() : nullptr;
+    for (int64_t i = 0; i < data.length; ++i) {
+      if (validity && !bit_util::GetBit(validity, data.offset + i)) {
+        continue;
+      }
+      const View& view = views[i];
+      const int32_t size = view.size();
+      if (size < 0) {
+        return Status::Invalid("Negative size in binary view at index ", i);
+      }
+      if (view.is_inline()) {
+        for (int32_t j = size; j < kInlineSize; ++j) {
+          if (view.inlined.data[j] != 0) {
+            return Status::Invalid("Non-zero padding in inlined binary view at index ",
+                                   i);
+          }
+        }
+        continue;
+      }
+      if (view.ref.buffer_index != 0) {
+        return Status::Invalid("Binary view at index ", i, " refers to data buffer ",
+                               view.ref.buffer_index, " but there is only one");
+      }
+      if (view.ref.offset < 0 ||
+          static_cast<int64_t>(view.ref.offset) + size > values_length) {
+        return Status::Invalid("Binary view at index ", i,
+                               " out of bounds of the value data buffer (size ",
+                               values_length, ")");
+      }
+      if (std::memcmp(view.ref.prefix, values + view.ref.offset, kPrefixSize) != 0) {
+        return Status::Invalid("Prefix of binary view at index ", i,
+                               " does not match the value data");
+      }
+    }
+    return Status::OK();
+  }
+
   template <typename ListType>
   Status ValidateListLike(const ListType& type) {
     const ArrayData& values = *data.child_data[0];
@@ -646,23 +837,35 @@ struct ValidateArrayImpl {
       // Validate all offset values
       const offset_type* offsets = data.GetValues<offset_type>(1);
 
-      auto prev_offset = offsets[0];
-      if (prev_offset < 0) {
+      if (offsets[0] < 0) {
         return Status::Invalid(
-            "Offset invariant failure: array starts at negative offset ", prev_offset);
-      }
-      for (int64_t i = 1; i <= data.length; ++i) {
-        const auto current_offset = offsets[i];
-        if (current_offset < prev_offset) {
-          return Status::Invalid(
-              "Offset invariant failure: non-monotonic offset at slot ", i, ": ",
-              current_offset, " < ", prev_offset);
+            "Offset invariant failure: array starts at negative offset ", offsets[0]);
+      }
+      // The offsets are checked by blocks without branching, so that the
+      // comparisons are vectorized. A failing block is scanned again for the error.
+      constexpr int64_t kBlockSize = 1024;
+      for (int64_t block_start = 1; block_start <= data.length;
+           block_start += kBlockSize) {
+        const int64_t block_end = std::min(block_start + kBlockSize, data.length + 1);
+        bool valid = true;
+        for (int64_t i = block_start; i < block_end; ++i) {
+          valid &= (offsets[i] >= offsets[i - 1]) & (offsets[i] <= offset_limit);
         }
-        if (current_offset > offset_limit) {
-          return Status::Invalid("Offset invariant failure: offset for slot ", i,
-                                 " out of bounds: ", current_offset, " > ", offset_limit);
+        if (ARROW_PREDICT_TRUE(valid)) continue;
+        for (int64_t i = block_start; i < block_end; ++i) {
+          const auto current_offset = offsets[i];
+          const auto prev_offset = offsets[i - 1];
+          if (current_offset < prev_offset) {
+            return Status::Invalid(
+                "Offset invariant failure: non-monotonic offset at slot ", i, ": ",
+                current_offset, " < ", prev_offset);
+          }
+          if (current_offset > offset_limit) {
+            return Status::Invalid("Offset invariant failure: offset for slot ", i,
+                                   " out of bounds: ", current_offset, " > ",
+                                   offset_limit);
+          }
         }
-        prev_offset = current_offset;
       }
     }
     return Status::OK();
@@ -716,7 +919,8 @@ Status ValidateArrayFull(const Array& array) { return ValidateArrayFull(*array.d
 
 ARROW_EXPORT
 Status ValidateUTF8(const ArrayData& data) {
-  DCHECK(data.type->id() == Type::STRING || data.type->id() == Type::LARGE_STRING);
+  DCHECK(data.type->id() == Type::STRING || data.type->id() == Type::LARGE_STRING ||
+         data.type->id() == Type::STRING_VIEW);
   UTF8DataValidator validator{data};
   return VisitTypeInline(*data.type, &validator);
 }
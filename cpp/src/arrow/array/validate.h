@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/visibility.h"
@@ -46,6 +48,10 @@ Status ValidateArrayFull(const Array& array);
 ARROW_EXPORT
 Status ValidateArrayFull(const ArrayData& data);
 
+// The total length of the chunks or columns from which they are fully
+// validated in parallel on the CPU thread pool
+constexpr int64_t kMinParallelValidationLength = 1 << 16;
+
 ARROW_EXPORT
 Status ValidateUTF8(const Array& array);
 
@@ -152,6 +152,8 @@ struct DictionaryBuilderCase {
 
   Status Visit(const DataType& value_type) { return NotImplemented(value_type); }
   Status Visit(const HalfFloatType& value_type) { return NotImplemented(value_type); }
+  Status Visit(const BinaryViewType& value_type) { return NotImplemented(value_type); }
+  Status Visit(const StringViewType& value_type) { return NotImplemented(value_type); }
   Status NotImplemented(const DataType& value_type) {
     return Status::NotImplemented(
         "MakeBuilder: cannot construct builder for dictionaries with value type ",
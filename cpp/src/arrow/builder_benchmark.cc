@@ -29,11 +29,14 @@
 #include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/string_view.h"
 
 namespace arrow {
 
+using internal::checked_cast;
+
 using ValueType = int64_t;
 using VectorType = std::vector<ValueType>;
 constexpr int64_t kNumberOfElements = 256 * 512;
@@ -140,6 +143,76 @@ static void BuildBinaryArray(benchmark::State& state) {  // NOLINT non-const ref
   state.SetBytesProcessed(state.iterations() * kBytesProcessed);
 }
 
+static void BuildBinaryArrayBulk(benchmark::State& state) {  // NOLINT non-const reference
+  // One round of values, laid out as offsets into contiguous data
+  std::vector<int32_t> offsets(kNumberOfElements + 1);
+  for (int64_t i = 0; i <= kNumberOfElements; i++) {
+    offsets[i] = static_cast<int32_t>(i * kBinaryView.size());
+  }
+  std::string data;
+  for (int64_t i = 0; i < kNumberOfElements; i++) {
+    data.append(kBinaryView.data(), kBinaryView.size());
+  }
+  const auto values = reinterpret_cast<const uint8_t*>(data.data());
+
+  for (auto _ : state) {
+    BinaryBuilder builder;
+
+    for (int64_t i = 0; i < kRounds; i++) {
+      ABORT_NOT_OK(builder.AppendValues(offsets.data(), values, kNumberOfElements));
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+}
+
+static void BenchmarkAppendArraySlice(benchmark::State& state,  // NOLINT non-const ref
+                                      const std::shared_ptr<Array>& array) {
+  const ArraySpan span(*array->data());
+  for (auto _ : state) {
+    std::unique_ptr<ArrayBuilder> builder;
+    ABORT_NOT_OK(MakeBuilder(default_memory_pool(), array->type(), &builder));
+
+    for (int64_t i = 0; i < kRounds; i++) {
+      ABORT_NOT_OK(builder->AppendArraySlice(span, 0, array->length()));
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder->Finish(&out));
+  }
+
+  state.SetItemsProcessed(state.iterations() * kRounds * array->length());
+}
+
+static void AppendBinaryArraySlice(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BinaryBuilder builder;
+  for (int64_t i = 0; i < kNumberOfElements; i++) {
+    ABORT_NOT_OK(i % 8 == 0 ? builder.AppendNull() : builder.Append(kBinaryView));
+  }
+  std::shared_ptr<Array> array;
+  ABORT_NOT_OK(builder.Finish(&array));
+  BenchmarkAppendArraySlice(state, array);
+}
+
+static void AppendListArraySlice(benchmark::State& state) {  // NOLINT non-const reference
+  // Lists of 0 to 3 values
+  ListBuilder builder(default_memory_pool(), std::make_shared<Int64Builder>());
+  auto value_builder = checked_cast<Int64Builder*>(builder.value_builder());
+  for (int64_t i = 0; i < kNumberOfElements; i++) {
+    ABORT_NOT_OK(builder.Append(i % 8 != 0));
+    for (int64_t j = 0; j < i % 4; j++) {
+      ABORT_NOT_OK(value_builder->Append(j));
+    }
+  }
+  std::shared_ptr<Array> array;
+  ABORT_NOT_OK(builder.Finish(&array));
+  BenchmarkAppendArraySlice(state, array);
+}
+
 static void BuildChunkedBinaryArray(
     benchmark::State& state) {  // NOLINT non-const reference
   // 1MB chunks
@@ -439,6 +512,9 @@ BENCHMARK(BuildAdaptiveIntNoNulls);
 BENCHMARK(BuildAdaptiveIntNoNullsScalarAppend);
 
 BENCHMARK(BuildBinaryArray);
+BENCHMARK(BuildBinaryArrayBulk);
+BENCHMARK(AppendBinaryArraySlice);
+BENCHMARK(AppendListArraySlice);
 BENCHMARK(BuildChunkedBinaryArray);
 BENCHMARK(BuildFixedSizeBinaryArray);
 BENCHMARK(BuildDecimalArray);
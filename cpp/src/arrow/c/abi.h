@@ -106,6 +106,91 @@ struct ArrowArrayStream {
 
 #endif  // ARROW_C_STREAM_INTERFACE
 
+#ifndef ARROW_C_ASYNC_STREAM_INTERFACE
+#define ARROW_C_ASYNC_STREAM_INTERFACE
+
+// EXPERIMENTAL: C asynchronous stream interface
+//
+// The producer pushes arrays to a consumer-provided handler as the consumer
+// requests them, instead of the consumer blocking in `get_next`.
+
+// An array delivered by the producer, not necessarily materialized yet.
+// The consumer may copy the struct and must call `extract_data` exactly once,
+// from any thread, even if it is not interested in the array anymore.
+struct ArrowAsyncTask {
+  // Callback to move the array of the task to `out`, releasing the task's
+  // own resources.
+  //
+  // Return value: 0 if successful, an `errno`-compatible error code otherwise.
+  //
+  // If successful, the ArrowArray must be released independently from the task.
+  int (*extract_data)(struct ArrowAsyncTask* self, struct ArrowArray* out);
+
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+// Producer-side controls of an asynchronous stream, valid from the call to
+// the handler's `on_schema` until the call to the handler's `release`.
+// Neither callback calls back into the handler before returning.
+struct ArrowAsyncProducer {
+  // Callback to request `n` more arrays (n > 0), which the producer delivers to
+  // the handler's `on_next_task` as they become available. Requests add up.
+  // The producer never delivers arrays which weren't requested.
+  void (*request)(struct ArrowAsyncProducer* self, int64_t n);
+
+  // Callback to stop the stream. The producer stops delivering arrays and
+  // eventually calls the handler's `release`.
+  void (*cancel)(struct ArrowAsyncProducer* self);
+
+  // Optional metadata about the stream, in the format of ArrowSchema metadata,
+  // or NULL
+  const char* additional_metadata;
+
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+// Consumer-provided callbacks of an asynchronous stream. The producer never
+// calls them concurrently, and calls `release` last.
+struct ArrowAsyncArrayStreamHandler {
+  // Callback receiving the stream type, once and first. `producer` is set
+  // before the call, so that arrays may already be requested from it.
+  //
+  // The handler takes ownership of `stream_schema`.
+  //
+  // Return value: 0 if successful, an `errno`-compatible error code otherwise,
+  // which makes the producer stop the stream.
+  int (*on_schema)(struct ArrowAsyncArrayStreamHandler* self,
+                   struct ArrowSchema* stream_schema);
+
+  // Callback receiving the next requested array, or NULL at the end of the
+  // stream. `metadata` is optional metadata about the array, or NULL.
+  //
+  // Return value: 0 if successful, an `errno`-compatible error code otherwise,
+  // which makes the producer stop the stream.
+  int (*on_next_task)(struct ArrowAsyncArrayStreamHandler* self,
+                      struct ArrowAsyncTask* task, const char* metadata);
+
+  // Callback receiving an `errno`-compatible error code and an optional
+  // description (or NULL) when the stream failed. No arrays are delivered after
+  // the error.
+  void (*on_error)(struct ArrowAsyncArrayStreamHandler* self, int code,
+                   const char* message, const char* metadata);
+
+  // Release callback: release the handler's own resources. Called by the
+  // producer at the end of the stream, after an error or after cancellation.
+  void (*release)(struct ArrowAsyncArrayStreamHandler* self);
+
+  // Producer controls, set by the producer before calling `on_schema`
+  struct ArrowAsyncProducer* producer;
+
+  // Opaque handler-specific data
+  void* private_data;
+};
+
+#endif  // ARROW_C_ASYNC_STREAM_INTERFACE
+
 #ifdef __cplusplus
 }
 #endif
@@ -20,6 +20,9 @@
 #include <algorithm>
 #include <cerrno>
 #include <cstring>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -34,6 +37,7 @@
 #include "arrow/result.h"
 #include "arrow/stl_allocator.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/key_value_metadata.h"
@@ -41,6 +45,7 @@
 #include "arrow/util/macros.h"
 #include "arrow/util/small_vector.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/value_parsing.h"
 #include "arrow/visit_type_inline.h"
 
@@ -1627,6 +1632,45 @@ Result<std::shared_ptr<RecordBatch>> ImportRecordBatch(struct ArrowArray* array,
 
 namespace {
 
+int ErrnoFromStatus(const Status& status) {
+  switch (status.code()) {
+    case StatusCode::IOError:
+      return EIO;
+    case StatusCode::NotImplemented:
+      return ENOSYS;
+    case StatusCode::OutOfMemory:
+      return ENOMEM;
+    case StatusCode::Cancelled:
+      return ECANCELED;
+    default:
+      return EINVAL;  // Fallback for Invalid, TypeError, etc.
+  }
+}
+
+Status StatusFromErrno(int errno_like, const char* message) {
+  StatusCode code;
+  switch (errno_like) {
+    case EDOM:
+    case EINVAL:
+    case ERANGE:
+      code = StatusCode::Invalid;
+      break;
+    case ENOMEM:
+      code = StatusCode::OutOfMemory;
+      break;
+    case ENOSYS:
+      code = StatusCode::NotImplemented;
+      break;
+    case ECANCELED:
+      code = StatusCode::Cancelled;
+      break;
+    default:
+      code = StatusCode::IOError;
+      break;
+  }
+  return Status(code, message ? std::string(message) : "");
+}
+
 class ExportedArrayStream {
  public:
   struct PrivateData {
@@ -1702,16 +1746,7 @@ class ExportedArrayStream {
       return 0;
     }
     private_data()->last_error_ = status.ToString();
-    switch (status.code()) {
-      case StatusCode::IOError:
-        return EIO;
-      case StatusCode::NotImplemented:
-        return ENOSYS;
-      case StatusCode::OutOfMemory:
-        return ENOMEM;
-      default:
-        return EINVAL;  // Fallback for Invalid, TypeError, etc.
-    }
+    return ErrnoFromStatus(status);
   }
 
   PrivateData* private_data() {
@@ -1789,24 +1824,7 @@ class ArrayStreamBatchReader : public RecordBatchReader {
     if (ARROW_PREDICT_TRUE(errno_like == 0)) {
       return Status::OK();
     }
-    StatusCode code;
-    switch (errno_like) {
-      case EDOM:
-      case EINVAL:
-      case ERANGE:
-        code = StatusCode::Invalid;
-        break;
-      case ENOMEM:
-        code = StatusCode::OutOfMemory;
-        break;
-      case ENOSYS:
-        code = StatusCode::NotImplemented;
-      default:
-        code = StatusCode::IOError;
-        break;
-    }
-    const char* last_error = stream_.get_last_error(&stream_);
-    return Status(code, last_error ? std::string(last_error) : "");
+    return StatusFromErrno(errno_like, stream_.get_last_error(&stream_));
   }
 
   mutable struct ArrowArrayStream stream_;
@@ -1824,4 +1842,458 @@ Result<std::shared_ptr<RecordBatchReader>> ImportRecordBatchReader(
   return std::make_shared<ArrayStreamBatchReader>(stream);
 }
 
+//////////////////////////////////////////////////////////////////////////
+// C async stream export
+
+namespace {
+
+using RecordBatchGenerator = std::function<Future<std::shared_ptr<RecordBatch>>()>;
+
+class AsyncArrayStreamProducer
+    : public std::enable_shared_from_this<AsyncArrayStreamProducer> {
+ public:
+  AsyncArrayStreamProducer(RecordBatchGenerator generator,
+                           ::arrow::internal::Executor* executor,
+                           struct ArrowAsyncArrayStreamHandler* handler)
+      : generator_(std::move(generator)), executor_(executor), handler_(handler) {
+    producer_.request = StaticRequest;
+    producer_.cancel = StaticCancel;
+    producer_.additional_metadata = nullptr;
+    producer_.private_data = this;
+  }
+
+  Future<> Start(const Schema& schema) {
+    // Keep alive until the handler is released
+    self_ = shared_from_this();
+    auto finished = finished_;
+
+    struct ArrowSchema c_schema;
+    auto status = ExportSchema(schema, &c_schema);
+    if (!status.ok()) {
+      ReportError(status);
+      return finished;
+    }
+    handler_->producer = &producer_;
+    const int errno_like = handler_->on_schema(handler_, &c_schema);
+    ArrowSchemaRelease(&c_schema);
+    if (errno_like != 0) {
+      Finish(StatusFromErrno(errno_like,
+                             "ArrowAsyncArrayStreamHandler::on_schema failed"));
+      return finished;
+    }
+
+    // Arrays requested from on_schema are only delivered once it returned
+    std::unique_lock<std::mutex> lock(mutex_);
+    started_ = true;
+    ScheduleLocked(&lock);
+    return finished;
+  }
+
+  void Request(int64_t n) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (n <= 0 || done_) {
+      return;
+    }
+    pending_requests_ += n;
+    ScheduleLocked(&lock);
+  }
+
+  void Cancel() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cancelled_ = true;
+    ScheduleLocked(&lock);
+  }
+
+  // C-compatible callbacks
+
+  static void StaticRequest(struct ArrowAsyncProducer* producer, int64_t n) {
+    reinterpret_cast<AsyncArrayStreamProducer*>(producer->private_data)->Request(n);
+  }
+
+  static void StaticCancel(struct ArrowAsyncProducer* producer) {
+    reinterpret_cast<AsyncArrayStreamProducer*>(producer->private_data)->Cancel();
+  }
+
+ private:
+  // Start pumping on the executor if there is something to do, so that the handler
+  // is never called back from within a producer callback
+  void ScheduleLocked(std::unique_lock<std::mutex>* lock) {
+    if (!started_ || pumping_ || done_ || (pending_requests_ == 0 && !cancelled_)) {
+      return;
+    }
+    pumping_ = true;
+    lock->unlock();
+    auto self = shared_from_this();
+    auto status = executor_->Spawn([self] { self->Pump(); });
+    if (!status.ok()) {
+      ReportError(status);
+    }
+  }
+
+  // Deliver the requested record batches, one at a time
+  void Pump() {
+    while (true) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (cancelled_) {
+          break;
+        }
+        if (pending_requests_ == 0) {
+          pumping_ = false;
+          return;
+        }
+        --pending_requests_;
+      }
+      auto next = generator_();
+      if (!next.is_finished()) {
+        auto self = shared_from_this();
+        next.AddCallback([self](const Result<std::shared_ptr<RecordBatch>>& result) {
+          if (self->Deliver(result)) {
+            self->Pump();
+          }
+        });
+        return;
+      }
+      if (!Deliver(next.result())) {
+        return;
+      }
+    }
+    Finish(Status::Cancelled("Asynchronous C stream was cancelled by the consumer"));
+  }
+
+  // Return whether the stream goes on
+  bool Deliver(const Result<std::shared_ptr<RecordBatch>>& result) {
+    if (!result.ok()) {
+      ReportError(result.status());
+      return false;
+    }
+    const auto& batch = *result;
+    if (IsIterationEnd(batch)) {
+      const int errno_like = handler_->on_next_task(handler_, nullptr, nullptr);
+      Finish(errno_like == 0 ? Status::OK()
+                             : StatusFromErrno(errno_like,
+                                               "ArrowAsyncArrayStreamHandler::"
+                                               "on_next_task failed"));
+      return false;
+    }
+    struct ArrowAsyncTask task;
+    task.extract_data = ExtractData;
+    task.private_data = new std::shared_ptr<RecordBatch>(batch);
+    const int errno_like = handler_->on_next_task(handler_, &task, nullptr);
+    if (errno_like != 0) {
+      Finish(StatusFromErrno(errno_like,
+                             "ArrowAsyncArrayStreamHandler::on_next_task failed"));
+      return false;
+    }
+    return true;
+  }
+
+  static int ExtractData(struct ArrowAsyncTask* task, struct ArrowArray* out) {
+    std::unique_ptr<std::shared_ptr<RecordBatch>> batch(
+        reinterpret_cast<std::shared_ptr<RecordBatch>*>(task->private_data));
+    task->private_data = nullptr;
+    auto status = ExportRecordBatch(**batch, out);
+    return status.ok() ? 0 : ErrnoFromStatus(status);
+  }
+
+  void ReportError(const Status& status) {
+    const auto message = status.ToString();
+    handler_->on_error(handler_, ErrnoFromStatus(status), message.c_str(), nullptr);
+    Finish(status);
+  }
+
+  void Finish(const Status& status) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (done_) {
+        return;
+      }
+      done_ = true;
+    }
+    handler_->release(handler_);
+    // May destroy this object
+    auto self = std::move(self_);
+    auto finished = finished_;
+    finished.MarkFinished(status);
+  }
+
+  RecordBatchGenerator generator_;
+  ::arrow::internal::Executor* executor_;
+  struct ArrowAsyncArrayStreamHandler* handler_;
+  struct ArrowAsyncProducer producer_;
+  Future<> finished_ = Future<>::Make();
+  std::shared_ptr<AsyncArrayStreamProducer> self_;
+
+  std::mutex mutex_;
+  int64_t pending_requests_ = 0;
+  bool started_ = false;
+  bool pumping_ = false;
+  bool cancelled_ = false;
+  bool done_ = false;
+};
+
+}  // namespace
+
+Future<> ExportAsyncRecordBatchGenerator(
+    std::shared_ptr<Schema> schema,
+    std::function<Future<std::shared_ptr<RecordBatch>>()> generator,
+    ::arrow::internal::Executor* executor, struct ArrowAsyncArrayStreamHandler* handler) {
+  auto producer =
+      std::make_shared<AsyncArrayStreamProducer>(std::move(generator), executor, handler);
+  return producer->Start(*schema);
+}
+
+Future<> ExportAsyncRecordBatchReader(std::shared_ptr<RecordBatchReader> reader,
+                                      ::arrow::internal::Executor* executor,
+                                      struct ArrowAsyncArrayStreamHandler* handler) {
+  auto schema = reader->schema();
+  // Read on demand, unlike a background generator which would read ahead
+  // regardless of the requests of the consumer
+  RecordBatchGenerator generator = [reader, executor] {
+    return DeferNotOk(executor->Submit([reader] { return reader->Next(); }));
+  };
+  return ExportAsyncRecordBatchGenerator(std::move(schema), std::move(generator),
+                                         executor, handler);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// C async stream import
+
+namespace {
+
+class AsyncArrayStreamHandler
+    : public std::enable_shared_from_this<AsyncArrayStreamHandler> {
+ public:
+  AsyncArrayStreamHandler(::arrow::internal::Executor* executor, int64_t queue_size)
+      : executor_(executor), queue_size_(queue_size) {}
+
+  ~AsyncArrayStreamHandler() {
+    // Release the arrays which were delivered but not consumed
+    for (auto& task : tasks_) {
+      struct ArrowArray c_array;
+      if (task.extract_data(&task, &c_array) == 0) {
+        ArrowArrayRelease(&c_array);
+      }
+    }
+  }
+
+  Future<AsyncRecordBatchGenerator> Init(struct ArrowAsyncArrayStreamHandler* handler) {
+    // Keep alive until released by the producer
+    self_ = shared_from_this();
+    handler->on_schema = StaticOnSchema;
+    handler->on_next_task = StaticOnNextTask;
+    handler->on_error = StaticOnError;
+    handler->release = StaticRelease;
+    handler->producer = nullptr;
+    handler->private_data = this;
+    return schema_future_;
+  }
+
+  int OnSchema(struct ArrowAsyncArrayStreamHandler* handler,
+               struct ArrowSchema* c_schema) {
+    auto maybe_schema = ImportSchema(c_schema);
+    if (!maybe_schema.ok()) {
+      Fail(maybe_schema.status());
+      return ErrnoFromStatus(maybe_schema.status());
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      schema_received_ = true;
+      schema_ = *maybe_schema;
+      producer_ = handler->producer;
+      producer_->request(producer_, queue_size_);
+    }
+
+    auto consumer = std::make_shared<Consumer>(shared_from_this());
+    AsyncRecordBatchGenerator stream;
+    stream.schema = *maybe_schema;
+    stream.generator = [consumer] { return consumer->handler->Next(); };
+    Complete(schema_future_, Result<AsyncRecordBatchGenerator>(std::move(stream)));
+    return 0;
+  }
+
+  int OnNextTask(struct ArrowAsyncTask* task) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (task == nullptr) {
+      ended_ = true;
+      auto waiters = std::move(waiters_);
+      lock.unlock();
+      for (auto& waiter : waiters) {
+        Complete(waiter, Result<std::shared_ptr<RecordBatch>>(
+                             IterationEnd<std::shared_ptr<RecordBatch>>()));
+      }
+      return 0;
+    }
+    if (waiters_.empty()) {
+      tasks_.push_back(*task);
+      return 0;
+    }
+    auto waiter = std::move(waiters_.front());
+    waiters_.pop_front();
+    producer_->request(producer_, 1);
+    lock.unlock();
+    ExtractAndComplete(*task, std::move(waiter));
+    return 0;
+  }
+
+  void OnError(int errno_like, const char* message) {
+    Fail(StatusFromErrno(errno_like, message));
+  }
+
+  void Release() {
+    Fail(Status::Invalid("Asynchronous C stream was released before its end"));
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      producer_ = nullptr;
+    }
+    self_.reset();
+  }
+
+  // C-compatible callbacks
+
+  static int StaticOnSchema(struct ArrowAsyncArrayStreamHandler* handler,
+                            struct ArrowSchema* c_schema) {
+    return FromHandler(handler)->OnSchema(handler, c_schema);
+  }
+
+  static int StaticOnNextTask(struct ArrowAsyncArrayStreamHandler* handler,
+                              struct ArrowAsyncTask* task, const char* metadata) {
+    return FromHandler(handler)->OnNextTask(task);
+  }
+
+  static void StaticOnError(struct ArrowAsyncArrayStreamHandler* handler,
+                            int errno_like, const char* message, const char* metadata) {
+    FromHandler(handler)->OnError(errno_like, message);
+  }
+
+  static void StaticRelease(struct ArrowAsyncArrayStreamHandler* handler) {
+    auto self = FromHandler(handler)->shared_from_this();
+    handler->release = nullptr;
+    self->Release();
+  }
+
+ private:
+  // Cancels the stream once the consumer drops the generator
+  struct Consumer {
+    explicit Consumer(std::shared_ptr<AsyncArrayStreamHandler> handler)
+        : handler(std::move(handler)) {}
+    ~Consumer() { handler->Cancel(); }
+
+    std::shared_ptr<AsyncArrayStreamHandler> handler;
+  };
+
+  static AsyncArrayStreamHandler* FromHandler(
+      struct ArrowAsyncArrayStreamHandler* handler) {
+    return reinterpret_cast<AsyncArrayStreamHandler*>(handler->private_data);
+  }
+
+  Future<std::shared_ptr<RecordBatch>> Next() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!tasks_.empty()) {
+      auto task = tasks_.front();
+      tasks_.pop_front();
+      if (producer_ != nullptr) {
+        producer_->request(producer_, 1);
+      }
+      lock.unlock();
+      auto next = Future<std::shared_ptr<RecordBatch>>::Make();
+      ExtractAndComplete(task, next);
+      return next;
+    }
+    if (!status_.ok()) {
+      return status_;
+    }
+    if (ended_) {
+      return AsyncGeneratorEnd<std::shared_ptr<RecordBatch>>();
+    }
+    waiters_.push_back(Future<std::shared_ptr<RecordBatch>>::Make());
+    return waiters_.back();
+  }
+
+  void Cancel() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (producer_ != nullptr && !ended_ && status_.ok()) {
+      producer_->cancel(producer_);
+    }
+  }
+
+  void Fail(const Status& status) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (ended_ || !status_.ok()) {
+      return;
+    }
+    status_ = status;
+    auto waiters = std::move(waiters_);
+    const bool schema_received = schema_received_;
+    schema_received_ = true;
+    lock.unlock();
+    if (!schema_received) {
+      Complete(schema_future_, Result<AsyncRecordBatchGenerator>(status));
+    }
+    for (auto& waiter : waiters) {
+      Complete(waiter, Result<std::shared_ptr<RecordBatch>>(status));
+    }
+  }
+
+  // Finish futures on the executor, rather than from within the producer's calls
+  template <typename T>
+  void Complete(Future<T> future, Result<T> result) {
+    auto status = executor_->Spawn([future, result]() mutable {
+      future.MarkFinished(std::move(result));
+    });
+    if (!status.ok()) {
+      future.MarkFinished(status);
+    }
+  }
+
+  void ExtractAndComplete(struct ArrowAsyncTask task,
+                          Future<std::shared_ptr<RecordBatch>> future) {
+    auto self = shared_from_this();
+    auto import_batch = [self, task]() mutable -> Result<std::shared_ptr<RecordBatch>> {
+      struct ArrowArray c_array;
+      const int errno_like = task.extract_data(&task, &c_array);
+      if (errno_like != 0) {
+        return StatusFromErrno(errno_like, "ArrowAsyncTask::extract_data failed");
+      }
+      return ImportRecordBatch(&c_array, self->schema_);
+    };
+    auto status = executor_->Spawn([import_batch, future]() mutable {
+      future.MarkFinished(import_batch());
+    });
+    if (!status.ok()) {
+      // The array must still be released
+      future.MarkFinished(import_batch());
+    }
+  }
+
+  ::arrow::internal::Executor* executor_;
+  const int64_t queue_size_;
+  Future<AsyncRecordBatchGenerator> schema_future_ =
+      Future<AsyncRecordBatchGenerator>::Make();
+  std::shared_ptr<AsyncArrayStreamHandler> self_;
+  std::shared_ptr<Schema> schema_;
+
+  std::mutex mutex_;
+  struct ArrowAsyncProducer* producer_ = nullptr;
+  bool schema_received_ = false;
+  // Arrays delivered ahead of the consumer
+  std::deque<struct ArrowAsyncTask> tasks_;
+  // Consumer futures waiting for arrays
+  std::deque<Future<std::shared_ptr<RecordBatch>>> waiters_;
+  bool ended_ = false;
+  Status status_;
+};
+
+}  // namespace
+
+Future<AsyncRecordBatchGenerator> CreateAsyncArrayStreamHandler(
+    struct ArrowAsyncArrayStreamHandler* handler, ::arrow::internal::Executor* executor,
+    int64_t queue_size) {
+  if (queue_size <= 0) {
+    return Status::Invalid("Queue size must be positive, got ", queue_size);
+  }
+  auto stream = std::make_shared<AsyncArrayStreamHandler>(executor, queue_size);
+  return stream->Init(handler);
+}
+
 }  // namespace arrow
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -24,7 +26,9 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/future.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -194,4 +198,72 @@ Result<std::shared_ptr<RecordBatchReader>> ImportRecordBatchReader(
 
 /// @}
 
+/// \defgroup c-async-stream-interface Functions for working with the C async
+/// stream interface.
+///
+/// @{
+
+/// \brief Export a stream of C++ record batches to an asynchronous C stream
+/// handler.
+///
+/// The handler's on_schema callback is called before returning. Record batches
+/// are only pulled from the generator once requested by the consumer, one at a
+/// time, and are delivered to the handler from the threads of `executor` or
+/// from those completing the generator's futures.
+///
+/// \param[in] schema schema of the record batches
+/// \param[in] generator generator of the record batches to export
+/// \param[in] executor executor on which the requests of the consumer are served
+/// \param[in,out] handler C struct of the handler receiving the stream
+/// \return a future finishing once the stream ended and the handler was released,
+/// with the error of the stream if any
+ARROW_EXPORT
+Future<> ExportAsyncRecordBatchGenerator(
+    std::shared_ptr<Schema> schema,
+    std::function<Future<std::shared_ptr<RecordBatch>>()> generator,
+    ::arrow::internal::Executor* executor, struct ArrowAsyncArrayStreamHandler* handler);
+
+/// \brief Export C++ RecordBatchReader to an asynchronous C stream handler.
+///
+/// Like ExportAsyncRecordBatchGenerator(), reading each record batch from
+/// `reader` on `executor` as requested by the consumer.
+///
+/// \param[in] reader RecordBatchReader object to export
+/// \param[in] executor executor on which record batches are read
+/// \param[in,out] handler C struct of the handler receiving the stream
+/// \return a future finishing once the stream ended and the handler was released,
+/// with the error of the stream if any
+ARROW_EXPORT
+Future<> ExportAsyncRecordBatchReader(std::shared_ptr<RecordBatchReader> reader,
+                                      ::arrow::internal::Executor* executor,
+                                      struct ArrowAsyncArrayStreamHandler* handler);
+
+/// \brief A stream of record batches imported from an asynchronous C stream
+struct AsyncRecordBatchGenerator {
+  std::shared_ptr<Schema> schema;
+  /// \brief Generator of the record batches, ending with a null record batch
+  ///
+  /// Destroying the generator before the end of the stream cancels it.
+  std::function<Future<std::shared_ptr<RecordBatch>>()> generator;
+};
+
+/// \brief Create an asynchronous C stream handler importing record batches.
+///
+/// The handler is to be passed to a producer, and stays valid until the producer
+/// releases it. Up to `queue_size` record batches are requested ahead of the
+/// consumption of the generator, so that the producer may run ahead of the
+/// consumer but not unboundedly.
+///
+/// \param[out] handler C struct where to create the handler
+/// \param[in] executor executor on which record batches are imported and the
+/// futures of the stream are finished
+/// \param[in] queue_size maximum number of record batches requested ahead
+/// \return a future finishing with the stream once the producer sent its schema
+ARROW_EXPORT
+Future<AsyncRecordBatchGenerator> CreateAsyncArrayStreamHandler(
+    struct ArrowAsyncArrayStreamHandler* handler, ::arrow::internal::Executor* executor,
+    int64_t queue_size = 5);
+
+/// @}
+
 }  // namespace arrow
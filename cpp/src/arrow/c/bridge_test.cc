@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
 #include <cerrno>
 #include <deque>
 #include <functional>
@@ -33,14 +34,17 @@
 #include "arrow/ipc/json_simple.h"
 #include "arrow/memory_pool.h"
 #include "arrow/testing/extension_type.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/endian.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -3228,4 +3232,114 @@ TEST_F(TestArrayStreamRoundtrip, Errors) {
   });
 }
 
+////////////////////////////////////////////////////////////////////////////
+// Async array stream roundtrip tests
+
+class TestAsyncArrayStreamRoundtrip : public BaseArrayStreamTest {
+ public:
+  void SetUp() override {
+    schema_ = arrow::schema({field("ints", int32())});
+    batches_ = MakeBatches(schema_, {ArrayFromJSON(int32(), "[1, 2]"),
+                                     ArrayFromJSON(int32(), "[4, 5, null]"),
+                                     ArrayFromJSON(int32(), "[]"),
+                                     ArrayFromJSON(int32(), "[6]")});
+    // After allocating the batches, which live until the end of the test
+    BaseArrayStreamTest::SetUp();
+  }
+
+  // A generator of batches_, counting how many batches were pulled
+  std::function<Future<std::shared_ptr<RecordBatch>>()> MakeGenerator() {
+    auto batches = batches_;
+    auto pulled = pulled_;
+    return [batches, pulled] {
+      const size_t index = (*pulled)++;
+      if (index >= batches.size()) {
+        return Future<std::shared_ptr<RecordBatch>>::MakeFinished(nullptr);
+      }
+      return SleepABitAsync().Then([batches, index] { return batches[index]; });
+    };
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_;
+  RecordBatchVector batches_;
+  std::shared_ptr<std::atomic<size_t>> pulled_ = std::make_shared<std::atomic<size_t>>(0);
+};
+
+TEST_F(TestAsyncArrayStreamRoundtrip, Simple) {
+  struct ArrowAsyncArrayStreamHandler handler;
+  auto executor = ::arrow::internal::GetCpuThreadPool();
+  auto fut_stream = CreateAsyncArrayStreamHandler(&handler, executor, /*queue_size=*/2);
+  auto exported =
+      ExportAsyncRecordBatchGenerator(schema_, MakeGenerator(), executor, &handler);
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto stream, fut_stream);
+  AssertSchemaEqual(*schema_, *stream.schema);
+
+  // The producer doesn't run ahead of the consumer by more than the queue size
+  BusyWait(10, [&] { return pulled_->load() >= 2; });
+  SleepABit();
+  ASSERT_EQ(pulled_->load(), 2U);
+  ASSERT_FALSE(exported.is_finished());
+
+  for (const auto& expected : batches_) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batch, stream.generator());
+    ASSERT_NE(batch, nullptr);
+    AssertBatchesEqual(*expected, *batch);
+  }
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto end, stream.generator());
+  ASSERT_EQ(end, nullptr);
+  ASSERT_FINISHES_OK(exported);
+}
+
+TEST_F(TestAsyncArrayStreamRoundtrip, RecordBatchReader) {
+  struct ArrowAsyncArrayStreamHandler handler;
+  auto executor = ::arrow::internal::GetCpuThreadPool();
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make(batches_, schema_));
+  auto fut_stream = CreateAsyncArrayStreamHandler(&handler, executor);
+  auto exported = ExportAsyncRecordBatchReader(reader, executor, &handler);
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto stream, fut_stream);
+  ASSERT_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(stream.generator).result());
+  ASSERT_EQ(batches.size(), batches_.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    AssertBatchesEqual(*batches_[i], *batches[i]);
+  }
+  ASSERT_FINISHES_OK(exported);
+}
+
+TEST_F(TestAsyncArrayStreamRoundtrip, Errors) {
+  struct ArrowAsyncArrayStreamHandler handler;
+  auto executor = ::arrow::internal::GetCpuThreadPool();
+  auto reader = std::make_shared<FailingRecordBatchReader>(
+      Status::Invalid("roundtrip error example"));
+  auto fut_stream = CreateAsyncArrayStreamHandler(&handler, executor);
+  auto exported = ExportAsyncRecordBatchReader(reader, executor, &handler);
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto stream, fut_stream);
+  AssertSchemaEqual(*FailingRecordBatchReader::expected_schema(), *stream.schema);
+  auto next = stream.generator();
+  ASSERT_FINISHES_AND_RAISES(Invalid, next);
+  ASSERT_THAT(next.status().message(),
+              ::testing::HasSubstr("roundtrip error example"));
+  ASSERT_FINISHES_AND_RAISES(Invalid, exported);
+}
+
+TEST_F(TestAsyncArrayStreamRoundtrip, Cancel) {
+  struct ArrowAsyncArrayStreamHandler handler;
+  auto executor = ::arrow::internal::GetCpuThreadPool();
+  auto fut_stream = CreateAsyncArrayStreamHandler(&handler, executor, /*queue_size=*/1);
+  auto exported =
+      ExportAsyncRecordBatchGenerator(schema_, MakeGenerator(), executor, &handler);
+
+  {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto stream, fut_stream);
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batch, stream.generator());
+    AssertBatchesEqual(*batches_[0], *batch);
+  }
+  // Dropping the generator cancels the stream
+  ASSERT_FINISHES_AND_RAISES(Cancelled, exported);
+  ASSERT_LE(pulled_->load(), 2U);
+}
+
 }  // namespace arrow
@@ -32,6 +32,7 @@
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 
@@ -245,13 +246,27 @@ Status ValidateChunks(const ArrayVector& chunks, bool full_validation) {
                              " but saw ", chunk.type()->ToString());
     }
   }
-  // Validate the chunks themselves
-  for (size_t i = 0; i < chunks.size(); ++i) {
+  // Validate the chunks themselves, fully validating large ones in parallel
+  int64_t total_length = 0;
+  for (const auto& chunk : chunks) {
+    total_length += chunk->length();
+  }
+  const int num_chunks = static_cast<int>(chunks.size());
+  const bool use_threads =
+      full_validation &&
+      internal::ShouldUseCpuThreadPool(num_chunks, total_length,
+                                       internal::kMinParallelValidationLength);
+  std::vector<Status> statuses(chunks.size());
+  // Either way, the first invalid chunk is reported below
+  ARROW_UNUSED(internal::OptionalParallelFor(use_threads, num_chunks, [&](int i) {
     const Array& chunk = *chunks[i];
-    const Status st = full_validation ? internal::ValidateArrayFull(chunk)
-                                      : internal::ValidateArray(chunk);
-    if (!st.ok()) {
-      return Status::Invalid("In chunk ", i, ": ", st.ToString());
+    statuses[i] = full_validation ? internal::ValidateArrayFull(chunk)
+                                  : internal::ValidateArray(chunk);
+    return statuses[i];
+  }));
+  for (size_t i = 0; i < statuses.size(); ++i) {
+    if (!statuses[i].ok()) {
+      return Status::Invalid("In chunk ", i, ": ", statuses[i].ToString());
     }
   }
   return Status::OK();
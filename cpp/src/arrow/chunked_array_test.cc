@@ -17,6 +17,7 @@
 
 #include "arrow/chunked_array.h"
 
+#include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 
 #include <cstdint>
@@ -218,6 +219,30 @@ TEST_F(TestChunkedArray, Validate) {
   ASSERT_RAISES(Invalid, one_->ValidateFull());
 }
 
+TEST_F(TestChunkedArray, ValidateFullLarge) {
+  // Large enough to be validated in parallel
+  random::RandomArrayGenerator gen(0);
+  ArrayVector chunks;
+  for (int i = 0; i < 8; ++i) {
+    chunks.push_back(gen.String(20000, 0, 10, 0.1));
+  }
+  ChunkedArray valid(chunks);
+  ASSERT_OK(valid.ValidateFull());
+
+  // The first invalid chunk is reported
+  for (int i : {5, 3}) {
+    auto data = chunks[i]->data()->Copy();
+    ASSERT_OK_AND_ASSIGN(auto offsets,
+                         data->buffers[1]->CopySlice(0, data->buffers[1]->size()));
+    reinterpret_cast<int32_t*>(offsets->mutable_data())[10] = -1;
+    data->buffers[1] = std::move(offsets);
+    chunks[i] = MakeArray(data);
+  }
+  ChunkedArray invalid(chunks);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("In chunk 3"),
+                                  invalid.ValidateFull());
+}
+
 TEST_F(TestChunkedArray, PrintDiff) {
   random::RandomArrayGenerator gen(0);
   arrays_one_.push_back(gen.Int32(50, 0, 100, 0.1));
@@ -38,6 +38,7 @@
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
@@ -46,6 +47,7 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/memory.h"
+#include "arrow/util/ree_util.h"
 #include "arrow/visit_scalar_inline.h"
 #include "arrow/visit_type_inline.h"
 
@@ -262,6 +264,27 @@ class RangeDataEqualsImpl {
   // Also matches LargeStringType
   Status Visit(const LargeBinaryType& type) { return CompareBinary(type); }
 
+  // Also matches StringViewType
+  Status Visit(const BinaryViewType& type) {
+    using View = BinaryViewType::c_type;
+    const View* left_views = left_.GetValues<View>(1) + left_start_idx_;
+    const View* right_views = right_.GetValues<View>(1) + right_start_idx_;
+    const uint8_t* left_data = left_.GetValues<uint8_t>(2, 0);
+    const uint8_t* right_data = right_.GetValues<uint8_t>(2, 0);
+
+    auto compare_runs = [&](int64_t i, int64_t length) -> bool {
+      for (int64_t j = i; j < i + length; ++j) {
+        if (!binary_view_util::EqualViews(left_views[j], left_data, right_views[j],
+                                          right_data)) {
+          return false;
+        }
+      }
+      return true;
+    };
+    VisitValidRuns(compare_runs);
+    return Status::OK();
+  }
+
   Status Visit(const FixedSizeBinaryType& type) {
     const auto byte_width = type.byte_width();
     const uint8_t* left_data = left_.GetValues<uint8_t>(1, 0);
@@ -387,6 +410,29 @@ class RangeDataEqualsImpl {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    // Compare the values of every pair of overlapping runs
+    ArraySpan left(left_);
+    left.offset += left_start_idx_;
+    left.length = range_length_;
+    ArraySpan right(right_);
+    right.offset += right_start_idx_;
+    right.length = range_length_;
+    auto compare_runs = [&](int64_t, int64_t, int64_t left_physical,
+                            int64_t right_physical) {
+      RangeDataEqualsImpl impl(options_, floating_approximate_, *left_.child_data[1],
+                               *right_.child_data[1], left_physical, right_physical, 1);
+      if (!impl.Compare()) {
+        result_ = false;
+        // Stop at the first mismatch
+        return Status::Cancelled("ranges differ");
+      }
+      return Status::OK();
+    };
+    ARROW_UNUSED(ree_util::VisitMergedRuns(left, right, compare_runs));
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionType& type) {
     // Compare storages
     result_ &= CompareWithType(*type.storage_type());
@@ -591,7 +637,7 @@ class TypeEqualsVisitor {
 
   template <typename T>
   enable_if_t<is_null_type<T>::value || is_primitive_ctype<T>::value ||
-                  is_base_binary_type<T>::value,
+                  is_base_binary_type<T>::value || is_binary_view_like_type<T>::value,
               Status>
   Visit(const T&) {
     result_ = true;
@@ -680,6 +726,13 @@ class TypeEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& left) {
+    const auto& right = checked_cast<const RunEndEncodedType&>(right_);
+    result_ = left.run_end_type()->Equals(right.run_end_type()) &&
+              left.value_type()->Equals(*right.value_type(), check_metadata_);
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionType& left) {
     result_ = left.ExtensionEquals(static_cast<const ExtensionType&>(right_));
     return Status::OK();
@@ -811,6 +864,12 @@ class ScalarEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedScalar& left) {
+    const auto& right = checked_cast<const RunEndEncodedScalar&>(right_);
+    result_ = ScalarEquals(*left.value, *right.value, options_, floating_approximate_);
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionScalar& left) {
     const auto& right = checked_cast<const ExtensionScalar&>(right_);
     result_ = ScalarEquals(*left.value, *right.value, options_, floating_approximate_);
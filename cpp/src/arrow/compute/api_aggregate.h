@@ -173,6 +173,24 @@ class ARROW_EXPORT TDigestOptions : public FunctionOptions {
   uint32_t min_count;
 };
 
+/// \brief Control approximate distinct count kernel behavior
+///
+/// The distinct values are counted with HyperLogLog++ sketches of
+/// 2^precision registers.  A higher precision gives a more accurate count
+/// at the expense of memory: the relative standard error is about
+/// 1.04 / sqrt(2^precision), and each sketch uses up to 2^precision bytes.
+class ARROW_EXPORT ApproximateCountDistinctOptions : public FunctionOptions {
+ public:
+  explicit ApproximateCountDistinctOptions(int32_t precision = 14);
+  static constexpr char const kTypeName[] = "ApproximateCountDistinctOptions";
+  static ApproximateCountDistinctOptions Defaults() {
+    return ApproximateCountDistinctOptions{};
+  }
+
+  /// precision of the sketches, between 4 and 18, default 14 (about 0.8% error)
+  int32_t precision;
+};
+
 /// \brief Control Index kernel behavior
 class ARROW_EXPORT IndexOptions : public FunctionOptions {
  public:
@@ -395,6 +413,22 @@ Result<Datum> TDigest(const Datum& value,
                       const TDigestOptions& options = TDigestOptions::Defaults(),
                       ExecContext* ctx = NULLPTR);
 
+/// \brief Approximate the number of distinct non-null values of an array
+///
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[in] options see ApproximateCountDistinctOptions for more information
+/// \param[in] ctx the function execution context, optional
+/// \return resulting datum as an Int64Scalar
+///
+/// \since 11.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> ApproximateCountDistinct(
+    const Datum& value,
+    const ApproximateCountDistinctOptions& options =
+        ApproximateCountDistinctOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
 /// \brief Find the first index of a value in an array.
 ///
 /// \param[in] value The array to search.
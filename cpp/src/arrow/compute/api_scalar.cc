@@ -313,6 +313,10 @@ static auto kMapLookupOptionsType = GetFunctionOptionsType<MapLookupOptions>(
 static auto kMatchSubstringOptionsType = GetFunctionOptionsType<MatchSubstringOptions>(
     DataMember("pattern", &MatchSubstringOptions::pattern),
     DataMember("ignore_case", &MatchSubstringOptions::ignore_case));
+static auto kMatchSubstringSetOptionsType =
+    GetFunctionOptionsType<MatchSubstringSetOptions>(
+        DataMember("patterns", &MatchSubstringSetOptions::patterns),
+        DataMember("ignore_case", &MatchSubstringSetOptions::ignore_case));
 static auto kNullOptionsType = GetFunctionOptionsType<NullOptions>(
     DataMember("nan_is_null", &NullOptions::nan_is_null));
 static auto kPadOptionsType = GetFunctionOptionsType<PadOptions>(
@@ -443,6 +447,15 @@ MatchSubstringOptions::MatchSubstringOptions(std::string pattern, bool ignore_ca
 MatchSubstringOptions::MatchSubstringOptions() : MatchSubstringOptions("", false) {}
 constexpr char MatchSubstringOptions::kTypeName[];
 
+MatchSubstringSetOptions::MatchSubstringSetOptions(std::vector<std::string> patterns,
+                                                   bool ignore_case)
+    : FunctionOptions(internal::kMatchSubstringSetOptionsType),
+      patterns(std::move(patterns)),
+      ignore_case(ignore_case) {}
+MatchSubstringSetOptions::MatchSubstringSetOptions()
+    : MatchSubstringSetOptions(std::vector<std::string>{}) {}
+constexpr char MatchSubstringSetOptions::kTypeName[];
+
 NullOptions::NullOptions(bool nan_is_null)
     : FunctionOptions(internal::kNullOptionsType), nan_is_null(nan_is_null) {}
 constexpr char NullOptions::kTypeName[];
@@ -600,6 +613,7 @@ void RegisterScalarOptions(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunctionOptionsType(kMakeStructOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kMapLookupOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kMatchSubstringOptionsType));
+  DCHECK_OK(registry->AddFunctionOptionsType(kMatchSubstringSetOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kNullOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kPadOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kReplaceSliceOptionsType));
@@ -190,6 +190,19 @@ class ARROW_EXPORT MatchSubstringOptions : public FunctionOptions {
   bool ignore_case;
 };
 
+class ARROW_EXPORT MatchSubstringSetOptions : public FunctionOptions {
+ public:
+  explicit MatchSubstringSetOptions(std::vector<std::string> patterns,
+                                    bool ignore_case = false);
+  MatchSubstringSetOptions();
+  static constexpr char const kTypeName[] = "MatchSubstringSetOptions";
+
+  /// The exact substrings to look for inside input values.
+  std::vector<std::string> patterns;
+  /// Whether to perform a case-insensitive match (ASCII letters only).
+  bool ignore_case;
+};
+
 class ARROW_EXPORT SplitOptions : public FunctionOptions {
  public:
   explicit SplitOptions(int64_t max_splits = -1, bool reverse = false);
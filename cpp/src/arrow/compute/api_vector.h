@@ -24,6 +24,7 @@
 #include "arrow/datum.h"
 #include "arrow/result.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/optional.h"
 
 namespace arrow {
 namespace compute {
@@ -246,6 +247,36 @@ class ARROW_EXPORT CumulativeSumOptions : public FunctionOptions {
   bool check_overflow = false;
 };
 
+/// \brief Options for the cumulative functions other than cumulative sum
+class ARROW_EXPORT CumulativeOptions : public FunctionOptions {
+ public:
+  explicit CumulativeOptions(bool skip_nulls = false);
+  explicit CumulativeOptions(double start, bool skip_nulls = false);
+  explicit CumulativeOptions(std::shared_ptr<Scalar> start, bool skip_nulls = false);
+  static constexpr char const kTypeName[] = "CumulativeOptions";
+  static CumulativeOptions Defaults() { return CumulativeOptions(); }
+
+  /// Optional starting value for cumulative operation computation. When unset,
+  /// the identity of the operation for the input type is used (e.g. 1 for
+  /// products, the largest representable value for minimums).
+  util::optional<std::shared_ptr<Scalar>> start;
+
+  /// If true, nulls in the input are ignored and produce a corresponding null output.
+  /// When false, the first null encountered is propagated through the remaining output.
+  bool skip_nulls = false;
+};
+
+/// \brief Options for run_end_encode
+class ARROW_EXPORT RunEndEncodeOptions : public FunctionOptions {
+ public:
+  explicit RunEndEncodeOptions(std::shared_ptr<DataType> run_end_type = int32());
+  static constexpr char const kTypeName[] = "RunEndEncodeOptions";
+  static RunEndEncodeOptions Defaults() { return RunEndEncodeOptions(); }
+
+  /// The type of the run ends: int16, int32 or int64
+  std::shared_ptr<DataType> run_end_type;
+};
+
 /// @}
 
 /// \brief Filter with a boolean selection filter
@@ -586,6 +617,61 @@ Result<Datum> CumulativeSum(
     const CumulativeSumOptions& options = CumulativeSumOptions::Defaults(),
     ExecContext* ctx = NULLPTR);
 
+/// \brief Compute the cumulative product of an array-like object
+///
+/// \param[in] values array-like input
+/// \param[in] options configures the starting value and null handling
+/// \param[in] check_overflow whether to return an error on integer overflow
+/// \param[in] ctx the function execution context, optional
+ARROW_EXPORT
+Result<Datum> CumulativeProd(
+    const Datum& values, const CumulativeOptions& options = CumulativeOptions::Defaults(),
+    bool check_overflow = false, ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the cumulative minimum of an array-like object
+ARROW_EXPORT
+Result<Datum> CumulativeMin(
+    const Datum& values, const CumulativeOptions& options = CumulativeOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the cumulative maximum of an array-like object
+ARROW_EXPORT
+Result<Datum> CumulativeMax(
+    const Datum& values, const CumulativeOptions& options = CumulativeOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the cumulative mean of an array-like object
+///
+/// The output is always float64. A `start` value is not supported.
+ARROW_EXPORT
+Result<Datum> CumulativeMean(
+    const Datum& values, const CumulativeOptions& options = CumulativeOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \brief Run-end encode values in an array-like object
+///
+/// Runs of equal consecutive values (and runs of nulls) are stored once. For
+/// example, given values [1, 1, null, null, 2] the output will have
+/// run_ends [2, 4, 5] and values [1, null, 2].
+///
+/// \param[in] data array-like input
+/// \param[in] options configures the run end type of the output
+/// \param[in] ctx the function execution context, optional
+/// \return result of type run_end_encoded(options.run_end_type, data.type())
+ARROW_EXPORT
+Result<Datum> RunEndEncode(
+    const Datum& data,
+    const RunEndEncodeOptions& options = RunEndEncodeOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \brief Decode a run-end encoded array-like object to a plain array
+///
+/// \param[in] data array-like input of run-end encoded type
+/// \param[in] ctx the function execution context, optional
+/// \return result of the value type of the input
+ARROW_EXPORT
+Result<Datum> RunEndDecode(const Datum& data, ExecContext* ctx = NULLPTR);
+
 // ----------------------------------------------------------------------
 // Deprecated functions
 
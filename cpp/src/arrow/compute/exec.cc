@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -31,6 +32,7 @@
 #include "arrow/array/util.h"
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernel.h"
@@ -42,6 +44,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -64,6 +67,45 @@ ExecContext* default_exec_context() {
   return &default_ctx;
 }
 
+namespace {
+
+// Whether two arrays reference the same data.  The buffers are immutable, so this
+// holds for slices or copies of an ArrayData taken with the same offset and length.
+bool SameArrayData(const ArrayData& left, const ArrayData& right) {
+  if (&left == &right) return true;
+  return left.offset == right.offset && left.length == right.length &&
+         left.buffers == right.buffers && left.child_data == right.child_data &&
+         left.dictionary == right.dictionary && left.type->Equals(*right.type);
+}
+
+}  // namespace
+
+bool KeyHashes::Matches(Function hash_function,
+                        const std::vector<Datum>& key_values) const {
+  if (function != hash_function || keys.size() != key_values.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (!key_values[i].is_array() || !SameArrayData(*keys[i], *key_values[i].array())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::shared_ptr<KeyHashes> KeyHashes::Slice(int64_t offset, int64_t length) const {
+  auto out = std::make_shared<KeyHashes>();
+  out->function = function;
+  const int64_t num_hashes = hashes->size() / static_cast<int64_t>(sizeof(uint32_t));
+  length = std::min(length, num_hashes - offset);
+  out->keys.reserve(keys.size());
+  for (const auto& key : keys) {
+    out->keys.push_back(key->Slice(offset, length));
+  }
+  out->hashes = SliceBuffer(hashes, offset * sizeof(uint32_t), length * sizeof(uint32_t));
+  return out;
+}
+
 ExecBatch::ExecBatch(const RecordBatch& batch)
     : values(batch.num_columns()), length(batch.num_rows()) {
   auto columns = batch.column_data();
@@ -118,11 +160,22 @@ std::string ExecBatch::ToString() const {
 
 ExecBatch ExecBatch::Slice(int64_t offset, int64_t length) const {
   ExecBatch out = *this;
+  if (selection_vector) {
+    // The values are indexed through the selection, which is sliced instead
+    length = std::min(length, this->length - offset);
+    out.selection_vector = std::make_shared<SelectionVector>(
+        selection_vector->data()->Slice(offset, length));
+    out.length = length;
+    return out;
+  }
   for (auto& value : out.values) {
     if (value.is_scalar()) continue;
     value = value.array()->Slice(offset, length);
   }
   out.length = std::min(length, this->length - offset);
+  if (key_hashes) {
+    out.key_hashes = key_hashes->Slice(offset, out.length);
+  }
   return out;
 }
 
@@ -157,6 +210,11 @@ Result<ExecBatch> ExecBatch::Make(std::vector<Datum> values) {
 
 Result<std::shared_ptr<RecordBatch>> ExecBatch::ToRecordBatch(
     std::shared_ptr<Schema> schema, MemoryPool* pool) const {
+  if (selection_vector) {
+    ExecContext ctx(pool);
+    ARROW_ASSIGN_OR_RAISE(ExecBatch selected, ApplySelection(&ctx));
+    return selected.ToRecordBatch(std::move(schema), pool);
+  }
   ArrayVector columns(schema->num_fields());
 
   for (size_t i = 0; i < columns.size(); ++i) {
@@ -171,6 +229,33 @@ Result<std::shared_ptr<RecordBatch>> ExecBatch::ToRecordBatch(
   return RecordBatch::Make(std::move(schema), length, std::move(columns));
 }
 
+Result<ExecBatch> ExecBatch::ApplySelection(ExecContext* ctx) const {
+  return ApplySelection(std::vector<bool>(values.size(), true), ctx);
+}
+
+Result<ExecBatch> ExecBatch::ApplySelection(const std::vector<bool>& columns,
+                                            ExecContext* ctx) const {
+  DCHECK_EQ(columns.size(), values.size());
+  if (!selection_vector) {
+    return *this;
+  }
+  ExecBatch out = *this;
+  out.selection_vector.reset();
+  out.key_hashes.reset();
+  const Datum indices(selection_vector->data());
+  const TakeOptions options = TakeOptions::NoBoundsCheck();
+  for (size_t i = 0; i < out.values.size(); ++i) {
+    Datum& value = out.values[i];
+    if (value.is_scalar()) continue;
+    if (!columns[i]) {
+      value = MakeNullScalar(value.type());
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(value, CallFunction("take", {value, indices}, &options, ctx));
+  }
+  return out;
+}
+
 namespace {
 
 Result<std::shared_ptr<Buffer>> AllocateDataBuffer(KernelContext* ctx, int64_t length,
@@ -1025,9 +1110,14 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
     if (kernel_->can_execute_chunkwise) {
       RETURN_NOT_OK(span_iterator_.Init(batch, output_descr_.shape,
                                         exec_context()->exec_chunksize()));
-      ExecSpan span;
-      while (span_iterator_.Next(&span)) {
-        RETURN_NOT_OK(Exec(span, listener));
+      if (kernel_->can_execute_chunks_in_parallel && !kernel_->finalize &&
+          exec_context()->parallelize_chunks()) {
+        RETURN_NOT_OK(ExecParallel(listener));
+      } else {
+        ExecSpan span;
+        while (span_iterator_.Next(&span)) {
+          RETURN_NOT_OK(Exec(span, listener));
+        }
       }
     } else {
       // Kernel cannot execute chunkwise. If we have any chunked
@@ -1091,6 +1181,35 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
     return Status::OK();
   }
 
+  // Execute all spans in parallel, then emit the results in order
+  Status ExecParallel(ExecListener* listener) {
+    std::vector<ExecSpan> spans;
+    ExecSpan span;
+    while (span_iterator_.Next(&span)) {
+      // Copy the span as the iterator updates it in place
+      spans.push_back(span);
+    }
+    std::vector<std::shared_ptr<ArrayData>> outputs(spans.size());
+    RETURN_NOT_OK(ParallelForChunks(
+        exec_context(), static_cast<int>(spans.size()),
+        [&](int i, ExecContext* task_ctx) -> Status {
+          KernelContext kernel_ctx(task_ctx, kernel_);
+          kernel_ctx.SetState(state());
+          ExecResult out;
+          ARROW_ASSIGN_OR_RAISE(out.value, PrepareOutput(spans[i].length));
+          if (kernel_->null_handling == NullHandling::INTERSECTION) {
+            RETURN_NOT_OK(PropagateNulls(&kernel_ctx, spans[i], out.array_data().get()));
+          }
+          RETURN_NOT_OK(kernel_->exec(&kernel_ctx, spans[i], &out));
+          outputs[i] = out.array_data();
+          return Status::OK();
+        }));
+    for (auto& output : outputs) {
+      RETURN_NOT_OK(listener->OnResult(std::move(output)));
+    }
+    return Status::OK();
+  }
+
   Status ExecChunked(const ExecBatch& batch, ExecListener* listener) {
     if (kernel_->exec_chunked == nullptr) {
       return Status::Invalid(
@@ -1351,8 +1470,35 @@ SelectionVector::SelectionVector(const Array& arr) : SelectionVector(arr.data())
 int32_t SelectionVector::length() const { return static_cast<int32_t>(data_->length); }
 
 Result<std::shared_ptr<SelectionVector>> SelectionVector::FromMask(
-    const BooleanArray& arr) {
-  return Status::NotImplemented("FromMask");
+    const BooleanArray& arr, MemoryPool* pool) {
+  if (arr.length() > std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid("Masks longer than 2^31 - 1 can not be a selection vector");
+  }
+  const uint8_t* bitmap = arr.values()->data();
+  int64_t offset = arr.offset();
+  std::shared_ptr<Buffer> selected;
+  if (arr.null_count() > 0) {
+    ARROW_ASSIGN_OR_RAISE(selected,
+                          BitmapAnd(pool, arr.null_bitmap_data(), offset, bitmap, offset,
+                                    arr.length(), /*out_offset=*/0));
+    bitmap = selected->data();
+    offset = 0;
+  }
+
+  const int64_t num_selected =
+      ::arrow::internal::CountSetBits(bitmap, offset, arr.length());
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices,
+                        AllocateBuffer(num_selected * sizeof(int32_t), pool));
+  auto* out = reinterpret_cast<int32_t*>(indices->mutable_data());
+  ::arrow::internal::VisitSetBitRunsVoid(bitmap, offset, arr.length(),
+                                         [&](int64_t position, int64_t length) {
+                                           for (int64_t i = 0; i < length; ++i) {
+                                             *out++ = static_cast<int32_t>(position + i);
+                                           }
+                                         });
+  return std::make_shared<SelectionVector>(
+      ArrayData::Make(int32(), num_selected, {nullptr, std::move(indices)},
+                      /*null_count=*/0));
 }
 
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
@@ -34,6 +34,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/cancel.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
@@ -72,6 +73,11 @@ class ARROW_EXPORT ExecContext {
   const ::arrow::internal::CpuInfo* cpu_info() const;
 
   /// \brief An Executor which may be used to parallelize execution.
+  ///
+  /// An ExecPlan can be switched to morsel-driven scheduling by passing a
+  /// ::arrow::internal::WorkStealingThreadPool here.  On NUMA machines, pinning its
+  /// workers to nodes and allocating from a NumaLocalMemoryPool keeps the work on
+  /// each morsel, and its data, on one node.
   ::arrow::internal::Executor* executor() const { return executor_; }
 
   /// \brief The FunctionRegistry for looking up functions by name and
@@ -118,13 +124,43 @@ class ARROW_EXPORT ExecContext {
   /// set_preallocate_contiguous() for more information.
   bool preallocate_contiguous() const { return preallocate_contiguous_; }
 
+  /// \brief Set whether the chunks of ChunkedArray and Table inputs may be
+  /// processed in parallel by vector functions which support it (such as
+  /// "filter", "take" and "sort_indices"), if use_threads() is also true.
+  ///
+  /// The tasks run on executor(), or the CPU thread pool if it is not set,
+  /// and the calling thread waits for their completion.  This is off by
+  /// default, and should not be enabled when calling functions from tasks
+  /// running on the same thread pool.
+  void set_parallelize_chunks(bool parallelize = true) {
+    parallelize_chunks_ = parallelize;
+  }
+
+  /// \brief If the chunks of ChunkedArray and Table inputs may be processed in
+  /// parallel. See set_parallelize_chunks() for more information.
+  bool parallelize_chunks() const { return parallelize_chunks_; }
+
+  /// \brief Set a token through which the work done with this context may be
+  /// cancelled, for example once a deadline set on its StopSource has passed.
+  ///
+  /// An ExecPlan then stops pulling from its sources and drops the batches still
+  /// queued in its nodes, and the scans of the plan abort their reads (unless
+  /// their IOContext has its own token).
+  void set_stop_token(StopToken stop_token) { stop_token_ = std::move(stop_token); }
+
+  /// \brief The token through which the work may be cancelled, unstoppable by
+  /// default. See set_stop_token() for more information.
+  const StopToken& stop_token() const { return stop_token_; }
+
  private:
   MemoryPool* pool_;
   ::arrow::internal::Executor* executor_;
   FunctionRegistry* func_registry_;
+  StopToken stop_token_;
   int64_t exec_chunksize_ = std::numeric_limits<int64_t>::max();
   bool preallocate_contiguous_ = true;
   bool use_threads_ = true;
+  bool parallelize_chunks_ = false;
 };
 
 ARROW_EXPORT ExecContext* default_exec_context();
@@ -151,16 +187,60 @@ class ARROW_EXPORT SelectionVector {
   explicit SelectionVector(const Array& arr);
 
   /// \brief Create SelectionVector from boolean mask
-  static Result<std::shared_ptr<SelectionVector>> FromMask(const BooleanArray& arr);
+  ///
+  /// The selection holds the indices of the true values, null values are not selected.
+  static Result<std::shared_ptr<SelectionVector>> FromMask(
+      const BooleanArray& arr, MemoryPool* pool = default_memory_pool());
 
   const int32_t* indices() const { return indices_; }
   int32_t length() const;
 
+  /// \brief The indices, as an int32 array without nulls
+  const std::shared_ptr<ArrayData>& data() const { return data_; }
+
  private:
   std::shared_ptr<ArrayData> data_;
   const int32_t* indices_;
 };
 
+/// \brief Hashes of the rows of some key columns, passed along with an ExecBatch
+///
+/// Nodes which hash the rows of a batch on key columns (such as the hash partitioning
+/// of the exchange node) may attach the hashes to the batches they output, so that a
+/// downstream node hashing the same key columns with the same function (such as the
+/// grouper of an aggregation, or another partitioning) does not hash them again.
+///
+/// The hashes are tagged with the key columns they were computed from and are only
+/// used for columns which reference the same data, so nodes which pass columns
+/// through unchanged may forward them as they are.
+struct ARROW_EXPORT KeyHashes {
+  enum Function {
+    /// Hashing32::HashBatch of the key columns, in order
+    HASHING32,
+  };
+
+  /// The hash function
+  Function function = HASHING32;
+
+  /// The hashed key columns, in hashing order
+  std::vector<std::shared_ptr<ArrayData>> keys;
+
+  /// The uint32_t hash of each row of the key columns
+  std::shared_ptr<Buffer> hashes;
+
+  const uint32_t* hashes32() const {
+    return reinterpret_cast<const uint32_t*>(hashes->data());
+  }
+
+  /// \brief Whether these are the `hash_function` hashes of the `key_values` columns
+  ///
+  /// Scalar keys never match.
+  bool Matches(Function hash_function, const std::vector<Datum>& key_values) const;
+
+  /// \brief Slice the hashes along with the key columns
+  std::shared_ptr<KeyHashes> Slice(int64_t offset, int64_t length) const;
+};
+
 /// \brief A unit of work for kernel execution. It contains a collection of
 /// Array and Scalar values and an optional SelectionVector indicating that
 /// there is an unmaterialized filter that either must be materialized, or (if
@@ -183,9 +263,22 @@ struct ARROW_EXPORT ExecBatch {
 
   static Result<ExecBatch> Make(std::vector<Datum> values);
 
+  /// \brief Convert to a RecordBatch, applying the selection vector if there is one
   Result<std::shared_ptr<RecordBatch>> ToRecordBatch(
       std::shared_ptr<Schema> schema, MemoryPool* pool = default_memory_pool()) const;
 
+  /// \brief Copy the selected rows into new values, and drop the selection vector
+  ///
+  /// Returns the batch unchanged if it has no selection vector.
+  Result<ExecBatch> ApplySelection(ExecContext* ctx = NULLPTR) const;
+
+  /// \brief Copy the selected rows of some of the values only
+  ///
+  /// The values for which `columns` is false are replaced by null scalars of the same
+  /// type, so that they are cheap to produce; they must not be read.
+  Result<ExecBatch> ApplySelection(const std::vector<bool>& columns,
+                                   ExecContext* ctx = NULLPTR) const;
+
   /// The values representing positional arguments to be passed to a kernel's
   /// exec function for processing.
   std::vector<Datum> values;
@@ -194,12 +287,23 @@ struct ARROW_EXPORT ExecBatch {
   ///
   /// For example, the filter [true, true, false, true] would be represented as
   /// the selection vector [0, 1, 3]. When the selection vector is set,
-  /// ExecBatch::length is equal to the length of this array.
+  /// ExecBatch::length is equal to the length of this array, while the array values
+  /// keep their unfiltered length.
+  ///
+  /// Exec nodes only receive batches with a selection vector if they declare they
+  /// accept them, see ExecNode::accepts_selection_vector().
   std::shared_ptr<SelectionVector> selection_vector;
 
   /// A predicate Expression guaranteed to evaluate to true for all rows in this batch.
   Expression guarantee = literal(true);
 
+  /// Precomputed hashes of some of the values, if any.
+  ///
+  /// The hashes are aligned with the array values: when there is a selection vector,
+  /// they are not filtered.  They are ignored when comparing batches and are dropped
+  /// by ApplySelection.
+  std::shared_ptr<KeyHashes> key_hashes;
+
   /// The semantic length of the ExecBatch. When the values are all scalars,
   /// the length should be set to 1 for non-aggregate kernels, otherwise the
   /// length is taken from the array values, except when there is a selection
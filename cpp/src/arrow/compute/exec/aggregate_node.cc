@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <mutex>
 #include <sstream>
 #include <thread>
@@ -24,6 +25,7 @@
 #include "arrow/compute/exec/aggregate.h"
 #include "arrow/compute/exec/exec_plan.h"
 #include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/spilling_util.h"
 #include "arrow/compute/exec/util.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/registry.h"
@@ -31,7 +33,9 @@
 #include "arrow/datum.h"
 #include "arrow/result.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/tracing_internal.h"
 
@@ -256,7 +260,7 @@ class ScalarAggregateNode : public ExecNode {
       RETURN_NOT_OK(kernels_[i]->finalize(&ctx, &batch.values[i]));
     }
 
-    outputs_[0]->InputReceived(this, std::move(batch));
+    EmitBatch(std::move(batch));
     finished_.MarkFinished();
     return Status::OK();
   }
@@ -276,14 +280,17 @@ class GroupByNode : public ExecNode {
   GroupByNode(ExecNode* input, std::shared_ptr<Schema> output_schema, ExecContext* ctx,
               std::vector<int> key_field_ids, std::vector<int> agg_src_field_ids,
               std::vector<Aggregate> aggs,
-              std::vector<const HashAggregateKernel*> agg_kernels)
+              std::vector<const HashAggregateKernel*> agg_kernels,
+              int64_t spill_memory_limit, bool streaming)
       : ExecNode(input->plan(), {input}, {"groupby"}, std::move(output_schema),
                  /*num_outputs=*/1),
         ctx_(ctx),
         key_field_ids_(std::move(key_field_ids)),
         agg_src_field_ids_(std::move(agg_src_field_ids)),
         aggs_(std::move(aggs)),
-        agg_kernels_(std::move(agg_kernels)) {}
+        agg_kernels_(std::move(agg_kernels)),
+        spill_memory_limit_(spill_memory_limit),
+        streaming_(streaming) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -312,6 +319,29 @@ class GroupByNode : public ExecNode {
       agg_src_field_ids[i] = match[0];
     }
 
+    if (aggregate_options.spill_memory_limit < 0) {
+      return Status::Invalid("spill_memory_limit cannot be negative");
+    }
+    if (aggregate_options.streaming && aggregate_options.spill_memory_limit > 0) {
+      return Status::Invalid("A streaming group by cannot spill");
+    }
+    if (aggregate_options.spill_memory_limit > 0) {
+      // Spill files may only hold a single dictionary per column and partitioning hashes
+      // dictionary indices, so dictionaries could end up split across partitions
+      for (int field_id : key_field_ids) {
+        if (input_schema->field(field_id)->type()->id() == Type::DICTIONARY) {
+          return Status::NotImplemented(
+              "Spilling group by is not supported for dictionary keys");
+        }
+      }
+      for (int field_id : agg_src_field_ids) {
+        if (input_schema->field(field_id)->type()->id() == Type::DICTIONARY) {
+          return Status::NotImplemented(
+              "Spilling group by is not supported for dictionary arguments");
+        }
+      }
+    }
+
     // Build vector of aggregate source field data types
     std::vector<ValueDescr> agg_src_descrs(aggs.size());
     for (size_t i = 0; i < aggs.size(); ++i) {
@@ -349,7 +379,8 @@ class GroupByNode : public ExecNode {
 
     return input->plan()->EmplaceNode<GroupByNode>(
         input, schema(std::move(output_fields)), ctx, std::move(key_field_ids),
-        std::move(agg_src_field_ids), std::move(aggs), std::move(agg_kernels));
+        std::move(agg_src_field_ids), std::move(aggs), std::move(agg_kernels),
+        aggregate_options.spill_memory_limit, aggregate_options.streaming);
   }
 
   const char* kind_name() const override { return "GroupByNode"; }
@@ -366,39 +397,28 @@ class GroupByNode : public ExecNode {
                                 local_states_.size(), ")");
     }
 
-    auto state = &local_states_[thread_index];
-    RETURN_NOT_OK(InitLocalStateIfNeeded(state));
-
-    // Create a batch with key columns
-    std::vector<Datum> keys(key_field_ids_.size());
-    for (size_t i = 0; i < key_field_ids_.size(); ++i) {
-      keys[i] = batch.values[key_field_ids_[i]];
+    if (spill_partitioner_) {
+      // Only the keys and the aggregate arguments are needed to aggregate a partition
+      ExecBatch spill_batch({}, batch.length);
+      spill_batch.values.reserve(key_field_ids_.size() + agg_src_field_ids_.size());
+      for (int field_id : key_field_ids_) {
+        spill_batch.values.push_back(batch.values[field_id]);
+      }
+      for (int field_id : agg_src_field_ids_) {
+        spill_batch.values.push_back(batch.values[field_id]);
+      }
+      spill_batch.key_hashes = batch.key_hashes;
+      return spill_partitioner_->Push(spill_batch);
     }
-    ExecBatch key_batch(std::move(keys), batch.length);
-
-    // Create a batch with group ids
-    ARROW_ASSIGN_OR_RAISE(Datum id_batch, state->grouper->Consume(key_batch));
 
-    // Execute aggregate kernels
-    for (size_t i = 0; i < agg_kernels_.size(); ++i) {
-      util::tracing::Span span;
-      START_COMPUTE_SPAN(span, aggs_[i].function,
-                         {{"function.name", aggs_[i].function},
-                          {"function.options",
-                           aggs_[i].options ? aggs_[i].options->ToString() : "<NULLPTR>"},
-                          {"function.kind", std::string(kind_name()) + "::Consume"}});
-      KernelContext kernel_ctx{ctx_};
-      kernel_ctx.SetState(state->agg_states[i].get());
-
-      ARROW_ASSIGN_OR_RAISE(
-          auto agg_batch,
-          ExecBatch::Make({batch.values[agg_src_field_ids_[i]], id_batch}));
-
-      RETURN_NOT_OK(agg_kernels_[i]->resize(&kernel_ctx, state->grouper->num_groups()));
-      RETURN_NOT_OK(agg_kernels_[i]->consume(&kernel_ctx, agg_batch));
+    if (streaming_) {
+      std::lock_guard<std::mutex> lock(streaming_mutex_);
+      return ConsumeSegments(batch);
     }
 
-    return Status::OK();
+    auto state = &local_states_[thread_index];
+    RETURN_NOT_OK(InitLocalStateIfNeeded(state));
+    return ConsumeBatch(state, batch, key_field_ids_, agg_src_field_ids_);
   }
 
   Status Merge() {
@@ -445,28 +465,8 @@ class GroupByNode : public ExecNode {
     ThreadLocalState* state = &local_states_[0];
     // If we never got any batches, then state won't have been initialized
     RETURN_NOT_OK(InitLocalStateIfNeeded(state));
-
-    ExecBatch out_data{{}, state->grouper->num_groups()};
-    out_data.values.resize(agg_kernels_.size() + key_field_ids_.size());
-
-    // Aggregate fields come before key fields to match the behavior of GroupBy function
-    for (size_t i = 0; i < agg_kernels_.size(); ++i) {
-      util::tracing::Span span;
-      START_COMPUTE_SPAN(span, aggs_[i].function,
-                         {{"function.name", aggs_[i].function},
-                          {"function.options",
-                           aggs_[i].options ? aggs_[i].options->ToString() : "<NULLPTR>"},
-                          {"function.kind", std::string(kind_name()) + "::Finalize"}});
-      KernelContext batch_ctx{ctx_};
-      batch_ctx.SetState(state->agg_states[i].get());
-      RETURN_NOT_OK(agg_kernels_[i]->finalize(&batch_ctx, &out_data.values[i]));
-      state->agg_states[i].reset();
-    }
-
-    ARROW_ASSIGN_OR_RAISE(ExecBatch out_keys, state->grouper->GetUniques());
-    std::move(out_keys.values.begin(), out_keys.values.end(),
-              out_data.values.begin() + agg_kernels_.size());
-    state->grouper.reset();
+    ARROW_ASSIGN_OR_RAISE(ExecBatch out_data,
+                          FinalizeState(state, state->grouper->num_groups()));
 
     if (output_counter_.SetTotal(
             static_cast<int>(bit_util::CeilDiv(out_data.length, output_batch_size())))) {
@@ -481,14 +481,161 @@ class GroupByNode : public ExecNode {
     if (finished_.is_finished()) return;
 
     int64_t batch_size = output_batch_size();
-    outputs_[0]->InputReceived(this, out_data_.Slice(batch_size * n, batch_size));
+    EmitBatch(out_data_.Slice(batch_size * n, batch_size));
 
     if (output_counter_.Increment()) {
       finished_.MarkFinished();
     }
   }
 
+  // Aggregate the spilled input one partition at a time, so that only the groups of a
+  // single partition are held in memory.  Each partition's result is output as soon as
+  // it has been finalized.
+  Status OutputSpilledResult() {
+    RETURN_NOT_OK(spill_partitioner_->Finish());
+    RecordSpilledBytes(spill_partitioner_->bytes_spilled());
+
+    // Keys come first in the spilled batches, followed by the aggregate arguments
+    const int num_keys = static_cast<int>(key_field_ids_.size());
+    std::vector<int> key_field_ids(num_keys);
+    std::vector<int> agg_src_field_ids(agg_src_field_ids_.size());
+    for (int i = 0; i < num_keys; ++i) {
+      key_field_ids[i] = i;
+    }
+    for (size_t i = 0; i < agg_src_field_ids.size(); ++i) {
+      agg_src_field_ids[i] = num_keys + static_cast<int>(i);
+    }
+
+    const int64_t batch_size = output_batch_size();
+    int num_output_batches = 0;
+    for (int prtn = 0; prtn < spill_partitioner_->num_partitions(); ++prtn) {
+      // bail if StopProducing was called
+      if (finished_.is_finished()) return Status::OK();
+      if (spill_partitioner_->num_rows(prtn) == 0) continue;
+
+      ARROW_ASSIGN_OR_RAISE(util::AccumulationQueue batches,
+                            spill_partitioner_->TakePartition(prtn));
+      ThreadLocalState state;
+      RETURN_NOT_OK(InitLocalStateIfNeeded(&state));
+      for (size_t i = 0; i < batches.batch_count(); ++i) {
+        RETURN_NOT_OK(ConsumeBatch(&state, batches[i], key_field_ids, agg_src_field_ids));
+      }
+      batches.Clear();
+      ARROW_ASSIGN_OR_RAISE(ExecBatch out_data,
+                            FinalizeState(&state, state.grouper->num_groups()));
+      for (int64_t offset = 0; offset < out_data.length; offset += batch_size) {
+        EmitBatch(out_data.Slice(offset, batch_size));
+        ++num_output_batches;
+        ARROW_UNUSED(output_counter_.Increment());
+      }
+    }
+
+    outputs_[0]->InputFinished(this, num_output_batches);
+    if (output_counter_.SetTotal(num_output_batches)) {
+      finished_.MarkFinished();
+    }
+    return Status::OK();
+  }
+
+  // Aggregate a batch of an input ordered on the keys.  Only the group of the last row
+  // may continue in the next batch, all the other groups are complete and are output.
+  Status ConsumeSegments(const ExecBatch& batch) {
+    ThreadLocalState* state = &streaming_state_;
+    RETURN_NOT_OK(InitLocalStateIfNeeded(state));
+    if (batch.length == 0) return Status::OK();
+
+    // The groups already output must not appear again.  Only the key of the last one is
+    // kept, which catches a group interrupted by another one without holding the keys
+    // of every group output.
+    if (emitted_grouper_ != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(
+          Datum emitted_ids,
+          emitted_grouper_->Consume(MakeKeyBatch(batch, key_field_ids_)));
+      const uint32_t* emitted = emitted_ids.array()->GetValues<uint32_t>(1);
+      if (std::find(emitted, emitted + batch.length, 0u) != emitted + batch.length) {
+        return Status::Invalid(
+            "Input of a streaming group by is not ordered on the keys: a group appeared "
+            "again after it was output");
+      }
+    }
+
+    ARROW_ASSIGN_OR_RAISE(Datum id_batch, ConsumeKeys(state, batch, key_field_ids_));
+    // The grouper numbers groups in order of appearance, so as long as the groups are
+    // contiguous the ids never decrease
+    const uint32_t* ids = id_batch.array()->GetValues<uint32_t>(1);
+    for (int64_t i = 1; i < batch.length; ++i) {
+      if (ids[i] < ids[i - 1]) {
+        return Status::Invalid(
+            "Input of a streaming group by is not ordered on the keys");
+      }
+    }
+    const uint32_t open_group = ids[batch.length - 1];
+    if (open_group == 0) {
+      return ConsumeAggregates(state, batch, agg_src_field_ids_, id_batch,
+                               /*num_groups=*/1);
+    }
+
+    int64_t open_start = batch.length - 1;
+    while (open_start > 0 && ids[open_start - 1] == open_group) {
+      --open_start;
+    }
+    if (open_start > 0) {
+      RETURN_NOT_OK(ConsumeAggregates(
+          state, batch.Slice(0, open_start), agg_src_field_ids_,
+          id_batch.array()->Slice(0, open_start), open_group));
+    }
+    ARROW_ASSIGN_OR_RAISE(ExecBatch out_data, FinalizeState(state, open_group));
+    ExecBatch out_keys(std::vector<Datum>(out_data.values.begin() + agg_kernels_.size(),
+                                          out_data.values.end()),
+                       out_data.length);
+    ARROW_ASSIGN_OR_RAISE(emitted_grouper_, Grouper::Make(KeyDescrs(), ctx_));
+    RETURN_NOT_OK(emitted_grouper_->Consume(out_keys.Slice(open_group - 1, 1)).status());
+    RETURN_NOT_OK(OutputSegments(out_data));
+
+    // Start over with the rows of the group which is still open
+    RETURN_NOT_OK(InitLocalStateIfNeeded(state));
+    return ConsumeBatch(state, batch.Slice(open_start, batch.length - open_start),
+                        key_field_ids_, agg_src_field_ids_);
+  }
+
+  Status OutputSegments(const ExecBatch& out_data) {
+    const int64_t batch_size = output_batch_size();
+    for (int64_t offset = 0; offset < out_data.length; offset += batch_size) {
+      // bail if StopProducing was called
+      if (finished_.is_finished()) return Status::OK();
+      EmitBatch(out_data.Slice(offset, batch_size));
+      ++num_output_batches_;
+      ARROW_UNUSED(output_counter_.Increment());
+    }
+    return Status::OK();
+  }
+
+  // Output the last group of a streaming aggregation
+  Status OutputStreamingResult() {
+    {
+      std::lock_guard<std::mutex> lock(streaming_mutex_);
+      ThreadLocalState* state = &streaming_state_;
+      if (state->grouper != nullptr && state->grouper->num_groups() > 0) {
+        ARROW_ASSIGN_OR_RAISE(ExecBatch out_data,
+                              FinalizeState(state, state->grouper->num_groups()));
+        RETURN_NOT_OK(OutputSegments(out_data));
+      }
+    }
+
+    outputs_[0]->InputFinished(this, num_output_batches_);
+    if (output_counter_.SetTotal(num_output_batches_)) {
+      finished_.MarkFinished();
+    }
+    return Status::OK();
+  }
+
   Status OutputResult() {
+    if (spill_partitioner_) {
+      return OutputSpilledResult();
+    }
+    if (streaming_) {
+      return OutputStreamingResult();
+    }
     RETURN_NOT_OK(Merge());
     ARROW_ASSIGN_OR_RAISE(out_data_, Finalize());
 
@@ -502,7 +649,9 @@ class GroupByNode : public ExecNode {
         if (finished_.is_finished()) break;
 
         auto plan = this->plan()->shared_from_this();
-        RETURN_NOT_OK(executor->Spawn([plan, this, i] { OutputNthBatch(i); }));
+        // Emitting the results releases the hash table, do it before new input
+        RETURN_NOT_OK(executor->Spawn(plan->MakeTaskHints(/*urgency=*/1),
+                                      [plan, this, i] { OutputNthBatch(i); }));
       } else {
         OutputNthBatch(i);
       }
@@ -561,6 +710,30 @@ class GroupByNode : public ExecNode {
     END_SPAN_ON_FUTURE_COMPLETION(span_, finished_, this);
 
     local_states_.resize(ThreadIndexer::Capacity());
+
+    if (spill_memory_limit_ > 0) {
+      if (plan_->memory_governor()) {
+        // Share the plan's memory limit with the other nodes that spill
+        spill_reservation_ = plan_->memory_governor()->Reserve(spill_memory_limit_);
+        spill_memory_limit_ = spill_reservation_.bytes();
+      }
+      const auto& input_schema = inputs_[0]->output_schema();
+      FieldVector spill_fields;
+      std::vector<int> spill_key_ids;
+      for (int field_id : key_field_ids_) {
+        spill_key_ids.push_back(static_cast<int>(spill_fields.size()));
+        spill_fields.push_back(input_schema->field(field_id));
+      }
+      for (int field_id : agg_src_field_ids_) {
+        spill_fields.push_back(input_schema->field(field_id));
+      }
+      ARROW_ASSIGN_OR_RAISE(spill_dir_,
+                            arrow::internal::TemporaryDir::Make("arrow-groupby-spill-"));
+      spill_partitioner_ = ::arrow::internal::make_unique<SpillingPartitioner>();
+      RETURN_NOT_OK(spill_partitioner_->Init(
+          ctx_, schema(std::move(spill_fields)), std::move(spill_key_ids),
+          kLogSpillPartitions, spill_memory_limit_, spill_dir_->path(), "groupby"));
+    }
     return Status::OK();
   }
 
@@ -609,26 +782,33 @@ class GroupByNode : public ExecNode {
     std::vector<std::unique_ptr<KernelState>> agg_states;
   };
 
+  // The input of a spilling aggregation is split into 2^kLogSpillPartitions partitions
+  static constexpr int kLogSpillPartitions = 5;
+
   ThreadLocalState* GetLocalState() {
     size_t thread_index = get_thread_index_();
     return &local_states_[thread_index];
   }
 
-  Status InitLocalStateIfNeeded(ThreadLocalState* state) {
-    // Get input schema
+  // The data types of the key fields
+  std::vector<ValueDescr> KeyDescrs() const {
     auto input_schema = inputs_[0]->output_schema();
-
-    if (state->grouper != nullptr) return Status::OK();
-
-    // Build vector of key field data types
     std::vector<ValueDescr> key_descrs(key_field_ids_.size());
     for (size_t i = 0; i < key_field_ids_.size(); ++i) {
       auto key_field_id = key_field_ids_[i];
       key_descrs[i] = ValueDescr(input_schema->field(key_field_id)->type());
     }
+    return key_descrs;
+  }
+
+  Status InitLocalStateIfNeeded(ThreadLocalState* state) {
+    // Get input schema
+    auto input_schema = inputs_[0]->output_schema();
+
+    if (state->grouper != nullptr) return Status::OK();
 
     // Construct grouper
-    ARROW_ASSIGN_OR_RAISE(state->grouper, Grouper::Make(key_descrs, ctx_));
+    ARROW_ASSIGN_OR_RAISE(state->grouper, Grouper::Make(KeyDescrs(), ctx_));
 
     // Build vector of aggregate source field data types
     std::vector<ValueDescr> agg_src_descrs(agg_kernels_.size());
@@ -645,6 +825,90 @@ class GroupByNode : public ExecNode {
     return Status::OK();
   }
 
+  Status ConsumeBatch(ThreadLocalState* state, const ExecBatch& batch,
+                      const std::vector<int>& key_field_ids,
+                      const std::vector<int>& agg_src_field_ids) {
+    ARROW_ASSIGN_OR_RAISE(Datum id_batch, ConsumeKeys(state, batch, key_field_ids));
+    return ConsumeAggregates(state, batch, agg_src_field_ids, id_batch,
+                             state->grouper->num_groups());
+  }
+
+  // Compute the group ids of a batch
+  Result<Datum> ConsumeKeys(ThreadLocalState* state, const ExecBatch& batch,
+                            const std::vector<int>& key_field_ids) {
+    // Create a batch with group ids
+    return state->grouper->Consume(MakeKeyBatch(batch, key_field_ids));
+  }
+
+  // Create a batch with the key columns of a batch
+  static ExecBatch MakeKeyBatch(const ExecBatch& batch,
+                                const std::vector<int>& key_field_ids) {
+    std::vector<Datum> keys(key_field_ids.size());
+    for (size_t i = 0; i < key_field_ids.size(); ++i) {
+      keys[i] = batch.values[key_field_ids[i]];
+    }
+    ExecBatch key_batch(std::move(keys), batch.length);
+    // The grouper uses the key hashes computed upstream if they are those of its keys
+    key_batch.key_hashes = batch.key_hashes;
+    return key_batch;
+  }
+
+  // Update the aggregate states of the first num_groups groups
+  Status ConsumeAggregates(ThreadLocalState* state, const ExecBatch& batch,
+                           const std::vector<int>& agg_src_field_ids,
+                           const Datum& id_batch, int64_t num_groups) {
+    // Execute aggregate kernels
+    for (size_t i = 0; i < agg_kernels_.size(); ++i) {
+      util::tracing::Span span;
+      START_COMPUTE_SPAN(span, aggs_[i].function,
+                         {{"function.name", aggs_[i].function},
+                          {"function.options",
+                           aggs_[i].options ? aggs_[i].options->ToString() : "<NULLPTR>"},
+                          {"function.kind", std::string(kind_name()) + "::Consume"}});
+      KernelContext kernel_ctx{ctx_};
+      kernel_ctx.SetState(state->agg_states[i].get());
+
+      ARROW_ASSIGN_OR_RAISE(
+          auto agg_batch,
+          ExecBatch::Make({batch.values[agg_src_field_ids[i]], id_batch}));
+
+      RETURN_NOT_OK(agg_kernels_[i]->resize(&kernel_ctx, num_groups));
+      RETURN_NOT_OK(agg_kernels_[i]->consume(&kernel_ctx, agg_batch));
+    }
+
+    return Status::OK();
+  }
+
+  // Finalize the first num_groups groups (the aggregate states must not hold any other
+  // groups) and reset the state
+  Result<ExecBatch> FinalizeState(ThreadLocalState* state, int64_t num_groups) {
+    ExecBatch out_data{{}, num_groups};
+    out_data.values.resize(agg_kernels_.size() + key_field_ids_.size());
+
+    // Aggregate fields come before key fields to match the behavior of GroupBy function
+    for (size_t i = 0; i < agg_kernels_.size(); ++i) {
+      util::tracing::Span span;
+      START_COMPUTE_SPAN(span, aggs_[i].function,
+                         {{"function.name", aggs_[i].function},
+                          {"function.options",
+                           aggs_[i].options ? aggs_[i].options->ToString() : "<NULLPTR>"},
+                          {"function.kind", std::string(kind_name()) + "::Finalize"}});
+      KernelContext batch_ctx{ctx_};
+      batch_ctx.SetState(state->agg_states[i].get());
+      RETURN_NOT_OK(agg_kernels_[i]->finalize(&batch_ctx, &out_data.values[i]));
+      state->agg_states[i].reset();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(ExecBatch out_keys, state->grouper->GetUniques());
+    if (out_keys.length > num_groups) {
+      out_keys = out_keys.Slice(0, num_groups);
+    }
+    std::move(out_keys.values.begin(), out_keys.values.end(),
+              out_data.values.begin() + agg_kernels_.size());
+    state->grouper.reset();
+    return out_data;
+  }
+
   int output_batch_size() const {
     int result = static_cast<int>(ctx_->exec_chunksize());
     if (result < 0) {
@@ -665,6 +929,19 @@ class GroupByNode : public ExecNode {
 
   std::vector<ThreadLocalState> local_states_;
   ExecBatch out_data_;
+
+  int64_t spill_memory_limit_;
+  // Held while running if the plan has a memory limit
+  MemoryReservation spill_reservation_;
+  std::unique_ptr<arrow::internal::TemporaryDir> spill_dir_;
+  std::unique_ptr<SpillingPartitioner> spill_partitioner_;
+
+  const bool streaming_;
+  std::mutex streaming_mutex_;
+  ThreadLocalState streaming_state_;
+  // The key of the last group output by a streaming aggregation
+  std::unique_ptr<Grouper> emitted_grouper_;
+  int num_output_batches_ = 0;
 };
 
 }  // namespace
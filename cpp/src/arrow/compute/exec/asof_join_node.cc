@@ -15,10 +15,13 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
+#include <limits>
+#include <map>
 #include <mutex>
 #include <set>
-#include <thread>
 #include <unordered_map>
 
 #include "arrow/array/builder_primitive.h"
@@ -29,10 +32,12 @@
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/async_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/make_unique.h"
 #include "arrow/util/optional.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace compute {
@@ -45,6 +50,14 @@ typedef int32_t KeyType;
 typedef uint64_t row_index_t;
 typedef int col_index_t;
 
+// Rows queued for an input above which the input is paused, and at or below which it is
+// resumed
+constexpr int64_t kPauseInputAboveRows = 1 << 20;
+constexpr int64_t kResumeInputBelowRows = 1 << 19;
+
+// Time of an input before its first row
+constexpr int64_t kNoTime = std::numeric_limits<int64_t>::min();
+
 /**
  * Simple implementation for an unbound concurrent queue
  */
@@ -137,18 +150,29 @@ struct MemoStore {
   }
 };
 
+// The rows of an input batch in the partition of an InputState
+struct PartitionBatch {
+  std::shared_ptr<RecordBatch> batch;
+  // Indices of the rows of the partition in the batch, in order
+  std::vector<row_index_t> rows;
+  // Index of the batch in its input
+  int seq;
+};
+
 class InputState {
-  // InputState correponds to an input
+  // InputState correponds to an input, for the keys of a partition
   // Input record batches are queued up in InputState until processed and
   // turned into output record batches.
 
  public:
   InputState(const std::shared_ptr<arrow::Schema>& schema,
-             const std::string& time_col_name, const std::string& key_col_name)
+             const std::string& time_col_name, const std::string& key_col_name,
+             std::atomic<int64_t>* pending_rows)
       : queue_(),
         schema_(schema),
         time_col_index_(schema->GetFieldIndex(time_col_name)),
-        key_col_index_(schema->GetFieldIndex(key_col_name)) {}
+        key_col_index_(schema->GetFieldIndex(key_col_name)),
+        pending_rows_(pending_rows) {}
 
   col_index_t InitSrcToDstMapping(col_index_t dst_offset, bool skip_time_and_key_fields) {
     src_to_dst_.resize(schema_->num_fields());
@@ -167,8 +191,19 @@ class InputState {
     return (i == time_col_index_) || (i == key_col_index_);
   }
 
-  // Gets the latest row index,  assuming the queue isn't empty
-  row_index_t GetLatestRow() const { return latest_ref_row_; }
+  // Gets the latest row index in its batch, assuming the queue isn't empty
+  row_index_t GetLatestRow() const { return queue_.UnsyncFront()->rows[latest_ref_row_]; }
+
+  // Whether the latest row is the first, or the last, of the partition in its batch
+  bool AtFirstRowOfBatch() const { return latest_ref_row_ == 0; }
+  bool AtLastRowOfBatch() const {
+    return latest_ref_row_ + 1 == queue_.UnsyncFront()->rows.size();
+  }
+
+  // Number of rows of the partition in the latest batch
+  row_index_t GetLatestBatchSize() const { return queue_.UnsyncFront()->rows.size(); }
+
+  int GetLatestSeq() const { return queue_.UnsyncFront()->seq; }
 
   bool Empty() const {
     // cannot be empty if ref row is >0 -- can avoid slow queue lock
@@ -181,19 +216,17 @@ class InputState {
 
   // Gets latest batch (precondition: must not be empty)
   const std::shared_ptr<arrow::RecordBatch>& GetLatestBatch() const {
-    return queue_.UnsyncFront();
+    return queue_.UnsyncFront()->batch;
   }
 
   KeyType GetLatestKey() const {
-    return queue_.UnsyncFront()
-        ->column_data(key_col_index_)
-        ->GetValues<KeyType>(1)[latest_ref_row_];
+    return GetLatestBatch()->column_data(key_col_index_)->GetValues<KeyType>(
+        1)[GetLatestRow()];
   }
 
   int64_t GetLatestTime() const {
-    return queue_.UnsyncFront()
-        ->column_data(time_col_index_)
-        ->GetValues<int64_t>(1)[latest_ref_row_];
+    return GetLatestBatch()->column_data(time_col_index_)->GetValues<int64_t>(
+        1)[GetLatestRow()];
   }
 
   bool Finished() const { return batches_processed_ == total_batches_; }
@@ -206,13 +239,14 @@ class InputState {
 
     if (have_active_batch) {
       // If we have an active batch
-      if (++latest_ref_row_ >= (row_index_t)queue_.UnsyncFront()->num_rows()) {
+      if (++latest_ref_row_ >= GetLatestBatchSize()) {
         // hit the end of the batch, need to get the next batch if possible.
+        *pending_rows_ -= static_cast<int64_t>(GetLatestBatchSize());
         ++batches_processed_;
         latest_ref_row_ = 0;
         have_active_batch &= !queue_.TryPop();
         if (have_active_batch)
-          DCHECK_GT(queue_.UnsyncFront()->num_rows(), 0);  // empty batches disallowed
+          DCHECK_GT(GetLatestBatchSize(), 0);  // empty batches disallowed
       }
     }
     return have_active_batch;
@@ -240,7 +274,7 @@ class InputState {
       // timestamp <= ts. This is because we only need the latest row for the
       // match given a left ts.
       if (latest_time <= ts) {
-        memo_.Store(GetLatestBatch(), latest_ref_row_, latest_time, GetLatestKey());
+        memo_.Store(GetLatestBatch(), GetLatestRow(), latest_time, GetLatestKey());
       } else {
         break;  // hit a future timestamp -- done updating for now
       }
@@ -249,9 +283,9 @@ class InputState {
     return updated;
   }
 
-  void Push(const std::shared_ptr<arrow::RecordBatch>& rb) {
-    if (rb->num_rows() > 0) {
-      queue_.Push(rb);
+  void Push(const std::shared_ptr<PartitionBatch>& batch) {
+    if (!batch->rows.empty()) {
+      queue_.Push(batch);
     } else {
       ++batches_processed_;  // don't enqueue empty batches, just record as processed
     }
@@ -284,20 +318,23 @@ class InputState {
 
  private:
   // Pending record batches. The latest is the front. Batches cannot be empty.
-  ConcurrentQueue<std::shared_ptr<RecordBatch>> queue_;
+  ConcurrentQueue<std::shared_ptr<PartitionBatch>> queue_;
   // Schema associated with the input
   std::shared_ptr<Schema> schema_;
   // Total number of batches (only int because InputFinished uses int)
-  int total_batches_ = -1;
+  std::atomic<int> total_batches_{-1};
   // Number of batches processed so far (only int because InputFinished uses int)
-  int batches_processed_ = 0;
+  std::atomic<int> batches_processed_{0};
   // Index of the time col
   col_index_t time_col_index_;
   // Index of the key col
   col_index_t key_col_index_;
-  // Index of the latest row reference within; if >0 then queue_ cannot be empty
-  // Must be < queue_.front()->num_rows() if queue_ is non-empty
+  // Index of the latest row reference within the rows of the front batch; if >0 then
+  // queue_ cannot be empty
+  // Must be < queue_.front()->rows.size() if queue_ is non-empty
   row_index_t latest_ref_row_ = 0;
+  // Rows queued for the input in all the partitions, decremented as they are processed
+  std::atomic<int64_t>* pending_rows_;
   // Stores latest known values for the various keys
   MemoStore memo_;
   // Mapping of source columns to destination columns
@@ -348,10 +385,10 @@ class CompositeReferenceTable {
     const std::shared_ptr<arrow::RecordBatch>& lhs_latest_batch = in[0]->GetLatestBatch();
     row_index_t lhs_latest_row = in[0]->GetLatestRow();
     int64_t lhs_latest_time = in[0]->GetLatestTime();
-    if (0 == lhs_latest_row) {
+    if (in[0]->AtFirstRowOfBatch()) {
       // On the first row of the batch, we resize the destination.
       // The destination size is dictated by the size of the LHS batch.
-      row_index_t new_batch_size = lhs_latest_batch->num_rows();
+      row_index_t new_batch_size = in[0]->GetLatestBatchSize();
       row_index_t new_capacity = rows_.size() + new_batch_size;
       if (rows_.capacity() < new_capacity) rows_.reserve(new_capacity);
     }
@@ -444,6 +481,24 @@ class CompositeReferenceTable {
   // Returns true if there are no rows
   bool empty() const { return rows_.empty(); }
 
+  // Sets the number of rows, for the rows of the partitions of an LHS batch to be
+  // scattered to
+  void Resize(size_t n_rows) { rows_.resize(n_rows); }
+
+  // Moves the rows of a partition of an LHS batch to the positions of their LHS rows,
+  // leaving the partition table empty
+  void Scatter(CompositeReferenceTable* part) {
+    for (const auto& row : part->rows_) {
+      DCHECK_LT(row.refs[0].row, rows_.size());
+      rows_[row.refs[0].row] = row;
+    }
+    for (auto& ref : part->_ptr2ref) {
+      _ptr2ref.insert(std::move(ref));
+    }
+    part->rows_.clear();
+    part->_ptr2ref.clear();
+  }
+
  private:
   // Contains shared_ptr refs for all RecordBatches referred to by the contents of rows_
   std::unordered_map<uintptr_t, std::shared_ptr<RecordBatch>> _ptr2ref;
@@ -480,133 +535,276 @@ class CompositeReferenceTable {
 };
 
 class AsofJoinNode : public ExecNode {
-  // Advances the RHS as far as possible to be up to date for the current LHS timestamp
-  bool UpdateRhs() {
-    auto& lhs = *state_.at(0);
-    auto lhs_latest_time = lhs.GetLatestTime();
+  // The inputs are partitioned by key, and the partitions are processed independently
+  // on the executor. The rows matched by the partitions for an LHS batch are assembled
+  // back in the order of the batch, and the output batches are emitted in the order of
+  // the LHS batches.
+
+  // The state of all the inputs for the keys of a partition
+  struct Partition {
+    explicit Partition(size_t n_tables) : dst(n_tables) {}
+
+    // One per input
+    std::vector<std::unique_ptr<InputState>> state;
+    // Rows matched for the LHS batch in progress
+    CompositeReferenceTable<MAX_JOIN_TABLES> dst;
+    // Number of requests to process the partition, it is processed by one task at a time
+    std::atomic<int> requests{0};
+  };
+
+  // The progress of an input, for all the partitions
+  struct InputProgress {
+    // Ensures the batches of the input are partitioned in order
+    std::mutex mutex;
+    int batches_received = 0;
+    col_index_t time_col_index;
+    col_index_t key_col_index;
+    // Time of the last row received. The later rows are not older, so a partition which
+    // processed all its rows has seen all the rows up to this time.
+    std::atomic<int64_t> watermark{kNoTime};
+    // Rows received and not yet processed by all the partitions
+    std::atomic<int64_t> pending_rows{0};
+    // Guarded by backpressure_mutex_
+    bool paused = false;
+    int32_t backpressure_counter = 0;
+  };
+
+  // An LHS batch being assembled from the rows matched by the partitions
+  struct PendingOutput {
+    PendingOutput(size_t n_tables, int64_t n_rows, int n_partitions)
+        : rows(n_tables), remaining_partitions(n_partitions) {
+      rows.Resize(static_cast<size_t>(n_rows));
+    }
+
+    CompositeReferenceTable<MAX_JOIN_TABLES> rows;
+    // Partitions with rows of the batch that have not yet matched them
+    int remaining_partitions;
+    // The materialized rows, null if the batch is empty
+    std::shared_ptr<RecordBatch> batch;
+    bool ready = false;
+  };
+
+  // Advances the RHS as far as possible to be up to date for the given LHS timestamp
+  static bool UpdateRhs(const Partition& part, int64_t lhs_latest_time) {
     bool any_updated = false;
-    for (size_t i = 1; i < state_.size(); ++i)
-      any_updated |= state_[i]->AdvanceAndMemoize(lhs_latest_time);
+    for (size_t i = 1; i < part.state.size(); ++i)
+      any_updated |= part.state[i]->AdvanceAndMemoize(lhs_latest_time);
     return any_updated;
   }
 
-  // Returns false if RHS not up to date for LHS
-  bool IsUpToDateWithLhsRow() const {
-    auto& lhs = *state_[0];
-    if (lhs.Empty()) return false;  // can't proceed if nothing on the LHS
-    int64_t lhs_ts = lhs.GetLatestTime();
-    for (size_t i = 1; i < state_.size(); ++i) {
-      auto& rhs = *state_[i];
+  // Returns false if RHS not up to date for the LHS timestamp
+  //
+  // The watermarks of the inputs must be read before the RHS is updated: an RHS with no
+  // rows left in the partition is up to date if the input received a later row.
+  static bool IsUpToDateWithLhsRow(const Partition& part, int64_t lhs_ts,
+                                   const std::vector<int64_t>& watermarks) {
+    for (size_t i = 1; i < part.state.size(); ++i) {
+      auto& rhs = *part.state[i];
       if (!rhs.Finished()) {
         // If RHS is finished, then we know it's up to date
-        if (rhs.Empty())
-          return false;  // RHS isn't finished, but is empty --> not up to date
-        if (lhs_ts >= rhs.GetLatestTime())
+        if (rhs.Empty()) {
+          // RHS isn't finished, but is empty --> not up to date unless there are no
+          // rows of the partition to come up to the LHS timestamp
+          if (watermarks[i] <= lhs_ts) return false;
+        } else if (lhs_ts >= rhs.GetLatestTime()) {
           return false;  // RHS isn't up to date (and not finished)
+        }
       }
     }
     return true;
   }
 
-  Result<std::shared_ptr<RecordBatch>> ProcessInner() {
-    DCHECK(!state_.empty());
-    auto& lhs = *state_.at(0);
-
-    // Construct new target table if needed
-    CompositeReferenceTable<MAX_JOIN_TABLES> dst(state_.size());
+  Status ProcessPartition(Partition* part) {
+    auto& lhs = *part->state.at(0);
+    std::vector<int64_t> watermarks(part->state.size());
 
-    // Generate rows into the dst table until we either run out of data or hit the row
-    // limit, or run out of input
+    // Generate rows into the dst table until we run out of input, handing the rows
+    // over at the end of each LHS batch
     for (;;) {
-      // If LHS is finished or empty then there's nothing we can do here
-      if (lhs.Finished() || lhs.Empty()) break;
+      for (size_t i = 0; i < watermarks.size(); ++i) {
+        watermarks[i] = progress_[i]->watermark.load();
+      }
+
+      // If LHS is finished or empty then there's nothing we can match here
+      if (lhs.Empty()) {
+        // The next LHS rows are not older than the latest one received, so the RHS can
+        // be advanced up to it already (which lets their queues drain)
+        if (watermarks[0] != kNoTime) UpdateRhs(*part, watermarks[0]);
+        break;
+      }
 
       // Advance each of the RHS as far as possible to be up to date for the LHS timestamp
-      bool any_rhs_advanced = UpdateRhs();
-
-      // If we have received enough inputs to produce the next output batch
-      // (decided by IsUpToDateWithLhsRow), we will perform the join and
-      // materialize the output batch. The join is done by advancing through
-      // the LHS and adding joined row to rows_ (done by Emplace). Finally,
-      // input batches that are no longer needed are removed to free up memory.
-      if (IsUpToDateWithLhsRow()) {
-        dst.Emplace(state_, options_.tolerance);
-        if (!lhs.Advance()) break;  // if we can't advance LHS, we're done for this batch
+      int64_t lhs_ts = lhs.GetLatestTime();
+      bool any_rhs_advanced = UpdateRhs(*part, lhs_ts);
+
+      // If we have received enough inputs to match the next LHS row (decided by
+      // IsUpToDateWithLhsRow), we add the joined row to dst (done by Emplace). Once
+      // all the rows of the partition in the LHS batch are matched, they are assembled
+      // with those of the other partitions.
+      if (IsUpToDateWithLhsRow(*part, lhs_ts, watermarks)) {
+        part->dst.Emplace(part->state, options_.tolerance);
+        int seq = lhs.GetLatestSeq();
+        bool end_of_batch = lhs.AtLastRowOfBatch();
+        bool advanced = lhs.Advance();
+        if (end_of_batch) {
+          RETURN_NOT_OK(OutputRows(seq, &part->dst));
+        }
+        if (!advanced) break;  // if we can't advance LHS, we're done for this batch
       } else {
         if (!any_rhs_advanced) break;  // need to wait for new data
       }
     }
 
     // Prune memo entries that have expired (to bound memory consumption)
-    if (!lhs.Empty()) {
-      for (size_t i = 1; i < state_.size(); ++i) {
-        state_[i]->RemoveMemoEntriesWithLesserTime(lhs.GetLatestTime() -
-                                                   options_.tolerance);
+    int64_t lhs_time = lhs.Empty() ? watermarks[0] : lhs.GetLatestTime();
+    if (lhs_time != kNoTime) {
+      for (size_t i = 1; i < part->state.size(); ++i) {
+        part->state[i]->RemoveMemoEntriesWithLesserTime(lhs_time - options_.tolerance);
       }
     }
+    return Status::OK();
+  }
 
-    // Emit the batch
-    if (dst.empty()) {
-      return NULLPTR;
-    } else {
-      return dst.Materialize(output_schema(), state_);
+  // Runs the requests to process a partition, until there are no new ones
+  void RunPartition(Partition* part) {
+    int requests = part->requests.load();
+    do {
+      if (!complete_.load()) {
+        Status status = ProcessPartition(part);
+        if (!status.ok()) {
+          StopProducing();
+          ErrorIfNotOk(status);
+        }
+        UpdateBackpressure();
+      }
+      requests = part->requests.fetch_sub(requests) - requests;
+    } while (requests > 0);
+  }
+
+  // Requests the processing of all the partitions, since new rows on any input may
+  // let any partition progress
+  void SchedulePartitions() {
+    auto executor = plan_->exec_context()->executor();
+    for (auto& part : partitions_) {
+      if (part->requests.fetch_add(1) > 0) {
+        continue;  // already being processed, it will run the request
+      }
+      Partition* partition = part.get();
+      if (executor) {
+        Status status = task_group_.AddTaskIfNotEnded([this, executor, partition] {
+          return DeferNotOk(
+              executor->Submit([this, partition] { RunPartition(partition); }));
+        });
+        if (!status.ok()) {
+          StopProducing();
+          ErrorIfNotOk(status);
+          return;
+        }
+      } else {
+        RunPartition(partition);
+      }
     }
   }
 
-  void Process() {
-    std::lock_guard<std::mutex> guard(gate_);
-    if (finished_.is_finished()) {
-      return;
+  // Pauses the inputs with too many rows queued, and resumes them once they are
+  // processed, or once the output finished
+  //
+  // Must not be called with a lock held, since resuming an input may deliver its next
+  // batch in the calling thread.
+  void UpdateBackpressure() {
+    for (size_t k = 0; k < progress_.size(); ++k) {
+      auto& progress = *progress_[k];
+      bool pause;
+      int32_t counter;
+      {
+        std::lock_guard<std::mutex> guard(backpressure_mutex_);
+        int64_t pending_rows = progress.pending_rows.load();
+        if (!progress.paused && !complete_.load() &&
+            pending_rows > kPauseInputAboveRows) {
+          pause = true;
+        } else if (progress.paused &&
+                   (complete_.load() || pending_rows <= kResumeInputBelowRows)) {
+          pause = false;
+        } else {
+          continue;
+        }
+        progress.paused = pause;
+        counter = ++progress.backpressure_counter;
+      }
+      // The counter orders the calls made concurrently
+      if (pause) {
+        inputs_[k]->PauseProducing(this, counter);
+      } else {
+        inputs_[k]->ResumeProducing(this, counter);
+      }
     }
+  }
 
-    // Process batches while we have data
-    for (;;) {
-      Result<std::shared_ptr<RecordBatch>> result = ProcessInner();
+  // Hands over the rows matched by a partition for an LHS batch, and emits the batch
+  // once all the partitions did
+  Status OutputRows(int seq, CompositeReferenceTable<MAX_JOIN_TABLES>* part_rows) {
+    CompositeReferenceTable<MAX_JOIN_TABLES> rows(partitions_[0]->state.size());
+    {
+      std::lock_guard<std::mutex> guard(output_mutex_);
+      auto& output = pending_outputs_.at(seq);
+      output.rows.Scatter(part_rows);
+      if (--output.remaining_partitions > 0) return Status::OK();
+      rows = std::move(output.rows);
+    }
+    // Materialized out of the lock, the output batches may be in progress in parallel
+    ARROW_ASSIGN_OR_RAISE(auto batch,
+                          rows.Materialize(output_schema(), partitions_[0]->state));
+
+    std::lock_guard<std::mutex> guard(output_mutex_);
+    auto& output = pending_outputs_.at(seq);
+    output.batch = std::move(batch);
+    output.ready = true;
+    EmitReadyOutputs();
+    return Status::OK();
+  }
 
-      if (result.ok()) {
-        auto out_rb = *result;
-        if (!out_rb) break;
+  // Emits the batches which are ready, in order, and finishes after the last LHS batch
+  // (called with output_mutex_ held)
+  void EmitReadyOutputs() {
+    while (!pending_outputs_.empty()) {
+      auto it = pending_outputs_.begin();
+      if (it->first != next_output_seq_ || !it->second.ready) break;
+      if (it->second.batch && !complete_.load()) {
         ++batches_produced_;
-        ExecBatch out_b(*out_rb);
-        outputs_[0]->InputReceived(this, std::move(out_b));
-      } else {
-        StopProducing();
-        ErrorIfNotOk(result.status());
-        return;
+        EmitBatch(ExecBatch(*it->second.batch));
       }
+      pending_outputs_.erase(it);
+      ++next_output_seq_;
     }
 
     // Report to the output the total batch count, if we've already finished everything
-    // (there are two places where this can happen: here and InputFinished)
-    //
-    // It may happen here in cases where InputFinished was called before we were finished
-    // producing results (so we didn't know the output size at that time)
-    if (state_.at(0)->Finished()) {
-      StopProducing();
-      outputs_[0]->InputFinished(this, batches_produced_);
+    // (the LHS batch count is known once InputFinished was called on the LHS)
+    if (next_output_seq_ == lhs_total_batches_) {
+      bool expected = false;
+      if (complete_.compare_exchange_strong(expected, true)) {
+        // The paused inputs are resumed by the next UpdateBackpressure, to finish
+        outputs_[0]->InputFinished(this, batches_produced_);
+        ARROW_UNUSED(task_group_.End());
+      }
     }
   }
 
-  void ProcessThread() {
-    for (;;) {
-      if (!process_.Pop()) {
-        return;
-      }
-      Process();
+  // Indices of the rows of a batch in each partition
+  std::vector<std::vector<row_index_t>> PartitionRows(const RecordBatch& batch,
+                                                      col_index_t key_col_index) const {
+    std::vector<std::vector<row_index_t>> rows(partitions_.size());
+    const KeyType* keys = batch.column_data(key_col_index)->GetValues<KeyType>(1);
+    for (int64_t i = 0; i < batch.num_rows(); ++i) {
+      uint64_t hash = static_cast<uint32_t>(keys[i]) * 0x9E3779B97F4A7C15ULL;
+      rows[(hash >> 32) % partitions_.size()].push_back(static_cast<row_index_t>(i));
     }
+    return rows;
   }
 
-  static void ProcessThreadWrapper(AsofJoinNode* node) { node->ProcessThread(); }
-
  public:
   AsofJoinNode(ExecPlan* plan, NodeVector inputs, std::vector<std::string> input_labels,
                const AsofJoinNodeOptions& join_options,
-               std::shared_ptr<Schema> output_schema);
-
-  virtual ~AsofJoinNode() {
-    process_.Push(false);  // poison pill
-    process_thread_.join();
-  }
+               std::shared_ptr<Schema> output_schema, size_t num_partitions);
 
   static arrow::Result<std::shared_ptr<Schema>> MakeOutputSchema(
       const std::vector<ExecNode*>& inputs, const AsofJoinNodeOptions& options) {
@@ -669,70 +867,129 @@ class AsofJoinNode : public ExecNode {
       input_labels[i] = "right_" + std::to_string(i);
     }
 
+    // One partition per thread of the executor, or all the keys processed in the
+    // calling threads without one
+    size_t num_partitions = 1;
+    if (auto executor = plan->exec_context()->executor()) {
+      num_partitions = static_cast<size_t>(std::max(executor->GetCapacity(), 1));
+    }
+
     return plan->EmplaceNode<AsofJoinNode>(plan, inputs, std::move(input_labels),
-                                           join_options, std::move(output_schema));
+                                           join_options, std::move(output_schema),
+                                           num_partitions);
   }
 
   const char* kind_name() const override { return "AsofJoinNode"; }
 
   void InputReceived(ExecNode* input, ExecBatch batch) override {
+    if (complete_.load()) return;
+
     // Get the input
     ARROW_DCHECK(std::find(inputs_.begin(), inputs_.end(), input) != inputs_.end());
     size_t k = std::find(inputs_.begin(), inputs_.end(), input) - inputs_.begin();
 
-    // Put into the queue
+    // Put the rows of each partition into its queue
     auto rb = *batch.ToRecordBatch(input->output_schema());
-    state_.at(k)->Push(rb);
-    process_.Push(true);
+    {
+      auto& progress = *progress_[k];
+      std::lock_guard<std::mutex> guard(progress.mutex);
+      int seq = progress.batches_received++;
+      auto rows = PartitionRows(*rb, progress.key_col_index);
+      if (k == 0) {
+        int n_partitions = 0;
+        for (const auto& part_rows : rows) n_partitions += !part_rows.empty();
+        std::lock_guard<std::mutex> output_guard(output_mutex_);
+        auto& output =
+            pending_outputs_
+                .emplace(std::piecewise_construct, std::forward_as_tuple(seq),
+                         std::forward_as_tuple(state_size(), rb->num_rows(),
+                                               n_partitions))
+                .first->second;
+        if (n_partitions == 0) {
+          // Nothing to match, only emitted in order
+          output.ready = true;
+          EmitReadyOutputs();
+        }
+      }
+      progress.pending_rows += rb->num_rows();
+      for (size_t p = 0; p < partitions_.size(); ++p) {
+        partitions_[p]->state[k]->Push(std::make_shared<PartitionBatch>(
+            PartitionBatch{rb, std::move(rows[p]), seq}));
+      }
+      // Published after the rows, see IsUpToDateWithLhsRow
+      if (rb->num_rows() > 0) {
+        progress.watermark.store(rb->column_data(progress.time_col_index)
+                                     ->GetValues<int64_t>(1)[rb->num_rows() - 1]);
+      }
+    }
+    UpdateBackpressure();
+    SchedulePartitions();
   }
   void ErrorReceived(ExecNode* input, Status error) override {
     outputs_[0]->ErrorReceived(this, std::move(error));
     StopProducing();
   }
   void InputFinished(ExecNode* input, int total_batches) override {
-    {
-      std::lock_guard<std::mutex> guard(gate_);
-      ARROW_DCHECK(std::find(inputs_.begin(), inputs_.end(), input) != inputs_.end());
-      size_t k = std::find(inputs_.begin(), inputs_.end(), input) - inputs_.begin();
-      state_.at(k)->set_total_batches(total_batches);
+    ARROW_DCHECK(std::find(inputs_.begin(), inputs_.end(), input) != inputs_.end());
+    size_t k = std::find(inputs_.begin(), inputs_.end(), input) - inputs_.begin();
+    for (auto& part : partitions_) {
+      part->state.at(k)->set_total_batches(total_batches);
+    }
+    if (k == 0) {
+      {
+        std::lock_guard<std::mutex> guard(output_mutex_);
+        lhs_total_batches_ = total_batches;
+        EmitReadyOutputs();
+      }
+      UpdateBackpressure();
     }
     // Trigger a process call
     // The reason for this is that there are cases at the end of a table where we don't
     // know whether the RHS of the join is up-to-date until we know that the table is
     // finished.
-    process_.Push(true);
-  }
-  Status StartProducing() override {
-    finished_ = arrow::Future<>::Make();
-    return Status::OK();
+    SchedulePartitions();
   }
+  Status StartProducing() override { return Status::OK(); }
   void PauseProducing(ExecNode* output, int32_t counter) override {}
   void ResumeProducing(ExecNode* output, int32_t counter) override {}
   void StopProducing(ExecNode* output) override {
     DCHECK_EQ(output, outputs_[0]);
     StopProducing();
   }
-  void StopProducing() override { finished_.MarkFinished(); }
-  arrow::Future<> finished() override { return finished_; }
+  void StopProducing() override {
+    bool expected = false;
+    if (complete_.compare_exchange_strong(expected, true)) {
+      for (auto&& input : inputs_) {
+        input->StopProducing(this);
+      }
+      ARROW_UNUSED(task_group_.End());
+    }
+  }
+  arrow::Future<> finished() override { return task_group_.OnFinished(); }
 
  private:
+  size_t state_size() const { return inputs_.size(); }
+
   static const std::set<std::shared_ptr<DataType>> kSupportedOnTypes_;
   static const std::set<std::shared_ptr<DataType>> kSupportedByTypes_;
   static const std::set<std::shared_ptr<DataType>> kSupportedDataTypes_;
 
-  arrow::Future<> finished_;
-  // InputStates
-  // Each input state correponds to an input table
-  std::vector<std::unique_ptr<InputState>> state_;
-  std::mutex gate_;
   AsofJoinNodeOptions options_;
-
-  // Queue for triggering processing of a given input
-  // (a false value is a poison pill)
-  ConcurrentQueue<bool> process_;
-  // Worker thread
-  std::thread process_thread_;
-
+  // One per input
+  std::vector<std::unique_ptr<InputProgress>> progress_;
+  // Each partition holds an input state per input table, for its keys
+  std::vector<std::unique_ptr<Partition>> partitions_;
+  // Set once the output finished, or on StopProducing
+  std::atomic<bool> complete_{false};
+  util::AsyncTaskGroup task_group_;
+  std::mutex backpressure_mutex_;
+
+  // Guards the outputs below
+  std::mutex output_mutex_;
+  // By index of the LHS batch
+  std::map<int, PendingOutput> pending_outputs_;
+  int next_output_seq_ = 0;
+  int lhs_total_batches_ = -1;
   // In-progress batches produced
   int batches_produced_ = 0;
 };
@@ -740,21 +997,29 @@ class AsofJoinNode : public ExecNode {
 AsofJoinNode::AsofJoinNode(ExecPlan* plan, NodeVector inputs,
                            std::vector<std::string> input_labels,
                            const AsofJoinNodeOptions& join_options,
-                           std::shared_ptr<Schema> output_schema)
+                           std::shared_ptr<Schema> output_schema, size_t num_partitions)
     : ExecNode(plan, inputs, input_labels,
                /*output_schema=*/std::move(output_schema),
                /*num_outputs=*/1),
-      options_(join_options),
-      process_(),
-      process_thread_(&AsofJoinNode::ProcessThreadWrapper, this) {
-  for (size_t i = 0; i < inputs.size(); ++i)
-    state_.push_back(::arrow::internal::make_unique<InputState>(
-        inputs[i]->output_schema(), *options_.on_key.name(), *options_.by_key.name()));
-  col_index_t dst_offset = 0;
-  for (auto& state : state_)
-    dst_offset = state->InitSrcToDstMapping(dst_offset, !!dst_offset);
-
-  finished_ = arrow::Future<>::MakeFinished();
+      options_(join_options) {
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    auto progress = ::arrow::internal::make_unique<InputProgress>();
+    const auto& schema = inputs[i]->output_schema();
+    progress->time_col_index = schema->GetFieldIndex(*options_.on_key.name());
+    progress->key_col_index = schema->GetFieldIndex(*options_.by_key.name());
+    progress_.push_back(std::move(progress));
+  }
+  for (size_t p = 0; p < num_partitions; ++p) {
+    auto part = ::arrow::internal::make_unique<Partition>(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i)
+      part->state.push_back(::arrow::internal::make_unique<InputState>(
+          inputs[i]->output_schema(), *options_.on_key.name(), *options_.by_key.name(),
+          &progress_[i]->pending_rows));
+    col_index_t dst_offset = 0;
+    for (auto& state : part->state)
+      dst_offset = state->InitSrcToDstMapping(dst_offset, !!dst_offset);
+    partitions_.push_back(std::move(part));
+  }
 }
 
 // Currently supported types
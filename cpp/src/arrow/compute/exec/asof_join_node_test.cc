@@ -19,6 +19,7 @@
 
 #include <numeric>
 #include <random>
+#include <sstream>
 #include <unordered_set>
 
 #include "arrow/api.h"
@@ -74,6 +75,27 @@ void CheckRunOutput(const BatchesWithSchema& l_batches,
                     /*same_chunk_layout=*/true, /*flatten=*/true);
 }
 
+Result<std::shared_ptr<Table>> RunJoin(const BatchesWithSchema& l_batches,
+                                       const BatchesWithSchema& r0_batches,
+                                       const BatchesWithSchema& r1_batches,
+                                       const std::shared_ptr<Schema>& out_schema,
+                                       ::arrow::internal::Executor* executor,
+                                       int64_t tolerance) {
+  ExecContext exec_ctx(default_memory_pool(), executor);
+  ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make(&exec_ctx));
+
+  Declaration join{"asofjoin", AsofJoinNodeOptions("time", "key", tolerance)};
+  for (const auto* batches : {&l_batches, &r0_batches, &r1_batches}) {
+    join.inputs.emplace_back(Declaration{
+        "source", SourceNodeOptions{batches->schema, batches->gen(false, false)}});
+  }
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+  RETURN_NOT_OK(Declaration::Sequence({join, {"sink", SinkNodeOptions{&sink_gen}}})
+                    .AddToPlan(plan.get()));
+  ARROW_ASSIGN_OR_RAISE(auto res, StartAndCollect(plan.get(), sink_gen).result());
+  return TableFromExecBatches(out_schema, res);
+}
+
 void DoRunBasicTest(const std::vector<util::string_view>& l_data,
                     const std::vector<util::string_view>& r0_data,
                     const std::vector<util::string_view>& r1_data,
@@ -275,6 +297,41 @@ TEST(AsofJoinTest, TestEmpty5) {
                  {R"([])"}, 1000);
 }
 
+TEST(AsofJoinTest, TestParallelMatchesSerial) {
+  // Many keys, matched by the partitions of a multi-threaded executor. Each input is a
+  // single batch, since the batches of a source may be delivered out of order then.
+  auto make_input = [](const std::string& value_name, int64_t num_rows, uint32_t seed) {
+    std::default_random_engine rng(seed);
+    std::uniform_int_distribution<int> time_step(0, 3), key(0, 99);
+    std::stringstream json;
+    json << "[";
+    int64_t time = 0;
+    for (int64_t i = 0; i < num_rows; ++i) {
+      time += time_step(rng);
+      json << (i ? ", " : "") << "[" << time << ", " << key(rng) << ", " << i << "]";
+    }
+    json << "]";
+    auto schema = arrow::schema(
+        {field("time", int64()), field("key", int32()), field(value_name, float64())});
+    return MakeBatchesFromString(schema, {json.str()});
+  };
+  auto l_batches = make_input("l_v0", 5000, 1);
+  auto r0_batches = make_input("r0_v0", 3000, 2);
+  auto r1_batches = make_input("r1_v0", 8000, 3);
+  auto out_schema =
+      schema({field("time", int64()), field("key", int32()), field("l_v0", float64()),
+              field("r0_v0", float64()), field("r1_v0", float64())});
+
+  ASSERT_OK_AND_ASSIGN(auto expected, RunJoin(l_batches, r0_batches, r1_batches,
+                                              out_schema, nullptr, /*tolerance=*/20));
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, arrow::internal::ThreadPool::Make(4));
+  ASSERT_OK_AND_ASSIGN(auto actual, RunJoin(l_batches, r0_batches, r1_batches,
+                                            out_schema, thread_pool.get(), 20));
+  ASSERT_EQ(expected->num_rows(), 5000);
+  // The rows are in the order of the LHS
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
 TEST(AsofJoinTest, TestUnsupportedOntype) {
   DoRunInvalidTypeTest(
       schema({field("time", utf8()), field("key", int32()), field("l_v0", float64())}),
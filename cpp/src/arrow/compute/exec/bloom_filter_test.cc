@@ -203,9 +203,9 @@ void TestBloomSmall(BloomFilterBuildStrategy strategy, int64_t num_build,
     Hashing32::HashFixed(hardware_flags, /*combine_hashes=*/false, batch_size, key_length,
                          reinterpret_cast<const uint8_t*>(unique_keys.data() + i),
                          hashes32.data() + i, nullptr);
-    Hashing64::HashFixed(
-        /*combine_hashes=*/false, batch_size, key_length,
-        reinterpret_cast<const uint8_t*>(unique_keys.data() + i), hashes64.data() + i);
+    Hashing64::HashFixed(hardware_flags, /*combine_hashes=*/false, batch_size, key_length,
+                         reinterpret_cast<const uint8_t*>(unique_keys.data() + i),
+                         hashes64.data() + i);
   }
 
   MemoryPool* pool = default_memory_pool();
@@ -308,7 +308,7 @@ void TestBloomLargeHashHelper(int64_t hardware_flags, int64_t block,
                            reinterpret_cast<const uint8_t*>(keys),
                            reinterpret_cast<uint32_t*>(output_hashes) + ibase, nullptr);
     } else {
-      Hashing64::HashFixed(false, next_batch_size, key_length,
+      Hashing64::HashFixed(hardware_flags, false, next_batch_size, key_length,
                            reinterpret_cast<const uint8_t*>(keys),
                            reinterpret_cast<uint64_t*>(output_hashes) + ibase);
     }
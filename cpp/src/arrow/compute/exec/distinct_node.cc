@@ -0,0 +1,260 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <mutex>
+#include <sstream>
+
+#include "arrow/array/array_primitive.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/compute/row/grouper.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace {
+
+// Emits the rows whose keys are seen for the first time.  The keys seen so far are the
+// groups of a single grouper, so the batches are consumed one at a time; only the
+// gathering of the new rows runs in parallel.
+class DistinctNode : public ExecNode {
+ public:
+  DistinctNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+               std::shared_ptr<Schema> output_schema, std::vector<int> key_ids,
+               std::unique_ptr<Grouper> grouper)
+      : ExecNode(plan, inputs, {"input"}, std::move(output_schema),
+                 /*num_outputs=*/1),
+        key_ids_(std::move(key_ids)),
+        grouper_(std::move(grouper)) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "DistinctNode"));
+    const auto& distinct_options = checked_cast<const DistinctNodeOptions&>(options);
+
+    const auto& input_schema = *inputs[0]->output_schema();
+    std::vector<int> key_ids;
+    if (distinct_options.keys.empty()) {
+      for (int i = 0; i < input_schema.num_fields(); ++i) {
+        key_ids.push_back(i);
+      }
+    }
+    for (const auto& key : distinct_options.keys) {
+      ARROW_ASSIGN_OR_RAISE(auto match, key.FindOne(input_schema));
+      if (match.indices().size() > 1) {
+        return Status::NotImplemented("DistinctNode does not support nested keys, got ",
+                                      key.ToString());
+      }
+      key_ids.push_back(match[0]);
+    }
+    if (key_ids.empty()) {
+      return Status::Invalid("DistinctNode requires at least one key");
+    }
+
+    FieldVector fields(key_ids.size());
+    std::vector<ValueDescr> key_descrs(key_ids.size());
+    for (size_t i = 0; i < key_ids.size(); ++i) {
+      fields[i] = input_schema.field(key_ids[i]);
+      key_descrs[i] = ValueDescr::Array(fields[i]->type());
+    }
+    ARROW_ASSIGN_OR_RAISE(auto grouper, Grouper::Make(key_descrs, plan->exec_context()));
+    return plan->EmplaceNode<DistinctNode>(plan, std::move(inputs),
+                                           schema(std::move(fields)),
+                                           std::move(key_ids), std::move(grouper));
+  }
+
+  const char* kind_name() const override { return "DistinctNode"; }
+
+  void InputReceived(ExecNode* input, ExecBatch batch) override {
+    EVENT(span_, "InputReceived", {{"batch.length", batch.length}});
+    DCHECK_EQ(input, inputs_[0]);
+
+    auto distinct = SelectNewKeys(batch);
+    if (ErrorIfNotOk(distinct.status())) {
+      return;
+    }
+    if (distinct->length > 0) {
+      EmitBatch(distinct.MoveValueUnsafe());
+      if (output_counter_.Increment()) {
+        finished_.MarkFinished();
+      }
+    }
+    if (input_counter_.Increment()) {
+      InputExhausted();
+    }
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    EVENT(span_, "ErrorReceived", {{"error", error.message()}});
+    DCHECK_EQ(input, inputs_[0]);
+    outputs_[0]->ErrorReceived(this, std::move(error));
+    StopProducing();
+  }
+
+  void InputFinished(ExecNode* input, int total_batches) override {
+    EVENT(span_, "InputFinished", {{"batches.length", total_batches}});
+    DCHECK_EQ(input, inputs_[0]);
+    if (input_counter_.SetTotal(total_batches)) {
+      InputExhausted();
+    }
+  }
+
+  Status StartProducing() override {
+    START_COMPUTE_SPAN(span_, std::string(kind_name()) + ":" + label(),
+                       {{"node.label", label()},
+                        {"node.detail", ToString()},
+                        {"node.kind", kind_name()}});
+    finished_ = Future<>::Make();
+    END_SPAN_ON_FUTURE_COMPLETION(span_, finished_, this);
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  void StopProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    StopProducing();
+  }
+
+  void StopProducing() override {
+    EVENT(span_, "StopProducing");
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+    }
+    if (output_counter_.Cancel()) {
+      finished_.MarkFinished();
+    }
+    inputs_[0]->StopProducing(this);
+  }
+
+  Future<> finished() override { return finished_; }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    ss << "keys=[";
+    for (size_t i = 0; i < key_ids_.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << '"' << output_schema_->field(static_cast<int>(i))->name() << '"';
+    }
+    ss << ']';
+    return ss.str();
+  }
+
+ private:
+  // The key columns of the rows of `batch` whose keys were not seen before, at most one
+  // row per key
+  Result<ExecBatch> SelectNewKeys(const ExecBatch& batch) {
+    ExecBatch keys({}, batch.length);
+    for (int key_id : key_ids_) {
+      keys.values.push_back(batch.values[key_id]);
+    }
+    keys.key_hashes = batch.key_hashes;
+
+    std::vector<int32_t> new_rows;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_ || batch.length == 0) {
+        return ExecBatch({}, 0);
+      }
+      const uint32_t num_groups = grouper_->num_groups();
+      ARROW_ASSIGN_OR_RAISE(Datum ids, grouper_->Consume(keys));
+      const uint32_t num_new_groups = grouper_->num_groups() - num_groups;
+      if (num_new_groups == 0) {
+        return ExecBatch({}, 0);
+      }
+      // The first row of each new group
+      const uint32_t* group_ids = ids.array()->GetValues<uint32_t>(1);
+      std::vector<bool> selected(num_new_groups, false);
+      new_rows.reserve(num_new_groups);
+      for (int64_t i = 0; i < batch.length; ++i) {
+        if (group_ids[i] >= num_groups && !selected[group_ids[i] - num_groups]) {
+          selected[group_ids[i] - num_groups] = true;
+          new_rows.push_back(static_cast<int32_t>(i));
+        }
+      }
+      ++batches_output_;
+    }
+
+    const auto num_new_rows = static_cast<int64_t>(new_rows.size());
+    if (num_new_rows == batch.length) {
+      return keys;
+    }
+    keys.key_hashes.reset();
+    Int32Array indices(num_new_rows, Buffer::Wrap(new_rows));
+    for (Datum& key : keys.values) {
+      if (key.is_scalar()) continue;
+      ARROW_ASSIGN_OR_RAISE(key, Take(key, indices, TakeOptions::NoBoundsCheck(),
+                                      plan()->exec_context()));
+    }
+    keys.length = num_new_rows;
+    return keys;
+  }
+
+  // Called once every input batch has been processed
+  void InputExhausted() {
+    int total_batches;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      total_batches = batches_output_;
+    }
+    outputs_[0]->InputFinished(this, total_batches);
+    if (output_counter_.SetTotal(total_batches)) {
+      finished_.MarkFinished();
+    }
+  }
+
+  const std::vector<int> key_ids_;
+
+  std::mutex mutex_;
+  std::unique_ptr<Grouper> grouper_;
+  int batches_output_ = 0;
+  bool stopped_ = false;
+
+  AtomicCounter input_counter_;
+  // Counts batches emitted downstream, so that the node only finishes once none of them
+  // are still being pushed
+  AtomicCounter output_counter_;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterDistinctNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory("distinct", DistinctNode::Make));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,146 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+#include "arrow/api.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/matchers.h"
+
+namespace arrow {
+namespace compute {
+
+class DistinctNodeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    schema_ = schema({field("k", int32()), field("s", utf8()), field("a", int64())});
+    input_ = MakeBatchesFromString(
+        schema_, {R"([[1, "x", 0], [2, "y", 1], [1, "x", 2]])", R"([])",
+                  R"([[2, "y", 3], [3, null, 4], [1, "z", 5]])",
+                  R"([[null, null, 6], [3, null, 7]])"});
+  }
+
+  // Run a source followed by `decls`, counting the batches pulled from the source
+  Result<std::vector<ExecBatch>> Run(const BatchesWithSchema& input,
+                                     std::vector<Declaration> decls, bool parallel) {
+    ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make());
+    auto gen = input.gen(parallel, /*slow=*/false);
+    auto pulls = &pulls_;
+    pulls_ = 0;
+    AsyncGenerator<util::optional<ExecBatch>> counting_gen = [gen, pulls] {
+      ++*pulls;
+      return gen();
+    };
+    decls.insert(decls.begin(),
+                 Declaration{"source", SourceNodeOptions{input.schema, counting_gen}});
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    decls.emplace_back(Declaration{"sink", SinkNodeOptions{&sink_gen}});
+    ARROW_RETURN_NOT_OK(Declaration::Sequence(std::move(decls)).AddToPlan(plan.get()));
+    auto collected = StartAndCollect(plan.get(), sink_gen).result();
+    ARROW_RETURN_NOT_OK(collected.status());
+    return collected.MoveValueUnsafe();
+  }
+
+  void CheckDistinct(std::vector<FieldRef> keys,
+                     const std::shared_ptr<Schema>& expected_schema,
+                     const std::string& expected_json) {
+    for (bool parallel : {false, true}) {
+      ARROW_SCOPED_TRACE(parallel ? "parallel" : "serial");
+      ASSERT_OK_AND_ASSIGN(
+          auto batches, Run(input_, {{"distinct", DistinctNodeOptions(keys)}}, parallel));
+      ASSERT_OK_AND_ASSIGN(auto actual, TableFromExecBatches(expected_schema, batches));
+      ASSERT_OK_AND_ASSIGN(auto sorted_indices,
+                           SortIndices(actual, SortOptions(SortKeys(expected_schema))));
+      ASSERT_OK_AND_ASSIGN(Datum sorted, Take(actual, sorted_indices));
+      auto expected = TableFromJSON(expected_schema, {expected_json});
+      AssertTablesEqual(*expected, *sorted.table(), /*same_chunk_layout=*/false);
+    }
+  }
+
+  static std::vector<SortKey> SortKeys(const std::shared_ptr<Schema>& schema) {
+    std::vector<SortKey> sort_keys;
+    for (const auto& field : schema->fields()) {
+      sort_keys.emplace_back(field->name());
+    }
+    return sort_keys;
+  }
+
+  std::shared_ptr<Schema> schema_;
+  BatchesWithSchema input_;
+  std::atomic<int> pulls_{0};
+};
+
+TEST_F(DistinctNodeTest, Keys) {
+  CheckDistinct({"k"}, schema({field("k", int32())}), "[[1], [2], [3], [null]]");
+  CheckDistinct({"s", "k"}, schema({field("s", utf8()), field("k", int32())}),
+                R"([["x", 1], ["y", 2], ["z", 1], [null, 3], [null, null]])");
+}
+
+TEST_F(DistinctNodeTest, AllColumns) {
+  BatchesWithSchema input = input_;
+  for (auto& batch : input.batches) {
+    batch.values.pop_back();
+  }
+  input.schema = schema({field("k", int32()), field("s", utf8())});
+  ASSERT_OK_AND_ASSIGN(auto batches,
+                       Run(input, {{"distinct", DistinctNodeOptions()}}, false));
+  ASSERT_OK_AND_ASSIGN(auto actual, TableFromExecBatches(input.schema, batches));
+  ASSERT_EQ(actual->num_rows(), 5);
+}
+
+TEST_F(DistinctNodeTest, EmitsEarly) {
+  // Each batch with new keys is emitted as soon as it is received
+  ASSERT_OK_AND_ASSIGN(auto batches,
+                       Run(input_, {{"distinct", DistinctNodeOptions({"k"})}}, false));
+  ASSERT_EQ(batches.size(), 3);
+  ASSERT_EQ(batches[0].length, 2);
+  ASSERT_EQ(batches[1].length, 1);
+  ASSERT_EQ(batches[2].length, 1);
+
+  // With a fetch, the input is only read until enough distinct keys were seen
+  constexpr int kNumBatches = 1000;
+  BatchesWithSchema many;
+  many.schema = schema_;
+  for (int i = 0; i < kNumBatches; ++i) {
+    many.batches.push_back(input_.batches[i % 4]);
+  }
+  ASSERT_OK_AND_ASSIGN(batches, Run(many,
+                                    {{"distinct", DistinctNodeOptions({"k"})},
+                                     {"fetch", FetchNodeOptions(0, 3)}},
+                                    false));
+  ASSERT_OK_AND_ASSIGN(auto actual,
+                       TableFromExecBatches(schema({field("k", int32())}), batches));
+  ASSERT_EQ(actual->num_rows(), 3);
+  ASSERT_LT(pulls_.load(), 10);
+}
+
+TEST_F(DistinctNodeTest, Errors) {
+  ASSERT_RAISES(Invalid, Run(input_, {{"distinct", DistinctNodeOptions({"missing"})}},
+                             false));
+  BatchesWithSchema empty;
+  empty.schema = schema({});
+  ASSERT_RAISES(Invalid, Run(empty, {{"distinct", DistinctNodeOptions()}}, false));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,270 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <sstream>
+
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/partition_util.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/compute/light_array.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace {
+
+// Partitions at most this many ways, the limit of PartitionSort
+constexpr int kMaxExchangePartitions = 1 << 15;
+
+class ExchangeNode : public ExecNode {
+ public:
+  ExchangeNode(ExecPlan* plan, std::vector<ExecNode*> inputs, std::vector<int> key_ids,
+               int num_partitions)
+      : ExecNode(plan, inputs, {"input"},
+                 /*output_schema=*/inputs[0]->output_schema(), num_partitions),
+        key_ids_(std::move(key_ids)),
+        batches_output_(num_partitions),
+        output_stopped_(num_partitions, false),
+        output_paused_(num_partitions, false),
+        output_counters_(num_partitions, std::numeric_limits<int32_t>::min()) {
+    for (auto& count : batches_output_) {
+      count.store(0);
+    }
+  }
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "ExchangeNode"));
+    const auto& exchange_options = checked_cast<const ExchangeNodeOptions&>(options);
+    if (exchange_options.num_partitions < 1 ||
+        exchange_options.num_partitions > kMaxExchangePartitions) {
+      return Status::Invalid("ExchangeNode num_partitions must be between 1 and ",
+                             kMaxExchangePartitions, ", got ",
+                             exchange_options.num_partitions);
+    }
+    if (exchange_options.keys.empty()) {
+      return Status::Invalid("ExchangeNode requires at least one key");
+    }
+
+    const auto& input_schema = *inputs[0]->output_schema();
+    std::vector<int> key_ids(exchange_options.keys.size());
+    for (size_t i = 0; i < key_ids.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto match, exchange_options.keys[i].FindOne(input_schema));
+      if (match.indices().size() > 1) {
+        return Status::NotImplemented("ExchangeNode does not support nested keys, got ",
+                                      exchange_options.keys[i].ToString());
+      }
+      key_ids[i] = match[0];
+      const auto& type = input_schema.field(key_ids[i])->type();
+      if (!ColumnMetadataFromDataType(type).ok()) {
+        return Status::NotImplemented("ExchangeNode can not partition on keys of type ",
+                                      *type);
+      }
+    }
+    return plan->EmplaceNode<ExchangeNode>(plan, std::move(inputs), std::move(key_ids),
+                                           exchange_options.num_partitions);
+  }
+
+  const char* kind_name() const override { return "ExchangeNode"; }
+
+  void InputReceived(ExecNode* input, ExecBatch batch) override {
+    EVENT(span_, "InputReceived", {{"batch.length", batch.length}});
+    DCHECK_EQ(input, inputs_[0]);
+
+    auto partitions = HashPartitionBatch(plan()->exec_context(), batch, key_ids_,
+                                         num_outputs());
+    if (ErrorIfNotOk(partitions.status())) {
+      return;
+    }
+    for (int i = 0; i < num_outputs(); ++i) {
+      ExecBatch& partition = (*partitions)[i];
+      if (partition.length == 0 || IsOutputStopped(i)) {
+        continue;
+      }
+      EmitBatch(outputs_[i], std::move(partition));
+      batches_output_[i].fetch_add(1);
+    }
+    if (input_counter_.Increment()) {
+      FinishOutputs();
+    }
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    EVENT(span_, "ErrorReceived", {{"error", error.message()}});
+    DCHECK_EQ(input, inputs_[0]);
+    for (auto* output : outputs_) {
+      output->ErrorReceived(this, error);
+    }
+    StopProducing();
+  }
+
+  void InputFinished(ExecNode* input, int total_batches) override {
+    EVENT(span_, "InputFinished", {{"batches.length", total_batches}});
+    DCHECK_EQ(input, inputs_[0]);
+    if (input_counter_.SetTotal(total_batches)) {
+      FinishOutputs();
+    }
+  }
+
+  Status StartProducing() override {
+    START_COMPUTE_SPAN(span_, std::string(kind_name()) + ":" + label(),
+                       {{"node.label", label()},
+                        {"node.detail", ToString()},
+                        {"node.kind", kind_name()}});
+    finished_ = Future<>::Make();
+    END_SPAN_ON_FUTURE_COMPLETION(span_, finished_, this);
+    return Status::OK();
+  }
+
+  // The input is paused while any output is paused
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    UpdateBackpressure(OutputIndex(output), /*paused=*/true, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    UpdateBackpressure(OutputIndex(output), /*paused=*/false, counter);
+  }
+
+  // The input is only stopped once no output needs any more rows
+  void StopProducing(ExecNode* output) override {
+    EVENT(span_, "StopProducing");
+    const int index = OutputIndex(output);
+    bool all_stopped;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      output_stopped_[index] = true;
+      all_stopped = std::all_of(output_stopped_.begin(), output_stopped_.end(),
+                                [](bool stopped) { return stopped; });
+    }
+    if (all_stopped) {
+      StopProducing();
+    } else {
+      // A stopped output no longer applies backpressure
+      UpdateBackpressure(index, /*paused=*/false, std::numeric_limits<int32_t>::max());
+    }
+  }
+
+  void StopProducing() override {
+    EVENT(span_, "StopProducing");
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::fill(output_stopped_.begin(), output_stopped_.end(), true);
+    }
+    if (input_counter_.Cancel()) {
+      finished_.MarkFinished();
+    }
+    inputs_[0]->StopProducing(this);
+  }
+
+  Future<> finished() override { return finished_; }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    ss << "keys=[";
+    for (size_t i = 0; i < key_ids_.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << '"' << inputs_[0]->output_schema()->field(key_ids_[i])->name() << '"';
+    }
+    ss << "], num_partitions=" << num_outputs();
+    return ss.str();
+  }
+
+ private:
+  int OutputIndex(ExecNode* output) const {
+    auto it = std::find(outputs_.begin(), outputs_.end(), output);
+    DCHECK(it != outputs_.end());
+    return static_cast<int>(it - outputs_.begin());
+  }
+
+  bool IsOutputStopped(int index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return output_stopped_[index];
+  }
+
+  void UpdateBackpressure(int index, bool paused, int32_t counter) {
+    bool pause_input = false;
+    bool resume_input = false;
+    int32_t input_counter;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // Signals from one output may arrive out of order, the latest counter wins
+      if (counter <= output_counters_[index]) {
+        return;
+      }
+      output_counters_[index] = counter;
+      output_paused_[index] = paused && !output_stopped_[index];
+      const bool any_paused = std::any_of(output_paused_.begin(), output_paused_.end(),
+                                          [](bool p) { return p; });
+      if (any_paused != input_paused_) {
+        input_paused_ = any_paused;
+        pause_input = any_paused;
+        resume_input = !any_paused;
+        input_counter = ++backpressure_counter_;
+      }
+    }
+    if (pause_input) {
+      inputs_[0]->PauseProducing(this, input_counter);
+    } else if (resume_input) {
+      inputs_[0]->ResumeProducing(this, input_counter);
+    }
+  }
+
+  // Called once every input batch has been partitioned
+  void FinishOutputs() {
+    for (int i = 0; i < num_outputs(); ++i) {
+      outputs_[i]->InputFinished(this, batches_output_[i].load());
+    }
+    finished_.MarkFinished();
+  }
+
+  const std::vector<int> key_ids_;
+
+  AtomicCounter input_counter_;
+  std::vector<std::atomic<int>> batches_output_;
+
+  std::mutex mutex_;
+  std::vector<bool> output_stopped_;
+  std::vector<bool> output_paused_;
+  std::vector<int32_t> output_counters_;
+  bool input_paused_ = false;
+  int32_t backpressure_counter_ = 0;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterExchangeNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory("exchange", ExchangeNode::Make));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
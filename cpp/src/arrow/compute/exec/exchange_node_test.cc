@@ -0,0 +1,333 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <set>
+#include <string>
+
+#include "arrow/api.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/key_hash.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/partition_util.h"
+#include "arrow/compute/exec/test_util.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/testing/builder.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/matchers.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+namespace compute {
+
+class ExchangeNodeTest : public ::testing::Test {
+ protected:
+  static constexpr int kNumPartitions = 4;
+
+  void SetUp() override {
+    schema_ = schema({field("k", int32()), field("s", utf8()), field("a", int64())});
+    // 17 distinct (k, s) groups spread over batches of varying length
+    std::vector<std::string> json_batches;
+    int row = 0;
+    for (int batch = 0; batch < 20; ++batch) {
+      std::string json = "[";
+      for (int i = 0; i < batch % 7 * 5; ++i, ++row) {
+        if (i > 0) json += ", ";
+        json += "[" + std::to_string(row % 17) + ", \"s" + std::to_string(row % 17 % 3) +
+                "\", " + std::to_string(row) + "]";
+      }
+      json += "]";
+      json_batches.push_back(std::move(json));
+    }
+    std::vector<util::string_view> views(json_batches.begin(), json_batches.end());
+    input_ = MakeBatchesFromString(schema_, views);
+  }
+
+  // Run source -> exchange, with a sink for each partition
+  Result<std::vector<std::shared_ptr<Table>>> RunExchange(ExecContext* exec_ctx,
+                                                          bool parallel) {
+    ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make(exec_ctx));
+    ARROW_ASSIGN_OR_RAISE(
+        auto source,
+        MakeExecNode("source", plan.get(), {},
+                     SourceNodeOptions{schema_, input_.gen(parallel, /*slow=*/false)}));
+    ARROW_ASSIGN_OR_RAISE(
+        auto exchange,
+        MakeExecNode("exchange", plan.get(), {source},
+                     ExchangeNodeOptions({"k", "s"}, kNumPartitions)));
+    std::vector<AsyncGenerator<util::optional<ExecBatch>>> sink_gens(kNumPartitions);
+    for (auto& sink_gen : sink_gens) {
+      RETURN_NOT_OK(MakeExecNode("sink", plan.get(), {exchange},
+                                 SinkNodeOptions{&sink_gen}));
+    }
+    RETURN_NOT_OK(plan->Validate());
+    RETURN_NOT_OK(plan->StartProducing());
+
+    std::vector<std::shared_ptr<Table>> tables;
+    for (auto& sink_gen : sink_gens) {
+      auto collected_fut = CollectAsyncGenerator(sink_gen);
+      ARROW_ASSIGN_OR_RAISE(auto collected, collected_fut.result());
+      std::vector<ExecBatch> batches;
+      for (auto& batch : collected) {
+        batches.push_back(std::move(*batch));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto table, TableFromExecBatches(schema_, batches));
+      tables.push_back(std::move(table));
+    }
+    auto finished = plan->finished();
+    RETURN_NOT_OK(finished.status());
+    return tables;
+  }
+
+  std::shared_ptr<Schema> schema_;
+  BatchesWithSchema input_;
+};
+
+constexpr int ExchangeNodeTest::kNumPartitions;
+
+TEST_F(ExchangeNodeTest, PartitionsByKey) {
+  ASSERT_OK_AND_ASSIGN(auto pool, arrow::internal::ThreadPool::Make(4));
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "single threaded");
+    ExecContext exec_ctx(default_memory_pool(), parallel ? pool.get() : nullptr);
+    ASSERT_OK_AND_ASSIGN(auto partitions, RunExchange(&exec_ctx, parallel));
+    ASSERT_EQ(partitions.size(), static_cast<size_t>(kNumPartitions));
+
+    // Every row arrives at exactly one partition, and each key at only one
+    std::set<std::string> seen_keys;
+    int64_t num_rows = 0;
+    int num_nonempty = 0;
+    for (const auto& partition : partitions) {
+      std::set<std::string> keys;
+      ASSERT_OK_AND_ASSIGN(auto combined, partition->CombineChunksToBatch());
+      for (int64_t i = 0; i < combined->num_rows(); ++i) {
+        ASSERT_OK_AND_ASSIGN(auto k, combined->column(0)->GetScalar(i));
+        ASSERT_OK_AND_ASSIGN(auto s, combined->column(1)->GetScalar(i));
+        keys.insert(k->ToString() + "/" + s->ToString());
+      }
+      for (const auto& key : keys) {
+        ASSERT_TRUE(seen_keys.insert(key).second) << key << " is in several partitions";
+      }
+      num_rows += partition->num_rows();
+      num_nonempty += partition->num_rows() > 0;
+    }
+    ASSERT_EQ(seen_keys.size(), 17);
+    ASSERT_GT(num_nonempty, 1);
+
+    ASSERT_OK_AND_ASSIGN(auto expected, TableFromExecBatches(schema_, input_.batches));
+    ASSERT_EQ(num_rows, expected->num_rows());
+    ASSERT_OK_AND_ASSIGN(auto actual, ConcatenateTables(partitions));
+    ASSERT_OK_AND_ASSIGN(auto sorted_actual, SortTableOnAllFields(actual));
+    ASSERT_OK_AND_ASSIGN(auto sorted_expected, SortTableOnAllFields(expected));
+    AssertTablesEqual(*sorted_expected, *sorted_actual, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST_F(ExchangeNodeTest, AggregatePerPartition) {
+  ASSERT_OK_AND_ASSIGN(auto pool, arrow::internal::ThreadPool::Make(4));
+  ExecContext exec_ctx(default_memory_pool(), pool.get());
+  AggregateNodeOptions aggregate_options{
+      /*aggregates=*/{{"hash_sum", nullptr, "a", "sum(a)"},
+                      {"hash_count", nullptr, "a", "count(a)"}},
+      /*keys=*/{"k", "s"}};
+
+  // The same aggregate over the whole input
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_ctx));
+  ASSERT_OK(Declaration::Sequence(
+                {
+                    {"source", SourceNodeOptions{schema_, input_.gen(true, false)}},
+                    {"aggregate", aggregate_options},
+                    {"sink", SinkNodeOptions{&sink_gen}},
+                })
+                .AddToPlan(plan.get()));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto merged, StartAndCollect(plan.get(), sink_gen));
+
+  // More partitions than groups leaves some aggregates without input
+  for (int num_partitions : {kNumPartitions, 64}) {
+    ARROW_SCOPED_TRACE("num_partitions=", num_partitions);
+    // source -> exchange -> one aggregate per partition -> union -> sink
+    ASSERT_OK_AND_ASSIGN(plan, ExecPlan::Make(&exec_ctx));
+    ASSERT_OK_AND_ASSIGN(
+        auto source, MakeExecNode("source", plan.get(), {},
+                                  SourceNodeOptions{schema_, input_.gen(true, false)}));
+    ASSERT_OK_AND_ASSIGN(auto exchange,
+                         MakeExecNode("exchange", plan.get(), {source},
+                                      ExchangeNodeOptions({"k", "s"}, num_partitions)));
+    std::vector<ExecNode*> aggregates;
+    for (int i = 0; i < num_partitions; ++i) {
+      ASSERT_OK_AND_ASSIGN(auto aggregate, MakeExecNode("aggregate", plan.get(),
+                                                        {exchange}, aggregate_options));
+      aggregates.push_back(aggregate);
+    }
+    ASSERT_OK_AND_ASSIGN(auto union_node, MakeExecNode("union", plan.get(), aggregates,
+                                                       ExecNodeOptions{}));
+    ASSERT_OK(
+        MakeExecNode("sink", plan.get(), {union_node}, SinkNodeOptions{&sink_gen}));
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto partitioned,
+                                  StartAndCollect(plan.get(), sink_gen));
+    auto output_schema = aggregates[0]->output_schema();
+
+    ASSERT_OK_AND_ASSIGN(auto actual, TableFromExecBatches(output_schema, partitioned));
+    ASSERT_OK_AND_ASSIGN(auto expected, TableFromExecBatches(output_schema, merged));
+    ASSERT_EQ(actual->num_rows(), 17);
+    ASSERT_OK_AND_ASSIGN(actual, SortTableOnAllFields(actual));
+    ASSERT_OK_AND_ASSIGN(expected, SortTableOnAllFields(expected));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST_F(ExchangeNodeTest, StoppedPartition) {
+  // A partition which stops early does not stop the others
+  ExecContext exec_ctx(default_memory_pool(), nullptr);
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_ctx));
+  ASSERT_OK_AND_ASSIGN(
+      auto source, MakeExecNode("source", plan.get(), {},
+                                SourceNodeOptions{schema_, input_.gen(false, false)}));
+  ASSERT_OK_AND_ASSIGN(auto exchange,
+                       MakeExecNode("exchange", plan.get(), {source},
+                                    ExchangeNodeOptions({"k"}, /*num_partitions=*/2)));
+  ASSERT_OK_AND_ASSIGN(auto fetch, MakeExecNode("fetch", plan.get(), {exchange},
+                                                FetchNodeOptions(0, 1)));
+  AsyncGenerator<util::optional<ExecBatch>> fetch_gen, sink_gen;
+  ASSERT_OK(MakeExecNode("sink", plan.get(), {fetch}, SinkNodeOptions{&fetch_gen}));
+  ASSERT_OK(MakeExecNode("sink", plan.get(), {exchange}, SinkNodeOptions{&sink_gen}));
+  ASSERT_OK(plan->Validate());
+  ASSERT_OK(plan->StartProducing());
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto fetched, CollectAsyncGenerator(fetch_gen));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto rest, CollectAsyncGenerator(sink_gen));
+  ASSERT_FINISHES_OK(plan->finished());
+
+  ASSERT_EQ(fetched.size(), 1);
+  ASSERT_EQ(fetched[0]->length, 1);
+  int64_t num_rows = 0;
+  for (const auto& batch : rest) {
+    num_rows += batch->length;
+  }
+  ASSERT_OK_AND_ASSIGN(auto input, TableFromExecBatches(schema_, input_.batches));
+  ASSERT_GT(num_rows, 0);
+  ASSERT_LT(num_rows, input->num_rows());
+}
+
+TEST_F(ExchangeNodeTest, PartitionKeyHashes) {
+  ExecContext exec_ctx;
+  const ExecBatch& batch = input_.batches[6];
+  ASSERT_OK_AND_ASSIGN(auto partitions,
+                       HashPartitionBatch(&exec_ctx, batch, {0, 1}, kNumPartitions));
+
+  // The partitions carry the hashes of their keys
+  util::TempVectorStack stack;
+  ASSERT_OK(stack.Init(default_memory_pool(),
+                       4 * util::MiniBatch::kMiniBatchLength * sizeof(uint32_t)));
+  for (const auto& partition : partitions) {
+    if (partition.length == 0) continue;
+    ASSERT_NE(partition.key_hashes, nullptr);
+    ASSERT_TRUE(partition.key_hashes->Matches(KeyHashes::HASHING32,
+                                              {partition[0], partition[1]}));
+    ASSERT_FALSE(partition.key_hashes->Matches(KeyHashes::HASHING32, {partition[0]}));
+    ExecBatch key_batch({partition[0], partition[1]}, partition.length);
+    std::vector<uint32_t> hashes(partition.length);
+    ASSERT_OK(Hashing32::HashBatch(key_batch, hashes.data(),
+                                   exec_ctx.cpu_info()->hardware_flags(), &stack, 0,
+                                   partition.length));
+    ASSERT_EQ(hashes, std::vector<uint32_t>(partition.key_hashes->hashes32(),
+                                            partition.key_hashes->hashes32() +
+                                                partition.length));
+  }
+
+  // Partitioning on the same keys uses the hashes instead of hashing the keys again
+  ExecBatch rehashed = batch;
+  rehashed.key_hashes = std::make_shared<KeyHashes>();
+  rehashed.key_hashes->keys = {batch[0].array(), batch[1].array()};
+  rehashed.key_hashes->hashes =
+      Buffer::FromString(std::string(batch.length * sizeof(uint32_t), '\0'));
+  ASSERT_OK_AND_ASSIGN(partitions,
+                       HashPartitionBatch(&exec_ctx, rehashed, {0, 1}, kNumPartitions));
+  ASSERT_EQ(partitions[0].length, batch.length);
+  ASSERT_OK_AND_ASSIGN(partitions,
+                       HashPartitionBatch(&exec_ctx, rehashed, {1, 0}, kNumPartitions));
+  ASSERT_LT(partitions[0].length, batch.length);
+
+  // Scalar keys are expanded to be hashed, their hashes are not passed on
+  ExecBatch with_scalar = batch;
+  with_scalar.values[1] = MakeScalar(std::string("s"));
+  ASSERT_OK_AND_ASSIGN(partitions, HashPartitionBatch(&exec_ctx, with_scalar, {0, 1},
+                                                      kNumPartitions));
+  for (const auto& partition : partitions) {
+    ASSERT_EQ(partition.key_hashes, nullptr);
+  }
+}
+
+TEST_F(ExchangeNodeTest, PartitionsSpreadOverHashTableBlocks) {
+  // A SwissTable of 64 blocks, such as that of a grouper reusing the hashes passed on
+  // by the exchange, picks the block of a key from the 6 high bits of its hash.  The
+  // keys of each of 64 partitions must not all land in a few of the blocks.
+  constexpr int kManyPartitions = 64;
+  constexpr int kLogBlocks = 6;
+  ExecContext exec_ctx;
+  std::vector<int32_t> keys(1 << 14);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::shared_ptr<Array> key_array;
+  ArrayFromVector<Int32Type>(keys, &key_array);
+  ExecBatch batch({key_array}, key_array->length());
+  ASSERT_OK_AND_ASSIGN(auto partitions,
+                       HashPartitionBatch(&exec_ctx, batch, {0}, kManyPartitions));
+  for (const auto& partition : partitions) {
+    ASSERT_GT(partition.length, 0);
+    ASSERT_NE(partition.key_hashes, nullptr);
+    std::set<uint32_t> blocks;
+    for (int64_t i = 0; i < partition.length; ++i) {
+      blocks.insert(partition.key_hashes->hashes32()[i] >> (32 - kLogBlocks));
+    }
+    ASSERT_GE(blocks.size(), 48u);
+  }
+}
+
+TEST_F(ExchangeNodeTest, Errors) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  ASSERT_OK_AND_ASSIGN(
+      auto source, MakeExecNode("source", plan.get(), {},
+                                SourceNodeOptions{schema_, input_.gen(false, false)}));
+  ASSERT_RAISES(Invalid, MakeExecNode("exchange", plan.get(), {source},
+                                      ExchangeNodeOptions({"k"}, 0)));
+  ASSERT_RAISES(Invalid, MakeExecNode("exchange", plan.get(), {source},
+                                      ExchangeNodeOptions({}, 2)));
+  ASSERT_RAISES(Invalid, MakeExecNode("exchange", plan.get(), {source},
+                                      ExchangeNodeOptions({"missing"}, 2)));
+
+  auto list_schema = schema({field("l", list(int32()))});
+  ASSERT_OK_AND_ASSIGN(
+      auto list_source,
+      MakeExecNode("source", plan.get(), {},
+                   SourceNodeOptions{list_schema, MakeBasicBatches().gen(false, false)}));
+  ASSERT_RAISES(NotImplemented, MakeExecNode("exchange", plan.get(), {list_source},
+                                             ExchangeNodeOptions({"l"}, 2)));
+
+  // The node needs as many consumers as partitions
+  ASSERT_OK_AND_ASSIGN(auto exchange, MakeExecNode("exchange", plan.get(), {source},
+                                                   ExchangeNodeOptions({"k"}, 2)));
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+  ASSERT_OK(MakeExecNode("sink", plan.get(), {exchange}, SinkNodeOptions{&sink_gen}));
+  ASSERT_RAISES(Invalid, exchange->Validate());
+}
+
+}  // namespace compute
+}  // namespace arrow
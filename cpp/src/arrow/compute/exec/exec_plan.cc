@@ -17,6 +17,8 @@
 
 #include "arrow/compute/exec/exec_plan.h"
 
+#include <chrono>
+#include <iomanip>
 #include <sstream>
 #include <unordered_map>
 #include <unordered_set>
@@ -29,11 +31,20 @@
 #include "arrow/datum.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
+#include "arrow/type_traits.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
 #include "arrow/util/optional.h"
 #include "arrow/util/tracing_internal.h"
+#include "arrow/util/windows_compatibility.h"
+
+#ifndef _WIN32
+#include <time.h>
+#endif
 
 namespace arrow {
 
@@ -96,6 +107,8 @@ struct ExecPlanImpl : public ExecPlan {
     if (started_) {
       return Status::Invalid("restarted ExecPlan");
     }
+    // Don't start at all if cancelled (or past its deadline) already
+    RETURN_NOT_OK(exec_context()->stop_token().Poll());
     started_ = true;
 
     // producers precede consumers
@@ -231,13 +244,17 @@ struct ExecPlanImpl : public ExecPlan {
     return std::make_pair(result.sorted, result.indents);
   }
 
-  std::string ToString() const {
+  std::string ToString(bool with_metrics = false) const {
     std::stringstream ss;
     ss << "ExecPlan with " << nodes_.size() << " nodes:" << std::endl;
     auto sorted = OrderedNodes();
     for (size_t i = sorted.first.size(); i > 0; --i) {
       for (int j = 0; j < sorted.second[i - 1]; ++j) ss << "  ";
-      ss << sorted.first[i - 1]->ToString(sorted.second[i - 1]) << std::endl;
+      ss << sorted.first[i - 1]->ToString(sorted.second[i - 1]);
+      if (with_metrics) {
+        ss << " " << sorted.first[i - 1]->metrics().ToString();
+      }
+      ss << std::endl;
     }
     return ss.str();
   }
@@ -258,6 +275,83 @@ const ExecPlanImpl* ToDerived(const ExecPlan* ptr) {
   return checked_cast<const ExecPlanImpl*>(ptr);
 }
 
+// The bytes of the buffers of `data` referenced by its rows.  Unlike TotalBufferSize()
+// this does not count the whole buffers of a slice, such as one of the batches an
+// aggregation slices its output into.  Nested arrays are not looked into.
+int64_t ReferencedBytes(const ArrayData& data) {
+  const Type::type type_id = data.type->id();
+  if (type_id == Type::NA || data.buffers.empty()) {
+    return 0;
+  }
+  int64_t bytes = data.buffers[0] ? bit_util::BytesForBits(data.length) : 0;
+  if (is_fixed_width(type_id)) {
+    const int bit_width = checked_cast<const FixedWidthType&>(*data.type).bit_width();
+    return bytes + bit_util::BytesForBits(data.length * bit_width);
+  }
+  if (data.buffers.size() > 1 && !data.buffers[1]) {
+    // An empty array may have no offsets
+    return bytes;
+  }
+  if (is_binary_like(type_id)) {
+    const auto* offsets = data.GetValues<int32_t>(1);
+    return bytes + (data.length + 1) * sizeof(int32_t) + offsets[data.length] -
+           offsets[0];
+  }
+  if (is_large_binary_like(type_id)) {
+    const auto* offsets = data.GetValues<int64_t>(1);
+    return bytes + (data.length + 1) * sizeof(int64_t) + offsets[data.length] -
+           offsets[0];
+  }
+  return util::TotalBufferSize(data);
+}
+
+int64_t ReferencedBytes(const ExecBatch& batch) {
+  int64_t bytes = 0;
+  for (const Datum& value : batch.values) {
+    if (value.is_array()) {
+      bytes += ReferencedBytes(*value.array());
+    } else if (value.is_chunked_array()) {
+      bytes += util::TotalBufferSize(*value.chunked_array());
+    }
+  }
+  return bytes;
+}
+
+// The CPU time consumed by the calling thread, in nanoseconds
+int64_t ThreadCpuTimeNs() {
+#ifdef _WIN32
+  FILETIME creation_time, exit_time, kernel_time, user_time;
+  if (!GetThreadTimes(GetCurrentThread(), &creation_time, &exit_time, &kernel_time,
+                      &user_time)) {
+    return 0;
+  }
+  auto to_ns = [](const FILETIME& t) {
+    return ((static_cast<int64_t>(t.dwHighDateTime) << 32) | t.dwLowDateTime) * 100;
+  };
+  return to_ns(kernel_time) + to_ns(user_time);
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+  struct timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+    return 0;
+  }
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#else
+  return 0;
+#endif
+}
+
+// The time the calling thread has spent in the InputReceived() of the nodes called from
+// the node it is currently running
+thread_local int64_t downstream_wall_time_ns = 0;
+thread_local int64_t downstream_cpu_time_ns = 0;
+
+void AtomicMax(std::atomic<int64_t>* max, int64_t value) {
+  int64_t current = max->load(std::memory_order_relaxed);
+  while (value > current &&
+         !max->compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
 util::optional<int> GetNodeIndex(const std::vector<ExecNode*>& nodes,
                                  const ExecNode* node) {
   for (int i = 0; i < static_cast<int>(nodes.size()); ++i) {
@@ -273,6 +367,24 @@ Result<std::shared_ptr<ExecPlan>> ExecPlan::Make(
   return std::shared_ptr<ExecPlan>(new ExecPlanImpl{ctx, metadata});
 }
 
+Result<std::shared_ptr<ExecPlan>> ExecPlan::Make(
+    ExecContext* ctx, MemoryGovernor* memory_governor,
+    std::shared_ptr<const KeyValueMetadata> metadata) {
+  if (memory_governor == nullptr) {
+    return Make(ctx, std::move(metadata));
+  }
+  std::shared_ptr<ExecPlan> plan(new ExecPlanImpl{ctx, std::move(metadata)});
+  plan->memory_governor_ = memory_governor;
+  plan->governed_context_ = ::arrow::internal::make_unique<ExecContext>(
+      plan->memory_governor_->memory_pool(), ctx->executor(), ctx->func_registry());
+  plan->governed_context_->set_exec_chunksize(ctx->exec_chunksize());
+  plan->governed_context_->set_use_threads(ctx->use_threads());
+  plan->governed_context_->set_preallocate_contiguous(ctx->preallocate_contiguous());
+  plan->governed_context_->set_stop_token(ctx->stop_token());
+  plan->exec_context_ = plan->governed_context_.get();
+  return plan;
+}
+
 ExecNode* ExecPlan::AddNode(std::unique_ptr<ExecNode> node) {
   return ToDerived(this)->AddNode(std::move(node));
 }
@@ -299,6 +411,23 @@ std::shared_ptr<const KeyValueMetadata> ExecPlan::metadata() const {
 
 std::string ExecPlan::ToString() const { return ToDerived(this)->ToString(); }
 
+std::string ExecPlan::ToStringWithMetrics() const {
+  return ToDerived(this)->ToString(/*with_metrics=*/true);
+}
+
+std::string ExecNodeMetrics::ToString() const {
+  std::stringstream ss;
+  ss << std::fixed << std::setprecision(3);
+  ss << "[batches_in=" << batches_in << ", rows_in=" << rows_in
+     << ", bytes_in=" << bytes_in << ", batches_out=" << batches_out
+     << ", rows_out=" << rows_out << ", bytes_out=" << bytes_out
+     << ", wall_time=" << wall_time_ns / 1e6 << "ms"
+     << ", cpu_time=" << cpu_time_ns / 1e6 << "ms"
+     << ", peak_memory_bytes=" << peak_memory_bytes
+     << ", spilled_bytes=" << spilled_bytes << "]";
+  return ss.str();
+}
+
 ExecNode::ExecNode(ExecPlan* plan, NodeVector inputs,
                    std::vector<std::string> input_labels,
                    std::shared_ptr<Schema> output_schema, int num_outputs)
@@ -355,6 +484,70 @@ std::string ExecNode::ToString(int indent) const {
 
 std::string ExecNode::ToStringExtra(int indent = 0) const { return ""; }
 
+ExecNodeMetrics ExecNode::metrics() const {
+  ExecNodeMetrics metrics;
+  metrics.batches_in = metrics_.batches_in.load();
+  metrics.rows_in = metrics_.rows_in.load();
+  metrics.bytes_in = metrics_.bytes_in.load();
+  metrics.batches_out = metrics_.batches_out.load();
+  metrics.rows_out = metrics_.rows_out.load();
+  metrics.bytes_out = metrics_.bytes_out.load();
+  metrics.wall_time_ns = metrics_.wall_time_ns.load();
+  metrics.cpu_time_ns = metrics_.cpu_time_ns.load();
+  metrics.peak_memory_bytes = metrics_.peak_memory_bytes.load();
+  metrics.spilled_bytes = metrics_.spilled_bytes.load();
+  return metrics;
+}
+
+void ExecNode::EmitBatch(ExecBatch batch) { EmitBatch(outputs_[0], std::move(batch)); }
+
+void ExecNode::EmitBatch(ExecNode* output, ExecBatch batch) {
+  if (batch.selection_vector && !output->accepts_selection_vector()) {
+    auto selected = batch.ApplySelection(plan_->exec_context());
+    if (!selected.ok()) {
+      output->ErrorReceived(this, selected.status());
+      return;
+    }
+    batch = selected.MoveValueUnsafe();
+  }
+  const int64_t rows = batch.length;
+  const int64_t bytes = ReferencedBytes(batch);
+  metrics_.batches_out.fetch_add(1, std::memory_order_relaxed);
+  metrics_.rows_out.fetch_add(rows, std::memory_order_relaxed);
+  metrics_.bytes_out.fetch_add(bytes, std::memory_order_relaxed);
+  output->metrics_.batches_in.fetch_add(1, std::memory_order_relaxed);
+  output->metrics_.rows_in.fetch_add(rows, std::memory_order_relaxed);
+  output->metrics_.bytes_in.fetch_add(bytes, std::memory_order_relaxed);
+
+  // Time spent downstream of the output is accounted to the nodes downstream
+  const int64_t outer_wall_time_ns = downstream_wall_time_ns;
+  const int64_t outer_cpu_time_ns = downstream_cpu_time_ns;
+  downstream_wall_time_ns = downstream_cpu_time_ns = 0;
+  const auto wall_start = std::chrono::steady_clock::now();
+  const int64_t cpu_start = ThreadCpuTimeNs();
+
+  output->InputReceived(this, std::move(batch));
+
+  const int64_t cpu_time_ns = ThreadCpuTimeNs() - cpu_start;
+  const int64_t wall_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now() - wall_start)
+                                   .count();
+  output->metrics_.wall_time_ns.fetch_add(wall_time_ns - downstream_wall_time_ns,
+                                          std::memory_order_relaxed);
+  output->metrics_.cpu_time_ns.fetch_add(cpu_time_ns - downstream_cpu_time_ns,
+                                         std::memory_order_relaxed);
+  downstream_wall_time_ns = outer_wall_time_ns + wall_time_ns;
+  downstream_cpu_time_ns = outer_cpu_time_ns + cpu_time_ns;
+}
+
+void ExecNode::RecordMemoryUsage(int64_t bytes) {
+  AtomicMax(&metrics_.peak_memory_bytes, bytes);
+}
+
+void ExecNode::RecordSpilledBytes(int64_t bytes) {
+  metrics_.spilled_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
 bool ExecNode::ErrorIfNotOk(Status status) {
   if (status.ok()) return false;
 
@@ -435,13 +628,18 @@ void MapNode::SubmitTask(std::function<Result<ExecBatch>(ExecBatch)> map_fn,
     return;
   }
   auto task = [this, map_fn, batch]() {
+    // Drop the batches still queued once the plan is cancelled
+    Status stop_status = plan()->exec_context()->stop_token().Poll();
+    if (ErrorIfNotOk(stop_status)) {
+      return stop_status;
+    }
     auto guarantee = batch.guarantee;
     auto output_batch = map_fn(std::move(batch));
     if (ErrorIfNotOk(output_batch.status())) {
       return output_batch.status();
     }
     output_batch->guarantee = guarantee;
-    outputs_[0]->InputReceived(this, output_batch.MoveValueUnsafe());
+    EmitBatch(output_batch.MoveValueUnsafe());
     return Status::OK();
   };
 
@@ -542,11 +740,16 @@ namespace internal {
 void RegisterSourceNode(ExecFactoryRegistry*);
 void RegisterFilterNode(ExecFactoryRegistry*);
 void RegisterProjectNode(ExecFactoryRegistry*);
+void RegisterFetchNode(ExecFactoryRegistry*);
+void RegisterExchangeNode(ExecFactoryRegistry*);
+void RegisterDistinctNode(ExecFactoryRegistry*);
 void RegisterUnionNode(ExecFactoryRegistry*);
 void RegisterAggregateNode(ExecFactoryRegistry*);
 void RegisterSinkNode(ExecFactoryRegistry*);
 void RegisterHashJoinNode(ExecFactoryRegistry*);
 void RegisterAsofJoinNode(ExecFactoryRegistry*);
+void RegisterSortMergeJoinNode(ExecFactoryRegistry*);
+void RegisterWindowNode(ExecFactoryRegistry*);
 
 }  // namespace internal
 
@@ -558,10 +761,15 @@ ExecFactoryRegistry* default_exec_factory_registry() {
       internal::RegisterFilterNode(this);
       internal::RegisterProjectNode(this);
       internal::RegisterUnionNode(this);
+      internal::RegisterFetchNode(this);
+      internal::RegisterExchangeNode(this);
+      internal::RegisterDistinctNode(this);
       internal::RegisterAggregateNode(this);
       internal::RegisterSinkNode(this);
       internal::RegisterHashJoinNode(this);
       internal::RegisterAsofJoinNode(this);
+      internal::RegisterSortMergeJoinNode(this);
+      internal::RegisterWindowNode(this);
     }
 
     Result<Factory> GetFactory(const std::string& factory_name) override {
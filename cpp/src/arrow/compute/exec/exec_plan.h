@@ -17,12 +17,15 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "arrow/compute/exec.h"
+#include "arrow/compute/exec/memory_governor.h"
 #include "arrow/compute/exec/util.h"
 #include "arrow/compute/type_fwd.h"
 #include "arrow/type_fwd.h"
@@ -31,6 +34,7 @@
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/optional.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/tracing.h"
 #include "arrow/util/visibility.h"
 
@@ -51,6 +55,37 @@ class ARROW_EXPORT ExecPlan : public std::enable_shared_from_this<ExecPlan> {
       ExecContext* = default_exec_context(),
       std::shared_ptr<const KeyValueMetadata> metadata = NULLPTR);
 
+  /// Make an empty exec plan whose memory is bounded by `memory_governor`
+  ///
+  /// The plan allocates from the governor's pool instead of the context's one.  Like
+  /// any other memory pool the governor must outlive the plan and all the data it
+  /// produces.
+  static Result<std::shared_ptr<ExecPlan>> Make(
+      ExecContext* ctx, MemoryGovernor* memory_governor,
+      std::shared_ptr<const KeyValueMetadata> metadata = NULLPTR);
+
+  /// The governor bounding the plan's memory, or null if the plan has no memory limit
+  MemoryGovernor* memory_governor() const { return memory_governor_; }
+
+  /// \brief The scheduling priority of the plan's tasks, see TaskHints::priority
+  ///
+  /// The lower the more urgent.  Plans sharing an executor may be given different
+  /// priorities, for example so that interactive queries do not queue up behind the
+  /// tasks of large batch queries.  Must be set before the plan starts producing.
+  int32_t task_priority() const { return task_priority_; }
+  void set_task_priority(int32_t priority) { task_priority_ = priority; }
+
+  /// \brief The hints with which nodes should spawn their tasks
+  ///
+  /// `urgency` is subtracted from the plan's priority.  Tasks which unblock the rest of
+  /// the plan (e.g. hash table builds or the output of pipeline breakers) should be
+  /// more urgent than those bringing in new input.
+  ::arrow::internal::TaskHints MakeTaskHints(int32_t urgency = 0) const {
+    ::arrow::internal::TaskHints hints;
+    hints.priority = task_priority_ - urgency;
+    return hints;
+  }
+
   ExecNode* AddNode(std::unique_ptr<ExecNode> node);
 
   template <typename Node, typename... Args>
@@ -92,11 +127,48 @@ class ARROW_EXPORT ExecPlan : public std::enable_shared_from_this<ExecPlan> {
 
   std::string ToString() const;
 
+  /// \brief The plan, each node annotated with its runtime metrics
+  ///
+  /// May be called while the plan runs, the metrics are then those gathered so far.
+  std::string ToStringWithMetrics() const;
+
  protected:
   ExecContext* exec_context_;
+  MemoryGovernor* memory_governor_ = NULLPTR;
+  // A copy of the caller's context allocating from the governor's pool
+  std::unique_ptr<ExecContext> governed_context_;
+  int32_t task_priority_ = 0;
   explicit ExecPlan(ExecContext* exec_context) : exec_context_(exec_context) {}
 };
 
+/// \brief Runtime metrics of an ExecNode
+///
+/// Batches, rows and bytes are counted as a node sends batches on to its output with
+/// ExecNode::EmitBatch(), bytes being the size of the data referenced by the batches.
+/// Times are those spent in the node's InputReceived(), excluding the time spent in
+/// the InputReceived() of the nodes it calls into synchronously.  Work a node defers
+/// to tasks of its own is not included.
+struct ARROW_EXPORT ExecNodeMetrics {
+  int64_t batches_in = 0;
+  int64_t rows_in = 0;
+  int64_t bytes_in = 0;
+  int64_t batches_out = 0;
+  int64_t rows_out = 0;
+  int64_t bytes_out = 0;
+  /// Wall clock time spent in InputReceived(), in nanoseconds
+  int64_t wall_time_ns = 0;
+  /// CPU time spent in InputReceived() by the delivering threads, in nanoseconds.  Zero
+  /// where the platform has no per-thread CPU clock.
+  int64_t cpu_time_ns = 0;
+  /// The most bytes the node has held at once, as reported by the node itself.  Zero
+  /// for nodes which do not accumulate their input.
+  int64_t peak_memory_bytes = 0;
+  /// Bytes the node has written to disk
+  int64_t spilled_bytes = 0;
+
+  std::string ToString() const;
+};
+
 class ARROW_EXPORT ExecNode {
  public:
   using NodeVector = std::vector<ExecNode*>;
@@ -267,6 +339,17 @@ class ARROW_EXPORT ExecNode {
 
   std::string ToString(int indent = 0) const;
 
+  /// \brief The metrics gathered so far
+  ExecNodeMetrics metrics() const;
+
+  /// \brief Whether InputReceived() handles batches with a selection vector
+  ///
+  /// Batches emitted with a selection vector (see ExecBatch::selection_vector) are
+  /// first materialized for nodes which do not accept them.  Nodes which only read
+  /// some of their input columns should accept them, so that the other columns are
+  /// never copied.
+  virtual bool accepts_selection_vector() const { return false; }
+
  protected:
   ExecNode(ExecPlan* plan, NodeVector inputs, std::vector<std::string> input_labels,
            std::shared_ptr<Schema> output_schema, int num_outputs);
@@ -275,6 +358,20 @@ class ARROW_EXPORT ExecNode {
   // Returns true if the status was an error.
   bool ErrorIfNotOk(Status status);
 
+  /// \brief Deliver a batch to the output, and count it in the metrics of both nodes
+  ///
+  /// Nodes should call this rather than calling their output's InputReceived().
+  void EmitBatch(ExecBatch batch);
+
+  /// \brief Deliver a batch to one of several outputs
+  void EmitBatch(ExecNode* output, ExecBatch batch);
+
+  /// \brief Report the number of bytes the node currently holds
+  void RecordMemoryUsage(int64_t bytes);
+
+  /// \brief Report bytes written to disk
+  void RecordSpilledBytes(int64_t bytes);
+
   /// Provide extra info to include in the string representation.
   virtual std::string ToStringExtra(int indent) const;
 
@@ -292,6 +389,15 @@ class ARROW_EXPORT ExecNode {
   Future<> finished_ = Future<>::MakeFinished();
 
   util::tracing::Span span_;
+
+ private:
+  struct AtomicMetrics {
+    std::atomic<int64_t> batches_in{0}, rows_in{0}, bytes_in{0};
+    std::atomic<int64_t> batches_out{0}, rows_out{0}, bytes_out{0};
+    std::atomic<int64_t> wall_time_ns{0}, cpu_time_ns{0};
+    std::atomic<int64_t> peak_memory_bytes{0}, spilled_bytes{0};
+  };
+  AtomicMetrics metrics_;
 };
 
 /// \brief MapNode is an ExecNode type class which process a task like filter/project
@@ -17,10 +17,16 @@
 
 #include "arrow/compute/exec/expression.h"
 
+#include <algorithm>
+#include <limits>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
 #include "arrow/chunked_array.h"
+#include "arrow/compute/api_scalar.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec/expression_internal.h"
 #include "arrow/compute/exec_internal.h"
@@ -28,6 +34,7 @@
 #include "arrow/io/memory.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/hash_util.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
@@ -479,6 +486,59 @@ Result<Expression> Expression::Bind(const Schema& in_schema,
   return BindImpl(*this, in_schema, ValueDescr::ARRAY, exec_context);
 }
 
+namespace {
+
+// Readers may only materialize the children of a struct column which are referenced,
+// in which case the others are filled in with nulls.  Other mismatches are cast.
+Result<std::shared_ptr<ArrayData>> ConformToType(const std::shared_ptr<ArrayData>& data,
+                                                 const std::shared_ptr<DataType>& type) {
+  if (data->type->Equals(type)) {
+    return data;
+  }
+  if (data->type->id() == Type::STRUCT && type->id() == Type::STRUCT) {
+    const auto& data_type = checked_cast<const StructType&>(*data->type);
+    std::vector<int> indices;
+    bool unique_names = true;
+    for (const auto& field : type->fields()) {
+      auto field_indices = data_type.GetAllFieldIndices(field->name());
+      unique_names &= field_indices.size() <= 1;
+      indices.push_back(field_indices.empty() ? -1 : field_indices[0]);
+    }
+    if (unique_names) {
+      auto out = data->Copy();
+      out->type = type;
+      out->child_data.resize(type->num_fields());
+      FieldVector missing_fields;
+      for (int i = 0; i < type->num_fields(); ++i) {
+        if (indices[i] == -1) {
+          missing_fields.push_back(type->field(i));
+          continue;
+        }
+        ARROW_ASSIGN_OR_RAISE(out->child_data[i],
+                              ConformToType(data->child_data[indices[i]],
+                                            type->field(i)->type()));
+      }
+      if (!missing_fields.empty()) {
+        // Children are indexed like their parent, so they span its offset as well
+        ARROW_ASSIGN_OR_RAISE(auto nulls, MakeArrayOfNull(struct_(missing_fields),
+                                                          data->offset + data->length));
+        size_t missing_index = 0;
+        for (int i = 0; i < type->num_fields(); ++i) {
+          if (indices[i] == -1) {
+            out->child_data[i] = nulls->data()->child_data[missing_index++];
+          }
+        }
+      }
+      return out;
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(auto converted,
+                        compute::Cast(MakeArray(data), type, CastOptions::Safe()));
+  return converted.array();
+}
+
+}  // namespace
+
 Result<ExecBatch> MakeExecBatch(const Schema& full_schema, const Datum& partial) {
   ExecBatch out;
 
@@ -494,10 +554,9 @@ Result<ExecBatch> MakeExecBatch(const Schema& full_schema, const Datum& partial)
         if (!column->type()->Equals(field->type())) {
           // Referenced field was present but didn't have the expected type.
           // This *should* be handled by readers, and will just be an error in the future.
-          ARROW_ASSIGN_OR_RAISE(
-              auto converted,
-              compute::Cast(column, field->type(), compute::CastOptions::Safe()));
-          column = converted.make_array();
+          ARROW_ASSIGN_OR_RAISE(auto converted,
+                                ConformToType(column->data(), field->type()));
+          column = MakeArray(std::move(converted));
         }
         out.values.emplace_back(std::move(column));
       } else {
@@ -539,22 +598,162 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const Schema& full
   return ExecuteScalarExpression(expr, input, exec_context);
 }
 
-Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& input,
-                                      compute::ExecContext* exec_context) {
-  if (exec_context == nullptr) {
-    compute::ExecContext exec_context;
-    return ExecuteScalarExpression(expr, input, &exec_context);
+namespace {
+
+// Values of the call subexpressions which occur more than once among the expressions
+// being executed, keyed by the subexpression.  A value is null until it is computed.
+using SubexpressionCache = std::unordered_map<Expression, Datum, Expression::Hash>;
+
+// Count the occurrences of call subexpressions.  The arguments of a repeated call are
+// not counted again, since they are only evaluated along with the call's first
+// occurrence.
+void CountCalls(const Expression& expr,
+                std::unordered_map<Expression, int, Expression::Hash>* counts) {
+  auto call = expr.call();
+  // Nullary calls are cheap and may not be deterministic, e.g. "random"
+  if (!call || call->arguments.empty()) return;
+  if (++(*counts)[expr] > 1) return;
+  for (const Expression& argument : call->arguments) {
+    CountCalls(argument, counts);
+  }
+}
+
+SubexpressionCache FindCommonSubexpressions(const std::vector<Expression>& exprs) {
+  std::unordered_map<Expression, int, Expression::Hash> counts;
+  for (const Expression& expr : exprs) {
+    CountCalls(expr, &counts);
+  }
+  SubexpressionCache cache;
+  for (const auto& count : counts) {
+    if (count.second > 1) {
+      cache.emplace(count.first, Datum());
+    }
   }
+  return cache;
+}
 
+Status CheckExecutable(const Expression& expr) {
   if (!expr.IsBound()) {
     return Status::Invalid("Cannot Execute unbound expression.");
   }
-
   if (!expr.IsScalarExpression()) {
     return Status::Invalid(
         "ExecuteScalarExpression cannot Execute non-scalar expression ", expr.ToString());
   }
+  return Status::OK();
+}
+
+Result<Datum> ExecuteScalarExpressionImpl(const Expression& expr, const ExecBatch& input,
+                                          compute::ExecContext* exec_context,
+                                          SubexpressionCache* cache);
+
+// if_else and case_when only use each of their value arguments ("branches") on the
+// rows whose conditions select it.  Once the conditions are computed, a branch
+// which is a call selected by at most this fraction of the rows is only evaluated
+// over those rows, then scattered back to the length of the batch.  A branch
+// selected by no row isn't evaluated at all.
+constexpr double kMaxLazyBranchSelectivity = 0.5;
+
+bool CanScatterBranch(const DataType& type) {
+  // Types supported by replace_with_mask
+  return is_primitive(type.id()) || is_decimal(type.id()) ||
+         type.id() == Type::FIXED_SIZE_BINARY || is_base_binary_like(type.id());
+}
+
+// The masks of the rows selecting each branch of a call to if_else or case_when,
+// or nothing if the branches should be evaluated over the whole batch
+Result<std::vector<Datum>> GetBranchMasks(const Expression::Call& call,
+                                          const Datum& cond, const ExecBatch& input,
+                                          compute::ExecContext* exec_context) {
+  std::vector<Datum> masks;
+  if (input.selection_vector || !cond.is_array() || cond.length() == 0 ||
+      !CanScatterBranch(*call.descr.type)) {
+    return masks;
+  }
+
+  if (call.function_name == "if_else") {
+    // Null conditions select neither branch
+    ARROW_ASSIGN_OR_RAISE(Datum inverted, compute::Invert(cond, exec_context));
+    masks = {cond, std::move(inverted)};
+    return masks;
+  }
+
+  if (call.function_name != "case_when") return masks;
+  const ArrayData& conds = *cond.array();
+  const int num_conds = conds.type->num_fields();
+  const int num_branches = static_cast<int>(call.arguments.size()) - 1;
+  // Let the kernel report invalid conditions
+  if (conds.GetNullCount() != 0 ||
+      (num_branches != num_conds && num_branches != num_conds + 1)) {
+    return masks;
+  }
+  // A row selects the first branch whose condition is true, else the "else" branch
+  auto struct_conds = checked_pointer_cast<StructArray>(cond.make_array());
+  Datum remaining;
+  for (int i = 0; i < num_branches; ++i) {
+    if (i == num_conds) {
+      masks.push_back(remaining);
+      break;
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum field, struct_conds->GetFlattenedField(i));
+    ARROW_ASSIGN_OR_RAISE(
+        field, compute::CallFunction("coalesce", {field, Datum(false)}, exec_context));
+    if (i == 0) {
+      masks.push_back(field);
+      ARROW_ASSIGN_OR_RAISE(remaining, compute::Invert(field, exec_context));
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum mask, compute::And(remaining, field, exec_context));
+    masks.push_back(std::move(mask));
+    ARROW_ASSIGN_OR_RAISE(remaining, compute::AndNot(remaining, field, exec_context));
+  }
+  return masks;
+}
+
+// Evaluate a branch of if_else or case_when given the mask of the rows selecting it
+Result<Datum> ExecuteBranch(const Expression& branch, const Datum& mask,
+                            const ExecBatch& input, compute::ExecContext* exec_context,
+                            SubexpressionCache* cache) {
+  auto it = cache->find(branch);
+  const bool is_cached = it != cache->end() && it->second.kind() != Datum::NONE;
+  if (!branch.call() || is_cached) {
+    return ExecuteScalarExpressionImpl(branch, input, exec_context, cache);
+  }
+
+  const int64_t num_selected = BooleanArray(mask.array()).true_count();
+  if (num_selected == 0) return MakeNullScalar(branch.type());
+  if (num_selected > kMaxLazyBranchSelectivity * input.length) {
+    return ExecuteScalarExpressionImpl(branch, input, exec_context, cache);
+  }
+
+  // Only the columns referenced by the branch need to be filtered
+  std::vector<bool> referenced(input.values.size(), false);
+  MarkReferencedColumns(branch, &referenced);
+  ExecBatch selected = input;
+  selected.length = num_selected;
+  for (size_t i = 0; i < selected.values.size(); ++i) {
+    if (referenced[i] && selected.values[i].is_array()) {
+      ARROW_ASSIGN_OR_RAISE(selected.values[i],
+                            compute::Filter(selected.values[i], mask,
+                                            FilterOptions::Defaults(), exec_context));
+    }
+  }
+
+  // The values of common subexpressions cover all rows, so they aren't used here
+  SubexpressionCache no_cache;
+  ARROW_ASSIGN_OR_RAISE(
+      Datum value,
+      ExecuteScalarExpressionImpl(branch, selected, exec_context, &no_cache));
+  if (value.is_scalar()) return value;
+  ARROW_ASSIGN_OR_RAISE(
+      auto nulls,
+      MakeArrayOfNull(branch.type(), input.length, exec_context->memory_pool()));
+  return compute::ReplaceWithMask(nulls, mask, value, exec_context);
+}
 
+Result<Datum> ExecuteScalarExpressionImpl(const Expression& expr, const ExecBatch& input,
+                                          compute::ExecContext* exec_context,
+                                          SubexpressionCache* cache) {
   if (auto lit = expr.literal()) return *lit;
 
   if (auto param = expr.parameter()) {
@@ -580,12 +779,33 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
 
   auto call = CallNotNull(expr);
 
+  Datum* cached = nullptr;
+  if (!cache->empty()) {
+    auto it = cache->find(expr);
+    if (it != cache->end()) {
+      if (it->second.kind() != Datum::NONE) return it->second;
+      cached = &it->second;
+    }
+  }
+
   std::vector<Datum> arguments(call->arguments.size());
 
   bool all_scalar = true;
+  std::vector<Datum> branch_masks;
   for (size_t i = 0; i < arguments.size(); ++i) {
-    ARROW_ASSIGN_OR_RAISE(
-        arguments[i], ExecuteScalarExpression(call->arguments[i], input, exec_context));
+    if (branch_masks.empty()) {
+      ARROW_ASSIGN_OR_RAISE(arguments[i],
+                            ExecuteScalarExpressionImpl(call->arguments[i], input,
+                                                        exec_context, cache));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(arguments[i],
+                            ExecuteBranch(call->arguments[i], branch_masks[i - 1], input,
+                                          exec_context, cache));
+    }
+    if (i == 0 && arguments.size() > 1) {
+      ARROW_ASSIGN_OR_RAISE(branch_masks,
+                            GetBranchMasks(*call, arguments[0], input, exec_context));
+    }
     if (arguments[i].is_array()) {
       all_scalar = false;
     }
@@ -602,15 +822,158 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
   RETURN_NOT_OK(executor->Init(&kernel_context, {kernel, descrs, options}));
 
   compute::detail::DatumAccumulator listener;
-  RETURN_NOT_OK(executor->Execute(
+  RETURN_NOT_OK(compute::detail::ExecuteKernel(
+      executor.get(), call->function->name(), *kernel,
       ExecBatch(std::move(arguments), all_scalar ? 1 : input.length), &listener));
   const auto out = executor->WrapResults(arguments, listener.values());
 #ifndef NDEBUG
   DCHECK_OK(executor->CheckResultType(out, call->function_name.c_str()));
 #endif
+  if (cached) *cached = out;
   return out;
 }
 
+// Large batches are executed in tiles when the expressions are trees of several
+// calls over fixed-width values (arithmetic, comparisons, boolean functions,
+// if_else...).  The whole tree is evaluated over one tile before moving to the next,
+// so that intermediate results are still in cache when they are consumed and their
+// allocations are recycled by the memory pool, rather than each call making a pass
+// over the full batch.
+constexpr int64_t kMinTileLength = 1024;
+
+struct TileEstimate {
+  int64_t bytes_per_row = 0;
+  int num_calls = 0;
+  bool references_array = false;
+};
+
+bool IsTileable(const std::shared_ptr<DataType>& type) {
+  return type->id() == Type::NA || is_primitive(type->id());
+}
+
+// Return false if the expression is not eligible for tiled execution
+bool EstimateTile(const Expression& expr, const ExecBatch& input,
+                  TileEstimate* estimate) {
+  if (expr.literal()) return true;
+
+  if (auto param = expr.parameter()) {
+    if (!IsTileable(param->descr.type)) return false;
+    if (param->descr.type->id() != Type::NA) {
+      const Datum& value = input[param->indices[0]];
+      if (value.is_array()) {
+        estimate->references_array = true;
+      } else if (!value.is_scalar()) {
+        return false;
+      }
+    }
+    estimate->bytes_per_row += bit_util::BytesForBits(bit_width(param->descr.type->id()));
+    return true;
+  }
+
+  auto call = expr.call();
+  // Nullary calls may not be deterministic, e.g. "random"
+  if (call->arguments.empty() || !IsTileable(call->descr.type)) return false;
+  ++estimate->num_calls;
+  estimate->bytes_per_row += bit_util::BytesForBits(bit_width(call->descr.type->id()));
+  for (const Expression& argument : call->arguments) {
+    if (!EstimateTile(argument, input, estimate)) return false;
+  }
+  return true;
+}
+
+// The length of the tiles to execute `exprs` in, or 0 to execute them over the
+// whole batch
+int64_t GetTileLength(const std::vector<Expression>& exprs, const ExecBatch& input) {
+  if (input.selection_vector || input.length <= 2 * kMinTileLength) return 0;
+  TileEstimate estimate;
+  for (const Expression& expr : exprs) {
+    if (!expr.call()) return 0;
+    estimate.references_array = false;
+    if (!EstimateTile(expr, input, &estimate) || !estimate.references_array) return 0;
+  }
+  // A single call has no intermediate results to keep in cache
+  if (estimate.num_calls < 2) return 0;
+
+  // Let the inputs, intermediate results and outputs of a tile take up about
+  // half of the L2 cache
+  const int64_t cache_size = ::arrow::internal::CpuInfo::GetInstance()->CacheSize(
+      ::arrow::internal::CpuInfo::CacheLevel::L2);
+  int64_t tile_length = cache_size / 2 / std::max<int64_t>(estimate.bytes_per_row, 1);
+  // Keep the tiles of boolean outputs byte-aligned
+  tile_length = std::max(kMinTileLength, tile_length & ~int64_t{63});
+  return tile_length < input.length / 2 ? tile_length : 0;
+}
+
+Result<std::vector<Datum>> ExecuteScalarExpressionsTiled(
+    const std::vector<Expression>& exprs, const ExecBatch& input,
+    compute::ExecContext* exec_context, const SubexpressionCache& cache,
+    int64_t tile_length) {
+  std::vector<ArrayVector> tiles(exprs.size());
+  for (int64_t offset = 0; offset < input.length; offset += tile_length) {
+    ExecBatch tile = input.Slice(offset, tile_length);
+    // The cached values of common subexpressions only apply to one tile
+    SubexpressionCache tile_cache = cache;
+    for (size_t i = 0; i < exprs.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(
+          Datum value,
+          ExecuteScalarExpressionImpl(exprs[i], tile, exec_context, &tile_cache));
+      DCHECK(value.is_array());
+      tiles[i].push_back(value.make_array());
+    }
+  }
+
+  std::vector<Datum> values(exprs.size());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(values[i],
+                          Concatenate(tiles[i], exec_context->memory_pool()));
+  }
+  return values;
+}
+
+}  // namespace
+
+Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& input,
+                                      compute::ExecContext* exec_context) {
+  if (exec_context == nullptr) {
+    compute::ExecContext exec_context;
+    return ExecuteScalarExpression(expr, input, &exec_context);
+  }
+  RETURN_NOT_OK(CheckExecutable(expr));
+  SubexpressionCache cache;
+  if (expr.call()) {
+    cache = FindCommonSubexpressions({expr});
+  }
+  if (int64_t tile_length = GetTileLength({expr}, input)) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto values,
+        ExecuteScalarExpressionsTiled({expr}, input, exec_context, cache, tile_length));
+    return std::move(values[0]);
+  }
+  return ExecuteScalarExpressionImpl(expr, input, exec_context, &cache);
+}
+
+Result<std::vector<Datum>> ExecuteScalarExpressions(const std::vector<Expression>& exprs,
+                                                    const ExecBatch& input,
+                                                    compute::ExecContext* exec_context) {
+  if (exec_context == nullptr) {
+    compute::ExecContext exec_context;
+    return ExecuteScalarExpressions(exprs, input, &exec_context);
+  }
+  for (const Expression& expr : exprs) {
+    RETURN_NOT_OK(CheckExecutable(expr));
+  }
+  SubexpressionCache cache = FindCommonSubexpressions(exprs);
+  if (int64_t tile_length = GetTileLength(exprs, input)) {
+    return ExecuteScalarExpressionsTiled(exprs, input, exec_context, cache, tile_length);
+  }
+  std::vector<Datum> values(exprs.size());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(
+        values[i], ExecuteScalarExpressionImpl(exprs[i], input, exec_context, &cache));
+  }
+  return values;
+}
+
 namespace {
 
 std::array<std::pair<const Expression&, const Expression&>, 2>
@@ -651,6 +1014,20 @@ std::vector<FieldRef> FieldsInExpression(const Expression& expr) {
   return fields;
 }
 
+void MarkReferencedColumns(const Expression& expr, std::vector<bool>* columns) {
+  if (auto param = expr.parameter()) {
+    DCHECK(!param->indices.empty())
+        << "unbound field reference " << param->ref.ToString();
+    (*columns)[param->indices[0]] = true;
+    return;
+  }
+  if (auto call = expr.call()) {
+    for (const Expression& arg : call->arguments) {
+      MarkReferencedColumns(arg, columns);
+    }
+  }
+}
+
 bool ExpressionHasFieldRefs(const Expression& expr) {
   if (expr.literal()) return false;
 
@@ -1191,6 +1568,100 @@ Result<Expression> SimplifyWithGuarantee(Expression expr,
   return expr;
 }
 
+namespace {
+
+// The conjunction members of a guarantee which reference a field of an expression
+// (or no field at all). The others can't simplify the expression.
+Expression RelevantGuarantee(const std::vector<FieldRef>& fields,
+                             const Expression& guaranteed_true_predicate) {
+  auto members = GuaranteeConjunctionMembers(guaranteed_true_predicate);
+  auto relevant = arrow::internal::FilterVector(
+      std::move(members), [&fields](const Expression& member) {
+        auto member_fields = FieldsInExpression(member);
+        return member_fields.empty() ||
+               std::any_of(member_fields.begin(), member_fields.end(),
+                           [&fields](const FieldRef& ref) {
+                             return std::find(fields.begin(), fields.end(), ref) !=
+                                    fields.end();
+                           });
+      });
+  return and_(relevant);
+}
+
+}  // namespace
+
+struct SimplifyWithGuaranteeCache::Impl {
+  struct Key {
+    Expression expr;
+    Expression guarantee;
+
+    bool operator==(const Key& other) const {
+      return expr == other.expr && guarantee == other.guarantee;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      size_t h = key.expr.hash();
+      arrow::internal::hash_combine(h, key.guarantee.hash());
+      return h;
+    }
+  };
+
+  explicit Impl(size_t capacity) : capacity(capacity) {}
+
+  std::vector<FieldRef> Fields(const Expression& expr) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = fields.find(expr);
+    if (it == fields.end()) {
+      if (fields.size() >= capacity) fields.clear();
+      it = fields.emplace(expr, FieldsInExpression(expr)).first;
+    }
+    return it->second;
+  }
+
+  const size_t capacity;
+  std::mutex mutex;
+  std::unordered_map<Expression, std::vector<FieldRef>, Expression::Hash> fields;
+  std::unordered_map<Key, Expression, KeyHash> simplified;
+};
+
+SimplifyWithGuaranteeCache::SimplifyWithGuaranteeCache(size_t capacity)
+    : impl_(new Impl(capacity)) {}
+
+SimplifyWithGuaranteeCache::~SimplifyWithGuaranteeCache() = default;
+
+Result<Expression> SimplifyWithGuaranteeCache::Simplify(
+    const Expression& expr, const Expression& guaranteed_true_predicate) {
+  Impl::Key key{expr,
+                RelevantGuarantee(impl_->Fields(expr), guaranteed_true_predicate)};
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    auto it = impl_->simplified.find(key);
+    if (it != impl_->simplified.end()) return it->second;
+  }
+
+  // Simplify outside the lock; concurrent misses of a key compute the same result
+  ARROW_ASSIGN_OR_RAISE(auto simplified, SimplifyWithGuarantee(expr, key.guarantee));
+
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  if (impl_->simplified.size() >= impl_->capacity) impl_->simplified.clear();
+  impl_->simplified.emplace(std::move(key), simplified);
+  return simplified;
+}
+
+Result<std::vector<Expression>> SimplifyWithGuarantees(
+    const Expression& expr, const std::vector<Expression>& guaranteed_true_predicates) {
+  SimplifyWithGuaranteeCache cache(std::numeric_limits<size_t>::max());
+  std::vector<Expression> out;
+  out.reserve(guaranteed_true_predicates.size());
+  for (const auto& guarantee : guaranteed_true_predicates) {
+    ARROW_ASSIGN_OR_RAISE(auto simplified, cache.Simplify(expr, guarantee));
+    out.push_back(std::move(simplified));
+  }
+  return out;
+}
+
 // Serialization is accomplished by converting expressions to KeyValueMetadata and storing
 // this in the schema of a RecordBatch. Embedded arrays and scalars are stored in its
 // columns. Finally, the RecordBatch is written to an IPC file.
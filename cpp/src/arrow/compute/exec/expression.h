@@ -168,6 +168,12 @@ Expression call(std::string function, std::vector<Expression> arguments,
 ARROW_EXPORT
 std::vector<FieldRef> FieldsInExpression(const Expression&);
 
+/// Mark the top-level columns of the input referenced by a bound Expression.
+///
+/// `columns` must hold one flag per column of the schema the expression was bound to.
+ARROW_EXPORT
+void MarkReferencedColumns(const Expression&, std::vector<bool>* columns);
+
 /// Check if the expression references any fields.
 ARROW_EXPORT
 bool ExpressionHasFieldRefs(const Expression&);
@@ -219,6 +225,35 @@ ARROW_EXPORT
 Result<Expression> SimplifyWithGuarantee(Expression,
                                          const Expression& guaranteed_true_predicate);
 
+/// \brief A cache of the results of SimplifyWithGuarantee.
+///
+/// The fragments of a dataset often share partition expressions, or differ only in
+/// fields which a filter doesn't reference. The conjunction members of a guarantee which
+/// reference none of the fields of the expression can't simplify it, so they are
+/// dropped, and an expression is simplified once per remaining guarantee.
+///
+/// Thread-safe. The cache is cleared when it would hold more than `capacity` results.
+class ARROW_EXPORT SimplifyWithGuaranteeCache {
+ public:
+  explicit SimplifyWithGuaranteeCache(size_t capacity = 4096);
+  ~SimplifyWithGuaranteeCache();
+
+  /// Equivalent to SimplifyWithGuarantee(expr, guaranteed_true_predicate).
+  Result<Expression> Simplify(const Expression& expr,
+                              const Expression& guaranteed_true_predicate);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// Simplify an expression based on each of several guarantees, as
+/// SimplifyWithGuarantee. The simplification is shared by the guarantees which are
+/// identical in the fields the expression references.
+ARROW_EXPORT
+Result<std::vector<Expression>> SimplifyWithGuarantees(
+    const Expression&, const std::vector<Expression>& guaranteed_true_predicates);
+
 /// @}
 
 // Execution
@@ -230,7 +265,15 @@ ARROW_EXPORT Result<ExecBatch> MakeExecBatch(const Schema& full_schema,
                                              const Datum& partial);
 
 /// Execute a scalar expression against the provided state and input ExecBatch. This
-/// expression must be bound.
+/// expression must be bound.  Calls which occur several times in the expression are
+/// only evaluated once.
+///
+/// When the expression is a tree of several calls over fixed-width values, large
+/// batches are executed in cache-sized tiles, so that intermediate results needn't
+/// be materialized for the whole batch.
+///
+/// The value arguments of if_else and case_when which are selected by few rows are
+/// only evaluated over those rows.
 ARROW_EXPORT
 Result<Datum> ExecuteScalarExpression(const Expression&, const ExecBatch& input,
                                       ExecContext* = NULLPTR);
@@ -240,6 +283,17 @@ ARROW_EXPORT
 Result<Datum> ExecuteScalarExpression(const Expression&, const Schema& full_schema,
                                       const Datum& partial_input, ExecContext* = NULLPTR);
 
+/// Execute several scalar expressions against the same input ExecBatch.  The
+/// expressions must be bound.
+///
+/// Calls which occur more than once, within one expression or across several, are only
+/// evaluated once.  For instance `a * b` is computed a single time when executing both
+/// `a * b + 1` and `a * b - 1`.
+ARROW_EXPORT
+Result<std::vector<Datum>> ExecuteScalarExpressions(const std::vector<Expression>&,
+                                                    const ExecBatch& input,
+                                                    ExecContext* = NULLPTR);
+
 // Serialization
 
 ARROW_EXPORT
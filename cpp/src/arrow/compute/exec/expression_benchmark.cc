@@ -70,6 +70,35 @@ static void SimplifyFilterWithGuarantee(benchmark::State& state, Expression filt
   }
 }
 
+// Simplify a filter on "a" against the partition expressions "a=i/b=j" of many
+// fragments, one at a time or all at once, which shares the simplifications.
+static void SimplifyFilterWithManyGuarantees(benchmark::State& state) {
+  const bool all_at_once = state.range(0) != 0;
+  auto dataset_schema = schema({field("a", int64()), field("b", int64())});
+  ASSIGN_OR_ABORT(auto filter,
+                  equal(field_ref("a"), literal(int64_t(3))).Bind(*dataset_schema));
+  std::vector<Expression> guarantees;
+  for (int64_t a = 0; a < 10; ++a) {
+    for (int64_t b = 0; b < 1000; ++b) {
+      guarantees.push_back(
+          and_(equal(field_ref("a"), literal(a)), equal(field_ref("b"), literal(b))));
+    }
+  }
+
+  for (auto _ : state) {
+    if (all_at_once) {
+      ABORT_NOT_OK(SimplifyWithGuarantees(filter, guarantees));
+    } else {
+      for (const auto& guarantee : guarantees) {
+        ABORT_NOT_OK(SimplifyWithGuarantee(filter, guarantee));
+      }
+    }
+  }
+  state.counters["guarantees_per_second"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * guarantees.size()),
+      benchmark::Counter::kIsRate);
+}
+
 static void ExecuteScalarExpressionOverhead(benchmark::State& state, Expression expr) {
   const auto rows_per_batch = static_cast<int32_t>(state.range(0));
   const auto num_batches = 1000000 / rows_per_batch;
@@ -145,6 +174,8 @@ BENCHMARK_CAPTURE(SimplifyFilterWithGuarantee,
 BENCHMARK_CAPTURE(SimplifyFilterWithGuarantee, positive_filter_cast_guarantee_dictionary,
                   filter_cast_positive, guarantee_dictionary);
 
+BENCHMARK(SimplifyFilterWithManyGuarantees)->ArgNames({"all_at_once"})->Arg(0)->Arg(1);
+
 BENCHMARK_CAPTURE(BindAndEvaluate, simple_array, field_ref("int_arr"));
 BENCHMARK_CAPTURE(BindAndEvaluate, simple_scalar, field_ref("int_scalar"));
 BENCHMARK_CAPTURE(BindAndEvaluate, nested_array,
@@ -30,6 +30,7 @@
 #include "arrow/compute/function_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/util/make_unique.h"
 
 using testing::HasSubstr;
@@ -221,6 +222,43 @@ TEST(ExpressionUtils, MakeExecBatch) {
   ASSERT_RAISES(Invalid, MakeExecBatch(*kBoringSchema, duplicated_names));
 }
 
+TEST(ExpressionUtils, MakeExecBatchPadsStructs) {
+  // Readers may only materialize some children of a struct column
+  auto inner = struct_({field("x", int32()), field("y", utf8())});
+  auto full_schema = schema({field("s", struct_({field("a", int32()), field("b", inner),
+                                                 field("c", float64())}))});
+  auto partial_type =
+      struct_({field("b", struct_({field("y", utf8())})), field("a", int32())});
+  auto partial = ArrayFromJSON(partial_type, R"([
+    {"b": {"y": "one"}, "a": 1},
+    null,
+    {"b": null, "a": 3},
+    {"b": {"y": "four"}, "a": 4}
+  ])");
+  // Conforming must respect the offset of the partial column
+  auto partial_batch = RecordBatch::Make(schema({field("s", partial_type)}), 3,
+                                         {partial->Slice(1)});
+
+  ASSERT_OK_AND_ASSIGN(auto batch, MakeExecBatch(*full_schema, partial_batch));
+  ASSERT_EQ(batch.num_values(), 1);
+  auto expected = ArrayFromJSON(full_schema->field(0)->type(), R"([
+    null,
+    {"a": 3, "b": null, "c": null},
+    {"a": 4, "b": {"x": null, "y": "four"}, "c": null}
+  ])");
+  ASSERT_OK(batch[0].make_array()->ValidateFull());
+  AssertDatumsEqual(expected, batch[0]);
+
+  // Duplicate names can't be matched by name
+  ASSERT_OK_AND_ASSIGN(auto duplicated,
+                       StructArray::Make({ArrayFromJSON(int32(), "[1]"),
+                                          ArrayFromJSON(int32(), "[2]")},
+                                         std::vector<std::string>{"a", "a"}));
+  ASSERT_NOT_OK(MakeExecBatch(
+      *full_schema,
+      RecordBatch::Make(schema({field("s", duplicated->type())}), 1, {duplicated})));
+}
+
 class WidgetifyOptions : public compute::FunctionOptions {
  public:
   explicit WidgetifyOptions(bool really = true);
@@ -823,6 +861,168 @@ TEST(Expression, ExecuteDictionaryTransparent) {
   ])"));
 }
 
+TEST(Expression, ExecuteCommonSubexpressions) {
+  // An identity function counting how often it is executed
+  static int num_calls = 0;
+  auto registry = FunctionRegistry::Make(GetFunctionRegistry());
+  auto counted = std::make_shared<ScalarFunction>("counted", Arity::Unary(),
+                                                  /*doc=*/FunctionDoc::Empty());
+  ScalarKernel kernel({InputType::Array(float64())}, float64(),
+                      [](KernelContext*, const ExecSpan& batch, ExecResult* out) {
+                        ++num_calls;
+                        out->value = batch[0].array.ToArrayData();
+                        return Status::OK();
+                      });
+  kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  ASSERT_OK(counted->AddKernel(std::move(kernel)));
+  ASSERT_OK(registry->AddFunction(std::move(counted)));
+  ExecContext exec_context(default_memory_pool(), /*executor=*/nullptr, registry.get());
+
+  auto schm = schema({field("a", float64()), field("b", float64())});
+  auto shared = call("counted", {call("multiply", {field_ref("a"), field_ref("b")})});
+  std::vector<Expression> exprs = {
+      call("add", {shared, literal(1.0)}),
+      call("subtract", {shared, call("counted", {field_ref("a")})}),
+      call("multiply", {shared, shared}),
+  };
+  for (auto& expr : exprs) {
+    ASSERT_OK_AND_ASSIGN(expr, expr.Bind(*schm, &exec_context));
+  }
+
+  ExecBatch batch({ArrayFromJSON(float64(), "[1, 2, null, 4]"),
+                   ArrayFromJSON(float64(), "[0.5, 3, 1, null]")},
+                  /*length=*/4);
+
+  std::vector<Datum> expected;
+  for (const auto& expr : exprs) {
+    ASSERT_OK_AND_ASSIGN(auto out, ExecuteScalarExpression(expr, batch, &exec_context));
+    expected.push_back(std::move(out));
+  }
+  // Repeated within the last expression only
+  num_calls = 0;
+  ASSERT_OK(ExecuteScalarExpression(exprs[2], batch, &exec_context).status());
+  ASSERT_EQ(num_calls, 1);
+
+  num_calls = 0;
+  ASSERT_OK_AND_ASSIGN(auto actual,
+                       ExecuteScalarExpressions(exprs, batch, &exec_context));
+  // counted(a * b) once, counted(a) once
+  ASSERT_EQ(num_calls, 2);
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); ++i) {
+    AssertDatumsEqual(expected[i], actual[i], /*verbose=*/true);
+  }
+  AssertDatumsEqual(ArrayFromJSON(float64(), "[0.25, 36, null, null]"), actual[2]);
+}
+
+TEST(Expression, ExecuteLargeBatchInTiles) {
+  // Trees of several calls over large batches are executed in cache-sized tiles
+  random::RandomArrayGenerator rng(42);
+  const int64_t length = 1 << 18;
+  auto schm = schema({field("a", float64()), field("b", float64()), field("c", int32()),
+                      field("d", boolean())});
+  ArrayVector columns = {rng.Float64(length, -100, 100, /*null_probability=*/0.1),
+                         rng.Float64(length, -100, 100, /*null_probability=*/0.1),
+                         rng.Int32(length, -100, 100, /*null_probability=*/0.1),
+                         rng.Boolean(length, 0.5, /*null_probability=*/0.1)};
+  ExecBatch batch(std::vector<Datum>(columns.begin(), columns.end()), length);
+  auto record_batch = RecordBatch::Make(schm, length, columns);
+
+  auto sum = call("add", {field_ref("a"), field_ref("b")});
+  std::vector<Expression> exprs = {
+      greater(call("multiply", {sum, field_ref("c")}), literal(10.0)),
+      call("if_else", {field_ref("d"), sum, call("negate", {sum})}),
+      and_(field_ref("d"), less(field_ref("c"), literal(0))),
+  };
+  for (auto& expr : exprs) {
+    ASSERT_OK_AND_ASSIGN(expr, expr.Bind(*schm));
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto actual, ExecuteScalarExpressions(exprs, batch));
+  ASSERT_EQ(actual.size(), exprs.size());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    ARROW_SCOPED_TRACE(exprs[i].ToString());
+    ASSERT_OK_AND_ASSIGN(Datum expected,
+                         NaiveExecuteScalarExpression(exprs[i], record_batch));
+    ASSERT_OK_AND_ASSIGN(Datum single, ExecuteScalarExpression(exprs[i], batch));
+    ASSERT_OK(single.make_array()->ValidateFull());
+    AssertDatumsEqual(expected, single, /*verbose=*/true);
+    AssertDatumsEqual(expected, actual[i], /*verbose=*/true);
+  }
+}
+
+TEST(Expression, ExecuteBranchesLazily) {
+  // An identity function counting the rows it is executed over
+  static int64_t num_rows = 0;
+  auto registry = FunctionRegistry::Make(GetFunctionRegistry());
+  auto counted = std::make_shared<ScalarFunction>("counted", Arity::Unary(),
+                                                  /*doc=*/FunctionDoc::Empty());
+  ScalarKernel kernel({InputType::Array(float64())}, float64(),
+                      [](KernelContext*, const ExecSpan& batch, ExecResult* out) {
+                        num_rows += batch.length;
+                        out->value = batch[0].array.ToArrayData();
+                        return Status::OK();
+                      });
+  kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  ASSERT_OK(counted->AddKernel(std::move(kernel)));
+  ASSERT_OK(registry->AddFunction(std::move(counted)));
+  ExecContext exec_context(default_memory_pool(), /*executor=*/nullptr, registry.get());
+
+  auto schm = schema({field("a", float64()), field("b", float64()),
+                      field("c", boolean()), field("d", boolean())});
+  auto record_batch = RecordBatchFromJSON(schm, R"([
+    {"a": 1, "b": -1, "c": true, "d": false},
+    {"a": 2, "b": -2, "c": false, "d": false},
+    {"a": 3, "b": -3, "c": null, "d": true},
+    {"a": null, "b": -4, "c": false, "d": false},
+    {"a": 5, "b": -5, "c": false, "d": null},
+    {"a": 6, "b": null, "c": true, "d": false},
+    {"a": 7, "b": -7, "c": false, "d": false},
+    {"a": 8, "b": -8, "c": false, "d": true}
+  ])");
+  ExecBatch batch(*record_batch);
+
+  auto counted_a = call("counted", {field_ref("a")});
+  auto counted_b = call("counted", {field_ref("b")});
+  auto conds = call("make_struct", {field_ref("c"), field_ref("d")},
+                    MakeStructOptions({"c", "d"}));
+  struct {
+    Expression expr;
+    int64_t expected_rows;
+  } cases[] = {
+      // Rows selecting counted(a) only, the other branch is selected by most rows
+      {call("if_else", {field_ref("c"), counted_a, call("negate", {field_ref("b")})}), 2},
+      {call("if_else", {field_ref("c"), counted_a, counted_b}), 2 + 8},
+      // A branch selected by no row isn't evaluated
+      {call("if_else", {and_(field_ref("c"), field_ref("d")), counted_a, field_ref("b")}),
+       0},
+      {call("case_when", {conds, counted_a, counted_b}), 2 + 2},
+      {call("case_when", {conds, counted_a, counted_b, field_ref("b")}), 2 + 2},
+  };
+  for (auto& test_case : cases) {
+    ARROW_SCOPED_TRACE(test_case.expr.ToString());
+    ASSERT_OK_AND_ASSIGN(auto expr, test_case.expr.Bind(*schm, &exec_context));
+    num_rows = 0;
+    ASSERT_OK_AND_ASSIGN(Datum actual,
+                         ExecuteScalarExpression(expr, batch, &exec_context));
+    ASSERT_EQ(num_rows, test_case.expected_rows);
+
+    // Evaluate all branches over the whole batch
+    std::vector<Datum> arguments;
+    for (const auto& argument : expr.call()->arguments) {
+      ASSERT_OK_AND_ASSIGN(Datum value,
+                           ExecuteScalarExpression(argument, batch, &exec_context));
+      arguments.push_back(std::move(value));
+    }
+    ASSERT_OK_AND_ASSIGN(Datum expected,
+                         CallFunction(expr.call()->function_name, arguments,
+                                      expr.call()->options.get(), &exec_context));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+}
+
 void ExpectIdenticalIfUnchanged(Expression modified, Expression original) {
   if (modified == original) {
     // no change -> must be identical
@@ -1128,6 +1328,11 @@ struct Simplify {
                                       << (simplified == bound ? "  (no change)\n" : "");
 
       ExpectIdenticalIfUnchanged(simplified, bound);
+
+      // the cache only drops the members of the guarantee which can't simplify expr
+      SimplifyWithGuaranteeCache cache;
+      ASSERT_OK_AND_ASSIGN(auto cached, cache.Simplify(bound, guarantee));
+      EXPECT_EQ(cached, simplified);
     }
     void ExpectUnchanged() { Expect(expr); }
     void Expect(bool constant) { Expect(literal(constant)); }
@@ -1391,6 +1596,46 @@ TEST(Expression, SimplifyWithComparisonAndNullableCaveat) {
           true_unless_null(field_ref("i32"))));  // not satisfiable, will drop row group
 }
 
+TEST(Expression, SimplifyWithGuarantees) {
+  auto i32 = field_ref("i32");
+  auto f32 = field_ref("f32");
+  ASSERT_OK_AND_ASSIGN(auto filter,
+                       or_(equal(i32, literal(1)), is_null(i32)).Bind(*kBoringSchema));
+
+  // partition expressions which only differ in f32 share a simplification
+  std::vector<Expression> guarantees;
+  for (int i : {0, 1}) {
+    for (float f : {0.5F, 1.5F, 2.5F}) {
+      guarantees.push_back(and_(equal(i32, literal(i)), equal(f32, literal(f))));
+    }
+  }
+  guarantees.push_back(is_null(i32));
+  guarantees.push_back(literal(true));
+
+  ASSERT_OK_AND_ASSIGN(auto simplified, SimplifyWithGuarantees(filter, guarantees));
+  ASSERT_EQ(simplified.size(), guarantees.size());
+  for (size_t i = 0; i < guarantees.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto expected, SimplifyWithGuarantee(filter, guarantees[i]));
+    EXPECT_EQ(simplified[i], expected) << "  guarantee: " << guarantees[i].ToString();
+  }
+  EXPECT_EQ(simplified[0], literal(false));
+  EXPECT_EQ(simplified[5], literal(true));
+  EXPECT_EQ(simplified[6], literal(true));
+
+  // a cache shared by several filters, cleared at capacity
+  SimplifyWithGuaranteeCache cache(/*capacity=*/2);
+  ASSERT_OK_AND_ASSIGN(auto other, equal(f32, literal(1.5F)).Bind(*kBoringSchema));
+  for (int round = 0; round < 2; ++round) {
+    for (const auto& guarantee : guarantees) {
+      for (const auto& expr : {filter, other}) {
+        ASSERT_OK_AND_ASSIGN(auto expected, SimplifyWithGuarantee(expr, guarantee));
+        ASSERT_OK_AND_ASSIGN(auto cached, cache.Simplify(expr, guarantee));
+        EXPECT_EQ(cached, expected);
+      }
+    }
+  }
+}
+
 TEST(Expression, SimplifyThenExecute) {
   auto filter =
       or_({equal(field_ref("f32"), literal(0)),
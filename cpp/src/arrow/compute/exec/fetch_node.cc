@@ -0,0 +1,227 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <sstream>
+
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace {
+
+class FetchNode : public ExecNode {
+ public:
+  FetchNode(ExecPlan* plan, std::vector<ExecNode*> inputs, int64_t offset, int64_t count)
+      : ExecNode(plan, inputs, {"input"},
+                 /*output_schema=*/inputs[0]->output_schema(),
+                 /*num_outputs=*/1),
+        offset_(offset),
+        count_(count),
+        end_(offset > std::numeric_limits<int64_t>::max() - count
+                 ? std::numeric_limits<int64_t>::max()
+                 : offset + count) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "FetchNode"));
+    const auto& fetch_options = checked_cast<const FetchNodeOptions&>(options);
+    if (fetch_options.offset < 0) {
+      return Status::Invalid("FetchNode offset must be non-negative, got ",
+                             fetch_options.offset);
+    }
+    if (fetch_options.count < 0) {
+      return Status::Invalid("FetchNode count must be non-negative, got ",
+                             fetch_options.count);
+    }
+    return plan->EmplaceNode<FetchNode>(plan, std::move(inputs), fetch_options.offset,
+                                        fetch_options.count);
+  }
+
+  const char* kind_name() const override { return "FetchNode"; }
+
+  void InputReceived(ExecNode* input, ExecBatch batch) override {
+    EVENT(span_, "InputReceived", {{"batch.length", batch.length}});
+    DCHECK_EQ(input, inputs_[0]);
+
+    bool emit = false;
+    bool satisfied = false;
+    int total_batches = 0;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (output_finished_) {
+        // Batches which were already in flight when the input was stopped
+        return;
+      }
+      int64_t batch_start = rows_seen_;
+      rows_seen_ += batch.length;
+      int64_t slice_start = std::max(batch_start, offset_);
+      int64_t slice_end = std::min(rows_seen_, end_);
+      if (slice_start < slice_end) {
+        if (slice_start > batch_start || slice_end < rows_seen_) {
+          batch = batch.Slice(slice_start - batch_start, slice_end - slice_start);
+        }
+        emit = true;
+        ++batches_output_;
+      }
+      if (rows_seen_ >= end_) {
+        satisfied = output_finished_ = true;
+        total_batches = batches_output_;
+      }
+    }
+
+    if (emit) {
+      EmitBatch(std::move(batch));
+      if (output_counter_.Increment()) {
+        finished_.MarkFinished();
+      }
+    }
+    if (satisfied) {
+      FinishOutput(total_batches);
+      // Nothing more is needed from upstream, so let producers such as scans stop early
+      inputs_[0]->StopProducing(this);
+      return;
+    }
+    if (input_counter_.Increment()) {
+      InputExhausted();
+    }
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    EVENT(span_, "ErrorReceived", {{"error", error.message()}});
+    DCHECK_EQ(input, inputs_[0]);
+    outputs_[0]->ErrorReceived(this, std::move(error));
+    StopProducing();
+  }
+
+  void InputFinished(ExecNode* input, int total_batches) override {
+    EVENT(span_, "InputFinished", {{"batches.length", total_batches}});
+    DCHECK_EQ(input, inputs_[0]);
+    if (input_counter_.SetTotal(total_batches)) {
+      InputExhausted();
+    }
+  }
+
+  Status StartProducing() override {
+    START_COMPUTE_SPAN(span_, std::string(kind_name()) + ":" + label(),
+                       {{"node.label", label()},
+                        {"node.detail", ToString()},
+                        {"node.kind", kind_name()}});
+    finished_ = Future<>::Make();
+    END_SPAN_ON_FUTURE_COMPLETION(span_, finished_, this);
+    if (count_ == 0) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        output_finished_ = true;
+      }
+      FinishOutput(0);
+      inputs_[0]->StopProducing(this);
+    }
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  void StopProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    StopProducing();
+  }
+
+  void StopProducing() override {
+    EVENT(span_, "StopProducing");
+    if (output_counter_.Cancel()) {
+      finished_.MarkFinished();
+    }
+    inputs_[0]->StopProducing(this);
+  }
+
+  Future<> finished() override { return finished_; }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    ss << "offset=" << offset_ << ", count=" << count_;
+    return ss.str();
+  }
+
+ private:
+  // Called once every input batch has been processed without reaching the limit
+  void InputExhausted() {
+    int total_batches;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (output_finished_) {
+        return;
+      }
+      output_finished_ = true;
+      total_batches = batches_output_;
+    }
+    FinishOutput(total_batches);
+  }
+
+  void FinishOutput(int total_batches) {
+    outputs_[0]->InputFinished(this, total_batches);
+    if (output_counter_.SetTotal(total_batches)) {
+      finished_.MarkFinished();
+    }
+  }
+
+  const int64_t offset_;
+  const int64_t count_;
+  // One past the last row to forward, saturated to the maximum
+  const int64_t end_;
+
+  std::mutex mutex_;
+  int64_t rows_seen_ = 0;
+  int batches_output_ = 0;
+  bool output_finished_ = false;
+
+  AtomicCounter input_counter_;
+  // Counts batches forwarded downstream, so that the node only finishes once none of
+  // them are still being pushed
+  AtomicCounter output_counter_;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterFetchNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory("fetch", FetchNode::Make));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,125 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <limits>
+
+#include "arrow/api.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/matchers.h"
+
+namespace arrow {
+namespace compute {
+
+class FetchNodeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    schema_ = schema({field("i", int32())});
+    input_ = MakeBatchesFromString(
+        schema_, {"[[0], [1], [2]]", "[]", "[[3], [4], [5], [6]]", "[[7], [8]]"});
+  }
+
+  // Run `extra` (if any) followed by a fetch over a source which counts its pulls
+  Result<std::shared_ptr<Table>> RunFetch(const BatchesWithSchema& input,
+                                          FetchNodeOptions options,
+                                          std::vector<Declaration> extra = {}) {
+    ExecContext exec_ctx(default_memory_pool(), nullptr);
+    ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make(&exec_ctx));
+    auto gen = input.gen(/*parallel=*/false, /*slow=*/false);
+    auto pulls = &pulls_;
+    pulls_ = 0;
+    AsyncGenerator<util::optional<ExecBatch>> counting_gen = [gen, pulls] {
+      ++*pulls;
+      return gen();
+    };
+    std::vector<Declaration> decls;
+    decls.emplace_back(
+        Declaration{"source", SourceNodeOptions{input.schema, counting_gen}});
+    for (auto& decl : extra) {
+      decls.emplace_back(std::move(decl));
+    }
+    decls.emplace_back(Declaration{"fetch", std::move(options)});
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    decls.emplace_back(Declaration{"sink", SinkNodeOptions{&sink_gen}});
+    ARROW_RETURN_NOT_OK(Declaration::Sequence(std::move(decls)).AddToPlan(plan.get()));
+    auto collected = StartAndCollect(plan.get(), sink_gen).result();
+    ARROW_RETURN_NOT_OK(collected.status());
+    return TableFromExecBatches(input.schema, *collected);
+  }
+
+  void CheckFetch(int64_t offset, int64_t count, const std::string& expected_json) {
+    ARROW_SCOPED_TRACE("offset=", offset, " count=", count);
+    ASSERT_OK_AND_ASSIGN(auto actual, RunFetch(input_, FetchNodeOptions(offset, count)));
+    auto expected = TableFromJSON(schema_, {expected_json});
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+
+  std::shared_ptr<Schema> schema_;
+  BatchesWithSchema input_;
+  std::atomic<int> pulls_{0};
+};
+
+TEST_F(FetchNodeTest, OffsetAndCount) {
+  CheckFetch(0, 2, "[[0], [1]]");
+  CheckFetch(2, 5, "[[2], [3], [4], [5], [6]]");
+  CheckFetch(3, 4, "[[3], [4], [5], [6]]");
+  CheckFetch(5, 100, "[[5], [6], [7], [8]]");
+  CheckFetch(0, std::numeric_limits<int64_t>::max(),
+             "[[0], [1], [2], [3], [4], [5], [6], [7], [8]]");
+  CheckFetch(9, 1, "[]");
+  CheckFetch(std::numeric_limits<int64_t>::max(), 1, "[]");
+  CheckFetch(4, 0, "[]");
+}
+
+TEST_F(FetchNodeTest, StopsInputEarly) {
+  constexpr int kNumBatches = 1000;
+  BatchesWithSchema many;
+  many.schema = schema_;
+  for (int i = 0; i < kNumBatches; ++i) {
+    many.batches.push_back(input_.batches[2]);
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto actual, RunFetch(many, FetchNodeOptions(1, 6)));
+  ASSERT_EQ(actual->num_rows(), 6);
+  ASSERT_LT(pulls_.load(), 10);
+
+  // The stop request propagates through intermediate nodes
+  ASSERT_OK_AND_ASSIGN(
+      actual,
+      RunFetch(many, FetchNodeOptions(0, 10),
+               {{"filter", FilterNodeOptions{greater(field_ref("i"), literal(4))}}}));
+  ASSERT_EQ(actual->num_rows(), 10);
+  ASSERT_LT(pulls_.load(), 10);
+
+  // Nothing is needed at all
+  ASSERT_OK_AND_ASSIGN(actual, RunFetch(many, FetchNodeOptions(0, 0)));
+  ASSERT_EQ(actual->num_rows(), 0);
+  ASSERT_EQ(pulls_.load(), 0);
+}
+
+TEST_F(FetchNodeTest, Errors) {
+  ASSERT_RAISES(Invalid, RunFetch(input_, FetchNodeOptions(-1, 1)));
+  ASSERT_RAISES(Invalid, RunFetch(input_, FetchNodeOptions(0, -1)));
+}
+
+}  // namespace compute
+}  // namespace arrow
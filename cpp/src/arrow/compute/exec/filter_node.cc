@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include "arrow/array/array_primitive.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec/exec_plan.h"
@@ -39,7 +40,10 @@ class FilterNode : public MapNode {
   FilterNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
              std::shared_ptr<Schema> output_schema, Expression filter, bool async_mode)
       : MapNode(plan, std::move(inputs), std::move(output_schema), async_mode),
-        filter_(std::move(filter)) {}
+        filter_(std::move(filter)),
+        filter_columns_(output_schema_->num_fields(), false) {
+    MarkReferencedColumns(filter_, &filter_columns_);
+  }
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -66,6 +70,10 @@ class FilterNode : public MapNode {
 
   const char* kind_name() const override { return "FilterNode"; }
 
+  bool accepts_selection_vector() const override { return true; }
+
+  // The rows passing the filter are not copied, they are selected by the selection
+  // vector of the output batch.  Downstream nodes copy the columns they read.
   Result<ExecBatch> DoFilter(const ExecBatch& target) {
     ARROW_ASSIGN_OR_RAISE(Expression simplified_filter,
                           SimplifyWithGuarantee(filter_, target.guarantee));
@@ -76,7 +84,11 @@ class FilterNode : public MapNode {
                         {"filter.expression.simplified", simplified_filter.ToString()},
                         {"filter.length", target.length}});
 
-    ARROW_ASSIGN_OR_RAISE(Datum mask, ExecuteScalarExpression(simplified_filter, target,
+    // Only the columns read by the filter are copied from an input which is already
+    // filtered
+    ARROW_ASSIGN_OR_RAISE(ExecBatch input,
+                          target.ApplySelection(filter_columns_, plan()->exec_context()));
+    ARROW_ASSIGN_OR_RAISE(Datum mask, ExecuteScalarExpression(simplified_filter, input,
                                                               plan()->exec_context()));
 
     if (mask.is_scalar()) {
@@ -91,12 +103,25 @@ class FilterNode : public MapNode {
     DCHECK(!std::all_of(target.values.begin(), target.values.end(),
                         [](const Datum& value) { return value.is_scalar(); }));
 
-    auto values = target.values;
-    for (auto& value : values) {
-      if (value.is_scalar()) continue;
-      ARROW_ASSIGN_OR_RAISE(value, Filter(value, mask, FilterOptions::Defaults()));
+    ARROW_ASSIGN_OR_RAISE(
+        auto selection, SelectionVector::FromMask(BooleanArray(mask.array()),
+                                                  plan()->exec_context()->memory_pool()));
+    if (selection->length() == target.length) {
+      return target;
     }
-    return ExecBatch::Make(std::move(values));
+    if (target.selection_vector) {
+      // Rows of the input are rows of the values selected by the input's selection
+      ARROW_ASSIGN_OR_RAISE(
+          Datum indices,
+          Take(target.selection_vector->data(), selection->data(),
+               TakeOptions::NoBoundsCheck(), plan()->exec_context()));
+      selection = std::make_shared<SelectionVector>(indices.array());
+    }
+
+    ExecBatch out = target;
+    out.selection_vector = std::move(selection);
+    out.length = out.selection_vector->length();
+    return out;
   }
 
   void InputReceived(ExecNode* input, ExecBatch batch) override {
@@ -123,6 +148,8 @@ class FilterNode : public MapNode {
 
  private:
   Expression filter_;
+  // The input columns read by the filter
+  std::vector<bool> filter_columns_;
 };
 }  // namespace
 
@@ -27,9 +27,12 @@
 
 #include "arrow/compute/exec/hash_join_dict.h"
 #include "arrow/compute/exec/key_hash.h"
+#include "arrow/compute/exec/swiss_join.h"
 #include "arrow/compute/exec/task_util.h"
 #include "arrow/compute/kernels/row_encoder.h"
 #include "arrow/compute/row/encode_internal.h"
+#include "arrow/memory_pool.h"
+#include "arrow/util/make_unique.h"
 #include "arrow/util/tracing_internal.h"
 
 namespace arrow {
@@ -40,6 +43,8 @@ class HashJoinBasicImpl : public HashJoinImpl {
   struct ThreadLocalState;
 
  public:
+  explicit HashJoinBasicImpl(bool use_swiss_table) : use_swiss_table_(use_swiss_table) {}
+
   Status Init(ExecContext* ctx, JoinType join_type, size_t num_threads,
               HashJoinSchema* schema_mgr, std::vector<JoinKeyCmp> key_cmp,
               Expression filter, OutputBatchCallback output_batch_callback,
@@ -71,6 +76,9 @@ class HashJoinBasicImpl : public HashJoinImpl {
     cancelled_ = false;
 
     RegisterBuildHashTable();
+    if (use_swiss_table_) {
+      RegisterBuildSwissTable();
+    }
     RegisterScanHashTable();
     return Status::OK();
   }
@@ -111,8 +119,8 @@ class HashJoinBasicImpl : public HashJoinImpl {
     return Status::OK();
   }
 
-  Status EncodeBatch(int side, HashJoinProjection projection_handle, RowEncoder* encoder,
-                     const ExecBatch& batch, ExecBatch* opt_projected_batch = nullptr) {
+  ExecBatch ProjectBatch(int side, HashJoinProjection projection_handle,
+                         const ExecBatch& batch) {
     ExecBatch projected({}, batch.length);
     int num_cols = schema_mgr_->proj_maps[side].num_cols(projection_handle);
     projected.values.resize(num_cols);
@@ -122,6 +130,21 @@ class HashJoinBasicImpl : public HashJoinImpl {
     for (int icol = 0; icol < num_cols; ++icol) {
       projected.values[icol] = batch.values[to_input.get(icol)];
     }
+    return projected;
+  }
+
+  std::vector<std::shared_ptr<DataType>> KeyTypes(int side) {
+    int num_cols = schema_mgr_->proj_maps[side].num_cols(HashJoinProjection::KEY);
+    std::vector<std::shared_ptr<DataType>> types(num_cols);
+    for (int icol = 0; icol < num_cols; ++icol) {
+      types[icol] = schema_mgr_->proj_maps[side].data_type(HashJoinProjection::KEY, icol);
+    }
+    return types;
+  }
+
+  Status EncodeBatch(int side, HashJoinProjection projection_handle, RowEncoder* encoder,
+                     const ExecBatch& batch, ExecBatch* opt_projected_batch = nullptr) {
+    ExecBatch projected = ProjectBatch(side, projection_handle, batch);
 
     if (opt_projected_batch) {
       *opt_projected_batch = projected;
@@ -487,6 +510,7 @@ class HashJoinBasicImpl : public HashJoinImpl {
   }
 
   Status ProbeSingleBatch(size_t thread_index, ExecBatch batch) override {
+    MemoryTagScope memory_tag("hash_join.probe");
     ThreadLocalState& local_state = local_states_[thread_index];
     RETURN_NOT_OK(InitLocalStateIfNeeded(thread_index));
 
@@ -518,18 +542,25 @@ class HashJoinBasicImpl : public HashJoinImpl {
           batch, &row_encoder_for_lookups, &batch_key_for_lookups, ctx_));
     }
 
-    // Collect information about all nulls in key columns.
-    //
-    std::vector<const uint8_t*> non_null_bit_vectors;
-    std::vector<int64_t> non_null_bit_vector_offsets;
-    std::vector<uint8_t> all_nulls;
-    NullInfoFromBatch(batch_key_for_lookups, &non_null_bit_vectors,
-                      &non_null_bit_vector_offsets, &all_nulls);
+    if (swiss_table_ && !hash_table_empty_) {
+      InitHasMatchIfNeeded(&local_state);
+      RETURN_NOT_OK(swiss_table_->Probe(
+          thread_index, batch_key_for_lookups, key_cmp_, &local_state.match,
+          &local_state.no_match, &local_state.match_left, &local_state.match_right));
+    } else {
+      // Collect information about all nulls in key columns.
+      //
+      std::vector<const uint8_t*> non_null_bit_vectors;
+      std::vector<int64_t> non_null_bit_vector_offsets;
+      std::vector<uint8_t> all_nulls;
+      NullInfoFromBatch(batch_key_for_lookups, &non_null_bit_vectors,
+                        &non_null_bit_vector_offsets, &all_nulls);
 
-    ProbeBatch_Lookup(&local_state, *row_encoder_for_lookups, non_null_bit_vectors,
-                      non_null_bit_vector_offsets, &local_state.match,
-                      &local_state.no_match, &local_state.match_left,
-                      &local_state.match_right);
+      ProbeBatch_Lookup(&local_state, *row_encoder_for_lookups, non_null_bit_vectors,
+                        non_null_bit_vector_offsets, &local_state.match,
+                        &local_state.no_match, &local_state.match_left,
+                        &local_state.match_right);
+    }
 
     RETURN_NOT_OK(ProbeBatch_ResidualFilter(local_state, local_state.match,
                                             local_state.no_match, local_state.match_left,
@@ -558,11 +589,28 @@ class HashJoinBasicImpl : public HashJoinImpl {
         });
   }
 
+  // The single task of the build.  It encodes the rows of the build side, which stays
+  // serial even with the swiss table: a row id is the position of the row in the
+  // append-only hash_table_keys_ and hash_table_payloads_ encoders, and their dictionary
+  // column encoders keep the dictionary of the first batch, which later batches are
+  // checked against and rows are decoded with.  Only the hashing, partitioning and
+  // insertion of the keys into the swiss table run in parallel, in the tasks started
+  // once this one finishes.
   Status BuildHashTable_exec_task(size_t thread_index, int64_t /*task_id*/) {
+    MemoryTagScope memory_tag("hash_join.build");
     AccumulationQueue batches = std::move(build_batches_);
+    swiss_table_.reset();
     if (batches.empty()) {
       hash_table_empty_ = true;
     } else {
+      // The swiss table indexes keys by their raw values, so it cannot be used when
+      // dictionary keys on the two sides need to be remapped.
+      bool use_swiss_table = use_swiss_table_ &&
+                             SwissJoinHashTable::IsSupported(KeyTypes(0)) &&
+                             SwissJoinHashTable::IsSupported(KeyTypes(1));
+      if (use_swiss_table) {
+        swiss_first_row_ids_.resize(batches.batch_count());
+      }
       dict_build_.InitEncoder(schema_mgr_->proj_maps[1], &hash_table_keys_, ctx_);
       bool has_payload =
           (schema_mgr_->proj_maps[1].num_cols(HashJoinProjection::PAYLOAD) > 0);
@@ -583,17 +631,32 @@ class HashJoinBasicImpl : public HashJoinImpl {
           RETURN_NOT_OK(dict_build_.Init(schema_mgr_->proj_maps[1], &batch, ctx_));
         }
         int32_t num_rows_before = hash_table_keys_.num_rows();
+        if (use_swiss_table) {
+          swiss_first_row_ids_[ibatch] = num_rows_before;
+        }
         RETURN_NOT_OK(dict_build_.EncodeBatch(thread_index, schema_mgr_->proj_maps[1],
                                               batch, &hash_table_keys_, ctx_));
         if (has_payload) {
           RETURN_NOT_OK(
               EncodeBatch(1, HashJoinProjection::PAYLOAD, &hash_table_payloads_, batch));
         }
+        if (use_swiss_table) {
+          continue;
+        }
         int32_t num_rows_after = hash_table_keys_.num_rows();
         for (int32_t irow = num_rows_before; irow < num_rows_after; ++irow) {
           hash_table_.insert(std::make_pair(hash_table_keys_.encoded_row(irow), irow));
         }
       }
+      if (use_swiss_table && !hash_table_empty_) {
+        swiss_table_ = ::arrow::internal::make_unique<SwissJoinHashTable>();
+        RETURN_NOT_OK(swiss_table_->Init(ctx_, KeyTypes(1), num_threads_,
+                                         static_cast<int64_t>(batches.batch_count()),
+                                         hash_table_keys_.num_rows()));
+        // Keys are inserted into the swiss table by the tasks started once this one
+        // finishes
+        swiss_build_batches_ = std::move(batches);
+      }
     }
 
     if (hash_table_empty_) {
@@ -605,6 +668,60 @@ class HashJoinBasicImpl : public HashJoinImpl {
 
   Status BuildHashTable_on_finished(size_t thread_index) {
     ARROW_DCHECK_EQ(build_batches_.batch_count(), 0);
+    if (swiss_table_) {
+      return scheduler_->StartTaskGroup(thread_index, task_group_partition_swiss_,
+                                        swiss_build_batches_.batch_count());
+    }
+    has_hash_table_ = true;
+    return build_finished_callback_(thread_index);
+  }
+
+  // Building the swiss table happens in two lock-free phases: every build batch is
+  // first hashed and split by partition in its own task, and then every partition is
+  // inserted into its own hash table in its own task.
+  //
+  void RegisterBuildSwissTable() {
+    task_group_partition_swiss_ = scheduler_->RegisterTaskGroup(
+        [this](size_t thread_index, int64_t task_id) -> Status {
+          return PartitionSwissTable_exec_task(thread_index, task_id);
+        },
+        [this](size_t thread_index) -> Status {
+          return PartitionSwissTable_on_finished(thread_index);
+        });
+    task_group_build_swiss_ = scheduler_->RegisterTaskGroup(
+        [this](size_t thread_index, int64_t task_id) -> Status {
+          return BuildSwissTable_exec_task(thread_index, task_id);
+        },
+        [this](size_t thread_index) -> Status {
+          return BuildSwissTable_on_finished(thread_index);
+        });
+  }
+
+  Status PartitionSwissTable_exec_task(size_t /*thread_index*/, int64_t task_id) {
+    if (cancelled_) {
+      return Status::Cancelled("Hash join cancelled");
+    }
+    const ExecBatch& batch = swiss_build_batches_[task_id];
+    return swiss_table_->PartitionBuildBatch(
+        task_id, ProjectBatch(1, HashJoinProjection::KEY, batch),
+        swiss_first_row_ids_[task_id]);
+  }
+
+  Status PartitionSwissTable_on_finished(size_t thread_index) {
+    swiss_build_batches_.Clear();
+    std::vector<int32_t>().swap(swiss_first_row_ids_);
+    return scheduler_->StartTaskGroup(thread_index, task_group_build_swiss_,
+                                      swiss_table_->num_partitions());
+  }
+
+  Status BuildSwissTable_exec_task(size_t /*thread_index*/, int64_t task_id) {
+    if (cancelled_) {
+      return Status::Cancelled("Hash join cancelled");
+    }
+    return swiss_table_->BuildPartition(static_cast<int>(task_id));
+  }
+
+  Status BuildSwissTable_on_finished(size_t thread_index) {
     has_hash_table_ = true;
     return build_finished_callback_(thread_index);
   }
@@ -687,6 +804,13 @@ class HashJoinBasicImpl : public HashJoinImpl {
       return Status::Cancelled("Hash join cancelled");
     }
     END_SPAN(span_);
+    // All output has been produced, release the hash table before reporting completion
+    // so that an owner running several joins in sequence does not accumulate them
+    std::unordered_multimap<std::string, int32_t>().swap(hash_table_);
+    hash_table_keys_ = RowEncoder();
+    hash_table_payloads_ = RowEncoder();
+    std::vector<uint8_t>().swap(has_match_);
+    swiss_table_.reset();
     finished_callback_(num_batches_produced_.load());
     return Status::OK();
   }
@@ -778,6 +902,16 @@ class HashJoinBasicImpl : public HashJoinImpl {
   std::vector<uint8_t> has_match_;
   bool hash_table_empty_;
 
+  // Swiss table replacing hash_table_ for key lookups, when enabled and supported by
+  // the key types.  Keys and payloads are still decoded from the row encoders above.
+  //
+  bool use_swiss_table_;
+  std::unique_ptr<SwissJoinHashTable> swiss_table_;
+  AccumulationQueue swiss_build_batches_;
+  std::vector<int32_t> swiss_first_row_ids_;
+  int task_group_partition_swiss_;
+  int task_group_build_swiss_;
+
   // Dictionary handling
   //
   HashJoinDictBuildMulti dict_build_;
@@ -792,7 +926,12 @@ class HashJoinBasicImpl : public HashJoinImpl {
 };
 
 Result<std::unique_ptr<HashJoinImpl>> HashJoinImpl::MakeBasic() {
-  std::unique_ptr<HashJoinImpl> impl{new HashJoinBasicImpl()};
+  std::unique_ptr<HashJoinImpl> impl{new HashJoinBasicImpl(/*use_swiss_table=*/false)};
+  return std::move(impl);
+}
+
+Result<std::unique_ptr<HashJoinImpl>> HashJoinImpl::MakeSwiss() {
+  std::unique_ptr<HashJoinImpl> impl{new HashJoinBasicImpl(/*use_swiss_table=*/true)};
   return std::move(impl);
 }
 
@@ -36,6 +36,9 @@ namespace compute {
 
 using arrow::util::AccumulationQueue;
 
+/// The join type which gives the same result with the inputs swapped
+ARROW_EXPORT JoinType MirrorJoinType(JoinType join_type);
+
 class ARROW_EXPORT HashJoinSchema {
  public:
   Status Init(JoinType join_type, const Schema& left_schema,
@@ -120,6 +123,12 @@ class HashJoinImpl {
   virtual void Abort(TaskScheduler::AbortContinuationImpl pos_abort_callback) = 0;
 
   static Result<std::unique_ptr<HashJoinImpl>> MakeBasic();
+  /// \brief Make a hash join that looks up keys in a partitioned SwissTable
+  ///
+  /// The table is built in parallel and probed one mini-batch at a time.  Joins on
+  /// keys the SwissTable does not support (dictionaries, large binary types) fall back
+  /// to the same processing as MakeBasic().
+  static Result<std::unique_ptr<HashJoinImpl>> MakeSwiss();
 
  protected:
   util::tracing::Span span_;
@@ -24,6 +24,7 @@
 #include "arrow/compute/exec/util.h"
 #include "arrow/compute/kernels/row_encoder.h"
 #include "arrow/testing/random.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/make_unique.h"
 #include "arrow/util/thread_pool.h"
 
@@ -48,6 +49,7 @@ struct BenchmarkSettings {
   double null_percentage = 0.0;
   double cardinality = 1.0;  // Proportion of distinct keys in build side
   double selectivity = 1.0;  // Probability of a match for a given row
+  bool use_swiss_table = false;
 };
 
 class JoinBenchmark {
@@ -132,7 +134,8 @@ class JoinBenchmark {
                                 left_keys, *r_batches_with_schema.schema, right_keys,
                                 filter, "l_", "r_"));
 
-    join_ = *HashJoinImpl::MakeBasic();
+    join_ = settings.use_swiss_table ? *HashJoinImpl::MakeSwiss()
+                                     : *HashJoinImpl::MakeBasic();
 
     omp_set_num_threads(settings.num_threads);
     auto schedule_callback = [](std::function<Status(size_t)> func) -> Status {
@@ -217,6 +220,50 @@ static void BM_HashJoinBasic_KeyTypes(benchmark::State& st,
   HashJoinBasicBenchmarkImpl(st, settings);
 }
 
+template <typename... Args>
+static void BM_HashJoinSwiss_KeyTypes(benchmark::State& st,
+                                      std::vector<std::shared_ptr<DataType>> key_types,
+                                      Args&&...) {
+  BenchmarkSettings settings;
+  settings.num_build_batches = static_cast<int>(st.range(0));
+  settings.num_probe_batches = settings.num_build_batches;
+  settings.key_types = std::move(key_types);
+  settings.use_swiss_table = true;
+
+  HashJoinBasicBenchmarkImpl(st, settings);
+}
+
+// Runs the Swiss join with the SIMD code paths above simd_level (0 for scalar) turned
+// off. The CpuInfo features are restored afterwards.
+template <typename... Args>
+static void BM_HashJoinSwiss_SimdLevel(benchmark::State& st, int64_t simd_level,
+                                       std::vector<std::shared_ptr<DataType>> key_types,
+                                       Args&&...) {
+  using arrow::internal::CpuInfo;
+  auto cpu_info = const_cast<CpuInfo*>(CpuInfo::GetInstance());
+  if (simd_level != 0 && !cpu_info->IsDetected(simd_level)) {
+    st.SkipWithError("SIMD level not supported by this CPU");
+    return;
+  }
+  const int64_t original_flags = cpu_info->hardware_flags();
+  if (simd_level != CpuInfo::AVX512) {
+    cpu_info->EnableFeature(CpuInfo::AVX512, false);
+  }
+  if (simd_level == 0) {
+    cpu_info->EnableFeature(CpuInfo::AVX2, false);
+  }
+
+  BenchmarkSettings settings;
+  settings.num_build_batches = static_cast<int>(st.range(0));
+  settings.num_probe_batches = settings.num_build_batches;
+  settings.key_types = std::move(key_types);
+  settings.use_swiss_table = true;
+
+  HashJoinBasicBenchmarkImpl(st, settings);
+
+  cpu_info->EnableFeature(original_flags, true);
+}
+
 static void BM_HashJoinBasic_ProbeParallelism(benchmark::State& st) {
   BenchmarkSettings settings;
   settings.num_threads = static_cast<int>(st.range(0));
@@ -415,6 +462,37 @@ BENCHMARK(BM_HashJoinBasic_BuildParallelism)
     ->ArgsProduct({benchmark::CreateDenseRange(1, 16, 1), hashtable_krows})
     ->MeasureProcessCPUTime();
 
+BENCHMARK_CAPTURE(BM_HashJoinSwiss_SimdLevel, "Scalar {int64}", 0, {int64()})
+    ->ArgNames(keytypes_argnames)
+    ->ArgsProduct({hashtable_krows});
+
+BENCHMARK_CAPTURE(BM_HashJoinSwiss_SimdLevel, "AVX2 {int64}",
+                  arrow::internal::CpuInfo::AVX2, {int64()})
+    ->ArgNames(keytypes_argnames)
+    ->ArgsProduct({hashtable_krows});
+
+BENCHMARK_CAPTURE(BM_HashJoinSwiss_SimdLevel, "AVX512 {int64}",
+                  arrow::internal::CpuInfo::AVX512, {int64()})
+    ->ArgNames(keytypes_argnames)
+    ->ArgsProduct({hashtable_krows});
+
+BENCHMARK_CAPTURE(BM_HashJoinSwiss_SimdLevel, "Scalar {utf8}", 0, {utf8()})
+    ->ArgNames(keytypes_argnames)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+
+BENCHMARK_CAPTURE(BM_HashJoinSwiss_SimdLevel, "AVX2 {utf8}",
+                  arrow::internal::CpuInfo::AVX2, {utf8()})
+    ->ArgNames(keytypes_argnames)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+
+BENCHMARK_CAPTURE(BM_HashJoinSwiss_SimdLevel, "AVX512 {utf8}",
+                  arrow::internal::CpuInfo::AVX512, {utf8()})
+    ->ArgNames(keytypes_argnames)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+
 BENCHMARK(BM_HashJoinBasic_NullPercentage)
     ->ArgNames({"Null Percentage"})
     ->DenseRange(0, 100, 10);
@@ -429,6 +507,46 @@ BENCHMARK_CAPTURE(BM_HashJoinBasic_KeyTypes, "{utf8}", {utf8()})
     ->RangeMultiplier(4)
     ->Range(1, 64);
 
+BENCHMARK_CAPTURE(BM_HashJoinSwiss_KeyTypes, "{int32}", {int32()})
+    ->ArgNames(keytypes_argnames)
+    ->ArgsProduct({hashtable_krows});
+
+BENCHMARK_CAPTURE(BM_HashJoinSwiss_KeyTypes, "{utf8}", {utf8()})
+    ->ArgNames(keytypes_argnames)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+
+BENCHMARK_CAPTURE(BM_HashJoinSwiss_SimdLevel, "Scalar {int64}", 0, {int64()})
+    ->ArgNames(keytypes_argnames)
+    ->ArgsProduct({hashtable_krows});
+
+BENCHMARK_CAPTURE(BM_HashJoinSwiss_SimdLevel, "AVX2 {int64}",
+                  arrow::internal::CpuInfo::AVX2, {int64()})
+    ->ArgNames(keytypes_argnames)
+    ->ArgsProduct({hashtable_krows});
+
+BENCHMARK_CAPTURE(BM_HashJoinSwiss_SimdLevel, "AVX512 {int64}",
+                  arrow::internal::CpuInfo::AVX512, {int64()})
+    ->ArgNames(keytypes_argnames)
+    ->ArgsProduct({hashtable_krows});
+
+BENCHMARK_CAPTURE(BM_HashJoinSwiss_SimdLevel, "Scalar {utf8}", 0, {utf8()})
+    ->ArgNames(keytypes_argnames)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+
+BENCHMARK_CAPTURE(BM_HashJoinSwiss_SimdLevel, "AVX2 {utf8}",
+                  arrow::internal::CpuInfo::AVX2, {utf8()})
+    ->ArgNames(keytypes_argnames)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+
+BENCHMARK_CAPTURE(BM_HashJoinSwiss_SimdLevel, "AVX512 {utf8}",
+                  arrow::internal::CpuInfo::AVX512, {utf8()})
+    ->ArgNames(keytypes_argnames)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+
 BENCHMARK(BM_HashJoinBasic_ProbeParallelism)
     ->ArgNames({"Threads", "HashTable krows"})
     ->ArgsProduct({benchmark::CreateDenseRange(1, 16, 1), hashtable_krows})
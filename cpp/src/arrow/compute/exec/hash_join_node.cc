@@ -19,15 +19,23 @@
 #include <unordered_set>
 #include <utility>
 
+#include "arrow/array/builder_base.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec/exec_plan.h"
 #include "arrow/compute/exec/hash_join.h"
 #include "arrow/compute/exec/hash_join_dict.h"
 #include "arrow/compute/exec/key_hash.h"
 #include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/runtime_filter.h"
 #include "arrow/compute/exec/schema_util.h"
+#include "arrow/compute/exec/spilling_util.h"
 #include "arrow/compute/exec/util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/make_unique.h"
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/tracing_internal.h"
@@ -469,6 +477,59 @@ Status ValidateHashJoinNodeOptions(const HashJoinNodeOptions& join_options) {
     return Status::Invalid("key_cmp and keys must have the same size");
   }
 
+  if (join_options.spill_memory_limit < 0) {
+    return Status::Invalid("spill_memory_limit cannot be negative");
+  }
+
+  if (join_options.adaptive_build_side) {
+    if (join_options.adaptive_build_side_max_batches <= 0) {
+      return Status::Invalid("adaptive_build_side_max_batches must be positive");
+    }
+    if (join_options.spill_memory_limit > 0) {
+      return Status::NotImplemented(
+          "Adaptive build side selection is not supported together with spilling");
+    }
+  }
+
+  return Status::OK();
+}
+
+JoinType MirrorJoinType(JoinType join_type) {
+  switch (join_type) {
+    case JoinType::LEFT_SEMI:
+      return JoinType::RIGHT_SEMI;
+    case JoinType::RIGHT_SEMI:
+      return JoinType::LEFT_SEMI;
+    case JoinType::LEFT_ANTI:
+      return JoinType::RIGHT_ANTI;
+    case JoinType::RIGHT_ANTI:
+      return JoinType::LEFT_ANTI;
+    case JoinType::LEFT_OUTER:
+      return JoinType::RIGHT_OUTER;
+    case JoinType::RIGHT_OUTER:
+      return JoinType::LEFT_OUTER;
+    default:
+      return join_type;
+  }
+}
+
+// Spilling partitions rows by key hash, which requires keys to hash identically on both
+// sides of the join.  Dictionary keys are remapped by the join implementation and would
+// not, so they are rejected up front.
+Status ValidateSpillingKeys(const HashJoinSchema& schema_mgr,
+                            const std::vector<ExecNode*>& inputs) {
+  for (int side = 0; side < 2; ++side) {
+    SchemaProjectionMap keys_to_input = schema_mgr.proj_maps[side].map(
+        HashJoinProjection::KEY, HashJoinProjection::INPUT);
+    for (int i = 0; i < keys_to_input.num_cols; ++i) {
+      const auto& type =
+          inputs[side]->output_schema()->field(keys_to_input.get(i))->type();
+      if (type->id() == Type::DICTIONARY) {
+        return Status::NotImplemented(
+            "Hash join spilling is not supported for dictionary keys");
+      }
+    }
+  }
   return Status::OK();
 }
 
@@ -502,7 +563,7 @@ struct BloomFilterPushdownContext {
   Status PushBloomFilter();
 
   // Receives a Bloom filter and its associated column map.
-  Status ReceiveBloomFilter(std::unique_ptr<BlockedBloomFilter> filter,
+  Status ReceiveBloomFilter(std::shared_ptr<BlockedBloomFilter> filter,
                             std::vector<int> column_map) {
     bool proceed;
     {
@@ -610,6 +671,13 @@ struct BloomFilterPushdownContext {
   // the disable_bloom_filter_ flag.
   std::pair<HashJoinNode*, std::vector<int>> GetPushdownTarget(HashJoinNode* start);
 
+  // Looks through the filter nodes below the pushdown target for a source which accepts
+  // runtime filters.  The Bloom filter is shared with such a source, along with the
+  // range of those build side keys for which a range may be used to skip data.
+  void InitSourcePushdown(HashJoinNode* owner);
+  Status UpdateKeyRanges(const ExecBatch& key_batch);
+  Result<Expression> MakeKeyRange();
+
   Result<util::TempVectorStack*> GetStack(size_t thread_index) {
     if (!tld_[thread_index].is_init) {
       RETURN_NOT_OK(tld_[thread_index].stack.Init(
@@ -638,16 +706,30 @@ struct BloomFilterPushdownContext {
   } build_;
 
   struct {
-    std::unique_ptr<BlockedBloomFilter> bloom_filter_;
+    std::shared_ptr<BlockedBloomFilter> bloom_filter_;
     HashJoinNode* pushdown_target_;
     std::vector<int> column_map_;
   } push_;
 
+  struct {
+    RuntimeFilterTarget* target_ = NULLPTR;
+    // For the keys with a range: their index among the keys, their name in the output
+    // of the source, and the minima and maxima of the build side batches
+    std::vector<int> range_keys_;
+    std::vector<std::shared_ptr<Field>> range_fields_;
+    std::mutex mutex_;
+    std::vector<ScalarVector> mins_, maxs_;
+    // The distinct values of each key with a range, until there are too many of them to
+    // be pushed down as a set
+    std::vector<ArrayVector> distinct_;
+    std::vector<bool> too_many_distinct_;
+  } source_;
+
   struct {
     int task_id_;
     size_t num_expected_bloom_filters_ = 0;
     std::mutex receive_mutex_;
-    std::vector<std::unique_ptr<BlockedBloomFilter>> received_filters_;
+    std::vector<std::shared_ptr<BlockedBloomFilter>> received_filters_;
     std::vector<std::vector<int>> received_maps_;
     AccumulationQueue batches_;
     FiltersReceivedCallback all_received_callback_;
@@ -657,10 +739,22 @@ struct BloomFilterPushdownContext {
 
 class HashJoinNode : public ExecNode {
  public:
+  // The join with the left input as build side, used by an adaptive join which chooses
+  // to build on the left input
+  struct SwappedJoin {
+    JoinType join_type;
+    std::unique_ptr<HashJoinSchema> schema_mgr;
+    Expression filter;
+    std::unique_ptr<HashJoinImpl> impl;
+    // For each output column, its index in the output of the swapped join
+    std::vector<int> output_order;
+  };
+
   HashJoinNode(ExecPlan* plan, NodeVector inputs, const HashJoinNodeOptions& join_options,
                std::shared_ptr<Schema> output_schema,
                std::unique_ptr<HashJoinSchema> schema_mgr, Expression filter,
-               std::unique_ptr<HashJoinImpl> impl)
+               std::unique_ptr<HashJoinImpl> impl,
+               std::unique_ptr<SwappedJoin> swapped_join)
       : ExecNode(plan, inputs, {"left", "right"},
                  /*output_schema=*/std::move(output_schema),
                  /*num_outputs=*/1),
@@ -669,8 +763,67 @@ class HashJoinNode : public ExecNode {
         filter_(std::move(filter)),
         schema_mgr_(std::move(schema_mgr)),
         impl_(std::move(impl)),
-        disable_bloom_filter_(join_options.disable_bloom_filter) {
+        spill_memory_limit_(join_options.spill_memory_limit),
+        swapped_join_(std::move(swapped_join)),
+        adaptive_max_batches_(join_options.adaptive_build_side_max_batches),
+        // A join that may spill cannot promise a Bloom filter to its pushdown target, nor
+        // can a join which does not know its build side yet
+        disable_bloom_filter_(join_options.disable_bloom_filter ||
+                              join_options.spill_memory_limit > 0 ||
+                              swapped_join_ != nullptr) {
     complete_.store(false);
+    // Both the build and the probe side only read their keys, payload and filter
+    // columns.  The swapped join projects the same columns of each input.
+    for (int side = 0; side < 2; ++side) {
+      read_columns_[side].resize(inputs_[side]->output_schema()->num_fields(), false);
+      for (auto handle : {HashJoinProjection::KEY, HashJoinProjection::PAYLOAD,
+                          HashJoinProjection::FILTER}) {
+        SchemaProjectionMap to_input =
+            schema_mgr_->proj_maps[side].map(handle, HashJoinProjection::INPUT);
+        for (int i = 0; i < to_input.num_cols; ++i) {
+          read_columns_[side][to_input.get(i)] = true;
+        }
+      }
+    }
+  }
+
+  // The same join with the right input as probe side and the left input as build side
+  static Result<std::unique_ptr<SwappedJoin>> MakeSwappedJoin(
+      ExecPlan* plan, const HashJoinNodeOptions& join_options, const Schema& left_schema,
+      const Schema& right_schema) {
+    for (const FieldRef& ref : FieldsInExpression(join_options.filter)) {
+      if (!ref.IsName()) {
+        return Status::NotImplemented(
+            "Swapping the inputs of a join whose filter refers to fields by position");
+      }
+    }
+    auto swapped = ::arrow::internal::make_unique<SwappedJoin>();
+    swapped->join_type = MirrorJoinType(join_options.join_type);
+    swapped->schema_mgr = ::arrow::internal::make_unique<HashJoinSchema>();
+    if (join_options.output_all) {
+      RETURN_NOT_OK(swapped->schema_mgr->Init(
+          swapped->join_type, right_schema, join_options.right_keys, left_schema,
+          join_options.left_keys, join_options.filter,
+          join_options.output_suffix_for_right, join_options.output_suffix_for_left));
+    } else {
+      RETURN_NOT_OK(swapped->schema_mgr->Init(
+          swapped->join_type, right_schema, join_options.right_keys,
+          join_options.right_output, left_schema, join_options.left_keys,
+          join_options.left_output, join_options.filter,
+          join_options.output_suffix_for_right, join_options.output_suffix_for_left));
+    }
+    ARROW_ASSIGN_OR_RAISE(swapped->filter, swapped->schema_mgr->BindFilter(
+                                               join_options.filter, right_schema,
+                                               left_schema, plan->exec_context()));
+    ARROW_ASSIGN_OR_RAISE(swapped->impl, HashJoinImpl::MakeSwiss());
+
+    // The swapped join outputs the columns of the right input first
+    const auto& proj_maps = swapped->schema_mgr->proj_maps;
+    int num_right = proj_maps[0].num_cols(HashJoinProjection::OUTPUT);
+    int num_left = proj_maps[1].num_cols(HashJoinProjection::OUTPUT);
+    for (int i = 0; i < num_left; ++i) swapped->output_order.push_back(num_right + i);
+    for (int i = 0; i < num_right; ++i) swapped->output_order.push_back(i);
+    return std::move(swapped);
   }
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
@@ -701,6 +854,10 @@ class HashJoinNode : public ExecNode {
           join_options.output_suffix_for_left, join_options.output_suffix_for_right));
     }
 
+    if (join_options.spill_memory_limit > 0) {
+      RETURN_NOT_OK(ValidateSpillingKeys(*schema_mgr, inputs));
+    }
+
     ARROW_ASSIGN_OR_RAISE(Expression filter,
                           schema_mgr->BindFilter(join_options.filter, left_schema,
                                                  right_schema, plan->exec_context()));
@@ -709,22 +866,187 @@ class HashJoinNode : public ExecNode {
     std::shared_ptr<Schema> output_schema = schema_mgr->MakeOutputSchema(
         join_options.output_suffix_for_left, join_options.output_suffix_for_right);
     // Create hash join implementation object
-    ARROW_ASSIGN_OR_RAISE(std::unique_ptr<HashJoinImpl> impl, HashJoinImpl::MakeBasic());
+    ARROW_ASSIGN_OR_RAISE(std::unique_ptr<HashJoinImpl> impl, HashJoinImpl::MakeSwiss());
+
+    std::unique_ptr<SwappedJoin> swapped_join;
+    if (join_options.adaptive_build_side) {
+      // If the inputs cannot be swapped the join always builds on the right input
+      auto maybe_swapped_join =
+          MakeSwappedJoin(plan, join_options, left_schema, right_schema);
+      if (maybe_swapped_join.ok()) {
+        swapped_join = maybe_swapped_join.MoveValueUnsafe();
+      }
+    }
 
     return plan->EmplaceNode<HashJoinNode>(
         plan, inputs, join_options, std::move(output_schema), std::move(schema_mgr),
-        std::move(filter), std::move(impl));
+        std::move(filter), std::move(impl), std::move(swapped_join));
   }
 
   const char* kind_name() const override { return "HashJoinNode"; }
 
+  bool accepts_selection_vector() const override { return true; }
+
   Status OnBuildSideBatch(size_t thread_index, ExecBatch batch) {
-    std::lock_guard<std::mutex> guard(build_side_mutex_);
-    build_accumulator_.InsertBatch(std::move(batch));
+    if (spill_memory_limit_ == 0) {
+      std::lock_guard<std::mutex> guard(build_side_mutex_);
+      build_bytes_accumulated_ += batch.TotalBufferSize();
+      RecordMemoryUsage(build_bytes_accumulated_);
+      build_accumulator_.InsertBatch(std::move(batch));
+      return Status::OK();
+    }
+
+    bool start_spilling;
+    {
+      std::lock_guard<std::mutex> guard(build_side_mutex_);
+      if (!spilling_) {
+        build_bytes_accumulated_ += batch.TotalBufferSize();
+        RecordMemoryUsage(build_bytes_accumulated_);
+        build_accumulator_.InsertBatch(std::move(batch));
+        MemoryGovernor* governor = plan_->memory_governor();
+        start_spilling = build_bytes_accumulated_ > spill_memory_limit_ ||
+                         (governor != nullptr && governor->exceeded());
+        if (!start_spilling) {
+          return Status::OK();
+        }
+      } else {
+        start_spilling = false;
+      }
+    }
+    if (start_spilling) {
+      return StartSpilling();
+    }
+    return spill_partitioners_[1]->Push(batch);
+  }
+
+  // Switch to a grace hash join.  Everything accumulated so far on either side is moved
+  // into hash partitioners which will also receive all further input.
+  Status StartSpilling() {
+    std::lock_guard<std::mutex> build_guard(build_side_mutex_);
+    std::lock_guard<std::mutex> probe_guard(probe_side_mutex_);
+    if (spilling_) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(spill_dir_,
+                          arrow::internal::TemporaryDir::Make("arrow-hashjoin-spill-"));
+    static const char* kSideNames[] = {"probe", "build"};
+    for (int side = 0; side < 2; ++side) {
+      SchemaProjectionMap keys_to_input = schema_mgr_->proj_maps[side].map(
+          HashJoinProjection::KEY, HashJoinProjection::INPUT);
+      std::vector<int> key_ids(keys_to_input.num_cols);
+      for (int i = 0; i < keys_to_input.num_cols; ++i) {
+        key_ids[i] = keys_to_input.get(i);
+      }
+      spill_partitioners_[side] = ::arrow::internal::make_unique<SpillingPartitioner>();
+      // Each side gets half of the memory budget for its partition buffers
+      RETURN_NOT_OK(spill_partitioners_[side]->Init(
+          plan_->exec_context(), inputs_[side]->output_schema(), std::move(key_ids),
+          kLogSpillPartitions, spill_memory_limit_ / 2, spill_dir_->path(),
+          kSideNames[side]));
+    }
+    spilling_ = true;
+    if (probe_side_finished_) {
+      ++num_spilled_sides_finished_;
+    }
+
+    AccumulationQueue build_batches = std::move(build_accumulator_);
+    for (size_t i = 0; i < build_batches.batch_count(); ++i) {
+      RETURN_NOT_OK(spill_partitioners_[1]->Push(build_batches[i]));
+    }
+    build_batches.Clear();
+    AccumulationQueue probe_batches = std::move(probe_accumulator_);
+    for (size_t i = 0; i < probe_batches.batch_count(); ++i) {
+      RETURN_NOT_OK(spill_partitioners_[0]->Push(probe_batches[i]));
+    }
     return Status::OK();
   }
 
+  Status OnSpilledSideFinished(size_t thread_index) {
+    bool both_sides_finished;
+    {
+      std::lock_guard<std::mutex> guard(probe_side_mutex_);
+      both_sides_finished = ++num_spilled_sides_finished_ == 2;
+    }
+    if (!both_sides_finished) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(spill_partitioners_[0]->Finish());
+    RETURN_NOT_OK(spill_partitioners_[1]->Finish());
+    RecordSpilledBytes(spill_partitioners_[0]->bytes_spilled() +
+                       spill_partitioners_[1]->bytes_spilled());
+    spilled_joins_.resize(spill_partitioners_[1]->num_partitions());
+    return JoinNextSpilledPartition(thread_index);
+  }
+
+  // Run an in-memory hash join over the next pair of partitions, each partition gets its
+  // own join implementation and task scheduler.
+  Status JoinNextSpilledPartition(size_t thread_index) {
+    SpilledPartitionJoin* join;
+    int partition;
+    {
+      // Empty partitions may finish synchronously and recurse, so the lock is only held
+      // while the next join is being set up
+      std::lock_guard<std::mutex> guard(spill_mutex_);
+      if (complete_.load()) {
+        return Status::OK();
+      }
+      if (next_spilled_partition_ == static_cast<int>(spilled_joins_.size())) {
+        FinishedCallback(num_spilled_batches_produced_.load());
+        return Status::OK();
+      }
+      partition = next_spilled_partition_++;
+      join = &spilled_joins_[partition];
+
+      ARROW_ASSIGN_OR_RAISE(join->impl, HashJoinImpl::MakeSwiss());
+      join->scheduler = TaskScheduler::Make();
+      RETURN_NOT_OK(join->impl->Init(
+          plan_->exec_context(), join_type_, num_threads_, schema_mgr_.get(), key_cmp_,
+          filter_, [this](ExecBatch batch) { this->OutputBatchCallback(batch); },
+          [this](int64_t num_batches) { this->OnSpilledPartitionFinished(num_batches); },
+          join->scheduler.get()));
+      join->task_group_probe = join->scheduler->RegisterTaskGroup(
+          [join](size_t thread_index, int64_t task_id) -> Status {
+            return join->impl->ProbeSingleBatch(thread_index,
+                                                std::move(join->probe_batches[task_id]));
+          },
+          [join](size_t thread_index) -> Status {
+            join->probe_batches.Clear();
+            return join->impl->ProbingFinished(thread_index);
+          });
+      join->scheduler->RegisterEnd();
+    }
+
+    RETURN_NOT_OK(join->scheduler->StartScheduling(
+        thread_index,
+        [this](std::function<Status(size_t)> func) -> Status {
+          return this->ScheduleTaskCallback(std::move(func));
+        },
+        static_cast<int>(2 * num_threads_), use_sync_execution_));
+
+    ARROW_ASSIGN_OR_RAISE(AccumulationQueue build_batches,
+                          spill_partitioners_[1]->TakePartition(partition));
+    ARROW_ASSIGN_OR_RAISE(join->probe_batches,
+                          spill_partitioners_[0]->TakePartition(partition));
+    return join->impl->BuildHashTable(
+        thread_index, std::move(build_batches), [join](size_t thread_index) {
+          return join->scheduler->StartTaskGroup(thread_index, join->task_group_probe,
+                                                 join->probe_batches.batch_count());
+        });
+  }
+
+  void OnSpilledPartitionFinished(int64_t num_batches) {
+    num_spilled_batches_produced_ += num_batches;
+    Status status = JoinNextSpilledPartition(thread_indexer_());
+    if (!status.ok()) {
+      StopProducing();
+      ErrorIfNotOk(status);
+    }
+  }
+
   Status OnBuildSideFinished(size_t thread_index) {
+    if (spilling_) {
+      return OnSpilledSideFinished(thread_index);
+    }
     return pushdown_context_.BuildBloomFilter(
         thread_index, std::move(build_accumulator_),
         [this](size_t thread_index, AccumulationQueue batches) {
@@ -755,6 +1077,10 @@ class HashJoinNode : public ExecNode {
   Status OnProbeSideBatch(size_t thread_index, ExecBatch batch) {
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
+      if (spilling_) {
+        // Partitions are joined without Bloom filters
+        return spill_partitioners_[0]->Push(batch);
+      }
       if (!bloom_filters_ready_) {
         probe_accumulator_.InsertBatch(std::move(batch));
         return Status::OK();
@@ -764,6 +1090,9 @@ class HashJoinNode : public ExecNode {
 
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
+      if (spilling_) {
+        return spill_partitioners_[0]->Push(batch);
+      }
       if (!hash_table_ready_) {
         probe_accumulator_.InsertBatch(std::move(batch));
         return Status::OK();
@@ -776,7 +1105,12 @@ class HashJoinNode : public ExecNode {
   Status OnProbeSideFinished(size_t thread_index) {
     bool probing_finished;
     {
-      std::lock_guard<std::mutex> guard(probe_side_mutex_);
+      std::unique_lock<std::mutex> guard(probe_side_mutex_);
+      if (spilling_) {
+        probe_side_finished_ = true;
+        guard.unlock();
+        return OnSpilledSideFinished(thread_index);
+      }
       probing_finished = queued_batches_probed_ && !probe_side_finished_;
       probe_side_finished_ = true;
     }
@@ -801,6 +1135,12 @@ class HashJoinNode : public ExecNode {
     bool should_probe;
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
+      if (spilling_) {
+        for (size_t i = 0; i < batches.batch_count(); ++i) {
+          RETURN_NOT_OK(spill_partitioners_[0]->Push(batches[i]));
+        }
+        return Status::OK();
+      }
       probe_accumulator_.Concatenate(std::move(batches));
       should_probe = !queued_batches_filtered_ && hash_table_ready_;
       queued_batches_filtered_ = true;
@@ -832,6 +1172,93 @@ class HashJoinNode : public ExecNode {
     return Status::OK();
   }
 
+  // The side of the join (0 for probe, 1 for build) an input is on
+  int SideOfInput(int input_index) const {
+    return swapped_ ? 1 - input_index : input_index;
+  }
+
+  void OnInputBatch(size_t thread_index, int input_index, ExecBatch batch) {
+    int side = SideOfInput(input_index);
+    Status status = side == 0 ? OnProbeSideBatch(thread_index, std::move(batch))
+                              : OnBuildSideBatch(thread_index, std::move(batch));
+
+    if (!status.ok()) {
+      StopProducing();
+      ErrorIfNotOk(status);
+      return;
+    }
+
+    if (batch_count_[input_index].Increment()) {
+      OnInputFinished(thread_index, input_index);
+    }
+  }
+
+  void OnInputFinished(size_t thread_index, int input_index) {
+    Status status = SideOfInput(input_index) == 0 ? OnProbeSideFinished(thread_index)
+                                                  : OnBuildSideFinished(thread_index);
+    if (!status.ok()) {
+      StopProducing();
+      ErrorIfNotOk(status);
+    }
+  }
+
+  // Whether the build side can be chosen given what has been buffered so far
+  bool ChooseBuildSide(bool* build_on_left) {
+    bool input_finished[2];
+    for (int i = 0; i < 2; ++i) {
+      input_finished[i] = adaptive_total_batches_[i] >= 0 &&
+                          static_cast<int>(adaptive_batches_[i].batch_count()) ==
+                              adaptive_total_batches_[i];
+    }
+    if (input_finished[1] && adaptive_rows_[1] <= adaptive_rows_[0]) {
+      *build_on_left = false;
+      return true;
+    }
+    if (input_finished[0] && adaptive_rows_[0] < adaptive_rows_[1]) {
+      *build_on_left = true;
+      return true;
+    }
+    if (static_cast<int>(adaptive_batches_[0].batch_count()) >= adaptive_max_batches_ &&
+        static_cast<int>(adaptive_batches_[1].batch_count()) >= adaptive_max_batches_) {
+      *build_on_left = adaptive_rows_[0] < adaptive_rows_[1];
+      return true;
+    }
+    return false;
+  }
+
+  // Called with adaptive_mutex_ held while the build side has not been chosen.  Once it
+  // can be chosen the buffered batches are passed on, build side first.
+  void MaybeChooseBuildSide(size_t thread_index, std::unique_lock<std::mutex>* guard) {
+    bool build_on_left;
+    if (!ChooseBuildSide(&build_on_left)) {
+      return;
+    }
+    if (build_on_left) {
+      std::swap(impl_, swapped_join_->impl);
+      swapped_ = true;
+    }
+    build_side_chosen_.store(true);
+    AccumulationQueue batches[2] = {std::move(adaptive_batches_[0]),
+                                    std::move(adaptive_batches_[1])};
+    int total_batches[2] = {adaptive_total_batches_[0], adaptive_total_batches_[1]};
+    guard->unlock();
+
+    EVENT(span_, "BuildSideChosen", {{"build_side", build_on_left ? "left" : "right"}});
+    int build_input = build_on_left ? 0 : 1;
+    for (int input_index : {build_input, 1 - build_input}) {
+      for (size_t i = 0; i < batches[input_index].batch_count(); ++i) {
+        if (complete_.load()) {
+          return;
+        }
+        OnInputBatch(thread_index, input_index, std::move(batches[input_index][i]));
+      }
+      if (total_batches[input_index] >= 0 &&
+          batch_count_[input_index].SetTotal(total_batches[input_index])) {
+        OnInputFinished(thread_index, input_index);
+      }
+    }
+  }
+
   void InputReceived(ExecNode* input, ExecBatch batch) override {
     ARROW_DCHECK(std::find(inputs_.begin(), inputs_.end(), input) != inputs_.end());
     if (complete_.load()) {
@@ -839,32 +1266,36 @@ class HashJoinNode : public ExecNode {
     }
 
     size_t thread_index = thread_indexer_();
-    int side = (input == inputs_[0]) ? 0 : 1;
+    int input_index = (input == inputs_[0]) ? 0 : 1;
 
-    EVENT(span_, "InputReceived", {{"batch.length", batch.length}, {"side", side}});
+    EVENT(span_, "InputReceived",
+          {{"batch.length", batch.length}, {"side", input_index}});
     util::tracing::Span span;
     START_COMPUTE_SPAN_WITH_PARENT(span, span_, "InputReceived",
                                    {{"batch.length", batch.length}});
 
-    Status status = side == 0 ? OnProbeSideBatch(thread_index, std::move(batch))
-                              : OnBuildSideBatch(thread_index, std::move(batch));
-
-    if (!status.ok()) {
-      StopProducing();
-      ErrorIfNotOk(status);
-      return;
+    if (batch.selection_vector) {
+      // Of a filtered input, only the rows of the columns read by the join are copied
+      auto selected =
+          batch.ApplySelection(read_columns_[input_index], plan_->exec_context());
+      if (!selected.ok()) {
+        StopProducing();
+        ErrorIfNotOk(selected.status());
+        return;
+      }
+      batch = selected.MoveValueUnsafe();
     }
 
-    if (batch_count_[side].Increment()) {
-      status = side == 0 ? OnProbeSideFinished(thread_index)
-                         : OnBuildSideFinished(thread_index);
-
-      if (!status.ok()) {
-        StopProducing();
-        ErrorIfNotOk(status);
+    if (swapped_join_ && !build_side_chosen_.load()) {
+      std::unique_lock<std::mutex> guard(adaptive_mutex_);
+      if (!build_side_chosen_.load()) {
+        adaptive_rows_[input_index] += batch.length;
+        adaptive_batches_[input_index].InsertBatch(std::move(batch));
+        MaybeChooseBuildSide(thread_index, &guard);
         return;
       }
     }
+    OnInputBatch(thread_index, input_index, std::move(batch));
   }
 
   void ErrorReceived(ExecNode* input, Status error) override {
@@ -878,20 +1309,22 @@ class HashJoinNode : public ExecNode {
     ARROW_DCHECK(std::find(inputs_.begin(), inputs_.end(), input) != inputs_.end());
 
     size_t thread_index = thread_indexer_();
-    int side = (input == inputs_[0]) ? 0 : 1;
-
-    EVENT(span_, "InputFinished", {{"side", side}, {"batches.length", total_batches}});
+    int input_index = (input == inputs_[0]) ? 0 : 1;
 
-    if (batch_count_[side].SetTotal(total_batches)) {
-      Status status = side == 0 ? OnProbeSideFinished(thread_index)
-                                : OnBuildSideFinished(thread_index);
+    EVENT(span_, "InputFinished",
+          {{"side", input_index}, {"batches.length", total_batches}});
 
-      if (!status.ok()) {
-        StopProducing();
-        ErrorIfNotOk(status);
+    if (swapped_join_ && !build_side_chosen_.load()) {
+      std::unique_lock<std::mutex> guard(adaptive_mutex_);
+      if (!build_side_chosen_.load()) {
+        adaptive_total_batches_[input_index] = total_batches;
+        MaybeChooseBuildSide(thread_index, &guard);
         return;
       }
     }
+    if (batch_count_[input_index].SetTotal(total_batches)) {
+      OnInputFinished(thread_index, input_index);
+    }
   }
 
   Status PrepareToProduce() override {
@@ -900,6 +1333,8 @@ class HashJoinNode : public ExecNode {
     // Each side of join might have an IO thread being called from. Once this is fixed
     // we will change it back to just the CPU's thread pool capacity.
     size_t num_threads = (GetCpuThreadPoolCapacity() + io::GetIOThreadPoolCapacity() + 1);
+    num_threads_ = num_threads;
+    use_sync_execution_ = use_sync_execution;
 
     scheduler_ = TaskScheduler::Make();
     pushdown_context_.Init(
@@ -911,6 +1346,16 @@ class HashJoinNode : public ExecNode {
         filter_, [this](ExecBatch batch) { this->OutputBatchCallback(batch); },
         [this](int64_t total_num_batches) { this->FinishedCallback(total_num_batches); },
         scheduler_.get()));
+    if (swapped_join_) {
+      RETURN_NOT_OK(swapped_join_->impl->Init(
+          plan_->exec_context(), swapped_join_->join_type, num_threads,
+          swapped_join_->schema_mgr.get(), key_cmp_, swapped_join_->filter,
+          [this](ExecBatch batch) { this->OutputBatchCallback(batch); },
+          [this](int64_t total_num_batches) {
+            this->FinishedCallback(total_num_batches);
+          },
+          scheduler_.get()));
+    }
 
     task_group_probe_ = scheduler_->RegisterTaskGroup(
         [this](size_t thread_index, int64_t task_id) -> Status {
@@ -939,6 +1384,11 @@ class HashJoinNode : public ExecNode {
                         {"node.kind", kind_name()}});
     END_SPAN_ON_FUTURE_COMPLETION(span_, finished(), this);
     RETURN_NOT_OK(pushdown_context_.StartProducing());
+    if (spill_memory_limit_ > 0 && plan_->memory_governor()) {
+      // Share the plan's memory limit with the other nodes that spill
+      spill_reservation_ = plan_->memory_governor()->Reserve(spill_memory_limit_);
+      spill_memory_limit_ = spill_reservation_.bytes();
+    }
     return Status::OK();
   }
 
@@ -962,7 +1412,23 @@ class HashJoinNode : public ExecNode {
       for (auto&& input : inputs_) {
         input->StopProducing(this);
       }
-      impl_->Abort([this]() { ARROW_UNUSED(task_group_.End()); });
+      {
+        // Tasks of partition joins are part of task_group_, which will not finish
+        // before they do
+        std::lock_guard<std::mutex> guard(spill_mutex_);
+        for (auto& join : spilled_joins_) {
+          if (join.impl) {
+            join.impl->Abort([]() {});
+          }
+        }
+      }
+      HashJoinImpl* impl;
+      {
+        // An adaptive join swaps its implementation when choosing the build side
+        std::lock_guard<std::mutex> guard(adaptive_mutex_);
+        impl = impl_.get();
+      }
+      impl->Abort([this]() { ARROW_UNUSED(task_group_.End()); });
     }
   }
 
@@ -970,7 +1436,14 @@ class HashJoinNode : public ExecNode {
 
  private:
   void OutputBatchCallback(ExecBatch batch) {
-    outputs_[0]->InputReceived(this, std::move(batch));
+    if (swapped_) {
+      std::vector<Datum> values(swapped_join_->output_order.size());
+      for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = std::move(batch.values[swapped_join_->output_order[i]]);
+      }
+      batch.values = std::move(values);
+    }
+    EmitBatch(std::move(batch));
   }
 
   void FinishedCallback(int64_t total_num_batches) {
@@ -984,8 +1457,11 @@ class HashJoinNode : public ExecNode {
   Status ScheduleTaskCallback(std::function<Status(size_t)> func) {
     auto executor = plan_->exec_context()->executor();
     if (executor) {
-      return task_group_.AddTask([this, executor, func] {
-        return DeferNotOk(executor->Submit([this, func] {
+      // Hash table build and probing of accumulated batches hold back the rest of the
+      // plan, ask the executor to run them before new input batches.
+      auto hints = plan_->MakeTaskHints(/*urgency=*/1);
+      return task_group_.AddTask([this, executor, hints, func] {
+        return DeferNotOk(executor->Submit(hints, [this, func] {
           size_t thread_index = thread_indexer_();
           Status status = func(thread_index);
           if (!status.ok()) {
@@ -1010,6 +1486,8 @@ class HashJoinNode : public ExecNode {
   Expression filter_;
   ThreadIndexer thread_indexer_;
   std::unique_ptr<HashJoinSchema> schema_mgr_;
+  // For each input, which of its columns the join reads
+  std::vector<bool> read_columns_[2];
   std::unique_ptr<HashJoinImpl> impl_;
   util::AsyncTaskGroup task_group_;
   std::unique_ptr<TaskScheduler> scheduler_;
@@ -1027,6 +1505,50 @@ class HashJoinNode : public ExecNode {
   bool queued_batches_probed_ = false;
   bool probe_side_finished_ = false;
 
+  size_t num_threads_ = 0;
+  bool use_sync_execution_ = false;
+
+  // Spilling (grace hash join) state
+  //
+  // Both inputs are split into 2^kLogSpillPartitions partitions
+  static constexpr int kLogSpillPartitions = 5;
+  struct SpilledPartitionJoin {
+    std::unique_ptr<HashJoinImpl> impl;
+    std::unique_ptr<TaskScheduler> scheduler;
+    AccumulationQueue probe_batches;
+    int task_group_probe;
+  };
+  int64_t spill_memory_limit_;
+  // Held while running if the plan has a memory limit
+  MemoryReservation spill_reservation_;
+  // Bytes accumulated on the build side, guarded by build_side_mutex_
+  int64_t build_bytes_accumulated_ = 0;
+  // Written while holding both the build side and the probe side mutex
+  bool spilling_ = false;
+  // Guarded by probe_side_mutex_
+  int num_spilled_sides_finished_ = 0;
+  std::unique_ptr<arrow::internal::TemporaryDir> spill_dir_;
+  std::unique_ptr<SpillingPartitioner> spill_partitioners_[2];
+  std::mutex spill_mutex_;
+  std::vector<SpilledPartitionJoin> spilled_joins_;
+  int next_spilled_partition_ = 0;
+  std::atomic<int64_t> num_spilled_batches_produced_{0};
+
+  // Adaptive build side selection state.  Until the build side is chosen the batches of
+  // both inputs are buffered, the state below is guarded by adaptive_mutex_.
+  //
+  // Null unless the join is adaptive
+  std::unique_ptr<SwappedJoin> swapped_join_;
+  int adaptive_max_batches_;
+  std::mutex adaptive_mutex_;
+  std::atomic<bool> build_side_chosen_{false};
+  // Whether the left input is the build side, written before build_side_chosen_ is set
+  bool swapped_ = false;
+  AccumulationQueue adaptive_batches_[2];
+  int64_t adaptive_rows_[2] = {0, 0};
+  // -1 while the total is not known
+  int adaptive_total_batches_[2] = {-1, -1};
+
   friend struct BloomFilterPushdownContext;
   bool disable_bloom_filter_;
   BloomFilterPushdownContext pushdown_context_;
@@ -1046,8 +1568,9 @@ void BloomFilterPushdownContext::Init(HashJoinNode* owner, size_t num_threads,
   eval_.all_received_callback_ = std::move(on_bloom_filters_received);
   if (!disable_bloom_filter_) {
     ARROW_CHECK(push_.pushdown_target_);
-    push_.bloom_filter_ = arrow::internal::make_unique<BlockedBloomFilter>();
+    push_.bloom_filter_ = std::make_shared<BlockedBloomFilter>();
     push_.pushdown_target_->pushdown_context_.ExpectBloomFilter();
+    InitSourcePushdown(owner);
 
     build_.builder_ = BloomFilterBuilder::Make(
         use_sync_execution ? BloomFilterBuildStrategy::SINGLE_THREADED
@@ -1095,12 +1618,146 @@ Status BloomFilterPushdownContext::BuildBloomFilter(size_t thread_index,
 }
 
 Status BloomFilterPushdownContext::PushBloomFilter() {
-  if (!disable_bloom_filter_)
-    return push_.pushdown_target_->pushdown_context_.ReceiveBloomFilter(
-        std::move(push_.bloom_filter_), std::move(push_.column_map_));
+  if (disable_bloom_filter_) return Status::OK();
+  if (source_.target_) {
+    // The source's output has the same columns as the pushdown target's probe input
+    ARROW_ASSIGN_OR_RAISE(Expression key_range, MakeKeyRange());
+    source_.target_->runtime_filters()->Add(std::make_shared<RuntimeFilter>(
+        push_.bloom_filter_, push_.column_map_, std::move(key_range)));
+  }
+  return push_.pushdown_target_->pushdown_context_.ReceiveBloomFilter(
+      std::move(push_.bloom_filter_), std::move(push_.column_map_));
+}
+
+namespace {
+
+// Whether a range of keys of this type can be used to skip data.  Floating point keys
+// are excluded as NaN, which may match NaN, is outside of any range.
+bool SupportsKeyRange(const DataType& type) {
+  switch (type.id()) {
+    case Type::DATE32:
+    case Type::DATE64:
+    case Type::TIME32:
+    case Type::TIME64:
+    case Type::TIMESTAMP:
+    case Type::DURATION:
+      return true;
+    default:
+      return is_integer(type.id()) || is_decimal(type.id()) ||
+             is_base_binary_like(type.id());
+  }
+}
+
+Result<std::shared_ptr<Scalar>> Extremum(const std::shared_ptr<DataType>& type,
+                                         const ScalarVector& values, bool max,
+                                         ExecContext* ctx) {
+  std::unique_ptr<ArrayBuilder> builder;
+  RETURN_NOT_OK(MakeBuilder(ctx->memory_pool(), type, &builder));
+  RETURN_NOT_OK(builder->AppendScalars(values));
+  ARROW_ASSIGN_OR_RAISE(auto array, builder->Finish());
+  ARROW_ASSIGN_OR_RAISE(Datum min_max,
+                        MinMax(array, ScalarAggregateOptions::Defaults(), ctx));
+  return checked_cast<const StructScalar&>(*min_max.scalar()).value[max ? 1 : 0];
+}
+
+// The largest number of distinct build side keys pushed down as a set.  A scan then
+// skips the partitions holding none of them, which a range may not exclude.
+constexpr int64_t kMaxPushedKeySetSize = 1024;
+
+// The sorted distinct non-null values of `arrays`
+Result<std::shared_ptr<Array>> SortedDistinct(const ArrayVector& arrays,
+                                              ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(auto values, Concatenate(arrays, ctx->memory_pool()));
+  ARROW_ASSIGN_OR_RAISE(values, Unique(values, ctx));
+  ARROW_ASSIGN_OR_RAISE(values, DropNull(*values, ctx));
+  ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(*values, SortOrder::Ascending, ctx));
+  ARROW_ASSIGN_OR_RAISE(Datum sorted,
+                        Take(values, indices, TakeOptions::Defaults(), ctx));
+  return sorted.make_array();
+}
+
+}  // namespace
+
+void BloomFilterPushdownContext::InitSourcePushdown(HashJoinNode* owner) {
+  ExecNode* probe_input = push_.pushdown_target_->inputs()[0];
+  source_.target_ = FindRuntimeFilterTarget(probe_input);
+  if (!source_.target_) return;
+  for (size_t i = 0; i < push_.column_map_.size(); ++i) {
+    const auto& field = probe_input->output_schema()->field(push_.column_map_[i]);
+    // With IS, null keys may match yet fall outside of any range
+    if (owner->key_cmp_[i] == JoinKeyCmp::EQ && SupportsKeyRange(*field->type())) {
+      source_.range_keys_.push_back(static_cast<int>(i));
+      source_.range_fields_.push_back(field);
+    }
+  }
+  source_.mins_.resize(source_.range_keys_.size());
+  source_.maxs_.resize(source_.range_keys_.size());
+  source_.distinct_.resize(source_.range_keys_.size());
+  source_.too_many_distinct_.resize(source_.range_keys_.size(), false);
+}
+
+Status BloomFilterPushdownContext::UpdateKeyRanges(const ExecBatch& key_batch) {
+  for (size_t i = 0; i < source_.range_keys_.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(
+        Datum min_max,
+        MinMax(key_batch[source_.range_keys_[i]], ScalarAggregateOptions::Defaults(),
+               ctx_));
+    const auto& min_max_scalar = checked_cast<const StructScalar&>(*min_max.scalar());
+    bool collect_distinct;
+    {
+      std::lock_guard<std::mutex> guard(source_.mutex_);
+      collect_distinct = !source_.too_many_distinct_[i];
+    }
+    std::shared_ptr<Array> distinct;
+    if (collect_distinct) {
+      ARROW_ASSIGN_OR_RAISE(distinct, Unique(key_batch[source_.range_keys_[i]], ctx_));
+    }
+    std::lock_guard<std::mutex> guard(source_.mutex_);
+    source_.mins_[i].push_back(min_max_scalar.value[0]);
+    source_.maxs_[i].push_back(min_max_scalar.value[1]);
+    if (!distinct || source_.too_many_distinct_[i]) continue;
+
+    ArrayVector& distinct_values = source_.distinct_[i];
+    distinct_values.push_back(std::move(distinct));
+    int64_t num_distinct = 0;
+    for (const auto& values : distinct_values) num_distinct += values->length();
+    if (num_distinct > kMaxPushedKeySetSize && distinct_values.size() > 1) {
+      ARROW_ASSIGN_OR_RAISE(distinct, SortedDistinct(distinct_values, ctx_));
+      num_distinct = distinct->length();
+      distinct_values = {std::move(distinct)};
+    }
+    if (num_distinct > kMaxPushedKeySetSize) {
+      source_.too_many_distinct_[i] = true;
+      distinct_values.clear();
+    }
+  }
   return Status::OK();
 }
 
+Result<Expression> BloomFilterPushdownContext::MakeKeyRange() {
+  std::vector<Expression> conjuncts;
+  for (size_t i = 0; i < source_.range_keys_.size(); ++i) {
+    const auto& field = source_.range_fields_[i];
+    ARROW_ASSIGN_OR_RAISE(auto min,
+                          Extremum(field->type(), source_.mins_[i], /*max=*/false, ctx_));
+    ARROW_ASSIGN_OR_RAISE(auto max,
+                          Extremum(field->type(), source_.maxs_[i], /*max=*/true, ctx_));
+    if (!min->is_valid) {
+      // No build side row has a non-null key, so no probe side row can match
+      return literal(false);
+    }
+    conjuncts.push_back(greater_equal(field_ref(field->name()), literal(std::move(min))));
+    conjuncts.push_back(less_equal(field_ref(field->name()), literal(std::move(max))));
+    if (!source_.too_many_distinct_[i]) {
+      ARROW_ASSIGN_OR_RAISE(auto distinct, SortedDistinct(source_.distinct_[i], ctx_));
+      conjuncts.push_back(call("is_in", {field_ref(field->name())},
+                               SetLookupOptions(std::move(distinct),
+                                                /*skip_nulls=*/true)));
+    }
+  }
+  return and_(std::move(conjuncts));
+}
+
 Status BloomFilterPushdownContext::BuildBloomFilter_exec_task(size_t thread_index,
                                                               int64_t task_id) {
   const ExecBatch& input_batch = build_.batches_[task_id];
@@ -1117,6 +1774,9 @@ Status BloomFilterPushdownContext::BuildBloomFilter_exec_task(size_t thread_inde
     }
   }
   ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch, ExecBatch::Make(std::move(key_columns)));
+  if (source_.target_) {
+    RETURN_NOT_OK(UpdateKeyRanges(key_batch));
+  }
 
   ARROW_ASSIGN_OR_RAISE(util::TempVectorStack * stack, GetStack(thread_index));
   util::TempVectorHolder<uint32_t> hash_holder(stack, util::MiniBatch::kMiniBatchLength);
@@ -1193,6 +1853,8 @@ std::pair<HashJoinNode*, std::vector<int>> BloomFilterPushdownContext::GetPushdo
   for (ExecNode* candidate = start->inputs()[0];
        candidate->kind_name() == start->kind_name(); candidate = candidate->inputs()[0]) {
     auto* candidate_as_join = checked_cast<HashJoinNode*>(candidate);
+    // The probe side of an adaptive join is not known yet
+    if (candidate_as_join->swapped_join_) break;
     SchemaProjectionMap candidate_output_to_input =
         candidate_as_join->schema_mgr_->proj_maps[0].map(HashJoinProjection::OUTPUT,
                                                          HashJoinProjection::INPUT);
@@ -1224,6 +1886,10 @@ std::pair<HashJoinNode*, std::vector<int>> BloomFilterPushdownContext::GetPushdo
 
     if (all_comparisons_is || can_produce_build_side_nulls) break;
 
+    // A join that may spill partitions its probe side as it arrives and does not wait
+    // for Bloom filters
+    if (candidate_as_join->spill_memory_limit_ > 0) break;
+
     // All keys are present, we can update the mapping
     for (int i = 0; i < num_keys; i++) {
       int candidate_input_idx = candidate_output_to_input.get(bloom_to_target[i]);
@@ -22,6 +22,7 @@
 #include <unordered_set>
 
 #include "arrow/api.h"
+#include "arrow/compute/exec/hash_join.h"
 #include "arrow/compute/exec/options.h"
 #include "arrow/compute/exec/test_util.h"
 #include "arrow/compute/exec/util.h"
@@ -996,6 +997,65 @@ TEST(HashJoin, Suffix) {
   AssertSchemaEqual(expected.schema, hashjoin->output_schema());
 }
 
+TEST(HashJoin, FilteredInputs) {
+  BatchesWithSchema input_left;
+  input_left.batches = {ExecBatchFromJSON({int32(), utf8(), int32()}, R"([
+                   [1, "a", 4],
+                   [2, "b", 5],
+                   [3, "c", 6],
+                   [1, "d", 7]
+                 ])")};
+  input_left.schema = schema(
+      {field("lkey", int32()), field("lunused", utf8()), field("lpayload", int32())});
+
+  BatchesWithSchema input_right;
+  input_right.batches = {ExecBatchFromJSON({int32(), int32()}, R"([
+                   [1, 10],
+                   [2, 11],
+                   [3, 12]
+                 ])")};
+  input_right.schema = schema({field("rkey", int32()), field("rpayload", int32())});
+
+  auto expected_schema = schema({field("lkey", int32()), field("lpayload", int32()),
+                                 field("rkey", int32()), field("rpayload", int32())});
+  auto expected = ExecBatchFromJSON({int32(), int32(), int32(), int32()}, R"([
+    [3, 6, 3, 12],
+    [1, 7, 1, 10]
+  ])");
+
+  for (bool adaptive : {false, true}) {
+    SCOPED_TRACE(adaptive ? "adaptive" : "right build side");
+    // Both inputs reach the join with a selection vector, of which the join only copies
+    // the columns it reads
+    HashJoinNodeOptions join_opts{JoinType::INNER,
+                                  /*left_keys=*/{"lkey"},
+                                  /*right_keys=*/{"rkey"},
+                                  /*left_output=*/{"lkey", "lpayload"},
+                                  /*right_output=*/{"rkey", "rpayload"}};
+    join_opts.adaptive_build_side = adaptive;
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    auto left = Declaration::Sequence({
+        {"source", SourceNodeOptions{input_left.schema, input_left.gen(false, false)}},
+        {"filter", FilterNodeOptions{greater(field_ref("lpayload"), literal(4))}},
+    });
+    auto right = Declaration::Sequence({
+        {"source", SourceNodeOptions{input_right.schema, input_right.gen(false, false)}},
+        {"filter", FilterNodeOptions{not_equal(field_ref("rkey"), literal(2))}},
+    });
+    Declaration join{"hashjoin",
+                     {Declaration::Input(std::move(left)),
+                      Declaration::Input(std::move(right))},
+                     join_opts};
+    ASSERT_OK(
+        Declaration::Sequence({std::move(join), {"sink", SinkNodeOptions{&sink_gen}}})
+            .AddToPlan(plan.get()));
+
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto result, StartAndCollect(plan.get(), sink_gen));
+    AssertExecBatchesEqual(expected_schema, {expected}, result);
+  }
+}
+
 TEST(HashJoin, Random) {
   Random64Bit rng(42);
 #if defined(THREAD_SANITIZER) || defined(ARROW_VALGRIND)
@@ -2126,6 +2186,299 @@ void TestSingleChainOfHashJoins(Random64Bit& rng) {
   }
 }
 
+Result<std::shared_ptr<Table>> SortedHashJoinOutput(
+    const HashJoinNodeOptions& join_options, const BatchesWithSchema& l_batches,
+    const BatchesWithSchema& r_batches, bool parallel) {
+  auto exec_ctx = arrow::internal::make_unique<ExecContext>(
+      default_memory_pool(), parallel ? arrow::internal::GetCpuThreadPool() : nullptr);
+  ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make(exec_ctx.get()));
+
+  ARROW_ASSIGN_OR_RAISE(
+      ExecNode * l_source,
+      MakeExecNode("source", plan.get(), {},
+                   SourceNodeOptions{l_batches.schema,
+                                     l_batches.gen(parallel, /*slow=*/false)}));
+  ARROW_ASSIGN_OR_RAISE(
+      ExecNode * r_source,
+      MakeExecNode("source", plan.get(), {},
+                   SourceNodeOptions{r_batches.schema,
+                                     r_batches.gen(parallel, /*slow=*/false)}));
+
+  ARROW_ASSIGN_OR_RAISE(
+      ExecNode * join,
+      MakeExecNode("hashjoin", plan.get(), {l_source, r_source}, join_options));
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+  ARROW_ASSIGN_OR_RAISE(
+      std::ignore, MakeExecNode("sink", plan.get(), {join}, SinkNodeOptions{&sink_gen}));
+
+  auto batches_fut = StartAndCollect(plan.get(), sink_gen);
+  if (!batches_fut.Wait(::arrow::kDefaultAssertFinishesWaitSeconds)) {
+    plan->StopProducing();
+    return Status::Invalid("Plan did not finish");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto batches, batches_fut.result());
+  ARROW_ASSIGN_OR_RAISE(auto table,
+                        TableFromExecBatches(join->output_schema(), batches));
+
+  std::vector<SortKey> sort_keys;
+  for (auto&& f : table->schema()->fields()) {
+    sort_keys.emplace_back(f->name());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto sort_ids, SortIndices(table, SortOptions(sort_keys)));
+  ARROW_ASSIGN_OR_RAISE(Datum sorted, Take(table, sort_ids));
+  return sorted.table();
+}
+
+Result<std::shared_ptr<Table>> HashJoinWithSpilling(
+    JoinType join_type, const BatchesWithSchema& l_batches,
+    const BatchesWithSchema& r_batches, int64_t spill_memory_limit, bool parallel) {
+  HashJoinNodeOptions join_options{join_type, {FieldRef("l_key")}, {FieldRef("r_key")}};
+  join_options.spill_memory_limit = spill_memory_limit;
+  return SortedHashJoinOutput(join_options, l_batches, r_batches, parallel);
+}
+
+TEST(HashJoin, Spilling) {
+  ::arrow::random::RandomArrayGenerator rng(42);
+  auto l_schema = schema({field("l_key", int32()), field("l_payload", utf8())});
+  auto r_schema = schema({field("r_key", int32()), field("r_payload", int64())});
+
+  BatchesWithSchema l_batches, r_batches;
+  l_batches.schema = l_schema;
+  r_batches.schema = r_schema;
+  constexpr int kNumBatches = 16;
+  constexpr int64_t kBatchSize = 512;
+  for (int i = 0; i < kNumBatches; ++i) {
+    l_batches.batches.push_back(ExecBatch::Make({rng.Int32(kBatchSize, 0, 4000, 0.05),
+                                                 rng.String(kBatchSize, 0, 8, 0.1)})
+                                    .ValueOrDie());
+    r_batches.batches.push_back(ExecBatch::Make({rng.Int32(kBatchSize, 0, 4000, 0.05),
+                                                 rng.Int64(kBatchSize, 0, 1000, 0.1)})
+                                    .ValueOrDie());
+  }
+
+  for (bool parallel : {false, true}) {
+    for (JoinType join_type :
+         {JoinType::LEFT_SEMI, JoinType::RIGHT_SEMI, JoinType::LEFT_ANTI,
+          JoinType::RIGHT_ANTI, JoinType::INNER, JoinType::LEFT_OUTER,
+          JoinType::RIGHT_OUTER, JoinType::FULL_OUTER}) {
+      ARROW_SCOPED_TRACE("parallel=", parallel, " join_type=", ToString(join_type));
+      ASSERT_OK_AND_ASSIGN(auto expected,
+                           HashJoinWithSpilling(join_type, l_batches, r_batches,
+                                                /*spill_memory_limit=*/0, parallel));
+      // A limit far below the size of the build side forces every partition to spill
+      ASSERT_OK_AND_ASSIGN(auto actual,
+                           HashJoinWithSpilling(join_type, l_batches, r_batches,
+                                                /*spill_memory_limit=*/4096, parallel));
+      AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false,
+                        /*flatten=*/true);
+    }
+  }
+}
+
+TEST(HashJoin, AdaptiveBuildSide) {
+  ::arrow::random::RandomArrayGenerator rng(42);
+  auto make_batches = [&](const std::string& prefix, int num_batches,
+                          int64_t batch_size) {
+    BatchesWithSchema batches;
+    batches.schema =
+        schema({field(prefix + "_key", int32()), field(prefix + "_payload", int64())});
+    for (int i = 0; i < num_batches; ++i) {
+      batches.batches.push_back(ExecBatch::Make({rng.Int32(batch_size, 0, 1000, 0.05),
+                                                 rng.Int64(batch_size, 0, 1000, 0.1)})
+                                    .ValueOrDie());
+    }
+    return batches;
+  };
+  // Either input may be the smaller one
+  std::vector<std::pair<BatchesWithSchema, BatchesWithSchema>> inputs = {
+      {make_batches("l", 2, 64), make_batches("r", 16, 512)},
+      {make_batches("l", 16, 512), make_batches("r", 2, 64)},
+      {make_batches("l", 4, 512), make_batches("r", 4, 512)}};
+
+  for (bool parallel : {false, true}) {
+    for (const auto& input : inputs) {
+      for (JoinType join_type :
+           {JoinType::LEFT_SEMI, JoinType::RIGHT_SEMI, JoinType::LEFT_ANTI,
+            JoinType::RIGHT_ANTI, JoinType::INNER, JoinType::LEFT_OUTER,
+            JoinType::RIGHT_OUTER, JoinType::FULL_OUTER}) {
+        for (bool residual_filter : {false, true}) {
+          ARROW_SCOPED_TRACE("parallel=", parallel, " join_type=", ToString(join_type),
+                             " left batches=", input.first.batches.size(),
+                             " residual_filter=", residual_filter);
+          HashJoinNodeOptions join_options{join_type, {"l_key"}, {"r_key"}};
+          if (residual_filter) {
+            join_options.filter = less(field_ref("l_payload"), field_ref("r_payload"));
+          }
+          ASSERT_OK_AND_ASSIGN(auto expected,
+                               SortedHashJoinOutput(join_options, input.first,
+                                                    input.second, parallel));
+          join_options.adaptive_build_side = true;
+          for (int max_batches : {1, 16}) {
+            join_options.adaptive_build_side_max_batches = max_batches;
+            ASSERT_OK_AND_ASSIGN(auto actual,
+                                 SortedHashJoinOutput(join_options, input.first,
+                                                      input.second, parallel));
+            AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false,
+                              /*flatten=*/true);
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(HashJoin, AdaptiveBuildSideValidation) {
+  BatchesWithSchema l_batches, r_batches;
+  l_batches.schema = schema({field("l_key", int32())});
+  r_batches.schema = schema({field("r_key", int32())});
+  HashJoinNodeOptions join_options{JoinType::INNER, {"l_key"}, {"r_key"}};
+  join_options.adaptive_build_side = true;
+  join_options.adaptive_build_side_max_batches = 0;
+  ASSERT_RAISES(Invalid, SortedHashJoinOutput(join_options, l_batches, r_batches,
+                                              /*parallel=*/false));
+  join_options.adaptive_build_side_max_batches = 16;
+  join_options.spill_memory_limit = 1 << 20;
+  ASSERT_RAISES(NotImplemented, SortedHashJoinOutput(join_options, l_batches, r_batches,
+                                                     /*parallel=*/false));
+}
+
+TEST(HashJoin, SpillingValidation) {
+  auto exec_ctx =
+      arrow::internal::make_unique<ExecContext>(default_memory_pool(), nullptr);
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(exec_ctx.get()));
+
+  BatchesWithSchema l_batches, r_batches;
+  l_batches.schema = schema({field("l_key", dictionary(int8(), utf8()))});
+  r_batches.schema = schema({field("r_key", dictionary(int8(), utf8()))});
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * l_source,
+      MakeExecNode("source", plan.get(), {},
+                   SourceNodeOptions{l_batches.schema,
+                                     l_batches.gen(/*parallel=*/false, /*slow=*/false)}));
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * r_source,
+      MakeExecNode("source", plan.get(), {},
+                   SourceNodeOptions{r_batches.schema,
+                                     r_batches.gen(/*parallel=*/false, /*slow=*/false)}));
+
+  HashJoinNodeOptions options{JoinType::INNER, {FieldRef("l_key")}, {FieldRef("r_key")}};
+  options.spill_memory_limit = -1;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("spill_memory_limit"),
+      MakeExecNode("hashjoin", plan.get(), {l_source, r_source}, options));
+
+  options.spill_memory_limit = 1 << 20;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      NotImplemented, ::testing::HasSubstr("dictionary"),
+      MakeExecNode("hashjoin", plan.get(), {l_source, r_source}, options));
+}
+
+// Run a join directly on a HashJoinImpl, executing all tasks on the calling thread
+Result<std::shared_ptr<Table>> HashJoinWithImpl(std::unique_ptr<HashJoinImpl> impl,
+                                                JoinType join_type,
+                                                std::vector<JoinKeyCmp> key_cmp,
+                                                const BatchesWithSchema& l_batches,
+                                                const BatchesWithSchema& r_batches,
+                                                Expression filter, size_t num_threads) {
+  ExecContext ctx;
+  HashJoinSchema schema_mgr;
+  RETURN_NOT_OK(schema_mgr.Init(
+      join_type, *l_batches.schema, {FieldRef("l_key"), FieldRef("l_str")},
+      *r_batches.schema, {FieldRef("r_key"), FieldRef("r_str")}, filter, "l_", "r_"));
+  ARROW_ASSIGN_OR_RAISE(filter, schema_mgr.BindFilter(filter, *l_batches.schema,
+                                                      *r_batches.schema, &ctx));
+  auto output_schema = schema_mgr.MakeOutputSchema("", "");
+
+  std::vector<ExecBatch> output;
+  std::unique_ptr<TaskScheduler> scheduler = TaskScheduler::Make();
+  RETURN_NOT_OK(impl->Init(
+      &ctx, join_type, num_threads, &schema_mgr, std::move(key_cmp), std::move(filter),
+      [&output](ExecBatch batch) { output.push_back(std::move(batch)); },
+      [](int64_t) {}, scheduler.get()));
+  int task_group_probe = scheduler->RegisterTaskGroup(
+      [&](size_t thread_index, int64_t task_id) -> Status {
+        return impl->ProbeSingleBatch(thread_index, l_batches.batches[task_id]);
+      },
+      [&](size_t thread_index) -> Status { return impl->ProbingFinished(thread_index); });
+  scheduler->RegisterEnd();
+  RETURN_NOT_OK(scheduler->StartScheduling(
+      /*thread_index=*/0,
+      [](std::function<Status(size_t)> func) -> Status { return func(0); },
+      /*num_concurrent_tasks=*/1, /*use_sync_execution=*/true));
+
+  AccumulationQueue build_batches;
+  for (const ExecBatch& batch : r_batches.batches) {
+    build_batches.InsertBatch(batch);
+  }
+  RETURN_NOT_OK(impl->BuildHashTable(
+      /*thread_index=*/0, std::move(build_batches), [&](size_t thread_index) {
+        return scheduler->StartTaskGroup(thread_index, task_group_probe,
+                                         l_batches.batches.size());
+      }));
+
+  ARROW_ASSIGN_OR_RAISE(auto table, TableFromExecBatches(output_schema, output));
+  std::vector<SortKey> sort_keys;
+  for (auto&& f : table->schema()->fields()) {
+    sort_keys.emplace_back(f->name());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto sort_ids, SortIndices(table, SortOptions(sort_keys)));
+  ARROW_ASSIGN_OR_RAISE(Datum sorted, Take(table, sort_ids));
+  return sorted.table();
+}
+
+TEST(HashJoin, SwissTable) {
+  ::arrow::random::RandomArrayGenerator rng(42);
+  auto l_schema = schema({field("l_key", int32()), field("l_str", utf8()),
+                          field("l_payload", int32())});
+  auto r_schema = schema({field("r_key", int32()), field("r_str", utf8()),
+                          field("r_payload", int32())});
+
+  // Enough build rows to split the swiss table into several partitions
+  BatchesWithSchema l_batches, r_batches;
+  l_batches.schema = l_schema;
+  r_batches.schema = r_schema;
+  constexpr int kNumBatches = 24;
+  constexpr int64_t kBatchSize = 1024;
+  for (int i = 0; i < kNumBatches; ++i) {
+    l_batches.batches.push_back(ExecBatch::Make({rng.Int32(kBatchSize, 0, 3000, 0.05),
+                                                 rng.String(kBatchSize, 0, 1, 0.05),
+                                                 rng.Int32(kBatchSize, 0, 100)})
+                                    .ValueOrDie());
+    r_batches.batches.push_back(ExecBatch::Make({rng.Int32(kBatchSize, 0, 3000, 0.05),
+                                                 rng.String(kBatchSize, 0, 1, 0.05),
+                                                 rng.Int32(kBatchSize, 0, 100)})
+                                    .ValueOrDie());
+  }
+
+  for (JoinKeyCmp str_cmp : {JoinKeyCmp::EQ, JoinKeyCmp::IS}) {
+    for (bool use_filter : {false, true}) {
+      for (JoinType join_type :
+           {JoinType::LEFT_SEMI, JoinType::RIGHT_SEMI, JoinType::LEFT_ANTI,
+            JoinType::RIGHT_ANTI, JoinType::INNER, JoinType::LEFT_OUTER,
+            JoinType::RIGHT_OUTER, JoinType::FULL_OUTER}) {
+        ARROW_SCOPED_TRACE("join_type=", ToString(join_type), " filter=", use_filter,
+                           " str_cmp=", str_cmp == JoinKeyCmp::EQ ? "EQ" : "IS");
+        Expression filter = use_filter ? greater(field_ref("l_payload"),
+                                                 field_ref("r_payload"))
+                                       : literal(true);
+        std::vector<JoinKeyCmp> key_cmp = {JoinKeyCmp::EQ, str_cmp};
+        ASSERT_OK_AND_ASSIGN(auto basic, HashJoinImpl::MakeBasic());
+        ASSERT_OK_AND_ASSIGN(auto expected,
+                             HashJoinWithImpl(std::move(basic), join_type, key_cmp,
+                                              l_batches, r_batches, filter,
+                                              /*num_threads=*/4));
+        ASSERT_OK_AND_ASSIGN(auto swiss, HashJoinImpl::MakeSwiss());
+        ASSERT_OK_AND_ASSIGN(auto actual,
+                             HashJoinWithImpl(std::move(swiss), join_type, key_cmp,
+                                              l_batches, r_batches, filter,
+                                              /*num_threads=*/4));
+        AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false,
+                          /*flatten=*/true);
+      }
+    }
+  }
+}
+
 TEST(HashJoin, ChainedIntegerHashJoins) {
   Random64Bit rng(42);
   int num_tests = 30;
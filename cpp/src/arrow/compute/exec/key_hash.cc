@@ -236,8 +236,15 @@ void Hashing32::HashVarLen(int64_t hardware_flags, bool combine_hashes, uint32_t
                            const uint32_t* offsets, const uint8_t* concatenated_keys,
                            uint32_t* hashes, uint32_t* hashes_temp_for_combine) {
   uint32_t num_processed = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if ((hardware_flags & arrow::internal::CpuInfo::AVX512) ==
+      arrow::internal::CpuInfo::AVX512) {
+    num_processed =
+        HashVarLen_avx512(combine_hashes, num_rows, offsets, concatenated_keys, hashes);
+  }
+#endif
 #if defined(ARROW_HAVE_AVX2)
-  if (hardware_flags & arrow::internal::CpuInfo::AVX2) {
+  if (num_processed == 0 && (hardware_flags & arrow::internal::CpuInfo::AVX2)) {
     num_processed = HashVarLen_avx2(combine_hashes, num_rows, offsets, concatenated_keys,
                                     hashes, hashes_temp_for_combine);
   }
@@ -255,8 +262,15 @@ void Hashing32::HashVarLen(int64_t hardware_flags, bool combine_hashes, uint32_t
                            const uint64_t* offsets, const uint8_t* concatenated_keys,
                            uint32_t* hashes, uint32_t* hashes_temp_for_combine) {
   uint32_t num_processed = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if ((hardware_flags & arrow::internal::CpuInfo::AVX512) ==
+      arrow::internal::CpuInfo::AVX512) {
+    num_processed =
+        HashVarLen_avx512(combine_hashes, num_rows, offsets, concatenated_keys, hashes);
+  }
+#endif
 #if defined(ARROW_HAVE_AVX2)
-  if (hardware_flags & arrow::internal::CpuInfo::AVX2) {
+  if (num_processed == 0 && (hardware_flags & arrow::internal::CpuInfo::AVX2)) {
     num_processed = HashVarLen_avx2(combine_hashes, num_rows, offsets, concatenated_keys,
                                     hashes, hashes_temp_for_combine);
   }
@@ -361,8 +375,14 @@ void Hashing32::HashFixed(int64_t hardware_flags, bool combine_hashes, uint32_t
   }
 
   uint32_t num_processed = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if ((hardware_flags & arrow::internal::CpuInfo::AVX512) ==
+      arrow::internal::CpuInfo::AVX512) {
+    num_processed = HashFixedLen_avx512(combine_hashes, num_rows, length, keys, hashes);
+  }
+#endif
 #if defined(ARROW_HAVE_AVX2)
-  if (hardware_flags & arrow::internal::CpuInfo::AVX2) {
+  if (num_processed == 0 && (hardware_flags & arrow::internal::CpuInfo::AVX2)) {
     num_processed = HashFixedLen_avx2(combine_hashes, num_rows, length, keys, hashes,
                                       hashes_temp_for_combine);
   }
@@ -697,23 +717,43 @@ void Hashing64::HashVarLenImp(uint32_t num_rows, const T* offsets,
   }
 }
 
-void Hashing64::HashVarLen(bool combine_hashes, uint32_t num_rows,
+void Hashing64::HashVarLen(int64_t hardware_flags, bool combine_hashes, uint32_t num_rows,
                            const uint32_t* offsets, const uint8_t* concatenated_keys,
                            uint64_t* hashes) {
+  uint32_t num_processed = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if ((hardware_flags & arrow::internal::CpuInfo::AVX512) ==
+      arrow::internal::CpuInfo::AVX512) {
+    num_processed =
+        HashVarLen_avx512(combine_hashes, num_rows, offsets, concatenated_keys, hashes);
+  }
+#endif
   if (combine_hashes) {
-    HashVarLenImp<uint32_t, true>(num_rows, offsets, concatenated_keys, hashes);
+    HashVarLenImp<uint32_t, true>(num_rows - num_processed, offsets + num_processed,
+                                  concatenated_keys, hashes + num_processed);
   } else {
-    HashVarLenImp<uint32_t, false>(num_rows, offsets, concatenated_keys, hashes);
+    HashVarLenImp<uint32_t, false>(num_rows - num_processed, offsets + num_processed,
+                                   concatenated_keys, hashes + num_processed);
   }
 }
 
-void Hashing64::HashVarLen(bool combine_hashes, uint32_t num_rows,
+void Hashing64::HashVarLen(int64_t hardware_flags, bool combine_hashes, uint32_t num_rows,
                            const uint64_t* offsets, const uint8_t* concatenated_keys,
                            uint64_t* hashes) {
+  uint32_t num_processed = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if ((hardware_flags & arrow::internal::CpuInfo::AVX512) ==
+      arrow::internal::CpuInfo::AVX512) {
+    num_processed =
+        HashVarLen_avx512(combine_hashes, num_rows, offsets, concatenated_keys, hashes);
+  }
+#endif
   if (combine_hashes) {
-    HashVarLenImp<uint64_t, true>(num_rows, offsets, concatenated_keys, hashes);
+    HashVarLenImp<uint64_t, true>(num_rows - num_processed, offsets + num_processed,
+                                  concatenated_keys, hashes + num_processed);
   } else {
-    HashVarLenImp<uint64_t, false>(num_rows, offsets, concatenated_keys, hashes);
+    HashVarLenImp<uint64_t, false>(num_rows - num_processed, offsets + num_processed,
+                                   concatenated_keys, hashes + num_processed);
   }
 }
 
@@ -799,17 +839,26 @@ void Hashing64::HashInt(bool combine_hashes, uint32_t num_keys, uint64_t length_
   }
 }
 
-void Hashing64::HashFixed(bool combine_hashes, uint32_t num_rows, uint64_t length,
-                          const uint8_t* keys, uint64_t* hashes) {
+void Hashing64::HashFixed(int64_t hardware_flags, bool combine_hashes, uint32_t num_rows,
+                          uint64_t length, const uint8_t* keys, uint64_t* hashes) {
   if (ARROW_POPCOUNT64(length) == 1 && length <= sizeof(uint64_t)) {
     HashInt(combine_hashes, num_rows, length, keys, hashes);
     return;
   }
 
+  uint32_t num_processed = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if ((hardware_flags & arrow::internal::CpuInfo::AVX512) ==
+      arrow::internal::CpuInfo::AVX512) {
+    num_processed = HashFixedLen_avx512(combine_hashes, num_rows, length, keys, hashes);
+  }
+#endif
   if (combine_hashes) {
-    HashFixedLenImp<true>(num_rows, length, keys, hashes);
+    HashFixedLenImp<true>(num_rows - num_processed, length, keys + length * num_processed,
+                          hashes + num_processed);
   } else {
-    HashFixedLenImp<false>(num_rows, length, keys, hashes);
+    HashFixedLenImp<false>(num_rows - num_processed, length,
+                           keys + length * num_processed, hashes + num_processed);
   }
 }
 
@@ -862,13 +911,14 @@ void Hashing64::HashMultiColumn(const std::vector<KeyColumnArray>& cols,
           HashBit(icol > 0, cols[icol].bit_offset(1), batch_size_next,
                   cols[icol].data(1) + first_row / 8, hashes + first_row);
         } else {
-          HashFixed(icol > 0, batch_size_next, col_width,
+          HashFixed(ctx->hardware_flags, icol > 0, batch_size_next, col_width,
                     cols[icol].data(1) + first_row * col_width, hashes + first_row);
         }
       } else {
         // TODO: add support for 64-bit offsets
-        HashVarLen(icol > 0, batch_size_next, cols[icol].offsets() + first_row,
-                   cols[icol].data(2), hashes + first_row);
+        HashVarLen(ctx->hardware_flags, icol > 0, batch_size_next,
+                   cols[icol].offsets() + first_row, cols[icol].data(2),
+                   hashes + first_row);
       }
 
       // Zero hash for nulls
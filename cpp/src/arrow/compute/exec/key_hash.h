@@ -17,7 +17,7 @@
 
 #pragma once
 
-#if defined(ARROW_HAVE_AVX2)
+#if defined(ARROW_HAVE_AVX2) || defined(ARROW_HAVE_RUNTIME_AVX512)
 #include <immintrin.h>
 #endif
 
@@ -147,6 +147,36 @@ class ARROW_EXPORT Hashing32 {
                                   const uint8_t* concatenated_keys, uint32_t* hashes,
                                   uint32_t* hashes_temp_for_combine);
 #endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  // AVX-512 variants process 4 keys at a time and rely on masked loads, so unlike the
+  // AVX2 versions they do not have to leave the rows near the end of the buffer to the
+  // scalar code. They return the number of rows processed.
+  //
+  static inline __m128i Avalanche_avx512(__m128i hash);
+  static inline __m128i CombineHashesImp_avx512(__m128i previous_hash, __m128i hash);
+  static inline __m512i Round_avx512(__m512i acc, __m512i input);
+  static inline __m128i CombineAccumulators_avx512(__m512i acc);
+  template <bool two_equal_lengths>
+  static inline __m512i ProcessStripes_avx512(const uint8_t* const* keys,
+                                              const uint64_t* lengths);
+  template <bool T_COMBINE_HASHES>
+  static uint32_t HashFixedLenImp_avx512(uint32_t num_rows, uint64_t length,
+                                         const uint8_t* keys, uint32_t* hashes);
+  template <typename T, bool T_COMBINE_HASHES>
+  static uint32_t HashVarLenImp_avx512(uint32_t num_rows, const T* offsets,
+                                       const uint8_t* concatenated_keys,
+                                       uint32_t* hashes);
+  static uint32_t HashFixedLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                      uint64_t length, const uint8_t* keys,
+                                      uint32_t* hashes);
+  static uint32_t HashVarLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                    const uint32_t* offsets,
+                                    const uint8_t* concatenated_keys, uint32_t* hashes);
+  static uint32_t HashVarLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                    const uint64_t* offsets,
+                                    const uint8_t* concatenated_keys, uint32_t* hashes);
+#endif
 };
 
 class ARROW_EXPORT Hashing64 {
@@ -173,14 +203,16 @@ class ARROW_EXPORT Hashing64 {
   static const uint32_t kCombineConst = 0x9e3779b9UL;
   static const int64_t kStripeSize = 4 * sizeof(uint64_t);
 
-  static void HashFixed(bool combine_hashes, uint32_t num_keys, uint64_t length_key,
-                        const uint8_t* keys, uint64_t* hashes);
+  static void HashFixed(int64_t hardware_flags, bool combine_hashes, uint32_t num_keys,
+                        uint64_t length_key, const uint8_t* keys, uint64_t* hashes);
 
-  static void HashVarLen(bool combine_hashes, uint32_t num_rows, const uint32_t* offsets,
-                         const uint8_t* concatenated_keys, uint64_t* hashes);
+  static void HashVarLen(int64_t hardware_flags, bool combine_hashes, uint32_t num_rows,
+                         const uint32_t* offsets, const uint8_t* concatenated_keys,
+                         uint64_t* hashes);
 
-  static void HashVarLen(bool combine_hashes, uint32_t num_rows, const uint64_t* offsets,
-                         const uint8_t* concatenated_keys, uint64_t* hashes);
+  static void HashVarLen(int64_t hardware_flags, bool combine_hashes, uint32_t num_rows,
+                         const uint64_t* offsets, const uint8_t* concatenated_keys,
+                         uint64_t* hashes);
 
   static inline uint64_t Avalanche(uint64_t acc);
   static inline uint64_t Round(uint64_t acc, uint64_t input);
@@ -215,6 +247,33 @@ class ARROW_EXPORT Hashing64 {
   static void HashIntImp(uint32_t num_keys, const T* keys, uint64_t* hashes);
   static void HashInt(bool T_COMBINE_HASHES, uint32_t num_keys, uint64_t length_key,
                       const uint8_t* keys, uint64_t* hashes);
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  // Each 256-bit half of a 512-bit register holds the accumulators of one key, so two
+  // keys are processed at a time. They return the number of rows processed.
+  //
+  static inline __m512i Round_avx512(__m512i acc, __m512i input);
+  static inline __m512i CombineAccumulatorsAndAvalanche_avx512(__m512i acc);
+  template <bool two_equal_lengths>
+  static inline __m512i ProcessStripes_avx512(const uint8_t* const* keys,
+                                              const uint64_t* lengths);
+  template <bool T_COMBINE_HASHES>
+  static uint32_t HashFixedLenImp_avx512(uint32_t num_rows, uint64_t length,
+                                         const uint8_t* keys, uint64_t* hashes);
+  template <typename T, bool T_COMBINE_HASHES>
+  static uint32_t HashVarLenImp_avx512(uint32_t num_rows, const T* offsets,
+                                       const uint8_t* concatenated_keys,
+                                       uint64_t* hashes);
+  static uint32_t HashFixedLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                      uint64_t length, const uint8_t* keys,
+                                      uint64_t* hashes);
+  static uint32_t HashVarLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                    const uint32_t* offsets,
+                                    const uint8_t* concatenated_keys, uint64_t* hashes);
+  static uint32_t HashVarLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                    const uint64_t* offsets,
+                                    const uint8_t* concatenated_keys, uint64_t* hashes);
+#endif
 };
 
 }  // namespace compute
@@ -0,0 +1,370 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include <algorithm>
+
+#include "arrow/compute/exec/key_hash.h"
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+namespace compute {
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+
+namespace {
+
+// Masked loads do not fault on the bytes that are masked out, which lets us read the
+// last stripe of every key in place, without copying it or skipping the rows at the
+// end of the buffer.
+//
+// Number of bytes of stripe istripe that belong to a key of the given length
+//
+inline int64_t StripeBytes(uint64_t length, int64_t istripe, int64_t stripe_size) {
+  int64_t remaining = static_cast<int64_t>(length) - istripe * stripe_size;
+  return std::max<int64_t>(0, std::min<int64_t>(remaining, stripe_size));
+}
+
+}  // namespace
+
+inline __m128i Hashing32::Avalanche_avx512(__m128i hash) {
+  hash = _mm_xor_si128(hash, _mm_srli_epi32(hash, 15));
+  hash = _mm_mullo_epi32(hash, _mm_set1_epi32(PRIME32_2));
+  hash = _mm_xor_si128(hash, _mm_srli_epi32(hash, 13));
+  hash = _mm_mullo_epi32(hash, _mm_set1_epi32(PRIME32_3));
+  hash = _mm_xor_si128(hash, _mm_srli_epi32(hash, 16));
+  return hash;
+}
+
+inline __m128i Hashing32::CombineHashesImp_avx512(__m128i previous_hash, __m128i hash) {
+  __m128i x =
+      _mm_add_epi32(_mm_slli_epi32(previous_hash, 6), _mm_srli_epi32(previous_hash, 2));
+  __m128i y = _mm_add_epi32(hash, _mm_set1_epi32(kCombineConst));
+  return _mm_xor_si128(previous_hash, _mm_add_epi32(x, y));
+}
+
+inline __m512i Hashing32::Round_avx512(__m512i acc, __m512i input) {
+  acc = _mm512_add_epi32(acc, _mm512_mullo_epi32(input, _mm512_set1_epi32(PRIME32_2)));
+  acc = _mm512_rol_epi32(acc, 13);
+  acc = _mm512_mullo_epi32(acc, _mm512_set1_epi32(PRIME32_1));
+  return acc;
+}
+
+inline __m128i Hashing32::CombineAccumulators_avx512(__m512i acc) {
+  // Each 128-bit lane of input represents a set of 4 accumulators related to
+  // a single hash (we process here four hashes together).
+  //
+  acc = _mm512_rolv_epi32(
+      acc, _mm512_setr_epi32(1, 7, 12, 18, 1, 7, 12, 18, 1, 7, 12, 18, 1, 7, 12, 18));
+  acc = _mm512_add_epi32(acc, _mm512_shuffle_epi32(acc, _MM_PERM_BADC));
+  acc = _mm512_add_epi32(acc, _mm512_srli_epi64(acc, 32));
+  acc = _mm512_permutexvar_epi32(
+      _mm512_setr_epi32(0, 4, 8, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0), acc);
+  return _mm512_castsi512_si128(acc);
+}
+
+template <bool two_equal_lengths>
+inline __m512i Hashing32::ProcessStripes_avx512(const uint8_t* const* keys,
+                                                const uint64_t* lengths) {
+  constexpr int kNumKeys = 4;
+  const uint32_t acc1 =
+      static_cast<uint32_t>((static_cast<uint64_t>(PRIME32_1) + PRIME32_2) & 0xffffffff);
+  const uint32_t acc4 = static_cast<uint32_t>(-static_cast<int32_t>(PRIME32_1));
+  __m512i acc = _mm512_setr_epi32(acc1, PRIME32_2, 0, acc4, acc1, PRIME32_2, 0, acc4,
+                                  acc1, PRIME32_2, 0, acc4, acc1, PRIME32_2, 0, acc4);
+
+  // An empty key is hashed as a single stripe of zeroes
+  int64_t num_stripes[kNumKeys];
+  int64_t max_num_stripes = 0;
+  for (int k = 0; k < kNumKeys; ++k) {
+    uint64_t length = lengths[two_equal_lengths ? 0 : k];
+    num_stripes[k] = std::max<int64_t>(1, bit_util::CeilDiv(length, kStripeSize));
+    max_num_stripes = std::max(max_num_stripes, num_stripes[k]);
+  }
+
+  for (int64_t istripe = 0; istripe < max_num_stripes; ++istripe) {
+    __m128i stripes[kNumKeys];
+    __mmask16 active = 0;
+    for (int k = 0; k < kNumKeys; ++k) {
+      int64_t num_bytes =
+          StripeBytes(lengths[two_equal_lengths ? 0 : k], istripe, kStripeSize);
+      stripes[k] = _mm_maskz_loadu_epi8(static_cast<__mmask16>((1U << num_bytes) - 1),
+                                        keys[k] + istripe * kStripeSize);
+      if (istripe < num_stripes[k]) {
+        active |= static_cast<__mmask16>(0xf << (4 * k));
+      }
+    }
+    __m512i stripe = _mm512_castsi128_si512(stripes[0]);
+    stripe = _mm512_inserti32x4(stripe, stripes[1], 1);
+    stripe = _mm512_inserti32x4(stripe, stripes[2], 2);
+    stripe = _mm512_inserti32x4(stripe, stripes[3], 3);
+    // Keys that ran out of stripes keep their accumulators
+    acc = _mm512_mask_mov_epi32(acc, active, Round_avx512(acc, stripe));
+  }
+  return acc;
+}
+
+template <bool T_COMBINE_HASHES>
+uint32_t Hashing32::HashFixedLenImp_avx512(uint32_t num_rows, uint64_t length,
+                                           const uint8_t* keys, uint32_t* hashes) {
+  constexpr int unroll = 4;
+  uint32_t num_rows_to_process = num_rows - num_rows % unroll;
+
+  for (uint32_t i = 0; i < num_rows_to_process; i += unroll) {
+    const uint8_t* key_ptrs[unroll];
+    for (int k = 0; k < unroll; ++k) {
+      key_ptrs[k] = keys + static_cast<uint64_t>(i + k) * length;
+    }
+    __m512i acc = ProcessStripes_avx512</*two_equal_lengths=*/true>(key_ptrs, &length);
+    __m128i hash = Avalanche_avx512(CombineAccumulators_avx512(acc));
+    if (T_COMBINE_HASHES) {
+      __m128i previous_hash =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(hashes + i));
+      hash = CombineHashesImp_avx512(previous_hash, hash);
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(hashes + i), hash);
+  }
+
+  return num_rows_to_process;
+}
+
+uint32_t Hashing32::HashFixedLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                        uint64_t length, const uint8_t* keys,
+                                        uint32_t* hashes) {
+  if (combine_hashes) {
+    return HashFixedLenImp_avx512<true>(num_rows, length, keys, hashes);
+  } else {
+    return HashFixedLenImp_avx512<false>(num_rows, length, keys, hashes);
+  }
+}
+
+template <typename T, bool T_COMBINE_HASHES>
+uint32_t Hashing32::HashVarLenImp_avx512(uint32_t num_rows, const T* offsets,
+                                         const uint8_t* concatenated_keys,
+                                         uint32_t* hashes) {
+  constexpr int unroll = 4;
+  uint32_t num_rows_to_process = num_rows - num_rows % unroll;
+
+  for (uint32_t i = 0; i < num_rows_to_process; i += unroll) {
+    const uint8_t* key_ptrs[unroll];
+    uint64_t lengths[unroll];
+    for (int k = 0; k < unroll; ++k) {
+      key_ptrs[k] = concatenated_keys + offsets[i + k];
+      lengths[k] = static_cast<uint64_t>(offsets[i + k + 1] - offsets[i + k]);
+    }
+    __m512i acc = ProcessStripes_avx512</*two_equal_lengths=*/false>(key_ptrs, lengths);
+    __m128i hash = Avalanche_avx512(CombineAccumulators_avx512(acc));
+    if (T_COMBINE_HASHES) {
+      __m128i previous_hash =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(hashes + i));
+      hash = CombineHashesImp_avx512(previous_hash, hash);
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(hashes + i), hash);
+  }
+
+  return num_rows_to_process;
+}
+
+uint32_t Hashing32::HashVarLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                      const uint32_t* offsets,
+                                      const uint8_t* concatenated_keys,
+                                      uint32_t* hashes) {
+  if (combine_hashes) {
+    return HashVarLenImp_avx512<uint32_t, true>(num_rows, offsets, concatenated_keys,
+                                                hashes);
+  } else {
+    return HashVarLenImp_avx512<uint32_t, false>(num_rows, offsets, concatenated_keys,
+                                                 hashes);
+  }
+}
+
+uint32_t Hashing32::HashVarLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                      const uint64_t* offsets,
+                                      const uint8_t* concatenated_keys,
+                                      uint32_t* hashes) {
+  if (combine_hashes) {
+    return HashVarLenImp_avx512<uint64_t, true>(num_rows, offsets, concatenated_keys,
+                                                hashes);
+  } else {
+    return HashVarLenImp_avx512<uint64_t, false>(num_rows, offsets, concatenated_keys,
+                                                 hashes);
+  }
+}
+
+inline __m512i Hashing64::Round_avx512(__m512i acc, __m512i input) {
+  acc = _mm512_add_epi64(acc, _mm512_mullo_epi64(input, _mm512_set1_epi64(PRIME64_2)));
+  acc = _mm512_rol_epi64(acc, 31);
+  acc = _mm512_mullo_epi64(acc, _mm512_set1_epi64(PRIME64_1));
+  return acc;
+}
+
+inline __m512i Hashing64::CombineAccumulatorsAndAvalanche_avx512(__m512i acc) {
+  // Each 256-bit half of input represents a set of 4 accumulators related to
+  // a single hash. The resulting hash is replicated in all elements of the half.
+  //
+  __m512i rotated = _mm512_rolv_epi64(acc, _mm512_setr_epi64(1, 7, 12, 18, 1, 7, 12, 18));
+  __m512i hash = _mm512_add_epi64(rotated, _mm512_shuffle_epi32(rotated, _MM_PERM_BADC));
+  hash = _mm512_add_epi64(hash, _mm512_shuffle_i64x2(hash, hash, _MM_PERM_CDAB));
+
+  __m512i rounds = Round_avx512(_mm512_setzero_si512(), acc);
+  for (int k = 0; k < 4; ++k) {
+    __m512i round = _mm512_permutexvar_epi64(
+        _mm512_setr_epi64(k, k, k, k, 4 + k, 4 + k, 4 + k, 4 + k), rounds);
+    hash = _mm512_xor_si512(hash, round);
+    hash = _mm512_mullo_epi64(hash, _mm512_set1_epi64(PRIME64_1));
+    hash = _mm512_add_epi64(hash, _mm512_set1_epi64(PRIME64_4));
+  }
+
+  hash = _mm512_xor_si512(hash, _mm512_srli_epi64(hash, 33));
+  hash = _mm512_mullo_epi64(hash, _mm512_set1_epi64(PRIME64_2));
+  hash = _mm512_xor_si512(hash, _mm512_srli_epi64(hash, 29));
+  hash = _mm512_mullo_epi64(hash, _mm512_set1_epi64(PRIME64_3));
+  hash = _mm512_xor_si512(hash, _mm512_srli_epi64(hash, 32));
+  return hash;
+}
+
+template <bool two_equal_lengths>
+inline __m512i Hashing64::ProcessStripes_avx512(const uint8_t* const* keys,
+                                                const uint64_t* lengths) {
+  constexpr int kNumKeys = 2;
+  const uint64_t acc1 = PRIME64_1 + (PRIME64_2 & ~(1ULL << 63));
+  const uint64_t acc4 = static_cast<uint64_t>(-static_cast<int64_t>(PRIME64_1));
+  __m512i acc = _mm512_setr_epi64(acc1, PRIME64_2, 0, acc4, acc1, PRIME64_2, 0, acc4);
+
+  // An empty key is hashed as a single stripe of zeroes
+  int64_t num_stripes[kNumKeys];
+  for (int k = 0; k < kNumKeys; ++k) {
+    uint64_t length = lengths[two_equal_lengths ? 0 : k];
+    num_stripes[k] = std::max<int64_t>(1, bit_util::CeilDiv(length, kStripeSize));
+  }
+  int64_t max_num_stripes = std::max(num_stripes[0], num_stripes[1]);
+
+  for (int64_t istripe = 0; istripe < max_num_stripes; ++istripe) {
+    __m256i stripes[kNumKeys];
+    __mmask8 active = 0;
+    for (int k = 0; k < kNumKeys; ++k) {
+      int64_t num_bytes =
+          StripeBytes(lengths[two_equal_lengths ? 0 : k], istripe, kStripeSize);
+      stripes[k] =
+          _mm256_maskz_loadu_epi8(static_cast<__mmask32>((1ULL << num_bytes) - 1),
+                                  keys[k] + istripe * kStripeSize);
+      if (istripe < num_stripes[k]) {
+        active |= static_cast<__mmask8>(0xf << (4 * k));
+      }
+    }
+    __m512i stripe =
+        _mm512_inserti64x4(_mm512_castsi256_si512(stripes[0]), stripes[1], 1);
+    // Keys that ran out of stripes keep their accumulators
+    acc = _mm512_mask_mov_epi64(acc, active, Round_avx512(acc, stripe));
+  }
+  return acc;
+}
+
+template <bool T_COMBINE_HASHES>
+uint32_t Hashing64::HashFixedLenImp_avx512(uint32_t num_rows, uint64_t length,
+                                           const uint8_t* keys, uint64_t* hashes) {
+  constexpr int unroll = 2;
+  uint32_t num_rows_to_process = num_rows - num_rows % unroll;
+
+  for (uint32_t i = 0; i < num_rows_to_process; i += unroll) {
+    const uint8_t* key_ptrs[unroll] = {keys + static_cast<uint64_t>(i) * length,
+                                       keys + static_cast<uint64_t>(i + 1) * length};
+    __m512i acc = ProcessStripes_avx512</*two_equal_lengths=*/true>(key_ptrs, &length);
+    __m512i hash = CombineAccumulatorsAndAvalanche_avx512(acc);
+    uint64_t hash_A = _mm_cvtsi128_si64(_mm512_castsi512_si128(hash));
+    uint64_t hash_B = _mm_cvtsi128_si64(_mm512_extracti64x2_epi64(hash, 2));
+    if (T_COMBINE_HASHES) {
+      hashes[i] = CombineHashesImp(hashes[i], hash_A);
+      hashes[i + 1] = CombineHashesImp(hashes[i + 1], hash_B);
+    } else {
+      hashes[i] = hash_A;
+      hashes[i + 1] = hash_B;
+    }
+  }
+
+  return num_rows_to_process;
+}
+
+uint32_t Hashing64::HashFixedLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                        uint64_t length, const uint8_t* keys,
+                                        uint64_t* hashes) {
+  if (combine_hashes) {
+    return HashFixedLenImp_avx512<true>(num_rows, length, keys, hashes);
+  } else {
+    return HashFixedLenImp_avx512<false>(num_rows, length, keys, hashes);
+  }
+}
+
+template <typename T, bool T_COMBINE_HASHES>
+uint32_t Hashing64::HashVarLenImp_avx512(uint32_t num_rows, const T* offsets,
+                                         const uint8_t* concatenated_keys,
+                                         uint64_t* hashes) {
+  constexpr int unroll = 2;
+  uint32_t num_rows_to_process = num_rows - num_rows % unroll;
+
+  for (uint32_t i = 0; i < num_rows_to_process; i += unroll) {
+    const uint8_t* key_ptrs[unroll] = {concatenated_keys + offsets[i],
+                                       concatenated_keys + offsets[i + 1]};
+    uint64_t lengths[unroll] = {static_cast<uint64_t>(offsets[i + 1] - offsets[i]),
+                                static_cast<uint64_t>(offsets[i + 2] - offsets[i + 1])};
+    __m512i acc = ProcessStripes_avx512</*two_equal_lengths=*/false>(key_ptrs, lengths);
+    __m512i hash = CombineAccumulatorsAndAvalanche_avx512(acc);
+    uint64_t hash_A = _mm_cvtsi128_si64(_mm512_castsi512_si128(hash));
+    uint64_t hash_B = _mm_cvtsi128_si64(_mm512_extracti64x2_epi64(hash, 2));
+    if (T_COMBINE_HASHES) {
+      hashes[i] = CombineHashesImp(hashes[i], hash_A);
+      hashes[i + 1] = CombineHashesImp(hashes[i + 1], hash_B);
+    } else {
+      hashes[i] = hash_A;
+      hashes[i + 1] = hash_B;
+    }
+  }
+
+  return num_rows_to_process;
+}
+
+uint32_t Hashing64::HashVarLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                      const uint32_t* offsets,
+                                      const uint8_t* concatenated_keys,
+                                      uint64_t* hashes) {
+  if (combine_hashes) {
+    return HashVarLenImp_avx512<uint32_t, true>(num_rows, offsets, concatenated_keys,
+                                                hashes);
+  } else {
+    return HashVarLenImp_avx512<uint32_t, false>(num_rows, offsets, concatenated_keys,
+                                                 hashes);
+  }
+}
+
+uint32_t Hashing64::HashVarLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                      const uint64_t* offsets,
+                                      const uint8_t* concatenated_keys,
+                                      uint64_t* hashes) {
+  if (combine_hashes) {
+    return HashVarLenImp_avx512<uint64_t, true>(num_rows, offsets, concatenated_keys,
+                                                hashes);
+  } else {
+    return HashVarLenImp_avx512<uint64_t, false>(num_rows, offsets, concatenated_keys,
+                                                 hashes);
+  }
+}
+
+#endif
+
+}  // namespace compute
+}  // namespace arrow
@@ -130,57 +130,62 @@ class TestVectorHash {
     hashes_simd64.resize(num_rows);
 
     int64_t hardware_flags_scalar = 0LL;
-    int64_t hardware_flags_simd = ::arrow::internal::CpuInfo::AVX2;
+    std::vector<int64_t> hardware_flags_simd = {::arrow::internal::CpuInfo::AVX2};
+    if (::arrow::internal::CpuInfo::GetInstance()->IsSupported(
+            ::arrow::internal::CpuInfo::AVX512)) {
+      hardware_flags_simd.push_back(::arrow::internal::CpuInfo::AVX512);
+    }
 
     constexpr int mini_batch_size = 1024;
     std::vector<uint32_t> temp_buffer;
     temp_buffer.resize(mini_batch_size * 4);
 
-    for (bool use_simd : {false, true}) {
+    auto compute_hashes = [&](int64_t hardware_flags, bool combine_hashes,
+                              uint32_t* hashes32, uint64_t* hashes64) {
       if (use_32bit_hash) {
-        if (!use_varlen_input) {
-          Hashing32::HashFixed(use_simd ? hardware_flags_simd : hardware_flags_scalar,
-                               /*combine_hashes=*/false, num_rows, fixed_length, keys,
-                               use_simd ? hashes_simd32.data() : hashes_scalar32.data(),
-                               temp_buffer.data());
-        } else {
-          for (int first_row = 0; first_row < num_rows;) {
-            int batch_size_next = std::min(num_rows - first_row, mini_batch_size);
-
-            Hashing32::HashVarLen(
-                use_simd ? hardware_flags_simd : hardware_flags_scalar,
-                /*combine_hashes=*/false, batch_size_next, key_offsets + first_row, keys,
-                (use_simd ? hashes_simd32.data() : hashes_scalar32.data()) + first_row,
-                temp_buffer.data());
-
-            first_row += batch_size_next;
+        // The temporary buffer for combining hashes only covers a mini batch
+        for (int first_row = 0; first_row < num_rows;) {
+          int batch_size_next = std::min(num_rows - first_row, mini_batch_size);
+
+          if (!use_varlen_input) {
+            Hashing32::HashFixed(hardware_flags, combine_hashes, batch_size_next,
+                                 fixed_length, keys + first_row * fixed_length,
+                                 hashes32 + first_row, temp_buffer.data());
+          } else {
+            Hashing32::HashVarLen(hardware_flags, combine_hashes, batch_size_next,
+                                  key_offsets + first_row, keys, hashes32 + first_row,
+                                  temp_buffer.data());
           }
+
+          first_row += batch_size_next;
+        }
+        for (int i = 0; i < num_rows; ++i) {
+          hashes64[i] = hashes32[i];
         }
       } else {
         if (!use_varlen_input) {
-          Hashing64::HashFixed(
-              /*combine_hashes=*/false, num_rows, fixed_length, keys,
-              use_simd ? hashes_simd64.data() : hashes_scalar64.data());
+          Hashing64::HashFixed(hardware_flags, combine_hashes, num_rows, fixed_length,
+                               keys, hashes64);
         } else {
-          Hashing64::HashVarLen(
-              /*combine_hashes=*/false, num_rows, key_offsets, keys,
-              use_simd ? hashes_simd64.data() : hashes_scalar64.data());
+          Hashing64::HashVarLen(hardware_flags, combine_hashes, num_rows, key_offsets,
+                                keys, hashes64);
         }
       }
-    }
+    };
 
-    if (use_32bit_hash) {
-      for (int i = 0; i < num_rows; ++i) {
-        hashes_scalar64[i] = hashes_scalar32[i];
-        hashes_simd64[i] = hashes_simd32[i];
-      }
-    }
+    compute_hashes(hardware_flags_scalar, /*combine_hashes=*/false,
+                   hashes_scalar32.data(), hashes_scalar64.data());
 
-    // Verify that both scalar and AVX2 implementations give the same hashes
+    // Verify that both scalar and SIMD implementations give the same hashes
     //
-    for (int i = 0; i < num_rows; ++i) {
-      ASSERT_EQ(hashes_scalar64[i], hashes_simd64[i])
-          << "scalar and simd approaches yielded different hashes";
+    for (int64_t hardware_flags : hardware_flags_simd) {
+      SCOPED_TRACE("hardware_flags = " + std::to_string(hardware_flags));
+      compute_hashes(hardware_flags, /*combine_hashes=*/false, hashes_simd32.data(),
+                     hashes_simd64.data());
+      for (int i = 0; i < num_rows; ++i) {
+        ASSERT_EQ(hashes_scalar64[i], hashes_simd64[i])
+            << "scalar and simd approaches yielded different hashes";
+      }
     }
 
     // Verify that the same key appearing multiple times generates the same hash
@@ -205,6 +210,24 @@ class TestVectorHash {
         static_cast<float>(num_unique);
     SCOPED_TRACE("percent_hash_collisions " + std::to_string(percent_hash_collisions));
     ASSERT_LT(percent_hash_collisions, 5.0f) << "hash collision rate was too high";
+
+    // Verify that combining with the hashes of a previous column matches as well
+    //
+    std::vector<uint32_t> hashes_previous32 = hashes_scalar32;
+    std::vector<uint64_t> hashes_previous64 = hashes_scalar64;
+    compute_hashes(hardware_flags_scalar, /*combine_hashes=*/true, hashes_scalar32.data(),
+                   hashes_scalar64.data());
+    for (int64_t hardware_flags : hardware_flags_simd) {
+      SCOPED_TRACE("combined, hardware_flags = " + std::to_string(hardware_flags));
+      hashes_simd32 = hashes_previous32;
+      hashes_simd64 = hashes_previous64;
+      compute_hashes(hardware_flags, /*combine_hashes=*/true, hashes_simd32.data(),
+                     hashes_simd64.data());
+      for (int i = 0; i < num_rows; ++i) {
+        ASSERT_EQ(hashes_scalar64[i], hashes_simd64[i])
+            << "scalar and simd approaches yielded different combined hashes";
+      }
+    }
   }
 };
 
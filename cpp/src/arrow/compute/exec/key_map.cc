@@ -149,6 +149,16 @@ void SwissTable::extract_group_ids(const int num_keys, const uint16_t* optional_
 
   // Optimistically use simplified lookup involving only a start block to find
   // a single group id candidate for every input.
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if ((hardware_flags_ & arrow::internal::CpuInfo::AVX512) ==
+      arrow::internal::CpuInfo::AVX512) {
+    int num_group_id_bytes = num_group_id_bits / 8;
+    extract_group_ids_avx512(num_keys, optional_selection, hashes, local_slots,
+                             out_group_ids, sizeof(uint64_t), 8 + 8 * num_group_id_bytes,
+                             num_group_id_bytes);
+    return;
+  }
+#endif
 #if defined(ARROW_HAVE_AVX2)
   int num_group_id_bytes = num_group_id_bits / 8;
   if ((hardware_flags_ & arrow::internal::CpuInfo::AVX2) && !optional_selection) {
@@ -312,6 +322,16 @@ void SwissTable::early_filter(const int num_keys, const uint32_t* hashes,
                               uint8_t* out_local_slots) const {
   // Optimistically use simplified lookup involving only a start block to find
   // a single group id candidate for every input.
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  // Small tables are left to the AVX2 version below, which keeps all the blocks in
+  // registers instead of gathering them.
+  if ((hardware_flags_ & arrow::internal::CpuInfo::AVX512) ==
+          arrow::internal::CpuInfo::AVX512 &&
+      (log_blocks_ > 4 || !(hardware_flags_ & arrow::internal::CpuInfo::AVX2))) {
+    early_filter_imp_avx512_x8(num_keys, hashes, out_match_bitvector, out_local_slots);
+    return;
+  }
+#endif
 #if defined(ARROW_HAVE_AVX2)
   if (hardware_flags_ & arrow::internal::CpuInfo::AVX2) {
     if (log_blocks_ <= 4) {
@@ -348,7 +368,8 @@ void SwissTable::run_comparisons(const int num_keys,
                                  const uint16_t* optional_selection_ids,
                                  const uint8_t* optional_selection_bitvector,
                                  const uint32_t* groupids, int* out_num_not_equal,
-                                 uint16_t* out_not_equal_selection) const {
+                                 uint16_t* out_not_equal_selection,
+                                 const EqualImpl& equal_impl) const {
   ARROW_DCHECK(optional_selection_ids || optional_selection_bitvector);
   ARROW_DCHECK(!optional_selection_ids || !optional_selection_bitvector);
 
@@ -368,20 +389,20 @@ void SwissTable::run_comparisons(const int num_keys,
 
     if (num_inserted_ > 0 && num_matches > 0 && num_matches > 3 * num_keys / 4) {
       uint32_t out_num;
-      equal_impl_(num_keys, nullptr, groupids, &out_num, out_not_equal_selection);
+      equal_impl(num_keys, nullptr, groupids, &out_num, out_not_equal_selection);
       *out_num_not_equal = static_cast<int>(out_num);
     } else {
       util::bit_util::bits_to_indexes(1, hardware_flags_, num_keys,
                                       optional_selection_bitvector, out_num_not_equal,
                                       out_not_equal_selection);
       uint32_t out_num;
-      equal_impl_(*out_num_not_equal, out_not_equal_selection, groupids, &out_num,
+      equal_impl(*out_num_not_equal, out_not_equal_selection, groupids, &out_num,
                   out_not_equal_selection);
       *out_num_not_equal = static_cast<int>(out_num);
     }
   } else {
     uint32_t out_num;
-    equal_impl_(num_keys, optional_selection_ids, groupids, &out_num,
+    equal_impl(num_keys, optional_selection_ids, groupids, &out_num,
                 out_not_equal_selection);
     *out_num_not_equal = static_cast<int>(out_num);
   }
@@ -472,6 +493,14 @@ void SwissTable::insert_into_empty_slot(uint32_t slot_id, uint32_t hash,
 void SwissTable::find(const int num_keys, const uint32_t* hashes,
                       uint8_t* inout_match_bitvector, const uint8_t* local_slots,
                       uint32_t* out_group_ids) const {
+  find(num_keys, hashes, inout_match_bitvector, local_slots, out_group_ids, temp_stack_,
+       equal_impl_);
+}
+
+void SwissTable::find(const int num_keys, const uint32_t* hashes,
+                      uint8_t* inout_match_bitvector, const uint8_t* local_slots,
+                      uint32_t* out_group_ids, util::TempVectorStack* temp_stack,
+                      const EqualImpl& equal_impl) const {
   // Temporary selection vector.
   // It will hold ids of keys for which we do not know yet
   // if they have a match in hash table or not.
@@ -481,7 +510,7 @@ void SwissTable::find(const int num_keys, const uint32_t* hashes,
   // to array of ids.
   //
   ARROW_DCHECK(num_keys <= (1 << log_minibatch_));
-  auto ids_buf = util::TempVectorHolder<uint16_t>(temp_stack_, num_keys);
+  auto ids_buf = util::TempVectorHolder<uint16_t>(temp_stack, num_keys);
   uint16_t* ids = ids_buf.mutable_data();
   int num_ids;
 
@@ -498,19 +527,19 @@ void SwissTable::find(const int num_keys, const uint32_t* hashes,
   if (visit_all) {
     extract_group_ids(num_keys, nullptr, hashes, local_slots, out_group_ids);
     run_comparisons(num_keys, nullptr, inout_match_bitvector, out_group_ids, &num_ids,
-                    ids);
+                    ids, equal_impl);
   } else {
     util::bit_util::bits_to_indexes(1, hardware_flags_, num_keys, inout_match_bitvector,
                                     &num_ids, ids);
     extract_group_ids(num_ids, ids, hashes, local_slots, out_group_ids);
-    run_comparisons(num_ids, ids, nullptr, out_group_ids, &num_ids, ids);
+    run_comparisons(num_ids, ids, nullptr, out_group_ids, &num_ids, ids, equal_impl);
   }
 
   if (num_ids == 0) {
     return;
   }
 
-  auto slot_ids_buf = util::TempVectorHolder<uint32_t>(temp_stack_, num_keys);
+  auto slot_ids_buf = util::TempVectorHolder<uint32_t>(temp_stack, num_keys);
   uint32_t* slot_ids = slot_ids_buf.mutable_data();
   init_slot_ids(num_ids, ids, hashes, local_slots, inout_match_bitvector, slot_ids);
 
@@ -531,7 +560,7 @@ void SwissTable::find(const int num_keys, const uint32_t* hashes,
       }
     }
 
-    run_comparisons(num_ids, ids, nullptr, out_group_ids, &num_ids, ids);
+    run_comparisons(num_ids, ids, nullptr, out_group_ids, &num_ids, ids, equal_impl);
   }
 }  // namespace compute
 
@@ -610,7 +639,7 @@ Status SwissTable::map_new_keys_helper(const uint32_t* hashes,
   util::bit_util::bits_filter_indexes(1, hardware_flags_, num_processed, match_bitvector,
                                       inout_selection, &num_temp_ids, temp_ids);
   run_comparisons(num_temp_ids, temp_ids, nullptr, out_group_ids, &num_temp_ids,
-                  temp_ids);
+                  temp_ids, equal_impl_);
 
   memcpy(inout_selection, temp_ids, sizeof(uint16_t) * num_temp_ids);
   // Append ids of any unprocessed entries if we aborted processing due to the need
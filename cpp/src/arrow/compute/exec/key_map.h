@@ -49,6 +49,16 @@ class SwissTable {
   void find(const int num_keys, const uint32_t* hashes, uint8_t* inout_match_bitvector,
             const uint8_t* local_slots, uint32_t* out_group_ids) const;
 
+  /// \brief Variant of find() that does not touch any mutable state of the table.
+  ///
+  /// Temporary buffers are allocated from the given stack and keys are compared with
+  /// the given comparison function instead of the ones provided to init().  Several
+  /// threads may therefore call it concurrently on the same table, as long as each
+  /// passes its own stack and nothing is inserted in the meantime.
+  void find(const int num_keys, const uint32_t* hashes, uint8_t* inout_match_bitvector,
+            const uint8_t* local_slots, uint32_t* out_group_ids,
+            util::TempVectorStack* temp_stack, const EqualImpl& equal_impl) const;
+
   Status map_new_keys(uint32_t num_ids, uint16_t* ids, const uint32_t* hashes,
                       uint32_t* group_ids);
 
@@ -126,11 +136,21 @@ class SwissTable {
                               const uint8_t* local_slots, uint32_t* out_group_ids,
                               int byte_offset, int byte_multiplier, int byte_size) const;
 #endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  void early_filter_imp_avx512_x8(const int num_hashes, const uint32_t* hashes,
+                                  uint8_t* out_match_bitvector,
+                                  uint8_t* out_local_slots) const;
+  void extract_group_ids_avx512(const int num_keys, const uint16_t* optional_selection,
+                                const uint32_t* hashes, const uint8_t* local_slots,
+                                uint32_t* out_group_ids, int byte_offset,
+                                int byte_multiplier, int byte_size) const;
+#endif
 
   void run_comparisons(const int num_keys, const uint16_t* optional_selection_ids,
                        const uint8_t* optional_selection_bitvector,
                        const uint32_t* groupids, int* out_num_not_equal,
-                       uint16_t* out_not_equal_selection) const;
+                       uint16_t* out_not_equal_selection,
+                       const EqualImpl& equal_impl) const;
 
   inline bool find_next_stamp_match(const uint32_t hash, const uint32_t in_slot_id,
                                     uint32_t* out_slot_id, uint32_t* out_group_id) const;
@@ -0,0 +1,144 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "arrow/compute/exec/key_map.h"
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+namespace compute {
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+
+// Unlike the AVX2 versions, these use masked loads, gathers and stores for the last
+// (partial) group of inputs instead of processing garbage past the end of the buffers.
+//
+// This is a direct translation of the scalar search_block, with one 64-bit block of
+// slot status bytes per 64-bit lane. AVX-512 has a leading zero count instruction for
+// 64-bit lanes, so unlike the AVX2 version no emulation is needed.
+//
+void SwissTable::early_filter_imp_avx512_x8(const int num_hashes, const uint32_t* hashes,
+                                            uint8_t* out_match_bitvector,
+                                            uint8_t* out_local_slots) const {
+  // Number of inputs processed together in a loop
+  constexpr int unroll = 8;
+  constexpr uint64_t kHighBitOfEachByte = 0x8080808080808080ULL;
+
+  const int num_group_id_bits = num_groupid_bits_from_log_blocks(log_blocks_);
+  const __m512i vblock_bytes = _mm512_set1_epi64(num_group_id_bits + 8);
+  const __m512i vhigh_bits = _mm512_set1_epi64(kHighBitOfEachByte);
+  const __m256i vstamp_mask = _mm256_set1_epi32((1 << bits_stamp_) - 1);
+
+  for (int i = 0; i < static_cast<int>(bit_util::CeilDiv(num_hashes, unroll)); ++i) {
+    int num_left = num_hashes - i * unroll;
+    __mmask8 mask =
+        num_left >= unroll ? 0xff : static_cast<__mmask8>((1 << num_left) - 1);
+
+    // Calculate block index and hash stamp
+    //
+    __m256i vhash = _mm256_maskz_loadu_epi32(mask, hashes + i * unroll);
+    __m256i vblock_id = _mm256_srlv_epi32(
+        vhash, _mm256_set1_epi32(bits_hash_ - bits_stamp_ - log_blocks_));
+    __m512i vstamp = _mm512_cvtepu32_epi64(_mm256_and_si256(vblock_id, vstamp_mask));
+    vblock_id = _mm256_srli_epi32(vblock_id, bits_stamp_);
+
+    __m512i vblock_offset =
+        _mm512_mullo_epi64(_mm512_cvtepu32_epi64(vblock_id), vblock_bytes);
+    __m512i vblock = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), mask,
+                                                 vblock_offset, blocks_, 1);
+
+    // Replicate 7-bit stamp to all non-empty slots, leaving zeroes for empty slots.
+    __m512i vblock_high_bits = _mm512_and_si512(vblock, vhigh_bits);
+    __m512i vstamp_pattern = _mm512_mullo_epi64(
+        vstamp, _mm512_srli_epi64(_mm512_xor_si512(vblock_high_bits, vhigh_bits), 7));
+
+    // The highest bit of each byte tells us if we have a match (0) or not (1).
+    __m512i vmatch_base =
+        _mm512_add_epi64(_mm512_xor_si512(vblock, vstamp_pattern),
+                         _mm512_set1_epi64(~kHighBitOfEachByte));
+    __m512i vmatches = _mm512_andnot_si512(vmatch_base, vhigh_bits);
+
+    // In case when there are no matches in slots and the block is full (no empty slots),
+    // pretend that there is a match in the last slot.
+    //
+    vmatches = _mm512_or_si512(
+        vmatches, _mm512_andnot_si512(vblock_high_bits, _mm512_set1_epi64(0x80)));
+
+    __mmask8 match_found = _mm512_test_epi64_mask(vmatches, vmatches);
+    __m512i vlocal_slot = _mm512_srli_epi64(
+        _mm512_lzcnt_epi64(_mm512_or_si512(vmatches, vblock_high_bits)), 3);
+
+    out_match_bitvector[i] = static_cast<uint8_t>(match_found & mask);
+    _mm_mask_storeu_epi8(out_local_slots + i * unroll, mask,
+                         _mm512_cvtepi64_epi8(vlocal_slot));
+  }
+}
+
+void SwissTable::extract_group_ids_avx512(const int num_keys,
+                                          const uint16_t* optional_selection,
+                                          const uint32_t* hashes,
+                                          const uint8_t* local_slots,
+                                          uint32_t* out_group_ids, int byte_offset,
+                                          int byte_multiplier, int byte_size) const {
+  ARROW_DCHECK(byte_size == 1 || byte_size == 2 || byte_size == 4);
+  uint32_t mask = byte_size == 1 ? 0xFF : byte_size == 2 ? 0xFFFF : 0xFFFFFFFF;
+  const uint8_t* elements = blocks_ + byte_offset;
+  constexpr int unroll = 16;
+
+  for (int i = 0; i < static_cast<int>(bit_util::CeilDiv(num_keys, unroll)); ++i) {
+    int num_left = num_keys - i * unroll;
+    __mmask16 keys_mask =
+        num_left >= unroll ? 0xffff : static_cast<__mmask16>((1 << num_left) - 1);
+
+    __m512i id, hash, local_slot;
+    if (optional_selection) {
+      id = _mm512_cvtepu16_epi32(
+          _mm256_maskz_loadu_epi16(keys_mask, optional_selection + i * unroll));
+      hash =
+          _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), keys_mask, id, hashes, 4);
+      local_slot = _mm512_and_si512(
+          _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), keys_mask, id, local_slots,
+                                      1),
+          _mm512_set1_epi32(0xff));
+    } else {
+      hash = _mm512_maskz_loadu_epi32(keys_mask, hashes + i * unroll);
+      local_slot = _mm512_cvtepu8_epi32(
+          _mm_maskz_loadu_epi8(keys_mask, local_slots + i * unroll));
+    }
+
+    // For a single block the shift is by 32 bits, which yields zero block index
+    __m512i pos = _mm512_srlv_epi32(hash, _mm512_set1_epi32(bits_hash_ - log_blocks_));
+    pos = _mm512_mullo_epi32(pos, _mm512_set1_epi32(byte_multiplier));
+    pos = _mm512_add_epi32(pos,
+                           _mm512_mullo_epi32(local_slot, _mm512_set1_epi32(byte_size)));
+    __m512i group_id = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), keys_mask,
+                                                   pos, elements, 1);
+    group_id = _mm512_and_si512(group_id, _mm512_set1_epi32(mask));
+
+    if (optional_selection) {
+      _mm512_mask_i32scatter_epi32(out_group_ids, keys_mask, id, group_id, 4);
+    } else {
+      _mm512_mask_storeu_epi32(out_group_ids + i * unroll, keys_mask, group_id);
+    }
+  }
+}
+
+#endif
+
+}  // namespace compute
+}  // namespace arrow
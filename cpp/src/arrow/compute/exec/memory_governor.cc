@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/exec/memory_governor.h"
+
+#include <algorithm>
+
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace compute {
+
+MemoryReservation::~MemoryReservation() { Release(); }
+
+MemoryReservation::MemoryReservation(MemoryReservation&& other) noexcept
+    : governor_(other.governor_), bytes_(other.bytes_) {
+  other.governor_ = NULLPTR;
+  other.bytes_ = 0;
+}
+
+MemoryReservation& MemoryReservation::operator=(MemoryReservation&& other) noexcept {
+  if (this != &other) {
+    Release();
+    governor_ = other.governor_;
+    bytes_ = other.bytes_;
+    other.governor_ = NULLPTR;
+    other.bytes_ = 0;
+  }
+  return *this;
+}
+
+void MemoryReservation::Release() {
+  if (governor_ != NULLPTR) {
+    governor_->Release(bytes_);
+    governor_ = NULLPTR;
+    bytes_ = 0;
+  }
+}
+
+MemoryGovernor::MemoryGovernor(MemoryPool* pool, int64_t memory_limit)
+    : pool_(pool), memory_limit_(memory_limit) {
+  DCHECK_GT(memory_limit, 0);
+}
+
+int64_t MemoryGovernor::bytes_reserved() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return bytes_reserved_;
+}
+
+MemoryReservation MemoryGovernor::Reserve(int64_t bytes) {
+  DCHECK_GE(bytes, 0);
+  // Every reservation gets at least this much, even once the limit is fully reserved
+  const int64_t min_grant = std::min(bytes, std::max<int64_t>(memory_limit_ / 16, 1));
+  std::lock_guard<std::mutex> lock(mutex_);
+  int64_t unreserved = std::max<int64_t>(memory_limit_ - bytes_reserved_, 0);
+  int64_t granted = std::max(std::min(bytes, unreserved), min_grant);
+  bytes_reserved_ += granted;
+  return MemoryReservation(this, granted);
+}
+
+void MemoryGovernor::Release(int64_t bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  bytes_reserved_ -= bytes;
+  DCHECK_GE(bytes_reserved_, 0);
+}
+
+}  // namespace compute
+}  // namespace arrow
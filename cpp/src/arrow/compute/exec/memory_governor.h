@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+
+#include "arrow/memory_pool.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class MemoryGovernor;
+
+/// \brief A share of a MemoryGovernor's limit, returned to the governor on destruction
+class ARROW_EXPORT MemoryReservation {
+ public:
+  MemoryReservation() = default;
+  ~MemoryReservation();
+
+  MemoryReservation(MemoryReservation&& other) noexcept;
+  MemoryReservation& operator=(MemoryReservation&& other) noexcept;
+  MemoryReservation(const MemoryReservation&) = delete;
+  MemoryReservation& operator=(const MemoryReservation&) = delete;
+
+  /// \brief The number of bytes granted, which may be less than requested
+  int64_t bytes() const { return bytes_; }
+
+  /// \brief Return the reserved bytes to the governor
+  void Release();
+
+ private:
+  friend class MemoryGovernor;
+  MemoryReservation(MemoryGovernor* governor, int64_t bytes)
+      : governor_(governor), bytes_(bytes) {}
+
+  MemoryGovernor* governor_ = NULLPTR;
+  int64_t bytes_ = 0;
+};
+
+/// \brief Bounds the memory used by the nodes of an ExecPlan
+///
+/// The governor owns a memory pool which tracks every allocation made through it.  An
+/// ExecPlan made with a governor uses this pool for its ExecContext, and nodes consult
+/// the governor in two ways:
+///
+/// - Sources stop running ahead of the rest of the plan while the pool holds more than
+///   the limit: before producing another batch they wait for the batches they already
+///   produced to be consumed.
+/// - Nodes which can spill reserve their spilling budget from the governor.  The
+///   reservations share the limit, so when several such nodes run at once each may be
+///   granted less than it asked for and will spill sooner.  The hash join also starts
+///   spilling as soon as the pool exceeds the limit.
+///
+/// The limit is soft: allocations never fail because of it.  A governor is meant to be
+/// used by a single plan at a time, and must outlive the buffers allocated from it.
+class ARROW_EXPORT MemoryGovernor {
+ public:
+  /// \brief Make a governor for at most `memory_limit` bytes allocated from `pool`
+  MemoryGovernor(MemoryPool* pool, int64_t memory_limit);
+
+  /// \brief The tracking pool which all allocations of the plan should use
+  MemoryPool* memory_pool() { return &pool_; }
+
+  int64_t memory_limit() const { return memory_limit_; }
+
+  /// \brief Bytes currently allocated through memory_pool()
+  int64_t bytes_allocated() const { return pool_.bytes_allocated(); }
+
+  /// \brief Whether more than the limit is currently allocated
+  bool exceeded() const { return bytes_allocated() > memory_limit_; }
+
+  /// \brief Total size of the outstanding reservations
+  int64_t bytes_reserved() const;
+
+  /// \brief Reserve up to `bytes` of the limit
+  ///
+  /// If less than `bytes` is unreserved the reservation is shrunk to what remains, but
+  /// never below a small fraction of the limit so that latecomers are still able to
+  /// make progress.
+  MemoryReservation Reserve(int64_t bytes);
+
+ private:
+  friend class MemoryReservation;
+  void Release(int64_t bytes);
+
+  ProxyMemoryPool pool_;
+  const int64_t memory_limit_;
+  mutable std::mutex mutex_;
+  int64_t bytes_reserved_ = 0;
+};
+
+}  // namespace compute
+}  // namespace arrow
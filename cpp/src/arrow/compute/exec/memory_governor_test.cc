@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include "arrow/api.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/memory_governor.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace compute {
+
+TEST(MemoryGovernor, Reserve) {
+  MemoryGovernor governor(default_memory_pool(), 1600);
+  {
+    auto first = governor.Reserve(1000);
+    ASSERT_EQ(first.bytes(), 1000);
+    auto second = governor.Reserve(1000);
+    ASSERT_EQ(second.bytes(), 600);
+    // The limit is used up, but a small share is still granted
+    auto third = governor.Reserve(1000);
+    ASSERT_EQ(third.bytes(), 100);
+    ASSERT_EQ(governor.Reserve(10).bytes(), 10);
+    ASSERT_EQ(governor.bytes_reserved(), 1700);
+
+    second.Release();
+    ASSERT_EQ(second.bytes(), 0);
+    ASSERT_EQ(governor.bytes_reserved(), 1100);
+
+    MemoryReservation moved = std::move(first);
+    ASSERT_EQ(moved.bytes(), 1000);
+    ASSERT_EQ(first.bytes(), 0);
+    ASSERT_EQ(governor.bytes_reserved(), 1100);
+    moved = governor.Reserve(0);
+    ASSERT_EQ(governor.bytes_reserved(), 100);
+  }
+  ASSERT_EQ(governor.bytes_reserved(), 0);
+}
+
+TEST(MemoryGovernor, TracksAllocations) {
+  MemoryGovernor governor(default_memory_pool(), 1024);
+  ASSERT_FALSE(governor.exceeded());
+  ASSERT_OK_AND_ASSIGN(auto small, AllocateBuffer(512, governor.memory_pool()));
+  ASSERT_EQ(governor.bytes_allocated(), 512);
+  ASSERT_FALSE(governor.exceeded());
+  ASSERT_OK_AND_ASSIGN(auto large, AllocateBuffer(1024, governor.memory_pool()));
+  ASSERT_TRUE(governor.exceeded());
+  large.reset();
+  ASSERT_FALSE(governor.exceeded());
+  ASSERT_EQ(governor.bytes_allocated(), 512);
+}
+
+TEST(MemoryGovernor, PlanContext) {
+  ExecContext exec_ctx(default_memory_pool(), nullptr);
+  ASSERT_OK_AND_ASSIGN(auto unlimited, ExecPlan::Make(&exec_ctx));
+  ASSERT_EQ(unlimited->memory_governor(), nullptr);
+  ASSERT_EQ(unlimited->exec_context(), &exec_ctx);
+
+  MemoryGovernor governor(default_memory_pool(), 1 << 20);
+  exec_ctx.set_exec_chunksize(100);
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_ctx, &governor));
+  ASSERT_EQ(plan->memory_governor(), &governor);
+  ASSERT_EQ(plan->exec_context()->memory_pool(), governor.memory_pool());
+  ASSERT_EQ(plan->exec_context()->executor(), exec_ctx.executor());
+  ASSERT_EQ(plan->exec_context()->exec_chunksize(), 100);
+}
+
+// A plan which is always over its limit still runs to completion, with sources
+// throttled and spilling nodes sharing a small budget
+TEST(MemoryGovernor, SpillingPlanOverLimit) {
+  BatchesWithSchema input;
+  input.schema = schema({field("key", int32()), field("i64", int64())});
+  random::RandomArrayGenerator rng(42);
+  for (int i = 0; i < 64; ++i) {
+    input.batches.push_back(
+        ExecBatch::Make({rng.Int32(/*size=*/256, /*min=*/0, /*max=*/1000),
+                         rng.Int64(/*size=*/256, /*min=*/-100, /*max=*/100)})
+            .ValueOrDie());
+  }
+
+  auto run = [&](bool parallel,
+                 MemoryGovernor* governor) -> Result<std::shared_ptr<Table>> {
+    ExecContext exec_ctx(default_memory_pool(),
+                         parallel ? arrow::internal::GetCpuThreadPool() : nullptr);
+    ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make(&exec_ctx, governor));
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    AggregateNodeOptions aggregate_options{
+        /*aggregates=*/{{"hash_sum", nullptr, "i64", "sum(i64)"}}, /*keys=*/{"key"}};
+    aggregate_options.spill_memory_limit = 1 << 20;
+    OrderBySinkNodeOptions sink_options{SortOptions({SortKey("key")}), &sink_gen};
+    sink_options.spill_memory_limit = 1 << 20;
+    RETURN_NOT_OK(
+        Declaration::Sequence(
+            {
+                {"source",
+                 SourceNodeOptions{input.schema, input.gen(parallel, /*slow=*/false)}},
+                {"aggregate", std::move(aggregate_options)},
+                {"order_by_sink", std::move(sink_options)},
+            })
+            .AddToPlan(plan.get()));
+    auto output_schema = schema({field("sum(i64)", int64()), field("key", int32())});
+    auto collected = StartAndCollect(plan.get(), sink_gen);
+    ARROW_ASSIGN_OR_RAISE(auto batches, collected.result());
+    ARROW_ASSIGN_OR_RAISE(auto table, TableFromExecBatches(output_schema, batches));
+    return table->CombineChunks();
+  };
+
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "serial");
+    MemoryGovernor governor(default_memory_pool(), /*memory_limit=*/4096);
+    ASSERT_OK_AND_ASSIGN(auto expected, run(parallel, /*governor=*/nullptr));
+    ASSERT_OK_AND_ASSIGN(auto actual, run(parallel, &governor));
+    ASSERT_GT(governor.memory_pool()->max_memory(), governor.memory_limit());
+    ASSERT_EQ(governor.bytes_reserved(), 0);
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -48,6 +48,8 @@ std::string ToString(JoinType t) {
   std::abort();
 }
 
+constexpr int64_t WindowFrame::kUnbounded;
+
 Result<std::shared_ptr<SourceNodeOptions>> SourceNodeOptions::FromTable(
     const Table& table, arrow::internal::Executor* exc) {
   std::shared_ptr<RecordBatchReader> reader = std::make_shared<TableBatchReader>(table);
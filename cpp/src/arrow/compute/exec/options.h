@@ -26,6 +26,7 @@
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec/expression.h"
+#include "arrow/compute/exec/runtime_filter.h"
 #include "arrow/result.h"
 #include "arrow/util/async_generator.h"
 #include "arrow/util/async_util.h"
@@ -51,14 +52,23 @@ class ARROW_EXPORT ExecNodeOptions {
 class ARROW_EXPORT SourceNodeOptions : public ExecNodeOptions {
  public:
   SourceNodeOptions(std::shared_ptr<Schema> output_schema,
-                    std::function<Future<util::optional<ExecBatch>>()> generator)
-      : output_schema(std::move(output_schema)), generator(std::move(generator)) {}
+                    std::function<Future<util::optional<ExecBatch>>()> generator,
+                    std::shared_ptr<RuntimeFilterSet> runtime_filters = NULLPTR)
+      : output_schema(std::move(output_schema)),
+        generator(std::move(generator)),
+        runtime_filters(std::move(runtime_filters)) {}
 
   static Result<std::shared_ptr<SourceNodeOptions>> FromTable(const Table& table,
                                                               arrow::internal::Executor*);
 
   std::shared_ptr<Schema> output_schema;
   std::function<Future<util::optional<ExecBatch>>()> generator;
+  /// \brief Where the filters pushed down by hash joins are collected
+  ///
+  /// The source drops the rows of every batch it outputs which fail these filters.  A
+  /// producer of the generator can share this set to skip data which will be rejected,
+  /// as the dataset scan node does.  If null the source makes its own.
+  std::shared_ptr<RuntimeFilterSet> runtime_filters;
 };
 
 /// \brief An extended Source node which accepts a table
@@ -108,6 +118,55 @@ class ARROW_EXPORT ProjectNodeOptions : public ExecNodeOptions {
   bool async_mode;
 };
 
+/// \brief Make a node which skips the first `offset` rows passed through it and then
+/// forwards at most `count` rows.
+///
+/// Rows are counted in the order batches are received, which is only deterministic if
+/// the input delivers its batches in order.  Once `count` rows have been forwarded the
+/// node finishes its output and stops its input, so that upstream producers (such as
+/// a dataset scan) do not read any further.
+class ARROW_EXPORT FetchNodeOptions : public ExecNodeOptions {
+ public:
+  explicit FetchNodeOptions(int64_t offset, int64_t count)
+      : offset(offset), count(count) {}
+
+  int64_t offset;
+  int64_t count;
+};
+
+/// \brief Make a node which outputs the distinct combinations of `keys` (SELECT DISTINCT)
+///
+/// The output has the key columns only.  A row is emitted as soon as its keys are seen
+/// for the first time, rather than once the input is exhausted, so downstream nodes
+/// (such as a fetch node) receive the distinct rows while the input is still being
+/// read.  The node keeps the set of keys seen so far.  If `keys` is empty, all the
+/// input columns are keys.
+class ARROW_EXPORT DistinctNodeOptions : public ExecNodeOptions {
+ public:
+  explicit DistinctNodeOptions(std::vector<FieldRef> keys = {}) : keys(std::move(keys)) {}
+
+  // keys of the distinct rows
+  std::vector<FieldRef> keys;
+};
+
+/// \brief Make a node which hash partitions its input into `num_partitions` outputs
+///
+/// Rows with equal `keys` always go to the same output, so that each output can be
+/// consumed by an independent pipeline.  For instance a grouped aggregate attached to
+/// each output computes a disjoint set of groups, and the results only need to be
+/// unioned rather than merged.  The node must be given exactly `num_partitions`
+/// consumers; the i-th consumer added receives partition i.
+class ARROW_EXPORT ExchangeNodeOptions : public ExecNodeOptions {
+ public:
+  ExchangeNodeOptions(std::vector<FieldRef> keys, int num_partitions)
+      : keys(std::move(keys)), num_partitions(num_partitions) {}
+
+  // keys by which rows are partitioned
+  std::vector<FieldRef> keys;
+  // number of outputs
+  int num_partitions;
+};
+
 /// \brief Make a node which aggregates input batches, optionally grouped by keys.
 class ARROW_EXPORT AggregateNodeOptions : public ExecNodeOptions {
  public:
@@ -119,6 +178,105 @@ class ARROW_EXPORT AggregateNodeOptions : public ExecNodeOptions {
   std::vector<Aggregate> aggregates;
   // keys by which aggregations will be grouped
   std::vector<FieldRef> keys;
+  // maximum number of bytes of input to buffer in memory for a grouped aggregation.
+  // When positive, input rows are hash partitioned on the keys, partitions that
+  // outgrow their share of the limit are spilled to temporary Arrow IPC files (created
+  // under the system temporary directory, see TMPDIR) and the groups are aggregated
+  // one partition at a time.  Zero disables spilling.  Ignored when there are no keys.
+  //
+  // Spilling is not supported for dictionary-encoded keys or arguments.
+  int64_t spill_memory_limit = 0;
+  // if set, the input is assumed to be ordered on the keys (all rows of a group are
+  // contiguous, as when the input is sorted on the keys) and to be delivered in order.
+  // Each group is then output as soon as a row with different keys is seen, so only a
+  // single group is held in memory, instead of all groups being output once the input
+  // is finished.  An input found to be out of order is an error.  Ignored when there
+  // are no keys; cannot be combined with spilling.
+  bool streaming = false;
+};
+
+/// \brief The rows of a partition over which a window aggregate is computed
+///
+/// The frame of a row extends from `preceding` rows (or order key units) before it to
+/// `following` rows (or order key units) after it, kUnbounded meaning the start or end
+/// of the partition.  The default frame, like in SQL, covers the start of the partition
+/// up to the current row and its peers (rows with equal order key values), or the
+/// whole partition when there are no order keys.
+struct ARROW_EXPORT WindowFrame {
+  enum Units {
+    // bounds are numbers of rows
+    ROWS,
+    // bounds are distances between order key values, and peers of the current row are
+    // always part of its frame.  Bounds other than 0 and kUnbounded require a single
+    // numeric or temporal order key.
+    RANGE
+  };
+
+  static constexpr int64_t kUnbounded = -1;
+
+  explicit WindowFrame(Units units = RANGE, int64_t preceding = kUnbounded,
+                       int64_t following = 0)
+      : units(units), preceding(preceding), following(following) {}
+
+  Units units;
+  int64_t preceding;
+  int64_t following;
+};
+
+/// \brief A function computed by the window node
+struct ARROW_EXPORT WindowFunction {
+  /// the name of the function, one of:
+  /// - "row_number", "rank", "dense_rank": ranking within the partition, `target` is
+  ///   ignored
+  /// - "lag", "lead": value of `target` `offset` rows before / after the current row
+  ///   within the partition, null if there is no such row
+  /// - "count", "sum", "mean", "min", "max": aggregate of the non-null values of
+  ///   `target` in the frame of the current row
+  WindowFunction(std::string function, FieldRef target, std::string name,
+                 WindowFrame frame = WindowFrame(), int64_t offset = 1)
+      : function(std::move(function)),
+        target(std::move(target)),
+        name(std::move(name)),
+        frame(frame),
+        offset(offset) {}
+
+  // the name of the function
+  std::string function;
+
+  // field to which the function is applied
+  FieldRef target;
+
+  // output field name
+  std::string name;
+
+  // frame of the aggregate functions
+  WindowFrame frame;
+
+  // offset of "lag" and "lead"
+  int64_t offset;
+};
+
+/// \brief Make a node which computes window functions
+///
+/// Rows are split into partitions with equal values of the partition keys and sorted
+/// within each partition by the order keys.  The node outputs all input columns
+/// followed by one column per window function, partition by partition in sorted order.
+/// All input is accumulated in memory before any output is produced.
+class ARROW_EXPORT WindowNodeOptions : public ExecNodeOptions {
+ public:
+  explicit WindowNodeOptions(std::vector<WindowFunction> functions,
+                             std::vector<FieldRef> partition_keys = {},
+                             std::vector<SortKey> order_by = {})
+      : functions(std::move(functions)),
+        partition_keys(std::move(partition_keys)),
+        order_by(std::move(order_by)) {}
+
+  // window functions to compute
+  std::vector<WindowFunction> functions;
+  // keys by which rows are partitioned
+  std::vector<FieldRef> partition_keys;
+  // keys by which rows are ordered within a partition, nulls are sorted last
+  std::vector<SortKey> order_by;
 };
 
 constexpr int32_t kDefaultBackpressureHighBytes = 1 << 30;  // 1GiB
@@ -248,6 +406,17 @@ class ARROW_EXPORT OrderBySinkNodeOptions : public SinkNodeOptions {
       : SinkNodeOptions(generator), sort_options(std::move(sort_options)) {}
 
   SortOptions sort_options;
+  // maximum number of bytes of input to buffer in memory.  When positive, the input is
+  // sorted in runs of about this size which are written to temporary Arrow IPC files
+  // (created under the system temporary directory, see TMPDIR), the runs are then
+  // merged and the output is produced as the merge progresses.  Zero sorts the whole
+  // input in memory.
+  //
+  // External sorting is not supported for dictionary columns.
+  int64_t spill_memory_limit = 0;
+  // number of rows per sorted run of an in-memory sort.  Runs are sorted as the input
+  // arrives, by the threads delivering it, and merged in parallel once it has ended.
+  int64_t sort_run_length = 1 << 20;
 };
 
 /// @}
@@ -380,6 +549,94 @@ class ARROW_EXPORT HashJoinNodeOptions : public ExecNodeOptions {
   Expression filter = literal(true);
   // whether or not to disable Bloom filters in this join
   bool disable_bloom_filter = false;
+  // maximum number of bytes of build side input to hold in memory.  Once the build
+  // side grows past this limit the join switches to a grace hash join: both inputs are
+  // hash partitioned, partitions that do not fit in memory are spilled to temporary
+  // Arrow IPC files (created under the system temporary directory, see TMPDIR) and the
+  // partitions are then joined one at a time.  Zero disables spilling.
+  //
+  // Spilling is not supported for dictionary keys, and a join with spilling enabled
+  // neither produces nor receives Bloom filters.
+  int64_t spill_memory_limit = 0;
+  // if set the build side is chosen at runtime rather than always being the right
+  // input.  Batches of both inputs are buffered until one input has finished with no
+  // more rows than the other has delivered so far, which then becomes the build side.
+  // If neither has once adaptive_build_side_max_batches batches are buffered from each
+  // input, the input with fewer buffered rows is chosen.  The output is the same
+  // whichever input is chosen.
+  //
+  // An adaptive join neither produces nor receives Bloom filters and cannot be combined
+  // with spilling.
+  bool adaptive_build_side = false;
+  // maximum number of batches of each input to buffer while choosing the build side
+  int adaptive_build_side_max_batches = 16;
+};
+
+/// \brief Make a node which implements join operation using sort-merge join strategy.
+///
+/// Note, this API is experimental and will change in the future
+///
+/// Both inputs must deliver their batches in order, sorted ascending on the join keys
+/// (compared lexicographically in the order the keys are listed) with null keys placed
+/// according to `null_placement`.  No hash table is built: the inputs are merged as
+/// they arrive and only the rows sharing the current key value are retained, so memory
+/// use is proportional to the number of duplicates of a key rather than to the size of
+/// either input.  Null keys never match.
+class ARROW_EXPORT SortMergeJoinNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr const char* default_output_suffix_for_left = "";
+  static constexpr const char* default_output_suffix_for_right = "";
+  SortMergeJoinNodeOptions(
+      JoinType join_type, std::vector<FieldRef> left_keys,
+      std::vector<FieldRef> right_keys,
+      std::string output_suffix_for_left = default_output_suffix_for_left,
+      std::string output_suffix_for_right = default_output_suffix_for_right,
+      NullPlacement null_placement = NullPlacement::AtEnd)
+      : join_type(join_type),
+        left_keys(std::move(left_keys)),
+        right_keys(std::move(right_keys)),
+        output_all(true),
+        output_suffix_for_left(std::move(output_suffix_for_left)),
+        output_suffix_for_right(std::move(output_suffix_for_right)),
+        null_placement(null_placement) {}
+  SortMergeJoinNodeOptions(
+      JoinType join_type, std::vector<FieldRef> left_keys,
+      std::vector<FieldRef> right_keys, std::vector<FieldRef> left_output,
+      std::vector<FieldRef> right_output,
+      std::string output_suffix_for_left = default_output_suffix_for_left,
+      std::string output_suffix_for_right = default_output_suffix_for_right,
+      NullPlacement null_placement = NullPlacement::AtEnd)
+      : join_type(join_type),
+        left_keys(std::move(left_keys)),
+        right_keys(std::move(right_keys)),
+        output_all(false),
+        left_output(std::move(left_output)),
+        right_output(std::move(right_output)),
+        output_suffix_for_left(std::move(output_suffix_for_left)),
+        output_suffix_for_right(std::move(output_suffix_for_right)),
+        null_placement(null_placement) {}
+
+  // type of join (inner, left, semi...)
+  JoinType join_type;
+  // key fields from left input
+  std::vector<FieldRef> left_keys;
+  // key fields from right input
+  std::vector<FieldRef> right_keys;
+  // if set all valid fields from both left and right input will be output
+  // (and field ref vectors for output fields will be ignored)
+  bool output_all;
+  // output fields passed from left input
+  std::vector<FieldRef> left_output;
+  // output fields passed from right input
+  std::vector<FieldRef> right_output;
+  // suffix added to names of output fields coming from left input (used to distinguish,
+  // if necessary, between fields of the same name in left and right input and can be left
+  // empty if there are no name collisions)
+  std::string output_suffix_for_left;
+  // suffix added to names of output fields coming from right input
+  std::string output_suffix_for_right;
+  // where null keys are placed in the sort order of both inputs
+  NullPlacement null_placement;
 };
 
 /// \brief Make a node which implements asof join operation
@@ -17,86 +17,884 @@
 
 #include "arrow/compute/exec/order_by_impl.h"
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <vector>
+#include "arrow/array/array_binary.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/buffer.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec/expression.h"
 #include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/runtime_filter.h"
+#include "arrow/compute/exec/spilling_util.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/ipc/reader.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visit_type_inline.h"
 
 namespace arrow {
 using internal::checked_cast;
 
 namespace compute {
 
-class SortBasicImpl : public OrderByImpl {
+constexpr int64_t OrderByImpl::kDefaultSortRunLength;
+
+Future<> OrderByImpl::Finish(const std::function<bool(ExecBatch)>& output) {
+  return DoFinish().Then([output](const std::shared_ptr<Table>& sorted) -> Status {
+    TableBatchReader reader(*sorted);
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (!batch) break;
+      if (!output(ExecBatch(*batch))) break;
+    }
+    return Status::OK();
+  });
+}
+
+namespace {
+
+// Splits sorted runs into ranges of their first sort key, such that every row of a range
+// sorts before every row of the next range.  Runs are binary searched for splitters
+// sampled from the runs, keys comparing equal on the first sort key always end up in
+// the same range.
+class RunPartitioner {
  public:
-  SortBasicImpl(ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
-                const SortOptions& options = SortOptions{})
-      : ctx_(ctx), output_schema_(output_schema), options_(options) {}
+  RunPartitioner(const std::vector<std::shared_ptr<Array>>& keys, SortOrder order,
+                 NullPlacement null_placement, int num_ranges)
+      : keys_(keys),
+        order_(order),
+        null_placement_(null_placement),
+        num_ranges_(num_ranges) {}
+
+  // For each run, the num_ranges + 1 offsets bounding its rows in each range.  Fails
+  // with NotImplemented for key types which are not supported.
+  Result<std::vector<std::vector<int64_t>>> Partition() {
+    RETURN_NOT_OK(VisitTypeInline(*keys_[0]->type(), this));
+    return std::move(bounds_);
+  }
+
+  template <typename Type>
+  enable_if_t<is_integer_type<Type>::value ||
+                  (is_temporal_type<Type>::value && !is_interval_type<Type>::value) ||
+                  is_base_binary_type<Type>::value,
+              Status>
+  Visit(const Type&) {
+    using ArrayType = typename TypeTraits<Type>::ArrayType;
+    using ValueType = decltype(std::declval<ArrayType>().GetView(0));
+    // Whether a sorts strictly before b
+    auto before = [this](const ValueType& a, const ValueType& b) {
+      return order_ == SortOrder::Ascending ? a < b : b < a;
+    };
+
+    // The non-null rows of each run, nulls are placed together at one end
+    std::vector<std::pair<int64_t, int64_t>> non_null(keys_.size());
+    std::vector<ValueType> samples;
+    for (size_t run = 0; run < keys_.size(); ++run) {
+      const auto& key = checked_cast<const ArrayType&>(*keys_[run]);
+      int64_t begin = null_placement_ == NullPlacement::AtStart ? key.null_count() : 0;
+      int64_t end = begin + key.length() - key.null_count();
+      non_null[run] = {begin, end};
+      int64_t num_samples =
+          std::min<int64_t>(end - begin, kSamplesPerRange * num_ranges_);
+      for (int64_t i = 0; i < num_samples; ++i) {
+        samples.push_back(key.GetView(begin + i * (end - begin) / num_samples));
+      }
+    }
+    std::sort(samples.begin(), samples.end(), before);
+
+    bounds_.resize(keys_.size());
+    for (size_t run = 0; run < keys_.size(); ++run) {
+      const auto& key = checked_cast<const ArrayType&>(*keys_[run]);
+      auto& bounds = bounds_[run];
+      bounds.resize(num_ranges_ + 1);
+      // Null rows go to the first or the last range
+      bounds[0] = 0;
+      bounds[num_ranges_] = key.length();
+      for (int range = 1; range < num_ranges_; ++range) {
+        if (samples.empty()) {
+          bounds[range] = non_null[run].second;
+          continue;
+        }
+        const ValueType& splitter = samples[range * samples.size() / num_ranges_];
+        // The first row which sorts after the splitter
+        int64_t lo = non_null[run].first, hi = non_null[run].second;
+        while (lo < hi) {
+          int64_t mid = lo + (hi - lo) / 2;
+          if (before(splitter, key.GetView(mid))) {
+            hi = mid;
+          } else {
+            lo = mid + 1;
+          }
+        }
+        bounds[range] = lo;
+      }
+    }
+    return Status::OK();
+  }
+
+  // Floating point keys are not supported as NaN is unordered, nor are keys without a
+  // natural order on their values such as dictionaries
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Partitioning sorted runs on ", type.ToString());
+  }
+
+ private:
+  static constexpr int64_t kSamplesPerRange = 16;
 
-  void InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
+  const std::vector<std::shared_ptr<Array>>& keys_;
+  SortOrder order_;
+  NullPlacement null_placement_;
+  int num_ranges_;
+  std::vector<std::vector<int64_t>> bounds_;
+};
+
+constexpr int64_t RunPartitioner::kSamplesPerRange;
+
+// Three-way comparison of two rows of sorted runs on one sort key, in the order of
+// SortIndices: values in the sort order, then NaNs, then nulls (or nulls, then NaNs,
+// then values if nulls are placed at the start)
+class RunKeyComparator {
+ public:
+  virtual ~RunKeyComparator() = default;
+  virtual int Compare(const Array& left, int64_t left_row, const Array& right,
+                      int64_t right_row) const = 0;
+};
+
+template <typename Type>
+class TypedRunKeyComparator : public RunKeyComparator {
+ public:
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+
+  TypedRunKeyComparator(SortOrder order, NullPlacement null_placement)
+      : order_(order), null_placement_(null_placement) {}
+
+  int Compare(const Array& left, int64_t left_row, const Array& right,
+              int64_t right_row) const override {
+    const auto& left_values = checked_cast<const ArrayType&>(left);
+    const auto& right_values = checked_cast<const ArrayType&>(right);
+    const int left_rank = Rank(left_values, left_row);
+    const int right_rank = Rank(right_values, right_row);
+    if (left_rank != right_rank || left_rank != 0) {
+      return left_rank - right_rank;
+    }
+    const auto a = left_values.GetView(left_row);
+    const auto b = right_values.GetView(right_row);
+    const int result = a < b ? -1 : (b < a ? 1 : 0);
+    return order_ == SortOrder::Ascending ? result : -result;
+  }
+
+ private:
+  // 0 for values, 1 for NaNs and 2 for nulls, negated if nulls are placed at the start
+  int Rank(const ArrayType& values, int64_t row) const {
+    int rank = 0;
+    if (values.IsNull(row)) {
+      rank = 2;
+    } else if (IsNaNValue(values.GetView(row))) {
+      rank = 1;
+    }
+    return null_placement_ == NullPlacement::AtEnd ? rank : -rank;
+  }
+
+  template <typename Value>
+  static enable_if_t<std::is_floating_point<Value>::value, bool> IsNaNValue(Value v) {
+    return std::isnan(v);
+  }
+
+  template <typename Value>
+  static enable_if_t<!std::is_floating_point<Value>::value, bool> IsNaNValue(
+      const Value&) {
+    return false;
+  }
+
+  SortOrder order_;
+  NullPlacement null_placement_;
+};
+
+struct RunKeyComparatorMaker {
+  template <typename Type>
+  enable_if_t<is_integer_type<Type>::value || is_floating_type<Type>::value ||
+                  is_boolean_type<Type>::value ||
+                  (is_temporal_type<Type>::value && !is_interval_type<Type>::value) ||
+                  is_base_binary_type<Type>::value ||
+                  std::is_same<Type, FixedSizeBinaryType>::value,
+              Status>
+  Visit(const Type&) {
+    out.reset(new TypedRunKeyComparator<Type>(order, null_placement));
+    return Status::OK();
+  }
+
+  Status Visit(const HalfFloatType& type) { return Unsupported(type); }
+
+  // Keys without a natural order on their values, such as dictionaries, or whose views
+  // do not compare as values, such as decimals
+  Status Visit(const DataType& type) { return Unsupported(type); }
+
+  Status Unsupported(const DataType& type) {
+    return Status::NotImplemented("Merging sorted runs on ", type.ToString());
+  }
+
+  SortOrder order;
+  NullPlacement null_placement;
+  std::unique_ptr<RunKeyComparator> out;
+};
+
+// A sort which spreads its work over the threads of the plan.  Input is sorted in runs
+// as it is received, by the thread delivering it.  When finishing the runs are split
+// into ranges of their first sort key and the runs are merged in each range in
+// parallel.
+class ParallelSortImpl : public OrderByImpl {
+ public:
+  ParallelSortImpl(ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
+                   const SortOptions& options, int64_t run_length)
+      : ctx_(ctx),
+        output_schema_(output_schema),
+        options_(options),
+        run_length_(run_length) {}
+
+  Status InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      batches_.push_back(batch);
+      buffered_rows_ += batch->num_rows();
+      bytes_buffered_ += util::TotalBufferSize(*batch);
+      if (buffered_rows_ < run_length_) {
+        return Status::OK();
+      }
+      batches.swap(batches_);
+      buffered_rows_ = 0;
+    }
+    // Sort the run outside of the lock so other threads can keep buffering
+    ARROW_ASSIGN_OR_RAISE(auto run, SortRun(std::move(batches)));
     std::unique_lock<std::mutex> lock(mutex_);
-    batches_.push_back(batch);
+    runs_.push_back(std::move(run));
+    return Status::OK();
   }
 
-  Result<Datum> DoFinish() override {
+  Future<std::shared_ptr<Table>> DoFinish() override {
     std::unique_lock<std::mutex> lock(mutex_);
+    if (!batches_.empty()) {
+      ARROW_ASSIGN_OR_RAISE(auto run, SortRun(std::move(batches_)));
+      runs_.push_back(std::move(run));
+      batches_.clear();
+      buffered_rows_ = 0;
+    }
+    std::vector<std::shared_ptr<RecordBatch>> runs = std::move(runs_);
+    runs_.clear();
+    if (runs.size() <= 1) {
+      return Table::FromRecordBatches(output_schema_, std::move(runs));
+    }
+
+    int num_ranges = 1;
+    ::arrow::internal::Executor* executor = ctx_->executor();
+    if (executor != nullptr && executor->GetCapacity() > 1) {
+      num_ranges = executor->GetCapacity();
+    }
+    std::vector<std::vector<int64_t>> bounds;
+    if (num_ranges > 1) {
+      ARROW_ASSIGN_OR_RAISE(auto key_ref,
+                            options_.sort_keys[0].target.FindOne(*output_schema_));
+      std::vector<std::shared_ptr<Array>> keys(runs.size());
+      for (size_t run = 0; run < runs.size(); ++run) {
+        ARROW_ASSIGN_OR_RAISE(auto key, key_ref.Get(*runs[run]));
+        keys[run] = std::move(key);
+      }
+      auto maybe_bounds = RunPartitioner(keys, options_.sort_keys[0].order,
+                                         options_.null_placement, num_ranges)
+                              .Partition();
+      if (maybe_bounds.ok()) {
+        bounds = maybe_bounds.MoveValueUnsafe();
+      } else if (maybe_bounds.status().IsNotImplemented()) {
+        num_ranges = 1;
+      } else {
+        return maybe_bounds.status();
+      }
+    }
+    if (num_ranges == 1) {
+      return MergeRuns(std::move(runs));
+    }
+
+    std::vector<std::vector<std::shared_ptr<RecordBatch>>> ranges(num_ranges);
+    for (int range = 0; range < num_ranges; ++range) {
+      for (size_t run = 0; run < runs.size(); ++run) {
+        int64_t begin = bounds[run][range], end = bounds[run][range + 1];
+        if (end > begin) {
+          ranges[range].push_back(runs[run]->Slice(begin, end - begin));
+        }
+      }
+    }
+    // The ranges are merged by tasks of the executor and concatenated by a continuation,
+    // the calling thread, which may be one of the executor's, does not wait for them
+    return ::arrow::internal::ParallelForAsync(
+               std::move(ranges),
+               [this](size_t, std::vector<std::shared_ptr<RecordBatch>> slices) {
+                 return MergeRuns(std::move(slices));
+               },
+               executor)
+        .Then([](const std::vector<std::shared_ptr<Table>>& merged) {
+          return ConcatenateTables(merged);
+        });
+  }
+
+  std::string ToString() const override { return options_.ToString(); }
+
+  int64_t bytes_buffered() const override { return bytes_buffered_.load(); }
+
+ private:
+  Result<std::shared_ptr<RecordBatch>> SortRun(
+      std::vector<std::shared_ptr<RecordBatch>> batches) {
     ARROW_ASSIGN_OR_RAISE(auto table,
-                          Table::FromRecordBatches(output_schema_, std::move(batches_)));
+                          Table::FromRecordBatches(output_schema_, std::move(batches)));
     ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(table, options_, ctx_));
-    return Take(table, indices, TakeOptions::NoBoundsCheck(), ctx_);
+    ARROW_ASSIGN_OR_RAISE(Datum sorted,
+                          Take(table, indices, TakeOptions::NoBoundsCheck(), ctx_));
+    return sorted.table()->CombineChunksToBatch(ctx_->memory_pool());
   }
 
-  std::string ToString() const override { return options_.ToString(); }
+  // Merge sorted runs with a heap holding the current row of each run.  Runs are ranked
+  // by their position on ties, so the merge is as stable as sorting their concatenation.
+  Result<std::shared_ptr<Table>> MergeRuns(
+      std::vector<std::shared_ptr<RecordBatch>> runs) {
+    ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(output_schema_, runs));
+    if (runs.size() <= 1 || table->num_rows() == 0) {
+      return table;
+    }
+
+    // The comparators of the sort keys, and the key columns of each run
+    std::vector<std::unique_ptr<RunKeyComparator>> comparators;
+    std::vector<std::vector<std::shared_ptr<Array>>> keys;
+    for (const SortKey& sort_key : options_.sort_keys) {
+      ARROW_ASSIGN_OR_RAISE(auto key_ref, sort_key.target.FindOne(*output_schema_));
+      ARROW_ASSIGN_OR_RAISE(auto key_field, key_ref.Get(*output_schema_));
+      RunKeyComparatorMaker maker{sort_key.order, options_.null_placement, nullptr};
+      Status st = VisitTypeInline(*key_field->type(), &maker);
+      if (st.IsNotImplemented()) {
+        return SortTable(std::move(table));
+      }
+      RETURN_NOT_OK(st);
+      comparators.push_back(std::move(maker.out));
+      std::vector<std::shared_ptr<Array>> run_keys(runs.size());
+      for (size_t run = 0; run < runs.size(); ++run) {
+        ARROW_ASSIGN_OR_RAISE(run_keys[run], key_ref.Get(*runs[run]));
+      }
+      keys.push_back(std::move(run_keys));
+    }
+
+    std::vector<int64_t> run_offsets(runs.size() + 1, 0);
+    std::vector<int64_t> positions(runs.size(), 0);
+    for (size_t run = 0; run < runs.size(); ++run) {
+      run_offsets[run + 1] = run_offsets[run] + runs[run]->num_rows();
+    }
+    // Whether the current row of run a sorts after that of run b
+    auto after = [&](size_t a, size_t b) {
+      for (size_t key = 0; key < comparators.size(); ++key) {
+        int result = comparators[key]->Compare(*keys[key][a], positions[a],
+                                               *keys[key][b], positions[b]);
+        if (result != 0) {
+          return result > 0;
+        }
+      }
+      return a > b;
+    };
+    std::vector<size_t> heap;
+    for (size_t run = 0; run < runs.size(); ++run) {
+      if (runs[run]->num_rows() > 0) {
+        heap.push_back(run);
+      }
+    }
+    std::make_heap(heap.begin(), heap.end(), after);
+
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Buffer> indices_buffer,
+        AllocateBuffer(table->num_rows() * sizeof(uint64_t), ctx_->memory_pool()));
+    auto* indices = reinterpret_cast<uint64_t*>(indices_buffer->mutable_data());
+    while (!heap.empty()) {
+      std::pop_heap(heap.begin(), heap.end(), after);
+      const size_t run = heap.back();
+      *indices++ = static_cast<uint64_t>(run_offsets[run] + positions[run]);
+      if (++positions[run] < runs[run]->num_rows()) {
+        std::push_heap(heap.begin(), heap.end(), after);
+      } else {
+        heap.pop_back();
+      }
+    }
+    auto indices_array = std::make_shared<UInt64Array>(table->num_rows(),
+                                                       std::move(indices_buffer));
+    ARROW_ASSIGN_OR_RAISE(Datum merged, Take(table, indices_array,
+                                             TakeOptions::NoBoundsCheck(), ctx_));
+    return merged.table();
+  }
+
+  // Sorting by the table sorter, which sorts each run again before merging them, is
+  // left for the key types the merge does not support
+  Result<std::shared_ptr<Table>> SortTable(std::shared_ptr<Table> table) {
+    ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(table, options_, ctx_));
+    ARROW_ASSIGN_OR_RAISE(Datum sorted,
+                          Take(table, indices, TakeOptions::NoBoundsCheck(), ctx_));
+    return sorted.table();
+  }
 
- protected:
   ExecContext* ctx_;
   std::shared_ptr<Schema> output_schema_;
+  const SortOptions options_;
+  const int64_t run_length_;
+
   std::mutex mutex_;
   std::vector<std::shared_ptr<RecordBatch>> batches_;
+  int64_t buffered_rows_ = 0;
+  std::atomic<int64_t> bytes_buffered_{0};
+  std::vector<std::shared_ptr<RecordBatch>> runs_;
+};
 
- private:
-  const SortOptions options_;
-};  // namespace compute
+bool IsNaN(const Scalar& scalar) {
+  switch (scalar.type->id()) {
+    case Type::FLOAT:
+      return std::isnan(checked_cast<const FloatScalar&>(scalar).value);
+    case Type::DOUBLE:
+      return std::isnan(checked_cast<const DoubleScalar&>(scalar).value);
+    default:
+      return false;
+  }
+}
 
-class SelectKBasicImpl : public SortBasicImpl {
+}  // namespace
+
+// A select-k which keeps the best K rows of each thread.  Input is buffered per thread
+// and reduced to the best K rows whenever K more have been buffered.  Once a thread holds
+// K rows no row whose first sort key is worse than the K-th one can be selected, the
+// tightest such bound is pushed down to the source of the input.
+class StreamingSelectKImpl : public OrderByImpl {
  public:
-  SelectKBasicImpl(ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
-                   const SelectKOptions& options)
-      : SortBasicImpl(ctx, output_schema), options_(options) {}
+  StreamingSelectKImpl(ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
+                       const SelectKOptions& options, int first_key_index,
+                       RuntimeFilterSet* pushdown)
+      : ctx_(ctx),
+        output_schema_(output_schema),
+        options_(options),
+        first_key_index_(first_key_index),
+        pushdown_(pushdown),
+        states_(ThreadIndexer::Capacity()) {}
 
-  Result<Datum> DoFinish() override {
-    std::unique_lock<std::mutex> lock(mutex_);
+  Status InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
+    size_t thread_index = get_thread_index_();
+    if (thread_index >= states_.size()) {
+      return Status::IndexError("thread index ", thread_index, " is out of range [0, ",
+                                states_.size(), ")");
+    }
+    ThreadState& state = states_[thread_index];
+    state.batches.push_back(batch);
+    state.num_rows += batch->num_rows();
+    const int64_t batch_bytes = util::TotalBufferSize(*batch);
+    state.num_bytes += batch_bytes;
+    bytes_buffered_ += batch_bytes;
+    if (state.num_rows - options_.k < options_.k) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto selected, SelectK(std::move(state.batches)));
+    const int64_t selected_bytes = util::TotalBufferSize(*selected);
+    bytes_buffered_ += selected_bytes - state.num_bytes;
+    state.num_rows = selected->num_rows();
+    state.num_bytes = selected_bytes;
+    state.batches = {selected};
+    if (pushdown_ != NULLPTR && selected->num_rows() == options_.k) {
+      return PushDownBound(*selected);
+    }
+    return Status::OK();
+  }
+
+  Future<std::shared_ptr<Table>> DoFinish() override {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (ThreadState& state : states_) {
+      for (auto& batch : state.batches) {
+        batches.push_back(std::move(batch));
+      }
+      state.batches.clear();
+      state.num_rows = 0;
+      state.num_bytes = 0;
+    }
+    bytes_buffered_ = 0;
+    ARROW_ASSIGN_OR_RAISE(auto selected, SelectK(std::move(batches)));
+    return Table::FromRecordBatches(output_schema_, {std::move(selected)});
+  }
+
+  std::string ToString() const override { return options_.ToString(); }
+
+  int64_t bytes_buffered() const override { return bytes_buffered_.load(); }
+
+ private:
+  struct ThreadState {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    int64_t num_rows = 0;
+    int64_t num_bytes = 0;
+  };
+
+  // The selected rows, in order
+  Result<std::shared_ptr<RecordBatch>> SelectK(
+      std::vector<std::shared_ptr<RecordBatch>> batches) {
     ARROW_ASSIGN_OR_RAISE(auto table,
-                          Table::FromRecordBatches(output_schema_, std::move(batches_)));
+                          Table::FromRecordBatches(output_schema_, std::move(batches)));
     ARROW_ASSIGN_OR_RAISE(auto indices, SelectKUnstable(table, options_, ctx_));
-    return Take(table, indices, TakeOptions::NoBoundsCheck(), ctx_);
+    ARROW_ASSIGN_OR_RAISE(Datum selected,
+                          Take(table, indices, TakeOptions::NoBoundsCheck(), ctx_));
+    return selected.table()->CombineChunksToBatch(ctx_->memory_pool());
+  }
+
+  // Once the K-th first sort key is a proper value, rows with a null first sort key are
+  // never selected, neither are those failing the comparison with it, such as NaNs
+  Status PushDownBound(const RecordBatch& selected) {
+    const auto& key_values = selected.column(first_key_index_);
+    ARROW_ASSIGN_OR_RAISE(auto bound, key_values->GetScalar(key_values->length() - 1));
+    // select_k leaves nulls and NaNs out, but should one be the K-th key it bounds
+    // nothing, and comparing against it would make the filter reject every row
+    if (!bound->is_valid || IsNaN(*bound)) {
+      return Status::OK();
+    }
+    const bool descending = options_.sort_keys[0].order == SortOrder::Descending;
+    std::lock_guard<std::mutex> lock(bound_mutex_);
+    if (bound_) {
+      ARROW_ASSIGN_OR_RAISE(
+          Datum tighter,
+          CallFunction(descending ? "greater" : "less", {bound, bound_}, ctx_));
+      if (!tighter.scalar_as<BooleanScalar>().value) {
+        return Status::OK();
+      }
+    }
+    bound_ = bound;
+    auto key = field_ref(output_schema_->field(first_key_index_)->name());
+    auto key_range = descending ? greater_equal(std::move(key), literal(std::move(bound)))
+                                : less_equal(std::move(key), literal(std::move(bound)));
+    auto filter = std::make_shared<RuntimeFilter>(
+        /*bloom_filter=*/NULLPTR, /*key_ids=*/std::vector<int>{}, std::move(key_range));
+    pushdown_->Replace(pushed_.get(), filter);
+    pushed_ = std::move(filter);
+    return Status::OK();
+  }
+
+  ExecContext* ctx_;
+  std::shared_ptr<Schema> output_schema_;
+  const SelectKOptions options_;
+  const int first_key_index_;
+  RuntimeFilterSet* pushdown_;
+
+  ThreadIndexer get_thread_index_;
+  std::vector<ThreadState> states_;
+  std::atomic<int64_t> bytes_buffered_{0};
+
+  std::mutex bound_mutex_;
+  std::shared_ptr<Scalar> bound_;
+  std::shared_ptr<const RuntimeFilter> pushed_;
+};
+
+// An external merge sort.  Input is buffered until spill_memory_limit bytes have
+// accumulated, the buffered batches are then sorted and written to disk as a run.  On
+// Finish() the runs are merged, and the output streamed, one batch of each run at a time.
+class ExternalSortImpl : public OrderByImpl {
+ public:
+  ExternalSortImpl(ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
+                   const SortOptions& options, int64_t spill_memory_limit)
+      : ctx_(ctx),
+        output_schema_(output_schema),
+        options_(options),
+        spill_memory_limit_(spill_memory_limit) {}
+
+  Status InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
+    std::vector<std::shared_ptr<RecordBatch>> run;
+    int64_t run_bytes;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      batches_.push_back(batch);
+      const int64_t batch_bytes = util::TotalBufferSize(*batch);
+      buffered_bytes_ += batch_bytes;
+      bytes_in_memory_ += batch_bytes;
+      if (buffered_bytes_ < spill_memory_limit_) {
+        return Status::OK();
+      }
+      run.swap(batches_);
+      run_bytes = buffered_bytes_;
+      buffered_bytes_ = 0;
+    }
+    // Sort and write the run outside of the lock so other threads can keep buffering
+    RETURN_NOT_OK(SpillRun(std::move(run)));
+    bytes_in_memory_ -= run_bytes;
+    return Status::OK();
+  }
+
+  Future<std::shared_ptr<Table>> DoFinish() override {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    Status status;
+    RETURN_NOT_OK(MergeRuns([&](ExecBatch batch) {
+      auto maybe_batch = batch.ToRecordBatch(output_schema_, ctx_->memory_pool());
+      if (!maybe_batch.ok()) {
+        status = maybe_batch.status();
+        return false;
+      }
+      batches.push_back(maybe_batch.MoveValueUnsafe());
+      return true;
+    }));
+    RETURN_NOT_OK(status);
+    return Table::FromRecordBatches(output_schema_, std::move(batches));
+  }
+
+  Future<> Finish(const std::function<bool(ExecBatch)>& output) override {
+    return MergeRuns(output);
   }
 
   std::string ToString() const override { return options_.ToString(); }
 
+  int64_t bytes_buffered() const override { return bytes_in_memory_.load(); }
+
+  int64_t bytes_spilled() const override { return bytes_spilled_.load(); }
+
  private:
-  const SelectKOptions options_;
+  // Number of rows per batch when writing and reading back runs.  While merging, one
+  // such batch from every run is resident.
+  static constexpr int64_t kRunBatchSize = 16 * 1024;
+
+  // Merge the spilled runs and what remains in memory into `output`
+  Status MergeRuns(const std::function<bool(ExecBatch)>& output) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    // The input that did not fill a whole run is sorted in memory and merged with the
+    // spilled runs
+    ARROW_ASSIGN_OR_RAISE(auto in_memory, SortBatches(std::move(batches_)));
+    batches_.clear();
+    buffered_bytes_ = 0;
+
+    std::vector<SortedRun> runs;
+    for (const auto& run_file : spilled_runs_) {
+      ARROW_ASSIGN_OR_RAISE(auto reader, run_file->OpenReader());
+      runs.emplace_back(std::move(reader));
+    }
+    if (in_memory->num_rows() > 0) {
+      runs.emplace_back(std::move(in_memory));
+    }
+    return Merge(std::move(runs), output);
+  }
+
+  // A sorted run, either spilled or in memory, read back one batch at a time
+  class SortedRun {
+   public:
+    explicit SortedRun(std::shared_ptr<ipc::RecordBatchFileReader> file)
+        : file_(std::move(file)) {}
+
+    explicit SortedRun(std::shared_ptr<Table> table) : table_(std::move(table)) {
+      table_reader_ = ::arrow::internal::make_unique<TableBatchReader>(*table_);
+      table_reader_->set_chunksize(kRunBatchSize);
+    }
+
+    // Sets *out to null once the run is exhausted
+    Status Next(std::shared_ptr<RecordBatch>* out) {
+      if (table_reader_) {
+        return table_reader_->ReadNext(out);
+      }
+      if (next_batch_ == file_->num_record_batches()) {
+        out->reset();
+        return Status::OK();
+      }
+      return file_->ReadRecordBatch(next_batch_++).Value(out);
+    }
+
+   private:
+    std::shared_ptr<ipc::RecordBatchFileReader> file_;
+    int next_batch_ = 0;
+    std::shared_ptr<Table> table_;
+    std::unique_ptr<TableBatchReader> table_reader_;
+  };
+
+  Result<std::shared_ptr<Table>> SortBatches(
+      std::vector<std::shared_ptr<RecordBatch>> batches) {
+    ARROW_ASSIGN_OR_RAISE(auto table,
+                          Table::FromRecordBatches(output_schema_, std::move(batches)));
+    ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(table, options_, ctx_));
+    ARROW_ASSIGN_OR_RAISE(Datum sorted,
+                          Take(table, indices, TakeOptions::NoBoundsCheck(), ctx_));
+    return sorted.table();
+  }
+
+  Status SpillRun(std::vector<std::shared_ptr<RecordBatch>> batches) {
+    ARROW_ASSIGN_OR_RAISE(auto sorted, SortBatches(std::move(batches)));
+    ARROW_ASSIGN_OR_RAISE(auto run_file, MakeRunFile());
+    TableBatchReader reader(*sorted);
+    reader.set_chunksize(kRunBatchSize);
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (!batch) break;
+      RETURN_NOT_OK(run_file->Append(ExecBatch(*batch)));
+    }
+    RETURN_NOT_OK(run_file->Finish());
+    bytes_spilled_ += run_file->bytes_written();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    spilled_runs_.push_back(std::move(run_file));
+    return Status::OK();
+  }
+
+  Result<std::unique_ptr<SpillFile>> MakeRunFile() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!spill_dir_) {
+      ARROW_ASSIGN_OR_RAISE(spill_dir_,
+                            ::arrow::internal::TemporaryDir::Make("arrow-sort-spill-"));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto path, spill_dir_->path().Join(
+                                         "run-" + std::to_string(num_run_files_++) +
+                                         ".arrow"));
+    return ::arrow::internal::make_unique<SpillFile>(ctx_, output_schema_,
+                                                     std::move(path));
+  }
+
+  // Output a table, returns false if the consumer stopped accepting batches
+  static Result<bool> OutputTable(const Table& table,
+                                  const std::function<bool(ExecBatch)>& output) {
+    TableBatchReader reader(table);
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (!batch) return true;
+      if (!output(ExecBatch(*batch))) return false;
+    }
+  }
+
+  // Merge sorted runs.  Each round sorts the current batch of every run together.  The
+  // run whose last row sorts first bounds the output: no row still on disk can sort
+  // before it, so every row up to and including it is emitted, and what remains of the
+  // other runs' batches takes part in the next round.
+  Status Merge(std::vector<SortedRun> runs,
+               const std::function<bool(ExecBatch)>& output) {
+    std::vector<std::shared_ptr<RecordBatch>> heads(runs.size());
+    while (true) {
+      // Make sure every run has a non-empty current batch, dropping exhausted runs
+      size_t run = 0;
+      while (run < runs.size()) {
+        if (heads[run] && heads[run]->num_rows() > 0) {
+          ++run;
+          continue;
+        }
+        RETURN_NOT_OK(runs[run].Next(&heads[run]));
+        if (!heads[run]) {
+          runs.erase(runs.begin() + run);
+          heads.erase(heads.begin() + run);
+        }
+      }
+
+      if (runs.empty()) {
+        return Status::OK();
+      }
+      if (runs.size() == 1) {
+        // Nothing left to merge with, stream out the rest of the last run
+        while (heads[0]) {
+          if (heads[0]->num_rows() > 0 && !output(ExecBatch(*heads[0]))) {
+            return Status::OK();
+          }
+          RETURN_NOT_OK(runs[0].Next(&heads[0]));
+        }
+        return Status::OK();
+      }
+
+      ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(output_schema_, heads));
+      std::vector<int64_t> head_offsets(heads.size() + 1, 0);
+      for (size_t i = 0; i < heads.size(); ++i) {
+        head_offsets[i + 1] = head_offsets[i] + heads[i]->num_rows();
+      }
+      // Sorting is stable, so the rows taken from each run form a prefix of its batch
+      ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(table, options_, ctx_));
+      const uint64_t* sorted = indices->data()->GetValues<uint64_t>(1);
+      std::vector<int64_t> num_taken(heads.size(), 0);
+      int64_t num_output = 0;
+      for (int64_t k = 0; k < indices->length(); ++k) {
+        const auto row = static_cast<int64_t>(sorted[k]);
+        const size_t run =
+            std::upper_bound(head_offsets.begin(), head_offsets.end(), row) -
+            head_offsets.begin() - 1;
+        ++num_taken[run];
+        if (row == head_offsets[run + 1] - 1) {
+          num_output = k + 1;
+          break;
+        }
+      }
+
+      ARROW_ASSIGN_OR_RAISE(Datum merged, Take(table, indices->Slice(0, num_output),
+                                               TakeOptions::NoBoundsCheck(), ctx_));
+      ARROW_ASSIGN_OR_RAISE(bool keep_going, OutputTable(*merged.table(), output));
+      if (!keep_going) {
+        return Status::OK();
+      }
+      for (size_t i = 0; i < heads.size(); ++i) {
+        heads[i] = heads[i]->Slice(num_taken[i]);
+      }
+    }
+  }
+
+  ExecContext* ctx_;
+  std::shared_ptr<Schema> output_schema_;
+  const SortOptions options_;
+  const int64_t spill_memory_limit_;
+
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<RecordBatch>> batches_;
+  int64_t buffered_bytes_ = 0;
+  // Including the runs being spilled
+  std::atomic<int64_t> bytes_in_memory_{0};
+  std::atomic<int64_t> bytes_spilled_{0};
+  std::unique_ptr<::arrow::internal::TemporaryDir> spill_dir_;
+  int num_run_files_ = 0;
+  std::vector<std::unique_ptr<SpillFile>> spilled_runs_;
 };
 
 Result<std::unique_ptr<OrderByImpl>> OrderByImpl::MakeSort(
     ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
-    const SortOptions& options) {
-  std::unique_ptr<OrderByImpl> impl{new SortBasicImpl(ctx, output_schema, options)};
+    const SortOptions& options, int64_t run_length) {
+  std::unique_ptr<OrderByImpl> impl{
+      new ParallelSortImpl(ctx, output_schema, options, run_length)};
+  return std::move(impl);
+}
+
+Result<std::unique_ptr<OrderByImpl>> OrderByImpl::MakeExternalSort(
+    ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
+    const SortOptions& options, int64_t spill_memory_limit) {
+  for (const auto& field : output_schema->fields()) {
+    // Sorted runs mix the dictionaries of their input batches, which an IPC file
+    // cannot represent
+    if (field->type()->id() == Type::DICTIONARY) {
+      return Status::NotImplemented(
+          "External sort is not supported for dictionary columns, found field ",
+          field->ToString());
+    }
+  }
+  std::unique_ptr<OrderByImpl> impl{
+      new ExternalSortImpl(ctx, output_schema, options, spill_memory_limit)};
   return std::move(impl);
 }
 
 Result<std::unique_ptr<OrderByImpl>> OrderByImpl::MakeSelectK(
     ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
-    const SelectKOptions& options) {
-  std::unique_ptr<OrderByImpl> impl{new SelectKBasicImpl(ctx, output_schema, options)};
+    const SelectKOptions& options, RuntimeFilterSet* pushdown) {
+  if (options.sort_keys.empty()) {
+    return Status::Invalid("At least one sort key should be specified");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto first_key,
+                        options.sort_keys[0].target.FindOne(*output_schema));
+  if (first_key.indices().size() != 1) {
+    // A nested first sort key is not visible to the source
+    pushdown = NULLPTR;
+  }
+  std::unique_ptr<OrderByImpl> impl{new StreamingSelectKImpl(
+      ctx, output_schema, options, first_key[0], pushdown)};
   return std::move(impl);
 }
 
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -26,27 +27,61 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/future.h"
 
 namespace arrow {
 namespace compute {
 
 class OrderByImpl {
  public:
+  static constexpr int64_t kDefaultSortRunLength = 1 << 20;
+
   virtual ~OrderByImpl() = default;
 
-  virtual void InputReceived(const std::shared_ptr<RecordBatch>& batch) = 0;
+  virtual Status InputReceived(const std::shared_ptr<RecordBatch>& batch) = 0;
+
+  /// \brief The ordered output
+  ///
+  /// The future may be finished by tasks of the ExecContext's executor, so it must not
+  /// be waited for from a thread of that executor.
+  virtual Future<std::shared_ptr<Table>> DoFinish() = 0;
 
-  virtual Result<Datum> DoFinish() = 0;
+  /// \brief Deliver the ordered output to `output` one batch at a time
+  ///
+  /// Stops early, without error, if `output` returns false.  The default implementation
+  /// slices the table returned by DoFinish().  As for DoFinish(), the future must not be
+  /// waited for from a thread of the executor.
+  virtual Future<> Finish(const std::function<bool(ExecBatch)>& output);
 
   virtual std::string ToString() const = 0;
 
+  /// \brief The number of bytes of input currently held in memory
+  virtual int64_t bytes_buffered() const { return 0; }
+
+  /// \brief The number of bytes written to disk so far
+  virtual int64_t bytes_spilled() const { return 0; }
+
+  /// \brief Make an in-memory sort
+  ///
+  /// The input is sorted in runs of `run_length` rows as it is received, the runs are
+  /// merged in parallel when finishing.
   static Result<std::unique_ptr<OrderByImpl>> MakeSort(
       ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
-      const SortOptions& options);
+      const SortOptions& options, int64_t run_length = kDefaultSortRunLength);
+
+  /// \brief Make a sort that writes sorted runs to disk whenever more than
+  /// spill_memory_limit bytes of input are buffered, and merges the runs when finishing
+  static Result<std::unique_ptr<OrderByImpl>> MakeExternalSort(
+      ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
+      const SortOptions& options, int64_t spill_memory_limit);
 
+  /// \brief Make a select-k which keeps only the best K rows of each thread
+  ///
+  /// Once a thread has seen K rows the K-th value of the first sort key is added to
+  /// `pushdown`, if not null, as the bound of a runtime filter.
   static Result<std::unique_ptr<OrderByImpl>> MakeSelectK(
       ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
-      const SelectKOptions& options);
+      const SelectKOptions& options, RuntimeFilterSet* pushdown = NULLPTR);
 };
 
 }  // namespace compute
@@ -16,11 +16,36 @@
 // under the License.
 
 #include "arrow/compute/exec/partition_util.h"
+
+#include <algorithm>
 #include <mutex>
 
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec/key_hash.h"
+#include "arrow/util/logging.h"
+
 namespace arrow {
 namespace compute {
 
+namespace {
+
+// The partition of a key hash.  Hash tables downstream of the partitioning, such as the
+// SwissTable of a grouper reusing the hashes passed on with the partitions, select
+// blocks with the high bits of the hash: taking the partition from the same bits would
+// crowd the keys of a partition into 1/num_prtns of the blocks.  The hash is multiplied
+// by an odd constant first, which makes the high bits of the product depend on all bits
+// of the hash.
+inline int HashPartitionId(uint32_t hash, int num_prtns) {
+  const uint32_t mixed = hash * 0x9E3779B1u;
+  return static_cast<int>((static_cast<uint64_t>(mixed) *
+                           static_cast<uint64_t>(num_prtns)) >>
+                          32);
+}
+
+}  // namespace
+
 PartitionLocks::PartitionLocks() : num_prtns_(0), locks_(nullptr), rngs_(nullptr) {}
 
 PartitionLocks::~PartitionLocks() { CleanUp(); }
@@ -85,5 +110,117 @@ void PartitionLocks::ReleasePartitionLock(int prtn_id) {
   lock->store(false, std::memory_order_release);
 }
 
+Result<std::vector<ExecBatch>> HashPartitionBatch(ExecContext* ctx,
+                                                  const ExecBatch& batch,
+                                                  const std::vector<int>& key_ids,
+                                                  int num_prtns) {
+  DCHECK(num_prtns >= 1 && num_prtns <= (1 << 15));
+  std::vector<ExecBatch> result(num_prtns);
+  if (batch.length == 0) {
+    return result;
+  }
+  if (num_prtns == 1) {
+    result[0] = batch;
+    return result;
+  }
+
+  std::vector<Datum> key_columns(key_ids.size());
+  for (size_t i = 0; i < key_columns.size(); ++i) {
+    key_columns[i] = batch[key_ids[i]];
+  }
+  const bool attach_hashes =
+      std::all_of(key_columns.begin(), key_columns.end(),
+                  [](const Datum& key) { return key.is_array(); });
+
+  // Use the hashes computed upstream if they are the hashes of the same keys
+  std::vector<uint32_t> computed_hashes;
+  const uint32_t* hashes;
+  if (batch.key_hashes && batch.key_hashes->Matches(KeyHashes::HASHING32, key_columns)) {
+    hashes = batch.key_hashes->hashes32();
+  } else {
+    for (auto& key : key_columns) {
+      if (key.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(key, MakeArrayFromScalar(*key.scalar(), batch.length,
+                                                       ctx->memory_pool()));
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch, ExecBatch::Make(std::move(key_columns)));
+
+    util::TempVectorStack stack;
+    RETURN_NOT_OK(stack.Init(ctx->memory_pool(),
+                             4 * util::MiniBatch::kMiniBatchLength * sizeof(uint32_t)));
+    computed_hashes.resize(batch.length);
+    RETURN_NOT_OK(Hashing32::HashBatch(key_batch, computed_hashes.data(),
+                                       ctx->cpu_info()->hardware_flags(), &stack, 0,
+                                       batch.length));
+    hashes = computed_hashes.data();
+  }
+
+  // Bucket sort row ids on partition id.  PartitionSort works on at most 2^15 rows at a
+  // time, so large batches are sorted in slices whose results are then gathered
+  // partition by partition.
+  constexpr int64_t kMaxRowsPerSort = 1 << 15;
+  std::vector<std::vector<int32_t>> row_ids(num_prtns);
+  std::vector<uint16_t> prtn_ranges(num_prtns + 1);
+  std::vector<uint16_t> sorted(std::min(batch.length, kMaxRowsPerSort));
+  for (int64_t start = 0; start < batch.length; start += kMaxRowsPerSort) {
+    int64_t length = std::min(batch.length - start, kMaxRowsPerSort);
+    const uint32_t* slice_hashes = hashes + start;
+    PartitionSort::Eval(
+        length, num_prtns, prtn_ranges.data(),
+        [&](int64_t row_id) { return HashPartitionId(slice_hashes[row_id], num_prtns); },
+        [&](int64_t row_id, int pos) { sorted[pos] = static_cast<uint16_t>(row_id); });
+    for (int prtn = 0; prtn < num_prtns; ++prtn) {
+      for (int pos = prtn_ranges[prtn]; pos < prtn_ranges[prtn + 1]; ++pos) {
+        row_ids[prtn].push_back(static_cast<int32_t>(start + sorted[pos]));
+      }
+    }
+  }
+
+  // Gather all rows in partition order with a single take and slice the result.
+  std::vector<int32_t> permutation;
+  permutation.reserve(batch.length);
+  for (const auto& ids : row_ids) {
+    permutation.insert(permutation.end(), ids.begin(), ids.end());
+  }
+  auto indices = std::make_shared<Int32Array>(batch.length, Buffer::Wrap(permutation));
+  ExecBatch permuted({}, batch.length);
+  permuted.values.resize(batch.values.size());
+  for (size_t i = 0; i < batch.values.size(); ++i) {
+    if (batch.values[i].is_scalar()) {
+      permuted.values[i] = batch.values[i];
+    } else {
+      ARROW_ASSIGN_OR_RAISE(permuted.values[i], Take(batch.values[i], indices,
+                                                     TakeOptions::NoBoundsCheck(), ctx));
+    }
+  }
+  if (attach_hashes) {
+    // Pass the hashes on with the partitions, for downstream nodes hashing the keys
+    ARROW_ASSIGN_OR_RAISE(
+        std::unique_ptr<Buffer> permuted_hashes,
+        AllocateBuffer(batch.length * sizeof(uint32_t), ctx->memory_pool()));
+    auto permuted_data = reinterpret_cast<uint32_t*>(permuted_hashes->mutable_data());
+    for (int64_t i = 0; i < batch.length; ++i) {
+      permuted_data[i] = hashes[permutation[i]];
+    }
+    auto key_hashes = std::make_shared<KeyHashes>();
+    key_hashes->hashes = std::move(permuted_hashes);
+    for (int key_id : key_ids) {
+      key_hashes->keys.push_back(permuted.values[key_id].array());
+    }
+    permuted.key_hashes = std::move(key_hashes);
+  }
+
+  int64_t offset = 0;
+  for (int prtn = 0; prtn < num_prtns; ++prtn) {
+    int64_t length = static_cast<int64_t>(row_ids[prtn].size());
+    if (length > 0) {
+      result[prtn] = permuted.Slice(offset, length);
+    }
+    offset += length;
+  }
+  return result;
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -22,8 +22,11 @@
 #include <cstdint>
 #include <functional>
 #include <random>
+#include <vector>
 #include "arrow/buffer.h"
+#include "arrow/compute/exec.h"
 #include "arrow/compute/exec/util.h"
+#include "arrow/result.h"
 #include "arrow/util/pcg_random.h"
 
 namespace arrow {
@@ -87,6 +90,23 @@ class PartitionSort {
   }
 };
 
+/// \brief Hash partition the rows of a batch on a set of key columns
+///
+/// Rows are assigned to partitions by their Hashing32 key hash, remixed and scaled to
+/// the number of partitions.  The remix leaves the high bits of the hashes, which hash
+/// tables use to select blocks, evenly spread within each partition.  Batches with the
+/// same key types send rows with equal keys to partitions with the same index.
+///
+/// Returns one batch per partition, of length zero for partitions without rows.  The
+/// batches are slices of a single permutation of `batch`.
+///
+/// The key hashes of `batch` are used instead of hashing the keys if they match them.
+/// If no key is a scalar, the output batches carry the hashes of their keys, see
+/// ExecBatch::key_hashes.
+ARROW_EXPORT Result<std::vector<ExecBatch>> HashPartitionBatch(
+    ExecContext* ctx, const ExecBatch& batch, const std::vector<int>& key_ids,
+    int num_prtns);
+
 /// \brief A control for synchronizing threads on a partitionable workload
 class PartitionLocks {
  public:
@@ -0,0 +1,814 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/exec/plan_optimizer.h"
+
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "arrow/compute/exec/hash_join.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/make_unique.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+class SourceRulesRegistry {
+ public:
+  static SourceRulesRegistry* Get() {
+    static SourceRulesRegistry registry;
+    return &registry;
+  }
+
+  Status Add(const std::string& factory_name, SourceOptimizerRules rules) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!rules_.emplace(factory_name, std::move(rules)).second) {
+      return Status::KeyError("Optimizer rules for ", factory_name,
+                              " already registered");
+    }
+    return Status::OK();
+  }
+
+  // Entries are never removed, so the rules stay valid
+  const SourceOptimizerRules* Find(const std::string& factory_name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = rules_.find(factory_name);
+    return it == rules_.end() ? nullptr : &it->second;
+  }
+
+ private:
+  SourceRulesRegistry() {
+    SourceOptimizerRules source;
+    source.output_schema =
+        [](const ExecNodeOptions& options) -> Result<std::shared_ptr<Schema>> {
+      return checked_cast<const SourceNodeOptions&>(options).output_schema;
+    };
+    rules_.emplace("source", std::move(source));
+
+    SourceOptimizerRules table_source;
+    table_source.output_schema =
+        [](const ExecNodeOptions& options) -> Result<std::shared_ptr<Schema>> {
+      const auto& table = checked_cast<const TableSourceNodeOptions&>(options).table;
+      if (table == nullptr) return nullptr;
+      return table->schema();
+    };
+    table_source.estimate_rows =
+        [](const ExecNodeOptions& options) -> util::optional<int64_t> {
+      const auto& table = checked_cast<const TableSourceNodeOptions&>(options).table;
+      if (table == nullptr) return util::nullopt;
+      return table->num_rows();
+    };
+    rules_.emplace("table_source", std::move(table_source));
+  }
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, SourceOptimizerRules> rules_;
+};
+
+const Declaration* GetDeclaration(const Declaration::Input& input) {
+  return util::get_if<Declaration>(&input);
+}
+
+Declaration* GetDeclaration(Declaration::Input* input) {
+  return util::get_if<Declaration>(input);
+}
+
+// Whether the declaration is of the given kind and has a single declaration input
+bool IsUnaryOver(const Declaration& decl, const char* factory_name) {
+  return decl.factory_name == factory_name && decl.options != nullptr &&
+         decl.inputs.size() == 1 && GetDeclaration(decl.inputs[0]) != nullptr;
+}
+
+Result<std::shared_ptr<Schema>> InputSchema(const Declaration::Input& input) {
+  if (auto decl = GetDeclaration(input)) return DeclarationOutputSchema(*decl);
+  return util::get<ExecNode*>(input)->output_schema();
+}
+
+// The schemas of a hash join, or null if they can't be determined
+struct JoinSchemas {
+  std::shared_ptr<Schema> inputs[2];
+  std::shared_ptr<Schema> output;
+  HashJoinSchema schema_mgr;
+};
+
+Result<std::unique_ptr<JoinSchemas>> GetJoinSchemas(const Declaration& decl) {
+  if (decl.options == nullptr || decl.inputs.size() != 2) return nullptr;
+  const auto& options = checked_cast<const HashJoinNodeOptions&>(*decl.options);
+  auto schemas = ::arrow::internal::make_unique<JoinSchemas>();
+  for (int side = 0; side < 2; ++side) {
+    ARROW_ASSIGN_OR_RAISE(schemas->inputs[side], InputSchema(decl.inputs[side]));
+    if (schemas->inputs[side] == nullptr) return nullptr;
+  }
+  Status st;
+  if (options.output_all) {
+    st = schemas->schema_mgr.Init(options.join_type, *schemas->inputs[0],
+                                  options.left_keys, *schemas->inputs[1],
+                                  options.right_keys, options.filter,
+                                  options.output_suffix_for_left,
+                                  options.output_suffix_for_right);
+  } else {
+    st = schemas->schema_mgr.Init(options.join_type, *schemas->inputs[0],
+                                  options.left_keys, options.left_output,
+                                  *schemas->inputs[1], options.right_keys,
+                                  options.right_output, options.filter,
+                                  options.output_suffix_for_left,
+                                  options.output_suffix_for_right);
+  }
+  // The node will report the error when it's added to a plan
+  if (!st.ok()) return nullptr;
+  schemas->output = schemas->schema_mgr.MakeOutputSchema(options.output_suffix_for_left,
+                                                         options.output_suffix_for_right);
+  return std::move(schemas);
+}
+
+void SplitConjunction(const Expression& expr, std::vector<Expression>* members) {
+  if (auto call = expr.call()) {
+    if (call->function_name == "and_kleene" || call->function_name == "and") {
+      for (const auto& argument : call->arguments) {
+        SplitConjunction(argument, members);
+      }
+      return;
+    }
+  }
+  if (expr == literal(true)) return;
+  members->push_back(expr);
+}
+
+bool IsDeterministic(const Expression& expr) {
+  auto call = expr.call();
+  if (call == nullptr) return true;
+  if (call->function_name == "random") return false;
+  for (const auto& argument : call->arguments) {
+    if (!IsDeterministic(argument)) return false;
+  }
+  return true;
+}
+
+// Whether the expression can be evaluated on any rows without failing, so that it may
+// be moved below a node which drops rows it would not have seen
+bool CanEvaluateOnAnyRows(const Expression& expr) {
+  static const std::unordered_set<std::string> kTotalFunctions = {
+      "equal", "not_equal", "less", "less_equal", "greater", "greater_equal",
+      "and", "and_kleene", "or", "or_kleene", "and_not", "and_not_kleene", "xor",
+      "invert", "is_null", "is_valid", "is_nan", "is_finite", "is_inf",
+      "true_unless_null", "is_in", "starts_with", "ends_with", "match_like",
+      "match_substring", "add", "subtract", "multiply", "negate", "abs"};
+  auto call = expr.call();
+  if (call == nullptr) return true;
+  if (kTotalFunctions.count(call->function_name) == 0) return false;
+  for (const auto& argument : call->arguments) {
+    if (!CanEvaluateOnAnyRows(argument)) return false;
+  }
+  return true;
+}
+
+// Rebuild an expression with its field references replaced. `replace` sets `*ok` to
+// false if a reference can't be replaced.
+template <typename Replace>
+Expression ReplaceFieldRefs(const Expression& expr, Replace&& replace, bool* ok) {
+  if (auto ref = expr.field_ref()) return replace(*ref, ok);
+  auto call = expr.call();
+  if (call == nullptr) return expr;
+  std::vector<Expression> arguments;
+  for (const auto& argument : call->arguments) {
+    arguments.push_back(ReplaceFieldRefs(argument, replace, ok));
+  }
+  return compute::call(call->function_name, std::move(arguments), call->options);
+}
+
+// The top-level column a reference to a whole column resolves to, or -1
+int ResolveColumn(const FieldRef& ref, const Schema& schema) {
+  auto maybe_path = ref.FindOne(schema);
+  if (!maybe_path.ok() || maybe_path->indices().size() != 1) return -1;
+  return maybe_path->indices()[0];
+}
+
+// The top-level column containing the referenced field, or -1
+int ResolveTopLevelColumn(const FieldRef& ref, const Schema& schema) {
+  auto maybe_path = ref.FindOne(schema);
+  if (!maybe_path.ok() || maybe_path->indices().empty()) return -1;
+  return maybe_path->indices()[0];
+}
+
+// Refer to a top-level column by name if it's unique, else by position
+FieldRef ColumnRef(const Schema& schema, int i) {
+  const auto& name = schema.field(i)->name();
+  if (schema.GetFieldIndex(name) == i) return FieldRef(name);
+  return FieldRef(i);
+}
+
+template <typename Options>
+Declaration MakeUnary(std::string factory_name, Declaration input, Options options) {
+  std::vector<Declaration::Input> inputs;
+  inputs.emplace_back(std::move(input));
+  return Declaration{std::move(factory_name), std::move(inputs), std::move(options)};
+}
+
+Declaration MakeFilter(Declaration input, const std::vector<Expression>& members) {
+  if (members.empty()) return input;
+  return MakeUnary("filter", std::move(input), FilterNodeOptions(and_(members)));
+}
+
+class Optimizer {
+ public:
+  explicit Optimizer(const PlanOptimizerOptions& options)
+      : options_(options), registry_(SourceRulesRegistry::Get()) {}
+
+  Result<Declaration> Optimize(Declaration decl) {
+    if (options_.push_down_filters) {
+      ARROW_ASSIGN_OR_RAISE(decl, PushDownFilters(std::move(decl)));
+    }
+    if (options_.push_down_limits) {
+      ARROW_ASSIGN_OR_RAISE(decl, PushDownLimits(std::move(decl)));
+    }
+    if (options_.choose_join_build_side) {
+      ARROW_ASSIGN_OR_RAISE(decl, ChooseBuildSides(std::move(decl)));
+    }
+    if (options_.prune_columns) {
+      ARROW_ASSIGN_OR_RAISE(decl, PruneColumns(std::move(decl), UsedColumns{}));
+    }
+    return decl;
+  }
+
+ private:
+  const SourceOptimizerRules* FindSourceRules(const Declaration& decl) {
+    if (!decl.inputs.empty() || decl.options == nullptr) return nullptr;
+    return registry_->Find(decl.factory_name);
+  }
+
+  template <typename Visit>
+  Result<Declaration> VisitInputs(Declaration decl, Visit&& visit) {
+    for (auto& input : decl.inputs) {
+      if (auto input_decl = GetDeclaration(&input)) {
+        ARROW_ASSIGN_OR_RAISE(*input_decl, visit(std::move(*input_decl)));
+      }
+    }
+    return decl;
+  }
+
+  // Filter pushdown
+
+  Result<Declaration> PushDownFilters(Declaration decl) {
+    if (IsUnaryOver(decl, "filter")) {
+      const auto& options = checked_cast<const FilterNodeOptions&>(*decl.options);
+      std::vector<Expression> members;
+      SplitConjunction(options.filter_expression, &members);
+      return PushDown(std::move(util::get<Declaration>(decl.inputs[0])),
+                      std::move(members));
+    }
+    return VisitInputs(std::move(decl), [this](Declaration input) {
+      return PushDownFilters(std::move(input));
+    });
+  }
+
+  // The declaration filtered by the conjunction of `members`, with the members moved
+  // as far down as possible
+  Result<Declaration> PushDown(Declaration decl, std::vector<Expression> members) {
+    if (members.empty()) return PushDownFilters(std::move(decl));
+    if (IsUnaryOver(decl, "filter")) {
+      // Only members which may see the rows the inner filter drops are merged into it
+      std::vector<Expression> merged, kept;
+      for (auto& member : members) {
+        (CanEvaluateOnAnyRows(member) ? merged : kept).push_back(std::move(member));
+      }
+      const auto& options = checked_cast<const FilterNodeOptions&>(*decl.options);
+      SplitConjunction(options.filter_expression, &merged);
+      ARROW_ASSIGN_OR_RAISE(auto input,
+                            PushDown(std::move(util::get<Declaration>(decl.inputs[0])),
+                                     std::move(merged)));
+      return MakeFilter(std::move(input), kept);
+    }
+    if (IsUnaryOver(decl, "project")) {
+      return PushIntoProject(std::move(decl), std::move(members));
+    }
+    if (decl.factory_name == "hashjoin") {
+      return PushIntoJoin(std::move(decl), std::move(members));
+    }
+    if (decl.factory_name == "union") {
+      return PushIntoUnion(std::move(decl), std::move(members));
+    }
+    if (auto rules = FindSourceRules(decl)) {
+      if (rules->push_filter && rules->output_schema) {
+        return PushIntoSource(*rules, std::move(decl), std::move(members));
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(decl, PushDownFilters(std::move(decl)));
+    return MakeFilter(std::move(decl), members);
+  }
+
+  // A project computes its outputs row by row, so the members may be evaluated on its
+  // input instead, with the projected expressions in place of the references
+  Result<Declaration> PushIntoProject(Declaration decl, std::vector<Expression> members) {
+    ARROW_ASSIGN_OR_RAISE(auto output_schema, DeclarationOutputSchema(decl));
+    std::vector<Expression> pushed, kept;
+    if (output_schema != nullptr) {
+      const auto& options = checked_cast<const ProjectNodeOptions&>(*decl.options);
+      for (auto& member : members) {
+        bool ok = true;
+        auto substituted = ReplaceFieldRefs(
+            member,
+            [&](const FieldRef& ref, bool* ok) -> Expression {
+              int i = ResolveColumn(ref, *output_schema);
+              if (i < 0 || !IsDeterministic(options.expressions[i])) {
+                *ok = false;
+                return field_ref(ref);
+              }
+              return options.expressions[i];
+            },
+            &ok);
+        if (ok) {
+          pushed.push_back(std::move(substituted));
+        } else {
+          kept.push_back(std::move(member));
+        }
+      }
+    } else {
+      kept = std::move(members);
+    }
+    auto input = GetDeclaration(&decl.inputs[0]);
+    ARROW_ASSIGN_OR_RAISE(*input, PushDown(std::move(*input), std::move(pushed)));
+    return MakeFilter(std::move(decl), kept);
+  }
+
+  // Members referring to the columns of a single input are pushed into it when the join
+  // keeps no rows of that input which fail them
+  Result<Declaration> PushIntoJoin(Declaration decl, std::vector<Expression> members) {
+    ARROW_ASSIGN_OR_RAISE(auto schemas, GetJoinSchemas(decl));
+    if (schemas == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(decl, PushDownFilters(std::move(decl)));
+      return MakeFilter(std::move(decl), members);
+    }
+    const auto join_type =
+        checked_cast<const HashJoinNodeOptions&>(*decl.options).join_type;
+    const bool can_push[2] = {
+        join_type == JoinType::INNER || join_type == JoinType::LEFT_OUTER ||
+            join_type == JoinType::LEFT_SEMI || join_type == JoinType::LEFT_ANTI,
+        join_type == JoinType::INNER || join_type == JoinType::RIGHT_OUTER ||
+            join_type == JoinType::RIGHT_SEMI || join_type == JoinType::RIGHT_ANTI};
+    SchemaProjectionMap to_input[2];
+    for (int side = 0; side < 2; ++side) {
+      to_input[side] = schemas->schema_mgr.proj_maps[side].map(HashJoinProjection::OUTPUT,
+                                                               HashJoinProjection::INPUT);
+    }
+
+    std::vector<Expression> pushed[2], kept;
+    for (auto& member : members) {
+      int side = -1;
+      bool ok = CanEvaluateOnAnyRows(member) && IsDeterministic(member);
+      Expression rewritten;
+      if (ok) {
+        rewritten = ReplaceFieldRefs(
+            member,
+            [&](const FieldRef& ref, bool* ok) -> Expression {
+              int i = ResolveColumn(ref, *schemas->output);
+              int ref_side = i < to_input[0].num_cols ? 0 : 1;
+              if (i < 0 || (side >= 0 && side != ref_side)) {
+                *ok = false;
+                return field_ref(ref);
+              }
+              side = ref_side;
+              if (ref_side == 1) i -= to_input[0].num_cols;
+              return field_ref(
+                  ColumnRef(*schemas->inputs[side], to_input[side].get(i)));
+            },
+            &ok);
+      }
+      if (ok && side >= 0 && can_push[side] && GetDeclaration(decl.inputs[side])) {
+        pushed[side].push_back(std::move(rewritten));
+      } else {
+        kept.push_back(std::move(member));
+      }
+    }
+    for (int side = 0; side < 2; ++side) {
+      if (auto input = GetDeclaration(&decl.inputs[side])) {
+        ARROW_ASSIGN_OR_RAISE(*input,
+                              PushDown(std::move(*input), std::move(pushed[side])));
+      }
+    }
+    return MakeFilter(std::move(decl), kept);
+  }
+
+  // A union outputs the rows of its inputs unchanged, so every input is filtered
+  Result<Declaration> PushIntoUnion(Declaration decl, std::vector<Expression> members) {
+    bool all_declarations = !decl.inputs.empty();
+    for (const auto& input : decl.inputs) {
+      all_declarations &= GetDeclaration(input) != nullptr;
+    }
+    if (!all_declarations) {
+      ARROW_ASSIGN_OR_RAISE(decl, PushDownFilters(std::move(decl)));
+      return MakeFilter(std::move(decl), members);
+    }
+    for (auto& input : decl.inputs) {
+      auto input_decl = GetDeclaration(&input);
+      ARROW_ASSIGN_OR_RAISE(*input_decl, PushDown(std::move(*input_decl), members));
+    }
+    return decl;
+  }
+
+  // The source may skip data using the members, which are still applied above it
+  Result<Declaration> PushIntoSource(const SourceOptimizerRules& rules, Declaration decl,
+                                     std::vector<Expression> members) {
+    ARROW_ASSIGN_OR_RAISE(auto output_schema, rules.output_schema(*decl.options));
+    std::vector<Expression> pushed;
+    if (output_schema != nullptr) {
+      for (const auto& member : members) {
+        if (!CanEvaluateOnAnyRows(member) || !IsDeterministic(member)) continue;
+        bool ok = true;
+        auto rewritten = ReplaceFieldRefs(
+            member,
+            [&](const FieldRef& ref, bool* ok) -> Expression {
+              int i = ResolveColumn(ref, *output_schema);
+              if (i < 0 ||
+                  output_schema->GetFieldIndex(output_schema->field(i)->name()) != i) {
+                *ok = false;
+                return field_ref(ref);
+              }
+              return field_ref(output_schema->field(i)->name());
+            },
+            &ok);
+        if (ok) pushed.push_back(std::move(rewritten));
+      }
+    }
+    if (!pushed.empty()) {
+      ARROW_ASSIGN_OR_RAISE(auto options, rules.push_filter(*decl.options, and_(pushed)));
+      if (options != nullptr) decl.options = std::move(options);
+    }
+    return MakeFilter(std::move(decl), members);
+  }
+
+  // Limit pushdown
+
+  Result<Declaration> PushDownLimits(Declaration decl) {
+    if (IsUnaryOver(decl, "fetch")) {
+      const auto& fetch = checked_cast<const FetchNodeOptions&>(*decl.options);
+      auto input = GetDeclaration(&decl.inputs[0]);
+      if (IsUnaryOver(*input, "project")) {
+        // fetch(project(x)) -> project(fetch(x))
+        Declaration project = std::move(*input);
+        decl.inputs[0] = std::move(project.inputs[0]);
+        ARROW_ASSIGN_OR_RAISE(project.inputs[0], PushDownLimits(std::move(decl)));
+        return project;
+      }
+      if (IsUnaryOver(*input, "fetch")) {
+        const auto& inner = checked_cast<const FetchNodeOptions&>(*input->options);
+        int64_t offset = inner.offset + std::min(fetch.offset,
+                                                 std::numeric_limits<int64_t>::max() -
+                                                     inner.offset);
+        int64_t count = std::max<int64_t>(
+            0, std::min(fetch.offset >= inner.count ? 0 : inner.count - fetch.offset,
+                        fetch.count));
+        Declaration merged{"fetch", std::move(input->inputs),
+                           FetchNodeOptions(offset, count), std::move(decl.label)};
+        return PushDownLimits(std::move(merged));
+      }
+      if (input->factory_name == "union") {
+        // Any offset + count rows of the inputs are a valid input to the fetch
+        int64_t bound = fetch.offset + std::min(fetch.count,
+                                                std::numeric_limits<int64_t>::max() -
+                                                    fetch.offset);
+        for (auto& union_input : input->inputs) {
+          if (auto union_input_decl = GetDeclaration(&union_input)) {
+            *union_input_decl = MakeUnary("fetch", std::move(*union_input_decl),
+                                          FetchNodeOptions(0, bound));
+          }
+        }
+      }
+    }
+    return VisitInputs(std::move(decl), [this](Declaration input) {
+      return PushDownLimits(std::move(input));
+    });
+  }
+
+  // Join build side selection
+
+  util::optional<int64_t> EstimateRows(const Declaration::Input& input) {
+    auto decl = GetDeclaration(input);
+    if (decl == nullptr) return util::nullopt;
+    if (options_.estimate_rows) {
+      auto estimate = options_.estimate_rows(*decl);
+      if (estimate.has_value()) return estimate;
+    }
+    if (auto rules = FindSourceRules(*decl)) {
+      if (rules->estimate_rows) return rules->estimate_rows(*decl->options);
+      return util::nullopt;
+    }
+    const auto& kind = decl->factory_name;
+    if (decl->inputs.empty() || decl->options == nullptr) return util::nullopt;
+    if (kind == "union") {
+      int64_t sum = 0;
+      for (const auto& union_input : decl->inputs) {
+        auto estimate = EstimateRows(union_input);
+        if (!estimate.has_value()) return util::nullopt;
+        sum += *estimate;
+      }
+      return sum;
+    }
+    if (kind == "hashjoin" && decl->inputs.size() == 2) {
+      auto left = EstimateRows(decl->inputs[0]);
+      auto right = EstimateRows(decl->inputs[1]);
+      switch (checked_cast<const HashJoinNodeOptions&>(*decl->options).join_type) {
+        case JoinType::LEFT_SEMI:
+        case JoinType::LEFT_ANTI:
+          return left;
+        case JoinType::RIGHT_SEMI:
+        case JoinType::RIGHT_ANTI:
+          return right;
+        default:
+          if (!left.has_value() || !right.has_value()) return util::nullopt;
+          return std::max(*left, *right);
+      }
+    }
+    auto input_rows = EstimateRows(decl->inputs[0]);
+    if (!input_rows.has_value()) return util::nullopt;
+    if (kind == "filter") return *input_rows / 2;
+    if (kind == "project") return input_rows;
+    if (kind == "fetch") {
+      return std::min(*input_rows,
+                      checked_cast<const FetchNodeOptions&>(*decl->options).count);
+    }
+    if (kind == "aggregate") {
+      const auto& options = checked_cast<const AggregateNodeOptions&>(*decl->options);
+      if (options.keys.empty()) return 1;
+      return input_rows;
+    }
+    return util::nullopt;
+  }
+
+  // Swap the inputs of a hash join whose right (build) input is estimated to output
+  // more rows than its left (probe) input
+  Result<Declaration> ChooseBuildSides(Declaration decl) {
+    ARROW_ASSIGN_OR_RAISE(decl, VisitInputs(std::move(decl), [this](Declaration input) {
+                            return ChooseBuildSides(std::move(input));
+                          }));
+    if (decl.factory_name != "hashjoin" || decl.options == nullptr ||
+        decl.inputs.size() != 2) {
+      return decl;
+    }
+    const auto& options = checked_cast<const HashJoinNodeOptions&>(*decl.options);
+    // The node picks the build side itself
+    if (options.adaptive_build_side) return decl;
+    for (const FieldRef& ref : FieldsInExpression(options.filter)) {
+      if (!ref.IsName()) return decl;
+    }
+    auto left_rows = EstimateRows(decl.inputs[0]);
+    auto right_rows = EstimateRows(decl.inputs[1]);
+    if (!left_rows.has_value() || !right_rows.has_value() || *right_rows <= *left_rows) {
+      return decl;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto schemas, GetJoinSchemas(decl));
+    if (schemas == nullptr) return decl;
+
+    auto swapped = std::make_shared<HashJoinNodeOptions>(options);
+    swapped->join_type = MirrorJoinType(options.join_type);
+    std::swap(swapped->left_keys, swapped->right_keys);
+    std::swap(swapped->left_output, swapped->right_output);
+    std::swap(swapped->output_suffix_for_left, swapped->output_suffix_for_right);
+    std::vector<Declaration::Input> inputs;
+    inputs.push_back(std::move(decl.inputs[1]));
+    inputs.push_back(std::move(decl.inputs[0]));
+    Declaration join{"hashjoin", std::move(inputs),
+                     std::shared_ptr<ExecNodeOptions>(std::move(swapped)),
+                     std::move(decl.label)};
+
+    // Restore the order of the output columns
+    const auto& proj_maps = schemas->schema_mgr.proj_maps;
+    int num_left = proj_maps[0].num_cols(HashJoinProjection::OUTPUT);
+    int num_right = proj_maps[1].num_cols(HashJoinProjection::OUTPUT);
+    if (num_left == 0 || num_right == 0) return join;
+    std::vector<Expression> exprs;
+    for (int i = 0; i < num_left; ++i) exprs.push_back(field_ref(num_right + i));
+    for (int i = 0; i < num_right; ++i) exprs.push_back(field_ref(i));
+    auto names = schemas->output->field_names();
+    return MakeUnary("project", std::move(join),
+                     ProjectNodeOptions(std::move(exprs), std::move(names)));
+  }
+
+  // Column pruning
+
+  // The output columns of a declaration which are used; all of them unless `columns`
+  // is set
+  struct UsedColumns {
+    util::optional<std::vector<bool>> columns;
+
+    static UsedColumns None(int num_columns) {
+      UsedColumns used;
+      used.columns = std::vector<bool>(num_columns, false);
+      return used;
+    }
+
+    bool all() const { return !columns.has_value(); }
+    bool used(int i) const { return all() || (*columns)[i]; }
+
+    void Mark(const FieldRef& ref, const Schema& schema) {
+      if (all()) return;
+      int i = ResolveTopLevelColumn(ref, schema);
+      if (i < 0) {
+        columns.reset();
+      } else {
+        (*columns)[i] = true;
+      }
+    }
+
+    void Mark(const Expression& expr, const Schema& schema) {
+      for (const auto& ref : FieldsInExpression(expr)) Mark(ref, schema);
+    }
+  };
+
+  Result<Declaration> PruneInput(Declaration decl, int i, UsedColumns used) {
+    if (auto input = GetDeclaration(&decl.inputs[i])) {
+      ARROW_ASSIGN_OR_RAISE(*input, PruneColumns(std::move(*input), std::move(used)));
+    }
+    return decl;
+  }
+
+  Result<Declaration> PruneColumns(Declaration decl, UsedColumns used) {
+    const auto& kind = decl.factory_name;
+    if (decl.options == nullptr) return PruneAllInputs(std::move(decl));
+
+    if (IsUnaryOver(decl, "fetch")) return PruneInput(std::move(decl), 0, used);
+
+    if (IsUnaryOver(decl, "filter")) {
+      if (!used.all()) {
+        ARROW_ASSIGN_OR_RAISE(auto schema, InputSchema(decl.inputs[0]));
+        if (schema == nullptr) {
+          used = UsedColumns{};
+        } else {
+          used.Mark(
+              checked_cast<const FilterNodeOptions&>(*decl.options).filter_expression,
+              *schema);
+        }
+      }
+      return PruneInput(std::move(decl), 0, std::move(used));
+    }
+
+    if (IsUnaryOver(decl, "project")) {
+      ARROW_ASSIGN_OR_RAISE(auto input_schema, InputSchema(decl.inputs[0]));
+      if (input_schema == nullptr) return PruneAllInputs(std::move(decl));
+      auto options = std::make_shared<ProjectNodeOptions>(
+          checked_cast<const ProjectNodeOptions&>(*decl.options));
+      if (!used.all() && options->names.empty()) {
+        for (const auto& expr : options->expressions) {
+          options->names.push_back(expr.ToString());
+        }
+      }
+      auto input_used = UsedColumns::None(input_schema->num_fields());
+      for (size_t i = 0; i < options->expressions.size(); ++i) {
+        auto& expr = options->expressions[i];
+        if (!used.used(static_cast<int>(i)) && expr.literal() == nullptr) {
+          // Compute a null of the same type instead
+          auto maybe_bound = expr.Bind(*input_schema);
+          if (maybe_bound.ok()) {
+            expr = literal(MakeNullScalar(maybe_bound->type()));
+            continue;
+          }
+        }
+        input_used.Mark(expr, *input_schema);
+      }
+      decl.options = std::move(options);
+      return PruneInput(std::move(decl), 0, std::move(input_used));
+    }
+
+    if (kind == "hashjoin") {
+      ARROW_ASSIGN_OR_RAISE(auto schemas, GetJoinSchemas(decl));
+      if (schemas == nullptr) return PruneAllInputs(std::move(decl));
+      const auto& proj_maps = schemas->schema_mgr.proj_maps;
+      int offset = 0;
+      for (int side = 0; side < 2; ++side) {
+        auto input_used = UsedColumns::None(schemas->inputs[side]->num_fields());
+        for (auto handle : {HashJoinProjection::KEY, HashJoinProjection::FILTER}) {
+          auto to_input = proj_maps[side].map(handle, HashJoinProjection::INPUT);
+          for (int i = 0; i < to_input.num_cols; ++i) {
+            (*input_used.columns)[to_input.get(i)] = true;
+          }
+        }
+        auto to_input =
+            proj_maps[side].map(HashJoinProjection::OUTPUT, HashJoinProjection::INPUT);
+        for (int i = 0; i < to_input.num_cols; ++i) {
+          if (used.used(offset + i)) (*input_used.columns)[to_input.get(i)] = true;
+        }
+        offset += to_input.num_cols;
+        ARROW_ASSIGN_OR_RAISE(decl, PruneInput(std::move(decl), side, input_used));
+      }
+      return decl;
+    }
+
+    if (IsUnaryOver(decl, "aggregate")) {
+      ARROW_ASSIGN_OR_RAISE(auto input_schema, InputSchema(decl.inputs[0]));
+      if (input_schema == nullptr) return PruneAllInputs(std::move(decl));
+      const auto& options = checked_cast<const AggregateNodeOptions&>(*decl.options);
+      auto input_used = UsedColumns::None(input_schema->num_fields());
+      for (const auto& key : options.keys) input_used.Mark(key, *input_schema);
+      for (const auto& aggregate : options.aggregates) {
+        input_used.Mark(aggregate.target, *input_schema);
+      }
+      return PruneInput(std::move(decl), 0, std::move(input_used));
+    }
+
+    if (kind == "union") {
+      for (int i = 0; i < static_cast<int>(decl.inputs.size()); ++i) {
+        ARROW_ASSIGN_OR_RAISE(decl, PruneInput(std::move(decl), i, used));
+      }
+      return decl;
+    }
+
+    if (auto rules = FindSourceRules(decl)) {
+      if (rules->prune_columns && !used.all()) {
+        std::vector<int> columns;
+        for (int i = 0; i < static_cast<int>(used.columns->size()); ++i) {
+          if ((*used.columns)[i]) columns.push_back(i);
+        }
+        ARROW_ASSIGN_OR_RAISE(auto options, rules->prune_columns(*decl.options, columns));
+        if (options != nullptr) decl.options = std::move(options);
+      }
+      return decl;
+    }
+
+    return PruneAllInputs(std::move(decl));
+  }
+
+  Result<Declaration> PruneAllInputs(Declaration decl) {
+    return VisitInputs(std::move(decl), [this](Declaration input) {
+      return PruneColumns(std::move(input), UsedColumns{});
+    });
+  }
+
+  const PlanOptimizerOptions& options_;
+  SourceRulesRegistry* registry_;
+};
+
+}  // namespace
+
+Status RegisterSourceOptimizerRules(const std::string& factory_name,
+                                    SourceOptimizerRules rules) {
+  return SourceRulesRegistry::Get()->Add(factory_name, std::move(rules));
+}
+
+Result<Declaration> OptimizeDeclaration(Declaration declaration,
+                                        const PlanOptimizerOptions& options) {
+  return Optimizer(options).Optimize(std::move(declaration));
+}
+
+Result<std::shared_ptr<Schema>> DeclarationOutputSchema(const Declaration& declaration) {
+  const auto& kind = declaration.factory_name;
+  if (declaration.options == nullptr) return nullptr;
+  if (declaration.inputs.empty()) {
+    auto rules = SourceRulesRegistry::Get()->Find(kind);
+    if (rules == nullptr || !rules->output_schema) return nullptr;
+    return rules->output_schema(*declaration.options);
+  }
+  if (kind == "filter" || kind == "fetch" || kind == "union") {
+    return InputSchema(declaration.inputs[0]);
+  }
+  if (kind == "project" && declaration.inputs.size() == 1) {
+    ARROW_ASSIGN_OR_RAISE(auto input_schema, InputSchema(declaration.inputs[0]));
+    if (input_schema == nullptr) return nullptr;
+    const auto& options = checked_cast<const ProjectNodeOptions&>(*declaration.options);
+    if (!options.names.empty() && options.names.size() != options.expressions.size()) {
+      return nullptr;
+    }
+    FieldVector fields;
+    for (size_t i = 0; i < options.expressions.size(); ++i) {
+      const auto& expr = options.expressions[i];
+      auto maybe_bound = expr.Bind(*input_schema);
+      if (!maybe_bound.ok()) return nullptr;
+      fields.push_back(field(options.names.empty() ? expr.ToString() : options.names[i],
+                             maybe_bound->type()));
+    }
+    return schema(std::move(fields));
+  }
+  if (kind == "hashjoin") {
+    ARROW_ASSIGN_OR_RAISE(auto schemas, GetJoinSchemas(declaration));
+    if (schemas == nullptr) return nullptr;
+    return schemas->output;
+  }
+  return nullptr;
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,102 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/expression.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/optional.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+/// \brief How the optimizer treats the declarations of a source node factory
+///
+/// The optimizer knows the nodes of this module. The sources of other modules, such
+/// as the "scan" node of the dataset module, register these rules so that filters and
+/// column selections can be pushed into them. Any of the functions may be left empty.
+struct ARROW_EXPORT SourceOptimizerRules {
+  /// The output schema of the source
+  std::function<Result<std::shared_ptr<Schema>>(const ExecNodeOptions&)> output_schema;
+
+  /// Options of the source which may skip the data failing `filter`, which references
+  /// the output fields by name. The optimizer keeps a filter node above the source, so
+  /// the source need not drop every row failing it. Null if the filter can't be used.
+  std::function<Result<std::shared_ptr<ExecNodeOptions>>(const ExecNodeOptions&,
+                                                         const Expression& filter)>
+      push_filter;
+
+  /// Options of the source which only needs to materialize the given top-level output
+  /// columns; the others may be output as nulls. Null if the columns can't be pruned.
+  std::function<Result<std::shared_ptr<ExecNodeOptions>>(const ExecNodeOptions&,
+                                                         const std::vector<int>& columns)>
+      prune_columns;
+
+  /// An estimate of the number of rows output, if known
+  std::function<util::optional<int64_t>(const ExecNodeOptions&)> estimate_rows;
+};
+
+/// \brief Register the optimizer rules of a source node factory
+///
+/// The rules of "source" and "table_source" are registered by default.
+ARROW_EXPORT
+Status RegisterSourceOptimizerRules(const std::string& factory_name,
+                                    SourceOptimizerRules rules);
+
+struct ARROW_EXPORT PlanOptimizerOptions {
+  /// Move the conjunction members of filters below projects, into the inputs of joins
+  /// and unions, and into sources (e.g. for partition and statistics pruning)
+  bool push_down_filters = true;
+  /// Only materialize the source columns which are used, and compute nulls instead of
+  /// the projected columns which are not
+  bool prune_columns = true;
+  /// Build hash joins on the input with fewer estimated rows
+  bool choose_join_build_side = true;
+  /// Move fetch nodes below projects, and bound the inputs of unions below them
+  bool push_down_limits = true;
+
+  /// Estimates of the number of rows output by declarations, taking precedence over
+  /// the optimizer's own estimates when not null
+  std::function<util::optional<int64_t>(const Declaration&)> estimate_rows;
+};
+
+/// \brief Rewrite a declaration into an equivalent one which is cheaper to execute
+///
+/// The declaration should be optimized before being added to an ExecPlan. Nodes the
+/// optimizer doesn't know are kept as they are, and only the declarations below them
+/// are optimized.
+ARROW_EXPORT
+Result<Declaration> OptimizeDeclaration(
+    Declaration declaration, const PlanOptimizerOptions& options = PlanOptimizerOptions());
+
+/// \brief The output schema of a declaration, or null if it can't be determined
+/// without adding it to a plan
+ARROW_EXPORT
+Result<std::shared_ptr<Schema>> DeclarationOutputSchema(const Declaration& declaration);
+
+}  // namespace compute
+}  // namespace arrow
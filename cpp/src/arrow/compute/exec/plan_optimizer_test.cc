@@ -0,0 +1,278 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include "arrow/api.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/plan_optimizer.h"
+#include "arrow/compute/exec/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+const Declaration& InputOf(const Declaration& decl, int i = 0) {
+  return util::get<Declaration>(decl.inputs[i]);
+}
+
+class PlanOptimizerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    left_ = TableFromJSON(schema({field("lkey", int32()), field("lval", int32())}),
+                          {R"([[1, 10], [2, 20], [3, 30], [4, 40]])"});
+    right_ = TableFromJSON(
+        schema({field("rkey", int32()), field("rval", utf8())}),
+        {R"([[1, "a"], [2, "b"], [2, "c"], [5, "d"], [6, "e"], [7, "f"]])"});
+  }
+
+  Declaration Left() const {
+    return {"table_source", TableSourceNodeOptions(left_, /*max_batch_size=*/2)};
+  }
+  Declaration Right() const {
+    return {"table_source", TableSourceNodeOptions(right_, /*max_batch_size=*/2)};
+  }
+
+  template <typename Options>
+  static Declaration Unary(std::string factory_name, Declaration input, Options options) {
+    return Declaration::Sequence(
+        {std::move(input), {std::move(factory_name), std::move(options)}});
+  }
+
+  template <typename Options>
+  static Declaration Binary(std::string factory_name, Declaration left, Declaration right,
+                            Options options) {
+    std::vector<Declaration::Input> inputs;
+    inputs.emplace_back(std::move(left));
+    inputs.emplace_back(std::move(right));
+    return Declaration{std::move(factory_name), std::move(inputs), std::move(options)};
+  }
+
+  static Declaration Join(JoinType join_type, Declaration left, Declaration right) {
+    return Binary("hashjoin", std::move(left), std::move(right),
+                  HashJoinNodeOptions(join_type, {"lkey"}, {"rkey"}));
+  }
+
+  static Result<std::shared_ptr<Table>> Run(Declaration decl) {
+    ExecContext exec_ctx(default_memory_pool(), nullptr);
+    ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make(&exec_ctx));
+    ARROW_ASSIGN_OR_RAISE(auto output_schema, DeclarationOutputSchema(decl));
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    ARROW_RETURN_NOT_OK(
+        Declaration::Sequence({std::move(decl), {"sink", SinkNodeOptions{&sink_gen}}})
+            .AddToPlan(plan.get()));
+    auto collected = StartAndCollect(plan.get(), sink_gen).result();
+    ARROW_RETURN_NOT_OK(collected.status());
+    ARROW_ASSIGN_OR_RAISE(auto table, TableFromExecBatches(output_schema, *collected));
+    return SortTableOnAllFields(table);
+  }
+
+  // Optimize the declaration, checking that the result computes the same rows
+  Declaration Optimize(const Declaration& decl,
+                       const PlanOptimizerOptions& options = PlanOptimizerOptions()) {
+    EXPECT_OK_AND_ASSIGN(auto optimized, OptimizeDeclaration(decl, options));
+    EXPECT_OK_AND_ASSIGN(auto expected, Run(decl));
+    EXPECT_OK_AND_ASSIGN(auto actual, Run(optimized));
+    if (expected && actual) {
+      AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+    }
+    return optimized;
+  }
+
+  std::shared_ptr<Table> left_, right_;
+};
+
+TEST_F(PlanOptimizerTest, FilterBelowProject) {
+  auto decl = Unary(
+      "filter",
+      Unary("project", Left(),
+            ProjectNodeOptions(
+                std::vector<Expression>{
+                    call("multiply", {field_ref("lval"), literal(2)}),
+                    field_ref("lkey")},
+                std::vector<std::string>{"doubled", "key"})),
+      FilterNodeOptions(greater(field_ref("doubled"), literal(30))));
+
+  auto optimized = Optimize(decl);
+  ASSERT_EQ(optimized.factory_name, "project");
+  const auto& filter = InputOf(optimized);
+  ASSERT_EQ(filter.factory_name, "filter");
+  ASSERT_EQ(checked_cast<const FilterNodeOptions&>(*filter.options).filter_expression,
+            greater(call("multiply", {field_ref("lval"), literal(2)}), literal(30)));
+  ASSERT_EQ(InputOf(filter).factory_name, "table_source");
+}
+
+TEST_F(PlanOptimizerTest, FilterIntoJoinInputs) {
+  PlanOptimizerOptions options;
+  options.choose_join_build_side = false;
+
+  auto decl = Unary("filter", Join(JoinType::INNER, Left(), Right()),
+                    FilterNodeOptions(
+                        and_(greater(field_ref("lval"), literal(15)),
+                             equal(field_ref("rval"), literal("b")))));
+  auto optimized = Optimize(decl, options);
+  ASSERT_EQ(optimized.factory_name, "hashjoin");
+  for (int side = 0; side < 2; ++side) {
+    ASSERT_EQ(InputOf(optimized, side).factory_name, "filter");
+  }
+
+  // The right rows failing the filter are still output by a left outer join
+  decl = Unary("filter", Join(JoinType::LEFT_OUTER, Left(), Right()),
+               FilterNodeOptions(
+                   and_(greater(field_ref("lval"), literal(15)),
+                        is_null(field_ref("rval")))));
+  optimized = Optimize(decl, options);
+  ASSERT_EQ(optimized.factory_name, "filter");
+  ASSERT_EQ(checked_cast<const FilterNodeOptions&>(*optimized.options).filter_expression,
+            is_null(field_ref("rval")));
+  const auto& join = InputOf(optimized);
+  ASSERT_EQ(InputOf(join, 0).factory_name, "filter");
+  ASSERT_EQ(InputOf(join, 1).factory_name, "table_source");
+}
+
+TEST_F(PlanOptimizerTest, FailingMembersStayAbove) {
+  // The division must not see the rows dropped by the inner filter
+  auto decl = Unary(
+      "filter",
+      Unary("filter", Left(),
+            FilterNodeOptions(not_equal(field_ref("lkey"), literal(2)))),
+      FilterNodeOptions(and_(
+          greater(call("divide", {field_ref("lval"), field_ref("lkey")}), literal(5)),
+          less(field_ref("lval"), literal(40)))));
+
+  auto optimized = Optimize(decl);
+  ASSERT_EQ(optimized.factory_name, "filter");
+  ASSERT_EQ(
+      checked_cast<const FilterNodeOptions&>(*optimized.options).filter_expression,
+      greater(call("divide", {field_ref("lval"), field_ref("lkey")}), literal(5)));
+  const auto& inner = InputOf(optimized);
+  ASSERT_EQ(inner.factory_name, "filter");
+  ASSERT_EQ(checked_cast<const FilterNodeOptions&>(*inner.options).filter_expression,
+            and_(less(field_ref("lval"), literal(40)),
+                 not_equal(field_ref("lkey"), literal(2))));
+}
+
+TEST_F(PlanOptimizerTest, PruneProjectedColumns) {
+  auto decl = Unary(
+      "project",
+      Unary("project", Left(),
+            ProjectNodeOptions(
+                std::vector<Expression>{
+                    call("add", {field_ref("lkey"), field_ref("lval")}),
+                    call("multiply", {field_ref("lval"), literal(2)})},
+                std::vector<std::string>{"sum", "doubled"})),
+      ProjectNodeOptions(std::vector<Expression>{field_ref("doubled")}));
+
+  auto optimized = Optimize(decl);
+  const auto& inner =
+      checked_cast<const ProjectNodeOptions&>(*InputOf(optimized).options);
+  ASSERT_EQ(inner.expressions[0], literal(MakeNullScalar(int32())));
+  ASSERT_EQ(inner.expressions[1], call("multiply", {field_ref("lval"), literal(2)}));
+  ASSERT_EQ(inner.names, (std::vector<std::string>{"sum", "doubled"}));
+}
+
+TEST_F(PlanOptimizerTest, JoinBuildSide) {
+  // The right input is larger, so the join is built on the left input
+  auto optimized = Optimize(Join(JoinType::INNER, Left(), Right()));
+  ASSERT_EQ(optimized.factory_name, "project");
+  const auto& join = InputOf(optimized);
+  ASSERT_EQ(join.factory_name, "hashjoin");
+  const auto& swapped = checked_cast<const HashJoinNodeOptions&>(*join.options);
+  ASSERT_EQ(swapped.left_keys[0], FieldRef("rkey"));
+  ASSERT_EQ(checked_cast<const TableSourceNodeOptions&>(*InputOf(join, 0).options).table,
+            right_);
+
+  optimized = Optimize(Join(JoinType::LEFT_SEMI, Left(), Right()));
+  ASSERT_EQ(optimized.factory_name, "hashjoin");
+  ASSERT_EQ(checked_cast<const HashJoinNodeOptions&>(*optimized.options).join_type,
+            JoinType::RIGHT_SEMI);
+
+  // Estimates given by the caller take precedence
+  PlanOptimizerOptions options;
+  options.estimate_rows = [this](const Declaration& decl) -> util::optional<int64_t> {
+    if (decl.factory_name == "table_source" &&
+        checked_cast<const TableSourceNodeOptions&>(*decl.options).table == left_) {
+      return 1000;
+    }
+    return util::nullopt;
+  };
+  optimized = Optimize(Join(JoinType::INNER, Left(), Right()), options);
+  ASSERT_EQ(optimized.factory_name, "hashjoin");
+  const auto& probe = InputOf(optimized);
+  ASSERT_EQ(checked_cast<const TableSourceNodeOptions&>(*probe.options).table, left_);
+}
+
+TEST_F(PlanOptimizerTest, PushDownLimits) {
+  ASSERT_OK_AND_ASSIGN(
+      auto optimized,
+      OptimizeDeclaration(Unary(
+          "fetch",
+          Unary("fetch",
+                Unary("project", Left(),
+                      ProjectNodeOptions(std::vector<Expression>{field_ref("lval")})),
+                FetchNodeOptions(1, 10)),
+          FetchNodeOptions(1, 2))));
+  ASSERT_EQ(optimized.factory_name, "project");
+  const auto& fetch = InputOf(optimized);
+  ASSERT_EQ(fetch.factory_name, "fetch");
+  const auto& fetch_options = checked_cast<const FetchNodeOptions&>(*fetch.options);
+  ASSERT_EQ(fetch_options.offset, 2);
+  ASSERT_EQ(fetch_options.count, 2);
+  ASSERT_EQ(InputOf(fetch).factory_name, "table_source");
+
+  ASSERT_OK_AND_ASSIGN(
+      optimized, OptimizeDeclaration(
+                     Unary("fetch", Binary("union", Left(), Left(), ExecNodeOptions{}),
+                           FetchNodeOptions(1, 2))));
+  const auto& union_decl = InputOf(optimized);
+  for (int i = 0; i < 2; ++i) {
+    const auto& bound = InputOf(union_decl, i);
+    ASSERT_EQ(bound.factory_name, "fetch");
+    ASSERT_EQ(checked_cast<const FetchNodeOptions&>(*bound.options).count, 3);
+  }
+}
+
+TEST_F(PlanOptimizerTest, OutputSchema) {
+  ASSERT_OK_AND_ASSIGN(auto output_schema,
+                       DeclarationOutputSchema(Join(JoinType::INNER, Left(), Right())));
+  AssertSchemaEqual(*output_schema,
+                    *schema({field("lkey", int32()), field("lval", int32()),
+                             field("rkey", int32()), field("rval", utf8())}));
+
+  ASSERT_OK_AND_ASSIGN(
+      output_schema,
+      DeclarationOutputSchema(Unary(
+          "project", Left(),
+          ProjectNodeOptions(
+              std::vector<Expression>{call("add", {field_ref("lkey"), literal(1.5)})},
+              std::vector<std::string>{"x"}))));
+  AssertSchemaEqual(*output_schema, *schema({field("x", float64())}));
+
+  ASSERT_OK_AND_ASSIGN(
+      output_schema,
+      DeclarationOutputSchema(Unary("order_by_sink", Left(),
+                                    FilterNodeOptions(literal(true)))));
+  ASSERT_EQ(output_schema, nullptr);
+}
+
+}  // namespace compute
+}  // namespace arrow
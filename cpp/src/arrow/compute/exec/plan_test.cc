@@ -17,8 +17,10 @@
 
 #include <gmock/gmock-matchers.h>
 
+#include <chrono>
 #include <functional>
 #include <memory>
+#include <numeric>
 
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec/exec_plan.h"
@@ -29,11 +31,13 @@
 #include "arrow/io/util_internal.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/testing/builder.h"
 #include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/cancel.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
 #include "arrow/util/thread_pool.h"
@@ -451,6 +455,65 @@ custom_sink_label:OrderBySinkNode{by={sort_keys=[FieldRef.Name(sum(multiply(i32,
 )a");
 }
 
+TEST(ExecPlan, Metrics) {
+  auto basic_data = MakeBasicBatches();
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "single threaded");
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    ASSERT_OK(Declaration::Sequence(
+                  {
+                      {"source", SourceNodeOptions{basic_data.schema,
+                                                   basic_data.gen(parallel,
+                                                                  /*slow=*/false)}},
+                      {"filter",
+                       FilterNodeOptions{greater(field_ref("i32"), literal(4))}},
+                      {"order_by_sink",
+                       OrderBySinkNodeOptions{SortOptions({SortKey{"i32"}}), &sink_gen}},
+                  })
+                  .AddToPlan(plan.get()));
+    auto collected = StartAndCollect(plan.get(), sink_gen);
+    ASSERT_FINISHES_OK(collected);
+
+    ExecNode* sink = plan->sinks()[0];
+    ExecNode* filter = sink->inputs()[0];
+    ExecNode* source = plan->sources()[0];
+
+    ExecNodeMetrics source_metrics = source->metrics();
+    ASSERT_EQ(source_metrics.batches_in, 0);
+    ASSERT_EQ(source_metrics.batches_out, 2);
+    ASSERT_EQ(source_metrics.rows_out, 5);
+    ASSERT_GT(source_metrics.bytes_out, 0);
+
+    ExecNodeMetrics filter_metrics = filter->metrics();
+    ASSERT_EQ(filter_metrics.batches_in, 2);
+    ASSERT_EQ(filter_metrics.rows_in, 5);
+    ASSERT_EQ(filter_metrics.bytes_in, source_metrics.bytes_out);
+    ASSERT_EQ(filter_metrics.batches_out, 2);
+    ASSERT_EQ(filter_metrics.rows_out, 3);
+    ASSERT_LT(filter_metrics.bytes_out, filter_metrics.bytes_in);
+    ASSERT_GT(filter_metrics.wall_time_ns, 0);
+    ASSERT_EQ(filter_metrics.peak_memory_bytes, 0);
+
+    ExecNodeMetrics sink_metrics = sink->metrics();
+    ASSERT_EQ(sink_metrics.batches_in, 2);
+    ASSERT_EQ(sink_metrics.rows_in, 3);
+    ASSERT_EQ(sink_metrics.bytes_in, filter_metrics.bytes_out);
+    ASSERT_EQ(sink_metrics.batches_out, 0);
+    ASSERT_GT(sink_metrics.wall_time_ns, 0);
+    // The sort holds all of its input
+    ASSERT_GT(sink_metrics.peak_memory_bytes, 0);
+    ASSERT_EQ(sink_metrics.spilled_bytes, 0);
+
+    std::string annotated = plan->ToStringWithMetrics();
+    EXPECT_THAT(annotated, ::testing::HasSubstr(":FilterNode{filter=(i32 > 4)} "
+                                                "[batches_in=2, rows_in=5, bytes_in="));
+    EXPECT_THAT(annotated,
+                ::testing::HasSubstr(":SourceNode{} [batches_in=0, rows_in=0"));
+    EXPECT_THAT(annotated, ::testing::HasSubstr("wall_time="));
+  }
+}
+
 TEST(ExecPlanExecution, SourceOrderBy) {
   std::vector<ExecBatch> expected = {
       ExecBatchFromJSON({int32(), boolean()},
@@ -481,6 +544,145 @@ TEST(ExecPlanExecution, SourceOrderBy) {
   }
 }
 
+TEST(ExecPlanExecution, SourceOrderBySpilling) {
+  ::arrow::random::RandomArrayGenerator rng(42);
+  BatchesWithSchema input;
+  input.schema =
+      schema({field("i32", int32()), field("str", utf8()), field("i64", int64())});
+  for (int i = 0; i < 32; ++i) {
+    input.batches.push_back(
+        ExecBatch::Make({rng.Int32(/*size=*/256, /*min=*/0, /*max=*/50, /*null=*/0.1),
+                         rng.String(/*size=*/256, /*min_length=*/0, /*max_length=*/4,
+                                    /*null=*/0.1),
+                         rng.Int64(/*size=*/256, /*min=*/0, /*max=*/1000)})
+            .ValueOrDie());
+  }
+  // Sorting on every column makes the order of the output deterministic
+  SortOptions options({SortKey("i32", SortOrder::Descending), SortKey("str"),
+                       SortKey("i64")},
+                      NullPlacement::AtStart);
+
+  auto run = [&](bool parallel,
+                 int64_t spill_memory_limit) -> Result<std::shared_ptr<Table>> {
+    ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make());
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    OrderBySinkNodeOptions sink_options{options, &sink_gen};
+    sink_options.spill_memory_limit = spill_memory_limit;
+    RETURN_NOT_OK(
+        Declaration::Sequence(
+            {
+                {"source",
+                 SourceNodeOptions{input.schema, input.gen(parallel, /*slow=*/false)}},
+                {"order_by_sink", std::move(sink_options)},
+            })
+            .AddToPlan(plan.get()));
+    auto collected = StartAndCollect(plan.get(), sink_gen);
+    ARROW_ASSIGN_OR_RAISE(auto batches, collected.result());
+    ARROW_ASSIGN_OR_RAISE(auto table, TableFromExecBatches(input.schema, batches));
+    return table->CombineChunks();
+  };
+
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "single threaded");
+    ASSERT_OK_AND_ASSIGN(auto expected, run(parallel, /*spill_memory_limit=*/0));
+    // Every few batches are sorted into a run and spilled
+    ASSERT_OK_AND_ASSIGN(auto actual, run(parallel, /*spill_memory_limit=*/8192));
+    ASSERT_EQ(expected->num_rows(), 32 * 256);
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST(ExecPlanExecution, SourceOrderByRuns) {
+  ::arrow::random::RandomArrayGenerator rng(42);
+  BatchesWithSchema input;
+  input.schema = schema({field("i32", int32()), field("str", utf8()),
+                         field("f64", float64()), field("i64", int64())});
+  for (int i = 0; i < 32; ++i) {
+    input.batches.push_back(
+        ExecBatch::Make({rng.Int32(/*size=*/256, /*min=*/0, /*max=*/50, /*null=*/0.1),
+                         rng.String(/*size=*/256, /*min_length=*/0, /*max_length=*/4,
+                                    /*null=*/0.1),
+                         rng.Float64(/*size=*/256, /*min=*/0, /*max=*/10, /*null=*/0.1,
+                                     /*nan=*/0.1),
+                         rng.Int64(/*size=*/256, /*min=*/0, /*max=*/1000)})
+            .ValueOrDie());
+  }
+  ASSERT_OK_AND_ASSIGN(auto input_table,
+                       TableFromExecBatches(input.schema, input.batches));
+
+  // Runs are merged in as many ranges as the executor has threads
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, arrow::internal::ThreadPool::Make(4));
+  auto run = [&](bool parallel, const SortOptions& options,
+                 int64_t sort_run_length) -> Result<std::shared_ptr<Table>> {
+    ExecContext exec_ctx(default_memory_pool(), parallel ? thread_pool.get() : nullptr);
+    ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make(&exec_ctx));
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    OrderBySinkNodeOptions sink_options{options, &sink_gen};
+    sink_options.sort_run_length = sort_run_length;
+    RETURN_NOT_OK(
+        Declaration::Sequence(
+            {
+                {"source",
+                 SourceNodeOptions{input.schema, input.gen(parallel, /*slow=*/false)}},
+                {"order_by_sink", std::move(sink_options)},
+            })
+            .AddToPlan(plan.get()));
+    auto collected = StartAndCollect(plan.get(), sink_gen);
+    ARROW_ASSIGN_OR_RAISE(auto batches, collected.result());
+    ARROW_ASSIGN_OR_RAISE(auto table, TableFromExecBatches(input.schema, batches));
+    return table->CombineChunks();
+  };
+
+  // The first sort key decides how runs are split for merging
+  for (std::string first_key : {"i32", "str", "f64"}) {
+    for (SortOrder order : {SortOrder::Ascending, SortOrder::Descending}) {
+      for (NullPlacement null_placement :
+           {NullPlacement::AtStart, NullPlacement::AtEnd}) {
+        // Sorting on every column makes the order of the output deterministic
+        std::vector<SortKey> sort_keys = {SortKey(first_key, order)};
+        for (std::string key : {"i32", "str", "f64", "i64"}) {
+          if (key != first_key) sort_keys.emplace_back(key);
+        }
+        SortOptions options(sort_keys, null_placement);
+        ASSERT_OK_AND_ASSIGN(auto indices, SortIndices(input_table, options));
+        ASSERT_OK_AND_ASSIGN(Datum expected, Take(input_table, indices));
+        ASSERT_OK_AND_ASSIGN(auto expected_table, expected.table()->CombineChunks());
+        for (bool parallel : {false, true}) {
+          for (int64_t sort_run_length : {int64_t{300}, int64_t{1} << 20}) {
+            ARROW_SCOPED_TRACE("first_key=", first_key, " order=",
+                               order == SortOrder::Ascending ? "asc" : "desc",
+                               " nulls=",
+                               null_placement == NullPlacement::AtStart ? "first"
+                                                                        : "last",
+                               " parallel=", parallel,
+                               " sort_run_length=", sort_run_length);
+            ASSERT_OK_AND_ASSIGN(auto actual, run(parallel, options, sort_run_length));
+            ASSERT_EQ(expected_table->num_columns(), actual->num_columns());
+            for (int i = 0; i < actual->num_columns(); ++i) {
+              ASSERT_EQ(actual->column(i)->num_chunks(), 1);
+              AssertArraysEqual(*expected_table->column(i)->chunk(0),
+                                *actual->column(i)->chunk(0), /*verbose=*/false,
+                                EqualOptions().nans_equal(true));
+            }
+          }
+        }
+      }
+    }
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+  OrderBySinkNodeOptions sink_options{SortOptions({SortKey("i32")}), &sink_gen};
+  sink_options.sort_run_length = 0;
+  ASSERT_RAISES(Invalid, Declaration::Sequence(
+                             {
+                                 {"source", SourceNodeOptions{input.schema,
+                                                              input.gen(false, false)}},
+                                 {"order_by_sink", std::move(sink_options)},
+                             })
+                             .AddToPlan(plan.get()));
+}
+
 TEST(ExecPlanExecution, SourceSinkError) {
   ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
   AsyncGenerator<util::optional<ExecBatch>> sink_gen;
@@ -819,6 +1021,48 @@ TEST(ExecPlanExecution, StressSourceSinkStopped) {
   }
 }
 
+TEST(ExecPlanExecution, SourceSinkCancelled) {
+  auto basic_data = MakeBasicBatches();
+  for (bool deadline : {false, true}) {
+    SCOPED_TRACE(deadline ? "deadline" : "stop request");
+    StopSource stop_source;
+    ExecContext ctx;
+    ctx.set_stop_token(stop_source.token());
+
+    // Doesn't end until cancelled
+    int num_batches = 0;
+    AsyncGenerator<util::optional<ExecBatch>> source_gen =
+        [&]() -> Result<util::optional<ExecBatch>> {
+      if (++num_batches == 5) {
+        if (deadline) {
+          stop_source.RequestStopAt(std::chrono::steady_clock::now());
+        } else {
+          stop_source.RequestStop();
+        }
+      }
+      return util::make_optional(basic_data.batches[num_batches % 2]);
+    };
+    auto declaration = Declaration::Sequence({
+        {"source", SourceNodeOptions{basic_data.schema, source_gen}},
+        {"filter", FilterNodeOptions{literal(true)}},
+    });
+
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&ctx));
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    ASSERT_OK(Declaration::Sequence({declaration, {"sink", SinkNodeOptions{&sink_gen}}})
+                  .AddToPlan(plan.get()));
+    ASSERT_THAT(StartAndCollect(plan.get(), sink_gen),
+                Finishes(Raises(StatusCode::Cancelled)));
+    ASSERT_EQ(num_batches, 5);
+
+    // A cancelled plan doesn't start
+    ASSERT_OK_AND_ASSIGN(plan, ExecPlan::Make(&ctx));
+    ASSERT_OK(Declaration::Sequence({declaration, {"sink", SinkNodeOptions{&sink_gen}}})
+                  .AddToPlan(plan.get()));
+    ASSERT_RAISES(Cancelled, plan->StartProducing());
+  }
+}
+
 TEST(ExecPlanExecution, SourceFilterSink) {
   auto basic_data = MakeBasicBatches();
 
@@ -841,6 +1085,40 @@ TEST(ExecPlanExecution, SourceFilterSink) {
                    ExecBatchFromJSON({int32(), boolean()}, "[[6, false]]")}))));
 }
 
+TEST(ExecPlanExecution, SourceFilterFilterSink) {
+  for (bool project : {false, true}) {
+    SCOPED_TRACE(project ? "projected" : "sunk");
+    auto basic_data = MakeBasicBatches();
+
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+    // The first filter's output carries a selection vector, refined by the second
+    std::vector<Declaration> decls = {
+        {"source",
+         SourceNodeOptions{basic_data.schema,
+                           basic_data.gen(/*parallel=*/false, /*slow=*/false)}},
+        {"filter", FilterNodeOptions{greater(field_ref("i32"), literal(4))}},
+        {"filter", FilterNodeOptions{not_equal(field_ref("i32"), literal(6))}},
+    };
+    std::vector<ExecBatch> expected;
+    if (project) {
+      decls.push_back({"project", ProjectNodeOptions{{call(
+                                      "multiply", {field_ref("i32"), literal(2)})}}});
+      expected = {ExecBatchFromJSON({int32()}, "[]"),
+                  ExecBatchFromJSON({int32()}, "[[10], [14]]")};
+    } else {
+      expected = {ExecBatchFromJSON({int32(), boolean()}, "[]"),
+                  ExecBatchFromJSON({int32(), boolean()}, "[[5, null], [7, false]]")};
+    }
+    decls.push_back({"sink", SinkNodeOptions{&sink_gen}});
+    ASSERT_OK(Declaration::Sequence(std::move(decls)).AddToPlan(plan.get()));
+
+    ASSERT_THAT(StartAndCollect(plan.get(), sink_gen),
+                Finishes(ResultWith(UnorderedElementsAreArray(expected))));
+  }
+}
+
 TEST(ExecPlanExecution, SourceProjectSink) {
   auto basic_data = MakeBasicBatches();
 
@@ -1113,6 +1391,62 @@ TEST(ExecPlanExecution, SourceFilterProjectGroupedSumTopK) {
   }
 }
 
+TEST(ExecPlanExecution, SourceSelectK) {
+  ::arrow::random::RandomArrayGenerator rng(42);
+  BatchesWithSchema input;
+  input.schema = schema({field("i32", int32()), field("f64", float64()),
+                         field("row", int64())});
+  for (int i = 0; i < 32; ++i) {
+    std::vector<int64_t> row_values(256);
+    std::iota(row_values.begin(), row_values.end(), i * 256);
+    std::shared_ptr<Array> row;
+    ArrayFromVector<Int64Type>(row_values, &row);
+    input.batches.push_back(
+        ExecBatch::Make({rng.Int32(/*size=*/256, /*min=*/0, /*max=*/1000, /*null=*/0.1),
+                         rng.Float64(/*size=*/256, /*min=*/0, /*max=*/10, /*null=*/0.1,
+                                     /*nan_probability=*/0.1),
+                         std::move(row)})
+            .ValueOrDie());
+  }
+  ASSERT_OK_AND_ASSIGN(auto input_table,
+                       TableFromExecBatches(input.schema, input.batches));
+
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, arrow::internal::ThreadPool::Make(4));
+  for (std::string first_key : {"i32", "f64"}) {
+    for (SortOrder order : {SortOrder::Ascending, SortOrder::Descending}) {
+      for (int64_t k : {1, 100, 3000, 10000}) {
+        // The row number makes the selection deterministic
+        SelectKOptions options(k, {SortKey(first_key, order), SortKey("row")});
+        ASSERT_OK_AND_ASSIGN(auto indices, SelectKUnstable(input_table, options));
+        ASSERT_OK_AND_ASSIGN(Datum expected, Take(input_table, indices));
+        for (bool parallel : {false, true}) {
+          ARROW_SCOPED_TRACE("first_key=", first_key,
+                             " order=", order == SortOrder::Ascending ? "asc" : "desc",
+                             " k=", k, " parallel=", parallel);
+          ExecContext exec_ctx(default_memory_pool(),
+                               parallel ? thread_pool.get() : nullptr);
+          ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_ctx));
+          AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+          ASSERT_OK(
+              Declaration::Sequence(
+                  {
+                      {"source", SourceNodeOptions{input.schema,
+                                                   input.gen(parallel, /*slow=*/false)}},
+                      {"select_k_sink", SelectKSinkNodeOptions{options, &sink_gen}},
+                  })
+                  .AddToPlan(plan.get()));
+          auto collected = StartAndCollect(plan.get(), sink_gen);
+          ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, collected);
+          ASSERT_OK_AND_ASSIGN(auto actual, TableFromExecBatches(input.schema, batches));
+          // Only compare the row numbers, NaNs do not compare equal
+          AssertChunkedEquivalent(*expected.table()->GetColumnByName("row"),
+                                  *actual->GetColumnByName("row"));
+        }
+      }
+    }
+  }
+}
+
 TEST(ExecPlanExecution, SourceScalarAggSink) {
   ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
   AsyncGenerator<util::optional<ExecBatch>> sink_gen;
@@ -1282,6 +1616,172 @@ TEST(ExecPlanExecution, ScalarSourceGroupedSum) {
               }))));
 }
 
+TEST(ExecPlanExecution, SourceGroupedSumSpilling) {
+  ::arrow::random::RandomArrayGenerator rng(42);
+  BatchesWithSchema input;
+  input.schema =
+      schema({field("key", int32()), field("str", utf8()), field("i64", int64())});
+  for (int i = 0; i < 16; ++i) {
+    input.batches.push_back(
+        ExecBatch::Make({rng.Int32(/*size=*/512, /*min=*/0, /*max=*/3000, /*null=*/0.05),
+                         rng.String(/*size=*/512, /*min_length=*/0, /*max_length=*/8),
+                         rng.Int64(/*size=*/512, /*min=*/-100, /*max=*/100,
+                                   /*null=*/0.1)})
+            .ValueOrDie());
+  }
+
+  auto run = [&](bool parallel,
+                 int64_t spill_memory_limit) -> Result<std::shared_ptr<Table>> {
+    ExecContext exec_ctx(default_memory_pool(),
+                         parallel ? arrow::internal::GetCpuThreadPool() : nullptr);
+    ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make(&exec_ctx));
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+    AggregateNodeOptions aggregate_options{
+        /*aggregates=*/{{"hash_sum", nullptr, "i64", "sum(i64)"},
+                        {"hash_count", nullptr, "str", "count(str)"},
+                        {"hash_mean", nullptr, "i64", "mean(i64)"}},
+        /*keys=*/{"key"}};
+    aggregate_options.spill_memory_limit = spill_memory_limit;
+    RETURN_NOT_OK(
+        Declaration::Sequence(
+            {
+                {"source",
+                 SourceNodeOptions{input.schema, input.gen(parallel, /*slow=*/false)}},
+                {"aggregate", std::move(aggregate_options)},
+                {"order_by_sink",
+                 OrderBySinkNodeOptions{SortOptions({SortKey("key")}), &sink_gen}},
+            })
+            .AddToPlan(plan.get()));
+    auto output_schema = schema({field("sum(i64)", int64()), field("count(str)", int64()),
+                                 field("mean(i64)", float64()), field("key", int32())});
+    auto collected = StartAndCollect(plan.get(), sink_gen);
+    ARROW_ASSIGN_OR_RAISE(auto batches, collected.result());
+    ARROW_ASSIGN_OR_RAISE(auto table, TableFromExecBatches(output_schema, batches));
+    return table->CombineChunks();
+  };
+
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "serial");
+    ASSERT_OK_AND_ASSIGN(auto expected, run(parallel, /*spill_memory_limit=*/0));
+    // Small enough for every partition to be written to disk
+    ASSERT_OK_AND_ASSIGN(auto actual, run(parallel, /*spill_memory_limit=*/4096));
+    ASSERT_GT(expected->num_rows(), 2000);
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST(ExecPlanExecution, GroupedSumSpillingValidation) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  BatchesWithSchema input;
+  input.schema =
+      schema({field("key", dictionary(int32(), utf8())), field("i32", int32())});
+  ASSERT_OK_AND_ASSIGN(
+      auto source,
+      MakeExecNode("source", plan.get(), {},
+                   SourceNodeOptions{input.schema,
+                                     input.gen(/*parallel=*/false, /*slow=*/false)}));
+
+  AggregateNodeOptions options{/*aggregates=*/{{"hash_sum", nullptr, "i32", "sum(i32)"}},
+                               /*keys=*/{"key"}};
+  options.spill_memory_limit = -1;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, HasSubstr("spill_memory_limit"),
+      MakeExecNode("aggregate", plan.get(), {source}, options));
+  options.spill_memory_limit = 1 << 20;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      NotImplemented, HasSubstr("dictionary keys"),
+      MakeExecNode("aggregate", plan.get(), {source}, options));
+}
+
+TEST(ExecPlanExecution, SourceGroupedSumStreaming) {
+  ::arrow::random::RandomArrayGenerator rng(42);
+  auto unsorted = RecordBatch::Make(
+      schema({field("key", int32()), field("str", utf8()), field("i64", int64())}),
+      2048,
+      {rng.Int32(/*size=*/2048, /*min=*/0, /*max=*/300, /*null=*/0.05),
+       rng.String(/*size=*/2048, /*min_length=*/0, /*max_length=*/8),
+       rng.Int64(/*size=*/2048, /*min=*/-100, /*max=*/100, /*null=*/0.1)});
+  ASSERT_OK_AND_ASSIGN(auto indices,
+                       SortIndices(Datum(unsorted), SortOptions({SortKey("key")})));
+  ASSERT_OK_AND_ASSIGN(Datum sorted, Take(unsorted, indices));
+  BatchesWithSchema input;
+  input.schema = unsorted->schema();
+  // Groups span batch boundaries and some batches hold a single group
+  for (int64_t offset = 0; offset < 2048; offset += 100) {
+    input.batches.emplace_back(*sorted.record_batch()->Slice(offset, 100));
+  }
+
+  auto run = [&](bool streaming, const BatchesWithSchema& input,
+                 bool order_by) -> Result<std::shared_ptr<Table>> {
+    // Batches have to be delivered in order
+    ExecContext exec_ctx(default_memory_pool(), nullptr);
+    ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make(&exec_ctx));
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    AggregateNodeOptions aggregate_options{
+        /*aggregates=*/{{"hash_sum", nullptr, "i64", "sum(i64)"},
+                        {"hash_count", nullptr, "str", "count(str)"},
+                        {"hash_mean", nullptr, "i64", "mean(i64)"}},
+        /*keys=*/{"key"}};
+    aggregate_options.streaming = streaming;
+    Declaration sink{"sink", SinkNodeOptions{&sink_gen}};
+    if (order_by) {
+      sink = {"order_by_sink",
+              OrderBySinkNodeOptions{SortOptions({SortKey("key")}), &sink_gen}};
+    }
+    RETURN_NOT_OK(
+        Declaration::Sequence(
+            {
+                {"source", SourceNodeOptions{input.schema,
+                                             input.gen(/*parallel=*/false,
+                                                       /*slow=*/false)}},
+                {"aggregate", std::move(aggregate_options)},
+                sink,
+            })
+            .AddToPlan(plan.get()));
+    auto output_schema = schema({field("sum(i64)", int64()), field("count(str)", int64()),
+                                 field("mean(i64)", float64()), field("key", int32())});
+    auto collected = StartAndCollect(plan.get(), sink_gen);
+    ARROW_ASSIGN_OR_RAISE(auto batches, collected.result());
+    ARROW_ASSIGN_OR_RAISE(auto table, TableFromExecBatches(output_schema, batches));
+    return table->CombineChunks();
+  };
+
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       run(/*streaming=*/false, input, /*order_by=*/true));
+  // Groups are output in input order
+  ASSERT_OK_AND_ASSIGN(auto actual, run(/*streaming=*/true, input, /*order_by=*/false));
+  ASSERT_GT(expected->num_rows(), 250);
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+  BatchesWithSchema unordered;
+  unordered.schema = input.schema;
+  unordered.batches = {ExecBatch(*unsorted->Slice(0, 100))};
+  EXPECT_THAT(run(/*streaming=*/true, unordered, /*order_by=*/false),
+              Raises(StatusCode::Invalid, HasSubstr("not ordered")));
+
+  // A group output at the end of a batch must not appear again in the next one
+  unordered.batches = {
+      ExecBatchFromJSON({int32(), utf8(), int64()}, R"([[1, "a", 1], [2, "b", 2]])"),
+      ExecBatchFromJSON({int32(), utf8(), int64()}, R"([[1, "c", 3]])")};
+  EXPECT_THAT(run(/*streaming=*/true, unordered, /*order_by=*/false),
+              Raises(StatusCode::Invalid, HasSubstr("appeared again")));
+
+  AggregateNodeOptions options{/*aggregates=*/{{"hash_sum", nullptr, "i64", "sum(i64)"}},
+                               /*keys=*/{"key"}};
+  options.streaming = true;
+  options.spill_memory_limit = 1 << 20;
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  ASSERT_OK_AND_ASSIGN(
+      auto source,
+      MakeExecNode("source", plan.get(), {},
+                   SourceNodeOptions{input.schema,
+                                     input.gen(/*parallel=*/false, /*slow=*/false)}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, HasSubstr("cannot spill"),
+                                  MakeExecNode("aggregate", plan.get(), {source},
+                                               options));
+}
+
 TEST(ExecPlanExecution, SelfInnerHashJoinSink) {
   for (bool parallel : {false, true}) {
     SCOPED_TRACE(parallel ? "parallel/merged" : "serial");
@@ -43,7 +43,12 @@ class ProjectNode : public MapNode {
               std::shared_ptr<Schema> output_schema, std::vector<Expression> exprs,
               bool async_mode)
       : MapNode(plan, std::move(inputs), std::move(output_schema), async_mode),
-        exprs_(std::move(exprs)) {}
+        exprs_(std::move(exprs)),
+        projected_columns_(inputs_[0]->output_schema()->num_fields(), false) {
+    for (const auto& expr : exprs_) {
+      MarkReferencedColumns(expr, &projected_columns_);
+    }
+  }
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -77,20 +82,27 @@ class ProjectNode : public MapNode {
 
   const char* kind_name() const override { return "ProjectNode"; }
 
-  Result<ExecBatch> DoProject(const ExecBatch& target) {
-    std::vector<Datum> values{exprs_.size()};
+  bool accepts_selection_vector() const override { return true; }
+
+  Result<ExecBatch> DoProject(const ExecBatch& filtered_target) {
+    // Of a filtered input, only the rows of the columns which are projected are copied
+    ARROW_ASSIGN_OR_RAISE(
+        ExecBatch target,
+        filtered_target.ApplySelection(projected_columns_, plan()->exec_context()));
+
+    std::vector<Expression> simplified_exprs(exprs_.size());
     for (size_t i = 0; i < exprs_.size(); ++i) {
-      util::tracing::Span span;
-      START_COMPUTE_SPAN(span, "Project",
-                         {{"project.descr", exprs_[i].descr().ToString()},
-                          {"project.length", target.length},
-                          {"project.expression", exprs_[i].ToString()}});
-      ARROW_ASSIGN_OR_RAISE(Expression simplified_expr,
+      ARROW_ASSIGN_OR_RAISE(simplified_exprs[i],
                             SimplifyWithGuarantee(exprs_[i], target.guarantee));
-
-      ARROW_ASSIGN_OR_RAISE(values[i], ExecuteScalarExpression(simplified_expr, target,
-                                                               plan()->exec_context()));
     }
+    util::tracing::Span span;
+    START_COMPUTE_SPAN(span, "Project",
+                       {{"project.length", target.length},
+                        {"project.expressions", ToStringExtra()}});
+    // Subexpressions shared by several projections are only evaluated once
+    ARROW_ASSIGN_OR_RAISE(
+        std::vector<Datum> values,
+        ExecuteScalarExpressions(simplified_exprs, target, plan()->exec_context()));
     return ExecBatch{std::move(values), target.length};
   }
 
@@ -129,6 +141,8 @@ class ProjectNode : public MapNode {
 
  private:
   std::vector<Expression> exprs_;
+  // The input columns read by any of the expressions
+  std::vector<bool> projected_columns_;
 };
 
 }  // namespace
@@ -0,0 +1,148 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/exec/runtime_filter.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec/bloom_filter.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/key_hash.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/cpu_info.h"
+
+namespace arrow {
+namespace compute {
+
+RuntimeFilter::RuntimeFilter(std::shared_ptr<BlockedBloomFilter> bloom_filter,
+                             std::vector<int> key_ids, Expression key_range)
+    : bloom_filter_(std::move(bloom_filter)),
+      key_ids_(std::move(key_ids)),
+      key_range_(std::move(key_range)) {}
+
+Status RuntimeFilter::Select(ExecContext* ctx, const ExecBatch& batch,
+                             uint8_t* selection) const {
+  if (!bloom_filter_) {
+    return Status::OK();
+  }
+  std::vector<Datum> keys(key_ids_.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    keys[i] = batch[key_ids_[i]];
+    if (keys[i].is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(keys[i], MakeArrayFromScalar(*keys[i].scalar(), batch.length,
+                                                         ctx->memory_pool()));
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch, ExecBatch::Make(std::move(keys)));
+
+  util::TempVectorStack stack;
+  RETURN_NOT_OK(stack.Init(ctx->memory_pool(),
+                           4 * util::MiniBatch::kMiniBatchLength * sizeof(uint32_t)));
+  const int64_t hardware_flags = ctx->cpu_info()->hardware_flags();
+  std::vector<uint32_t> hashes(batch.length);
+  std::vector<uint8_t> found(bit_util::BytesForBits(batch.length));
+  RETURN_NOT_OK(Hashing32::HashBatch(key_batch, hashes.data(), hardware_flags, &stack,
+                                     0, key_batch.length));
+  bloom_filter_->Find(hardware_flags, key_batch.length, hashes.data(), found.data());
+  arrow::internal::BitmapAnd(found.data(), 0, selection, 0, batch.length, 0, selection);
+  return Status::OK();
+}
+
+void RuntimeFilterSet::Add(std::shared_ptr<const RuntimeFilter> filter) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  filters_.push_back(std::move(filter));
+}
+
+void RuntimeFilterSet::Replace(const RuntimeFilter* old,
+                               std::shared_ptr<const RuntimeFilter> filter) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = std::find_if(
+      filters_.begin(), filters_.end(),
+      [&](const std::shared_ptr<const RuntimeFilter>& f) { return f.get() == old; });
+  if (old != NULLPTR && it != filters_.end()) {
+    *it = std::move(filter);
+  } else {
+    filters_.push_back(std::move(filter));
+  }
+}
+
+bool RuntimeFilterSet::empty() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return filters_.empty();
+}
+
+Expression RuntimeFilterSet::key_range() const {
+  std::vector<Expression> ranges;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& filter : filters_) {
+      ranges.push_back(filter->key_range());
+    }
+  }
+  return and_(std::move(ranges));
+}
+
+Status RuntimeFilterSet::Apply(ExecContext* ctx, ExecBatch* batch) const {
+  std::vector<std::shared_ptr<const RuntimeFilter>> filters;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& filter : filters_) {
+      if (filter->bloom_filter()) filters.push_back(filter);
+    }
+  }
+  if (filters.empty() || batch->length == 0) {
+    return Status::OK();
+  }
+
+  const int64_t bitmap_bytes = bit_util::BytesForBits(batch->length);
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> selection,
+                        AllocateBuffer(bitmap_bytes, ctx->memory_pool()));
+  std::memset(selection->mutable_data(), 0xff, bitmap_bytes);
+  for (const auto& filter : filters) {
+    RETURN_NOT_OK(filter->Select(ctx, *batch, selection->mutable_data()));
+  }
+  int64_t num_selected =
+      arrow::internal::CountSetBits(selection->data(), 0, batch->length);
+  if (num_selected == batch->length) {
+    return Status::OK();
+  }
+
+  Datum selection_datum(
+      ArrayData::Make(boolean(), batch->length, {nullptr, std::move(selection)}));
+  for (Datum& value : batch->values) {
+    if (!value.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(value, Filter(value, selection_datum, FilterOptions(), ctx));
+    }
+  }
+  batch->length = num_selected;
+  return Status::OK();
+}
+
+RuntimeFilterTarget* FindRuntimeFilterTarget(ExecNode* node) {
+  while (std::strcmp(node->kind_name(), "FilterNode") == 0) {
+    node = node->inputs()[0];
+  }
+  return dynamic_cast<RuntimeFilterTarget*>(node);
+}
+
+}  // namespace compute
+}  // namespace arrow
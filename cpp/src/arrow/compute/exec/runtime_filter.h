@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/expression.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class BlockedBloomFilter;
+class ExecNode;
+
+/// \brief A filter on the rows of a source, made by one of its consumers while it runs
+///
+/// A row which fails the filter can not contribute to the output of the consumer.  Once
+/// its build side is complete a hash join pushes such a filter, made from the build side
+/// keys, down to the source of its probe side, so that non-matching rows are dropped as
+/// soon as they are read.  A select_k_sink pushes down the K-th value of its first sort
+/// key, once it has seen K rows.
+class ARROW_EXPORT RuntimeFilter {
+ public:
+  /// \param[in] bloom_filter a Bloom filter over the hashes of the build side keys.  May
+  /// be null, the filter then only narrows the scans of the source by `key_range`.
+  /// \param[in] key_ids the indices of the key columns in the batches to filter, in the
+  /// order in which the build side keys were hashed
+  /// \param[in] key_range an expression (referring to columns by name) which is true for
+  /// every row that may have a match, such as the range or the set of the build side
+  /// keys
+  RuntimeFilter(std::shared_ptr<BlockedBloomFilter> bloom_filter,
+                std::vector<int> key_ids, Expression key_range);
+
+  const std::shared_ptr<BlockedBloomFilter>& bloom_filter() const {
+    return bloom_filter_;
+  }
+  const std::vector<int>& key_ids() const { return key_ids_; }
+  const Expression& key_range() const { return key_range_; }
+
+  /// \brief Clear the bits of `selection` for the rows of `batch` which fail the filter
+  ///
+  /// `selection` holds one bit per row of `batch`
+  Status Select(ExecContext* ctx, const ExecBatch& batch, uint8_t* selection) const;
+
+ private:
+  std::shared_ptr<BlockedBloomFilter> bloom_filter_;
+  std::vector<int> key_ids_;
+  Expression key_range_;
+};
+
+/// \brief The runtime filters of a source, to which filters may be added while it runs
+///
+/// This class is thread-safe.
+class ARROW_EXPORT RuntimeFilterSet {
+ public:
+  void Add(std::shared_ptr<const RuntimeFilter> filter);
+
+  /// \brief Replace `old`, which may be null, with `filter`
+  ///
+  /// The filter is added if `old` is not in the set.
+  void Replace(const RuntimeFilter* old, std::shared_ptr<const RuntimeFilter> filter);
+
+  bool empty() const;
+
+  /// \brief The conjunction of the key ranges of all filters added so far
+  Expression key_range() const;
+
+  /// \brief Drop the rows of `batch` which fail any of the filters added so far
+  Status Apply(ExecContext* ctx, ExecBatch* batch) const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<std::shared_ptr<const RuntimeFilter>> filters_;
+};
+
+/// \brief Implemented by nodes which accept runtime filters from their consumers
+class ARROW_EXPORT RuntimeFilterTarget {
+ public:
+  virtual ~RuntimeFilterTarget() = default;
+
+  /// \brief The filters applied to the batches the node outputs
+  virtual RuntimeFilterSet* runtime_filters() = 0;
+};
+
+/// \brief The node whose output `node` receives, unchanged but for dropped rows, if it
+/// accepts runtime filters
+///
+/// Looks through filter nodes.  Returns null if there is no such node.
+ARROW_EXPORT RuntimeFilterTarget* FindRuntimeFilterTarget(ExecNode* node);
+
+}  // namespace compute
+}  // namespace arrow
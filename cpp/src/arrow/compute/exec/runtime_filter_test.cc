@@ -0,0 +1,327 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "arrow/api.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/exec/bloom_filter.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/key_hash.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/runtime_filter.h"
+#include "arrow/compute/exec/test_util.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+std::shared_ptr<BlockedBloomFilter> MakeBloomFilter(const ExecBatch& keys) {
+  const int64_t hardware_flags =
+      arrow::internal::CpuInfo::GetInstance()->hardware_flags();
+  util::TempVectorStack stack;
+  ARROW_EXPECT_OK(stack.Init(default_memory_pool(),
+                             4 * util::MiniBatch::kMiniBatchLength * sizeof(uint32_t)));
+  std::vector<uint32_t> hashes(keys.length);
+  ARROW_EXPECT_OK(Hashing32::HashBatch(keys, hashes.data(), hardware_flags, &stack, 0,
+                                       keys.length));
+
+  auto bloom_filter = std::make_shared<BlockedBloomFilter>();
+  auto builder = BloomFilterBuilder::Make(BloomFilterBuildStrategy::SINGLE_THREADED);
+  ARROW_EXPECT_OK(builder->Begin(/*num_threads=*/1, hardware_flags, default_memory_pool(),
+                                 keys.length, /*num_batches=*/1, bloom_filter.get()));
+  ARROW_EXPECT_OK(builder->PushNextBatch(/*thread_index=*/0, keys.length, hashes.data()));
+  builder->CleanUp();
+  return bloom_filter;
+}
+
+std::set<int32_t> Int32Values(const Datum& datum) {
+  std::set<int32_t> values;
+  auto array = datum.make_array();
+  const auto& int32_array = arrow::internal::checked_cast<const Int32Array&>(*array);
+  for (int64_t i = 0; i < array->length(); ++i) values.insert(int32_array.Value(i));
+  return values;
+}
+
+}  // namespace
+
+TEST(RuntimeFilterSet, Apply) {
+  RuntimeFilterSet filters;
+  ASSERT_TRUE(filters.empty());
+  ASSERT_EQ(filters.key_range(), literal(true));
+
+  auto batch = ExecBatchFromJSON({int32(), utf8(), int32()},
+                                 R"([[0, "a", 0], [1, "b", 1], [2, "c", 2], [3, "d", 3],
+                                     [4, "e", 4], [5, "f", 5], [6, "g", 6],
+                                     [7, "h", 7]])");
+  batch.values.push_back(MakeScalar(int64_t{42}));
+
+  // No filter: the batch is untouched
+  ExecBatch unfiltered = batch;
+  ASSERT_OK(filters.Apply(default_exec_context(), &unfiltered));
+  ASSERT_EQ(unfiltered, batch);
+
+  auto build_keys = ExecBatchFromJSON({int32()}, "[[2], [5], [7]]");
+  auto key_range = and_(greater_equal(field_ref("key"), literal(2)),
+                        less_equal(field_ref("key"), literal(7)));
+  filters.Add(std::make_shared<RuntimeFilter>(MakeBloomFilter(build_keys),
+                                              std::vector<int>{2}, key_range));
+  ASSERT_FALSE(filters.empty());
+  ASSERT_EQ(filters.key_range(), key_range);
+
+  ExecBatch filtered = batch;
+  ASSERT_OK(filters.Apply(default_exec_context(), &filtered));
+  // A Bloom filter may let through some rows without a match, but never drops a match
+  ASSERT_LE(filtered.length, batch.length);
+  ASSERT_EQ(filtered.values[0].length(), filtered.length);
+  ASSERT_EQ(Int32Values(filtered.values[0]), Int32Values(filtered.values[2]));
+  ASSERT_THAT(Int32Values(filtered.values[2]), ::testing::IsSupersetOf({2, 5, 7}));
+  ASSERT_TRUE(filtered.values[3].is_scalar());
+}
+
+class RuntimeFilterJoinTest : public ::testing::TestWithParam<bool> {};
+
+// An inner join pushes its Bloom filter, and the range and the set of its build side
+// keys, down to the source of its probe side
+TEST_P(RuntimeFilterJoinTest, PushedToProbeSource) {
+  bool parallel = GetParam();
+  BatchesWithSchema probe, build;
+  probe.schema = schema({field("l_key", int32()), field("l_str", utf8())});
+  for (int i = 0; i < 8; ++i) {
+    std::string json = "[";
+    for (int j = 0; j < 16; ++j) {
+      int key = i * 16 + j;
+      json += (j ? ", [" : "[") + std::to_string(key) + R"(, ")" +
+              std::to_string(key) + R"("])";
+    }
+    probe.batches.push_back(ExecBatchFromJSON({int32(), utf8()}, json + "]"));
+  }
+  build.schema = schema({field("r_key", int32())});
+  build.batches = {ExecBatchFromJSON({int32()}, "[[20], [null], [35]]"),
+                   ExecBatchFromJSON({int32()}, "[[17], [100]]")};
+
+  ExecContext exec_ctx(default_memory_pool(),
+                       parallel ? arrow::internal::GetCpuThreadPool() : nullptr);
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_ctx));
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * probe_source,
+      MakeExecNode("source", plan.get(), {},
+                   SourceNodeOptions{probe.schema, probe.gen(parallel, /*slow=*/false)}));
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * build_source,
+      MakeExecNode("source", plan.get(), {},
+                   SourceNodeOptions{build.schema, build.gen(parallel, /*slow=*/false)}));
+  HashJoinNodeOptions join_options{JoinType::INNER, {"l_key"}, {"r_key"}};
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * join,
+      MakeExecNode("hashjoin", plan.get(), {probe_source, build_source}, join_options));
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+  ASSERT_OK(MakeExecNode("sink", plan.get(), {join}, SinkNodeOptions{&sink_gen}));
+
+  auto collected = StartAndCollect(plan.get(), sink_gen);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto result, collected);
+  AssertExecBatchesEqual(
+      join->output_schema(),
+      {ExecBatchFromJSON({int32(), utf8(), int32()},
+                         R"([[17, "17", 17], [20, "20", 20], [35, "35", 35],
+                             [100, "100", 100]])")},
+      result);
+
+  auto* target = dynamic_cast<RuntimeFilterTarget*>(probe_source);
+  ASSERT_NE(target, nullptr);
+  ASSERT_FALSE(target->runtime_filters()->empty());
+  ASSERT_EQ(target->runtime_filters()->key_range(),
+            and_(std::vector<Expression>{
+                greater_equal(field_ref("l_key"), literal(17)),
+                less_equal(field_ref("l_key"), literal(100)),
+                call("is_in", {field_ref("l_key")},
+                     SetLookupOptions(ArrayFromJSON(int32(), "[17, 20, 35, 100]"),
+                                      /*skip_nulls=*/true))}));
+}
+
+// Without a non-null key on the build side no probe side row can match
+TEST_P(RuntimeFilterJoinTest, NoBuildSideKeys) {
+  bool parallel = GetParam();
+  BatchesWithSchema probe, build;
+  probe.schema = schema({field("l_key", int32())});
+  probe.batches = {ExecBatchFromJSON({int32()}, "[[1], [2]]")};
+  build.schema = schema({field("r_key", int32())});
+  build.batches = {ExecBatchFromJSON({int32()}, "[[null]]")};
+
+  ExecContext exec_ctx(default_memory_pool(),
+                       parallel ? arrow::internal::GetCpuThreadPool() : nullptr);
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_ctx));
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * probe_source,
+      MakeExecNode("source", plan.get(), {},
+                   SourceNodeOptions{probe.schema, probe.gen(parallel, /*slow=*/false)}));
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * build_source,
+      MakeExecNode("source", plan.get(), {},
+                   SourceNodeOptions{build.schema, build.gen(parallel, /*slow=*/false)}));
+  HashJoinNodeOptions join_options{JoinType::LEFT_SEMI, {"l_key"}, {"r_key"}};
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * join,
+      MakeExecNode("hashjoin", plan.get(), {probe_source, build_source}, join_options));
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+  ASSERT_OK(MakeExecNode("sink", plan.get(), {join}, SinkNodeOptions{&sink_gen}));
+
+  auto collected = StartAndCollect(plan.get(), sink_gen);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto result, collected);
+  AssertExecBatchesEqual(join->output_schema(), {}, result);
+  auto* target = dynamic_cast<RuntimeFilterTarget*>(probe_source);
+  ASSERT_NE(target, nullptr);
+  ASSERT_EQ(target->runtime_filters()->key_range(), literal(false));
+}
+
+// Joins which output probe side rows without a match push nothing down
+TEST_P(RuntimeFilterJoinTest, NotPushedForLeftOuter) {
+  bool parallel = GetParam();
+  BatchesWithSchema probe, build;
+  probe.schema = schema({field("l_key", int32())});
+  probe.batches = {ExecBatchFromJSON({int32()}, "[[1], [2]]")};
+  build.schema = schema({field("r_key", int32())});
+  build.batches = {ExecBatchFromJSON({int32()}, "[[2]]")};
+
+  ExecContext exec_ctx(default_memory_pool(),
+                       parallel ? arrow::internal::GetCpuThreadPool() : nullptr);
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_ctx));
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * probe_source,
+      MakeExecNode("source", plan.get(), {},
+                   SourceNodeOptions{probe.schema, probe.gen(parallel, /*slow=*/false)}));
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * build_source,
+      MakeExecNode("source", plan.get(), {},
+                   SourceNodeOptions{build.schema, build.gen(parallel, /*slow=*/false)}));
+  HashJoinNodeOptions join_options{JoinType::LEFT_OUTER, {"l_key"}, {"r_key"}};
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * join,
+      MakeExecNode("hashjoin", plan.get(), {probe_source, build_source}, join_options));
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+  ASSERT_OK(MakeExecNode("sink", plan.get(), {join}, SinkNodeOptions{&sink_gen}));
+
+  auto collected = StartAndCollect(plan.get(), sink_gen);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto result, collected);
+  AssertExecBatchesEqual(
+      join->output_schema(),
+      {ExecBatchFromJSON({int32(), int32()}, "[[1, null], [2, 2]]")}, result);
+  auto* target = dynamic_cast<RuntimeFilterTarget*>(probe_source);
+  ASSERT_NE(target, nullptr);
+  ASSERT_TRUE(target->runtime_filters()->empty());
+}
+
+INSTANTIATE_TEST_SUITE_P(RuntimeFilterJoinTest, RuntimeFilterJoinTest,
+                         ::testing::Values(false, true));
+
+// Once it holds K rows a select_k_sink pushes the K-th value of its first sort key down
+// to its source, tightening it as better rows arrive
+TEST(RuntimeFilterSelectK, PushedToSource) {
+  BatchesWithSchema input;
+  input.schema = schema({field("x", int32()), field("y", utf8())});
+  input.batches = {ExecBatchFromJSON({int32(), utf8()}, R"([[5, "a"], [3, "b"]])"),
+                   ExecBatchFromJSON({int32(), utf8()}, R"([[9, "c"], [null, "d"]])"),
+                   ExecBatchFromJSON({int32(), utf8()}, R"([[1, "e"], [7, "f"]])"),
+                   ExecBatchFromJSON({int32(), utf8()}, R"([[8, "g"], [2, "h"]])")};
+
+  for (SortOrder order : {SortOrder::Descending, SortOrder::Ascending}) {
+    ExecContext exec_ctx(default_memory_pool(), /*executor=*/nullptr);
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_ctx));
+    ASSERT_OK_AND_ASSIGN(
+        ExecNode * source,
+        MakeExecNode("source", plan.get(), {},
+                     SourceNodeOptions{input.schema, input.gen(/*parallel=*/false,
+                                                               /*slow=*/false)}));
+    ASSERT_OK_AND_ASSIGN(ExecNode * filter,
+                         MakeExecNode("filter", plan.get(), {source},
+                                      FilterNodeOptions{not_equal(field_ref("y"),
+                                                                  literal("b"))}));
+    SelectKOptions options(/*k=*/2, {SortKey("x", order)});
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    ASSERT_OK(MakeExecNode("select_k_sink", plan.get(), {filter},
+                           SelectKSinkNodeOptions{options, &sink_gen}));
+
+    auto collected = StartAndCollect(plan.get(), sink_gen);
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto result, collected);
+    auto* target = dynamic_cast<RuntimeFilterTarget*>(source);
+    ASSERT_NE(target, nullptr);
+    // The filter has no Bloom filter, no row is dropped by the source itself
+    if (order == SortOrder::Descending) {
+      AssertExecBatchesEqual(
+          filter->output_schema(),
+          {ExecBatchFromJSON({int32(), utf8()}, R"([[9, "c"], [8, "g"]])")}, result);
+      ASSERT_EQ(target->runtime_filters()->key_range(),
+                greater_equal(field_ref("x"), literal(8)));
+    } else {
+      AssertExecBatchesEqual(
+          filter->output_schema(),
+          {ExecBatchFromJSON({int32(), utf8()}, R"([[1, "e"], [2, "h"]])")}, result);
+      ASSERT_EQ(target->runtime_filters()->key_range(),
+                less_equal(field_ref("x"), literal(2)));
+    }
+  }
+}
+
+// Nulls and NaNs are never selected and never bound the rows still to come, which may
+// be selected in their place
+TEST(RuntimeFilterSelectK, NotPushedForNullOrNaN) {
+  for (const auto& type : {int32(), float64()}) {
+    ARROW_SCOPED_TRACE("type=", type->ToString());
+    const std::string missing = is_floating(type->id()) ? "NaN" : "null";
+    BatchesWithSchema input;
+    input.schema = schema({field("x", type)});
+    input.batches = {
+        ExecBatchFromJSON({type}, "[[" + missing + "], [" + missing + "], [" + missing +
+                                      "], [4]]"),
+        ExecBatchFromJSON({type}, "[[1], [6]]"), ExecBatchFromJSON({type}, "[[5]]")};
+
+    ExecContext exec_ctx(default_memory_pool(), /*executor=*/nullptr);
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_ctx));
+    ASSERT_OK_AND_ASSIGN(
+        ExecNode * source,
+        MakeExecNode("source", plan.get(), {},
+                     SourceNodeOptions{input.schema, input.gen(/*parallel=*/false,
+                                                               /*slow=*/false)}));
+    SelectKOptions options(/*k=*/2, {SortKey("x", SortOrder::Descending)});
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    ASSERT_OK(MakeExecNode("select_k_sink", plan.get(), {source},
+                           SelectKSinkNodeOptions{options, &sink_gen}));
+
+    auto collected = StartAndCollect(plan.get(), sink_gen);
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto result, collected);
+    AssertExecBatchesEqual(input.schema, {ExecBatchFromJSON({type}, "[[6], [5]]")},
+                           result);
+    // The first batch leaves only {4} selected, the first bound is pushed once the
+    // third batch fills the selection with proper values
+    auto* target = dynamic_cast<RuntimeFilterTarget*>(source);
+    ASSERT_NE(target, nullptr);
+    ASSERT_EQ(target->runtime_filters()->key_range(),
+              greater_equal(field_ref("x"), literal(MakeScalar(type, 5).ValueOrDie())));
+  }
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -24,6 +24,7 @@
 #include "arrow/compute/exec/expression.h"
 #include "arrow/compute/exec/options.h"
 #include "arrow/compute/exec/order_by_impl.h"
+#include "arrow/compute/exec/runtime_filter.h"
 #include "arrow/compute/exec/util.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/datum.h"
@@ -450,10 +451,12 @@ static Result<ExecNode*> MakeTableConsumingSinkNode(
 struct OrderBySinkNode final : public SinkNode {
   OrderBySinkNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
                   std::unique_ptr<OrderByImpl> impl,
-                  AsyncGenerator<util::optional<ExecBatch>>* generator)
+                  AsyncGenerator<util::optional<ExecBatch>>* generator,
+                  MemoryReservation spill_reservation = {})
       : SinkNode(plan, std::move(inputs), generator, /*backpressure=*/{},
                  /*backpressure_monitor_out=*/nullptr),
-        impl_(std::move(impl)) {}
+        impl_(std::move(impl)),
+        spill_reservation_(std::move(spill_reservation)) {}
 
   const char* kind_name() const override { return "OrderBySinkNode"; }
 
@@ -467,12 +470,27 @@ struct OrderBySinkNode final : public SinkNode {
       return Status::Invalid("Backpressure cannot be applied to an OrderBySinkNode");
     }
     RETURN_NOT_OK(ValidateOrderByOptions(sink_options));
-    ARROW_ASSIGN_OR_RAISE(
-        std::unique_ptr<OrderByImpl> impl,
-        OrderByImpl::MakeSort(plan->exec_context(), inputs[0]->output_schema(),
-                              sink_options.sort_options));
+    std::unique_ptr<OrderByImpl> impl;
+    MemoryReservation spill_reservation;
+    if (sink_options.spill_memory_limit > 0) {
+      int64_t spill_memory_limit = sink_options.spill_memory_limit;
+      if (plan->memory_governor()) {
+        // Share the plan's memory limit with the other nodes that spill
+        spill_reservation = plan->memory_governor()->Reserve(spill_memory_limit);
+        spill_memory_limit = spill_reservation.bytes();
+      }
+      ARROW_ASSIGN_OR_RAISE(impl, OrderByImpl::MakeExternalSort(
+                                      plan->exec_context(), inputs[0]->output_schema(),
+                                      sink_options.sort_options, spill_memory_limit));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(
+          impl, OrderByImpl::MakeSort(plan->exec_context(), inputs[0]->output_schema(),
+                                      sink_options.sort_options,
+                                      sink_options.sort_run_length));
+    }
     return plan->EmplaceNode<OrderBySinkNode>(plan, std::move(inputs), std::move(impl),
-                                              sink_options.generator);
+                                              sink_options.generator,
+                                              std::move(spill_reservation));
   }
 
   static Status ValidateCommonOrderOptions(const SinkNodeOptions& options) {
@@ -486,6 +504,12 @@ struct OrderBySinkNode final : public SinkNode {
     if (options.sort_options.sort_keys.empty()) {
       return Status::Invalid("At least one sort key should be specified");
     }
+    if (options.spill_memory_limit < 0) {
+      return Status::Invalid("spill_memory_limit cannot be negative");
+    }
+    if (options.sort_run_length <= 0) {
+      return Status::Invalid("sort_run_length must be positive");
+    }
     return ValidateCommonOrderOptions(options);
   }
 
@@ -502,11 +526,18 @@ struct OrderBySinkNode final : public SinkNode {
     ARROW_ASSIGN_OR_RAISE(
         std::unique_ptr<OrderByImpl> impl,
         OrderByImpl::MakeSelectK(plan->exec_context(), inputs[0]->output_schema(),
-                                 sink_options.select_k_options));
+                                 sink_options.select_k_options,
+                                 PushdownTarget(inputs[0])));
     return plan->EmplaceNode<OrderBySinkNode>(plan, std::move(inputs), std::move(impl),
                                               sink_options.generator);
   }
 
+  // The runtime filters of the source of `input`, if it accepts any
+  static RuntimeFilterSet* PushdownTarget(ExecNode* input) {
+    RuntimeFilterTarget* target = FindRuntimeFilterTarget(input);
+    return target ? target->runtime_filters() : NULLPTR;
+  }
+
   static Status ValidateSelectKOptions(const SelectKSinkNodeOptions& options) {
     if (options.select_k_options.k <= 0) {
       return Status::Invalid("`k` must be > 0");
@@ -534,34 +565,40 @@ struct OrderBySinkNode final : public SinkNode {
     }
     auto record_batch = maybe_batch.MoveValueUnsafe();
 
-    impl_->InputReceived(std::move(record_batch));
+    Status status = impl_->InputReceived(std::move(record_batch));
+    if (ErrorIfNotOk(status)) {
+      StopProducing();
+      if (input_counter_.Cancel()) {
+        finished_.MarkFinished(status);
+      }
+      return;
+    }
+    RecordMemoryUsage(impl_->bytes_buffered());
     if (input_counter_.Increment()) {
       Finish();
     }
   }
 
  protected:
-  Status DoFinish() {
-    ARROW_ASSIGN_OR_RAISE(Datum sorted, impl_->DoFinish());
-    TableBatchReader reader(*sorted.table());
-    while (true) {
-      std::shared_ptr<RecordBatch> batch;
-      RETURN_NOT_OK(reader.ReadNext(&batch));
-      if (!batch) break;
-      bool did_push = producer_.Push(ExecBatch(*batch));
-      if (!did_push) break;  // producer_ was Closed already
-    }
-    return Status::OK();
+  Future<> DoFinish() {
+    RecordSpilledBytes(impl_->bytes_spilled());
+    return impl_->Finish([this](ExecBatch batch) {
+      // producer_ may have been Closed already
+      return producer_.Push(std::move(batch));
+    });
   }
 
+  // The output may be produced by tasks of the plan's executor, which this thread may
+  // belong to: the producer is closed once they are done rather than waiting for them
   void Finish() override {
     util::tracing::Span span;
     START_COMPUTE_SPAN_WITH_PARENT(span, span_, "Finish", {{"node.label", label()}});
-    Status st = DoFinish();
-    if (ErrorIfNotOk(st)) {
-      producer_.Push(std::move(st));
-    }
-    SinkNode::Finish();
+    DoFinish().AddCallback([this](const Status& st) {
+      if (ErrorIfNotOk(st)) {
+        producer_.Push(st);
+      }
+      SinkNode::Finish();
+    });
   }
 
  protected:
@@ -571,6 +608,7 @@ struct OrderBySinkNode final : public SinkNode {
 
  private:
   std::unique_ptr<OrderByImpl> impl_;
+  MemoryReservation spill_reservation_;
 };
 
 }  // namespace
@@ -0,0 +1,770 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/array/array_binary.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/builder_base.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/hash_join.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/tracing_internal.h"
+#include "arrow/visit_type_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+// An input stops being read once it has this many batches queued while the join is
+// waiting for the other input
+constexpr size_t kMaxQueuedBatches = 16;
+
+constexpr int64_t kMaxOutputBatchSize = 32 * 1024;
+
+// Three-way comparison of two non-null key values
+class KeyComparator {
+ public:
+  virtual ~KeyComparator() = default;
+  virtual int Compare(const Array& left, int64_t left_row, const Array& right,
+                      int64_t right_row) const = 0;
+};
+
+template <typename T>
+int CompareValues(const T& left, const T& right) {
+  return left < right ? -1 : (right < left ? 1 : 0);
+}
+
+// NaN sorts after all other values (as in SortIndices) and matches itself (as in the
+// hash join)
+template <typename T>
+int CompareFloatingValues(T left, T right) {
+  bool left_nan = std::isnan(left), right_nan = std::isnan(right);
+  if (left_nan || right_nan) {
+    return static_cast<int>(left_nan) - static_cast<int>(right_nan);
+  }
+  return CompareValues(left, right);
+}
+
+inline int CompareValues(float left, float right) {
+  return CompareFloatingValues(left, right);
+}
+
+inline int CompareValues(double left, double right) {
+  return CompareFloatingValues(left, right);
+}
+
+template <typename Type>
+class TypedKeyComparator : public KeyComparator {
+ public:
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+
+  int Compare(const Array& left, int64_t left_row, const Array& right,
+              int64_t right_row) const override {
+    return CompareValues(checked_cast<const ArrayType&>(left).GetView(left_row),
+                         checked_cast<const ArrayType&>(right).GetView(right_row));
+  }
+};
+
+struct KeyComparatorMaker {
+  template <typename T>
+  using is_comparable_type =
+      std::integral_constant<bool, is_integer_type<T>::value ||
+                                       is_floating_type<T>::value ||
+                                       is_date_type<T>::value || is_time_type<T>::value ||
+                                       is_timestamp_type<T>::value ||
+                                       is_duration_type<T>::value ||
+                                       is_boolean_type<T>::value ||
+                                       is_base_binary_type<T>::value>;
+
+  template <typename T>
+  enable_if_t<is_comparable_type<T>::value, Status> Visit(const T&) {
+    out.reset(new TypedKeyComparator<T>());
+    return Status::OK();
+  }
+
+  Status Visit(const FixedSizeBinaryType&) {
+    out.reset(new TypedKeyComparator<FixedSizeBinaryType>());
+    return Status::OK();
+  }
+
+  Status Visit(const HalfFloatType& type) { return Unsupported(type); }
+
+  Status Visit(const DecimalType& type) { return Unsupported(type); }
+
+  Status Visit(const DataType& type) { return Unsupported(type); }
+
+  Status Unsupported(const DataType& type) {
+    return Status::NotImplemented("Data type ", type,
+                                  " is not supported in sort-merge join key field");
+  }
+
+  std::unique_ptr<KeyComparator> out;
+};
+
+// A non-empty input batch waiting to be merged
+struct QueuedBatch {
+  int64_t length;
+  // Key columns used for comparisons
+  std::vector<std::shared_ptr<Array>> keys;
+  // Columns which are copied to the output
+  std::vector<std::shared_ptr<ArrayData>> columns;
+  std::vector<ArraySpan> spans;
+};
+
+struct InputState {
+  // Column indices of the key and output fields in the input schema
+  std::vector<int> key_ids;
+  std::vector<int> output_ids;
+
+  // Batches which have not been completely merged yet.  The current row is in the
+  // front batch.
+  std::deque<QueuedBatch> batches;
+  int64_t row = 0;
+
+  // Number of rows, starting from the current row, which are known to share its key and
+  // the position just past them
+  int64_t run_length = 0;
+  size_t run_end_batch = 0;
+  int64_t run_end_row = 0;
+
+  int batches_received = 0;
+  int total_batches = -1;
+
+  bool paused = false;
+  int32_t backpressure_counter = 0;
+
+  bool finished() const { return batches_received == total_batches; }
+  bool has_row() const { return !batches.empty(); }
+  bool exhausted() const { return finished() && batches.empty(); }
+};
+
+// The output columns of one side of the join.  Consecutive rows of the same input batch
+// (and consecutive nulls) are coalesced before they are appended to the builders.
+class SideOutput {
+ public:
+  Status Init(const std::vector<std::shared_ptr<DataType>>& types, MemoryPool* pool) {
+    builders_.resize(types.size());
+    for (size_t i = 0; i < types.size(); ++i) {
+      RETURN_NOT_OK(MakeBuilder(pool, types[i], &builders_[i]));
+    }
+    return Status::OK();
+  }
+
+  Status AppendRows(const QueuedBatch* batch, int64_t offset, int64_t length) {
+    if (batch == pending_batch_ && offset == pending_offset_ + pending_length_) {
+      pending_length_ += length;
+      return Status::OK();
+    }
+    RETURN_NOT_OK(Flush());
+    pending_batch_ = batch;
+    pending_offset_ = offset;
+    pending_length_ = length;
+    return Status::OK();
+  }
+
+  Status AppendRepeated(const QueuedBatch* batch, int64_t row, int64_t repeats) {
+    for (int64_t i = 0; i < repeats; ++i) {
+      RETURN_NOT_OK(AppendRows(batch, row, 1));
+    }
+    return Status::OK();
+  }
+
+  Status AppendNulls(int64_t length) {
+    if (pending_batch_ != NULLPTR) {
+      RETURN_NOT_OK(Flush());
+    }
+    pending_length_ += length;
+    return Status::OK();
+  }
+
+  // Must be called before a batch referenced by this output is discarded
+  Status Flush() {
+    if (pending_length_ == 0) return Status::OK();
+    for (size_t i = 0; i < builders_.size(); ++i) {
+      if (pending_batch_ == NULLPTR) {
+        RETURN_NOT_OK(builders_[i]->AppendNulls(pending_length_));
+      } else {
+        RETURN_NOT_OK(builders_[i]->AppendArraySlice(pending_batch_->spans[i],
+                                                     pending_offset_, pending_length_));
+      }
+    }
+    pending_batch_ = NULLPTR;
+    pending_length_ = 0;
+    return Status::OK();
+  }
+
+  Status Finish(std::vector<Datum>* out) {
+    RETURN_NOT_OK(Flush());
+    for (auto& builder : builders_) {
+      std::shared_ptr<Array> array;
+      RETURN_NOT_OK(builder->Finish(&array));
+      out->emplace_back(std::move(array));
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::vector<std::unique_ptr<ArrayBuilder>> builders_;
+  // Either a slice of a batch or, if pending_batch_ is null, a run of nulls
+  const QueuedBatch* pending_batch_ = NULLPTR;
+  int64_t pending_offset_ = 0;
+  int64_t pending_length_ = 0;
+};
+
+class SortMergeJoinNode : public ExecNode {
+ public:
+  SortMergeJoinNode(ExecPlan* plan, NodeVector inputs,
+                    const SortMergeJoinNodeOptions& join_options,
+                    std::shared_ptr<Schema> output_schema, InputState left,
+                    InputState right, std::vector<std::unique_ptr<KeyComparator>> cmp)
+      : ExecNode(plan, inputs, {"left", "right"},
+                 /*output_schema=*/std::move(output_schema),
+                 /*num_outputs=*/1),
+        join_type_(join_options.join_type),
+        null_placement_(join_options.null_placement),
+        key_cmp_(std::move(cmp)) {
+    state_[0] = std::move(left);
+    state_[1] = std::move(right);
+    emit_unmatched_[0] = join_type_ == JoinType::LEFT_OUTER ||
+                         join_type_ == JoinType::FULL_OUTER ||
+                         join_type_ == JoinType::LEFT_ANTI;
+    emit_unmatched_[1] = join_type_ == JoinType::RIGHT_OUTER ||
+                         join_type_ == JoinType::FULL_OUTER ||
+                         join_type_ == JoinType::RIGHT_ANTI;
+    complete_.store(false);
+  }
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 2, "SortMergeJoinNode"));
+
+    const auto& join_options = checked_cast<const SortMergeJoinNodeOptions&>(options);
+    const auto& left_schema = *(inputs[0]->output_schema());
+    const auto& right_schema = *(inputs[1]->output_schema());
+
+    // The output schema is the same as the one of the equivalent hash join
+    HashJoinSchema schema_mgr;
+    if (join_options.output_all) {
+      RETURN_NOT_OK(schema_mgr.Init(join_options.join_type, left_schema,
+                                    join_options.left_keys, right_schema,
+                                    join_options.right_keys, literal(true),
+                                    join_options.output_suffix_for_left,
+                                    join_options.output_suffix_for_right));
+    } else {
+      RETURN_NOT_OK(schema_mgr.Init(
+          join_options.join_type, left_schema, join_options.left_keys,
+          join_options.left_output, right_schema, join_options.right_keys,
+          join_options.right_output, literal(true), join_options.output_suffix_for_left,
+          join_options.output_suffix_for_right));
+    }
+    std::shared_ptr<Schema> output_schema = schema_mgr.MakeOutputSchema(
+        join_options.output_suffix_for_left, join_options.output_suffix_for_right);
+
+    InputState states[2];
+    for (int side = 0; side < 2; ++side) {
+      const SchemaProjectionMaps<HashJoinProjection>& proj_map =
+          schema_mgr.proj_maps[side];
+      SchemaProjectionMap keys_to_input =
+          proj_map.map(HashJoinProjection::KEY, HashJoinProjection::INPUT);
+      for (int i = 0; i < keys_to_input.num_cols; ++i) {
+        states[side].key_ids.push_back(keys_to_input.get(i));
+      }
+      SchemaProjectionMap output_to_input =
+          proj_map.map(HashJoinProjection::OUTPUT, HashJoinProjection::INPUT);
+      for (int i = 0; i < output_to_input.num_cols; ++i) {
+        states[side].output_ids.push_back(output_to_input.get(i));
+      }
+      const auto& input_schema = *inputs[side]->output_schema();
+      for (const auto& field : input_schema.fields()) {
+        if (field->type()->id() == Type::DICTIONARY) {
+          return Status::NotImplemented("Dictionary type is not supported in ",
+                                        "sort-merge join field ", field->name());
+        }
+      }
+    }
+
+    std::vector<std::unique_ptr<KeyComparator>> key_cmp;
+    for (int id : states[0].key_ids) {
+      KeyComparatorMaker maker;
+      RETURN_NOT_OK(VisitTypeInline(*left_schema.field(id)->type(), &maker));
+      key_cmp.push_back(std::move(maker.out));
+    }
+
+    return plan->EmplaceNode<SortMergeJoinNode>(
+        plan, inputs, join_options, std::move(output_schema), std::move(states[0]),
+        std::move(states[1]), std::move(key_cmp));
+  }
+
+  const char* kind_name() const override { return "SortMergeJoinNode"; }
+
+  void InputReceived(ExecNode* input, ExecBatch batch) override {
+    EVENT(span_, "InputReceived", {{"batch.length", batch.length}});
+    ARROW_DCHECK(input == inputs_[0] || input == inputs_[1]);
+    const int side = input == inputs_[0] ? 0 : 1;
+
+    Status status;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (complete_.load()) return;
+      InputState& state = state_[side];
+      ++state.batches_received;
+      if (batch.length > 0) {
+        status = Enqueue(&state, batch);
+      }
+      if (status.ok()) {
+        status = Process();
+      }
+    }
+    Finish(std::move(status));
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    EVENT(span_, "ErrorReceived", {{"error", error.message()}});
+    ARROW_DCHECK(input == inputs_[0] || input == inputs_[1]);
+    outputs_[0]->ErrorReceived(this, std::move(error));
+    StopProducing();
+  }
+
+  void InputFinished(ExecNode* input, int total_batches) override {
+    EVENT(span_, "InputFinished", {{"batches.length", total_batches}});
+    ARROW_DCHECK(input == inputs_[0] || input == inputs_[1]);
+    const int side = input == inputs_[0] ? 0 : 1;
+
+    Status status;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (complete_.load()) return;
+      state_[side].total_batches = total_batches;
+      status = Process();
+    }
+    Finish(std::move(status));
+  }
+
+  Status StartProducing() override {
+    START_COMPUTE_SPAN(span_, std::string(kind_name()) + ":" + label(),
+                       {{"node.label", label()},
+                        {"node.detail", ToString()},
+                        {"node.kind", kind_name()}});
+    finished_ = Future<>::Make();
+    END_SPAN_ON_FUTURE_COMPLETION(span_, finished_, this);
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    // Inputs are paused and resumed by the merge itself
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    // Inputs are paused and resumed by the merge itself
+  }
+
+  void StopProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    StopProducing();
+  }
+
+  void StopProducing() override {
+    EVENT(span_, "StopProducing");
+    bool expected = false;
+    if (complete_.compare_exchange_strong(expected, true)) {
+      for (auto&& input : inputs_) {
+        input->StopProducing(this);
+      }
+      finished_.MarkFinished();
+    }
+  }
+
+  Future<> finished() override { return finished_; }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    ss << "type=" << ::arrow::compute::ToString(join_type_);
+    for (int side = 0; side < 2; ++side) {
+      const auto& input_schema = inputs_[side]->output_schema();
+      ss << (side == 0 ? ", left_keys=[" : ", right_keys=[");
+      for (size_t i = 0; i < state_[side].key_ids.size(); ++i) {
+        if (i > 0) ss << ", ";
+        ss << '"' << input_schema->field(state_[side].key_ids[i])->name() << '"';
+      }
+      ss << ']';
+    }
+    return ss.str();
+  }
+
+ private:
+  int64_t output_batch_size() {
+    int64_t result = plan()->exec_context()->exec_chunksize();
+    if (result <= 0 || result > kMaxOutputBatchSize) {
+      result = kMaxOutputBatchSize;
+    }
+    return result;
+  }
+
+  Status Enqueue(InputState* state, const ExecBatch& batch) {
+    MemoryPool* pool = plan()->exec_context()->memory_pool();
+    auto to_array = [&](int id) -> Result<std::shared_ptr<Array>> {
+      const Datum& value = batch.values[id];
+      if (value.is_array()) return value.make_array();
+      return MakeArrayFromScalar(*value.scalar(), batch.length, pool);
+    };
+
+    QueuedBatch queued;
+    queued.length = batch.length;
+    for (int id : state->key_ids) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> key, to_array(id));
+      queued.keys.push_back(std::move(key));
+    }
+    for (int id : state->output_ids) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> column, to_array(id));
+      queued.columns.push_back(column->data());
+    }
+    for (const auto& column : queued.columns) {
+      queued.spans.emplace_back(*column);
+    }
+    state->batches.push_back(std::move(queued));
+    return Status::OK();
+  }
+
+  // Three-way comparison of the keys of two rows, null keys sort according to
+  // null_placement_.  has_null is set if the keys are equal but contain nulls (and so
+  // do not match).
+  int CompareKeys(const QueuedBatch& left, int64_t left_row, const QueuedBatch& right,
+                  int64_t right_row, bool* has_null) const {
+    *has_null = false;
+    const int null_order = null_placement_ == NullPlacement::AtEnd ? 1 : -1;
+    for (size_t i = 0; i < key_cmp_.size(); ++i) {
+      const Array& left_key = *left.keys[i];
+      const Array& right_key = *right.keys[i];
+      const bool left_null = left_key.IsNull(left_row);
+      const bool right_null = right_key.IsNull(right_row);
+      if (left_null || right_null) {
+        if (!right_null) return null_order;
+        if (!left_null) return -null_order;
+        *has_null = true;
+        continue;
+      }
+      int cmp = key_cmp_[i]->Compare(left_key, left_row, right_key, right_row);
+      if (cmp != 0) return cmp;
+    }
+    return 0;
+  }
+
+  // Move the current row of an input forward, discarding batches which have been
+  // completely merged.  The pending output must not reference discarded batches.
+  Status Advance(InputState* state, int64_t num_rows) {
+    state->row += num_rows;
+    state->run_length = 0;
+    while (!state->batches.empty() && state->row >= state->batches.front().length) {
+      RETURN_NOT_OK(output_[0].Flush());
+      RETURN_NOT_OK(output_[1].Flush());
+      state->row -= state->batches.front().length;
+      state->batches.pop_front();
+    }
+    return Status::OK();
+  }
+
+  // Extend the run of rows sharing the key of the current row.  Returns true once its
+  // end is known, i.e. a row with a different key was seen or the input is finished.
+  bool FindRun(InputState* state) {
+    const QueuedBatch& current = state->batches.front();
+    if (state->run_length == 0) {
+      state->run_end_batch = 0;
+      state->run_end_row = state->row;
+    }
+    while (state->run_end_batch < state->batches.size()) {
+      const QueuedBatch& batch = state->batches[state->run_end_batch];
+      if (state->run_end_row >= batch.length) {
+        ++state->run_end_batch;
+        state->run_end_row = 0;
+        continue;
+      }
+      bool has_null;
+      if (CompareKeys(current, state->row, batch, state->run_end_row, &has_null) != 0) {
+        return true;
+      }
+      ++state->run_length;
+      ++state->run_end_row;
+    }
+    return state->finished();
+  }
+
+  Status EmitRow(int side, const QueuedBatch& batch, int64_t offset, int64_t length) {
+    RETURN_NOT_OK(output_[side].AppendRows(&batch, offset, length));
+    RETURN_NOT_OK(output_[1 - side].AppendNulls(length));
+    return RowsAppended(length);
+  }
+
+  // Emit the rows of the current batch of an input whose other input is exhausted
+  Status EmitRemaining(int side) {
+    InputState& state = state_[side];
+    const QueuedBatch& batch = state.batches.front();
+    const int64_t num_rows = batch.length - state.row;
+    if (emit_unmatched_[side]) {
+      int64_t offset = state.row;
+      while (offset < batch.length) {
+        int64_t length = std::min(batch.length - offset, output_capacity());
+        RETURN_NOT_OK(EmitRow(side, batch, offset, length));
+        offset += length;
+      }
+    }
+    return Advance(&state, num_rows);
+  }
+
+  // Emit the cross product of the runs of rows sharing the current key
+  Status EmitMatches() {
+    InputState& left = state_[0];
+    InputState& right = state_[1];
+    size_t left_batch = 0;
+    int64_t left_row = left.row;
+    for (int64_t i = 0; i < left.run_length; ++i, ++left_row) {
+      if (left_row >= left.batches[left_batch].length) {
+        ++left_batch;
+        left_row = 0;
+      }
+      size_t right_batch = 0;
+      int64_t right_row = right.row;
+      int64_t remaining = right.run_length;
+      while (remaining > 0) {
+        const QueuedBatch& batch = right.batches[right_batch];
+        if (right_row >= batch.length) {
+          ++right_batch;
+          right_row = 0;
+          continue;
+        }
+        int64_t length =
+            std::min(std::min(batch.length - right_row, remaining), output_capacity());
+        RETURN_NOT_OK(
+            output_[0].AppendRepeated(&left.batches[left_batch], left_row, length));
+        RETURN_NOT_OK(output_[1].AppendRows(&batch, right_row, length));
+        RETURN_NOT_OK(RowsAppended(length));
+        right_row += length;
+        remaining -= length;
+      }
+    }
+    const int64_t left_length = left.run_length;
+    const int64_t right_length = right.run_length;
+    RETURN_NOT_OK(Advance(&left, left_length));
+    return Advance(&right, right_length);
+  }
+
+  // Merge as much of the queued input as possible
+  Status Process() {
+    InputState& left = state_[0];
+    InputState& right = state_[1];
+    waiting_for_ = -1;
+    for (;;) {
+      if (left.exhausted() && right.exhausted()) {
+        RETURN_NOT_OK(FlushOutput());
+        outputs_[0]->InputFinished(this, batches_output_);
+        done_ = true;
+        return Status::OK();
+      }
+      if (!left.has_row() && !left.finished()) {
+        waiting_for_ = 0;
+        break;
+      }
+      if (!right.has_row() && !right.finished()) {
+        waiting_for_ = 1;
+        break;
+      }
+      if (left.exhausted()) {
+        RETURN_NOT_OK(EmitRemaining(1));
+        continue;
+      }
+      if (right.exhausted()) {
+        RETURN_NOT_OK(EmitRemaining(0));
+        continue;
+      }
+
+      const QueuedBatch& left_batch = left.batches.front();
+      const QueuedBatch& right_batch = right.batches.front();
+      bool has_null;
+      int cmp = CompareKeys(left_batch, left.row, right_batch, right.row, &has_null);
+      if (cmp < 0 || (cmp == 0 && has_null)) {
+        if (emit_unmatched_[0]) {
+          RETURN_NOT_OK(EmitRow(0, left_batch, left.row, 1));
+        }
+        RETURN_NOT_OK(Advance(&left, 1));
+        continue;
+      }
+      if (cmp > 0) {
+        if (emit_unmatched_[1]) {
+          RETURN_NOT_OK(EmitRow(1, right_batch, right.row, 1));
+        }
+        RETURN_NOT_OK(Advance(&right, 1));
+        continue;
+      }
+
+      // Semi and anti joins only need to know whether the other input has the key
+      if (join_type_ == JoinType::LEFT_SEMI || join_type_ == JoinType::LEFT_ANTI) {
+        if (join_type_ == JoinType::LEFT_SEMI) {
+          RETURN_NOT_OK(EmitRow(0, left_batch, left.row, 1));
+        }
+        RETURN_NOT_OK(Advance(&left, 1));
+        continue;
+      }
+      if (join_type_ == JoinType::RIGHT_SEMI || join_type_ == JoinType::RIGHT_ANTI) {
+        if (join_type_ == JoinType::RIGHT_SEMI) {
+          RETURN_NOT_OK(EmitRow(1, right_batch, right.row, 1));
+        }
+        RETURN_NOT_OK(Advance(&right, 1));
+        continue;
+      }
+
+      if (!FindRun(&left)) {
+        waiting_for_ = 0;
+        break;
+      }
+      if (!FindRun(&right)) {
+        waiting_for_ = 1;
+        break;
+      }
+      RETURN_NOT_OK(EmitMatches());
+    }
+
+    // Stop reading an input which is running ahead of the other one
+    for (int side = 0; side < 2; ++side) {
+      InputState& state = state_[side];
+      bool pause = waiting_for_ == 1 - side && state.batches.size() > kMaxQueuedBatches;
+      if (pause != state.paused) {
+        state.paused = pause;
+        backpressure_changes_.emplace_back(side, ++state.backpressure_counter);
+      }
+    }
+    return Status::OK();
+  }
+
+  // Called without holding the lock once the queued input has been merged
+  void Finish(Status status) {
+    std::vector<std::pair<int, int32_t>> backpressure_changes;
+    bool done;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      backpressure_changes.swap(backpressure_changes_);
+      done = done_;
+      done_ = false;
+    }
+    if (!status.ok()) {
+      ErrorIfNotOk(std::move(status));
+      StopProducing();
+      return;
+    }
+    for (const auto& change : backpressure_changes) {
+      // An odd counter pauses the input, an even one resumes it
+      if (change.second % 2 == 1) {
+        inputs_[change.first]->PauseProducing(this, change.second);
+      } else {
+        inputs_[change.first]->ResumeProducing(this, change.second);
+      }
+    }
+    if (done) {
+      bool expected = false;
+      if (complete_.compare_exchange_strong(expected, true)) {
+        finished_.MarkFinished();
+      }
+    }
+  }
+
+  int64_t output_capacity() { return output_batch_size() - output_length_; }
+
+  Status RowsAppended(int64_t num_rows) {
+    output_length_ += num_rows;
+    if (output_length_ >= output_batch_size()) {
+      return FlushOutput();
+    }
+    return Status::OK();
+  }
+
+  Status FlushOutput() {
+    if (output_length_ == 0) return Status::OK();
+    std::vector<Datum> values;
+    RETURN_NOT_OK(output_[0].Finish(&values));
+    RETURN_NOT_OK(output_[1].Finish(&values));
+    ExecBatch batch(std::move(values), output_length_);
+    output_length_ = 0;
+    ++batches_output_;
+    EmitBatch(std::move(batch));
+    return Status::OK();
+  }
+
+  Status PrepareToProduce() override {
+    MemoryPool* pool = plan()->exec_context()->memory_pool();
+    for (int side = 0; side < 2; ++side) {
+      std::vector<std::shared_ptr<DataType>> types;
+      for (int id : state_[side].output_ids) {
+        types.push_back(inputs_[side]->output_schema()->field(id)->type());
+      }
+      RETURN_NOT_OK(output_[side].Init(types, pool));
+    }
+    return Status::OK();
+  }
+
+  const JoinType join_type_;
+  const NullPlacement null_placement_;
+  const std::vector<std::unique_ptr<KeyComparator>> key_cmp_;
+  bool emit_unmatched_[2];
+
+  std::mutex mutex_;
+  InputState state_[2];
+  SideOutput output_[2];
+  int64_t output_length_ = 0;
+  int batches_output_ = 0;
+  // The input the merge needs more rows from, or -1
+  int waiting_for_ = -1;
+  // Pause (odd counter) and resume (even counter) requests for the inputs, sent once the
+  // lock is released
+  std::vector<std::pair<int, int32_t>> backpressure_changes_;
+  bool done_ = false;
+
+  std::atomic<bool> complete_;
+  Future<> finished_ = Future<>::MakeFinished();
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterSortMergeJoinNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory("sort_merge_join", SortMergeJoinNode::Make));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
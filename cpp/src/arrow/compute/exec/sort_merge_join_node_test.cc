@@ -0,0 +1,227 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "arrow/api.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/matchers.h"
+
+namespace arrow {
+namespace compute {
+
+template <typename JoinOptions>
+Result<std::shared_ptr<Table>> RunJoin(const std::string& factory_name,
+                                       const JoinOptions& options,
+                                       const BatchesWithSchema& left,
+                                       const BatchesWithSchema& right) {
+  ExecContext exec_ctx(default_memory_pool(), nullptr);
+  ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make(&exec_ctx));
+  Declaration join{factory_name, options};
+  join.inputs.emplace_back(Declaration{
+      "source", SourceNodeOptions{left.schema, left.gen(/*parallel=*/false,
+                                                        /*slow=*/false)}});
+  join.inputs.emplace_back(Declaration{
+      "source", SourceNodeOptions{right.schema, right.gen(/*parallel=*/false,
+                                                          /*slow=*/false)}});
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+  ARROW_RETURN_NOT_OK(Declaration::Sequence({join, {"sink", SinkNodeOptions{&sink_gen}}})
+                          .AddToPlan(plan.get()));
+  auto output_schema = plan->sinks()[0]->inputs()[0]->output_schema();
+  auto collected = StartAndCollect(plan.get(), sink_gen).result();
+  ARROW_RETURN_NOT_OK(collected.status());
+  return TableFromExecBatches(output_schema, *collected);
+}
+
+void CheckSortMergeJoin(const BatchesWithSchema& left, const BatchesWithSchema& right,
+                        const SortMergeJoinNodeOptions& options,
+                        const std::shared_ptr<Schema>& expected_schema,
+                        const std::string& expected_json) {
+  ASSERT_OK_AND_ASSIGN(auto actual, RunJoin("sort_merge_join", options, left, right));
+  ASSERT_OK_AND_ASSIGN(auto combined, actual->CombineChunks());
+  auto expected = TableFromJSON(expected_schema, {expected_json});
+  AssertSchemaEqual(*expected_schema, *combined->schema());
+  AssertTablesEqual(*expected, *combined, /*same_chunk_layout=*/false);
+}
+
+class SortMergeJoinTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    left_schema_ = schema({field("k", int32()), field("lv", utf8())});
+    right_schema_ = schema({field("k", int32()), field("rv", int64())});
+    // Runs of duplicate keys span batch boundaries on both sides
+    left_ = MakeBatchesFromString(left_schema_, {R"([[1, "a"], [2, "b"], [2, "c"]])",
+                                                 R"([])", R"([[2, "d"], [4, "e"]])",
+                                                 R"([[5, "f"], [null, "g"]])"});
+    right_ = MakeBatchesFromString(right_schema_, {R"([[0, 0], [2, 20]])", R"([[2, 21]])",
+                                                   R"([[2, 22], [3, 30], [5, 50]])",
+                                                   R"([[null, 100]])"});
+  }
+
+  std::shared_ptr<Schema> left_schema_, right_schema_;
+  BatchesWithSchema left_, right_;
+};
+
+TEST_F(SortMergeJoinTest, Inner) {
+  auto expected_schema = schema({field("k_l", int32()), field("lv", utf8()),
+                                 field("k_r", int32()), field("rv", int64())});
+  CheckSortMergeJoin(left_, right_,
+                     SortMergeJoinNodeOptions(JoinType::INNER, {"k"}, {"k"}, "_l", "_r"),
+                     expected_schema, R"([
+    [2, "b", 2, 20], [2, "b", 2, 21], [2, "b", 2, 22],
+    [2, "c", 2, 20], [2, "c", 2, 21], [2, "c", 2, 22],
+    [2, "d", 2, 20], [2, "d", 2, 21], [2, "d", 2, 22],
+    [5, "f", 5, 50]
+  ])");
+}
+
+TEST_F(SortMergeJoinTest, FullOuter) {
+  auto expected_schema = schema({field("k_l", int32()), field("lv", utf8()),
+                                 field("k_r", int32()), field("rv", int64())});
+  CheckSortMergeJoin(
+      left_, right_,
+      SortMergeJoinNodeOptions(JoinType::FULL_OUTER, {"k"}, {"k"}, "_l", "_r"),
+      expected_schema, R"([
+    [null, null, 0, 0], [1, "a", null, null],
+    [2, "b", 2, 20], [2, "b", 2, 21], [2, "b", 2, 22],
+    [2, "c", 2, 20], [2, "c", 2, 21], [2, "c", 2, 22],
+    [2, "d", 2, 20], [2, "d", 2, 21], [2, "d", 2, 22],
+    [null, null, 3, 30], [4, "e", null, null], [5, "f", 5, 50],
+    [null, "g", null, null], [null, null, null, 100]
+  ])");
+}
+
+TEST_F(SortMergeJoinTest, SemiAndAnti) {
+  CheckSortMergeJoin(left_, right_,
+                     SortMergeJoinNodeOptions(JoinType::LEFT_SEMI, {"k"}, {"k"}),
+                     left_schema_, R"([[2, "b"], [2, "c"], [2, "d"], [5, "f"]])");
+  CheckSortMergeJoin(left_, right_,
+                     SortMergeJoinNodeOptions(JoinType::LEFT_ANTI, {"k"}, {"k"}),
+                     left_schema_, R"([[1, "a"], [4, "e"], [null, "g"]])");
+  CheckSortMergeJoin(left_, right_,
+                     SortMergeJoinNodeOptions(JoinType::RIGHT_SEMI, {"k"}, {"k"}),
+                     right_schema_, R"([[2, 20], [2, 21], [2, 22], [5, 50]])");
+  CheckSortMergeJoin(left_, right_,
+                     SortMergeJoinNodeOptions(JoinType::RIGHT_ANTI, {"k"}, {"k"}),
+                     right_schema_, R"([[0, 0], [3, 30], [null, 100]])");
+}
+
+TEST_F(SortMergeJoinTest, OutputFields) {
+  CheckSortMergeJoin(left_, right_,
+                     SortMergeJoinNodeOptions(JoinType::LEFT_OUTER, {"k"}, {"k"},
+                                              std::vector<FieldRef>{"lv"},
+                                              std::vector<FieldRef>{"rv"}),
+                     schema({field("lv", utf8()), field("rv", int64())}), R"([
+    ["a", null], ["b", 20], ["b", 21], ["b", 22], ["c", 20], ["c", 21], ["c", 22],
+    ["d", 20], ["d", 21], ["d", 22], ["e", null], ["f", 50], ["g", null]
+  ])");
+}
+
+TEST_F(SortMergeJoinTest, Errors) {
+  auto dict_schema = schema({field("k", dictionary(int32(), utf8()))});
+  auto dict_input = MakeBatchesFromString(dict_schema, {R"([])"});
+  auto decimal_schema = schema({field("k", decimal128(10, 2))});
+  auto decimal_input = MakeBatchesFromString(decimal_schema, {R"([])"});
+  auto int64_input = MakeBatchesFromString(schema({field("k", int64())}), {R"([])"});
+  SortMergeJoinNodeOptions options(JoinType::INNER, {"k"}, {"k"});
+
+  ASSERT_RAISES(NotImplemented, RunJoin("sort_merge_join", options, dict_input,
+                                        dict_input));
+  ASSERT_RAISES(NotImplemented, RunJoin("sort_merge_join", options, decimal_input,
+                                        decimal_input));
+  ASSERT_RAISES(Invalid, RunJoin("sort_merge_join", options, left_, int64_input));
+  ASSERT_RAISES(Invalid,
+                RunJoin("sort_merge_join",
+                        SortMergeJoinNodeOptions(JoinType::INNER, {"k"}, {"missing"}),
+                        left_, right_));
+}
+
+// Make batches of random sizes holding rows sorted on (k0, k1)
+BatchesWithSchema MakeSortedBatches(std::mt19937* rng, const std::string& prefix,
+                                    int64_t num_rows, NullPlacement null_placement) {
+  std::uniform_int_distribution<int> key_dist(0, 40);
+  std::uniform_int_distribution<int> percent(0, 99);
+  Int32Builder k0;
+  StringBuilder k1;
+  Int64Builder value;
+  for (int64_t i = 0; i < num_rows; ++i) {
+    if (percent(*rng) < 5) {
+      ARROW_EXPECT_OK(k0.AppendNull());
+    } else {
+      ARROW_EXPECT_OK(k0.Append(key_dist(*rng)));
+    }
+    if (percent(*rng) < 5) {
+      ARROW_EXPECT_OK(k1.AppendNull());
+    } else {
+      ARROW_EXPECT_OK(k1.Append(std::string(1, "abc"[key_dist(*rng) % 3])));
+    }
+    ARROW_EXPECT_OK(value.Append(i));
+  }
+  auto batch_schema = schema(
+      {field("k0", int32()), field("k1", utf8()), field(prefix + "v", int64())});
+  auto batch = RecordBatch::Make(batch_schema, num_rows,
+                                 {*k0.Finish(), *k1.Finish(), *value.Finish()});
+  SortOptions sort_options({SortKey("k0"), SortKey("k1")}, null_placement);
+  auto indices = *SortIndices(Datum(batch), sort_options);
+  auto sorted = (*Take(batch, indices)).record_batch();
+
+  BatchesWithSchema out;
+  out.schema = batch_schema;
+  std::uniform_int_distribution<int64_t> size_dist(0, 12);
+  for (int64_t offset = 0; offset < num_rows;) {
+    int64_t length = std::min(size_dist(*rng), num_rows - offset);
+    out.batches.emplace_back(*sorted->Slice(offset, length));
+    offset += length;
+  }
+  return out;
+}
+
+TEST(SortMergeJoin, MatchesHashJoin) {
+  std::mt19937 rng(42);
+  for (auto null_placement : {NullPlacement::AtEnd, NullPlacement::AtStart}) {
+    for (int64_t num_rows : {0, 1, 50, 500}) {
+      auto left = MakeSortedBatches(&rng, "l", num_rows, null_placement);
+      auto right = MakeSortedBatches(&rng, "r", num_rows / 2 + 3, null_placement);
+      for (auto join_type :
+           {JoinType::INNER, JoinType::LEFT_OUTER, JoinType::RIGHT_OUTER,
+            JoinType::FULL_OUTER, JoinType::LEFT_SEMI, JoinType::RIGHT_SEMI,
+            JoinType::LEFT_ANTI, JoinType::RIGHT_ANTI}) {
+        ARROW_SCOPED_TRACE("join_type=", ToString(join_type), " num_rows=", num_rows);
+        SortMergeJoinNodeOptions merge_options(join_type, {"k0", "k1"}, {"k0", "k1"},
+                                               "_l", "_r", null_placement);
+        HashJoinNodeOptions hash_options(join_type, {"k0", "k1"}, {"k0", "k1"},
+                                         literal(true), "_l", "_r");
+        ASSERT_OK_AND_ASSIGN(auto actual,
+                             RunJoin("sort_merge_join", merge_options, left, right));
+        ASSERT_OK_AND_ASSIGN(auto expected,
+                             RunJoin("hashjoin", hash_options, left, right));
+        ASSERT_OK_AND_ASSIGN(actual, SortTableOnAllFields(actual));
+        ASSERT_OK_AND_ASSIGN(expected, SortTableOnAllFields(expected));
+        AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+      }
+    }
+  }
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -45,23 +45,29 @@ using internal::MapVector;
 namespace compute {
 namespace {
 
-struct SourceNode : ExecNode {
+struct SourceNode : ExecNode, RuntimeFilterTarget {
   SourceNode(ExecPlan* plan, std::shared_ptr<Schema> output_schema,
-             AsyncGenerator<util::optional<ExecBatch>> generator)
+             AsyncGenerator<util::optional<ExecBatch>> generator,
+             std::shared_ptr<RuntimeFilterSet> runtime_filters = NULLPTR)
       : ExecNode(plan, {}, {}, std::move(output_schema),
                  /*num_outputs=*/1),
-        generator_(std::move(generator)) {}
+        generator_(std::move(generator)),
+        runtime_filters_(runtime_filters ? std::move(runtime_filters)
+                                         : std::make_shared<RuntimeFilterSet>()) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
     RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 0, "SourceNode"));
     const auto& source_options = checked_cast<const SourceNodeOptions&>(options);
     return plan->EmplaceNode<SourceNode>(plan, source_options.output_schema,
-                                         source_options.generator);
+                                         source_options.generator,
+                                         source_options.runtime_filters);
   }
 
   const char* kind_name() const override { return "SourceNode"; }
 
+  RuntimeFilterSet* runtime_filters() override { return runtime_filters_.get(); }
+
   [[noreturn]] static void NoInputs() {
     Unreachable("no inputs; this should never be called");
   }
@@ -86,6 +92,12 @@ struct SourceNode : ExecNode {
       }
     }
 
+    const StopToken& stop_token = plan()->exec_context()->stop_token();
+    if (stop_token.IsStoppable()) {
+      // Once cancelled, the generator fails and the error is reported downstream
+      generator_ = MakeCancellable(std::move(generator_), stop_token);
+    }
+
     CallbackOptions options;
     auto executor = plan()->exec_context()->executor();
     if (executor) {
@@ -116,19 +128,25 @@ struct SourceNode : ExecNode {
                         ExecBatch batch = std::move(*maybe_batch);
 
                         if (executor) {
+                          lock.lock();
+                          ++batches_in_flight_;
+                          lock.unlock();
                           auto status = task_group_.AddTask(
                               [this, executor, batch]() -> Result<Future<>> {
-                                return executor->Submit([=]() {
-                                  outputs_[0]->InputReceived(this, std::move(batch));
-                                  return Status::OK();
-                                });
+                                return executor->Submit(
+                                    plan_->MakeTaskHints(), [=]() {
+                                      OutputBatch(std::move(batch));
+                                      BatchConsumed();
+                                      return Status::OK();
+                                    });
                               });
                           if (!status.ok()) {
+                            BatchConsumed();
                             outputs_[0]->ErrorReceived(this, std::move(status));
                             return Break(total_batches);
                           }
                         } else {
-                          outputs_[0]->InputReceived(this, std::move(batch));
+                          OutputBatch(std::move(batch));
                         }
                         lock.lock();
                         if (!backpressure_future_.is_finished()) {
@@ -136,6 +154,19 @@ struct SourceNode : ExecNode {
                           return backpressure_future_.Then(
                               []() -> ControlFlow<int> { return Continue(); });
                         }
+                        // Don't run ahead of the rest of the plan while it is over its
+                        // memory limit.  Only batches still being pushed are waited for,
+                        // memory held elsewhere (e.g. by a hash table) could otherwise
+                        // stall the plan forever.
+                        auto governor = plan()->memory_governor();
+                        if (governor && batches_in_flight_ > 0 && governor->exceeded()) {
+                          EVENT(span_, "Source paused due to the plan's memory limit");
+                          if (in_flight_drained_.is_finished()) {
+                            in_flight_drained_ = Future<>::Make();
+                          }
+                          return in_flight_drained_.Then(
+                              []() -> ControlFlow<int> { return Continue(); });
+                        }
                         return Future<ControlFlow<int>>::MakeFinished(Continue());
                       },
                       [=](const Status& error) -> ControlFlow<int> {
@@ -152,6 +183,9 @@ struct SourceNode : ExecNode {
                       },
                       options);
                 }).Then([&](int total_batches) {
+      // Release the generator, and with it any batches it has read ahead, as it is not
+      // going to be polled again (this matters when the node was stopped early)
+      generator_ = {};
       outputs_[0]->InputFinished(this, total_batches);
       return task_group_.End();
     });
@@ -194,20 +228,56 @@ struct SourceNode : ExecNode {
   }
 
   void StopProducing() override {
-    std::unique_lock<std::mutex> lock(mutex_);
-    stop_requested_ = true;
+    Future<> to_finish;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      stop_requested_ = true;
+      // A paused source would never notice the request
+      if (!backpressure_future_.is_finished()) {
+        to_finish = backpressure_future_;
+      }
+    }
+    if (to_finish.is_valid()) {
+      to_finish.MarkFinished();
+    }
   }
 
   Future<> finished() override { return finished_; }
 
  private:
+  void OutputBatch(ExecBatch batch) {
+    Status st = runtime_filters_->Apply(plan()->exec_context(), &batch);
+    if (!st.ok()) {
+      outputs_[0]->ErrorReceived(this, std::move(st));
+      return;
+    }
+    EmitBatch(std::move(batch));
+  }
+
+  void BatchConsumed() {
+    Future<> to_finish;
+    {
+      std::lock_guard<std::mutex> lg(mutex_);
+      if (--batches_in_flight_ == 0 && !in_flight_drained_.is_finished()) {
+        to_finish = in_flight_drained_;
+      }
+    }
+    if (to_finish.is_valid()) {
+      to_finish.MarkFinished();
+    }
+  }
+
   std::mutex mutex_;
   int32_t backpressure_counter_{0};
   Future<> backpressure_future_ = Future<>::MakeFinished();
   bool stop_requested_{false};
   int batch_count_{0};
+  // Batches submitted to the executor whose InputReceived has not returned yet
+  int batches_in_flight_{0};
+  Future<> in_flight_drained_ = Future<>::MakeFinished();
   util::AsyncTaskGroup task_group_;
   AsyncGenerator<util::optional<ExecBatch>> generator_;
+  std::shared_ptr<RuntimeFilterSet> runtime_filters_;
 };
 
 struct TableSourceNode : public SourceNode {
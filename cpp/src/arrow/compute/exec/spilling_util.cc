@@ -0,0 +1,204 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/exec/spilling_util.h"
+
+#include <algorithm>
+
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec/key_hash.h"
+#include "arrow/compute/exec/partition_util.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+
+namespace arrow {
+
+using internal::PlatformFilename;
+
+namespace compute {
+
+SpillFile::SpillFile(ExecContext* ctx, std::shared_ptr<Schema> schema,
+                     PlatformFilename path)
+    : ctx_(ctx), schema_(std::move(schema)), path_(std::move(path)) {}
+
+SpillFile::~SpillFile() {
+  if (!finished_ && writer_) {
+    ARROW_WARN_NOT_OK(Finish(), "Failed to close spill file");
+  }
+  ARROW_WARN_NOT_OK(::arrow::internal::DeleteFile(path_).status(),
+                    "Failed to delete spill file");
+}
+
+Status SpillFile::Append(const ExecBatch& batch) {
+  DCHECK(!finished_);
+  if (!writer_) {
+    ARROW_ASSIGN_OR_RAISE(sink_, io::FileOutputStream::Open(path_.ToString()));
+    ARROW_ASSIGN_OR_RAISE(writer_, ipc::MakeFileWriter(sink_, schema_));
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
+                        batch.ToRecordBatch(schema_, ctx_->memory_pool()));
+  RETURN_NOT_OK(writer_->WriteRecordBatch(*record_batch));
+  ARROW_ASSIGN_OR_RAISE(bytes_written_, sink_->Tell());
+  ++num_batches_;
+  num_rows_ += batch.length;
+  return Status::OK();
+}
+
+Status SpillFile::Finish() {
+  DCHECK(!finished_);
+  finished_ = true;
+  if (!writer_) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(writer_->Close());
+  ARROW_ASSIGN_OR_RAISE(bytes_written_, sink_->Tell());
+  RETURN_NOT_OK(sink_->Close());
+  writer_.reset();
+  sink_.reset();
+  return Status::OK();
+}
+
+Result<std::shared_ptr<ipc::RecordBatchFileReader>> SpillFile::OpenReader() const {
+  if (!finished_) {
+    return Status::Invalid("Spill file must be finished before it is read");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto file,
+                        io::ReadableFile::Open(path_.ToString(), ctx_->memory_pool()));
+  auto read_options = ipc::IpcReadOptions::Defaults();
+  read_options.memory_pool = ctx_->memory_pool();
+  return ipc::RecordBatchFileReader::Open(std::move(file), read_options);
+}
+
+Result<ExecBatch> SpillFile::ReadBatch(int index) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader());
+  ARROW_ASSIGN_OR_RAISE(auto record_batch, reader->ReadRecordBatch(index));
+  return ExecBatch(*record_batch);
+}
+
+Result<util::AccumulationQueue> SpillFile::ReadAll() const {
+  util::AccumulationQueue batches;
+  if (num_batches_ == 0) {
+    return std::move(batches);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader());
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto record_batch, reader->ReadRecordBatch(i));
+    batches.InsertBatch(ExecBatch(*record_batch));
+  }
+  return std::move(batches);
+}
+
+Status SpillingPartitioner::Init(ExecContext* ctx, std::shared_ptr<Schema> schema,
+                                 std::vector<int> key_ids, int log_num_partitions,
+                                 int64_t max_buffered_bytes,
+                                 const PlatformFilename& directory,
+                                 const std::string& file_prefix) {
+  DCHECK(log_num_partitions >= 0 && log_num_partitions <= 15);
+  ctx_ = ctx;
+  schema_ = std::move(schema);
+  key_ids_ = std::move(key_ids);
+  int num_partitions = 1 << log_num_partitions;
+  max_buffered_bytes_per_partition_ = std::max<int64_t>(
+      1, max_buffered_bytes / static_cast<int64_t>(num_partitions));
+  partitions_.resize(num_partitions);
+  for (int i = 0; i < num_partitions; ++i) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto path, directory.Join(file_prefix + "-" + std::to_string(i) + ".arrow"));
+    partitions_[i].file =
+        arrow::internal::make_unique<SpillFile>(ctx_, schema_, std::move(path));
+  }
+  return Status::OK();
+}
+
+Status SpillingPartitioner::Push(const ExecBatch& batch) {
+  ARROW_ASSIGN_OR_RAISE(std::vector<ExecBatch> pieces,
+                        HashPartitionBatch(ctx_, batch, key_ids_, num_partitions()));
+  // Slices share the buffers of the permuted batch, so attribute its size to each
+  // partition proportionally to the number of rows it received.
+  const double bytes_per_row =
+      batch.length == 0 ? 0.0
+                        : static_cast<double>(batch.TotalBufferSize()) / batch.length;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (int prtn = 0; prtn < num_partitions(); ++prtn) {
+    if (pieces[prtn].length == 0) {
+      continue;
+    }
+    Partition& partition = partitions_[prtn];
+    partition.num_rows += pieces[prtn].length;
+    partition.buffered_bytes += static_cast<int64_t>(bytes_per_row * pieces[prtn].length);
+    partition.buffered.push_back(std::move(pieces[prtn]));
+    if (partition.buffered_bytes >= max_buffered_bytes_per_partition_) {
+      RETURN_NOT_OK(SpillPartition(prtn));
+    }
+  }
+  return Status::OK();
+}
+
+Status SpillingPartitioner::SpillPartition(int partition) {
+  Partition& prtn = partitions_[partition];
+  int64_t bytes_before = prtn.file->bytes_written();
+  for (const ExecBatch& batch : prtn.buffered) {
+    RETURN_NOT_OK(prtn.file->Append(batch));
+  }
+  bytes_spilled_ += prtn.file->bytes_written() - bytes_before;
+  prtn.buffered.clear();
+  prtn.buffered_bytes = 0;
+  return Status::OK();
+}
+
+Status SpillingPartitioner::Finish() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (int prtn = 0; prtn < num_partitions(); ++prtn) {
+    if (partitions_[prtn].file->num_batches() > 0) {
+      RETURN_NOT_OK(SpillPartition(prtn));
+    }
+    RETURN_NOT_OK(partitions_[prtn].file->Finish());
+  }
+  return Status::OK();
+}
+
+Result<util::AccumulationQueue> SpillingPartitioner::TakePartition(int partition) {
+  DCHECK(partition >= 0 && partition < num_partitions());
+  Partition& prtn = partitions_[partition];
+  ARROW_ASSIGN_OR_RAISE(util::AccumulationQueue batches, prtn.file->ReadAll());
+  for (ExecBatch& batch : prtn.buffered) {
+    batches.InsertBatch(std::move(batch));
+  }
+  prtn.buffered.clear();
+  prtn.buffered_bytes = 0;
+  // Release the disk space as soon as the partition has been read back
+  prtn.file.reset();
+  return std::move(batches);
+}
+
+int64_t SpillingPartitioner::num_rows(int partition) const {
+  return partitions_[partition].num_rows;
+}
+
+int64_t SpillingPartitioner::bytes_spilled() const { return bytes_spilled_; }
+
+}  // namespace compute
+}  // namespace arrow
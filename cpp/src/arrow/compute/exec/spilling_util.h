@@ -0,0 +1,154 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/accumulation_queue.h"
+#include "arrow/io/type_fwd.h"
+#include "arrow/ipc/type_fwd.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+/// \brief A sequence of batches written to local disk as an Arrow IPC file
+///
+/// Batches are appended with Append() and become readable once Finish() has been
+/// called.  The file is removed when the SpillFile is destroyed.
+///
+/// This class is not thread-safe.
+class ARROW_EXPORT SpillFile {
+ public:
+  SpillFile(ExecContext* ctx, std::shared_ptr<Schema> schema,
+            ::arrow::internal::PlatformFilename path);
+  ~SpillFile();
+
+  SpillFile(const SpillFile&) = delete;
+  SpillFile& operator=(const SpillFile&) = delete;
+
+  /// \brief Write a batch to the end of the file
+  Status Append(const ExecBatch& batch);
+
+  /// \brief Flush and close the file, it may not be appended to afterwards
+  Status Finish();
+
+  /// \brief Read back all batches, in the order they were appended
+  Result<util::AccumulationQueue> ReadAll() const;
+
+  /// \brief Read back a single batch
+  Result<ExecBatch> ReadBatch(int index) const;
+
+  /// \brief Open the finished file for reading batches one at a time
+  Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader() const;
+
+  int64_t num_batches() const { return num_batches_; }
+  int64_t num_rows() const { return num_rows_; }
+  /// \brief Number of bytes written so far
+  int64_t bytes_written() const { return bytes_written_; }
+
+ private:
+  ExecContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  ::arrow::internal::PlatformFilename path_;
+  std::shared_ptr<io::OutputStream> sink_;
+  std::shared_ptr<ipc::RecordBatchWriter> writer_;
+  bool finished_ = false;
+  int64_t num_batches_ = 0;
+  int64_t num_rows_ = 0;
+  int64_t bytes_written_ = 0;
+};
+
+/// \brief Hash partitions batches on a set of key columns and spills each partition
+///        to its own SpillFile.
+///
+/// Rows are assigned to partitions using the high bits of their Hashing32 key hash.
+/// Two partitioners fed with inputs that have the same key types therefore route rows
+/// with equal keys to partitions with the same index, which is what a grace hash join
+/// relies upon.
+///
+/// Push() is thread-safe.  Rows are buffered in memory per partition and written out
+/// whenever a partition's buffer grows beyond max_buffered_bytes / num_partitions, so
+/// small partitions never touch the disk.
+class ARROW_EXPORT SpillingPartitioner {
+ public:
+  /// \brief Initialize the partitioner
+  ///
+  /// \param ctx execution context used for memory allocation and CPU feature detection
+  /// \param schema schema of the batches that will be pushed
+  /// \param key_ids indices of the key columns in the pushed batches
+  /// \param log_num_partitions log2 of the number of partitions to create
+  /// \param max_buffered_bytes upper bound on the bytes kept in memory across all
+  ///        partitions before they are written to disk
+  /// \param directory directory in which to create the spill files
+  /// \param file_prefix prefix for the names of the spill files
+  Status Init(ExecContext* ctx, std::shared_ptr<Schema> schema, std::vector<int> key_ids,
+              int log_num_partitions, int64_t max_buffered_bytes,
+              const ::arrow::internal::PlatformFilename& directory,
+              const std::string& file_prefix);
+
+  /// \brief Partition a batch, spilling partitions whose buffers are full
+  Status Push(const ExecBatch& batch);
+
+  /// \brief Spill the remaining rows of partitions that have already spilled, and close
+  ///        the spill files
+  Status Finish();
+
+  /// \brief Take all batches of a partition, reading spilled ones back from disk
+  ///
+  /// Finish() must have been called.  Partitions that never exceeded their share of
+  /// max_buffered_bytes are returned straight from memory.  Each partition may only be
+  /// taken once.
+  Result<util::AccumulationQueue> TakePartition(int partition);
+
+  int num_partitions() const { return static_cast<int>(partitions_.size()); }
+  /// \brief Number of rows pushed into the given partition
+  int64_t num_rows(int partition) const;
+  /// \brief Total number of bytes written to disk
+  int64_t bytes_spilled() const;
+
+ private:
+  Status SpillPartition(int partition);
+
+  struct Partition {
+    std::unique_ptr<SpillFile> file;
+    std::vector<ExecBatch> buffered;
+    int64_t buffered_bytes = 0;
+    int64_t num_rows = 0;
+  };
+
+  ExecContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<int> key_ids_;
+  int64_t max_buffered_bytes_per_partition_;
+  std::vector<Partition> partitions_;
+  int64_t bytes_spilled_ = 0;
+  std::mutex mutex_;
+};
+
+}  // namespace compute
+}  // namespace arrow
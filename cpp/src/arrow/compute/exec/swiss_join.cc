@@ -0,0 +1,441 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/exec/swiss_join.h"
+
+#include <algorithm>
+
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec/key_hash.h"
+#include "arrow/compute/row/compare_internal.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+constexpr int kLogMiniBatchLength = 10;
+static_assert((1 << kLogMiniBatchLength) == util::MiniBatch::kMiniBatchLength,
+              "log of mini-batch length does not match");
+
+// Size of the temporary stacks used for hashing, lookups and comparisons of a single
+// mini-batch
+constexpr int64_t kTempStackSize = 64 * util::MiniBatch::kMiniBatchLength;
+
+// Padding appended to arrays of hashes, which SIMD versions of SwissTable lookups may
+// read beyond the last element
+constexpr int64_t kHashPadding = 64 / sizeof(uint32_t);
+
+// Do not split the hash table into partitions smaller than this
+constexpr int64_t kMinRowsPerPartition = 4096;
+
+constexpr int kMaxLogNumPartitions = 6;
+
+Result<ExecBatch> BroadcastScalars(const ExecBatch& batch, MemoryPool* pool) {
+  ExecBatch result = batch;
+  for (Datum& value : result.values) {
+    if (value.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(value,
+                            MakeArrayFromScalar(*value.scalar(), batch.length, pool));
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+bool SwissJoinHashTable::IsSupported(
+    const std::vector<std::shared_ptr<DataType>>& key_types) {
+#if ARROW_LITTLE_ENDIAN
+  for (const auto& type : key_types) {
+    const Type::type id = type->id();
+    if (id == Type::DICTIONARY || id == Type::NA) {
+      return false;
+    }
+    if (!is_fixed_width(id) && !is_binary_like(id)) {
+      return false;
+    }
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+Status SwissJoinHashTable::Init(ExecContext* ctx,
+                                const std::vector<std::shared_ptr<DataType>>& key_types,
+                                size_t num_threads, int64_t num_build_batches,
+                                int64_t num_build_rows) {
+  ARROW_DCHECK(IsSupported(key_types));
+  ctx_ = ctx;
+  hardware_flags_ = ctx->cpu_info()->hardware_flags();
+
+  col_metadata_.resize(key_types.size());
+  for (size_t i = 0; i < key_types.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(col_metadata_[i], ColumnMetadataFromDataType(key_types[i]));
+  }
+
+  // Use enough partitions to keep all threads busy while building, unless that would
+  // leave them too small to amortize the fixed cost of a hash table.
+  log_num_partitions_ = 0;
+  while (log_num_partitions_ < kMaxLogNumPartitions &&
+         (static_cast<size_t>(1) << log_num_partitions_) < num_threads &&
+         (num_build_rows >> (log_num_partitions_ + 1)) >= kMinRowsPerPartition) {
+    ++log_num_partitions_;
+  }
+
+  partitions_.resize(num_partitions());
+  for (auto& prtn : partitions_) {
+    prtn = ::arrow::internal::make_unique<Partition>();
+    prtn->build_keys.resize(num_build_batches);
+    prtn->build_hashes.resize(num_build_batches);
+    prtn->build_row_ids.resize(num_build_batches);
+  }
+
+  local_states_.clear();
+  local_states_.resize(num_threads);
+  return Status::OK();
+}
+
+Status SwissJoinHashTable::InitThreadLocalStateIfNeeded(size_t thread_index) {
+  ARROW_DCHECK_LT(thread_index, local_states_.size());
+  ThreadLocalState& state = local_states_[thread_index];
+  if (!state.is_initialized) {
+    RETURN_NOT_OK(state.temp_stack.Init(ctx_->memory_pool(), kTempStackSize));
+    state.encode_ctx.hardware_flags = hardware_flags_;
+    state.encode_ctx.stack = &state.temp_stack;
+    state.encoder.Init(col_metadata_, &state.encode_ctx,
+                       /*row_alignment=*/sizeof(uint64_t),
+                       /*string_alignment=*/sizeof(uint64_t));
+    state.is_initialized = true;
+  }
+  return Status::OK();
+}
+
+Status SwissJoinHashTable::PartitionKeys(const ExecBatch& input,
+                                         const std::vector<bool>* row_filter,
+                                         util::TempVectorStack* temp_stack,
+                                         ExecBatch* permuted,
+                                         std::vector<int32_t>* row_ids,
+                                         std::vector<uint32_t>* hashes,
+                                         std::vector<int64_t>* offsets) const {
+  ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch,
+                        BroadcastScalars(input, ctx_->memory_pool()));
+  const int64_t num_rows = key_batch.length;
+
+  std::vector<uint32_t> batch_hashes(num_rows);
+  RETURN_NOT_OK(Hashing32::HashBatch(key_batch, batch_hashes.data(), hardware_flags_,
+                                     temp_stack, 0, num_rows));
+
+  // Counting sort of row ids on partition id, which is given by the highest bits of the
+  // hash.  The remaining bits are kept for use inside the partition's hash table.
+  const int num_prtns = num_partitions();
+  const int shift = 32 - log_num_partitions_;
+  auto prtn_id = [&](uint32_t hash) {
+    return log_num_partitions_ == 0 ? 0 : static_cast<int>(hash >> shift);
+  };
+  offsets->assign(num_prtns + 1, 0);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    if (!row_filter || (*row_filter)[i]) {
+      ++(*offsets)[prtn_id(batch_hashes[i]) + 1];
+    }
+  }
+  for (int prtn = 0; prtn < num_prtns; ++prtn) {
+    (*offsets)[prtn + 1] += (*offsets)[prtn];
+  }
+  const int64_t num_selected = offsets->back();
+  std::vector<int64_t> next(offsets->begin(), offsets->end() - 1);
+  row_ids->resize(num_selected);
+  hashes->resize(num_selected + kHashPadding);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    if (!row_filter || (*row_filter)[i]) {
+      int64_t pos = next[prtn_id(batch_hashes[i])]++;
+      (*row_ids)[pos] = static_cast<int32_t>(i);
+      (*hashes)[pos] = log_num_partitions_ == 0 ? batch_hashes[i]
+                                                : batch_hashes[i] << log_num_partitions_;
+    }
+  }
+
+  // Gather the keys in partition order
+  auto indices = std::make_shared<Int32Array>(num_selected, Buffer::Wrap(*row_ids));
+  *permuted = ExecBatch({}, num_selected);
+  permuted->values.resize(key_batch.values.size());
+  for (size_t i = 0; i < key_batch.values.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(permuted->values[i], Take(key_batch.values[i], indices,
+                                                    TakeOptions::NoBoundsCheck(), ctx_));
+  }
+  return Status::OK();
+}
+
+Status SwissJoinHashTable::PartitionBuildBatch(int64_t batch_index,
+                                               const ExecBatch& key_batch,
+                                               int32_t first_row_id) {
+  if (key_batch.length == 0) {
+    return Status::OK();
+  }
+  util::TempVectorStack temp_stack;
+  RETURN_NOT_OK(temp_stack.Init(ctx_->memory_pool(), kTempStackSize));
+
+  ExecBatch permuted;
+  std::vector<int32_t> row_ids;
+  std::vector<uint32_t> hashes;
+  std::vector<int64_t> offsets;
+  RETURN_NOT_OK(PartitionKeys(key_batch, /*row_filter=*/nullptr, &temp_stack, &permuted,
+                              &row_ids, &hashes, &offsets));
+
+  // Each batch writes to its own slot of every partition, so no locking is needed
+  for (int prtn = 0; prtn < num_partitions(); ++prtn) {
+    const int64_t begin = offsets[prtn];
+    const int64_t length = offsets[prtn + 1] - begin;
+    if (length == 0) {
+      continue;
+    }
+    Partition* partition = partitions_[prtn].get();
+    partition->build_keys[batch_index] = permuted.Slice(begin, length);
+    partition->build_hashes[batch_index].assign(hashes.begin() + begin,
+                                                hashes.begin() + begin + length);
+    partition->build_hashes[batch_index].resize(length + kHashPadding);
+    std::vector<int32_t>& ids = partition->build_row_ids[batch_index];
+    ids.resize(length);
+    for (int64_t i = 0; i < length; ++i) {
+      ids[i] = first_row_id + row_ids[begin + i];
+    }
+  }
+  return Status::OK();
+}
+
+Status SwissJoinHashTable::BuildPartition(int partition) {
+  Partition* prtn = partitions_[partition].get();
+  MemoryPool* pool = ctx_->memory_pool();
+
+  RETURN_NOT_OK(prtn->temp_stack.Init(pool, kTempStackSize));
+  prtn->encode_ctx.hardware_flags = hardware_flags_;
+  prtn->encode_ctx.stack = &prtn->temp_stack;
+  prtn->encoder.Init(col_metadata_, &prtn->encode_ctx,
+                     /*row_alignment=*/sizeof(uint64_t),
+                     /*string_alignment=*/sizeof(uint64_t));
+  RETURN_NOT_OK(prtn->rows.Init(pool, prtn->encoder.row_metadata()));
+  RETURN_NOT_OK(prtn->rows_minibatch.Init(pool, prtn->encoder.row_metadata()));
+  auto equal_impl = [prtn](int num_keys, const uint16_t* selection_may_be_null,
+                           const uint32_t* group_ids, uint32_t* out_num_keys_mismatch,
+                           uint16_t* out_selection_mismatch) {
+    KeyCompare::CompareColumnsToRows(num_keys, selection_may_be_null, group_ids,
+                                     &prtn->encode_ctx, out_num_keys_mismatch,
+                                     out_selection_mismatch,
+                                     prtn->encoder.batch_all_cols(), prtn->rows);
+  };
+  auto append_impl = [prtn](int num_keys, const uint16_t* selection) {
+    RETURN_NOT_OK(
+        prtn->encoder.EncodeSelected(&prtn->rows_minibatch, num_keys, selection));
+    return prtn->rows.AppendSelectionFrom(prtn->rows_minibatch, num_keys, nullptr);
+  };
+  RETURN_NOT_OK(prtn->map.init(hardware_flags_, pool, &prtn->temp_stack,
+                               kLogMiniBatchLength, equal_impl, append_impl));
+
+  int64_t num_rows = 0;
+  for (const auto& ids : prtn->build_row_ids) {
+    num_rows += static_cast<int64_t>(ids.size());
+  }
+  std::vector<uint32_t> key_ids(num_rows);
+  std::vector<int32_t> row_ids;
+  row_ids.reserve(num_rows);
+
+  std::vector<KeyColumnArray> cols;
+  for (size_t ibatch = 0; ibatch < prtn->build_keys.size(); ++ibatch) {
+    const ExecBatch& keys = prtn->build_keys[ibatch];
+    if (keys.length == 0) {
+      continue;
+    }
+    RETURN_NOT_OK(ColumnArraysFromExecBatch(keys, &cols));
+    const uint32_t* hashes = prtn->build_hashes[ibatch].data();
+    uint32_t* batch_key_ids = key_ids.data() + row_ids.size();
+    for (int64_t start = 0; start < keys.length;
+         start += util::MiniBatch::kMiniBatchLength) {
+      const int num_keys = static_cast<int>(std::min(
+          keys.length - start, static_cast<int64_t>(util::MiniBatch::kMiniBatchLength)));
+
+      prtn->rows_minibatch.Clean();
+      prtn->encoder.PrepareEncodeSelected(start, num_keys, cols);
+
+      auto match_bitvector = util::TempVectorHolder<uint8_t>(
+          &prtn->temp_stack, static_cast<uint32_t>(bit_util::BytesForBits(num_keys)));
+      {
+        auto local_slots = util::TempVectorHolder<uint8_t>(&prtn->temp_stack, num_keys);
+        prtn->map.early_filter(num_keys, hashes + start, match_bitvector.mutable_data(),
+                               local_slots.mutable_data());
+        prtn->map.find(num_keys, hashes + start, match_bitvector.mutable_data(),
+                       local_slots.mutable_data(), batch_key_ids + start);
+      }
+      auto ids = util::TempVectorHolder<uint16_t>(&prtn->temp_stack, num_keys);
+      int num_ids;
+      util::bit_util::bits_to_indexes(0, hardware_flags_, num_keys,
+                                      match_bitvector.mutable_data(), &num_ids,
+                                      ids.mutable_data());
+      RETURN_NOT_OK(prtn->map.map_new_keys(num_ids, ids.mutable_data(), hashes + start,
+                                           batch_key_ids + start));
+    }
+    const std::vector<int32_t>& batch_row_ids = prtn->build_row_ids[ibatch];
+    row_ids.insert(row_ids.end(), batch_row_ids.begin(), batch_row_ids.end());
+  }
+
+  // The inputs are no longer needed once the keys are in the row table
+  std::vector<ExecBatch>().swap(prtn->build_keys);
+  std::vector<std::vector<uint32_t>>().swap(prtn->build_hashes);
+  std::vector<std::vector<int32_t>>().swap(prtn->build_row_ids);
+
+  // Group build row ids by key id
+  const int64_t num_keys = prtn->rows.length();
+  prtn->row_id_offsets.assign(num_keys + 1, 0);
+  for (uint32_t key_id : key_ids) {
+    ++prtn->row_id_offsets[key_id + 1];
+  }
+  for (int64_t key_id = 0; key_id < num_keys; ++key_id) {
+    prtn->row_id_offsets[key_id + 1] += prtn->row_id_offsets[key_id];
+  }
+  std::vector<uint32_t> next(prtn->row_id_offsets.begin(),
+                             prtn->row_id_offsets.end() - 1);
+  prtn->row_ids.resize(num_rows);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    prtn->row_ids[next[key_ids[i]]++] = row_ids[i];
+  }
+  return Status::OK();
+}
+
+Status SwissJoinHashTable::Probe(size_t thread_index, const ExecBatch& key_batch,
+                                 const std::vector<JoinKeyCmp>& key_cmp,
+                                 std::vector<int32_t>* match,
+                                 std::vector<int32_t>* no_match,
+                                 std::vector<int32_t>* match_left,
+                                 std::vector<int32_t>* match_right) {
+  RETURN_NOT_OK(InitThreadLocalStateIfNeeded(thread_index));
+  ThreadLocalState& state = local_states_[thread_index];
+  const int64_t num_rows = key_batch.length;
+
+  // Rows with a null in a key compared for equality cannot match anything
+  std::vector<bool> row_filter;
+  for (size_t icol = 0; icol < key_cmp.size(); ++icol) {
+    if (key_cmp[icol] != JoinKeyCmp::EQ) {
+      continue;
+    }
+    const Datum& value = key_batch[static_cast<int>(icol)];
+    if (value.is_scalar()) {
+      if (!value.scalar()->is_valid) {
+        for (int32_t irow = 0; irow < num_rows; ++irow) {
+          no_match->push_back(irow);
+        }
+        return Status::OK();
+      }
+      continue;
+    }
+    const ArrayData& array = *value.array();
+    if (array.GetNullCount() == 0) {
+      continue;
+    }
+    if (row_filter.empty()) {
+      row_filter.assign(num_rows, true);
+    }
+    const uint8_t* validity = array.buffers[0]->data();
+    for (int64_t irow = 0; irow < num_rows; ++irow) {
+      if (!bit_util::GetBit(validity, array.offset + irow)) {
+        row_filter[irow] = false;
+      }
+    }
+  }
+
+  ExecBatch permuted;
+  std::vector<int32_t> row_ids;
+  std::vector<uint32_t> hashes;
+  std::vector<int64_t> offsets;
+  RETURN_NOT_OK(PartitionKeys(key_batch, row_filter.empty() ? nullptr : &row_filter,
+                              &state.temp_stack, &permuted, &row_ids, &hashes,
+                              &offsets));
+
+  // Partition (plus one, zero meaning no match) and key id for every probe row
+  state.row_partitions.assign(num_rows, 0);
+  state.key_ids.resize(num_rows);
+
+  std::vector<KeyColumnArray> cols;
+  for (int iprtn = 0; iprtn < num_partitions(); ++iprtn) {
+    const int64_t begin = offsets[iprtn];
+    const int64_t length = offsets[iprtn + 1] - begin;
+    const Partition* prtn = partitions_[iprtn].get();
+    if (length == 0 || prtn->rows.length() == 0) {
+      continue;
+    }
+    RETURN_NOT_OK(ColumnArraysFromExecBatch(permuted, begin, length, &cols));
+    auto equal_impl = [&state, prtn](int num_keys, const uint16_t* selection_may_be_null,
+                                     const uint32_t* group_ids,
+                                     uint32_t* out_num_keys_mismatch,
+                                     uint16_t* out_selection_mismatch) {
+      KeyCompare::CompareColumnsToRows(num_keys, selection_may_be_null, group_ids,
+                                       &state.encode_ctx, out_num_keys_mismatch,
+                                       out_selection_mismatch,
+                                       state.encoder.batch_all_cols(), prtn->rows);
+    };
+    for (int64_t start = 0; start < length; start += util::MiniBatch::kMiniBatchLength) {
+      const int num_keys = static_cast<int>(std::min(
+          length - start, static_cast<int64_t>(util::MiniBatch::kMiniBatchLength)));
+      const uint32_t* minibatch_hashes = hashes.data() + begin + start;
+      state.encoder.PrepareEncodeSelected(start, num_keys, cols);
+
+      auto match_bitvector = util::TempVectorHolder<uint8_t>(
+          &state.temp_stack, static_cast<uint32_t>(bit_util::BytesForBits(num_keys)));
+      auto local_slots = util::TempVectorHolder<uint8_t>(&state.temp_stack, num_keys);
+      auto key_ids = util::TempVectorHolder<uint32_t>(&state.temp_stack, num_keys);
+      prtn->map.early_filter(num_keys, minibatch_hashes, match_bitvector.mutable_data(),
+                             local_slots.mutable_data());
+      prtn->map.find(num_keys, minibatch_hashes, match_bitvector.mutable_data(),
+                     local_slots.mutable_data(), key_ids.mutable_data(),
+                     &state.temp_stack, equal_impl);
+      for (int i = 0; i < num_keys; ++i) {
+        if (bit_util::GetBit(match_bitvector.mutable_data(), i)) {
+          int32_t irow = row_ids[begin + start + i];
+          state.row_partitions[irow] = static_cast<uint8_t>(iprtn + 1);
+          state.key_ids[irow] = key_ids.mutable_data()[i];
+        }
+      }
+    }
+  }
+
+  // Expand matches in the order of probe rows
+  for (int32_t irow = 0; irow < num_rows; ++irow) {
+    if (state.row_partitions[irow] == 0) {
+      no_match->push_back(irow);
+      continue;
+    }
+    match->push_back(irow);
+    const Partition* prtn = partitions_[state.row_partitions[irow] - 1].get();
+    const uint32_t key_id = state.key_ids[irow];
+    for (uint32_t i = prtn->row_id_offsets[key_id]; i < prtn->row_id_offsets[key_id + 1];
+         ++i) {
+      match_left->push_back(irow);
+      match_right->push_back(prtn->row_ids[i]);
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
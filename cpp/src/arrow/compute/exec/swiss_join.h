@@ -0,0 +1,138 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/key_map.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/compute/light_array.h"
+#include "arrow/compute/row/encode_internal.h"
+#include "arrow/compute/row/row_internal.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace compute {
+
+/// \brief Hash table mapping join keys to the ids of the build side rows holding them
+///
+/// Keys are stored in row format (RowTableImpl) and indexed with SwissTable.  The table
+/// is split on the high bits of the key hash into independent partitions, each with
+/// its own SwissTable, so that it can be constructed in parallel without locks:
+///
+/// 1. PartitionBuildBatch() hashes the keys of one build batch and distributes them
+///    between partitions.  It may be called concurrently for different batches.
+/// 2. BuildPartition() inserts all keys of one partition.  It may be called
+///    concurrently for different partitions.
+///
+/// Once all partitions are built, Probe() may be called concurrently from any number
+/// of threads, as long as each uses a distinct thread index.  Probing works on
+/// mini-batches of at most util::MiniBatch::kMiniBatchLength rows, using
+/// SwissTable::early_filter and SwissTable::find for the lookups and
+/// KeyCompare::CompareColumnsToRows for the key comparisons.
+class SwissJoinHashTable {
+ public:
+  /// \brief Whether the given join key types can be stored in the table
+  static bool IsSupported(const std::vector<std::shared_ptr<DataType>>& key_types);
+
+  Status Init(ExecContext* ctx, const std::vector<std::shared_ptr<DataType>>& key_types,
+              size_t num_threads, int64_t num_build_batches, int64_t num_build_rows);
+
+  /// \brief Hash and partition the key columns of a build batch
+  ///
+  /// Build row ids of the rows of the batch start at first_row_id.
+  Status PartitionBuildBatch(int64_t batch_index, const ExecBatch& key_batch,
+                             int32_t first_row_id);
+
+  /// \brief Insert all keys of a partition into its hash table
+  Status BuildPartition(int partition);
+
+  /// \brief Find the build rows matching each row of a probe batch of keys
+  ///
+  /// Outputs follow the conventions of the basic hash join: ids of probe rows with and
+  /// without a match go to match and no_match respectively, and every matching pair of
+  /// probe and build row ids is appended to match_left and match_right, in ascending
+  /// order of probe row id.  Rows with a null in a key compared with JoinKeyCmp::EQ
+  /// never match.
+  Status Probe(size_t thread_index, const ExecBatch& key_batch,
+               const std::vector<JoinKeyCmp>& key_cmp, std::vector<int32_t>* match,
+               std::vector<int32_t>* no_match, std::vector<int32_t>* match_left,
+               std::vector<int32_t>* match_right);
+
+  int num_partitions() const { return 1 << log_num_partitions_; }
+
+ private:
+  struct Partition {
+    ~Partition() { map.cleanup(); }
+
+    // Input of BuildPartition, one entry per build batch
+    std::vector<ExecBatch> build_keys;
+    std::vector<std::vector<uint32_t>> build_hashes;
+    std::vector<std::vector<int32_t>> build_row_ids;
+
+    util::TempVectorStack temp_stack;
+    LightContext encode_ctx;
+    RowTableEncoder encoder;
+    RowTableImpl rows;
+    RowTableImpl rows_minibatch;
+    SwissTable map;
+
+    // Build row ids grouped by key id: rows holding key k are
+    // row_ids[row_id_offsets[k]] ... row_ids[row_id_offsets[k + 1] - 1]
+    std::vector<uint32_t> row_id_offsets;
+    std::vector<int32_t> row_ids;
+  };
+
+  struct ThreadLocalState {
+    bool is_initialized = false;
+    util::TempVectorStack temp_stack;
+    LightContext encode_ctx;
+    RowTableEncoder encoder;
+    std::vector<uint8_t> row_partitions;
+    std::vector<uint32_t> key_ids;
+  };
+
+  Status InitThreadLocalStateIfNeeded(size_t thread_index);
+
+  /// \brief Hash a batch of keys and group its rows by partition
+  ///
+  /// Rows rejected by row_filter (if not null) are dropped.  On return the keys of the
+  /// rows of partition p occupy rows [offsets[p], offsets[p + 1]) of permuted,
+  /// (*row_ids)[i] is the original row of row i of permuted and (*hashes)[i] its hash
+  /// with the partition bits shifted out.
+  Status PartitionKeys(const ExecBatch& key_batch, const std::vector<bool>* row_filter,
+                       util::TempVectorStack* temp_stack, ExecBatch* permuted,
+                       std::vector<int32_t>* row_ids, std::vector<uint32_t>* hashes,
+                       std::vector<int64_t>* offsets) const;
+
+  ExecContext* ctx_;
+  int64_t hardware_flags_;
+  int log_num_partitions_;
+  std::vector<KeyColumnMetadata> col_metadata_;
+  std::vector<std::unique_ptr<Partition>> partitions_;
+  std::vector<ThreadLocalState> local_states_;
+};
+
+}  // namespace compute
+}  // namespace arrow
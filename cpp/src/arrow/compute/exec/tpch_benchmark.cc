@@ -15,109 +15,1204 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <thread>
+
 #include <benchmark/benchmark.h>
 
+#include "arrow/builder.h"
+#include "arrow/compute/api_scalar.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/exec/options.h"
 #include "arrow/compute/exec/test_util.h"
 #include "arrow/compute/exec/tpch_node.h"
-#include "arrow/testing/future_util.h"
-#include "arrow/util/make_unique.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/vendored/datetime.h"
+
+#ifdef ARROW_TPCH_BENCHMARK_PARQUET
+#include "arrow/io/memory.h"
+#include "parquet/arrow/reader.h"
+#include "parquet/arrow/writer.h"
+#endif
 
 namespace arrow {
 namespace compute {
 namespace internal {
 
-std::shared_ptr<ExecPlan> Plan_Q1(AsyncGenerator<util::optional<ExecBatch>>* sink_gen,
-                                  int scale_factor) {
-  ExecContext* ctx = default_exec_context();
-  *ctx = ExecContext(default_memory_pool(), arrow::internal::GetCpuThreadPool());
-  std::shared_ptr<ExecPlan> plan = *ExecPlan::Make(ctx);
-  std::unique_ptr<TpchGen> gen =
-      *TpchGen::Make(plan.get(), static_cast<double>(scale_factor));
-
-  ExecNode* lineitem =
-      *gen->Lineitem({"L_QUANTITY", "L_EXTENDEDPRICE", "L_TAX", "L_DISCOUNT",
-                      "L_SHIPDATE", "L_RETURNFLAG", "L_LINESTATUS"});
-
-  auto sept_2_1998 = std::make_shared<Date32Scalar>(
-      10471);  // September 2, 1998 is 10471 days after January 1, 1970
-  Expression filter =
-      less_equal(field_ref("L_SHIPDATE"), literal(std::move(sept_2_1998)));
-  FilterNodeOptions filter_opts(filter);
-
-  Expression l_returnflag = field_ref("L_RETURNFLAG");
-  Expression l_linestatus = field_ref("L_LINESTATUS");
-  Expression quantity = field_ref("L_QUANTITY");
-  Expression base_price = field_ref("L_EXTENDEDPRICE");
-
-  std::shared_ptr<Decimal128Scalar> decimal_1 =
-      std::make_shared<Decimal128Scalar>(Decimal128{0, 100}, decimal(12, 2));
-  Expression discount_multiplier =
-      call("subtract", {literal(decimal_1), field_ref("L_DISCOUNT")});
-  Expression tax_multiplier = call("add", {literal(decimal_1), field_ref("L_TAX")});
-  Expression disc_price =
-      call("multiply", {field_ref("L_EXTENDEDPRICE"), discount_multiplier});
+// The 22 TPC-H queries, with the validation parameters of the specification.  The
+// correlated subqueries are decorrelated into joins with aggregates, and the views into
+// repeated subplans.
+//
+// The tables are generated once per scale factor, with the CHAR columns as trimmed
+// strings (as dbgen output loaded into a database), and are either read from memory or
+// scanned from Parquet files in memory by each run.  The scale factor is read from the
+// environment variable ARROW_TPCH_SCALE_FACTOR (1 by default).
+
+using SinkGenerator = AsyncGenerator<util::optional<ExecBatch>>;
+
+constexpr int64_t kBatchSize = 32 * 1024;
+
+// The source of the tables of a query
+class TpchTables {
+ public:
+  explicit TpchTables(double scale_factor) : scale_factor_(scale_factor) {}
+  virtual ~TpchTables() = default;
+
+  double scale_factor() const { return scale_factor_; }
+
+  // A source of the given columns of a table
+  virtual Result<Declaration> Scan(const std::string& table,
+                                   const std::vector<std::string>& columns) = 0;
+
+ private:
+  const double scale_factor_;
+};
+
+using Query = Result<Declaration> (*)(TpchTables* tables, SinkGenerator* sink_gen);
+
+// ---------------------------------------------------------------------------
+// Plan building helpers
+
+Declaration Filter(Declaration input, Expression filter) {
+  return Declaration::Sequence(
+      {std::move(input), {"filter", FilterNodeOptions(std::move(filter))}});
+}
+
+Declaration Project(Declaration input, std::vector<Expression> exprs,
+                    std::vector<std::string> names) {
+  return Declaration::Sequence(
+      {std::move(input),
+       {"project", ProjectNodeOptions(std::move(exprs), std::move(names))}});
+}
+
+// Group by the keys, or aggregate all the rows to one without keys
+Declaration AggregateBy(Declaration input, std::vector<compute::Aggregate> aggs,
+                        std::vector<FieldRef> keys = {}) {
+  return Declaration::Sequence(
+      {std::move(input),
+       {"aggregate", AggregateNodeOptions(std::move(aggs), std::move(keys))}});
+}
+
+Declaration Join(Declaration left, Declaration right, std::vector<FieldRef> left_keys,
+                 std::vector<FieldRef> right_keys, JoinType type = JoinType::INNER,
+                 Expression filter = literal(true)) {
+  return Declaration("hashjoin",
+                     {Declaration::Input(std::move(left)),
+                      Declaration::Input(std::move(right))},
+                     HashJoinNodeOptions(type, std::move(left_keys),
+                                         std::move(right_keys), std::move(filter)));
+}
+
+Declaration OrderBy(Declaration input, std::vector<SortKey> keys,
+                    SinkGenerator* sink_gen) {
+  return Declaration::Sequence(
+      {std::move(input),
+       {"order_by_sink",
+        OrderBySinkNodeOptions(SortOptions(std::move(keys)), sink_gen)}});
+}
+
+Declaration TopK(Declaration input, int64_t k, std::vector<SortKey> keys,
+                 SinkGenerator* sink_gen) {
+  return Declaration::Sequence(
+      {std::move(input),
+       {"select_k_sink",
+        SelectKSinkNodeOptions(SelectKOptions(k, std::move(keys)), sink_gen)}});
+}
+
+Declaration Sink(Declaration input, SinkGenerator* sink_gen) {
+  return Declaration::Sequence({std::move(input), {"sink", SinkNodeOptions(sink_gen)}});
+}
+
+compute::Aggregate Agg(std::string function, FieldRef target, std::string name) {
+  std::shared_ptr<FunctionOptions> options;
+  if (function.find("count") != std::string::npos) {
+    options = std::make_shared<CountOptions>(CountOptions::ONLY_VALID);
+  } else {
+    options =
+        std::make_shared<ScalarAggregateOptions>(ScalarAggregateOptions::Defaults());
+  }
+  return {std::move(function), std::move(options), std::move(target), std::move(name)};
+}
+
+SortKey Asc(std::string name) { return SortKey(std::move(name), SortOrder::Ascending); }
+
+SortKey Desc(std::string name) { return SortKey(std::move(name), SortOrder::Descending); }
+
+Expression Field(std::string name) { return field_ref(std::move(name)); }
+
+Expression Str(std::string value) { return literal(std::move(value)); }
+
+Expression Date(int year, unsigned month, unsigned day) {
+  namespace date = arrow_vendored::date;
+  auto days = date::sys_days(date::year(year) / month / day).time_since_epoch().count();
+  return literal(std::make_shared<Date32Scalar>(static_cast<int32_t>(days)));
+}
+
+// A decimal(12, 2) literal, the type of the prices, quantities and rates
+Expression Money(int64_t cents) {
+  return literal(std::make_shared<Decimal128Scalar>(Decimal128(cents), decimal(12, 2)));
+}
+
+Expression ToDouble(Expression expr) {
+  return call("cast", {std::move(expr)}, CastOptions::Safe(float64()));
+}
+
+Expression Like(Expression expr, std::string pattern) {
+  return call("match_like", {std::move(expr)}, MatchSubstringOptions(std::move(pattern)));
+}
+
+Expression IsIn(Expression expr, const std::shared_ptr<DataType>& type,
+                const std::string& values_json) {
+  return call("is_in", {std::move(expr)},
+              SetLookupOptions(ArrayFromJSON(type, values_json)));
+}
+
+Expression Between(Expression expr, Expression low, Expression high) {
+  return and_(greater_equal(expr, std::move(low)), less_equal(expr, std::move(high)));
+}
+
+// l_extendedprice * (1 - l_discount)
+Expression Revenue() {
+  return call("multiply", {Field("L_EXTENDEDPRICE"),
+                           call("subtract", {Money(100), Field("L_DISCOUNT")})});
+}
+
+// A constant column, to join a table with the one row of an aggregate
+Expression JoinKey() { return literal(0); }
+
+Result<Declaration> NationsOfRegion(TpchTables* tables, const std::string& region,
+                                    std::vector<std::string> columns) {
+  ARROW_ASSIGN_OR_RAISE(auto nation, tables->Scan("nation", std::move(columns)));
+  ARROW_ASSIGN_OR_RAISE(auto regions, tables->Scan("region", {"R_REGIONKEY", "R_NAME"}));
+  return Join(std::move(nation), Filter(std::move(regions), equal(Field("R_NAME"),
+                                                                  Str(region))),
+              {"N_REGIONKEY"}, {"R_REGIONKEY"}, JoinType::LEFT_SEMI);
+}
+
+Result<Declaration> NationNamed(TpchTables* tables, const std::string& name) {
+  ARROW_ASSIGN_OR_RAISE(auto nation, tables->Scan("nation", {"N_NATIONKEY", "N_NAME"}));
+  return Filter(std::move(nation), equal(Field("N_NAME"), Str(name)));
+}
+
+// ---------------------------------------------------------------------------
+// Queries
+
+// Pricing summary report
+Result<Declaration> Q1(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto lineitem,
+      tables->Scan("lineitem", {"L_QUANTITY", "L_EXTENDEDPRICE", "L_TAX", "L_DISCOUNT",
+                                "L_SHIPDATE", "L_RETURNFLAG", "L_LINESTATUS"}));
+  Expression disc_price = Revenue();
   Expression charge =
-      call("multiply",
-           {call("cast",
-                 {call("multiply", {field_ref("L_EXTENDEDPRICE"), discount_multiplier})},
-                 compute::CastOptions::Unsafe(decimal(12, 2))),
-            tax_multiplier});
-  Expression discount = field_ref("L_DISCOUNT");
-
-  std::vector<Expression> projection_list = {l_returnflag, l_linestatus, quantity,
-                                             base_price,   disc_price,   charge,
-                                             quantity,     base_price,   discount};
-  std::vector<std::string> project_names = {
-      "l_returnflag", "l_linestatus", "sum_qty",   "sum_base_price", "sum_disc_price",
-      "sum_charge",   "avg_qty",      "avg_price", "avg_disc"};
-  ProjectNodeOptions project_opts(std::move(projection_list), std::move(project_names));
-
-  auto sum_opts =
-      std::make_shared<ScalarAggregateOptions>(ScalarAggregateOptions::Defaults());
-  auto count_opts = std::make_shared<CountOptions>(CountOptions::CountMode::ALL);
-  std::vector<arrow::compute::Aggregate> aggs = {
-      {"hash_sum", sum_opts, "sum_qty", "sum_qty"},
-      {"hash_sum", sum_opts, "sum_base_price", "sum_base_price"},
-      {"hash_sum", sum_opts, "sum_disc_price", "sum_disc_price"},
-      {"hash_sum", sum_opts, "sum_charge", "sum_charge"},
-      {"hash_mean", sum_opts, "avg_qty", "avg_qty"},
-      {"hash_mean", sum_opts, "avg_price", "avg_price"},
-      {"hash_mean", sum_opts, "avg_disc", "avg_disc"},
-      {"hash_count", count_opts, "sum_qty", "count_order"}};
-
-  std::vector<FieldRef> keys = {"l_returnflag", "l_linestatus"};
-  AggregateNodeOptions agg_opts(aggs, keys);
-
-  SortKey l_returnflag_key("l_returnflag");
-  SortKey l_linestatus_key("l_linestatus");
-  SortOptions sort_opts({l_returnflag_key, l_linestatus_key});
-  OrderBySinkNodeOptions order_by_opts(sort_opts, sink_gen);
-
-  Declaration filter_decl("filter", {Declaration::Input(lineitem)}, filter_opts);
-  Declaration project_decl("project", project_opts);
-  Declaration aggregate_decl("aggregate", agg_opts);
-  Declaration orderby_decl("order_by_sink", order_by_opts);
-
-  Declaration q1 =
-      Declaration::Sequence({filter_decl, project_decl, aggregate_decl, orderby_decl});
-  std::ignore = *q1.AddToPlan(plan.get());
-  return plan;
-}
-
-static void BM_Tpch_Q1(benchmark::State& st) {
+      call("multiply", {call("cast", {disc_price}, CastOptions::Unsafe(decimal(12, 2))),
+                        call("add", {Money(100), Field("L_TAX")})});
+  auto project = Project(
+      Filter(std::move(lineitem), less_equal(Field("L_SHIPDATE"), Date(1998, 9, 2))),
+      {Field("L_RETURNFLAG"), Field("L_LINESTATUS"), Field("L_QUANTITY"),
+       Field("L_EXTENDEDPRICE"), disc_price, charge, Field("L_DISCOUNT")},
+      {"L_RETURNFLAG", "L_LINESTATUS", "QUANTITY", "PRICE", "DISC_PRICE", "CHARGE",
+       "DISCOUNT"});
+  auto aggregate = AggregateBy(std::move(project),
+                               {Agg("hash_sum", "QUANTITY", "SUM_QTY"),
+                                Agg("hash_sum", "PRICE", "SUM_BASE_PRICE"),
+                                Agg("hash_sum", "DISC_PRICE", "SUM_DISC_PRICE"),
+                                Agg("hash_sum", "CHARGE", "SUM_CHARGE"),
+                                Agg("hash_mean", "QUANTITY", "AVG_QTY"),
+                                Agg("hash_mean", "PRICE", "AVG_PRICE"),
+                                Agg("hash_mean", "DISCOUNT", "AVG_DISC"),
+                                Agg("hash_count", "QUANTITY", "COUNT_ORDER")},
+                               {"L_RETURNFLAG", "L_LINESTATUS"});
+  return OrderBy(std::move(aggregate), {Asc("L_RETURNFLAG"), Asc("L_LINESTATUS")},
+                 sink_gen);
+}
+
+// The suppliers of a region, with their partsupps
+Result<Declaration> PartsuppsOfRegion(TpchTables* tables, const std::string& region,
+                                      std::vector<std::string> supplier_columns) {
+  ARROW_ASSIGN_OR_RAISE(auto partsupp, tables->Scan("partsupp", {"PS_PARTKEY",
+                                                                 "PS_SUPPKEY",
+                                                                 "PS_SUPPLYCOST"}));
+  ARROW_ASSIGN_OR_RAISE(auto supplier, tables->Scan("supplier", supplier_columns));
+  ARROW_ASSIGN_OR_RAISE(auto nation, NationsOfRegion(tables, region,
+                                                     {"N_NATIONKEY", "N_NAME",
+                                                      "N_REGIONKEY"}));
+  auto suppliers = Join(std::move(supplier), std::move(nation), {"S_NATIONKEY"},
+                        {"N_NATIONKEY"});
+  return Join(std::move(partsupp), std::move(suppliers), {"PS_SUPPKEY"}, {"S_SUPPKEY"});
+}
+
+// Minimum cost supplier
+Result<Declaration> Q2(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto part, tables->Scan("part", {"P_PARTKEY", "P_MFGR", "P_SIZE",
+                                                         "P_TYPE"}));
+  ARROW_ASSIGN_OR_RAISE(
+      auto partsupps,
+      PartsuppsOfRegion(tables, "EUROPE",
+                        {"S_SUPPKEY", "S_NAME", "S_ADDRESS", "S_NATIONKEY", "S_PHONE",
+                         "S_ACCTBAL", "S_COMMENT"}));
+  ARROW_ASSIGN_OR_RAISE(
+      auto costs, PartsuppsOfRegion(tables, "EUROPE", {"S_SUPPKEY", "S_NATIONKEY"}));
+  auto min_costs = Project(
+      AggregateBy(std::move(costs), {Agg("hash_min", "PS_SUPPLYCOST", "MIN_COST")},
+                  {"PS_PARTKEY"}),
+      {Field("PS_PARTKEY"), Field("MIN_COST")}, {"MIN_PARTKEY", "MIN_COST"});
+
+  part = Filter(std::move(part), and_(equal(Field("P_SIZE"), literal(15)),
+                                      Like(Field("P_TYPE"), "%BRASS")));
+  auto join = Join(Join(std::move(partsupps), std::move(part), {"PS_PARTKEY"},
+                        {"P_PARTKEY"}),
+                   std::move(min_costs), {"PS_PARTKEY"}, {"MIN_PARTKEY"}, JoinType::INNER,
+                   equal(Field("PS_SUPPLYCOST"), Field("MIN_COST")));
+  auto project = Project(std::move(join),
+                         {Field("S_ACCTBAL"), Field("S_NAME"), Field("N_NAME"),
+                          Field("P_PARTKEY"), Field("P_MFGR"), Field("S_ADDRESS"),
+                          Field("S_PHONE"), Field("S_COMMENT")},
+                         {"S_ACCTBAL", "S_NAME", "N_NAME", "P_PARTKEY", "P_MFGR",
+                          "S_ADDRESS", "S_PHONE", "S_COMMENT"});
+  return TopK(std::move(project), 100,
+              {Desc("S_ACCTBAL"), Asc("N_NAME"), Asc("S_NAME"), Asc("P_PARTKEY")},
+              sink_gen);
+}
+
+// Shipping priority
+Result<Declaration> Q3(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto customer,
+                        tables->Scan("customer", {"C_CUSTKEY", "C_MKTSEGMENT"}));
+  ARROW_ASSIGN_OR_RAISE(auto orders,
+                        tables->Scan("orders", {"O_ORDERKEY", "O_CUSTKEY", "O_ORDERDATE",
+                                                "O_SHIPPRIORITY"}));
+  ARROW_ASSIGN_OR_RAISE(auto lineitem,
+                        tables->Scan("lineitem", {"L_ORDERKEY", "L_EXTENDEDPRICE",
+                                                  "L_DISCOUNT", "L_SHIPDATE"}));
+  auto building =
+      Filter(std::move(customer), equal(Field("C_MKTSEGMENT"), Str("BUILDING")));
+  orders = Join(Filter(std::move(orders), less(Field("O_ORDERDATE"), Date(1995, 3, 15))),
+                std::move(building), {"O_CUSTKEY"}, {"C_CUSTKEY"}, JoinType::LEFT_SEMI);
+  lineitem = Filter(std::move(lineitem), greater(Field("L_SHIPDATE"), Date(1995, 3, 15)));
+  auto project = Project(
+      Join(std::move(lineitem), std::move(orders), {"L_ORDERKEY"}, {"O_ORDERKEY"}),
+      {Field("L_ORDERKEY"), Field("O_ORDERDATE"), Field("O_SHIPPRIORITY"), Revenue()},
+      {"L_ORDERKEY", "O_ORDERDATE", "O_SHIPPRIORITY", "VOLUME"});
+  auto aggregate =
+      AggregateBy(std::move(project), {Agg("hash_sum", "VOLUME", "REVENUE")},
+                  {"L_ORDERKEY", "O_ORDERDATE", "O_SHIPPRIORITY"});
+  return TopK(std::move(aggregate), 10, {Desc("REVENUE"), Asc("O_ORDERDATE")}, sink_gen);
+}
+
+// Order priority checking
+Result<Declaration> Q4(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto orders, tables->Scan("orders", {"O_ORDERKEY", "O_ORDERDATE",
+                                                             "O_ORDERPRIORITY"}));
+  ARROW_ASSIGN_OR_RAISE(auto lineitem,
+                        tables->Scan("lineitem", {"L_ORDERKEY", "L_COMMITDATE",
+                                                  "L_RECEIPTDATE"}));
+  orders = Filter(std::move(orders),
+                  and_(greater_equal(Field("O_ORDERDATE"), Date(1993, 7, 1)),
+                       less(Field("O_ORDERDATE"), Date(1993, 10, 1))));
+  lineitem =
+      Filter(std::move(lineitem), less(Field("L_COMMITDATE"), Field("L_RECEIPTDATE")));
+  // The orders with a late lineitem, the hash table is built on the orders
+  auto late_orders = Join(std::move(lineitem), std::move(orders), {"L_ORDERKEY"},
+                          {"O_ORDERKEY"}, JoinType::RIGHT_SEMI);
+  auto aggregate = AggregateBy(std::move(late_orders),
+                               {Agg("hash_count", "O_ORDERKEY", "ORDER_COUNT")},
+                               {"O_ORDERPRIORITY"});
+  return OrderBy(std::move(aggregate), {Asc("O_ORDERPRIORITY")}, sink_gen);
+}
+
+// Local supplier volume
+Result<Declaration> Q5(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto customer,
+                        tables->Scan("customer", {"C_CUSTKEY", "C_NATIONKEY"}));
+  ARROW_ASSIGN_OR_RAISE(auto orders, tables->Scan("orders", {"O_ORDERKEY", "O_CUSTKEY",
+                                                             "O_ORDERDATE"}));
+  ARROW_ASSIGN_OR_RAISE(auto lineitem,
+                        tables->Scan("lineitem", {"L_ORDERKEY", "L_SUPPKEY",
+                                                  "L_EXTENDEDPRICE", "L_DISCOUNT"}));
+  ARROW_ASSIGN_OR_RAISE(auto supplier,
+                        tables->Scan("supplier", {"S_SUPPKEY", "S_NATIONKEY"}));
+  ARROW_ASSIGN_OR_RAISE(auto nation, NationsOfRegion(tables, "ASIA",
+                                                     {"N_NATIONKEY", "N_NAME",
+                                                      "N_REGIONKEY"}));
+  auto suppliers =
+      Join(std::move(supplier), std::move(nation), {"S_NATIONKEY"}, {"N_NATIONKEY"});
+  orders = Filter(std::move(orders),
+                  and_(greater_equal(Field("O_ORDERDATE"), Date(1994, 1, 1)),
+                       less(Field("O_ORDERDATE"), Date(1995, 1, 1))));
+  orders = Join(std::move(orders), std::move(customer), {"O_CUSTKEY"}, {"C_CUSTKEY"});
+  auto join = Join(Join(std::move(lineitem), std::move(orders), {"L_ORDERKEY"},
+                        {"O_ORDERKEY"}),
+                   std::move(suppliers), {"L_SUPPKEY", "C_NATIONKEY"},
+                   {"S_SUPPKEY", "S_NATIONKEY"});
+  auto aggregate = AggregateBy(Project(std::move(join), {Field("N_NAME"), Revenue()},
+                                       {"N_NAME", "VOLUME"}),
+                               {Agg("hash_sum", "VOLUME", "REVENUE")}, {"N_NAME"});
+  return OrderBy(std::move(aggregate), {Desc("REVENUE")}, sink_gen);
+}
+
+// Forecasting revenue change
+Result<Declaration> Q6(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto lineitem,
+                        tables->Scan("lineitem", {"L_QUANTITY", "L_EXTENDEDPRICE",
+                                                  "L_DISCOUNT", "L_SHIPDATE"}));
+  auto filter =
+      Filter(std::move(lineitem),
+             and_({greater_equal(Field("L_SHIPDATE"), Date(1994, 1, 1)),
+                   less(Field("L_SHIPDATE"), Date(1995, 1, 1)),
+                   Between(Field("L_DISCOUNT"), Money(5), Money(7)),
+                   less(Field("L_QUANTITY"), Money(2400))}));
+  auto project = Project(
+      std::move(filter),
+      {call("multiply", {Field("L_EXTENDEDPRICE"), Field("L_DISCOUNT")})}, {"VOLUME"});
+  return Sink(AggregateBy(std::move(project), {Agg("sum", "VOLUME", "REVENUE")}),
+              sink_gen);
+}
+
+// Volume shipping
+Result<Declaration> Q7(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto supplier,
+                        tables->Scan("supplier", {"S_SUPPKEY", "S_NATIONKEY"}));
+  ARROW_ASSIGN_OR_RAISE(auto customer,
+                        tables->Scan("customer", {"C_CUSTKEY", "C_NATIONKEY"}));
+  ARROW_ASSIGN_OR_RAISE(auto orders, tables->Scan("orders", {"O_ORDERKEY", "O_CUSTKEY"}));
+  ARROW_ASSIGN_OR_RAISE(auto lineitem,
+                        tables->Scan("lineitem", {"L_ORDERKEY", "L_SUPPKEY",
+                                                  "L_EXTENDEDPRICE", "L_DISCOUNT",
+                                                  "L_SHIPDATE"}));
+  // The nation twice, under different names
+  Expression france_or_germany =
+      IsIn(Field("N_NAME"), utf8(), R"(["FRANCE", "GERMANY"])");
+  ARROW_ASSIGN_OR_RAISE(auto supp_nation, tables->Scan("nation", {"N_NATIONKEY",
+                                                                  "N_NAME"}));
+  supp_nation = Project(Filter(std::move(supp_nation), france_or_germany),
+                        {Field("N_NATIONKEY"), Field("N_NAME")},
+                        {"SUPP_NATIONKEY", "SUPP_NATION"});
+  ARROW_ASSIGN_OR_RAISE(auto cust_nation, tables->Scan("nation", {"N_NATIONKEY",
+                                                                  "N_NAME"}));
+  cust_nation = Project(Filter(std::move(cust_nation), france_or_germany),
+                        {Field("N_NATIONKEY"), Field("N_NAME")},
+                        {"CUST_NATIONKEY", "CUST_NATION"});
+
+  auto suppliers = Join(std::move(supplier), std::move(supp_nation), {"S_NATIONKEY"},
+                        {"SUPP_NATIONKEY"});
+  auto customers = Join(std::move(customer), std::move(cust_nation), {"C_NATIONKEY"},
+                        {"CUST_NATIONKEY"});
+  orders = Join(std::move(orders), std::move(customers), {"O_CUSTKEY"}, {"C_CUSTKEY"});
+  lineitem = Filter(std::move(lineitem),
+                    Between(Field("L_SHIPDATE"), Date(1995, 1, 1), Date(1996, 12, 31)));
+  auto join = Join(
+      Join(std::move(lineitem), std::move(suppliers), {"L_SUPPKEY"}, {"S_SUPPKEY"}),
+      std::move(orders), {"L_ORDERKEY"}, {"O_ORDERKEY"}, JoinType::INNER,
+      or_(and_(equal(Field("SUPP_NATION"), Str("FRANCE")),
+               equal(Field("CUST_NATION"), Str("GERMANY"))),
+          and_(equal(Field("SUPP_NATION"), Str("GERMANY")),
+               equal(Field("CUST_NATION"), Str("FRANCE")))));
+  auto project =
+      Project(std::move(join),
+              {Field("SUPP_NATION"), Field("CUST_NATION"),
+               call("year", {Field("L_SHIPDATE")}), Revenue()},
+              {"SUPP_NATION", "CUST_NATION", "L_YEAR", "VOLUME"});
+  auto aggregate =
+      AggregateBy(std::move(project), {Agg("hash_sum", "VOLUME", "REVENUE")},
+                  {"SUPP_NATION", "CUST_NATION", "L_YEAR"});
+  return OrderBy(std::move(aggregate),
+                 {Asc("SUPP_NATION"), Asc("CUST_NATION"), Asc("L_YEAR")}, sink_gen);
+}
+
+// National market share
+Result<Declaration> Q8(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto part, tables->Scan("part", {"P_PARTKEY", "P_TYPE"}));
+  ARROW_ASSIGN_OR_RAISE(auto supplier,
+                        tables->Scan("supplier", {"S_SUPPKEY", "S_NATIONKEY"}));
+  ARROW_ASSIGN_OR_RAISE(auto customer,
+                        tables->Scan("customer", {"C_CUSTKEY", "C_NATIONKEY"}));
+  ARROW_ASSIGN_OR_RAISE(auto orders, tables->Scan("orders", {"O_ORDERKEY", "O_CUSTKEY",
+                                                             "O_ORDERDATE"}));
+  ARROW_ASSIGN_OR_RAISE(auto lineitem,
+                        tables->Scan("lineitem", {"L_ORDERKEY", "L_PARTKEY", "L_SUPPKEY",
+                                                  "L_EXTENDEDPRICE", "L_DISCOUNT"}));
+  ARROW_ASSIGN_OR_RAISE(auto america, NationsOfRegion(tables, "AMERICA",
+                                                      {"N_NATIONKEY", "N_REGIONKEY"}));
+  ARROW_ASSIGN_OR_RAISE(auto supp_nation, tables->Scan("nation", {"N_NATIONKEY",
+                                                                  "N_NAME"}));
+
+  part = Filter(std::move(part), equal(Field("P_TYPE"), Str("ECONOMY ANODIZED STEEL")));
+  auto customers = Join(std::move(customer), std::move(america), {"C_NATIONKEY"},
+                        {"N_NATIONKEY"}, JoinType::LEFT_SEMI);
+  orders = Filter(std::move(orders), Between(Field("O_ORDERDATE"), Date(1995, 1, 1),
+                                             Date(1996, 12, 31)));
+  orders = Join(std::move(orders), std::move(customers), {"O_CUSTKEY"}, {"C_CUSTKEY"},
+                JoinType::LEFT_SEMI);
+  auto suppliers = Join(std::move(supplier), std::move(supp_nation), {"S_NATIONKEY"},
+                        {"N_NATIONKEY"});
+  lineitem = Join(std::move(lineitem), std::move(part), {"L_PARTKEY"}, {"P_PARTKEY"},
+                  JoinType::LEFT_SEMI);
+  auto join = Join(
+      Join(std::move(lineitem), std::move(orders), {"L_ORDERKEY"}, {"O_ORDERKEY"}),
+      std::move(suppliers), {"L_SUPPKEY"}, {"S_SUPPKEY"});
+
+  Expression volume = ToDouble(Revenue());
+  auto project = Project(
+      std::move(join),
+      {call("year", {Field("O_ORDERDATE")}), volume,
+       call("if_else", {equal(Field("N_NAME"), Str("BRAZIL")), volume, literal(0.0)})},
+      {"O_YEAR", "VOLUME", "BRAZIL_VOLUME"});
+  auto aggregate = AggregateBy(std::move(project),
+                               {Agg("hash_sum", "VOLUME", "VOLUME"),
+                                Agg("hash_sum", "BRAZIL_VOLUME", "BRAZIL_VOLUME")},
+                               {"O_YEAR"});
+  auto share = Project(
+      std::move(aggregate),
+      {Field("O_YEAR"), call("divide", {Field("BRAZIL_VOLUME"), Field("VOLUME")})},
+      {"O_YEAR", "MKT_SHARE"});
+  return OrderBy(std::move(share), {Asc("O_YEAR")}, sink_gen);
+}
+
+// Product type profit measure
+Result<Declaration> Q9(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto part, tables->Scan("part", {"P_PARTKEY", "P_NAME"}));
+  ARROW_ASSIGN_OR_RAISE(auto supplier,
+                        tables->Scan("supplier", {"S_SUPPKEY", "S_NATIONKEY"}));
+  ARROW_ASSIGN_OR_RAISE(auto partsupp, tables->Scan("partsupp", {"PS_PARTKEY",
+                                                                 "PS_SUPPKEY",
+                                                                 "PS_SUPPLYCOST"}));
+  ARROW_ASSIGN_OR_RAISE(auto orders,
+                        tables->Scan("orders", {"O_ORDERKEY", "O_ORDERDATE"}));
+  ARROW_ASSIGN_OR_RAISE(
+      auto lineitem,
+      tables->Scan("lineitem", {"L_ORDERKEY", "L_PARTKEY", "L_SUPPKEY", "L_QUANTITY",
+                                "L_EXTENDEDPRICE", "L_DISCOUNT"}));
+  ARROW_ASSIGN_OR_RAISE(auto nation, tables->Scan("nation", {"N_NATIONKEY", "N_NAME"}));
+
+  part = Filter(std::move(part), Like(Field("P_NAME"), "%green%"));
+  auto suppliers =
+      Join(std::move(supplier), std::move(nation), {"S_NATIONKEY"}, {"N_NATIONKEY"});
+  lineitem = Join(std::move(lineitem), std::move(part), {"L_PARTKEY"}, {"P_PARTKEY"},
+                  JoinType::LEFT_SEMI);
+  auto join = Join(Join(Join(std::move(lineitem), std::move(suppliers), {"L_SUPPKEY"},
+                             {"S_SUPPKEY"}),
+                        std::move(partsupp), {"L_PARTKEY", "L_SUPPKEY"},
+                        {"PS_PARTKEY", "PS_SUPPKEY"}),
+                   std::move(orders), {"L_ORDERKEY"}, {"O_ORDERKEY"});
+  Expression amount =
+      call("subtract",
+           {Revenue(), call("multiply", {Field("PS_SUPPLYCOST"), Field("L_QUANTITY")})});
+  auto project =
+      Project(std::move(join),
+              {Field("N_NAME"), call("year", {Field("O_ORDERDATE")}), amount},
+              {"NATION", "O_YEAR", "AMOUNT"});
+  auto aggregate = AggregateBy(std::move(project),
+                               {Agg("hash_sum", "AMOUNT", "SUM_PROFIT")},
+                               {"NATION", "O_YEAR"});
+  return OrderBy(std::move(aggregate), {Asc("NATION"), Desc("O_YEAR")}, sink_gen);
+}
+
+// Returned item reporting
+Result<Declaration> Q10(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto customer,
+                        tables->Scan("customer", {"C_CUSTKEY", "C_NAME", "C_ADDRESS",
+                                                  "C_NATIONKEY", "C_PHONE", "C_ACCTBAL",
+                                                  "C_COMMENT"}));
+  ARROW_ASSIGN_OR_RAISE(auto orders, tables->Scan("orders", {"O_ORDERKEY", "O_CUSTKEY",
+                                                             "O_ORDERDATE"}));
+  ARROW_ASSIGN_OR_RAISE(auto lineitem,
+                        tables->Scan("lineitem", {"L_ORDERKEY", "L_EXTENDEDPRICE",
+                                                  "L_DISCOUNT", "L_RETURNFLAG"}));
+  ARROW_ASSIGN_OR_RAISE(auto nation, tables->Scan("nation", {"N_NATIONKEY", "N_NAME"}));
+
+  orders = Filter(std::move(orders),
+                  and_(greater_equal(Field("O_ORDERDATE"), Date(1993, 10, 1)),
+                       less(Field("O_ORDERDATE"), Date(1994, 1, 1))));
+  lineitem = Filter(std::move(lineitem), equal(Field("L_RETURNFLAG"), Str("R")));
+  auto customers =
+      Join(std::move(customer), std::move(nation), {"C_NATIONKEY"}, {"N_NATIONKEY"});
+  auto join = Join(
+      Join(std::move(lineitem), std::move(orders), {"L_ORDERKEY"}, {"O_ORDERKEY"}),
+      std::move(customers), {"O_CUSTKEY"}, {"C_CUSTKEY"});
+  std::vector<std::string> keys = {"C_CUSTKEY", "C_NAME",    "C_ACCTBAL", "C_PHONE",
+                                   "N_NAME",    "C_ADDRESS", "C_COMMENT"};
+  std::vector<Expression> exprs;
+  for (const auto& key : keys) {
+    exprs.push_back(Field(key));
+  }
+  exprs.push_back(Revenue());
+  std::vector<std::string> names = keys;
+  names.push_back("VOLUME");
+  auto aggregate = AggregateBy(Project(std::move(join), std::move(exprs), names),
+                               {Agg("hash_sum", "VOLUME", "REVENUE")},
+                               {keys.begin(), keys.end()});
+  return TopK(std::move(aggregate), 20, {Desc("REVENUE")}, sink_gen);
+}
+
+// The value of the partsupps of the suppliers of a nation
+Result<Declaration> PartsuppValuesOfNation(TpchTables* tables, const std::string& name) {
+  ARROW_ASSIGN_OR_RAISE(auto partsupp, tables->Scan("partsupp", {"PS_PARTKEY",
+                                                                 "PS_SUPPKEY",
+                                                                 "PS_AVAILQTY",
+                                                                 "PS_SUPPLYCOST"}));
+  ARROW_ASSIGN_OR_RAISE(auto supplier,
+                        tables->Scan("supplier", {"S_SUPPKEY", "S_NATIONKEY"}));
+  ARROW_ASSIGN_OR_RAISE(auto nation, NationNamed(tables, name));
+  auto suppliers = Join(std::move(supplier), std::move(nation), {"S_NATIONKEY"},
+                        {"N_NATIONKEY"}, JoinType::LEFT_SEMI);
+  auto join = Join(std::move(partsupp), std::move(suppliers), {"PS_SUPPKEY"},
+                   {"S_SUPPKEY"}, JoinType::LEFT_SEMI);
+  return Project(std::move(join),
+                 {Field("PS_PARTKEY"),
+                  call("multiply", {ToDouble(Field("PS_SUPPLYCOST")),
+                                    ToDouble(Field("PS_AVAILQTY"))})},
+                 {"PS_PARTKEY", "VALUE"});
+}
+
+// Important stock identification
+Result<Declaration> Q11(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto values, PartsuppValuesOfNation(tables, "GERMANY"));
+  ARROW_ASSIGN_OR_RAISE(auto all_values, PartsuppValuesOfNation(tables, "GERMANY"));
+  auto part_values =
+      AggregateBy(std::move(values), {Agg("hash_sum", "VALUE", "VALUE")}, {"PS_PARTKEY"});
+  part_values = Project(std::move(part_values),
+                        {Field("PS_PARTKEY"), Field("VALUE"), JoinKey()},
+                        {"PS_PARTKEY", "VALUE", "KEY"});
+  auto threshold = Project(
+      AggregateBy(std::move(all_values), {Agg("sum", "VALUE", "TOTAL_VALUE")}),
+      {JoinKey(), call("multiply", {Field("TOTAL_VALUE"),
+                                    literal(0.0001 / tables->scale_factor())})},
+      {"THRESHOLD_KEY", "THRESHOLD"});
+  auto join = Join(std::move(part_values), std::move(threshold), {"KEY"},
+                   {"THRESHOLD_KEY"}, JoinType::INNER,
+                   greater(Field("VALUE"), Field("THRESHOLD")));
+  return OrderBy(
+      Project(std::move(join), {Field("PS_PARTKEY"), Field("VALUE")},
+              {"PS_PARTKEY", "VALUE"}),
+      {Desc("VALUE")}, sink_gen);
+}
+
+// Shipping modes and order priority
+Result<Declaration> Q12(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto orders,
+                        tables->Scan("orders", {"O_ORDERKEY", "O_ORDERPRIORITY"}));
+  ARROW_ASSIGN_OR_RAISE(auto lineitem,
+                        tables->Scan("lineitem", {"L_ORDERKEY", "L_SHIPMODE",
+                                                  "L_COMMITDATE", "L_SHIPDATE",
+                                                  "L_RECEIPTDATE"}));
+  lineitem = Filter(std::move(lineitem),
+                    and_({IsIn(Field("L_SHIPMODE"), utf8(), R"(["MAIL", "SHIP"])"),
+                          less(Field("L_COMMITDATE"), Field("L_RECEIPTDATE")),
+                          less(Field("L_SHIPDATE"), Field("L_COMMITDATE")),
+                          greater_equal(Field("L_RECEIPTDATE"), Date(1994, 1, 1)),
+                          less(Field("L_RECEIPTDATE"), Date(1995, 1, 1))}));
+  auto join =
+      Join(std::move(lineitem), std::move(orders), {"L_ORDERKEY"}, {"O_ORDERKEY"});
+  Expression high = IsIn(Field("O_ORDERPRIORITY"), utf8(), R"(["1-URGENT", "2-HIGH"])");
+  auto project = Project(
+      std::move(join),
+      {Field("L_SHIPMODE"), call("if_else", {high, literal(int64_t(1)),
+                                             literal(int64_t(0))}),
+       call("if_else", {high, literal(int64_t(0)), literal(int64_t(1))})},
+      {"L_SHIPMODE", "HIGH", "LOW"});
+  auto aggregate = AggregateBy(std::move(project),
+                               {Agg("hash_sum", "HIGH", "HIGH_LINE_COUNT"),
+                                Agg("hash_sum", "LOW", "LOW_LINE_COUNT")},
+                               {"L_SHIPMODE"});
+  return OrderBy(std::move(aggregate), {Asc("L_SHIPMODE")}, sink_gen);
+}
+
+// Customer distribution
+Result<Declaration> Q13(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto customer, tables->Scan("customer", {"C_CUSTKEY"}));
+  ARROW_ASSIGN_OR_RAISE(auto orders, tables->Scan("orders", {"O_ORDERKEY", "O_CUSTKEY",
+                                                             "O_COMMENT"}));
+  orders =
+      Filter(std::move(orders), not_(Like(Field("O_COMMENT"), "%special%requests%")));
+  auto join = Join(std::move(customer), std::move(orders), {"C_CUSTKEY"}, {"O_CUSTKEY"},
+                   JoinType::LEFT_OUTER);
+  // The orders are counted, the customers without orders count none
+  auto counts = AggregateBy(std::move(join), {Agg("hash_count", "O_ORDERKEY", "C_COUNT")},
+                            {"C_CUSTKEY"});
+  auto aggregate = AggregateBy(std::move(counts),
+                               {Agg("hash_count", "C_CUSTKEY", "CUSTDIST")}, {"C_COUNT"});
+  return OrderBy(std::move(aggregate), {Desc("CUSTDIST"), Desc("C_COUNT")}, sink_gen);
+}
+
+// Promotion effect
+Result<Declaration> Q14(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto part, tables->Scan("part", {"P_PARTKEY", "P_TYPE"}));
+  ARROW_ASSIGN_OR_RAISE(auto lineitem,
+                        tables->Scan("lineitem", {"L_PARTKEY", "L_EXTENDEDPRICE",
+                                                  "L_DISCOUNT", "L_SHIPDATE"}));
+  lineitem = Filter(std::move(lineitem),
+                    and_(greater_equal(Field("L_SHIPDATE"), Date(1995, 9, 1)),
+                         less(Field("L_SHIPDATE"), Date(1995, 10, 1))));
+  auto join = Join(std::move(lineitem), std::move(part), {"L_PARTKEY"}, {"P_PARTKEY"});
+  Expression volume = ToDouble(Revenue());
+  auto project = Project(
+      std::move(join),
+      {call("if_else", {Like(Field("P_TYPE"), "PROMO%"), volume, literal(0.0)}), volume},
+      {"PROMO_VOLUME", "VOLUME"});
+  auto aggregate = AggregateBy(std::move(project),
+                               {Agg("sum", "PROMO_VOLUME", "PROMO_VOLUME"),
+                                Agg("sum", "VOLUME", "VOLUME")});
+  auto ratio = Project(
+      std::move(aggregate),
+      {call("divide", {call("multiply", {literal(100.0), Field("PROMO_VOLUME")}),
+                       Field("VOLUME")})},
+      {"PROMO_REVENUE"});
+  return Sink(std::move(ratio), sink_gen);
+}
+
+// The revenue of each supplier in the first quarter of 1996
+Result<Declaration> SupplierRevenues(TpchTables* tables) {
+  ARROW_ASSIGN_OR_RAISE(auto lineitem,
+                        tables->Scan("lineitem", {"L_SUPPKEY", "L_EXTENDEDPRICE",
+                                                  "L_DISCOUNT", "L_SHIPDATE"}));
+  lineitem = Filter(std::move(lineitem),
+                    and_(greater_equal(Field("L_SHIPDATE"), Date(1996, 1, 1)),
+                         less(Field("L_SHIPDATE"), Date(1996, 4, 1))));
+  auto project = Project(std::move(lineitem), {Field("L_SUPPKEY"), Revenue()},
+                         {"SUPPLIER_NO", "VOLUME"});
+  return AggregateBy(std::move(project), {Agg("hash_sum", "VOLUME", "TOTAL_REVENUE")},
+                     {"SUPPLIER_NO"});
+}
+
+// Top supplier
+Result<Declaration> Q15(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto supplier,
+                        tables->Scan("supplier", {"S_SUPPKEY", "S_NAME", "S_ADDRESS",
+                                                  "S_PHONE"}));
+  ARROW_ASSIGN_OR_RAISE(auto revenues, SupplierRevenues(tables));
+  ARROW_ASSIGN_OR_RAISE(auto all_revenues, SupplierRevenues(tables));
+  revenues = Project(std::move(revenues),
+                     {Field("SUPPLIER_NO"), Field("TOTAL_REVENUE"), JoinKey()},
+                     {"SUPPLIER_NO", "TOTAL_REVENUE", "KEY"});
+  auto max_revenue = Project(
+      AggregateBy(std::move(all_revenues), {Agg("max", "TOTAL_REVENUE", "MAX_REVENUE")}),
+      {JoinKey(), Field("MAX_REVENUE")}, {"MAX_KEY", "MAX_REVENUE"});
+  auto top = Join(std::move(revenues), std::move(max_revenue), {"KEY"}, {"MAX_KEY"},
+                  JoinType::INNER, equal(Field("TOTAL_REVENUE"), Field("MAX_REVENUE")));
+  auto join =
+      Join(std::move(supplier), std::move(top), {"S_SUPPKEY"}, {"SUPPLIER_NO"});
+  auto project = Project(std::move(join),
+                         {Field("S_SUPPKEY"), Field("S_NAME"), Field("S_ADDRESS"),
+                          Field("S_PHONE"), Field("TOTAL_REVENUE")},
+                         {"S_SUPPKEY", "S_NAME", "S_ADDRESS", "S_PHONE",
+                          "TOTAL_REVENUE"});
+  return OrderBy(std::move(project), {Asc("S_SUPPKEY")}, sink_gen);
+}
+
+// Parts/supplier relationship
+Result<Declaration> Q16(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto part, tables->Scan("part", {"P_PARTKEY", "P_BRAND", "P_TYPE",
+                                                         "P_SIZE"}));
+  ARROW_ASSIGN_OR_RAISE(auto supplier,
+                        tables->Scan("supplier", {"S_SUPPKEY", "S_COMMENT"}));
+  ARROW_ASSIGN_OR_RAISE(auto partsupp,
+                        tables->Scan("partsupp", {"PS_PARTKEY", "PS_SUPPKEY"}));
+  part = Filter(std::move(part),
+                and_({not_equal(Field("P_BRAND"), Str("Brand#45")),
+                      not_(Like(Field("P_TYPE"), "MEDIUM POLISHED%")),
+                      IsIn(Field("P_SIZE"), int32(), "[49, 14, 23, 45, 19, 3, 36, 9]")}));
+  auto complaints =
+      Filter(std::move(supplier), Like(Field("S_COMMENT"), "%Customer%Complaints%"));
+  auto join = Join(
+      Join(std::move(partsupp), std::move(part), {"PS_PARTKEY"}, {"P_PARTKEY"}),
+      std::move(complaints), {"PS_SUPPKEY"}, {"S_SUPPKEY"}, JoinType::LEFT_ANTI);
+  auto aggregate = AggregateBy(std::move(join),
+                               {Agg("hash_count_distinct", "PS_SUPPKEY", "SUPPLIER_CNT")},
+                               {"P_BRAND", "P_TYPE", "P_SIZE"});
+  return OrderBy(std::move(aggregate),
+                 {Desc("SUPPLIER_CNT"), Asc("P_BRAND"), Asc("P_TYPE"), Asc("P_SIZE")},
+                 sink_gen);
+}
+
+// The lineitems of the parts of brand 23 in a medium box
+Result<Declaration> MediumBoxLineitems(TpchTables* tables) {
+  ARROW_ASSIGN_OR_RAISE(auto part,
+                        tables->Scan("part", {"P_PARTKEY", "P_BRAND", "P_CONTAINER"}));
+  ARROW_ASSIGN_OR_RAISE(auto lineitem, tables->Scan("lineitem", {"L_PARTKEY",
+                                                                 "L_QUANTITY",
+                                                                 "L_EXTENDEDPRICE"}));
+  part = Filter(std::move(part), and_(equal(Field("P_BRAND"), Str("Brand#23")),
+                                      equal(Field("P_CONTAINER"), Str("MED BOX"))));
+  auto join = Join(std::move(lineitem), std::move(part), {"L_PARTKEY"}, {"P_PARTKEY"},
+                   JoinType::LEFT_SEMI);
+  return Project(std::move(join),
+                 {Field("L_PARTKEY"), ToDouble(Field("L_QUANTITY")),
+                  ToDouble(Field("L_EXTENDEDPRICE"))},
+                 {"L_PARTKEY", "QUANTITY", "PRICE"});
+}
+
+// Small-quantity-order revenue
+Result<Declaration> Q17(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto lineitems, MediumBoxLineitems(tables));
+  ARROW_ASSIGN_OR_RAISE(auto all_lineitems, MediumBoxLineitems(tables));
+  auto limits = Project(
+      AggregateBy(std::move(all_lineitems),
+                  {Agg("hash_mean", "QUANTITY", "AVG_QUANTITY")}, {"L_PARTKEY"}),
+      {Field("L_PARTKEY"), call("multiply", {literal(0.2), Field("AVG_QUANTITY")})},
+      {"LIMIT_PARTKEY", "LIMIT_QUANTITY"});
+  auto join = Join(std::move(lineitems), std::move(limits), {"L_PARTKEY"},
+                   {"LIMIT_PARTKEY"}, JoinType::INNER,
+                   less(Field("QUANTITY"), Field("LIMIT_QUANTITY")));
+  auto aggregate = AggregateBy(std::move(join), {Agg("sum", "PRICE", "PRICE")});
+  return Sink(Project(std::move(aggregate),
+                      {call("divide", {Field("PRICE"), literal(7.0)})}, {"AVG_YEARLY"}),
+              sink_gen);
+}
+
+// Large volume customer
+Result<Declaration> Q18(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto customer, tables->Scan("customer", {"C_CUSTKEY", "C_NAME"}));
+  ARROW_ASSIGN_OR_RAISE(auto orders,
+                        tables->Scan("orders", {"O_ORDERKEY", "O_CUSTKEY", "O_TOTALPRICE",
+                                                "O_ORDERDATE"}));
+  ARROW_ASSIGN_OR_RAISE(auto lineitem,
+                        tables->Scan("lineitem", {"L_ORDERKEY", "L_QUANTITY"}));
+  ARROW_ASSIGN_OR_RAISE(auto all_lineitem,
+                        tables->Scan("lineitem", {"L_ORDERKEY", "L_QUANTITY"}));
+  auto large_orders = Project(
+      Filter(AggregateBy(std::move(all_lineitem),
+                         {Agg("hash_sum", "L_QUANTITY", "ORDER_QUANTITY")},
+                         {"L_ORDERKEY"}),
+             greater(Field("ORDER_QUANTITY"), Money(30000))),
+      {Field("L_ORDERKEY")}, {"LARGE_ORDERKEY"});
+  orders = Join(Join(std::move(orders), std::move(large_orders), {"O_ORDERKEY"},
+                     {"LARGE_ORDERKEY"}, JoinType::LEFT_SEMI),
+                std::move(customer), {"O_CUSTKEY"}, {"C_CUSTKEY"});
+  auto join =
+      Join(std::move(lineitem), std::move(orders), {"L_ORDERKEY"}, {"O_ORDERKEY"});
+  auto aggregate = AggregateBy(
+      std::move(join), {Agg("hash_sum", "L_QUANTITY", "SUM_QUANTITY")},
+      {"C_NAME", "C_CUSTKEY", "O_ORDERKEY", "O_ORDERDATE", "O_TOTALPRICE"});
+  return TopK(std::move(aggregate), 100, {Desc("O_TOTALPRICE"), Asc("O_ORDERDATE")},
+              sink_gen);
+}
+
+// Discounted revenue
+Result<Declaration> Q19(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto part, tables->Scan("part", {"P_PARTKEY", "P_BRAND",
+                                                         "P_CONTAINER", "P_SIZE"}));
+  ARROW_ASSIGN_OR_RAISE(
+      auto lineitem,
+      tables->Scan("lineitem", {"L_PARTKEY", "L_QUANTITY", "L_EXTENDEDPRICE",
+                                "L_DISCOUNT", "L_SHIPMODE", "L_SHIPINSTRUCT"}));
+  lineitem = Filter(std::move(lineitem),
+                    and_(IsIn(Field("L_SHIPMODE"), utf8(), R"(["AIR", "AIR REG"])"),
+                         equal(Field("L_SHIPINSTRUCT"), Str("DELIVER IN PERSON"))));
+  auto condition = [](const std::string& brand, const std::string& containers,
+                      int64_t min_quantity, int max_size) {
+    return and_({equal(Field("P_BRAND"), Str(brand)),
+                 IsIn(Field("P_CONTAINER"), utf8(), containers),
+                 Between(Field("L_QUANTITY"), Money(min_quantity * 100),
+                         Money((min_quantity + 10) * 100)),
+                 Between(Field("P_SIZE"), literal(1), literal(max_size))});
+  };
+  auto join = Join(
+      std::move(lineitem), std::move(part), {"L_PARTKEY"}, {"P_PARTKEY"}, JoinType::INNER,
+      or_({condition("Brand#12", R"(["SM CASE", "SM BOX", "SM PACK", "SM PKG"])", 1, 5),
+           condition("Brand#23", R"(["MED BAG", "MED BOX", "MED PKG", "MED PACK"])", 10,
+                     10),
+           condition("Brand#34", R"(["LG CASE", "LG BOX", "LG PACK", "LG PKG"])", 20,
+                     15)}));
+  auto project = Project(std::move(join), {Revenue()}, {"VOLUME"});
+  return Sink(AggregateBy(std::move(project), {Agg("sum", "VOLUME", "REVENUE")}),
+              sink_gen);
+}
+
+// Potential part promotion
+Result<Declaration> Q20(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto supplier,
+                        tables->Scan("supplier", {"S_SUPPKEY", "S_NAME", "S_ADDRESS",
+                                                  "S_NATIONKEY"}));
+  ARROW_ASSIGN_OR_RAISE(auto nation, NationNamed(tables, "CANADA"));
+  ARROW_ASSIGN_OR_RAISE(auto part, tables->Scan("part", {"P_PARTKEY", "P_NAME"}));
+  ARROW_ASSIGN_OR_RAISE(auto partsupp, tables->Scan("partsupp", {"PS_PARTKEY",
+                                                                 "PS_SUPPKEY",
+                                                                 "PS_AVAILQTY"}));
+  ARROW_ASSIGN_OR_RAISE(auto lineitem,
+                        tables->Scan("lineitem", {"L_PARTKEY", "L_SUPPKEY", "L_QUANTITY",
+                                                  "L_SHIPDATE"}));
+  lineitem = Filter(std::move(lineitem),
+                    and_(greater_equal(Field("L_SHIPDATE"), Date(1994, 1, 1)),
+                         less(Field("L_SHIPDATE"), Date(1995, 1, 1))));
+  auto shipped = Project(
+      AggregateBy(std::move(lineitem), {Agg("hash_sum", "L_QUANTITY", "QUANTITY")},
+                  {"L_PARTKEY", "L_SUPPKEY"}),
+      {Field("L_PARTKEY"), Field("L_SUPPKEY"),
+       call("multiply", {literal(0.5), ToDouble(Field("QUANTITY"))})},
+      {"L_PARTKEY", "L_SUPPKEY", "HALF_QUANTITY"});
+  part = Filter(std::move(part), Like(Field("P_NAME"), "forest%"));
+  partsupp = Join(std::move(partsupp), std::move(part), {"PS_PARTKEY"}, {"P_PARTKEY"},
+                  JoinType::LEFT_SEMI);
+  partsupp = Join(std::move(partsupp), std::move(shipped), {"PS_PARTKEY", "PS_SUPPKEY"},
+                  {"L_PARTKEY", "L_SUPPKEY"}, JoinType::LEFT_SEMI,
+                  greater(ToDouble(Field("PS_AVAILQTY")), Field("HALF_QUANTITY")));
+  supplier = Join(std::move(supplier), std::move(nation), {"S_NATIONKEY"},
+                  {"N_NATIONKEY"}, JoinType::LEFT_SEMI);
+  auto join = Join(std::move(supplier), std::move(partsupp), {"S_SUPPKEY"},
+                   {"PS_SUPPKEY"}, JoinType::LEFT_SEMI);
+  return OrderBy(
+      Project(std::move(join), {Field("S_NAME"), Field("S_ADDRESS")},
+              {"S_NAME", "S_ADDRESS"}),
+      {Asc("S_NAME")}, sink_gen);
+}
+
+// The lineitems received after their commit date
+Result<Declaration> LateLineitems(TpchTables* tables) {
+  ARROW_ASSIGN_OR_RAISE(auto lineitem,
+                        tables->Scan("lineitem", {"L_ORDERKEY", "L_SUPPKEY",
+                                                  "L_COMMITDATE", "L_RECEIPTDATE"}));
+  return Filter(std::move(lineitem),
+                greater(Field("L_RECEIPTDATE"), Field("L_COMMITDATE")));
+}
+
+// Suppliers who kept orders waiting
+//
+// The lineitems of the other suppliers of an order are checked by counting the
+// suppliers of each order, and the suppliers late for each order.
+Result<Declaration> Q21(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto supplier,
+                        tables->Scan("supplier", {"S_SUPPKEY", "S_NAME", "S_NATIONKEY"}));
+  ARROW_ASSIGN_OR_RAISE(auto nation, NationNamed(tables, "SAUDI ARABIA"));
+  ARROW_ASSIGN_OR_RAISE(auto orders,
+                        tables->Scan("orders", {"O_ORDERKEY", "O_ORDERSTATUS"}));
+  ARROW_ASSIGN_OR_RAISE(auto late, LateLineitems(tables));
+  ARROW_ASSIGN_OR_RAISE(auto all_late, LateLineitems(tables));
+  ARROW_ASSIGN_OR_RAISE(auto lineitem,
+                        tables->Scan("lineitem", {"L_ORDERKEY", "L_SUPPKEY"}));
+
+  auto shared_orders = Project(
+      Filter(AggregateBy(std::move(lineitem),
+                         {Agg("hash_count_distinct", "L_SUPPKEY", "NUM_SUPPLIERS")},
+                         {"L_ORDERKEY"}),
+             greater(Field("NUM_SUPPLIERS"), literal(int64_t(1)))),
+      {Field("L_ORDERKEY")}, {"SHARED_ORDERKEY"});
+  auto single_late_orders = Project(
+      Filter(AggregateBy(std::move(all_late),
+                         {Agg("hash_count_distinct", "L_SUPPKEY", "NUM_LATE")},
+                         {"L_ORDERKEY"}),
+             equal(Field("NUM_LATE"), literal(int64_t(1)))),
+      {Field("L_ORDERKEY")}, {"SINGLE_LATE_ORDERKEY"});
+  orders = Filter(std::move(orders), equal(Field("O_ORDERSTATUS"), Str("F")));
+  supplier = Join(std::move(supplier), std::move(nation), {"S_NATIONKEY"},
+                  {"N_NATIONKEY"}, JoinType::LEFT_SEMI);
+
+  auto join = Join(std::move(late), std::move(supplier), {"L_SUPPKEY"}, {"S_SUPPKEY"});
+  join = Join(std::move(join), std::move(orders), {"L_ORDERKEY"}, {"O_ORDERKEY"},
+              JoinType::LEFT_SEMI);
+  join = Join(std::move(join), std::move(shared_orders), {"L_ORDERKEY"},
+              {"SHARED_ORDERKEY"}, JoinType::LEFT_SEMI);
+  join = Join(std::move(join), std::move(single_late_orders), {"L_ORDERKEY"},
+              {"SINGLE_LATE_ORDERKEY"}, JoinType::LEFT_SEMI);
+  auto aggregate = AggregateBy(std::move(join), {Agg("hash_count", "S_NAME", "NUMWAIT")},
+                               {"S_NAME"});
+  return TopK(std::move(aggregate), 100, {Desc("NUMWAIT"), Asc("S_NAME")}, sink_gen);
+}
+
+// The customers with one of the given country codes
+Result<Declaration> CustomersOfCountries(TpchTables* tables) {
+  ARROW_ASSIGN_OR_RAISE(auto customer, tables->Scan("customer", {"C_CUSTKEY", "C_PHONE",
+                                                                 "C_ACCTBAL"}));
+  auto project = Project(
+      std::move(customer),
+      {Field("C_CUSTKEY"),
+       call("utf8_slice_codeunits", {Field("C_PHONE")}, SliceOptions(0, 2)),
+       ToDouble(Field("C_ACCTBAL"))},
+      {"C_CUSTKEY", "CNTRYCODE", "C_ACCTBAL"});
+  return Filter(std::move(project),
+                IsIn(Field("CNTRYCODE"), utf8(),
+                     R"(["13", "31", "23", "29", "30", "18", "17"])"));
+}
+
+// Global sales opportunity
+Result<Declaration> Q22(TpchTables* tables, SinkGenerator* sink_gen) {
+  ARROW_ASSIGN_OR_RAISE(auto customers, CustomersOfCountries(tables));
+  ARROW_ASSIGN_OR_RAISE(auto all_customers, CustomersOfCountries(tables));
+  ARROW_ASSIGN_OR_RAISE(auto orders, tables->Scan("orders", {"O_CUSTKEY"}));
+  auto average = Project(
+      AggregateBy(Filter(std::move(all_customers),
+                         greater(Field("C_ACCTBAL"), literal(0.0))),
+                  {Agg("mean", "C_ACCTBAL", "AVG_ACCTBAL")}),
+      {JoinKey(), Field("AVG_ACCTBAL")}, {"AVG_KEY", "AVG_ACCTBAL"});
+  customers = Project(std::move(customers),
+                      {Field("C_CUSTKEY"), Field("CNTRYCODE"), Field("C_ACCTBAL"),
+                       JoinKey()},
+                      {"C_CUSTKEY", "CNTRYCODE", "C_ACCTBAL", "KEY"});
+  customers = Join(std::move(customers), std::move(average), {"KEY"}, {"AVG_KEY"},
+                   JoinType::INNER, greater(Field("C_ACCTBAL"), Field("AVG_ACCTBAL")));
+  // The customers without orders, the hash table is built on the customers
+  auto join = Join(std::move(orders), std::move(customers), {"O_CUSTKEY"}, {"C_CUSTKEY"},
+                   JoinType::RIGHT_ANTI);
+  auto aggregate = AggregateBy(std::move(join),
+                               {Agg("hash_count", "C_CUSTKEY", "NUMCUST"),
+                                Agg("hash_sum", "C_ACCTBAL", "TOTACCTBAL")},
+                               {"CNTRYCODE"});
+  return OrderBy(std::move(aggregate), {Asc("CNTRYCODE")}, sink_gen);
+}
+
+// ---------------------------------------------------------------------------
+// Data
+
+// The CHAR columns, fixed size binaries padded with zeros, as strings
+Result<std::shared_ptr<ChunkedArray>> TrimFixedSizeBinary(const ChunkedArray& column) {
+  ArrayVector chunks;
+  for (const auto& chunk : column.chunks()) {
+    const auto& binary =
+        arrow::internal::checked_cast<const FixedSizeBinaryArray&>(*chunk);
+    StringBuilder builder;
+    RETURN_NOT_OK(builder.Reserve(binary.length()));
+    for (int64_t i = 0; i < binary.length(); i++) {
+      util::string_view value = binary.GetView(i);
+      auto end = value.find_last_not_of(std::string("\0 ", 2));
+      RETURN_NOT_OK(builder.Append(value.substr(0, end + 1)));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto trimmed, builder.Finish());
+    chunks.push_back(std::move(trimmed));
+  }
+  return std::make_shared<ChunkedArray>(std::move(chunks), utf8());
+}
+
+using TableMap = std::map<std::string, std::shared_ptr<Table>>;
+
+Result<TableMap> GenerateTables(double scale_factor) {
+  ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make());
+  ARROW_ASSIGN_OR_RAISE(auto gen, TpchGen::Make(plan.get(), scale_factor));
+  // All the tables from one generator, for their keys to match
+  std::map<std::string, ExecNode*> sources;
+  ARROW_ASSIGN_OR_RAISE(sources["part"], gen->Part());
+  ARROW_ASSIGN_OR_RAISE(sources["supplier"], gen->Supplier());
+  ARROW_ASSIGN_OR_RAISE(sources["partsupp"], gen->PartSupp());
+  ARROW_ASSIGN_OR_RAISE(sources["customer"], gen->Customer());
+  ARROW_ASSIGN_OR_RAISE(sources["orders"], gen->Orders());
+  ARROW_ASSIGN_OR_RAISE(sources["lineitem"], gen->Lineitem());
+  ARROW_ASSIGN_OR_RAISE(sources["nation"], gen->Nation());
+  ARROW_ASSIGN_OR_RAISE(sources["region"], gen->Region());
+  TableMap tables;
+  for (const auto& source : sources) {
+    RETURN_NOT_OK(Declaration("table_sink", {Declaration::Input(source.second)},
+                              TableSinkNodeOptions(&tables[source.first]))
+                      .AddToPlan(plan.get())
+                      .status());
+  }
+  RETURN_NOT_OK(plan->StartProducing());
+  RETURN_NOT_OK(plan->finished().status());
+
+  for (auto& table : tables) {
+    auto fields = table.second->schema()->fields();
+    auto columns = table.second->columns();
+    for (size_t i = 0; i < fields.size(); i++) {
+      if (fields[i]->type()->id() == Type::FIXED_SIZE_BINARY) {
+        ARROW_ASSIGN_OR_RAISE(columns[i], TrimFixedSizeBinary(*columns[i]));
+        fields[i] = fields[i]->WithType(utf8());
+      }
+    }
+    table.second = Table::Make(schema(std::move(fields)), std::move(columns));
+  }
+  return tables;
+}
+
+// The tables of the current scale factor, generated once
+const TableMap& GetTables(double scale_factor) {
+  static std::map<double, TableMap> tables;
+  auto it = tables.find(scale_factor);
+  if (it == tables.end()) {
+    it = tables.emplace(scale_factor, *GenerateTables(scale_factor)).first;
+  }
+  return it->second;
+}
+
+double GetScaleFactor() {
+  const char* scale_factor = std::getenv("ARROW_TPCH_SCALE_FACTOR");
+  return scale_factor != nullptr ? std::atof(scale_factor) : 1.0;
+}
+
+Result<std::vector<int>> ColumnIndices(const Schema& schema,
+                                       const std::vector<std::string>& columns) {
+  std::vector<int> indices;
+  for (const auto& column : columns) {
+    ARROW_ASSIGN_OR_RAISE(auto path, FieldRef(column).FindOne(schema));
+    indices.push_back(path[0]);
+  }
+  return indices;
+}
+
+class InMemoryTables : public TpchTables {
+ public:
+  InMemoryTables(double scale_factor, const TableMap& tables)
+      : TpchTables(scale_factor), tables_(tables) {}
+
+  Result<Declaration> Scan(const std::string& table,
+                           const std::vector<std::string>& columns) override {
+    const auto& full_table = tables_.at(table);
+    ARROW_ASSIGN_OR_RAISE(auto indices, ColumnIndices(*full_table->schema(), columns));
+    ARROW_ASSIGN_OR_RAISE(auto selected, full_table->SelectColumns(indices));
+    return Declaration("table_source", TableSourceNodeOptions(selected, kBatchSize));
+  }
+
+ private:
+  const TableMap& tables_;
+};
+
+#ifdef ARROW_TPCH_BENCHMARK_PARQUET
+
+using FileMap = std::map<std::string, std::shared_ptr<Buffer>>;
+
+// The tables of the current scale factor as Parquet files, written once
+const FileMap& GetParquetFiles(double scale_factor) {
+  static std::map<double, FileMap> files;
+  auto it = files.find(scale_factor);
+  if (it == files.end()) {
+    FileMap tables_files;
+    for (const auto& table : GetTables(scale_factor)) {
+      auto sink = *io::BufferOutputStream::Create();
+      ABORT_NOT_OK(parquet::arrow::WriteTable(*table.second, default_memory_pool(), sink,
+                                              /*chunk_size=*/kBatchSize * 8));
+      tables_files[table.first] = *sink->Finish();
+    }
+    it = files.emplace(scale_factor, std::move(tables_files)).first;
+  }
+  return it->second;
+}
+
+// The columns are read from the Parquet files as each query is planned
+class ParquetTables : public TpchTables {
+ public:
+  ParquetTables(double scale_factor, const FileMap& files)
+      : TpchTables(scale_factor), files_(files) {}
+
+  Result<Declaration> Scan(const std::string& table,
+                           const std::vector<std::string>& columns) override {
+    std::unique_ptr<parquet::arrow::FileReader> reader;
+    RETURN_NOT_OK(parquet::arrow::OpenFile(
+        std::make_shared<io::BufferReader>(files_.at(table)), default_memory_pool(),
+        &reader));
+    reader->set_use_threads(true);
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(reader->GetSchema(&schema));
+    ARROW_ASSIGN_OR_RAISE(auto indices, ColumnIndices(*schema, columns));
+    std::shared_ptr<Table> selected;
+    RETURN_NOT_OK(reader->ReadTable(indices, &selected));
+    return Declaration("table_source", TableSourceNodeOptions(selected, kBatchSize));
+  }
+
+ private:
+  const FileMap& files_;
+};
+
+#endif
+
+// ---------------------------------------------------------------------------
+// Benchmarks
+
+// The nodes of a plan, from its sinks
+void CollectNodes(ExecNode* node, std::vector<ExecNode*>* nodes) {
+  if (std::find(nodes->begin(), nodes->end(), node) != nodes->end()) return;
+  nodes->push_back(node);
+  for (auto input : node->inputs()) {
+    CollectNodes(input, nodes);
+  }
+}
+
+// Run the query in each iteration, with the given number of threads.  The time spent in
+// each kind of node is reported as a counter.
+void RunQuery(benchmark::State& st, Query query, TpchTables* tables) {
+  auto thread_pool = *arrow::internal::ThreadPool::Make(static_cast<int>(st.range(0)));
+  ExecContext ctx(default_memory_pool(), thread_pool.get());
+
+  int64_t num_rows = 0;
+  std::map<std::string, int64_t> wall_time_ns;
   for (auto _ : st) {
+    SinkGenerator sink_gen;
+    auto plan = *ExecPlan::Make(&ctx);
+    auto declaration = query(tables, &sink_gen);
+    if (!declaration.ok()) {
+      st.SkipWithError(declaration.status().ToString().c_str());
+      return;
+    }
+    ABORT_NOT_OK(declaration->AddToPlan(plan.get()));
+    auto batches = *StartAndCollect(plan.get(), sink_gen).MoveResult();
+
     st.PauseTiming();
-    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
-    std::shared_ptr<ExecPlan> plan = Plan_Q1(&sink_gen, static_cast<int>(st.range(0)));
+    num_rows = 0;
+    for (const auto& batch : batches) {
+      num_rows += batch.length;
+    }
+    std::vector<ExecNode*> nodes;
+    for (auto sink : plan->sinks()) {
+      CollectNodes(sink, &nodes);
+    }
+    for (auto node : nodes) {
+      wall_time_ns[node->kind_name()] += node->metrics().wall_time_ns;
+    }
     st.ResumeTiming();
-    auto fut = StartAndCollect(plan.get(), sink_gen);
-    auto res = *fut.MoveResult();
   }
+  st.counters["result_rows"] = static_cast<double>(num_rows);
+  for (const auto& kind : wall_time_ns) {
+    st.counters[kind.first + "_ms"] = benchmark::Counter(
+        static_cast<double>(kind.second) / 1e6, benchmark::Counter::kAvgIterations);
+  }
+}
+
+static void BM_Tpch(benchmark::State& st, Query query) {
+  double scale_factor = GetScaleFactor();
+  InMemoryTables tables(scale_factor, GetTables(scale_factor));
+  RunQuery(st, query, &tables);
+}
+
+#ifdef ARROW_TPCH_BENCHMARK_PARQUET
+static void BM_TpchParquet(benchmark::State& st, Query query) {
+  double scale_factor = GetScaleFactor();
+  ParquetTables tables(scale_factor, GetParquetFiles(scale_factor));
+  RunQuery(st, query, &tables);
 }
+#endif
+
+static void TpchArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"Threads"});
+  bench->Arg(1);
+  int num_cores = static_cast<int>(std::thread::hardware_concurrency());
+  if (num_cores > 1) {
+    bench->Arg(num_cores);
+  }
+  bench->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+#ifdef ARROW_TPCH_BENCHMARK_PARQUET
+#define TPCH_BENCHMARK(QUERY)                               \
+  BENCHMARK_CAPTURE(BM_Tpch, QUERY, QUERY)->Apply(TpchArgs); \
+  BENCHMARK_CAPTURE(BM_TpchParquet, QUERY, QUERY)->Apply(TpchArgs)
+#else
+#define TPCH_BENCHMARK(QUERY) BENCHMARK_CAPTURE(BM_Tpch, QUERY, QUERY)->Apply(TpchArgs)
+#endif
+
+TPCH_BENCHMARK(Q1);
+TPCH_BENCHMARK(Q2);
+TPCH_BENCHMARK(Q3);
+TPCH_BENCHMARK(Q4);
+TPCH_BENCHMARK(Q5);
+TPCH_BENCHMARK(Q6);
+TPCH_BENCHMARK(Q7);
+TPCH_BENCHMARK(Q8);
+TPCH_BENCHMARK(Q9);
+TPCH_BENCHMARK(Q10);
+TPCH_BENCHMARK(Q11);
+TPCH_BENCHMARK(Q12);
+TPCH_BENCHMARK(Q13);
+TPCH_BENCHMARK(Q14);
+TPCH_BENCHMARK(Q15);
+TPCH_BENCHMARK(Q16);
+TPCH_BENCHMARK(Q17);
+TPCH_BENCHMARK(Q18);
+TPCH_BENCHMARK(Q19);
+TPCH_BENCHMARK(Q20);
+TPCH_BENCHMARK(Q21);
+TPCH_BENCHMARK(Q22);
 
-BENCHMARK(BM_Tpch_Q1)->Args({1})->ArgNames({"ScaleFactor"});
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
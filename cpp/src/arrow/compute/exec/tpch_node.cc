@@ -3407,7 +3407,7 @@ class TpchNode : public ExecNode {
 
  private:
   void OutputBatchCallback(ExecBatch batch) {
-    outputs_[0]->InputReceived(this, std::move(batch));
+    EmitBatch(std::move(batch));
   }
 
   void FinishedCallback(int64_t total_num_batches) {
@@ -3427,7 +3427,7 @@ class TpchNode : public ExecNode {
     // if the task group is ended we can just skip scheduling these tasks in general.
     if (executor) {
       RETURN_NOT_OK(task_group_.AddTaskIfNotEnded([&] {
-        return executor->Submit([this, func] {
+        return executor->Submit(plan_->MakeTaskHints(), [this, func] {
           size_t thread_index = thread_indexer_();
           Status status = func(thread_index);
           if (!status.ok()) {
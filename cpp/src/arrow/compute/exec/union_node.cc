@@ -82,7 +82,7 @@ class UnionNode : public ExecNode {
     if (finished_.is_finished()) {
       return;
     }
-    outputs_[0]->InputReceived(this, std::move(batch));
+    EmitBatch(std::move(batch));
     if (batch_count_.Increment()) {
       finished_.MarkFinished();
     }
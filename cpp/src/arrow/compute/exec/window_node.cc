@@ -0,0 +1,861 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/compute/row/grouper.h"
+#include "arrow/datum.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/int_util_overflow.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+enum class WindowFunctionKind {
+  ROW_NUMBER,
+  RANK,
+  DENSE_RANK,
+  LAG,
+  LEAD,
+  COUNT,
+  SUM,
+  MEAN,
+  MIN,
+  MAX
+};
+
+Result<WindowFunctionKind> GetWindowFunctionKind(const std::string& name) {
+  static const std::vector<std::pair<std::string, WindowFunctionKind>> kinds = {
+      {"row_number", WindowFunctionKind::ROW_NUMBER},
+      {"rank", WindowFunctionKind::RANK},
+      {"dense_rank", WindowFunctionKind::DENSE_RANK},
+      {"lag", WindowFunctionKind::LAG},
+      {"lead", WindowFunctionKind::LEAD},
+      {"count", WindowFunctionKind::COUNT},
+      {"sum", WindowFunctionKind::SUM},
+      {"mean", WindowFunctionKind::MEAN},
+      {"min", WindowFunctionKind::MIN},
+      {"max", WindowFunctionKind::MAX}};
+  for (const auto& kind : kinds) {
+    if (kind.first == name) return kind.second;
+  }
+  return Status::Invalid("Unknown window function '", name, "'");
+}
+
+bool IsRankingFunction(WindowFunctionKind kind) {
+  return kind == WindowFunctionKind::ROW_NUMBER || kind == WindowFunctionKind::RANK ||
+         kind == WindowFunctionKind::DENSE_RANK;
+}
+
+bool IsFrameFunction(WindowFunctionKind kind) {
+  return kind == WindowFunctionKind::COUNT || kind == WindowFunctionKind::SUM ||
+         kind == WindowFunctionKind::MEAN || kind == WindowFunctionKind::MIN ||
+         kind == WindowFunctionKind::MAX;
+}
+
+// Type in which sum, mean, min and max accumulate values of the given type
+Result<std::shared_ptr<DataType>> AccumulatorType(const std::string& function,
+                                                  const DataType& type) {
+  if (is_signed_integer(type.id())) return int64();
+  if (is_unsigned_integer(type.id())) return uint64();
+  if (is_floating(type.id())) return float64();
+  return Status::TypeError("Window function '", function, "' is not supported for ",
+                           type.ToString());
+}
+
+bool IsTemporal(Type::type id) {
+  switch (id) {
+    case Type::DATE32:
+    case Type::DATE64:
+    case Type::TIME32:
+    case Type::TIME64:
+    case Type::TIMESTAMP:
+    case Type::DURATION:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool IsRangeOffsetFrame(const WindowFrame& frame) {
+  return frame.units == WindowFrame::RANGE &&
+         (frame.preceding > 0 || frame.following > 0);
+}
+
+// Layout of the sorted input: for every row i (in sorted order), the rows of its
+// partition are [partition_begin[i], partition_end[i]) and the rows of its peer group
+// are [peer_begin[i], peer_end[i])
+struct SortedLayout {
+  std::vector<int64_t> partition_begin;
+  std::vector<int64_t> partition_end;
+  std::vector<int64_t> peer_begin;
+  std::vector<int64_t> peer_end;
+};
+
+template <typename T>
+T AddSaturated(T value, int64_t offset) {
+  T out;
+  if (::arrow::internal::AddWithOverflow(value, static_cast<T>(offset), &out)) {
+    return std::numeric_limits<T>::max();
+  }
+  return out;
+}
+
+template <typename T>
+T SubtractSaturated(T value, int64_t offset) {
+  T out;
+  if (::arrow::internal::SubtractWithOverflow(value, static_cast<T>(offset), &out)) {
+    return std::numeric_limits<T>::min();
+  }
+  return out;
+}
+
+template <>
+double AddSaturated<double>(double value, int64_t offset) {
+  return value + static_cast<double>(offset);
+}
+
+template <>
+double SubtractSaturated<double>(double value, int64_t offset) {
+  return value - static_cast<double>(offset);
+}
+
+// Compute RANGE frame bounds given as distances between values of the order key.
+// Bounds which are not offsets have already been set by the caller.  Both bounds are
+// non-decreasing within a partition, so two moving pointers find them in linear time.
+template <typename T>
+void ComputeRangeOffsetFrames(const WindowFrame& frame, bool descending,
+                              const Array& keys, const SortedLayout& layout,
+                              std::vector<int64_t>* lo, std::vector<int64_t>* hi) {
+  const T* values = keys.data()->GetValues<T>(1);
+  const int64_t num_rows = keys.length();
+  int64_t begin = 0;
+  while (begin < num_rows) {
+    const int64_t end = layout.partition_end[begin];
+    // Nulls are sorted last and are only part of the frames of other nulls (their peers)
+    int64_t non_null_end = end;
+    while (non_null_end > begin && keys.IsNull(non_null_end - 1)) --non_null_end;
+    for (int64_t i = non_null_end; i < end; ++i) {
+      if (frame.preceding > 0) (*lo)[i] = layout.peer_begin[i];
+      if (frame.following > 0) (*hi)[i] = layout.peer_end[i];
+    }
+    int64_t lo_pos = begin;
+    int64_t hi_pos = begin;
+    for (int64_t i = begin; i < non_null_end; ++i) {
+      if (frame.preceding > 0) {
+        // Skip rows further than `preceding` before the current row
+        if (descending) {
+          const T bound = AddSaturated(values[i], frame.preceding);
+          while (lo_pos < i && values[lo_pos] > bound) ++lo_pos;
+        } else {
+          const T bound = SubtractSaturated(values[i], frame.preceding);
+          while (lo_pos < i && values[lo_pos] < bound) ++lo_pos;
+        }
+        (*lo)[i] = std::min(lo_pos, layout.peer_begin[i]);
+      }
+      if (frame.following > 0) {
+        // Include rows at most `following` after the current row
+        hi_pos = std::max(hi_pos, layout.peer_end[i]);
+        if (descending) {
+          const T bound = SubtractSaturated(values[i], frame.following);
+          while (hi_pos < non_null_end && values[hi_pos] >= bound) ++hi_pos;
+        } else {
+          const T bound = AddSaturated(values[i], frame.following);
+          while (hi_pos < non_null_end && values[hi_pos] <= bound) ++hi_pos;
+        }
+        (*hi)[i] = hi_pos;
+      }
+    }
+    begin = end;
+  }
+}
+
+// Compute the frame [lo[i], hi[i]) of every sorted row
+Status ComputeFrames(const WindowFrame& frame, const SortedLayout& layout,
+                     const std::shared_ptr<Array>& range_key, bool descending,
+                     std::vector<int64_t>* lo, std::vector<int64_t>* hi) {
+  const int64_t num_rows = static_cast<int64_t>(layout.partition_begin.size());
+  lo->resize(num_rows);
+  hi->resize(num_rows);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    const int64_t begin = layout.partition_begin[i];
+    const int64_t end = layout.partition_end[i];
+    if (frame.preceding == WindowFrame::kUnbounded) {
+      (*lo)[i] = begin;
+    } else if (frame.units == WindowFrame::ROWS) {
+      (*lo)[i] = std::max(begin, i - frame.preceding);
+    } else {
+      (*lo)[i] = layout.peer_begin[i];
+    }
+    if (frame.following == WindowFrame::kUnbounded) {
+      (*hi)[i] = end;
+    } else if (frame.units == WindowFrame::ROWS) {
+      (*hi)[i] = std::min(end, i + frame.following + 1);
+    } else {
+      (*hi)[i] = layout.peer_end[i];
+    }
+  }
+  if (!IsRangeOffsetFrame(frame)) {
+    return Status::OK();
+  }
+  switch (range_key->type()->id()) {
+    case Type::INT64:
+      ComputeRangeOffsetFrames<int64_t>(frame, descending, *range_key, layout, lo, hi);
+      break;
+    case Type::DOUBLE:
+      ComputeRangeOffsetFrames<double>(frame, descending, *range_key, layout, lo, hi);
+      break;
+    default:
+      DCHECK(false);
+      return Status::UnknownError("Unexpected range key type");
+  }
+  return Status::OK();
+}
+
+// Compute count, sum, mean, min or max of the non-null values over the frames
+// [lo[i], hi[i]).  Count, sum and mean are differences of prefix sums, min and max are
+// maintained in a monotonic deque, which works because frame bounds never decrease.
+template <typename T>
+Result<std::shared_ptr<Array>> ComputeFrameAggregate(WindowFunctionKind kind,
+                                                     const Array& values,
+                                                     const std::vector<int64_t>& lo,
+                                                     const std::vector<int64_t>& hi,
+                                                     MemoryPool* pool) {
+  using ArrowType = typename CTypeTraits<T>::ArrowType;
+  const int64_t num_rows = values.length();
+  std::vector<int64_t> prefix_count(num_rows + 1, 0);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    prefix_count[i + 1] = prefix_count[i] + (values.IsValid(i) ? 1 : 0);
+  }
+  if (kind == WindowFunctionKind::COUNT) {
+    Int64Builder builder(pool);
+    RETURN_NOT_OK(builder.Reserve(num_rows));
+    for (int64_t i = 0; i < num_rows; ++i) {
+      builder.UnsafeAppend(prefix_count[hi[i]] - prefix_count[lo[i]]);
+    }
+    return builder.Finish();
+  }
+
+  const T* data = values.data()->GetValues<T>(1);
+  if (kind == WindowFunctionKind::SUM || kind == WindowFunctionKind::MEAN) {
+    // Integer sums wrap around on overflow, like the "sum" aggregate function
+    using SumType =
+        typename std::conditional<std::is_integral<T>::value, uint64_t, double>::type;
+    std::vector<SumType> prefix_sum(num_rows + 1, 0);
+    for (int64_t i = 0; i < num_rows; ++i) {
+      prefix_sum[i + 1] =
+          prefix_sum[i] + (values.IsValid(i) ? static_cast<SumType>(data[i]) : 0);
+    }
+    if (kind == WindowFunctionKind::SUM) {
+      NumericBuilder<ArrowType> builder(pool);
+      RETURN_NOT_OK(builder.Reserve(num_rows));
+      for (int64_t i = 0; i < num_rows; ++i) {
+        if (prefix_count[hi[i]] == prefix_count[lo[i]]) {
+          builder.UnsafeAppendNull();
+        } else {
+          builder.UnsafeAppend(static_cast<T>(prefix_sum[hi[i]] - prefix_sum[lo[i]]));
+        }
+      }
+      return builder.Finish();
+    }
+    DoubleBuilder builder(pool);
+    RETURN_NOT_OK(builder.Reserve(num_rows));
+    for (int64_t i = 0; i < num_rows; ++i) {
+      const int64_t count = prefix_count[hi[i]] - prefix_count[lo[i]];
+      if (count == 0) {
+        builder.UnsafeAppendNull();
+      } else {
+        const T sum = static_cast<T>(prefix_sum[hi[i]] - prefix_sum[lo[i]]);
+        builder.UnsafeAppend(static_cast<double>(sum) / static_cast<double>(count));
+      }
+    }
+    return builder.Finish();
+  }
+
+  DCHECK(kind == WindowFunctionKind::MIN || kind == WindowFunctionKind::MAX);
+  const bool is_min = kind == WindowFunctionKind::MIN;
+  // Indices of the candidate extrema of the current frame, values are monotonic from
+  // front to back and the front is the extremum
+  std::deque<int64_t> candidates;
+  int64_t next = 0;
+  NumericBuilder<ArrowType> builder(pool);
+  RETURN_NOT_OK(builder.Reserve(num_rows));
+  for (int64_t i = 0; i < num_rows; ++i) {
+    if (next < lo[i]) next = lo[i];
+    for (; next < hi[i]; ++next) {
+      if (values.IsNull(next)) continue;
+      while (!candidates.empty() &&
+             (is_min ? data[candidates.back()] >= data[next]
+                     : data[candidates.back()] <= data[next])) {
+        candidates.pop_back();
+      }
+      candidates.push_back(next);
+    }
+    while (!candidates.empty() && candidates.front() < lo[i]) {
+      candidates.pop_front();
+    }
+    if (candidates.empty()) {
+      builder.UnsafeAppendNull();
+    } else {
+      builder.UnsafeAppend(data[candidates.front()]);
+    }
+  }
+  return builder.Finish();
+}
+
+Result<std::shared_ptr<Array>> ConcatenateColumn(const std::vector<ExecBatch>& batches,
+                                                 int column,
+                                                 const std::shared_ptr<DataType>& type,
+                                                 MemoryPool* pool) {
+  if (batches.empty()) {
+    return MakeArrayOfNull(type, 0, pool);
+  }
+  ArrayVector chunks;
+  for (const ExecBatch& batch : batches) {
+    const Datum& value = batch.values[column];
+    if (value.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(auto chunk,
+                            MakeArrayFromScalar(*value.scalar(), batch.length, pool));
+      chunks.push_back(std::move(chunk));
+    } else {
+      chunks.push_back(value.make_array());
+    }
+  }
+  if (chunks.size() == 1) {
+    return chunks[0];
+  }
+  return Concatenate(chunks, pool);
+}
+
+class WindowNode : public ExecNode {
+ public:
+  WindowNode(ExecNode* input, std::shared_ptr<Schema> output_schema,
+             std::vector<int> partition_key_ids, std::vector<int> order_key_ids,
+             std::vector<SortOrder> sort_orders, std::vector<WindowFunction> functions,
+             std::vector<WindowFunctionKind> kinds, std::vector<int> target_ids)
+      : ExecNode(input->plan(), {input}, {"input"}, std::move(output_schema),
+                 /*num_outputs=*/1),
+        partition_key_ids_(std::move(partition_key_ids)),
+        order_key_ids_(std::move(order_key_ids)),
+        sort_orders_(std::move(sort_orders)),
+        functions_(std::move(functions)),
+        kinds_(std::move(kinds)),
+        target_ids_(std::move(target_ids)) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "WindowNode"));
+
+    auto input = inputs[0];
+    const auto& window_options = checked_cast<const WindowNodeOptions&>(options);
+    const auto& input_schema = input->output_schema();
+
+    std::vector<int> partition_key_ids;
+    for (const FieldRef& key : window_options.partition_keys) {
+      ARROW_ASSIGN_OR_RAISE(auto match, key.FindOne(*input_schema));
+      partition_key_ids.push_back(match[0]);
+    }
+    std::vector<int> order_key_ids;
+    std::vector<SortOrder> sort_orders;
+    for (const SortKey& key : window_options.order_by) {
+      ARROW_ASSIGN_OR_RAISE(auto match, key.target.FindOne(*input_schema));
+      order_key_ids.push_back(match[0]);
+      sort_orders.push_back(key.order);
+    }
+
+    FieldVector output_fields = input_schema->fields();
+    std::vector<WindowFunctionKind> kinds;
+    std::vector<int> target_ids;
+    for (const WindowFunction& function : window_options.functions) {
+      ARROW_ASSIGN_OR_RAISE(WindowFunctionKind kind,
+                            GetWindowFunctionKind(function.function));
+      kinds.push_back(kind);
+      if (IsRankingFunction(kind)) {
+        target_ids.push_back(-1);
+        output_fields.push_back(field(function.name, int64()));
+        continue;
+      }
+      ARROW_ASSIGN_OR_RAISE(auto match, function.target.FindOne(*input_schema));
+      target_ids.push_back(match[0]);
+      const auto& target_type = input_schema->field(match[0])->type();
+
+      if (kind == WindowFunctionKind::LAG || kind == WindowFunctionKind::LEAD) {
+        if (function.offset < 0) {
+          return Status::Invalid("Window function '", function.function,
+                                 "' offset cannot be negative");
+        }
+        output_fields.push_back(field(function.name, target_type));
+        continue;
+      }
+
+      DCHECK(IsFrameFunction(kind));
+      const WindowFrame& frame = function.frame;
+      if (frame.preceding < WindowFrame::kUnbounded ||
+          frame.following < WindowFrame::kUnbounded) {
+        return Status::Invalid("Window frame bounds must be non-negative or kUnbounded");
+      }
+      if (IsRangeOffsetFrame(frame)) {
+        if (order_key_ids.size() != 1) {
+          return Status::Invalid(
+              "RANGE window frames with offsets require exactly one order key");
+        }
+        const auto& key_type = input_schema->field(order_key_ids[0])->type();
+        if (!is_integer(key_type->id()) && !is_floating(key_type->id()) &&
+            !IsTemporal(key_type->id())) {
+          return Status::TypeError(
+              "RANGE window frames with offsets require a numeric or temporal order key, "
+              "got ",
+              key_type->ToString());
+        }
+      }
+      std::shared_ptr<DataType> out_type = int64();
+      if (kind != WindowFunctionKind::COUNT) {
+        ARROW_ASSIGN_OR_RAISE(auto acc_type,
+                              AccumulatorType(function.function, *target_type));
+        if (kind == WindowFunctionKind::SUM) {
+          out_type = std::move(acc_type);
+        } else if (kind == WindowFunctionKind::MEAN) {
+          out_type = float64();
+        } else {
+          out_type = target_type;
+        }
+      }
+      output_fields.push_back(field(function.name, std::move(out_type)));
+    }
+
+    return plan->EmplaceNode<WindowNode>(
+        input, schema(std::move(output_fields)), std::move(partition_key_ids),
+        std::move(order_key_ids), std::move(sort_orders), window_options.functions,
+        std::move(kinds), std::move(target_ids));
+  }
+
+  const char* kind_name() const override { return "WindowNode"; }
+
+  void InputReceived(ExecNode* input, ExecBatch batch) override {
+    EVENT(span_, "InputReceived", {{"batch.length", batch.length}});
+    DCHECK_EQ(input, inputs_[0]);
+
+    // bail if StopProducing was called
+    if (finished_.is_finished()) return;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      batches_.push_back(std::move(batch));
+    }
+
+    if (input_counter_.Increment()) {
+      ErrorIfNotOk(OutputResult());
+    }
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    EVENT(span_, "ErrorReceived", {{"error", error.message()}});
+    DCHECK_EQ(input, inputs_[0]);
+    outputs_[0]->ErrorReceived(this, std::move(error));
+  }
+
+  void InputFinished(ExecNode* input, int total_batches) override {
+    EVENT(span_, "InputFinished", {{"batches.length", total_batches}});
+    DCHECK_EQ(input, inputs_[0]);
+
+    // bail if StopProducing was called
+    if (finished_.is_finished()) return;
+
+    if (input_counter_.SetTotal(total_batches)) {
+      ErrorIfNotOk(OutputResult());
+    }
+  }
+
+  Status StartProducing() override {
+    START_COMPUTE_SPAN(span_, std::string(kind_name()) + ":" + label(),
+                       {{"node.label", label()},
+                        {"node.detail", ToString()},
+                        {"node.kind", kind_name()}});
+    finished_ = Future<>::Make();
+    END_SPAN_ON_FUTURE_COMPLETION(span_, finished_, this);
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    // All input has to be accumulated before any output is produced
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    // All input has to be accumulated before any output is produced
+  }
+
+  void StopProducing(ExecNode* output) override {
+    EVENT(span_, "StopProducing");
+    DCHECK_EQ(output, outputs_[0]);
+
+    ARROW_UNUSED(input_counter_.Cancel());
+    if (output_counter_.Cancel()) {
+      finished_.MarkFinished();
+    }
+    inputs_[0]->StopProducing(this);
+  }
+
+  void StopProducing() override { StopProducing(outputs_[0]); }
+
+  Future<> finished() override { return finished_; }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    const auto& input_schema = inputs_[0]->output_schema();
+    ss << "partition_keys=[";
+    for (size_t i = 0; i < partition_key_ids_.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << '"' << input_schema->field(partition_key_ids_[i])->name() << '"';
+    }
+    ss << "], order_by=[";
+    for (size_t i = 0; i < order_key_ids_.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << '"' << input_schema->field(order_key_ids_[i])->name() << '"'
+         << (sort_orders_[i] == SortOrder::Descending ? " DESC" : " ASC");
+    }
+    ss << "], functions=[";
+    for (size_t i = 0; i < functions_.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << functions_[i].function << '(';
+      if (target_ids_[i] >= 0) ss << input_schema->field(target_ids_[i])->name();
+      ss << ')';
+    }
+    ss << ']';
+    return ss.str();
+  }
+
+ private:
+  int output_batch_size() {
+    int result = static_cast<int>(plan()->exec_context()->exec_chunksize());
+    if (result < 0) {
+      result = 32 * 1024;
+    }
+    return result;
+  }
+
+  // Sort the accumulated rows by partition and order keys and find the partition and
+  // peer group boundaries
+  Status SortInput(ArrayVector* columns, SortedLayout* layout) {
+    ExecContext* ctx = plan()->exec_context();
+    const int64_t num_rows = columns->empty() ? 0 : (*columns)[0]->length();
+
+    // Partition ids are assigned in order of first appearance by the Grouper
+    ArrayVector sort_columns;
+    FieldVector sort_fields;
+    std::vector<SortKey> sort_keys;
+    std::shared_ptr<Array> partition_ids;
+    if (!partition_key_ids_.empty()) {
+      std::vector<ValueDescr> key_descrs;
+      std::vector<Datum> key_values;
+      for (int id : partition_key_ids_) {
+        key_descrs.emplace_back((*columns)[id]->type(), ValueDescr::ARRAY);
+        key_values.emplace_back((*columns)[id]);
+      }
+      ARROW_ASSIGN_OR_RAISE(auto grouper, Grouper::Make(key_descrs, ctx));
+      ARROW_ASSIGN_OR_RAISE(Datum ids,
+                            grouper->Consume(ExecBatch(std::move(key_values), num_rows)));
+      partition_ids = ids.make_array();
+      sort_keys.emplace_back(FieldRef(static_cast<int>(sort_columns.size())));
+      sort_fields.push_back(field("partition", partition_ids->type()));
+      sort_columns.push_back(partition_ids);
+    }
+    for (size_t i = 0; i < order_key_ids_.size(); ++i) {
+      const auto& column = (*columns)[order_key_ids_[i]];
+      sort_keys.emplace_back(FieldRef(static_cast<int>(sort_columns.size())),
+                             sort_orders_[i]);
+      sort_fields.push_back(field("key" + std::to_string(i), column->type()));
+      sort_columns.push_back(column);
+    }
+
+    std::shared_ptr<Array> partition_ids_sorted = partition_ids;
+    if (!sort_keys.empty() && num_rows > 0) {
+      auto sort_batch = RecordBatch::Make(schema(std::move(sort_fields)), num_rows,
+                                          std::move(sort_columns));
+      ARROW_ASSIGN_OR_RAISE(
+          auto indices,
+          SortIndices(Datum(sort_batch), SortOptions(std::move(sort_keys)), ctx));
+      for (auto& column : *columns) {
+        ARROW_ASSIGN_OR_RAISE(Datum sorted, Take(column, indices,
+                                                 TakeOptions::NoBoundsCheck(), ctx));
+        column = sorted.make_array();
+      }
+      if (partition_ids) {
+        ARROW_ASSIGN_OR_RAISE(Datum sorted, Take(partition_ids, indices,
+                                                 TakeOptions::NoBoundsCheck(), ctx));
+        partition_ids_sorted = sorted.make_array();
+      }
+    }
+
+    // Peer groups are runs of rows with equal order keys in the sorted rows
+    std::shared_ptr<Array> peer_ids;
+    if (!order_key_ids_.empty()) {
+      std::vector<ValueDescr> key_descrs;
+      std::vector<Datum> key_values;
+      for (int id : order_key_ids_) {
+        key_descrs.emplace_back((*columns)[id]->type(), ValueDescr::ARRAY);
+        key_values.emplace_back((*columns)[id]);
+      }
+      ARROW_ASSIGN_OR_RAISE(auto grouper, Grouper::Make(key_descrs, ctx));
+      ARROW_ASSIGN_OR_RAISE(Datum ids,
+                            grouper->Consume(ExecBatch(std::move(key_values), num_rows)));
+      peer_ids = ids.make_array();
+    }
+
+    const uint32_t* partitions =
+        partition_ids_sorted ? partition_ids_sorted->data()->GetValues<uint32_t>(1)
+                             : NULLPTR;
+    const uint32_t* peers = peer_ids ? peer_ids->data()->GetValues<uint32_t>(1) : NULLPTR;
+    layout->partition_begin.resize(num_rows);
+    layout->partition_end.resize(num_rows);
+    layout->peer_begin.resize(num_rows);
+    layout->peer_end.resize(num_rows);
+    int64_t partition_begin = 0;
+    int64_t peer_begin = 0;
+    for (int64_t i = 0; i <= num_rows; ++i) {
+      const bool new_partition =
+          i == num_rows || (partitions && partitions[i] != partitions[i - 1]);
+      const bool new_peer_group =
+          new_partition || (peers && i > 0 && peers[i] != peers[i - 1]);
+      if (i > 0 && new_peer_group) {
+        for (int64_t j = peer_begin; j < i; ++j) layout->peer_end[j] = i;
+        peer_begin = i;
+      }
+      if (i > 0 && new_partition) {
+        for (int64_t j = partition_begin; j < i; ++j) layout->partition_end[j] = i;
+        partition_begin = i;
+      }
+      if (i < num_rows) {
+        layout->partition_begin[i] = partition_begin;
+        layout->peer_begin[i] = peer_begin;
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Array>> ComputeRanking(WindowFunctionKind kind,
+                                                const SortedLayout& layout) {
+    const int64_t num_rows = static_cast<int64_t>(layout.partition_begin.size());
+    Int64Builder builder(plan()->exec_context()->memory_pool());
+    RETURN_NOT_OK(builder.Reserve(num_rows));
+    int64_t dense_rank = 0;
+    for (int64_t i = 0; i < num_rows; ++i) {
+      if (i == layout.partition_begin[i]) dense_rank = 0;
+      if (i == layout.peer_begin[i]) ++dense_rank;
+      switch (kind) {
+        case WindowFunctionKind::ROW_NUMBER:
+          builder.UnsafeAppend(i - layout.partition_begin[i] + 1);
+          break;
+        case WindowFunctionKind::RANK:
+          builder.UnsafeAppend(layout.peer_begin[i] - layout.partition_begin[i] + 1);
+          break;
+        default:
+          builder.UnsafeAppend(dense_rank);
+          break;
+      }
+    }
+    return builder.Finish();
+  }
+
+  Result<std::shared_ptr<Array>> ComputeOffset(WindowFunctionKind kind, int64_t offset,
+                                               const std::shared_ptr<Array>& values,
+                                               const SortedLayout& layout) {
+    ExecContext* ctx = plan()->exec_context();
+    const int64_t num_rows = values->length();
+    Int64Builder indices(ctx->memory_pool());
+    RETURN_NOT_OK(indices.Reserve(num_rows));
+    for (int64_t i = 0; i < num_rows; ++i) {
+      const int64_t source = kind == WindowFunctionKind::LAG ? i - offset : i + offset;
+      if (source >= layout.partition_begin[i] && source < layout.partition_end[i]) {
+        indices.UnsafeAppend(source);
+      } else {
+        indices.UnsafeAppendNull();
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto index_array, indices.Finish());
+    ARROW_ASSIGN_OR_RAISE(Datum out, Take(values, index_array,
+                                          TakeOptions::NoBoundsCheck(), ctx));
+    return out.make_array();
+  }
+
+  // Convert the order key of a RANGE frame to int64 or double values
+  Result<std::shared_ptr<Array>> RangeKeyValues(const Array& key) {
+    ExecContext* ctx = plan()->exec_context();
+    if (is_floating(key.type_id())) {
+      return Cast(key, float64(), CastOptions::Safe(), ctx);
+    }
+    if (IsTemporal(key.type_id())) {
+      // Distances are measured in the unit of the temporal type
+      const int bit_width = checked_cast<const FixedWidthType&>(*key.type()).bit_width();
+      ARROW_ASSIGN_OR_RAISE(auto storage, key.View(bit_width == 32 ? int32() : int64()));
+      return Cast(*storage, int64(), CastOptions::Safe(), ctx);
+    }
+    return Cast(key, int64(), CastOptions::Safe(), ctx);
+  }
+
+  Result<std::shared_ptr<Array>> ComputeAggregate(const WindowFunction& function,
+                                                  WindowFunctionKind kind,
+                                                  const std::shared_ptr<Array>& values,
+                                                  const ArrayVector& columns,
+                                                  const SortedLayout& layout) {
+    ExecContext* ctx = plan()->exec_context();
+    std::shared_ptr<Array> range_key;
+    bool descending = false;
+    if (IsRangeOffsetFrame(function.frame)) {
+      ARROW_ASSIGN_OR_RAISE(range_key, RangeKeyValues(*columns[order_key_ids_[0]]));
+      descending = sort_orders_[0] == SortOrder::Descending;
+    }
+    std::vector<int64_t> lo, hi;
+    RETURN_NOT_OK(ComputeFrames(function.frame, layout, range_key, descending, &lo, &hi));
+
+    if (kind == WindowFunctionKind::COUNT) {
+      // Only validity matters, any physical type will do
+      return ComputeFrameAggregate<int64_t>(kind, *values, lo, hi, ctx->memory_pool());
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto acc_type, AccumulatorType(function.function,
+                                                         *values->type()));
+    ARROW_ASSIGN_OR_RAISE(auto acc_values, Cast(*values, acc_type, CastOptions::Safe(),
+                                                ctx));
+    std::shared_ptr<Array> out;
+    if (acc_type->id() == Type::INT64) {
+      ARROW_ASSIGN_OR_RAISE(out, ComputeFrameAggregate<int64_t>(kind, *acc_values, lo, hi,
+                                                                ctx->memory_pool()));
+    } else if (acc_type->id() == Type::UINT64) {
+      ARROW_ASSIGN_OR_RAISE(out, ComputeFrameAggregate<uint64_t>(
+                                     kind, *acc_values, lo, hi, ctx->memory_pool()));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(out, ComputeFrameAggregate<double>(kind, *acc_values, lo, hi,
+                                                               ctx->memory_pool()));
+    }
+    if (kind == WindowFunctionKind::MIN || kind == WindowFunctionKind::MAX) {
+      // Extrema are input values, converting them back is lossless
+      ARROW_ASSIGN_OR_RAISE(out, Cast(*out, values->type(), CastOptions::Unsafe(), ctx));
+    }
+    return out;
+  }
+
+  Result<ExecBatch> ComputeWindows() {
+    util::tracing::Span span;
+    START_COMPUTE_SPAN(span, "ComputeWindows",
+                       {{"window", ToStringExtra()}, {"node.label", label()}});
+    ExecContext* ctx = plan()->exec_context();
+    const auto& input_schema = inputs_[0]->output_schema();
+
+    ArrayVector columns;
+    int64_t num_rows = 0;
+    for (const ExecBatch& batch : batches_) {
+      num_rows += batch.length;
+    }
+    for (int i = 0; i < input_schema->num_fields(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto column,
+                            ConcatenateColumn(batches_, i, input_schema->field(i)->type(),
+                                              ctx->memory_pool()));
+      columns.push_back(std::move(column));
+    }
+    batches_.clear();
+
+    SortedLayout layout;
+    RETURN_NOT_OK(SortInput(&columns, &layout));
+
+    std::vector<Datum> out_values(columns.begin(), columns.end());
+    for (size_t i = 0; i < functions_.size(); ++i) {
+      std::shared_ptr<Array> out;
+      if (IsRankingFunction(kinds_[i])) {
+        ARROW_ASSIGN_OR_RAISE(out, ComputeRanking(kinds_[i], layout));
+      } else if (IsFrameFunction(kinds_[i])) {
+        ARROW_ASSIGN_OR_RAISE(out, ComputeAggregate(functions_[i], kinds_[i],
+                                                    columns[target_ids_[i]], columns,
+                                                    layout));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(out, ComputeOffset(kinds_[i], functions_[i].offset,
+                                                 columns[target_ids_[i]], layout));
+      }
+      out_values.emplace_back(std::move(out));
+    }
+    return ExecBatch(std::move(out_values), num_rows);
+  }
+
+  Status OutputResult() {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch out_data, ComputeWindows());
+
+    const int64_t batch_size = output_batch_size();
+    const int num_output_batches =
+        static_cast<int>(bit_util::CeilDiv(out_data.length, batch_size));
+    outputs_[0]->InputFinished(this, num_output_batches);
+    for (int i = 0; i < num_output_batches; ++i) {
+      // bail if StopProducing was called
+      if (finished_.is_finished()) return Status::OK();
+      EmitBatch(out_data.Slice(batch_size * i, batch_size));
+      ARROW_UNUSED(output_counter_.Increment());
+    }
+    if (output_counter_.SetTotal(num_output_batches)) {
+      finished_.MarkFinished();
+    }
+    return Status::OK();
+  }
+
+  const std::vector<int> partition_key_ids_;
+  const std::vector<int> order_key_ids_;
+  const std::vector<SortOrder> sort_orders_;
+  const std::vector<WindowFunction> functions_;
+  const std::vector<WindowFunctionKind> kinds_;
+  const std::vector<int> target_ids_;
+
+  std::mutex mutex_;
+  std::vector<ExecBatch> batches_;
+
+  AtomicCounter input_counter_, output_counter_;
+  Future<> finished_ = Future<>::MakeFinished();
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterWindowNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory("window", WindowNode::Make));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
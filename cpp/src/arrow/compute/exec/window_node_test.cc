@@ -0,0 +1,265 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "arrow/api.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/matchers.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/make_unique.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+Result<std::shared_ptr<Table>> RunWindow(const BatchesWithSchema& input,
+                                         WindowNodeOptions options) {
+  ExecContext exec_ctx(default_memory_pool(), nullptr);
+  ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make(&exec_ctx));
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+  ARROW_RETURN_NOT_OK(
+      Declaration::Sequence(
+          {{"source", SourceNodeOptions{input.schema, input.gen(/*parallel=*/false,
+                                                                /*slow=*/false)}},
+           {"window", std::move(options)},
+           {"sink", SinkNodeOptions{&sink_gen}}})
+          .AddToPlan(plan.get()));
+  auto output_schema = plan->sinks()[0]->inputs()[0]->output_schema();
+  auto collected = StartAndCollect(plan.get(), sink_gen).result();
+  ARROW_RETURN_NOT_OK(collected.status());
+  return TableFromExecBatches(output_schema, *collected);
+}
+
+void CheckWindow(const BatchesWithSchema& input, WindowNodeOptions options,
+                 const std::shared_ptr<Schema>& expected_schema,
+                 const std::string& expected_json) {
+  ASSERT_OK_AND_ASSIGN(auto actual, RunWindow(input, std::move(options)));
+  ASSERT_OK_AND_ASSIGN(auto combined, actual->CombineChunks());
+  auto expected = TableFromJSON(expected_schema, {expected_json});
+  AssertSchemaEqual(*expected_schema, *combined->schema());
+  AssertTablesEqual(*expected, *combined, /*same_chunk_layout=*/false);
+}
+
+TEST(WindowNode, Basic) {
+  auto input_schema =
+      schema({field("p", int32()), field("t", int64()), field("v", int64())});
+  auto input = MakeBatchesFromString(input_schema, {R"([[1, 1, 10], [2, 5, 1],
+                                                        [1, 3, 30]])",
+                                                    R"([[1, 3, 30], [2, 4, null],
+                                                        [1, 6, 60], [2, 7, 3]])"});
+  WindowNodeOptions options(
+      {{"row_number", {}, "row_number"},
+       {"rank", {}, "rank"},
+       {"dense_rank", {}, "dense_rank"},
+       {"sum", "v", "running_sum"},
+       {"sum", "v", "rows_sum", WindowFrame(WindowFrame::ROWS, 1, 1)},
+       {"sum", "v", "range_sum", WindowFrame(WindowFrame::RANGE, 2, 0)},
+       {"max", "v", "rows_max", WindowFrame(WindowFrame::ROWS, 1, 0)},
+       {"min", "v", "partition_min",
+        WindowFrame(WindowFrame::RANGE, WindowFrame::kUnbounded,
+                    WindowFrame::kUnbounded)},
+       {"count", "v", "rows_count", WindowFrame(WindowFrame::ROWS)},
+       {"mean", "v", "range_mean", WindowFrame(WindowFrame::RANGE, 1, 1)},
+       {"lag", "v", "lag"},
+       {"lead", "v", "lead2", WindowFrame(), 2}},
+      {"p"}, {SortKey("t")});
+  auto expected_schema = schema(
+      {field("p", int32()), field("t", int64()), field("v", int64()),
+       field("row_number", int64()), field("rank", int64()), field("dense_rank", int64()),
+       field("running_sum", int64()), field("rows_sum", int64()),
+       field("range_sum", int64()), field("rows_max", int64()),
+       field("partition_min", int64()), field("rows_count", int64()),
+       field("range_mean", float64()), field("lag", int64()), field("lead2", int64())});
+  CheckWindow(input, std::move(options), expected_schema, R"([
+    [1, 1, 10,   1, 1, 1, 10,   40,  10,   10,   10, 1, 10.0, null, 30],
+    [1, 3, 30,   2, 2, 2, 70,   70,  70,   30,   10, 2, 30.0, 10,   60],
+    [1, 3, 30,   3, 2, 2, 70,   120, 70,   30,   10, 3, 30.0, 30,   null],
+    [1, 6, 60,   4, 4, 3, 130,  90,  60,   60,   10, 4, 60.0, 30,   null],
+    [2, 4, null, 1, 1, 1, null, 1,   null, null, 1,  0, 1.0,  null, 3],
+    [2, 5, 1,    2, 2, 2, 1,    4,   1,    1,    1,  1, 1.0,  null, null],
+    [2, 7, 3,    3, 3, 3, 4,    4,   4,    3,    1,  2, 3.0,  1,    null]
+  ])");
+}
+
+TEST(WindowNode, DescendingRangeWithNulls) {
+  auto input_schema = schema({field("t", int32()), field("v", float64())});
+  auto input = MakeBatchesFromString(
+      input_schema,
+      {R"([[2, 2.0], [null, 100.0], [5, 5.0]])", R"([[1, 1.0], [4, 4.0]])"});
+  WindowNodeOptions options(
+      {{"row_number", {}, "row_number"},
+       {"sum", "v", "range_sum", WindowFrame(WindowFrame::RANGE, 1, 0)},
+       {"max", "v", "range_max", WindowFrame(WindowFrame::RANGE, 0, 3)}},
+      /*partition_keys=*/{}, {SortKey("t", SortOrder::Descending)});
+  auto expected_schema =
+      schema({field("t", int32()), field("v", float64()), field("row_number", int64()),
+              field("range_sum", float64()), field("range_max", float64())});
+  CheckWindow(input, std::move(options), expected_schema, R"([
+    [5,    5.0,   1, 5.0,   5.0],
+    [4,    4.0,   2, 9.0,   4.0],
+    [2,    2.0,   3, 2.0,   2.0],
+    [1,    1.0,   4, 3.0,   1.0],
+    [null, 100.0, 5, 100.0, 100.0]
+  ])");
+}
+
+TEST(WindowNode, Unordered) {
+  // Without order keys all rows of a partition are peers
+  auto input_schema = schema({field("p", utf8()), field("v", uint8())});
+  auto input = MakeBatchesFromString(
+      input_schema, {R"([["a", 1], ["b", 2]])", R"([["a", 3], ["b", null]])"});
+  WindowNodeOptions options({{"rank", {}, "rank"},
+                             {"sum", "v", "sum"},
+                             {"count", "v", "count"},
+                             {"min", "v", "min"}},
+                            {"p"});
+  auto expected_schema =
+      schema({field("p", utf8()), field("v", uint8()), field("rank", int64()),
+              field("sum", uint64()), field("count", int64()), field("min", uint8())});
+  ASSERT_OK_AND_ASSIGN(auto actual, RunWindow(input, std::move(options)));
+  AssertSchemaEqual(*expected_schema, *actual->schema());
+  ASSERT_OK_AND_ASSIGN(auto sorted, SortTableOnAllFields(actual));
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       SortTableOnAllFields(TableFromJSON(expected_schema, {R"([
+    ["a", 1,    1, 4, 2, 1],
+    ["a", 3,    1, 4, 2, 1],
+    ["b", 2,    1, 2, 1, 2],
+    ["b", null, 1, 2, 1, 2]
+  ])"})));
+  AssertTablesEqual(*expected, *sorted, /*same_chunk_layout=*/false);
+}
+
+TEST(WindowNode, SlidingFramesMatchNaive) {
+  constexpr int kNumRows = 500;
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> partition_dist(0, 3);
+  std::uniform_int_distribution<int> time_dist(0, 60);
+  std::uniform_int_distribution<int> value_dist(-100, 100);
+  Int32Builder p_builder, t_builder, v_builder;
+  for (int i = 0; i < kNumRows; ++i) {
+    ASSERT_OK(p_builder.Append(partition_dist(gen)));
+    ASSERT_OK(t_builder.Append(time_dist(gen)));
+    if (i % 7 == 0) {
+      ASSERT_OK(v_builder.AppendNull());
+    } else {
+      ASSERT_OK(v_builder.Append(value_dist(gen)));
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto p, p_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto t, t_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto v, v_builder.Finish());
+  auto input_schema =
+      schema({field("p", int32()), field("t", int32()), field("v", int32())});
+  BatchesWithSchema input;
+  input.schema = input_schema;
+  for (int64_t offset = 0; offset < kNumRows; offset += 64) {
+    input.batches.push_back(ExecBatch(
+        {p->Slice(offset, 64), t->Slice(offset, 64), v->Slice(offset, 64)},
+        std::min<int64_t>(64, kNumRows - offset)));
+  }
+
+  const std::vector<WindowFrame> frames = {
+      WindowFrame(WindowFrame::ROWS, 3, 2), WindowFrame(WindowFrame::ROWS, 0, 5),
+      WindowFrame(WindowFrame::RANGE, 5, 2), WindowFrame(WindowFrame::RANGE, 0, 4),
+      WindowFrame(WindowFrame::RANGE, WindowFrame::kUnbounded, 3)};
+  std::vector<WindowFunction> functions;
+  for (size_t i = 0; i < frames.size(); ++i) {
+    for (std::string function : {"sum", "min", "max", "count"}) {
+      functions.emplace_back(function, "v", function + std::to_string(i), frames[i]);
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(
+      auto table, RunWindow(input, WindowNodeOptions(functions, {"p"}, {SortKey("t")})));
+  ASSERT_OK_AND_ASSIGN(table, table->CombineChunks());
+  ASSERT_EQ(table->num_rows(), kNumRows);
+
+  auto column = [&](int i) { return table->column(i)->chunk(0); };
+  const auto& out_p = checked_cast<const Int32Array&>(*column(0));
+  const auto& out_t = checked_cast<const Int32Array&>(*column(1));
+  const auto& out_v = checked_cast<const Int32Array&>(*column(2));
+
+  for (size_t f = 0; f < functions.size(); ++f) {
+    const WindowFrame& frame = functions[f].frame;
+    const std::string& name = functions[f].function;
+    auto result = column(3 + static_cast<int>(f));
+    for (int64_t i = 0; i < kNumRows; ++i) {
+      // Frame of row i by definition, over the rows of its partition
+      int64_t count = 0, sum = 0, min = 1000, max = -1000;
+      for (int64_t j = 0; j < kNumRows; ++j) {
+        if (out_p.Value(j) != out_p.Value(i)) continue;
+        bool in_frame;
+        if (frame.units == WindowFrame::ROWS) {
+          in_frame = (frame.preceding == WindowFrame::kUnbounded ||
+                      j >= i - frame.preceding) &&
+                     j <= i + frame.following;
+        } else {
+          const int64_t distance = out_t.Value(j) - out_t.Value(i);
+          in_frame = (frame.preceding == WindowFrame::kUnbounded ||
+                      distance >= -frame.preceding) &&
+                     distance <= frame.following;
+        }
+        if (!in_frame || out_v.IsNull(j)) continue;
+        ++count;
+        sum += out_v.Value(j);
+        min = std::min<int64_t>(min, out_v.Value(j));
+        max = std::max<int64_t>(max, out_v.Value(j));
+      }
+      ASSERT_OK_AND_ASSIGN(auto scalar, result->GetScalar(i));
+      if (name == "count") {
+        ASSERT_EQ(checked_cast<const Int64Scalar&>(*scalar).value, count);
+      } else if (count == 0) {
+        ASSERT_FALSE(scalar->is_valid) << name << " row " << i;
+      } else {
+        ASSERT_TRUE(scalar->is_valid) << name << " row " << i;
+        int64_t value = name == "sum" ? sum : (name == "min" ? min : max);
+        ASSERT_OK_AND_ASSIGN(auto expected, MakeScalar(int64(), value));
+        ASSERT_OK_AND_ASSIGN(expected, expected->CastTo(scalar->type));
+        ASSERT_TRUE(scalar->Equals(*expected))
+            << name << " row " << i << ": " << scalar->ToString()
+            << " != " << expected->ToString();
+      }
+    }
+  }
+}
+
+TEST(WindowNode, Errors) {
+  auto input_schema =
+      schema({field("p", int32()), field("t", int64()), field("s", utf8())});
+  auto input = MakeBatchesFromString(input_schema, {R"([[1, 1, "a"]])"});
+  const WindowFrame range_frame(WindowFrame::RANGE, 2);
+  ASSERT_RAISES(Invalid, RunWindow(input, WindowNodeOptions({{"median", "t", "m"}})));
+  ASSERT_RAISES(TypeError, RunWindow(input, WindowNodeOptions({{"sum", "s", "sum"}})));
+  // RANGE offsets need a single numeric order key
+  ASSERT_RAISES(Invalid,
+                RunWindow(input, WindowNodeOptions({{"sum", "t", "sum", range_frame}})));
+  ASSERT_RAISES(TypeError, RunWindow(input, WindowNodeOptions(
+                                                {{"sum", "t", "sum", range_frame}},
+                                                /*partition_keys=*/{}, {SortKey("s")})));
+  ASSERT_RAISES(Invalid, RunWindow(input, WindowNodeOptions(
+                                              {{"lag", "t", "lag", WindowFrame(), -1}})));
+}
+
+}  // namespace compute
+}  // namespace arrow
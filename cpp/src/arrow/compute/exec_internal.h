@@ -28,6 +28,8 @@
 #include "arrow/compute/exec.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/status.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -179,6 +181,12 @@ class ARROW_EXPORT KernelExecutor {
   static std::unique_ptr<KernelExecutor> MakeScalarAggregate();
 };
 
+/// \brief Execute a batch, recording the KernelMetrics of the kernel if enabled
+ARROW_EXPORT
+Status ExecuteKernel(KernelExecutor* executor, const std::string& function_name,
+                     const Kernel& kernel, const ExecBatch& batch,
+                     ExecListener* listener);
+
 int64_t InferBatchLength(const std::vector<Datum>& values, bool* all_same);
 
 /// \brief Populate validity bitmap with the intersection of the nullity of the
@@ -196,6 +204,30 @@ Status PropagateNulls(KernelContext* ctx, const ExecSpan& batch, ArrayData* out)
 ARROW_EXPORT
 void PropagateNullsSpans(const ExecSpan& batch, ArraySpan* out);
 
+/// \brief Call `func(i, task_ctx)` for each i in [0, num_tasks), in parallel
+/// if ExecContext::parallelize_chunks() and ExecContext::use_threads() are
+/// enabled, else in sequence with `task_ctx == ctx`.
+///
+/// When running in parallel, `task_ctx` has parallelize_chunks() disabled, so
+/// that nested function calls don't block thread pool tasks.
+template <typename Function>
+Status ParallelForChunks(ExecContext* ctx, int num_tasks, Function&& func) {
+  if (!ctx->parallelize_chunks() || !ctx->use_threads() || num_tasks <= 1) {
+    for (int i = 0; i < num_tasks; ++i) {
+      RETURN_NOT_OK(func(i, ctx));
+    }
+    return Status::OK();
+  }
+  ExecContext task_ctx = *ctx;
+  task_ctx.set_parallelize_chunks(false);
+  ::arrow::internal::Executor* executor = ctx->executor();
+  if (executor == NULLPTR) {
+    executor = ::arrow::internal::GetCpuThreadPool();
+  }
+  return ::arrow::internal::ParallelFor(
+      num_tasks, [&](int i) { return func(i, &task_ctx); }, executor);
+}
+
 }  // namespace detail
 }  // namespace compute
 }  // namespace arrow
@@ -35,6 +35,7 @@
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/registry.h"
 #include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
 #include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
@@ -90,6 +91,52 @@ TEST(SelectionVector, Basics) {
   ASSERT_EQ(3, sel_vector->indices()[1]);
 }
 
+TEST(SelectionVector, FromMask) {
+  auto mask = ArrayFromJSON(boolean(), "[true, false, null, true, true, false, true]");
+  const auto& bool_mask = checked_cast<const BooleanArray&>(*mask);
+  ASSERT_OK_AND_ASSIGN(auto sel_vector, SelectionVector::FromMask(bool_mask));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 3, 4, 6]"),
+                    *MakeArray(sel_vector->data()));
+
+  ASSERT_OK_AND_ASSIGN(sel_vector, SelectionVector::FromMask(BooleanArray(
+                                       bool_mask.Slice(2)->data())));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2, 4]"), *MakeArray(sel_vector->data()));
+}
+
+TEST(ExecBatch, ApplySelection) {
+  ExecBatch batch({ArrayFromJSON(int32(), "[1, 2, 3, 4]"),
+                   ArrayFromJSON(utf8(), R"(["a", "b", "c", "d"])"),
+                   MakeScalar(int64_t(7))},
+                  /*length=*/4);
+  batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[0, 2, 3]"));
+  batch.length = 3;
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch selected, batch.ApplySelection());
+  ASSERT_EQ(selected.selection_vector, nullptr);
+  ASSERT_EQ(selected.length, 3);
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[1, 3, 4]"), selected[0]);
+  AssertDatumsEqual(ArrayFromJSON(utf8(), R"(["a", "c", "d"])"), selected[1]);
+  AssertDatumsEqual(MakeScalar(int64_t(7)), selected[2]);
+
+  // Unselected columns are replaced by null scalars
+  ASSERT_OK_AND_ASSIGN(selected, batch.ApplySelection({false, true, false}));
+  AssertDatumsEqual(MakeNullScalar(int32()), selected[0]);
+  AssertDatumsEqual(ArrayFromJSON(utf8(), R"(["a", "c", "d"])"), selected[1]);
+
+  // Slicing slices the selection
+  ExecBatch sliced = batch.Slice(1, 5);
+  ASSERT_EQ(sliced.length, 2);
+  ASSERT_OK_AND_ASSIGN(selected, sliced.ApplySelection());
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[3, 4]"), selected[0]);
+
+  auto batch_schema =
+      schema({field("i", int32()), field("s", utf8()), field("l", int64())});
+  ASSERT_OK_AND_ASSIGN(auto record_batch, batch.ToRecordBatch(batch_schema));
+  ASSERT_EQ(record_batch->num_rows(), 3);
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[7, 7, 7]"), *record_batch->column(2));
+}
+
 void AssertValidityZeroExtraBits(const uint8_t* data, int64_t length, int64_t offset) {
   const int64_t bit_extent = ((offset + length + 7) / 8) * 8;
   for (int64_t i = offset + length; i < bit_extent; ++i) {
@@ -1280,6 +1327,37 @@ TEST_F(TestCallScalarFunction, ScalarFunction) {
   ASSERT_TRUE(expected->Equals(*result.scalar()));
 }
 
+TEST_F(TestCallScalarFunction, FunctionMetrics) {
+  auto input = ArrayFromJSON(int32(), "[1, 2, 3, null, 5]");
+  ExampleOptions options(std::make_shared<Int32Scalar>(2));
+  ResetFunctionMetrics();
+
+  ASSERT_FALSE(FunctionMetricsEnabled());
+  ASSERT_OK(CallFunction("test_stateful", {input}, &options));
+  ASSERT_TRUE(GetFunctionMetrics().empty());
+
+  SetFunctionMetricsEnabled(true);
+  ASSERT_OK(CallFunction("test_stateful", {input}, &options));
+  ASSERT_OK(CallFunction("test_stateful", {input->Slice(1)}, &options));
+  SetFunctionMetricsEnabled(false);
+
+  ASSERT_OK_AND_ASSIGN(auto function,
+                       GetFunctionRegistry()->GetFunction("test_stateful"));
+  ASSERT_OK_AND_ASSIGN(const Kernel* kernel, function->DispatchExact({int32()}));
+  auto metrics = GetFunctionMetrics();
+  ASSERT_EQ(metrics.size(), 1);
+  ASSERT_EQ(metrics[0].function_name, "test_stateful");
+  ASSERT_EQ(metrics[0].kernel_signature, kernel->signature->ToString());
+  ASSERT_EQ(metrics[0].simd_level, kernel->simd_level);
+  ASSERT_EQ(metrics[0].calls, 2);
+  ASSERT_EQ(metrics[0].rows, 9);
+  ASSERT_EQ(metrics[0].bytes, 2 * Datum(input).TotalBufferSize());
+  ASSERT_GE(metrics[0].nanoseconds, 0);
+
+  ResetFunctionMetrics();
+  ASSERT_TRUE(GetFunctionMetrics().empty());
+}
+
 }  // namespace detail
 }  // namespace compute
 }  // namespace arrow
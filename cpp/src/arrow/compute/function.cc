@@ -17,9 +17,15 @@
 
 #include "arrow/compute/function.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <sstream>
+#include <tuple>
+#include <unordered_map>
 
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/cast.h"
@@ -284,7 +290,7 @@ Result<Datum> Function::ExecuteInternal(const std::vector<Datum>& args,
       }
     }
   }
-  RETURN_NOT_OK(executor->Execute(input, &listener));
+  RETURN_NOT_OK(detail::ExecuteKernel(executor.get(), name_, *kernel, input, &listener));
   const auto out = executor->WrapResults(input.values, listener.values());
 #ifndef NDEBUG
   DCHECK_OK(executor->CheckResultType(out, name_.c_str()));
@@ -426,5 +432,103 @@ Result<Datum> MetaFunction::Execute(const ExecBatch& batch,
   return Execute(batch.values, options, ctx);
 }
 
+// ----------------------------------------------------------------------
+// Function metrics
+
+namespace {
+
+std::atomic<bool> g_function_metrics_enabled{false};
+
+// The metrics of the executed kernels, keyed by kernel: kernels are owned by a single
+// function
+class FunctionMetricsRegistry {
+ public:
+  static FunctionMetricsRegistry* GetInstance() {
+    static FunctionMetricsRegistry instance;
+    return &instance;
+  }
+
+  void Record(const std::string& function_name, const Kernel& kernel, int64_t rows,
+              int64_t bytes, int64_t nanoseconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = metrics_.find(&kernel);
+    if (it == metrics_.end()) {
+      KernelMetrics metrics;
+      metrics.function_name = function_name;
+      metrics.kernel_signature = kernel.signature->ToString();
+      metrics.simd_level = kernel.simd_level;
+      it = metrics_.emplace(&kernel, std::move(metrics)).first;
+    }
+    KernelMetrics& metrics = it->second;
+    ++metrics.calls;
+    metrics.rows += rows;
+    metrics.bytes += bytes;
+    metrics.nanoseconds += nanoseconds;
+  }
+
+  std::vector<KernelMetrics> Get() {
+    std::vector<KernelMetrics> out;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      out.reserve(metrics_.size());
+      for (const auto& entry : metrics_) {
+        out.push_back(entry.second);
+      }
+    }
+    std::sort(out.begin(), out.end(),
+              [](const KernelMetrics& left, const KernelMetrics& right) {
+                return std::tie(left.function_name, left.kernel_signature,
+                                left.simd_level) < std::tie(right.function_name,
+                                                            right.kernel_signature,
+                                                            right.simd_level);
+              });
+    return out;
+  }
+
+  void Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    metrics_.clear();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<const Kernel*, KernelMetrics> metrics_;
+};
+
+}  // namespace
+
+void SetFunctionMetricsEnabled(bool enabled) {
+  g_function_metrics_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool FunctionMetricsEnabled() {
+  return g_function_metrics_enabled.load(std::memory_order_relaxed);
+}
+
+std::vector<KernelMetrics> GetFunctionMetrics() {
+  return FunctionMetricsRegistry::GetInstance()->Get();
+}
+
+void ResetFunctionMetrics() { FunctionMetricsRegistry::GetInstance()->Reset(); }
+
+namespace detail {
+
+Status ExecuteKernel(KernelExecutor* executor, const std::string& function_name,
+                     const Kernel& kernel, const ExecBatch& batch,
+                     ExecListener* listener) {
+  if (!FunctionMetricsEnabled()) {
+    return executor->Execute(batch, listener);
+  }
+  const auto start = std::chrono::steady_clock::now();
+  Status status = executor->Execute(batch, listener);
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  FunctionMetricsRegistry::GetInstance()->Record(
+      function_name, kernel, batch.length, batch.TotalBufferSize(),
+      std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  return status;
+}
+
+}  // namespace detail
+
 }  // namespace compute
 }  // namespace arrow
@@ -411,5 +411,48 @@ class ARROW_EXPORT MetaFunction : public Function {
 
 /// @}
 
+/// \defgroup compute-function-metrics Execution metrics of compute functions
+///
+/// @{
+
+/// \brief Execution counters of a kernel of a compute function
+///
+/// Kernels are counted when executed by Function::Execute (and so by CallFunction) or
+/// by the evaluation of bound expressions, while SetFunctionMetricsEnabled(true) is in
+/// effect.
+struct ARROW_EXPORT KernelMetrics {
+  /// The name of the function
+  std::string function_name;
+  /// The signature of the kernel, as per KernelSignature::ToString
+  std::string kernel_signature;
+  /// The SIMD level the kernel was compiled for
+  SimdLevel::type simd_level = SimdLevel::NONE;
+  /// The number of executions
+  int64_t calls = 0;
+  /// The number of input rows
+  int64_t rows = 0;
+  /// The size of the input buffers, as per ExecBatch::TotalBufferSize
+  int64_t bytes = 0;
+  /// The wall clock time spent in the executions, in nanoseconds
+  int64_t nanoseconds = 0;
+};
+
+/// \brief Enable or disable the recording of KernelMetrics (disabled by default)
+///
+/// While disabled, the recording costs a relaxed atomic load per execution.
+ARROW_EXPORT void SetFunctionMetricsEnabled(bool enabled);
+
+/// \brief Whether KernelMetrics are recorded
+ARROW_EXPORT bool FunctionMetricsEnabled();
+
+/// \brief The metrics of the kernels executed since the last reset, ordered by
+/// function name and kernel signature
+ARROW_EXPORT std::vector<KernelMetrics> GetFunctionMetrics();
+
+/// \brief Clear the recorded metrics
+ARROW_EXPORT void ResetFunctionMetrics();
+
+/// @}
+
 }  // namespace compute
 }  // namespace arrow
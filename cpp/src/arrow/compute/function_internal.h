@@ -31,6 +31,7 @@
 #include "arrow/status.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/key_value_metadata.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/reflection_internal.h"
 #include "arrow/util/string.h"
 #include "arrow/util/visibility.h"
@@ -165,6 +166,11 @@ static inline std::string GenericToString(const Datum& value) {
   }
 }
 
+template <typename T>
+static inline std::string GenericToString(const util::optional<T>& value) {
+  return value.has_value() ? GenericToString(*value) : "<NULLOPT>";
+}
+
 template <typename T>
 static inline std::string GenericToString(const std::vector<T>& value) {
   std::stringstream ss;
@@ -232,6 +238,15 @@ static inline bool GenericEquals(const std::shared_ptr<const KeyValueMetadata>&
   return left->Equals(*right);
 }
 
+template <typename T>
+static inline bool GenericEquals(const util::optional<T>& left,
+                                 const util::optional<T>& right) {
+  if (left.has_value() && right.has_value()) {
+    return GenericEquals(*left, *right);
+  }
+  return left.has_value() == right.has_value();
+}
+
 template <typename T>
 static inline bool GenericEquals(const std::vector<T>& left,
                                  const std::vector<T>& right) {
@@ -355,6 +370,16 @@ static inline Result<std::shared_ptr<Scalar>> GenericToScalar(
   return std::make_shared<ListScalar>(value);
 }
 
+// An unset optional is stored as a null scalar of null type
+template <typename T>
+static inline Result<std::shared_ptr<Scalar>> GenericToScalar(
+    const util::optional<T>& value) {
+  if (!value.has_value()) {
+    return MakeNullScalar(null());
+  }
+  return GenericToScalar(*value);
+}
+
 static inline Result<std::shared_ptr<Scalar>> GenericToScalar(const Datum& value) {
   // TODO(ARROW-9434): store in a union instead.
   switch (value.kind()) {
@@ -468,6 +493,23 @@ static inline enable_if_same_result<T, Datum> GenericFromScalar(
   return Status::Invalid("Cannot deserialize Datum from ", value->ToString());
 }
 
+template <typename T>
+struct is_optional : std::false_type {};
+
+template <typename T>
+struct is_optional<util::optional<T>> : std::true_type {};
+
+template <typename T>
+static inline enable_if_t<is_optional<T>::value, Result<T>> GenericFromScalar(
+    const std::shared_ptr<Scalar>& value) {
+  using ValueType = typename T::value_type;
+  if (value->type->id() == Type::NA) {
+    return T{};
+  }
+  ARROW_ASSIGN_OR_RAISE(auto v, GenericFromScalar<ValueType>(value));
+  return T(std::move(v));
+}
+
 template <typename T>
 static enable_if_same<typename CTypeTraits<T>::ArrowType, ListType, Result<T>>
 GenericFromScalar(const std::shared_ptr<Scalar>& value) {
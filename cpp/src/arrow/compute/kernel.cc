@@ -26,6 +26,7 @@
 #include "arrow/compute/exec.h"
 #include "arrow/result.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/arena.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hash_util.h"
@@ -58,6 +59,8 @@ Result<std::shared_ptr<ResizableBuffer>> KernelContext::AllocateBitmap(int64_t n
   return result;
 }
 
+util::Arena* KernelContext::scratch_arena() { return util::Arena::ThreadLocal(); }
+
 Status Kernel::InitAll(KernelContext* ctx, const KernelInitArgs& args,
                        std::vector<std::unique_ptr<KernelState>>* states) {
   for (auto& state : *states) {
@@ -39,6 +39,13 @@
 #include "arrow/util/visibility.h"
 
 namespace arrow {
+
+namespace util {
+
+class Arena;
+
+}  // namespace util
+
 namespace compute {
 
 class FunctionOptions;
@@ -66,6 +73,14 @@ class ARROW_EXPORT KernelContext {
   /// byte is preemptively zeroed to help avoid ASAN or valgrind issues.
   Result<std::shared_ptr<ResizableBuffer>> AllocateBitmap(int64_t num_bits);
 
+  /// \brief The arena to allocate the scratch memory of the kernel from
+  ///
+  /// This is the util::Arena of the calling thread.  Allocate from it through a
+  /// util::ArenaScope local to the kernel's execution, so that the temporaries are
+  /// released once the current batch is processed.  Unlike Allocate(), this memory
+  /// is not accounted to the context's memory pool.
+  util::Arena* scratch_arena();
+
   /// \brief Assign the active KernelState to be utilized for each stage of
   /// kernel execution. Ownership and memory lifetime of the KernelState must
   /// be minded separately.
@@ -657,6 +672,11 @@ struct VectorKernel : public Kernel {
   /// be passed whole arrays and don't work on ChunkedArray inputs
   bool can_execute_chunkwise = true;
 
+  /// Chunkwise execution may be parallelized (see
+  /// ExecContext::parallelize_chunks) if exec doesn't mutate any state and
+  /// there is no finalize function. Kernels must opt in to this.
+  bool can_execute_chunks_in_parallel = false;
+
   /// Some kernels (like unique and value_counts) yield non-chunked output from
   /// chunked-array inputs. This option controls how the results are boxed when
   /// returned from ExecVectorFunction
@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cmath>
+
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernels/aggregate_basic_internal.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
@@ -22,6 +24,7 @@
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/hashing.h"
+#include "arrow/util/hyperloglog.h"
 #include "arrow/util/make_unique.h"
 
 namespace arrow {
@@ -68,6 +71,20 @@ namespace {
 // ----------------------------------------------------------------------
 // Count implementation
 
+// Run-end encoded arrays have no validity bitmap of their own, the logical
+// nulls are the runs of null values
+int64_t RunEndEncodedNullCount(const ArraySpan& input) {
+  const ArraySpan& values = ree_util::ValuesArray(input);
+  if (values.GetNullCount() == 0) return 0;
+  int64_t nulls = 0;
+  ARROW_UNUSED(ree_util::VisitRuns(
+      input, [&](int64_t, int64_t run_length, int64_t physical_index) {
+        nulls += values.IsNull(physical_index) * run_length;
+        return Status::OK();
+      }));
+  return nulls;
+}
+
 struct CountImpl : public ScalarAggregator {
   explicit CountImpl(CountOptions options) : options(std::move(options)) {}
 
@@ -76,7 +93,9 @@ struct CountImpl : public ScalarAggregator {
       this->non_nulls += batch.length;
     } else if (batch[0].is_array()) {
       const ArrayData& input = *batch[0].array();
-      const int64_t nulls = input.GetNullCount();
+      const int64_t nulls = input.type->id() == Type::RUN_END_ENCODED
+                                ? RunEndEncodedNullCount(ArraySpan(input))
+                                : input.GetNullCount();
       this->nulls += nulls;
       this->non_nulls += input.length - nulls;
     } else {
@@ -236,6 +255,47 @@ void AddCountDistinctKernels(ScalarAggregateFunction* func) {
       match::FixedSizeBinaryLike(), func);
 }
 
+// ----------------------------------------------------------------------
+// Approximate Distinct Count implementation
+
+using arrow::internal::HyperLogLog;
+
+struct ApproximateCountDistinctImpl : public ScalarAggregator {
+  explicit ApproximateCountDistinctImpl(const ApproximateCountDistinctOptions& options)
+      : sketch(options.precision) {}
+
+  Status Consume(KernelContext*, const ExecBatch& batch) override {
+    const ArraySpan values = batch[0].is_array() ? ArraySpan(*batch[0].array())
+                                                 : ArraySpan(*batch[0].scalar());
+    return VisitValueHashes(values, [&](int64_t, uint64_t hash) { sketch.Add(hash); });
+  }
+
+  Status MergeFrom(KernelContext*, KernelState&& src) override {
+    const auto& other_state = checked_cast<const ApproximateCountDistinctImpl&>(src);
+    this->sketch.Merge(other_state.sketch);
+    return Status::OK();
+  }
+
+  Status Finalize(KernelContext* ctx, Datum* out) override {
+    const auto& state = checked_cast<const ApproximateCountDistinctImpl&>(*ctx->state());
+    *out = Datum(static_cast<int64_t>(std::llround(state.sketch.Estimate())));
+    return Status::OK();
+  }
+
+  HyperLogLog sketch;
+};
+
+Result<std::unique_ptr<KernelState>> ApproximateCountDistinctInit(
+    KernelContext*, const KernelInitArgs& args) {
+  const auto& options = static_cast<const ApproximateCountDistinctOptions&>(*args.options);
+  RETURN_NOT_OK(HyperLogLog::ValidatePrecision(options.precision));
+  if (!CanHashValues(*args.inputs[0].type)) {
+    return Status::NotImplemented("Approximate distinct count of data of type ",
+                                  *args.inputs[0].type);
+  }
+  return ::arrow::internal::make_unique<ApproximateCountDistinctImpl>(options);
+}
+
 // ----------------------------------------------------------------------
 // Sum implementation
 
@@ -257,6 +317,34 @@ Result<std::unique_ptr<KernelState>> SumInit(KernelContext* ctx,
   return visitor.Create();
 }
 
+Result<std::unique_ptr<KernelState>> RunEndEncodedSumInit(KernelContext* ctx,
+                                                          const KernelInitArgs& args) {
+  const auto& value_type =
+      checked_cast<const RunEndEncodedType&>(*args.inputs[0].type).value_type();
+  if (value_type->id() == Type::NA) {
+    return Status::NotImplemented("No sum implemented for run-end encoded nulls");
+  }
+  SumLikeInit<SumImplDefault> visitor(
+      ctx, value_type, static_cast<const ScalarAggregateOptions&>(*args.options));
+  return visitor.Create();
+}
+
+Result<ValueDescr> ResolveRunEndEncodedSumOutput(KernelContext*,
+                                                 const std::vector<ValueDescr>& descrs) {
+  const auto& value_type =
+      checked_cast<const RunEndEncodedType&>(*descrs[0].type).value_type();
+  if (value_type->id() == Type::BOOL || is_unsigned_integer(value_type->id())) {
+    return ValueDescr::Scalar(uint64());
+  } else if (is_signed_integer(value_type->id())) {
+    return ValueDescr::Scalar(int64());
+  } else if (is_floating(value_type->id()) && value_type->id() != Type::HALF_FLOAT) {
+    return ValueDescr::Scalar(float64());
+  } else if (is_decimal(value_type->id())) {
+    return ValueDescr::Scalar(value_type);
+  }
+  return Status::NotImplemented("No sum implemented for run-end encoded ", *value_type);
+}
+
 Result<std::unique_ptr<KernelState>> MeanInit(KernelContext* ctx,
                                               const KernelInitArgs& args) {
   MeanKernelInit<MeanImplDefault> visitor(
@@ -847,6 +935,14 @@ const FunctionDoc count_distinct_doc{"Count the number of unique values",
                                      {"array"},
                                      "CountOptions"};
 
+const FunctionDoc approximate_count_distinct_doc{
+    "Approximate the number of unique values",
+    ("Nulls are not counted.  The count is estimated with a HyperLogLog++ sketch,\n"
+     "whose precision is set in ApproximateCountDistinctOptions.\n"
+     "NaNs and signed zeroes are not normalized."),
+    {"array"},
+    "ApproximateCountDistinctOptions"};
+
 const FunctionDoc sum_doc{
     "Compute the sum of a numeric array",
     ("Null values are ignored by default. Minimum count of non-null\n"
@@ -932,6 +1028,16 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddCountDistinctKernels(func.get());
   DCHECK_OK(registry->AddFunction(std::move(func)));
 
+  static auto default_approximate_count_distinct_options =
+      ApproximateCountDistinctOptions::Defaults();
+  func = std::make_shared<ScalarAggregateFunction>(
+      "approximate_count_distinct", Arity::Unary(), approximate_count_distinct_doc,
+      &default_approximate_count_distinct_options);
+  // Takes any hashable input, outputs int64 scalar
+  AddAggKernel(KernelSignature::Make({any_input}, ValueDescr::Scalar(int64())),
+               ApproximateCountDistinctInit, func.get());
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
   func = std::make_shared<ScalarAggregateFunction>("sum", Arity::Unary(), sum_doc,
                                                    &default_scalar_aggregate_options);
   AddArrayScalarAggKernels(SumInit, {boolean()}, uint64(), func.get());
@@ -945,6 +1051,9 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddArrayScalarAggKernels(SumInit, UnsignedIntTypes(), uint64(), func.get());
   AddArrayScalarAggKernels(SumInit, FloatingPointTypes(), float64(), func.get());
   AddArrayScalarAggKernels(SumInit, {null()}, int64(), func.get());
+  AddAggKernel(KernelSignature::Make({InputType::Array(Type::RUN_END_ENCODED)},
+                                    OutputType(ResolveRunEndEncodedSumOutput)),
+               RunEndEncodedSumInit, func.get(), SimdLevel::NONE);
   // Add the SIMD variants for sum
 #if defined(ARROW_HAVE_RUNTIME_AVX2) || defined(ARROW_HAVE_RUNTIME_AVX512)
   auto cpu_info = arrow::internal::CpuInfo::GetInstance();
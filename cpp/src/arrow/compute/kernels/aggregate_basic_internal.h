@@ -27,6 +27,7 @@
 #include "arrow/util/align_util.h"
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow {
 namespace compute {
@@ -72,6 +73,9 @@ struct SumImpl : public ScalarAggregator {
   Status Consume(KernelContext*, const ExecBatch& batch) override {
     if (batch[0].is_array()) {
       const auto& data = batch[0].array();
+      if (data->type->id() == Type::RUN_END_ENCODED) {
+        return ConsumeRunEndEncoded(ArraySpan(*data));
+      }
       this->count += data->length - data->GetNullCount();
       this->nulls_observed = this->nulls_observed || data->GetNullCount();
 
@@ -83,7 +87,7 @@ struct SumImpl : public ScalarAggregator {
       if (is_boolean_type<ArrowType>::value) {
         this->sum += static_cast<SumCType>(BooleanArray(data).true_count());
       } else {
-        this->sum += SumArray<CType, SumCType, SimdLevel>(*data);
+        this->sum += SumValues(*data);
       }
     } else {
       const auto& data = *batch[0].scalar();
@@ -96,6 +100,49 @@ struct SumImpl : public ScalarAggregator {
     return Status::OK();
   }
 
+  // Each run of a run-end encoded input adds its value once, scaled by the run
+  // length
+  template <typename T = ArrowType>
+  enable_if_t<!std::is_same<T, Decimal128Type>::value, SumCType> SumValues(
+      const ArrayData& data) {
+    return SumArray<CType, SumCType, SimdLevel>(data);
+  }
+
+  template <typename T = ArrowType>
+  enable_if_t<std::is_same<T, Decimal128Type>::value, SumCType> SumValues(
+      const ArrayData& data) {
+    if (DecimalFitsInt64(*data.type)) {
+      return SumInt64Decimal128Array<SimdLevel>(data);
+    }
+    return SumArray<CType, SumCType, SimdLevel>(data);
+  }
+
+  Status ConsumeRunEndEncoded(const ArraySpan& data) {
+    const ArraySpan& values = ree_util::ValuesArray(data);
+    return ree_util::VisitRuns(
+        data, [&](int64_t, int64_t run_length, int64_t physical_index) {
+          if (!values.IsValid(physical_index)) {
+            this->nulls_observed = true;
+            return Status::OK();
+          }
+          this->count += run_length;
+          this->sum += static_cast<SumCType>(GetRunValue(values, physical_index)) *
+                       static_cast<SumCType>(run_length);
+          return Status::OK();
+        });
+  }
+
+  template <typename T = ArrowType>
+  static enable_if_boolean<T, bool> GetRunValue(const ArraySpan& values, int64_t i) {
+    return bit_util::GetBit(values.buffers[1].data, values.offset + i);
+  }
+
+  template <typename T = ArrowType>
+  static enable_if_t<!is_boolean_type<T>::value, CType> GetRunValue(
+      const ArraySpan& values, int64_t i) {
+    return values.GetValues<CType>(1)[i];
+  }
+
   Status MergeFrom(KernelContext*, KernelState&& src) override {
     const auto& other = checked_cast<const ThisType&>(src);
     this->count += other.count;
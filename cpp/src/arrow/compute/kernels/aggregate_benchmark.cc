@@ -550,6 +550,23 @@ SUM_KERNEL_BENCHMARK(SumKernelInt16, Int16Type);
 SUM_KERNEL_BENCHMARK(SumKernelInt32, Int32Type);
 SUM_KERNEL_BENCHMARK(SumKernelInt64, Int64Type);
 
+template <int32_t Precision>
+static void SumKernelDecimal128(benchmark::State& state) {
+  RegressionArgs args(state);
+  const int64_t array_size = args.size / sizeof(Decimal128);
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array =
+      rand.Decimal128(decimal128(Precision, 2), array_size, args.null_proportion);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(Sum(array).status());
+  }
+}
+
+BENCHMARK_TEMPLATE(SumKernelDecimal128, 9)->Apply(SumKernelArgs);
+BENCHMARK_TEMPLATE(SumKernelDecimal128, 18)->Apply(SumKernelArgs);
+BENCHMARK_TEMPLATE(SumKernelDecimal128, 38)->Apply(SumKernelArgs);
+
 //
 // Mode
 //
@@ -17,11 +17,18 @@
 
 #pragma once
 
+#include "arrow/array/data.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bit_run_reader.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/int128_internal.h"
+#include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -239,6 +246,116 @@ SumType SumArray(const ArrayData& data) {
       data, [](ValueType v) { return static_cast<SumType>(v); });
 }
 
+// summation of decimal128 values of at most 18 digits, accumulated as int64 and
+// only widened into the 128-bit sum when the int64 partial sum would overflow
+template <SimdLevel::type SimdLevel>
+Decimal128 SumInt64Decimal128Array(const ArrayData& data) {
+  using arrow::internal::AddWithOverflow;
+  using arrow::internal::VisitSetBitRunsVoid;
+
+  Decimal128 sum = 0;
+  int64_t partial = 0;
+  const Decimal128* values = data.GetValues<Decimal128>(1);
+  VisitSetBitRunsVoid(
+      data.buffers[0], data.offset, data.length, [&](int64_t pos, int64_t len) {
+        for (int64_t i = pos; i < pos + len; ++i) {
+          const auto value = static_cast<int64_t>(values[i].low_bits());
+          int64_t next = 0;
+          if (ARROW_PREDICT_FALSE(AddWithOverflow(partial, value, &next))) {
+            sum += Decimal128(partial);
+            next = value;
+          }
+          partial = next;
+        }
+      });
+  return sum + Decimal128(partial);
+}
+
+// Whether VisitValueHashes supports values of the given type
+inline bool CanHashValues(const DataType& type) {
+  return type.id() == Type::NA || type.id() == Type::BOOL ||
+         (is_fixed_width(type.id()) && type.id() != Type::DICTIONARY) ||
+         is_base_binary_like(type.id()) || is_binary_view_like(type.id());
+}
+
+// Call `visit(i, hash)` with the hash of each non-null value, i being the
+// position of the value relative to the array offset.  Equal values of the
+// same type have equal hashes (NaNs and signed zeroes are not normalized).
+template <typename Visit>
+Status VisitValueHashes(const ArraySpan& values, Visit&& visit) {
+  using arrow::internal::ComputeStringHash;
+  using arrow::internal::VisitSetBitRunsVoid;
+
+  const DataType& type = *values.type;
+  const uint8_t* validity = values.null_count != 0 ? values.buffers[0].data : NULLPTR;
+  auto visit_binary = [&](int64_t i, const void* data, int64_t length) {
+    visit(i, ComputeStringHash<0>(data, length));
+  };
+  if (type.id() == Type::NA) {
+    return Status::OK();
+  }
+  if (type.id() == Type::BOOL) {
+    const uint8_t* data = values.buffers[1].data;
+    VisitSetBitRunsVoid(validity, values.offset, values.length,
+                        [&](int64_t pos, int64_t len) {
+                          for (int64_t i = pos; i < pos + len; ++i) {
+                            const uint8_t value =
+                                bit_util::GetBit(data, values.offset + i);
+                            visit_binary(i, &value, 1);
+                          }
+                        });
+    return Status::OK();
+  }
+  if (is_fixed_width(type.id()) && type.id() != Type::DICTIONARY) {
+    const int byte_width =
+        ::arrow::internal::checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+    const uint8_t* data = values.buffers[1].data + values.offset * byte_width;
+    VisitSetBitRunsVoid(validity, values.offset, values.length,
+                        [&](int64_t pos, int64_t len) {
+                          for (int64_t i = pos; i < pos + len; ++i) {
+                            visit_binary(i, data + i * byte_width, byte_width);
+                          }
+                        });
+    return Status::OK();
+  }
+  if (is_base_binary_like(type.id())) {
+    const uint8_t* data = values.buffers[2].data;
+    if (is_large_binary_like(type.id())) {
+      const int64_t* offsets = values.GetValues<int64_t>(1);
+      VisitSetBitRunsVoid(validity, values.offset, values.length,
+                          [&](int64_t pos, int64_t len) {
+                            for (int64_t i = pos; i < pos + len; ++i) {
+                              visit_binary(i, data + offsets[i],
+                                           offsets[i + 1] - offsets[i]);
+                            }
+                          });
+    } else {
+      const int32_t* offsets = values.GetValues<int32_t>(1);
+      VisitSetBitRunsVoid(validity, values.offset, values.length,
+                          [&](int64_t pos, int64_t len) {
+                            for (int64_t i = pos; i < pos + len; ++i) {
+                              visit_binary(i, data + offsets[i],
+                                           offsets[i + 1] - offsets[i]);
+                            }
+                          });
+    }
+    return Status::OK();
+  }
+  if (is_binary_view_like(type.id())) {
+    const auto* views = values.GetValues<BinaryViewType::c_type>(1);
+    const uint8_t* data = values.buffers[2].data;
+    VisitSetBitRunsVoid(validity, values.offset, values.length,
+                        [&](int64_t pos, int64_t len) {
+                          for (int64_t i = pos; i < pos + len; ++i) {
+                            visit_binary(i, binary_view_util::ViewData(views[i], data),
+                                         views[i].size());
+                          }
+                        });
+    return Status::OK();
+  }
+  return Status::NotImplemented("Hashing values of type ", type);
+}
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
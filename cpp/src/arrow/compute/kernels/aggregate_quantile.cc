@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/kernels/aggregate_quantile_internal.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/stl_allocator.h"
@@ -32,57 +33,6 @@ namespace {
 
 using QuantileState = internal::OptionsWrapper<QuantileOptions>;
 
-// output is at some input data point, not interpolated
-bool IsDataPoint(const QuantileOptions& options) {
-  // some interpolation methods return exact data point
-  return options.interpolation == QuantileOptions::LOWER ||
-         options.interpolation == QuantileOptions::HIGHER ||
-         options.interpolation == QuantileOptions::NEAREST;
-}
-
-// quantile to exact datapoint index (IsDataPoint == true)
-uint64_t QuantileToDataPoint(size_t length, double q,
-                             enum QuantileOptions::Interpolation interpolation) {
-  const double index = (length - 1) * q;
-  uint64_t datapoint_index = static_cast<uint64_t>(index);
-  const double fraction = index - datapoint_index;
-
-  if (interpolation == QuantileOptions::LINEAR ||
-      interpolation == QuantileOptions::MIDPOINT) {
-    DCHECK_EQ(fraction, 0);
-  }
-
-  // convert NEAREST interpolation method to LOWER or HIGHER
-  if (interpolation == QuantileOptions::NEAREST) {
-    if (fraction < 0.5) {
-      interpolation = QuantileOptions::LOWER;
-    } else if (fraction > 0.5) {
-      interpolation = QuantileOptions::HIGHER;
-    } else {
-      // round 0.5 to nearest even number, similar to numpy.around
-      interpolation =
-          (datapoint_index & 1) ? QuantileOptions::HIGHER : QuantileOptions::LOWER;
-    }
-  }
-
-  if (interpolation == QuantileOptions::HIGHER && fraction != 0) {
-    ++datapoint_index;
-  }
-
-  return datapoint_index;
-}
-
-template <typename T>
-double DataPointToDouble(T value, const DataType&) {
-  return static_cast<double>(value);
-}
-double DataPointToDouble(const Decimal128& value, const DataType& ty) {
-  return value.ToDouble(checked_cast<const DecimalType&>(ty).scale());
-}
-double DataPointToDouble(const Decimal256& value, const DataType& ty) {
-  return value.ToDouble(checked_cast<const DecimalType&>(ty).scale());
-}
-
 // copy and nth_element approach, large memory footprint
 template <typename InType>
 struct SortQuantiler {
@@ -126,15 +76,17 @@ struct SortQuantiler {
         CType* out_buffer = out_data->template GetMutableValues<CType>(1);
         for (int64_t i = 0; i < out_length; ++i) {
           const int64_t q_index = q_indices[i];
-          out_buffer[q_index] = GetQuantileAtDataPoint(
-              in_buffer, &last_index, options.q[q_index], options.interpolation);
+          out_buffer[q_index] =
+              GetQuantileAtDataPoint(in_buffer.data(), in_buffer.size(), &last_index,
+                                     options.q[q_index], options.interpolation);
         }
       } else {
         double* out_buffer = out_data->template GetMutableValues<double>(1);
         for (int64_t i = 0; i < out_length; ++i) {
           const int64_t q_index = q_indices[i];
-          out_buffer[q_index] = GetQuantileByInterp(
-              in_buffer, &last_index, options.q[q_index], options.interpolation, *type);
+          out_buffer[q_index] =
+              GetQuantileByInterp(in_buffer.data(), in_buffer.size(), &last_index,
+                                  options.q[q_index], options.interpolation, *type);
         }
       }
     }
@@ -188,64 +140,6 @@ struct SortQuantiler {
     *out = result.array_data();
     return Status::OK();
   }
-
-  // return quantile located exactly at some input data point
-  CType GetQuantileAtDataPoint(std::vector<CType, Allocator>& in, uint64_t* last_index,
-                               double q,
-                               enum QuantileOptions::Interpolation interpolation) {
-    const uint64_t datapoint_index = QuantileToDataPoint(in.size(), q, interpolation);
-
-    if (datapoint_index != *last_index) {
-      DCHECK_LT(datapoint_index, *last_index);
-      std::nth_element(in.begin(), in.begin() + datapoint_index,
-                       in.begin() + *last_index);
-      *last_index = datapoint_index;
-    }
-
-    return in[datapoint_index];
-  }
-
-  // return quantile interpolated from adjacent input data points
-  double GetQuantileByInterp(std::vector<CType, Allocator>& in, uint64_t* last_index,
-                             double q, enum QuantileOptions::Interpolation interpolation,
-                             const DataType& in_type) {
-    const double index = (in.size() - 1) * q;
-    const uint64_t lower_index = static_cast<uint64_t>(index);
-    const double fraction = index - lower_index;
-
-    if (lower_index != *last_index) {
-      DCHECK_LT(lower_index, *last_index);
-      std::nth_element(in.begin(), in.begin() + lower_index, in.begin() + *last_index);
-    }
-
-    const double lower_value = DataPointToDouble(in[lower_index], in_type);
-    if (fraction == 0) {
-      *last_index = lower_index;
-      return lower_value;
-    }
-
-    const uint64_t higher_index = lower_index + 1;
-    DCHECK_LT(higher_index, in.size());
-    if (lower_index != *last_index && higher_index != *last_index) {
-      DCHECK_LT(higher_index, *last_index);
-      // higher value must be the minimal value after lower_index
-      auto min = std::min_element(in.begin() + higher_index, in.begin() + *last_index);
-      std::iter_swap(in.begin() + higher_index, min);
-    }
-    *last_index = lower_index;
-
-    const double higher_value = DataPointToDouble(in[higher_index], in_type);
-
-    if (interpolation == QuantileOptions::LINEAR) {
-      // more stable than naive linear interpolation
-      return fraction * higher_value + (1 - fraction) * lower_value;
-    } else if (interpolation == QuantileOptions::MIDPOINT) {
-      return lower_value / 2 + higher_value / 2;
-    } else {
-      DCHECK(false);
-      return NAN;
-    }
-  }
 };
 
 // histogram approach with constant memory, only for integers within limited value range
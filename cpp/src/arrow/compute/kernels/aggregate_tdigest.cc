@@ -54,6 +54,23 @@ struct TDigestImpl : public ScalarAggregator {
   double ToDouble(const Decimal128& value) const { return value.ToDouble(decimal_scale); }
   double ToDouble(const Decimal256& value) const { return value.ToDouble(decimal_scale); }
 
+  template <typename T>
+  void AddValues(const T* values, int64_t length) {
+    this->tdigest.NanAdd(values, length);
+  }
+  template <typename T>
+  void AddDecimalValues(const T* values, int64_t length) {
+    for (int64_t i = 0; i < length; ++i) {
+      this->tdigest.NanAdd(ToDouble(values[i]));
+    }
+  }
+  void AddValues(const Decimal128* values, int64_t length) {
+    AddDecimalValues(values, length);
+  }
+  void AddValues(const Decimal256* values, int64_t length) {
+    AddDecimalValues(values, length);
+  }
+
   Status Consume(KernelContext*, const ExecBatch& batch) override {
     if (!this->all_valid) return Status::OK();
     if (!options.skip_nulls && batch[0].null_count() > 0) {
@@ -68,9 +85,7 @@ struct TDigestImpl : public ScalarAggregator {
         this->count += data.length - data.GetNullCount();
         VisitSetBitRunsVoid(data.buffers[0], data.offset, data.length,
                             [&](int64_t pos, int64_t len) {
-                              for (int64_t i = 0; i < len; ++i) {
-                                this->tdigest.NanAdd(ToDouble(values[pos + i]));
-                              }
+                              AddValues(values + pos, len);
                             });
       }
     } else {
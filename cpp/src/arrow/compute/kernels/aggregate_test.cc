@@ -16,6 +16,7 @@
 // under the License.
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <type_traits>
@@ -534,6 +535,22 @@ TEST(TestDecimalSumKernel, SimpleSum) {
   }
 }
 
+TEST(TestDecimalSumKernel, Int64Overflow) {
+  // Decimals of at most 18 digits are summed as int64 and widened on overflow
+  auto ty = decimal128(18, 0);
+  auto values = ArrayFromJSON(ty, R"([
+    "999999999999999999", "999999999999999999", "999999999999999999",
+    "999999999999999999", "999999999999999999", null, "999999999999999999",
+    "999999999999999999", "999999999999999999", "999999999999999999",
+    "999999999999999999", "-1"
+  ])");
+  auto sum = std::make_shared<Decimal128Scalar>(Decimal128("9999999999999999989"), ty);
+  EXPECT_THAT(Sum(values), ResultWith(Datum(sum)));
+  EXPECT_THAT(Sum(values->Slice(10)),
+              ResultWith(ScalarFromJSON(ty, R"("999999999999999998")")));
+  EXPECT_THAT(Mean(values), ResultWith(ScalarFromJSON(ty, R"("909090909090909090")")));
+}
+
 TEST(TestDecimalSumKernel, ScalarAggregateOptions) {
   for (const auto& ty : {decimal128(3, 2), decimal256(3, 2)}) {
     Datum null = ScalarFromJSON(ty, R"(null)");
@@ -1068,6 +1085,65 @@ TEST_F(TestCountDistinctKernel, Random) {
   Check(input, memo.size(), false);
 }
 
+//
+// Approximate Count Distinct
+//
+
+TEST(TestApproximateCountDistinctKernel, Basics) {
+  auto check = [](const Datum& input, int64_t expected) {
+    EXPECT_THAT(CallFunction("approximate_count_distinct", {input}),
+                ResultWith(Datum(expected)));
+  };
+  // Small counts are exact
+  check(ArrayFromJSON(boolean(), "[]"), 0);
+  check(ArrayFromJSON(null(), "[null, null]"), 0);
+  check(ArrayFromJSON(boolean(), "[true, null, false, null, false, true]"), 2);
+  for (auto ty : NumericTypes()) {
+    check(ArrayFromJSON(ty, "[1, 1, null, 2, 5, 8, 9, 9, null, 10, 6, 6]"), 7);
+  }
+  check(ArrayFromJSON(timestamp(TimeUnit::SECOND), "[0, 11, 0, null, 14, 14, null]"), 3);
+  check(ArrayFromJSON(day_time_interval(), "[[0, 1], [0, 1], null, [1234, 5678]]"), 2);
+  auto samples = R"([null, "abc", null, "abc", "abc", "cba", "bca", "cba", null])";
+  for (auto ty : {binary(), large_binary(), utf8(), large_utf8(), utf8_view(),
+                  fixed_size_binary(3)}) {
+    check(ArrayFromJSON(ty, samples), 3);
+  }
+  check(ArrayFromJSON(decimal128(21, 3), R"(["12345.679", "98765.421", null])"), 2);
+  // Scalars
+  check(ScalarFromJSON(utf8(), R"("abc")"), 1);
+  check(ScalarFromJSON(int32(), "null"), 0);
+  // Chunked arrays merge the states of the chunks
+  check(ChunkedArrayFromJSON(int64(), {"[1, 2, null]", "[2, 3]", "[]", "[1, 4]"}), 4);
+}
+
+TEST(TestApproximateCountDistinctKernel, Random) {
+  auto rand = random::RandomArrayGenerator(0x1205643);
+  auto arr = rand.Numeric<Int64Type>(100000, 0, 30000, 0.1);
+  ASSERT_OK_AND_ASSIGN(Datum exact, CallFunction("count_distinct", {arr}));
+  const auto expected = exact.scalar_as<Int64Scalar>().value;
+  for (int32_t precision : {10, 14}) {
+    ApproximateCountDistinctOptions options(precision);
+    ASSERT_OK_AND_ASSIGN(Datum approx, ApproximateCountDistinct(arr, options));
+    const auto actual = approx.scalar_as<Int64Scalar>().value;
+    // Well within 4 standard errors
+    const double tolerance = 4 * 1.04 / std::sqrt(static_cast<double>(1 << precision));
+    EXPECT_NEAR(static_cast<double>(actual), static_cast<double>(expected),
+                tolerance * static_cast<double>(expected));
+  }
+}
+
+TEST(TestApproximateCountDistinctKernel, Errors) {
+  auto arr = ArrayFromJSON(int32(), "[1, 2]");
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("precision must be between 4 and 18"),
+      ApproximateCountDistinct(arr, ApproximateCountDistinctOptions(3)));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("precision must be between 4 and 18"),
+      ApproximateCountDistinct(arr, ApproximateCountDistinctOptions(19)));
+  ASSERT_RAISES(NotImplemented,
+                ApproximateCountDistinct(ArrayFromJSON(list(int32()), "[[1], [2]]")));
+}
+
 //
 // Mean
 //
@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/util_internal.h"
@@ -358,6 +361,35 @@ struct MultiplyChecked {
   }
 };
 
+// Minimum and maximum, ignoring NaNs unless both operands are NaN
+struct Min {
+  template <typename T, typename Arg0, typename Arg1>
+  static constexpr enable_if_integer_value<T> Call(KernelContext*, Arg0 left, Arg1 right,
+                                                   Status*) {
+    return std::min<T>(left, right);
+  }
+
+  template <typename T, typename Arg0, typename Arg1>
+  static enable_if_floating_value<T> Call(KernelContext*, Arg0 left, Arg1 right,
+                                          Status*) {
+    return std::fmin(left, right);
+  }
+};
+
+struct Max {
+  template <typename T, typename Arg0, typename Arg1>
+  static constexpr enable_if_integer_value<T> Call(KernelContext*, Arg0 left, Arg1 right,
+                                                   Status*) {
+    return std::max<T>(left, right);
+  }
+
+  template <typename T, typename Arg0, typename Arg1>
+  static enable_if_floating_value<T> Call(KernelContext*, Arg0 left, Arg1 right,
+                                          Status*) {
+    return std::fmax(left, right);
+  }
+};
+
 struct Divide {
   template <typename T, typename Arg0, typename Arg1>
   static enable_if_floating_value<T> Call(KernelContext*, Arg0 left, Arg1 right,
@@ -19,11 +19,13 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <numeric>
 #include <string>
 #include <thread>
 #include <unordered_map>
 #include <vector>
 
+#include "arrow/array/builder_decimal.h"
 #include "arrow/array/builder_nested.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/buffer_builder.h"
@@ -35,6 +37,7 @@
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/aggregate_quantile_internal.h"
 #include "arrow/compute/kernels/aggregate_var_std_internal.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/row_encoder.h"
@@ -47,6 +50,7 @@
 #include "arrow/util/bitmap_writer.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
+#include "arrow/util/hyperloglog.h"
 #include "arrow/util/int128_internal.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/make_unique.h"
@@ -1202,6 +1206,431 @@ HashAggregateKernel MakeApproximateMedianKernel(HashAggregateFunction* tdigest_f
   return kernel;
 }
 
+// ----------------------------------------------------------------------
+// Quantile/Mode implementation
+
+// The values of all groups, appended as (value, group id) pairs to flat
+// buffers rather than to a structure per group.  They are grouped with a
+// counting sort when finalizing, so that each group's values can be selected
+// from in place.
+template <typename CType>
+struct GroupedValueBuffer {
+  explicit GroupedValueBuffer(MemoryPool* pool = default_memory_pool())
+      : values_(pool), groups_(pool) {}
+
+  Status Reserve(int64_t additional_values) {
+    RETURN_NOT_OK(values_.Reserve(additional_values));
+    return groups_.Reserve(additional_values);
+  }
+
+  void UnsafeAppend(uint32_t g, CType value) {
+    values_.UnsafeAppend(value);
+    groups_.UnsafeAppend(g);
+  }
+
+  Status Merge(const GroupedValueBuffer& other, const ArrayData& group_id_mapping) {
+    const auto* g_mapping = group_id_mapping.GetValues<uint32_t>(1);
+    const CType* other_values = other.values_.data();
+    const uint32_t* other_groups = other.groups_.data();
+    RETURN_NOT_OK(Reserve(other.values_.length()));
+    for (int64_t i = 0; i < other.values_.length(); ++i) {
+      UnsafeAppend(g_mapping[other_groups[i]], other_values[i]);
+    }
+    return Status::OK();
+  }
+
+  // On return, the values of group g are at [offsets[g], offsets[g + 1]) in the
+  // returned buffer
+  Result<std::shared_ptr<Buffer>> GroupValues(int64_t num_groups,
+                                              std::vector<int64_t>* offsets,
+                                              MemoryPool* pool) {
+    const int64_t length = values_.length();
+    const CType* values = values_.data();
+    const uint32_t* groups = groups_.data();
+
+    offsets->assign(num_groups + 1, 0);
+    for (int64_t i = 0; i < length; ++i) {
+      ++(*offsets)[groups[i] + 1];
+    }
+    std::partial_sum(offsets->begin(), offsets->end(), offsets->begin());
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> grouped,
+                          AllocateBuffer(length * sizeof(CType), pool));
+    CType* out = reinterpret_cast<CType*>(grouped->mutable_data());
+    std::vector<int64_t> positions(offsets->begin(), offsets->end() - 1);
+    for (int64_t i = 0; i < length; ++i) {
+      out[positions[groups[i]]++] = values[i];
+    }
+    values_.Reset();
+    groups_.Reset();
+    return std::move(grouped);
+  }
+
+  TypedBufferBuilder<CType> values_;
+  TypedBufferBuilder<uint32_t> groups_;
+};
+
+template <typename Type>
+struct GroupedQuantileImpl : public GroupedAggregator {
+  using CType = typename TypeTraits<Type>::CType;
+
+  Status Init(ExecContext* ctx, const std::vector<ValueDescr>& inputs,
+              const FunctionOptions* options) override {
+    options_ = checked_cast<const QuantileOptions&>(*options);
+    if (options_.q.empty()) {
+      return Status::Invalid("Requires quantile argument");
+    }
+    for (double q : options_.q) {
+      if (q < 0 || q > 1) {
+        return Status::Invalid("Quantile must be between 0 and 1");
+      }
+    }
+    type_ = inputs[0].type;
+    pool_ = ctx->memory_pool();
+    values_ = GroupedValueBuffer<CType>(pool_);
+    counts_ = TypedBufferBuilder<int64_t>(pool_);
+    no_nulls_ = TypedBufferBuilder<bool>(pool_);
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    auto added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    RETURN_NOT_OK(counts_.Append(added_groups, 0));
+    return no_nulls_.Append(added_groups, true);
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(values_.Reserve(batch.length));
+    int64_t* counts = counts_.mutable_data();
+    uint8_t* no_nulls = no_nulls_.mutable_data();
+    VisitGroupedValues<Type>(
+        batch,
+        [&](uint32_t g, CType value) {
+          counts[g]++;
+          // NaNs are counted (for min_count), but ignored
+          if (!is_floating_type<Type>::value || value == value) {
+            values_.UnsafeAppend(g, value);
+          }
+        },
+        [&](uint32_t g) { bit_util::SetBitTo(no_nulls, g, false); });
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedQuantileImpl*>(&raw_other);
+
+    int64_t* counts = counts_.mutable_data();
+    uint8_t* no_nulls = no_nulls_.mutable_data();
+    const int64_t* other_counts = other->counts_.data();
+    const uint8_t* other_no_nulls = other->no_nulls_.data();
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      counts[*g] += other_counts[other_g];
+      bit_util::SetBitTo(
+          no_nulls, *g,
+          bit_util::GetBit(no_nulls, *g) && bit_util::GetBit(other_no_nulls, other_g));
+    }
+    return values_.Merge(other->values_, group_id_mapping);
+  }
+
+  Result<Datum> Finalize() override {
+    const int64_t slot_length = options_.q.size();
+    const int64_t num_values = num_groups_ * slot_length;
+    const bool is_datapoint = IsDataPoint(options_);
+    const auto value_type = is_datapoint ? type_ : float64();
+
+    std::vector<int64_t> offsets;
+    ARROW_ASSIGN_OR_RAISE(auto grouped,
+                          values_.GroupValues(num_groups_, &offsets, pool_));
+    CType* in = reinterpret_cast<CType*>(grouped->mutable_data());
+
+    // find quantiles in descending order, see GetQuantileAtDataPoint
+    std::vector<int64_t> q_indices(slot_length);
+    std::iota(q_indices.begin(), q_indices.end(), 0);
+    std::sort(q_indices.begin(), q_indices.end(), [&](int64_t left, int64_t right) {
+      return options_.q[right] < options_.q[left];
+    });
+
+    const int byte_width =
+        checked_cast<const FixedWidthType&>(*value_type).bit_width() / 8;
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> values,
+                          AllocateBuffer(num_values * byte_width, pool_));
+    std::memset(values->mutable_data(), 0, values->size());
+    auto* datapoints = reinterpret_cast<CType*>(values->mutable_data());
+    auto* interpolated = reinterpret_cast<double*>(values->mutable_data());
+    std::shared_ptr<Buffer> null_bitmap;
+    int64_t null_count = 0;
+
+    const int64_t* counts = counts_.data();
+    for (int64_t g = 0; g < num_groups_; ++g) {
+      const uint64_t length = offsets[g + 1] - offsets[g];
+      if (length > 0 && counts[g] >= options_.min_count &&
+          (options_.skip_nulls || bit_util::GetBit(no_nulls_.data(), g))) {
+        uint64_t last_index = length;
+        for (int64_t q_index : q_indices) {
+          const int64_t out_index = g * slot_length + q_index;
+          if (is_datapoint) {
+            datapoints[out_index] =
+                GetQuantileAtDataPoint(in + offsets[g], length, &last_index,
+                                       options_.q[q_index], options_.interpolation);
+          } else {
+            interpolated[out_index] = GetQuantileByInterp(
+                in + offsets[g], length, &last_index, options_.q[q_index],
+                options_.interpolation, *type_);
+          }
+        }
+        continue;
+      }
+
+      if (!null_bitmap) {
+        ARROW_ASSIGN_OR_RAISE(null_bitmap, AllocateBitmap(num_values, pool_));
+        bit_util::SetBitsTo(null_bitmap->mutable_data(), 0, num_values, true);
+      }
+      null_count += slot_length;
+      bit_util::SetBitsTo(null_bitmap->mutable_data(), g * slot_length, slot_length,
+                          false);
+    }
+
+    auto child = ArrayData::Make(value_type, num_values,
+                                 {std::move(null_bitmap), std::move(values)}, null_count);
+    return ArrayData::Make(out_type(), num_groups_, {nullptr}, {std::move(child)},
+                           /*null_count=*/0);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return fixed_size_list(IsDataPoint(options_) ? type_ : float64(),
+                           static_cast<int32_t>(options_.q.size()));
+  }
+
+  QuantileOptions options_;
+  std::shared_ptr<DataType> type_;
+  int64_t num_groups_ = 0;
+  GroupedValueBuffer<CType> values_;
+  TypedBufferBuilder<int64_t> counts_;
+  TypedBufferBuilder<bool> no_nulls_;
+  MemoryPool* pool_;
+};
+
+template <typename Type>
+struct GroupedModeImpl : public GroupedAggregator {
+  using CType = typename TypeTraits<Type>::CType;
+  // booleans are stored as bytes, not bits
+  using StorageType =
+      typename std::conditional<is_boolean_type<Type>::value, uint8_t, CType>::type;
+  using BuilderType = typename TypeTraits<Type>::BuilderType;
+
+  Status Init(ExecContext* ctx, const std::vector<ValueDescr>& inputs,
+              const FunctionOptions* options) override {
+    options_ = checked_cast<const ModeOptions&>(*options);
+    if (options_.n <= 0) {
+      return Status::Invalid("ModeOptions::n must be strictly positive");
+    }
+    type_ = inputs[0].type;
+    pool_ = ctx->memory_pool();
+    values_ = GroupedValueBuffer<StorageType>(pool_);
+    counts_ = TypedBufferBuilder<int64_t>(pool_);
+    no_nulls_ = TypedBufferBuilder<bool>(pool_);
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    auto added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    RETURN_NOT_OK(counts_.Append(added_groups, 0));
+    return no_nulls_.Append(added_groups, true);
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(values_.Reserve(batch.length));
+    int64_t* counts = counts_.mutable_data();
+    uint8_t* no_nulls = no_nulls_.mutable_data();
+    VisitGroupedValues<Type>(
+        batch,
+        [&](uint32_t g, CType value) {
+          counts[g]++;
+          values_.UnsafeAppend(g, static_cast<StorageType>(value));
+        },
+        [&](uint32_t g) { bit_util::SetBitTo(no_nulls, g, false); });
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedModeImpl*>(&raw_other);
+
+    int64_t* counts = counts_.mutable_data();
+    uint8_t* no_nulls = no_nulls_.mutable_data();
+    const int64_t* other_counts = other->counts_.data();
+    const uint8_t* other_no_nulls = other->no_nulls_.data();
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      counts[*g] += other_counts[other_g];
+      bit_util::SetBitTo(
+          no_nulls, *g,
+          bit_util::GetBit(no_nulls, *g) && bit_util::GetBit(other_no_nulls, other_g));
+    }
+    return values_.Merge(other->values_, group_id_mapping);
+  }
+
+  Result<Datum> Finalize() override {
+    std::vector<int64_t> offsets;
+    ARROW_ASSIGN_OR_RAISE(auto grouped,
+                          values_.GroupValues(num_groups_, &offsets, pool_));
+    StorageType* in = reinterpret_cast<StorageType*>(grouped->mutable_data());
+
+    std::unique_ptr<ArrayBuilder> raw_mode_builder;
+    RETURN_NOT_OK(MakeBuilder(pool_, type_, &raw_mode_builder));
+    auto mode_builder = checked_cast<BuilderType*>(raw_mode_builder.get());
+    Int64Builder count_builder(pool_);
+    TypedBufferBuilder<int32_t> offsets_builder(pool_);
+    RETURN_NOT_OK(offsets_builder.Reserve(num_groups_ + 1));
+    offsets_builder.UnsafeAppend(0);
+
+    // same order as the mode kernel: descending count, then ascending value with
+    // NaNs last
+    using ValueCount = std::pair<StorageType, int64_t>;
+    auto is_nan = [](StorageType v) { return is_floating_type<Type>::value && v != v; };
+    auto better = [&](const ValueCount& lhs, const ValueCount& rhs) {
+      return lhs.second > rhs.second ||
+             (lhs.second == rhs.second && (lhs.first < rhs.first || is_nan(rhs.first)));
+    };
+    std::vector<ValueCount> value_counts;
+
+    const int64_t* counts = counts_.data();
+    int32_t num_modes = 0;
+    for (int64_t g = 0; g < num_groups_; ++g) {
+      StorageType* begin = in + offsets[g];
+      StorageType* end = in + offsets[g + 1];
+      if (begin != end && counts[g] >= options_.min_count &&
+          (options_.skip_nulls || bit_util::GetBit(no_nulls_.data(), g))) {
+        // count the runs of equal values, NaNs apart
+        StorageType* nans = std::partition(begin, end, [&](StorageType v) {
+          return !is_nan(v);
+        });
+        std::sort(begin, nans);
+        value_counts.clear();
+        for (StorageType* it = begin; it != nans;) {
+          StorageType* run_end = std::upper_bound(it, nans, *it);
+          value_counts.emplace_back(*it, run_end - it);
+          it = run_end;
+        }
+        if (nans != end) {
+          value_counts.emplace_back(*nans, end - nans);
+        }
+        const auto n = std::min<int64_t>(options_.n, value_counts.size());
+        std::partial_sort(value_counts.begin(), value_counts.begin() + n,
+                          value_counts.end(), better);
+        RETURN_NOT_OK(mode_builder->Reserve(n));
+        RETURN_NOT_OK(count_builder.Reserve(n));
+        for (int64_t i = 0; i < n; ++i) {
+          mode_builder->UnsafeAppend(static_cast<CType>(value_counts[i].first));
+          count_builder.UnsafeAppend(value_counts[i].second);
+        }
+        num_modes += static_cast<int32_t>(n);
+      }
+      offsets_builder.UnsafeAppend(num_modes);
+    }
+
+    std::shared_ptr<Array> modes, mode_counts;
+    RETURN_NOT_OK(mode_builder->Finish(&modes));
+    RETURN_NOT_OK(count_builder.Finish(&mode_counts));
+    ARROW_ASSIGN_OR_RAISE(auto list_offsets, offsets_builder.Finish());
+    auto child = ArrayData::Make(out_type()->field(0)->type(), num_modes, {nullptr},
+                                 {modes->data(), mode_counts->data()},
+                                 /*null_count=*/0);
+    return ArrayData::Make(out_type(), num_groups_, {nullptr, std::move(list_offsets)},
+                           {std::move(child)}, /*null_count=*/0);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return list(struct_({field("mode", type_), field("count", int64())}));
+  }
+
+  ModeOptions options_;
+  std::shared_ptr<DataType> type_;
+  int64_t num_groups_ = 0;
+  GroupedValueBuffer<StorageType> values_;
+  TypedBufferBuilder<int64_t> counts_;
+  TypedBufferBuilder<bool> no_nulls_;
+  MemoryPool* pool_;
+};
+
+struct GroupedQuantileFactory {
+  template <typename T>
+  enable_if_number<T, Status> Visit(const T&) {
+    kernel =
+        MakeKernel(std::move(argument_type), HashAggregateInit<GroupedQuantileImpl<T>>);
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_decimal<T, Status> Visit(const T&) {
+    kernel =
+        MakeKernel(std::move(argument_type), HashAggregateInit<GroupedQuantileImpl<T>>);
+    return Status::OK();
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Status::NotImplemented("Computing quantile of data of type ", type);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Computing quantile of data of type ", type);
+  }
+
+  static Result<HashAggregateKernel> Make(const std::shared_ptr<DataType>& type) {
+    GroupedQuantileFactory factory;
+    factory.argument_type = InputType::Array(type->id());
+    RETURN_NOT_OK(VisitTypeInline(*type, &factory));
+    return std::move(factory.kernel);
+  }
+
+  HashAggregateKernel kernel;
+  InputType argument_type;
+};
+
+struct GroupedModeFactory {
+  template <typename T>
+  enable_if_number<T, Status> Visit(const T&) {
+    kernel = MakeKernel(std::move(argument_type), HashAggregateInit<GroupedModeImpl<T>>);
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_decimal<T, Status> Visit(const T&) {
+    kernel = MakeKernel(std::move(argument_type), HashAggregateInit<GroupedModeImpl<T>>);
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    kernel = MakeKernel(std::move(argument_type),
+                        HashAggregateInit<GroupedModeImpl<BooleanType>>);
+    return Status::OK();
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Status::NotImplemented("Computing mode of data of type ", type);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Computing mode of data of type ", type);
+  }
+
+  static Result<HashAggregateKernel> Make(const std::shared_ptr<DataType>& type) {
+    GroupedModeFactory factory;
+    factory.argument_type = InputType::Array(type->id());
+    RETURN_NOT_OK(VisitTypeInline(*type, &factory));
+    return std::move(factory.kernel);
+  }
+
+  HashAggregateKernel kernel;
+  InputType argument_type;
+};
+
 // ----------------------------------------------------------------------
 // MinMax implementation
 
@@ -1983,6 +2412,76 @@ Result<std::unique_ptr<KernelState>> GroupedDistinctInit(KernelContext* ctx,
   return std::move(impl);
 }
 
+// ----------------------------------------------------------------------
+// ApproximateCountDistinct implementation
+
+using arrow::internal::HyperLogLog;
+
+// Unlike GroupedCountDistinctImpl, the memory used per group is bounded by the
+// sketch size rather than growing with the number of distinct values
+struct GroupedApproximateCountDistinctImpl : public GroupedAggregator {
+  Status Init(ExecContext* ctx, const std::vector<ValueDescr>& inputs,
+              const FunctionOptions* options) override {
+    options_ = checked_cast<const ApproximateCountDistinctOptions&>(*options);
+    RETURN_NOT_OK(HyperLogLog::ValidatePrecision(options_.precision));
+    if (!CanHashValues(*inputs[0].type)) {
+      return Status::NotImplemented("Approximate distinct count of data of type ",
+                                    *inputs[0].type);
+    }
+    pool_ = ctx->memory_pool();
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    sketches_.resize(new_num_groups, HyperLogLog(options_.precision));
+    return Status::OK();
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    const auto* g = batch[1].array()->GetValues<uint32_t>(1);
+    if (batch[0].is_array()) {
+      return VisitValueHashes(*batch[0].array(), [&](int64_t i, uint64_t hash) {
+        sketches_[g[i]].Add(hash);
+      });
+    }
+    // The same value for all rows: hash it once
+    return VisitValueHashes(*batch[0].scalar(), [&](int64_t, uint64_t hash) {
+      for (int64_t i = 0; i < batch.length; i++) {
+        sketches_[g[i]].Add(hash);
+      }
+    });
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedApproximateCountDistinctImpl*>(&raw_other);
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      sketches_[*g].Merge(other->sketches_[other_g]);
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const auto num_groups = static_cast<int64_t>(sketches_.size());
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> values,
+                          AllocateBuffer(num_groups * sizeof(int64_t), pool_));
+    int64_t* counts = reinterpret_cast<int64_t*>(values->mutable_data());
+    for (int64_t i = 0; i < num_groups; i++) {
+      counts[i] = static_cast<int64_t>(std::llround(sketches_[i].Estimate()));
+    }
+    return ArrayData::Make(int64(), num_groups, {nullptr, std::move(values)},
+                           /*null_count=*/0);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+  ApproximateCountDistinctOptions options_;
+  std::vector<HyperLogLog> sketches_;
+  MemoryPool* pool_;
+};
+
 // ----------------------------------------------------------------------
 // One implementation
 
@@ -2690,6 +3189,229 @@ struct GroupedListFactory {
   HashAggregateKernel kernel;
   InputType argument_type;
 };
+
+// ----------------------------------------------------------------------
+// TopK/FirstN/LastN implementation
+
+enum class GroupedSelectKind { TOP_K, FIRST_N, LAST_N };
+
+// Keeps at most k values per group, in slots [g * k, (g + 1) * k) of a flat
+// buffer, so that memory is proportional to the number of groups rather than
+// to the number of rows.  For top_k, the slots of a group form a heap whose
+// root is the worst value retained; for last_n, a ring buffer.
+template <typename Type, GroupedSelectKind kind>
+struct GroupedSelectKImpl : public GroupedAggregator {
+  using CType = typename TypeTraits<Type>::CType;
+  // booleans are stored as bytes, not bits
+  using StorageType =
+      typename std::conditional<is_boolean_type<Type>::value, uint8_t, CType>::type;
+
+  Status Init(ExecContext* ctx, const std::vector<ValueDescr>& inputs,
+              const FunctionOptions* options) override {
+    const auto& select_k_options = checked_cast<const SelectKOptions&>(*options);
+    k_ = select_k_options.k;
+    if (k_ < 0) {
+      return Status::Invalid(kind_name(), " requires a nonnegative `k`, got ", k_);
+    }
+    if (kind == GroupedSelectKind::TOP_K) {
+      if (select_k_options.sort_keys.empty()) {
+        return Status::Invalid(kind_name(), " requires a non-empty `sort_keys`");
+      }
+      order_ = select_k_options.sort_keys[0].order;
+    }
+    type_ = inputs[0].type;
+    pool_ = ctx->memory_pool();
+    values_ = TypedBufferBuilder<StorageType>(pool_);
+    counts_ = TypedBufferBuilder<int64_t>(pool_);
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    auto added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    RETURN_NOT_OK(values_.Append(added_groups * k_, StorageType{}));
+    return counts_.Append(added_groups, 0);
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    VisitGroupedValues<Type>(
+        batch, [&](uint32_t g, CType value) { Add(g, static_cast<StorageType>(value)); },
+        [](uint32_t) {});
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedSelectKImpl*>(&raw_other);
+    const StorageType* other_values = other->values_.data();
+    const int64_t* other_counts = other->counts_.data();
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      const StorageType* slots = other_values + other_g * k_;
+      const int64_t count = other_counts[other_g];
+      const int64_t size = std::min(count, k_);
+      // for last_n, replay the other ring buffer from its oldest value
+      const int64_t start =
+          (kind == GroupedSelectKind::LAST_N && count > k_) ? count % k_ : 0;
+      for (int64_t i = 0; i < size; ++i) {
+        Add(*g, slots[(start + i) % k_]);
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    StorageType* values = values_.mutable_data();
+    const int64_t* counts = counts_.data();
+
+    TypedBufferBuilder<CType> out_values(pool_);
+    TypedBufferBuilder<int32_t> offsets_builder(pool_);
+    RETURN_NOT_OK(offsets_builder.Reserve(num_groups_ + 1));
+    offsets_builder.UnsafeAppend(0);
+    int32_t num_values = 0;
+    for (int64_t g = 0; g < num_groups_; ++g) {
+      StorageType* slots = values + g * k_;
+      const int64_t size = std::min(counts[g], k_);
+      if (kind == GroupedSelectKind::TOP_K) {
+        // best values first
+        std::sort_heap(slots, slots + size, better());
+      } else if (kind == GroupedSelectKind::LAST_N && counts[g] > k_) {
+        std::rotate(slots, slots + counts[g] % k_, slots + k_);
+      }
+      RETURN_NOT_OK(out_values.Reserve(size));
+      for (int64_t i = 0; i < size; ++i) {
+        out_values.UnsafeAppend(static_cast<CType>(slots[i]));
+      }
+      num_values += static_cast<int32_t>(size);
+      offsets_builder.UnsafeAppend(num_values);
+    }
+    values_.Reset();
+
+    ARROW_ASSIGN_OR_RAISE(auto values_buffer, out_values.Finish());
+    ARROW_ASSIGN_OR_RAISE(auto offsets, offsets_builder.Finish());
+    auto child = ArrayData::Make(type_, num_values, {nullptr, std::move(values_buffer)},
+                                 /*null_count=*/0);
+    return ArrayData::Make(out_type(), num_groups_, {nullptr, std::move(offsets)},
+                           {std::move(child)}, /*null_count=*/0);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return list(type_); }
+
+  static const char* kind_name() {
+    return kind == GroupedSelectKind::TOP_K
+               ? "hash_top_k"
+               : (kind == GroupedSelectKind::FIRST_N ? "hash_first_n" : "hash_last_n");
+  }
+
+  // NaNs are ordered after all other values, whatever the sort order
+  struct Better {
+    bool operator()(StorageType left, StorageType right) const {
+      if (is_nan(right)) return !is_nan(left);
+      if (is_nan(left)) return false;
+      return order == SortOrder::Ascending ? left < right : right < left;
+    }
+    static bool is_nan(StorageType v) { return is_floating_type<Type>::value && v != v; }
+
+    SortOrder order;
+  };
+
+  Better better() const { return Better{order_}; }
+
+  void Add(uint32_t g, StorageType value) {
+    StorageType* slots = values_.mutable_data() + g * k_;
+    int64_t* count = counts_.mutable_data() + g;
+    switch (kind) {
+      case GroupedSelectKind::TOP_K:
+        if (*count < k_) {
+          slots[(*count)++] = value;
+          std::push_heap(slots, slots + *count, better());
+        } else if (k_ > 0 && better()(value, slots[0])) {
+          std::pop_heap(slots, slots + k_, better());
+          slots[k_ - 1] = value;
+          std::push_heap(slots, slots + k_, better());
+        }
+        break;
+      case GroupedSelectKind::FIRST_N:
+        if (*count < k_) {
+          slots[(*count)++] = value;
+        }
+        break;
+      case GroupedSelectKind::LAST_N:
+        if (k_ > 0) {
+          slots[(*count)++ % k_] = value;
+        }
+        break;
+    }
+  }
+
+  int64_t k_;
+  SortOrder order_ = SortOrder::Descending;
+  std::shared_ptr<DataType> type_;
+  int64_t num_groups_ = 0;
+  TypedBufferBuilder<StorageType> values_;
+  // number of values consumed per group, retained or not
+  TypedBufferBuilder<int64_t> counts_;
+  MemoryPool* pool_;
+};
+
+template <GroupedSelectKind kind>
+struct GroupedSelectKFactory {
+  template <typename T>
+  enable_if_physical_integer<T, Status> Visit(const T&) {
+    using PhysicalType = typename T::PhysicalType;
+    kernel = MakeKernel(std::move(argument_type),
+                        HashAggregateInit<GroupedSelectKImpl<PhysicalType, kind>>);
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_floating_point<T, Status> Visit(const T&) {
+    kernel = MakeKernel(std::move(argument_type),
+                        HashAggregateInit<GroupedSelectKImpl<T, kind>>);
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_decimal<T, Status> Visit(const T&) {
+    kernel = MakeKernel(std::move(argument_type),
+                        HashAggregateInit<GroupedSelectKImpl<T, kind>>);
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    kernel = MakeKernel(std::move(argument_type),
+                        HashAggregateInit<GroupedSelectKImpl<BooleanType, kind>>);
+    return Status::OK();
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Status::NotImplemented("Selecting values of type ", type);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Selecting values of type ", type);
+  }
+
+  static Result<HashAggregateKernel> Make(const std::shared_ptr<DataType>& type) {
+    GroupedSelectKFactory factory;
+    factory.argument_type = InputType::Array(type->id());
+    RETURN_NOT_OK(VisitTypeInline(*type, &factory));
+    return std::move(factory.kernel);
+  }
+
+  HashAggregateKernel kernel;
+  InputType argument_type;
+};
+
+template <GroupedSelectKind kind>
+void AddSelectKKernels(HashAggregateFunction* func) {
+  auto make = GroupedSelectKFactory<kind>::Make;
+  DCHECK_OK(AddHashAggKernels(NumericTypes(), make, func));
+  DCHECK_OK(AddHashAggKernels(TemporalTypes(), make, func));
+  DCHECK_OK(AddHashAggKernels(
+      {boolean(), decimal128(1, 1), decimal256(1, 1), month_interval()}, make, func));
+}
 }  // namespace
 
 namespace {
@@ -2754,6 +3476,28 @@ const FunctionDoc hash_approximate_median_doc{
     {"array", "group_id_array"},
     "ScalarAggregateOptions"};
 
+const FunctionDoc hash_quantile_doc{
+    "Compute quantiles of values in each group",
+    ("By default, the 0.5 quantile (i.e. median) is returned.\n"
+     "If a quantile lies between two data points, an interpolated value is\n"
+     "returned based on the selected interpolation method.\n"
+     "Nulls and NaNs are ignored.\n"
+     "Nulls are returned if there are no valid data points."),
+    {"array", "group_id_array"},
+    "QuantileOptions"};
+
+const FunctionDoc hash_mode_doc{
+    "Compute the modal (most common) values of each group",
+    ("Compute the n most common values of each group, and their respective\n"
+     "occurrence counts.  The output has type `list<struct<mode: T, count: int64>>`,\n"
+     "where T is the input type.\n"
+     "The results are ordered by descending `count` first, and ascending `mode`\n"
+     "when breaking ties.\n"
+     "Nulls are ignored.  If there are no non-null values in a group,\n"
+     "an empty list is returned."),
+    {"array", "group_id_array"},
+    "ModeOptions"};
+
 const FunctionDoc hash_min_max_doc{
     "Compute the minimum and maximum of values in each group",
     ("Null values are ignored by default.\n"
@@ -2785,6 +3529,14 @@ const FunctionDoc hash_count_distinct_doc{
     {"array", "group_id_array"},
     "CountOptions"};
 
+const FunctionDoc hash_approximate_count_distinct_doc{
+    "Approximate the number of distinct values in each group",
+    ("Nulls are not counted.  The counts are estimated with HyperLogLog++\n"
+     "sketches, whose precision is set in ApproximateCountDistinctOptions.\n"
+     "NaNs and signed zeroes are not normalized."),
+    {"array", "group_id_array"},
+    "ApproximateCountDistinctOptions"};
+
 const FunctionDoc hash_distinct_doc{
     "Keep the distinct values in each group",
     ("Whether nulls/values are kept is controlled by CountOptions.\n"
@@ -2799,6 +3551,33 @@ const FunctionDoc hash_one_doc{"Get one value from each group",
 const FunctionDoc hash_list_doc{"List all values in each group",
                                 ("Null values are also returned."),
                                 {"array", "group_id_array"}};
+
+const FunctionDoc hash_top_k_doc{
+    "Select the first `k` ordered values of each group",
+    ("The values of each group are ordered as specified by the first sort key\n"
+     "of `options.sort_keys`, and at most `k` values are kept.\n"
+     "Null values are ignored.  NaNs are ordered after any other value."),
+    {"array", "group_id_array"},
+    "SelectKOptions",
+    /*options_required=*/true};
+
+const FunctionDoc hash_first_n_doc{
+    "Get the first `k` values of each group",
+    ("Values are returned in input order, which is only defined when the\n"
+     "input is consumed serially.  `options.sort_keys` is ignored.\n"
+     "Null values are ignored."),
+    {"array", "group_id_array"},
+    "SelectKOptions",
+    /*options_required=*/true};
+
+const FunctionDoc hash_last_n_doc{
+    "Get the last `k` values of each group",
+    ("Values are returned in input order, which is only defined when the\n"
+     "input is consumed serially.  `options.sort_keys` is ignored.\n"
+     "Null values are ignored."),
+    {"array", "group_id_array"},
+    "SelectKOptions",
+    /*options_required=*/true};
 }  // namespace
 
 void RegisterHashAggregateBasic(FunctionRegistry* registry) {
@@ -2918,6 +3697,29 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 
+  {
+    static auto default_quantile_options = QuantileOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_quantile", Arity::Binary(), hash_quantile_doc, &default_quantile_options);
+    DCHECK_OK(
+        AddHashAggKernels(NumericTypes(), GroupedQuantileFactory::Make, func.get()));
+    // Type parameters are ignored
+    DCHECK_OK(AddHashAggKernels({decimal128(1, 1), decimal256(1, 1)},
+                                GroupedQuantileFactory::Make, func.get()));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    static auto default_mode_options = ModeOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_mode", Arity::Binary(), hash_mode_doc, &default_mode_options);
+    DCHECK_OK(AddHashAggKernels(NumericTypes(), GroupedModeFactory::Make, func.get()));
+    // Type parameters are ignored
+    DCHECK_OK(AddHashAggKernels({boolean(), decimal128(1, 1), decimal256(1, 1)},
+                                GroupedModeFactory::Make, func.get()));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
   HashAggregateFunction* min_max_func = nullptr;
   {
     auto func = std::make_shared<HashAggregateFunction>(
@@ -2974,6 +3776,17 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 
+  {
+    static auto default_approximate_count_distinct_options =
+        ApproximateCountDistinctOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_approximate_count_distinct", Arity::Binary(),
+        hash_approximate_count_distinct_doc, &default_approximate_count_distinct_options);
+    DCHECK_OK(func->AddKernel(MakeKernel(
+        ValueDescr::ANY, HashAggregateInit<GroupedApproximateCountDistinctImpl>)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
   {
     auto func = std::make_shared<HashAggregateFunction>(
         "hash_distinct", Arity::Binary(), hash_distinct_doc, &default_count_options);
@@ -3005,6 +3818,27 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
                                 GroupedListFactory::Make, func.get()));
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_top_k", Arity::Binary(),
+                                                        hash_top_k_doc);
+    AddSelectKKernels<GroupedSelectKind::TOP_K>(func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_first_n", Arity::Binary(),
+                                                        hash_first_n_doc);
+    AddSelectKKernels<GroupedSelectKind::FIRST_N>(func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_last_n", Arity::Binary(),
+                                                        hash_last_n_doc);
+    AddSelectKKernels<GroupedSelectKind::LAST_N>(func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
 }
 
 }  // namespace internal
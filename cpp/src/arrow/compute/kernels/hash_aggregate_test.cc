@@ -35,8 +35,10 @@
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec/aggregate.h"
 #include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/key_hash.h"
 #include "arrow/compute/exec/options.h"
 #include "arrow/compute/exec/test_util.h"
+#include "arrow/compute/exec/util.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/kernels/codegen_internal.h"
@@ -584,6 +586,99 @@ TEST(Grouper, DoubleStringInt64Key) {
   g.ExpectConsume(R"([[-0.0, "be", 7], [0.0, "be", 7]])", "[3, 4]");
 }
 
+// Attach the Hashing32 hashes of all the values of a batch, or the given hashes
+ExecBatch WithKeyHashes(ExecBatch batch, std::vector<uint32_t> hashes = {}) {
+  if (hashes.empty()) {
+    util::TempVectorStack stack;
+    ARROW_EXPECT_OK(stack.Init(default_memory_pool(),
+                               4 * util::MiniBatch::kMiniBatchLength * sizeof(uint32_t)));
+    hashes.resize(batch.length);
+    ARROW_EXPECT_OK(Hashing32::HashBatch(
+        batch, hashes.data(), arrow::internal::CpuInfo::GetInstance()->hardware_flags(),
+        &stack, 0, batch.length));
+  }
+  auto key_hashes = std::make_shared<KeyHashes>();
+  for (const auto& value : batch.values) {
+    key_hashes->keys.push_back(value.array());
+  }
+  key_hashes->hashes = Buffer::FromString(std::string(
+      reinterpret_cast<const char*>(hashes.data()), hashes.size() * sizeof(uint32_t)));
+  batch.key_hashes = std::move(key_hashes);
+  return batch;
+}
+
+TEST(Grouper, PrecomputedKeyHashes) {
+  std::vector<ValueDescr> descrs = {utf8(), int64(), boolean()};
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make(descrs));
+
+  ExecBatch keys = ExecBatchFromJSON(descrs, R"([
+    ["ex", 0, true], ["why", null, false], [null, 1, null], ["ex", 0, true]
+  ])");
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(keys));
+  AssertDatumsEqual(ArrayFromJSON(uint32(), "[0, 1, 2, 0]"), ids);
+
+  // The hashes computed upstream match those of the grouper
+  const std::string more_keys_json =
+      R"([["why", null, false], ["zed", 2, true], ["ex", 0, true]])";
+  ExecBatch more_keys = ExecBatchFromJSON(descrs, more_keys_json);
+  ASSERT_OK_AND_ASSIGN(ids, grouper->Consume(WithKeyHashes(more_keys)));
+  AssertDatumsEqual(ArrayFromJSON(uint32(), "[1, 3, 0]"), ids);
+  ASSERT_OK_AND_ASSIGN(ids, grouper->Consume(WithKeyHashes(more_keys).Slice(1, 2)));
+  AssertDatumsEqual(ArrayFromJSON(uint32(), "[3, 0]"), ids);
+
+  // Hashes of other columns are not used
+  ExecBatch other_keys =
+      WithKeyHashes(ExecBatchFromJSON(descrs, more_keys_json), {0, 0, 0});
+  other_keys.values = more_keys.values;
+  ASSERT_OK_AND_ASSIGN(ids, grouper->Consume(other_keys));
+  AssertDatumsEqual(ArrayFromJSON(uint32(), "[1, 3, 0]"), ids);
+
+#if ARROW_LITTLE_ENDIAN
+  // The hashes of the keys are used instead of hashing them: with differing hashes,
+  // the keys are not found
+  ASSERT_OK_AND_ASSIGN(ids, grouper->Consume(WithKeyHashes(more_keys, {0, 0, 0})));
+  AssertDatumsEqual(ArrayFromJSON(uint32(), "[4, 5, 6]"), ids);
+#endif
+}
+
+TEST(Grouper, SmallRangeKeys) {
+  // The ranges of the keys grow with the batches, without renumbering the groups
+  TestGrouper g({int16(), boolean()});
+
+  g.ExpectConsume("[[3, true], [3, true], [4, null]]", "[0, 0, 1]");
+  g.ExpectUniques("[[3, true], [4, null]]");
+
+  g.ExpectConsume("[[-300, false], [4, null], [null, true], [300, true], [3, true]]",
+                  "[2, 1, 3, 4, 0]");
+  g.ExpectUniques("[[3, true], [4, null], [-300, false], [null, true], [300, true]]");
+
+  g.ExpectConsume("[[null, null], [-300, false], [4, true]]", "[5, 2, 6]");
+  g.ExpectUniques(
+      "[[3, true], [4, null], [-300, false], [null, true], [300, true], [null, null], "
+      "[4, true]]");
+}
+
+TEST(Grouper, WideRangeKeys) {
+  // Past the small ranges, the groups are moved to a hashing grouper
+  TestGrouper g({int64(), uint8()});
+
+  g.ExpectConsume("[[1, 1], [2, 2], [1, 1], [null, 2]]", "[0, 1, 0, 2]");
+
+  g.ExpectConsume("[[2, 2], [1000000000000, 1], [null, 2], [-1000000000000, null]]",
+                  "[1, 3, 2, 4]");
+  g.ExpectUniques(
+      "[[1, 1], [2, 2], [null, 2], [1000000000000, 1], [-1000000000000, null]]");
+
+  g.ExpectConsume("[[1, 1], [1000000000000, 1], [5, 5]]", "[0, 3, 5]");
+
+  g = TestGrouper({int32(), int32()});
+
+  // Each range fits, but not their product
+  g.ExpectConsume("[[0, 0], [1000, 1000]]", "[0, 1]");
+  g.ExpectConsume("[[1000, 1000], [0, 0], [0, 1000]]", "[1, 0, 2]");
+  g.ExpectUniques("[[0, 0], [1000, 1000], [0, 1000]]");
+}
+
 TEST(Grouper, RandomInt64Keys) {
   TestGrouper g({int64()});
   for (int i = 0; i < 4; ++i) {
@@ -1447,6 +1542,295 @@ TEST(GroupBy, ApproximateMedian) {
   }
 }
 
+TEST(GroupBy, Quantile) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("argument", float64()), field("key", int64())}), R"([
+    [1,    1],
+    [null, 1],
+    [0,    2],
+    [null, 3],
+    [1,    4],
+    [4,    null],
+    [3,    1],
+    [0,    2],
+    [-1,   2],
+    [1,    null],
+    [NaN,  3],
+    [1,    4],
+    [1,    4],
+    [null, 4]
+  ])");
+
+  auto lower = std::make_shared<QuantileOptions>(std::vector<double>{0.5, 0.25},
+                                                 QuantileOptions::LOWER);
+  auto keep_nulls = std::make_shared<QuantileOptions>(
+      /*q=*/0.5, QuantileOptions::LINEAR, /*skip_nulls=*/false, /*min_count=*/0);
+  auto min_count = std::make_shared<QuantileOptions>(
+      /*q=*/0.5, QuantileOptions::LINEAR, /*skip_nulls=*/true, /*min_count=*/3);
+  auto keep_nulls_min_count = std::make_shared<QuantileOptions>(
+      /*q=*/0.5, QuantileOptions::LINEAR, /*skip_nulls=*/false, /*min_count=*/3);
+  for (bool use_threads : {false, true}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+    ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                         GroupByTest(
+                             {
+                                 batch->GetColumnByName("argument"),
+                                 batch->GetColumnByName("argument"),
+                                 batch->GetColumnByName("argument"),
+                                 batch->GetColumnByName("argument"),
+                                 batch->GetColumnByName("argument"),
+                             },
+                             {
+                                 batch->GetColumnByName("key"),
+                             },
+                             {
+                                 {"hash_quantile", nullptr},
+                                 {"hash_quantile", lower},
+                                 {"hash_quantile", keep_nulls},
+                                 {"hash_quantile", min_count},
+                                 {"hash_quantile", keep_nulls_min_count},
+                             },
+                             use_threads));
+    SortBy({"key_0"}, &aggregated_and_grouped);
+
+    AssertDatumsApproxEqual(
+        ArrayFromJSON(struct_({
+                          field("hash_quantile", fixed_size_list(float64(), 1)),
+                          field("hash_quantile", fixed_size_list(float64(), 2)),
+                          field("hash_quantile", fixed_size_list(float64(), 1)),
+                          field("hash_quantile", fixed_size_list(float64(), 1)),
+                          field("hash_quantile", fixed_size_list(float64(), 1)),
+                          field("key_0", int64()),
+                      }),
+                      R"([
+    [[2.0],  [1.0, 1.0],    [null], [null], [null], 1],
+    [[0.0],  [0.0, -1.0],   [0.0],  [0.0],  [0.0],  2],
+    [[null], [null, null],  [null], [null], [null], 3],
+    [[1.0],  [1.0, 1.0],    [null], [1.0],  [null], 4],
+    [[2.5],  [1.0, 1.0],    [2.5],  [null], [null], null]
+  ])"),
+        aggregated_and_grouped,
+        /*verbose=*/true);
+  }
+}
+
+TEST(GroupBy, QuantileDataPoint) {
+  for (const auto& type : {int32(), decimal128(3, 1)}) {
+    auto batch =
+        RecordBatchFromJSON(schema({field("argument", type), field("key", int64())}),
+                            type->id() == Type::INT32 ? R"([
+    [1,  1],
+    [5,  2],
+    [3,  1],
+    [2,  1],
+    [-4, 2]
+  ])"
+                                                      : R"([
+    ["1.0",  1],
+    ["5.0",  2],
+    ["3.0",  1],
+    ["2.0",  1],
+    ["-4.0", 2]
+  ])");
+
+    auto options = std::make_shared<QuantileOptions>(std::vector<double>{0.25, 1.0},
+                                                     QuantileOptions::NEAREST);
+    ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                         GroupByTest({batch->GetColumnByName("argument")},
+                                     {batch->GetColumnByName("key")},
+                                     {{"hash_quantile", options}},
+                                     /*use_threads=*/false));
+
+    auto expected = ArrayFromJSON(struct_({
+                                      field("hash_quantile", fixed_size_list(type, 2)),
+                                      field("key_0", int64()),
+                                  }),
+                                  type->id() == Type::INT32 ? R"([
+    [[1, 3],  1],
+    [[-4, 5], 2]
+  ])"
+                                                            : R"([
+    [["1.0", "3.0"],  1],
+    [["-4.0", "5.0"], 2]
+  ])");
+    AssertDatumsEqual(expected, aggregated_and_grouped, /*verbose=*/true);
+  }
+}
+
+TEST(GroupBy, Mode) {
+  for (const auto& type : {int32(), float64()}) {
+    auto batch =
+        RecordBatchFromJSON(schema({field("argument", type), field("key", int64())}), R"([
+    [1,    1],
+    [null, 1],
+    [0,    2],
+    [null, 3],
+    [1,    4],
+    [4,    null],
+    [3,    1],
+    [0,    2],
+    [-1,   2],
+    [1,    null],
+    [null, 3],
+    [1,    4],
+    [1,    4],
+    [null, 4]
+  ])");
+
+    auto two = std::make_shared<ModeOptions>(/*n=*/2);
+    auto keep_nulls =
+        std::make_shared<ModeOptions>(/*n=*/1, /*skip_nulls=*/false, /*min_count=*/0);
+    auto min_count =
+        std::make_shared<ModeOptions>(/*n=*/1, /*skip_nulls=*/true, /*min_count=*/3);
+    for (bool use_threads : {false, true}) {
+      SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+      ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                           GroupByTest(
+                               {
+                                   batch->GetColumnByName("argument"),
+                                   batch->GetColumnByName("argument"),
+                                   batch->GetColumnByName("argument"),
+                                   batch->GetColumnByName("argument"),
+                               },
+                               {
+                                   batch->GetColumnByName("key"),
+                               },
+                               {
+                                   {"hash_mode", nullptr},
+                                   {"hash_mode", two},
+                                   {"hash_mode", keep_nulls},
+                                   {"hash_mode", min_count},
+                               },
+                               use_threads));
+      SortBy({"key_0"}, &aggregated_and_grouped);
+
+      auto mode_type = list(struct_({field("mode", type), field("count", int64())}));
+      AssertDatumsEqual(ArrayFromJSON(struct_({
+                                          field("hash_mode", mode_type),
+                                          field("hash_mode", mode_type),
+                                          field("hash_mode", mode_type),
+                                          field("hash_mode", mode_type),
+                                          field("key_0", int64()),
+                                      }),
+                                      R"([
+    [[[1, 1]], [[1, 1], [3, 1]],  [],       [],       1],
+    [[[0, 2]], [[0, 2], [-1, 1]], [[0, 2]], [[0, 2]], 2],
+    [[],       [],                [],       [],       3],
+    [[[1, 3]], [[1, 3]],          [],       [[1, 3]], 4],
+    [[[1, 1]], [[1, 1], [4, 1]],  [[1, 1]], [],       null]
+  ])"),
+                        aggregated_and_grouped,
+                        /*verbose=*/true);
+    }
+  }
+}
+
+TEST(GroupBy, TopK) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("argument", float64()), field("key", int64())}), R"([
+    [3,    1],
+    [null, 1],
+    [1,    2],
+    [5,    1],
+    [NaN,  2],
+    [2,    1],
+    [4,    2],
+    [null, 3],
+    [6,    null],
+    [1,    1]
+  ])");
+
+  auto top = std::make_shared<SelectKOptions>(SelectKOptions::TopKDefault(/*k=*/2));
+  auto bottom = std::make_shared<SelectKOptions>(SelectKOptions::BottomKDefault(/*k=*/3));
+  auto first = std::make_shared<SelectKOptions>(/*k=*/3);
+  auto last = std::make_shared<SelectKOptions>(/*k=*/3);
+  for (bool use_threads : {false, true}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+    ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                         GroupByTest(
+                             {
+                                 batch->GetColumnByName("argument"),
+                                 batch->GetColumnByName("argument"),
+                                 batch->GetColumnByName("argument"),
+                                 batch->GetColumnByName("argument"),
+                             },
+                             {
+                                 batch->GetColumnByName("key"),
+                             },
+                             {
+                                 {"hash_top_k", top},
+                                 {"hash_top_k", bottom},
+                                 {"hash_first_n", first},
+                                 {"hash_last_n", last},
+                             },
+                             use_threads));
+    SortBy({"key_0"}, &aggregated_and_grouped);
+
+    // NaNs are ordered last, whatever the order
+    AssertDatumsApproxEqual(ArrayFromJSON(struct_({
+                                              field("hash_top_k", list(float64())),
+                                              field("hash_top_k", list(float64())),
+                                              field("hash_first_n", list(float64())),
+                                              field("hash_last_n", list(float64())),
+                                              field("key_0", int64()),
+                                          }),
+                                          R"([
+    [[5, 3], [1, 2, 3],   [3, 5, 2],   [5, 2, 1],   1],
+    [[4, 1], [1, 4, NaN], [1, NaN, 4], [1, NaN, 4], 2],
+    [[],     [],          [],          [],          3],
+    [[6],    [6],         [6],         [6],         null]
+  ])"),
+                            aggregated_and_grouped,
+                            /*verbose=*/true, EqualOptions().nans_equal(true));
+  }
+}
+
+TEST(GroupBy, TopKTypes) {
+  for (const auto& type : {int16(), date32(), timestamp(TimeUnit::MILLI)}) {
+    auto table = TableFromJSON(schema({field("argument", type), field("key", int64())}),
+                               {R"([[10, 1], [1, 2], [7, 1]])",
+                                R"([[12, 1], [null, 2], [3, 2]])"});
+
+    auto top = std::make_shared<SelectKOptions>(SelectKOptions::TopKDefault(/*k=*/2));
+    auto last = std::make_shared<SelectKOptions>(/*k=*/2);
+    ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                         GroupByTest({table->GetColumnByName("argument"),
+                                      table->GetColumnByName("argument")},
+                                     {table->GetColumnByName("key")},
+                                     {
+                                         {"hash_top_k", top},
+                                         {"hash_last_n", last},
+                                     },
+                                     /*use_threads=*/false));
+
+    AssertDatumsEqual(ArrayFromJSON(struct_({
+                                        field("hash_top_k", list(type)),
+                                        field("hash_last_n", list(type)),
+                                        field("key_0", int64()),
+                                    }),
+                                    R"([
+    [[12, 10], [7, 12], 1],
+    [[3, 1],   [1, 3],  2]
+  ])"),
+                      aggregated_and_grouped, /*verbose=*/true);
+  }
+}
+
+TEST(GroupBy, TopKErrors) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("argument", float64()), field("key", int64())}), R"([[1, 1]])");
+  auto negative = std::make_shared<SelectKOptions>(/*k=*/-1);
+  auto no_sort_keys = std::make_shared<SelectKOptions>(/*k=*/1);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("requires a nonnegative `k`"),
+      GroupByTest({batch->GetColumnByName("argument")}, {batch->GetColumnByName("key")},
+                  {{"hash_first_n", negative}}, /*use_threads=*/false));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("requires a non-empty `sort_keys`"),
+      GroupByTest({batch->GetColumnByName("argument")}, {batch->GetColumnByName("key")},
+                  {{"hash_top_k", no_sort_keys}}, /*use_threads=*/false));
+}
+
 TEST(GroupBy, StddevVarianceTDigestScalar) {
   BatchesWithSchema input;
   input.batches = {
@@ -2327,6 +2711,117 @@ TEST(GroupBy, CountDistinct) {
   }
 }
 
+TEST(GroupBy, ApproximateCountDistinct) {
+  auto low_precision = std::make_shared<ApproximateCountDistinctOptions>(8);
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+
+    auto table =
+        TableFromJSON(schema({field("argument", utf8()), field("key", int64())}), {R"([
+    ["foo",  1],
+    ["foo",  1]
+])",
+                                                                                   R"([
+    ["bar",  2],
+    [null,   3],
+    [null,   3]
+])",
+                                                                                   R"([
+    [null, 4],
+    [null, 4]
+])",
+                                                                                   R"([
+    ["baz",  null],
+    ["foo",  3]
+])",
+                                                                                   R"([
+    ["bar",  2],
+    ["spam", 2]
+])",
+                                                                                   R"([
+    ["eggs", null],
+    ["a long value to not inline", 3]
+  ])",
+                                                                                   R"([
+    ["a",    null],
+    ["b",    null]
+  ])"});
+
+    // Small counts are exact
+    ASSERT_OK_AND_ASSIGN(
+        Datum aggregated_and_grouped,
+        internal::GroupBy(
+            {
+                table->GetColumnByName("argument"),
+                table->GetColumnByName("argument"),
+            },
+            {
+                table->GetColumnByName("key"),
+            },
+            {
+                {"hash_approximate_count_distinct", nullptr, "agg_0",
+                 "hash_approximate_count_distinct"},
+                {"hash_approximate_count_distinct", low_precision, "agg_1",
+                 "hash_approximate_count_distinct"},
+            },
+            use_threads));
+    SortBy({"key_0"}, &aggregated_and_grouped);
+    ValidateOutput(aggregated_and_grouped);
+
+    AssertDatumsEqual(ArrayFromJSON(struct_({
+                                        field("hash_approximate_count_distinct", int64()),
+                                        field("hash_approximate_count_distinct", int64()),
+                                        field("key_0", int64()),
+                                    }),
+                                    R"([
+    [1, 1, 1],
+    [2, 2, 2],
+    [2, 2, 3],
+    [0, 0, 4],
+    [4, 4, null]
+  ])"),
+                      aggregated_and_grouped,
+                      /*verbose=*/true);
+  }
+}
+
+TEST(GroupBy, ApproximateCountDistinctRandom) {
+  // Compare with the exact counts
+  auto rand = random::RandomArrayGenerator(0xbadf00d);
+  const int64_t length = 100000;
+  auto argument = rand.Numeric<Int64Type>(length, 0, 20000, /*null_probability=*/0.1);
+  auto key = rand.Numeric<Int64Type>(length, 0, 3, /*null_probability=*/0.0);
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+    ASSERT_OK_AND_ASSIGN(
+        Datum approx,
+        internal::GroupBy({argument}, {key},
+                          {{"hash_approximate_count_distinct", nullptr, "agg_0",
+                            "hash_approximate_count_distinct"}},
+                          use_threads));
+    SortBy({"key_0"}, &approx);
+    ASSERT_OK_AND_ASSIGN(
+        Datum exact,
+        internal::GroupBy({argument}, {key},
+                          {{"hash_count_distinct", nullptr, "agg_0",
+                            "hash_count_distinct"}},
+                          use_threads));
+    SortBy({"key_0"}, &exact);
+
+    const auto& approx_counts =
+        checked_cast<const Int64Array&>(*approx.array_as<StructArray>()->field(0));
+    const auto& exact_counts =
+        checked_cast<const Int64Array&>(*exact.array_as<StructArray>()->field(0));
+    ASSERT_EQ(approx_counts.length(), exact_counts.length());
+    for (int64_t i = 0; i < exact_counts.length(); ++i) {
+      const auto expected = static_cast<double>(exact_counts.Value(i));
+      // Well within 4 standard errors of the default precision
+      EXPECT_NEAR(static_cast<double>(approx_counts.Value(i)), expected,
+                  0.04 * expected + 1);
+    }
+  }
+}
+
 TEST(GroupBy, Distinct) {
   auto all = std::make_shared<CountOptions>(CountOptions::ALL);
   auto only_valid = std::make_shared<CountOptions>(CountOptions::ONLY_VALID);
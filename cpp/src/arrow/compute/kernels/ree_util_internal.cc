@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/ree_util_internal.h"
+
+#include <limits>
+#include <utility>
+
+#include "arrow/array/array_base.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace internal {
+
+namespace {
+
+template <typename RunEndCType>
+Result<std::shared_ptr<ArrayData>> MakeTypedRunEndsArray(
+    const std::shared_ptr<DataType>& run_end_type, const std::vector<int64_t>& run_ends,
+    MemoryPool* pool) {
+  if (!run_ends.empty() && run_ends.back() > std::numeric_limits<RunEndCType>::max()) {
+    return Status::Invalid("Run end value ", run_ends.back(),
+                           " cannot be represented in run end type ", *run_end_type);
+  }
+  TypedBufferBuilder<RunEndCType> builder(pool);
+  RETURN_NOT_OK(builder.Reserve(static_cast<int64_t>(run_ends.size())));
+  for (int64_t run_end : run_ends) {
+    builder.UnsafeAppend(static_cast<RunEndCType>(run_end));
+  }
+  ARROW_ASSIGN_OR_RAISE(auto buffer, builder.Finish());
+  return ArrayData::Make(run_end_type, static_cast<int64_t>(run_ends.size()),
+                         {nullptr, std::move(buffer)}, /*null_count=*/0);
+}
+
+}  // namespace
+
+Result<std::shared_ptr<ArrayData>> MakeRunEndsArray(
+    const std::shared_ptr<DataType>& run_end_type, const std::vector<int64_t>& run_ends,
+    MemoryPool* pool) {
+  switch (run_end_type->id()) {
+    case Type::INT16:
+      return MakeTypedRunEndsArray<int16_t>(run_end_type, run_ends, pool);
+    case Type::INT32:
+      return MakeTypedRunEndsArray<int32_t>(run_end_type, run_ends, pool);
+    case Type::INT64:
+      return MakeTypedRunEndsArray<int64_t>(run_end_type, run_ends, pool);
+    default:
+      return Status::Invalid("Invalid run end type: ", *run_end_type);
+  }
+}
+
+Result<std::shared_ptr<ArrayData>> TakePhysical(const ArraySpan& values,
+                                                const std::vector<int64_t>& indices,
+                                                ExecContext* ctx) {
+  const auto num_indices = static_cast<int64_t>(indices.size());
+  TypedBufferBuilder<int64_t> index_builder(ctx->memory_pool());
+  TypedBufferBuilder<bool> validity_builder(ctx->memory_pool());
+  RETURN_NOT_OK(index_builder.Reserve(num_indices));
+  RETURN_NOT_OK(validity_builder.Reserve(num_indices));
+  int64_t null_count = 0;
+  for (int64_t index : indices) {
+    const bool valid = index >= 0;
+    index_builder.UnsafeAppend(valid ? index : 0);
+    validity_builder.UnsafeAppend(valid);
+    null_count += !valid;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto index_buffer, index_builder.Finish());
+  std::shared_ptr<Buffer> validity_buffer;
+  if (null_count > 0) {
+    ARROW_ASSIGN_OR_RAISE(validity_buffer, validity_builder.Finish());
+  }
+  auto index_data = ArrayData::Make(int64(), num_indices,
+                                    {std::move(validity_buffer), std::move(index_buffer)},
+                                    null_count);
+  ARROW_ASSIGN_OR_RAISE(Datum taken, Take(Datum(values.ToArrayData()), Datum(index_data),
+                                          TakeOptions::NoBoundsCheck(), ctx));
+  return taken.array();
+}
+
+std::shared_ptr<ArrayData> MakeRunEndEncodedData(std::shared_ptr<DataType> type,
+                                                 int64_t length,
+                                                 std::shared_ptr<ArrayData> run_ends,
+                                                 std::shared_ptr<ArrayData> values) {
+  auto out = ArrayData::Make(std::move(type), length, {nullptr}, /*null_count=*/0);
+  out->child_data = {std::move(run_ends), std::move(values)};
+  return out;
+}
+
+Result<std::shared_ptr<ArrayData>> RunEndEncodedBuilder::Finish(
+    const std::shared_ptr<DataType>& ree_type, const ArraySpan& values,
+    ExecContext* ctx) {
+  const auto& type = checked_cast<const RunEndEncodedType&>(*ree_type);
+  ARROW_ASSIGN_OR_RAISE(auto run_ends, MakeRunEndsArray(type.run_end_type(), run_ends_,
+                                                        ctx->memory_pool()));
+  ARROW_ASSIGN_OR_RAISE(auto taken, TakePhysical(values, indices_, ctx));
+  return MakeRunEndEncodedData(ree_type, logical_length(), std::move(run_ends),
+                               std::move(taken));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
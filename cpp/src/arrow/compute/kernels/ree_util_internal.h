@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Helpers shared by the kernels operating on run-end encoded data
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/array/data.h"
+#include "arrow/compute/type_fwd.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+/// \brief Make a run ends array of the given type, failing if the last run
+/// end is not representable in it
+Result<std::shared_ptr<ArrayData>> MakeRunEndsArray(
+    const std::shared_ptr<DataType>& run_end_type, const std::vector<int64_t>& run_ends,
+    MemoryPool* pool);
+
+/// \brief Gather values by physical index, an index of -1 emitting a null
+///
+/// `values` is the values child of a REE array (or any array) and the indices
+/// are relative to its offset.
+Result<std::shared_ptr<ArrayData>> TakePhysical(const ArraySpan& values,
+                                                const std::vector<int64_t>& indices,
+                                                ExecContext* ctx);
+
+/// \brief Assemble REE array data from its children
+std::shared_ptr<ArrayData> MakeRunEndEncodedData(std::shared_ptr<DataType> type,
+                                                 int64_t length,
+                                                 std::shared_ptr<ArrayData> run_ends,
+                                                 std::shared_ptr<ArrayData> values);
+
+/// \brief Accumulate the output of a kernel as runs of physical indices into
+/// the values of an input REE array
+///
+/// Consecutive runs referring to the same physical index (or both null) are
+/// merged, so that repeatedly appending single elements of a run still
+/// produces a single output run.
+class RunEndEncodedBuilder {
+ public:
+  /// \brief Append `length` logical elements taken from physical index
+  /// `physical_index`, or nulls when it is -1
+  void Append(int64_t physical_index, int64_t length) {
+    if (length == 0) return;
+    if (!indices_.empty() && indices_.back() == physical_index) {
+      run_ends_.back() += length;
+      return;
+    }
+    indices_.push_back(physical_index);
+    run_ends_.push_back(logical_length() + length);
+  }
+
+  int64_t logical_length() const { return run_ends_.empty() ? 0 : run_ends_.back(); }
+
+  const std::vector<int64_t>& run_ends() const { return run_ends_; }
+  const std::vector<int64_t>& physical_indices() const { return indices_; }
+
+  /// \brief Finish into an array of type `ree_type`, gathering the run values
+  /// from `values`
+  Result<std::shared_ptr<ArrayData>> Finish(const std::shared_ptr<DataType>& ree_type,
+                                            const ArraySpan& values, ExecContext* ctx);
+
+ private:
+  std::vector<int64_t> run_ends_;
+  std::vector<int64_t> indices_;
+};
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
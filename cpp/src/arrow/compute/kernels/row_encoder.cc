@@ -287,6 +287,11 @@ void RowEncoder::Init(const std::vector<ValueDescr>& column_types, ExecContext*
       continue;
     }
 
+    if (is_binary_view_like(column_type->id())) {
+      encoders_[i] = std::make_shared<VarLengthKeyEncoder<BinaryViewType>>(column_type);
+      continue;
+    }
+
     // We should not get here
     ARROW_DCHECK(false);
   }
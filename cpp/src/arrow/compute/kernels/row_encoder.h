@@ -21,6 +21,7 @@
 
 #include "arrow/compute/exec.h"
 #include "arrow/compute/kernels/codegen_internal.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/visit_data_inline.h"
 
 namespace arrow {
@@ -112,9 +113,48 @@ struct DictionaryKeyEncoder : FixedWidthKeyEncoder {
   std::shared_ptr<Array> dictionary_;
 };
 
+template <typename T, typename Enable = void>
+struct VarLengthKeyTraits {
+  using Offset = typename T::offset_type;
+
+  static Result<std::shared_ptr<ArrayData>> MakeArrayData(
+      std::shared_ptr<DataType> type, int32_t length, std::shared_ptr<Buffer> null_buf,
+      std::shared_ptr<Buffer> offset_buf, std::shared_ptr<Buffer> key_buf,
+      int32_t null_count, MemoryPool*) {
+    return ArrayData::Make(
+        std::move(type), length,
+        {std::move(null_buf), std::move(offset_buf), std::move(key_buf)}, null_count);
+  }
+};
+
+// Binary view keys are decoded with offsets like binary keys, then the views
+// are made to refer to the decoded bytes
+template <typename T>
+struct VarLengthKeyTraits<T, enable_if_binary_view_like<T>> {
+  using Offset = int32_t;
+
+  static Result<std::shared_ptr<ArrayData>> MakeArrayData(
+      std::shared_ptr<DataType> type, int32_t length, std::shared_ptr<Buffer> null_buf,
+      std::shared_ptr<Buffer> offset_buf, std::shared_ptr<Buffer> key_buf,
+      int32_t null_count, MemoryPool* pool) {
+    ARROW_ASSIGN_OR_RAISE(auto views_buf,
+                          AllocateBuffer(BinaryViewType::kSize * length, pool));
+    auto raw_views = reinterpret_cast<BinaryViewType::c_type*>(views_buf->mutable_data());
+    auto raw_offsets = reinterpret_cast<const Offset*>(offset_buf->data());
+    for (int32_t i = 0; i < length; ++i) {
+      raw_views[i] = binary_view_util::MakeView(key_buf->data() + raw_offsets[i],
+                                                raw_offsets[i + 1] - raw_offsets[i],
+                                                raw_offsets[i]);
+    }
+    return ArrayData::Make(
+        std::move(type), length,
+        {std::move(null_buf), std::move(views_buf), std::move(key_buf)}, null_count);
+  }
+};
+
 template <typename T>
 struct VarLengthKeyEncoder : KeyEncoder {
-  using Offset = typename T::offset_type;
+  using Offset = typename VarLengthKeyTraits<T>::Offset;
 
   void AddLength(const ExecValue& data, int64_t batch_length, int32_t* lengths) override {
     if (data.is_array()) {
@@ -223,9 +263,9 @@ struct VarLengthKeyEncoder : KeyEncoder {
     }
     raw_offsets[length] = current_offset;
 
-    return ArrayData::Make(
-        type_, length, {std::move(null_buf), std::move(offset_buf), std::move(key_buf)},
-        null_count);
+    return VarLengthKeyTraits<T>::MakeArrayData(type_, length, std::move(null_buf),
+                                                std::move(offset_buf),
+                                                std::move(key_buf), null_count, pool);
   }
 
   explicit VarLengthKeyEncoder(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
@@ -1139,6 +1139,86 @@ void AddDecimalUnaryKernels(ScalarFunction* func) {
   DCHECK_OK(func->AddKernel({in_type256}, out_type, exec256));
 }
 
+// Decimal128 arithmetic on values of at most 18 digits, computed on the low
+// words of the decimals as int64. Multiplication widens to 128 bits only when
+// the int64 product overflows.
+struct AddInt64Decimal {
+  template <typename T, typename Arg0, typename Arg1>
+  static T Call(KernelContext*, Arg0 left, Arg1 right, Status*) {
+    return T(static_cast<int64_t>(left.low_bits()) +
+             static_cast<int64_t>(right.low_bits()));
+  }
+};
+
+struct SubtractInt64Decimal {
+  template <typename T, typename Arg0, typename Arg1>
+  static T Call(KernelContext*, Arg0 left, Arg1 right, Status*) {
+    return T(static_cast<int64_t>(left.low_bits()) -
+             static_cast<int64_t>(right.low_bits()));
+  }
+};
+
+struct MultiplyInt64Decimal {
+  template <typename T, typename Arg0, typename Arg1>
+  static T Call(KernelContext*, Arg0 left, Arg1 right, Status*) {
+    int64_t result = 0;
+    if (ARROW_PREDICT_FALSE(MultiplyWithOverflow(static_cast<int64_t>(left.low_bits()),
+                                                 static_cast<int64_t>(right.low_bits()),
+                                                 &result))) {
+      return left * right;
+    }
+    return T(result);
+  }
+};
+
+template <typename Op>
+struct Int64DecimalOp {};
+
+template <>
+struct Int64DecimalOp<Add> {
+  using type = AddInt64Decimal;
+};
+template <>
+struct Int64DecimalOp<AddChecked> {
+  using type = AddInt64Decimal;
+};
+template <>
+struct Int64DecimalOp<Subtract> {
+  using type = SubtractInt64Decimal;
+};
+template <>
+struct Int64DecimalOp<SubtractChecked> {
+  using type = SubtractInt64Decimal;
+};
+template <>
+struct Int64DecimalOp<Multiply> {
+  using type = MultiplyInt64Decimal;
+};
+template <>
+struct Int64DecimalOp<MultiplyChecked> {
+  using type = MultiplyInt64Decimal;
+};
+
+template <typename Op, typename Int64Op>
+Status ExecDecimal128Binary(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  if (DecimalFitsInt64(*batch[0].type()) && DecimalFitsInt64(*batch[1].type())) {
+    return ScalarBinaryNotNullEqualTypes<Decimal128Type, Decimal128Type, Int64Op>::Exec(
+        ctx, batch, out);
+  }
+  return ScalarBinaryNotNullEqualTypes<Decimal128Type, Decimal128Type, Op>::Exec(
+      ctx, batch, out);
+}
+
+template <typename Op>
+ArrayKernelExec Decimal128BinaryExec(typename Int64DecimalOp<Op>::type* = NULLPTR) {
+  return ExecDecimal128Binary<Op, typename Int64DecimalOp<Op>::type>;
+}
+
+template <typename Op>
+ArrayKernelExec Decimal128BinaryExec(...) {
+  return ScalarBinaryNotNullEqualTypes<Decimal128Type, Decimal128Type, Op>::Exec;
+}
+
 template <typename Op>
 void AddDecimalBinaryKernels(const std::string& name, ScalarFunction* func) {
   OutputType out_type(null());
@@ -1155,7 +1235,7 @@ void AddDecimalBinaryKernels(const std::string& name, ScalarFunction* func) {
 
   auto in_type128 = InputType(Type::DECIMAL128);
   auto in_type256 = InputType(Type::DECIMAL256);
-  auto exec128 = ScalarBinaryNotNullEqualTypes<Decimal128Type, Decimal128Type, Op>::Exec;
+  auto exec128 = Decimal128BinaryExec<Op>(NULLPTR);
   auto exec256 = ScalarBinaryNotNullEqualTypes<Decimal256Type, Decimal256Type, Op>::Exec;
   DCHECK_OK(func->AddKernel({in_type128, in_type128}, out_type, exec128));
   DCHECK_OK(func->AddKernel({in_type256, in_type256}, out_type, exec256));
@@ -106,6 +106,24 @@ static void ArrayArrayKernel(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * array_size);
 }
 
+// Decimal128 operands of the given precision (decimals of at most 18 digits
+// are computed on as int64)
+template <BinaryOp& Op, int32_t Precision>
+static void ArrayArrayDecimal128Kernel(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(Decimal128);
+  auto type = decimal128(Precision, 2);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto lhs = rand.Decimal128(type, array_size, args.null_proportion);
+  auto rhs = rand.Decimal128(type, array_size, args.null_proportion);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(Op(lhs, rhs, ArithmeticOptions(), nullptr).status());
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
 void SetArgs(benchmark::internal::Benchmark* bench) {
   for (const auto inverse_null_proportion : std::vector<ArgsType>({100, 0})) {
     bench->Args({static_cast<ArgsType>(kL2Size), inverse_null_proportion});
@@ -155,5 +173,14 @@ DECLARE_ARITHMETIC_CHECKED_BENCHMARKS(ArrayScalarKernel, MultiplyChecked);
 DECLARE_ARITHMETIC_CHECKED_BENCHMARKS(ArrayArrayKernel, DivideChecked);
 DECLARE_ARITHMETIC_CHECKED_BENCHMARKS(ArrayScalarKernel, DivideChecked);
 
+#define DECLARE_DECIMAL128_BENCHMARKS(OP)                                \
+  BENCHMARK_TEMPLATE(ArrayArrayDecimal128Kernel, OP, 9)->Apply(SetArgs);  \
+  BENCHMARK_TEMPLATE(ArrayArrayDecimal128Kernel, OP, 18)->Apply(SetArgs); \
+  BENCHMARK_TEMPLATE(ArrayArrayDecimal128Kernel, OP, 38)->Apply(SetArgs)
+
+DECLARE_DECIMAL128_BENCHMARKS(Add);
+DECLARE_DECIMAL128_BENCHMARKS(Subtract);
+DECLARE_DECIMAL128_BENCHMARKS(Multiply);
+
 }  // namespace compute
 }  // namespace arrow
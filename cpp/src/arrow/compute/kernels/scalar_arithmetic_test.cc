@@ -2682,6 +2682,23 @@ TEST_F(TestBinaryArithmeticDecimal, Multiply) {
     CheckScalarBinary("multiply", left, right, expected);
   }
 
+  // array array, decimal128 of at most 18 digits, widened on int64 overflow
+  {
+    auto left = ArrayFromJSON(decimal128(18, 2),
+                              R"(["9999999999999999.99", "-12345.67", "0.01", null])");
+    auto right = ArrayFromJSON(decimal128(18, 2),
+                               R"(["9999999999999999.99", "100.00", "-0.01", "1.00"])");
+    auto expected = ArrayFromJSON(decimal128(37, 4),
+                                  R"([
+      "99999999999999999800000000000000.0001",
+      "-1234567.0000",
+      "-0.0001",
+      null
+    ])");
+    CheckScalarBinary("multiply", left, right, expected);
+    CheckScalarBinary("multiply_checked", left, right, expected);
+  }
+
   // array array, decimal256
   {
     auto left = ArrayFromJSON(decimal256(30, 3),
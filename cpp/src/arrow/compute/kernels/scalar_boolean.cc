@@ -30,60 +30,9 @@ namespace compute {
 
 namespace {
 
-template <typename ComputeWord>
-void ComputeKleene(ComputeWord&& compute_word, KernelContext* ctx, const ArraySpan& left,
-                   const ArraySpan& right, ArraySpan* out) {
-  DCHECK(left.GetNullCount() != 0 || right.GetNullCount() != 0)
-      << "ComputeKleene is unnecessarily expensive for the non-null case";
-
-  Bitmap left_valid_bm{left.buffers[0].data, left.offset, left.length};
-  Bitmap left_data_bm{left.buffers[1].data, left.offset, left.length};
-
-  Bitmap right_valid_bm{right.buffers[0].data, right.offset, right.length};
-  Bitmap right_data_bm{right.buffers[1].data, right.offset, right.length};
-
-  std::array<Bitmap, 2> out_bms{Bitmap(out->buffers[0].data, out->offset, out->length),
-                                Bitmap(out->buffers[1].data, out->offset, out->length)};
-
-  auto apply = [&](uint64_t left_valid, uint64_t left_data, uint64_t right_valid,
-                   uint64_t right_data, uint64_t* out_validity, uint64_t* out_data) {
-    auto left_true = left_valid & left_data;
-    auto left_false = left_valid & ~left_data;
-
-    auto right_true = right_valid & right_data;
-    auto right_false = right_valid & ~right_data;
-
-    compute_word(left_true, left_false, right_true, right_false, out_validity, out_data);
-  };
-
-  if (right.GetNullCount() == 0) {
-    std::array<Bitmap, 3> in_bms{left_valid_bm, left_data_bm, right_data_bm};
-    Bitmap::VisitWordsAndWrite(
-        in_bms, &out_bms,
-        [&](const std::array<uint64_t, 3>& in, std::array<uint64_t, 2>* out) {
-          apply(in[0], in[1], ~uint64_t(0), in[2], &(out->at(0)), &(out->at(1)));
-        });
-    return;
-  }
-
-  if (left.GetNullCount() == 0) {
-    std::array<Bitmap, 3> in_bms{left_data_bm, right_valid_bm, right_data_bm};
-    Bitmap::VisitWordsAndWrite(
-        in_bms, &out_bms,
-        [&](const std::array<uint64_t, 3>& in, std::array<uint64_t, 2>* out) {
-          apply(~uint64_t(0), in[0], in[1], in[2], &(out->at(0)), &(out->at(1)));
-        });
-    return;
-  }
-
-  DCHECK(left.GetNullCount() != 0 && right.GetNullCount() != 0);
-  std::array<Bitmap, 4> in_bms{left_valid_bm, left_data_bm, right_valid_bm,
-                               right_data_bm};
-  Bitmap::VisitWordsAndWrite(
-      in_bms, &out_bms,
-      [&](const std::array<uint64_t, 4>& in, std::array<uint64_t, 2>* out) {
-        apply(in[0], in[1], in[2], in[3], &(out->at(0)), &(out->at(1)));
-      });
+// The validity bitmap of a Kleene operand, or null if all its values are valid
+inline const uint8_t* KleeneValidity(const ArraySpan& arr) {
+  return arr.GetNullCount() != 0 ? arr.buffers[0].data : nullptr;
 }
 
 inline BooleanScalar InvertScalar(const Scalar& in) {
@@ -214,13 +163,10 @@ struct KleeneAndOp : Commutative<KleeneAndOp> {
       return AndOp::Call(ctx, left, right, out);
     }
 
-    auto compute_word = [](uint64_t left_true, uint64_t left_false, uint64_t right_true,
-                           uint64_t right_false, uint64_t* out_valid,
-                           uint64_t* out_data) {
-      *out_data = left_true & right_true;
-      *out_valid = left_false | right_false | (left_true & right_true);
-    };
-    ComputeKleene(compute_word, ctx, left, right, out_span);
+    ::arrow::internal::BitmapKleeneAnd(
+        KleeneValidity(left), left.buffers[1].data, left.offset, KleeneValidity(right),
+        right.buffers[1].data, right.offset, left.length, out_span->offset,
+        out_span->buffers[0].data, out_span->buffers[1].data);
     return Status::OK();
   }
 };
@@ -324,14 +270,10 @@ struct KleeneOrOp : Commutative<KleeneOrOp> {
       return OrOp::Call(ctx, left, right, out);
     }
 
-    static auto compute_word = [](uint64_t left_true, uint64_t left_false,
-                                  uint64_t right_true, uint64_t right_false,
-                                  uint64_t* out_valid, uint64_t* out_data) {
-      *out_data = left_true | right_true;
-      *out_valid = left_true | right_true | (left_false & right_false);
-    };
-
-    ComputeKleene(compute_word, ctx, left, right, out_span);
+    ::arrow::internal::BitmapKleeneOr(
+        KleeneValidity(left), left.buffers[1].data, left.offset, KleeneValidity(right),
+        right.buffers[1].data, right.offset, left.length, out_span->offset,
+        out_span->buffers[0].data, out_span->buffers[1].data);
     return Status::OK();
   }
 };
@@ -461,14 +403,10 @@ struct KleeneAndNotOp {
       return AndNotOp::Call(ctx, left, right, out);
     }
 
-    static auto compute_word = [](uint64_t left_true, uint64_t left_false,
-                                  uint64_t right_true, uint64_t right_false,
-                                  uint64_t* out_valid, uint64_t* out_data) {
-      *out_data = left_true & right_false;
-      *out_valid = left_false | right_true | (left_true & right_false);
-    };
-
-    ComputeKleene(compute_word, ctx, left, right, out_span);
+    ::arrow::internal::BitmapKleeneAndNot(
+        KleeneValidity(left), left.buffers[1].data, left.offset, KleeneValidity(right),
+        right.buffers[1].data, right.offset, left.length, out_span->offset,
+        out_span->buffers[0].data, out_span->buffers[1].data);
     return Status::OK();
   }
 };
@@ -24,6 +24,7 @@
 #include "arrow/compute/kernels/scalar_cast_internal.h"
 #include "arrow/compute/kernels/temporal_internal.h"
 #include "arrow/result.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/formatting.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/optional.h"
@@ -351,6 +352,104 @@ BinaryToBinaryCastExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* ou
   return ZeroCopyCastExec(ctx, batch, out);
 }
 
+// ----------------------------------------------------------------------
+// Binary views
+
+// Binary to view: the views refer to the input data buffer, so only the
+// values inlined in the views are copied
+template <typename O, typename I>
+Status BinaryToViewCastExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const CastOptions& options = checked_cast<const CastState&>(*ctx->state()).options;
+  const ArraySpan& input = batch[0].array;
+
+  if (!I::is_utf8 && O::is_utf8 && !options.allow_invalid_utf8) {
+    InitializeUTF8();
+    ArraySpanVisitor<I> visitor;
+    Utf8Validator validator;
+    RETURN_NOT_OK(visitor.Visit(input, &validator));
+  }
+
+  using offset_type = typename I::offset_type;
+  const offset_type* offsets = input.GetValues<offset_type>(1);
+  if (offsets[input.length] > std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid("Failed casting from ", input.type->ToString(), " to ",
+                           out->type()->ToString(), ": input array too large");
+  }
+  const uint8_t* data = input.buffers[2].data;
+  const uint8_t* validity = input.null_count != 0 ? input.buffers[0].data : nullptr;
+
+  ARROW_ASSIGN_OR_RAISE(auto views,
+                        ctx->Allocate(input.length * BinaryViewType::kSize));
+  auto* out_views = reinterpret_cast<BinaryViewType::c_type*>(views->mutable_data());
+  for (int64_t i = 0; i < input.length; ++i) {
+    if (validity != nullptr && !bit_util::GetBit(validity, input.offset + i)) {
+      out_views[i] = binary_view_util::MakeView(nullptr, 0, 0);
+      continue;
+    }
+    const auto offset = static_cast<int32_t>(offsets[i]);
+    out_views[i] = binary_view_util::MakeView(
+        data + offset, static_cast<int32_t>(offsets[i + 1] - offsets[i]), offset);
+  }
+
+  std::shared_ptr<Buffer> out_validity;
+  if (validity != nullptr) {
+    if (input.offset == 0) {
+      out_validity = input.GetBuffer(0);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(out_validity,
+                            arrow::internal::CopyBitmap(ctx->memory_pool(), validity,
+                                                        input.offset, input.length));
+    }
+  }
+  out->value = ArrayData::Make(out->type()->Copy(), input.length,
+                               {std::move(out_validity), std::move(views),
+                                input.GetBuffer(2)},
+                               input.null_count);
+  return Status::OK();
+}
+
+template <typename O, typename I>
+Status ViewToBinaryCastExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const CastOptions& options = checked_cast<const CastState&>(*ctx->state()).options;
+  const ArraySpan& input = batch[0].array;
+
+  if (!I::is_utf8 && O::is_utf8 && !options.allow_invalid_utf8) {
+    InitializeUTF8();
+    ArraySpanVisitor<I> visitor;
+    Utf8Validator validator;
+    RETURN_NOT_OK(visitor.Visit(input, &validator));
+  }
+
+  int64_t total_data_bytes = 0;
+  VisitArraySpanInline<I>(
+      input, [&](util::string_view v) { total_data_bytes += v.size(); }, [] {});
+
+  typename TypeTraits<O>::BuilderType builder(out->type()->Copy(), ctx->memory_pool());
+  RETURN_NOT_OK(builder.Reserve(input.length));
+  RETURN_NOT_OK(builder.ReserveData(total_data_bytes));
+  VisitArraySpanInline<I>(
+      input, [&](util::string_view v) { builder.UnsafeAppend(v); },
+      [&] { builder.UnsafeAppendNull(); });
+
+  std::shared_ptr<Array> output_array;
+  RETURN_NOT_OK(builder.Finish(&output_array));
+  out->value = std::move(output_array->data());
+  return Status::OK();
+}
+
+template <typename O, typename I>
+Status ViewToViewCastExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const CastOptions& options = checked_cast<const CastState&>(*ctx->state()).options;
+
+  if (!I::is_utf8 && O::is_utf8 && !options.allow_invalid_utf8) {
+    InitializeUTF8();
+    ArraySpanVisitor<I> visitor;
+    Utf8Validator validator;
+    RETURN_NOT_OK(visitor.Visit(batch[0].array, &validator));
+  }
+  return ZeroCopyCastExec(ctx, batch, out);
+}
+
 #if defined(_MSC_VER)
 #pragma warning(pop)
 #endif
@@ -402,6 +501,17 @@ void AddBinaryToBinaryCast(CastFunction* func) {
       NullHandling::COMPUTED_NO_PREALLOCATE));
 }
 
+template <typename OutType, typename InType>
+void AddViewCast(CastFunction* func, ArrayKernelExec exec) {
+  auto out_ty = TypeTraits<OutType>::type_singleton();
+
+  DCHECK_OK(func->AddKernel(InType::type_id, {InputType(InType::type_id)}, out_ty,
+                            TrivialScalarUnaryAsArraysExec(exec,
+                                                           /*use_array_span=*/false),
+                            NullHandling::COMPUTED_NO_PREALLOCATE,
+                            MemAllocation::NO_PREALLOCATE));
+}
+
 template <typename OutType>
 void AddBinaryToBinaryCast(CastFunction* func) {
   AddBinaryToBinaryCast<OutType, StringType>(func);
@@ -409,6 +519,20 @@ void AddBinaryToBinaryCast(CastFunction* func) {
   AddBinaryToBinaryCast<OutType, LargeStringType>(func);
   AddBinaryToBinaryCast<OutType, LargeBinaryType>(func);
   AddBinaryToBinaryCast<OutType, FixedSizeBinaryType>(func);
+  AddViewCast<OutType, StringViewType>(func, ViewToBinaryCastExec<OutType, StringViewType>);
+  AddViewCast<OutType, BinaryViewType>(func, ViewToBinaryCastExec<OutType, BinaryViewType>);
+}
+
+template <typename OutType>
+void AddBinaryToViewCast(CastFunction* func) {
+  AddViewCast<OutType, StringType>(func, BinaryToViewCastExec<OutType, StringType>);
+  AddViewCast<OutType, BinaryType>(func, BinaryToViewCastExec<OutType, BinaryType>);
+  AddViewCast<OutType, LargeStringType>(func,
+                                        BinaryToViewCastExec<OutType, LargeStringType>);
+  AddViewCast<OutType, LargeBinaryType>(func,
+                                        BinaryToViewCastExec<OutType, LargeBinaryType>);
+  AddViewCast<OutType, StringViewType>(func, ViewToViewCastExec<OutType, StringViewType>);
+  AddViewCast<OutType, BinaryViewType>(func, ViewToViewCastExec<OutType, BinaryViewType>);
 }
 
 }  // namespace
@@ -448,7 +572,18 @@ std::vector<std::shared_ptr<CastFunction>> GetBinaryLikeCasts() {
           /*use_array_span=*/false),
       NullHandling::COMPUTED_NO_PREALLOCATE));
 
-  return {cast_binary, cast_large_binary, cast_string, cast_large_string, cast_fsb};
+  auto cast_binary_view =
+      std::make_shared<CastFunction>("cast_binary_view", Type::BINARY_VIEW);
+  AddCommonCasts(Type::BINARY_VIEW, binary_view(), cast_binary_view.get());
+  AddBinaryToViewCast<BinaryViewType>(cast_binary_view.get());
+
+  auto cast_string_view =
+      std::make_shared<CastFunction>("cast_string_view", Type::STRING_VIEW);
+  AddCommonCasts(Type::STRING_VIEW, utf8_view(), cast_string_view.get());
+  AddBinaryToViewCast<StringViewType>(cast_string_view.get());
+
+  return {cast_binary,      cast_large_binary, cast_string,     cast_large_string,
+          cast_fsb,         cast_binary_view,  cast_string_view};
 }
 
 }  // namespace internal
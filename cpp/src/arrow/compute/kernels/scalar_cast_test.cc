@@ -2096,6 +2096,57 @@ TEST(Cast, StringToString) {
   }
 }
 
+TEST(Cast, BinaryToView) {
+  for (auto from_type : {utf8(), large_utf8(), binary(), large_binary()}) {
+    for (auto to_type : {utf8_view(), binary_view()}) {
+      ARROW_SCOPED_TRACE(*from_type, " -> ", *to_type);
+      CheckCast(ArrayFromJSON(from_type, "[]"), ArrayFromJSON(to_type, "[]"));
+      const char* json = R"(["a", null, "a value longer than twelve bytes"])";
+      CheckCast(ArrayFromJSON(from_type, json), ArrayFromJSON(to_type, json));
+
+      // invalid utf-8 masked by a null bit is not an error
+      CheckCast(MaskArrayWithNullsAt(InvalidUtf8(from_type), {4}),
+                MaskArrayWithNullsAt(InvalidUtf8(to_type), {4}));
+
+      // The views refer to the input data
+      auto values = ArrayFromJSON(from_type, R"(["a value longer than twelve bytes"])");
+      ASSERT_OK_AND_ASSIGN(auto views, Cast(*values, to_type));
+      ValidateOutput(*views);
+      ASSERT_EQ(values->data()->buffers[2].get(), views->data()->buffers[2].get());
+    }
+
+    auto invalid_utf8 = InvalidUtf8(from_type);
+    if (from_type->id() == Type::STRING || from_type->id() == Type::LARGE_STRING) {
+      // utf-8 is not checked by Cast when the origin guarantees utf-8
+      auto options = CastOptions::Safe(utf8_view());
+      options.allow_invalid_utf8 = true;
+      ASSERT_OK_AND_ASSIGN(auto strings, Cast(*invalid_utf8, utf8_view(), options));
+      ASSERT_RAISES(Invalid, strings->ValidateFull());
+    } else {
+      CheckCastFails(invalid_utf8, CastOptions::Safe(utf8_view()));
+    }
+  }
+}
+
+TEST(Cast, ViewToBinaryOrString) {
+  for (auto from_type : {utf8_view(), binary_view()}) {
+    for (auto to_type : {utf8(), large_utf8(), binary(), large_binary(), utf8_view(),
+                         binary_view()}) {
+      ARROW_SCOPED_TRACE(*from_type, " -> ", *to_type);
+      CheckCast(ArrayFromJSON(from_type, "[]"), ArrayFromJSON(to_type, "[]"));
+      const char* json = R"(["a", null, "a value longer than twelve bytes"])";
+      CheckCast(ArrayFromJSON(from_type, json), ArrayFromJSON(to_type, json));
+
+      // invalid utf-8 masked by a null bit is not an error
+      CheckCast(MaskArrayWithNullsAt(InvalidUtf8(from_type), {4}),
+                MaskArrayWithNullsAt(InvalidUtf8(to_type), {4}));
+    }
+  }
+
+  CheckCastFails(InvalidUtf8(binary_view()), CastOptions::Safe(utf8()));
+  CheckCastFails(InvalidUtf8(binary_view()), CastOptions::Safe(utf8_view()));
+}
+
 TEST(Cast, IntToString) {
   for (auto string_type : {utf8(), large_utf8()}) {
     CheckCast(ArrayFromJSON(int8(), "[0, 1, 127, -128, null]"),
@@ -21,9 +21,12 @@
 
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/ree_util_internal.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/optional.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow {
 
@@ -239,6 +242,295 @@ struct VarArgsCompareFunction : ScalarFunction {
   }
 };
 
+// Run-end encoded comparisons compare each pair of runs once and produce a
+// run-end encoded boolean output. The comparison of the run values is
+// delegated to the function for the value types, looked up by name (kernel
+// data can't be used as flipped functions overwrite it).
+
+template <typename Op>
+struct CompareFunctionName;
+
+template <>
+struct CompareFunctionName<Equal> {
+  static constexpr const char* kName = "equal";
+};
+
+template <>
+struct CompareFunctionName<NotEqual> {
+  static constexpr const char* kName = "not_equal";
+};
+
+template <>
+struct CompareFunctionName<Greater> {
+  static constexpr const char* kName = "greater";
+};
+
+template <>
+struct CompareFunctionName<GreaterEqual> {
+  static constexpr const char* kName = "greater_equal";
+};
+
+Result<ValueDescr> ResolveRunEndEncodedCompareOutput(
+    KernelContext*, const std::vector<ValueDescr>& descrs) {
+  const auto& ree_descr =
+      descrs[0].type->id() == Type::RUN_END_ENCODED ? descrs[0] : descrs[1];
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*ree_descr.type);
+  return ValueDescr(run_end_encoded(ree_type.run_end_type(), boolean()),
+                    ValueDescr::ARRAY);
+}
+
+template <typename Op>
+Status CompareRunEndEncoded(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  ExecContext* exec_ctx = ctx->exec_context();
+  std::vector<int64_t> run_ends;
+  Datum left, right;
+  int64_t length;
+  if (batch[0].is_array() && batch[1].is_array()) {
+    const ArraySpan& left_span = batch[0].array;
+    const ArraySpan& right_span = batch[1].array;
+    if (left_span.length != right_span.length) {
+      return Status::Invalid("Array arguments must all be the same length");
+    }
+    length = left_span.length;
+    std::vector<int64_t> left_indices, right_indices;
+    RETURN_NOT_OK(ree_util::VisitMergedRuns(
+        left_span, right_span,
+        [&](int64_t begin, int64_t run_length, int64_t left_index, int64_t right_index) {
+          run_ends.push_back(begin + run_length);
+          left_indices.push_back(left_index);
+          right_indices.push_back(right_index);
+          return Status::OK();
+        }));
+    ARROW_ASSIGN_OR_RAISE(
+        left, TakePhysical(ree_util::ValuesArray(left_span), left_indices, exec_ctx));
+    ARROW_ASSIGN_OR_RAISE(
+        right, TakePhysical(ree_util::ValuesArray(right_span), right_indices, exec_ctx));
+  } else {
+    // One side is a scalar: compare it against the values of the runs overlapping
+    // the logical range of the other side
+    const bool left_is_array = batch[0].is_array();
+    const ArraySpan& span = left_is_array ? batch[0].array : batch[1].array;
+    length = span.length;
+    RETURN_NOT_OK(ree_util::VisitRuns(span, [&](int64_t begin, int64_t run_length,
+                                                int64_t) {
+      run_ends.push_back(begin + run_length);
+      return Status::OK();
+    }));
+    auto values = ree_util::ValuesArray(span).ToArrayData()->Slice(
+        ree_util::FindPhysicalOffset(span), static_cast<int64_t>(run_ends.size()));
+    Datum scalar((left_is_array ? batch[1] : batch[0]).scalar->Copy());
+    left = left_is_array ? Datum(std::move(values)) : scalar;
+    right = left_is_array ? scalar : Datum(std::move(values));
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum result, CallFunction(CompareFunctionName<Op>::kName,
+                                                   {left, right}, exec_ctx));
+  const auto& out_type = checked_cast<const RunEndEncodedType&>(*out->type());
+  ARROW_ASSIGN_OR_RAISE(auto out_run_ends, MakeRunEndsArray(out_type.run_end_type(),
+                                                            run_ends,
+                                                            exec_ctx->memory_pool()));
+  out->value = MakeRunEndEncodedData(out->type()->Copy(), length,
+                                     std::move(out_run_ends), result.array());
+  return Status::OK();
+}
+
+template <typename Op>
+void AddRunEndEncodedCompare(ScalarFunction* func) {
+  const InputType ree(Type::RUN_END_ENCODED, ValueDescr::ARRAY);
+  const InputType any_scalar(ValueDescr::SCALAR);
+  for (const auto& in_types : std::vector<std::vector<InputType>>{
+           {ree, ree}, {ree, any_scalar}, {any_scalar, ree}}) {
+    ScalarKernel kernel(in_types, OutputType(ResolveRunEndEncodedCompareOutput),
+                        CompareRunEndEncoded<Op>);
+    kernel.null_handling = NullHandling::OUTPUT_NOT_NULL;
+    kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+}
+
+// Dictionary arrays are compared against a scalar by comparing the dictionary
+// values once, then looking up the result of each index, rather than decoding
+// the dictionary.
+
+template <typename IndexCType>
+void MapDictionaryResult(const ArraySpan& indices, const ArraySpan& dict_result,
+                         ArraySpan* out) {
+  const auto* index_values = indices.GetValues<IndexCType>(1);
+  const uint8_t* dict_values = dict_result.buffers[1].data;
+  int64_t i = 0;
+  // Null indices may be arbitrary, so only valid ones are looked up
+  ::arrow::internal::GenerateBitsUnrolled(
+      out->buffers[0].data, out->offset, out->length, [&]() -> bool {
+        const bool valid =
+            indices.IsValid(i) &&
+            dict_result.IsValid(static_cast<int64_t>(index_values[i]));
+        ++i;
+        return valid;
+      });
+  i = 0;
+  ::arrow::internal::GenerateBitsUnrolled(
+      out->buffers[1].data, out->offset, out->length, [&]() -> bool {
+        const bool value =
+            bit_util::GetBit(out->buffers[0].data, out->offset + i) &&
+            bit_util::GetBit(dict_values, dict_result.offset +
+                                              static_cast<int64_t>(index_values[i]));
+        ++i;
+        return value;
+      });
+  out->null_count = kUnknownNullCount;
+}
+
+template <typename Op>
+Status CompareDictionary(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const bool left_is_array = batch[0].is_array();
+  const ArraySpan& indices = left_is_array ? batch[0].array : batch[1].array;
+  Datum dictionary(indices.dictionary().ToArrayData());
+  Datum scalar((left_is_array ? batch[1] : batch[0]).scalar->Copy());
+  ARROW_ASSIGN_OR_RAISE(
+      Datum dict_result,
+      CallFunction(CompareFunctionName<Op>::kName,
+                   {left_is_array ? dictionary : scalar,
+                    left_is_array ? scalar : dictionary},
+                   ctx->exec_context()));
+  const ArraySpan dict_span(*dict_result.array());
+  ArraySpan* out_span = out->array_span();
+  const auto& dict_type = checked_cast<const DictionaryType&>(*indices.type);
+  switch (dict_type.index_type()->id()) {
+    case Type::INT8:
+    case Type::UINT8:
+      MapDictionaryResult<uint8_t>(indices, dict_span, out_span);
+      break;
+    case Type::INT16:
+    case Type::UINT16:
+      MapDictionaryResult<uint16_t>(indices, dict_span, out_span);
+      break;
+    case Type::INT32:
+    case Type::UINT32:
+      MapDictionaryResult<uint32_t>(indices, dict_span, out_span);
+      break;
+    case Type::INT64:
+    case Type::UINT64:
+      MapDictionaryResult<uint64_t>(indices, dict_span, out_span);
+      break;
+    default:
+      return Status::TypeError("Invalid index type: ", *dict_type.index_type());
+  }
+  return Status::OK();
+}
+
+template <typename Op>
+void AddDictionaryCompare(ScalarFunction* func) {
+  const InputType dict(Type::DICTIONARY, ValueDescr::ARRAY);
+  const InputType any_scalar(ValueDescr::SCALAR);
+  for (const auto& in_types :
+       std::vector<std::vector<InputType>>{{dict, any_scalar}, {any_scalar, dict}}) {
+    ScalarKernel kernel(in_types, boolean(), CompareDictionary<Op>);
+    kernel.null_handling = NullHandling::COMPUTED_PREALLOCATE;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+}
+
+// Binary views are compared without going through the data buffers for values
+// whose size and prefix already decide the comparison
+
+template <typename Op>
+struct CompareViews {
+  static bool Call(const BinaryViewType::c_type& left, const uint8_t* left_data,
+                   const BinaryViewType::c_type& right, const uint8_t* right_data) {
+    const int cmp = binary_view_util::CompareViews(left, left_data, right, right_data);
+    return Op::template Call<bool, int, int>(nullptr, cmp, 0, nullptr);
+  }
+};
+
+template <>
+struct CompareViews<Equal> {
+  static bool Call(const BinaryViewType::c_type& left, const uint8_t* left_data,
+                   const BinaryViewType::c_type& right, const uint8_t* right_data) {
+    return binary_view_util::EqualViews(left, left_data, right, right_data);
+  }
+};
+
+template <>
+struct CompareViews<NotEqual> {
+  static bool Call(const BinaryViewType::c_type& left, const uint8_t* left_data,
+                   const BinaryViewType::c_type& right, const uint8_t* right_data) {
+    return !binary_view_util::EqualViews(left, left_data, right, right_data);
+  }
+};
+
+// An argument of a binary view comparison, either an array or a scalar
+// broadcast to the length of the batch
+struct BinaryViewOperand {
+  explicit BinaryViewOperand(const ExecValue& value) {
+    if (value.is_array()) {
+      views = value.array.GetValues<BinaryViewType::c_type>(1);
+      data = value.array.buffers[2].data;
+      if (value.array.null_count != 0) {
+        validity = value.array.buffers[0].data;
+        offset = value.array.offset;
+      }
+    } else {
+      const auto& scalar = checked_cast<const BaseBinaryScalar&>(*value.scalar);
+      if (scalar.is_valid) {
+        data = scalar.value->data();
+        scalar_view = binary_view_util::MakeView(
+            data, static_cast<int32_t>(scalar.value->size()), /*offset=*/0);
+      } else {
+        scalar_view = binary_view_util::MakeView(nullptr, 0, 0);
+      }
+    }
+  }
+
+  // The views of null slots may be garbage, so they are never looked at
+  bool IsValid(int64_t i) const {
+    return validity == nullptr || bit_util::GetBit(validity, offset + i);
+  }
+
+  const BinaryViewType::c_type& operator[](int64_t i) const {
+    return views != nullptr ? views[i] : scalar_view;
+  }
+
+  const BinaryViewType::c_type* views = nullptr;
+  const uint8_t* data = nullptr;
+  const uint8_t* validity = nullptr;
+  int64_t offset = 0;
+  BinaryViewType::c_type scalar_view;
+};
+
+template <typename Op>
+Status CompareBinaryViewsExec(KernelContext*, const ExecSpan& batch, ExecResult* out) {
+  const BinaryViewOperand left(batch[0]);
+  const BinaryViewOperand right(batch[1]);
+  if (out->is_scalar()) {
+    auto* out_scalar = checked_cast<BooleanScalar*>(out->scalar().get());
+    if (out_scalar->is_valid) {
+      out_scalar->value =
+          CompareViews<Op>::Call(left[0], left.data, right[0], right.data);
+    }
+    return Status::OK();
+  }
+  ArraySpan* out_span = out->array_span();
+  int64_t i = 0;
+  ::arrow::internal::GenerateBitsUnrolled(
+      out_span->buffers[1].data, out_span->offset, out_span->length,
+                       [&]() -> bool {
+                         const bool result =
+                             left.IsValid(i) && right.IsValid(i) &&
+                             CompareViews<Op>::Call(left[i], left.data, right[i],
+                                                    right.data);
+                         ++i;
+                         return result;
+                       });
+  return Status::OK();
+}
+
+template <typename Op>
+void AddBinaryViewCompare(ScalarFunction* func) {
+  for (const auto id : {Type::BINARY_VIEW, Type::STRING_VIEW}) {
+    DCHECK_OK(func->AddKernel({InputType(id), InputType(id)}, boolean(),
+                              CompareBinaryViewsExec<Op>));
+  }
+}
+
 template <typename Op>
 std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name, FunctionDoc doc) {
   auto func = std::make_shared<CompareFunction>(name, Arity::Binary(), std::move(doc));
@@ -307,6 +599,10 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name, FunctionDo
     DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
   }
 
+  AddBinaryViewCompare<Op>(func.get());
+  AddRunEndEncodedCompare<Op>(func.get());
+  AddDictionaryCompare<Op>(func.get());
+
   return func;
 }
 
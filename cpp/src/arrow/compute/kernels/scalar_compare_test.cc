@@ -25,6 +25,7 @@
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/compute/api.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/builder.h"
@@ -1175,6 +1176,82 @@ TEST_F(TestStringCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+TEST_F(TestStringCompareKernel, StringView) {
+  // Values sharing their first bytes, on both sides of the inline size
+  const char* json = R"(["abcd", "abcde", "abcdefghijklmnop", "abcdefghijklmnoq",
+                         "abcc", "", null, "abcdefghijklmnop"])";
+  const char* scalar_json = R"("abcdefghijklmnop")";
+  for (const auto& type : {utf8_view(), binary_view()}) {
+    auto base_type = type->id() == Type::STRING_VIEW ? utf8() : binary();
+    auto views = ArrayFromJSON(type, json);
+    auto strings = ArrayFromJSON(base_type, json);
+    auto rotate = [](const std::shared_ptr<Array>& array, int64_t shift) {
+      return *Concatenate({array->Slice(shift), array->Slice(0, shift)});
+    };
+
+    for (const char* function :
+         {"equal", "not_equal", "greater", "greater_equal", "less", "less_equal"}) {
+      ARROW_SCOPED_TRACE(function, " ", *type);
+      // Compare every pair of values through rotated copies
+      for (int64_t shift = 0; shift < views->length(); ++shift) {
+        ASSERT_OK_AND_ASSIGN(auto expected,
+                             CallFunction(function, {strings, rotate(strings, shift)}));
+        ASSERT_OK_AND_ASSIGN(auto actual,
+                             CallFunction(function, {views, rotate(views, shift)}));
+        AssertDatumsEqual(expected, actual, /*verbose=*/true);
+      }
+
+      Datum scalar_view(ScalarFromJSON(type, scalar_json));
+      Datum scalar_string(ScalarFromJSON(base_type, scalar_json));
+      ASSERT_OK_AND_ASSIGN(auto expected, CallFunction(function, {strings, scalar_string}));
+      ASSERT_OK_AND_ASSIGN(auto actual, CallFunction(function, {views, scalar_view}));
+      AssertDatumsEqual(expected, actual, /*verbose=*/true);
+      ASSERT_OK_AND_ASSIGN(expected, CallFunction(function, {scalar_string, strings}));
+      ASSERT_OK_AND_ASSIGN(actual, CallFunction(function, {scalar_view, views}));
+      AssertDatumsEqual(expected, actual, /*verbose=*/true);
+    }
+  }
+}
+
+TEST_F(TestStringCompareKernel, DictionaryArrayScalar) {
+  // Null indices, a null dictionary value and unused dictionary values
+  const char* indices_json = "[0, 2, null, 1, 3, 0, 2, 3]";
+  const char* dict_json = R"(["b", null, "a", "c", "unused"])";
+  for (const auto& index_type : {int8(), uint16(), int32(), int64()}) {
+    auto type = dictionary(index_type, utf8());
+    auto dict_array = DictArrayFromJSON(type, indices_json, dict_json);
+    ASSERT_OK_AND_ASSIGN(Datum decoded, Cast(dict_array, utf8()));
+
+    for (const char* function :
+         {"equal", "not_equal", "greater", "greater_equal", "less", "less_equal"}) {
+      for (const char* scalar_json : {R"("b")", R"("bb")", "null"}) {
+        ARROW_SCOPED_TRACE(function, " ", *type, " ", scalar_json);
+        Datum scalar(ScalarFromJSON(utf8(), scalar_json));
+        for (int64_t offset : {0, 3}) {
+          auto array = dict_array->Slice(offset);
+          auto decoded_array = decoded.make_array()->Slice(offset);
+          ASSERT_OK_AND_ASSIGN(auto expected,
+                               CallFunction(function, {decoded_array, scalar}));
+          ASSERT_OK_AND_ASSIGN(auto actual, CallFunction(function, {array, scalar}));
+          ValidateOutput(actual);
+          AssertDatumsEqual(expected, actual, /*verbose=*/true);
+          ASSERT_OK_AND_ASSIGN(expected, CallFunction(function, {scalar, decoded_array}));
+          ASSERT_OK_AND_ASSIGN(actual, CallFunction(function, {scalar, array}));
+          ValidateOutput(actual);
+          AssertDatumsEqual(expected, actual, /*verbose=*/true);
+        }
+      }
+    }
+  }
+
+  // The scalar is cast to the common type with the dictionary values
+  CheckScalarBinary("greater",
+                    DictArrayFromJSON(dictionary(int32(), float64()), "[0, 1, null, 2]",
+                                      "[1.5, 0.5, 3]"),
+                    ScalarFromJSON(int8(), "1"),
+                    ArrayFromJSON(boolean(), "[true, false, null, true]"));
+}
+
 template <typename T>
 class TestVarArgsCompare : public ::testing::Test {
  protected:
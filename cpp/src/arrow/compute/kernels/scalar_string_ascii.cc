@@ -16,7 +16,9 @@
 // under the License.
 
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <cstring>
 #include <iterator>
 #include <string>
 
@@ -26,6 +28,8 @@
 
 #include "arrow/array/builder_nested.h"
 #include "arrow/compute/kernels/scalar_string_internal.h"
+#include "arrow/util/arena.h"
+#include "arrow/util/cache_internal.h"
 #include "arrow/util/value_parsing.h"
 
 namespace arrow {
@@ -68,6 +72,71 @@ template <typename T>
 RE2::Options MakeRE2Options(bool ignore_case = false, bool literal = false) {
   return MakeRE2Options(T::is_utf8, ignore_case, literal);
 }
+
+// Kernels are initialized for every call, which for small batches makes compiling
+// the same patterns over and over a significant cost.  Compiled regexes are
+// therefore shared process-wide through a LRU cache; an RE2 object is thread-safe
+// once constructed.
+//
+// Invalid regexes are cached as well, callers must check them with RegexStatus().
+constexpr int32_t kRE2CacheCapacity = 128;
+
+std::shared_ptr<const RE2> CompileRE2(const std::string& pattern, bool is_utf8,
+                                      bool ignore_case = false, bool literal = false) {
+  static auto compile = ::arrow::internal::MemoizeLru(
+      [](const std::string& key) {
+        // The first byte of the key holds the options
+        const char flags = key[0];
+        return std::make_shared<const RE2>(
+            re2::StringPiece(key.data() + 1, key.size() - 1),
+            MakeRE2Options(flags & 1, flags & 2, flags & 4));
+      },
+      kRE2CacheCapacity);
+  std::string key;
+  key.reserve(pattern.size() + 1);
+  key.push_back(static_cast<char>(is_utf8 | ignore_case << 1 | literal << 2));
+  key += pattern;
+  return compile(key);
+}
+
+template <typename T>
+std::shared_ptr<const RE2> CompileRE2(const std::string& pattern,
+                                      bool ignore_case = false, bool literal = false) {
+  return CompileRE2(pattern, T::is_utf8, ignore_case, literal);
+}
+
+// Return a literal that any match of the regex contains, so that most non-matching
+// inputs can be rejected by a plain (memchr-based) substring search.  This is a
+// conservative scan of the pattern's leading literal characters; an empty string
+// means there is no usable literal.
+std::string RequiredRegexLiteral(const std::string& pattern, bool ignore_case,
+                                 bool literal) {
+  if (literal) return ignore_case ? "" : pattern;
+  // An alternation could match without the literal, a case-insensitive match
+  // would not contain it as is
+  if (ignore_case || pattern.find('|') != std::string::npos) return "";
+  util::string_view rest(pattern);
+  // The flags group and anchor of match_like regexes
+  if (rest.substr(0, 4) == "(?s:") rest.remove_prefix(4);
+  if (rest.substr(0, 1) == "^") rest.remove_prefix(1);
+  std::string result;
+  for (const char c : rest) {
+    if (std::strchr("\\.^$|?*+()[]{}", c) != nullptr) {
+      // A quantifier may make the previous character optional.  Drop all of it: a
+      // UTF-8 character may span several bytes, its continuation bytes come last.
+      if ((c == '?' || c == '*' || c == '{') && !result.empty()) {
+        while (result.size() > 1 &&
+               (static_cast<uint8_t>(result.back()) & 0xC0) == 0x80) {
+          result.pop_back();
+        }
+        result.pop_back();
+      }
+      break;
+    }
+    result.push_back(c);
+  }
+  return result;
+}
 #endif
 
 // ----------------------------------------------------------------------
@@ -1417,28 +1486,132 @@ struct PlainEndsWithMatcher {
   }
 };
 
+// This is an implementation of the Aho-Corasick algorithm: the patterns are
+// compiled once into a DFA, so that each string is scanned once whatever the
+// number of patterns.  Bytes that appear in no pattern share a single input
+// class, which keeps the transition table small.
+struct MultiSubstringMatcher {
+  // number of input classes
+  int32_t num_classes_ = 1;
+  std::array<uint16_t, 256> byte_classes_;
+  // transitions_[state * num_classes_ + class] is the next state
+  std::vector<int32_t> transitions_;
+  // whether a pattern ends at a state (or at any of its suffixes)
+  std::vector<bool> accepting_;
+
+  MultiSubstringMatcher(KernelContext*, const MatchSubstringSetOptions& options) {
+    // Phase 1: Assign input classes, letters of both cases sharing one if
+    // ignoring case
+    byte_classes_.fill(0);
+    for (const auto& pattern : options.patterns) {
+      for (const auto c : pattern) {
+        auto byte = static_cast<uint8_t>(c);
+        if (options.ignore_case) byte = ascii_tolower(byte);
+        if (byte_classes_[byte] == 0) {
+          byte_classes_[byte] = static_cast<uint16_t>(num_classes_++);
+        }
+      }
+    }
+    if (options.ignore_case) {
+      for (int c = 'a'; c <= 'z'; ++c) {
+        byte_classes_[c - 'a' + 'A'] = byte_classes_[c];
+      }
+    }
+
+    // Phase 2: Build the trie of the patterns, -1 meaning no edge
+    transitions_.assign(num_classes_, -1);
+    accepting_.assign(1, false);
+    for (const auto& pattern : options.patterns) {
+      int32_t state = 0;
+      for (const auto c : pattern) {
+        int32_t& next = transitions_[state * num_classes_ + Class(c)];
+        if (next < 0) {
+          next = static_cast<int32_t>(accepting_.size());
+          transitions_.resize(transitions_.size() + num_classes_, -1);
+          accepting_.push_back(false);
+        }
+        // `next` may be dangling after the resize
+        state = transitions_[state * num_classes_ + Class(c)];
+      }
+      accepting_[state] = true;
+    }
+
+    // Phase 3: Turn the trie into a DFA, visiting states breadth-first so that
+    // the failure state of each state is complete before it is used
+    std::vector<int32_t> failure(accepting_.size(), 0);
+    std::vector<int32_t> queue;
+    queue.reserve(accepting_.size());
+    for (int32_t cls = 0; cls < num_classes_; ++cls) {
+      int32_t& next = transitions_[cls];
+      if (next < 0) {
+        next = 0;
+      } else {
+        queue.push_back(next);
+      }
+    }
+    for (size_t i = 0; i < queue.size(); ++i) {
+      const int32_t state = queue[i];
+      accepting_[state] = accepting_[state] || accepting_[failure[state]];
+      for (int32_t cls = 0; cls < num_classes_; ++cls) {
+        int32_t& next = transitions_[state * num_classes_ + cls];
+        const int32_t fallback = transitions_[failure[state] * num_classes_ + cls];
+        if (next < 0) {
+          next = fallback;
+        } else {
+          failure[next] = fallback;
+          queue.push_back(next);
+        }
+      }
+    }
+  }
+
+  uint16_t Class(char c) const {
+    return byte_classes_[static_cast<uint8_t>(c)];
+  }
+
+  bool Match(util::string_view current) const {
+    if (accepting_[0]) return true;
+    int32_t state = 0;
+    for (const auto c : current) {
+      state = transitions_[state * num_classes_ + Class(c)];
+      if (accepting_[state]) return true;
+    }
+    return false;
+  }
+};
+
+using MatchSubstringSetState =
+    KernelStateFromFunctionOptions<MultiSubstringMatcher, MatchSubstringSetOptions>;
+
 #ifdef ARROW_WITH_RE2
 struct RegexSubstringMatcher {
   const MatchSubstringOptions& options_;
-  const RE2 regex_match_;
+  const std::shared_ptr<const RE2> regex_match_;
+  // Checked before running the regex, if not empty
+  const std::string required_literal_;
 
   static Result<std::unique_ptr<RegexSubstringMatcher>> Make(
       const MatchSubstringOptions& options, bool is_utf8 = true, bool literal = false) {
     auto matcher =
         ::arrow::internal::make_unique<RegexSubstringMatcher>(options, is_utf8, literal);
-    RETURN_NOT_OK(RegexStatus(matcher->regex_match_));
+    RETURN_NOT_OK(RegexStatus(*matcher->regex_match_));
     return std::move(matcher);
   }
 
   explicit RegexSubstringMatcher(const MatchSubstringOptions& options,
                                  bool is_utf8 = true, bool literal = false)
       : options_(options),
-        regex_match_(options_.pattern,
-                     MakeRE2Options(is_utf8, options.ignore_case, literal)) {}
+        regex_match_(CompileRE2(options_.pattern, is_utf8, options.ignore_case, literal)),
+        required_literal_(
+            RequiredRegexLiteral(options_.pattern, options.ignore_case, literal)) {}
 
   bool Match(util::string_view current) const {
+    if (!required_literal_.empty() &&
+        current.find(required_literal_) == util::string_view::npos) {
+      return false;
+    }
     auto piece = re2::StringPiece(current.data(), current.length());
-    return RE2::PartialMatch(piece, regex_match_);
+    return RE2::PartialMatch(piece, *regex_match_);
   }
 };
 #endif
@@ -1479,6 +1652,14 @@ struct MatchSubstring {
   }
 };
 
+template <typename Type>
+struct MatchSubstringSet {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    return MatchSubstringImpl<Type, MultiSubstringMatcher>::Exec(
+        ctx, batch, out, &MatchSubstringSetState::Get(ctx));
+  }
+};
+
 #ifdef ARROW_WITH_RE2
 template <typename Type>
 struct MatchSubstring<Type, RegexSubstringMatcher> {
@@ -1692,6 +1873,15 @@ const FunctionDoc ends_with_doc(
      "Null inputs emit null."),
     {"strings"}, "MatchSubstringOptions", /*options_required=*/true);
 
+const FunctionDoc match_substring_set_doc(
+    "Match strings against a set of literal patterns",
+    ("For each string in `strings`, emit true iff it contains any of the given\n"
+     "patterns.  Each string is scanned once, whatever the number of patterns.\n"
+     "Null inputs emit null.\n"
+     "The patterns must be given in MatchSubstringSetOptions.\n"
+     "If ignore_case is set, only ASCII letters are case-folded."),
+    {"strings"}, "MatchSubstringSetOptions", /*options_required=*/true);
+
 #ifdef ARROW_WITH_RE2
 const FunctionDoc match_substring_regex_doc(
     "Match strings against regex pattern",
@@ -1744,6 +1934,16 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
     }
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
+  {
+    auto func = std::make_shared<ScalarFunction>("match_substring_set", Arity::Unary(),
+                                                 match_substring_set_doc);
+    for (const auto& ty : BaseBinaryTypes()) {
+      auto exec = GenerateVarBinaryToVarBinary<MatchSubstringSet>(ty);
+      DCHECK_OK(func->AddKernel({ty}, boolean(), std::move(exec),
+                                MatchSubstringSetState::Init));
+    }
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
 #ifdef ARROW_WITH_RE2
   {
     auto func = std::make_shared<ScalarFunction>("match_substring_regex", Arity::Unary(),
@@ -1784,7 +1984,7 @@ struct FindSubstring {
 
 #ifdef ARROW_WITH_RE2
 struct FindSubstringRegex {
-  std::unique_ptr<RE2> regex_match_;
+  std::shared_ptr<const RE2> regex_match_;
 
   explicit FindSubstringRegex(const MatchSubstringOptions& options, bool is_utf8 = true,
                               bool literal = false) {
@@ -1792,8 +1992,7 @@ struct FindSubstringRegex {
     regex.reserve(options.pattern.length() + 2);
     regex += literal ? RE2::QuoteMeta(options.pattern) : options.pattern;
     regex += ")";
-    regex_match_.reset(
-        new RE2(regex, MakeRE2Options(is_utf8, options.ignore_case, /*literal=*/false)));
+    regex_match_ = CompileRE2(regex, is_utf8, options.ignore_case, /*literal=*/false);
   }
 
   template <typename OutValue, typename... Ignored>
@@ -1917,12 +2116,12 @@ struct CountSubstring {
 
 #ifdef ARROW_WITH_RE2
 struct CountSubstringRegex {
-  std::unique_ptr<RE2> regex_match_;
+  std::shared_ptr<const RE2> regex_match_;
 
   explicit CountSubstringRegex(const MatchSubstringOptions& options, bool is_utf8 = true,
                                bool literal = false)
-      : regex_match_(new RE2(options.pattern,
-                             MakeRE2Options(is_utf8, options.ignore_case, literal))) {}
+      : regex_match_(
+            CompileRE2(options.pattern, is_utf8, options.ignore_case, literal)) {}
 
   static Result<CountSubstringRegex> Make(const MatchSubstringOptions& options,
                                           bool is_utf8 = true, bool literal = false) {
@@ -2144,18 +2343,18 @@ struct PlainSubstringReplacer {
 template <typename Type>
 struct RegexSubstringReplacer {
   const ReplaceSubstringOptions& options_;
-  const RE2 regex_find_;
-  const RE2 regex_replacement_;
+  const std::shared_ptr<const RE2> regex_find_;
+  const std::shared_ptr<const RE2> regex_replacement_;
 
   static Result<std::unique_ptr<RegexSubstringReplacer>> Make(
       const ReplaceSubstringOptions& options) {
     auto replacer = arrow::internal::make_unique<RegexSubstringReplacer>(options);
 
-    RETURN_NOT_OK(RegexStatus(replacer->regex_find_));
-    RETURN_NOT_OK(RegexStatus(replacer->regex_replacement_));
+    RETURN_NOT_OK(RegexStatus(*replacer->regex_find_));
+    RETURN_NOT_OK(RegexStatus(*replacer->regex_replacement_));
 
     std::string replacement_error;
-    if (!replacer->regex_replacement_.CheckRewriteString(replacer->options_.replacement,
+    if (!replacer->regex_replacement_->CheckRewriteString(replacer->options_.replacement,
                                                          &replacement_error)) {
       return Status::Invalid("Invalid replacement string: ",
                              std::move(replacement_error));
@@ -2168,15 +2367,15 @@ struct RegexSubstringReplacer {
   // we have 2 regexes, one with () around it, one without.
   explicit RegexSubstringReplacer(const ReplaceSubstringOptions& options)
       : options_(options),
-        regex_find_("(" + options_.pattern + ")", MakeRE2Options<Type>()),
-        regex_replacement_(options_.pattern, MakeRE2Options<Type>()) {}
+        regex_find_(CompileRE2<Type>("(" + options_.pattern + ")")),
+        regex_replacement_(CompileRE2<Type>(options_.pattern)) {}
 
   Status ReplaceString(util::string_view s, TypedBufferBuilder<uint8_t>* builder) const {
     re2::StringPiece replacement(options_.replacement);
 
     if (options_.max_replacements == -1) {
       std::string s_copy(s.to_string());
-      RE2::GlobalReplace(&s_copy, regex_replacement_, replacement);
+      RE2::GlobalReplace(&s_copy, *regex_replacement_, replacement);
       return builder->Append(reinterpret_cast<const uint8_t*>(s_copy.data()),
                              s_copy.length());
     }
@@ -2191,7 +2390,7 @@ struct RegexSubstringReplacer {
     int64_t max_replacements = options_.max_replacements;
     while ((i < end) && (max_replacements != 0)) {
       std::string found;
-      if (!RE2::FindAndConsume(&piece, regex_find_, &found)) {
+      if (!RE2::FindAndConsume(&piece, *regex_find_, &found)) {
         RETURN_NOT_OK(builder->Append(reinterpret_cast<const uint8_t*>(i),
                                       static_cast<int64_t>(end - i)));
         i = end;
@@ -2202,7 +2401,7 @@ struct RegexSubstringReplacer {
         RETURN_NOT_OK(builder->Append(reinterpret_cast<const uint8_t*>(i),
                                       static_cast<int64_t>(pos - i)));
         // replace the pattern in what we found
-        if (!RE2::Replace(&found, regex_replacement_, replacement)) {
+        if (!RE2::Replace(&found, *regex_replacement_, replacement)) {
           return Status::Invalid("Regex found, but replacement failed");
         }
         RETURN_NOT_OK(builder->Append(reinterpret_cast<const uint8_t*>(found.data()),
@@ -2279,10 +2478,9 @@ void AddAsciiStringReplaceSubstring(FunctionRegistry* registry) {
 
 using ExtractRegexState = OptionsWrapper<ExtractRegexOptions>;
 
-// TODO cache this once per ExtractRegexOptions
 struct ExtractRegexData {
-  // Use unique_ptr<> because RE2 is non-movable (for ARROW_ASSIGN_OR_RAISE)
-  std::unique_ptr<RE2> regex;
+  // Use shared_ptr<> because RE2 is non-movable (for ARROW_ASSIGN_OR_RAISE)
+  std::shared_ptr<const RE2> regex;
   std::vector<std::string> group_names;
 
   static Result<ExtractRegexData> Make(const ExtractRegexOptions& options,
@@ -2323,7 +2521,7 @@ struct ExtractRegexData {
 
  private:
   explicit ExtractRegexData(const std::string& pattern, bool is_utf8 = true)
-      : regex(new RE2(pattern, MakeRE2Options(is_utf8))) {}
+      : regex(CompileRE2(pattern, is_utf8)) {}
 };
 
 Result<ValueDescr> ResolveExtractRegexOutput(KernelContext* ctx,
@@ -2707,7 +2905,7 @@ template <typename Type>
 struct SplitRegexFinder : public StringSplitFinderBase<SplitPatternOptions> {
   using Options = SplitPatternOptions;
 
-  std::unique_ptr<RE2> regex_split;
+  std::shared_ptr<const RE2> regex_split;
 
   Status PreExec(const SplitPatternOptions& options) override {
     if (options.reverse) {
@@ -2719,7 +2917,7 @@ struct SplitRegexFinder : public StringSplitFinderBase<SplitPatternOptions> {
     pattern.reserve(options.pattern.size() + 2);
     pattern += options.pattern;
     pattern += ')';
-    regex_split = arrow::internal::make_unique<RE2>(pattern, MakeRE2Options<Type>());
+    regex_split = CompileRE2<Type>(pattern);
     return RegexStatus(*regex_split);
   }
 
@@ -3113,7 +3311,10 @@ struct BinaryJoinElementWise {
     RETURN_NOT_OK(builder.Reserve(batch.length));
     RETURN_NOT_OK(builder.ReserveData(final_size));
 
-    std::vector<util::string_view> valid_cols(batch.num_values());
+    util::ArenaScope scratch(ctx->scratch_arena());
+    ARROW_ASSIGN_OR_RAISE(
+        util::string_view * valid_cols,
+        scratch.AllocateArray<util::string_view>(batch.num_values()));
     for (int64_t row = 0; row < batch.length; row++) {
       int num_valid = 0;  // Not counting separator
       for (int col = 0; col < batch.num_values(); col++) {
@@ -3141,7 +3342,7 @@ struct BinaryJoinElementWise {
         }
       }
 
-      if (!valid_cols.back().data()) {
+      if (!valid_cols[batch.num_values() - 1].data()) {
         // Separator is null
         builder.UnsafeAppendNull();
         continue;
@@ -3156,7 +3357,7 @@ struct BinaryJoinElementWise {
           continue;
         }
       }
-      const auto separator = valid_cols.back();
+      const auto separator = valid_cols[batch.num_values() - 1];
       bool first = true;
       for (int col = 0; col < batch.num_values() - 1; col++) {
         util::string_view value = valid_cols[col];
@@ -72,6 +72,15 @@ static void MatchSubstring(benchmark::State& state) {
   UnaryStringBenchmark(state, "match_substring", &options);
 }
 
+static void MatchSubstringSet(benchmark::State& state) {
+  std::vector<std::string> patterns;
+  for (int i = 0; i < 100; ++i) {
+    patterns.push_back("abac" + std::to_string(i));
+  }
+  MatchSubstringSetOptions options(std::move(patterns));
+  UnaryStringBenchmark(state, "match_substring_set", &options);
+}
+
 static void SplitPattern(benchmark::State& state) {
   SplitPatternOptions options("a");
   UnaryStringBenchmark(state, "split_pattern", &options);
@@ -237,6 +246,7 @@ BENCHMARK(AsciiLower);
 BENCHMARK(AsciiUpper);
 BENCHMARK(IsAlphaNumericAscii);
 BENCHMARK(MatchSubstring);
+BENCHMARK(MatchSubstringSet);
 BENCHMARK(SplitPattern);
 BENCHMARK(TrimSingleAscii);
 BENCHMARK(TrimManyAscii);
@@ -1399,6 +1399,34 @@ TYPED_TEST(TestBaseBinaryKernels, MatchSubstringIgnoreCase) {
 }
 #endif
 
+TYPED_TEST(TestBaseBinaryKernels, MatchSubstringSet) {
+  MatchSubstringSetOptions options{{"ab", "cd", "bca"}};
+  this->CheckUnary("match_substring_set", "[]", boolean(), "[]", &options);
+  this->CheckUnary("match_substring_set",
+                   R"(["abc", "xcdx", "bcb", "bca", null, "", "AB"])", boolean(),
+                   "[true, true, false, true, null, false, false]", &options);
+
+  // Matches ending within other patterns
+  MatchSubstringSetOptions options_overlapping{{"he", "she", "his", "hers"}};
+  this->CheckUnary("match_substring_set", R"(["ushers", "hi", "ahishe", "h", "sh"])",
+                   boolean(), "[true, false, true, false, false]", &options_overlapping);
+  MatchSubstringSetOptions options_suffix{{"abcd", "bc"}};
+  this->CheckUnary("match_substring_set", R"(["abce", "abd", "aabcd"])", boolean(),
+                   "[true, false, true]", &options_suffix);
+
+  MatchSubstringSetOptions options_none{std::vector<std::string>{}};
+  this->CheckUnary("match_substring_set", R"(["a", null, ""])", boolean(),
+                   "[false, null, false]", &options_none);
+
+  MatchSubstringSetOptions options_empty{{"zz", ""}};
+  this->CheckUnary("match_substring_set", R"(["a", null, ""])", boolean(),
+                   "[true, null, true]", &options_empty);
+
+  MatchSubstringSetOptions options_insensitive{{"Ab", "aB", "x"}, /*ignore_case=*/true};
+  this->CheckUnary("match_substring_set", R"(["AB", "cab", "X", "yz", "a b"])",
+                   boolean(), "[true, true, true, false, false]", &options_insensitive);
+}
+
 TYPED_TEST(TestBaseBinaryKernels, MatchStartsWith) {
   MatchSubstringOptions options{"abab"};
   this->CheckUnary("starts_with", "[]", boolean(), "[]", &options);
@@ -1492,9 +1520,48 @@ TYPED_TEST(TestBaseBinaryKernels, MatchSubstringRegexNoOptions) {
 TYPED_TEST(TestBaseBinaryKernels, MatchSubstringRegexInvalid) {
   Datum input = ArrayFromJSON(this->type(), "[null]");
   MatchSubstringOptions options{"invalid["};
-  EXPECT_RAISES_WITH_MESSAGE_THAT(
-      Invalid, ::testing::HasSubstr("Invalid regular expression: missing ]"),
-      CallFunction("match_substring_regex", {input}, &options));
+  // Twice, since compiled regexes are cached
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        Invalid, ::testing::HasSubstr("Invalid regular expression: missing ]"),
+        CallFunction("match_substring_regex", {input}, &options));
+  }
+}
+
+TYPED_TEST(TestBaseBinaryKernels, MatchSubstringRegexLiteralPrefix) {
+  // The leading literal of a regex is looked for before running the regex, check
+  // that optional or alternative characters are not required
+  auto inputs = R"(["ac", "abc", "xabcx", "ab", "cd", "bc", null])";
+  MatchSubstringOptions options{"ab*c"};
+  this->CheckUnary("match_substring_regex", inputs, boolean(),
+                   "[true, true, true, false, false, false, null]", &options);
+  options.pattern = "abc?";
+  this->CheckUnary("match_substring_regex", inputs, boolean(),
+                   "[false, true, true, true, false, false, null]", &options);
+  options.pattern = "ab{0,2}c";
+  this->CheckUnary("match_substring_regex", inputs, boolean(),
+                   "[true, true, true, false, false, false, null]", &options);
+  options.pattern = "ab|cd";
+  this->CheckUnary("match_substring_regex", inputs, boolean(),
+                   "[false, true, true, true, true, false, null]", &options);
+  options.pattern = "^ab";
+  this->CheckUnary("match_substring_regex", inputs, boolean(),
+                   "[false, true, false, true, false, false, null]", &options);
+  options.pattern = "AB";
+  options.ignore_case = true;
+  this->CheckUnary("match_substring_regex", inputs, boolean(),
+                   "[false, true, true, true, false, false, null]", &options);
+}
+
+TYPED_TEST(TestStringKernels, MatchSubstringRegexLiteralPrefixUtf8) {
+  // A quantifier applies to the whole preceding character, not its last byte
+  auto inputs = R"(["caf", "café", "xcaféx", "cafx", "cae", null])";
+  MatchSubstringOptions options{"café?"};
+  this->CheckUnary("match_substring_regex", inputs, boolean(),
+                   "[true, true, true, true, false, null]", &options);
+  options.pattern = "cé{0,1}af";
+  this->CheckUnary("match_substring_regex", inputs, boolean(),
+                   "[true, true, true, true, false, null]", &options);
 }
 
 TYPED_TEST(TestStringKernels, MatchLike) {
@@ -885,6 +885,38 @@ TEST_F(ScalarTemporalTest, TestZoned2) {
   }
 }
 
+TEST_F(ScalarTemporalTest, TestZonedAcrossTransitions) {
+  // Consecutive values in different DST intervals, including a return to
+  // an earlier interval
+  std::string timezone = "America/New_York";
+  const char* times = R"(["2021-03-14 06:59:59", "2021-03-14 07:00:00",
+                          "2021-11-07 05:59:59", "2021-11-07 06:00:00",
+                          "2021-03-14 06:00:00", "2021-07-01 12:00:00", null])";
+  auto hour = "[1, 3, 1, 1, 1, 8, null]";
+  auto is_dst = "[false, true, true, false, false, true, null]";
+  auto strftime = R"(["2021-03-14T01:59:59-0500", "2021-03-14T03:00:00-0400",
+                      "2021-11-07T01:59:59-0400", "2021-11-07T01:00:00-0500",
+                      "2021-03-14T01:00:00-0500", "2021-07-01T08:00:00-0400", null])";
+  auto strftime_options = StrftimeOptions("%Y-%m-%dT%H:%M:%S%z");
+
+  const char* local_times = R"(["2021-03-13 12:00:00", "2021-03-14 03:30:00",
+                                "2021-03-14 01:30:00", "2021-06-01 00:00:00",
+                                "2021-06-02 00:00:00", "2021-01-01 00:00:00", null])";
+  const char* local_times_utc = R"(["2021-03-13 17:00:00", "2021-03-14 07:30:00",
+                                    "2021-03-14 06:30:00", "2021-06-01 04:00:00",
+                                    "2021-06-02 04:00:00", "2021-01-01 05:00:00", null])";
+  auto assume_timezone_options = AssumeTimezoneOptions(timezone);
+
+  for (auto u : TimeUnit::values()) {
+    auto unit = timestamp(u, timezone);
+    CheckScalarUnary("hour", unit, times, int64(), hour);
+    CheckScalarUnary("is_dst", unit, times, boolean(), is_dst);
+    CheckScalarUnary("strftime", unit, times, utf8(), strftime, &strftime_options);
+    CheckScalarUnary("assume_timezone", timestamp(u), local_times, unit, local_times_utc,
+                     &assume_timezone_options);
+  }
+}
+
 TEST_F(ScalarTemporalTest, TestNonexistentTimezone) {
   auto data_buffer = Buffer::Wrap(std::vector<int32_t>{1, 2, 3});
   auto null_buffer = Buffer::FromString("\xff");
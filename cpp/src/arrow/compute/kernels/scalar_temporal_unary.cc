@@ -676,14 +676,14 @@ struct Nanosecond {
 template <typename Duration>
 struct IsDaylightSavings {
   explicit IsDaylightSavings(const FunctionOptions* options, const time_zone* tz)
-      : tz_(tz) {}
+      : tz_cache_(tz) {}
 
   template <typename T, typename Arg0>
   T Call(KernelContext*, Arg0 arg, Status*) const {
-    return tz_->get_info(sys_time<Duration>{Duration{arg}}).save.count() != 0;
+    return tz_cache_.GetInfo(sys_time<Duration>{Duration{arg}}).save.count() != 0;
   }
 
-  const time_zone* tz_;
+  mutable TimeZoneIntervalCache tz_cache_;
 };
 
 // ----------------------------------------------------------------------
@@ -691,7 +691,8 @@ struct IsDaylightSavings {
 
 template <typename Duration, typename Localizer>
 year_month_day GetFlooredYmd(int64_t arg, const int multiple,
-                             const RoundTemporalOptions& options, Localizer localizer_) {
+                             const RoundTemporalOptions& options,
+                             const Localizer& localizer_) {
   year_month_day ymd{floor<days>(localizer_.template ConvertTimePoint<Duration>(arg))};
 
   if (multiple == 1) {
@@ -736,7 +737,7 @@ year_month_day GetFlooredYmd(int64_t arg, const int multiple,
 
 template <typename Duration, typename Unit, typename Localizer>
 const Duration FloorTimePoint(const int64_t arg, const RoundTemporalOptions& options,
-                              Localizer localizer_, Status* st) {
+                              const Localizer& localizer_, Status* st) {
   const auto t = localizer_.template ConvertTimePoint<Duration>(arg);
 
   if (options.multiple == 1) {
@@ -804,8 +805,8 @@ const Duration FloorTimePoint(const int64_t arg, const RoundTemporalOptions& opt
 
 template <typename Duration, typename Localizer>
 const Duration FloorWeekTimePoint(const int64_t arg, const RoundTemporalOptions& options,
-                                  Localizer localizer_, const Duration weekday_offset,
-                                  Status* st) {
+                                  const Localizer& localizer_,
+                                  const Duration weekday_offset, Status* st) {
   const auto t = localizer_.template ConvertTimePoint<Duration>(arg) + weekday_offset;
   const weeks d = floor<weeks>(t).time_since_epoch();
 
@@ -842,7 +843,7 @@ const Duration FloorWeekTimePoint(const int64_t arg, const RoundTemporalOptions&
 
 template <typename Duration, typename Unit, typename Localizer>
 Duration CeilTimePoint(const int64_t arg, const RoundTemporalOptions& options,
-                       Localizer localizer_, Status* st) {
+                       const Localizer& localizer_, Status* st) {
   const Duration f =
       FloorTimePoint<Duration, Unit, Localizer>(arg, options, localizer_, st);
   const auto cl =
@@ -860,7 +861,7 @@ Duration CeilTimePoint(const int64_t arg, const RoundTemporalOptions& options,
 
 template <typename Duration, typename Localizer>
 Duration CeilWeekTimePoint(const int64_t arg, const RoundTemporalOptions& options,
-                           Localizer localizer_, const Duration weekday_offset,
+                           const Localizer& localizer_, const Duration weekday_offset,
                            Status* st) {
   const Duration f = FloorWeekTimePoint<Duration, Localizer>(arg, options, localizer_,
                                                              weekday_offset, st);
@@ -878,7 +879,7 @@ Duration CeilWeekTimePoint(const int64_t arg, const RoundTemporalOptions& option
 
 template <typename Duration, typename Unit, typename Localizer>
 Duration RoundTimePoint(const int64_t arg, const RoundTemporalOptions& options,
-                        Localizer localizer_, Status* st) {
+                        const Localizer& localizer_, Status* st) {
   const Duration f =
       FloorTimePoint<Duration, Unit, Localizer>(arg, options, localizer_, st);
   const Duration c =
@@ -888,7 +889,7 @@ Duration RoundTimePoint(const int64_t arg, const RoundTemporalOptions& options,
 
 template <typename Duration, typename Localizer>
 Duration RoundWeekTimePoint(const int64_t arg, const RoundTemporalOptions& options,
-                            Localizer localizer_, const Duration weekday_offset,
+                            const Localizer& localizer_, const Duration weekday_offset,
                             Status* st) {
   const Duration f = FloorWeekTimePoint<Duration, Localizer>(arg, options, localizer_,
                                                              weekday_offset, st);
@@ -1384,7 +1385,7 @@ Result<ValueDescr> ResolveAssumeTimezoneOutput(KernelContext* ctx,
 template <typename Duration>
 struct AssumeTimezone {
   explicit AssumeTimezone(const AssumeTimezoneOptions* options, const time_zone* tz)
-      : options(*options), tz_(tz) {}
+      : options(*options), tz_(tz), tz_cache_(tz) {}
 
   template <typename T, typename Arg0>
   T get_local_time(Arg0 arg, const time_zone* tz) const {
@@ -1406,8 +1407,14 @@ struct AssumeTimezone {
 
   template <typename T, typename Arg0>
   T Call(KernelContext*, Arg0 arg, Status* st) const {
+    Duration sys;
+    if (tz_cache_.TryToSys(local_time<Duration>(Duration{arg}), &sys)) {
+      return static_cast<T>(sys.count());
+    }
     try {
-      return get_local_time<T, Arg0>(arg, tz_);
+      const T result = get_local_time<T, Arg0>(arg, tz_);
+      tz_cache_.GetInfo(sys_time<Duration>(Duration{result}));
+      return result;
     } catch (const arrow_vendored::date::nonexistent_local_time& e) {
       switch (options.nonexistent) {
         case AssumeTimezoneOptions::Nonexistent::NONEXISTENT_RAISE: {
@@ -1443,6 +1450,7 @@ struct AssumeTimezone {
   }
   AssumeTimezoneOptions options;
   const time_zone* tz_;
+  mutable TimeZoneIntervalCache tz_cache_;
 };
 
 // ----------------------------------------------------------------------
@@ -21,6 +21,7 @@
 #include <cstdint>
 
 #include "arrow/compute/api_scalar.h"
+#include "arrow/util/macros.h"
 #include "arrow/vendored/datetime.h"
 
 namespace arrow {
@@ -34,6 +35,8 @@ using arrow_vendored::date::local_days;
 using arrow_vendored::date::local_time;
 using arrow_vendored::date::locate_zone;
 using arrow_vendored::date::sys_days;
+using arrow_vendored::date::sys_info;
+using arrow_vendored::date::sys_seconds;
 using arrow_vendored::date::sys_time;
 using arrow_vendored::date::time_zone;
 using arrow_vendored::date::year_month_day;
@@ -96,23 +99,81 @@ struct NonZonedLocalizer {
   sys_days ConvertDays(sys_days d) const { return d; }
 };
 
+// Caches the timezone interval (the time span with a constant UTC offset) of the
+// last converted time point.  Consecutive values of an array most often fall into
+// the same interval, and can then be converted without looking up the timezone
+// transitions.
+class TimeZoneIntervalCache {
+ public:
+  explicit TimeZoneIntervalCache(const time_zone* tz) : tz_(tz), info_() {}
+
+  // The interval of the given time point
+  const sys_info& GetInfo(sys_seconds t) {
+    if (ARROW_PREDICT_FALSE(t < info_.begin || t >= info_.end)) {
+      info_ = tz_->get_info(t);
+    }
+    return info_;
+  }
+
+  template <typename Duration>
+  const sys_info& GetInfo(sys_time<Duration> t) {
+    return GetInfo(floor<std::chrono::seconds>(t));
+  }
+
+  // UTC -> local time
+  template <typename Duration>
+  local_time<Duration> ToLocal(sys_time<Duration> t) {
+    return local_time<Duration>(t.time_since_epoch() + GetInfo(t).offset);
+  }
+
+  // Local time -> UTC, only if the local time maps to a UTC time of the cached
+  // interval which is too far from its bounds to be ambiguous or nonexistent
+  template <typename Duration>
+  bool TryToSys(local_time<Duration> t, Duration* out) const {
+    // Larger than any change of UTC offset between two intervals
+    const std::chrono::seconds max_offset_change{2 * 24 * 3600};
+    const sys_seconds s{floor<std::chrono::seconds>(t).time_since_epoch() -
+                        info_.offset};
+    if (s >= info_.begin + max_offset_change && s < info_.end - max_offset_change) {
+      *out = t.time_since_epoch() - info_.offset;
+      return true;
+    }
+    return false;
+  }
+
+ private:
+  const time_zone* tz_;
+  // Initially empty
+  sys_info info_;
+};
+
 struct ZonedLocalizer {
   using days_t = local_days;
 
+  explicit ZonedLocalizer(const time_zone* tz) : tz(tz), cache(tz) {}
+
   // Timezone-localizing conversions: UTC -> local time
   const time_zone* tz;
+  // Mutable as the conversions are const, a localizer is not shared between threads
+  mutable TimeZoneIntervalCache cache;
 
   template <typename Duration>
   local_time<Duration> ConvertTimePoint(int64_t t) const {
-    return tz->to_local(sys_time<Duration>(Duration{t}));
+    return cache.ToLocal(sys_time<Duration>(Duration{t}));
   }
 
   template <typename Duration>
   Duration ConvertLocalToSys(Duration t, Status* st) const {
+    Duration out;
+    if (cache.TryToSys(local_time<Duration>(t), &out)) {
+      return out;
+    }
     try {
-      return zoned_time<Duration>{tz, local_time<Duration>(t)}
-          .get_sys_time()
-          .time_since_epoch();
+      out = zoned_time<Duration>{tz, local_time<Duration>(t)}
+                .get_sys_time()
+                .time_since_epoch();
+      cache.GetInfo(sys_time<Duration>(out));
+      return out;
     } catch (const arrow_vendored::date::nonexistent_local_time& e) {
       *st = Status::Invalid("Local time does not exist: ", e.what());
       return Duration{0};
@@ -128,12 +189,12 @@ struct ZonedLocalizer {
 template <typename Duration>
 struct TimestampFormatter {
   const char* format;
-  const time_zone* tz;
+  TimeZoneIntervalCache tz_cache;
   std::ostringstream bufstream;
 
   explicit TimestampFormatter(const std::string& format, const time_zone* tz,
                               const std::locale& locale)
-      : format(format.c_str()), tz(tz) {
+      : format(format.c_str()), tz_cache(tz) {
     bufstream.imbue(locale);
     // Propagate errors as C++ exceptions (to get an actual error message)
     bufstream.exceptions(std::ios::failbit | std::ios::badbit);
@@ -141,9 +202,15 @@ struct TimestampFormatter {
 
   Result<std::string> operator()(int64_t arg) {
     bufstream.str("");
-    const auto zt = zoned_time<Duration>{tz, sys_time<Duration>(Duration{arg})};
+    // Same as formatting a zoned_time, without looking up the timezone interval
+    // for every value
+    using LocalDuration = typename zoned_time<Duration>::duration;
+    const sys_time<Duration> t{Duration{arg}};
+    const sys_info& info = tz_cache.GetInfo(t);
+    const local_time<LocalDuration> local{(t + info.offset).time_since_epoch()};
     try {
-      arrow_vendored::date::to_stream(bufstream, format, zt);
+      arrow_vendored::date::to_stream(bufstream, format, local, &info.abbrev,
+                                      &info.offset);
     } catch (const std::runtime_error& ex) {
       bufstream.clear();
       return Status::Invalid("Failed formatting timestamp: ", ex.what());
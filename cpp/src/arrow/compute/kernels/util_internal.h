@@ -25,8 +25,10 @@
 #include "arrow/buffer.h"
 #include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/type_fwd.h"
+#include "arrow/type.h"
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bitmap_ops.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/math_constants.h"
 
 namespace arrow {
@@ -145,6 +147,13 @@ int64_t CopyNonNullValues(const ChunkedArray& arr, T* out) {
 
 ExecValue GetExecValue(const Datum& value);
 
+// Whether all values of the type are decimal128 values of at most 18 digits,
+// which can be computed on as int64 (the low word of the decimal)
+inline bool DecimalFitsInt64(const DataType& type) {
+  return type.id() == Type::DECIMAL128 &&
+         ::arrow::internal::checked_cast<const DecimalType&>(type).precision() <= 18;
+}
+
 int64_t GetTrueCount(const ArraySpan& mask);
 
 }  // namespace internal
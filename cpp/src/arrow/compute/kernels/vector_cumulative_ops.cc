@@ -15,16 +15,22 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
 #include "arrow/array/array_base.h"
-#include "arrow/array/builder_primitive.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
+#include "arrow/compute/exec_internal.h"
 #include "arrow/compute/kernels/base_arithmetic_internal.h"
 #include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/result.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/visit_type_inline.h"
 
 namespace arrow {
@@ -33,6 +39,16 @@ namespace internal {
 
 namespace {
 
+// The `start` value of the options, or null to start from the identity of the
+// operation
+const std::shared_ptr<Scalar>* GetStart(const CumulativeSumOptions& options) {
+  return options.start ? &options.start : nullptr;
+}
+
+const std::shared_ptr<Scalar>* GetStart(const CumulativeOptions& options) {
+  return options.start.has_value() ? &*options.start : nullptr;
+}
+
 template <typename OptionsType>
 struct CumulativeOptionsWrapper : public OptionsWrapper<OptionsType> {
   using State = CumulativeOptionsWrapper<OptionsType>;
@@ -48,83 +64,200 @@ struct CumulativeOptionsWrapper : public OptionsWrapper<OptionsType> {
           "Attempted to initialize KernelState from null FunctionOptions");
     }
 
-    const auto& start = options->start;
-    if (!start || !start->is_valid) {
+    const std::shared_ptr<Scalar>* start = GetStart(*options);
+    if (start == nullptr) {
+      return ::arrow::internal::make_unique<State>(*options);
+    }
+    if (!*start || !(*start)->is_valid) {
       return Status::Invalid("Cumulative `start` option must be non-null and valid");
     }
 
     // Ensure `start` option matches input type
-    if (!start->type->Equals(args.inputs[0].type)) {
+    if (!(*start)->type->Equals(args.inputs[0].type)) {
       ARROW_ASSIGN_OR_RAISE(auto casted_start,
-                            Cast(Datum(start), args.inputs[0].type, CastOptions::Safe(),
+                            Cast(Datum(*start), args.inputs[0].type, CastOptions::Safe(),
                                  ctx->exec_context()));
-      auto new_options = OptionsType(casted_start.scalar(), options->skip_nulls);
-      return ::arrow::internal::make_unique<State>(new_options);
+      auto new_options = *options;
+      new_options.start = casted_start.scalar();
+      return ::arrow::internal::make_unique<State>(std::move(new_options));
     }
     return ::arrow::internal::make_unique<State>(*options);
   }
 };
 
+// The value a cumulative operation starts from when no `start` is given
+template <typename Op, typename T>
+struct CumulativeIdentity;
+
+template <typename T>
+struct CumulativeIdentity<Add, T> {
+  static T value() { return 0; }
+};
+
+template <typename T>
+struct CumulativeIdentity<AddChecked, T> : CumulativeIdentity<Add, T> {};
+
+template <typename T>
+struct CumulativeIdentity<Multiply, T> {
+  static T value() { return 1; }
+};
+
+template <typename T>
+struct CumulativeIdentity<MultiplyChecked, T> : CumulativeIdentity<Multiply, T> {};
+
+template <typename T>
+struct CumulativeIdentity<Min, T> {
+  static T value() {
+    return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                : std::numeric_limits<T>::max();
+  }
+};
+
+template <typename T>
+struct CumulativeIdentity<Max, T> {
+  static T value() {
+    return std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity()
+                                                : std::numeric_limits<T>::lowest();
+  }
+};
+
+// Whether scanning chunks independently and then combining each chunk with the
+// total of the preceding ones gives exactly the result of a sequential scan.
+// This excludes floating-point sums and products, whose rounding depends on the
+// evaluation order, and the checked variants, which must detect an overflowing
+// intermediate result even if the final total doesn't overflow.
+template <typename Op, typename T>
+struct IsReassociable : std::false_type {};
+
+template <typename T>
+struct IsReassociable<Add, T> : std::is_integral<T> {};
+
+template <typename T>
+struct IsReassociable<Multiply, T> : std::is_integral<T> {};
+
+template <typename T>
+struct IsReassociable<Min, T> : std::true_type {};
+
+template <typename T>
+struct IsReassociable<Max, T> : std::true_type {};
+
+// Visit the values of `input` in order, calling `on_value` for the ones which
+// contribute to the running result and `on_null` for each null output. Unless
+// `skip_nulls` is true, the first null (in this input or an earlier one, as
+// tracked by `encountered_null`) is propagated through the remaining output.
+template <typename ArgType, typename OnValue, typename OnNull>
+void VisitCumulative(const ArraySpan& input, bool skip_nulls, bool* encountered_null,
+                     OnValue&& on_value, OnNull&& on_null) {
+  using ArgValue = typename GetViewType<ArgType>::T;
+  if (skip_nulls || (input.GetNullCount() == 0 && !*encountered_null)) {
+    VisitArrayValuesInline<ArgType>(input, std::forward<OnValue>(on_value),
+                                    std::forward<OnNull>(on_null));
+    return;
+  }
+  VisitArrayValuesInline<ArgType>(
+      input,
+      [&](ArgValue v) {
+        if (*encountered_null) {
+          on_null();
+        } else {
+          on_value(v);
+        }
+      },
+      [&]() {
+        *encountered_null = true;
+        on_null();
+      });
+}
+
+// The values and validity buffers of a cumulative result, filled in order
+template <typename OutValue>
+struct CumulativeOutput {
+  std::shared_ptr<Buffer> validity_buffer;
+  std::shared_ptr<Buffer> values_buffer;
+  uint8_t* validity = nullptr;
+  OutValue* values = nullptr;
+  int64_t position = 0;
+  int64_t null_count = 0;
+
+  Status Allocate(KernelContext* ctx, int64_t length) {
+    ARROW_ASSIGN_OR_RAISE(validity_buffer, ctx->AllocateBitmap(length));
+    ARROW_ASSIGN_OR_RAISE(values_buffer,
+                          ctx->Allocate(length * static_cast<int64_t>(sizeof(OutValue))));
+    validity = validity_buffer->mutable_data();
+    values = reinterpret_cast<OutValue*>(values_buffer->mutable_data());
+    return Status::OK();
+  }
+
+  void AppendValue(OutValue v) {
+    values[position] = v;
+    bit_util::SetBit(validity, position++);
+  }
+
+  void AppendNull() {
+    values[position] = OutValue{};
+    bit_util::ClearBit(validity, position++);
+    ++null_count;
+  }
+
+  std::shared_ptr<ArrayData> Finish(std::shared_ptr<DataType> type) {
+    return ArrayData::Make(std::move(type), position,
+                           {null_count > 0 ? validity_buffer : nullptr, values_buffer},
+                           null_count);
+  }
+};
+
 // The driver kernel for all cumulative compute functions. Op is a compute kernel
-// representing any binary associative operation (add, product, min, max, etc.) and
-// OptionsType the options type corresponding to Op. ArgType and OutType are the input
-// and output types, which will normally be the same (e.g. the cumulative sum of an array
-// of Int64Type will result in an array of Int64Type).
-template <typename OutType, typename ArgType, typename Op, typename OptionsType>
+// representing any binary associative operation (add, product, min, max, etc.).
+// ArgType and OutType are the input and output types, which will normally be the
+// same (e.g. the cumulative sum of an array of Int64Type will result in an array of
+// Int64Type).
+template <typename OutType, typename ArgType, typename Op>
 struct Accumulator {
   using OutValue = typename GetOutputType<OutType>::T;
   using ArgValue = typename GetViewType<ArgType>::T;
 
   KernelContext* ctx;
-  ArgValue current_value;
+  OutValue current_value;
   bool skip_nulls;
   bool encountered_null = false;
-  NumericBuilder<OutType> builder;
+  CumulativeOutput<OutValue>* out;
 
-  explicit Accumulator(KernelContext* ctx) : ctx(ctx), builder(ctx->memory_pool()) {}
+  Accumulator(KernelContext* ctx, OutValue start, bool skip_nulls,
+              CumulativeOutput<OutValue>* out)
+      : ctx(ctx), current_value(start), skip_nulls(skip_nulls), out(out) {}
 
   Status Accumulate(const ArraySpan& input) {
     Status st = Status::OK();
-
-    if (skip_nulls || (input.GetNullCount() == 0 && !encountered_null)) {
-      VisitArrayValuesInline<ArgType>(
-          input,
-          [&](ArgValue v) {
-            current_value = Op::template Call<OutValue, ArgValue, ArgValue>(
-                ctx, v, current_value, &st);
-            builder.UnsafeAppend(current_value);
-          },
-          [&]() { builder.UnsafeAppendNull(); });
-    } else {
-      int64_t nulls_start_idx = 0;
-      VisitArrayValuesInline<ArgType>(
-          input,
-          [&](ArgValue v) {
-            if (!encountered_null) {
-              current_value = Op::template Call<OutValue, ArgValue, ArgValue>(
-                  ctx, v, current_value, &st);
-              builder.UnsafeAppend(current_value);
-              ++nulls_start_idx;
-            }
-          },
-          [&]() { encountered_null = true; });
-
-      RETURN_NOT_OK(builder.AppendNulls(input.length - nulls_start_idx));
-    }
-
+    VisitCumulative<ArgType>(
+        input, skip_nulls, &encountered_null,
+        [&](ArgValue v) {
+          current_value =
+              Op::template Call<OutValue, ArgValue, ArgValue>(ctx, v, current_value, &st);
+          out->AppendValue(current_value);
+        },
+        [&]() { out->AppendNull(); });
     return st;
   }
 };
 
+template <typename OutType, typename Op, typename OptionsType>
+typename GetOutputType<OutType>::T GetStartValue(const OptionsType& options) {
+  using OutValue = typename GetOutputType<OutType>::T;
+  const std::shared_ptr<Scalar>* start = GetStart(options);
+  return start ? UnboxScalar<OutType>::Unbox(**start)
+               : CumulativeIdentity<Op, OutValue>::value();
+}
+
 template <typename OutType, typename ArgType, typename Op, typename OptionsType>
 struct CumulativeKernel {
+  using OutValue = typename GetOutputType<OutType>::T;
+
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
     const auto& options = CumulativeOptionsWrapper<OptionsType>::Get(ctx);
-    Accumulator<OutType, ArgType, Op, OptionsType> accumulator(ctx);
-    accumulator.current_value = UnboxScalar<OutType>::Unbox(*(options.start));
-    accumulator.skip_nulls = options.skip_nulls;
-
-    RETURN_NOT_OK(accumulator.builder.Reserve(batch.length));
+    CumulativeOutput<OutValue> output;
+    RETURN_NOT_OK(output.Allocate(ctx, batch.length));
+    Accumulator<OutType, ArgType, Op> accumulator(
+        ctx, GetStartValue<OutType, Op>(options), options.skip_nulls, &output);
 
     if (batch[0].is_array()) {
       RETURN_NOT_OK(accumulator.Accumulate(batch[0].array));
@@ -134,30 +267,175 @@ struct CumulativeKernel {
       RETURN_NOT_OK(accumulator.Accumulate(span));
     }
 
-    std::shared_ptr<ArrayData> result;
-    RETURN_NOT_OK(accumulator.builder.FinishInternal(&result));
-    out->value = std::move(result);
+    out->value = output.Finish(TypeTraits<OutType>::type_singleton());
     return Status::OK();
   }
 };
 
 template <typename OutType, typename ArgType, typename Op, typename OptionsType>
 struct CumulativeKernelChunked {
+  using OutValue = typename GetOutputType<OutType>::T;
+
   static Status Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
     const auto& options = CumulativeOptionsWrapper<OptionsType>::Get(ctx);
-    Accumulator<OutType, ArgType, Op, OptionsType> accumulator(ctx);
-    accumulator.current_value = UnboxScalar<OutType>::Unbox(*(options.start));
-    accumulator.skip_nulls = options.skip_nulls;
+    const ChunkedArray& chunked_input = *batch[0].chunked_array();
+    CumulativeOutput<OutValue> output;
+    RETURN_NOT_OK(output.Allocate(ctx, chunked_input.length()));
+
+    const ExecContext* exec_ctx = ctx->exec_context();
+    if (IsReassociable<Op, OutValue>::value && chunked_input.num_chunks() > 1 &&
+        exec_ctx->parallelize_chunks() && exec_ctx->use_threads()) {
+      RETURN_NOT_OK(ExecParallel(ctx, options, chunked_input, &output));
+    } else {
+      Accumulator<OutType, ArgType, Op> accumulator(
+          ctx, GetStartValue<OutType, Op>(options), options.skip_nulls, &output);
+      for (const auto& chunk : chunked_input.chunks()) {
+        RETURN_NOT_OK(accumulator.Accumulate(*chunk->data()));
+      }
+    }
+    out->value = output.Finish(chunked_input.type());
+    return Status::OK();
+  }
+
+  // A two-phase scan: each chunk is first scanned from the identity of Op, then
+  // the running total of the preceding chunks is folded into its results.
+  static Status ExecParallel(KernelContext* ctx, const OptionsType& options,
+                             const ChunkedArray& chunked_input,
+                             CumulativeOutput<OutValue>* output) {
+    const int num_chunks = chunked_input.num_chunks();
+    std::vector<int64_t> chunk_offsets(num_chunks);
+    for (int i = 1; i < num_chunks; ++i) {
+      chunk_offsets[i] = chunk_offsets[i - 1] + chunked_input.chunk(i - 1)->length();
+    }
+
+    // Each chunk gets its own validity bitmap, as its first and last bits may share
+    // a byte of the output bitmap with the neighbouring chunks
+    std::vector<CumulativeOutput<OutValue>> chunk_outputs(num_chunks);
+    std::vector<OutValue> chunk_totals(num_chunks);
+    std::vector<char> chunk_has_null(num_chunks);
+    RETURN_NOT_OK(compute::detail::ParallelForChunks(
+        ctx->exec_context(), num_chunks, [&](int i, ExecContext* task_ctx) -> Status {
+          KernelContext task_kernel_ctx(task_ctx);
+          CumulativeOutput<OutValue>& chunk_output = chunk_outputs[i];
+          ARROW_ASSIGN_OR_RAISE(chunk_output.validity_buffer,
+                                task_kernel_ctx.AllocateBitmap(
+                                    chunked_input.chunk(i)->length()));
+          chunk_output.validity = chunk_output.validity_buffer->mutable_data();
+          chunk_output.values = output->values + chunk_offsets[i];
+          Accumulator<OutType, ArgType, Op> accumulator(
+              &task_kernel_ctx, CumulativeIdentity<Op, OutValue>::value(),
+              options.skip_nulls, &chunk_output);
+          RETURN_NOT_OK(accumulator.Accumulate(*chunked_input.chunk(i)->data()));
+          chunk_totals[i] = accumulator.current_value;
+          chunk_has_null[i] = accumulator.encountered_null;
+          return Status::OK();
+        }));
+
+    // Compute the running total before each chunk and assemble the validity
+    std::vector<OutValue> chunk_prefixes(num_chunks);
+    std::vector<char> chunk_nulled(num_chunks);
+    OutValue running = GetStartValue<OutType, Op>(options);
+    bool encountered_null = false;
+    Status st = Status::OK();
+    for (int i = 0; i < num_chunks; ++i) {
+      const int64_t length = chunked_input.chunk(i)->length();
+      chunk_prefixes[i] = running;
+      chunk_nulled[i] = encountered_null;
+      if (encountered_null) {
+        bit_util::SetBitsTo(output->validity, chunk_offsets[i], length, false);
+        output->null_count += length;
+      } else {
+        ::arrow::internal::CopyBitmap(chunk_outputs[i].validity, 0, length,
+                                      output->validity, chunk_offsets[i]);
+        output->null_count += chunk_outputs[i].null_count;
+      }
+      running = Op::template Call<OutValue, OutValue, OutValue>(ctx, chunk_totals[i],
+                                                                running, &st);
+      encountered_null = encountered_null || chunk_has_null[i];
+    }
+    RETURN_NOT_OK(st);
+    output->position = chunk_offsets[num_chunks - 1] +
+                       chunked_input.chunk(num_chunks - 1)->length();
+
+    return compute::detail::ParallelForChunks(
+        ctx->exec_context(), num_chunks, [&](int i, ExecContext* task_ctx) -> Status {
+          if (chunk_nulled[i]) {
+            return Status::OK();
+          }
+          KernelContext task_kernel_ctx(task_ctx);
+          Status st = Status::OK();
+          const OutValue prefix = chunk_prefixes[i];
+          OutValue* values = output->values + chunk_offsets[i];
+          const int64_t length = chunked_input.chunk(i)->length();
+          for (int64_t j = 0; j < length; ++j) {
+            values[j] = Op::template Call<OutValue, OutValue, OutValue>(
+                &task_kernel_ctx, values[j], prefix, &st);
+          }
+          return st;
+        });
+  }
+};
+
+// The cumulative mean is computed from a running sum and count, so that the
+// output doesn't accumulate the rounding errors of repeated divisions
+template <typename ArgType>
+struct MeanAccumulator {
+  using ArgValue = typename GetViewType<ArgType>::T;
 
+  double sum = 0;
+  int64_t count = 0;
+  bool skip_nulls;
+  bool encountered_null = false;
+  CumulativeOutput<double>* out;
+
+  MeanAccumulator(bool skip_nulls, CumulativeOutput<double>* out)
+      : skip_nulls(skip_nulls), out(out) {}
+
+  void Accumulate(const ArraySpan& input) {
+    VisitCumulative<ArgType>(
+        input, skip_nulls, &encountered_null,
+        [&](ArgValue v) {
+          sum += static_cast<double>(v);
+          out->AppendValue(sum / static_cast<double>(++count));
+        },
+        [&]() { out->AppendNull(); });
+  }
+};
+
+Result<std::unique_ptr<KernelState>> CumulativeMeanInit(KernelContext* ctx,
+                                                        const KernelInitArgs& args) {
+  auto options = checked_cast<const CumulativeOptions*>(args.options);
+  if (options && options->start.has_value()) {
+    return Status::Invalid("Cumulative `start` option is not supported for mean");
+  }
+  return CumulativeOptionsWrapper<CumulativeOptions>::Init(ctx, args);
+}
+
+template <typename OutType, typename ArgType, typename Op, typename OptionsType>
+struct CumulativeMeanKernel {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    const auto& options = CumulativeOptionsWrapper<CumulativeOptions>::Get(ctx);
+    CumulativeOutput<double> output;
+    RETURN_NOT_OK(output.Allocate(ctx, batch.length));
+    MeanAccumulator<ArgType> accumulator(options.skip_nulls, &output);
+    accumulator.Accumulate(batch[0].array);
+    out->value = output.Finish(float64());
+    return Status::OK();
+  }
+};
+
+template <typename OutType, typename ArgType, typename Op, typename OptionsType>
+struct CumulativeMeanKernelChunked {
+  static Status Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const auto& options = CumulativeOptionsWrapper<CumulativeOptions>::Get(ctx);
     const ChunkedArray& chunked_input = *batch[0].chunked_array();
-    RETURN_NOT_OK(accumulator.builder.Reserve(chunked_input.length()));
-    std::vector<std::shared_ptr<Array>> out_chunks;
+    CumulativeOutput<double> output;
+    RETURN_NOT_OK(output.Allocate(ctx, chunked_input.length()));
+    MeanAccumulator<ArgType> accumulator(options.skip_nulls, &output);
     for (const auto& chunk : chunked_input.chunks()) {
-      RETURN_NOT_OK(accumulator.Accumulate(*chunk->data()));
+      accumulator.Accumulate(*chunk->data());
     }
-    std::shared_ptr<ArrayData> result;
-    RETURN_NOT_OK(accumulator.builder.FinishInternal(&result));
-    out->value = std::move(result);
+    out->value = output.Finish(float64());
     return Status::OK();
   }
 };
@@ -179,11 +457,55 @@ const FunctionDoc cumulative_sum_checked_doc{
      "function \"cumulative_sum\"."),
     {"values"},
     "CumulativeSumOptions"};
+
+const FunctionDoc cumulative_prod_doc{
+    "Compute the cumulative product over a numeric input",
+    ("`values` must be numeric. Return an array/chunked array which is the\n"
+     "cumulative product computed over `values`. Results will wrap around on\n"
+     "integer overflow. Use function \"cumulative_prod_checked\" if you want\n"
+     "overflow to return an error."),
+    {"values"},
+    "CumulativeOptions"};
+
+const FunctionDoc cumulative_prod_checked_doc{
+    "Compute the cumulative product over a numeric input",
+    ("`values` must be numeric. Return an array/chunked array which is the\n"
+     "cumulative product computed over `values`. This function returns an error\n"
+     "on overflow. For a variant that doesn't fail on overflow, use\n"
+     "function \"cumulative_prod\"."),
+    {"values"},
+    "CumulativeOptions"};
+
+const FunctionDoc cumulative_min_doc{
+    "Compute the cumulative minimum over a numeric input",
+    ("`values` must be numeric. Return an array/chunked array which is the\n"
+     "cumulative minimum computed over `values`. NaNs are ignored unless all\n"
+     "the values so far are NaN."),
+    {"values"},
+    "CumulativeOptions"};
+
+const FunctionDoc cumulative_max_doc{
+    "Compute the cumulative maximum over a numeric input",
+    ("`values` must be numeric. Return an array/chunked array which is the\n"
+     "cumulative maximum computed over `values`. NaNs are ignored unless all\n"
+     "the values so far are NaN."),
+    {"values"},
+    "CumulativeOptions"};
+
+const FunctionDoc cumulative_mean_doc{
+    "Compute the cumulative mean over a numeric input",
+    ("`values` must be numeric. Return a float64 array/chunked array which is\n"
+     "the cumulative mean computed over `values`. The `start` option is not\n"
+     "supported."),
+    {"values"},
+    "CumulativeOptions"};
 }  // namespace
 
-template <typename Op, typename OptionsType>
+template <template <typename...> class Kernel, template <typename...> class KernelChunked,
+          typename Op, typename OptionsType>
 void MakeVectorCumulativeFunction(FunctionRegistry* registry, const std::string func_name,
-                                  const FunctionDoc doc) {
+                                  const FunctionDoc doc, OutputType out_type,
+                                  KernelInit init) {
   static const OptionsType kDefaultOptions = OptionsType::Defaults();
   auto func =
       std::make_shared<VectorFunction>(func_name, Arity::Unary(), doc, &kDefaultOptions);
@@ -196,25 +518,45 @@ void MakeVectorCumulativeFunction(FunctionRegistry* registry, const std::string
     kernel.can_execute_chunkwise = false;
     kernel.null_handling = NullHandling::type::COMPUTED_NO_PREALLOCATE;
     kernel.mem_allocation = MemAllocation::type::NO_PREALLOCATE;
-    kernel.signature =
-        KernelSignature::Make({InputType::Array(ty)}, OutputType(ValueDescr(ty)));
-    kernel.exec =
-        ArithmeticExecFromOp<CumulativeKernel, Op, ArrayKernelExec, OptionsType>(ty);
+    kernel.signature = KernelSignature::Make({InputType::Array(ty)}, out_type);
+    kernel.exec = ArithmeticExecFromOp<Kernel, Op, ArrayKernelExec, OptionsType>(ty);
     kernel.exec_chunked =
-        ArithmeticExecFromOp<CumulativeKernelChunked, Op, VectorKernel::ChunkedExec,
-                             OptionsType>(ty);
-    kernel.init = CumulativeOptionsWrapper<OptionsType>::Init;
+        ArithmeticExecFromOp<KernelChunked, Op, VectorKernel::ChunkedExec, OptionsType>(
+            ty);
+    kernel.init = init;
     DCHECK_OK(func->AddKernel(std::move(kernel)));
   }
 
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
-void RegisterVectorCumulativeSum(FunctionRegistry* registry) {
+template <typename Op, typename OptionsType>
+void MakeVectorCumulativeFunction(FunctionRegistry* registry, const std::string func_name,
+                                  const FunctionDoc doc) {
+  MakeVectorCumulativeFunction<CumulativeKernel, CumulativeKernelChunked, Op,
+                               OptionsType>(registry, func_name, doc,
+                                            OutputType(FirstType),
+                                            CumulativeOptionsWrapper<OptionsType>::Init);
+}
+
+void RegisterVectorCumulativeOps(FunctionRegistry* registry) {
   MakeVectorCumulativeFunction<Add, CumulativeSumOptions>(registry, "cumulative_sum",
                                                           cumulative_sum_doc);
   MakeVectorCumulativeFunction<AddChecked, CumulativeSumOptions>(
       registry, "cumulative_sum_checked", cumulative_sum_checked_doc);
+  MakeVectorCumulativeFunction<Multiply, CumulativeOptions>(registry, "cumulative_prod",
+                                                            cumulative_prod_doc);
+  MakeVectorCumulativeFunction<MultiplyChecked, CumulativeOptions>(
+      registry, "cumulative_prod_checked", cumulative_prod_checked_doc);
+  MakeVectorCumulativeFunction<Min, CumulativeOptions>(registry, "cumulative_min",
+                                                       cumulative_min_doc);
+  MakeVectorCumulativeFunction<Max, CumulativeOptions>(registry, "cumulative_max",
+                                                       cumulative_max_doc);
+  MakeVectorCumulativeFunction<CumulativeMeanKernel, CumulativeMeanKernelChunked, Add,
+                               CumulativeOptions>(registry, "cumulative_mean",
+                                                  cumulative_mean_doc,
+                                                  OutputType(float64()),
+                                                  CumulativeMeanInit);
 }
 
 }  // namespace internal
@@ -30,6 +30,7 @@
 #include "arrow/array/builder_primitive.h"
 #include "arrow/compute/api.h"
 #include "arrow/compute/kernels/test_util.h"
+#include "arrow/testing/random.h"
 
 namespace arrow {
 namespace compute {
@@ -320,5 +321,147 @@ TEST(TestCumulativeSum, HasStartDoSkip) {
   }
 }
 
+TEST(TestCumulativeOps, NoStart) {
+  for (auto skip_nulls : {false, true}) {
+    CumulativeOptions options(skip_nulls);
+    for (auto ty : NumericTypes()) {
+      CheckVectorUnary("cumulative_prod", ArrayFromJSON(ty, "[1, 2, 3, 4]"),
+                       ArrayFromJSON(ty, "[1, 2, 6, 24]"), &options);
+      CheckVectorUnary("cumulative_prod_checked", ArrayFromJSON(ty, "[1, 2, 3, 4]"),
+                       ArrayFromJSON(ty, "[1, 2, 6, 24]"), &options);
+      CheckVectorUnary("cumulative_min", ArrayFromJSON(ty, "[5, 3, 4, 1, 2]"),
+                       ArrayFromJSON(ty, "[5, 3, 3, 1, 1]"), &options);
+      CheckVectorUnary("cumulative_max", ArrayFromJSON(ty, "[1, 3, 2, 5, 4]"),
+                       ArrayFromJSON(ty, "[1, 3, 3, 5, 5]"), &options);
+      CheckVectorUnary("cumulative_mean", ArrayFromJSON(ty, "[1, 3, 2, 6]"),
+                       ArrayFromJSON(float64(), "[1, 2, 2, 3]"), &options);
+
+      CheckVectorUnary("cumulative_prod",
+                       ChunkedArrayFromJSON(ty, {"[1, 2]", "[3, 4]"}),
+                       ChunkedArrayFromJSON(ty, {"[1, 2, 6, 24]"}), &options);
+      CheckVectorUnary("cumulative_min",
+                       ChunkedArrayFromJSON(ty, {"[5, 3]", "[]", "[4, 1, 2]"}),
+                       ChunkedArrayFromJSON(ty, {"[5, 3, 3, 1, 1]"}), &options);
+      CheckVectorUnary("cumulative_max",
+                       ChunkedArrayFromJSON(ty, {"[1, 3, 2]", "[5, 4]"}),
+                       ChunkedArrayFromJSON(ty, {"[1, 3, 3, 5, 5]"}), &options);
+      CheckVectorUnary("cumulative_mean",
+                       ChunkedArrayFromJSON(ty, {"[1, 3]", "[2, 6]"}),
+                       ChunkedArrayFromJSON(float64(), {"[1, 2, 2, 3]"}), &options);
+    }
+  }
+}
+
+TEST(TestCumulativeOps, Nulls) {
+  CumulativeOptions no_skip(/*skip_nulls=*/false);
+  CumulativeOptions skip(/*skip_nulls=*/true);
+  for (auto ty : NumericTypes()) {
+    auto input = ArrayFromJSON(ty, "[2, null, 3, 1]");
+    CheckVectorUnary("cumulative_prod", input,
+                     ArrayFromJSON(ty, "[2, null, null, null]"), &no_skip);
+    CheckVectorUnary("cumulative_prod", input, ArrayFromJSON(ty, "[2, null, 6, 6]"),
+                     &skip);
+    CheckVectorUnary("cumulative_min", input, ArrayFromJSON(ty, "[2, null, 2, 1]"),
+                     &skip);
+    CheckVectorUnary("cumulative_max", input, ArrayFromJSON(ty, "[2, null, 3, 3]"),
+                     &skip);
+    CheckVectorUnary("cumulative_mean", input,
+                     ArrayFromJSON(float64(), "[2, null, null, null]"), &no_skip);
+    CheckVectorUnary("cumulative_mean", input,
+                     ArrayFromJSON(float64(), "[2, null, 2.5, 2]"), &skip);
+
+    auto chunked = ChunkedArrayFromJSON(ty, {"[2]", "[null, 3]", "[1]"});
+    CheckVectorUnary("cumulative_max", chunked,
+                     ChunkedArrayFromJSON(ty, {"[2, null, null, null]"}), &no_skip);
+    CheckVectorUnary("cumulative_max", chunked,
+                     ChunkedArrayFromJSON(ty, {"[2, null, 3, 3]"}), &skip);
+  }
+}
+
+TEST(TestCumulativeOps, HasStart) {
+  CumulativeOptions options(/*start=*/2.0);
+  for (auto ty : NumericTypes()) {
+    CheckVectorUnary("cumulative_prod", ArrayFromJSON(ty, "[1, 2, 3]"),
+                     ArrayFromJSON(ty, "[2, 4, 12]"), &options);
+    CheckVectorUnary("cumulative_min", ArrayFromJSON(ty, "[3, 1, 4]"),
+                     ArrayFromJSON(ty, "[2, 1, 1]"), &options);
+    CheckVectorUnary("cumulative_max", ArrayFromJSON(ty, "[1, 3, 2]"),
+                     ArrayFromJSON(ty, "[2, 3, 3]"), &options);
+  }
+}
+
+TEST(TestCumulativeOps, FloatingPointNaN) {
+  CumulativeOptions options;
+  for (auto ty : {float32(), float64()}) {
+    CheckVectorUnary("cumulative_min", ArrayFromJSON(ty, "[NaN, 3, NaN, 1]"),
+                     ArrayFromJSON(ty, "[Inf, 3, 3, 1]"), &options);
+    CheckVectorUnary("cumulative_max", ArrayFromJSON(ty, "[NaN, 3, NaN, 1]"),
+                     ArrayFromJSON(ty, "[-Inf, 3, 3, 3]"), &options);
+  }
+}
+
+TEST(TestCumulativeOps, MeanStartNotSupported) {
+  CumulativeOptions options(/*start=*/1.0);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, HasSubstr("not supported"),
+      CallFunction("cumulative_mean", {ArrayFromJSON(int64(), "[1, 2]")}, &options));
+}
+
+TEST(TestCumulativeOps, ProductOverflow) {
+  auto input = ArrayFromJSON(int8(), "[16, 16]");
+  CumulativeOptions options;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, HasSubstr("overflow"),
+      CallFunction("cumulative_prod_checked", {input}, &options));
+  CheckVectorUnary("cumulative_prod", input, ArrayFromJSON(int8(), "[16, 0]"),
+                   &options);
+}
+
+// With parallelize_chunks enabled, the chunks may be scanned in parallel and the
+// result must be the same as for a sequential scan
+TEST(TestCumulativeOps, ParallelChunks) {
+  random::RandomArrayGenerator rng(42);
+  ExecContext parallel_ctx;
+  parallel_ctx.set_parallelize_chunks(true);
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+
+  for (auto ty : {int8(), int32(), uint64(), float64()}) {
+    for (double null_probability : {0.0, 0.001}) {
+      auto values = rng.ArrayOf(ty, 10000, null_probability);
+      ArrayVector chunks;
+      for (int64_t offset = 0; offset < values->length(); offset += 999) {
+        chunks.push_back(values->Slice(offset, 999));
+      }
+      auto chunked = std::make_shared<ChunkedArray>(chunks);
+
+      for (auto skip_nulls : {false, true}) {
+        CumulativeOptions options(std::make_shared<Int8Scalar>(3), skip_nulls);
+        CumulativeSumOptions sum_options(std::make_shared<Int8Scalar>(3), skip_nulls);
+        for (std::string func : {"cumulative_sum", "cumulative_prod", "cumulative_min",
+                                 "cumulative_max"}) {
+          if (is_floating(ty->id()) &&
+              (func == "cumulative_sum" || func == "cumulative_prod")) {
+            // Always scanned sequentially, as floating-point rounding depends
+            // on the evaluation order
+            continue;
+          }
+          ARROW_SCOPED_TRACE(ty->ToString(), " ", func, " skip_nulls=", skip_nulls);
+          const FunctionOptions* func_options =
+              func == "cumulative_sum"
+                  ? static_cast<const FunctionOptions*>(&sum_options)
+                  : &options;
+          ASSERT_OK_AND_ASSIGN(Datum expected,
+                               CallFunction(func, {chunked}, func_options, &serial_ctx));
+          ASSERT_OK_AND_ASSIGN(
+              Datum actual, CallFunction(func, {chunked}, func_options, &parallel_ctx));
+          ValidateOutput(actual);
+          AssertDatumsEqual(expected, actual, /*verbose=*/true);
+        }
+      }
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
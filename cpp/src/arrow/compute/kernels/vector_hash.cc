@@ -573,6 +573,9 @@ KernelInit GetHashInit(Type::type type_id) {
     case Type::LARGE_BINARY:
     case Type::LARGE_STRING:
       return HashInit<LargeBinaryType, Action>;
+    case Type::BINARY_VIEW:
+    case Type::STRING_VIEW:
+      return HashInit<BinaryViewType, Action>;
     case Type::FIXED_SIZE_BINARY:
     case Type::DECIMAL128:
     case Type::DECIMAL256:
@@ -735,6 +738,12 @@ void AddHashKernels(VectorFunction* func, VectorKernel base, OutputType out_ty)
     base.signature = KernelSignature::Make({InputType::Array(ty)}, out_ty);
     DCHECK_OK(func->AddKernel(base));
   }
+
+  for (const auto& ty : {binary_view(), utf8_view()}) {
+    base.init = GetHashInit<Action>(ty->id());
+    base.signature = KernelSignature::Make({InputType::Array(ty)}, out_ty);
+    DCHECK_OK(func->AddKernel(base));
+  }
 }
 
 const FunctionDoc unique_doc(
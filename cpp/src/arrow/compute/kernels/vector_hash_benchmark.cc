@@ -232,6 +232,42 @@ void HashSetArgs(benchmark::internal::Benchmark* bench) {
   }
 }
 
+// clang-format off
+std::vector<HashBenchCase> high_cardinality_bench_cases = {
+  {kHashBenchmarkLength, kHashBenchmarkLength / 16, 0},
+  {kHashBenchmarkLength, kHashBenchmarkLength / 16, 0.1},
+  {kHashBenchmarkLength, kHashBenchmarkLength / 2, 0},
+  {kHashBenchmarkLength, kHashBenchmarkLength / 2, 0.1},
+  {kHashBenchmarkLength, kHashBenchmarkLength, 0},
+};
+// clang-format on
+
+static void UniqueInt64HighCardinality(benchmark::State& state) {
+  BenchUnique(state,
+              HashParams<Int64Type>{high_cardinality_bench_cases[state.range(0)]});
+}
+
+static void UniqueString10bytesHighCardinality(benchmark::State& state) {
+  BenchUnique(state,
+              HashParams<StringType>{high_cardinality_bench_cases[state.range(0)], 10});
+}
+
+static void DictionaryEncodeInt64HighCardinality(benchmark::State& state) {
+  BenchDictionaryEncode(
+      state, HashParams<Int64Type>{high_cardinality_bench_cases[state.range(0)]});
+}
+
+static void DictionaryEncodeString10bytesHighCardinality(benchmark::State& state) {
+  BenchDictionaryEncode(
+      state, HashParams<StringType>{high_cardinality_bench_cases[state.range(0)], 10});
+}
+
+void HighCardinalitySetArgs(benchmark::internal::Benchmark* bench) {
+  for (int i = 0; i < static_cast<int>(high_cardinality_bench_cases.size()); ++i) {
+    bench->Arg(i);
+  }
+}
+
 BENCHMARK(BuildDictionary);
 BENCHMARK(BuildStringDictionary);
 
@@ -239,6 +275,11 @@ BENCHMARK(UniqueInt64)->Apply(HashSetArgs);
 BENCHMARK(UniqueString10bytes)->Apply(HashSetArgs);
 BENCHMARK(UniqueString100bytes)->Apply(HashSetArgs);
 
+BENCHMARK(UniqueInt64HighCardinality)->Apply(HighCardinalitySetArgs);
+BENCHMARK(UniqueString10bytesHighCardinality)->Apply(HighCardinalitySetArgs);
+BENCHMARK(DictionaryEncodeInt64HighCardinality)->Apply(HighCardinalitySetArgs);
+BENCHMARK(DictionaryEncodeString10bytesHighCardinality)->Apply(HighCardinalitySetArgs);
+
 void UInt8SetArgs(benchmark::internal::Benchmark* bench) {
   for (int i = 0; i < static_cast<int>(uint8_bench_cases.size()); ++i) {
     bench->Arg(i);
@@ -502,6 +502,24 @@ TYPED_TEST(TestHashKernelBinaryTypes, DictEncode) {
       ArrayFromJSON(int32(), "[null, 0, 1, 0]"));
 }
 
+TEST(TestHashKernel, BinaryView) {
+  for (const auto& type : {binary_view(), utf8_view()}) {
+    ARROW_SCOPED_TRACE("type = ", *type);
+    // Mix inlined and out-of-line values
+    auto input = ArrayFromJSON(type, R"(["ab", null, "a longer value", "ab",
+                                        "a longer value", "a longer valuf", null])");
+    CheckUnique(input,
+                ArrayFromJSON(type, R"(["ab", null, "a longer value", "a longer valuf"])"));
+    CheckValueCounts(
+        input, ArrayFromJSON(type, R"(["ab", null, "a longer value", "a longer valuf"])"),
+        ArrayFromJSON(int64(), "[2, 2, 2, 1]"));
+
+    // Sliced
+    CheckUnique(input->Slice(1, 4),
+                ArrayFromJSON(type, R"([null, "a longer value", "ab"])"));
+  }
+}
+
 TYPED_TEST(TestHashKernelBinaryTypes, BinaryResizeTable) {
   const int32_t kTotalValues = 10000;
 #if !defined(ARROW_VALGRIND)
@@ -0,0 +1,215 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Vector kernels converting from and to run-end encoded data
+
+#include <cstring>
+
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/ree_util_internal.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/ree_util.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+namespace {
+
+using RunEndEncodeState = OptionsWrapper<RunEndEncodeOptions>;
+
+// Find the runs of equal consecutive values, `equal(i, j)` comparing the
+// (valid) values at positions i and j relative to the array offset
+template <typename Equal>
+void FindRuns(const ArraySpan& values, Equal&& equal, RunEndEncodedBuilder* builder) {
+  const uint8_t* validity = values.null_count != 0 ? values.buffers[0].data : nullptr;
+  auto is_valid = [&](int64_t i) {
+    return validity == nullptr || bit_util::GetBit(validity, values.offset + i);
+  };
+  int64_t run_start = 0;
+  bool run_valid = values.length > 0 && is_valid(0);
+  for (int64_t i = 1; i < values.length; ++i) {
+    const bool valid = is_valid(i);
+    if (valid == run_valid && (!valid || equal(run_start, i))) {
+      continue;
+    }
+    builder->Append(run_valid ? run_start : -1, i - run_start);
+    run_start = i;
+    run_valid = valid;
+  }
+  builder->Append(run_valid ? run_start : -1, values.length - run_start);
+}
+
+template <typename CType>
+void FindFixedWidthRuns(const ArraySpan& values, RunEndEncodedBuilder* builder) {
+  const CType* data = values.GetValues<CType>(1);
+  FindRuns(
+      values, [&](int64_t i, int64_t j) { return data[i] == data[j]; }, builder);
+}
+
+template <typename OffsetType>
+void FindBinaryRuns(const ArraySpan& values, RunEndEncodedBuilder* builder) {
+  const OffsetType* offsets = values.GetValues<OffsetType>(1);
+  const uint8_t* data = values.buffers[2].data;
+  FindRuns(
+      values,
+      [&](int64_t i, int64_t j) {
+        const OffsetType length = offsets[i + 1] - offsets[i];
+        return length == offsets[j + 1] - offsets[j] &&
+               std::memcmp(data + offsets[i], data + offsets[j], length) == 0;
+      },
+      builder);
+}
+
+Status FindValueRuns(const ArraySpan& values, RunEndEncodedBuilder* builder) {
+  const DataType& type = *values.type;
+  if (type.id() == Type::NA) {
+    builder->Append(-1, values.length);
+    return Status::OK();
+  }
+  if (type.id() == Type::BOOL) {
+    const uint8_t* data = values.buffers[1].data;
+    const int64_t offset = values.offset;
+    FindRuns(
+        values,
+        [&](int64_t i, int64_t j) {
+          return bit_util::GetBit(data, offset + i) == bit_util::GetBit(data, offset + j);
+        },
+        builder);
+    return Status::OK();
+  }
+  if (is_fixed_width(type.id()) && type.id() != Type::DICTIONARY) {
+    const int byte_width = checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+    switch (byte_width) {
+      case 1:
+        FindFixedWidthRuns<uint8_t>(values, builder);
+        return Status::OK();
+      case 2:
+        FindFixedWidthRuns<uint16_t>(values, builder);
+        return Status::OK();
+      case 4:
+        FindFixedWidthRuns<uint32_t>(values, builder);
+        return Status::OK();
+      case 8:
+        FindFixedWidthRuns<uint64_t>(values, builder);
+        return Status::OK();
+      default: {
+        const uint8_t* data = values.buffers[1].data + values.offset * byte_width;
+        FindRuns(
+            values,
+            [&](int64_t i, int64_t j) {
+              return std::memcmp(data + i * byte_width, data + j * byte_width,
+                                 byte_width) == 0;
+            },
+            builder);
+        return Status::OK();
+      }
+    }
+  }
+  if (is_base_binary_like(type.id())) {
+    if (is_large_binary_like(type.id())) {
+      FindBinaryRuns<int64_t>(values, builder);
+    } else {
+      FindBinaryRuns<int32_t>(values, builder);
+    }
+    return Status::OK();
+  }
+  return Status::NotImplemented("run_end_encode not implemented for type ", type);
+}
+
+Result<ValueDescr> ResolveEncodeOutput(KernelContext* ctx,
+                                       const std::vector<ValueDescr>& descrs) {
+  const auto& options = RunEndEncodeState::Get(ctx);
+  ARROW_ASSIGN_OR_RAISE(auto type,
+                        RunEndEncodedType::Make(options.run_end_type, descrs[0].type));
+  return ValueDescr(std::move(type), ValueDescr::ARRAY);
+}
+
+Status RunEndEncodeExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const ArraySpan& values = batch[0].array;
+  RunEndEncodedBuilder builder;
+  RETURN_NOT_OK(FindValueRuns(values, &builder));
+  ARROW_ASSIGN_OR_RAISE(auto result,
+                        builder.Finish(out->type()->Copy(), values,
+                                       ctx->exec_context()));
+  out->value = std::move(result);
+  return Status::OK();
+}
+
+Result<ValueDescr> ResolveDecodeOutput(KernelContext*,
+                                       const std::vector<ValueDescr>& descrs) {
+  const auto& type = checked_cast<const RunEndEncodedType&>(*descrs[0].type);
+  return ValueDescr(type.value_type(), ValueDescr::ARRAY);
+}
+
+Status RunEndDecodeExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const ArraySpan& input = batch[0].array;
+  std::vector<int64_t> indices;
+  indices.reserve(input.length);
+  RETURN_NOT_OK(ree_util::VisitRuns(
+      input, [&](int64_t, int64_t run_length, int64_t physical_index) {
+        indices.insert(indices.end(), run_length, physical_index);
+        return Status::OK();
+      }));
+  ARROW_ASSIGN_OR_RAISE(
+      auto result,
+      TakePhysical(ree_util::ValuesArray(input), indices, ctx->exec_context()));
+  out->value = std::move(result);
+  return Status::OK();
+}
+
+const FunctionDoc run_end_encode_doc(
+    "Run-end encode array",
+    ("Return a run-end encoded version of the input array, storing each run of\n"
+     "equal consecutive values (or of nulls) once.  The type of the run ends\n"
+     "is given by RunEndEncodeOptions."),
+    {"array"}, "RunEndEncodeOptions");
+
+const FunctionDoc run_end_decode_doc(
+    "Decode run-end encoded array",
+    ("Return a plain array with the values of the run-end encoded input array."),
+    {"array"});
+
+}  // namespace
+
+void RegisterVectorRunEndEncode(FunctionRegistry* registry) {
+  static const auto kDefaultOptions = RunEndEncodeOptions::Defaults();
+  auto encode = std::make_shared<VectorFunction>("run_end_encode", Arity::Unary(),
+                                                 run_end_encode_doc, &kDefaultOptions);
+  VectorKernel encode_kernel({InputType(ValueDescr::ARRAY)},
+                             OutputType(ResolveEncodeOutput), RunEndEncodeExec,
+                             RunEndEncodeState::Init);
+  encode_kernel.null_handling = NullHandling::OUTPUT_NOT_NULL;
+  encode_kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  encode_kernel.can_execute_chunkwise = true;
+  DCHECK_OK(encode->AddKernel(std::move(encode_kernel)));
+  DCHECK_OK(registry->AddFunction(std::move(encode)));
+
+  auto decode = std::make_shared<VectorFunction>("run_end_decode", Arity::Unary(),
+                                                 run_end_decode_doc);
+  VectorKernel decode_kernel({InputType::Array(Type::RUN_END_ENCODED)},
+                             OutputType(ResolveDecodeOutput), RunEndDecodeExec);
+  decode_kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  decode_kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  decode_kernel.can_execute_chunkwise = true;
+  DCHECK_OK(decode->AddKernel(std::move(decode_kernel)));
+  DCHECK_OK(registry->AddFunction(std::move(decode)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
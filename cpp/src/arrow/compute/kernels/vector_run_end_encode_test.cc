@@ -0,0 +1,188 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/api.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/compute/row/grouper.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestRunEndEncode : public ::testing::TestWithParam<std::shared_ptr<DataType>> {
+ protected:
+  std::shared_ptr<Array> MakeRee(int64_t length, const std::string& run_ends_json,
+                                 const std::shared_ptr<DataType>& value_type,
+                                 const std::string& values_json, int64_t offset = 0) {
+    EXPECT_OK_AND_ASSIGN(
+        auto array,
+        RunEndEncodedArray::Make(length, ArrayFromJSON(GetParam(), run_ends_json),
+                                 ArrayFromJSON(value_type, values_json), offset));
+    return array;
+  }
+
+  void CheckRoundTrip(const std::shared_ptr<DataType>& value_type,
+                      const std::string& plain_json, const std::string& run_ends_json,
+                      const std::string& values_json) {
+    auto plain = ArrayFromJSON(value_type, plain_json);
+    auto expected = MakeRee(plain->length(), run_ends_json, value_type, values_json);
+    ASSERT_OK_AND_ASSIGN(Datum encoded,
+                         RunEndEncode(plain, RunEndEncodeOptions(GetParam())));
+    ValidateOutput(encoded);
+    AssertDatumsEqual(expected, encoded, /*verbose=*/true);
+    ASSERT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(encoded));
+    ValidateOutput(decoded);
+    AssertDatumsEqual(plain, decoded, /*verbose=*/true);
+  }
+};
+
+TEST_P(TestRunEndEncode, EncodeDecode) {
+  CheckRoundTrip(int32(), "[1, 1, 1, null, null, 2, 1]", "[3, 5, 6, 7]",
+                 "[1, null, 2, 1]");
+  CheckRoundTrip(boolean(), "[true, true, false, null]", "[2, 3, 4]",
+                 "[true, false, null]");
+  CheckRoundTrip(utf8(), R"(["a", "a", "bc", "bc", "a", null])", "[2, 4, 5, 6]",
+                 R"(["a", "bc", "a", null])");
+  CheckRoundTrip(large_utf8(), R"(["xyz", "xyz"])", "[2]", R"(["xyz"])");
+  CheckRoundTrip(decimal128(5, 2), R"(["1.00", "1.00", "2.50"])", "[2, 3]",
+                 R"(["1.00", "2.50"])");
+  CheckRoundTrip(null(), "[null, null, null]", "[3]", "[null]");
+  CheckRoundTrip(float64(), "[]", "[]", "[]");
+}
+
+TEST_P(TestRunEndEncode, DecodeSliced) {
+  auto array = MakeRee(6, "[3, 5, 6]", utf8(), R"(["foo", null, "bar"])")->Slice(2, 3);
+  ASSERT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(array));
+  AssertDatumsEqual(ArrayFromJSON(utf8(), R"(["foo", null, null])"), decoded);
+}
+
+TEST_P(TestRunEndEncode, Filter) {
+  auto array = MakeRee(6, "[3, 5, 6]", utf8(), R"(["foo", null, "bar"])");
+  auto filter = ArrayFromJSON(boolean(), "[true, false, true, true, null, true]");
+
+  ASSERT_OK_AND_ASSIGN(Datum dropped, Filter(array, filter));
+  ValidateOutput(dropped);
+  AssertDatumsEqual(MakeRee(4, "[2, 3, 4]", utf8(), R"(["foo", null, "bar"])"), dropped,
+                    /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(
+      Datum emitted, Filter(array, filter, FilterOptions(FilterOptions::EMIT_NULL)));
+  ValidateOutput(emitted);
+  AssertDatumsEqual(MakeRee(5, "[2, 4, 5]", utf8(), R"(["foo", null, "bar"])"), emitted,
+                    /*verbose=*/true);
+
+  // Sliced input
+  ASSERT_OK_AND_ASSIGN(Datum sliced,
+                       Filter(array->Slice(1, 3),
+                              ArrayFromJSON(boolean(), "[false, true, true]")));
+  AssertDatumsEqual(MakeRee(2, "[1, 2]", utf8(), R"(["foo", null])"), sliced,
+                    /*verbose=*/true);
+}
+
+TEST_P(TestRunEndEncode, Take) {
+  auto array = MakeRee(6, "[3, 5, 6]", int64(), "[10, null, 30]");
+  auto indices = ArrayFromJSON(int32(), "[0, 2, 1, null, 5, 3]");
+  ASSERT_OK_AND_ASSIGN(Datum taken, Take(array, indices));
+  ValidateOutput(taken);
+  AssertDatumsEqual(MakeRee(6, "[3, 4, 5, 6]", int64(), "[10, null, 30, null]"), taken,
+                    /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(taken, Take(array->Slice(3), ArrayFromJSON(uint8(), "[2, 0]")));
+  AssertDatumsEqual(MakeRee(2, "[1, 2]", int64(), "[30, null]"), taken,
+                    /*verbose=*/true);
+
+  ASSERT_RAISES(IndexError, Take(array, ArrayFromJSON(int32(), "[6]")));
+}
+
+TEST_P(TestRunEndEncode, Compare) {
+  auto left = MakeRee(6, "[3, 5, 6]", int32(), "[1, null, 3]");
+  auto right = MakeRee(6, "[2, 6]", int32(), "[1, 3]");
+
+  ASSERT_OK_AND_ASSIGN(Datum equal, CallFunction("equal", {left, right}));
+  ValidateOutput(equal);
+  AssertDatumsEqual(MakeRee(6, "[2, 3, 5, 6]", boolean(), "[true, false, null, true]"),
+                    equal, /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(Datum less, CallFunction("less", {left, right}));
+  AssertDatumsEqual(MakeRee(6, "[2, 3, 5, 6]", boolean(), "[false, true, null, false]"),
+                    less, /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(Datum greater,
+                       CallFunction("greater", {left, *MakeScalar(int32(), 1)}));
+  AssertDatumsEqual(MakeRee(6, "[3, 5, 6]", boolean(), "[false, null, true]"), greater,
+                    /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(
+      Datum not_equal,
+      CallFunction("not_equal", {*MakeScalar(int32(), 3), left->Slice(4)}));
+  AssertDatumsEqual(MakeRee(2, "[1, 2]", boolean(), "[null, false]"), not_equal,
+                    /*verbose=*/true);
+}
+
+TEST_P(TestRunEndEncode, SumAndCount) {
+  auto array = MakeRee(6, "[3, 5, 6]", int32(), "[2, null, 5]");
+
+  ASSERT_OK_AND_ASSIGN(Datum sum, Sum(array));
+  AssertDatumsEqual(Datum(int64_t(11)), sum);
+  ASSERT_OK_AND_ASSIGN(sum, Sum(array->Slice(2, 3)));
+  AssertDatumsEqual(Datum(int64_t(2)), sum);
+  ASSERT_OK_AND_ASSIGN(sum, Sum(array, ScalarAggregateOptions(/*skip_nulls=*/false)));
+  AssertDatumsEqual(Datum(MakeNullScalar(int64())), sum);
+
+  auto bools = MakeRee(5, "[2, 5]", boolean(), "[true, false]");
+  ASSERT_OK_AND_ASSIGN(sum, Sum(bools));
+  AssertDatumsEqual(Datum(uint64_t(2)), sum);
+
+  ASSERT_OK_AND_ASSIGN(Datum count, Count(array));
+  AssertDatumsEqual(Datum(int64_t(4)), count);
+  ASSERT_OK_AND_ASSIGN(count, Count(array, CountOptions(CountOptions::ONLY_NULL)));
+  AssertDatumsEqual(Datum(int64_t(2)), count);
+}
+
+TEST_P(TestRunEndEncode, GroupByKeys) {
+  auto ree_type = run_end_encoded(GetParam(), utf8());
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({ValueDescr::Array(ree_type)}));
+
+  auto keys = MakeRee(6, "[3, 5, 6]", utf8(), R"(["a", null, "a"])");
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(ExecBatch({keys}, keys->length())));
+  AssertDatumsEqual(ArrayFromJSON(uint32(), "[0, 0, 0, 1, 1, 0]"), ids);
+
+  ASSERT_OK_AND_ASSIGN(auto uniques, grouper->GetUniques());
+  AssertDatumsEqual(MakeRee(2, "[1, 2]", utf8(), R"(["a", null])"), uniques[0],
+                    /*verbose=*/true);
+
+  // Mixed with plain keys, the run-end encoded ones are decoded
+  ASSERT_OK_AND_ASSIGN(grouper, Grouper::Make({ValueDescr::Array(ree_type),
+                                               ValueDescr::Array(int32())}));
+  ASSERT_OK_AND_ASSIGN(
+      ids, grouper->Consume(ExecBatch(
+               {keys, ArrayFromJSON(int32(), "[1, 2, 1, 1, 1, 1]")}, keys->length())));
+  AssertDatumsEqual(ArrayFromJSON(uint32(), "[0, 1, 0, 2, 2, 0]"), ids);
+}
+
+INSTANTIATE_TEST_SUITE_P(RunEndTypes, TestRunEndEncode,
+                         ::testing::Values(int16(), int32(), int64()));
+
+}  // namespace compute
+}  // namespace arrow
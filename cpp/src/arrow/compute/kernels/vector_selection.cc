@@ -31,7 +31,9 @@
 #include "arrow/buffer_builder.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec_internal.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/ree_util_internal.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/extension_type.h"
 #include "arrow/record_batch.h"
@@ -43,7 +45,9 @@
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/bitmap_reader.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/int_util.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow {
 
@@ -52,11 +56,16 @@ using internal::BitBlockCount;
 using internal::BitBlockCounter;
 using internal::CheckIndexBounds;
 using internal::CopyBitmap;
+using internal::CountAndSetBits;
 using internal::CountSetBits;
+using internal::CpuInfo;
 using internal::OptionalBitBlockCounter;
 using internal::OptionalBitIndexer;
 
 namespace compute {
+
+using detail::ParallelForChunks;
+
 namespace internal {
 
 int64_t GetFilterOutputSize(const ArraySpan& filter,
@@ -1205,6 +1214,136 @@ Status ExtensionFilter(KernelContext* ctx, const ExecSpan& batch, ExecResult* ou
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Run-end encoded take and filter
+//
+// The selection is computed in terms of runs of the input, so that the
+// values child is only gathered once per output run.
+
+Status RunEndEncodedFilter(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const ArraySpan& values = batch[0].array;
+  const ArraySpan& filter = batch[1].array;
+  if (values.length != filter.length) {
+    return Status::Invalid("Filter inputs must all be the same length");
+  }
+  const auto null_selection = FilterState::Get(ctx).null_selection_behavior;
+  const uint8_t* filter_data = filter.buffers[1].data;
+  const uint8_t* filter_is_valid =
+      filter.null_count != 0 ? filter.buffers[0].data : nullptr;
+
+  RunEndEncodedBuilder builder;
+  RETURN_NOT_OK(ree_util::VisitRuns(
+      values, [&](int64_t begin, int64_t length, int64_t physical_index) {
+        const int64_t position = filter.offset + begin;
+        if (filter_is_valid == nullptr) {
+          builder.Append(physical_index, CountSetBits(filter_data, position, length));
+        } else if (null_selection == FilterOptions::DROP) {
+          builder.Append(physical_index, CountAndSetBits(filter_data, position,
+                                                         filter_is_valid, position,
+                                                         length));
+        } else {
+          // Null filter slots emit nulls, which split the run
+          for (int64_t i = position; i < position + length; ++i) {
+            if (!bit_util::GetBit(filter_is_valid, i)) {
+              builder.Append(-1, 1);
+            } else if (bit_util::GetBit(filter_data, i)) {
+              builder.Append(physical_index, 1);
+            }
+          }
+        }
+        return Status::OK();
+      }));
+  ARROW_ASSIGN_OR_RAISE(
+      auto result, builder.Finish(values.type->Copy(),
+                                  ree_util::ValuesArray(values), ctx->exec_context()));
+  out->value = std::move(result);
+  return Status::OK();
+}
+
+template <typename RunEndCType, typename IndexCType>
+Status TakeRuns(const ArraySpan& values, const ArraySpan& indices, bool boundscheck,
+                RunEndEncodedBuilder* builder) {
+  const RunEndCType* run_ends = ree_util::RunEnds<RunEndCType>(values);
+  const int64_t num_run_ends = ree_util::RunEndsArray(values).length;
+  const IndexCType* index_data = indices.GetValues<IndexCType>(1);
+  const uint8_t* index_is_valid =
+      indices.null_count != 0 ? indices.buffers[0].data : nullptr;
+
+  // Indices are often clustered, so remember the last run hit. Bounds are
+  // logical positions including the array offset.
+  int64_t run_begin = 0;
+  int64_t run_end = 0;
+  int64_t physical_index = -1;
+  for (int64_t i = 0; i < indices.length; ++i) {
+    if (index_is_valid != nullptr &&
+        !bit_util::GetBit(index_is_valid, indices.offset + i)) {
+      builder->Append(-1, 1);
+      continue;
+    }
+    const auto index = static_cast<int64_t>(index_data[i]);
+    if (boundscheck && (index < 0 || index >= values.length)) {
+      return Status::IndexError("Index ", index, " out of bounds");
+    }
+    const int64_t position = values.offset + index;
+    if (position < run_begin || position >= run_end) {
+      physical_index = ree_util::FindPhysicalIndex(run_ends, num_run_ends, position);
+      run_begin = physical_index == 0 ? 0 : run_ends[physical_index - 1];
+      run_end = run_ends[physical_index];
+    }
+    builder->Append(physical_index, 1);
+  }
+  return Status::OK();
+}
+
+template <typename RunEndCType>
+Status TakeRuns(const ArraySpan& values, const ArraySpan& indices, bool boundscheck,
+                RunEndEncodedBuilder* builder) {
+  switch (indices.type->id()) {
+    case Type::INT8:
+      return TakeRuns<RunEndCType, int8_t>(values, indices, boundscheck, builder);
+    case Type::INT16:
+      return TakeRuns<RunEndCType, int16_t>(values, indices, boundscheck, builder);
+    case Type::INT32:
+      return TakeRuns<RunEndCType, int32_t>(values, indices, boundscheck, builder);
+    case Type::INT64:
+      return TakeRuns<RunEndCType, int64_t>(values, indices, boundscheck, builder);
+    case Type::UINT8:
+      return TakeRuns<RunEndCType, uint8_t>(values, indices, boundscheck, builder);
+    case Type::UINT16:
+      return TakeRuns<RunEndCType, uint16_t>(values, indices, boundscheck, builder);
+    case Type::UINT32:
+      return TakeRuns<RunEndCType, uint32_t>(values, indices, boundscheck, builder);
+    case Type::UINT64:
+      return TakeRuns<RunEndCType, uint64_t>(values, indices, boundscheck, builder);
+    default:
+      return Status::TypeError("Invalid index type for take: ", *indices.type);
+  }
+}
+
+Status RunEndEncodedTake(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const ArraySpan& values = batch[0].array;
+  const ArraySpan& indices = batch[1].array;
+  const bool boundscheck = TakeState::Get(ctx).boundscheck;
+
+  RunEndEncodedBuilder builder;
+  switch (ree_util::RunEndsArray(values).type->id()) {
+    case Type::INT16:
+      RETURN_NOT_OK(TakeRuns<int16_t>(values, indices, boundscheck, &builder));
+      break;
+    case Type::INT32:
+      RETURN_NOT_OK(TakeRuns<int32_t>(values, indices, boundscheck, &builder));
+      break;
+    default:
+      RETURN_NOT_OK(TakeRuns<int64_t>(values, indices, boundscheck, &builder));
+      break;
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      auto result, builder.Finish(values.type->Copy(),
+                                  ree_util::ValuesArray(values), ctx->exec_context()));
+  out->value = std::move(result);
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Implement take for other data types where there is less performance
 // sensitivity by visiting the selected indices.
@@ -1283,7 +1422,9 @@ struct Selection {
       if (!indices_have_nulls && !values_have_nulls) {
         // Fastest path, neither indices nor values have nulls
         validity_builder.UnsafeAppend(block.length, true);
+        const int64_t block_end = position + block.length;
         for (int64_t i = 0; i < block.length; ++i) {
+          static_cast<Impl*>(this)->PrefetchTake(indices_values, position, block_end);
           RETURN_NOT_OK(visit_valid(indices_values[position++]));
         }
       } else if (block.popcount > 0) {
@@ -1313,6 +1454,12 @@ struct Selection {
     return Status::OK();
   }
 
+  // Called before visiting the valid index at `position` of the fastest take
+  // path, the indices up to `end` being valid too. Implementations gathering
+  // from dependent memory locations may prefetch the upcoming values.
+  template <typename IndexCType>
+  void PrefetchTake(const IndexCType* indices, int64_t position, int64_t end) {}
+
   // We use the NullVisitor both for "selected" nulls as well as "emitted"
   // nulls coming from the filter when using FilterOptions::EMIT_NULL
   template <typename ValidVisitor, typename NullVisitor>
@@ -1535,6 +1682,17 @@ struct VarBinaryImpl : public Selection<VarBinaryImpl<Type>, Type> {
     }
     int64_t space_available = data_builder.capacity();
 
+    // Gathers from values which don't fit in cache are memory latency bound
+    raw_offsets_ = raw_offsets;
+    raw_data_ = raw_data;
+    const int64_t values_size =
+        this->values.length * static_cast<int64_t>(sizeof(offset_type)) +
+        (this->values.length > 0 ? raw_offsets[this->values.length] - raw_offsets[0]
+                                 : 0);
+    prefetch_take_ =
+        Adapter::is_take &&
+        values_size > CpuInfo::GetInstance()->CacheSize(CpuInfo::CacheLevel::L2);
+
     offset_type offset = 0;
     Adapter adapter(this);
     RETURN_NOT_OK(adapter.Generate(
@@ -1567,12 +1725,32 @@ struct VarBinaryImpl : public Selection<VarBinaryImpl<Type>, Type> {
     return Status::OK();
   }
 
+  // Prefetch the offsets of a value well ahead, then its data once its offsets
+  // are probably loaded
+  template <typename IndexCType>
+  void PrefetchTake(const IndexCType* indices, int64_t position, int64_t end) {
+    if (!prefetch_take_) return;
+    if (position + kPrefetchDistance < end) {
+      ARROW_PREFETCH(raw_offsets_ + indices[position + kPrefetchDistance]);
+    }
+    if (position + kPrefetchDistance / 2 < end) {
+      ARROW_PREFETCH(raw_data_ + raw_offsets_[indices[position + kPrefetchDistance / 2]]);
+    }
+  }
+
   Status Init() override { return offset_builder.Reserve(output_length + 1); }
 
   Status Finish() override {
     RETURN_NOT_OK(offset_builder.Finish(&out->buffers[1]));
     return data_builder.Finish(&out->buffers[2]);
   }
+
+ private:
+  static constexpr int64_t kPrefetchDistance = 32;
+
+  const offset_type* raw_offsets_ = NULLPTR;
+  const uint8_t* raw_data_ = NULLPTR;
+  bool prefetch_take_ = false;
 };
 
 struct FSBImpl : public Selection<FSBImpl, FixedSizeBinaryType> {
@@ -1608,6 +1786,47 @@ struct FSBImpl : public Selection<FSBImpl, FixedSizeBinaryType> {
   Status Finish() override { return data_builder.Finish(&out->buffers[1]); }
 };
 
+// ----------------------------------------------------------------------
+// BinaryView/StringView
+
+// Only the views are selected, the output shares the data buffer of the
+// input, so the cost does not depend on the size of the values
+struct BinaryViewImpl : public Selection<BinaryViewImpl, BinaryViewType> {
+  using Base = Selection<BinaryViewImpl, BinaryViewType>;
+  LIFT_BASE_MEMBERS();
+
+  TypedBufferBuilder<BinaryViewType::c_type> views_builder;
+
+  BinaryViewImpl(KernelContext* ctx, const ExecSpan& batch, int64_t output_length,
+                 ExecResult* out)
+      : Base(ctx, batch, output_length, out), views_builder(ctx->memory_pool()) {}
+
+  template <typename Adapter>
+  Status GenerateOutput() {
+    const auto* raw_views = this->values.GetValues<BinaryViewType::c_type>(1);
+    BinaryViewType::c_type null_view;
+    std::memset(&null_view, 0, sizeof(null_view));
+
+    RETURN_NOT_OK(views_builder.Reserve(output_length));
+    Adapter adapter(this);
+    return adapter.Generate(
+        [&](int64_t index) {
+          views_builder.UnsafeAppend(raw_views[index]);
+          return Status::OK();
+        },
+        [&]() {
+          views_builder.UnsafeAppend(null_view);
+          return Status::OK();
+        });
+  }
+
+  Status Finish() override {
+    RETURN_NOT_OK(views_builder.Finish(&out->buffers[1]));
+    out->buffers[2] = this->values.GetBuffer(2);
+    return Status::OK();
+  }
+};
+
 template <typename Type>
 struct ListImpl : public Selection<ListImpl<Type>, Type> {
   using offset_type = typename Type::offset_type;
@@ -1872,11 +2091,13 @@ Result<std::shared_ptr<RecordBatch>> FilterRecordBatch(const RecordBatch& batch,
       GetTakeIndices(*filter.array(), filter_opts.null_selection_behavior,
                      ctx->memory_pool()));
   std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
-  for (int i = 0; i < batch.num_columns(); ++i) {
-    ARROW_ASSIGN_OR_RAISE(Datum out, Take(batch.column(i)->data(), Datum(indices),
-                                          TakeOptions::NoBoundsCheck(), ctx));
-    columns[i] = out.make_array();
-  }
+  RETURN_NOT_OK(ParallelForChunks(
+      ctx, batch.num_columns(), [&](int i, ExecContext* task_ctx) -> Status {
+        ARROW_ASSIGN_OR_RAISE(Datum out, Take(batch.column(i)->data(), Datum(indices),
+                                              TakeOptions::NoBoundsCheck(), task_ctx));
+        columns[i] = out.make_array();
+        return Status::OK();
+      }));
   return RecordBatch::Make(batch.schema(), indices->length, std::move(columns));
 }
 
@@ -1917,28 +2138,43 @@ Result<std::shared_ptr<Table>> FilterTable(const Table& table, const Datum& filt
   // Instead of filtering each column with the boolean filter
   // (which would be slow if the table has a large number of columns: ARROW-10569),
   // convert each filter chunk to indices, and take() the column.
-  const int64_t num_chunks = static_cast<int64_t>(inputs.back().size());
+  const int num_chunks = static_cast<int>(inputs.back().size());
+  // Chunks which are filtered out entirely are left null
+  std::vector<ArrayVector> out_chunk_columns(num_chunks);
+  std::vector<int64_t> out_chunk_rows(num_chunks, 0);
+
+  RETURN_NOT_OK(ParallelForChunks(
+      ctx, num_chunks, [&](int i, ExecContext* task_ctx) -> Status {
+        const ArrayData& filter_chunk = *inputs.back()[i]->data();
+        ARROW_ASSIGN_OR_RAISE(
+            const auto indices,
+            GetTakeIndices(filter_chunk, filter_opts.null_selection_behavior,
+                           task_ctx->memory_pool()));
+
+        if (indices->length > 0) {
+          // Take from all input columns
+          out_chunk_rows[i] = indices->length;
+          Datum indices_datum{std::move(indices)};
+          out_chunk_columns[i].resize(num_columns);
+          for (int col = 0; col < num_columns; ++col) {
+            const auto& column_chunk = inputs[col][i];
+            ARROW_ASSIGN_OR_RAISE(
+                Datum out, Take(column_chunk, indices_datum,
+                                TakeOptions::NoBoundsCheck(), task_ctx));
+            out_chunk_columns[i][col] = std::move(out).make_array();
+          }
+        }
+        return Status::OK();
+      }));
+
   std::vector<ArrayVector> out_columns(num_columns);
   int64_t out_num_rows = 0;
-
-  for (int64_t i = 0; i < num_chunks; ++i) {
-    const ArrayData& filter_chunk = *inputs.back()[i]->data();
-    ARROW_ASSIGN_OR_RAISE(
-        const auto indices,
-        GetTakeIndices(filter_chunk, filter_opts.null_selection_behavior,
-                       ctx->memory_pool()));
-
-    if (indices->length > 0) {
-      // Take from all input columns
-      Datum indices_datum{std::move(indices)};
-      for (int col = 0; col < num_columns; ++col) {
-        const auto& column_chunk = inputs[col][i];
-        ARROW_ASSIGN_OR_RAISE(Datum out, Take(column_chunk, indices_datum,
-                                              TakeOptions::NoBoundsCheck(), ctx));
-        out_columns[col].push_back(std::move(out).make_array());
-      }
-      out_num_rows += indices->length;
+  for (int i = 0; i < num_chunks; ++i) {
+    if (out_chunk_rows[i] == 0) continue;
+    for (int col = 0; col < num_columns; ++col) {
+      out_columns[col].push_back(std::move(out_chunk_columns[i][col]));
     }
+    out_num_rows += out_chunk_rows[i];
   }
 
   ChunkedArrayVector out_chunks(num_columns);
@@ -2042,16 +2278,18 @@ Result<std::shared_ptr<ChunkedArray>> TakeCC(const ChunkedArray& values,
                                              ExecContext* ctx) {
   auto num_chunks = indices.num_chunks();
   std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
-  for (int i = 0; i < num_chunks; i++) {
-    // Take with that indices chunk
-    // Note that as currently implemented, this is inefficient because `values`
-    // will get concatenated on every iteration of this loop
-    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ChunkedArray> current_chunk,
-                          TakeCA(values, *indices.chunk(i), options, ctx));
-    // Concatenate the result to make a single array for this chunk
-    ARROW_ASSIGN_OR_RAISE(new_chunks[i],
-                          Concatenate(current_chunk->chunks(), ctx->memory_pool()));
-  }
+  RETURN_NOT_OK(ParallelForChunks(
+      ctx, num_chunks, [&](int i, ExecContext* task_ctx) -> Status {
+        // Take with that indices chunk
+        // Note that as currently implemented, this is inefficient because `values`
+        // will get concatenated on every iteration of this loop
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ChunkedArray> current_chunk,
+                              TakeCA(values, *indices.chunk(i), options, task_ctx));
+        // Concatenate the result to make a single array for this chunk
+        ARROW_ASSIGN_OR_RAISE(new_chunks[i], Concatenate(current_chunk->chunks(),
+                                                         task_ctx->memory_pool()));
+        return Status::OK();
+      }));
   return std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
 }
 
@@ -2061,10 +2299,11 @@ Result<std::shared_ptr<ChunkedArray>> TakeAC(const Array& values,
                                              ExecContext* ctx) {
   auto num_chunks = indices.num_chunks();
   std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
-  for (int i = 0; i < num_chunks; i++) {
-    // Take with that indices chunk
-    ARROW_ASSIGN_OR_RAISE(new_chunks[i], TakeAA(values, *indices.chunk(i), options, ctx));
-  }
+  RETURN_NOT_OK(ParallelForChunks(
+      ctx, num_chunks, [&](int i, ExecContext* task_ctx) -> Status {
+        // Take with that indices chunk
+        return TakeAA(values, *indices.chunk(i), options, task_ctx).Value(&new_chunks[i]);
+      }));
   return std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
 }
 
@@ -2075,9 +2314,10 @@ Result<std::shared_ptr<RecordBatch>> TakeRA(const RecordBatch& batch,
   auto ncols = batch.num_columns();
   auto nrows = indices.length();
   std::vector<std::shared_ptr<Array>> columns(ncols);
-  for (int j = 0; j < ncols; j++) {
-    ARROW_ASSIGN_OR_RAISE(columns[j], TakeAA(*batch.column(j), indices, options, ctx));
-  }
+  RETURN_NOT_OK(
+      ParallelForChunks(ctx, ncols, [&](int j, ExecContext* task_ctx) -> Status {
+        return TakeAA(*batch.column(j), indices, options, task_ctx).Value(&columns[j]);
+      }));
   return RecordBatch::Make(batch.schema(), nrows, std::move(columns));
 }
 
@@ -2086,9 +2326,10 @@ Result<std::shared_ptr<Table>> TakeTA(const Table& table, const Array& indices,
   auto ncols = table.num_columns();
   std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
 
-  for (int j = 0; j < ncols; j++) {
-    ARROW_ASSIGN_OR_RAISE(columns[j], TakeCA(*table.column(j), indices, options, ctx));
-  }
+  RETURN_NOT_OK(
+      ParallelForChunks(ctx, ncols, [&](int j, ExecContext* task_ctx) -> Status {
+        return TakeCA(*table.column(j), indices, options, task_ctx).Value(&columns[j]);
+      }));
   return Table::Make(table.schema(), std::move(columns));
 }
 
@@ -2096,9 +2337,10 @@ Result<std::shared_ptr<Table>> TakeTC(const Table& table, const ChunkedArray& in
                                       const TakeOptions& options, ExecContext* ctx) {
   auto ncols = table.num_columns();
   std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
-  for (int j = 0; j < ncols; j++) {
-    ARROW_ASSIGN_OR_RAISE(columns[j], TakeCC(*table.column(j), indices, options, ctx));
-  }
+  RETURN_NOT_OK(
+      ParallelForChunks(ctx, ncols, [&](int j, ExecContext* task_ctx) -> Status {
+        return TakeCC(*table.column(j), indices, options, task_ctx).Value(&columns[j]);
+      }));
   return Table::Make(table.schema(), std::move(columns));
 }
 
@@ -2472,11 +2714,14 @@ void RegisterVectorSelection(FunctionRegistry* registry) {
       {InputType(match::BinaryLike(), ValueDescr::ARRAY), BinaryFilter},
       {InputType(match::LargeBinaryLike(), ValueDescr::ARRAY), BinaryFilter},
       {InputType::Array(Type::FIXED_SIZE_BINARY), FilterExec<FSBImpl>},
+      {InputType::Array(Type::BINARY_VIEW), FilterExec<BinaryViewImpl>},
+      {InputType::Array(Type::STRING_VIEW), FilterExec<BinaryViewImpl>},
       {InputType::Array(null()), NullFilter},
       {InputType::Array(Type::DECIMAL128), FilterExec<FSBImpl>},
       {InputType::Array(Type::DECIMAL256), FilterExec<FSBImpl>},
       {InputType::Array(Type::DICTIONARY), DictionaryFilter},
       {InputType::Array(Type::EXTENSION), ExtensionFilter},
+      {InputType::Array(Type::RUN_END_ENCODED), RunEndEncodedFilter},
       {InputType::Array(Type::LIST), FilterExec<ListImpl<ListType>>},
       {InputType::Array(Type::LARGE_LIST), FilterExec<ListImpl<LargeListType>>},
       {InputType::Array(Type::FIXED_SIZE_LIST), FilterExec<FSLImpl>},
@@ -2488,6 +2733,7 @@ void RegisterVectorSelection(FunctionRegistry* registry) {
 
   VectorKernel filter_base;
   filter_base.init = FilterState::Init;
+  filter_base.can_execute_chunks_in_parallel = true;
   RegisterSelectionFunction("array_filter", array_filter_doc, filter_base,
                             /*selection_type=*/InputType::Array(boolean()),
                             filter_kernel_descrs, GetDefaultFilterOptions(), registry);
@@ -2502,11 +2748,14 @@ void RegisterVectorSelection(FunctionRegistry* registry) {
       {InputType(match::LargeBinaryLike(), ValueDescr::ARRAY),
        TakeExec<VarBinaryImpl<LargeBinaryType>>},
       {InputType::Array(Type::FIXED_SIZE_BINARY), TakeExec<FSBImpl>},
+      {InputType::Array(Type::BINARY_VIEW), TakeExec<BinaryViewImpl>},
+      {InputType::Array(Type::STRING_VIEW), TakeExec<BinaryViewImpl>},
       {InputType::Array(null()), NullTake},
       {InputType::Array(Type::DECIMAL128), TakeExec<FSBImpl>},
       {InputType::Array(Type::DECIMAL256), TakeExec<FSBImpl>},
       {InputType::Array(Type::DICTIONARY), DictionaryTake},
       {InputType::Array(Type::EXTENSION), ExtensionTake},
+      {InputType::Array(Type::RUN_END_ENCODED), RunEndEncodedTake},
       {InputType::Array(Type::LIST), TakeExec<ListImpl<ListType>>},
       {InputType::Array(Type::LARGE_LIST), TakeExec<ListImpl<LargeListType>>},
       {InputType::Array(Type::FIXED_SIZE_LIST), TakeExec<FSLImpl>},
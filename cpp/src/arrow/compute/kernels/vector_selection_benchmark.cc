@@ -307,6 +307,15 @@ static void TakeStringMonotonicIndices(benchmark::State& state) {
   TakeBenchmark(state, /*indices_with_nulls=*/false, /*monotonic=*/true).FSLInt64();
 }
 
+// Values much larger than the cache, gathered from at random
+static void TakeInt64LargeValuesRandomIndices(benchmark::State& state) {
+  TakeBenchmark(state, false).Int64();
+}
+
+static void TakeStringLargeValuesRandomIndices(benchmark::State& state) {
+  TakeBenchmark(state, false).String();
+}
+
 void FilterSetArgs(benchmark::internal::Benchmark* bench) {
   for (int64_t size : g_data_sizes) {
     for (int i = 0; i < static_cast<int>(g_filter_params.size()); ++i) {
@@ -350,5 +359,16 @@ BENCHMARK(TakeStringRandomIndicesNoNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringRandomIndicesWithNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringMonotonicIndices)->Apply(TakeSetArgs);
 
+void TakeLargeValuesSetArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t size : {kL2Size, kL2Size * 8}) {
+    for (auto nulls : std::vector<ArgsType>({0, 100})) {
+      bench->Args({static_cast<ArgsType>(size), nulls});
+    }
+  }
+}
+
+BENCHMARK(TakeInt64LargeValuesRandomIndices)->Apply(TakeLargeValuesSetArgs);
+BENCHMARK(TakeStringLargeValuesRandomIndices)->Apply(TakeLargeValuesSetArgs);
+
 }  // namespace compute
 }  // namespace arrow
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <algorithm>
+#include <functional>
 #include <iostream>
 #include <limits>
 #include <memory>
@@ -32,6 +33,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/cpu_info.h"
 
 namespace arrow {
 
@@ -570,6 +572,24 @@ TYPED_TEST(TestFilterKernelWithString, FilterDictionary) {
   this->AssertFilterDictionary(dict, "[3, 4, 2]", "[null, 1, 0]", "[null, 4]");
 }
 
+class TestFilterKernelWithBinaryView : public TestFilterKernel {};
+
+TEST_F(TestFilterKernelWithBinaryView, FilterBinaryView) {
+  for (auto type : {binary_view(), utf8_view()}) {
+    this->AssertFilter(type, R"(["a", "a value longer than twelve bytes", "c"])",
+                       "[0, 1, 0]", R"(["a value longer than twelve bytes"])");
+    this->AssertFilter(type, R"([null, "b", "a value longer than twelve bytes"])",
+                       "[0, 1, 1]", R"(["b", "a value longer than twelve bytes"])");
+    this->AssertFilter(type, R"(["a", "b", "c"])", "[null, 1, 0]", R"([null, "b"])");
+
+    // The output shares the data buffer of the input
+    auto values = ArrayFromJSON(type, R"(["a value longer than twelve bytes", "b"])");
+    ASSERT_OK_AND_ASSIGN(Datum filtered,
+                         Filter(values, ArrayFromJSON(boolean(), "[1, 0]")));
+    ASSERT_EQ(values->data()->buffers[2].get(), filtered.array()->buffers[2].get());
+  }
+}
+
 class TestFilterKernelWithList : public TestFilterKernel {
  public:
 };
@@ -1244,6 +1264,25 @@ TEST_F(TestTakeKernelFSB, TakeFixedSizeBinary) {
                                      int64(), "[2, 5]", &arr));
 }
 
+class TestTakeKernelWithBinaryView : public TestTakeKernelTyped<BinaryViewType> {};
+
+TEST_F(TestTakeKernelWithBinaryView, TakeBinaryView) {
+  for (auto type : {binary_view(), utf8_view()}) {
+    CheckTake(type, R"(["a", "a value longer than twelve bytes", "c"])", "[1, 0, 1]",
+              R"(["a value longer than twelve bytes", "a",
+                  "a value longer than twelve bytes"])");
+    CheckTake(type, R"([null, "b", "c"])", "[0, 1, 0]", R"([null, "b", null])");
+    CheckTake(type, R"(["a", "b", "c"])", "[null, 1, 0]", R"([null, "b", "a"])");
+
+    this->TestNoValidityBitmapButUnknownNullCount(type, R"(["a", "b", "c"])",
+                                                  "[0, 1, 0]");
+
+    std::shared_ptr<Array> arr;
+    ASSERT_RAISES(IndexError,
+                  TakeJSON(type, R"(["a", "b", "c"])", int8(), "[0, 9, 0]", &arr));
+  }
+}
+
 class TestTakeKernelWithList : public TestTakeKernelTyped<ListType> {};
 
 TEST_F(TestTakeKernelWithList, TakeListInt32) {
@@ -1732,6 +1771,81 @@ TEST(TestTakeMetaFunction, ArityChecking) {
   ASSERT_RAISES(Invalid, CallFunction("take", ExecBatch({}, 0)));
 }
 
+// ----------------------------------------------------------------------
+// Parallel execution over chunks
+
+class TestSelectionParallelChunks : public ::testing::Test {
+ public:
+  void SetUp() override {
+    random::RandomArrayGenerator rand(kRandomSeed);
+    ArrayVector ints, strings, filters, indices;
+    int64_t length = 0;
+    for (int i = 0; i < 20; ++i) {
+      const int64_t chunk_length = 10 * i;
+      ints.push_back(rand.Int32(chunk_length, -100, 100, /*null_probability=*/0.1));
+      strings.push_back(rand.String(chunk_length, 0, 5, /*null_probability=*/0.1));
+      filters.push_back(rand.Boolean(chunk_length, 0.5, /*null_probability=*/0.1));
+      length += chunk_length;
+    }
+    for (int i = 0; i < 7; ++i) {
+      indices.push_back(rand.Int64(50, 0, length - 1, /*null_probability=*/0.1));
+    }
+    auto ints_column = std::make_shared<ChunkedArray>(ints);
+    table_ = Table::Make(schema({field("a", int32()), field("b", utf8())}),
+                         {ints_column, std::make_shared<ChunkedArray>(strings)});
+    filter_ = std::make_shared<ChunkedArray>(filters);
+    indices_ = std::make_shared<ChunkedArray>(indices);
+    parallel_ctx_.set_parallelize_chunks(true);
+  }
+
+  // Check that the results don't depend on parallel execution
+  void AssertSameResults(std::function<Result<Datum>(ExecContext*)> func) {
+    ASSERT_OK_AND_ASSIGN(Datum expected, func(&serial_ctx_));
+    ASSERT_OK_AND_ASSIGN(Datum actual, func(&parallel_ctx_));
+    ValidateOutput(actual);
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+
+ protected:
+  std::shared_ptr<Table> table_;
+  std::shared_ptr<ChunkedArray> filter_;
+  std::shared_ptr<ChunkedArray> indices_;
+  ExecContext serial_ctx_;
+  ExecContext parallel_ctx_;
+};
+
+TEST_F(TestSelectionParallelChunks, Filter) {
+  for (auto options : {FilterOptions(FilterOptions::DROP),
+                       FilterOptions(FilterOptions::EMIT_NULL)}) {
+    AssertSameResults([&](ExecContext* ctx) {
+      return Filter(table_->column(1), filter_, options, ctx);
+    });
+    AssertSameResults(
+        [&](ExecContext* ctx) { return Filter(table_, filter_, options, ctx); });
+  }
+  ASSERT_OK_AND_ASSIGN(auto batch, table_->CombineChunksToBatch());
+  ASSERT_OK_AND_ASSIGN(auto filter, Concatenate(filter_->chunks()));
+  AssertSameResults([&](ExecContext* ctx) {
+    return Filter(batch, filter, FilterOptions::Defaults(), ctx);
+  });
+}
+
+TEST_F(TestSelectionParallelChunks, Take) {
+  AssertSameResults([&](ExecContext* ctx) {
+    return Take(table_->column(1), indices_, TakeOptions::Defaults(), ctx);
+  });
+  AssertSameResults([&](ExecContext* ctx) {
+    return Take(table_, indices_, TakeOptions::Defaults(), ctx);
+  });
+  AssertSameResults([&](ExecContext* ctx) {
+    return Take(table_, indices_->chunk(0), TakeOptions::Defaults(), ctx);
+  });
+  ASSERT_OK_AND_ASSIGN(auto batch, table_->CombineChunksToBatch());
+  AssertSameResults([&](ExecContext* ctx) {
+    return Take(batch, indices_->chunk(0), TakeOptions::Defaults(), ctx);
+  });
+}
+
 // ----------------------------------------------------------------------
 // Random data tests
 
@@ -1832,6 +1946,26 @@ TEST(TestTake, RandomString) {
   TakeRandomTest<LargeStringType>::Test(large_utf8());
 }
 
+TEST(TestTake, RandomStringLargerThanCache) {
+  // Gathers from binary values which don't fit in the L2 cache are prefetched
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  const int64_t cache_size = ::arrow::internal::CpuInfo::GetInstance()->CacheSize(
+      ::arrow::internal::CpuInfo::CacheLevel::L2);
+  const int64_t values_length = cache_size / 8 + 1;
+  const int64_t indices_length = 64 * 64 + 1;
+  for (const auto null_probability : {0.0, 0.05}) {
+    auto values = rand.String(values_length, /*min_length=*/0, /*max_length=*/32,
+                              null_probability);
+    CheckTakeRandom<StringType, Int32Type>(values, indices_length, null_probability,
+                                           &rand);
+    CheckTakeRandom<StringType, UInt8Type>(values, indices_length, null_probability,
+                                           &rand);
+    values = values->Slice(1, values_length - 2);
+    CheckTakeRandom<StringType, UInt64Type>(values, indices_length, null_probability,
+                                            &rand);
+  }
+}
+
 TEST(TestTake, RandomFixedSizeBinary) {
   TakeRandomTest<FixedSizeBinaryType>::Test(fixed_size_binary(0));
   TakeRandomTest<FixedSizeBinaryType>::Test(fixed_size_binary(16));
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iterator>
 #include <limits>
 #include <numeric>
@@ -29,13 +30,16 @@
 #include "arrow/array/data.h"
 #include "arrow/chunk_resolver.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec_internal.h"
 #include "arrow/compute/kernels/chunked_internal.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
 #include "arrow/table.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/arena.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/optional.h"
 #include "arrow/visit_type_inline.h"
 #include "arrow/visitor.h"
@@ -200,23 +204,27 @@ class ChunkedArraySorter : public TypeVisitor {
     const auto arrays = GetArrayPointers(physical_chunks_);
 
     // Sort each chunk independently and merge to sorted indices.
-    // This is a serial implementation.
+    // The chunks may be sorted in parallel, the merge is serial.
     std::vector<NullPartitionResult> sorted(num_chunks);
 
-    // First sort all individual chunks
-    int64_t begin_offset = 0;
-    int64_t end_offset = 0;
+    std::vector<int64_t> offsets(num_chunks + 1, 0);
     int64_t null_count = 0;
     for (int i = 0; i < num_chunks; ++i) {
-      const auto array = checked_cast<const ArrayType*>(arrays[i]);
-      end_offset += array->length();
-      null_count += array->null_count();
-      sorted[i] =
-          array_sorter_(indices_begin_ + begin_offset, indices_begin_ + end_offset,
-                        *array, begin_offset, options);
-      begin_offset = end_offset;
+      offsets[i + 1] = offsets[i] + arrays[i]->length();
+      null_count += arrays[i]->null_count();
     }
-    DCHECK_EQ(end_offset, indices_end_ - indices_begin_);
+    DCHECK_EQ(offsets[num_chunks], indices_end_ - indices_begin_);
+
+    // First sort all individual chunks
+    RETURN_NOT_OK(compute::detail::ParallelForChunks(
+        ctx_, num_chunks, [&](int i, ExecContext*) -> Status {
+          const auto array = checked_cast<const ArrayType*>(arrays[i]);
+          ARROW_ASSIGN_OR_RAISE(
+              sorted[i],
+              array_sorter_(indices_begin_ + offsets[i], indices_begin_ + offsets[i + 1],
+                            *array, offsets[i], options));
+          return Status::OK();
+        }));
 
     // Then merge them by pairs, recursively
     if (sorted.size() > 1) {
@@ -943,24 +951,30 @@ class TableSorter {
     }
     std::vector<NullPartitionResult> sorted(num_batches);
 
-    // First sort all individual batches
-    int64_t begin_offset = 0;
-    int64_t end_offset = 0;
-    int64_t null_count = 0;
+    std::vector<int64_t> offsets(num_batches + 1, 0);
     for (int64_t i = 0; i < num_batches; ++i) {
-      const auto& batch = *batches[i];
-      end_offset += batch.num_rows();
-      RadixRecordBatchSorter sorter(indices_begin_ + begin_offset,
-                                    indices_begin_ + end_offset, batch, options_);
-      ARROW_ASSIGN_OR_RAISE(sorted[i], sorter.Sort(begin_offset));
-      DCHECK_EQ(sorted[i].overall_begin(), indices_begin_ + begin_offset);
-      DCHECK_EQ(sorted[i].overall_end(), indices_begin_ + end_offset);
-      DCHECK_EQ(sorted[i].non_null_count() + sorted[i].null_count(), batch.num_rows());
-      begin_offset = end_offset;
-      // XXX this is an upper bound on the true null count
-      null_count += sorted[i].null_count();
-    }
-    DCHECK_EQ(end_offset, indices_end_ - indices_begin_);
+      offsets[i + 1] = offsets[i] + batches[i]->num_rows();
+    }
+    DCHECK_EQ(offsets[num_batches], indices_end_ - indices_begin_);
+
+    // First sort all individual batches, possibly in parallel
+    RETURN_NOT_OK(compute::detail::ParallelForChunks(
+        ctx_, static_cast<int>(num_batches), [&](int i, ExecContext*) -> Status {
+          const auto& batch = *batches[i];
+          RadixRecordBatchSorter sorter(indices_begin_ + offsets[i],
+                                        indices_begin_ + offsets[i + 1], batch, options_);
+          ARROW_ASSIGN_OR_RAISE(sorted[i], sorter.Sort(offsets[i]));
+          DCHECK_EQ(sorted[i].overall_begin(), indices_begin_ + offsets[i]);
+          DCHECK_EQ(sorted[i].overall_end(), indices_begin_ + offsets[i + 1]);
+          DCHECK_EQ(sorted[i].non_null_count() + sorted[i].null_count(),
+                    batch.num_rows());
+          return Status::OK();
+        }));
+    // XXX this is an upper bound on the true null count
+    int64_t null_count = 0;
+    for (const auto& partition : sorted) {
+      null_count += partition.null_count();
+    }
 
     // Then merge them by pairs, recursively
     if (sorted.size() > 1) {
@@ -1146,6 +1160,494 @@ class TableSorter {
   Comparator comparator_;
 };
 
+// ----------------------------------------------------------------------
+// Normalized key sorting implementation
+
+// Sort a table by first encoding the sort keys of each row into a fixed-width
+// normalized key which, compared with memcmp(), orders rows the same way as the
+// sort keys do. Sort order, null placement and NaNs are folded into the encoding,
+// so the rows can be radix sorted on their normalized keys alone, without the
+// per-column virtual calls of MultipleKeyComparator, and the whole table is
+// sorted at once, without a merge.
+//
+// Binary sort keys with long values only contribute a prefix of their values,
+// which ends the normalized key, and sort keys are left out once the key would
+// get too wide. Rows with equal normalized keys are then compared with MultipleKeyComparator,
+// starting from the first sort key that isn't fully encoded.
+class NormalizedKeySorter {
+ public:
+  using ResolvedSortKey = TableSorter::ResolvedSortKey;
+
+  // Maximum width in bytes of a normalized key
+  static constexpr int64_t kMaxKeyWidth = 64;
+  // Binary sort keys are encoded whole if no value is longer than this
+  static constexpr int64_t kMaxExactBinaryLength = 24;
+  // Number of leading bytes encoded for other binary sort keys
+  static constexpr int64_t kBinaryPrefixLength = 8;
+
+  NormalizedKeySorter(ExecContext* ctx, uint64_t* indices_begin, uint64_t* indices_end,
+                      const Table& table, const SortOptions& options)
+      : ctx_(ctx),
+        batches_(MakeBatches(table, &status_)),
+        null_placement_(options.null_placement),
+        resolver_(batches_),
+        sort_keys_(ResolveSortKeys(table, batches_, options.sort_keys, &status_)),
+        indices_begin_(indices_begin),
+        indices_end_(indices_end),
+        comparator_(sort_keys_, null_placement_) {
+    if (status_.ok()) {
+      MakeLayout();
+    }
+  }
+
+  // Whether at least the first sort key can be encoded. If not, another
+  // sorter should be used.
+  bool CanSort() const { return status_.ok() && !columns_.empty(); }
+
+  Status Sort() {
+    RETURN_NOT_OK(status_);
+    DCHECK(CanSort());
+    const int64_t num_rows = indices_end_ - indices_begin_;
+    ARROW_ASSIGN_OR_RAISE(auto rows,
+                          AllocateBuffer(num_rows * row_width_, ctx_->memory_pool()));
+    ARROW_ASSIGN_OR_RAISE(auto temp_rows,
+                          AllocateBuffer(num_rows * row_width_, ctx_->memory_pool()));
+    uint8_t* row_data = rows->mutable_data();
+    std::memset(row_data, 0, rows->size());
+    RETURN_NOT_OK(EncodeKeys(row_data));
+
+    RadixSort(row_data, temp_rows->mutable_data(), num_rows, /*byte_offset=*/0);
+    for (int64_t i = 0; i < num_rows; ++i) {
+      indices_begin_[i] = RowIndex(row_data + i * row_width_);
+    }
+
+    if (first_unencoded_key_ < sort_keys_.size()) {
+      // Sort runs of equal normalized keys on the remaining sort keys
+      auto& comparator = comparator_;
+      const size_t first_unencoded_key = first_unencoded_key_;
+      int64_t run_begin = 0;
+      for (int64_t i = 1; i <= num_rows; ++i) {
+        if (i < num_rows && std::memcmp(row_data + (i - 1) * row_width_,
+                                        row_data + i * row_width_, key_width_) == 0) {
+          continue;
+        }
+        if (i - run_begin > 1) {
+          std::stable_sort(indices_begin_ + run_begin, indices_begin_ + i,
+                           [&](uint64_t left, uint64_t right) {
+                             return comparator.Compare(resolver_.Resolve(left),
+                                                       resolver_.Resolve(right),
+                                                       first_unencoded_key);
+                           });
+        }
+        run_begin = i;
+      }
+    }
+    return comparator_.status();
+  }
+
+ private:
+  using Comparator = MultipleKeyComparator<ResolvedSortKey>;
+
+  // Placement of a sort key inside the normalized key
+  struct EncodedColumn {
+    size_t sort_key_index;
+    // Offset of the column's bytes in the normalized key
+    int64_t offset;
+    // Whether the first byte tells apart nulls, NaNs and other values
+    bool has_marker;
+    // Number of value bytes, which follow the marker byte if any
+    int64_t value_width;
+    // Whether the values are encoded whole
+    bool exact;
+  };
+
+  // Marker byte values, ordered for NullPlacement::AtEnd. They are reversed
+  // for NullPlacement::AtStart.
+  static constexpr uint8_t kValueMarker = 0;
+  static constexpr uint8_t kNaNMarker = 1;
+  static constexpr uint8_t kNullMarker = 2;
+
+  // Ranges of at most this many rows are insertion sorted
+  static constexpr int64_t kInsertionSortThreshold = 32;
+
+  uint64_t RowIndex(const uint8_t* row) const {
+    uint64_t index;
+    std::memcpy(&index, row + key_width_, sizeof(index));
+    return bit_util::FromBigEndian(index);
+  }
+
+  // Stable MSD radix sort of the rows on the bytes of their normalized key from
+  // `byte_offset` on. `temp` must have room for `num_rows` rows.
+  void RadixSort(uint8_t* rows, uint8_t* temp, int64_t num_rows, int64_t byte_offset) {
+    for (; byte_offset < key_width_; ++byte_offset) {
+      if (num_rows <= kInsertionSortThreshold) {
+        InsertionSort(rows, temp, num_rows, byte_offset);
+        return;
+      }
+      int64_t counts[256] = {0};
+      for (int64_t i = 0; i < num_rows; ++i) {
+        ++counts[rows[i * row_width_ + byte_offset]];
+      }
+      if (counts[rows[byte_offset]] == num_rows) {
+        // All rows share this byte
+        continue;
+      }
+      int64_t starts[256];
+      int64_t start = 0;
+      for (int i = 0; i < 256; ++i) {
+        starts[i] = start;
+        start += counts[i];
+      }
+      for (int64_t i = 0; i < num_rows; ++i) {
+        const uint8_t* row = rows + i * row_width_;
+        std::memcpy(temp + starts[row[byte_offset]]++ * row_width_, row, row_width_);
+      }
+      std::memcpy(rows, temp, num_rows * row_width_);
+      start = 0;
+      for (int i = 0; i < 256; ++i) {
+        if (counts[i] > 1) {
+          RadixSort(rows + start * row_width_, temp, counts[i], byte_offset + 1);
+        }
+        start += counts[i];
+      }
+      return;
+    }
+  }
+
+  // The trailing row index makes all rows distinct, which keeps this stable
+  void InsertionSort(uint8_t* rows, uint8_t* temp, int64_t num_rows,
+                     int64_t byte_offset) {
+    const int64_t compared_width = row_width_ - byte_offset;
+    for (int64_t i = 1; i < num_rows; ++i) {
+      std::memcpy(temp, rows + i * row_width_, row_width_);
+      int64_t j = i;
+      for (; j > 0; --j) {
+        uint8_t* previous = rows + (j - 1) * row_width_;
+        if (std::memcmp(previous + byte_offset, temp + byte_offset, compared_width) <=
+            0) {
+          break;
+        }
+        std::memcpy(previous + row_width_, previous, row_width_);
+      }
+      std::memcpy(rows + j * row_width_, temp, row_width_);
+    }
+  }
+
+  static RecordBatchVector MakeBatches(const Table& table, Status* status) {
+    const auto maybe_batches = BatchesFromTable(table);
+    if (!maybe_batches.ok()) {
+      *status = maybe_batches.status();
+      return {};
+    }
+    return *std::move(maybe_batches);
+  }
+
+  static std::vector<ResolvedSortKey> ResolveSortKeys(
+      const Table& table, const RecordBatchVector& batches,
+      const std::vector<SortKey>& sort_keys, Status* status) {
+    const auto maybe_resolved = ResolvedSortKey::Make(table, batches, sort_keys);
+    if (!maybe_resolved.ok()) {
+      *status = maybe_resolved.status();
+      return {};
+    }
+    return *std::move(maybe_resolved);
+  }
+
+  // Returns the number of value bytes needed to encode the sort key, or -1 if
+  // it can't be encoded. `*exact` is set to false if only a prefix of the values is
+  // encoded.
+  static int64_t ValueWidth(const ResolvedSortKey& sort_key, bool* exact) {
+    *exact = true;
+    const DataType& type = *sort_key.type;
+    switch (type.id()) {
+      case Type::NA:
+        return 0;
+      case Type::BOOL:
+        return 1;
+      case Type::INT8:
+      case Type::INT16:
+      case Type::INT32:
+      case Type::INT64:
+      case Type::UINT8:
+      case Type::UINT16:
+      case Type::UINT32:
+      case Type::UINT64:
+      case Type::FLOAT:
+      case Type::DOUBLE:
+      case Type::FIXED_SIZE_BINARY:
+        return checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+#if ARROW_LITTLE_ENDIAN
+      case Type::DECIMAL128:
+      case Type::DECIMAL256:
+        return checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+#endif
+      case Type::BINARY:
+      case Type::LARGE_BINARY: {
+        // Short values are stored whole, followed by their length
+        const int64_t max_length = type.id() == Type::BINARY
+                                       ? MaxValueLength<int32_t>(sort_key)
+                                       : MaxValueLength<int64_t>(sort_key);
+        if (max_length <= kMaxExactBinaryLength) {
+          return max_length + 1;
+        }
+        *exact = false;
+        return kBinaryPrefixLength;
+      }
+      default:
+        return -1;
+    }
+  }
+
+  template <typename OffsetType>
+  static int64_t MaxValueLength(const ResolvedSortKey& sort_key) {
+    int64_t max_length = 0;
+    for (const Array* chunk : sort_key.chunks) {
+      const OffsetType* offsets = chunk->data()->GetValues<OffsetType>(1);
+      for (int64_t i = 0; i < chunk->length(); ++i) {
+        max_length = std::max<int64_t>(max_length, offsets[i + 1] - offsets[i]);
+      }
+    }
+    return max_length;
+  }
+
+  void MakeLayout() {
+    key_width_ = 0;
+    first_unencoded_key_ = 0;
+    for (size_t i = 0; i < sort_keys_.size(); ++i) {
+      const auto& sort_key = sort_keys_[i];
+      bool exact;
+      const int64_t value_width = ValueWidth(sort_key, &exact);
+      if (value_width < 0) {
+        break;
+      }
+      const bool has_marker =
+          sort_key.null_count > 0 || is_floating(sort_key.type->id());
+      const int64_t width = (has_marker ? 1 : 0) + value_width;
+      if (key_width_ + width > kMaxKeyWidth) {
+        break;
+      }
+      columns_.push_back({i, key_width_, has_marker, value_width, exact});
+      key_width_ += width;
+      if (!exact) {
+        // Prefix ties must be broken by the comparator from this sort key on
+        break;
+      }
+      first_unencoded_key_ = i + 1;
+    }
+    // A normalized key needs at least one byte
+    if (key_width_ == 0) {
+      columns_.clear();
+    }
+    row_width_ = key_width_ + static_cast<int64_t>(sizeof(uint64_t));
+  }
+
+  // Writes the normalized key of each row, followed by the big-endian row index.
+  Status EncodeKeys(uint8_t* row_data) {
+    const int64_t num_rows = indices_end_ - indices_begin_;
+    for (int64_t i = 0; i < num_rows; ++i) {
+      const uint64_t index = bit_util::ToBigEndian(static_cast<uint64_t>(i));
+      std::memcpy(row_data + i * row_width_ + key_width_, &index, sizeof(index));
+    }
+    int64_t row_offset = 0;
+    for (size_t chunk_index = 0; chunk_index < batches_.size(); ++chunk_index) {
+      for (const auto& column : columns_) {
+        const auto& sort_key = sort_keys_[column.sort_key_index];
+        const auto physical_array =
+            GetPhysicalArray(*sort_key.chunks[chunk_index], sort_key.type);
+        const Array& array = *physical_array;
+        uint8_t* column_data = row_data + row_offset * row_width_ + column.offset;
+        if (column.has_marker) {
+          EncodeMarkers(array, column_data);
+          ++column_data;
+        }
+        ColumnEncoder encoder{array, column_data, row_width_, column.value_width,
+                              column.exact, sort_key.order == SortOrder::Descending};
+        RETURN_NOT_OK(VisitTypeInline(*sort_key.type, &encoder));
+      }
+      row_offset += batches_[chunk_index]->num_rows();
+    }
+    return Status::OK();
+  }
+
+  void EncodeMarkers(const Array& array, uint8_t* out) const {
+    uint8_t markers[] = {kValueMarker, kNaNMarker, kNullMarker};
+    if (null_placement_ == NullPlacement::AtStart) {
+      std::reverse(std::begin(markers), std::end(markers));
+    }
+    const bool is_float = is_floating(array.type_id());
+    for (int64_t i = 0; i < array.length(); ++i, out += row_width_) {
+      if (array.IsNull(i)) {
+        *out = markers[kNullMarker];
+      } else if (is_float && IsNaN(array, i)) {
+        *out = markers[kNaNMarker];
+      } else {
+        *out = markers[kValueMarker];
+      }
+    }
+  }
+
+  static bool IsNaN(const Array& array, int64_t i) {
+    if (array.type_id() == Type::FLOAT) {
+      return std::isnan(checked_cast<const FloatArray&>(array).Value(i));
+    }
+    return std::isnan(checked_cast<const DoubleArray&>(array).Value(i));
+  }
+
+  // Writes the value bytes of one column so that memcmp() orders them like the
+  // values. Nulls and NaNs are left zeroed, they are told apart by the marker.
+  struct ColumnEncoder {
+    template <typename UInt>
+    static void StoreBigEndian(UInt bits, uint8_t* out) {
+      bits = bit_util::ToBigEndian(bits);
+      std::memcpy(out, &bits, sizeof(bits));
+    }
+
+    // Calls encode(i, out) for each non-null row, then inverts the bytes
+    // written for descending sort keys.
+    template <typename Encode>
+    Status EncodeValues(Encode&& encode) {
+      for (int64_t i = 0; i < array.length(); ++i) {
+        if (array.IsNull(i)) {
+          continue;
+        }
+        uint8_t* value_out = out + i * row_width;
+        encode(i, value_out);
+        if (descending) {
+          for (int64_t j = 0; j < value_width; ++j) {
+            value_out[j] = ~value_out[j];
+          }
+        }
+      }
+      return Status::OK();
+    }
+
+    Status Visit(const NullType&) { return Status::OK(); }
+
+    Status Visit(const BooleanType&) {
+      const auto& values = checked_cast<const BooleanArray&>(array);
+      return EncodeValues([&](int64_t i, uint8_t* value_out) {
+        *value_out = values.Value(i) ? 1 : 0;
+      });
+    }
+
+    // Integers are stored big-endian with the sign bit flipped
+    template <typename Type>
+    enable_if_integer<Type, Status> Visit(const Type&) {
+      using CType = typename Type::c_type;
+      using UInt = typename std::make_unsigned<CType>::type;
+      constexpr UInt kSignBit = std::is_signed<CType>::value
+                                    ? static_cast<UInt>(UInt{1} << (sizeof(UInt) * 8 - 1))
+                                    : 0;
+      const auto& values = checked_cast<const NumericArray<Type>&>(array);
+      return EncodeValues([&](int64_t i, uint8_t* value_out) {
+        StoreBigEndian(static_cast<UInt>(static_cast<UInt>(values.Value(i)) ^ kSignBit),
+                       value_out);
+      });
+    }
+
+    // Floating point numbers are stored big-endian with the sign bit flipped for
+    // positive numbers and all bits flipped for negative numbers
+    Status Visit(const FloatType&) { return VisitFloatingPoint<FloatType>(); }
+
+    Status Visit(const DoubleType&) { return VisitFloatingPoint<DoubleType>(); }
+
+    template <typename Type>
+    Status VisitFloatingPoint() {
+      using CType = typename Type::c_type;
+      using UInt =
+          typename std::conditional<sizeof(CType) == 4, uint32_t, uint64_t>::type;
+      constexpr UInt kSignBit = UInt{1} << (sizeof(UInt) * 8 - 1);
+      const auto& values = checked_cast<const NumericArray<Type>&>(array);
+      return EncodeValues([&](int64_t i, uint8_t* value_out) {
+        CType value = values.Value(i);
+        if (std::isnan(value)) {
+          return;
+        }
+        if (value == 0) {
+          // -0.0 compares equal to 0.0
+          value = 0;
+        }
+        UInt bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        bits = (bits & kSignBit) ? ~bits : (bits | kSignBit);
+        StoreBigEndian(bits, value_out);
+      });
+    }
+
+    // Decimals are little-endian two's complement integers
+    template <typename Type>
+    enable_if_decimal<Type, Status> Visit(const Type& type) {
+      const auto& values = checked_cast<const FixedSizeBinaryArray&>(array);
+      const int32_t byte_width = type.byte_width();
+      return EncodeValues([&](int64_t i, uint8_t* value_out) {
+        const uint8_t* value = values.GetValue(i);
+        for (int32_t j = 0; j < byte_width; ++j) {
+          value_out[j] = value[byte_width - 1 - j];
+        }
+        value_out[0] ^= 0x80;
+      });
+    }
+
+    Status Visit(const FixedSizeBinaryType& type) {
+      const auto& values = checked_cast<const FixedSizeBinaryArray&>(array);
+      return EncodeValues([&](int64_t i, uint8_t* value_out) {
+        std::memcpy(value_out, values.GetValue(i), type.byte_width());
+      });
+    }
+
+    // Binary values are zero-padded. When stored whole they are followed
+    // by their length, so that a value sorts before its extensions.
+    template <typename Type>
+    enable_if_base_binary<Type, Status> Visit(const Type&) {
+      using ArrayType = typename TypeTraits<Type>::ArrayType;
+      const auto& values = checked_cast<const ArrayType&>(array);
+      const int64_t prefix_length = exact ? value_width - 1 : value_width;
+      return EncodeValues([&](int64_t i, uint8_t* value_out) {
+        const auto value = values.GetView(i);
+        const int64_t length = static_cast<int64_t>(value.size());
+        std::memcpy(value_out, value.data(), std::min(prefix_length, length));
+        if (exact) {
+          value_out[prefix_length] = static_cast<uint8_t>(length);
+        }
+      });
+    }
+
+    Status Visit(const DataType& type) {
+      return Status::TypeError("Unsupported type for normalized key sorting: ",
+                               type.ToString());
+    }
+
+    const Array& array;
+    uint8_t* out;
+    int64_t row_width;
+    int64_t value_width;
+    bool exact;
+    bool descending;
+  };
+
+  Status status_;
+  ExecContext* ctx_;
+  const RecordBatchVector batches_;
+  const NullPlacement null_placement_;
+  const ::arrow::internal::ChunkResolver resolver_;
+  const std::vector<ResolvedSortKey> sort_keys_;
+  uint64_t* indices_begin_;
+  uint64_t* indices_end_;
+  Comparator comparator_;
+  std::vector<EncodedColumn> columns_;
+  int64_t key_width_ = 0;
+  int64_t row_width_ = 0;
+  size_t first_unencoded_key_ = 0;
+};
+
+constexpr int64_t NormalizedKeySorter::kMaxKeyWidth;
+constexpr int64_t NormalizedKeySorter::kMaxExactBinaryLength;
+constexpr int64_t NormalizedKeySorter::kBinaryPrefixLength;
+constexpr int64_t NormalizedKeySorter::kInsertionSortThreshold;
+constexpr uint8_t NormalizedKeySorter::kValueMarker;
+constexpr uint8_t NormalizedKeySorter::kNaNMarker;
+constexpr uint8_t NormalizedKeySorter::kNullMarker;
+
 // ----------------------------------------------------------------------
 // Top-level sort functions
 
@@ -1257,6 +1759,13 @@ class SortIndicesMetaFunction : public MetaFunction {
     auto out_end = out_begin + length;
     std::iota(out_begin, out_end, 0);
 
+    const auto table = Table::Make(batch.schema(), batch.columns(), batch.num_rows());
+    NormalizedKeySorter normalized_key_sorter(ctx, out_begin, out_end, *table, options);
+    if (normalized_key_sorter.CanSort()) {
+      ARROW_RETURN_NOT_OK(normalized_key_sorter.Sort());
+      return Datum(out);
+    }
+
     // Radix sorting is consistently faster except when there is a large number
     // of sort keys, in which case it can end up degrading catastrophically.
     // Cut off above 8 sort keys.
@@ -1297,6 +1806,12 @@ class SortIndicesMetaFunction : public MetaFunction {
     auto out_end = out_begin + length;
     std::iota(out_begin, out_end, 0);
 
+    NormalizedKeySorter normalized_key_sorter(ctx, out_begin, out_end, table, options);
+    if (normalized_key_sorter.CanSort()) {
+      RETURN_NOT_OK(normalized_key_sorter.Sort());
+      return Datum(out);
+    }
+
     TableSorter sorter(ctx, out_begin, out_end, table, options);
     RETURN_NOT_OK(sorter.Sort());
 
@@ -1958,8 +2473,8 @@ class ArrayRanker : public TypeVisitor {
 
     ARROW_ASSIGN_OR_RAISE(auto array_sorter, GetArraySorter(*physical_type_));
 
-    NullPartitionResult sorted =
-        array_sorter(sort_begin, sort_end, arr, 0, array_options);
+    ARROW_ASSIGN_OR_RAISE(NullPartitionResult sorted,
+                          array_sorter(sort_begin, sort_end, arr, 0, array_options));
     uint64_t rank;
 
     ARROW_ASSIGN_OR_RAISE(auto rankings,
@@ -985,6 +985,13 @@ class TestChunkedArrayRandomBase : public ::testing::Test {
             ValidateSorted<ArrayType>(
                 *checked_pointer_cast<ArrayType>(concatenated_array),
                 *checked_pointer_cast<UInt64Array>(offsets), order, null_placement);
+
+            // Sorting chunks in parallel gives the same (stable) result
+            ExecContext parallel_ctx;
+            parallel_ctx.set_parallelize_chunks(true);
+            ASSERT_OK_AND_ASSIGN(auto parallel_offsets,
+                                 SortIndices(*chunked_array, options, &parallel_ctx));
+            AssertArraysEqual(*offsets, *parallel_offsets);
           }
         }
       }
@@ -1498,6 +1505,45 @@ TEST_F(TestTableSortIndices, BinaryLike) {
   AssertSortIndices(table, options, "[1, 5, 2, 6, 0, 4, 7, 3]");
 }
 
+TEST_F(TestTableSortIndices, LongBinary) {
+  // Values too long to be compared on their normalized key alone
+  auto schema = ::arrow::schema({
+      {field("a", utf8())},
+      {field("b", int32())},
+  });
+  const std::vector<SortKey> sort_keys{SortKey("a", SortOrder::Ascending),
+                                       SortKey("b", SortOrder::Descending)};
+  std::shared_ptr<Table> table;
+
+  table = TableFromJSON(schema, {R"([{"a": "abcdefghijklmnopqrstuvwxyz", "b": 1},
+                                     {"a": "abcdefgh", "b": 2},
+                                     {"a": null, "b": 3},
+                                     {"a": "abcdefghijklmnopqrstuvwxyz", "b": 4},
+                                     {"a": "abcdefghijklmnopqrstuvwxy", "b": 5},
+                                     {"a": "abcdefgh", "b": null},
+                                     {"a": "abcdefghz", "b": 7}
+                                    ])"});
+  SortOptions options(sort_keys, NullPlacement::AtEnd);
+  AssertSortIndices(table, options, "[1, 5, 4, 3, 0, 6, 2]");
+  options.null_placement = NullPlacement::AtStart;
+  AssertSortIndices(table, options, "[2, 5, 1, 4, 3, 0, 6]");
+
+  // Same data, several chunks
+  table = TableFromJSON(schema, {R"([{"a": "abcdefghijklmnopqrstuvwxyz", "b": 1},
+                                     {"a": "abcdefgh", "b": 2},
+                                     {"a": null, "b": 3}
+                                    ])",
+                                 R"([{"a": "abcdefghijklmnopqrstuvwxyz", "b": 4},
+                                     {"a": "abcdefghijklmnopqrstuvwxy", "b": 5},
+                                     {"a": "abcdefgh", "b": null},
+                                     {"a": "abcdefghz", "b": 7}
+                                    ])"});
+  options.null_placement = NullPlacement::AtEnd;
+  AssertSortIndices(table, options, "[1, 5, 4, 3, 0, 6, 2]");
+  options.null_placement = NullPlacement::AtStart;
+  AssertSortIndices(table, options, "[2, 5, 1, 4, 3, 0, 6]");
+}
+
 TEST_F(TestTableSortIndices, Decimal) {
   auto schema = ::arrow::schema({
       {field("a", decimal128(3, 1))},
@@ -1918,6 +1964,12 @@ TEST_P(TestTableSortIndicesRandom, Sort) {
       options.null_placement = null_placement;
       ASSERT_OK_AND_ASSIGN(auto offsets, SortIndices(Datum(*table), options));
       Validate(*table, options, *checked_pointer_cast<UInt64Array>(offsets));
+
+      ExecContext parallel_ctx;
+      parallel_ctx.set_parallelize_chunks(true);
+      ASSERT_OK_AND_ASSIGN(auto parallel_offsets,
+                           SortIndices(Datum(*table), options, &parallel_ctx));
+      AssertArraysEqual(*offsets, *parallel_offsets);
     }
   }
 
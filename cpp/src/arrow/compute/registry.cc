@@ -291,10 +291,11 @@ static std::unique_ptr<FunctionRegistry> CreateBuiltInRegistry() {
 
   // Vector functions
   RegisterVectorArraySort(registry.get());
-  RegisterVectorCumulativeSum(registry.get());
+  RegisterVectorCumulativeOps(registry.get());
   RegisterVectorHash(registry.get());
   RegisterVectorNested(registry.get());
   RegisterVectorReplace(registry.get());
+  RegisterVectorRunEndEncode(registry.get());
   RegisterVectorSelection(registry.get());
   RegisterVectorSort(registry.get());
 
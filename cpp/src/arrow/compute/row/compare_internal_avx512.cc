@@ -0,0 +1,153 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "arrow/compute/row/compare_internal.h"
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+namespace compute {
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+
+template <bool use_selection, int column_width>
+uint32_t KeyCompare::CompareBinaryColumnToRowImp_avx512(
+    uint32_t offset_within_row, uint32_t num_rows_to_compare,
+    const uint16_t* sel_left_maybe_null, const uint32_t* left_to_right_map,
+    const KeyColumnArray& col, const RowTableImpl& rows, uint8_t* match_bytevector) {
+  constexpr uint32_t unroll = 16;
+  const uint8_t* left_base = col.data(1);
+  const bool is_fixed_length = rows.metadata().is_fixed_length;
+  const uint8_t* right_base = is_fixed_length ? rows.data(1) : rows.data(2);
+  const uint32_t* offsets_right = rows.offsets();
+  const __m512i fixed_length = _mm512_set1_epi32(rows.metadata().fixed_length);
+
+  __m512i irow_left = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+                                        14, 15);
+  for (uint32_t i = 0; i < num_rows_to_compare / unroll; ++i) {
+    __m512i irow_right;
+    if (use_selection) {
+      irow_left = _mm512_cvtepu16_epi32(_mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(sel_left_maybe_null) + i));
+      irow_right = _mm512_i32gather_epi32(irow_left, left_to_right_map, 4);
+    } else {
+      irow_right =
+          _mm512_loadu_si512(reinterpret_cast<const __m512i*>(left_to_right_map) + i);
+    }
+
+    __m512i offset_right;
+    if (is_fixed_length) {
+      offset_right = _mm512_mullo_epi32(irow_right, fixed_length);
+    } else {
+      offset_right = _mm512_i32gather_epi32(irow_right, offsets_right, 4);
+    }
+    offset_right = _mm512_add_epi32(offset_right, _mm512_set1_epi32(offset_within_row));
+
+    __mmask16 cmp;
+    if (column_width == sizeof(uint64_t)) {
+      __m512i left_lo, left_hi;
+      if (use_selection) {
+        left_lo =
+            _mm512_i32gather_epi64(_mm512_castsi512_si256(irow_left), left_base, 8);
+        left_hi = _mm512_i32gather_epi64(_mm512_extracti64x4_epi64(irow_left, 1),
+                                         left_base, 8);
+      } else {
+        left_lo = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(left_base) + 2 * i);
+        left_hi =
+            _mm512_loadu_si512(reinterpret_cast<const __m512i*>(left_base) + 2 * i + 1);
+      }
+      __m512i right_lo =
+          _mm512_i32gather_epi64(_mm512_castsi512_si256(offset_right), right_base, 1);
+      __m512i right_hi = _mm512_i32gather_epi64(
+          _mm512_extracti64x4_epi64(offset_right, 1), right_base, 1);
+      cmp = static_cast<__mmask16>(_mm512_cmpeq_epi64_mask(left_lo, right_lo) |
+                                   (_mm512_cmpeq_epi64_mask(left_hi, right_hi) << 8));
+    } else {
+      __m512i left;
+      if (use_selection) {
+        left = _mm512_i32gather_epi32(irow_left, left_base, column_width);
+      } else if (column_width == sizeof(uint8_t)) {
+        left = _mm512_cvtepu8_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(left_base) + i));
+      } else if (column_width == sizeof(uint16_t)) {
+        left = _mm512_cvtepu16_epi32(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(left_base) + i));
+      } else {
+        left = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(left_base) + i);
+      }
+      __m512i right = _mm512_i32gather_epi32(offset_right, right_base, 1);
+      if (column_width != sizeof(uint32_t)) {
+        constexpr uint32_t mask = column_width == 1 ? 0xff : 0xffff;
+        left = _mm512_and_si512(left, _mm512_set1_epi32(mask));
+        right = _mm512_and_si512(right, _mm512_set1_epi32(mask));
+      }
+      cmp = _mm512_cmpeq_epi32_mask(left, right);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(match_bytevector) + i,
+                     _mm_movm_epi8(cmp));
+
+    if (!use_selection) {
+      irow_left = _mm512_add_epi32(irow_left, _mm512_set1_epi32(unroll));
+    }
+  }
+  return num_rows_to_compare - (num_rows_to_compare % unroll);
+}
+
+uint32_t KeyCompare::CompareBinaryColumnToRow_avx512(
+    bool use_selection, uint32_t offset_within_row, uint32_t num_rows_to_compare,
+    const uint16_t* sel_left_maybe_null, const uint32_t* left_to_right_map,
+    const KeyColumnArray& col, const RowTableImpl& rows, uint8_t* match_bytevector) {
+  switch (col.metadata().fixed_length) {
+#define COMPARE_CASE(WIDTH)                                                           \
+  case WIDTH:                                                                         \
+    if (use_selection) {                                                              \
+      return CompareBinaryColumnToRowImp_avx512<true, WIDTH>(                         \
+          offset_within_row, num_rows_to_compare, sel_left_maybe_null,                \
+          left_to_right_map, col, rows, match_bytevector);                            \
+    } else {                                                                          \
+      return CompareBinaryColumnToRowImp_avx512<false, WIDTH>(                        \
+          offset_within_row, num_rows_to_compare, sel_left_maybe_null,                \
+          left_to_right_map, col, rows, match_bytevector);                            \
+    }
+    COMPARE_CASE(1)
+    COMPARE_CASE(2)
+    COMPARE_CASE(4)
+    COMPARE_CASE(8)
+#undef COMPARE_CASE
+    default:
+      return 0;
+  }
+}
+
+uint32_t KeyCompare::AndByteVectors_avx512(uint32_t num_elements, uint8_t* bytevector_A,
+                                           const uint8_t* bytevector_B) {
+  constexpr int unroll = 64;
+  for (uint32_t i = 0; i < num_elements / unroll; ++i) {
+    __m512i result = _mm512_and_si512(
+        _mm512_loadu_si512(reinterpret_cast<const __m512i*>(bytevector_A) + i),
+        _mm512_loadu_si512(reinterpret_cast<const __m512i*>(bytevector_B) + i));
+    _mm512_storeu_si512(reinterpret_cast<__m512i*>(bytevector_A) + i, result);
+  }
+  return (num_elements - (num_elements % unroll));
+}
+
+#endif
+
+}  // namespace compute
+}  // namespace arrow
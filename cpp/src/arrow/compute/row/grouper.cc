@@ -17,23 +17,32 @@
 
 #include "arrow/compute/row/grouper.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <mutex>
+#include <numeric>
 
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/cast.h"
 #include "arrow/compute/exec/key_hash.h"
 #include "arrow/compute/exec/key_map.h"
 #include "arrow/compute/exec/options.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/function.h"
+#include "arrow/compute/kernels/ree_util_internal.h"
 #include "arrow/compute/kernels/row_encoder.h"
 #include "arrow/compute/light_array.h"
 #include "arrow/compute/registry.h"
 #include "arrow/compute/row/compare_internal.h"
 #include "arrow/type.h"
+#include "arrow/util/arena.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/ree_util.h"
 #include "arrow/util/task_group.h"
 
 namespace arrow {
@@ -87,6 +96,12 @@ struct GrouperImpl : Grouper {
         continue;
       }
 
+      if (is_binary_view_like(key->id())) {
+        impl->encoders_[i] = ::arrow::internal::make_unique<
+            internal::VarLengthKeyEncoder<BinaryViewType>>(key);
+        continue;
+      }
+
       if (key->id() == Type::NA) {
         impl->encoders_[i] = ::arrow::internal::make_unique<internal::NullKeyEncoder>();
         continue;
@@ -99,7 +114,11 @@ struct GrouperImpl : Grouper {
   }
 
   Result<Datum> Consume(const ExecBatch& batch) override {
-    std::vector<int32_t> offsets_batch(batch.length + 1);
+    // The encoded keys of the batch are only needed while consuming it
+    util::ArenaScope scratch;
+    ARROW_ASSIGN_OR_RAISE(int32_t* offsets_batch,
+                          scratch.AllocateArray<int32_t>(batch.length + 1));
+    std::fill(offsets_batch, offsets_batch + batch.length + 1, 0);
     for (int i = 0; i < batch.num_values(); ++i) {
       ExecValue value;
       if (batch[i].is_array()) {
@@ -107,7 +126,7 @@ struct GrouperImpl : Grouper {
       } else {
         value.SetScalar(batch[i].scalar().get());
       }
-      encoders_[i]->AddLength(value, batch.length, offsets_batch.data());
+      encoders_[i]->AddLength(value, batch.length, offsets_batch);
     }
 
     int32_t total_length = 0;
@@ -118,10 +137,12 @@ struct GrouperImpl : Grouper {
     }
     offsets_batch[batch.length] = total_length;
 
-    std::vector<uint8_t> key_bytes_batch(total_length);
-    std::vector<uint8_t*> key_buf_ptrs(batch.length);
+    ARROW_ASSIGN_OR_RAISE(uint8_t* key_bytes_batch, scratch.Allocate(total_length));
+    std::memset(key_bytes_batch, 0, total_length);
+    ARROW_ASSIGN_OR_RAISE(uint8_t** key_buf_ptrs,
+                          scratch.AllocateArray<uint8_t*>(batch.length));
     for (int64_t i = 0; i < batch.length; ++i) {
-      key_buf_ptrs[i] = key_bytes_batch.data() + offsets_batch[i];
+      key_buf_ptrs[i] = key_bytes_batch + offsets_batch[i];
     }
 
     for (int i = 0; i < batch.num_values(); ++i) {
@@ -131,22 +152,22 @@ struct GrouperImpl : Grouper {
       } else {
         value.SetScalar(batch[i].scalar().get());
       }
-      RETURN_NOT_OK(encoders_[i]->Encode(value, batch.length, key_buf_ptrs.data()));
+      RETURN_NOT_OK(encoders_[i]->Encode(value, batch.length, key_buf_ptrs));
     }
 
     TypedBufferBuilder<uint32_t> group_ids_batch(ctx_->memory_pool());
     RETURN_NOT_OK(group_ids_batch.Resize(batch.length));
 
+    // Reused across rows, so that looking up existing keys doesn't allocate
+    std::string key;
     for (int64_t i = 0; i < batch.length; ++i) {
       int32_t key_length = offsets_batch[i + 1] - offsets_batch[i];
-      std::string key(
-          reinterpret_cast<const char*>(key_bytes_batch.data() + offsets_batch[i]),
-          key_length);
-
-      auto it_success = map_.emplace(key, num_groups_);
-      auto group_id = it_success.first->second;
+      key.assign(reinterpret_cast<const char*>(key_bytes_batch + offsets_batch[i]),
+                 key_length);
 
-      if (it_success.second) {
+      auto it = map_.find(key);
+      if (it == map_.end()) {
+        it = map_.emplace(key, num_groups_).first;
         // new key; update offsets and key_bytes
         ++num_groups_;
         // Skip if there are no keys
@@ -158,7 +179,7 @@ struct GrouperImpl : Grouper {
         }
       }
 
-      group_ids_batch.UnsafeAppend(group_id);
+      group_ids_batch.UnsafeAppend(it->second);
     }
 
     ARROW_ASSIGN_OR_RAISE(auto group_ids, group_ids_batch.Finish());
@@ -202,7 +223,7 @@ struct GrouperFastImpl : Grouper {
 #if ARROW_LITTLE_ENDIAN
     for (size_t i = 0; i < keys.size(); ++i) {
       const auto& key = keys[i].type;
-      if (is_large_binary_like(key->id())) {
+      if (is_large_binary_like(key->id()) || is_binary_view_like(key->id())) {
         return false;
       }
     }
@@ -274,6 +295,7 @@ struct GrouperFastImpl : Grouper {
                                   impl->encode_ctx_.stack, impl->log_minibatch_max_,
                                   equal_func, append_func));
     impl->cols_.resize(num_columns);
+    impl->minibatch_cols_.resize(num_columns);
     impl->minibatch_hashes_.resize(impl->minibatch_size_max_ +
                                    kPaddingForSIMD / sizeof(uint32_t));
 
@@ -304,6 +326,13 @@ struct GrouperFastImpl : Grouper {
   Result<Datum> ConsumeImpl(const ExecBatch& batch) {
     int64_t num_rows = batch.length;
     int num_columns = batch.num_values();
+    // The hashes are those of Hashing32::HashBatch of the keys, so that the ones
+    // computed upstream can be used
+    const uint32_t* precomputed_hashes = NULLPTR;
+    if (batch.key_hashes &&
+        batch.key_hashes->Matches(KeyHashes::HASHING32, batch.values)) {
+      precomputed_hashes = batch.key_hashes->hashes32();
+    }
     // Process dictionaries
     for (int icol = 0; icol < num_columns; ++icol) {
       if (key_types_[icol]->id() == Type::DICTIONARY) {
@@ -359,9 +388,19 @@ struct GrouperFastImpl : Grouper {
       rows_minibatch_.Clean();
       encoder_.PrepareEncodeSelected(start_row, batch_size_next, cols_);
 
-      // Compute hash
-      Hashing32::HashMultiColumn(encoder_.batch_all_cols(), &encode_ctx_,
-                                 minibatch_hashes_.data());
+      // Compute hash, of the key columns in order rather than in the order of the
+      // encoder
+      if (precomputed_hashes) {
+        std::copy(precomputed_hashes + start_row,
+                  precomputed_hashes + start_row + batch_size_next,
+                  minibatch_hashes_.begin());
+      } else {
+        for (int icol = 0; icol < num_columns; ++icol) {
+          minibatch_cols_[icol] = cols_[icol].Slice(start_row, batch_size_next);
+        }
+        Hashing32::HashMultiColumn(minibatch_cols_, &encode_ctx_,
+                                   minibatch_hashes_.data());
+      }
 
       // Map
       auto match_bitvector =
@@ -526,6 +565,7 @@ struct GrouperFastImpl : Grouper {
   std::vector<std::shared_ptr<arrow::DataType>> key_types_;
   std::vector<KeyColumnMetadata> col_metadata_;
   std::vector<KeyColumnArray> cols_;
+  std::vector<KeyColumnArray> minibatch_cols_;
   std::vector<uint32_t> minibatch_hashes_;
 
   std::vector<std::shared_ptr<Array>> dictionaries_;
@@ -536,10 +576,474 @@ struct GrouperFastImpl : Grouper {
   SwissTable map_;
 };
 
+// Groups run-end encoded keys by delegating to a grouper of the value types.
+// When all array keys are run-end encoded, every segment over which no key
+// changes run is consumed as a single row and the group ids are expanded
+// afterwards; otherwise the keys are decoded first.
+struct RunEndEncodedGrouperImpl : Grouper {
+  static bool CanUse(const std::vector<ValueDescr>& keys) {
+    return std::any_of(keys.begin(), keys.end(), [](const ValueDescr& key) {
+      return key.type->id() == Type::RUN_END_ENCODED;
+    });
+  }
+
+  static Result<std::unique_ptr<RunEndEncodedGrouperImpl>> Make(
+      const std::vector<ValueDescr>& keys, ExecContext* ctx) {
+    auto impl = ::arrow::internal::make_unique<RunEndEncodedGrouperImpl>();
+    impl->ctx_ = ctx;
+    impl->key_types_.reserve(keys.size());
+    std::vector<ValueDescr> value_keys;
+    value_keys.reserve(keys.size());
+    for (const auto& key : keys) {
+      impl->key_types_.push_back(key.type);
+      if (key.type->id() == Type::RUN_END_ENCODED) {
+        value_keys.emplace_back(
+            checked_cast<const RunEndEncodedType&>(*key.type).value_type(), key.shape);
+      } else {
+        value_keys.push_back(key);
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(impl->values_grouper_, Grouper::Make(value_keys, ctx));
+    return std::move(impl);
+  }
+
+  bool IsRunEndEncoded(int i) const {
+    return key_types_[i]->id() == Type::RUN_END_ENCODED;
+  }
+
+  Result<Datum> Consume(const ExecBatch& batch) override {
+    bool all_runs = true;
+    for (int i = 0; i < batch.num_values(); ++i) {
+      all_runs &= batch[i].is_scalar() || IsRunEndEncoded(i);
+    }
+    return all_runs ? ConsumeRuns(batch) : ConsumeDecoded(batch);
+  }
+
+  Result<Datum> ConsumeRuns(const ExecBatch& batch) {
+    // Segments end wherever any of the keys starts a new run
+    std::vector<int64_t> segment_ends;
+    for (int i = 0; i < batch.num_values(); ++i) {
+      if (batch[i].is_scalar()) continue;
+      RETURN_NOT_OK(ree_util::VisitRuns(
+          ArraySpan(*batch[i].array()), [&](int64_t begin, int64_t length, int64_t) {
+            segment_ends.push_back(begin + length);
+            return Status::OK();
+          }));
+    }
+    std::sort(segment_ends.begin(), segment_ends.end());
+    segment_ends.erase(std::unique(segment_ends.begin(), segment_ends.end()),
+                       segment_ends.end());
+    const auto num_segments = static_cast<int64_t>(segment_ends.size());
+
+    ExecBatch segments({}, num_segments);
+    segments.values.resize(batch.num_values());
+    for (int i = 0; i < batch.num_values(); ++i) {
+      if (batch[i].is_scalar()) {
+        segments.values[i] = UnwrapScalar(batch[i]);
+        continue;
+      }
+      const ArraySpan span(*batch[i].array());
+      std::vector<int64_t> indices;
+      indices.reserve(num_segments);
+      size_t segment = 0;
+      RETURN_NOT_OK(ree_util::VisitRuns(
+          span, [&](int64_t begin, int64_t length, int64_t physical_index) {
+            for (; segment < segment_ends.size() &&
+                   segment_ends[segment] <= begin + length;
+                 ++segment) {
+              indices.push_back(physical_index);
+            }
+            return Status::OK();
+          }));
+      ARROW_ASSIGN_OR_RAISE(
+          segments.values[i],
+          internal::TakePhysical(ree_util::ValuesArray(span), indices, ctx_));
+    }
+
+    ARROW_ASSIGN_OR_RAISE(Datum segment_ids, values_grouper_->Consume(segments));
+    const uint32_t* ids = segment_ids.array()->GetValues<uint32_t>(1);
+
+    TypedBufferBuilder<uint32_t> group_ids_batch(ctx_->memory_pool());
+    RETURN_NOT_OK(group_ids_batch.Reserve(batch.length));
+    int64_t segment_begin = 0;
+    for (int64_t s = 0; s < num_segments; ++s) {
+      RETURN_NOT_OK(group_ids_batch.Append(segment_ends[s] - segment_begin, ids[s]));
+      segment_begin = segment_ends[s];
+    }
+    ARROW_ASSIGN_OR_RAISE(auto group_ids, group_ids_batch.Finish());
+    return Datum(UInt32Array(batch.length, std::move(group_ids)));
+  }
+
+  Result<Datum> ConsumeDecoded(const ExecBatch& batch) {
+    ExecBatch decoded = batch;
+    for (int i = 0; i < batch.num_values(); ++i) {
+      if (!IsRunEndEncoded(i)) continue;
+      if (batch[i].is_scalar()) {
+        decoded.values[i] = UnwrapScalar(batch[i]);
+        continue;
+      }
+      const ArraySpan span(*batch[i].array());
+      std::vector<int64_t> indices;
+      indices.reserve(batch.length);
+      RETURN_NOT_OK(ree_util::VisitRuns(
+          span, [&](int64_t, int64_t length, int64_t physical_index) {
+            indices.insert(indices.end(), length, physical_index);
+            return Status::OK();
+          }));
+      ARROW_ASSIGN_OR_RAISE(
+          decoded.values[i],
+          internal::TakePhysical(ree_util::ValuesArray(span), indices, ctx_));
+    }
+    return values_grouper_->Consume(decoded);
+  }
+
+  static Datum UnwrapScalar(const Datum& key) {
+    if (key.type()->id() != Type::RUN_END_ENCODED) return key;
+    return checked_cast<const RunEndEncodedScalar&>(*key.scalar()).value;
+  }
+
+  uint32_t num_groups() const override { return values_grouper_->num_groups(); }
+
+  Result<ExecBatch> GetUniques() override {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch uniques, values_grouper_->GetUniques());
+    // Every unique value makes up a run of its own
+    std::vector<int64_t> run_ends(uniques.length);
+    std::iota(run_ends.begin(), run_ends.end(), 1);
+    for (size_t i = 0; i < key_types_.size(); ++i) {
+      if (!IsRunEndEncoded(static_cast<int>(i))) continue;
+      const auto& ree_type = checked_cast<const RunEndEncodedType&>(*key_types_[i]);
+      ARROW_ASSIGN_OR_RAISE(auto ree_run_ends,
+                            internal::MakeRunEndsArray(ree_type.run_end_type(), run_ends,
+                                                       ctx_->memory_pool()));
+      uniques.values[i] = internal::MakeRunEndEncodedData(
+          key_types_[i], uniques.length, std::move(ree_run_ends), uniques[i].array());
+    }
+    return uniques;
+  }
+
+  ExecContext* ctx_;
+  std::vector<std::shared_ptr<DataType>> key_types_;
+  std::unique_ptr<Grouper> values_grouper_;
+};
+
+// Groups boolean, integer and dictionary keys (on the indices) without hashing.
+// The null and the values in the observed range [min, max] of each key column are
+// numbered densely, so every combination of the keys addresses a slot of a table
+// of group ids. The ranges grow with the consumed batches; once the table would
+// exceed kMaxSlots, the groups are moved to a hashing grouper which takes over.
+struct DirectGrouperImpl : Grouper {
+  static constexpr int64_t kMaxSlots = 1 << 16;
+  static constexpr uint32_t kNoGroup = std::numeric_limits<uint32_t>::max();
+
+  // The range of the valid values of a key column, and its stride in the slots
+  struct KeyRange {
+    int64_t min = 0;
+    int64_t max = -1;
+    int64_t stride = 1;
+
+    bool empty() const { return max < min; }
+    // Offset 0 is the null, the values follow from offset 1
+    int64_t domain() const { return empty() ? 1 : max - min + 2; }
+    int64_t OffsetOf(uint32_t slot) const { return slot / stride % domain(); }
+  };
+
+  static bool CanUseType(const DataType& type) {
+    switch (type.id()) {
+      case Type::BOOL:
+      case Type::INT8:
+      case Type::INT16:
+      case Type::INT32:
+      case Type::INT64:
+      case Type::UINT8:
+      case Type::UINT16:
+      case Type::UINT32:
+        return true;
+      case Type::DICTIONARY:
+        return CanUseType(*checked_cast<const DictionaryType&>(type).index_type());
+      default:
+        return false;
+    }
+  }
+
+  static bool CanUse(const std::vector<ValueDescr>& keys) {
+    return !keys.empty() &&
+           std::all_of(keys.begin(), keys.end(),
+                       [](const ValueDescr& key) { return CanUseType(*key.type); });
+  }
+
+  static Result<std::unique_ptr<DirectGrouperImpl>> Make(
+      const std::vector<ValueDescr>& keys, ExecContext* ctx) {
+    auto impl = ::arrow::internal::make_unique<DirectGrouperImpl>();
+    impl->ctx_ = ctx;
+    impl->keys_ = keys;
+    impl->ranges_.resize(keys.size());
+    impl->dictionaries_.resize(keys.size());
+    impl->values_.resize(keys.size());
+    // The single slot of all nulls
+    impl->table_.assign(1, kNoGroup);
+    return std::move(impl);
+  }
+
+  Result<Datum> Consume(const ExecBatch& batch) override {
+    if (fallback_) {
+      return fallback_->Consume(batch);
+    }
+    // ARROW-14027: broadcast scalar arguments for now
+    for (int i = 0; i < batch.num_values(); i++) {
+      if (batch.values[i].is_scalar()) {
+        ExecBatch expanded = batch;
+        for (int j = i; j < expanded.num_values(); j++) {
+          if (expanded.values[j].is_scalar()) {
+            ARROW_ASSIGN_OR_RAISE(
+                expanded.values[j],
+                MakeArrayFromScalar(*expanded.values[j].scalar(), expanded.length,
+                                    ctx_->memory_pool()));
+          }
+        }
+        return ConsumeImpl(expanded);
+      }
+    }
+    return ConsumeImpl(batch);
+  }
+
+  Result<Datum> ConsumeImpl(const ExecBatch& batch) {
+    const int64_t num_rows = batch.length;
+    const int num_columns = batch.num_values();
+
+    std::vector<KeyRange> ranges = ranges_;
+    bool grown = false;
+    for (int icol = 0; icol < num_columns; ++icol) {
+      const ArrayData& data = *batch[icol].array();
+      if (data.type->id() == Type::DICTIONARY) {
+        auto dict = MakeArray(data.dictionary);
+        if (dictionaries_[icol]) {
+          if (!dictionaries_[icol]->Equals(dict)) {
+            return Status::NotImplemented("Unifying differing dictionaries");
+          }
+        } else {
+          dictionaries_[icol] = std::move(dict);
+        }
+      }
+
+      std::vector<int64_t>& values = values_[icol];
+      values.resize(num_rows);
+      WidenValues(data, values.data());
+      const uint8_t* validity = data.MayHaveNulls() ? data.buffers[0]->data() : NULLPTR;
+      KeyRange& range = ranges[icol];
+      for (int64_t i = 0; i < num_rows; ++i) {
+        if (validity && !bit_util::GetBit(validity, data.offset + i)) continue;
+        if (range.empty()) {
+          range.min = range.max = values[i];
+        } else {
+          range.min = std::min(range.min, values[i]);
+          range.max = std::max(range.max, values[i]);
+        }
+      }
+      grown |= range.min != ranges_[icol].min || range.max != ranges_[icol].max;
+    }
+
+    if (grown) {
+      int64_t num_slots = 1;
+      for (auto& range : ranges) {
+        range.stride = num_slots;
+        // Compared unsigned, as the width of a 64-bit range may overflow
+        if (!range.empty() && static_cast<uint64_t>(range.max) -
+                                      static_cast<uint64_t>(range.min) >=
+                                  static_cast<uint64_t>(kMaxSlots)) {
+          num_slots = kMaxSlots + 1;
+          break;
+        }
+        num_slots *= range.domain();
+        if (num_slots > kMaxSlots) break;
+      }
+      if (num_slots > kMaxSlots) {
+        RETURN_NOT_OK(MoveToFallback());
+        return fallback_->Consume(batch);
+      }
+      Relayout(std::move(ranges), num_slots);
+    }
+
+    slots_.assign(num_rows, 0);
+    for (int icol = 0; icol < num_columns; ++icol) {
+      const ArrayData& data = *batch[icol].array();
+      const uint8_t* validity = data.MayHaveNulls() ? data.buffers[0]->data() : NULLPTR;
+      const std::vector<int64_t>& values = values_[icol];
+      const KeyRange& range = ranges_[icol];
+      for (int64_t i = 0; i < num_rows; ++i) {
+        if (validity && !bit_util::GetBit(validity, data.offset + i)) continue;
+        slots_[i] += static_cast<uint32_t>((values[i] - range.min + 1) * range.stride);
+      }
+    }
+
+    TypedBufferBuilder<uint32_t> group_ids_batch(ctx_->memory_pool());
+    RETURN_NOT_OK(group_ids_batch.Resize(num_rows));
+    for (int64_t i = 0; i < num_rows; ++i) {
+      uint32_t& group = table_[slots_[i]];
+      if (group == kNoGroup) {
+        group = num_groups_++;
+        group_slots_.push_back(slots_[i]);
+      }
+      group_ids_batch.UnsafeAppend(group);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto group_ids, group_ids_batch.Finish());
+    return Datum(UInt32Array(num_rows, std::move(group_ids)));
+  }
+
+  uint32_t num_groups() const override {
+    return fallback_ ? fallback_->num_groups() : num_groups_;
+  }
+
+  Result<ExecBatch> GetUniques() override {
+    if (fallback_) {
+      return fallback_->GetUniques();
+    }
+
+    ExecBatch out({}, num_groups_);
+    out.values.resize(keys_.size());
+    for (size_t icol = 0; icol < keys_.size(); ++icol) {
+      const KeyRange& range = ranges_[icol];
+      Int64Builder builder(ctx_->memory_pool());
+      RETURN_NOT_OK(builder.Reserve(num_groups_));
+      for (uint32_t group = 0; group < num_groups_; ++group) {
+        const int64_t offset = range.OffsetOf(group_slots_[group]);
+        if (offset == 0) {
+          builder.UnsafeAppendNull();
+        } else {
+          builder.UnsafeAppend(range.min + offset - 1);
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(auto values, builder.Finish());
+
+      const auto& key_type = keys_[icol].type;
+      if (key_type->id() != Type::DICTIONARY) {
+        ARROW_ASSIGN_OR_RAISE(out.values[icol],
+                              Cast(values, key_type, CastOptions::Safe(), ctx_));
+        continue;
+      }
+      const auto& dict_type = checked_cast<const DictionaryType&>(*key_type);
+      ARROW_ASSIGN_OR_RAISE(
+          Datum indices, Cast(values, dict_type.index_type(), CastOptions::Safe(), ctx_));
+      auto data = std::make_shared<ArrayData>(*indices.array());
+      data->type = key_type;
+      if (dictionaries_[icol]) {
+        data->dictionary = dictionaries_[icol]->data();
+      } else {
+        ARROW_ASSIGN_OR_RAISE(auto dict, MakeArrayOfNull(dict_type.value_type(), 0));
+        data->dictionary = dict->data();
+      }
+      out.values[icol] = std::move(data);
+    }
+    return out;
+  }
+
+  // Widen the values (the indices of a dictionary) of a key column to int64
+  static void WidenValues(const ArrayData& data, int64_t* out) {
+    const DataType* type = data.type.get();
+    if (type->id() == Type::DICTIONARY) {
+      type = checked_cast<const DictionaryType&>(*type).index_type().get();
+    }
+    switch (type->id()) {
+      case Type::BOOL: {
+        const uint8_t* bits = data.buffers[1]->data();
+        for (int64_t i = 0; i < data.length; ++i) {
+          out[i] = bit_util::GetBit(bits, data.offset + i);
+        }
+        return;
+      }
+      case Type::INT8:
+        return WidenValues<int8_t>(data, out);
+      case Type::INT16:
+        return WidenValues<int16_t>(data, out);
+      case Type::INT32:
+        return WidenValues<int32_t>(data, out);
+      case Type::INT64:
+        return WidenValues<int64_t>(data, out);
+      case Type::UINT8:
+        return WidenValues<uint8_t>(data, out);
+      case Type::UINT16:
+        return WidenValues<uint16_t>(data, out);
+      case Type::UINT32:
+        return WidenValues<uint32_t>(data, out);
+      default:
+        ARROW_DCHECK(false) << "Unexpected key type " << *type;
+    }
+  }
+
+  template <typename CType>
+  static void WidenValues(const ArrayData& data, int64_t* out) {
+    const CType* values = data.GetValues<CType>(1);
+    std::copy(values, values + data.length, out);
+  }
+
+  // Move the groups to the slots of the grown ranges
+  void Relayout(std::vector<KeyRange> ranges, int64_t num_slots) {
+    std::vector<uint32_t> table(num_slots, kNoGroup);
+    for (uint32_t group = 0; group < num_groups_; ++group) {
+      int64_t slot = 0;
+      for (size_t icol = 0; icol < ranges.size(); ++icol) {
+        const int64_t offset = ranges_[icol].OffsetOf(group_slots_[group]);
+        if (offset != 0) {
+          slot += (ranges_[icol].min - ranges[icol].min + offset) * ranges[icol].stride;
+        }
+      }
+      table[slot] = group;
+      group_slots_[group] = static_cast<uint32_t>(slot);
+    }
+    table_ = std::move(table);
+    ranges_ = std::move(ranges);
+  }
+
+  // Replay the uniques into a hashing grouper, which keeps the group ids
+  Status MoveToFallback() {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch uniques, GetUniques());
+    std::unique_ptr<Grouper> fallback;
+    if (GrouperFastImpl::CanUse(keys_)) {
+      ARROW_ASSIGN_OR_RAISE(fallback, GrouperFastImpl::Make(keys_, ctx_));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(fallback, GrouperImpl::Make(keys_, ctx_));
+    }
+    if (num_groups_ > 0) {
+      RETURN_NOT_OK(fallback->Consume(uniques).status());
+    }
+    fallback_ = std::move(fallback);
+    table_ = {};
+    group_slots_ = {};
+    values_ = {};
+    slots_ = {};
+    return Status::OK();
+  }
+
+  ExecContext* ctx_;
+  std::vector<ValueDescr> keys_;
+  std::vector<KeyRange> ranges_;
+  std::vector<std::shared_ptr<Array>> dictionaries_;
+
+  // The group id of every slot, and the slot of every group
+  std::vector<uint32_t> table_;
+  std::vector<uint32_t> group_slots_;
+  uint32_t num_groups_ = 0;
+
+  // Scratch space of a batch: the widened values of each key, and the slots
+  std::vector<std::vector<int64_t>> values_;
+  std::vector<uint32_t> slots_;
+
+  std::unique_ptr<Grouper> fallback_;
+};
+
+constexpr int64_t DirectGrouperImpl::kMaxSlots;
+constexpr uint32_t DirectGrouperImpl::kNoGroup;
+
 }  // namespace
 
 Result<std::unique_ptr<Grouper>> Grouper::Make(const std::vector<ValueDescr>& descrs,
                                                ExecContext* ctx) {
+  if (RunEndEncodedGrouperImpl::CanUse(descrs)) {
+    return RunEndEncodedGrouperImpl::Make(descrs, ctx);
+  }
+  if (DirectGrouperImpl::CanUse(descrs)) {
+    return DirectGrouperImpl::Make(descrs, ctx);
+  }
   if (GrouperFastImpl::CanUse(descrs)) {
     return GrouperFastImpl::Make(descrs, ctx);
   }
@@ -234,7 +234,7 @@ class Lexer {
   }
 
  protected:
-  using BulkFilterType = internal::PreferredBulkFilterType<SpecializedOptions>;
+  using BulkFilterType = internal::PreferredChunkerFilterType<SpecializedOptions>;
   using BulkWordType = typename BulkFilterType::WordType;
 
   const char* RunBulkFilter(const char* data, const char* data_end) {
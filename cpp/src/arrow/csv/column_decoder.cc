@@ -20,11 +20,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <utility>
 
 #include "arrow/array.h"
+#include "arrow/array/array_dict.h"
 #include "arrow/array/builder_base.h"
 #include "arrow/csv/converter.h"
 #include "arrow/csv/inference_internal.h"
@@ -33,10 +35,14 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace csv {
 
 class ConcreteColumnDecoder : public ColumnDecoder {
@@ -64,6 +70,59 @@ class ConcreteColumnDecoder : public ColumnDecoder {
   int32_t col_index_;
 };
 
+//////////////////////////////////////////////////////////////////////////
+// Dictionary sharing across chunks
+
+// Rewrites dictionary-encoded chunks so that they all share a single dictionary.
+// Chunks may be unified in any order; the dictionary of each chunk is a prefix of
+// the dictionaries of the chunks unified after it.
+class SharedDictionary {
+ public:
+  SharedDictionary(MemoryPool* pool, int32_t max_cardinality)
+      : pool_(pool), max_cardinality_(max_cardinality) {}
+
+  Result<std::shared_ptr<Array>> Unify(std::shared_ptr<Array> chunk) {
+    if (chunk->type_id() != Type::DICTIONARY) {
+      return chunk;
+    }
+    const auto& dict_array = checked_cast<const DictionaryArray&>(*chunk);
+    std::shared_ptr<Buffer> transpose_map;
+    std::shared_ptr<Array> dictionary;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (exhausted_ || max_cardinality_ <= 0) {
+        return chunk;
+      }
+      if (unifier_ == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(unifier_,
+                              DictionaryUnifier::Make(dict_array.dictionary()->type(),
+                                                      pool_));
+      }
+      RETURN_NOT_OK(unifier_->Unify(*dict_array.dictionary(), &transpose_map));
+      RETURN_NOT_OK(unifier_->GetResultWithIndexType(
+          checked_cast<const DictionaryType&>(*chunk->type()).index_type(),
+          &dictionary));
+      if (dictionary->length() > max_cardinality_) {
+        // Too many distinct values, leave this and further chunks alone
+        exhausted_ = true;
+        unifier_.reset();
+        return chunk;
+      }
+    }
+    return dict_array.Transpose(
+        chunk->type(), dictionary,
+        reinterpret_cast<const int32_t*>(transpose_map->data()), pool_);
+  }
+
+ protected:
+  MemoryPool* pool_;
+  const int32_t max_cardinality_;
+
+  std::mutex mutex_;
+  std::unique_ptr<DictionaryUnifier> unifier_;
+  bool exhausted_ = false;
+};
+
 //////////////////////////////////////////////////////////////////////////
 // Null column decoder implementation (for a column not in the CSV file)
 
@@ -94,7 +153,10 @@ class TypedColumnDecoder : public ConcreteColumnDecoder {
  public:
   TypedColumnDecoder(const std::shared_ptr<DataType>& type, int32_t col_index,
                      const ConvertOptions& options, MemoryPool* pool)
-      : ConcreteColumnDecoder(pool, col_index), type_(type), options_(options) {}
+      : ConcreteColumnDecoder(pool, col_index),
+        type_(type),
+        options_(options),
+        shared_dictionary_(pool, options.dict_max_shared_cardinality) {}
 
   Status Init();
 
@@ -110,6 +172,7 @@ class TypedColumnDecoder : public ConcreteColumnDecoder {
   const ConvertOptions& options_;
 
   std::shared_ptr<Converter> converter_;
+  SharedDictionary shared_dictionary_;
 };
 
 Status TypedColumnDecoder::Init() {
@@ -120,8 +183,11 @@ Status TypedColumnDecoder::Init() {
 Future<std::shared_ptr<Array>> TypedColumnDecoder::Decode(
     const std::shared_ptr<BlockParser>& parser) {
   DCHECK_NE(converter_, nullptr);
-  return Future<std::shared_ptr<Array>>::MakeFinished(
-      WrapConversionError(converter_->Convert(*parser, col_index_)));
+  auto maybe_array = WrapConversionError(converter_->Convert(*parser, col_index_));
+  if (maybe_array.ok()) {
+    maybe_array = shared_dictionary_.Unify(maybe_array.MoveValueUnsafe());
+  }
+  return Future<std::shared_ptr<Array>>::MakeFinished(std::move(maybe_array));
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -134,7 +200,8 @@ class InferringColumnDecoder : public ConcreteColumnDecoder {
       : ConcreteColumnDecoder(pool, col_index),
         options_(options),
         infer_status_(options),
-        type_frozen_(false) {
+        type_frozen_(false),
+        shared_dictionary_(pool, options.dict_max_shared_cardinality) {
     first_inference_run_ = Future<>::Make();
     first_inferrer_ = 0;
   }
@@ -163,6 +230,7 @@ class InferringColumnDecoder : public ConcreteColumnDecoder {
   std::atomic<int> first_inferrer_;
   Future<> first_inference_run_;
   std::shared_ptr<Converter> converter_;
+  SharedDictionary shared_dictionary_;
 };
 
 Status InferringColumnDecoder::Init() { return UpdateType(); }
@@ -181,6 +249,9 @@ Result<std::shared_ptr<Array>> InferringColumnDecoder::RunInference(
       // Conversion succeeded, or failed definitively
       DCHECK(!type_frozen_);
       type_frozen_ = true;
+      if (maybe_array.ok()) {
+        return shared_dictionary_.Unify(maybe_array.MoveValueUnsafe());
+      }
       return maybe_array;
     }
     // Conversion failed temporarily, try another type
@@ -211,10 +282,11 @@ Future<std::shared_ptr<Array>> InferringColumnDecoder::Decode(
 
   // Non-first block: wait for inference to finish on first block now,
   // without blocking a worker thread.
-  return first_inference_run_.Then([this, parser] {
+  return first_inference_run_.Then([this, parser]() -> Result<std::shared_ptr<Array>> {
     DCHECK(type_frozen_);
-    auto maybe_array = converter_->Convert(*parser, col_index_);
-    return WrapConversionError(converter_->Convert(*parser, col_index_));
+    ARROW_ASSIGN_OR_RAISE(auto array,
+                          WrapConversionError(converter_->Convert(*parser, col_index_)));
+    return shared_dictionary_.Unify(std::move(array));
   });
 }
 
@@ -256,6 +256,34 @@ class TypedColumnDecoderTest : public ColumnDecoderTest {
     AssertFetch(ArrayFromJSON(type, "[null, 1000]"));
   }
 
+  void TestSharedDictionary() {
+    auto type = dictionary(int32(), utf8());
+
+    MakeDecoder(type, default_options);
+
+    AppendChunks({{"ab", "cd", "ab"}, {"ef", "N/A", "cd"}, {"ab"}});
+    AssertFetch(DictArrayFromJSON(type, "[0, 1, 0]", R"(["ab", "cd"])"));
+    AssertFetch(DictArrayFromJSON(type, "[2, null, 1]", R"(["ab", "cd", "ef"])"));
+    AssertFetch(DictArrayFromJSON(type, "[0]", R"(["ab", "cd", "ef"])"));
+
+    // Once the shared dictionary grows too large, chunks get their own dictionary
+    auto options = default_options;
+    options.dict_max_shared_cardinality = 2;
+    MakeDecoder(type, options);
+
+    AppendChunks({{"ab", "cd", "ab"}, {"ef", "N/A", "cd"}, {"ab"}});
+    AssertFetch(DictArrayFromJSON(type, "[0, 1, 0]", R"(["ab", "cd"])"));
+    AssertFetch(DictArrayFromJSON(type, "[0, null, 1]", R"(["ef", "cd"])"));
+    AssertFetch(DictArrayFromJSON(type, "[0]", R"(["ab"])"));
+
+    options.dict_max_shared_cardinality = 0;
+    MakeDecoder(type, options);
+
+    AppendChunks({{"ab", "cd"}, {"cd"}});
+    AssertFetch(DictArrayFromJSON(type, "[0, 1]", R"(["ab", "cd"])"));
+    AssertFetch(DictArrayFromJSON(type, "[0]", R"(["cd"])"));
+  }
+
   void TestThreaded() {
     constexpr int NITERS = 10;
     auto type = uint32();
@@ -279,6 +307,8 @@ TEST_F(TypedColumnDecoderTest, Options) { this->TestOptions(); }
 
 TEST_F(TypedColumnDecoderTest, Errors) { this->TestErrors(); }
 
+TEST_F(TypedColumnDecoderTest, SharedDictionary) { this->TestSharedDictionary(); }
+
 TEST_F(TypedColumnDecoderTest, Threaded) { this->TestThreaded(); }
 
 //////////////////////////////////////////////////////////////////////////
@@ -347,6 +377,18 @@ class InferringColumnDecoderTest : public ColumnDecoderTest {
     AssertFetch(ArrayFromJSON(type, "[null]"));
   }
 
+  void TestSharedDictionary() {
+    auto type = dictionary(int32(), utf8());
+
+    auto options = default_options;
+    options.auto_dict_encode = true;
+    MakeDecoder(options);
+
+    AppendChunks({{"ab", "cd", "ab"}, {"ef", "cd"}});
+    AssertFetch(DictArrayFromJSON(type, "[0, 1, 0]", R"(["ab", "cd"])"));
+    AssertFetch(DictArrayFromJSON(type, "[2, 1]", R"(["ab", "cd", "ef"])"));
+  }
+
   void TestErrors() {
     auto type = int64();
 
@@ -376,6 +418,8 @@ TEST_F(InferringColumnDecoderTest, Threaded) { this->TestThreaded(); }
 
 TEST_F(InferringColumnDecoderTest, Options) { this->TestOptions(); }
 
+TEST_F(InferringColumnDecoderTest, SharedDictionary) { this->TestSharedDictionary(); }
+
 TEST_F(InferringColumnDecoderTest, Errors) { this->TestErrors(); }
 
 TEST_F(InferringColumnDecoderTest, Empty) { this->TestEmpty(); }
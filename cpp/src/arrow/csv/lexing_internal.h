@@ -196,16 +196,75 @@ class NeonFilter {
 
 #endif
 
+#if defined(ARROW_HAVE_AVX2)
+
+// AVX2 scanner: 32 bytes at a time, computing a bitmask of the special characters
+// so that the parser can jump directly to the first one.
+//
+// Unlike the filters above, which only tell whether a word contains a special
+// character, this has distinct sets of special characters inside and outside
+// of quoted fields: delimiters and line separators are ordinary characters in
+// the former, and quotes are ordinary characters in the latter.
+
+template <typename SpecializedOptions>
+class AVX2Scanner {
+ public:
+  static constexpr int64_t kBlockSize = 32;
+
+  explicit AVX2Scanner(const ParseOptions& options)
+      : cr_(_mm256_set1_epi8('\r')),
+        lf_(_mm256_set1_epi8('\n')),
+        delim_(_mm256_set1_epi8(options.delimiter)),
+        // (only looked up if quoting, resp. escaping, is enabled)
+        quote_(_mm256_set1_epi8(options.quote_char)),
+        escape_(_mm256_set1_epi8(options.escape_char)) {}
+
+  // Return the bitmask of the special characters in the kBlockSize bytes at `data`,
+  // bit #i being set if data[i] is special
+  template <bool Quoted>
+  uint32_t SpecialChars(const char* data) const {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    __m256i matches;
+    if (Quoted) {
+      matches = _mm256_cmpeq_epi8(v, quote_);
+    } else {
+      matches = _mm256_or_si256(_mm256_cmpeq_epi8(v, delim_),
+                                _mm256_or_si256(_mm256_cmpeq_epi8(v, cr_),
+                                                _mm256_cmpeq_epi8(v, lf_)));
+    }
+    if (SpecializedOptions::escaping) {
+      matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(v, escape_));
+    }
+    return static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+  }
+
+ private:
+  const __m256i cr_, lf_, delim_, quote_, escape_;
+};
+
+#endif
+
+// Filters telling whether a word holds any special character, as needed by the
+// chunker.
 #if defined(ARROW_HAVE_SSE4_2) && (defined(__x86_64__) || defined(_M_X64))
 // (the SSE4.2 filter seems to crash on RTools with 32-bit MinGW)
 template <typename SpecializedOptions>
-using PreferredBulkFilterType = SSE42Filter<SpecializedOptions>;
+using PreferredChunkerFilterType = SSE42Filter<SpecializedOptions>;
 #elif defined(ARROW_HAVE_NEON)
 template <typename SpecializedOptions>
-using PreferredBulkFilterType = NeonFilter<SpecializedOptions>;
+using PreferredChunkerFilterType = NeonFilter<SpecializedOptions>;
+#else
+template <typename SpecializedOptions>
+using PreferredChunkerFilterType = BloomFilter4B<SpecializedOptions>;
+#endif
+
+// The parser can also use the AVX2 scanner, which locates the special characters.
+#if defined(ARROW_HAVE_AVX2)
+template <typename SpecializedOptions>
+using PreferredBulkFilterType = AVX2Scanner<SpecializedOptions>;
 #else
 template <typename SpecializedOptions>
-using PreferredBulkFilterType = BloomFilter4B<SpecializedOptions>;
+using PreferredBulkFilterType = PreferredChunkerFilterType<SpecializedOptions>;
 #endif
 
 }  // namespace internal
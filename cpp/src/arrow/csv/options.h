@@ -103,6 +103,13 @@ struct ARROW_EXPORT ConvertOptions {
   /// This setting is ignored for non-inferred columns (those in `column_types`).
   bool auto_dict_encode = false;
   int32_t auto_dict_max_cardinality = 50;
+  /// Maximum number of distinct values shared across chunks of a dict-encoded column.
+  ///
+  /// When reading in a streaming fashion, the chunks of a dict-encoded column
+  /// share a single dictionary, each chunk's dictionary being a prefix of the
+  /// following ones.  Once the shared dictionary grows beyond this value, each
+  /// subsequent chunk gets its own dictionary.  Set to 0 to disable sharing.
+  int32_t dict_max_shared_cardinality = 1 << 16;
 
   /// Decimal point character for floating-point and decimal data
   char decimal_point = '.';
@@ -209,6 +216,13 @@ struct ARROW_EXPORT WriteOptions {
   /// \brief Quoting style
   QuotingStyle quoting_style = QuotingStyle::Needed;
 
+  /// \brief Whether to use the global CPU thread pool
+  ///
+  /// If true, several batches of `batch_size` rows are converted in parallel,
+  /// and written in order.  This is disabled by default, as the writer is
+  /// commonly itself called from CPU pool tasks.
+  bool use_threads = false;
+
   /// Create write options with default values
   static WriteOptions Defaults();
 
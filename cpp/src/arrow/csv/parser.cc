@@ -26,6 +26,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/simd.h"
 
@@ -88,6 +89,12 @@ class PresizedDataWriter {
     parsed_size_ += sizeof(w);
   }
 
+  void PushFieldChars(const char* data, int64_t size) {
+    DCHECK_GE(parsed_capacity_ - parsed_size_, size);
+    memcpy(parsed_ + parsed_size_, data, static_cast<size_t>(size));
+    parsed_size_ += size;
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
@@ -294,7 +301,8 @@ class BlockParserImpl {
   InField:
     // Inside a non-quoted part of a field
     if (UseBulkFilter) {
-      const char* bulk_end = RunBulkFilter(parsed_writer, data, data_end, bulk_filter);
+      const char* bulk_end = RunBulkFilter</*Quoted=*/false>(parsed_writer, data,
+                                                             data_end, bulk_filter);
       if (ARROW_PREDICT_FALSE(bulk_end == nullptr)) {
         if (is_final) {
           data = data_end;
@@ -338,7 +346,8 @@ class BlockParserImpl {
   InQuotedField:
     // Inside a quoted part of a field
     if (UseBulkFilter) {
-      const char* bulk_end = RunBulkFilter(parsed_writer, data, data_end, bulk_filter);
+      const char* bulk_end = RunBulkFilter</*Quoted=*/true>(parsed_writer, data,
+                                                            data_end, bulk_filter);
       if (ARROW_PREDICT_FALSE(bulk_end == nullptr)) {
         if (is_final) {
           data = data_end;
@@ -425,7 +434,9 @@ class BlockParserImpl {
     return Status::OK();
   }
 
-  template <typename DataWriter, typename SpecializedBulkFilter>
+  // Copy the field bytes preceding any special character, and return a pointer
+  // to where the parser should resume byte by byte (nullptr at end of data)
+  template <bool Quoted, typename DataWriter, typename SpecializedBulkFilter>
   const char* RunBulkFilter(DataWriter* data_writer, const char* data,
                             const char* data_end,
                             const SpecializedBulkFilter& bulk_filter) {
@@ -449,6 +460,31 @@ class BlockParserImpl {
     }
   }
 
+#if defined(ARROW_HAVE_AVX2)
+  // Same, but stopping right at the first special character rather than at the
+  // start of the word containing it
+  template <bool Quoted, typename DataWriter, typename SpecializedOptions>
+  const char* RunBulkFilter(DataWriter* data_writer, const char* data,
+                            const char* data_end,
+                            const internal::AVX2Scanner<SpecializedOptions>& scanner) {
+    constexpr int64_t kBlockSize = internal::AVX2Scanner<SpecializedOptions>::kBlockSize;
+    while (data_end - data >= kBlockSize) {
+      const uint32_t special_chars = scanner.template SpecialChars<Quoted>(data);
+      if (special_chars != 0) {
+        const int num_ordinary_chars = bit_util::CountTrailingZeros(special_chars);
+        data_writer->PushFieldChars(data, num_ordinary_chars);
+        return data + num_ordinary_chars;
+      }
+      data_writer->PushFieldChars(data, kBlockSize);
+      data += kBlockSize;
+    }
+    if (ARROW_PREDICT_FALSE(data == data_end)) {
+      return nullptr;
+    }
+    return data;
+  }
+#endif
+
   template <typename SpecializedOptions, typename ValueDescWriter, typename DataWriter,
             typename BulkFilter>
   Status ParseChunk(ValueDescWriter* values_writer, DataWriter* parsed_writer,
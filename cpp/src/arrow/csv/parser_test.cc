@@ -719,6 +719,64 @@ TEST(BlockParser, Escaping) {
   }
 }
 
+TEST(BlockParser, SpecialCharsAroundBulkBoundaries) {
+  // The bulk filters look at the data 8 or 32 bytes at a time: put special
+  // characters at every offset around those block sizes, both in a single
+  // Parse() call spanning all rows and in one call per row.
+  //
+  // The parser only enables the bulk filter after seeing a first line with long
+  // enough values.
+  const std::string first_line =
+      std::string(40, 'x') + "," + std::string(40, 'y') + "\n";
+  for (bool escaping : {false, true}) {
+    ARROW_SCOPED_TRACE("escaping=", escaping);
+    auto options = ParseOptions::Defaults();
+    options.escaping = escaping;
+
+    std::vector<std::string> lines;
+    std::vector<std::vector<std::string>> columns(2);
+    std::vector<std::vector<bool>> quoted(2);
+    auto add_row = [&](std::string line, std::string first, bool first_quoted,
+                       std::string second, bool second_quoted) {
+      lines.push_back(std::move(line));
+      columns[0].push_back(std::move(first));
+      quoted[0].push_back(first_quoted);
+      columns[1].push_back(std::move(second));
+      quoted[1].push_back(second_quoted);
+    };
+    add_row(first_line, std::string(40, 'x'), false, std::string(40, 'y'), false);
+    for (int n = 0; n <= 72; ++n) {
+      const std::string a(n, 'a');
+      // Delimiter, then LF, CR+LF and CR line endings
+      add_row(a + ",z\n", a, false, "z", false);
+      add_row("z," + a + "\r\n", "z", false, a, false);
+      add_row("z," + a + "\r", "z", false, a, false);
+      // Delimiter, line endings and a doubled quote inside a quoted field
+      add_row("\"" + a + ",\r\n\"\"" + a + "\",z\n", a + ",\r\n\"" + a, true, "z",
+              false);
+      add_row("z,\"" + a + "\"\n", "z", false, a, true);
+      if (escaping) {
+        add_row(a + "\\,b,z\n", a + ",b", false, "z", false);
+        add_row("\"" + a + "\\\"b\",z\n", a + "\"b", true, "z", false);
+      }
+    }
+
+    {
+      BlockParser parser(options);
+      AssertParseOk(parser, MakeCSVData(lines));
+      AssertColumnsEq(parser, columns, quoted);
+    }
+    for (size_t i = 1; i < lines.size(); ++i) {
+      ARROW_SCOPED_TRACE("line=", lines[i]);
+      BlockParser parser(options);
+      AssertParseOk(parser, first_line + lines[i]);
+      AssertColumnsEq(parser,
+                      {{columns[0][0], columns[0][i]}, {columns[1][0], columns[1][i]}},
+                      {{false, quoted[0][i]}, {false, quoted[1][i]}});
+    }
+  }
+}
+
 // Generate test data with the given number of columns.
 std::string MakeLotsOfCsvColumns(int32_t num_columns) {
   std::string values, header;
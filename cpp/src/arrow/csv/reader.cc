@@ -17,6 +17,7 @@
 
 #include "arrow/csv/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -52,6 +53,10 @@
 #include "arrow/util/utf8.h"
 #include "arrow/util/vector.h"
 
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+#include <xsimd/xsimd.hpp>
+#endif
+
 namespace arrow {
 
 using internal::Executor;
@@ -389,7 +394,8 @@ namespace {
 // The parsed batch contains a list of offsets for each of the columns so that columns
 // can be individually scanned
 //
-// This operator is not re-entrant
+// This operator is not re-entrant, unless it doesn't count rows and is fed
+// independent blocks (from a ThreadedBlockReader)
 class BlockParsingOperator {
  public:
   BlockParsingOperator(io::IOContext io_context, ParseOptions parse_options,
@@ -430,7 +436,9 @@ class BlockParsingOperator {
     if (count_rows_) {
       num_rows_seen_ += parser->total_num_rows();
     }
-    RETURN_NOT_OK(block.consume_bytes(parsed_size));
+    if (block.consume_bytes) {
+      RETURN_NOT_OK(block.consume_bytes(parsed_size));
+    }
     return ParsedBlock{std::move(parser), block.block_index,
                        static_cast<int64_t>(parsed_size) + block.bytes_skipped};
   }
@@ -864,9 +872,10 @@ class StreamingReaderImpl : public ReaderMixin,
     int max_readahead = cpu_executor->GetCapacity();
     auto self = shared_from_this();
 
-    return buffer_generator().Then([self, buffer_generator, max_readahead](
+    return buffer_generator().Then([self, buffer_generator, cpu_executor, max_readahead](
                                        const std::shared_ptr<Buffer>& first_buffer) {
-      return self->InitAfterFirstBuffer(first_buffer, buffer_generator, max_readahead);
+      return self->InitAfterFirstBuffer(first_buffer, buffer_generator, cpu_executor,
+                                        max_readahead);
     });
   }
 
@@ -887,7 +896,7 @@ class StreamingReaderImpl : public ReaderMixin,
  protected:
   Future<> InitAfterFirstBuffer(const std::shared_ptr<Buffer>& first_buffer,
                                 AsyncGenerator<std::shared_ptr<Buffer>> buffer_generator,
-                                int max_readahead) {
+                                Executor* cpu_executor, int max_readahead) {
     if (first_buffer == nullptr) {
       return Status::Invalid("Empty CSV file");
     }
@@ -903,12 +912,33 @@ class StreamingReaderImpl : public ReaderMixin,
         auto decoder_op,
         BlockDecodingOperator::Make(io_context_, convert_options_, conversion_schema_));
 
-    auto block_gen = SerialBlockReader::MakeAsyncIterator(
-        std::move(buffer_generator), MakeChunker(parse_options_), std::move(after_header),
-        read_options_.skip_rows_after_names);
-    auto parsed_block_gen =
-        MakeMappedGenerator(std::move(block_gen), std::move(parser_op));
-    auto rb_gen = MakeMappedGenerator(std::move(parsed_block_gen), std::move(decoder_op));
+    AsyncGenerator<DecodedBlock> rb_gen;
+    if (count_rows_) {
+      // Serial parsing: each block is delimited by where parsing of the previous
+      // one stopped
+      auto block_gen = SerialBlockReader::MakeAsyncIterator(
+          std::move(buffer_generator), MakeChunker(parse_options_),
+          std::move(after_header), read_options_.skip_rows_after_names);
+      auto parsed_block_gen =
+          MakeMappedGenerator(std::move(block_gen), std::move(parser_op));
+      rb_gen = MakeMappedGenerator(std::move(parsed_block_gen), std::move(decoder_op));
+    } else {
+      // Parallel parsing: the chunker delimits whole blocks, which are each parsed
+      // and decoded in a separate task.  Readahead (see InitFromBlock) bounds the
+      // number of blocks in flight and yields them in order.
+      auto block_gen = ThreadedBlockReader::MakeAsyncIterator(
+          std::move(buffer_generator), MakeChunker(parse_options_),
+          std::move(after_header), read_options_.skip_rows_after_names);
+      auto parse_and_decode = [cpu_executor, parser_op,
+                               decoder_op](const CSVBlock& block) mutable {
+        auto parsed_fut = DeferNotOk(cpu_executor->Submit(
+            [parser_op, block]() mutable { return parser_op(block); }));
+        return parsed_fut.Then([decoder_op](const ParsedBlock& parsed) mutable {
+          return decoder_op(parsed);
+        });
+      };
+      rb_gen = MakeMappedGenerator(std::move(block_gen), std::move(parse_and_decode));
+    }
 
     auto self = shared_from_this();
     return rb_gen().Then([self, rb_gen, max_readahead](const DecodedBlock& first_block) {
@@ -1169,6 +1199,89 @@ Future<std::shared_ptr<StreamingReader>> MakeStreamingReader(
 /////////////////////////////////////////////////////////////////////////
 // Row count implementation
 
+// Counts the rows of CSV data holding no quoted or escaped values by looking for line
+// terminators, checking the number of columns of each row.  Data it can't count, or
+// whose rows are invalid, is left to the parser.
+class LineCounter {
+ public:
+  LineCounter(const ParseOptions& options, int32_t num_cols)
+      : delimiter_(static_cast<uint8_t>(options.delimiter)),
+        quote_char_(static_cast<uint8_t>(options.quoting ? options.quote_char : '\n')),
+        escape_char_(static_cast<uint8_t>(options.escaping ? options.escape_char : '\n')),
+        num_delimiters_per_line_(num_cols - 1) {}
+
+  // Return false if the data can't be counted
+  bool Consume(const Buffer& buffer) {
+    const uint8_t* data = buffer.data();
+    const int64_t size = buffer.size();
+    int64_t offset = 0;
+#if defined(ARROW_HAVE_SSE4_2) || defined(ARROW_HAVE_NEON)
+    using simd_batch = xsimd::make_sized_batch_t<uint8_t, 16>;
+    while (offset + 16 <= size) {
+      const auto v = simd_batch::load_unaligned(data + offset);
+      if (xsimd::any((v == '\n') | (v == '\r') | (v == delimiter_) | (v == quote_char_) |
+                     (v == escape_char_))) {
+        if (!ConsumeScalar(data + offset, 16)) {
+          return false;
+        }
+      } else {
+        bytes_in_line_ += 16;
+      }
+      offset += 16;
+    }
+#endif
+    return ConsumeScalar(data + offset, size - offset);
+  }
+
+  // Return false if the line not ended by a line terminator is invalid
+  bool Finish() { return bytes_in_line_ == 0 || EndLine(); }
+
+  // Number of lines ended by a line terminator
+  int64_t num_lines() const { return num_lines_; }
+  // Number of bytes after the last line terminator
+  int64_t bytes_in_line() const { return bytes_in_line_; }
+
+ private:
+  bool ConsumeScalar(const uint8_t* data, int64_t size) {
+    for (int64_t i = 0; i < size; ++i) {
+      const uint8_t c = data[i];
+      if (c == '\n' || c == '\r') {
+        // "\r\n" ends a single line since the '\n' ends an empty one
+        if (bytes_in_line_ > 0 && !EndLine()) {
+          return false;
+        }
+        continue;
+      }
+      if (c == delimiter_) {
+        ++num_delimiters_;
+      } else if (c == quote_char_ || c == escape_char_) {
+        return false;
+      }
+      ++bytes_in_line_;
+    }
+    return true;
+  }
+
+  bool EndLine() {
+    if (num_delimiters_ != num_delimiters_per_line_) {
+      return false;
+    }
+    ++num_lines_;
+    bytes_in_line_ = 0;
+    num_delimiters_ = 0;
+    return true;
+  }
+
+  const uint8_t delimiter_;
+  // A line terminator when quoting or escaping is disabled
+  const uint8_t quote_char_;
+  const uint8_t escape_char_;
+  const int32_t num_delimiters_per_line_;
+  int64_t num_lines_ = 0;
+  int64_t bytes_in_line_ = 0;
+  int32_t num_delimiters_ = 0;
+};
+
 class CSVRowCounter : public ReaderMixin,
                       public std::enable_shared_from_this<CSVRowCounter> {
  public:
@@ -1214,6 +1327,12 @@ class CSVRowCounter : public ReaderMixin,
     // IterationEnd.
     std::function<Result<util::optional<int64_t>>(const CSVBlock&)> count_cb =
         [self](const CSVBlock& maybe_block) -> Result<util::optional<int64_t>> {
+      if (self->CanCountLines()) {
+        ARROW_ASSIGN_OR_RAISE(auto maybe_num_rows, self->CountLines(maybe_block));
+        if (maybe_num_rows.has_value()) {
+          return maybe_num_rows;
+        }
+      }
       ARROW_ASSIGN_OR_RAISE(
           auto parser,
           self->Parse(maybe_block.partial, maybe_block.completion, maybe_block.buffer,
@@ -1228,6 +1347,39 @@ class CSVRowCounter : public ReaderMixin,
         [self]() { return self->row_count_; });
   }
 
+  // Whether rows can be counted by looking for line terminators: each non-empty line
+  // is then a row
+  bool CanCountLines() const {
+    return !parse_options_.newlines_in_values && parse_options_.ignore_empty_lines &&
+           !parse_options_.invalid_row_handler &&
+           read_options_.skip_rows_after_names == 0;
+  }
+
+  // Count the rows of the block without parsing it, or return an empty optional if
+  // it must be parsed
+  Result<util::optional<int64_t>> CountLines(const CSVBlock& block) {
+    LineCounter counter(parse_options_, num_csv_cols_);
+    if (!counter.Consume(*block.partial) || !counter.Consume(*block.completion) ||
+        !counter.Consume(*block.buffer)) {
+      return util::nullopt;
+    }
+    int64_t consumed_bytes =
+        block.partial->size() + block.completion->size() + block.buffer->size();
+    if (block.is_final) {
+      if (!counter.Finish()) {
+        return util::nullopt;
+      }
+    } else {
+      // Leave an unfinished line for the next block
+      consumed_bytes -= std::min(counter.bytes_in_line(), block.buffer->size());
+    }
+    RETURN_NOT_OK(block.consume_bytes(consumed_bytes));
+    const int64_t num_rows = counter.num_lines();
+    num_rows_seen_ += num_rows;
+    row_count_ += num_rows;
+    return num_rows;
+  }
+
   Executor* cpu_executor_;
   AsyncGenerator<CSVBlock> block_generator_;
   int64_t row_count_;
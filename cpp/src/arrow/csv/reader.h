@@ -63,8 +63,13 @@ class ARROW_EXPORT TableReader {
 
 /// \brief A class that reads a CSV file incrementally
 ///
+/// If `ReadOptions::use_threads` is true and the CPU executor has more than one
+/// thread, several blocks are parsed and converted in parallel, with at most as
+/// many blocks in flight as there are executor threads.  Batches are always
+/// yielded in file order.
+///
 /// Caveats:
-/// - For now, this is always single-threaded (regardless of `ReadOptions::use_threads`.
+/// - When parsing in parallel, row numbers are not reported in error messages.
 /// - Type inference is done on the first block and types are frozen afterwards;
 ///   to make sure the right data types are inferred, either set
 ///   `ReadOptions::block_size` to a large enough value, or use
@@ -95,8 +100,7 @@ class ARROW_EXPORT StreamingReader : public RecordBatchReader {
   /// This involves some I/O as the first batch must be loaded during the creation process
   /// so it is returned as a future
   ///
-  /// Currently, the StreamingReader is not async-reentrant and does not do any fan-out
-  /// parsing (see ARROW-11889)
+  /// Currently, the StreamingReader is not async-reentrant
   static Future<std::shared_ptr<StreamingReader>> MakeAsync(
       io::IOContext io_context, std::shared_ptr<io::InputStream> input,
       arrow::internal::Executor* cpu_executor, const ReadOptions&, const ParseOptions&,
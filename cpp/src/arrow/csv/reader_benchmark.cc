@@ -0,0 +1,240 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <memory>
+#include <string>
+
+#include "arrow/array.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/compressed.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace csv {
+
+namespace {
+
+constexpr int kSeed = 42;
+// Number of values in each generated CSV file, whatever the number of columns
+constexpr int64_t kNumValues = 1 << 20;
+
+// Generate a CSV file cycling through integer, floating-point and string columns.
+// If `quoted`, strings are quoted and every tenth of them embeds an escaped quote.
+std::shared_ptr<Buffer> MakeCsvData(int num_cols, bool quoted,
+                                    std::shared_ptr<Schema>* out_schema = nullptr) {
+  random::RandomArrayGenerator rg(kSeed);
+  const int64_t num_rows = kNumValues / num_cols;
+
+  FieldVector fields;
+  ArrayVector arrays;
+  for (int i = 0; i < num_cols; ++i) {
+    const auto name = "f" + std::to_string(i);
+    switch (i % 3) {
+      case 0:
+        fields.push_back(field(name, int64()));
+        arrays.push_back(rg.Int64(num_rows, -1000000, 1000000,
+                                  /*null_probability=*/0.01));
+        break;
+      case 1:
+        fields.push_back(field(name, float64()));
+        arrays.push_back(rg.Float64(num_rows, -1e6, 1e6, /*null_probability=*/0.01));
+        break;
+      default: {
+        fields.push_back(field(name, utf8()));
+        auto strings = rg.String(num_rows, 5, 25, /*null_probability=*/0);
+        if (quoted) {
+          const auto& string_array = checked_cast<const StringArray&>(*strings);
+          StringBuilder builder;
+          for (int64_t j = 0; j < string_array.length(); ++j) {
+            auto value = string_array.GetString(j);
+            if (j % 10 == 0) value += '"';
+            ABORT_NOT_OK(builder.Append(value));
+          }
+          ABORT_NOT_OK(builder.Finish(&strings));
+        }
+        arrays.push_back(std::move(strings));
+      }
+    }
+  }
+  auto batch = RecordBatch::Make(schema(fields), num_rows, arrays);
+
+  auto write_options = WriteOptions::Defaults();
+  write_options.quoting_style = quoted ? QuotingStyle::Needed : QuotingStyle::None;
+  auto out = *io::BufferOutputStream::Create();
+  ABORT_NOT_OK(WriteCSV(*batch, write_options, out.get()));
+  if (out_schema != nullptr) {
+    *out_schema = batch->schema();
+  }
+  return *out->Finish();
+}
+
+std::shared_ptr<Buffer> Compress(const std::shared_ptr<Buffer>& data,
+                                 util::Codec* codec) {
+  auto sink = *io::BufferOutputStream::Create();
+  auto compressed = *io::CompressedOutputStream::Make(codec, sink);
+  ABORT_NOT_OK(compressed->Write(data));
+  ABORT_NOT_OK(compressed->Close());
+  return *sink->Finish();
+}
+
+// Run the benchmark body with the given number of CPU threads
+class ScopedCpuThreads {
+ public:
+  explicit ScopedCpuThreads(int num_threads)
+      : previous_(GetCpuThreadPoolCapacity()) {
+    ABORT_NOT_OK(SetCpuThreadPoolCapacity(num_threads));
+  }
+  ~ScopedCpuThreads() { ABORT_NOT_OK(SetCpuThreadPoolCapacity(previous_)); }
+
+ private:
+  int previous_;
+};
+
+enum class ReaderKind { Table, Streaming };
+
+int64_t ReadCsv(ReaderKind kind, std::shared_ptr<io::InputStream> input,
+                const ReadOptions& read_options, const ConvertOptions& convert_options) {
+  const auto parse_options = ParseOptions::Defaults();
+  if (kind == ReaderKind::Table) {
+    auto reader = *TableReader::Make(io::default_io_context(), std::move(input),
+                                     read_options, parse_options, convert_options);
+    return (*reader->Read())->num_rows();
+  }
+  auto reader = *StreamingReader::Make(io::default_io_context(), std::move(input),
+                                       read_options, parse_options, convert_options);
+  int64_t num_rows = 0;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    ABORT_NOT_OK(reader->ReadNext(&batch));
+    if (batch == nullptr) break;
+    num_rows += batch->num_rows();
+  }
+  return num_rows;
+}
+
+void BenchmarkReadCsv(benchmark::State& state,  // NOLINT non-const reference
+                      ReaderKind kind, util::Codec* codec = nullptr) {
+  const auto num_cols = static_cast<int>(state.range(0));
+  const bool quoted = state.range(1) != 0;
+  const bool infer_types = state.range(2) != 0;
+  const auto num_threads = static_cast<int>(state.range(3));
+
+  std::shared_ptr<Schema> schema;
+  auto data = MakeCsvData(num_cols, quoted, &schema);
+  auto input_data = codec != nullptr ? Compress(data, codec) : data;
+
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = num_threads > 1;
+  auto convert_options = ConvertOptions::Defaults();
+  if (!infer_types) {
+    for (const auto& field : schema->fields()) {
+      convert_options.column_types[field->name()] = field->type();
+    }
+  }
+
+  ScopedCpuThreads cpu_threads(num_threads);
+  int64_t num_rows = 0;
+  for (auto _ : state) {
+    std::shared_ptr<io::InputStream> input =
+        std::make_shared<io::BufferReader>(input_data);
+    if (codec != nullptr) {
+      input = *io::CompressedInputStream::Make(codec, input);
+    }
+    num_rows = ReadCsv(kind, std::move(input), read_options, convert_options);
+  }
+  if (num_rows != kNumValues / num_cols) {
+    state.SkipWithError("Unexpected number of rows read");
+  }
+
+  // Report the uncompressed size
+  state.SetBytesProcessed(state.iterations() * data->size());
+  state.SetItemsProcessed(state.iterations() * num_rows * num_cols);
+}
+
+void ReadCsvTable(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadCsv(state, ReaderKind::Table);
+}
+
+void ReadCsvStreaming(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadCsv(state, ReaderKind::Streaming);
+}
+
+void ReadCsvTableGzip(benchmark::State& state) {  // NOLINT non-const reference
+  if (!util::Codec::IsAvailable(Compression::GZIP)) {
+    state.SkipWithError("gzip support not built");
+    return;
+  }
+  auto codec = *util::Codec::Create(Compression::GZIP);
+  BenchmarkReadCsv(state, ReaderKind::Table, codec.get());
+}
+
+// Arguments: number of columns, quoting, type inference, number of threads
+void ReaderArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"cols", "quoted", "infer", "threads"});
+  for (int num_cols : {3, 30, 300}) {
+    for (int quoted : {0, 1}) {
+      for (int infer : {0, 1}) {
+        bench->Args({num_cols, quoted, infer, 1});
+      }
+    }
+  }
+  for (int num_threads : {2, 4, 8}) {
+    bench->Args({30, 1, 1, num_threads});
+  }
+}
+
+void StreamingReaderArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"cols", "quoted", "infer", "threads"});
+  for (int num_cols : {3, 30, 300}) {
+    for (int infer : {0, 1}) {
+      bench->Args({num_cols, 1, infer, 1});
+    }
+  }
+  bench->Args({30, 1, 1, 4});
+}
+
+void CompressedReaderArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"cols", "quoted", "infer", "threads"});
+  for (int num_threads : {1, 4}) {
+    bench->Args({30, 1, 1, num_threads});
+  }
+}
+
+}  // namespace
+
+BENCHMARK(ReadCsvTable)->Apply(ReaderArgs)->UseRealTime();
+BENCHMARK(ReadCsvStreaming)->Apply(StreamingReaderArgs)->UseRealTime();
+BENCHMARK(ReadCsvTableGzip)->Apply(CompressedReaderArgs)->UseRealTime();
+
+}  // namespace csv
+}  // namespace arrow
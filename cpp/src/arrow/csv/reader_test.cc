@@ -433,6 +433,33 @@ TEST(StreamingReaderTests, SkipMultipleEmptyBlocksAtStart) {
   ASSERT_EQ(nullptr, batch.get());
 }
 
+TEST(StreamingReaderTests, ParallelKeepsOrder) {
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, internal::ThreadPool::Make(4));
+  ASSERT_OK_AND_ASSIGN(auto table_buffer, MakeSampleCsvBuffer(/*num_rows=*/5000));
+
+  auto read_all = [&](bool use_threads, std::shared_ptr<Table>* out) {
+    auto input = std::make_shared<io::BufferReader>(table_buffer);
+    auto read_options = ReadOptions::Defaults();
+    read_options.block_size = 1000;
+    read_options.use_threads = use_threads;
+    auto reader_fut =
+        StreamingReader::MakeAsync(io::default_io_context(), input, thread_pool.get(),
+                                   read_options, ParseOptions::Defaults(),
+                                   ConvertOptions::Defaults());
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto reader, reader_fut);
+    ASSERT_OK_AND_ASSIGN(*out, reader->ToTable());
+    ASSERT_EQ(table_buffer->size(), reader->bytes_read());
+  };
+
+  std::shared_ptr<Table> serial_table, parallel_table;
+  read_all(/*use_threads=*/false, &serial_table);
+  ASSERT_EQ(5000, serial_table->num_rows());
+  for (int i = 0; i < 5; ++i) {
+    read_all(/*use_threads=*/true, &parallel_table);
+    AssertTablesEqual(*serial_table, *parallel_table, /*same_chunk_layout=*/false);
+  }
+}
+
 TEST(CountRowsAsync, Basics) {
   constexpr int NROWS = 4096;
   ASSERT_OK_AND_ASSIGN(auto table_buffer, MakeSampleCsvBuffer(NROWS));
@@ -473,6 +500,33 @@ TEST(CountRowsAsync, Basics) {
   }
 }
 
+TEST(CountRowsAsync, LineEndings) {
+  auto count_rows = [](const std::string& csv, int32_t block_size) {
+    auto reader = std::make_shared<io::BufferReader>(Buffer::FromString(csv));
+    auto read_options = ReadOptions::Defaults();
+    read_options.block_size = block_size;
+    return CountRowsAsync(io::default_io_context(), reader, internal::GetCpuThreadPool(),
+                          read_options, ParseOptions::Defaults());
+  };
+  const std::string lines = "a,b\n1,2\r\n\n3,4\r\r5,6\n\n7,8";
+  const std::string quoted = "a,b\n1,\"x,y\"\n\"z\",2\r\n3,4\n";
+  // Blocks must hold at least one line
+  for (int32_t block_size : {8, 13, 1 << 20}) {
+    ARROW_SCOPED_TRACE("block_size = ", block_size);
+    ASSERT_FINISHES_OK_AND_EQ(4, count_rows(lines, block_size));
+    ASSERT_FINISHES_OK_AND_EQ(4, count_rows(lines + "\r\n", block_size));
+    ASSERT_FINISHES_OK_AND_EQ(3, count_rows(quoted, block_size));
+    ASSERT_FINISHES_AND_RAISES(Invalid, count_rows(lines + "\n9", block_size));
+    ASSERT_FINISHES_AND_RAISES(Invalid, count_rows("a,b\n1,2,3\n4,5\n", block_size));
+  }
+  const std::string long_lines = "a,b\n" + std::string(40, 'x') + "," +
+                                 std::string(40, 'y') + "\n" + std::string(20, 'x') +
+                                 ",y\n";
+  ASSERT_FINISHES_OK_AND_EQ(2, count_rows(long_lines, 1 << 20));
+  ASSERT_FINISHES_AND_RAISES(Invalid, count_rows(long_lines + std::string(40, 'x'),
+                                                 1 << 20));
+}
+
 TEST(CountRowsAsync, Errors) {
   ASSERT_OK_AND_ASSIGN(auto table_buffer, MakeSampleCsvBuffer(4096, [](size_t row_num) {
                          return row_num != 2048;
@@ -27,6 +27,8 @@
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visit_data_inline.h"
 #include "arrow/visit_type_inline.h"
 
@@ -369,6 +371,7 @@ class QuotedColumnPopulator : public ColumnPopulator {
 struct PopulatorFactory {
   template <typename TypeClass>
   enable_if_t<is_base_binary_type<TypeClass>::value ||
+                  is_binary_view_like_type<TypeClass>::value ||
                   std::is_same<FixedSizeBinaryType, TypeClass>::value,
               Status>
   Visit(const TypeClass& type) {
@@ -443,6 +446,92 @@ Result<std::unique_ptr<ColumnPopulator>> MakePopulator(
   return std::unique_ptr<ColumnPopulator>(factory.populator);
 }
 
+// Converts slices of record batches to CSV data, in a buffer of its own.
+// Each instance has its own column populators, so that several slices can be
+// converted in parallel by separate translators.
+class SliceTranslator {
+ public:
+  static Result<std::unique_ptr<SliceTranslator>> Make(
+      const Schema& schema, const WriteOptions& options,
+      std::shared_ptr<Buffer> null_string) {
+    std::vector<std::unique_ptr<ColumnPopulator>> populators(schema.num_fields());
+    std::string delimiter(1, options.delimiter);
+    for (int col = 0; col < schema.num_fields(); col++) {
+      const std::string& end_chars =
+          col < schema.num_fields() - 1 ? delimiter : options.eol;
+      ASSIGN_OR_RAISE(
+          populators[col],
+          MakePopulator(*schema.field(col), end_chars, options.delimiter, null_string,
+                        options.quoting_style, options.io_context.pool()));
+    }
+    ASSIGN_OR_RAISE(auto data_buffer,
+                    AllocateResizableBuffer(
+                        options.batch_size * schema.num_fields() * kColumnSizeGuess,
+                        options.io_context.pool()));
+    return std::unique_ptr<SliceTranslator>(new SliceTranslator(
+        std::move(populators), std::move(data_buffer), options));
+  }
+
+  // The CSV data of the last translated slice
+  const std::shared_ptr<ResizableBuffer>& data() const { return data_buffer_; }
+
+  Status Translate(const RecordBatch& batch) {
+    if (batch.num_rows() == 0) {
+      return data_buffer_->Resize(0, /*shrink_to_fit=*/false);
+    }
+    offsets_.resize(batch.num_rows());
+    std::fill(offsets_.begin(), offsets_.end(), 0);
+
+    // Calculate relative offsets for each row (excluding delimiters)
+    for (int32_t col = 0; col < static_cast<int32_t>(column_populators_.size()); col++) {
+      RETURN_NOT_OK(
+          column_populators_[col]->UpdateRowLengths(*batch.column(col), offsets_.data()));
+    }
+    // Calculate cumulative offsets for each row (including delimiters).
+    // - before conversion: offsets_[i] = length of i-th row
+    // - after conversion:  offsets_[i] = offset to the starting of i-th row buffer
+    //   - offsets_[0] = 0
+    //   - offsets_[i] = offsets_[i-1] + len(i-1-th row) + len(delimiters)
+    // Delimiters: ',' * (num_columns - 1) + eol
+    const int32_t delimiters_length =
+        static_cast<int32_t>(batch.num_columns() - 1 + eol_size_);
+    int64_t last_row_length = offsets_[0] + delimiters_length;
+    offsets_[0] = 0;
+    for (size_t row = 1; row < offsets_.size(); ++row) {
+      const int64_t this_row_length = offsets_[row] + delimiters_length;
+      offsets_[row] = offsets_[row - 1] + last_row_length;
+      last_row_length = this_row_length;
+    }
+    // Resize the target buffer to required size. We assume batch to batch sizes
+    // should be pretty close so don't shrink the buffer to avoid allocation churn.
+    RETURN_NOT_OK(
+        data_buffer_->Resize(offsets_.back() + last_row_length, /*shrink_to_fit=*/false));
+
+    // Use the offsets to populate contents.
+    for (auto& populator : column_populators_) {
+      RETURN_NOT_OK(populator->PopulateRows(
+          reinterpret_cast<char*>(data_buffer_->mutable_data()), offsets_.data()));
+    }
+    DCHECK_EQ(data_buffer_->size(), offsets_.back());
+    return Status::OK();
+  }
+
+ private:
+  SliceTranslator(std::vector<std::unique_ptr<ColumnPopulator>> populators,
+                  std::shared_ptr<ResizableBuffer> data_buffer,
+                  const WriteOptions& options)
+      : column_populators_(std::move(populators)),
+        offsets_(0, 0, ::arrow::stl::allocator<char*>(options.io_context.pool())),
+        data_buffer_(std::move(data_buffer)),
+        eol_size_(options.eol.size()) {}
+
+  static constexpr int64_t kColumnSizeGuess = 8;
+  std::vector<std::unique_ptr<ColumnPopulator>> column_populators_;
+  std::vector<int64_t, arrow::stl::allocator<int64_t>> offsets_;
+  std::shared_ptr<ResizableBuffer> data_buffer_;
+  const size_t eol_size_;
+};
+
 class CSVWriterImpl : public ipc::RecordBatchWriter {
  public:
   static Result<std::shared_ptr<CSVWriterImpl>> Make(
@@ -459,19 +548,16 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     memcpy(null_string->mutable_data(), options.null_string.data(),
            options.null_string.length());
 
-    std::vector<std::unique_ptr<ColumnPopulator>> populators(schema->num_fields());
-    std::string delimiter(1, options.delimiter);
-    for (int col = 0; col < schema->num_fields(); col++) {
-      const std::string& end_chars =
-          col < schema->num_fields() - 1 ? delimiter : options.eol;
-      ASSIGN_OR_RAISE(
-          populators[col],
-          MakePopulator(*schema->field(col), end_chars, options.delimiter, null_string,
-                        options.quoting_style, options.io_context.pool()));
+    // One translator per slice converted concurrently
+    const int num_translators =
+        options.use_threads ? std::max(1, internal::GetCpuThreadPool()->GetCapacity())
+                            : 1;
+    std::vector<std::unique_ptr<SliceTranslator>> translators(num_translators);
+    for (auto& translator : translators) {
+      ASSIGN_OR_RAISE(translator, SliceTranslator::Make(*schema, options, null_string));
     }
     auto writer = std::make_shared<CSVWriterImpl>(
-        sink, std::move(owned_sink), std::move(schema), std::move(populators), options);
-    RETURN_NOT_OK(writer->PrepareForContentsWrite());
+        sink, std::move(owned_sink), std::move(schema), std::move(translators), options);
     if (options.include_header) {
       RETURN_NOT_OK(writer->WriteHeader());
     }
@@ -480,28 +566,13 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
 
   Status WriteRecordBatch(const RecordBatch& batch) override {
     RecordBatchIterator iterator = RecordBatchSliceIterator(batch, options_.batch_size);
-    for (auto maybe_slice : iterator) {
-      ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> slice, maybe_slice);
-      RETURN_NOT_OK(TranslateMinimalBatch(*slice));
-      RETURN_NOT_OK(sink_->Write(data_buffer_));
-      stats_.num_record_batches++;
-    }
-    return Status::OK();
+    return WriteSlices([&]() { return iterator.Next(); });
   }
 
   Status WriteTable(const Table& table, int64_t max_chunksize) override {
     TableBatchReader reader(table);
     reader.set_chunksize(max_chunksize > 0 ? max_chunksize : options_.batch_size);
-    std::shared_ptr<RecordBatch> batch;
-    RETURN_NOT_OK(reader.ReadNext(&batch));
-    while (batch != nullptr) {
-      RETURN_NOT_OK(TranslateMinimalBatch(*batch));
-      RETURN_NOT_OK(sink_->Write(data_buffer_));
-      RETURN_NOT_OK(reader.ReadNext(&batch));
-      stats_.num_record_batches++;
-    }
-
-    return Status::OK();
+    return WriteSlices([&]() { return reader.Next(); });
   }
 
   Status Close() override { return Status::OK(); }
@@ -510,25 +581,40 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
 
   CSVWriterImpl(io::OutputStream* sink, std::shared_ptr<io::OutputStream> owned_sink,
                 std::shared_ptr<Schema> schema,
-                std::vector<std::unique_ptr<ColumnPopulator>> populators,
+                std::vector<std::unique_ptr<SliceTranslator>> translators,
                 const WriteOptions& options)
       : sink_(sink),
         owned_sink_(std::move(owned_sink)),
-        column_populators_(std::move(populators)),
-        offsets_(0, 0, ::arrow::stl::allocator<char*>(options.io_context.pool())),
+        translators_(std::move(translators)),
         schema_(std::move(schema)),
         options_(options) {}
 
  private:
-  Status PrepareForContentsWrite() {
-    // Only called once, as part of initialization
-    if (data_buffer_ == nullptr) {
-      ASSIGN_OR_RAISE(data_buffer_,
-                      AllocateResizableBuffer(
-                          options_.batch_size * schema_->num_fields() * kColumnSizeGuess,
-                          options_.io_context.pool()));
+  // Convert and write the slices returned by `next_slice` until it returns null.
+  // Up to one slice per translator is converted at a time, in parallel if enabled.
+  template <typename NextSlice>
+  Status WriteSlices(NextSlice&& next_slice) {
+    std::vector<std::shared_ptr<RecordBatch>> slices;
+    while (true) {
+      slices.clear();
+      while (slices.size() < translators_.size()) {
+        ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> slice, next_slice());
+        if (slice == nullptr) {
+          break;
+        }
+        slices.push_back(std::move(slice));
+      }
+      if (slices.empty()) {
+        return Status::OK();
+      }
+      RETURN_NOT_OK(internal::OptionalParallelFor(
+          options_.use_threads && slices.size() > 1, static_cast<int>(slices.size()),
+          [&](int i) { return translators_[i]->Translate(*slices[i]); }));
+      for (size_t i = 0; i < slices.size(); ++i) {
+        RETURN_NOT_OK(sink_->Write(translators_[i]->data()));
+        stats_.num_record_batches++;
+      }
     }
-    return Status::OK();
   }
 
   int64_t CalculateHeaderSize() const {
@@ -545,8 +631,9 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
 
   Status WriteHeader() {
     // Only called once, as part of initialization
-    RETURN_NOT_OK(data_buffer_->Resize(CalculateHeaderSize(), /*shrink_to_fit=*/false));
-    char* next = reinterpret_cast<char*>(data_buffer_->mutable_data());
+    ASSIGN_OR_RAISE(std::shared_ptr<Buffer> header,
+                    AllocateBuffer(CalculateHeaderSize(), options_.io_context.pool()));
+    char* next = reinterpret_cast<char*>(header->mutable_data());
     for (int col = 0; col < schema_->num_fields(); ++col) {
       *next++ = '"';
       next = Escape(schema_->field(col)->name(), next);
@@ -557,58 +644,13 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     }
     memcpy(next, options_.eol.data(), options_.eol.size());
     next += options_.eol.size();
-    DCHECK_EQ(reinterpret_cast<uint8_t*>(next),
-              data_buffer_->data() + data_buffer_->size());
-    return sink_->Write(data_buffer_);
-  }
-
-  Status TranslateMinimalBatch(const RecordBatch& batch) {
-    if (batch.num_rows() == 0) {
-      return Status::OK();
-    }
-    offsets_.resize(batch.num_rows());
-    std::fill(offsets_.begin(), offsets_.end(), 0);
-
-    // Calculate relative offsets for each row (excluding delimiters)
-    for (int32_t col = 0; col < static_cast<int32_t>(column_populators_.size()); col++) {
-      RETURN_NOT_OK(
-          column_populators_[col]->UpdateRowLengths(*batch.column(col), offsets_.data()));
-    }
-    // Calculate cumulative offsets for each row (including delimiters).
-    // - before conversion: offsets_[i] = length of i-th row
-    // - after conversion:  offsets_[i] = offset to the starting of i-th row buffer
-    //   - offsets_[0] = 0
-    //   - offsets_[i] = offsets_[i-1] + len(i-1-th row) + len(delimiters)
-    // Delimiters: ',' * (num_columns - 1) + eol
-    const int32_t delimiters_length =
-        static_cast<int32_t>(batch.num_columns() - 1 + options_.eol.size());
-    int64_t last_row_length = offsets_[0] + delimiters_length;
-    offsets_[0] = 0;
-    for (size_t row = 1; row < offsets_.size(); ++row) {
-      const int64_t this_row_length = offsets_[row] + delimiters_length;
-      offsets_[row] = offsets_[row - 1] + last_row_length;
-      last_row_length = this_row_length;
-    }
-    // Resize the target buffer to required size. We assume batch to batch sizes
-    // should be pretty close so don't shrink the buffer to avoid allocation churn.
-    RETURN_NOT_OK(
-        data_buffer_->Resize(offsets_.back() + last_row_length, /*shrink_to_fit=*/false));
-
-    // Use the offsets to populate contents.
-    for (auto& populator : column_populators_) {
-      RETURN_NOT_OK(populator->PopulateRows(
-          reinterpret_cast<char*>(data_buffer_->mutable_data()), offsets_.data()));
-    }
-    DCHECK_EQ(data_buffer_->size(), offsets_.back());
-    return Status::OK();
+    DCHECK_EQ(reinterpret_cast<uint8_t*>(next), header->data() + header->size());
+    return sink_->Write(header);
   }
 
-  static constexpr int64_t kColumnSizeGuess = 8;
   io::OutputStream* sink_;
   std::shared_ptr<io::OutputStream> owned_sink_;
-  std::vector<std::unique_ptr<ColumnPopulator>> column_populators_;
-  std::vector<int64_t, arrow::stl::allocator<int64_t>> offsets_;
-  std::shared_ptr<ResizableBuffer> data_buffer_;
+  std::vector<std::unique_ptr<SliceTranslator>> translators_;
   const std::shared_ptr<Schema> schema_;
   const WriteOptions options_;
   ipc::WriteStats stats_;
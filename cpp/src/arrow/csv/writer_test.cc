@@ -343,6 +343,14 @@ TEST_P(TestWriteCSV, TestWrite) {
     // The writer should work identically.
     ASSERT_OK_AND_ASSIGN(csv, ToCsvStringUsingWriter(*table, options));
     EXPECT_EQ(csv, GetParam().expected_output);
+
+    // Slices converted in parallel should be written in order.
+    options.use_threads = true;
+    options.batch_size = 1;
+    ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*record_batch, options));
+    EXPECT_EQ(csv, GetParam().expected_output);
+    ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*table, options));
+    EXPECT_EQ(csv, GetParam().expected_output);
   }
 }
 
@@ -116,14 +116,19 @@ class FragmentDataset : public Dataset {
     }
 
     // TODO(ARROW-12891) Provide subtree pruning for any vector of fragments
-    FragmentVector fragments;
+    std::vector<compute::Expression> partition_expressions;
+    partition_expressions.reserve(fragments_.size());
     for (const auto& fragment : fragments_) {
-      ARROW_ASSIGN_OR_RAISE(
-          auto simplified_filter,
-          compute::SimplifyWithGuarantee(predicate, fragment->partition_expression()));
+      partition_expressions.push_back(fragment->partition_expression());
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto simplified_filters,
+        compute::SimplifyWithGuarantees(predicate, partition_expressions));
 
-      if (simplified_filter.IsSatisfiable()) {
-        fragments.push_back(fragment);
+    FragmentVector fragments;
+    for (size_t i = 0; i < fragments_.size(); ++i) {
+      if (simplified_filters[i].IsSatisfiable()) {
+        fragments.push_back(fragments_[i]);
       }
     }
     return MakeVectorIterator(std::move(fragments));
@@ -17,18 +17,26 @@
 
 #include "arrow/dataset/dataset_writer.h"
 
+#include <algorithm>
 #include <deque>
 #include <mutex>
 #include <unordered_map>
 
+#include "arrow/compute/api_vector.h"
+#include "arrow/dataset/manifest.h"
+#include "arrow/dataset/partition.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/table.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/future.h"
+#include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
 #include "arrow/util/map.h"
 #include "arrow/util/string.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace dataset {
@@ -49,7 +57,8 @@ class Throttle {
       return Future<>::MakeFinished();
     }
     std::lock_guard<std::mutex> lg(mutex_);
-    if (values + current_value_ > max_value_) {
+    // Values larger than the maximum are let through once nothing else is held
+    if (current_value_ > 0 && values + current_value_ > max_value_) {
       in_waiting_ = values;
       backpressure_ = Future<>::Make();
     } else {
@@ -66,7 +75,8 @@ class Throttle {
     {
       std::lock_guard<std::mutex> lg(mutex_);
       current_value_ -= values;
-      if (in_waiting_ > 0 && in_waiting_ + current_value_ <= max_value_) {
+      if (in_waiting_ > 0 &&
+          (current_value_ == 0 || in_waiting_ + current_value_ <= max_value_)) {
         in_waiting_ = 0;
         to_complete = backpressure_;
       }
@@ -85,9 +95,10 @@ class Throttle {
 };
 
 struct DatasetWriterState {
-  DatasetWriterState(uint64_t rows_in_flight, uint64_t max_open_files,
-                     uint64_t max_rows_staged)
+  DatasetWriterState(uint64_t rows_in_flight, uint64_t bytes_in_flight,
+                     uint64_t max_open_files, uint64_t max_rows_staged)
       : rows_in_flight_throttle(rows_in_flight),
+        bytes_in_flight_throttle(bytes_in_flight),
         open_files_throttle(max_open_files),
         staged_rows_count(0),
         max_rows_staged(max_rows_staged) {}
@@ -97,6 +108,9 @@ struct DatasetWriterState {
   // Throttle for how many rows the dataset writer will allow to be in process memory
   // When this is exceeded the dataset writer will pause / apply backpressure
   Throttle rows_in_flight_throttle;
+  // Throttle for how many bytes of data the dataset writer will allow to be in process
+  // memory.  Like rows_in_flight_throttle, backpressure is applied when it is exceeded.
+  Throttle bytes_in_flight_throttle;
   // Control for how many files the dataset writer will open.  When this is exceeded
   // the dataset writer will pause and it will also close the largest open file.
   Throttle open_files_throttle;
@@ -110,14 +124,19 @@ struct DatasetWriterState {
   const uint64_t max_rows_staged;
   // Mutex to guard access to the file visitors in the writer options
   std::mutex visitors_mutex;
+  // Files written so far and their schema, if a manifest is to be written
+  std::mutex manifest_mutex;
+  std::vector<FragmentManifestEntry> manifest_entries;
+  std::shared_ptr<Schema> manifest_schema;
 };
 
 class DatasetWriterFileQueue : public util::AsyncDestroyable {
  public:
   explicit DatasetWriterFileQueue(const Future<std::shared_ptr<FileWriter>>& writer_fut,
                                   const FileSystemDatasetWriteOptions& options,
+                                  const std::vector<compute::SortKey>& sort_keys,
                                   DatasetWriterState* writer_state)
-      : options_(options), writer_state_(writer_state) {
+      : options_(options), sort_keys_(sort_keys), writer_state_(writer_state) {
     // If this AddTask call fails (e.g. we're given an already failing future) then we
     // will get the error later when we try and write to it.
     ARROW_UNUSED(file_tasks_.AddTask([this, writer_fut] {
@@ -155,27 +174,39 @@ class DatasetWriterFileQueue : public util::AsyncDestroyable {
     return table->CombineChunksToBatch();
   }
 
-  Status ScheduleBatch(std::shared_ptr<RecordBatch> batch) {
+  Status ScheduleBatch(std::shared_ptr<RecordBatch> batch, uint64_t num_bytes) {
     struct WriteTask {
-      Future<> operator()() { return self->WriteNext(std::move(batch)); }
+      Future<> operator()() { return self->WriteNext(std::move(batch), num_bytes); }
       DatasetWriterFileQueue* self;
       std::shared_ptr<RecordBatch> batch;
+      uint64_t num_bytes;
     };
-    return file_tasks_.AddTask(WriteTask{this, std::move(batch)});
+    return file_tasks_.AddTask(WriteTask{this, std::move(batch), num_bytes});
   }
 
   Result<int64_t> PopAndDeliverStagedBatch() {
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next_batch, PopStagedBatch());
-    int64_t rows_popped = next_batch->num_rows();
-    rows_currently_staged_ -= next_batch->num_rows();
-    ARROW_RETURN_NOT_OK(ScheduleBatch(std::move(next_batch)));
-    return rows_popped;
+    uint64_t rows_popped = next_batch->num_rows();
+    // Staged batches are sliced and merged, so their bytes are released in proportion
+    // to their rows.  Whatever is left is released with the last rows.
+    uint64_t bytes_popped = bytes_currently_staged_;
+    if (rows_popped < rows_currently_staged_) {
+      bytes_popped = static_cast<uint64_t>(static_cast<double>(bytes_currently_staged_) *
+                                           rows_popped / rows_currently_staged_);
+    }
+    rows_currently_staged_ -= rows_popped;
+    bytes_currently_staged_ -= bytes_popped;
+    ARROW_RETURN_NOT_OK(ScheduleBatch(std::move(next_batch), bytes_popped));
+    return static_cast<int64_t>(rows_popped);
   }
 
   // Stage batches, popping and delivering batches if enough data has arrived
-  Status Push(std::shared_ptr<RecordBatch> batch) {
+  //
+  // num_bytes is the amount acquired from bytes_in_flight_throttle for the batch
+  Status Push(std::shared_ptr<RecordBatch> batch, uint64_t num_bytes) {
     uint64_t delta_staged = batch->num_rows();
     rows_currently_staged_ += delta_staged;
+    bytes_currently_staged_ += num_bytes;
     staged_batches_.push_back(std::move(batch));
     while (!staged_batches_.empty() &&
            (writer_state_->StagingFull() ||
@@ -197,20 +228,33 @@ class DatasetWriterFileQueue : public util::AsyncDestroyable {
   }
 
  private:
-  Future<> WriteNext(std::shared_ptr<RecordBatch> next) {
+  Future<> WriteNext(std::shared_ptr<RecordBatch> next, uint64_t num_bytes) {
     struct WriteTask {
       Status operator()() {
         int64_t rows_to_release = batch->num_rows();
-        Status status = self->writer_->Write(batch);
+        Status status = self->SortBatch(&batch);
+        if (status.ok()) {
+          status = self->UpdateStatistics(*batch);
+        }
+        if (status.ok()) {
+          status = self->writer_->Write(batch);
+        }
+        batch.reset();
         self->writer_state_->rows_in_flight_throttle.Release(rows_to_release);
+        self->writer_state_->bytes_in_flight_throttle.Release(bytes_to_release);
         return status;
       }
       DatasetWriterFileQueue* self;
       std::shared_ptr<RecordBatch> batch;
+      uint64_t bytes_to_release;
     };
+    // Writes to a file are serialized by file_tasks_, so different files are encoded
+    // concurrently, up to the capacity of the executor.
     // May want to prototype / measure someday pushing the async write down further
-    return DeferNotOk(options_.filesystem->io_context().executor()->Submit(
-        WriteTask{this, std::move(next)}));
+    ::arrow::internal::Executor* executor =
+        options_.use_threads ? ::arrow::internal::GetCpuThreadPool()
+                             : options_.filesystem->io_context().executor();
+    return DeferNotOk(executor->Submit(WriteTask{this, std::move(next), num_bytes}));
   }
 
   Future<> DoFinish() {
@@ -219,18 +263,58 @@ class DatasetWriterFileQueue : public util::AsyncDestroyable {
       RETURN_NOT_OK(options_.writer_pre_finish(writer_.get()));
     }
     return writer_->Finish().Then([this]() {
-      std::lock_guard<std::mutex> lg(writer_state_->visitors_mutex);
-      return options_.writer_post_finish(writer_.get());
+      {
+        std::lock_guard<std::mutex> lg(writer_state_->visitors_mutex);
+        RETURN_NOT_OK(options_.writer_post_finish(writer_.get()));
+      }
+      return AddManifestEntry();
     });
   }
 
+  Status SortBatch(std::shared_ptr<RecordBatch>* batch) {
+    if (sort_keys_.empty()) return Status::OK();
+    ARROW_ASSIGN_OR_RAISE(
+        auto indices,
+        compute::SortIndices(Datum(*batch), compute::SortOptions(sort_keys_)));
+    ARROW_ASSIGN_OR_RAISE(Datum sorted, compute::Take(Datum(*batch), Datum(indices)));
+    *batch = sorted.record_batch();
+    return Status::OK();
+  }
+
+  Status UpdateStatistics(const RecordBatch& batch) {
+    if (!options_.write_manifest) return Status::OK();
+    if (!statistics_) {
+      statistics_ = ::arrow::internal::make_unique<FragmentStatisticsCollector>(
+          writer_->schema());
+    }
+    return statistics_->Update(batch);
+  }
+
+  Status AddManifestEntry() {
+    if (!options_.write_manifest) return Status::OK();
+    FragmentManifestEntry entry;
+    entry.path = writer_->destination().path;
+    ARROW_ASSIGN_OR_RAISE(entry.size, writer_->GetBytesWritten());
+    if (statistics_) {
+      entry.num_rows = statistics_->num_rows();
+      ARROW_ASSIGN_OR_RAISE(entry.statistics, statistics_->Finish());
+    }
+    std::lock_guard<std::mutex> lg(writer_state_->manifest_mutex);
+    writer_state_->manifest_entries.push_back(std::move(entry));
+    writer_state_->manifest_schema = writer_->schema();
+    return Status::OK();
+  }
+
   const FileSystemDatasetWriteOptions& options_;
+  const std::vector<compute::SortKey>& sort_keys_;
   DatasetWriterState* writer_state_;
   std::shared_ptr<FileWriter> writer_;
   // Batches are accumulated here until they are large enough to write out at which
   // point they are merged together and added to write_queue_
   std::deque<std::shared_ptr<RecordBatch>> staged_batches_;
   uint64_t rows_currently_staged_ = 0;
+  uint64_t bytes_currently_staged_ = 0;
+  std::unique_ptr<FragmentStatisticsCollector> statistics_;
   util::SerializedAsyncTaskGroup file_tasks_;
 };
 
@@ -271,13 +355,13 @@ class DatasetWriterDirectoryQueue : public util::AsyncDestroyable {
     return to_queue;
   }
 
-  Status StartWrite(const std::shared_ptr<RecordBatch>& batch) {
+  Status StartWrite(const std::shared_ptr<RecordBatch>& batch, uint64_t num_bytes) {
     rows_written_ += batch->num_rows();
     WriteTask task{current_filename_, static_cast<uint64_t>(batch->num_rows())};
     if (!latest_open_file_) {
       ARROW_ASSIGN_OR_RAISE(latest_open_file_, OpenFileQueue(current_filename_));
     }
-    return latest_open_file_->Push(batch);
+    return latest_open_file_->Push(batch, num_bytes);
   }
 
   Result<std::string> GetNextFilename() {
@@ -300,7 +384,15 @@ class DatasetWriterDirectoryQueue : public util::AsyncDestroyable {
   Result<std::shared_ptr<FileWriter>> OpenWriter(const std::string& filename) {
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<io::OutputStream> out_stream,
                           write_options_.filesystem->OpenOutputStream(filename));
-    return write_options_.format()->MakeWriter(std::move(out_stream), schema_,
+    std::shared_ptr<Schema> file_schema = schema_;
+    if (!sort_keys_.empty()) {
+      auto metadata = schema_->HasMetadata() ? schema_->metadata()->Copy()
+                                             : key_value_metadata({}, {});
+      RETURN_NOT_OK(metadata->Set(kSortKeysMetadataKey, SerializeSortKeys(sort_keys_)));
+      file_schema = schema_->WithMetadata(std::move(metadata));
+    }
+    return write_options_.format()->MakeWriter(std::move(out_stream),
+                                               std::move(file_schema),
                                                write_options_.file_write_options,
                                                {write_options_.filesystem, filename});
   }
@@ -315,7 +407,7 @@ class DatasetWriterDirectoryQueue : public util::AsyncDestroyable {
               io_executor->Submit([this, filename]() { return OpenWriter(filename); }));
         });
     auto file_queue = util::MakeSharedAsync<DatasetWriterFileQueue>(
-        file_writer_fut, write_options_, writer_state_);
+        file_writer_fut, write_options_, sort_keys_, writer_state_);
     RETURN_NOT_OK(task_group_.AddTask(file_queue->on_closed().Then(
         [this] { writer_state_->open_files_throttle.Release(1); },
         [this](const Status& err) {
@@ -345,6 +437,23 @@ class DatasetWriterDirectoryQueue : public util::AsyncDestroyable {
     }
   }
 
+  // The sort keys that apply to the files, which don't hold the partition fields
+  Status ResolveSortKeys() {
+    for (const auto& key : write_options_.sort_keys) {
+      if (key.target.FindOne(*schema_).ok()) {
+        sort_keys_.push_back(key);
+        continue;
+      }
+      const auto& partitioning = write_options_.partitioning;
+      if (!partitioning || !key.target.FindOne(*partitioning->schema()).ok()) {
+        return Status::Invalid("Sort key ", key.target.ToString(),
+                               " does not refer to a field of the written data ",
+                               schema_->ToString());
+      }
+    }
+    return Status::OK();
+  }
+
   static Result<std::unique_ptr<DatasetWriterDirectoryQueue,
                                 util::DestroyingDeleter<DatasetWriterDirectoryQueue>>>
   Make(util::AsyncTaskGroup* task_group,
@@ -355,6 +464,7 @@ class DatasetWriterDirectoryQueue : public util::AsyncDestroyable {
         std::move(directory), std::move(prefix), std::move(schema), write_options,
         writer_state);
     RETURN_NOT_OK(task_group->AddTask(dir_queue->on_closed()));
+    RETURN_NOT_OK(dir_queue->ResolveSortKeys());
     dir_queue->PrepareDirectory();
     ARROW_ASSIGN_OR_RAISE(dir_queue->current_filename_, dir_queue->GetNextFilename());
     // std::move required to make RTools 3.5 mingw compiler happy
@@ -372,6 +482,7 @@ class DatasetWriterDirectoryQueue : public util::AsyncDestroyable {
   std::string prefix_;
   std::shared_ptr<Schema> schema_;
   const FileSystemDatasetWriteOptions& write_options_;
+  std::vector<compute::SortKey> sort_keys_;
   DatasetWriterState* writer_state_;
   Future<> init_future_;
   std::string current_filename_;
@@ -445,7 +556,8 @@ class DatasetWriter::DatasetWriterImpl : public util::AsyncDestroyable {
  public:
   DatasetWriterImpl(FileSystemDatasetWriteOptions write_options, uint64_t max_rows_queued)
       : write_options_(std::move(write_options)),
-        writer_state_(max_rows_queued, write_options_.max_open_files,
+        writer_state_(max_rows_queued, write_options_.max_bytes_in_flight,
+                      write_options_.max_open_files,
                       CalculateMaxRowsStaged(max_rows_queued)) {}
 
   Future<> WriteRecordBatch(std::shared_ptr<RecordBatch> batch,
@@ -502,14 +614,28 @@ class DatasetWriter::DatasetWriterImpl : public util::AsyncDestroyable {
       if (!backpressure.is_finished()) {
         break;
       }
+      uint64_t num_bytes = 0;
+      if (write_options_.max_bytes_in_flight > 0) {
+        ARROW_ASSIGN_OR_RAISE(int64_t referenced_bytes,
+                              util::ReferencedBufferSize(*next_chunk));
+        num_bytes = static_cast<uint64_t>(referenced_bytes);
+        backpressure = writer_state_.bytes_in_flight_throttle.Acquire(num_bytes);
+        if (!backpressure.is_finished()) {
+          writer_state_.rows_in_flight_throttle.Release(next_chunk->num_rows());
+          break;
+        }
+      }
       if (will_open_file) {
         backpressure = writer_state_.open_files_throttle.Acquire(1);
         if (!backpressure.is_finished()) {
+          // The chunk will be acquired again when the write is retried
+          writer_state_.rows_in_flight_throttle.Release(next_chunk->num_rows());
+          writer_state_.bytes_in_flight_throttle.Release(num_bytes);
           RETURN_NOT_OK(CloseLargestFile());
           break;
         }
       }
-      RETURN_NOT_OK(dir_queue->StartWrite(next_chunk));
+      RETURN_NOT_OK(dir_queue->StartWrite(next_chunk, num_bytes));
       batch = std::move(remainder);
       if (batch) {
         RETURN_NOT_OK(dir_queue->FinishCurrentFile());
@@ -536,7 +662,41 @@ class DatasetWriter::DatasetWriterImpl : public util::AsyncDestroyable {
 
   Future<> DoDestroy() override {
     directory_queues_.clear();
-    return task_group_.End().Then([this] { return err_; });
+    return task_group_.End().Then([this]() -> Status {
+      RETURN_NOT_OK(err_);
+      return WriteManifest();
+    });
+  }
+
+  Status WriteManifest() {
+    if (!write_options_.write_manifest) return Status::OK();
+    auto& entries = writer_state_.manifest_entries;
+    auto physical_schema = writer_state_.manifest_schema
+                               ? writer_state_.manifest_schema
+                               : schema(FieldVector{});
+    // The partition fields are not written to the files
+    SchemaBuilder schema_builder(physical_schema, SchemaBuilder::CONFLICT_IGNORE);
+    if (write_options_.partitioning) {
+      RETURN_NOT_OK(
+          schema_builder.AddSchema(write_options_.partitioning->schema()));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto dataset_schema, schema_builder.Finish());
+
+    for (auto& entry : entries) {
+      entry.path = StripPrefix(entry.path, write_options_.base_dir);
+      if (write_options_.partitioning) {
+        ARROW_ASSIGN_OR_RAISE(entry.partition_expression,
+                              write_options_.partitioning->Parse(entry.path));
+      }
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const FragmentManifestEntry& left, const FragmentManifestEntry& right) {
+                return left.path < right.path;
+              });
+    DatasetManifest manifest(std::move(dataset_schema), std::move(physical_schema),
+                             write_options_.format()->type_name(), std::move(entries),
+                             write_options_.sort_keys);
+    return manifest.Write(write_options_.filesystem, write_options_.base_dir);
   }
 
   util::AsyncTaskGroup task_group_;
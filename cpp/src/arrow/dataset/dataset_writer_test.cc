@@ -30,6 +30,7 @@
 #include "arrow/table.h"
 #include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/key_value_metadata.h"
 #include "arrow/util/optional.h"
 #include "gtest/gtest.h"
 
@@ -371,6 +372,86 @@ TEST_F(DatasetWriterTestFixture, MaxOpenFiles) {
                       "testdir/part1/chunk-0.arrow", "testdir/part2/chunk-0.arrow"});
 }
 
+TEST_F(DatasetWriterTestFixture, MaxBytesInFlight) {
+  auto gated_fs = UseGatedFs();
+  // Each batch of 10 int64 values holds 80 bytes
+  write_options_.max_bytes_in_flight = 100;
+  EXPECT_OK_AND_ASSIGN(auto dataset_writer, DatasetWriter::Make(write_options_));
+
+  ASSERT_FINISHES_OK(dataset_writer->WriteRecordBatch(MakeBatch(10), "part0"));
+  Future<> fut = dataset_writer->WriteRecordBatch(MakeBatch(10), "part1");
+  // Backpressure will be applied until the first batch has been written
+  AssertNotFinished(fut);
+
+  ASSERT_OK(gated_fs->WaitForOpenOutputStream(1));
+  ASSERT_OK(gated_fs->UnlockOpenOutputStream(2));
+  ASSERT_FINISHES_OK(fut);
+
+  // A batch larger than the limit is accepted once nothing else is in flight
+  ASSERT_FINISHES_OK(dataset_writer->WriteRecordBatch(MakeBatch(20), "part1"));
+  ASSERT_FINISHES_OK(dataset_writer->Finish());
+  AssertCreatedData({{"testdir/part0/chunk-0.arrow", 0, 10},
+                     {"testdir/part1/chunk-0.arrow", 10, 30, 2}});
+}
+
+TEST_F(DatasetWriterTestFixture, UseThreads) {
+  write_options_.use_threads = true;
+  write_options_.max_rows_per_file = 10;
+  EXPECT_OK_AND_ASSIGN(auto dataset_writer, DatasetWriter::Make(write_options_));
+  std::vector<ExpectedFile> expected_files;
+  for (int i = 0; i < 8; i++) {
+    std::string i_str = std::to_string(i);
+    expected_files.push_back({"testdir/part" + i_str + "/chunk-0.arrow",
+                              static_cast<uint64_t>(i) * 20, 10});
+    expected_files.push_back({"testdir/part" + i_str + "/chunk-1.arrow",
+                              static_cast<uint64_t>(i) * 20 + 10, 10});
+    ASSERT_FINISHES_OK(dataset_writer->WriteRecordBatch(MakeBatch(20), "part" + i_str));
+  }
+  ASSERT_FINISHES_OK(dataset_writer->Finish());
+  AssertCreatedData(expected_files);
+}
+
+TEST_F(DatasetWriterTestFixture, SortKeys) {
+  write_options_.sort_keys = {
+      compute::SortKey("int64", compute::SortOrder::Descending),
+      compute::SortKey("part", compute::SortOrder::Ascending)};
+  write_options_.partitioning =
+      std::make_shared<DirectoryPartitioning>(schema({field("part", utf8())}));
+  write_options_.min_rows_per_group = 20;
+  EXPECT_OK_AND_ASSIGN(auto dataset_writer, DatasetWriter::Make(write_options_));
+  ASSERT_FINISHES_OK(dataset_writer->WriteRecordBatch(MakeBatch(10), "a"));
+  ASSERT_FINISHES_OK(dataset_writer->WriteRecordBatch(MakeBatch(10), "a"));
+  ASSERT_FINISHES_OK(dataset_writer->Finish());
+
+  util::optional<MockFileInfo> written_file = FindFile("testdir/a/chunk-0.arrow");
+  ASSERT_TRUE(written_file.has_value());
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       ipc::RecordBatchFileReader::Open(
+                           std::make_shared<io::BufferReader>(written_file->data)));
+  // The partition field is not written to the file
+  ASSERT_TRUE(reader->schema()->HasMetadata());
+  ASSERT_OK_AND_ASSIGN(auto sort_keys,
+                       reader->schema()->metadata()->Get(kSortKeysMetadataKey));
+  ASSERT_EQ(sort_keys, "descending .int64");
+
+  ASSERT_EQ(reader->num_record_batches(), 1);
+  ASSERT_OK_AND_ASSIGN(auto batch, reader->ReadRecordBatch(0));
+  Int64Builder builder;
+  for (int64_t i = 19; i >= 0; i--) {
+    ASSERT_OK(builder.Append(i));
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected, builder.Finish());
+  AssertArraysEqual(*expected, *batch->column(0));
+}
+
+TEST_F(DatasetWriterTestFixture, UnknownSortKey) {
+  write_options_.sort_keys = {compute::SortKey("unknown")};
+  EXPECT_OK_AND_ASSIGN(auto dataset_writer, DatasetWriter::Make(write_options_));
+  ASSERT_FINISHES_AND_RAISES(Invalid,
+                             dataset_writer->WriteRecordBatch(MakeBatch(10), ""));
+  ASSERT_FINISHES_OK(dataset_writer->Finish());
+}
+
 TEST_F(DatasetWriterTestFixture, NoExistingDirectory) {
   fs::TimePoint mock_now = std::chrono::system_clock::now();
   ASSERT_OK_AND_ASSIGN(std::shared_ptr<fs::FileSystem> fs,
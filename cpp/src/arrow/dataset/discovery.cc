@@ -29,6 +29,8 @@
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -176,35 +178,59 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
   }
 
   ARROW_ASSIGN_OR_RAISE(selector.base_dir, filesystem->NormalizePath(selector.base_dir));
-  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetFileInfo(selector));
-
-  // Filter out anything that's not a file or that's explicitly ignored
-  Status st;
-  auto files_end =
-      std::remove_if(files.begin(), files.end(), [&](const fs::FileInfo& info) {
-        if (!info.IsFile()) return true;
-
-        auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
-        if (!relative.has_value()) {
-          st = Status::Invalid("GetFileInfo() yielded path '", info.path(),
-                               "', which is outside base dir '", selector.base_dir, "'");
-          return false;
-        }
-
-        if (StartsWithAnyOf(std::string(*relative), options.selector_ignore_prefixes)) {
-          return true;
-        }
-
-        return false;
-      });
+
+  // Stream the listing so that files are filtered, and possibly checked for
+  // validity in the background, while further directories are still being listed
+  std::vector<fs::FileInfo> files;
+  std::vector<Future<bool>> supported;
+  auto visit_batch = [&](const fs::FileInfoVector& batch) -> Status {
+    for (const auto& info : batch) {
+      // Filter out anything that's not a file or that's explicitly ignored
+      if (!info.IsFile()) continue;
+
+      auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
+      if (!relative.has_value()) {
+        return Status::Invalid("GetFileInfo() yielded path '", info.path(),
+                               "', which is outside base dir '", selector.base_dir,
+                               "'");
+      }
+
+      if (StartsWithAnyOf(std::string(*relative), options.selector_ignore_prefixes)) {
+        continue;
+      }
+
+      if (options.exclude_invalid_files) {
+        FileSource source(info, filesystem);
+        supported.push_back(DeferNotOk(io::internal::SubmitIO(
+            filesystem->io_context(),
+            [format, source]() { return format->IsSupported(source); })));
+      }
+      files.push_back(info);
+    }
+    return Status::OK();
+  };
+  auto listed =
+      VisitAsyncGenerator(filesystem->GetFileInfoGenerator(selector), visit_batch);
+  Status st = listed.status();
+  // Wait for the validity checks even on error, so as not to leave them dangling
+  ARROW_ASSIGN_OR_RAISE(auto supported_results, All(std::move(supported)).result());
   RETURN_NOT_OK(st);
-  files.erase(files_end, files.end());
+
+  std::vector<fs::FileInfo> filtered_files;
+  for (size_t i = 0; i < files.size(); ++i) {
+    if (options.exclude_invalid_files) {
+      ARROW_ASSIGN_OR_RAISE(bool is_supported, supported_results[i]);
+      if (!is_supported) continue;
+    }
+    filtered_files.push_back(std::move(files[i]));
+  }
 
   // Sorting by path guarantees a stability sometimes needed by unit tests.
-  std::sort(files.begin(), files.end(), fs::FileInfo::ByPath());
+  std::sort(filtered_files.begin(), filtered_files.end(), fs::FileInfo::ByPath());
 
-  return Make(std::move(filesystem), std::move(files), std::move(format),
-              std::move(options));
+  return std::shared_ptr<DatasetFactory>(
+      new FileSystemDatasetFactory(std::move(filtered_files), std::move(filesystem),
+                                   std::move(format), std::move(options)));
 }
 
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
@@ -131,6 +131,9 @@ Future<util::optional<int64_t>> FileFragment::CountRows(
   if (!predicate.IsSatisfiable()) {
     return Future<util::optional<int64_t>>::MakeFinished(0);
   }
+  if (num_rows_.has_value() && predicate.Equals(compute::literal(true))) {
+    return Future<util::optional<int64_t>>::MakeFinished(num_rows_);
+  }
   auto self = checked_pointer_cast<FileFragment>(shared_from_this());
   return format()->CountRows(self, std::move(predicate), options);
 }
@@ -223,6 +226,9 @@ Result<FragmentIterator> FileSystemDataset::GetFragmentsImpl(
 
   std::vector<int> fragment_indices;
 
+  // Subtrees under different parents often simplify the same predicate, e.g. the
+  // months of each year when the predicate only references the month
+  compute::SimplifyWithGuaranteeCache simplify_cache;
   std::vector<compute::Expression> predicates{predicate};
   RETURN_NOT_OK(subtrees_->forest.Visit(
       [&](compute::Forest::Ref ref) -> Result<bool> {
@@ -235,7 +241,7 @@ Result<FragmentIterator> FileSystemDataset::GetFragmentsImpl(
         const auto& subtree_expr =
             util::get<compute::Expression>(subtrees_->fragments_and_subtrees[ref.i]);
         ARROW_ASSIGN_OR_RAISE(auto simplified,
-                              SimplifyWithGuarantee(predicates.back(), subtree_expr));
+                              simplify_cache.Simplify(predicates.back(), subtree_expr));
 
         if (!simplified.IsSatisfiable()) {
           return false;
@@ -271,6 +277,72 @@ Future<> FileWriter::Finish() {
   });
 }
 
+namespace {
+
+constexpr char kAscending[] = "ascending";
+constexpr char kDescending[] = "descending";
+
+// Like FieldRef::ToDotPath, but escaping the characters of names which
+// FieldRef::FromDotPath would otherwise take as delimiters
+std::string EscapedDotPath(const FieldRef& ref) {
+  if (const std::string* name = ref.name()) {
+    std::string out = ".";
+    for (char c : *name) {
+      if (c == '\\' || c == '.' || c == '[') {
+        out += '\\';
+      }
+      out += c;
+    }
+    return out;
+  }
+  if (const std::vector<FieldRef>* children = ref.nested_refs()) {
+    std::string out;
+    for (const auto& child : *children) {
+      out += EscapedDotPath(child);
+    }
+    return out;
+  }
+  return ref.ToDotPath();
+}
+
+}  // namespace
+
+std::string SerializeSortKeys(const std::vector<compute::SortKey>& keys) {
+  // One key per line, as the order followed by the dot path of the field
+  std::string out;
+  for (const auto& key : keys) {
+    if (!out.empty()) out += '\n';
+    out += key.order == compute::SortOrder::Ascending ? kAscending : kDescending;
+    out += ' ';
+    out += EscapedDotPath(key.target);
+  }
+  return out;
+}
+
+Result<std::vector<compute::SortKey>> ParseSortKeys(const std::string& serialized) {
+  std::vector<compute::SortKey> keys;
+  if (serialized.empty()) return keys;
+  for (const auto& line : ::arrow::internal::SplitString(serialized, '\n')) {
+    auto space = line.find(' ');
+    if (space == util::string_view::npos) {
+      return Status::Invalid("Invalid sort key '", line, "'");
+    }
+    auto order = line.substr(0, space);
+    compute::SortOrder sort_order;
+    if (order == kAscending) {
+      sort_order = compute::SortOrder::Ascending;
+    } else if (order == kDescending) {
+      sort_order = compute::SortOrder::Descending;
+    } else {
+      return Status::Invalid("Invalid sort order '", order, "'");
+    }
+    ARROW_ASSIGN_OR_RAISE(auto target,
+                          FieldRef::FromDotPath(std::string(line.substr(space + 1))));
+    keys.emplace_back(std::move(target), sort_order);
+  }
+  return keys;
+}
+
 Result<int64_t> FileWriter::GetBytesWritten() const {
   if (bytes_written_.has_value()) {
     return bytes_written_.value();
@@ -382,6 +454,7 @@ Status FileSystemDataset::Write(const FileSystemDatasetWriteOptions& write_optio
       scanner->options()->use_threads ? ::arrow::internal::GetCpuThreadPool() : nullptr;
   std::shared_ptr<compute::ExecContext> exec_context =
       std::make_shared<compute::ExecContext>(io_context.pool(), cpu_executor);
+  exec_context->set_stop_token(io_context.stop_token());
 
   ARROW_ASSIGN_OR_RAISE(auto plan, compute::ExecPlan::Make(exec_context.get()));
 
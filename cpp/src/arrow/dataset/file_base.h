@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/scanner.h"
@@ -99,6 +100,12 @@ class ARROW_DS_EXPORT FileSource {
     return filesystem_ ? file_info_.path() : buffer_ ? buffer_path : custom_open_path;
   }
 
+  /// \brief Return the file info, if any. Only valid when file source wraps a path.
+  ///
+  /// The size and modification time are only known if the source was constructed
+  /// from a FileInfo carrying them.
+  const fs::FileInfo& file_info() const { return file_info_; }
+
   /// \brief Return the filesystem, if any. Otherwise returns nullptr
   const std::shared_ptr<fs::FileSystem>& filesystem() const { return filesystem_; }
 
@@ -193,6 +200,11 @@ class ARROW_DS_EXPORT FileFragment : public Fragment {
   const FileSource& source() const { return source_; }
   const std::shared_ptr<FileFormat>& format() const { return format_; }
 
+  /// \brief Record the number of rows in the file, when it is known without reading
+  /// the file (for example from a DatasetManifest), so that counting all rows
+  /// doesn't open it.
+  void set_num_rows(int64_t num_rows) { num_rows_ = num_rows; }
+
  protected:
   FileFragment(FileSource source, std::shared_ptr<FileFormat> format,
                compute::Expression partition_expression,
@@ -205,6 +217,7 @@ class ARROW_DS_EXPORT FileFragment : public Fragment {
 
   FileSource source_;
   std::shared_ptr<FileFormat> format_;
+  util::optional<int64_t> num_rows_;
 
   friend class FileFormat;
 };
@@ -341,6 +354,17 @@ class ARROW_DS_EXPORT FileWriter {
   util::optional<int64_t> bytes_written_;
 };
 
+/// \brief Schema metadata key under which the dataset writer records the sort keys of
+/// the row groups of the files it writes
+constexpr char kSortKeysMetadataKey[] = "ARROW:dataset:sort_keys";
+
+/// \brief Serialize sort keys as the value of kSortKeysMetadataKey
+ARROW_DS_EXPORT std::string SerializeSortKeys(const std::vector<compute::SortKey>& keys);
+
+/// \brief Parse sort keys serialized by SerializeSortKeys
+ARROW_DS_EXPORT Result<std::vector<compute::SortKey>> ParseSortKeys(
+    const std::string& serialized);
+
 /// \brief Options for writing a dataset.
 struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
   /// Options for individual fragment writing.
@@ -388,9 +412,37 @@ struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
   /// group size is just barely larger than this value).
   uint64_t max_rows_per_group = 1 << 20;
 
+  /// If greater than 0 then this will limit how many bytes of data the dataset writer
+  /// will hold while it waits for them to be written, across all files.  When this is
+  /// exceeded the dataset writer will apply backpressure.  A batch larger than the limit
+  /// is only accepted once nothing else is waiting to be written.
+  uint64_t max_bytes_in_flight = 0;
+
+  /// If true then batches are encoded and written on the CPU thread pool, so that
+  /// as many files as there are cores may be encoded concurrently.  Otherwise they are
+  /// encoded on the I/O thread pool of the filesystem, whose capacity limits how many
+  /// files are encoded concurrently.  Files are opened and closed on the I/O thread pool
+  /// either way.
+  bool use_threads = false;
+
+  /// If not empty then the rows of each row group are sorted by these keys before they
+  /// are written.  Row groups are sorted independently of each other, so memory use
+  /// stays bounded by max_rows_per_group; set min_rows_per_group as well to get large
+  /// sorted runs.  Keys referring to partition fields are ignored since those are
+  /// constant within each file.
+  ///
+  /// The keys are recorded in the schema metadata of the written files under
+  /// kSortKeysMetadataKey, and in the DatasetManifest if one is written.
+  std::vector<compute::SortKey> sort_keys;
+
   /// Controls what happens if an output directory already exists.
   ExistingDataBehavior existing_data_behavior = ExistingDataBehavior::kError;
 
+  /// \brief If true the dataset writer will write a DatasetManifest of the files it
+  /// wrote, with their row counts and column statistics, to base_dir. Files that
+  /// were already in base_dir are not listed.
+  bool write_manifest = false;
+
   /// \brief If false the dataset writer will not create directories
   /// This is mainly intended for filesystems that do not require directories such as S3.
   bool create_dir = true;
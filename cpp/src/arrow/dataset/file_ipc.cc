@@ -19,14 +19,17 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
+#include "arrow/dataset/manifest.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
@@ -124,6 +127,51 @@ static inline Result<ipc::IpcReadOptions> GetReadOptions(
   return options;
 }
 
+// The indices of the record batches of a file which may hold rows satisfying the
+// filter of a scan, according to the statistics stored in the file footer
+static inline Result<std::vector<int>> SelectRecordBatches(
+    const ipc::RecordBatchFileReader& reader, const ScanOptions& scan_options) {
+  std::vector<int> indices(reader.num_record_batches());
+  std::iota(indices.begin(), indices.end(), 0);
+  if (!ExpressionHasFieldRefs(scan_options.filter)) return indices;
+  ARROW_ASSIGN_OR_RAISE(auto statistics, reader.ReadStatistics());
+  if (statistics.empty()) return indices;
+
+  const auto& schema = *reader.schema();
+  indices.clear();
+  int64_t rows_pruned = 0;
+  for (int i = 0; i < static_cast<int>(statistics.size()); ++i) {
+    // Express the statistics the way a dataset manifest does
+    FragmentManifestEntry entry;
+    for (int field_index = 0; field_index < schema.num_fields(); ++field_index) {
+      const auto& field = schema.field(field_index);
+      const auto& batch_column = statistics[i].columns[field_index];
+      // Without bounds, only a column of nulls says anything about its values
+      if (schema.GetAllFieldIndices(field->name()).size() != 1 ||
+          (!batch_column.min && batch_column.null_count != statistics[i].num_rows)) {
+        continue;
+      }
+      FragmentColumnStatistics column;
+      column.name = field->name();
+      column.min = batch_column.min;
+      column.max = batch_column.max;
+      column.null_count = batch_column.null_count;
+      entry.statistics.push_back(std::move(column));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto simplified, SimplifyWithGuarantee(scan_options.filter,
+                                                                 entry.Guarantee()));
+    if (simplified.IsSatisfiable()) {
+      indices.push_back(i);
+    } else {
+      rows_pruned += statistics[i].num_rows;
+    }
+  }
+  if (scan_options.stats_collector) {
+    scan_options.stats_collector->RecordRowsPruned(rows_pruned);
+  }
+  return indices;
+}
+
 Result<bool> IpcFileFormat::IsSupported(const FileSource& source) const {
   RETURN_NOT_OK(source.Open().status());
   return OpenReader(source).ok();
@@ -156,8 +204,26 @@ Result<RecordBatchGenerator> IpcFileFormat::ScanBatchesAsync(
         GetFragmentScanOptions<IpcFragmentScanOptions>(kIpcTypeName, options.get(),
                                                        default_fragment_scan_options));
 
+    ARROW_ASSIGN_OR_RAISE(auto batch_indices, SelectRecordBatches(*reader, *options));
+
     RecordBatchGenerator generator;
-    if (ipc_scan_options->cache_options) {
+    if (batch_indices.size() < static_cast<size_t>(reader->num_record_batches())) {
+      // Some record batches are skipped, read the others one at a time
+      size_t next = 0;
+      auto batches = MakeFunctionIterator(
+          [reader, batch_indices,
+           next]() mutable -> Result<std::shared_ptr<RecordBatch>> {
+            if (next == batch_indices.size()) {
+              return IterationEnd<std::shared_ptr<RecordBatch>>();
+            }
+            return reader->ReadRecordBatch(batch_indices[next++]);
+          });
+      ARROW_ASSIGN_OR_RAISE(generator,
+                            MakeBackgroundGenerator(std::move(batches),
+                                                    options->io_context.executor()));
+      generator = MakeTransferredGenerator(std::move(generator),
+                                           ::arrow::internal::GetCpuThreadPool());
+    } else if (ipc_scan_options->cache_options) {
       // Transferring helps performance when coalescing
       ARROW_ASSIGN_OR_RAISE(generator, reader->GetRecordBatchGenerator(
                                            /*coalesce=*/true, options->io_context,
@@ -25,6 +25,7 @@
 #include "arrow/dataset/discovery.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/partition.h"
+#include "arrow/dataset/scanner.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/reader.h"
@@ -170,6 +171,54 @@ TEST_P(TestIpcFileFormatScan, FragmentScanOptions) {
   ASSERT_OK_AND_ASSIGN(auto batch_gen, fragment->ScanBatchesAsync(opts_));
   ASSERT_FINISHES_AND_RAISES(Invalid, CollectAsyncGenerator(batch_gen));
 }
+TEST_P(TestIpcFileFormatScan, SkipBatchesByStatistics) {
+  constexpr int64_t kNumBatches = 16;
+  constexpr int64_t kTotalNumRows = kNumBatches * (kNumBatches + 1) / 2;
+
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumBatches);
+  ASSERT_OK_AND_ASSIGN(auto batches, reader->ToRecordBatches());
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  auto write_options = ipc::IpcWriteOptions::Defaults();
+  write_options.write_statistics = true;
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       ipc::MakeFileWriter(sink, reader->schema(), write_options));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  SetSchema(reader->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+
+  auto count_rows_and_batches = [&](compute::Expression filter, int64_t expected_rows,
+                                    int64_t expected_batches) {
+    SetFilter(std::move(filter));
+    ASSERT_OK_AND_ASSIGN(auto batch_gen, fragment->ScanBatchesAsync(opts_));
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto scanned, CollectAsyncGenerator(batch_gen));
+    int64_t actual_rows = 0;
+    for (const auto& batch : scanned) {
+      actual_rows += batch->num_rows();
+    }
+    ASSERT_EQ(actual_rows, expected_rows);
+    ASSERT_EQ(static_cast<int64_t>(scanned.size()), expected_batches);
+  };
+
+  opts_->stats_collector = std::make_shared<ScanStatsCollector>();
+  // The batches keyed by 1 to 5 are skipped by their statistics
+  count_rows_and_batches(greater_equal(field_ref("i64"), literal<int64_t>(6)),
+                         kTotalNumRows - 15, kNumBatches - 5);
+  ASSERT_EQ(opts_->stats_collector->stats().rows_pruned, 15);
+
+  count_rows_and_batches(equal(field_ref("u8"), literal<uint8_t>(3)), 3, 1);
+  count_rows_and_batches(less(field_ref("i64"), literal<int64_t>(0)), 0, 0);
+  // Nested columns have no statistics
+  count_rows_and_batches(
+      equal(field_ref(FieldRef("struct", "i32")), literal<int32_t>(3)), kTotalNumRows,
+      kNumBatches);
+  count_rows_and_batches(literal(true), kTotalNumRows, kNumBatches);
+}
+
 INSTANTIATE_TEST_SUITE_P(TestScan, TestIpcFileFormatScan,
                          ::testing::ValuesIn(TestFormatParams::Values()),
                          TestFormatParams::ToTestNameString);
@@ -0,0 +1,232 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_json.h"
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/io/buffered.h"
+#include "arrow/json/chunker.h"
+#include "arrow/json/options.h"
+#include "arrow/json/parser.h"
+#include "arrow/json/reader.h"
+#include "arrow/result.h"
+#include "arrow/type.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/delimiting.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::Executor;
+
+namespace dataset {
+
+namespace {
+
+using RecordBatchGenerator = std::function<Future<std::shared_ptr<RecordBatch>>()>;
+
+// Return the names of the top-level fields found in the first block of a file
+Result<std::unordered_set<std::string>> GetFieldNames(
+    const json::ParseOptions& parse_options, util::string_view first_block,
+    int64_t block_size, MemoryPool* pool) {
+  auto block = std::make_shared<Buffer>(first_block);
+  if (static_cast<int64_t>(first_block.size()) >= block_size) {
+    // Only parse the complete objects of a truncated first block
+    std::shared_ptr<Buffer> partial;
+    RETURN_NOT_OK(json::MakeChunker(parse_options)->Process(block, &block, &partial));
+    if (block->size() == 0) {
+      return Status::Invalid(
+          "Could not read a complete JSON object from the first block, "
+          "either file is truncated or the object is larger than block size");
+    }
+  }
+
+  std::unique_ptr<json::BlockParser> parser;
+  RETURN_NOT_OK(json::BlockParser::Make(pool, parse_options, &parser));
+  RETURN_NOT_OK(parser->ReserveScalarStorage(block->size()));
+  RETURN_NOT_OK(parser->Parse(block));
+  std::shared_ptr<Array> parsed;
+  RETURN_NOT_OK(parser->Finish(&parsed));
+
+  std::unordered_set<std::string> field_names;
+  for (const auto& field : parsed->type()->fields()) {
+    field_names.insert(field->name());
+  }
+  return field_names;
+}
+
+Result<json::ParseOptions> GetParseOptions(const JsonFileFormat& format,
+                                           const ScanOptions* scan_options,
+                                           util::string_view first_block,
+                                           int64_t block_size) {
+  auto parse_options = format.parse_options;
+  if (!scan_options) return parse_options;
+
+  ARROW_ASSIGN_OR_RAISE(auto field_names,
+                        GetFieldNames(parse_options, first_block, block_size,
+                                      scan_options->pool));
+
+  // Only convert the materialized fields which appear in the file, using the
+  // dataset schema's types; anything else is skipped by the reader
+  std::vector<bool> materialized(scan_options->dataset_schema->num_fields(), false);
+  for (const auto& ref : scan_options->MaterializedFields()) {
+    ARROW_ASSIGN_OR_RAISE(auto match,
+                          ref.FindOneOrNone(*scan_options->dataset_schema));
+    if (match.empty()) continue;
+    materialized[match.indices()[0]] = true;
+  }
+
+  FieldVector fields;
+  for (int i = 0; i < scan_options->dataset_schema->num_fields(); ++i) {
+    const auto& field = scan_options->dataset_schema->field(i);
+    if (!materialized[i]) continue;
+    // Ignore virtual columns.
+    if (field_names.find(field->name()) == field_names.end()) continue;
+    fields.push_back(field);
+  }
+  parse_options.explicit_schema = schema(std::move(fields));
+  parse_options.unexpected_field_behavior = json::UnexpectedFieldBehavior::Ignore;
+  return parse_options;
+}
+
+Result<json::ReadOptions> GetReadOptions(const JsonFileFormat& format,
+                                         const ScanOptions* scan_options) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto json_scan_options,
+      GetFragmentScanOptions<JsonFragmentScanOptions>(
+          kJsonTypeName, scan_options, format.default_fragment_scan_options));
+  auto read_options = json_scan_options->read_options;
+  // Multithreaded conversion of individual files would lead to excessive thread
+  // contention when ScanTasks are also executed in multiple threads, so we disable it
+  // here.
+  read_options.use_threads = false;
+  return read_options;
+}
+
+Future<std::shared_ptr<json::StreamingReader>> OpenReaderAsync(
+    const FileSource& source, const JsonFileFormat& format,
+    const std::shared_ptr<ScanOptions>& scan_options, Executor* cpu_executor) {
+  ARROW_ASSIGN_OR_RAISE(auto read_options, GetReadOptions(format, scan_options.get()));
+
+  ARROW_ASSIGN_OR_RAISE(auto input, source.OpenCompressed());
+  const auto& path = source.path();
+  ARROW_ASSIGN_OR_RAISE(
+      input, io::BufferedInputStream::Create(read_options.block_size,
+                                             default_memory_pool(), std::move(input)));
+
+  // Grab the first block and use it to determine which fields to read.  The
+  // input->Peek call blocks so we run the whole thing on the I/O thread pool.
+  auto reader_fut = DeferNotOk(input->io_context().executor()->Submit(
+      [=]() -> Future<std::shared_ptr<json::StreamingReader>> {
+        ARROW_ASSIGN_OR_RAISE(auto first_block, input->Peek(read_options.block_size));
+        ARROW_ASSIGN_OR_RAISE(auto parse_options,
+                              GetParseOptions(format, scan_options.get(), first_block,
+                                              read_options.block_size));
+        return json::StreamingReader::MakeAsync(io::default_io_context(),
+                                                std::move(input), cpu_executor,
+                                                read_options, parse_options);
+      }));
+  return reader_fut.Then(
+      [](const std::shared_ptr<json::StreamingReader>& reader) { return reader; },
+      // Adds the filename to the error
+      [=](const Status& err) -> Result<std::shared_ptr<json::StreamingReader>> {
+        return err.WithMessage("Could not open JSON input source '", path, "': ", err);
+      });
+}
+
+Result<std::shared_ptr<json::StreamingReader>> OpenReader(
+    const FileSource& source, const JsonFileFormat& format,
+    const std::shared_ptr<ScanOptions>& scan_options = nullptr) {
+  auto open_reader_fut = OpenReaderAsync(source, format, scan_options,
+                                         ::arrow::internal::GetCpuThreadPool());
+  return open_reader_fut.result();
+}
+
+RecordBatchGenerator GeneratorFromReader(
+    const Future<std::shared_ptr<json::StreamingReader>>& reader, int64_t batch_size) {
+  auto gen_fut = reader.Then(
+      [batch_size](
+          const std::shared_ptr<json::StreamingReader>& reader) -> RecordBatchGenerator {
+        auto batch_gen = [reader]() { return reader->ReadNextAsync(); };
+        return MakeChunkedBatchGenerator(std::move(batch_gen), batch_size);
+      });
+  return MakeFromFuture(std::move(gen_fut));
+}
+
+}  // namespace
+
+bool JsonFileFormat::Equals(const FileFormat& format) const {
+  if (type_name() != format.type_name()) return false;
+
+  const auto& other_parse_options =
+      checked_cast<const JsonFileFormat&>(format).parse_options;
+
+  auto schemas_equal = [](const std::shared_ptr<Schema>& left,
+                          const std::shared_ptr<Schema>& right) {
+    if (left == nullptr || right == nullptr) return left == right;
+    return left->Equals(*right);
+  };
+
+  return schemas_equal(parse_options.explicit_schema,
+                       other_parse_options.explicit_schema) &&
+         parse_options.newlines_in_values == other_parse_options.newlines_in_values &&
+         parse_options.unexpected_field_behavior ==
+             other_parse_options.unexpected_field_behavior;
+}
+
+Result<bool> JsonFileFormat::IsSupported(const FileSource& source) const {
+  RETURN_NOT_OK(source.Open().status());
+  return OpenReader(source, *this).ok();
+}
+
+Result<std::shared_ptr<Schema>> JsonFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, *this));
+  return reader->schema();
+}
+
+Result<RecordBatchGenerator> JsonFileFormat::ScanBatchesAsync(
+    const std::shared_ptr<ScanOptions>& scan_options,
+    const std::shared_ptr<FileFragment>& file) const {
+  auto source = file->source();
+  auto reader_fut =
+      OpenReaderAsync(source, *this, scan_options, ::arrow::internal::GetCpuThreadPool());
+  return GeneratorFromReader(std::move(reader_fut), scan_options->batch_size);
+}
+
+std::shared_ptr<FileWriteOptions> JsonFileFormat::DefaultWriteOptions() {
+  // There is no JSON writer
+  return nullptr;
+}
+
+Result<std::shared_ptr<FileWriter>> JsonFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+    std::shared_ptr<FileWriteOptions> options,
+    fs::FileLocator destination_locator) const {
+  return Status::NotImplemented("JSON writer not yet implemented.");
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_json.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+
+namespace arrow {
+namespace dataset {
+
+class JsonFormatHelper {
+ public:
+  using FormatType = JsonFileFormat;
+
+  // Write one JSON object per line
+  static Result<std::shared_ptr<Buffer>> Write(RecordBatchReader* reader) {
+    ARROW_ASSIGN_OR_RAISE(auto table, reader->ToTable());
+    std::string json;
+    for (int64_t row = 0; row < table->num_rows(); ++row) {
+      json += "{";
+      for (int i = 0; i < table->num_columns(); ++i) {
+        if (i > 0) json += ",";
+        json += "\"" + table->field(i)->name() + "\":";
+        ARROW_ASSIGN_OR_RAISE(auto scalar, table->column(i)->GetScalar(row));
+        json += FormatScalar(*scalar);
+      }
+      json += "}\n";
+    }
+    return Buffer::FromString(std::move(json));
+  }
+
+  static std::shared_ptr<JsonFileFormat> MakeFormat() {
+    return std::make_shared<JsonFileFormat>();
+  }
+
+ private:
+  static std::string FormatScalar(const Scalar& scalar) {
+    if (!scalar.is_valid) return "null";
+    auto repr = scalar.ToString();
+    if (is_base_binary_like(scalar.type->id())) return "\"" + repr + "\"";
+    if (is_floating(scalar.type->id()) &&
+        repr.find_first_of(".eE") == std::string::npos) {
+      // Keep floating point values from being inferred as integers
+      repr += ".0";
+    }
+    return repr;
+  }
+};
+
+class TestJsonFileFormat : public FileFormatFixtureMixin<JsonFormatHelper> {};
+
+TEST_F(TestJsonFileFormat, InspectFailureWithRelevantError) {
+  TestInspectFailureWithRelevantError(StatusCode::Invalid, "JSON");
+}
+TEST_F(TestJsonFileFormat, Inspect) { TestInspect(); }
+TEST_F(TestJsonFileFormat, IsSupported) { TestIsSupported(); }
+
+TEST_F(TestJsonFileFormat, InspectWithCustomParseOptions) {
+  auto source = FileSource(Buffer::FromString(R"({"a": 1, "b": "x"}
+{"a": 2, "b": "y"}
+)"));
+  format_->parse_options.explicit_schema = schema({field("a", float64())});
+  format_->parse_options.unexpected_field_behavior =
+      json::UnexpectedFieldBehavior::Ignore;
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(source));
+  AssertSchemaEqual(*actual, Schema({field("a", float64())}), /*check_metadata=*/false);
+}
+
+TEST_F(TestJsonFileFormat, Equals) {
+  auto other = JsonFormatHelper::MakeFormat();
+  ASSERT_TRUE(format_->Equals(*other));
+  other->parse_options.newlines_in_values = true;
+  ASSERT_FALSE(format_->Equals(*other));
+  other = JsonFormatHelper::MakeFormat();
+  other->parse_options.explicit_schema = schema({field("a", int64())});
+  ASSERT_FALSE(format_->Equals(*other));
+}
+
+// TODO add TestJsonFileSystemDataset if write support is added
+
+class TestJsonFileFormatScan : public FileFormatScanMixin<JsonFormatHelper> {};
+
+TEST_P(TestJsonFileFormatScan, ScanRecordBatchReader) { TestScan(); }
+TEST_P(TestJsonFileFormatScan, ScanBatchSize) { TestScanBatchSize(); }
+TEST_P(TestJsonFileFormatScan, ScanRecordBatchReaderProjected) { TestScanProjected(); }
+TEST_P(TestJsonFileFormatScan, ScanRecordBatchReaderProjectedMissingCols) {
+  TestScanProjectedMissingCols();
+}
+TEST_P(TestJsonFileFormatScan, ScanRecordBatchReaderWithVirtualColumn) {
+  TestScanWithVirtualColumn();
+}
+TEST_P(TestJsonFileFormatScan, ScanRecordBatchReaderWithDuplicateColumnError) {
+  TestScanWithDuplicateColumnError();
+}
+TEST_P(TestJsonFileFormatScan, ScanWithPushdownNulls) { TestScanWithPushdownNulls(); }
+INSTANTIATE_TEST_SUITE_P(TestScan, TestJsonFileFormatScan,
+                         ::testing::ValuesIn(TestFormatParams::Values()),
+                         TestFormatParams::ToTestNameString);
+
+}  // namespace dataset
+}  // namespace arrow
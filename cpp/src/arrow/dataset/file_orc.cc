@@ -17,15 +17,22 @@
 
 #include "arrow/dataset/file_orc.h"
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "arrow/adapters/orc/adapter.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/exec/expression.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/scalar.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
-#include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/thread_pool.h"
 
@@ -58,87 +65,101 @@ Result<std::unique_ptr<arrow::adapters::orc::ORCFileReader>> OpenORCReader(
   return reader;
 }
 
-/// \brief A ScanTask backed by an ORC file.
-class OrcScanTask {
- public:
-  OrcScanTask(std::shared_ptr<FileFragment> fragment,
-              std::shared_ptr<ScanOptions> options)
-      : fragment_(std::move(fragment)), options_(std::move(options)) {}
-
-  Result<RecordBatchIterator> Execute() {
-    struct Impl {
-      static Result<RecordBatchIterator> Make(const FileSource& source,
-                                              const FileFormat& format,
-                                              const ScanOptions& scan_options) {
-        ARROW_ASSIGN_OR_RAISE(
-            auto reader,
-            OpenORCReader(source, std::make_shared<ScanOptions>(scan_options)));
-
-        auto materialized_fields = scan_options.MaterializedFields();
-        // filter out virtual columns
-        std::vector<std::string> included_fields;
-        ARROW_ASSIGN_OR_RAISE(auto schema, reader->ReadSchema());
-        for (const auto& ref : materialized_fields) {
-          ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*schema));
-          if (match.indices().empty()) continue;
-
-          included_fields.push_back(schema->field(match.indices()[0])->name());
-        }
-
-        std::shared_ptr<RecordBatchReader> record_batch_reader;
-        ARROW_ASSIGN_OR_RAISE(
-            record_batch_reader,
-            reader->GetRecordBatchReader(scan_options.batch_size, included_fields));
-
-        return RecordBatchIterator(Impl{std::move(record_batch_reader)});
-      }
-
-      Result<std::shared_ptr<RecordBatch>> Next() {
-        std::shared_ptr<RecordBatch> batch;
-        RETURN_NOT_OK(record_batch_reader_->ReadNext(&batch));
-        return batch;
-      }
-
-      std::shared_ptr<RecordBatchReader> record_batch_reader_;
-    };
-
-    return Impl::Make(fragment_->source(),
-                      *checked_pointer_cast<FileFragment>(fragment_)->format(),
-                      *options_);
+// ORC selects the children of structs by their dot separated path, so that only
+// the referenced children are read.  Other nested fields are read entirely.
+std::string IncludedName(const Schema& schema, const FieldPath& path) {
+  const Field* field = schema.field(path.indices()[0]).get();
+  std::string name = field->name();
+  for (size_t i = 1; i < path.indices().size(); ++i) {
+    if (field->type()->id() != Type::STRUCT) break;
+    field = field->type()->field(path.indices()[i]).get();
+    if (field->name().find('.') != std::string::npos ||
+        name.find('.') != std::string::npos) {
+      // The path would be ambiguous
+      return schema.field(path.indices()[0])->name();
+    }
+    name += "." + field->name();
   }
+  return name;
+}
 
- private:
-  std::shared_ptr<FileFragment> fragment_;
-  std::shared_ptr<ScanOptions> options_;
-};
+// An expression which is true for every row of a stripe, given the statistics of a
+// field in the stripe
+util::optional<compute::Expression> StatisticsAsExpression(
+    const Field& field, const adapters::orc::ColumnStatistics& statistics) {
+  auto field_expr = compute::field_ref(field.name());
 
-class OrcScanTaskIterator {
- public:
-  static Result<Iterator<std::shared_ptr<OrcScanTask>>> Make(
-      std::shared_ptr<ScanOptions> options, std::shared_ptr<FileFragment> fragment) {
-    return Iterator<std::shared_ptr<OrcScanTask>>(
-        OrcScanTaskIterator(std::move(options), std::move(fragment)));
+  // Optimize for corner case where all values are nulls
+  if (statistics.num_values == 0 && statistics.has_null) {
+    return compute::is_null(std::move(field_expr));
+  }
+  if (statistics.min == nullptr || statistics.max == nullptr) {
+    return util::nullopt;
   }
 
-  Result<std::shared_ptr<OrcScanTask>> Next() {
-    if (once_) {
-      // Iteration is done.
-      return nullptr;
-    }
+  auto maybe_min = statistics.min->CastTo(field.type());
+  auto maybe_max = statistics.max->CastTo(field.type());
+  if (!maybe_min.ok() || !maybe_max.ok()) {
+    return util::nullopt;
+  }
+  auto lower_bound =
+      compute::greater_equal(field_expr, compute::literal(maybe_min.MoveValueUnsafe()));
+  auto upper_bound =
+      compute::less_equal(field_expr, compute::literal(maybe_max.MoveValueUnsafe()));
+  auto in_range = compute::and_(std::move(lower_bound), std::move(upper_bound));
+  if (statistics.has_null) {
+    return compute::or_(std::move(in_range), compute::is_null(std::move(field_expr)));
+  }
+  return in_range;
+}
+
+// What a scan reads from an ORC file, decided once its footer has been read
+struct OrcScanPlan {
+  std::vector<std::string> included_fields;
+  std::vector<int64_t> stripes;
+  int64_t rows_per_stripe;
+};
 
-    once_ = true;
-    return std::make_shared<OrcScanTask>(fragment_, options_);
+// Select the fields to read and the stripes which may satisfy the filter
+Result<OrcScanPlan> MakeScanPlan(arrow::adapters::orc::ORCFileReader* reader,
+                                 const ScanOptions& scan_options) {
+  OrcScanPlan plan;
+  ARROW_ASSIGN_OR_RAISE(auto schema, reader->ReadSchema());
+  for (const auto& ref : scan_options.MaterializedFields()) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*schema));
+    // filter out virtual columns
+    if (match.indices().empty()) continue;
+
+    plan.included_fields.push_back(IncludedName(*schema, match));
   }
 
- private:
-  OrcScanTaskIterator(std::shared_ptr<ScanOptions> options,
-                      std::shared_ptr<FileFragment> fragment)
-      : options_(std::move(options)), fragment_(std::move(fragment)) {}
+  // Only top-level fields which the filter references have their statistics read
+  std::vector<int> filter_fields;
+  for (const auto& ref : compute::FieldsInExpression(scan_options.filter)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*schema));
+    if (match.indices().size() != 1) continue;
+    filter_fields.push_back(match.indices()[0]);
+  }
 
-  bool once_ = false;
-  std::shared_ptr<ScanOptions> options_;
-  std::shared_ptr<FileFragment> fragment_;
-};
+  const int64_t num_stripes = reader->NumberOfStripes();
+  plan.rows_per_stripe =
+      num_stripes == 0 ? 0 : bit_util::CeilDiv(reader->NumberOfRows(), num_stripes);
+  for (int64_t stripe = 0; stripe < num_stripes; ++stripe) {
+    auto predicate = scan_options.filter;
+    for (int field_index : filter_fields) {
+      ARROW_ASSIGN_OR_RAISE(auto statistics,
+                            reader->GetStripeColumnStatistics(stripe, field_index));
+      auto guarantee = StatisticsAsExpression(*schema->field(field_index), statistics);
+      if (!guarantee) continue;
+      ARROW_ASSIGN_OR_RAISE(predicate,
+                            SimplifyWithGuarantee(std::move(predicate), *guarantee));
+    }
+    if (predicate.IsSatisfiable()) {
+      plan.stripes.push_back(stripe);
+    }
+  }
+  return plan;
+}
 
 }  // namespace
 
@@ -155,45 +176,52 @@ Result<std::shared_ptr<Schema>> OrcFileFormat::Inspect(const FileSource& source)
 Result<RecordBatchGenerator> OrcFileFormat::ScanBatchesAsync(
     const std::shared_ptr<ScanOptions>& options,
     const std::shared_ptr<FileFragment>& file) const {
-  // TODO investigate "true" async version
-  // (https://issues.apache.org/jira/browse/ARROW-13795)
-  ARROW_ASSIGN_OR_RAISE(auto task_iter, OrcScanTaskIterator::Make(options, file));
-  struct IterState {
-    Iterator<std::shared_ptr<OrcScanTask>> iter;
-    RecordBatchIterator curr_iter;
-    bool first;
-    ::arrow::internal::Executor* io_executor;
-  };
-  struct {
-    Future<std::shared_ptr<RecordBatch>> operator()() {
-      auto state = state_;
-      return ::arrow::DeferNotOk(
-          state->io_executor->Submit([state]() -> Result<std::shared_ptr<RecordBatch>> {
-            if (state->first) {
-              ARROW_ASSIGN_OR_RAISE(auto task, state->iter.Next());
-              ARROW_ASSIGN_OR_RAISE(state->curr_iter, task->Execute());
-              state->first = false;
-            }
-            while (!IsIterationEnd(state->curr_iter)) {
-              ARROW_ASSIGN_OR_RAISE(auto next_batch, state->curr_iter.Next());
-              if (IsIterationEnd(next_batch)) {
-                ARROW_ASSIGN_OR_RAISE(auto task, state->iter.Next());
-                if (IsIterationEnd(task)) {
-                  state->curr_iter = IterationEnd<RecordBatchIterator>();
-                } else {
-                  ARROW_ASSIGN_OR_RAISE(state->curr_iter, task->Execute());
-                }
-              } else {
-                return next_batch;
-              }
-            }
-            return IterationEnd<std::shared_ptr<RecordBatch>>();
+  auto source = file->source();
+  auto io_executor = options->io_context.executor();
+
+  // Reading the footer and the stripe statistics blocks, so it is done on the I/O pool
+  auto plan_fut = DeferNotOk(
+      io_executor->Submit([source, options]() -> Result<OrcScanPlan> {
+        ARROW_ASSIGN_OR_RAISE(auto reader, OpenORCReader(source, options));
+        return MakeScanPlan(reader.get(), *options);
+      }));
+
+  auto gen_fut = plan_fut.Then([source, options, io_executor](
+                                   const OrcScanPlan& plan) -> RecordBatchGenerator {
+    // Each stripe is read and decoded with its own reader, so that several stripes
+    // are decoded at once without sharing liborc state between threads
+    auto included_fields = plan.included_fields;
+    auto read_stripe = [source, options, io_executor,
+                        included_fields](const int64_t& stripe) {
+      return DeferNotOk(
+          io_executor->Submit([source, options, included_fields,
+                               stripe]() -> Result<RecordBatchGenerator> {
+            ARROW_ASSIGN_OR_RAISE(auto reader, OpenORCReader(source, options));
+            ARROW_ASSIGN_OR_RAISE(auto stripe_reader,
+                                  reader->GetStripeReader(stripe, options->batch_size,
+                                                          included_fields));
+            ARROW_ASSIGN_OR_RAISE(auto batches, stripe_reader->ToRecordBatches());
+            return MakeVectorGenerator(std::move(batches));
           }));
+    };
+    auto stripe_gen = MakeMappedGenerator(MakeVectorGenerator(plan.stripes),
+                                          std::move(read_stripe));
+
+    // Read ahead as many stripes as it takes to cover the rows Parquet would read
+    // ahead with the same options
+    int64_t rows_to_readahead =
+        static_cast<int64_t>(options->batch_readahead) * options->batch_size;
+    int stripe_readahead = 1;
+    if (plan.rows_per_stripe > 0) {
+      stripe_readahead = static_cast<int>(std::max<int64_t>(
+          1, std::min<int64_t>(bit_util::CeilDiv(rows_to_readahead, plan.rows_per_stripe),
+                               options->batch_readahead)));
     }
-    std::shared_ptr<IterState> state_;
-  } iter_to_gen{std::shared_ptr<IterState>(
-      new IterState{std::move(task_iter), {}, true, options->io_context.executor()})};
-  return iter_to_gen;
+    stripe_gen = MakeReadaheadGenerator(std::move(stripe_gen), stripe_readahead);
+
+    return MakeConcatenatedGenerator(std::move(stripe_gen));
+  });
+  return MakeFromFuture(std::move(gen_fut));
 }
 
 Future<util::optional<int64_t>> OrcFileFormat::CountRows(
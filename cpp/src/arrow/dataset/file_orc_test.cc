@@ -21,6 +21,7 @@
 #include <utility>
 
 #include "arrow/adapters/orc/adapter.h"
+#include "arrow/builder.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/discovery.h"
 #include "arrow/dataset/file_base.h"
@@ -30,6 +31,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 
 namespace arrow {
@@ -63,6 +65,59 @@ TEST_F(TestOrcFileFormat, Inspect) { TestInspect(); }
 TEST_F(TestOrcFileFormat, IsSupported) { TestIsSupported(); }
 TEST_F(TestOrcFileFormat, CountRows) { TestCountRows(); }
 
+TEST_F(TestOrcFileFormat, SkipStripesUsingStatistics) {
+  // Consecutive values in stripes of 1000 rows, padded with random doubles so
+  // that each written batch fills a stripe
+  constexpr int64_t kNumRows = 10000;
+  auto table_schema = schema({field("i64", int64()), field("f64", float64())});
+  auto i64 = ArrayFromJSON(int64(), "[]");
+  {
+    Int64Builder builder;
+    for (int64_t i = 0; i < kNumRows; ++i) ASSERT_OK(builder.Append(i));
+    ASSERT_OK(builder.Finish(&i64));
+  }
+  random::RandomArrayGenerator rng(/*seed=*/0);
+  auto table = Table::Make(table_schema, {i64, rng.Float64(kNumRows, 0, 1)});
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  adapters::orc::WriteOptions write_options;
+  write_options.batch_size = 1000;
+  write_options.stripe_size = 1024;
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       adapters::orc::ORCFileWriter::Open(sink.get(), write_options));
+  ASSERT_OK(writer->Write(*table));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       adapters::orc::ORCFileReader::Open(
+                           std::make_shared<io::BufferReader>(buffer),
+                           default_memory_pool()));
+  ASSERT_GT(reader->NumberOfStripes(), 1);
+
+  auto CountRows = [&](compute::Expression filter) {
+    SetSchema(table_schema->fields());
+    SetFilter(std::move(filter));
+    auto fragment = MakeFragment(FileSource(buffer));
+    EXPECT_OK_AND_ASSIGN(auto batch_gen, fragment->ScanBatchesAsync(opts_));
+    int64_t num_rows = 0;
+    for (auto maybe_batch : MakeGeneratorIterator(std::move(batch_gen))) {
+      EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      num_rows += batch->num_rows();
+    }
+    return num_rows;
+  };
+
+  // The fragment doesn't filter rows itself, so the rows of every stripe which
+  // may match are returned
+  ASSERT_EQ(CountRows(literal(true)), kNumRows);
+  auto num_rows = CountRows(less(field_ref("i64"), literal(int64_t{10})));
+  ASSERT_GE(num_rows, 10);
+  ASSERT_LT(num_rows, kNumRows);
+  ASSERT_EQ(CountRows(greater(field_ref("i64"), literal(kNumRows))), 0);
+  ASSERT_EQ(CountRows(greater(field_ref("f64"), literal(2.0))), 0);
+}
+
 // TODO add TestOrcFileSystemDataset if write support is added
 
 class TestOrcFileFormatScan : public FileFormatScanMixin<OrcFormatHelper> {};
@@ -71,7 +126,7 @@ TEST_P(TestOrcFileFormatScan, ScanRecordBatchReader) { TestScan(); }
 TEST_P(TestOrcFileFormatScan, ScanBatchSize) { TestScanBatchSize(); }
 TEST_P(TestOrcFileFormatScan, ScanRecordBatchReaderProjected) { TestScanProjected(); }
 TEST_P(TestOrcFileFormatScan, ScanRecordBatchReaderProjectedNested) {
-  TestScanProjectedNested();
+  TestScanProjectedNested(/*fine_grained_selection=*/true);
 }
 TEST_P(TestOrcFileFormatScan, ScanRecordBatchReaderProjectedMissingCols) {
   TestScanProjectedMissingCols();
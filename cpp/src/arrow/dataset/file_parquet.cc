@@ -17,13 +17,17 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/compute/api_scalar.h"
 #include "arrow/compute/exec.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/scanner.h"
@@ -38,7 +42,11 @@
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/bloom_filter_reader.h"
 #include "parquet/file_reader.h"
+#include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 
@@ -76,6 +84,26 @@ parquet::ReaderProperties MakeReaderProperties(
   return properties;
 }
 
+// The key of a file in ParquetFragmentScanOptions::metadata_cache, or an empty
+// string if its metadata must not be cached.
+std::string MetadataCacheKey(const FileSource& source,
+                             const ParquetFragmentScanOptions& parquet_scan_options) {
+  if (parquet_scan_options.metadata_cache == nullptr || source.filesystem() == nullptr) {
+    return "";
+  }
+  // The decryption state is set up when parsing the footer
+  if (parquet_scan_options.reader_properties->file_decryption_properties() != nullptr) {
+    return "";
+  }
+  const fs::FileInfo& info = source.file_info();
+  if (info.size() == fs::kNoSize || info.mtime() == fs::kNoTime) {
+    return "";
+  }
+  return source.filesystem()->type_name() + "://" + info.path() + ":" +
+         std::to_string(info.size()) + ":" +
+         std::to_string(info.mtime().time_since_epoch().count());
+}
+
 parquet::ArrowReaderProperties MakeArrowReaderProperties(
     const ParquetFileFormat& format, const parquet::FileMetaData& metadata) {
   parquet::ArrowReaderProperties properties(/* use_threads = */ false);
@@ -98,39 +126,22 @@ Result<std::shared_ptr<SchemaManifest>> GetSchemaManifest(
   return manifest;
 }
 
-util::optional<compute::Expression> ColumnChunkStatisticsAsExpression(
-    const SchemaField& schema_field, const parquet::RowGroupMetaData& metadata) {
-  // For the remaining of this function, failure to extract/parse statistics
-  // are ignored by returning nullptr. The goal is two fold. First
-  // avoid an optimization which breaks the computation. Second, allow the
-  // following columns to maybe succeed in extracting column statistics.
-
-  // For now, only leaf (primitive) types are supported.
-  if (!schema_field.is_leaf()) {
-    return util::nullopt;
-  }
-
-  auto column_metadata = metadata.ColumnChunk(schema_field.column_index);
-  auto statistics = column_metadata->statistics();
-  if (statistics == nullptr) {
-    return util::nullopt;
-  }
-
-  const auto& field = schema_field.field;
-  auto field_expr = compute::field_ref(field->name());
+util::optional<compute::Expression> StatisticsAsExpression(
+    const Field& field, const parquet::Statistics& statistics) {
+  auto field_expr = compute::field_ref(field.name());
 
   // Optimize for corner case where all values are nulls
-  if (statistics->num_values() == 0 && statistics->null_count() > 0) {
+  if (statistics.num_values() == 0 && statistics.null_count() > 0) {
     return is_null(std::move(field_expr));
   }
 
   std::shared_ptr<Scalar> min, max;
-  if (!StatisticsAsScalars(*statistics, &min, &max).ok()) {
+  if (!StatisticsAsScalars(statistics, &min, &max).ok()) {
     return util::nullopt;
   }
 
-  auto maybe_min = min->CastTo(field->type());
-  auto maybe_max = max->CastTo(field->type());
+  auto maybe_min = min->CastTo(field.type());
+  auto maybe_max = max->CastTo(field.type());
   if (maybe_min.ok() && maybe_max.ok()) {
     min = maybe_min.MoveValueUnsafe();
     max = maybe_max.MoveValueUnsafe();
@@ -138,7 +149,7 @@ util::optional<compute::Expression> ColumnChunkStatisticsAsExpression(
     if (min->Equals(max)) {
       auto single_value = compute::equal(field_expr, compute::literal(std::move(min)));
 
-      if (statistics->null_count() == 0) {
+      if (statistics.null_count() == 0) {
         return single_value;
       }
       return compute::or_(std::move(single_value), is_null(std::move(field_expr)));
@@ -149,7 +160,7 @@ util::optional<compute::Expression> ColumnChunkStatisticsAsExpression(
     auto upper_bound = compute::less_equal(field_expr, compute::literal(std::move(max)));
 
     auto in_range = compute::and_(std::move(lower_bound), std::move(upper_bound));
-    if (statistics->null_count() != 0) {
+    if (statistics.null_count() != 0) {
       return compute::or_(std::move(in_range), compute::is_null(field_expr));
     }
     return in_range;
@@ -158,6 +169,309 @@ util::optional<compute::Expression> ColumnChunkStatisticsAsExpression(
   return util::nullopt;
 }
 
+util::optional<compute::Expression> ColumnChunkStatisticsAsExpression(
+    const SchemaField& schema_field, const parquet::RowGroupMetaData& metadata) {
+  // For the remaining of this function, failure to extract/parse statistics
+  // are ignored by returning nullptr. The goal is two fold. First
+  // avoid an optimization which breaks the computation. Second, allow the
+  // following columns to maybe succeed in extracting column statistics.
+
+  // For now, only leaf (primitive) types are supported.
+  if (!schema_field.is_leaf()) {
+    return util::nullopt;
+  }
+
+  auto column_metadata = metadata.ColumnChunk(schema_field.column_index);
+  auto statistics = column_metadata->statistics();
+  if (statistics == nullptr) {
+    return util::nullopt;
+  }
+
+  return StatisticsAsExpression(*schema_field.field, *statistics);
+}
+
+// Whether the ColumnIndex of a column chunk proves that none of its pages, and
+// hence no row of the row group, can satisfy the predicate.
+Result<bool> PagesExcludePredicate(const compute::Expression& predicate,
+                                   const SchemaField& schema_field,
+                                   const parquet::ColumnDescriptor* descr,
+                                   const parquet::ColumnIndex& column_index,
+                                   const Schema& physical_schema) {
+  const auto& field = *schema_field.field;
+  for (int i = 0; i < column_index.num_pages(); ++i) {
+    compute::Expression page_expr;
+    if (column_index.null_pages()[i]) {
+      page_expr = compute::is_null(compute::field_ref(field.name()));
+    } else {
+      // Conservatively assume nulls when their count is unknown
+      const int64_t null_count =
+          column_index.has_null_counts() ? column_index.null_counts()[i] : 1;
+      auto statistics = parquet::Statistics::Make(
+          descr, column_index.encoded_min_values()[i],
+          column_index.encoded_max_values()[i], /*num_values=*/1, null_count,
+          /*distinct_count=*/0, /*has_min_max=*/true, /*has_null_count=*/true,
+          /*has_distinct_count=*/false);
+      auto maybe_page_expr = StatisticsAsExpression(field, *statistics);
+      if (!maybe_page_expr) return false;
+      page_expr = std::move(*maybe_page_expr);
+    }
+    ARROW_ASSIGN_OR_RAISE(page_expr, page_expr.Bind(physical_schema));
+    ARROW_ASSIGN_OR_RAISE(auto page_predicate,
+                          SimplifyWithGuarantee(predicate, page_expr));
+    if (page_predicate.IsSatisfiable()) return false;
+  }
+  return true;
+}
+
+// Drop the row groups for which the page index of a column referenced by the
+// predicate shows that no page can hold a matching row. This refines the
+// column chunk statistics, which span values of all pages.
+Result<std::vector<int>> FilterRowGroupsWithPageIndex(
+    const parquet::arrow::FileReader& reader, const Schema& physical_schema,
+    const compute::Expression& predicate, std::vector<int> row_groups) {
+  std::vector<const SchemaField*> schema_fields;
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(physical_schema));
+    if (match.empty()) continue;
+    const SchemaField& schema_field = reader.manifest().schema_fields[match[0]];
+    // For now, only leaf (primitive) types are supported.
+    if (schema_field.is_leaf()) schema_fields.push_back(&schema_field);
+  }
+  if (schema_fields.empty()) return row_groups;
+
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  auto page_index_reader = reader.parquet_reader()->GetPageIndexReader();
+  if (page_index_reader == nullptr) return row_groups;
+  const parquet::SchemaDescriptor* schema =
+      reader.parquet_reader()->metadata()->schema();
+
+  std::vector<int> filtered;
+  for (int row_group : row_groups) {
+    auto row_group_index_reader = page_index_reader->RowGroup(row_group);
+    bool excluded = false;
+    if (row_group_index_reader != nullptr) {
+      for (const SchemaField* schema_field : schema_fields) {
+        auto column_index =
+            row_group_index_reader->GetColumnIndex(schema_field->column_index);
+        if (column_index == nullptr) continue;
+        ARROW_ASSIGN_OR_RAISE(
+            excluded,
+            PagesExcludePredicate(predicate, *schema_field,
+                                  schema->Column(schema_field->column_index),
+                                  *column_index, physical_schema));
+        if (excluded) break;
+      }
+    }
+    if (!excluded) filtered.push_back(row_group);
+  }
+  return filtered;
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
+// A constraint of the predicate which Bloom filters can refute: rows may only
+// match if the column holds one of the values.
+struct BloomFilterProbe {
+  const SchemaField* schema_field;
+  ScalarVector values;
+};
+
+template <typename T>
+util::optional<uint64_t> HashIntegerForBloomFilter(const parquet::BloomFilter& filter,
+                                                   const parquet::ColumnDescriptor& descr,
+                                                   T value) {
+  // Like the writer, store integers in INT32 or INT64, reinterpreting unsigned ones
+  switch (descr.physical_type()) {
+    case parquet::Type::INT32:
+      return filter.Hash(static_cast<int32_t>(value));
+    case parquet::Type::INT64:
+      return filter.Hash(static_cast<int64_t>(value));
+    default:
+      return util::nullopt;
+  }
+}
+
+// Hash a value the way it was inserted in the Bloom filter of the column, that is
+// its plain encoding. Returns nullopt for values which can't be looked up.
+util::optional<uint64_t> HashForBloomFilter(const parquet::BloomFilter& filter,
+                                            const parquet::ColumnDescriptor& descr,
+                                            const Scalar& value) {
+  if (!value.is_valid) return util::nullopt;
+  switch (value.type->id()) {
+    case Type::INT8:
+      return HashIntegerForBloomFilter(filter, descr,
+                                       checked_cast<const Int8Scalar&>(value).value);
+    case Type::INT16:
+      return HashIntegerForBloomFilter(filter, descr,
+                                       checked_cast<const Int16Scalar&>(value).value);
+    case Type::INT32:
+      return HashIntegerForBloomFilter(filter, descr,
+                                       checked_cast<const Int32Scalar&>(value).value);
+    case Type::INT64:
+      return HashIntegerForBloomFilter(filter, descr,
+                                       checked_cast<const Int64Scalar&>(value).value);
+    case Type::UINT8:
+      return HashIntegerForBloomFilter(filter, descr,
+                                       checked_cast<const UInt8Scalar&>(value).value);
+    case Type::UINT16:
+      return HashIntegerForBloomFilter(filter, descr,
+                                       checked_cast<const UInt16Scalar&>(value).value);
+    case Type::UINT32:
+      return HashIntegerForBloomFilter(filter, descr,
+                                       checked_cast<const UInt32Scalar&>(value).value);
+    case Type::UINT64:
+      return HashIntegerForBloomFilter(filter, descr,
+                                       checked_cast<const UInt64Scalar&>(value).value);
+    case Type::DATE32:
+      return HashIntegerForBloomFilter(filter, descr,
+                                       checked_cast<const Date32Scalar&>(value).value);
+    case Type::FLOAT: {
+      const float v = checked_cast<const FloatScalar&>(value).value;
+      // -0.0 equals 0.0 but hashes differently, and NaN never equals anything
+      if (v == 0 || std::isnan(v) || descr.physical_type() != parquet::Type::FLOAT) {
+        return util::nullopt;
+      }
+      return filter.Hash(v);
+    }
+    case Type::DOUBLE: {
+      const double v = checked_cast<const DoubleScalar&>(value).value;
+      if (v == 0 || std::isnan(v) || descr.physical_type() != parquet::Type::DOUBLE) {
+        return util::nullopt;
+      }
+      return filter.Hash(v);
+    }
+    case Type::STRING:
+    case Type::BINARY:
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY: {
+      if (descr.physical_type() != parquet::Type::BYTE_ARRAY) return util::nullopt;
+      const auto& buffer = *checked_cast<const BaseBinaryScalar&>(value).value;
+      const parquet::ByteArray byte_array(static_cast<uint32_t>(buffer.size()),
+                                          buffer.data());
+      return filter.Hash(&byte_array);
+    }
+    case Type::FIXED_SIZE_BINARY: {
+      if (descr.physical_type() != parquet::Type::FIXED_LEN_BYTE_ARRAY) {
+        return util::nullopt;
+      }
+      const auto& buffer = *checked_cast<const BaseBinaryScalar&>(value).value;
+      const parquet::FLBA flba(buffer.data());
+      return filter.Hash(&flba, static_cast<uint32_t>(descr.type_length()));
+    }
+    default:
+      return util::nullopt;
+  }
+}
+
+// Collect the equal and is_in constraints among the conjunction members of the
+// predicate, on leaf columns of the file
+Status CollectBloomFilterProbes(const compute::Expression& expr,
+                                const parquet::arrow::SchemaManifest& manifest,
+                                const Schema& physical_schema,
+                                std::vector<BloomFilterProbe>* probes) {
+  const compute::Expression::Call* call = expr.call();
+  if (call == nullptr) return Status::OK();
+
+  if (call->function_name == "and_kleene" || call->function_name == "and") {
+    for (const auto& argument : call->arguments) {
+      RETURN_NOT_OK(
+          CollectBloomFilterProbes(argument, manifest, physical_schema, probes));
+    }
+    return Status::OK();
+  }
+
+  const FieldRef* ref = nullptr;
+  ScalarVector values;
+  if (call->function_name == "equal" && call->arguments.size() == 2) {
+    for (int i = 0; i < 2; ++i) {
+      const auto* literal = call->arguments[1 - i].literal();
+      if (call->arguments[i].field_ref() && literal && literal->is_scalar()) {
+        ref = call->arguments[i].field_ref();
+        values.push_back(literal->scalar());
+        break;
+      }
+    }
+  } else if (call->function_name == "is_in" && call->arguments.size() == 1) {
+    ref = call->arguments[0].field_ref();
+    const auto* options =
+        checked_cast<const compute::SetLookupOptions*>(call->options.get());
+    if (ref == nullptr || options == nullptr || !options->value_set.is_array()) {
+      return Status::OK();
+    }
+    auto value_set = options->value_set.make_array();
+    // Bloom filters hold no nulls, which is_in may match
+    if (value_set->null_count() > 0) return Status::OK();
+    for (int64_t i = 0; i < value_set->length(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto value, value_set->GetScalar(i));
+      values.push_back(std::move(value));
+    }
+  }
+  if (ref == nullptr) return Status::OK();
+
+  ARROW_ASSIGN_OR_RAISE(auto match, ref->FindOneOrNone(physical_schema));
+  if (match.indices().size() != 1) return Status::OK();
+  const SchemaField& schema_field = manifest.schema_fields[match[0]];
+  if (!schema_field.is_leaf()) return Status::OK();
+  for (auto& value : values) {
+    if (!value->type->Equals(*schema_field.field->type())) {
+      auto maybe_value = value->CastTo(schema_field.field->type());
+      if (!maybe_value.ok()) return Status::OK();
+      value = maybe_value.MoveValueUnsafe();
+    }
+  }
+  probes->push_back({&schema_field, std::move(values)});
+  return Status::OK();
+}
+
+// Drop the row groups for which the Bloom filter of a column compared by the
+// predicate with equal or is_in holds none of the compared values. This helps
+// with high-cardinality columns, such as ids, whose min/max statistics span
+// most of the domain.
+Result<std::vector<int>> FilterRowGroupsWithBloomFilter(
+    const parquet::arrow::FileReader& reader, const Schema& physical_schema,
+    const compute::Expression& predicate, std::vector<int> row_groups,
+    const parquet::ArrowReaderProperties& arrow_properties) {
+  std::vector<BloomFilterProbe> probes;
+  RETURN_NOT_OK(
+      CollectBloomFilterProbes(predicate, reader.manifest(), physical_schema, &probes));
+  if (probes.empty()) return row_groups;
+
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  auto bloom_filter_reader = reader.parquet_reader()->GetBloomFilterReader();
+  if (bloom_filter_reader == nullptr) return row_groups;
+  const parquet::SchemaDescriptor* schema =
+      reader.parquet_reader()->metadata()->schema();
+
+  // Load all filters which may be probed at once, coalescing neighbouring reads
+  std::vector<int> column_indices;
+  for (const auto& probe : probes) {
+    column_indices.push_back(probe.schema_field->column_index);
+  }
+  bloom_filter_reader->WillNeed(row_groups, column_indices, arrow_properties.io_context(),
+                                arrow_properties.cache_options());
+
+  std::vector<int> filtered;
+  for (int row_group : row_groups) {
+    auto row_group_filter_reader = bloom_filter_reader->RowGroup(row_group);
+    bool excluded = false;
+    for (const auto& probe : probes) {
+      const int column_index = probe.schema_field->column_index;
+      auto filter = row_group_filter_reader->GetColumnBloomFilter(column_index);
+      if (filter == nullptr) continue;
+      const auto& descr = *schema->Column(column_index);
+      excluded = std::none_of(
+          probe.values.begin(), probe.values.end(),
+          [&](const std::shared_ptr<Scalar>& value) {
+            auto hash = HashForBloomFilter(*filter, descr, *value);
+            return !hash.has_value() || filter->FindHash(*hash);
+          });
+      if (excluded) break;
+    }
+    if (!excluded) filtered.push_back(row_group);
+  }
+  return filtered;
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
 void AddColumnIndices(const SchemaField& schema_field,
                       std::vector<int>* column_projection) {
   if (schema_field.is_leaf()) {
@@ -189,7 +503,6 @@ Status ResolveOneFieldRef(
     return Status::OK();
   }
 
-  const SchemaField* toplevel = nullptr;
   const SchemaField* field = nullptr;
   if (const std::vector<FieldRef>* refs = field_ref.nested_refs()) {
     // Only supports a sequence of names
@@ -200,7 +513,6 @@ Status ResolveOneFieldRef(
           auto it = field_lookup.find(*name);
           if (it != field_lookup.end()) {
             field = it->second;
-            toplevel = field;
           } else if (duplicate_fields.find(*name) != duplicate_fields.end()) {
             return Status::Invalid("Ambiguous reference to column '", *name,
                                    "' which occurs more than once");
@@ -238,12 +550,10 @@ Status ResolveOneFieldRef(
   }
 
   if (field) {
-    // TODO(ARROW-1888): support fine-grained column projection. We should be
-    // able to materialize only the child fields requested, and not the entire
-    // top-level field.
-    // Right now, if enabled, projection/filtering will fail when they cast the
-    // physical schema to the dataset schema.
-    AddColumnIndices(*toplevel, columns_selection);
+    // Only the leaves of the referenced field are read.  The struct fields which
+    // contain it then lack their other children, which MakeExecBatch fills in with
+    // nulls when the batch is conformed to the dataset schema.
+    AddColumnIndices(*field, columns_selection);
   }
   return Status::OK();
 }
@@ -279,6 +589,37 @@ Result<std::vector<int>> InferColumnProjection(const parquet::arrow::FileReader&
   return columns_selection;
 }
 
+// Counts the rows of the row groups of a fragment which are not scanned, and the
+// fragment if none is
+void RecordPrunedRowGroups(const ParquetFileFragment& fragment,
+                           const std::vector<int>& row_groups,
+                           ScanStatsCollector* stats_collector) {
+  if (stats_collector == nullptr || fragment.metadata() == nullptr ||
+      row_groups.size() == fragment.row_groups().size()) {
+    return;
+  }
+  const parquet::FileMetaData& metadata = *fragment.metadata();
+  int64_t num_rows = 0;
+  for (int row_group : fragment.row_groups()) {
+    num_rows += metadata.RowGroup(row_group)->num_rows();
+  }
+  for (int row_group : row_groups) {
+    num_rows -= metadata.RowGroup(row_group)->num_rows();
+  }
+  stats_collector->RecordRowsPruned(num_rows);
+  if (row_groups.empty()) stats_collector->RecordFragmentsSkipped(1);
+}
+
+// Moves the counters of the reader of a fragment to the stats of the scan
+void FlushReaderMetrics(parquet::ReaderMetrics* metrics,
+                        ScanStatsCollector* stats_collector) {
+  stats_collector->RecordIo(metrics->bytes_requested.exchange(0),
+                            metrics->bytes_wasted.exchange(0),
+                            metrics->io_wait_ns.exchange(0));
+  stats_collector->RecordDecode(metrics->decompression_ns.exchange(0),
+                                metrics->decode_ns.exchange(0));
+}
+
 Status WrapSourceError(const Status& status, const std::string& path) {
   return status.WithMessage("Could not open Parquet input source '", path,
                             "': ", status.message());
@@ -347,17 +688,25 @@ Result<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
 }
 
 Future<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReaderAsync(
-    const FileSource& source, const std::shared_ptr<ScanOptions>& options) const {
+    const FileSource& source, const std::shared_ptr<ScanOptions>& options,
+    std::shared_ptr<parquet::ReaderMetrics> metrics) const {
   ARROW_ASSIGN_OR_RAISE(
       auto parquet_scan_options,
       GetFragmentScanOptions<ParquetFragmentScanOptions>(kParquetTypeName, options.get(),
                                                          default_fragment_scan_options));
   auto properties =
       MakeReaderProperties(*this, parquet_scan_options.get(), options->pool);
+  properties.set_metrics(std::move(metrics));
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+  // Skip reading and parsing the footer if it was seen before
+  const std::string cache_key = MetadataCacheKey(source, *parquet_scan_options);
+  std::shared_ptr<parquet::FileMetaData> cached_metadata;
+  if (!cache_key.empty()) {
+    cached_metadata = parquet_scan_options->metadata_cache->Get(cache_key);
+  }
   // TODO(ARROW-12259): workaround since we have Future<(move-only type)>
-  auto reader_fut =
-      parquet::ParquetFileReader::OpenAsync(std::move(input), std::move(properties));
+  auto reader_fut = parquet::ParquetFileReader::OpenAsync(
+      std::move(input), std::move(properties), cached_metadata);
   auto path = source.path();
   auto self = checked_pointer_cast<const ParquetFileFormat>(shared_from_this());
   return reader_fut.Then(
@@ -366,6 +715,10 @@ Future<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
         ARROW_ASSIGN_OR_RAISE(std::unique_ptr<parquet::ParquetFileReader> reader,
                               reader_fut.MoveResult());
         std::shared_ptr<parquet::FileMetaData> metadata = reader->metadata();
+        if (!cache_key.empty() && cached_metadata == nullptr &&
+            !metadata->is_encryption_algorithm_set()) {
+          parquet_scan_options->metadata_cache->Put(cache_key, metadata);
+        }
         auto arrow_properties = MakeArrowReaderProperties(*self, *metadata);
         arrow_properties.set_batch_size(options->batch_size);
         // Must be set here since the sync ScanTask handles pre-buffering itself
@@ -373,8 +726,16 @@ Future<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
             parquet_scan_options->arrow_reader_properties->pre_buffer());
         arrow_properties.set_cache_options(
             parquet_scan_options->arrow_reader_properties->cache_options());
-        arrow_properties.set_io_context(
-            parquet_scan_options->arrow_reader_properties->io_context());
+        const io::IOContext& io_context =
+            parquet_scan_options->arrow_reader_properties->io_context();
+        if (!io_context.stop_token().IsStoppable()) {
+          // Abort the reads (including pre-buffering) when the scan is cancelled
+          arrow_properties.set_io_context(
+              io::IOContext(io_context.pool(), io_context.executor(),
+                            options->io_context.stop_token(), io_context.external_id()));
+        } else {
+          arrow_properties.set_io_context(io_context);
+        }
         arrow_properties.set_use_threads(options->use_threads);
         std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
         RETURN_NOT_OK(parquet::arrow::FileReader::Make(options->pool, std::move(reader),
@@ -440,10 +801,14 @@ Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
   // a FileReader, potentially avoiding IO altogether if all RowGroups are excluded due to
   // prior statistics knowledge. In the case where a RowGroup doesn't have statistics
   // metdata, it will not be excluded.
+  ScanStatsCollector* stats_collector = options->stats_collector.get();
   if (parquet_fragment->metadata() != nullptr) {
     ARROW_ASSIGN_OR_RAISE(row_groups, parquet_fragment->FilterRowGroups(options->filter));
     pre_filtered = true;
-    if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+    if (row_groups.empty()) {
+      RecordPrunedRowGroups(*parquet_fragment, row_groups, stats_collector);
+      return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+    }
   }
   int64_t batch_size = options->batch_size;
   // Open the reader and pay the real IO cost.
@@ -456,14 +821,29 @@ Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
       // row groups were not already filtered; do this now
       ARROW_ASSIGN_OR_RAISE(row_groups,
                             parquet_fragment->FilterRowGroups(options->filter));
-      if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
     }
-    ARROW_ASSIGN_OR_RAISE(auto column_projection,
-                          InferColumnProjection(*reader, *options));
     ARROW_ASSIGN_OR_RAISE(
         auto parquet_scan_options,
         GetFragmentScanOptions<ParquetFragmentScanOptions>(
             kParquetTypeName, options.get(), default_fragment_scan_options));
+    if (!row_groups.empty() && parquet_scan_options->use_page_index) {
+      ARROW_ASSIGN_OR_RAISE(auto physical_schema, parquet_fragment->ReadPhysicalSchema());
+      ARROW_ASSIGN_OR_RAISE(row_groups, FilterRowGroupsWithPageIndex(
+                                            *reader, *physical_schema, options->filter,
+                                            std::move(row_groups)));
+    }
+    if (!row_groups.empty() && parquet_scan_options->use_bloom_filter) {
+      ARROW_ASSIGN_OR_RAISE(auto physical_schema, parquet_fragment->ReadPhysicalSchema());
+      ARROW_ASSIGN_OR_RAISE(row_groups,
+                            FilterRowGroupsWithBloomFilter(
+                                *reader, *physical_schema, options->filter,
+                                std::move(row_groups),
+                                *parquet_scan_options->arrow_reader_properties));
+    }
+    RecordPrunedRowGroups(*parquet_fragment, row_groups, stats_collector);
+    if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+    ARROW_ASSIGN_OR_RAISE(auto column_projection,
+                          InferColumnProjection(*reader, *options));
     int batch_readahead = options->batch_readahead;
     int64_t rows_to_readahead = batch_readahead * batch_size;
     ARROW_ASSIGN_OR_RAISE(auto generator,
@@ -475,8 +855,21 @@ Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
         MakeSerialReadaheadGenerator(std::move(sliced), batch_readahead);
     return sliced_readahead;
   };
-  auto generator = MakeFromFuture(GetReaderAsync(parquet_fragment->source(), options)
-                                      .Then(std::move(make_generator)));
+  std::shared_ptr<parquet::ReaderMetrics> metrics;
+  if (stats_collector != nullptr) metrics = std::make_shared<parquet::ReaderMetrics>();
+  auto generator =
+      MakeFromFuture(GetReaderAsync(parquet_fragment->source(), options, metrics)
+                         .Then(std::move(make_generator)));
+  if (metrics) {
+    // Each batch is produced once the row group it belongs to is decoded
+    std::shared_ptr<ScanStatsCollector> collector = options->stats_collector;
+    generator = MakeMappedGenerator(
+        std::move(generator),
+        [metrics, collector](const std::shared_ptr<RecordBatch>& batch) {
+          FlushReaderMetrics(metrics.get(), collector.get());
+          return batch;
+        });
+  }
   WRAP_ASYNC_GENERATOR_WITH_CHILD_SPAN(
       generator, "arrow::dataset::ParquetFileFormat::ScanBatchesAsync::Next");
   return generator;
@@ -38,10 +38,12 @@ class Statistics;
 class ColumnChunkMetaData;
 class RowGroupMetaData;
 class FileMetaData;
+class FileMetaDataCache;
 class FileDecryptionProperties;
 class FileEncryptionProperties;
 
 class ReaderProperties;
+struct ReaderMetrics;
 class ArrowReaderProperties;
 
 class WriterProperties;
@@ -119,8 +121,11 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
   Result<std::shared_ptr<parquet::arrow::FileReader>> GetReader(
       const FileSource& source, const std::shared_ptr<ScanOptions>& options) const;
 
+  /// \brief Return a FileReader on the given source, which updates the given metrics
+  /// if any (see parquet::ReaderProperties::metrics()).
   Future<std::shared_ptr<parquet::arrow::FileReader>> GetReaderAsync(
-      const FileSource& source, const std::shared_ptr<ScanOptions>& options) const;
+      const FileSource& source, const std::shared_ptr<ScanOptions>& options,
+      std::shared_ptr<parquet::ReaderMetrics> metrics = NULLPTR) const;
 
   Result<std::shared_ptr<FileWriter>> MakeWriter(
       std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
@@ -215,6 +220,23 @@ class ARROW_DS_EXPORT ParquetFragmentScanOptions : public FragmentScanOptions {
   /// ScanOptions. Additionally, dictionary columns come from
   /// ParquetFileFormat::ReaderOptions::dict_columns.
   std::shared_ptr<parquet::ArrowReaderProperties> arrow_reader_properties;
+  /// Read the page index of files which have one, and skip row groups in which no
+  /// page can satisfy the filter according to its statistics. This costs one read
+  /// per row group, and helps most for data sorted on the filtered columns.
+  bool use_page_index = false;
+  /// Read the Bloom filters of files which have them, and skip row groups whose
+  /// filters hold none of the values which the filter compares a column with,
+  /// through equal or is_in. Reads of the Bloom filters are coalesced according
+  /// to arrow_reader_properties->cache_options().
+  bool use_bloom_filter = false;
+  /// Cache of parsed file footers, or nullptr to read the footer on every open.
+  ///
+  /// Footers are keyed by filesystem, path, size and modification time, so only
+  /// fragments whose FileSource carries a size and modification time (as those
+  /// discovered by a FileSystemDatasetFactory do) are cached. Encrypted files
+  /// are never cached. parquet::default_file_metadata_cache() returns a
+  /// process-wide cache.
+  std::shared_ptr<parquet::FileMetaDataCache> metadata_cache;
 };
 
 class ARROW_DS_EXPORT ParquetFileWriteOptions : public FileWriteOptions {
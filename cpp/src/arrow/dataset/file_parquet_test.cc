@@ -34,6 +34,7 @@
 #include "arrow/type_fwd.h"
 #include "arrow/util/range.h"
 
+#include "parquet/arrow/reader.h"
 #include "parquet/arrow/writer.h"
 #include "parquet/metadata.h"
 
@@ -44,6 +45,7 @@ using internal::checked_pointer_cast;
 namespace dataset {
 
 using parquet::ArrowWriterProperties;
+using parquet::BloomFilterOptions;
 using parquet::default_arrow_writer_properties;
 
 using parquet::default_writer_properties;
@@ -314,6 +316,41 @@ TEST_F(TestParquetFileFormat, MultithreadedScan) {
   ASSERT_EQ(batches.size(), kNumRowGroups);
 }
 
+TEST_F(TestParquetFileFormat, MetadataCache) {
+  auto reader = GetRecordBatchReader(schema({field("f64", float64())}));
+  ASSERT_OK_AND_ASSIGN(auto buffer, ParquetFormatHelper::Write(reader.get()));
+  const fs::TimePoint mtime(fs::TimePoint::duration(1));
+  auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(mtime);
+  ASSERT_OK(mock_fs->CreateFile("data.parquet", buffer->ToString(), /*recursive=*/false));
+  ASSERT_OK_AND_ASSIGN(auto info, mock_fs->GetFileInfo("data.parquet"));
+
+  auto cache = std::make_shared<parquet::FileMetaDataCache>(1 << 20);
+  auto parquet_options = std::make_shared<ParquetFragmentScanOptions>();
+  parquet_options->metadata_cache = cache;
+  format_->default_fragment_scan_options = parquet_options;
+
+  // Without a size and modification time the file contents can't be identified
+  ASSERT_OK(format_->GetReader(FileSource("data.parquet", mock_fs), opts_).status());
+  ASSERT_EQ(0, cache->num_entries());
+
+  FileSource source(info, mock_fs);
+  ASSERT_OK_AND_ASSIGN(auto first_reader, format_->GetReader(source, opts_));
+  ASSERT_EQ(1, cache->num_entries());
+  ASSERT_OK_AND_ASSIGN(auto second_reader, format_->GetReader(source, opts_));
+  ASSERT_EQ(1, cache->num_entries());
+  ASSERT_EQ(first_reader->parquet_reader()->metadata(),
+            second_reader->parquet_reader()->metadata());
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(second_reader->ReadTable(&table));
+  ASSERT_EQ(expected_rows(), table->num_rows());
+
+  // A rewritten file is a different cache entry
+  info.set_mtime(mtime + fs::TimePoint::duration(1));
+  ASSERT_OK(format_->GetReader(FileSource(info, mock_fs), opts_).status());
+  ASSERT_EQ(2, cache->num_entries());
+}
+
 class TestParquetFileSystemDataset : public WriteFileSystemDatasetMixin,
                                      public testing::Test {
  public:
@@ -388,8 +425,7 @@ TEST_P(TestParquetFileFormatScan, ScanRecordBatchReader) { TestScan(); }
 TEST_P(TestParquetFileFormatScan, ScanBatchSize) { TestScanBatchSize(); }
 TEST_P(TestParquetFileFormatScan, ScanRecordBatchReaderProjected) { TestScanProjected(); }
 TEST_P(TestParquetFileFormatScan, ScanRecordBatchReaderProjectedNested) {
-  // TODO(ARROW-1888): enable fine-grained column projection.
-  TestScanProjectedNested(/*fine_grained_selection=*/false);
+  TestScanProjectedNested(/*fine_grained_selection=*/true);
 }
 TEST_P(TestParquetFileFormatScan, ScanRecordBatchReaderProjectedMissingCols) {
   TestScanProjectedMissingCols();
@@ -497,6 +533,47 @@ TEST_P(TestParquetFileFormatScan, PredicatePushdown) {
                             kNumRowGroups - 5);
 }
 
+TEST_P(TestParquetFileFormatScan, ScanStats) {
+  constexpr int64_t kNumRowGroups = 16;
+  constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
+
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+
+  SetSchema(reader->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  std::vector<int64_t> bytes_requested;
+  for (bool pre_buffer : {false, true}) {
+    auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+    fragment_scan_options->arrow_reader_properties->set_pre_buffer(pre_buffer);
+    opts_->fragment_scan_options = fragment_scan_options;
+    opts_->stats_collector = std::make_shared<ScanStatsCollector>();
+
+    // The row groups keyed by 1 to 5 are skipped by their statistics
+    SetFilter(greater_equal(field_ref("i64"), literal<int64_t>(6)));
+    CountRowsAndBatchesInScan(fragment, kTotalNumRows - 15, kNumRowGroups - 5);
+    ScanStats stats = opts_->stats_collector->stats();
+    ASSERT_EQ(stats.rows_pruned, 15);
+    ASSERT_EQ(stats.fragments_skipped, 0);
+    ASSERT_GT(stats.bytes_requested, 0);
+    ASSERT_GT(stats.decode_time_ns, 0);
+    if (!pre_buffer) {
+      ASSERT_EQ(stats.bytes_wasted, 0);
+    }
+    bytes_requested.push_back(stats.bytes_requested);
+
+    // All row groups are skipped, and so is the fragment
+    SetFilter(literal(false));
+    CountRowsAndBatchesInScan(fragment, 0, 0);
+    stats = opts_->stats_collector->stats();
+    ASSERT_EQ(stats.rows_pruned, 15 + kTotalNumRows);
+    ASSERT_EQ(stats.fragments_skipped, 1);
+  }
+  // The same column chunks are read, whether pre-buffered or not
+  ASSERT_EQ(bytes_requested[0], bytes_requested[1]);
+}
+
 TEST_P(TestParquetFileFormatScan, PredicatePushdownRowGroupFragments) {
   constexpr int64_t kNumRowGroups = 16;
 
@@ -624,6 +701,93 @@ TEST_P(TestParquetFileFormatScan, PredicatePushdownRowGroupFragmentsUsingStringC
   CountRowGroupsInFragment(fragment, {0, 3}, equal(field_ref("x"), literal("a")));
 }
 
+TEST_P(TestParquetFileFormatScan, PredicatePushdownUsingPageIndex) {
+  // A single row group whose two pages hold [0, 10) and [20, 30): its column chunk
+  // statistics can't exclude x == 15, but its page index can.
+  auto table = TableFromJSON(schema({field("x", int64())}),
+                             {R"([{"x": 0}, {"x": 1}, {"x": 2}, {"x": 3}, {"x": 4},
+                                  {"x": 5}, {"x": 6}, {"x": 7}, {"x": 8}, {"x": 9},
+                                  {"x": 20}, {"x": 21}, {"x": 22}, {"x": 23},
+                                  {"x": 24}, {"x": 25}, {"x": 26}, {"x": 27},
+                                  {"x": 28}, {"x": 29}])"});
+  auto sink = CreateOutputStream();
+  auto properties = WriterProperties::Builder()
+                        .disable_dictionary()
+                        ->data_pagesize(1)
+                        ->write_batch_size(10)
+                        ->enable_write_page_index()
+                        ->build();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, /*chunk_size=*/20,
+                       properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+  SetFilter(equal(field_ref("x"), literal<int64_t>(15)));
+  CountRowsAndBatchesInScan(fragment, 20, 1);
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->use_page_index = true;
+  opts_->fragment_scan_options = fragment_scan_options;
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  SetFilter(equal(field_ref("x"), literal<int64_t>(25)));
+  CountRowsAndBatchesInScan(fragment, 20, 1);
+
+  SetFilter(is_null(field_ref("x")));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+}
+
+TEST_P(TestParquetFileFormatScan, PredicatePushdownUsingBloomFilter) {
+  // A single row group holding even values of x: its statistics can't exclude
+  // odd values in range, but its Bloom filters can.
+  auto table = TableFromJSON(schema({field("x", int64()), field("s", utf8())}),
+                             {R"([{"x": 0, "s": "a"}, {"x": 2, "s": "c"},
+                                  {"x": 4, "s": "e"}, {"x": 6, "s": null},
+                                  {"x": 8, "s": "i"}, {"x": 10, "s": "k"}])"});
+  auto sink = CreateOutputStream();
+  const BloomFilterOptions options{/*ndv=*/100, /*fpp=*/0.001};
+  auto properties = WriterProperties::Builder()
+                        .enable_bloom_filter("x", options)
+                        ->enable_bloom_filter("s", options)
+                        ->build();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, /*chunk_size=*/6,
+                       properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+  SetFilter(equal(field_ref("x"), literal<int64_t>(5)));
+  CountRowsAndBatchesInScan(fragment, 6, 1);
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->use_bloom_filter = true;
+  opts_->fragment_scan_options = fragment_scan_options;
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  SetFilter(equal(field_ref("x"), literal<int64_t>(4)));
+  CountRowsAndBatchesInScan(fragment, 6, 1);
+
+  SetFilter(equal(field_ref("s"), literal("b")));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  SetFilter(and_(equal(field_ref("s"), literal("k")),
+                 equal(field_ref("x"), literal<int64_t>(7))));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  SetFilter(call("is_in", {field_ref("s")},
+                 compute::SetLookupOptions{ArrayFromJSON(utf8(), R"(["b", "d"])")}));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  SetFilter(call("is_in", {field_ref("s")},
+                 compute::SetLookupOptions{ArrayFromJSON(utf8(), R"(["b", "e"])")}));
+  CountRowsAndBatchesInScan(fragment, 6, 1);
+}
+
 INSTANTIATE_TEST_SUITE_P(TestScan, TestParquetFileFormatScan,
                          ::testing::ValuesIn(TestFormatParams::Values()),
                          TestFormatParams::ToTestNameString);
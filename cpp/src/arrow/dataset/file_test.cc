@@ -121,6 +121,19 @@ class MockFileFormat : public FileFormat {
   std::shared_ptr<FileWriteOptions> DefaultWriteOptions() override { return nullptr; }
 };
 
+TEST(SortKeys, SerializeRoundTrip) {
+  std::vector<cp::SortKey> keys = {
+      cp::SortKey("a"), cp::SortKey("b.c[d]\\", cp::SortOrder::Descending),
+      cp::SortKey(FieldRef("e", "f")), cp::SortKey(FieldRef(FieldPath({1})))};
+  auto serialized = SerializeSortKeys(keys);
+  ASSERT_OK_AND_ASSIGN(auto parsed, ParseSortKeys(serialized));
+  ASSERT_EQ(parsed, keys);
+
+  ASSERT_OK_AND_EQ(std::vector<cp::SortKey>{}, ParseSortKeys(""));
+  ASSERT_RAISES(Invalid, ParseSortKeys(".a"));
+  ASSERT_RAISES(Invalid, ParseSortKeys("sideways .a"));
+}
+
 TEST(FileFormat, ScanAsync) {
   MockFileFormat format;
   auto scan_options = std::make_shared<ScanOptions>();
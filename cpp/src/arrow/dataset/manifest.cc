@@ -0,0 +1,456 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/manifest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "arrow/array/array_nested.h"
+#include "arrow/array/builder_base.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/util/base64.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/key_value_metadata.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace dataset {
+
+namespace {
+
+constexpr char kManifestVersionKey[] = "ARROW:dataset:manifest_version";
+constexpr char kManifestVersion[] = "1";
+constexpr char kSchemaKey[] = "ARROW:dataset:schema";
+constexpr char kPhysicalSchemaKey[] = "ARROW:dataset:physical_schema";
+constexpr char kFormatKey[] = "ARROW:dataset:format";
+
+// Minimums and maximums are merged once this many batches have been seen
+constexpr size_t kMaxUnmergedStatistics = 1024;
+
+bool IsNaN(const Scalar& scalar) {
+  if (!scalar.is_valid) return false;
+  switch (scalar.type->id()) {
+    case Type::FLOAT:
+      return std::isnan(checked_cast<const FloatScalar&>(scalar).value);
+    case Type::DOUBLE:
+      return std::isnan(checked_cast<const DoubleScalar&>(scalar).value);
+    default:
+      return false;
+  }
+}
+
+Result<std::shared_ptr<Array>> ScalarsToArray(const std::shared_ptr<DataType>& type,
+                                              const ScalarVector& scalars) {
+  std::unique_ptr<ArrayBuilder> builder;
+  RETURN_NOT_OK(MakeBuilder(default_memory_pool(), type, &builder));
+  for (const auto& scalar : scalars) {
+    if (scalar) {
+      RETURN_NOT_OK(builder->AppendScalar(*scalar));
+    } else {
+      RETURN_NOT_OK(builder->AppendNull());
+    }
+  }
+  return builder->Finish();
+}
+
+// The minimum and maximum of the non-null values of an array, or nullptrs if there
+// are none
+Status ArrayMinMax(const Datum& values, std::shared_ptr<Scalar>* min,
+                   std::shared_ptr<Scalar>* max) {
+  ARROW_ASSIGN_OR_RAISE(auto min_max, compute::MinMax(values));
+  const auto& min_max_scalar = min_max.scalar_as<StructScalar>();
+  *min = min_max_scalar.value[0]->is_valid ? min_max_scalar.value[0] : nullptr;
+  *max = min_max_scalar.value[1]->is_valid ? min_max_scalar.value[1] : nullptr;
+  return Status::OK();
+}
+
+std::string EncodeSchema(const Schema& schema) {
+  auto buffer = ipc::SerializeSchema(schema);
+  if (!buffer.ok()) return "";
+  return util::base64_encode(util::string_view(**buffer));
+}
+
+Result<std::shared_ptr<Schema>> DecodeSchema(const std::string& encoded) {
+  auto buffer = std::make_shared<Buffer>(util::base64_decode(encoded));
+  io::BufferReader reader(buffer);
+  ipc::DictionaryMemo dictionary_memo;
+  return ipc::ReadSchema(&reader, &dictionary_memo);
+}
+
+Result<std::string> GetMetadata(const KeyValueMetadata& metadata,
+                                const std::string& key) {
+  auto value = metadata.Get(key);
+  if (!value.ok()) {
+    return Status::Invalid("Dataset manifest is missing the '", key, "' metadata");
+  }
+  return value.MoveValueUnsafe();
+}
+
+}  // namespace
+
+compute::Expression FragmentManifestEntry::Guarantee() const {
+  std::vector<compute::Expression> conjunction = {partition_expression};
+  for (const auto& column : statistics) {
+    auto field_expr = compute::field_ref(column.name);
+    if (!column.min || !column.max) {
+      if (column.null_count > 0) {
+        conjunction.push_back(compute::is_null(std::move(field_expr)));
+      }
+      continue;
+    }
+
+    compute::Expression values;
+    if (column.min->Equals(*column.max)) {
+      values = compute::equal(field_expr, compute::literal(column.min));
+    } else {
+      values =
+          compute::and_(compute::greater_equal(field_expr, compute::literal(column.min)),
+                        compute::less_equal(field_expr, compute::literal(column.max)));
+    }
+    if (column.null_count > 0) {
+      values = compute::or_(std::move(values), compute::is_null(std::move(field_expr)));
+    }
+    conjunction.push_back(std::move(values));
+  }
+  return compute::and_(std::move(conjunction));
+}
+
+DatasetManifest::DatasetManifest(std::shared_ptr<Schema> schema,
+                                 std::shared_ptr<Schema> physical_schema,
+                                 std::string format_type_name,
+                                 std::vector<FragmentManifestEntry> fragments,
+                                 std::vector<compute::SortKey> sort_keys)
+    : schema_(std::move(schema)),
+      physical_schema_(std::move(physical_schema)),
+      format_type_name_(std::move(format_type_name)),
+      fragments_(std::move(fragments)),
+      sort_keys_(std::move(sort_keys)) {}
+
+Status DatasetManifest::Write(const std::shared_ptr<fs::FileSystem>& filesystem,
+                             const std::string& base_dir) const {
+  // One struct<min, max, null_count> child per column with statistics, in the order
+  // of the physical schema
+  FieldVector statistics_fields;
+  std::vector<std::string> statistics_names;
+  for (const auto& field : physical_schema_->fields()) {
+    if (!FragmentStatisticsCollector::SupportsType(*field->type()) ||
+        physical_schema_->GetAllFieldIndices(field->name()).size() != 1) {
+      continue;
+    }
+    statistics_fields.push_back(
+        arrow::field(field->name(), struct_({arrow::field("min", field->type()),
+                                             arrow::field("max", field->type()),
+                                             arrow::field("null_count", int64())})));
+    statistics_names.push_back(field->name());
+  }
+
+  StringBuilder path_builder;
+  Int64Builder size_builder, num_rows_builder;
+  BinaryBuilder partition_builder;
+  std::vector<ScalarVector> mins(statistics_names.size()), maxes(mins.size());
+  std::vector<std::vector<int64_t>> null_counts(mins.size());
+  for (const auto& fragment : fragments_) {
+    RETURN_NOT_OK(path_builder.Append(fragment.path));
+    RETURN_NOT_OK(size_builder.Append(fragment.size));
+    RETURN_NOT_OK(num_rows_builder.Append(fragment.num_rows));
+    ARROW_ASSIGN_OR_RAISE(auto partition,
+                          compute::Serialize(fragment.partition_expression));
+    RETURN_NOT_OK(partition_builder.Append(partition->data(), partition->size()));
+
+    for (size_t i = 0; i < statistics_names.size(); ++i) {
+      auto column = std::find_if(fragment.statistics.begin(), fragment.statistics.end(),
+                                 [&](const FragmentColumnStatistics& column) {
+                                   return column.name == statistics_names[i];
+                                 });
+      if (column == fragment.statistics.end()) {
+        mins[i].push_back(nullptr);
+        maxes[i].push_back(nullptr);
+        null_counts[i].push_back(-1);
+      } else {
+        mins[i].push_back(column->min);
+        maxes[i].push_back(column->max);
+        null_counts[i].push_back(column->null_count);
+      }
+    }
+  }
+
+  ArrayVector columns(4);
+  RETURN_NOT_OK(path_builder.Finish(&columns[0]));
+  RETURN_NOT_OK(size_builder.Finish(&columns[1]));
+  RETURN_NOT_OK(num_rows_builder.Finish(&columns[2]));
+  RETURN_NOT_OK(partition_builder.Finish(&columns[3]));
+  FieldVector fields = {arrow::field("path", utf8(), /*nullable=*/false),
+                        arrow::field("size", int64(), /*nullable=*/false),
+                        arrow::field("num_rows", int64(), /*nullable=*/false),
+                        arrow::field("partition_expression", binary())};
+
+  if (!statistics_fields.empty()) {
+    ArrayVector statistics_columns;
+    for (size_t i = 0; i < statistics_names.size(); ++i) {
+      const auto& type = physical_schema_->GetFieldByName(statistics_names[i])->type();
+      ARROW_ASSIGN_OR_RAISE(auto min, ScalarsToArray(type, mins[i]));
+      ARROW_ASSIGN_OR_RAISE(auto max, ScalarsToArray(type, maxes[i]));
+      Int64Builder null_count_builder;
+      for (int64_t null_count : null_counts[i]) {
+        if (null_count < 0) {
+          RETURN_NOT_OK(null_count_builder.AppendNull());
+        } else {
+          RETURN_NOT_OK(null_count_builder.Append(null_count));
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(auto null_count, null_count_builder.Finish());
+      ARROW_ASSIGN_OR_RAISE(
+          auto column, StructArray::Make({min, max, null_count},
+                                         statistics_fields[i]->type()->fields()));
+      statistics_columns.push_back(std::move(column));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto statistics,
+                          StructArray::Make(statistics_columns, statistics_fields));
+    columns.push_back(std::move(statistics));
+    fields.push_back(arrow::field("statistics", columns.back()->type()));
+  }
+
+  auto metadata = key_value_metadata(
+      {kManifestVersionKey, kSchemaKey, kPhysicalSchemaKey, kFormatKey},
+      {kManifestVersion, EncodeSchema(*schema_), EncodeSchema(*physical_schema_),
+       format_type_name_});
+  if (!sort_keys_.empty()) {
+    metadata->Append(kSortKeysMetadataKey, SerializeSortKeys(sort_keys_));
+  }
+  auto manifest_schema = arrow::schema(std::move(fields), std::move(metadata));
+  auto batch = RecordBatch::Make(manifest_schema, static_cast<int64_t>(fragments_.size()),
+                                 std::move(columns));
+
+  ARROW_ASSIGN_OR_RAISE(auto out, filesystem->OpenOutputStream(
+                                      fs::internal::ConcatAbstractPath(
+                                          base_dir, kDatasetManifestFileName)));
+  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(out, manifest_schema));
+  RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  RETURN_NOT_OK(writer->Close());
+  return out->Close();
+}
+
+Result<std::shared_ptr<DatasetManifest>> DatasetManifest::Read(
+    const std::shared_ptr<fs::FileSystem>& filesystem, const std::string& base_dir) {
+  ARROW_ASSIGN_OR_RAISE(auto input, filesystem->OpenInputFile(
+                                        fs::internal::ConcatAbstractPath(
+                                            base_dir, kDatasetManifestFileName)));
+  ARROW_ASSIGN_OR_RAISE(auto reader, ipc::RecordBatchFileReader::Open(input));
+  const auto& manifest_schema = reader->schema();
+  if (!manifest_schema->HasMetadata()) {
+    return Status::Invalid("Dataset manifest is missing its metadata");
+  }
+  const auto& metadata = *manifest_schema->metadata();
+  ARROW_ASSIGN_OR_RAISE(auto version, GetMetadata(metadata, kManifestVersionKey));
+  if (version != kManifestVersion) {
+    return Status::NotImplemented("Dataset manifest version ", version);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto encoded_schema, GetMetadata(metadata, kSchemaKey));
+  ARROW_ASSIGN_OR_RAISE(auto schema, DecodeSchema(encoded_schema));
+  ARROW_ASSIGN_OR_RAISE(auto encoded_physical_schema,
+                        GetMetadata(metadata, kPhysicalSchemaKey));
+  ARROW_ASSIGN_OR_RAISE(auto physical_schema, DecodeSchema(encoded_physical_schema));
+  ARROW_ASSIGN_OR_RAISE(auto format_type_name, GetMetadata(metadata, kFormatKey));
+  std::vector<compute::SortKey> sort_keys;
+  if (metadata.Contains(kSortKeysMetadataKey)) {
+    ARROW_ASSIGN_OR_RAISE(auto serialized_sort_keys, metadata.Get(kSortKeysMetadataKey));
+    ARROW_ASSIGN_OR_RAISE(sort_keys, ParseSortKeys(serialized_sort_keys));
+  }
+
+  RecordBatchVector batches;
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(i));
+    batches.push_back(std::move(batch));
+  }
+  ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(manifest_schema, batches));
+  ARROW_ASSIGN_OR_RAISE(auto combined, table->CombineChunksToBatch());
+
+  auto path = combined->GetColumnByName("path");
+  auto size = combined->GetColumnByName("size");
+  auto num_rows = combined->GetColumnByName("num_rows");
+  auto partition = combined->GetColumnByName("partition_expression");
+  if (!path || !size || !num_rows || !partition) {
+    return Status::Invalid("Dataset manifest is missing columns: ",
+                           manifest_schema->ToString());
+  }
+  const auto& paths = checked_cast<const StringArray&>(*path);
+  const auto& sizes = checked_cast<const Int64Array&>(*size);
+  const auto& row_counts = checked_cast<const Int64Array&>(*num_rows);
+  const auto& partitions = checked_cast<const BinaryArray&>(*partition);
+  std::shared_ptr<StructArray> statistics;
+  if (auto column = combined->GetColumnByName("statistics")) {
+    statistics = std::static_pointer_cast<StructArray>(column);
+  }
+
+  std::vector<FragmentManifestEntry> fragments(combined->num_rows());
+  for (int64_t i = 0; i < combined->num_rows(); ++i) {
+    auto& fragment = fragments[i];
+    fragment.path = paths.GetString(i);
+    fragment.size = sizes.Value(i);
+    fragment.num_rows = row_counts.Value(i);
+    if (partitions.IsValid(i)) {
+      ARROW_ASSIGN_OR_RAISE(fragment.partition_expression,
+                            compute::Deserialize(std::make_shared<Buffer>(
+                                partitions.GetString(i))));
+    }
+    if (!statistics) continue;
+
+    for (int c = 0; c < statistics->num_fields(); ++c) {
+      const auto& column = checked_cast<const StructArray&>(*statistics->field(c));
+      const auto& null_counts = checked_cast<const Int64Array&>(*column.field(2));
+      if (null_counts.IsNull(i)) continue;
+      FragmentColumnStatistics column_statistics;
+      column_statistics.name = statistics->type()->field(c)->name();
+      column_statistics.null_count = null_counts.Value(i);
+      if (column.field(0)->IsValid(i) && column.field(1)->IsValid(i)) {
+        ARROW_ASSIGN_OR_RAISE(column_statistics.min, column.field(0)->GetScalar(i));
+        ARROW_ASSIGN_OR_RAISE(column_statistics.max, column.field(1)->GetScalar(i));
+      }
+      fragment.statistics.push_back(std::move(column_statistics));
+    }
+  }
+
+  return std::make_shared<DatasetManifest>(std::move(schema), std::move(physical_schema),
+                                           std::move(format_type_name),
+                                           std::move(fragments), std::move(sort_keys));
+}
+
+Result<std::shared_ptr<FileSystemDataset>> DatasetManifest::MakeDataset(
+    std::shared_ptr<fs::FileSystem> filesystem, const std::string& base_dir,
+    std::shared_ptr<FileFormat> format) const {
+  if (format->type_name() != format_type_name_) {
+    return Status::Invalid("Dataset manifest lists ", format_type_name_,
+                           " files but the given format is ", format->type_name());
+  }
+  std::vector<std::shared_ptr<FileFragment>> fragments;
+  fragments.reserve(fragments_.size());
+  for (const auto& entry : fragments_) {
+    fs::FileInfo info(fs::internal::ConcatAbstractPath(base_dir, entry.path),
+                      fs::FileType::File);
+    info.set_size(entry.size);
+    ARROW_ASSIGN_OR_RAISE(
+        auto fragment, format->MakeFragment(FileSource(std::move(info), filesystem),
+                                            entry.Guarantee(), physical_schema_));
+    fragment->set_num_rows(entry.num_rows);
+    fragments.push_back(std::move(fragment));
+  }
+  return FileSystemDataset::Make(schema_, compute::literal(true), std::move(format),
+                                 std::move(filesystem), std::move(fragments));
+}
+
+FragmentStatisticsCollector::FragmentStatisticsCollector(
+    std::shared_ptr<Schema> physical_schema)
+    : physical_schema_(std::move(physical_schema)) {
+  for (int i = 0; i < physical_schema_->num_fields(); ++i) {
+    const auto& field = physical_schema_->field(i);
+    if (SupportsType(*field->type()) &&
+        physical_schema_->GetAllFieldIndices(field->name()).size() == 1) {
+      Column column;
+      column.index = i;
+      column.name = field->name();
+      columns_.push_back(std::move(column));
+    }
+  }
+}
+
+bool FragmentStatisticsCollector::SupportsType(const DataType& type) {
+  switch (type.id()) {
+    case Type::HALF_FLOAT:
+    case Type::INTERVAL_DAY_TIME:
+    case Type::INTERVAL_MONTH_DAY_NANO:
+      return false;
+    case Type::BOOL:
+    case Type::DATE32:
+    case Type::DATE64:
+    case Type::TIME32:
+    case Type::TIME64:
+    case Type::TIMESTAMP:
+    case Type::DURATION:
+      return true;
+    default:
+      return is_integer(type.id()) || is_floating(type.id()) ||
+             is_base_binary_like(type.id()) || is_fixed_size_binary(type.id());
+  }
+}
+
+Status FragmentStatisticsCollector::Update(const RecordBatch& batch) {
+  num_rows_ += batch.num_rows();
+  for (auto& column : columns_) {
+    const auto& values = batch.column(column.index);
+    column.null_count += values->null_count();
+    std::shared_ptr<Scalar> min, max;
+    RETURN_NOT_OK(ArrayMinMax(values, &min, &max));
+    if (min && max) {
+      column.mins.push_back(std::move(min));
+      column.maxes.push_back(std::move(max));
+    }
+    if (column.mins.size() >= kMaxUnmergedStatistics) {
+      RETURN_NOT_OK(Merge(&column));
+    }
+  }
+  return Status::OK();
+}
+
+Status FragmentStatisticsCollector::Merge(Column* column) {
+  if (column->mins.size() <= 1) return Status::OK();
+  const auto& type = physical_schema_->field(column->index)->type();
+  std::shared_ptr<Scalar> min, max, unused;
+  ARROW_ASSIGN_OR_RAISE(auto mins, ScalarsToArray(type, column->mins));
+  RETURN_NOT_OK(ArrayMinMax(mins, &min, &unused));
+  ARROW_ASSIGN_OR_RAISE(auto maxes, ScalarsToArray(type, column->maxes));
+  RETURN_NOT_OK(ArrayMinMax(maxes, &unused, &max));
+  column->mins = {std::move(min)};
+  column->maxes = {std::move(max)};
+  return Status::OK();
+}
+
+Result<std::vector<FragmentColumnStatistics>> FragmentStatisticsCollector::Finish() {
+  std::vector<FragmentColumnStatistics> statistics;
+  for (auto& column : columns_) {
+    RETURN_NOT_OK(Merge(&column));
+    FragmentColumnStatistics column_statistics;
+    column_statistics.name = column.name;
+    column_statistics.null_count = column.null_count;
+    if (!column.mins.empty()) {
+      column_statistics.min = column.mins[0];
+      column_statistics.max = column.maxes[0];
+      // A range with a NaN bound would exclude every value
+      if (IsNaN(*column_statistics.min) || IsNaN(*column_statistics.max)) continue;
+    }
+    statistics.push_back(std::move(column_statistics));
+  }
+  return statistics;
+}
+
+}  // namespace dataset
+}  // namespace arrow
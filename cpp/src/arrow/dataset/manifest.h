@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec/expression.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/filesystem/type_fwd.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \addtogroup dataset-filesystem
+///
+/// @{
+
+/// \brief Name of the manifest file written to the base directory of a dataset
+constexpr char kDatasetManifestFileName[] = "_arrow_manifest";
+
+/// \brief Statistics of one column of a file listed in a DatasetManifest
+struct ARROW_DS_EXPORT FragmentColumnStatistics {
+  /// The name of the column in the physical schema
+  std::string name;
+  /// The smallest and largest non-null values, or nullptr if the column only holds
+  /// nulls
+  std::shared_ptr<Scalar> min, max;
+  int64_t null_count = 0;
+};
+
+/// \brief A file listed in a DatasetManifest
+struct ARROW_DS_EXPORT FragmentManifestEntry {
+  /// The path of the file, relative to the base directory of the dataset
+  std::string path;
+  /// The size of the file in bytes
+  int64_t size = 0;
+  int64_t num_rows = 0;
+  /// The partition expression parsed from the path of the file
+  compute::Expression partition_expression = compute::literal(true);
+  /// Statistics of the columns of the file whose type supports them
+  std::vector<FragmentColumnStatistics> statistics;
+
+  /// \brief The expression that is true for every row of the file, made of the
+  /// partition expression and the column statistics
+  compute::Expression Guarantee() const;
+};
+
+/// \brief A persisted listing of the files of a dataset, with their row counts,
+/// partition expressions and column statistics.
+///
+/// A manifest is written to the base directory of a dataset by the dataset writer
+/// when FileSystemDatasetWriteOptions::write_manifest is set. Making a dataset from
+/// it neither lists the base directory nor opens any data file, and fragments are
+/// pruned by the statistics as well as the partition expressions.
+class ARROW_DS_EXPORT DatasetManifest {
+ public:
+  /// \param[in] schema the schema of the dataset, including partition fields
+  /// \param[in] physical_schema the schema of the files
+  /// \param[in] format_type_name the type name of the format of the files
+  /// \param[in] fragments the files of the dataset
+  /// \param[in] sort_keys the keys by which the row groups of the files are sorted,
+  /// if any
+  DatasetManifest(std::shared_ptr<Schema> schema,
+                  std::shared_ptr<Schema> physical_schema, std::string format_type_name,
+                  std::vector<FragmentManifestEntry> fragments,
+                  std::vector<compute::SortKey> sort_keys = {});
+
+  /// \brief Read the manifest in the given base directory
+  static Result<std::shared_ptr<DatasetManifest>> Read(
+      const std::shared_ptr<fs::FileSystem>& filesystem, const std::string& base_dir);
+
+  /// \brief Write the manifest to the given base directory, replacing any
+  /// previous one
+  Status Write(const std::shared_ptr<fs::FileSystem>& filesystem,
+               const std::string& base_dir) const;
+
+  /// \brief Make a dataset of the files listed in the manifest
+  ///
+  /// The partition expression of each fragment is its Guarantee(), and fragments
+  /// whose format supports it count rows from the manifest.
+  Result<std::shared_ptr<FileSystemDataset>> MakeDataset(
+      std::shared_ptr<fs::FileSystem> filesystem, const std::string& base_dir,
+      std::shared_ptr<FileFormat> format) const;
+
+  const std::shared_ptr<Schema>& schema() const { return schema_; }
+  const std::shared_ptr<Schema>& physical_schema() const { return physical_schema_; }
+  const std::string& format_type_name() const { return format_type_name_; }
+  const std::vector<FragmentManifestEntry>& fragments() const { return fragments_; }
+  /// \brief The keys by which the rows of each row group of the files are sorted, as
+  /// requested by FileSystemDatasetWriteOptions::sort_keys
+  const std::vector<compute::SortKey>& sort_keys() const { return sort_keys_; }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<Schema> physical_schema_;
+  std::string format_type_name_;
+  std::vector<FragmentManifestEntry> fragments_;
+  std::vector<compute::SortKey> sort_keys_;
+};
+
+/// \brief Accumulates the column statistics of the batches written to a file
+class ARROW_DS_EXPORT FragmentStatisticsCollector {
+ public:
+  explicit FragmentStatisticsCollector(std::shared_ptr<Schema> physical_schema);
+
+  /// \brief Whether statistics are collected for columns of the given type
+  static bool SupportsType(const DataType& type);
+
+  Status Update(const RecordBatch& batch);
+
+  /// \brief The statistics of the batches passed to Update() so far
+  Result<std::vector<FragmentColumnStatistics>> Finish();
+
+  int64_t num_rows() const { return num_rows_; }
+
+ private:
+  struct Column {
+    int index;
+    std::string name;
+    // Minimums and maximums of the batches seen since they were last merged
+    ScalarVector mins, maxes;
+    int64_t null_count = 0;
+  };
+
+  Status Merge(Column* column);
+
+  std::shared_ptr<Schema> physical_schema_;
+  std::vector<Column> columns_;
+  int64_t num_rows_ = 0;
+};
+
+/// @}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,241 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/manifest.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/file_ipc.h"
+#include "arrow/dataset/partition.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace dataset {
+
+using compute::field_ref;
+using compute::literal;
+
+class TestDatasetManifest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    fs_ = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+    format_ = std::make_shared<IpcFileFormat>();
+    schema_ = schema({field("id", int64()), field("name", utf8()),
+                      field("year", int32())});
+    table_ = TableFromJSON(schema_, {R"([
+        {"id": 1, "name": "a", "year": 2020},
+        {"id": 5, "name": null, "year": 2020},
+        {"id": 3, "name": "c", "year": 2020},
+        {"id": 10, "name": "d", "year": 2021},
+        {"id": 12, "name": "e", "year": 2021}
+      ])"});
+  }
+
+  void WriteDataset(bool write_manifest = true) {
+    auto dataset = std::make_shared<InMemoryDataset>(table_);
+    ASSERT_OK_AND_ASSIGN(auto scanner_builder, dataset->NewScan());
+    ASSERT_OK_AND_ASSIGN(auto scanner, scanner_builder->Finish());
+
+    FileSystemDatasetWriteOptions write_options;
+    write_options.file_write_options = format_->DefaultWriteOptions();
+    write_options.filesystem = fs_;
+    write_options.base_dir = "root";
+    write_options.basename_template = "part-{i}.arrow";
+    write_options.partitioning =
+        std::make_shared<HivePartitioning>(schema({field("year", int32())}));
+    write_options.write_manifest = write_manifest;
+    ASSERT_OK(FileSystemDataset::Write(write_options, scanner));
+  }
+
+  int CountFragments(compute::Expression predicate) {
+    EXPECT_OK_AND_ASSIGN(auto bound, predicate.Bind(*dataset_->schema()));
+    EXPECT_OK_AND_ASSIGN(auto fragments, dataset_->GetFragments(bound));
+    int count = 0;
+    for (const auto& fragment : fragments) {
+      ARROW_EXPECT_OK(fragment.status());
+      ++count;
+    }
+    return count;
+  }
+
+ protected:
+  std::shared_ptr<fs::FileSystem> fs_;
+  std::shared_ptr<FileFormat> format_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<Table> table_;
+  std::shared_ptr<Dataset> dataset_;
+};
+
+TEST_F(TestDatasetManifest, WrittenByDatasetWriter) {
+  WriteDataset();
+  ASSERT_OK_AND_ASSIGN(auto manifest, DatasetManifest::Read(fs_, "root"));
+
+  AssertSchemaEqual(*schema_, *manifest->schema());
+  AssertSchemaEqual(*schema({field("id", int64()), field("name", utf8())}),
+                    *manifest->physical_schema());
+  ASSERT_EQ(manifest->format_type_name(), "ipc");
+
+  const auto& fragments = manifest->fragments();
+  ASSERT_EQ(fragments.size(), 2);
+  ASSERT_EQ(fragments[0].path, "year=2020/part-0.arrow");
+  ASSERT_EQ(fragments[0].num_rows, 3);
+  ASSERT_GT(fragments[0].size, 0);
+  ASSERT_EQ(fragments[0].partition_expression,
+            equal(field_ref("year"), literal(2020)));
+  ASSERT_EQ(fragments[1].path, "year=2021/part-0.arrow");
+  ASSERT_EQ(fragments[1].num_rows, 2);
+
+  ASSERT_EQ(fragments[0].statistics.size(), 2);
+  const auto& id = fragments[0].statistics[0];
+  ASSERT_EQ(id.name, "id");
+  AssertScalarsEqual(*MakeScalar(int64_t(1)), *id.min);
+  AssertScalarsEqual(*MakeScalar(int64_t(5)), *id.max);
+  ASSERT_EQ(id.null_count, 0);
+  const auto& name = fragments[0].statistics[1];
+  ASSERT_EQ(name.name, "name");
+  AssertScalarsEqual(*MakeScalar("a"), *name.min);
+  AssertScalarsEqual(*MakeScalar("c"), *name.max);
+  ASSERT_EQ(name.null_count, 1);
+}
+
+TEST_F(TestDatasetManifest, SortKeys) {
+  WriteDataset();
+  ASSERT_OK_AND_ASSIGN(auto written, DatasetManifest::Read(fs_, "root"));
+  ASSERT_TRUE(written->sort_keys().empty());
+
+  DatasetManifest manifest(written->schema(), written->physical_schema(), "ipc",
+                           written->fragments(),
+                           {compute::SortKey("name"),
+                            compute::SortKey("id", compute::SortOrder::Descending)});
+  ASSERT_OK(manifest.Write(fs_, "root"));
+  ASSERT_OK_AND_ASSIGN(auto read_manifest, DatasetManifest::Read(fs_, "root"));
+  ASSERT_EQ(read_manifest->sort_keys(), manifest.sort_keys());
+}
+
+TEST_F(TestDatasetManifest, NotWrittenByDefault) {
+  WriteDataset(/*write_manifest=*/false);
+  ASSERT_RAISES(IOError, DatasetManifest::Read(fs_, "root"));
+}
+
+TEST_F(TestDatasetManifest, MakeDataset) {
+  WriteDataset();
+  ASSERT_OK_AND_ASSIGN(auto manifest, DatasetManifest::Read(fs_, "root"));
+  ASSERT_OK_AND_ASSIGN(dataset_, manifest->MakeDataset(fs_, "root", format_));
+  AssertSchemaEqual(*schema_, *dataset_->schema());
+
+  ASSERT_OK_AND_ASSIGN(auto scanner_builder, dataset_->NewScan());
+  ASSERT_OK(scanner_builder->Filter(greater(field_ref("id"), literal(int64_t(2)))));
+  ASSERT_OK_AND_ASSIGN(auto scanner, scanner_builder->Finish());
+  ASSERT_OK_AND_ASSIGN(auto num_rows, scanner->CountRows());
+  ASSERT_EQ(num_rows, 4);
+
+  // Fragments are pruned by their statistics as well as by their partitions
+  ASSERT_EQ(CountFragments(literal(true)), 2);
+  ASSERT_EQ(CountFragments(equal(field_ref("year"), literal(2021))), 1);
+  ASSERT_EQ(CountFragments(greater(field_ref("id"), literal(int64_t(6)))), 1);
+  ASSERT_EQ(CountFragments(less(field_ref("id"), literal(int64_t(0)))), 0);
+  ASSERT_EQ(CountFragments(equal(field_ref("name"), literal("b"))), 1);
+}
+
+TEST_F(TestDatasetManifest, PlanWithoutDataFiles) {
+  WriteDataset();
+  ASSERT_OK_AND_ASSIGN(auto manifest, DatasetManifest::Read(fs_, "root"));
+  ASSERT_OK_AND_ASSIGN(dataset_, manifest->MakeDataset(fs_, "root", format_));
+
+  // Neither pruning nor counting all rows needs to open the data files
+  for (const auto& fragment : manifest->fragments()) {
+    ASSERT_OK(fs_->DeleteFile("root/" + fragment.path));
+  }
+  ASSERT_EQ(CountFragments(greater(field_ref("id"), literal(int64_t(6)))), 1);
+  ASSERT_OK_AND_ASSIGN(auto scanner_builder, dataset_->NewScan());
+  ASSERT_OK_AND_ASSIGN(auto scanner, scanner_builder->Finish());
+  ASSERT_OK_AND_ASSIGN(auto num_rows, scanner->CountRows());
+  ASSERT_EQ(num_rows, 5);
+}
+
+TEST_F(TestDatasetManifest, FormatMismatch) {
+  WriteDataset();
+  ASSERT_OK_AND_ASSIGN(auto manifest, DatasetManifest::Read(fs_, "root"));
+  auto other_format = std::make_shared<IpcFileFormat>();
+  ASSERT_OK(manifest->MakeDataset(fs_, "root", other_format).status());
+
+  DatasetManifest renamed(manifest->schema(), manifest->physical_schema(), "parquet",
+                          manifest->fragments());
+  ASSERT_RAISES(Invalid, renamed.MakeDataset(fs_, "root", format_));
+}
+
+TEST(FragmentManifestEntry, Guarantee) {
+  FragmentManifestEntry entry;
+  entry.partition_expression = equal(field_ref("year"), literal(2020));
+
+  FragmentColumnStatistics range;
+  range.name = "id";
+  range.min = MakeScalar(int64_t(1));
+  range.max = MakeScalar(int64_t(5));
+  entry.statistics.push_back(range);
+
+  FragmentColumnStatistics single_value_or_null;
+  single_value_or_null.name = "name";
+  single_value_or_null.min = MakeScalar("a");
+  single_value_or_null.max = MakeScalar("a");
+  single_value_or_null.null_count = 2;
+  entry.statistics.push_back(single_value_or_null);
+
+  FragmentColumnStatistics all_null;
+  all_null.name = "flag";
+  all_null.null_count = 3;
+  entry.statistics.push_back(all_null);
+
+  ASSERT_EQ(entry.Guarantee(),
+            compute::and_(
+                {equal(field_ref("year"), literal(2020)),
+                 and_(greater_equal(field_ref("id"), literal(int64_t(1))),
+                      less_equal(field_ref("id"), literal(int64_t(5)))),
+                 or_(equal(field_ref("name"), literal("a")), is_null(field_ref("name"))),
+                 is_null(field_ref("flag"))}));
+}
+
+TEST(FragmentStatisticsCollector, MergesBatches) {
+  auto physical_schema = schema({field("f", float64()), field("l", list(int32()))});
+  FragmentStatisticsCollector collector(physical_schema);
+  ASSERT_OK(collector.Update(
+      *RecordBatchFromJSON(physical_schema, R"([{"f": 2.5, "l": [1]}, {"f": null}])")));
+  ASSERT_OK(collector.Update(
+      *RecordBatchFromJSON(physical_schema, R"([{"f": -1.0}, {"f": 0.5}])")));
+  ASSERT_EQ(collector.num_rows(), 4);
+
+  ASSERT_OK_AND_ASSIGN(auto statistics, collector.Finish());
+  // Lists have no statistics
+  ASSERT_EQ(statistics.size(), 1);
+  ASSERT_EQ(statistics[0].name, "f");
+  AssertScalarsEqual(*MakeScalar(-1.0), *statistics[0].min);
+  AssertScalarsEqual(*MakeScalar(2.5), *statistics[0].max);
+  ASSERT_EQ(statistics[0].null_count, 1);
+}
+
+}  // namespace dataset
+}  // namespace arrow
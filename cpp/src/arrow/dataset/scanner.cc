@@ -18,12 +18,17 @@
 #include "arrow/dataset/scanner.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <condition_variable>
+#include <deque>
+#include <iomanip>
 #include <memory>
 #include <mutex>
 #include <sstream>
 
 #include "arrow/array/array_primitive.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/array/util.h"
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/api_scalar.h"
@@ -31,11 +36,13 @@
 #include "arrow/compute/cast.h"
 #include "arrow/compute/exec/exec_plan.h"
 #include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/plan_optimizer.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/plan.h"
 #include "arrow/table.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/config.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
@@ -55,6 +62,133 @@ namespace dataset {
 
 using FragmentGenerator = std::function<Future<std::shared_ptr<Fragment>>()>;
 
+namespace {
+
+// Weight of a new observation in the running averages of ReadaheadTuner
+constexpr double kReadaheadSmoothing = 0.25;
+
+void UpdateAverage(double sample, double* average) {
+  if (*average == 0) {
+    *average = sample;
+  } else {
+    *average += kReadaheadSmoothing * (sample - *average);
+  }
+}
+
+}  // namespace
+
+ReadaheadTuner::ReadaheadTuner(int64_t readahead_bytes, int32_t max_fragment_readahead,
+                               int32_t max_batch_readahead)
+    : readahead_bytes_(readahead_bytes),
+      max_fragment_readahead_(std::max(max_fragment_readahead, 1)),
+      max_batch_readahead_(std::max(max_batch_readahead, 1)) {
+  // Start low until the size of batches is known
+  metrics_.fragment_readahead = std::min(max_fragment_readahead_, 2);
+  metrics_.batch_readahead = std::min(max_batch_readahead_, 2);
+}
+
+void ReadaheadTuner::RecordFragmentOpened(double seconds) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  UpdateAverage(seconds, &metrics_.fragment_open_seconds);
+  UpdateUnlocked();
+}
+
+void ReadaheadTuner::RecordBatchProduced(int64_t num_bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  double bytes_per_batch = static_cast<double>(metrics_.bytes_per_batch);
+  UpdateAverage(static_cast<double>(std::max<int64_t>(num_bytes, 1)), &bytes_per_batch);
+  metrics_.bytes_per_batch = static_cast<int64_t>(bytes_per_batch);
+  UpdateUnlocked();
+}
+
+void ReadaheadTuner::RecordFragmentFinished(int64_t num_batches) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  UpdateAverage(static_cast<double>(std::max<int64_t>(num_batches, 1)),
+                &metrics_.batches_per_fragment);
+  UpdateUnlocked();
+}
+
+void ReadaheadTuner::RecordBatchConsumed(double seconds) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  UpdateAverage(seconds, &metrics_.consumer_seconds_per_batch);
+  UpdateUnlocked();
+}
+
+int32_t ReadaheadTuner::fragment_readahead() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return metrics_.fragment_readahead;
+}
+
+int32_t ReadaheadTuner::batch_readahead() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return metrics_.batch_readahead;
+}
+
+ReadaheadMetrics ReadaheadTuner::metrics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return metrics_;
+}
+
+void ReadaheadTuner::UpdateUnlocked() {
+  int64_t fragments = metrics_.fragment_readahead;
+  if (metrics_.consumer_seconds_per_batch > 0 && metrics_.batches_per_fragment > 0) {
+    // Open enough fragments ahead that the next one is ready by the time the
+    // consumer is done with the current one
+    const double seconds_per_fragment =
+        metrics_.batches_per_fragment * metrics_.consumer_seconds_per_batch;
+    const double fragments_opening =
+        std::min(std::ceil(metrics_.fragment_open_seconds / seconds_per_fragment),
+                 static_cast<double>(max_fragment_readahead_));
+    fragments = 1 + static_cast<int64_t>(fragments_opening);
+  }
+  if (metrics_.bytes_per_batch == 0) {
+    metrics_.fragment_readahead =
+        static_cast<int32_t>(std::min<int64_t>(fragments, max_fragment_readahead_));
+    return;
+  }
+  // Each fragment being read holds at least the batch it is producing and one
+  // read ahead
+  fragments = std::min(fragments, readahead_bytes_ / (2 * metrics_.bytes_per_batch));
+  fragments = std::max<int64_t>(std::min<int64_t>(fragments, max_fragment_readahead_), 1);
+  const int64_t batches = readahead_bytes_ / (fragments * metrics_.bytes_per_batch) - 1;
+  metrics_.fragment_readahead = static_cast<int32_t>(fragments);
+  metrics_.batch_readahead = static_cast<int32_t>(
+      std::max<int64_t>(std::min<int64_t>(batches, max_batch_readahead_), 1));
+}
+
+std::string ScanStats::ToString() const {
+  std::stringstream ss;
+  ss << std::fixed << std::setprecision(3);
+  ss << "[fragments_scanned=" << fragments_scanned
+     << ", fragments_skipped=" << fragments_skipped << ", rows_pruned=" << rows_pruned
+     << ", batches_scanned=" << batches_scanned << ", rows_scanned=" << rows_scanned
+     << ", bytes_requested=" << bytes_requested << ", bytes_wasted=" << bytes_wasted
+     << ", io_wait_time=" << io_wait_time_ns / 1e6 << "ms"
+     << ", decompression_time=" << decompression_time_ns / 1e6 << "ms"
+     << ", decode_time=" << decode_time_ns / 1e6 << "ms]";
+  return ss.str();
+}
+
+ScanStats ScanStatsCollector::stats() const {
+  ScanStats stats;
+  stats.fragments_scanned = fragments_scanned_.load();
+  stats.fragments_skipped = fragments_skipped_.load();
+  stats.rows_pruned = rows_pruned_.load();
+  stats.batches_scanned = batches_scanned_.load();
+  stats.rows_scanned = rows_scanned_.load();
+  stats.bytes_requested = bytes_requested_.load();
+  stats.bytes_wasted = bytes_wasted_.load();
+  stats.io_wait_time_ns = io_wait_time_ns_.load();
+  stats.decompression_time_ns = decompression_time_ns_.load();
+  stats.decode_time_ns = decode_time_ns_.load();
+  return stats;
+}
+
+ScanStats Scanner::stats() const {
+  if (!scan_options_->stats_collector) return ScanStats{};
+  return scan_options_->stats_collector->stats();
+}
+
 std::vector<FieldRef> ScanOptions::MaterializedFields() const {
   std::vector<FieldRef> fields;
 
@@ -176,6 +310,16 @@ Status NormalizeScanOptions(const std::shared_ptr<ScanOptions>& scan_options,
                           scan_options->projection.Bind(Schema(std::move(fields))));
   }
 
+  if (!scan_options->stats_collector) {
+    scan_options->stats_collector = std::make_shared<ScanStatsCollector>();
+  }
+
+  if (scan_options->readahead_bytes > 0 && !scan_options->readahead_tuner) {
+    scan_options->readahead_tuner = std::make_shared<ReadaheadTuner>(
+        scan_options->readahead_bytes, scan_options->fragment_readahead,
+        scan_options->batch_readahead);
+  }
+
   return Status::OK();
 }
 
@@ -189,6 +333,10 @@ class AsyncScanner : public Scanner, public std::enable_shared_from_this<AsyncSc
                std::shared_ptr<ScanOptions> scan_options)
       : Scanner(std::move(scan_options)), dataset_(std::move(dataset)) {
     internal::Initialize();
+    // Shared by the copies of the options made by each scan
+    if (!scan_options_->stats_collector) {
+      scan_options_->stats_collector = std::make_shared<ScanStatsCollector>();
+    }
   }
 
   Status Scan(std::function<Status(TaggedRecordBatch)> visitor) override;
@@ -218,22 +366,43 @@ class AsyncScanner : public Scanner, public std::enable_shared_from_this<AsyncSc
   std::shared_ptr<Dataset> dataset_;
 };
 
-Result<EnumeratedRecordBatchGenerator> FragmentToBatches(
-    const Enumerated<std::shared_ptr<Fragment>>& fragment,
+double SecondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Reports the batches of a fragment, and how long it took to open, to the tuner
+RecordBatchGenerator MakeTunerReportingGenerator(RecordBatchGenerator gen,
+                                                std::shared_ptr<ReadaheadTuner> tuner) {
+  struct State {
+    std::chrono::steady_clock::time_point opened = std::chrono::steady_clock::now();
+    std::atomic<int64_t> num_batches{0};
+    std::atomic<bool> finished{false};
+  };
+  auto state = std::make_shared<State>();
+  return [gen, tuner, state]() {
+    return gen().Then([tuner, state](const std::shared_ptr<RecordBatch>& batch) {
+      if (IsIterationEnd(batch)) {
+        if (!state->finished.exchange(true)) {
+          tuner->RecordFragmentFinished(state->num_batches.load());
+        }
+        return batch;
+      }
+      if (state->num_batches.fetch_add(1) == 0) {
+        tuner->RecordFragmentOpened(SecondsSince(state->opened));
+      }
+      auto num_bytes = util::ReferencedBufferSize(*batch);
+      tuner->RecordBatchProduced(num_bytes.ok() ? *num_bytes
+                                                : util::TotalBufferSize(*batch));
+      return batch;
+    });
+  };
+}
+
+// Tags the batches of a fragment with their index and the fragment, yielding a single
+// empty batch if the fragment has none
+Result<EnumeratedRecordBatchGenerator> EnumerateFragmentBatches(
+    const Enumerated<std::shared_ptr<Fragment>>& fragment, RecordBatchGenerator batch_gen,
     const std::shared_ptr<ScanOptions>& options) {
-#ifdef ARROW_WITH_OPENTELEMETRY
-  auto tracer = arrow::internal::tracing::GetTracer();
-  auto span = tracer->StartSpan(
-      "arrow::dataset::FragmentToBatches",
-      {
-          {"arrow.dataset.fragment", fragment.value->ToString()},
-          {"arrow.dataset.fragment.index", fragment.index},
-          {"arrow.dataset.fragment.last", fragment.last},
-          {"arrow.dataset.fragment.type_name", fragment.value->type_name()},
-      });
-  auto scope = tracer->WithActiveSpan(span);
-#endif
-  ARROW_ASSIGN_OR_RAISE(auto batch_gen, fragment.value->ScanBatchesAsync(options));
   ArrayVector columns;
   for (const auto& field : options->dataset_schema->fields()) {
     // TODO(ARROW-7051): use helper to make empty batch
@@ -241,7 +410,6 @@ Result<EnumeratedRecordBatchGenerator> FragmentToBatches(
                           MakeArrayOfNull(field->type(), /*length=*/0, options->pool));
     columns.push_back(std::move(array));
   }
-  WRAP_ASYNC_GENERATOR(batch_gen);
   batch_gen = MakeDefaultIfEmptyGenerator(
       std::move(batch_gen),
       RecordBatch::Make(options->dataset_schema, /*num_rows=*/0, std::move(columns)));
@@ -255,14 +423,94 @@ Result<EnumeratedRecordBatchGenerator> FragmentToBatches(
   return MakeMappedGenerator(enumerated_batch_gen, std::move(combine_fn));
 }
 
+Result<EnumeratedRecordBatchGenerator> FragmentToBatches(
+    const Enumerated<std::shared_ptr<Fragment>>& fragment,
+    std::shared_ptr<ScanOptions> options) {
+  const auto& tuner = options->readahead_tuner;
+  if (tuner) {
+    options = std::make_shared<ScanOptions>(*options);
+    options->batch_readahead = tuner->batch_readahead();
+  }
+#ifdef ARROW_WITH_OPENTELEMETRY
+  auto tracer = arrow::internal::tracing::GetTracer();
+  auto span = tracer->StartSpan(
+      "arrow::dataset::FragmentToBatches",
+      {
+          {"arrow.dataset.fragment", fragment.value->ToString()},
+          {"arrow.dataset.fragment.index", fragment.index},
+          {"arrow.dataset.fragment.last", fragment.last},
+          {"arrow.dataset.fragment.type_name", fragment.value->type_name()},
+      });
+  auto scope = tracer->WithActiveSpan(span);
+#endif
+  ARROW_ASSIGN_OR_RAISE(auto batch_gen, fragment.value->ScanBatchesAsync(options));
+  if (const auto& stats_collector = options->stats_collector) {
+    stats_collector->RecordFragmentScanned();
+    batch_gen = MakeMappedGenerator(
+        std::move(batch_gen),
+        [stats_collector](const std::shared_ptr<RecordBatch>& batch) {
+          stats_collector->RecordBatchScanned(batch->num_rows());
+          return batch;
+        });
+  }
+  if (tuner) {
+    batch_gen = MakeTunerReportingGenerator(std::move(batch_gen), tuner);
+  }
+  WRAP_ASYNC_GENERATOR(batch_gen);
+  return EnumerateFragmentBatches(fragment, std::move(batch_gen), options);
+}
+
+// The batches of a fragment skipped by the runtime filters of the scan
+Result<EnumeratedRecordBatchGenerator> PrunedFragmentToBatches(
+    const Enumerated<std::shared_ptr<Fragment>>& fragment,
+    const std::shared_ptr<ScanOptions>& options) {
+  return EnumerateFragmentBatches(
+      fragment, MakeEmptyGenerator<std::shared_ptr<RecordBatch>>(), options);
+}
+
+// Narrows the filter of a scan by the key ranges of the runtime filters added so far, so
+// that fragments opened afterwards may skip data (such as Parquet row groups) by their
+// statistics
+std::shared_ptr<ScanOptions> WithRuntimeFilters(
+    const std::shared_ptr<ScanOptions>& options,
+    const compute::RuntimeFilterSet& runtime_filters) {
+  if (runtime_filters.empty()) return options;
+  auto filter = and_(options->filter, runtime_filters.key_range())
+                    .Bind(*options->dataset_schema);
+  if (!filter.ok()) return options;
+  auto narrowed = std::make_shared<ScanOptions>(*options);
+  narrowed->filter = filter.MoveValueUnsafe();
+  return narrowed;
+}
+
 Result<AsyncGenerator<EnumeratedRecordBatchGenerator>> FragmentsToBatches(
-    FragmentGenerator fragment_gen, const std::shared_ptr<ScanOptions>& options) {
+    FragmentGenerator fragment_gen, const std::shared_ptr<ScanOptions>& options,
+    std::shared_ptr<compute::RuntimeFilterSet> runtime_filters) {
   auto enumerated_fragment_gen = MakeEnumeratedGenerator(std::move(fragment_gen));
-  auto batch_gen_gen =
-      MakeMappedGenerator(std::move(enumerated_fragment_gen),
-                          [=](const Enumerated<std::shared_ptr<Fragment>>& fragment) {
-                            return FragmentToBatches(fragment, options);
-                          });
+  // Fragments of the same partition share the simplification of a filter
+  auto simplify_cache = std::make_shared<compute::SimplifyWithGuaranteeCache>();
+  auto batch_gen_gen = MakeMappedGenerator(
+      std::move(enumerated_fragment_gen),
+      [=](const Enumerated<std::shared_ptr<Fragment>>& fragment)
+          -> Result<EnumeratedRecordBatchGenerator> {
+        auto fragment_options = WithRuntimeFilters(options, *runtime_filters);
+        if (fragment_options != options) {
+          // Skip the fragments whose partition holds no key of the runtime filters,
+          // such as the partitions of a fact table for the dates excluded from the
+          // build side of a join, without opening them
+          ARROW_ASSIGN_OR_RAISE(
+              auto simplified,
+              simplify_cache->Simplify(fragment_options->filter,
+                                       fragment.value->partition_expression()));
+          if (!simplified.IsSatisfiable()) {
+            if (options->stats_collector) {
+              options->stats_collector->RecordFragmentsSkipped(1);
+            }
+            return PrunedFragmentToBatches(fragment, options);
+          }
+        }
+        return FragmentToBatches(fragment, std::move(fragment_options));
+      });
   PROPAGATE_SPAN_TO_GENERATOR(std::move(batch_gen_gen));
   return batch_gen_gen;
 }
@@ -360,8 +608,10 @@ Result<EnumeratedRecordBatchGenerator> AsyncScanner::ScanBatchesUnorderedAsync(
 
   auto exec_context =
       std::make_shared<compute::ExecContext>(scan_options_->pool, cpu_executor);
+  exec_context->set_stop_token(scan_options_->io_context.stop_token());
 
   ARROW_ASSIGN_OR_RAISE(auto plan, compute::ExecPlan::Make(exec_context.get()));
+  plan->set_task_priority(scan_options_->task_priority);
   AsyncGenerator<util::optional<compute::ExecBatch>> sink_gen;
 
   auto exprs = scan_options_->projection.call()->arguments;
@@ -369,10 +619,18 @@ Result<EnumeratedRecordBatchGenerator> AsyncScanner::ScanBatchesUnorderedAsync(
                    scan_options_->projection.call()->options.get())
                    ->field_names;
 
+  // Batches are tagged with their fragment, so must not be coalesced across fragments
+  auto scan_options = scan_options_;
+  if (scan_options->coalesce_batch_rows > 0 || scan_options->coalesce_batch_bytes > 0) {
+    scan_options = std::make_shared<ScanOptions>(*scan_options_);
+    scan_options->coalesce_batch_rows = scan_options->coalesce_batch_bytes = 0;
+  }
+
   RETURN_NOT_OK(
       compute::Declaration::Sequence(
           {
-              {"scan", ScanNodeOptions{dataset_, scan_options_, sequence_fragments}},
+              {"scan", ScanNodeOptions{dataset_, std::move(scan_options),
+                                       sequence_fragments}},
               {"filter", compute::FilterNodeOptions{scan_options_->filter}},
               {"augmented_project",
                compute::ProjectNodeOptions{std::move(exprs), std::move(names)}},
@@ -637,8 +895,10 @@ Result<int64_t> AsyncScanner::CountRows() {
   auto cpu_executor =
       scan_options_->use_threads ? ::arrow::internal::GetCpuThreadPool() : nullptr;
   compute::ExecContext exec_context(scan_options_->pool, cpu_executor);
+  exec_context.set_stop_token(scan_options_->io_context.stop_token());
 
   ARROW_ASSIGN_OR_RAISE(auto plan, compute::ExecPlan::Make(&exec_context));
+  plan->set_task_priority(scan_options_->task_priority);
   // Drop projection since we only need to count rows
   const auto options = std::make_shared<ScanOptions>(*scan_options_);
   ARROW_ASSIGN_OR_RAISE(auto empty_projection,
@@ -831,6 +1091,15 @@ Status ScannerBuilder::FragmentReadahead(int fragment_readahead) {
   return Status::OK();
 }
 
+Status ScannerBuilder::ReadaheadBytes(int64_t readahead_bytes) {
+  if (readahead_bytes <= 0) {
+    return Status::Invalid("ReadaheadBytes must be greater than 0, got ",
+                           readahead_bytes);
+  }
+  scan_options_->readahead_bytes = readahead_bytes;
+  return Status::OK();
+}
+
 Status ScannerBuilder::BatchSize(int64_t batch_size) {
   if (batch_size <= 0) {
     return Status::Invalid("BatchSize must be greater than 0, got ", batch_size);
@@ -855,6 +1124,11 @@ Status ScannerBuilder::Backpressure(compute::BackpressureOptions backpressure) {
   return Status::OK();
 }
 
+Status ScannerBuilder::TaskPriority(int32_t task_priority) {
+  scan_options_->task_priority = task_priority;
+  return Status::OK();
+}
+
 Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() {
   if (!scan_options_->projection.IsBound()) {
     RETURN_NOT_OK(Project(scan_options_->dataset_schema->field_names()));
@@ -865,6 +1139,262 @@ Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() {
 
 namespace {
 
+// Holds back opening fragments while as many as the tuner allows are being read
+class FragmentGate : public std::enable_shared_from_this<FragmentGate> {
+ public:
+  FragmentGate(AsyncGenerator<EnumeratedRecordBatchGenerator> source,
+               std::shared_ptr<ReadaheadTuner> tuner)
+      : source_(std::move(source)), tuner_(std::move(tuner)) {}
+
+  Future<EnumeratedRecordBatchGenerator> operator()() {
+    Future<> slot;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (waiting_.empty() && num_active_ < tuner_->fragment_readahead()) {
+        ++num_active_;
+        slot = Future<>::MakeFinished();
+      } else {
+        slot = Future<>::Make();
+        waiting_.push_back(slot);
+      }
+    }
+    auto self = shared_from_this();
+    return slot.Then([self] { return self->Pull(); });
+  }
+
+ private:
+  Future<EnumeratedRecordBatchGenerator> Pull() {
+    Future<EnumeratedRecordBatchGenerator> next;
+    {
+      // Waiting pulls may be let through from several threads at once
+      std::lock_guard<std::mutex> lock(source_mutex_);
+      next = source_();
+    }
+    auto self = shared_from_this();
+    return next.Then(
+        [self](const EnumeratedRecordBatchGenerator& batches)
+            -> EnumeratedRecordBatchGenerator {
+          if (IsIterationEnd(batches)) {
+            self->Release();
+            return batches;
+          }
+          return self->Track(batches);
+        },
+        [self](const Status& status) -> Result<EnumeratedRecordBatchGenerator> {
+          self->Release();
+          return status;
+        });
+  }
+
+  // Frees the fragment's slot once it is exhausted
+  EnumeratedRecordBatchGenerator Track(EnumeratedRecordBatchGenerator batches) {
+    auto self = shared_from_this();
+    auto finished = std::make_shared<std::atomic<bool>>(false);
+    return [self, batches, finished]() {
+      return batches().Then(
+          [self, finished](const EnumeratedRecordBatch& batch) {
+            if (IsIterationEnd(batch)) {
+              if (!finished->exchange(true)) self->Release();
+            } else {
+              // The tuner may have raised the limit
+              self->Admit();
+            }
+            return batch;
+          },
+          [self, finished](const Status& status) -> Result<EnumeratedRecordBatch> {
+            if (!finished->exchange(true)) self->Release();
+            return status;
+          });
+    };
+  }
+
+  void Release() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --num_active_;
+    }
+    Admit();
+  }
+
+  void Admit() {
+    std::vector<Future<>> admitted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      while (!waiting_.empty() && num_active_ < tuner_->fragment_readahead()) {
+        ++num_active_;
+        admitted.push_back(std::move(waiting_.front()));
+        waiting_.pop_front();
+      }
+    }
+    for (auto& slot : admitted) {
+      slot.MarkFinished();
+    }
+  }
+
+  AsyncGenerator<EnumeratedRecordBatchGenerator> source_;
+  std::shared_ptr<ReadaheadTuner> tuner_;
+  std::mutex source_mutex_;
+  std::mutex mutex_;
+  int32_t num_active_ = 0;
+  std::deque<Future<>> waiting_;
+};
+
+// Reports how long the consumer takes between receiving a batch and asking for
+// the next one to the tuner
+AsyncGenerator<EnumeratedRecordBatch> MakeTunerConsumerGenerator(
+    AsyncGenerator<EnumeratedRecordBatch> gen, std::shared_ptr<ReadaheadTuner> tuner) {
+  struct State {
+    std::mutex mutex;
+    bool delivered = false;
+    std::chrono::steady_clock::time_point delivered_at;
+  };
+  auto state = std::make_shared<State>();
+  return [gen, tuner, state]() {
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      if (state->delivered) {
+        state->delivered = false;
+        tuner->RecordBatchConsumed(SecondsSince(state->delivered_at));
+      }
+    }
+    return gen().Then([state](const EnumeratedRecordBatch& batch) {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->delivered = true;
+      state->delivered_at = std::chrono::steady_clock::now();
+      return batch;
+    });
+  };
+}
+
+// Concatenates batches of the same columns.  A column which is the same scalar in all of
+// them stays a scalar, and their guarantee is kept only if they all share it.
+Result<compute::ExecBatch> ConcatenateExecBatches(
+    const std::vector<compute::ExecBatch>& batches, MemoryPool* pool) {
+  compute::ExecBatch out = batches[0];
+  out.length = 0;
+  for (const auto& batch : batches) {
+    out.length += batch.length;
+    if (!(batch.guarantee == out.guarantee)) {
+      out.guarantee = compute::literal(true);
+    }
+  }
+  for (size_t i = 0; i < out.values.size(); ++i) {
+    bool same_scalar = out.values[i].is_scalar();
+    for (const auto& batch : batches) {
+      if (!same_scalar) break;
+      same_scalar = batch.values[i].is_scalar() &&
+                    batch.values[i].scalar()->Equals(*out.values[i].scalar());
+    }
+    if (same_scalar) continue;
+
+    ArrayVector pieces;
+    for (const auto& batch : batches) {
+      const Datum& value = batch.values[i];
+      if (value.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(auto piece,
+                              MakeArrayFromScalar(*value.scalar(), batch.length, pool));
+        pieces.push_back(std::move(piece));
+      } else {
+        pieces.push_back(value.make_array());
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto column, Concatenate(pieces, pool));
+    out.values[i] = std::move(column);
+  }
+  return out;
+}
+
+// Coalesces the batches of `gen`, in the order in which it yields them, into batches of
+// at most `max_rows` rows and about `max_bytes` bytes (0 for no bound), sliced from
+// larger batches.  Empty batches are dropped.
+AsyncGenerator<util::optional<compute::ExecBatch>> MakeCoalescingGenerator(
+    AsyncGenerator<util::optional<compute::ExecBatch>> gen, int64_t max_rows,
+    int64_t max_bytes, MemoryPool* pool) {
+  struct State {
+    Status Add(const compute::ExecBatch& batch) {
+      int64_t num_bytes = 0;
+      for (const auto& value : batch.values) {
+        if (!value.is_array()) continue;
+        auto referenced = util::ReferencedBufferSize(*value.array());
+        num_bytes +=
+            referenced.ok() ? *referenced : util::TotalBufferSize(*value.array());
+      }
+      const double bytes_per_row = static_cast<double>(num_bytes) / batch.length;
+
+      for (int64_t offset = 0; offset < batch.length;) {
+        int64_t num_rows = batch.length - offset;
+        if (max_rows > 0) {
+          num_rows = std::min(num_rows, max_rows - pending_rows);
+        }
+        if (max_bytes > 0 && bytes_per_row > 0) {
+          num_rows = std::min(
+              num_rows, std::max<int64_t>(1, static_cast<int64_t>(
+                                                 (max_bytes - pending_bytes) /
+                                                 bytes_per_row)));
+        }
+        pending.push_back(batch.Slice(offset, num_rows));
+        pending_rows += num_rows;
+        pending_bytes += num_rows * bytes_per_row;
+        offset += num_rows;
+        if ((max_rows > 0 && pending_rows >= max_rows) ||
+            (max_bytes > 0 && pending_bytes >= max_bytes)) {
+          RETURN_NOT_OK(Flush());
+        }
+      }
+      return Status::OK();
+    }
+
+    Status Flush() {
+      if (pending.size() == 1) {
+        ready.push_back(std::move(pending[0]));
+      } else if (pending.size() > 1) {
+        ARROW_ASSIGN_OR_RAISE(auto coalesced, ConcatenateExecBatches(pending, pool));
+        ready.push_back(std::move(coalesced));
+      }
+      pending.clear();
+      pending_rows = 0;
+      pending_bytes = 0;
+      return Status::OK();
+    }
+
+    int64_t max_rows, max_bytes;
+    MemoryPool* pool;
+    std::vector<compute::ExecBatch> pending;
+    int64_t pending_rows = 0;
+    double pending_bytes = 0;
+    std::deque<compute::ExecBatch> ready;
+    bool finished = false;
+  };
+  auto state = std::make_shared<State>();
+  state->max_rows = max_rows;
+  state->max_bytes = max_bytes;
+  state->pool = pool;
+
+  using OptionalBatch = util::optional<compute::ExecBatch>;
+  return [gen, state]() {
+    return Loop([gen, state]() -> Future<ControlFlow<OptionalBatch>> {
+      if (!state->ready.empty()) {
+        OptionalBatch batch = std::move(state->ready.front());
+        state->ready.pop_front();
+        return Break(std::move(batch));
+      }
+      if (state->finished) {
+        return Break(OptionalBatch());
+      }
+      return gen().Then(
+          [state](const OptionalBatch& batch) -> Result<ControlFlow<OptionalBatch>> {
+            if (IsIterationEnd(batch)) {
+              state->finished = true;
+              RETURN_NOT_OK(state->Flush());
+            } else if (batch->length > 0) {
+              RETURN_NOT_OK(state->Add(*batch));
+            }
+            return ControlFlow<OptionalBatch>(Continue());
+          });
+    });
+  };
+}
+
 Result<compute::ExecNode*> MakeScanNode(compute::ExecPlan* plan,
                                         std::vector<compute::ExecNode*> inputs,
                                         const compute::ExecNodeOptions& options) {
@@ -873,15 +1403,53 @@ Result<compute::ExecNode*> MakeScanNode(compute::ExecPlan* plan,
   auto dataset = scan_node_options.dataset;
   bool require_sequenced_output = scan_node_options.require_sequenced_output;
 
+  if (!scan_options->stats_collector) {
+    // Before any copy, so that the stats can be read from the given options
+    scan_options->stats_collector = std::make_shared<ScanStatsCollector>();
+  }
+
+  if (plan->memory_governor()) {
+    // Count the reads and readahead of the scan against the plan's memory limit
+    scan_options = std::make_shared<ScanOptions>(*scan_options);
+    scan_options->pool = plan->exec_context()->memory_pool();
+  }
+
+  const StopToken& plan_stop_token = plan->exec_context()->stop_token();
+  if (plan_stop_token.IsStoppable() &&
+      !scan_options->io_context.stop_token().IsStoppable()) {
+    // Abort the reads of the scan when the plan is cancelled
+    const io::IOContext& io_context = scan_options->io_context;
+    scan_options = std::make_shared<ScanOptions>(*scan_options);
+    scan_options->io_context = io::IOContext(io_context.pool(), io_context.executor(),
+                                             plan_stop_token, io_context.external_id());
+  }
+  const StopToken stop_token = scan_options->io_context.stop_token();
+
   RETURN_NOT_OK(NormalizeScanOptions(scan_options, dataset->schema()));
 
   // using a generator for speculative forward compatibility with async fragment discovery
   ARROW_ASSIGN_OR_RAISE(auto fragments_it, dataset->GetFragments(scan_options->filter));
   ARROW_ASSIGN_OR_RAISE(auto fragments_vec, fragments_it.ToVector());
-  auto fragment_gen = MakeVectorGenerator(std::move(fragments_vec));
+  if (dataset->type_name() == "filesystem") {
+    // The fragments of other datasets are not all known up front
+    const auto& filesystem_dataset = checked_cast<const FileSystemDataset&>(*dataset);
+    scan_options->stats_collector->RecordFragmentsSkipped(static_cast<int64_t>(
+        filesystem_dataset.files().size() - fragments_vec.size()));
+  }
+  // Once cancelled, no more fragments are opened
+  auto fragment_gen =
+      MakeCancellable(MakeVectorGenerator(std::move(fragments_vec)), stop_token);
 
-  ARROW_ASSIGN_OR_RAISE(auto batch_gen_gen,
-                        FragmentsToBatches(std::move(fragment_gen), scan_options));
+  // Filters pushed down by the consumers of the scan once it has started
+  auto runtime_filters = std::make_shared<compute::RuntimeFilterSet>();
+  ARROW_ASSIGN_OR_RAISE(
+      auto batch_gen_gen,
+      FragmentsToBatches(std::move(fragment_gen), scan_options, runtime_filters));
+  if (scan_options->readahead_tuner) {
+    auto gate = std::make_shared<FragmentGate>(std::move(batch_gen_gen),
+                                               scan_options->readahead_tuner);
+    batch_gen_gen = [gate] { return (*gate)(); };
+  }
 
   AsyncGenerator<EnumeratedRecordBatch> merged_batch_gen;
   if (require_sequenced_output) {
@@ -893,8 +1461,14 @@ Result<compute::ExecNode*> MakeScanNode(compute::ExecPlan* plan,
         MakeMergedGenerator(std::move(batch_gen_gen), scan_options->fragment_readahead);
   }
 
-  auto batch_gen = MakeReadaheadGenerator(std::move(merged_batch_gen),
-                                          scan_options->fragment_readahead);
+  // Once cancelled, the readahead stops pulling batches
+  auto batch_gen =
+      MakeReadaheadGenerator(MakeCancellable(std::move(merged_batch_gen), stop_token),
+                             scan_options->fragment_readahead);
+  if (scan_options->readahead_tuner) {
+    batch_gen =
+        MakeTunerConsumerGenerator(std::move(batch_gen), scan_options->readahead_tuner);
+  }
 
   auto gen = MakeMappedGenerator(
       std::move(batch_gen),
@@ -920,6 +1494,11 @@ Result<compute::ExecNode*> MakeScanNode(compute::ExecPlan* plan,
         batch->values.emplace_back(partial.fragment.value->ToString());
         return batch;
       });
+  if (scan_options->coalesce_batch_rows > 0 || scan_options->coalesce_batch_bytes > 0) {
+    gen = MakeCoalescingGenerator(std::move(gen), scan_options->coalesce_batch_rows,
+                                  scan_options->coalesce_batch_bytes,
+                                  scan_options->pool);
+  }
 
   auto fields = scan_options->dataset_schema->fields();
   for (const auto& aug_field : kAugmentedFields) {
@@ -928,7 +1507,8 @@ Result<compute::ExecNode*> MakeScanNode(compute::ExecPlan* plan,
 
   return compute::MakeExecNode(
       "source", plan, {},
-      compute::SourceNodeOptions{schema(std::move(fields)), std::move(gen)});
+      compute::SourceNodeOptions{schema(std::move(fields)), std::move(gen),
+                                 std::move(runtime_filters)});
 }
 
 Result<compute::ExecNode*> MakeAugmentedProjectNode(
@@ -1034,6 +1614,103 @@ Result<compute::ExecNode*> MakeOrderedSinkNode(compute::ExecPlan* plan,
   return node;
 }
 
+// The options of a scan declaration with a copy of its scan options to modify
+std::shared_ptr<ScanNodeOptions> CopyScanNodeOptions(const ScanNodeOptions& options) {
+  if (!options.scan_options->stats_collector) {
+    // Before the copy, so that the stats can be read from the given options
+    options.scan_options->stats_collector = std::make_shared<ScanStatsCollector>();
+  }
+  auto copy = std::make_shared<ScanNodeOptions>(options);
+  copy->scan_options = std::make_shared<ScanOptions>(*options.scan_options);
+  return copy;
+}
+
+const std::shared_ptr<Schema>& ScanDatasetSchema(const ScanNodeOptions& options) {
+  if (options.scan_options->dataset_schema) return options.scan_options->dataset_schema;
+  return options.dataset->schema();
+}
+
+compute::SourceOptimizerRules ScanOptimizerRules() {
+  compute::SourceOptimizerRules rules;
+  rules.output_schema = [](const compute::ExecNodeOptions& options)
+      -> Result<std::shared_ptr<Schema>> {
+    const auto& scan_options = checked_cast<const ScanNodeOptions&>(options);
+    if (!scan_options.dataset || !scan_options.scan_options) return nullptr;
+    auto fields = ScanDatasetSchema(scan_options)->fields();
+    fields.insert(fields.end(), kAugmentedFields.begin(), kAugmentedFields.end());
+    return schema(std::move(fields));
+  };
+
+  // The filter prunes fragments and row groups, the rows are filtered above the scan
+  rules.push_filter = [](const compute::ExecNodeOptions& options,
+                         const compute::Expression& filter)
+      -> Result<std::shared_ptr<compute::ExecNodeOptions>> {
+    const auto& scan_options = checked_cast<const ScanNodeOptions&>(options);
+    const auto& dataset_schema = ScanDatasetSchema(scan_options);
+    for (const auto& ref : compute::FieldsInExpression(filter)) {
+      // e.g. the augmented fields
+      if (!ref.FindOne(*dataset_schema).ok()) return nullptr;
+    }
+    auto copy = CopyScanNodeOptions(scan_options);
+    copy->scan_options->filter = and_(copy->scan_options->filter, filter);
+    return copy;
+  };
+
+  rules.prune_columns = [](const compute::ExecNodeOptions& options,
+                           const std::vector<int>& columns)
+      -> Result<std::shared_ptr<compute::ExecNodeOptions>> {
+    const auto& scan_options = checked_cast<const ScanNodeOptions&>(options);
+    const auto& dataset_schema = ScanDatasetSchema(scan_options);
+    // Keep the columns the scan is already restricted to
+    std::vector<bool> projected(dataset_schema->num_fields(), true);
+    const auto& projection = scan_options.scan_options->projection;
+    if (!Identical(projection, compute::Expression())) {
+      projected.assign(projected.size(), false);
+      for (const auto& ref : compute::FieldsInExpression(projection)) {
+        auto maybe_path = ref.FindOne(*dataset_schema);
+        if (!maybe_path.ok()) return nullptr;
+        projected[maybe_path->indices()[0]] = true;
+      }
+    }
+    std::vector<std::string> names;
+    for (int i : columns) {
+      if (i < dataset_schema->num_fields() && projected[i]) {
+        names.push_back(dataset_schema->field(i)->name());
+      }
+    }
+    // Scanning no columns is left to the scan as it is
+    if (names.empty()) return nullptr;
+    ARROW_ASSIGN_OR_RAISE(auto descr,
+                          ProjectionDescr::FromNames(std::move(names), *dataset_schema));
+    auto copy = CopyScanNodeOptions(scan_options);
+    SetProjection(copy->scan_options.get(), std::move(descr));
+    return copy;
+  };
+
+  // Only the row counts of in-memory datasets are known without reading
+  rules.estimate_rows =
+      [](const compute::ExecNodeOptions& options) -> util::optional<int64_t> {
+    const auto& scan_options = checked_cast<const ScanNodeOptions&>(options);
+    if (!scan_options.dataset || scan_options.dataset->type_name() != "in-memory") {
+      return util::nullopt;
+    }
+    auto maybe_fragments = scan_options.dataset->GetFragments();
+    if (!maybe_fragments.ok()) return util::nullopt;
+    int64_t total = 0;
+    for (auto maybe_fragment : *maybe_fragments) {
+      if (!maybe_fragment.ok()) return util::nullopt;
+      auto count = (*maybe_fragment)
+                       ->CountRows(compute::literal(true), scan_options.scan_options);
+      if (!count.is_finished() || !count.result().ok() || !count.result()->has_value()) {
+        return util::nullopt;
+      }
+      total += **count.result();
+    }
+    return total;
+  };
+  return rules;
+}
+
 }  // namespace
 
 namespace internal {
@@ -1041,6 +1718,7 @@ void InitializeScanner(arrow::compute::ExecFactoryRegistry* registry) {
   DCHECK_OK(registry->AddFactory("scan", MakeScanNode));
   DCHECK_OK(registry->AddFactory("ordered_sink", MakeOrderedSinkNode));
   DCHECK_OK(registry->AddFactory("augmented_project", MakeAugmentedProjectNode));
+  DCHECK_OK(compute::RegisterSourceOptimizerRules("scan", ScanOptimizerRules()));
 }
 }  // namespace internal
 
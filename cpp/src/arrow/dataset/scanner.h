@@ -19,8 +19,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -55,6 +57,133 @@ constexpr int64_t kDefaultBatchSize = 1 << 17;  // 128Ki rows
 constexpr int32_t kDefaultBatchReadahead = 16;
 constexpr int32_t kDefaultFragmentReadahead = 4;
 
+/// \brief Readahead levels chosen by a ReadaheadTuner, and the observations
+/// they were derived from.
+struct ARROW_DS_EXPORT ReadaheadMetrics {
+  /// How many fragments are currently allowed to be read at once
+  int32_t fragment_readahead = 0;
+  /// How many batches a newly opened fragment reads ahead
+  int32_t batch_readahead = 0;
+  /// Average size of the batches produced by fragments
+  int64_t bytes_per_batch = 0;
+  /// Average number of batches per fragment
+  double batches_per_fragment = 0;
+  /// Average time from opening a fragment to its first batch
+  double fragment_open_seconds = 0;
+  /// Average time the consumer of the scan spends on each batch
+  double consumer_seconds_per_batch = 0;
+};
+
+/// \brief Tunes the fragment and batch readahead of scans at runtime.
+///
+/// Enough fragments are read at once to hide the time it takes to open one
+/// behind the consumption of the others, so datasets of many small files get
+/// a high fragment readahead while datasets of large files get a low one.
+/// The memory held by readahead, i.e. the number of fragments times the batches
+/// each reads ahead times the observed batch size, is kept within a budget of
+/// bytes.  The readahead levels of ScanOptions are used as upper bounds.
+///
+/// All methods are thread-safe.
+class ARROW_DS_EXPORT ReadaheadTuner {
+ public:
+  ReadaheadTuner(int64_t readahead_bytes, int32_t max_fragment_readahead,
+                 int32_t max_batch_readahead);
+
+  /// \brief Record the time from opening a fragment to its first batch
+  void RecordFragmentOpened(double seconds);
+  /// \brief Record a batch produced by a fragment
+  void RecordBatchProduced(int64_t num_bytes);
+  /// \brief Record a fragment which has produced all of its batches
+  void RecordFragmentFinished(int64_t num_batches);
+  /// \brief Record the time the consumer of the scan spent on a batch
+  void RecordBatchConsumed(double seconds);
+
+  int32_t fragment_readahead() const;
+  int32_t batch_readahead() const;
+  int64_t readahead_bytes() const { return readahead_bytes_; }
+
+  /// \brief The current readahead levels and observations
+  ReadaheadMetrics metrics() const;
+
+ private:
+  void UpdateUnlocked();
+
+  const int64_t readahead_bytes_;
+  const int32_t max_fragment_readahead_;
+  const int32_t max_batch_readahead_;
+  mutable std::mutex mutex_;
+  ReadaheadMetrics metrics_;
+};
+
+/// \brief Where the time and bytes of scans went, as gathered by a ScanStatsCollector
+///
+/// Bytes and times are reported by the fragments which support them, currently
+/// Parquet fragments.  Times are in nanoseconds and are summed over the threads doing
+/// the work, so they may exceed the wall clock time of a parallel scan.
+struct ARROW_DS_EXPORT ScanStats {
+  /// Fragments handed to their format to be scanned
+  int64_t fragments_scanned = 0;
+  /// Fragments skipped without reading their data, because of their partition
+  /// expression, the runtime filters of the scan or the statistics of all their row
+  /// groups.  The latter were also counted in fragments_scanned.
+  int64_t fragments_skipped = 0;
+  /// Rows of the row groups skipped because of their statistics, page index or Bloom
+  /// filters
+  int64_t rows_pruned = 0;
+  /// Batches and rows produced by the fragments, before filtering
+  int64_t batches_scanned = 0;
+  int64_t rows_scanned = 0;
+  /// Bytes of data requested from the files
+  int64_t bytes_requested = 0;
+  /// Bytes read in addition to bytes_requested because nearby reads were coalesced,
+  /// see io::CacheOptions
+  int64_t bytes_wasted = 0;
+  /// Time spent waiting for data to be read
+  int64_t io_wait_time_ns = 0;
+  /// Time spent decompressing data
+  int64_t decompression_time_ns = 0;
+  /// Time spent decoding data into Arrow arrays, including decompression_time_ns and
+  /// the part of io_wait_time_ns spent blocking in the decoding threads
+  int64_t decode_time_ns = 0;
+
+  std::string ToString() const;
+};
+
+/// \brief Gathers the ScanStats of the scans run with a ScanOptions.
+///
+/// Counters are updated with atomic additions, at most a few per batch, so that
+/// statistics can be gathered for every scan.  All methods are thread-safe.
+class ARROW_DS_EXPORT ScanStatsCollector {
+ public:
+  void RecordFragmentScanned() { ++fragments_scanned_; }
+  void RecordFragmentsSkipped(int64_t num_fragments) {
+    fragments_skipped_ += num_fragments;
+  }
+  void RecordRowsPruned(int64_t num_rows) { rows_pruned_ += num_rows; }
+  void RecordBatchScanned(int64_t num_rows) {
+    ++batches_scanned_;
+    rows_scanned_ += num_rows;
+  }
+  void RecordIo(int64_t bytes_requested, int64_t bytes_wasted, int64_t wait_time_ns) {
+    bytes_requested_ += bytes_requested;
+    bytes_wasted_ += bytes_wasted;
+    io_wait_time_ns_ += wait_time_ns;
+  }
+  void RecordDecode(int64_t decompression_time_ns, int64_t decode_time_ns) {
+    decompression_time_ns_ += decompression_time_ns;
+    decode_time_ns_ += decode_time_ns;
+  }
+
+  /// \brief The statistics gathered so far
+  ScanStats stats() const;
+
+ private:
+  std::atomic<int64_t> fragments_scanned_{0}, fragments_skipped_{0}, rows_pruned_{0};
+  std::atomic<int64_t> batches_scanned_{0}, rows_scanned_{0};
+  std::atomic<int64_t> bytes_requested_{0}, bytes_wasted_{0}, io_wait_time_ns_{0};
+  std::atomic<int64_t> decompression_time_ns_{0}, decode_time_ns_{0};
+};
+
 /// Scan-specific options, which can be changed between scans of the same dataset.
 struct ARROW_DS_EXPORT ScanOptions {
   /// A row filter (which will be pushed down to partitioning/reading if supported).
@@ -98,12 +227,50 @@ struct ARROW_DS_EXPORT ScanOptions {
   /// Note: Will be ignored if use_threads is set to false
   int32_t fragment_readahead = kDefaultFragmentReadahead;
 
+  /// If positive, tune fragment and batch readahead at runtime so that they hold
+  /// about this many bytes, using batch_readahead and fragment_readahead as upper
+  /// bounds.  See ReadaheadTuner.
+  ///
+  /// Set to 0 (the default) to always use batch_readahead and fragment_readahead
+  int64_t readahead_bytes = 0;
+
+  /// The tuner of adaptive readahead, created when the scan options are
+  /// normalized if readahead_bytes is positive.  Its metrics() give the current
+  /// readahead levels.
+  std::shared_ptr<ReadaheadTuner> readahead_tuner;
+
+  /// If positive, a ScanNode coalesces the batches it outputs, across fragments, into
+  /// batches of at most this many rows, and slices larger batches.  Datasets of many
+  /// small files then yield batches of a uniform size instead of one small batch per
+  /// file.  Batches are coalesced in the order in which they are scanned, which is
+  /// the order of the dataset if ScanNodeOptions::require_sequenced_output is set.
+  ///
+  /// The columns which differ between coalesced batches, such as the partition and
+  /// the __fragment_index columns, are materialized as arrays.  The Scanner tags each
+  /// batch with its fragment and so does not coalesce them.
+  ///
+  /// Set to 0 (the default) to output the batches as they are read.
+  int64_t coalesce_batch_rows = 0;
+
+  /// If positive, a ScanNode also bounds the batches it coalesces (see
+  /// coalesce_batch_rows) to about this many bytes, e.g. the size of a CPU cache.
+  int64_t coalesce_batch_bytes = 0;
+
+  /// The collector of the statistics of the scans run with these options, created when
+  /// the scan options are normalized if not given.  The statistics of a ScanNode are
+  /// those of its ScanNodeOptions::scan_options.
+  std::shared_ptr<ScanStatsCollector> stats_collector;
+
   /// A pool from which materialized and scanned arrays will be allocated.
   MemoryPool* pool = arrow::default_memory_pool();
 
   /// IOContext for any IO tasks
   ///
   /// Note: The IOContext executor will be ignored if use_threads is set to false
+  /// Note: Its stop token cancels the scan: no more fragments or batches are read
+  /// and the reads in flight are aborted where the filesystem supports it.  When
+  /// scanning in an ExecPlan, the token of the plan's ExecContext is used if this
+  /// one is unstoppable.
   io::IOContext io_context;
 
   /// If true the scanner will scan in parallel
@@ -113,6 +280,12 @@ struct ARROW_DS_EXPORT ScanOptions {
   /// Note: This  must be true in order for any readahead to happen
   bool use_threads = false;
 
+  /// Scheduling priority of the scan's CPU tasks, see TaskHints::priority
+  ///
+  /// The lower the more urgent.  Lets interactive scans run ahead of large batch scans
+  /// sharing the same CPU thread pool.
+  int32_t task_priority = 0;
+
   /// Fragment-specific scan options.
   std::shared_ptr<FragmentScanOptions> fragment_scan_options;
 
@@ -299,6 +472,8 @@ class ARROW_DS_EXPORT Scanner {
 
   /// \brief Get the options for this scan.
   const std::shared_ptr<ScanOptions>& options() const { return scan_options_; }
+  /// \brief Get the statistics of the scans run so far by this scanner
+  ScanStats stats() const;
   /// \brief Get the dataset that this scanner will scan
   virtual const std::shared_ptr<Dataset>& dataset() const = 0;
 
@@ -376,6 +551,11 @@ class ARROW_DS_EXPORT ScannerBuilder {
   /// \brief Limit how many fragments the scanner will read at once
   Status FragmentReadahead(int fragment_readahead);
 
+  /// \brief Tune readahead at runtime to hold about this many bytes
+  ///
+  /// \see ScanOptions::readahead_bytes
+  Status ReadaheadBytes(int64_t readahead_bytes);
+
   /// \brief Set the maximum number of rows per RecordBatch.
   ///
   /// \param[in] batch_size the maximum number of rows.
@@ -393,6 +573,10 @@ class ARROW_DS_EXPORT ScannerBuilder {
   /// \brief Override default backpressure configuration
   Status Backpressure(compute::BackpressureOptions backpressure);
 
+  /// \brief Set the scheduling priority of the scan's CPU tasks, the lower the more
+  ///        urgent (see ScanOptions::task_priority)
+  Status TaskPriority(int32_t task_priority);
+
   /// \brief Return the constructed now-immutable Scanner object
   Result<std::shared_ptr<Scanner>> Finish();
 
@@ -165,6 +165,42 @@ TEST_P(TestScanner, ScanBatchesUnordered) {
   AssertScanBatchesUnorderedEqualRepetitionsOf(MakeScanner(batch), batch);
 }
 
+TEST_P(TestScanner, ScanWithReadaheadBytes) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(GetParam().items_per_batch, schema_);
+  options_->readahead_bytes = 1 << 20;
+  auto scanner = MakeScanner(batch);
+  AssertScanBatchesEqualRepetitionsOf(scanner, batch);
+
+  const auto& tuner = scanner->options()->readahead_tuner;
+  ASSERT_NE(tuner, nullptr);
+  auto metrics = tuner->metrics();
+  ASSERT_GE(metrics.fragment_readahead, 1);
+  ASSERT_GE(metrics.batch_readahead, 1);
+  ASSERT_GT(metrics.bytes_per_batch, 0);
+}
+
+TEST_P(TestScanner, ScanStats) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(GetParam().items_per_batch, schema_);
+  auto scanner = MakeScanner(batch);
+  AssertScanBatchesEqualRepetitionsOf(scanner, batch);
+
+  // Each batch is a fragment of its own, and in-memory fragments do no I/O
+  const int64_t total_batches = GetParam().num_child_datasets * GetParam().num_batches;
+  ScanStats stats = scanner->stats();
+  ASSERT_EQ(stats.fragments_scanned, total_batches);
+  ASSERT_EQ(stats.fragments_skipped, 0);
+  ASSERT_EQ(stats.batches_scanned, total_batches);
+  ASSERT_EQ(stats.rows_scanned, total_batches * GetParam().items_per_batch);
+  ASSERT_EQ(stats.bytes_requested, 0);
+  ASSERT_EQ(stats.decode_time_ns, 0);
+
+  // Statistics add up over the scans of a scanner
+  AssertScanBatchesEqualRepetitionsOf(scanner, batch);
+  ASSERT_EQ(scanner->stats().batches_scanned, 2 * total_batches);
+}
+
 TEST_P(TestScanner, ScanWithCappedBatchSize) {
   SetSchema({field("i32", int32()), field("f64", float64())});
   auto batch = ConstantArrayGenerator::Zeroes(GetParam().items_per_batch, schema_);
@@ -1231,6 +1267,49 @@ TEST_F(TestScannerBuilder, TestFilter) {
                                    equal(field_ref("not_a_column"), literal(true)))));
 }
 
+TEST_F(TestScannerBuilder, TestReadaheadBytes) {
+  ScannerBuilder builder(dataset_, options_);
+
+  ASSERT_OK(builder.ReadaheadBytes(1 << 20));
+  ASSERT_RAISES(Invalid, builder.ReadaheadBytes(0));
+  ASSERT_RAISES(Invalid, builder.ReadaheadBytes(-1));
+
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  ASSERT_NE(scanner->options()->readahead_tuner, nullptr);
+  ASSERT_EQ(scanner->options()->readahead_tuner->readahead_bytes(), 1 << 20);
+}
+
+TEST(ReadaheadTuner, LargeBatchesLimitReadahead) {
+  ReadaheadTuner tuner(/*readahead_bytes=*/4 << 20, /*max_fragment_readahead=*/8,
+                       /*max_batch_readahead=*/16);
+  for (int i = 0; i < 4; ++i) {
+    tuner.RecordFragmentOpened(0.1);
+    tuner.RecordBatchProduced(2 << 20);
+    tuner.RecordBatchConsumed(0.001);
+    tuner.RecordFragmentFinished(1);
+  }
+  ASSERT_EQ(tuner.fragment_readahead(), 1);
+  ASSERT_EQ(tuner.batch_readahead(), 1);
+}
+
+TEST(ReadaheadTuner, SlowOpensRaiseFragmentReadahead) {
+  ReadaheadTuner tuner(/*readahead_bytes=*/1 << 30, /*max_fragment_readahead=*/8,
+                       /*max_batch_readahead=*/16);
+  for (int i = 0; i < 4; ++i) {
+    tuner.RecordFragmentOpened(0.1);
+    tuner.RecordBatchProduced(1 << 10);
+    tuner.RecordBatchConsumed(0.01);
+    tuner.RecordFragmentFinished(2);
+  }
+  // Opening a fragment takes as long as consuming five of them
+  ASSERT_EQ(tuner.fragment_readahead(), 6);
+  ASSERT_EQ(tuner.batch_readahead(), 16);
+
+  auto metrics = tuner.metrics();
+  ASSERT_EQ(metrics.bytes_per_batch, 1 << 10);
+  ASSERT_DOUBLE_EQ(metrics.batches_per_fragment, 2);
+}
+
 TEST(ScanOptions, TestMaterializedFields) {
   auto i32 = field("i32", int32());
   auto i64 = field("i64", int64());
@@ -1599,6 +1678,84 @@ TEST(ScanNode, DeferredFilterOnPhysicalColumn) {
   ASSERT_THAT(plan.Run(), Finishes(ResultWith(UnorderedElementsAreArray(expected))));
 }
 
+TEST(ScanNode, FragmentsPrunedByRuntimeFilter) {
+  TestPlan plan;
+
+  auto basic = MakeBasicDataset();
+
+  auto options = std::make_shared<ScanOptions>();
+  // ensure all fields are materialized
+  options->projection = Materialize({"a", "b", "c"}, /*include_aug_fields=*/true);
+
+  ASSERT_OK_AND_ASSIGN(auto scan,
+                       compute::MakeExecNode("scan", plan.get(), {},
+                                             ScanNodeOptions{basic.dataset, options}));
+  ASSERT_OK(compute::MakeExecNode("sink", plan.get(), {scan},
+                                  compute::SinkNodeOptions{&plan.sink_gen}));
+
+  // As pushed down by a hash join on "c" whose build side only holds the key 47
+  auto* target = dynamic_cast<compute::RuntimeFilterTarget*>(scan);
+  ASSERT_NE(target, nullptr);
+  target->runtime_filters()->Add(std::make_shared<compute::RuntimeFilter>(
+      nullptr, std::vector<int>{2},
+      call("is_in", {field_ref("c")},
+           compute::SetLookupOptions(ArrayFromJSON(int32(), "[47]")))));
+
+  // The fragment of the partition c == 23 is not scanned and yields a single empty batch
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, plan.Run());
+  std::vector<compute::ExecBatch> nonempty;
+  for (auto& batch : batches) {
+    if (batch.length > 0) nonempty.push_back(std::move(batch));
+  }
+  auto expected = basic.batches;
+  expected.erase(expected.begin(), expected.begin() + 2);
+  ASSERT_THAT(nonempty, UnorderedElementsAreArray(expected));
+
+  ASSERT_NE(options->stats_collector, nullptr);
+  ScanStats stats = options->stats_collector->stats();
+  ASSERT_EQ(stats.fragments_scanned, 1);
+  ASSERT_EQ(stats.fragments_skipped, 1);
+  ASSERT_EQ(stats.batches_scanned, 2);
+  ASSERT_EQ(stats.rows_scanned, 5);
+}
+
+TEST(ScanNode, CoalescedBatches) {
+  TestPlan plan;
+
+  auto basic = MakeBasicDataset();
+
+  auto options = std::make_shared<ScanOptions>();
+  // ensure all fields are materialized
+  options->projection = Materialize({"a", "b", "c"}, /*include_aug_fields=*/true);
+  options->coalesce_batch_rows = 3;
+
+  ASSERT_OK(compute::Declaration::Sequence(
+                {
+                    {"scan", ScanNodeOptions{basic.dataset, options,
+                                             /*require_sequenced_output=*/true}},
+                    {"sink", compute::SinkNodeOptions{&plan.sink_gen}},
+                })
+                .AddToPlan(plan.get()));
+
+  // The batches of 2, 2, 2 and 3 rows are coalesced, in order, into batches of 3 rows
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, plan.Run());
+  ASSERT_EQ(batches.size(), 3);
+  for (const auto& batch : batches) {
+    ASSERT_EQ(batch.length, 3);
+  }
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[1, 2, null]"), batches[0][0]);
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[3, null, 4]"), batches[1][0]);
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[5, 6, 7]"), batches[2][0]);
+
+  // Columns and guarantees which differ between the coalesced batches are not kept
+  AssertDatumsEqual(Datum(0), batches[0][3]);
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[0, 0, 1]"), batches[0][4]);
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[0, 1, 1]"), batches[1][3]);
+  ASSERT_EQ(batches[0].guarantee, equal(field_ref("c"), literal(23)));
+  ASSERT_EQ(batches[1].guarantee, literal(true));
+  ASSERT_EQ(batches[2].guarantee, equal(field_ref("c"), literal(47)));
+}
+
 TEST(ScanNode, DISABLED_ProjectionPushdown) {
   // ARROW-13263
   TestPlan plan;
@@ -76,6 +76,9 @@ class IpcFileWriter;
 class IpcFileWriteOptions;
 class IpcFragmentScanOptions;
 
+class JsonFileFormat;
+struct JsonFragmentScanOptions;
+
 class ParquetFileFormat;
 class ParquetFileFragment;
 class ParquetFragmentScanOptions;
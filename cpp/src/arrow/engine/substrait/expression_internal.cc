@@ -668,8 +668,11 @@ struct ScalarToProtoImpl {
   Status Visit(const DurationScalar& s) { return NotImplemented(s); }
   Status Visit(const LargeStringScalar& s) { return NotImplemented(s); }
   Status Visit(const LargeBinaryScalar& s) { return NotImplemented(s); }
+  Status Visit(const BinaryViewScalar& s) { return NotImplemented(s); }
+  Status Visit(const StringViewScalar& s) { return NotImplemented(s); }
   Status Visit(const LargeListScalar& s) { return NotImplemented(s); }
   Status Visit(const MonthDayNanoIntervalScalar& s) { return NotImplemented(s); }
+  Status Visit(const RunEndEncodedScalar& s) { return NotImplemented(s); }
 
   Status NotImplemented(const Scalar& s) {
     return Status::NotImplemented("conversion to substrait::Expression::Literal from ",
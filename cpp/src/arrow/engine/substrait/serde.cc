@@ -17,10 +17,16 @@
 
 #include "arrow/engine/substrait/serde.h"
 
+#include <mutex>
+#include <unordered_map>
+
+#include "arrow/compute/exec/plan_optimizer.h"
+#include "arrow/dataset/scanner.h"
 #include "arrow/engine/substrait/expression_internal.h"
 #include "arrow/engine/substrait/plan_internal.h"
 #include "arrow/engine/substrait/relation_internal.h"
 #include "arrow/engine/substrait/type_internal.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/string_view.h"
 
 #include <google/protobuf/descriptor.h>
@@ -31,6 +37,9 @@
 #include <google/protobuf/util/type_resolver_util.h>
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace engine {
 
 Status ParseFromBufferImpl(const Buffer& buf, const std::string& full_name,
@@ -58,8 +67,7 @@ Result<compute::Declaration> DeserializeRelation(const Buffer& buf,
   return FromProto(rel, ext_set);
 }
 
-using DeclarationFactory = std::function<Result<compute::Declaration>(
-    compute::Declaration, std::vector<std::string> names)>;
+using DeclarationFactory = PreparedPlan::DeclarationFactory;
 
 namespace {
 
@@ -111,34 +119,115 @@ DeclarationFactory MakeWriteDeclarationFactory(
   };
 }
 
-Result<std::vector<compute::Declaration>> DeserializePlans(
-    const Buffer& buf, DeclarationFactory declaration_factory,
-    const ExtensionIdRegistry* registry, ExtensionSet* ext_set_out) {
+// A top-level relation of a plan and the names of its output fields
+struct PlanRelation {
+  compute::Declaration declaration;
+  std::vector<std::string> names;
+};
+
+Result<std::vector<PlanRelation>> DeserializeRelations(
+    const Buffer& buf, const ExtensionIdRegistry* registry, ExtensionSet* ext_set_out) {
   ARROW_ASSIGN_OR_RAISE(auto plan, ParseFromBuffer<substrait::Plan>(buf));
 
   ARROW_ASSIGN_OR_RAISE(auto ext_set, GetExtensionSetFromPlan(plan, registry));
 
-  std::vector<compute::Declaration> sink_decls;
+  std::vector<PlanRelation> relations;
   for (const substrait::PlanRel& plan_rel : plan.relations()) {
+    PlanRelation relation;
     ARROW_ASSIGN_OR_RAISE(
-        auto decl,
+        relation.declaration,
         FromProto(plan_rel.has_root() ? plan_rel.root().input() : plan_rel.rel(),
                   ext_set));
-    std::vector<std::string> names;
     if (plan_rel.has_root()) {
-      names.assign(plan_rel.root().names().begin(), plan_rel.root().names().end());
+      relation.names.assign(plan_rel.root().names().begin(),
+                            plan_rel.root().names().end());
     }
+    relations.push_back(std::move(relation));
+  }
+
+  if (ext_set_out) {
+    *ext_set_out = std::move(ext_set);
+  }
+  return relations;
+}
 
+Result<std::vector<compute::Declaration>> MakeSinkDeclarations(
+    std::vector<PlanRelation> relations, const DeclarationFactory& declaration_factory) {
+  std::vector<compute::Declaration> sink_decls;
+  for (auto& relation : relations) {
     // pipe each relation
     ARROW_ASSIGN_OR_RAISE(auto sink_decl,
-                          declaration_factory(std::move(decl), std::move(names)));
+                          declaration_factory(std::move(relation.declaration),
+                                              std::move(relation.names)));
     sink_decls.push_back(std::move(sink_decl));
   }
+  return sink_decls;
+}
 
-  if (ext_set_out) {
-    *ext_set_out = std::move(ext_set);
+Result<std::vector<compute::Declaration>> DeserializePlans(
+    const Buffer& buf, const DeclarationFactory& declaration_factory,
+    const ExtensionIdRegistry* registry, ExtensionSet* ext_set_out) {
+  ARROW_ASSIGN_OR_RAISE(auto relations, DeserializeRelations(buf, registry, ext_set_out));
+  return MakeSinkDeclarations(std::move(relations), declaration_factory);
+}
+
+using LiteralMap =
+    std::function<Result<compute::Expression>(const compute::Expression& literal)>;
+
+Result<compute::Expression> MapLiterals(const compute::Expression& expr,
+                                        const LiteralMap& map) {
+  if (expr.literal()) return map(expr);
+  auto call = expr.call();
+  if (call == NULLPTR) return expr;
+  std::vector<compute::Expression> arguments;
+  for (const auto& argument : call->arguments) {
+    ARROW_ASSIGN_OR_RAISE(auto mapped, MapLiterals(argument, map));
+    arguments.push_back(std::move(mapped));
   }
-  return sink_decls;
+  return compute::call(call->function_name, std::move(arguments), call->options);
+}
+
+// Map the parameters of a declaration and its inputs, in the order they are numbered.
+// The options holding them are replaced by copies, and so are the scan options, which
+// the scan node modifies.
+Status MapParameters(compute::Declaration* decl, const LiteralMap& map) {
+  for (auto& input : decl->inputs) {
+    if (auto input_decl = util::get_if<compute::Declaration>(&input)) {
+      RETURN_NOT_OK(MapParameters(input_decl, map));
+    }
+  }
+  const auto& kind = decl->factory_name;
+  if (kind == "scan") {
+    auto options = std::make_shared<dataset::ScanNodeOptions>(
+        checked_cast<const dataset::ScanNodeOptions&>(*decl->options));
+    options->scan_options =
+        std::make_shared<dataset::ScanOptions>(*options->scan_options);
+    // Not a parameter when the read has no filter
+    if (options->scan_options->filter != compute::literal(true)) {
+      ARROW_ASSIGN_OR_RAISE(options->scan_options->filter,
+                            MapLiterals(options->scan_options->filter, map));
+    }
+    decl->options = std::move(options);
+  } else if (kind == "filter") {
+    auto options = std::make_shared<compute::FilterNodeOptions>(
+        checked_cast<const compute::FilterNodeOptions&>(*decl->options));
+    ARROW_ASSIGN_OR_RAISE(options->filter_expression,
+                          MapLiterals(options->filter_expression, map));
+    decl->options = std::move(options);
+  } else if (kind == "project") {
+    auto options = std::make_shared<compute::ProjectNodeOptions>(
+        checked_cast<const compute::ProjectNodeOptions&>(*decl->options));
+    for (auto& expr : options->expressions) {
+      ARROW_ASSIGN_OR_RAISE(expr, MapLiterals(expr, map));
+    }
+    decl->options = std::move(options);
+  } else if (kind == "hashjoin") {
+    auto options = std::make_shared<compute::HashJoinNodeOptions>(
+        checked_cast<const compute::HashJoinNodeOptions&>(*decl->options));
+    ARROW_ASSIGN_OR_RAISE(options->filter, MapLiterals(options->filter, map));
+    decl->options = std::move(options);
+  }
+  return Status::OK();
 }
 
 }  // namespace
@@ -165,7 +254,9 @@ Result<compute::ExecPlan> MakeSingleDeclarationPlan(
     return Status::Invalid("DeserializePlan does not support multiple root relations");
   } else {
     ARROW_ASSIGN_OR_RAISE(auto plan, compute::ExecPlan::Make());
-    std::ignore = declarations[0].AddToPlan(plan.get());
+    ARROW_ASSIGN_OR_RAISE(auto declaration,
+                          compute::OptimizeDeclaration(std::move(declarations[0])));
+    std::ignore = declaration.AddToPlan(plan.get());
     return *std::move(plan);
   }
 }
@@ -204,6 +295,99 @@ Result<compute::ExecPlan> DeserializePlan(
   return MakeSingleDeclarationPlan(declarations);
 }
 
+Result<std::shared_ptr<PreparedPlan>> PreparedPlan::Make(
+    const Buffer& buf, const ExtensionIdRegistry* registry) {
+  auto prepared = std::shared_ptr<PreparedPlan>(new PreparedPlan(registry));
+  ARROW_ASSIGN_OR_RAISE(auto relations,
+                        DeserializeRelations(buf, registry, &prepared->ext_set_));
+  for (auto& relation : relations) {
+    RETURN_NOT_OK(MapParameters(
+        &relation.declaration,
+        [&prepared](const compute::Expression& literal) -> Result<compute::Expression> {
+          prepared->parameters_.push_back(*literal.literal());
+          return literal;
+        }));
+    prepared->relations_.push_back(std::move(relation.declaration));
+    prepared->names_.push_back(std::move(relation.names));
+  }
+  return prepared;
+}
+
+Result<std::vector<compute::Declaration>> PreparedPlan::Instantiate(
+    const ConsumerFactory& consumer_factory, const std::vector<Datum>& parameters) const {
+  return Instantiate(MakeConsumingSinkDeclarationFactory(consumer_factory), parameters);
+}
+
+Result<std::vector<compute::Declaration>> PreparedPlan::Instantiate(
+    const WriteOptionsFactory& write_options_factory,
+    const std::vector<Datum>& parameters) const {
+  return Instantiate(MakeWriteDeclarationFactory(write_options_factory), parameters);
+}
+
+Result<std::vector<compute::Declaration>> PreparedPlan::Instantiate(
+    const DeclarationFactory& declaration_factory,
+    const std::vector<Datum>& parameters) const {
+  if (!parameters.empty() && parameters.size() != parameters_.size()) {
+    return Status::Invalid("The plan has ", parameters_.size(), " parameters, but ",
+                           parameters.size(), " values were given");
+  }
+  size_t i = 0;
+  LiteralMap substitute =
+      [&](const compute::Expression& literal) -> Result<compute::Expression> {
+    size_t index = i++;
+    const Datum& value = parameters[index];
+    const auto& type = parameters_[index].type();
+    if (!value.type() || !value.type()->Equals(*type)) {
+      return Status::TypeError("Parameter ", index, " of the plan is of type ",
+                               type->ToString(), ", got ", value.ToString());
+    }
+    return compute::literal(value);
+  };
+  LiteralMap keep = [](const compute::Expression& literal) { return literal; };
+
+  std::vector<PlanRelation> relations;
+  for (size_t r = 0; r < relations_.size(); ++r) {
+    PlanRelation relation{relations_[r], names_[r]};
+    RETURN_NOT_OK(
+        MapParameters(&relation.declaration, parameters.empty() ? keep : substitute));
+    relations.push_back(std::move(relation));
+  }
+  return MakeSinkDeclarations(std::move(relations), declaration_factory);
+}
+
+struct PreparedPlanCache::Impl {
+  Impl(size_t capacity, const ExtensionIdRegistry* registry)
+      : capacity(capacity), registry(registry) {}
+
+  const size_t capacity;
+  const ExtensionIdRegistry* registry;
+  std::mutex mutex;
+  // By the serialized plan
+  std::unordered_map<std::string, std::shared_ptr<PreparedPlan>> plans;
+};
+
+PreparedPlanCache::PreparedPlanCache(size_t capacity, const ExtensionIdRegistry* registry)
+    : impl_(new Impl(capacity, registry)) {}
+
+PreparedPlanCache::~PreparedPlanCache() = default;
+
+Result<std::shared_ptr<PreparedPlan>> PreparedPlanCache::GetOrPrepare(const Buffer& buf) {
+  std::string key = buf.ToString();
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    auto it = impl_->plans.find(key);
+    if (it != impl_->plans.end()) return it->second;
+  }
+
+  // Prepare outside the lock; concurrent misses of a plan prepare it twice
+  ARROW_ASSIGN_OR_RAISE(auto prepared, PreparedPlan::Make(buf, impl_->registry));
+
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  if (impl_->plans.size() >= impl_->capacity) impl_->plans.clear();
+  impl_->plans.emplace(std::move(key), prepared);
+  return prepared;
+}
+
 Result<std::shared_ptr<Schema>> DeserializeSchema(const Buffer& buf,
                                                   const ExtensionSet& ext_set) {
   ARROW_ASSIGN_OR_RAISE(auto named_struct, ParseFromBuffer<substrait::NamedStruct>(buf));
@@ -20,12 +20,14 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/compute/exec/exec_plan.h"
 #include "arrow/compute/exec/options.h"
+#include "arrow/datum.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/engine/substrait/extension_set.h"
 #include "arrow/engine/substrait/visibility.h"
@@ -60,7 +62,8 @@ ARROW_ENGINE_EXPORT Result<std::vector<compute::Declaration>> DeserializePlans(
 /// \brief Deserializes a single-relation Substrait Plan message to an execution plan
 ///
 /// The output of each top-level Substrait relation will be sent to a caller supplied
-/// consumer function provided by consumer_factory
+/// consumer function provided by consumer_factory. The relation is rewritten with
+/// compute::OptimizeDeclaration before being added to the plan.
 ///
 /// \param[in] buf a buffer containing the protobuf serialization of a Substrait Plan
 /// message
@@ -101,6 +104,8 @@ ARROW_ENGINE_EXPORT Result<std::vector<compute::Declaration>> DeserializePlans(
 ///
 /// The output of the single Substrait relation will be written to a filesystem.
 /// `write_options_factory` can be used to control write behavior.
+/// The relation is rewritten with compute::OptimizeDeclaration before being added to
+/// the plan.
 ///
 /// \param[in] buf a buffer containing the protobuf serialization of a Substrait Plan
 /// message
@@ -115,6 +120,89 @@ ARROW_ENGINE_EXPORT Result<compute::ExecPlan> DeserializePlan(
     const Buffer& buf, const std::shared_ptr<dataset::WriteNodeOptions>& write_options,
     const ExtensionIdRegistry* registry = NULLPTR, ExtensionSet* ext_set_out = NULLPTR);
 
+/// \brief A Substrait Plan message deserialized once, to be executed repeatedly
+///
+/// Preparing a plan parses the protobuf, resolves its extensions and converts its
+/// relations to declarations, which each execution then copies. The literal arguments
+/// of the filter, projection and join filter expressions of the plan are its
+/// parameters, numbered in the order they're found (the inputs of a relation before
+/// the relation itself). An execution may substitute values of the same types for
+/// them, so that a query run with different constants is only prepared once.
+///
+/// The datasets read by the plan are discovered when it's prepared.
+class ARROW_ENGINE_EXPORT PreparedPlan {
+ public:
+  /// \brief Deserialize a Substrait Plan message
+  ///
+  /// \param[in] buf a buffer containing the protobuf serialization of a Substrait Plan
+  /// message
+  /// \param[in] registry an extension-id-registry to use, or null for the default one.
+  static Result<std::shared_ptr<PreparedPlan>> Make(
+      const Buffer& buf, const ExtensionIdRegistry* registry = NULLPTR);
+
+  /// The values of the parameters in the serialized plan
+  const std::vector<Datum>& parameters() const { return parameters_; }
+
+  /// The extension mapping used by the plan
+  const ExtensionSet& ext_set() const { return ext_set_; }
+
+  /// \brief The declarations of the plan, as returned by DeserializePlans
+  ///
+  /// \param[in] consumer_factory factory function for generating the node that
+  /// consumes the batches produced by each toplevel Substrait relation
+  /// \param[in] parameters values to substitute for the parameters of the plan, or
+  /// empty to keep the values of the serialized plan
+  Result<std::vector<compute::Declaration>> Instantiate(
+      const ConsumerFactory& consumer_factory,
+      const std::vector<Datum>& parameters = {}) const;
+
+  /// \brief The declarations of the plan, as returned by DeserializePlans
+  ///
+  /// \param[in] write_options_factory factory function for generating the write
+  /// options of a node consuming the batches produced by each toplevel Substrait
+  /// relation
+  /// \param[in] parameters values to substitute for the parameters of the plan, or
+  /// empty to keep the values of the serialized plan
+  Result<std::vector<compute::Declaration>> Instantiate(
+      const WriteOptionsFactory& write_options_factory,
+      const std::vector<Datum>& parameters = {}) const;
+
+  using DeclarationFactory = std::function<Result<compute::Declaration>(
+      compute::Declaration, std::vector<std::string> names)>;
+
+ private:
+  explicit PreparedPlan(const ExtensionIdRegistry* registry)
+      : ext_set_(registry != NULLPTR ? registry : default_extension_id_registry()) {}
+
+  Result<std::vector<compute::Declaration>> Instantiate(
+      const DeclarationFactory& declaration_factory,
+      const std::vector<Datum>& parameters) const;
+
+  ExtensionSet ext_set_;
+  std::vector<compute::Declaration> relations_;
+  std::vector<std::vector<std::string>> names_;
+  std::vector<Datum> parameters_;
+};
+
+/// \brief Prepared plans by serialized Substrait Plan message
+///
+/// Thread-safe. The cache is cleared when it would hold more than `capacity` plans.
+class ARROW_ENGINE_EXPORT PreparedPlanCache {
+ public:
+  /// \param[in] capacity the number of plans held at most
+  /// \param[in] registry an extension-id-registry to use, or null for the default one.
+  explicit PreparedPlanCache(size_t capacity = 128,
+                             const ExtensionIdRegistry* registry = NULLPTR);
+  ~PreparedPlanCache();
+
+  /// \brief The prepared plan of a Substrait Plan message, prepared if not cached
+  Result<std::shared_ptr<PreparedPlan>> GetOrPrepare(const Buffer& buf);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// \brief Deserializes a Substrait Type message to the corresponding Arrow type
 ///
 /// \param[in] buf a buffer containing the protobuf serialization of a Substrait Type
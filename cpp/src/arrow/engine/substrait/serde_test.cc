@@ -1383,5 +1383,110 @@ TEST(Substrait, JoinPlanInvalidKeys) {
   }
 }
 
+TEST(Substrait, PreparedPlan) {
+  std::string substrait_json = R"({
+  "relations": [{
+    "rel": {
+      "filter": {
+        "input": {
+          "read": {
+            "base_schema": {
+              "names": ["A", "B"],
+              "struct": {
+                "types": [{
+                  "i32": {}
+                }, {
+                  "i32": {}
+                }]
+              }
+            },
+            "local_files": {
+              "items": [
+                {
+                  "uri_file": "file:///tmp/dat1.parquet",
+                  "parquet": {}
+                }
+              ]
+            }
+          }
+        },
+        "condition": {
+          "scalarFunction": {
+            "functionReference": 0,
+            "arguments": [{
+              "value": {
+                "selection": {
+                  "directReference": {
+                    "structField": {
+                      "field": 0
+                    }
+                  },
+                  "rootReference": {
+                  }
+                }
+              }
+            }, {
+              "value": {
+                "literal": {
+                  "i32": 5
+                }
+              }
+            }]
+          }
+        }
+      }
+    }
+  }],
+  "extension_uris": [
+      {
+        "extension_uri_anchor": 0,
+        "uri": ")" + substrait::default_extension_types_uri() +
+                               R"("
+      }
+    ],
+    "extensions": [
+      {"extension_function": {
+        "extension_uri_reference": 0,
+        "function_anchor": 0,
+        "name": "equal"
+      }}
+    ]
+  })";
+  ASSERT_OK_AND_ASSIGN(auto buf, internal::SubstraitFromJSON("Plan", substrait_json));
+
+  PreparedPlanCache cache;
+  ASSERT_OK_AND_ASSIGN(auto prepared, cache.GetOrPrepare(*buf));
+  ASSERT_OK_AND_ASSIGN(auto again, cache.GetOrPrepare(*buf));
+  ASSERT_EQ(prepared, again);
+  ASSERT_EQ(prepared->parameters().size(), 1);
+  ASSERT_EQ(prepared->parameters()[0], Datum(5));
+
+  auto filter_of = [](const std::vector<compute::Declaration>& sink_decls) {
+    const auto& filter = util::get<compute::Declaration>(sink_decls[0].inputs[0]);
+    EXPECT_EQ(filter.factory_name, "filter");
+    return checked_cast<const compute::FilterNodeOptions&>(*filter.options)
+        .filter_expression;
+  };
+  auto a_equals = [](int32_t value) {
+    return compute::equal(compute::field_ref(FieldRef(0)), compute::literal(value));
+  };
+
+  ASSERT_OK_AND_ASSIGN(auto sink_decls,
+                       prepared->Instantiate([] { return kNullConsumer; }));
+  ASSERT_EQ(filter_of(sink_decls), a_equals(5));
+
+  ASSERT_OK_AND_ASSIGN(sink_decls,
+                       prepared->Instantiate([] { return kNullConsumer; }, {Datum(7)}));
+  ASSERT_EQ(filter_of(sink_decls), a_equals(7));
+  // The prepared plan is unchanged
+  ASSERT_OK_AND_ASSIGN(sink_decls, prepared->Instantiate([] { return kNullConsumer; }));
+  ASSERT_EQ(filter_of(sink_decls), a_equals(5));
+
+  ASSERT_RAISES(TypeError,
+                prepared->Instantiate([] { return kNullConsumer; }, {Datum(int64_t(7))}));
+  ASSERT_RAISES(Invalid, prepared->Instantiate([] { return kNullConsumer; },
+                                               {Datum(7), Datum(8)}));
+}
+
 }  // namespace engine
 }  // namespace arrow
@@ -368,8 +368,11 @@ struct DataTypeToProtoImpl {
   Status Visit(const DurationType& t) { return NotImplemented(t); }
   Status Visit(const LargeStringType& t) { return NotImplemented(t); }
   Status Visit(const LargeBinaryType& t) { return NotImplemented(t); }
+  Status Visit(const BinaryViewType& t) { return NotImplemented(t); }
+  Status Visit(const StringViewType& t) { return NotImplemented(t); }
   Status Visit(const LargeListType& t) { return NotImplemented(t); }
   Status Visit(const MonthDayNanoIntervalType& t) { return EncodeUserDefined(t); }
+  Status Visit(const RunEndEncodedType& t) { return NotImplemented(t); }
 
   template <typename Sub>
   Sub* SetWithThen(void (::substrait::Type::*set_allocated_sub)(Sub*)) {
@@ -0,0 +1,628 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/blockcache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/filesystem/util_internal.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string.h"
+
+namespace arrow {
+
+using internal::ComputeStringHash;
+
+namespace fs {
+
+BlockCacheOptions BlockCacheOptions::Defaults(std::string directory) {
+  BlockCacheOptions options;
+  options.directory = std::move(directory);
+  return options;
+}
+
+bool BlockCacheOptions::Equals(const BlockCacheOptions& other) const {
+  return directory == other.directory && block_size == other.block_size &&
+         capacity == other.capacity;
+}
+
+// ----------------------------------------------------------------------
+// LocalBlockCache implementation
+
+namespace {
+
+constexpr const char* kTempSuffix = ".tmp";
+// Two 64-bit hashes in hexadecimal
+constexpr size_t kBlockNameLength = 32;
+
+std::string BlockName(const std::string& key) {
+  const uint64_t hashes[2] = {ComputeStringHash<0>(key.data(), key.size()),
+                              ComputeStringHash<1>(key.data(), key.size())};
+  return HexEncode(reinterpret_cast<const uint8_t*>(hashes), sizeof(hashes));
+}
+
+bool IsTempName(const std::string& name) {
+  const size_t suffix_length = std::strlen(kTempSuffix);
+  return name.size() > suffix_length &&
+         name.compare(name.size() - suffix_length, suffix_length, kTempSuffix) == 0;
+}
+
+}  // namespace
+
+class LocalBlockCache::Impl {
+ public:
+  explicit Impl(const BlockCacheOptions& options) : options_(options) {}
+
+  Status Init() {
+    if (options_.block_size <= 0) {
+      return Status::Invalid("Block cache block size must be strictly positive");
+    }
+    if (options_.capacity < 0) {
+      return Status::Invalid("Block cache capacity must be positive");
+    }
+    ARROW_ASSIGN_OR_RAISE(options_.directory,
+                          local_fs_.NormalizePath(options_.directory));
+    RETURN_NOT_OK(local_fs_.CreateDir(options_.directory));
+
+    // Index the blocks left by a previous process, oldest first so that
+    // the most recently written blocks are evicted last
+    FileSelector select;
+    select.base_dir = options_.directory;
+    ARROW_ASSIGN_OR_RAISE(auto infos, local_fs_.GetFileInfo(select));
+    std::sort(infos.begin(), infos.end(), [](const FileInfo& a, const FileInfo& b) {
+      return a.mtime() < b.mtime();
+    });
+    for (const auto& info : infos) {
+      if (!info.IsFile()) {
+        continue;
+      }
+      const std::string name = info.base_name();
+      if (name.size() != kBlockNameLength) {
+        // Interrupted write, or foreign file
+        if (IsTempName(name)) {
+          ARROW_UNUSED(local_fs_.DeleteFile(info.path()));
+        }
+        continue;
+      }
+      InsertLocked(name, info.size());
+    }
+    for (const auto& name : EvictLocked()) {
+      ARROW_UNUSED(local_fs_.DeleteFile(BlockPath(name)));
+    }
+    return Status::OK();
+  }
+
+  const BlockCacheOptions& options() const { return options_; }
+
+  Result<std::shared_ptr<Buffer>> Get(const std::string& key) {
+    const std::string name = BlockName(key);
+    int64_t block_size;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = entries_.find(name);
+      if (it == entries_.end()) {
+        return nullptr;
+      }
+      lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+      block_size = it->second.size;
+    }
+    auto maybe_buffer = ReadBlock(name, block_size);
+    if (!maybe_buffer.ok()) {
+      // The block file was removed behind our back (perhaps evicted
+      // by a concurrent Put); drop it from the index
+      std::lock_guard<std::mutex> lock(mutex_);
+      EraseLocked(name);
+      return nullptr;
+    }
+    return maybe_buffer;
+  }
+
+  Status Put(const std::string& key, const Buffer& block) {
+    const std::string name = BlockName(key);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (entries_.count(name) != 0) {
+        return Status::OK();
+      }
+    }
+    // Write to a temporary file, then rename, so that blocks are never
+    // observed partially written, even across process restarts
+    std::stringstream ss;
+    ss << name << "." << temp_counter_.fetch_add(1) << kTempSuffix;
+    const std::string temp_path = BlockPath(ss.str());
+    auto status = WriteBlock(temp_path, block);
+    if (status.ok()) {
+      status = local_fs_.Move(temp_path, BlockPath(name));
+    }
+    if (!status.ok()) {
+      ARROW_UNUSED(local_fs_.DeleteFile(temp_path));
+      return status;
+    }
+
+    std::vector<std::string> evicted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      InsertLocked(name, block.size());
+      evicted = EvictLocked();
+    }
+    for (const auto& evicted_name : evicted) {
+      ARROW_UNUSED(local_fs_.DeleteFile(BlockPath(evicted_name)));
+    }
+    return Status::OK();
+  }
+
+  Status Clear() {
+    std::vector<std::string> names;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      names.assign(lru_.begin(), lru_.end());
+      lru_.clear();
+      entries_.clear();
+      size_ = 0;
+    }
+    for (const auto& name : names) {
+      RETURN_NOT_OK(local_fs_.DeleteFile(BlockPath(name)));
+    }
+    return Status::OK();
+  }
+
+  int64_t num_blocks() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int64_t>(entries_.size());
+  }
+
+  int64_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+  }
+
+ private:
+  struct Entry {
+    int64_t size;
+    std::list<std::string>::iterator lru_it;
+  };
+
+  std::string BlockPath(const std::string& name) const {
+    return internal::ConcatAbstractPath(options_.directory, name);
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadBlock(const std::string& name, int64_t size) {
+    ARROW_ASSIGN_OR_RAISE(auto file, local_fs_.OpenInputFile(BlockPath(name)));
+    ARROW_ASSIGN_OR_RAISE(auto buffer, file->Read(size));
+    RETURN_NOT_OK(file->Close());
+    if (buffer->size() != size) {
+      return Status::IOError("Truncated block file in cache");
+    }
+    return buffer;
+  }
+
+  Status WriteBlock(const std::string& path, const Buffer& block) {
+    ARROW_ASSIGN_OR_RAISE(auto stream, local_fs_.OpenOutputStream(path));
+    RETURN_NOT_OK(stream->Write(block.data(), block.size()));
+    return stream->Close();
+  }
+
+  void InsertLocked(const std::string& name, int64_t size) {
+    if (entries_.count(name) != 0) {
+      return;
+    }
+    lru_.push_front(name);
+    entries_[name] = Entry{size, lru_.begin()};
+    size_ += size;
+  }
+
+  void EraseLocked(const std::string& name) {
+    auto it = entries_.find(name);
+    if (it != entries_.end()) {
+      size_ -= it->second.size;
+      lru_.erase(it->second.lru_it);
+      entries_.erase(it);
+    }
+  }
+
+  // Drop least recently used blocks from the index until the capacity is
+  // respected, returning their names so that the caller deletes the files
+  // outside of the lock
+  std::vector<std::string> EvictLocked() {
+    std::vector<std::string> evicted;
+    while (size_ > options_.capacity && !lru_.empty()) {
+      evicted.push_back(lru_.back());
+      EraseLocked(lru_.back());
+    }
+    return evicted;
+  }
+
+  BlockCacheOptions options_;
+  LocalFileSystem local_fs_;
+  std::atomic<int64_t> temp_counter_{0};
+
+  mutable std::mutex mutex_;
+  // Most recently used blocks first
+  std::list<std::string> lru_;
+  std::unordered_map<std::string, Entry> entries_;
+  int64_t size_ = 0;
+};
+
+LocalBlockCache::LocalBlockCache() = default;
+
+LocalBlockCache::~LocalBlockCache() = default;
+
+Result<std::shared_ptr<LocalBlockCache>> LocalBlockCache::Make(
+    const BlockCacheOptions& options) {
+  std::shared_ptr<LocalBlockCache> cache(new LocalBlockCache());
+  cache->impl_.reset(new Impl(options));
+  RETURN_NOT_OK(cache->impl_->Init());
+  return cache;
+}
+
+const BlockCacheOptions& LocalBlockCache::options() const { return impl_->options(); }
+
+Result<std::shared_ptr<Buffer>> LocalBlockCache::Get(const std::string& key) {
+  return impl_->Get(key);
+}
+
+Status LocalBlockCache::Put(const std::string& key, const Buffer& block) {
+  return impl_->Put(key, block);
+}
+
+Status LocalBlockCache::Clear() { return impl_->Clear(); }
+
+int64_t LocalBlockCache::num_blocks() const { return impl_->num_blocks(); }
+
+int64_t LocalBlockCache::size() const { return impl_->size(); }
+
+// ----------------------------------------------------------------------
+// BlockCacheFileSystem implementation
+
+namespace {
+
+// A file reading its blocks from a LocalBlockCache, falling back on the
+// base filesystem for the missing ones.
+class BlockCachedFile : public io::RandomAccessFile {
+ public:
+  BlockCachedFile(std::shared_ptr<FileSystem> base_fs,
+                  std::shared_ptr<LocalBlockCache> cache, FileInfo info)
+      : base_fs_(std::move(base_fs)),
+        cache_(std::move(cache)),
+        info_(std::move(info)),
+        block_size_(cache_->options().block_size) {
+    std::stringstream ss;
+    ss << info_.path() << '\n'
+       << info_.mtime().time_since_epoch().count() << '\n'
+       << info_.size() << '\n'
+       << block_size_ << '\n';
+    key_prefix_ = ss.str();
+  }
+
+  ~BlockCachedFile() override { io::internal::CloseFromDestructor(this); }
+
+  Status Close() override {
+    std::lock_guard<std::mutex> lock(base_mutex_);
+    closed_ = true;
+    if (base_file_) {
+      auto status = base_file_->Close();
+      base_file_.reset();
+      return status;
+    }
+    return Status::OK();
+  }
+
+  bool closed() const override { return closed_; }
+
+  Result<int64_t> Tell() const override {
+    RETURN_NOT_OK(CheckClosed());
+    return pos_;
+  }
+
+  Result<int64_t> GetSize() override {
+    RETURN_NOT_OK(CheckClosed());
+    return info_.size();
+  }
+
+  Status Seek(int64_t position) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "seek"));
+    pos_ = position;
+    return Status::OK();
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+    nbytes = std::min(nbytes, info_.size() - position);
+    if (nbytes <= 0) {
+      return 0;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto blocks, GetBlocks(position, nbytes));
+    auto dest = static_cast<uint8_t*>(out);
+    int64_t offset = position % block_size_;
+    int64_t bytes_read = 0;
+    for (const auto& block : blocks) {
+      const int64_t chunk = std::min(nbytes - bytes_read, block->size() - offset);
+      if (chunk <= 0) {
+        break;
+      }
+      std::memcpy(dest + bytes_read, block->data() + offset, chunk);
+      bytes_read += chunk;
+      offset = 0;
+    }
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+    nbytes = std::min(nbytes, info_.size() - position);
+    if (nbytes <= 0) {
+      return std::make_shared<Buffer>(nullptr, 0);
+    }
+    const int64_t offset = position % block_size_;
+    if (offset + nbytes <= block_size_) {
+      // Single block: avoid a copy
+      ARROW_ASSIGN_OR_RAISE(auto blocks, GetBlocks(position, nbytes));
+      const auto& block = blocks[0];
+      return SliceBuffer(block, offset,
+                         std::max<int64_t>(0, std::min(nbytes, block->size() - offset)));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buf, AllocateResizableBuffer(nbytes));
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          ReadAt(position, nbytes, buf->mutable_data()));
+    RETURN_NOT_OK(buf->Resize(bytes_read));
+    return std::move(buf);
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
+    pos_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(pos_, nbytes));
+    pos_ += buffer->size();
+    return std::move(buffer);
+  }
+
+ private:
+  Status CheckClosed() const {
+    if (closed_) {
+      return Status::Invalid("Operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  Status CheckPosition(int64_t position, const char* action) const {
+    if (position < 0) {
+      return Status::Invalid("Cannot ", action, " from negative position");
+    }
+    if (position > info_.size()) {
+      return Status::IOError("Cannot ", action, " past end of file");
+    }
+    return Status::OK();
+  }
+
+  std::string BlockKey(int64_t index) const {
+    return key_prefix_ + std::to_string(index);
+  }
+
+  int64_t BlockLength(int64_t index) const {
+    return std::min(block_size_, info_.size() - index * block_size_);
+  }
+
+  Result<std::shared_ptr<io::RandomAccessFile>> BaseFile() {
+    std::lock_guard<std::mutex> lock(base_mutex_);
+    RETURN_NOT_OK(CheckClosed());
+    if (!base_file_) {
+      ARROW_ASSIGN_OR_RAISE(base_file_, base_fs_->OpenInputFile(info_));
+    }
+    return base_file_;
+  }
+
+  // Return the blocks spanning the given (non-empty) range, reading the
+  // missing ones from the base file
+  Result<std::vector<std::shared_ptr<Buffer>>> GetBlocks(int64_t position,
+                                                         int64_t nbytes) {
+    const int64_t first = position / block_size_;
+    const int64_t last = (position + nbytes - 1) / block_size_;
+    const int64_t num_blocks = last - first + 1;
+
+    std::vector<std::shared_ptr<Buffer>> blocks(num_blocks);
+    for (int64_t i = 0; i < num_blocks; ++i) {
+      // Cache failures only cost a read from the base file
+      auto maybe_block = cache_->Get(BlockKey(first + i));
+      if (maybe_block.ok() && *maybe_block &&
+          (*maybe_block)->size() == BlockLength(first + i)) {
+        blocks[i] = std::move(maybe_block).ValueUnsafe();
+      }
+    }
+
+    // Issue one read for each run of consecutive missing blocks
+    int64_t i = 0;
+    while (i < num_blocks) {
+      if (blocks[i]) {
+        ++i;
+        continue;
+      }
+      int64_t j = i + 1;
+      while (j < num_blocks && !blocks[j]) {
+        ++j;
+      }
+      const int64_t run_start = (first + i) * block_size_;
+      const int64_t run_end = std::min((first + j) * block_size_, info_.size());
+      ARROW_ASSIGN_OR_RAISE(auto file, BaseFile());
+      ARROW_ASSIGN_OR_RAISE(auto data, file->ReadAt(run_start, run_end - run_start));
+      if (data->size() != run_end - run_start) {
+        return Status::IOError("File '", info_.path(),
+                               "' was truncated while reading it through block cache");
+      }
+      for (int64_t k = i; k < j; ++k) {
+        blocks[k] = SliceBuffer(data, (k - i) * block_size_, BlockLength(first + k));
+        auto status = cache_->Put(BlockKey(first + k), *blocks[k]);
+        if (!status.ok()) {
+          ARROW_LOG(DEBUG) << "Failed caching block of '" << info_.path()
+                           << "': " << status.ToString();
+        }
+      }
+      i = j;
+    }
+    return blocks;
+  }
+
+  const std::shared_ptr<FileSystem> base_fs_;
+  const std::shared_ptr<LocalBlockCache> cache_;
+  const FileInfo info_;
+  const int64_t block_size_;
+  std::string key_prefix_;
+
+  std::mutex base_mutex_;
+  std::shared_ptr<io::RandomAccessFile> base_file_;
+  std::atomic<bool> closed_{false};
+  int64_t pos_ = 0;
+};
+
+}  // namespace
+
+BlockCacheFileSystem::BlockCacheFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                           std::shared_ptr<LocalBlockCache> cache)
+    : FileSystem(base_fs->io_context()),
+      base_fs_(std::move(base_fs)),
+      cache_(std::move(cache)) {}
+
+BlockCacheFileSystem::~BlockCacheFileSystem() = default;
+
+Result<std::string> BlockCacheFileSystem::NormalizePath(std::string path) {
+  return base_fs_->NormalizePath(std::move(path));
+}
+
+bool BlockCacheFileSystem::Equals(const FileSystem& other) const {
+  if (this == &other) {
+    return true;
+  }
+  if (other.type_name() != type_name()) {
+    return false;
+  }
+  const auto& blockcache = ::arrow::internal::checked_cast<const BlockCacheFileSystem&>(
+      other);
+  return cache_ == blockcache.cache_ && base_fs_->Equals(*blockcache.base_fs_);
+}
+
+Result<FileInfo> BlockCacheFileSystem::GetFileInfo(const std::string& path) {
+  return base_fs_->GetFileInfo(path);
+}
+
+Result<FileInfoVector> BlockCacheFileSystem::GetFileInfo(const FileSelector& select) {
+  return base_fs_->GetFileInfo(select);
+}
+
+FileInfoGenerator BlockCacheFileSystem::GetFileInfoGenerator(
+    const FileSelector& select) {
+  return base_fs_->GetFileInfoGenerator(select);
+}
+
+Status BlockCacheFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status BlockCacheFileSystem::DeleteDir(const std::string& path) {
+  return base_fs_->DeleteDir(path);
+}
+
+Status BlockCacheFileSystem::DeleteDirContents(const std::string& path,
+                                               bool missing_dir_ok) {
+  return base_fs_->DeleteDirContents(path, missing_dir_ok);
+}
+
+Status BlockCacheFileSystem::DeleteRootDirContents() {
+  return base_fs_->DeleteRootDirContents();
+}
+
+// Mutations don't need to invalidate the cache: rewritten files get a new
+// modification time, hence new block keys.
+
+Status BlockCacheFileSystem::DeleteFile(const std::string& path) {
+  return base_fs_->DeleteFile(path);
+}
+
+Status BlockCacheFileSystem::Move(const std::string& src, const std::string& dest) {
+  return base_fs_->Move(src, dest);
+}
+
+Status BlockCacheFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  return base_fs_->CopyFile(src, dest);
+}
+
+Result<std::shared_ptr<io::InputStream>> BlockCacheFileSystem::OpenInputStream(
+    const std::string& path) {
+  return OpenInputFile(path);
+}
+
+Result<std::shared_ptr<io::InputStream>> BlockCacheFileSystem::OpenInputStream(
+    const FileInfo& info) {
+  return OpenInputFile(info);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> BlockCacheFileSystem::OpenInputFile(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto info, base_fs_->GetFileInfo(path));
+  return OpenInputFile(info);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> BlockCacheFileSystem::OpenInputFile(
+    const FileInfo& info) {
+  if (info.type() == FileType::NotFound) {
+    return internal::PathNotFound(info.path());
+  }
+  if (info.type() != FileType::File && info.type() != FileType::Unknown) {
+    return internal::NotAFile(info.path());
+  }
+  if (info.mtime() == kNoTime || info.size() == kNoSize) {
+    // Can't tell whether cached blocks are stale
+    return base_fs_->OpenInputFile(info);
+  }
+  return std::make_shared<BlockCachedFile>(base_fs_, cache_, info);
+}
+
+Result<std::shared_ptr<io::OutputStream>> BlockCacheFileSystem::OpenOutputStream(
+    const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  return base_fs_->OpenOutputStream(path, metadata);
+}
+
+Result<std::shared_ptr<io::OutputStream>> BlockCacheFileSystem::OpenAppendStream(
+    const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  return base_fs_->OpenAppendStream(path, metadata);
+}
+
+}  // namespace fs
+}  // namespace arrow
@@ -0,0 +1,147 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/filesystem/filesystem.h"
+
+namespace arrow {
+namespace fs {
+
+/// Options for a LocalBlockCache
+struct ARROW_EXPORT BlockCacheOptions {
+  /// Local directory storing the cached blocks, created if necessary
+  std::string directory;
+  /// Size of the cached blocks.  Reads fetch whole blocks from the base filesystem.
+  int64_t block_size = 4 * 1024 * 1024;
+  /// Maximum total size of the cached blocks, beyond which the least recently
+  /// used blocks are evicted
+  int64_t capacity = 16LL * 1024 * 1024 * 1024;
+
+  /// \brief Initialize with defaults, caching in `directory`
+  static BlockCacheOptions Defaults(std::string directory);
+
+  bool Equals(const BlockCacheOptions& other) const;
+};
+
+/// \brief A cache of file blocks persisted on local storage
+///
+/// Each block is stored as a file in the cache directory, named after a hash of
+/// its key.  Blocks found in the directory when the cache is created are reused,
+/// so that the cache survives process restarts.
+///
+/// This class is thread-safe, and can be shared by several BlockCacheFileSystem
+/// instances.
+class ARROW_EXPORT LocalBlockCache {
+ public:
+  ~LocalBlockCache();
+
+  /// \brief Create a cache, indexing the blocks already present in its directory
+  static Result<std::shared_ptr<LocalBlockCache>> Make(const BlockCacheOptions& options);
+
+  const BlockCacheOptions& options() const;
+
+  /// \brief Return the block stored for `key`, or null if not cached
+  Result<std::shared_ptr<Buffer>> Get(const std::string& key);
+
+  /// \brief Store a block for `key`, possibly evicting other blocks
+  Status Put(const std::string& key, const Buffer& block);
+
+  /// \brief Drop all cached blocks
+  Status Clear();
+
+  /// The number of blocks currently cached
+  int64_t num_blocks() const;
+  /// The total size of the blocks currently cached
+  int64_t size() const;
+
+ private:
+  LocalBlockCache();
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief A FileSystem implementation that delegates to another
+/// implementation but caches the contents of files read from it in a
+/// LocalBlockCache.
+///
+/// Files opened for reading fetch only the blocks missing from the cache, one
+/// read being issued for each run of consecutive missing blocks.  Blocks are
+/// keyed by file path, modification time, size and block index, so that
+/// modified files don't hit stale blocks.  Files whose modification time is
+/// unknown are not cached.
+///
+/// This is meant for remote filesystems (such as S3) whose files are read
+/// repeatedly from the same machine.
+class ARROW_EXPORT BlockCacheFileSystem : public FileSystem {
+ public:
+  BlockCacheFileSystem(std::shared_ptr<FileSystem> base_fs,
+                       std::shared_ptr<LocalBlockCache> cache);
+  ~BlockCacheFileSystem() override;
+
+  std::string type_name() const override { return "blockcache"; }
+  std::shared_ptr<FileSystem> base_fs() const { return base_fs_; }
+  std::shared_ptr<LocalBlockCache> cache() const { return cache_; }
+
+  Result<std::string> NormalizePath(std::string path) override;
+
+  bool Equals(const FileSystem& other) const override;
+
+  using FileSystem::GetFileInfo;
+  Result<FileInfo> GetFileInfo(const std::string& path) override;
+  Result<FileInfoVector> GetFileInfo(const FileSelector& select) override;
+
+  FileInfoGenerator GetFileInfoGenerator(const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive = true) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path, bool missing_dir_ok = false) override;
+  Status DeleteRootDirContents() override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata = {}) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata = {}) override;
+
+ protected:
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<LocalBlockCache> cache_;
+};
+
+}  // namespace fs
+}  // namespace arrow
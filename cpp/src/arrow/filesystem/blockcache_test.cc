@@ -0,0 +1,180 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/blockcache.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/filesystem/test_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace fs {
+namespace internal {
+
+using ::arrow::internal::TemporaryDir;
+
+class TestBlockCacheFileSystem : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("test-blockcache-"));
+    options_ = BlockCacheOptions::Defaults(temp_dir_->path().ToString() + "cache");
+    options_.block_size = 4;
+    time_ = TimePoint(TimePoint::duration(42));
+    base_fs_ = std::make_shared<MockFileSystem>(time_);
+    MakeFileSystem();
+  }
+
+  void MakeFileSystem() {
+    ASSERT_OK_AND_ASSIGN(cache_, LocalBlockCache::Make(options_));
+    fs_ = std::make_shared<BlockCacheFileSystem>(base_fs_, cache_);
+  }
+
+  void CreateBaseFile(const std::string& path, const std::string& data) {
+    ::arrow::fs::CreateFile(base_fs_.get(), path, data);
+  }
+
+  void AssertReadAt(const std::string& path, int64_t position, int64_t nbytes,
+                    const std::string& expected) {
+    ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile(path));
+    ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(position, nbytes));
+    AssertBufferEqual(*buf, expected);
+    std::string out(static_cast<size_t>(nbytes), 'X');
+    ASSERT_OK_AND_ASSIGN(int64_t bytes_read, file->ReadAt(position, nbytes, &out[0]));
+    out.resize(static_cast<size_t>(bytes_read));
+    ASSERT_EQ(out, expected);
+    ASSERT_OK(file->Close());
+  }
+
+ protected:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  BlockCacheOptions options_;
+  TimePoint time_;
+  std::shared_ptr<MockFileSystem> base_fs_;
+  std::shared_ptr<LocalBlockCache> cache_;
+  std::shared_ptr<BlockCacheFileSystem> fs_;
+};
+
+TEST_F(TestBlockCacheFileSystem, ReadAt) {
+  CreateBaseFile("ab", "0123456789");
+  AssertReadAt("ab", 0, 10, "0123456789");
+  ASSERT_EQ(cache_->num_blocks(), 3);
+  ASSERT_EQ(cache_->size(), 10);
+  AssertReadAt("ab", 3, 4, "3456");
+  AssertReadAt("ab", 5, 2, "56");
+  AssertReadAt("ab", 8, 10, "89");
+  AssertReadAt("ab", 10, 1, "");
+
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("ab"));
+  ASSERT_RAISES(IOError, file->ReadAt(11, 1));
+  ASSERT_RAISES(Invalid, file->ReadAt(-1, 1));
+}
+
+TEST_F(TestBlockCacheFileSystem, Read) {
+  CreateBaseFile("ab", "0123456789");
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenInputStream("ab"));
+  ASSERT_OK_AND_ASSIGN(auto buf, stream->Read(3));
+  AssertBufferEqual(*buf, "012");
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(5));
+  AssertBufferEqual(*buf, "34567");
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(5));
+  AssertBufferEqual(*buf, "89");
+  ASSERT_OK_AND_EQ(10, stream->Tell());
+  ASSERT_OK(stream->Close());
+  ASSERT_RAISES(Invalid, stream->Read(1));
+}
+
+TEST_F(TestBlockCacheFileSystem, FetchesMissingBlocksOnly) {
+  CreateBaseFile("ab", "0123456789");
+  AssertReadAt("ab", 4, 2, "45");
+  ASSERT_EQ(cache_->num_blocks(), 1);
+
+  // Rewrite the base file behind the cache's back, keeping the same
+  // size and modification time: cached blocks are still served
+  CreateBaseFile("ab", "abcdefghij");
+  AssertReadAt("ab", 0, 10, "abcd4567ij");
+  ASSERT_EQ(cache_->num_blocks(), 3);
+}
+
+TEST_F(TestBlockCacheFileSystem, ModifiedFile) {
+  CreateBaseFile("ab", "0123456789");
+  AssertReadAt("ab", 0, 10, "0123456789");
+
+  // A different size (or modification time) changes the block keys
+  CreateBaseFile("ab", "abcdefgh");
+  AssertReadAt("ab", 0, 10, "abcdefgh");
+  ASSERT_EQ(cache_->num_blocks(), 5);
+}
+
+TEST_F(TestBlockCacheFileSystem, Eviction) {
+  options_.capacity = 8;
+  MakeFileSystem();
+  CreateBaseFile("ab", "0123456789");
+  AssertReadAt("ab", 0, 4, "0123");
+  AssertReadAt("ab", 4, 4, "4567");
+  // Touch the first block, so that the second one is evicted next
+  AssertReadAt("ab", 0, 4, "0123");
+  AssertReadAt("ab", 8, 2, "89");
+  ASSERT_EQ(cache_->num_blocks(), 2);
+  ASSERT_EQ(cache_->size(), 6);
+
+  // Blocks 0 and 2 are served from the cache, block 1 is fetched again
+  // (evicting block 0)
+  CreateBaseFile("ab", "abcdefghij");
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("ab"));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 10));
+  AssertBufferEqual(*buf, "0123efgh89");
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(0, 10));
+  AssertBufferEqual(*buf, "abcdefgh89");
+}
+
+TEST_F(TestBlockCacheFileSystem, Persistence) {
+  CreateBaseFile("ab", "0123456789");
+  AssertReadAt("ab", 0, 10, "0123456789");
+
+  // A new cache over the same directory finds the existing blocks
+  CreateBaseFile("ab", "abcdefghij");
+  MakeFileSystem();
+  ASSERT_EQ(cache_->num_blocks(), 3);
+  ASSERT_EQ(cache_->size(), 10);
+  AssertReadAt("ab", 0, 10, "0123456789");
+
+  ASSERT_OK(cache_->Clear());
+  ASSERT_EQ(cache_->num_blocks(), 0);
+  AssertReadAt("ab", 0, 10, "abcdefghij");
+  MakeFileSystem();
+  ASSERT_EQ(cache_->num_blocks(), 3);
+}
+
+TEST_F(TestBlockCacheFileSystem, Errors) {
+  ASSERT_OK(base_fs_->CreateDir("AB"));
+  ASSERT_RAISES(IOError, fs_->OpenInputFile("AB"));
+  ASSERT_RAISES(IOError, fs_->OpenInputFile("CD"));
+
+  options_.block_size = 0;
+  ASSERT_RAISES(Invalid, LocalBlockCache::Make(options_));
+}
+
+}  // namespace internal
+}  // namespace fs
+}  // namespace arrow
@@ -15,7 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <chrono>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 #include <utility>
 
 #include "arrow/util/config.h"
@@ -59,6 +62,7 @@ namespace fs {
 using internal::ConcatAbstractPath;
 using internal::EnsureTrailingSlash;
 using internal::GetAbstractPathParent;
+using internal::IsAncestorOf;
 using internal::kSep;
 using internal::RemoveLeadingSlash;
 using internal::RemoveTrailingSlash;
@@ -590,6 +594,209 @@ Result<std::shared_ptr<io::OutputStream>> SlowFileSystem::OpenAppendStream(
   return base_fs_->OpenAppendStream(path, metadata);
 }
 
+//////////////////////////////////////////////////////////////////////////
+// CachingFileSystem implementation
+
+class CachingFileSystem::Cache {
+ public:
+  explicit Cache(double ttl_seconds) : ttl_(ttl_seconds) {}
+
+  bool GetInfo(const std::string& path, FileInfo* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return Lookup(&infos_, std::string(RemoveTrailingSlash(path)), out);
+  }
+
+  bool GetListing(const FileSelector& select, FileInfoVector* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return Lookup(&listings_, ListingKey(select), out);
+  }
+
+  void PutInfo(const FileInfo& info) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    infos_[std::string(RemoveTrailingSlash(info.path()))] = {Clock::now(), info};
+  }
+
+  void PutListing(const FileSelector& select, const FileInfoVector& infos) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto now = Clock::now();
+    listings_[ListingKey(select)] = {now, infos};
+    for (const auto& info : infos) {
+      infos_[std::string(RemoveTrailingSlash(info.path()))] = {now, info};
+    }
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    infos_.clear();
+    listings_.clear();
+  }
+
+  void Invalidate(const std::string& path) {
+    const auto stripped = RemoveTrailingSlash(path);
+    // Creating or deleting an entry can affect its ancestors (implicit
+    // directories) as well as its descendants
+    auto related = [&](util::string_view other) {
+      return IsAncestorOf(stripped, other) || IsAncestorOf(other, stripped);
+    };
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = infos_.begin(); it != infos_.end();) {
+      it = related(it->first) ? infos_.erase(it) : std::next(it);
+    }
+    for (auto it = listings_.begin(); it != listings_.end();) {
+      it = related(it->second.base_dir) ? listings_.erase(it) : std::next(it);
+    }
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  template <typename T>
+  struct Entry {
+    Clock::time_point inserted;
+    T value;
+  };
+
+  struct Listing {
+    Clock::time_point inserted;
+    FileInfoVector value;
+    std::string base_dir;
+  };
+
+  static std::string ListingKey(const FileSelector& select) {
+    std::stringstream ss;
+    ss << RemoveTrailingSlash(select.base_dir) << '\0' << select.allow_not_found
+       << select.recursive << ':' << select.max_recursion;
+    return ss.str();
+  }
+
+  template <typename Map, typename T>
+  bool Lookup(Map* map, const std::string& key, T* out) {
+    auto it = map->find(key);
+    if (it == map->end()) {
+      return false;
+    }
+    const std::chrono::duration<double> age = Clock::now() - it->second.inserted;
+    if (age.count() >= ttl_) {
+      map->erase(it);
+      return false;
+    }
+    *out = it->second.value;
+    return true;
+  }
+
+  const double ttl_;
+  std::mutex mutex_;
+  std::unordered_map<std::string, Entry<FileInfo>> infos_;
+  std::unordered_map<std::string, Listing> listings_;
+};
+
+CachingFileSystem::CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                     double ttl_seconds)
+    : FileSystem(base_fs->io_context()),
+      base_fs_(std::move(base_fs)),
+      cache_(new Cache(ttl_seconds)) {}
+
+CachingFileSystem::~CachingFileSystem() = default;
+
+Result<std::string> CachingFileSystem::NormalizePath(std::string path) {
+  return base_fs_->NormalizePath(std::move(path));
+}
+
+bool CachingFileSystem::Equals(const FileSystem& other) const { return this == &other; }
+
+void CachingFileSystem::Invalidate() { cache_->Clear(); }
+
+void CachingFileSystem::Invalidate(const std::string& path) { cache_->Invalidate(path); }
+
+Result<FileInfo> CachingFileSystem::GetFileInfo(const std::string& path) {
+  FileInfo info;
+  if (cache_->GetInfo(path, &info)) {
+    return info;
+  }
+  ARROW_ASSIGN_OR_RAISE(info, base_fs_->GetFileInfo(path));
+  cache_->PutInfo(info);
+  return info;
+}
+
+Result<FileInfoVector> CachingFileSystem::GetFileInfo(const FileSelector& select) {
+  FileInfoVector infos;
+  if (cache_->GetListing(select, &infos)) {
+    return infos;
+  }
+  ARROW_ASSIGN_OR_RAISE(infos, base_fs_->GetFileInfo(select));
+  cache_->PutListing(select, infos);
+  return infos;
+}
+
+Status CachingFileSystem::CreateDir(const std::string& path, bool recursive) {
+  cache_->Invalidate(path);
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status CachingFileSystem::DeleteDir(const std::string& path) {
+  cache_->Invalidate(path);
+  return base_fs_->DeleteDir(path);
+}
+
+Status CachingFileSystem::DeleteDirContents(const std::string& path,
+                                            bool missing_dir_ok) {
+  cache_->Invalidate(path);
+  return base_fs_->DeleteDirContents(path, missing_dir_ok);
+}
+
+Status CachingFileSystem::DeleteRootDirContents() {
+  cache_->Clear();
+  return base_fs_->DeleteRootDirContents();
+}
+
+Status CachingFileSystem::DeleteFile(const std::string& path) {
+  cache_->Invalidate(path);
+  return base_fs_->DeleteFile(path);
+}
+
+Status CachingFileSystem::Move(const std::string& src, const std::string& dest) {
+  cache_->Invalidate(src);
+  cache_->Invalidate(dest);
+  return base_fs_->Move(src, dest);
+}
+
+Status CachingFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  cache_->Invalidate(dest);
+  return base_fs_->CopyFile(src, dest);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const std::string& path) {
+  return base_fs_->OpenInputStream(path);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const FileInfo& info) {
+  return base_fs_->OpenInputStream(info);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const std::string& path) {
+  return base_fs_->OpenInputFile(path);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const FileInfo& info) {
+  return base_fs_->OpenInputFile(info);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenOutputStream(
+    const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  cache_->Invalidate(path);
+  return base_fs_->OpenOutputStream(path, metadata);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenAppendStream(
+    const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  cache_->Invalidate(path);
+  return base_fs_->OpenAppendStream(path, metadata);
+}
+
 Status CopyFiles(const std::vector<FileLocator>& sources,
                  const std::vector<FileLocator>& destinations,
                  const io::IOContext& io_context, int64_t chunk_size, bool use_threads) {
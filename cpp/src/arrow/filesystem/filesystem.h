@@ -446,6 +446,70 @@ class ARROW_EXPORT SlowFileSystem : public FileSystem {
   std::shared_ptr<io::LatencyGenerator> latencies_;
 };
 
+/// \brief A FileSystem implementation that delegates to another
+/// implementation but caches file information.
+///
+/// The results of GetFileInfo() for single paths and for selectors are cached
+/// for `ttl_seconds`, so that repeated discovery of the same files (for example
+/// by several datasets sharing this filesystem instance) doesn't reach the base
+/// filesystem.  Modifications issued through this filesystem invalidate the
+/// affected entries, while other modifications are only seen once the entries
+/// expire or are explicitly invalidated.
+class ARROW_EXPORT CachingFileSystem : public FileSystem {
+ public:
+  /// \brief Cache file information for `ttl_seconds`, which can be infinite
+  CachingFileSystem(std::shared_ptr<FileSystem> base_fs, double ttl_seconds);
+  ~CachingFileSystem() override;
+
+  std::string type_name() const override { return "caching"; }
+  std::shared_ptr<FileSystem> base_fs() const { return base_fs_; }
+
+  Result<std::string> NormalizePath(std::string path) override;
+
+  bool Equals(const FileSystem& other) const override;
+
+  /// \brief Forget all cached file information
+  void Invalidate();
+  /// \brief Forget the cached information for `path`, its ancestors and descendants
+  void Invalidate(const std::string& path);
+
+  using FileSystem::GetFileInfo;
+  Result<FileInfo> GetFileInfo(const std::string& path) override;
+  Result<FileInfoVector> GetFileInfo(const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive = true) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path, bool missing_dir_ok = false) override;
+  Status DeleteRootDirContents() override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata = {}) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata = {}) override;
+
+ protected:
+  std::shared_ptr<FileSystem> base_fs_;
+
+  class Cache;
+  std::unique_ptr<Cache> cache_;
+};
+
 /// \defgroup filesystem-factories Functions for creating FileSystem instances
 ///
 /// @{
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -885,6 +886,115 @@ class TestSlowFSGeneric : public ::testing::Test, public GenericFileSystemTest {
 
 GENERIC_FS_TEST_FUNCTIONS(TestSlowFSGeneric);
 
+////////////////////////////////////////////////////////////////////////////
+// CachingFileSystem tests
+
+class TestCachingFSGeneric : public ::testing::Test, public GenericFileSystemTest {
+ public:
+  void SetUp() override {
+    time_ = TimePoint(TimePoint::duration(42));
+    fs_ = std::make_shared<MockFileSystem>(time_);
+    caching_fs_ = std::make_shared<CachingFileSystem>(
+        fs_, std::numeric_limits<double>::infinity());
+  }
+
+ protected:
+  std::shared_ptr<FileSystem> GetEmptyFileSystem() override { return caching_fs_; }
+
+  bool have_file_metadata() const override { return true; }
+
+  TimePoint time_;
+  std::shared_ptr<MockFileSystem> fs_;
+  std::shared_ptr<CachingFileSystem> caching_fs_;
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestCachingFSGeneric);
+
+class TestCachingFileSystem : public TestMockFS {
+ public:
+  void SetUp() override {
+    TestMockFS::SetUp();
+    caching_fs_ = std::make_shared<CachingFileSystem>(
+        fs_, std::numeric_limits<double>::infinity());
+  }
+
+ protected:
+  std::shared_ptr<CachingFileSystem> caching_fs_;
+};
+
+TEST_F(TestCachingFileSystem, GetFileInfo) {
+  ASSERT_OK(fs_->CreateDir("AB"));
+  CreateFile("AB/CD", "data");
+  ASSERT_OK_AND_ASSIGN(auto info, caching_fs_->GetFileInfo("AB/CD"));
+  AssertFileInfo(info, "AB/CD", FileType::File, time_, 4);
+  ASSERT_OK_AND_ASSIGN(info, caching_fs_->GetFileInfo("AB/EF"));
+  AssertFileInfo(info, "AB/EF", FileType::NotFound);
+
+  // Modifications behind the cache's back are not seen...
+  ASSERT_OK(fs_->DeleteFile("AB/CD"));
+  CreateFile("AB/EF", "other data");
+  ASSERT_OK_AND_ASSIGN(info, caching_fs_->GetFileInfo("AB/CD"));
+  AssertFileInfo(info, "AB/CD", FileType::File, time_, 4);
+  ASSERT_OK_AND_ASSIGN(info, caching_fs_->GetFileInfo("AB/EF"));
+  AssertFileInfo(info, "AB/EF", FileType::NotFound);
+
+  // ... until invalidated
+  caching_fs_->Invalidate("AB");
+  ASSERT_OK_AND_ASSIGN(info, caching_fs_->GetFileInfo("AB/CD"));
+  AssertFileInfo(info, "AB/CD", FileType::NotFound);
+  ASSERT_OK_AND_ASSIGN(info, caching_fs_->GetFileInfo("AB/EF"));
+  AssertFileInfo(info, "AB/EF", FileType::File, time_, 10);
+
+  // Modifications through the cache invalidate affected entries
+  ASSERT_OK(caching_fs_->DeleteFile("AB/EF"));
+  ASSERT_OK_AND_ASSIGN(info, caching_fs_->GetFileInfo("AB/EF"));
+  AssertFileInfo(info, "AB/EF", FileType::NotFound);
+}
+
+TEST_F(TestCachingFileSystem, GetFileInfoSelector) {
+  ASSERT_OK(fs_->CreateDir("AB"));
+  CreateFile("AB/CD", "data");
+  FileSelector selector;
+  selector.base_dir = "AB";
+  ASSERT_OK_AND_ASSIGN(auto infos, caching_fs_->GetFileInfo(selector));
+  ASSERT_EQ(infos.size(), 1);
+
+  CreateFile("AB/EF", "other data");
+  ASSERT_OK_AND_ASSIGN(infos, caching_fs_->GetFileInfo(selector));
+  ASSERT_EQ(infos.size(), 1);
+  // Listed entries are cached as well
+  ASSERT_OK(fs_->DeleteFile("AB/CD"));
+  ASSERT_OK_AND_ASSIGN(auto info, caching_fs_->GetFileInfo("AB/CD"));
+  AssertFileInfo(info, "AB/CD", FileType::File, time_, 4);
+
+  // A different selector isn't cached
+  selector.recursive = true;
+  ASSERT_OK_AND_ASSIGN(infos, caching_fs_->GetFileInfo(selector));
+  ASSERT_EQ(infos.size(), 1);
+  AssertFileInfo(infos[0], "AB/EF", FileType::File, time_, 10);
+
+  caching_fs_->Invalidate();
+  selector.recursive = false;
+  ASSERT_OK_AND_ASSIGN(infos, caching_fs_->GetFileInfo(selector));
+  ASSERT_EQ(infos.size(), 1);
+  AssertFileInfo(infos[0], "AB/EF", FileType::File, time_, 10);
+
+  // Writing a file through the cache invalidates its parent's listing
+  ASSERT_OK_AND_ASSIGN(auto stream, caching_fs_->OpenOutputStream("AB/GH"));
+  ASSERT_OK(stream->Close());
+  ASSERT_OK_AND_ASSIGN(infos, caching_fs_->GetFileInfo(selector));
+  ASSERT_EQ(infos.size(), 2);
+}
+
+TEST_F(TestCachingFileSystem, Expiry) {
+  auto caching_fs = std::make_shared<CachingFileSystem>(fs_, /*ttl_seconds=*/0);
+  ASSERT_OK_AND_ASSIGN(auto info, caching_fs->GetFileInfo("AB"));
+  AssertFileInfo(info, "AB", FileType::NotFound);
+  ASSERT_OK(fs_->CreateDir("AB"));
+  ASSERT_OK_AND_ASSIGN(info, caching_fs->GetFileInfo("AB"));
+  AssertFileInfo(info, "AB", FileType::Directory);
+}
+
 }  // namespace internal
 }  // namespace fs
 }  // namespace arrow
@@ -17,6 +17,8 @@
 
 #include <chrono>
 #include <cstring>
+#include <deque>
+#include <mutex>
 #include <sstream>
 #include <utility>
 
@@ -33,8 +35,10 @@
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/util_internal.h"
 #include "arrow/io/file.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/uri.h"
 #include "arrow/util/windows_fixup.h"
 
@@ -236,6 +240,122 @@ Status StatSelector(const PlatformFilename& dir_fn, const FileSelector& select,
   return Status::OK();
 }
 
+// Walks a directory tree for GetFileInfoGenerator(), listing up to
+// `max_concurrency` directories at once on an executor.  Each directory's
+// entries are pushed as one batch, as soon as it has been listed.
+class ParallelDirectoryWalker
+    : public std::enable_shared_from_this<ParallelDirectoryWalker> {
+ public:
+  using Producer = PushGenerator<std::vector<FileInfo>>::Producer;
+
+  ParallelDirectoryWalker(FileSelector select, ::arrow::internal::Executor* executor,
+                          Producer producer)
+      : select_(std::move(select)),
+        executor_(executor),
+        max_concurrency_(std::max(executor->GetCapacity(), 1)),
+        producer_(std::move(producer)) {}
+
+  void Start(PlatformFilename base_fn) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    pending_.push_back({std::move(base_fn), 0});
+    ScheduleLocked(std::move(lock));
+  }
+
+ private:
+  struct Directory {
+    PlatformFilename fn;
+    int32_t nesting_depth;
+  };
+
+  // Spawn listing tasks for pending directories, up to the concurrency limit,
+  // and close the generator once the walk is over
+  void ScheduleLocked(std::unique_lock<std::mutex> lock) {
+    while (status_.ok() && in_flight_ < max_concurrency_ && !pending_.empty()) {
+      auto dir = std::move(pending_.front());
+      pending_.pop_front();
+      auto self = shared_from_this();
+      auto st = executor_->Spawn([self, dir]() { self->ListDirectory(dir); });
+      if (st.ok()) {
+        ++in_flight_;
+      } else {
+        status_ &= st;
+      }
+    }
+    if (!status_.ok()) {
+      // Stop walking, but wait for running tasks so that the error is yielded last
+      pending_.clear();
+    }
+    if (in_flight_ > 0 || !pending_.empty()) {
+      return;
+    }
+    auto st = status_;
+    lock.unlock();
+    if (!st.ok()) {
+      producer_.Push(std::move(st));
+    }
+    producer_.Close();
+  }
+
+  void ListDirectory(const Directory& dir) {
+    std::vector<FileInfo> infos;
+    std::vector<Directory> children;
+    // Don't bother listing if the consumer went away
+    Status st = producer_.is_closed() ? Status::OK()
+                                      : StatDirectory(dir, &infos, &children);
+    if (st.ok() && !infos.empty()) {
+      producer_.Push(std::move(infos));
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    --in_flight_;
+    status_ &= st;
+    if (status_.ok() && !producer_.is_closed()) {
+      for (auto& child : children) {
+        pending_.push_back(std::move(child));
+      }
+    }
+    ScheduleLocked(std::move(lock));
+  }
+
+  Status StatDirectory(const Directory& dir, std::vector<FileInfo>* out,
+                       std::vector<Directory>* children) {
+    auto result = ListDir(dir.fn);
+    if (!result.ok()) {
+      auto status = result.status();
+      if (select_.allow_not_found && status.IsIOError()) {
+        ARROW_ASSIGN_OR_RAISE(bool exists, FileExists(dir.fn));
+        if (!exists) {
+          return Status::OK();
+        }
+      }
+      return status;
+    }
+
+    for (const auto& child_fn : *result) {
+      PlatformFilename full_fn = dir.fn.Join(child_fn);
+      ARROW_ASSIGN_OR_RAISE(FileInfo info, StatFile(full_fn.ToNative()));
+      if (info.type() == FileType::NotFound) {
+        continue;
+      }
+      if (dir.nesting_depth < select_.max_recursion && select_.recursive &&
+          info.type() == FileType::Directory) {
+        children->push_back({std::move(full_fn), dir.nesting_depth + 1});
+      }
+      out->push_back(std::move(info));
+    }
+    return Status::OK();
+  }
+
+  const FileSelector select_;
+  ::arrow::internal::Executor* executor_;
+  const int max_concurrency_;
+  Producer producer_;
+
+  std::mutex mutex_;
+  std::deque<Directory> pending_;
+  int in_flight_ = 0;
+  Status status_;
+};
+
 }  // namespace
 
 LocalFileSystemOptions LocalFileSystemOptions::Defaults() {
@@ -243,7 +363,8 @@ LocalFileSystemOptions LocalFileSystemOptions::Defaults() {
 }
 
 bool LocalFileSystemOptions::Equals(const LocalFileSystemOptions& other) const {
-  return use_mmap == other.use_mmap;
+  return use_mmap == other.use_mmap && use_io_uring == other.use_io_uring &&
+         use_direct_io == other.use_direct_io;
 }
 
 Result<LocalFileSystemOptions> LocalFileSystemOptions::FromUri(
@@ -309,6 +430,22 @@ Result<std::vector<FileInfo>> LocalFileSystem::GetFileInfo(const FileSelector& s
   return results;
 }
 
+FileInfoGenerator LocalFileSystem::GetFileInfoGenerator(const FileSelector& select) {
+  auto st = ValidatePath(select.base_dir);
+  if (!st.ok()) {
+    return MakeFailingGenerator<FileInfoVector>(std::move(st));
+  }
+  auto maybe_fn = PlatformFilename::FromString(select.base_dir);
+  if (!maybe_fn.ok()) {
+    return MakeFailingGenerator<FileInfoVector>(maybe_fn.status());
+  }
+  PushGenerator<FileInfoVector> gen;
+  auto walker = std::make_shared<ParallelDirectoryWalker>(select, io_context().executor(),
+                                                          gen.producer());
+  walker->Start(*std::move(maybe_fn));
+  return gen;
+}
+
 Status LocalFileSystem::CreateDir(const std::string& path, bool recursive) {
   RETURN_NOT_OK(ValidatePath(path));
   ARROW_ASSIGN_OR_RAISE(auto fn, PlatformFilename::FromString(path));
@@ -414,7 +551,10 @@ Result<std::shared_ptr<InputStreamType>> OpenInputStreamGeneric(
   if (options.use_mmap) {
     return io::MemoryMappedFile::Open(path, io::FileMode::READ);
   } else {
-    return io::ReadableFile::Open(path, io_context.pool());
+    io::ReadableFileOptions file_options;
+    file_options.use_io_uring = options.use_io_uring;
+    file_options.use_direct_io = options.use_direct_io;
+    return io::ReadableFile::Open(path, file_options, io_context.pool());
   }
 }
 
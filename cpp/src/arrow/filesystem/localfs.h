@@ -38,6 +38,16 @@ struct ARROW_EXPORT LocalFileSystemOptions {
   /// or a regular one.
   bool use_mmap = false;
 
+  /// Whether OpenInputStream and OpenInputFile return a file reading
+  /// asynchronously through io_uring (Linux only).  Ignored if use_mmap
+  /// is set, or if io_uring is not available.
+  bool use_io_uring = false;
+
+  /// Whether OpenInputStream and OpenInputFile return a file reading around
+  /// the page cache, for large scans (see io::ReadableFileOptions).  Ignored
+  /// if use_mmap is set, or if the file system doesn't support direct IO.
+  bool use_direct_io = false;
+
   /// \brief Initialize with defaults
   static LocalFileSystemOptions Defaults();
 
@@ -73,6 +83,10 @@ class ARROW_EXPORT LocalFileSystem : public FileSystem {
   /// \endcond
   Result<FileInfo> GetFileInfo(const std::string& path) override;
   Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
+  /// \brief Stream file information, listing several directories concurrently
+  ///
+  /// Unlike GetFileInfo(), the entries are not yielded in a deterministic order.
+  FileInfoGenerator GetFileInfoGenerator(const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
@@ -29,7 +29,9 @@
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/test_util.h"
 #include "arrow/filesystem/util_internal.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/io_util.h"
 
 namespace arrow {
@@ -398,6 +400,43 @@ TYPED_TEST(TestLocalFS, FileMTime) {
   AssertDurationBetween(t2 - infos[1].mtime(), -kTimeSlack, kTimeSlack);
 }
 
+TYPED_TEST(TestLocalFS, GetFileInfoGenerator) {
+  for (int i = 0; i < 20; ++i) {
+    const auto dir = "part=" + std::to_string(i);
+    ASSERT_OK(this->fs_->CreateDir(dir + "/sub"));
+    CreateFile(this->fs_.get(), dir + "/a", "data");
+    CreateFile(this->fs_.get(), dir + "/sub/b", "more data");
+  }
+
+  auto check_selector = [&](const FileSelector& select) {
+    ASSERT_OK_AND_ASSIGN(auto expected, this->fs_->GetFileInfo(select));
+    ASSERT_FINISHES_OK_AND_ASSIGN(
+        auto batches, CollectAsyncGenerator(this->fs_->GetFileInfoGenerator(select)));
+    std::vector<FileInfo> actual;
+    for (const auto& batch : batches) {
+      actual.insert(actual.end(), batch.begin(), batch.end());
+    }
+    SortInfos(&expected);
+    SortInfos(&actual);
+    ASSERT_EQ(actual, expected);
+  };
+
+  FileSelector select;
+  check_selector(select);
+  select.recursive = true;
+  check_selector(select);
+  select.max_recursion = 1;
+  check_selector(select);
+
+  select.base_dir = "nonexistent";
+  auto gen = this->fs_->GetFileInfoGenerator(select);
+  ASSERT_FINISHES_AND_RAISES(IOError, CollectAsyncGenerator(gen));
+  select.allow_not_found = true;
+  gen = this->fs_->GetFileInfoGenerator(select);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(gen));
+  ASSERT_EQ(batches.size(), 0);
+}
+
 // TODO Should we test backslash paths on Windows?
 // SubTreeFileSystem isn't compatible with them.
 
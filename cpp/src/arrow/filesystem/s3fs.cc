@@ -21,6 +21,7 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -85,6 +86,7 @@
 #include "arrow/status.h"
 #include "arrow/util/async_generator.h"
 #include "arrow/util/atomic_shared_ptr.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
@@ -393,6 +395,10 @@ bool S3Options::Equals(const S3Options& other) const {
           proxy_options.Equals(other.proxy_options) &&
           credentials_kind == other.credentials_kind &&
           background_writes == other.background_writes &&
+          upload_part_size == other.upload_part_size &&
+          max_concurrent_uploads == other.max_concurrent_uploads &&
+          download_concurrency == other.download_concurrency &&
+          download_part_size == other.download_part_size &&
           allow_bucket_creation == other.allow_bucket_creation &&
           allow_bucket_deletion == other.allow_bucket_deletion &&
           default_metadata_equals && GetAccessKey() == other.GetAccessKey() &&
@@ -878,17 +884,146 @@ Aws::IOStreamFactory AwsWriteableStreamFactory(void* data, int64_t nbytes) {
   return [=]() { return Aws::New<StringViewStream>("", data, nbytes); };
 }
 
-Result<S3Model::GetObjectResult> GetObjectRange(Aws::S3::S3Client* client,
-                                                const S3Path& path, int64_t start,
-                                                int64_t length, void* out) {
+// A stop requested on `stop_token` aborts the transfer while it is in flight
+Result<S3Model::GetObjectResult> GetObjectRange(
+    Aws::S3::S3Client* client, const S3Path& path, int64_t start, int64_t length,
+    void* out, const StopToken& stop_token = StopToken::Unstoppable()) {
+  RETURN_NOT_OK(stop_token.Poll());
   S3Model::GetObjectRequest req;
   req.SetBucket(ToAwsString(path.bucket));
   req.SetKey(ToAwsString(path.key));
   req.SetRange(ToAwsString(FormatRange(start, length)));
   req.SetResponseStreamFactory(AwsWriteableStreamFactory(out, length));
-  return OutcomeToResult(client->GetObject(req));
+  if (stop_token.IsStoppable()) {
+    req.SetContinueRequestHandler([stop_token](const Aws::Http::HttpRequest*) {
+      return !stop_token.IsStopRequested();
+    });
+  }
+  auto outcome = client->GetObject(req);
+  if (!outcome.IsSuccess() && stop_token.IsStopRequested()) {
+    // Report the cancellation rather than the aborted transfer
+    return stop_token.Poll();
+  }
+  return OutcomeToResult(std::move(outcome));
 }
 
+// Read a range of an object into `out`, returning the number of bytes read
+Result<int64_t> ReadObjectRange(Aws::S3::S3Client* client, const S3Path& path,
+                                int64_t start, int64_t length, void* out,
+                                const StopToken& stop_token = StopToken::Unstoppable()) {
+  ARROW_ASSIGN_OR_RAISE(S3Model::GetObjectResult result,
+                        GetObjectRange(client, path, start, length, out, stop_token));
+  auto& stream = result.GetBody();
+  stream.ignore(length);
+  // NOTE: the stream is a stringstream by default, there is no actual error
+  // to check for.  However, stream.fail() may return true if EOF is reached.
+  return stream.gcount();
+}
+
+// A range of an object downloaded as several parts fetched concurrently.
+//
+// Workers running on the IO thread pool claim parts until none are left (or
+// one of them failed); the future finishes once all claimed parts are done.
+// Since a worker which starts late finds no part to claim, the thread waiting
+// for the download can run a worker itself without risking a deadlock on a
+// saturated pool.  Once `stop_token` is stopped, the remaining parts are not
+// fetched and those in flight are aborted.
+class ParallelDownload : public std::enable_shared_from_this<ParallelDownload> {
+ public:
+  ParallelDownload(std::shared_ptr<Aws::S3::S3Client> client, const S3Path& path,
+                   int64_t position, int64_t nbytes, int64_t part_size, uint8_t* out,
+                   StopToken stop_token)
+      : client_(std::move(client)),
+        path_(path),
+        position_(position),
+        nbytes_(nbytes),
+        part_size_(part_size),
+        num_parts_(bit_util::CeilDiv(nbytes, part_size)),
+        out_(out),
+        stop_token_(std::move(stop_token)),
+        done_(Future<int64_t>::Make()) {}
+
+  int64_t num_parts() const { return num_parts_; }
+
+  /// Spawn up to `num_workers` workers on the executor
+  Status Spawn(::arrow::internal::Executor* executor, int num_workers) {
+    auto self = shared_from_this();
+    for (int i = 0; i < num_workers; ++i) {
+      RETURN_NOT_OK(executor->Spawn([self]() { self->Work(); }));
+    }
+    return Status::OK();
+  }
+
+  void Work() {
+    while (true) {
+      int64_t part;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (next_part_ == num_parts_) {
+          return;
+        }
+        part = next_part_++;
+        ++parts_in_flight_;
+      }
+      Status st = ReadPart(part);
+      bool finished;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!st.ok()) {
+          status_ &= st;
+          // Stop claiming parts
+          next_part_ = num_parts_;
+        }
+        finished = --parts_in_flight_ == 0 && next_part_ == num_parts_;
+      }
+      if (finished) {
+        if (status_.ok()) {
+          done_.MarkFinished(bytes_read_.load());
+        } else {
+          done_.MarkFinished(status_);
+        }
+        return;
+      }
+    }
+  }
+
+  /// The total number of bytes read, once all parts are done
+  const Future<int64_t>& done() const { return done_; }
+
+ private:
+  Status ReadPart(int64_t part) {
+    const int64_t offset = part * part_size_;
+    const int64_t length = std::min(part_size_, nbytes_ - offset);
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          ReadObjectRange(client_.get(), path_, position_ + offset,
+                                          length, out_ + offset, stop_token_));
+    if (bytes_read < length && part != num_parts_ - 1) {
+      // The object was truncated meanwhile, the output would have holes
+      return Status::IOError("Short read of ", bytes_read, " bytes instead of ",
+                             length, " for key '", path_.key, "' in bucket '",
+                             path_.bucket, "'");
+    }
+    bytes_read_ += bytes_read;
+    return Status::OK();
+  }
+
+  std::shared_ptr<Aws::S3::S3Client> client_;
+  const S3Path path_;
+  const int64_t position_;
+  const int64_t nbytes_;
+  const int64_t part_size_;
+  const int64_t num_parts_;
+  uint8_t* out_;
+  const StopToken stop_token_;
+  Future<int64_t> done_;
+
+  std::mutex mutex_;
+  int64_t next_part_ = 0;
+  int64_t parts_in_flight_ = 0;
+  Status status_;
+  std::atomic<int64_t> bytes_read_{0};
+};
+
 template <typename ObjectResult>
 std::shared_ptr<const KeyValueMetadata> GetObjectMetadata(const ObjectResult& result) {
   auto md = std::make_shared<KeyValueMetadata>();
@@ -991,10 +1126,13 @@ class ObjectInputFile final : public io::RandomAccessFile {
  public:
   ObjectInputFile(std::shared_ptr<Aws::S3::S3Client> client,
                   const io::IOContext& io_context, const S3Path& path,
-                  int64_t size = kNoSize)
+                  const S3Options& options, bool readahead, int64_t size = kNoSize)
       : client_(std::move(client)),
         io_context_(io_context),
         path_(path),
+        download_concurrency_(std::max(options.download_concurrency, 1)),
+        download_part_size_(std::max<int64_t>(options.download_part_size, 1)),
+        readahead_(readahead && download_concurrency_ > 1),
         content_length_(size) {}
 
   Status Init() {
@@ -1056,6 +1194,7 @@ class ObjectInputFile final : public io::RandomAccessFile {
 
   Status Close() override {
     client_ = nullptr;
+    window_ = next_window_ = {};
     closed_ = true;
     return Status::OK();
   }
@@ -1081,6 +1220,52 @@ class ObjectInputFile final : public io::RandomAccessFile {
   }
 
   Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    return DoReadAt(position, nbytes, out, io_context_.stop_token());
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    return DoReadAt(position, nbytes, io_context_.stop_token());
+  }
+
+  // Unlike the default implementation, observe the stop token of `ctx` rather than
+  // the one the file was opened with
+  Future<std::shared_ptr<Buffer>> ReadAsync(const io::IOContext& ctx, int64_t position,
+                                            int64_t nbytes) override {
+    auto self =
+        ::arrow::internal::checked_pointer_cast<ObjectInputFile>(shared_from_this());
+    StopToken stop_token = ctx.stop_token();
+    return DeferNotOk(SubmitIO(ctx, [self, position, nbytes, stop_token] {
+      return self->DoReadAt(position, nbytes, stop_token);
+    }));
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    if (readahead_) {
+      return ReadAhead(nbytes, static_cast<uint8_t*>(out));
+    }
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
+    pos_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    if (readahead_) {
+      RETURN_NOT_OK(CheckClosed());
+      nbytes = std::min(nbytes, content_length_ - pos_);
+      ARROW_ASSIGN_OR_RAISE(auto buf,
+                            AllocateResizableBuffer(nbytes, io_context_.pool()));
+      ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAhead(nbytes, buf->mutable_data()));
+      RETURN_NOT_OK(buf->Resize(bytes_read));
+      return std::move(buf);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(pos_, nbytes));
+    pos_ += buffer->size();
+    return std::move(buffer);
+  }
+
+ protected:
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out,
+                           const StopToken& stop_token) {
     RETURN_NOT_OK(CheckClosed());
     RETURN_NOT_OK(CheckPosition(position, "read"));
 
@@ -1088,19 +1273,16 @@ class ObjectInputFile final : public io::RandomAccessFile {
     if (nbytes == 0) {
       return 0;
     }
+    if (download_concurrency_ > 1 && nbytes > download_part_size_) {
+      return ParallelReadAt(position, nbytes, static_cast<uint8_t*>(out), stop_token);
+    }
 
     // Read the desired range of bytes
-    ARROW_ASSIGN_OR_RAISE(S3Model::GetObjectResult result,
-                          GetObjectRange(client_.get(), path_, position, nbytes, out));
-
-    auto& stream = result.GetBody();
-    stream.ignore(nbytes);
-    // NOTE: the stream is a stringstream by default, there is no actual error
-    // to check for.  However, stream.fail() may return true if EOF is reached.
-    return stream.gcount();
+    return ReadObjectRange(client_.get(), path_, position, nbytes, out, stop_token);
   }
 
-  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+  Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes,
+                                           const StopToken& stop_token) {
     RETURN_NOT_OK(CheckClosed());
     RETURN_NOT_OK(CheckPosition(position, "read"));
 
@@ -1110,29 +1292,108 @@ class ObjectInputFile final : public io::RandomAccessFile {
     ARROW_ASSIGN_OR_RAISE(auto buf, AllocateResizableBuffer(nbytes, io_context_.pool()));
     if (nbytes > 0) {
       ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
-                            ReadAt(position, nbytes, buf->mutable_data()));
+                            DoReadAt(position, nbytes, buf->mutable_data(), stop_token));
       DCHECK_LE(bytes_read, nbytes);
       RETURN_NOT_OK(buf->Resize(bytes_read));
     }
     return std::move(buf);
   }
 
-  Result<int64_t> Read(int64_t nbytes, void* out) override {
-    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
-    pos_ += bytes_read;
-    return bytes_read;
-  }
+  Result<int64_t> ParallelReadAt(int64_t position, int64_t nbytes, uint8_t* out,
+                                 const StopToken& stop_token) {
+    auto download = std::make_shared<ParallelDownload>(
+        client_, path_, position, nbytes, download_part_size_, out, stop_token);
+    // One worker runs on the calling thread, which would otherwise sit idle
+    const int num_workers = static_cast<int>(std::min<int64_t>(
+        download_concurrency_ - 1, download->num_parts() - 1));
+    Status st = download->Spawn(io_context_.executor(), num_workers);
+    download->Work();
+    // Even if spawning failed, wait for the claimed parts not to write into `out`
+    // after returning
+    auto result = download->done().result();
+    RETURN_NOT_OK(st);
+    return result;
+  }
+
+  struct ReadAheadWindow {
+    int64_t position;
+    std::shared_ptr<ResizableBuffer> buffer;
+    Future<int64_t> bytes_read;
+  };
 
-  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
-    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(pos_, nbytes));
-    pos_ += buffer->size();
-    return std::move(buffer);
+  // Start downloading the window of `download_concurrency_` parts at `position`
+  Result<ReadAheadWindow> StartWindow(int64_t position) {
+    const int64_t nbytes = std::min(download_part_size_ * download_concurrency_,
+                                    content_length_ - position);
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> buffer,
+                          AllocateResizableBuffer(nbytes, io_context_.pool()));
+    auto download = std::make_shared<ParallelDownload>(
+        client_, path_, position, nbytes, download_part_size_, buffer->mutable_data(),
+        io_context_.stop_token());
+    // Keep the buffer alive until the download is done, even if the window
+    // is discarded meanwhile
+    auto bytes_read = download->done().Then(
+        [buffer](const int64_t& bytes_read) { return bytes_read; });
+    const int num_workers = static_cast<int>(
+        std::min<int64_t>(download_concurrency_, download->num_parts()));
+    Status st = download->Spawn(io_context_.executor(), num_workers);
+    if (!st.ok()) {
+      // Finish the parts that may have been claimed already
+      download->Work();
+      return st;
+    }
+    return ReadAheadWindow{position, std::move(buffer), std::move(bytes_read)};
+  }
+
+  // Sequential read served from windows downloaded in parallel, the next window
+  // being downloaded while the current one is consumed
+  Result<int64_t> ReadAhead(int64_t nbytes, uint8_t* out) {
+    RETURN_NOT_OK(CheckClosed());
+    nbytes = std::min(nbytes, content_length_ - pos_);
+    int64_t total_read = 0;
+    while (total_read < nbytes) {
+      if (pos_ < window_end_ && pos_ >= window_.position) {
+        const int64_t length = std::min(window_end_ - pos_, nbytes - total_read);
+        std::memcpy(out + total_read, window_.buffer->data() + (pos_ - window_.position),
+                    length);
+        total_read += length;
+        pos_ += length;
+        continue;
+      }
+      window_ = {};
+      window_end_ = 0;
+      ReadAheadWindow window;
+      if (next_window_.buffer && next_window_.position == pos_) {
+        window = std::move(next_window_);
+      } else {
+        // First read, or a seek happened
+        ARROW_ASSIGN_OR_RAISE(window, StartWindow(pos_));
+      }
+      next_window_ = {};
+      ARROW_ASSIGN_OR_RAISE(int64_t window_size, window.bytes_read.result());
+      window_ = std::move(window);
+      window_end_ = window_.position + window_size;
+      if (window_end_ < content_length_) {
+        ARROW_ASSIGN_OR_RAISE(next_window_, StartWindow(window_end_));
+      }
+      if (window_size == 0) {
+        // Object truncated meanwhile
+        break;
+      }
+    }
+    return total_read;
   }
 
- protected:
   std::shared_ptr<Aws::S3::S3Client> client_;
   const io::IOContext io_context_;
   S3Path path_;
+  const int64_t download_concurrency_;
+  const int64_t download_part_size_;
+  const bool readahead_;
+
+  ReadAheadWindow window_{};
+  int64_t window_end_ = 0;
+  ReadAheadWindow next_window_{};
 
   bool closed_ = false;
   int64_t pos_ = 0;
@@ -1145,6 +1406,37 @@ class ObjectInputFile final : public io::RandomAccessFile {
 // so I chose the safer value.
 // (see https://docs.aws.amazon.com/AmazonS3/latest/API/mpUploadUploadPart.html)
 static constexpr int64_t kMinimumPartUpload = 5 * 1024 * 1024;
+// Maximum size for each part of a multipart upload
+static constexpr int64_t kMaximumPartUpload = 5LL * 1024 * 1024 * 1024;
+
+// The memory held by parts uploaded in the background, across all output streams
+class UploadMemoryBudget {
+ public:
+  static UploadMemoryBudget* Instance() {
+    static UploadMemoryBudget budget;
+    return &budget;
+  }
+
+  void set_limit(int64_t limit) { limit_.store(limit); }
+  int64_t limit() const { return limit_.load(); }
+
+  bool TryReserve(int64_t nbytes) {
+    const int64_t limit = limit_.load();
+    int64_t used = used_.load();
+    do {
+      if (limit > 0 && used + nbytes > limit) {
+        return false;
+      }
+    } while (!used_.compare_exchange_weak(used, used + nbytes));
+    return true;
+  }
+
+  void Release(int64_t nbytes) { used_ -= nbytes; }
+
+ private:
+  std::atomic<int64_t> limit_{0};
+  std::atomic<int64_t> used_{0};
+};
 
 // An OutputStream that writes to a S3 object
 class ObjectOutputStream final : public io::OutputStream {
@@ -1160,7 +1452,11 @@ class ObjectOutputStream final : public io::OutputStream {
         path_(path),
         metadata_(metadata),
         default_metadata_(options.default_metadata),
-        background_writes_(options.background_writes) {}
+        background_writes_(options.background_writes),
+        max_concurrent_uploads_(options.max_concurrent_uploads),
+        part_size_increment_(std::min(
+            std::max(options.upload_part_size, kMinimumPartUpload), kMaximumPartUpload)),
+        part_upload_threshold_(part_size_increment_) {}
 
   ~ObjectOutputStream() override {
     // For compliance with the rest of the IO stack, Close rather than Abort,
@@ -1356,12 +1652,13 @@ class ObjectOutputStream final : public io::OutputStream {
     req.SetPartNumber(part_number_);
     req.SetContentLength(nbytes);
 
-    if (!background_writes_) {
+    if (!background_writes_ || !ReserveBackgroundUpload(nbytes)) {
       req.SetBody(std::make_shared<StringViewStream>(data, nbytes));
       auto outcome = client_->UploadPart(req);
       if (!outcome.IsSuccess()) {
         return UploadPartError(req, outcome);
       } else {
+        std::unique_lock<std::mutex> lock(upload_state_->mutex);
         AddCompletedPart(upload_state_, part_number_, outcome.GetResult());
       }
     } else {
@@ -1383,14 +1680,19 @@ class ObjectOutputStream final : public io::OutputStream {
         }
       }
       auto client = client_;
-      ARROW_ASSIGN_OR_RAISE(auto fut, SubmitIO(io_context_, [client, req]() {
-                              return client->UploadPart(req);
-                            }));
+      auto maybe_fut =
+          SubmitIO(io_context_, [client, req]() { return client->UploadPart(req); });
+      if (!maybe_fut.ok()) {
+        UploadMemoryBudget::Instance()->Release(nbytes);
+        return maybe_fut.status();
+      }
+      auto fut = maybe_fut.MoveValueUnsafe();
       // The closure keeps the buffer and the upload state alive
       auto state = upload_state_;
       auto part_number = part_number_;
       auto handler = [owned_buffer, state, part_number,
                       req](const Result<S3Model::UploadPartOutcome>& result) -> void {
+        UploadMemoryBudget::Instance()->Release(owned_buffer->size());
         HandleUploadOutcome(state, part_number, req, result);
       };
       fut.AddCallback(std::move(handler));
@@ -1408,13 +1710,27 @@ class ObjectOutputStream final : public io::OutputStream {
     // So the total size limit is 2475000MB or ~2.4TB, while keeping manageable
     // chunk sizes and avoiding too much buffering in the common case of a small-ish
     // stream.  If the limit's not enough, we can revisit.
+    // (with a configured part size, that part size is used as increment instead)
     if (part_number_ % 100 == 0) {
-      part_upload_threshold_ += kMinimumPartUpload;
+      part_upload_threshold_ =
+          std::min(part_upload_threshold_ + part_size_increment_, kMaximumPartUpload);
     }
 
     return Status::OK();
   }
 
+  // Whether a part of `nbytes` can be uploaded in the background rather than
+  // synchronously, reserving memory for it in the global budget if so
+  bool ReserveBackgroundUpload(int64_t nbytes) {
+    if (max_concurrent_uploads_ > 0) {
+      std::unique_lock<std::mutex> lock(upload_state_->mutex);
+      if (upload_state_->parts_in_progress >= max_concurrent_uploads_) {
+        return false;
+      }
+    }
+    return UploadMemoryBudget::Instance()->TryReserve(nbytes);
+  }
+
   static void HandleUploadOutcome(const std::shared_ptr<UploadState>& state,
                                   int part_number, const S3Model::UploadPartRequest& req,
                                   const Result<S3Model::UploadPartOutcome>& result) {
@@ -1465,6 +1781,8 @@ class ObjectOutputStream final : public io::OutputStream {
   const std::shared_ptr<const KeyValueMetadata> metadata_;
   const std::shared_ptr<const KeyValueMetadata> default_metadata_;
   const bool background_writes_;
+  const int max_concurrent_uploads_;
+  const int64_t part_size_increment_;
 
   Aws::String upload_id_;
   bool closed_ = true;
@@ -1472,7 +1790,7 @@ class ObjectOutputStream final : public io::OutputStream {
   int32_t part_number_ = 1;
   std::shared_ptr<io::BufferOutputStream> current_part_;
   int64_t current_part_size_ = 0;
-  int64_t part_upload_threshold_ = kMinimumPartUpload;
+  int64_t part_upload_threshold_;
 
   // This struct is kept alive through background writes to avoid problems
   // in the completion handler.
@@ -2168,17 +2486,20 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
   }
 
   Result<std::shared_ptr<ObjectInputFile>> OpenInputFile(const std::string& s,
-                                                         S3FileSystem* fs) {
+                                                         S3FileSystem* fs,
+                                                         bool readahead) {
     ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
     RETURN_NOT_OK(ValidateFilePath(path));
 
-    auto ptr = std::make_shared<ObjectInputFile>(client_, fs->io_context(), path);
+    auto ptr = std::make_shared<ObjectInputFile>(client_, fs->io_context(), path,
+                                                 options(), readahead);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
 
   Result<std::shared_ptr<ObjectInputFile>> OpenInputFile(const FileInfo& info,
-                                                         S3FileSystem* fs) {
+                                                         S3FileSystem* fs,
+                                                         bool readahead) {
     if (info.type() == FileType::NotFound) {
       return ::arrow::fs::internal::PathNotFound(info.path());
     }
@@ -2189,8 +2510,8 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
     ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(info.path()));
     RETURN_NOT_OK(ValidateFilePath(path));
 
-    auto ptr =
-        std::make_shared<ObjectInputFile>(client_, fs->io_context(), path, info.size());
+    auto ptr = std::make_shared<ObjectInputFile>(client_, fs->io_context(), path,
+                                                 options(), readahead, info.size());
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -2517,22 +2838,22 @@ Status S3FileSystem::CopyFile(const std::string& src, const std::string& dest) {
 
 Result<std::shared_ptr<io::InputStream>> S3FileSystem::OpenInputStream(
     const std::string& s) {
-  return impl_->OpenInputFile(s, this);
+  return impl_->OpenInputFile(s, this, /*readahead=*/true);
 }
 
 Result<std::shared_ptr<io::InputStream>> S3FileSystem::OpenInputStream(
     const FileInfo& info) {
-  return impl_->OpenInputFile(info, this);
+  return impl_->OpenInputFile(info, this, /*readahead=*/true);
 }
 
 Result<std::shared_ptr<io::RandomAccessFile>> S3FileSystem::OpenInputFile(
     const std::string& s) {
-  return impl_->OpenInputFile(s, this);
+  return impl_->OpenInputFile(s, this, /*readahead=*/false);
 }
 
 Result<std::shared_ptr<io::RandomAccessFile>> S3FileSystem::OpenInputFile(
     const FileInfo& info) {
-  return impl_->OpenInputFile(info, this);
+  return impl_->OpenInputFile(info, this, /*readahead=*/false);
 }
 
 Result<std::shared_ptr<io::OutputStream>> S3FileSystem::OpenOutputStream(
@@ -2568,5 +2889,11 @@ Result<std::string> ResolveS3BucketRegion(const std::string& bucket) {
   return resolver->ResolveRegion(bucket);
 }
 
+void SetS3UploadMemoryLimit(int64_t nbytes) {
+  UploadMemoryBudget::Instance()->set_limit(nbytes);
+}
+
+int64_t GetS3UploadMemoryLimit() { return UploadMemoryBudget::Instance()->limit(); }
+
 }  // namespace fs
 }  // namespace arrow
@@ -130,6 +130,32 @@ struct ARROW_EXPORT S3Options {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// \brief Size of the parts of multipart uploads, at least 5 MiB.
+  ///
+  /// Since an upload can have at most 10000 parts, the part size is increased by
+  /// this amount every 100 parts (allowing objects of ~2.4 TB with 5 MiB parts).
+  int64_t upload_part_size = 5 * 1024 * 1024;
+
+  /// \brief Maximum number of parts uploaded in the background by each output
+  /// stream, or 0 for no limit.
+  ///
+  /// When this limit or the process-wide upload memory limit (see
+  /// SetS3UploadMemoryLimit) is reached, parts are uploaded synchronously by the
+  /// writing call, which thus blocks until the part is uploaded.
+  /// Only relevant if background_writes is enabled.
+  int max_concurrent_uploads = 0;
+
+  /// Number of ranged GetObject requests issued concurrently for large reads.
+  ///
+  /// If greater than 1, reads spanning several download parts are split into
+  /// parts fetched in parallel on the IO thread pool, and input streams read ahead
+  /// `download_concurrency` parts at a time.  This allows sequential reads of large
+  /// objects to exceed the throughput of a single connection.
+  int download_concurrency = 1;
+
+  /// Size of each part of a parallel download (see download_concurrency)
+  int64_t download_part_size = 8 * 1024 * 1024;
+
   /// Whether to allow creation of buckets
   ///
   /// When S3FileSystem creates new buckets, it does not pass any non-default settings.
@@ -255,9 +281,10 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
 
   /// Create a sequential input stream for reading from a S3 object.
   ///
-  /// NOTE: Reads from the stream will be synchronous and unbuffered.
-  /// You way want to wrap the stream in a BufferedInputStream or use
-  /// a custom readahead strategy to avoid idle waits.
+  /// NOTE: Unless S3Options.download_concurrency is greater than 1, reads from
+  /// the stream will be synchronous and unbuffered.  You way want to wrap the
+  /// stream in a BufferedInputStream or use a custom readahead strategy to avoid
+  /// idle waits.
   Result<std::shared_ptr<io::InputStream>> OpenInputStream(
       const std::string& path) override;
   /// Create a sequential input stream for reading from a S3 object.
@@ -326,5 +353,17 @@ Status FinalizeS3();
 ARROW_EXPORT
 Result<std::string> ResolveS3BucketRegion(const std::string& bucket);
 
+/// \brief Set the limit on memory held by parts being uploaded in the background
+///
+/// The limit is shared by all S3 output streams in the process.  While it is
+/// reached, output streams upload their parts synchronously instead, which
+/// throttles writers.  0 (the default) means no limit.
+ARROW_EXPORT
+void SetS3UploadMemoryLimit(int64_t nbytes);
+
+/// \brief Return the limit set by SetS3UploadMemoryLimit
+ARROW_EXPORT
+int64_t GetS3UploadMemoryLimit();
+
 }  // namespace fs
 }  // namespace arrow
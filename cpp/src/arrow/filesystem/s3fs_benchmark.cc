@@ -291,6 +291,37 @@ static void CoalescedRead(benchmark::State& st, S3FileSystem* fs,
   std::cerr << "Read the file " << total_items << " times" << std::endl;
 }
 
+/// Read the file with parallel ranged downloads, either in one go or as a stream.
+static void ParallelRead(benchmark::State& st, const S3Options& base_options,
+                         const std::string& path, bool stream) {
+  S3Options options = base_options;
+  options.download_concurrency = static_cast<int>(st.range(0));
+  options.download_part_size = kChunkSize;
+  ASSERT_OK_AND_ASSIGN(auto fs, S3FileSystem::Make(options));
+
+  int64_t total_bytes = 0;
+  int total_items = 0;
+  for (auto _ : st) {
+    std::shared_ptr<Buffer> buf;
+    if (stream) {
+      ASSERT_OK_AND_ASSIGN(auto file, fs->OpenInputStream(path));
+      do {
+        ASSERT_OK_AND_ASSIGN(buf, file->Read(1024 * 1024));
+        total_bytes += buf->size();
+      } while (buf->size() > 0);
+    } else {
+      ASSERT_OK_AND_ASSIGN(auto file, fs->OpenInputFile(path));
+      ASSERT_OK_AND_ASSIGN(int64_t size, file->GetSize());
+      ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(0, size));
+      total_bytes += buf->size();
+    }
+    total_items += 1;
+  }
+  st.SetBytesProcessed(total_bytes);
+  st.SetItemsProcessed(total_items);
+  std::cerr << "Read the file " << total_items << " times" << std::endl;
+}
+
 /// Read a Parquet file from S3.
 static void ParquetRead(benchmark::State& st, S3FileSystem* fs, const std::string& path,
                         std::vector<int> column_indices, bool pre_buffer,
@@ -384,6 +415,25 @@ BENCHMARK_DEFINE_F(MinioFixture, ReadCoalesced500Mib)(benchmark::State& st) {
 }
 BENCHMARK_REGISTER_F(MinioFixture, ReadCoalesced500Mib)->UseRealTime();
 
+BENCHMARK_DEFINE_F(MinioFixture, ReadParallel500Mib)(benchmark::State& st) {
+  ParallelRead(st, options_, bucket_ + "/bytes_500mib", /*stream=*/false);
+}
+BENCHMARK_REGISTER_F(MinioFixture, ReadParallel500Mib)
+    ->ArgName("concurrency")
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(16)
+    ->UseRealTime();
+BENCHMARK_DEFINE_F(MinioFixture, ReadStream500Mib)(benchmark::State& st) {
+  ParallelRead(st, options_, bucket_ + "/bytes_500mib", /*stream=*/true);
+}
+BENCHMARK_REGISTER_F(MinioFixture, ReadStream500Mib)
+    ->ArgName("concurrency")
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(16)
+    ->UseRealTime();
+
 // Helpers to generate various multiple benchmarks for a given Parquet file.
 
 // NAME: the base name of the benchmark.
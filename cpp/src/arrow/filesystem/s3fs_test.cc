@@ -16,6 +16,7 @@
 // under the License.
 
 #include <algorithm>
+#include <chrono>
 #include <exception>
 #include <memory>
 #include <sstream>
@@ -60,6 +61,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/cancel.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
@@ -1048,6 +1050,142 @@ TEST_F(TestS3FS, OpenInputFile) {
   ASSERT_RAISES(IOError, file->Seek(10));
 }
 
+// The download parts are small enough for reads to span several of them
+class TestS3FSParallelDownloads : public TestS3FS {
+ public:
+  void SetUp() override {
+    TestS3FS::SetUp();
+    options_.download_concurrency = 4;
+    options_.download_part_size = 100;
+    MakeFileSystem();
+
+    data_ = random_string(1000, /*seed=*/42);
+    Aws::S3::Model::PutObjectRequest req;
+    req.SetBucket(ToAwsString("bucket"));
+    req.SetKey(ToAwsString("largefile"));
+    req.SetBody(std::make_shared<std::stringstream>(data_));
+    ASSERT_OK(OutcomeToStatus(client_->PutObject(req)));
+  }
+
+ protected:
+  std::string data_;
+};
+
+TEST_F(TestS3FSParallelDownloads, ReadAt) {
+  std::shared_ptr<Buffer> buf;
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("bucket/largefile"));
+
+  // More parts than workers, parts not aligned on the read, a single part...
+  for (const auto& range : std::vector<std::pair<int64_t, int64_t>>{
+           {0, 1000}, {50, 100}, {150, 701}, {200, 100}, {0, 1}, {999, 10}, {900, 500}}) {
+    ARROW_SCOPED_TRACE("position = ", range.first, ", nbytes = ", range.second);
+    ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(range.first, range.second));
+    AssertBufferEqual(*buf, data_.substr(range.first, range.second));
+  }
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(1000, 10));
+  AssertBufferEqual(*buf, "");
+  ASSERT_RAISES(IOError, file->ReadAt(1001, 10));
+
+  std::string out(1000, 'x');
+  ASSERT_OK_AND_EQ(350, file->ReadAt(650, 1000, &out[0]));
+  ASSERT_EQ(out.substr(0, 350), data_.substr(650));
+  // Nothing is written past the end of the object
+  ASSERT_EQ(out.substr(350), std::string(650, 'x'));
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(buf,
+                                file->ReadAsync(io::default_io_context(), 123, 456));
+  AssertBufferEqual(*buf, data_.substr(123, 456));
+
+  // Sequential reads of a random access file are not read ahead
+  ASSERT_OK(file->Seek(990));
+  ASSERT_OK_AND_ASSIGN(buf, file->Read(20));
+  AssertBufferEqual(*buf, data_.substr(990));
+}
+
+TEST_F(TestS3FSParallelDownloads, ReadAhead) {
+  // Windows are 400 bytes long: reads end within, on and past window boundaries
+  for (int64_t chunk_size : {1, 37, 100, 399, 400, 1000, 2000}) {
+    ARROW_SCOPED_TRACE("chunk_size = ", chunk_size);
+    ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenInputStream("bucket/largefile"));
+    std::string contents;
+    while (true) {
+      ASSERT_OK_AND_ASSIGN(auto buf, stream->Read(chunk_size));
+      if (buf->size() == 0) {
+        break;
+      }
+      ASSERT_LE(buf->size(), chunk_size);
+      contents += buf->ToString();
+    }
+    ASSERT_EQ(contents, data_);
+    ASSERT_OK_AND_EQ(1000, stream->Tell());
+    ASSERT_OK(stream->Close());
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenInputStream("bucket/largefile"));
+  std::string out(500, 'x');
+  ASSERT_OK_AND_EQ(500, stream->Read(500, &out[0]));
+  ASSERT_EQ(out, data_.substr(0, 500));
+  ASSERT_OK_AND_EQ(500, stream->Read(1000, &out[0]));
+  ASSERT_EQ(out, data_.substr(500));
+  ASSERT_OK_AND_EQ(0, stream->Read(1000, &out[0]));
+  ASSERT_OK(stream->Close());
+  ASSERT_RAISES(Invalid, stream->Read(1));
+}
+
+TEST_F(TestS3FSParallelDownloads, Stopped) {
+  StopSource stop_source;
+  ASSERT_OK_AND_ASSIGN(fs_,
+                       S3FileSystem::Make(options_, io::IOContext(stop_source.token())));
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("bucket/largefile"));
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenInputStream("bucket/largefile"));
+  ASSERT_OK_AND_ASSIGN(auto buf, stream->Read(10));
+  AssertBufferEqual(*buf, data_.substr(0, 10));
+
+  stop_source.RequestStop();
+  ASSERT_RAISES(Cancelled, file->ReadAt(0, 1000));
+  // The rest of the current window was downloaded already
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(390));
+  AssertBufferEqual(*buf, data_.substr(10, 390));
+  ASSERT_RAISES(Cancelled, stream->Read(1000));
+}
+
+TEST_F(TestS3FS, ReadStopped) {
+  StopSource stop_source;
+  ASSERT_OK_AND_ASSIGN(fs_,
+                       S3FileSystem::Make(options_, io::IOContext(stop_source.token())));
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("bucket/somefile"));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 4));
+  AssertBufferEqual(*buf, "some");
+
+  stop_source.RequestStop();
+  ASSERT_RAISES(Cancelled, file->ReadAt(0, 4));
+  char out[4];
+  ASSERT_RAISES(Cancelled, file->ReadAt(0, 4, out));
+  ASSERT_RAISES(Cancelled, file->Read(4));
+  // ReadAsync observes the stop token of the context it is given instead
+  ASSERT_FINISHES_OK_AND_ASSIGN(buf, file->ReadAsync(io::default_io_context(), 5, 4));
+  AssertBufferEqual(*buf, "data");
+  ASSERT_FINISHES_AND_RAISES(Cancelled,
+                             file->ReadAsync(io::IOContext(stop_source.token()), 0, 4));
+}
+
+TEST_F(TestS3FS, ReadDeadline) {
+  using Clock = std::chrono::steady_clock;
+  StopSource stop_source;
+  ASSERT_OK_AND_ASSIGN(fs_,
+                       S3FileSystem::Make(options_, io::IOContext(stop_source.token())));
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("bucket/somefile"));
+
+  stop_source.RequestStopAt(Clock::now() + std::chrono::hours(1));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 4));
+  AssertBufferEqual(*buf, "some");
+
+  // The deadline is checked when a request starts, without a stop being requested
+  stop_source.RequestStopAt(Clock::now() - std::chrono::seconds(1));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Cancelled, testing::HasSubstr("Deadline exceeded"),
+                                  file->ReadAt(0, 4));
+}
+
 TEST_F(TestS3FS, OpenOutputStreamBackgroundWrites) { TestOpenOutputStream(); }
 
 TEST_F(TestS3FS, OpenOutputStreamSyncWrites) {
@@ -1056,6 +1194,21 @@ TEST_F(TestS3FS, OpenOutputStreamSyncWrites) {
   TestOpenOutputStream();
 }
 
+TEST_F(TestS3FS, OpenOutputStreamBoundedBackgroundWrites) {
+  options_.upload_part_size = 6 * 1024 * 1024;
+  options_.max_concurrent_uploads = 1;
+  MakeFileSystem();
+  TestOpenOutputStream();
+
+  // Once the memory limit is reached, parts are uploaded synchronously
+  options_.max_concurrent_uploads = 0;
+  MakeFileSystem();
+  SetS3UploadMemoryLimit(1);
+  TestOpenOutputStream();
+  SetS3UploadMemoryLimit(0);
+  ASSERT_EQ(GetS3UploadMemoryLimit(), 0);
+}
+
 TEST_F(TestS3FS, OpenOutputStreamAbortBackgroundWrites) { TestOpenOutputStreamAbort(); }
 
 TEST_F(TestS3FS, OpenOutputStreamAbortSyncWrites) {
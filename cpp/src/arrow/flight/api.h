@@ -20,8 +20,11 @@
 #include "arrow/flight/client.h"
 #include "arrow/flight/client_auth.h"
 #include "arrow/flight/client_middleware.h"
+#include "arrow/flight/client_pool.h"
+#include "arrow/flight/compression_middleware.h"
 #include "arrow/flight/middleware.h"
 #include "arrow/flight/server.h"
 #include "arrow/flight/server_auth.h"
 #include "arrow/flight/server_middleware.h"
+#include "arrow/flight/stream_stats_middleware.h"
 #include "arrow/flight/types.h"
@@ -21,17 +21,23 @@
 #include "arrow/flight/platform.h"
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/ipc/options.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/util/byte_size.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
 
@@ -154,11 +160,12 @@ class ClientStreamReader : public FlightStreamReader {
         options_(options),
         stop_token_(std::move(stop_token)),
         memory_manager_(std::move(memory_manager)),
-        peekable_reader_(new internal::PeekableFlightDataReader(stream_.get())),
+        peekable_reader_(new internal::PeekableFlightDataReader(stream_.get(), &stats_)),
         app_metadata_(nullptr) {}
 
   Status EnsureDataStarted() {
     if (!batch_reader_) {
+      internal::StreamStatsCodecTimer timer(&stats_);
       bool skipped_to_data = false;
       skipped_to_data = peekable_reader_->SkipToData();
       // peek() until we find the first data message; discard metadata
@@ -203,10 +210,18 @@ class ClientStreamReader : public FlightStreamReader {
       // Re-peek here since EnsureDataStarted() advances the stream
       return Next();
     }
-    auto status = batch_reader_->ReadNext(&out.data);
+    Status status;
+    {
+      internal::StreamStatsCodecTimer timer(&stats_);
+      status = batch_reader_->ReadNext(&out.data);
+    }
     if (ARROW_PREDICT_FALSE(!status.ok())) {
       return stream_->Finish(std::move(status));
     }
+    if (out.data) {
+      ++stats_.num_record_batches;
+      stats_.raw_body_bytes += util::TotalBufferSize(*out.data);
+    }
     out.app_metadata = std::move(app_metadata_);
     return out;
   }
@@ -234,6 +249,7 @@ class ClientStreamReader : public FlightStreamReader {
   }
   using FlightStreamReader::ToTable;
   void Cancel() override { stream_->TryCancel(); }
+  FlightStreamStats stream_stats() const override { return stats_; }
 
  private:
   Status OverrideWithServerError(Status&& st) {
@@ -247,6 +263,7 @@ class ClientStreamReader : public FlightStreamReader {
   ipc::IpcReadOptions options_;
   StopToken stop_token_;
   std::shared_ptr<MemoryManager> memory_manager_;
+  FlightStreamStats stats_;
   std::shared_ptr<internal::PeekableFlightDataReader> peekable_reader_;
   std::shared_ptr<ipc::RecordBatchReader> batch_reader_;
   std::shared_ptr<Buffer> app_metadata_;
@@ -298,11 +315,12 @@ class ClientPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
  public:
   ClientPutPayloadWriter(std::shared_ptr<internal::ClientDataStream> stream,
                          FlightDescriptor descriptor, int64_t write_size_limit_bytes,
-                         std::shared_ptr<Buffer>* app_metadata)
+                         std::shared_ptr<Buffer>* app_metadata, FlightStreamStats* stats)
       : descriptor_(std::move(descriptor)),
         write_size_limit_bytes_(write_size_limit_bytes),
         stream_(std::move(stream)),
         app_metadata_(app_metadata),
+        stats_(stats),
         first_payload_(true) {}
 
   Status Start() override { return Status::OK(); }
@@ -333,12 +351,14 @@ class ClientPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
         size += payload.app_metadata->size();
       }
       if (size > write_size_limit_bytes_) {
+        ++stats_->num_oversized_writes;
         return arrow::Status(
             arrow::StatusCode::Invalid, "IPC payload size exceeded soft limit",
             std::make_shared<FlightWriteSizeStatusDetail>(write_size_limit_bytes_, size));
       }
     }
-    ARROW_ASSIGN_OR_RAISE(auto success, stream_->WriteData(payload));
+    ARROW_ASSIGN_OR_RAISE(auto success,
+                          internal::WriteDataWithStats(stream_.get(), payload, stats_));
     if (!success) {
       return Status::FromDetailAndArgs(
           StatusCode::IOError, std::make_shared<ServerErrorTagStatusDetail>(),
@@ -356,6 +376,7 @@ class ClientPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
   const int64_t write_size_limit_bytes_;
   std::shared_ptr<internal::ClientDataStream> stream_;
   std::shared_ptr<Buffer>* app_metadata_;
+  FlightStreamStats* stats_;
   bool first_payload_;
 };
 
@@ -387,7 +408,7 @@ class ClientStreamWriter : public FlightStreamWriter {
     }
     std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(
         new ClientPutPayloadWriter(stream_, std::move(descriptor_),
-                                   write_size_limit_bytes_, &app_metadata_));
+                                   write_size_limit_bytes_, &app_metadata_, &stats_));
     // XXX: this does not actually write the message to the stream.
     // See Close().
 
@@ -411,7 +432,8 @@ class ClientStreamWriter : public FlightStreamWriter {
   Status Begin() {
     FlightPayload payload;
     RETURN_NOT_OK(internal::ToPayload(descriptor_, &payload.descriptor));
-    ARROW_ASSIGN_OR_RAISE(auto success, stream_->WriteData(payload));
+    ARROW_ASSIGN_OR_RAISE(auto success,
+                          internal::WriteDataWithStats(stream_.get(), payload, &stats_));
     if (!success) {
       return Close();
     }
@@ -426,7 +448,8 @@ class ClientStreamWriter : public FlightStreamWriter {
   Status WriteMetadata(std::shared_ptr<Buffer> app_metadata) override {
     FlightPayload payload;
     payload.app_metadata = app_metadata;
-    ARROW_ASSIGN_OR_RAISE(auto success, stream_->WriteData(payload));
+    ARROW_ASSIGN_OR_RAISE(auto success,
+                          internal::WriteDataWithStats(stream_.get(), payload, &stats_));
     if (!success) {
       return Close();
     }
@@ -437,7 +460,11 @@ class ClientStreamWriter : public FlightStreamWriter {
                            std::shared_ptr<Buffer> app_metadata) override {
     RETURN_NOT_OK(CheckStarted());
     app_metadata_ = app_metadata;
-    auto status = batch_writer_->WriteRecordBatch(batch);
+    Status status;
+    {
+      internal::StreamStatsCodecTimer timer(&stats_);
+      status = batch_writer_->WriteRecordBatch(batch);
+    }
     if (!status.ok() &&
         // Only want to Close() if server error, not for client error
         ServerErrorTagStatusDetail::UnwrapStatus(status)) {
@@ -485,6 +512,8 @@ class ClientStreamWriter : public FlightStreamWriter {
     return batch_writer_->stats();
   }
 
+  FlightStreamStats stream_stats() const override { return stats_; }
+
  private:
   Status CheckStarted() {
     if (!batch_writer_) {
@@ -496,6 +525,7 @@ class ClientStreamWriter : public FlightStreamWriter {
   std::shared_ptr<internal::ClientDataStream> stream_;
   std::unique_ptr<ipc::RecordBatchWriter> batch_writer_;
   std::shared_ptr<Buffer> app_metadata_;
+  FlightStreamStats stats_;
   bool writer_closed_;
   bool closed_;
   // Close() is expected to be idempotent
@@ -718,5 +748,134 @@ Status FlightClient::CheckOpen() const {
   return Status::OK();
 }
 
+FlightEndpointsReadOptions FlightEndpointsReadOptions::Defaults() {
+  return FlightEndpointsReadOptions();
+}
+
+namespace {
+
+// The connections used to read the endpoints of a FlightInfo, one per location
+class EndpointConnections {
+ public:
+  EndpointConnections(FlightClient* client, FlightClientOptions options)
+      : client_(client), options_(std::move(options)) {}
+
+  arrow::Result<FlightClient*> GetClient(const FlightEndpoint& endpoint) {
+    if (endpoint.locations.empty()) {
+      return client_;
+    }
+    const auto& location = endpoint.locations[0];
+    // Connect while holding the lock, so that endpoints at the same location
+    // never open several connections
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = clients_.find(location.ToString());
+    if (it == clients_.end()) {
+      ARROW_ASSIGN_OR_RAISE(auto client, FlightClient::Connect(location, options_));
+      it = clients_.emplace(location.ToString(), std::move(client)).first;
+    }
+    return it->second.get();
+  }
+
+ private:
+  FlightClient* client_;
+  const FlightClientOptions options_;
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::unique_ptr<FlightClient>> clients_;
+};
+
+// Read the batches of an endpoint, calling DoGet on the first call to Next()
+class EndpointBatchIterator {
+ public:
+  EndpointBatchIterator(std::shared_ptr<EndpointConnections> connections,
+                        FlightEndpoint endpoint, FlightCallOptions call_options)
+      : connections_(std::move(connections)),
+        endpoint_(std::move(endpoint)),
+        call_options_(std::move(call_options)) {}
+
+  arrow::Result<std::shared_ptr<RecordBatch>> Next() {
+    if (stream_ == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(auto client, connections_->GetClient(endpoint_));
+      ARROW_ASSIGN_OR_RAISE(stream_, client->DoGet(call_options_, endpoint_.ticket));
+    }
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto chunk, stream_->Next());
+      // Skip messages only carrying application metadata
+      if (chunk.data != nullptr || chunk.app_metadata == nullptr) {
+        return std::move(chunk.data);
+      }
+    }
+  }
+
+ private:
+  std::shared_ptr<EndpointConnections> connections_;
+  FlightEndpoint endpoint_;
+  FlightCallOptions call_options_;
+  std::unique_ptr<FlightStreamReader> stream_;
+};
+
+class GeneratorRecordBatchReader : public RecordBatchReader {
+ public:
+  GeneratorRecordBatchReader(std::shared_ptr<Schema> schema,
+                             AsyncGenerator<std::shared_ptr<RecordBatch>> generator)
+      : schema_(std::move(schema)), generator_(std::move(generator)) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    ARROW_ASSIGN_OR_RAISE(*batch, generator_().result());
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  AsyncGenerator<std::shared_ptr<RecordBatch>> generator_;
+};
+
+}  // namespace
+
+arrow::Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> MakeEndpointsGenerator(
+    FlightClient* client, const FlightInfo& info,
+    const FlightEndpointsReadOptions& options) {
+  if (options.max_concurrency < 1) {
+    return Status::Invalid("max_concurrency must be positive");
+  }
+  auto connections =
+      std::make_shared<EndpointConnections>(client, options.client_options);
+  auto io_executor = io::default_io_context().executor();
+
+  std::vector<AsyncGenerator<std::shared_ptr<RecordBatch>>> endpoint_gens;
+  for (const auto& endpoint : info.endpoints()) {
+    if (endpoint.locations.empty() && client == nullptr) {
+      return Status::Invalid("Endpoint with ticket '", endpoint.ticket.ticket,
+                             "' has no location and no client was given");
+    }
+    Iterator<std::shared_ptr<RecordBatch>> batch_it(
+        EndpointBatchIterator(connections, endpoint, options.call_options));
+    ARROW_ASSIGN_OR_RAISE(auto batch_gen,
+                          MakeBackgroundGenerator(std::move(batch_it), io_executor));
+    // Keep the consumer off the thread which reads the endpoint
+    endpoint_gens.push_back(MakeTransferredGenerator(std::move(batch_gen), io_executor));
+  }
+
+  auto gens = MakeVectorGenerator(std::move(endpoint_gens));
+  if (!options.ordered) {
+    return MakeMergedGenerator(std::move(gens), options.max_concurrency);
+  }
+  if (options.max_concurrency == 1) {
+    return MakeConcatenatedGenerator(std::move(gens));
+  }
+  return MakeSequencedMergedGenerator(std::move(gens), options.max_concurrency);
+}
+
+arrow::Result<std::shared_ptr<RecordBatchReader>> MakeEndpointsReader(
+    FlightClient* client, const FlightInfo& info,
+    const FlightEndpointsReadOptions& options) {
+  ipc::DictionaryMemo dictionary_memo;
+  ARROW_ASSIGN_OR_RAISE(auto schema, info.GetSchema(&dictionary_memo));
+  ARROW_ASSIGN_OR_RAISE(auto generator, MakeEndpointsGenerator(client, info, options));
+  return std::make_shared<GeneratorRecordBatchReader>(std::move(schema),
+                                                      std::move(generator));
+}
+
 }  // namespace flight
 }  // namespace arrow
@@ -31,6 +31,7 @@
 #include "arrow/ipc/writer.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/cancel.h"
 #include "arrow/util/variant.h"
 
@@ -41,6 +42,7 @@
 namespace arrow {
 
 class RecordBatch;
+class RecordBatchReader;
 class Schema;
 
 namespace flight {
@@ -430,5 +432,55 @@ class ARROW_FLIGHT_EXPORT FlightClient {
   int64_t write_size_limit_bytes_;
 };
 
+/// \brief Options for reading the endpoints of a FlightInfo together.
+struct ARROW_FLIGHT_EXPORT FlightEndpointsReadOptions {
+  /// \brief The maximum number of endpoints read at once.
+  ///
+  /// Each endpoint being read occupies a thread of the I/O thread pool.
+  int max_concurrency = 4;
+
+  /// \brief Whether batches are yielded in endpoint order.
+  ///
+  /// If false, batches are yielded as soon as they are received from any
+  /// endpoint.  Batches from a given endpoint are always yielded in order.
+  bool ordered = true;
+
+  /// \brief Options used to connect to the endpoint locations.
+  FlightClientOptions client_options = FlightClientOptions::Defaults();
+
+  /// \brief Options used for the DoGet call of each endpoint.
+  FlightCallOptions call_options;
+
+  /// \brief Get default options.
+  static FlightEndpointsReadOptions Defaults();
+};
+
+/// \brief Read the data of all the endpoints of a FlightInfo concurrently.
+///
+/// Each endpoint is read from its first location, or with \a client if it
+/// has no location.  A single connection is opened to each distinct location,
+/// and shared by all the endpoints located there.  Batches are received and
+/// decoded on the I/O thread pool.
+///
+/// \param[in] client the client used for endpoints without a location; it may
+///     be null if all endpoints have a location, otherwise it must outlive the
+///     returned generator
+/// \param[in] info the FlightInfo whose endpoints are read
+/// \param[in] options read options
+/// \return Arrow result with a generator of the batches of all endpoints
+ARROW_FLIGHT_EXPORT
+arrow::Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> MakeEndpointsGenerator(
+    FlightClient* client, const FlightInfo& info,
+    const FlightEndpointsReadOptions& options = FlightEndpointsReadOptions::Defaults());
+
+/// \brief Read the data of all the endpoints of a FlightInfo concurrently.
+///
+/// Like MakeEndpointsGenerator, but return a reader with the FlightInfo's
+/// schema.
+ARROW_FLIGHT_EXPORT
+arrow::Result<std::shared_ptr<RecordBatchReader>> MakeEndpointsReader(
+    FlightClient* client, const FlightInfo& info,
+    const FlightEndpointsReadOptions& options = FlightEndpointsReadOptions::Defaults());
+
 }  // namespace flight
 }  // namespace arrow
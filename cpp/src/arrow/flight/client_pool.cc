@@ -0,0 +1,206 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/client_pool.h"
+
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/make_unique.h"
+
+namespace arrow {
+namespace flight {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Identify the clients which may be shared: same location and same options
+std::string PoolKey(const Location& location, const FlightClientOptions& options) {
+  std::stringstream ss;
+  ss << location.ToString() << '\0' << options.tls_root_certs << '\0'
+     << options.override_hostname << '\0' << options.cert_chain << '\0'
+     << options.private_key << '\0' << options.write_size_limit_bytes << '\0'
+     << options.disable_server_verification << '\0';
+  for (const auto& middleware : options.middleware) {
+    ss << middleware.get() << ',';
+  }
+  ss << '\0';
+  for (const auto& arg : options.generic_options) {
+    ss << arg.first << '=';
+    if (util::holds_alternative<int>(arg.second)) {
+      ss << 'i' << util::get<int>(arg.second);
+    } else {
+      ss << 's' << util::get<std::string>(arg.second);
+    }
+    ss << ',';
+  }
+  return ss.str();
+}
+
+struct PooledClient {
+  std::shared_ptr<FlightClient> client;
+  Clock::time_point last_used;
+  Clock::time_point last_checked;
+
+  // Only the pool holds a reference
+  bool unused() const { return client.use_count() == 1; }
+};
+
+struct PooledLocation {
+  std::vector<PooledClient> clients;
+  size_t next_client = 0;
+};
+
+}  // namespace
+
+FlightClientPoolOptions FlightClientPoolOptions::Defaults() {
+  return FlightClientPoolOptions();
+}
+
+class FlightClientPool::Impl {
+ public:
+  explicit Impl(FlightClientPoolOptions options) : options_(std::move(options)) {}
+
+  arrow::Result<std::shared_ptr<FlightClient>> GetClient(
+      const Location& location, const FlightClientOptions& client_options) {
+    if (options_.clients_per_location < 1) {
+      return Status::Invalid("clients_per_location must be positive");
+    }
+    const auto key = PoolKey(location, client_options);
+    const auto now = Clock::now();
+    std::shared_ptr<FlightClient> client;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ReapIdleClientsUnlocked(now);
+      auto& pooled_location = locations_[key];
+      auto& clients = pooled_location.clients;
+      if (static_cast<int>(clients.size()) < options_.clients_per_location) {
+        // Creating a client does not connect, so this doesn't block
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<FlightClient> new_client,
+                              FlightClient::Connect(location, client_options));
+        clients.push_back({std::move(new_client), now, now});
+        return clients.back().client;
+      }
+      auto& pooled = clients[pooled_location.next_client++ % clients.size()];
+      pooled.last_used = now;
+      if (!options_.health_check || now - pooled.last_checked <
+                                        std::chrono::duration_cast<Clock::duration>(
+                                            options_.health_check_interval)) {
+        return pooled.client;
+      }
+      pooled.last_checked = now;
+      client = pooled.client;
+    }
+
+    // Run the health check without blocking other users of the pool
+    if (options_.health_check(client.get()).ok()) {
+      return client;
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<FlightClient> new_client,
+                          FlightClient::Connect(location, client_options));
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = locations_.find(key);
+    if (it != locations_.end()) {
+      for (auto& pooled : it->second.clients) {
+        if (pooled.client == client) {
+          pooled.client = new_client;
+          break;
+        }
+      }
+    }
+    return new_client;
+  }
+
+  int64_t ReapIdleClients() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ReapIdleClientsUnlocked(Clock::now());
+  }
+
+  int64_t num_clients() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    int64_t num_clients = 0;
+    for (const auto& pair : locations_) {
+      num_clients += static_cast<int64_t>(pair.second.clients.size());
+    }
+    return num_clients;
+  }
+
+  Status Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Status st;
+    for (auto& pair : locations_) {
+      for (auto& pooled : pair.second.clients) {
+        if (pooled.unused()) {
+          st &= pooled.client->Close();
+        }
+      }
+    }
+    locations_.clear();
+    return st;
+  }
+
+ private:
+  int64_t ReapIdleClientsUnlocked(Clock::time_point now) {
+    const auto idle_timeout =
+        std::chrono::duration_cast<Clock::duration>(options_.idle_timeout);
+    int64_t num_reaped = 0;
+    for (auto it = locations_.begin(); it != locations_.end();) {
+      auto& clients = it->second.clients;
+      for (auto client_it = clients.begin(); client_it != clients.end();) {
+        if (client_it->unused() && now - client_it->last_used >= idle_timeout) {
+          // Closing is a no-op for gRPC, so it doesn't block
+          ARROW_UNUSED(client_it->client->Close());
+          client_it = clients.erase(client_it);
+          ++num_reaped;
+        } else {
+          ++client_it;
+        }
+      }
+      it = clients.empty() ? locations_.erase(it) : std::next(it);
+    }
+    return num_reaped;
+  }
+
+  const FlightClientPoolOptions options_;
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, PooledLocation> locations_;
+};
+
+FlightClientPool::FlightClientPool(FlightClientPoolOptions options)
+    : impl_(::arrow::internal::make_unique<Impl>(std::move(options))) {}
+
+FlightClientPool::~FlightClientPool() = default;
+
+arrow::Result<std::shared_ptr<FlightClient>> FlightClientPool::GetClient(
+    const Location& location, const FlightClientOptions& options) {
+  return impl_->GetClient(location, options);
+}
+
+int64_t FlightClientPool::ReapIdleClients() { return impl_->ReapIdleClients(); }
+
+int64_t FlightClientPool::num_clients() const { return impl_->num_clients(); }
+
+Status FlightClientPool::Close() { return impl_->Close(); }
+
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// A pool of Flight clients sharing connections. API should be considered
+// experimental for now.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "arrow/flight/client.h"
+#include "arrow/flight/types.h"
+#include "arrow/flight/visibility.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace flight {
+
+/// \brief Options for a FlightClientPool.
+struct ARROW_FLIGHT_EXPORT FlightClientPoolOptions {
+  /// \brief The number of clients, each with its own channel, over which the
+  ///     users of a location are spread.
+  ///
+  /// Clients are handed out in a round-robin fashion, and every client
+  /// multiplexes the calls of all its users over its channel.
+  int clients_per_location = 1;
+
+  /// \brief How long a client nobody uses is kept in the pool.
+  TimeoutDuration idle_timeout = TimeoutDuration(300);
+
+  /// \brief An optional check of the health of a client, e.g. a cheap RPC.
+  ///
+  /// It is run before handing out a client which was last checked more than
+  /// health_check_interval ago.  Clients failing it are replaced by new ones.
+  std::function<Status(FlightClient*)> health_check;
+
+  /// \brief The minimum delay between two health checks of a client.
+  TimeoutDuration health_check_interval = TimeoutDuration(30);
+
+  /// \brief Get default options.
+  static FlightClientPoolOptions Defaults();
+};
+
+/// \brief A thread-safe pool of FlightClients, shared by location and options.
+///
+/// Creating a FlightClient sets up a new channel, whose connection (and TLS
+/// session) is established on first use.  Clients obtained from the pool for
+/// the same location and connection options (credentials, TLS settings,
+/// middleware and generic options) share a fixed set of clients instead, so
+/// that connections are reused by short-lived users.  Pooled clients are
+/// closed once unused for longer than the idle timeout.
+///
+/// Since pooled clients are shared, they must not be closed by their users,
+/// and per-user authentication should be passed as call headers (see
+/// FlightCallOptions::headers) rather than with FlightClient::Authenticate.
+/// The returned clients can also back a FlightSqlClient.
+class ARROW_FLIGHT_EXPORT FlightClientPool {
+ public:
+  explicit FlightClientPool(
+      FlightClientPoolOptions options = FlightClientPoolOptions::Defaults());
+  ~FlightClientPool();
+
+  /// \brief Get a client connected to the given location.
+  ///
+  /// \param[in] location the URI
+  /// \param[in] options options for setting up the client if none is pooled
+  /// \return Arrow result with a shared client
+  arrow::Result<std::shared_ptr<FlightClient>> GetClient(
+      const Location& location,
+      const FlightClientOptions& options = FlightClientOptions::Defaults());
+
+  /// \brief Close the pooled clients unused for longer than the idle timeout.
+  ///
+  /// This is also done on each call to GetClient.
+  /// \return the number of clients closed
+  int64_t ReapIdleClients();
+
+  /// \brief The number of clients currently in the pool.
+  int64_t num_clients() const;
+
+  /// \brief Close all the pooled clients.
+  ///
+  /// Clients still in use remain usable until released by their users, but
+  /// are not handed out anymore.
+  Status Close();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace flight
+}  // namespace arrow
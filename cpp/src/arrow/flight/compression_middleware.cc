@@ -0,0 +1,178 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/compression_middleware.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/string.h"
+
+namespace arrow {
+namespace flight {
+
+namespace {
+
+// The codecs which can be used for IPC bodies and are built into this library
+std::vector<Compression::type> AvailableCodecs(
+    const std::vector<Compression::type>& codecs) {
+  std::vector<Compression::type> available;
+  for (const auto codec : codecs) {
+    if ((codec == Compression::ZSTD || codec == Compression::LZ4_FRAME) &&
+        util::Codec::IsAvailable(codec) &&
+        std::find(available.begin(), available.end(), codec) == available.end()) {
+      available.push_back(codec);
+    }
+  }
+  return available;
+}
+
+class ClientCompressionMiddlewareFactory : public ClientMiddlewareFactory {
+ public:
+  explicit ClientCompressionMiddlewareFactory(
+      const std::vector<Compression::type>& codecs) {
+    std::vector<std::string> names;
+    for (const auto codec : AvailableCodecs(codecs)) {
+      names.push_back(util::Codec::GetCodecAsString(codec));
+    }
+    accepted_ = ::arrow::internal::JoinStrings(names, ",");
+  }
+
+  void StartCall(const CallInfo& info,
+                 std::unique_ptr<ClientMiddleware>* middleware) override {
+    ARROW_UNUSED(info);
+    if (!accepted_.empty()) {
+      *middleware =
+          std::unique_ptr<ClientMiddleware>(new ClientCompressionMiddleware(accepted_));
+    }
+  }
+
+ private:
+  class ClientCompressionMiddleware : public ClientMiddleware {
+   public:
+    explicit ClientCompressionMiddleware(const std::string& accepted)
+        : accepted_(accepted) {}
+
+    void SendingHeaders(AddCallHeaders* outgoing_headers) override {
+      outgoing_headers->AddHeader(kAcceptCompressionHeader, accepted_);
+    }
+
+    void ReceivedHeaders(const CallHeaders& incoming_headers) override {}
+
+    void CallCompleted(const Status& status) override {}
+
+   private:
+    const std::string& accepted_;
+  };
+
+  std::string accepted_;
+};
+
+class ServerCompressionMiddlewareFactory : public ServerMiddlewareFactory {
+ public:
+  explicit ServerCompressionMiddlewareFactory(ServerCompressionOptions options)
+      : codecs_(AvailableCodecs(options.codecs)),
+        min_space_savings_(options.min_space_savings) {}
+
+  Status StartCall(const CallInfo& info, const CallHeaders& incoming_headers,
+                   std::shared_ptr<ServerMiddleware>* middleware) override {
+    ARROW_UNUSED(info);
+    auto compression = Compression::UNCOMPRESSED;
+    const auto range = incoming_headers.equal_range(kAcceptCompressionHeader);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (Negotiate(it->second, &compression)) break;
+    }
+    *middleware =
+        std::make_shared<ServerCompressionMiddleware>(compression, min_space_savings_);
+    return Status::OK();
+  }
+
+ private:
+  // Pick the client's first preference the server supports
+  bool Negotiate(util::string_view accepted, Compression::type* out) const {
+    for (const auto name : ::arrow::internal::SplitString(accepted, ',')) {
+      auto maybe_codec = util::Codec::GetCompressionType(
+          ::arrow::internal::TrimString(std::string(name)));
+      if (!maybe_codec.ok()) continue;
+      const auto codec = *maybe_codec;
+      if (std::find(codecs_.begin(), codecs_.end(), codec) != codecs_.end()) {
+        *out = codec;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const std::vector<Compression::type> codecs_;
+  const util::optional<double> min_space_savings_;
+};
+
+}  // namespace
+
+constexpr char const ServerCompressionMiddleware::kMiddlewareName[];
+
+ServerCompressionOptions ServerCompressionOptions::Defaults() {
+  return ServerCompressionOptions();
+}
+
+ServerCompressionMiddleware::ServerCompressionMiddleware(
+    Compression::type compression, util::optional<double> min_space_savings)
+    : compression_(compression), min_space_savings_(min_space_savings) {}
+
+void ServerCompressionMiddleware::SendingHeaders(AddCallHeaders* outgoing_headers) {
+  if (compression_ != Compression::UNCOMPRESSED) {
+    outgoing_headers->AddHeader(kCompressionHeader,
+                                util::Codec::GetCodecAsString(compression_));
+  }
+}
+
+arrow::Result<ipc::IpcWriteOptions> ServerCompressionMiddleware::GetWriteOptions(
+    ipc::IpcWriteOptions options) const {
+  if (compression_ == Compression::UNCOMPRESSED) {
+    return options;
+  }
+  ARROW_ASSIGN_OR_RAISE(options.codec, util::Codec::Create(compression_));
+  options.min_space_savings = min_space_savings_;
+  return options;
+}
+
+std::shared_ptr<ClientMiddlewareFactory> GetCompressionFactory(
+    std::vector<Compression::type> codecs) {
+  return std::make_shared<ClientCompressionMiddlewareFactory>(codecs);
+}
+
+std::shared_ptr<ServerMiddlewareFactory> GetServerCompressionFactory(
+    ServerCompressionOptions options) {
+  return std::make_shared<ServerCompressionMiddlewareFactory>(std::move(options));
+}
+
+arrow::Result<ipc::IpcWriteOptions> GetNegotiatedWriteOptions(
+    const ServerCallContext& context, ipc::IpcWriteOptions options,
+    const std::string& key) {
+  auto middleware = context.GetMiddleware(key);
+  if (middleware == nullptr || middleware->name() !=
+                                   ServerCompressionMiddleware::kMiddlewareName) {
+    return options;
+  }
+  return ::arrow::internal::checked_cast<const ServerCompressionMiddleware*>(middleware)
+      ->GetWriteOptions(std::move(options));
+}
+
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Middleware negotiating the compression of the IPC bodies sent by a
+// server. API should be considered experimental for now.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/flight/client_middleware.h"
+#include "arrow/flight/server.h"
+#include "arrow/flight/server_middleware.h"
+#include "arrow/flight/visibility.h"
+#include "arrow/ipc/options.h"
+#include "arrow/result.h"
+#include "arrow/util/optional.h"
+#include "arrow/util/type_fwd.h"
+
+namespace arrow {
+namespace flight {
+
+/// \brief Header listing the codecs a client can decode, by preference.
+constexpr char kAcceptCompressionHeader[] = "arrow-flight-accept-compression";
+/// \brief Header with the codec chosen by the server.
+constexpr char kCompressionHeader[] = "arrow-flight-compression";
+/// \brief The default key of the server compression middleware.
+constexpr char kCompressionMiddlewareKey[] = "arrow-flight-compression";
+
+/// \brief Returns a ClientMiddlewareFactory advertising the given codecs.
+///
+/// Codecs not built into this library are not advertised.  Decoding the
+/// compressed streams needs no other client-side setup.
+ARROW_FLIGHT_EXPORT std::shared_ptr<ClientMiddlewareFactory> GetCompressionFactory(
+    std::vector<Compression::type> codecs = {Compression::ZSTD, Compression::LZ4_FRAME});
+
+/// \brief Options for negotiating the compression of server streams.
+struct ARROW_FLIGHT_EXPORT ServerCompressionOptions {
+  /// \brief The codecs the server may use.
+  ///
+  /// The first codec of the client's list of preferences which also appears
+  /// here is chosen.  Codecs not built into this library are ignored.
+  std::vector<Compression::type> codecs = {Compression::ZSTD, Compression::LZ4_FRAME};
+
+  /// \brief The minimum space savings for a buffer to be sent compressed.
+  ///
+  /// See ipc::IpcWriteOptions::min_space_savings: buffers which don't
+  /// compress well, and would only cost CPU time on both ends, are sent
+  /// as is.
+  util::optional<double> min_space_savings = 0.1;
+
+  /// \brief Get default options.
+  static ServerCompressionOptions Defaults();
+};
+
+/// \brief The server side of the compression negotiation of a call.
+class ARROW_FLIGHT_EXPORT ServerCompressionMiddleware : public ServerMiddleware {
+ public:
+  static constexpr char const kMiddlewareName[] = "arrow::flight::ServerCompression";
+
+  ServerCompressionMiddleware(Compression::type compression,
+                              util::optional<double> min_space_savings);
+
+  std::string name() const override { return kMiddlewareName; }
+  void SendingHeaders(AddCallHeaders* outgoing_headers) override;
+  void CallCompleted(const Status& status) override {}
+
+  /// \brief The negotiated codec, Compression::UNCOMPRESSED if none.
+  Compression::type compression() const { return compression_; }
+
+  /// \brief Set up write options to use the negotiated codec.
+  arrow::Result<ipc::IpcWriteOptions> GetWriteOptions(
+      ipc::IpcWriteOptions options = ipc::IpcWriteOptions::Defaults()) const;
+
+ private:
+  Compression::type compression_;
+  util::optional<double> min_space_savings_;
+};
+
+/// \brief Returns a ServerMiddlewareFactory negotiating the compression of
+///     the IPC bodies sent to the clients.
+///
+/// The codec is chosen by the header sent by GetCompressionFactory(); calls
+/// from other clients are left uncompressed.  Servers apply it by creating
+/// their RecordBatchStream with the result of GetNegotiatedWriteOptions().
+ARROW_FLIGHT_EXPORT std::shared_ptr<ServerMiddlewareFactory>
+GetServerCompressionFactory(
+    ServerCompressionOptions options = ServerCompressionOptions::Defaults());
+
+/// \brief Get write options for the codec negotiated for a call.
+///
+/// \param[in] context the context of the call
+/// \param[in] options the options to start from
+/// \param[in] key the key of the compression middleware factory
+/// \return the options unchanged if no codec was negotiated
+ARROW_FLIGHT_EXPORT arrow::Result<ipc::IpcWriteOptions> GetNegotiatedWriteOptions(
+    const ServerCallContext& context,
+    ipc::IpcWriteOptions options = ipc::IpcWriteOptions::Defaults(),
+    const std::string& key = kCompressionMiddlewareKey);
+
+}  // namespace flight
+}  // namespace arrow
@@ -16,6 +16,9 @@
 // under the License.
 
 #include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <iostream>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -46,6 +49,9 @@
 #ifdef ARROW_WITH_UCX
 #include "arrow/flight/transport/ucx/ucx.h"
 #endif
+#ifdef ARROW_FLIGHT_SHM
+#include "arrow/flight/transport/shm/shm.h"
+#endif
 
 DEFINE_bool(cuda, false, "Allocate results in CUDA memory");
 DEFINE_string(transport, "grpc",
@@ -53,6 +59,9 @@ DEFINE_string(transport, "grpc",
 #ifdef ARROW_WITH_UCX
               ", \"ucx\""
 #endif  // ARROW_WITH_UCX
+#ifdef ARROW_FLIGHT_SHM
+              ", \"shm\" (requires a Unix socket path)"
+#endif  // ARROW_FLIGHT_SHM
               ".");
 DEFINE_string(server_host, "",
               "An existing performance server to benchmark against (leave blank to spawn "
@@ -71,16 +80,24 @@ DEFINE_int32(num_threads, 4, "Number of concurrent gets");
 DEFINE_int64(records_per_stream, 10000000, "Total records per stream");
 DEFINE_int32(records_per_batch, 4096, "Total records per batch within stream");
 DEFINE_bool(test_put, false, "Test DoPut instead of DoGet");
+DEFINE_bool(test_exchange, false,
+            "Test DoExchange round trips (each batch is echoed back by the server) "
+            "instead of DoGet");
 DEFINE_string(compression, "",
               "Select compression method (\"zstd\", \"lz4\"). "
               "Leave blank to disable compression.\n"
               "E.g., \"zstd\":   zstd with default compression level.\n"
-              "      \"zstd:7\": zstd with compression leve = 7.\n");
+              "      \"zstd:7\": zstd with compression leve = 7.\n"
+              "The server negotiates the method of the data it sends and always uses "
+              "the default level.\n");
 DEFINE_string(
     data_file, "",
     "Instead of random data, use data from the given IPC file. Only affects -test_put.");
 DEFINE_string(cert_file, "", "Path to TLS certificate");
 DEFINE_string(key_file, "", "Path to TLS private key (used when spawning a server)");
+DEFINE_string(output_json, "",
+              "Also write the configuration and results as a JSON object to the given "
+              "file (\"-\" for stdout)");
 
 namespace perf = arrow::flight::perf;
 
@@ -91,6 +108,19 @@ using internal::ThreadPool;
 
 namespace flight {
 
+enum class TestMethod { DoGet, DoPut, DoExchange };
+
+const char* TestMethodName(TestMethod method) {
+  switch (method) {
+    case TestMethod::DoPut:
+      return "DoPut";
+    case TestMethod::DoExchange:
+      return "DoExchange";
+    default:
+      return "DoGet";
+  }
+}
+
 struct PerformanceResult {
   int64_t num_batches;
   int64_t num_records;
@@ -276,8 +306,58 @@ arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
   return PerformanceResult{static_cast<int64_t>(batches.size()), num_records, num_bytes};
 }
 
+// Send the batches one at a time, waiting for each to be echoed back, so the
+// latencies are round trip times
+arrow::Result<PerformanceResult> RunDoExchangeTest(FlightClient* client,
+                                                   const FlightCallOptions& call_options,
+                                                   const perf::Token& token,
+                                                   const FlightEndpoint& endpoint,
+                                                   PerformanceStats* stats) {
+  ARROW_ASSIGN_OR_RAISE(const auto batches, GetPutData(token));
+  ARROW_ASSIGN_OR_RAISE(auto exchange,
+                        client->DoExchange(call_options, FlightDescriptor{}));
+  RETURN_NOT_OK(exchange.writer->Begin(batches[0].batch->schema()));
+  StopWatch timer;
+  int64_t num_records = 0;
+  int64_t num_bytes = 0;
+  for (const auto& batch : batches) {
+    timer.Start();
+    RETURN_NOT_OK(exchange.writer->WriteRecordBatch(*batch.batch));
+    ARROW_ASSIGN_OR_RAISE(auto chunk, exchange.reader->Next());
+    stats->AddLatency(timer.Stop());
+    if (!chunk.data || chunk.data->num_rows() != batch.batch->num_rows()) {
+      return Status::Invalid("Batch was not echoed back");
+    }
+    num_records += batch.batch->num_rows();
+    num_bytes += batch.bytes;
+  }
+  RETURN_NOT_OK(exchange.writer->DoneWriting());
+  ARROW_ASSIGN_OR_RAISE(auto chunk, exchange.reader->Next());
+  if (chunk.data) {
+    return Status::Invalid("Unexpected batch echoed back");
+  }
+  RETURN_NOT_OK(exchange.writer->Close());
+  return PerformanceResult{static_cast<int64_t>(batches.size()), num_records, num_bytes};
+}
+
+// The CPU time used by the server process so far, in seconds
+arrow::Result<double> GetServerCpuTime(FlightClient* client,
+                                       const FlightCallOptions& call_options) {
+  Action action{"cpu_time", nullptr};
+  ARROW_ASSIGN_OR_RAISE(auto stream, client->DoAction(call_options, action));
+  ARROW_ASSIGN_OR_RAISE(auto result, stream->Next());
+  if (result == nullptr) {
+    return Status::Invalid("No CPU time returned by the server");
+  }
+  return std::stod(result->body->ToString());
+}
+
+double GetClientCpuTime() {
+  return static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+}
+
 Status DoSinglePerfRun(FlightClient* client, const FlightClientOptions client_options,
-                       const FlightCallOptions& call_options, bool test_put,
+                       const FlightCallOptions& call_options, TestMethod method,
                        PerformanceStats* stats) {
   // schema not needed
   perf::Perf perf;
@@ -298,7 +378,12 @@ Status DoSinglePerfRun(FlightClient* client, const FlightClientOptions client_op
 
   int64_t start_total_records = stats->total_records;
 
-  auto test_loop = test_put ? &RunDoPutTest : &RunDoGetTest;
+  auto test_loop = &RunDoGetTest;
+  if (method == TestMethod::DoPut) {
+    test_loop = &RunDoPutTest;
+  } else if (method == TestMethod::DoExchange) {
+    test_loop = &RunDoExchangeTest;
+  }
   auto ConsumeStream = [&client, &stats, &test_loop, &client_options,
                         &call_options](const FlightEndpoint& endpoint) {
     std::unique_ptr<FlightClient> local_client;
@@ -351,30 +436,85 @@ Status DoSinglePerfRun(FlightClient* client, const FlightClientOptions client_op
   return Status::OK();
 }
 
+// Write the configuration and results of the run as a flat JSON object
+Status WriteJsonResults(std::ostream* out, TestMethod method, const std::string& location,
+                        const PerformanceStats& stats, uint64_t elapsed_nanos,
+                        double client_cpu_time, double server_cpu_time) {
+  const double time_elapsed =
+      static_cast<double>(elapsed_nanos) / static_cast<double>(1000000000);
+  const double gigabytes = static_cast<double>(stats.total_bytes) / (1 << 30);
+  auto& os = *out;
+  os << "{\"method\": \"" << TestMethodName(method) << "\"";
+  os << ", \"transport\": \"" << FLAGS_transport << "\"";
+  os << ", \"location\": \"" << location << "\"";
+  os << ", \"tls\": " << (FLAGS_cert_file.empty() ? "false" : "true");
+  os << ", \"compression\": \"" << FLAGS_compression << "\"";
+  os << ", \"num_perf_runs\": " << FLAGS_num_perf_runs;
+  os << ", \"num_streams\": " << FLAGS_num_streams;
+  os << ", \"num_threads\": " << FLAGS_num_threads;
+  os << ", \"records_per_stream\": " << FLAGS_records_per_stream;
+  os << ", \"records_per_batch\": " << FLAGS_records_per_batch;
+  os << ", \"total_batches\": " << stats.total_batches;
+  os << ", \"total_records\": " << stats.total_records;
+  os << ", \"total_bytes\": " << stats.total_bytes;
+  os << ", \"nanos\": " << elapsed_nanos;
+  os << ", \"megabytes_per_second\": "
+     << static_cast<double>(stats.total_bytes) / (1 << 20) / time_elapsed;
+  os << ", \"batches_per_second\": "
+     << static_cast<double>(stats.total_batches) / time_elapsed;
+  os << ", \"latency_mean_us\": " << stats.mean_latency();
+  for (auto q : stats.quantiles) {
+    os << ", \"latency_p" << static_cast<int>(q * 100) << "_us\": "
+       << stats.quantile_latency(q);
+  }
+  os << ", \"latency_max_us\": " << stats.max_latency();
+  os << ", \"client_cpu_seconds_per_gb\": " << client_cpu_time / gigabytes;
+  if (server_cpu_time >= 0) {
+    os << ", \"server_cpu_seconds_per_gb\": " << server_cpu_time / gigabytes;
+  } else {
+    os << ", \"server_cpu_seconds_per_gb\": null";
+  }
+  os << "}" << std::endl;
+  return os.good() ? Status::OK() : Status::IOError("Failed writing JSON results");
+}
+
 Status RunPerformanceTest(FlightClient* client, const FlightClientOptions& client_options,
-                          const FlightCallOptions& call_options, bool test_put) {
+                          const FlightCallOptions& call_options, TestMethod method,
+                          const std::string& location) {
+  // The server may predate the CPU time action
+  auto maybe_server_cpu_start = GetServerCpuTime(client, call_options);
+  const double client_cpu_start = GetClientCpuTime();
   StopWatch timer;
   timer.Start();
 
   PerformanceStats stats;
   for (int i = 0; i < FLAGS_num_perf_runs; ++i) {
-    RETURN_NOT_OK(
-        DoSinglePerfRun(client, client_options, call_options, test_put, &stats));
+    RETURN_NOT_OK(DoSinglePerfRun(client, client_options, call_options, method, &stats));
   }
 
   // Elapsed time in seconds
   uint64_t elapsed_nanos = timer.Stop();
   double time_elapsed =
       static_cast<double>(elapsed_nanos) / static_cast<double>(1000000000);
+  const double client_cpu_time = GetClientCpuTime() - client_cpu_start;
+  double server_cpu_time = -1;
+  if (maybe_server_cpu_start.ok()) {
+    ARROW_ASSIGN_OR_RAISE(auto server_cpu_end, GetServerCpuTime(client, call_options));
+    server_cpu_time = server_cpu_end - *maybe_server_cpu_start;
+  }
 
   constexpr double kMegabyte = static_cast<double>(1 << 20);
+  constexpr double kGigabyte = static_cast<double>(1 << 30);
 
   std::cout << "Number of perf runs: " << FLAGS_num_perf_runs << std::endl;
   std::cout << "Number of concurrent gets/puts: " << FLAGS_num_threads << std::endl;
   std::cout << "Batch size: " << stats.total_bytes / stats.total_batches << std::endl;
-  if (FLAGS_test_put) {
+  if (method == TestMethod::DoPut) {
     std::cout << "Batches written: " << stats.total_batches << std::endl;
     std::cout << "Bytes written: " << stats.total_bytes << std::endl;
+  } else if (method == TestMethod::DoExchange) {
+    std::cout << "Batches exchanged: " << stats.total_batches << std::endl;
+    std::cout << "Bytes exchanged: " << stats.total_bytes << std::endl;
   } else {
     std::cout << "Batches read: " << stats.total_batches << std::endl;
     std::cout << "Bytes read: " << stats.total_bytes << std::endl;
@@ -395,6 +535,21 @@ Status RunPerformanceTest(FlightClient* client, const FlightClientOptions& clien
   }
   std::cout << "Latency max: " << stats.max_latency() << " us" << std::endl;
 
+  // CPU cost, which includes the data generation on both sides
+  const double gigabytes = static_cast<double>(stats.total_bytes) / kGigabyte;
+  std::cout << "Client CPU: " << client_cpu_time / gigabytes << " s/GB" << std::endl;
+  if (server_cpu_time >= 0) {
+    std::cout << "Server CPU: " << server_cpu_time / gigabytes << " s/GB" << std::endl;
+  }
+
+  if (FLAGS_output_json == "-") {
+    RETURN_NOT_OK(WriteJsonResults(&std::cout, method, location, stats, elapsed_nanos,
+                                   client_cpu_time, server_cpu_time));
+  } else if (!FLAGS_output_json.empty()) {
+    std::ofstream out(FLAGS_output_json);
+    RETURN_NOT_OK(WriteJsonResults(&out, method, location, stats, elapsed_nanos,
+                                   client_cpu_time, server_cpu_time));
+  }
   return Status::OK();
 }
 
@@ -404,22 +559,21 @@ Status RunPerformanceTest(FlightClient* client, const FlightClientOptions& clien
 int main(int argc, char** argv) {
   gflags::ParseCommandLineFlags(&argc, &argv, true);
 
-  std::cout << "Testing method: ";
+  if (FLAGS_test_put && FLAGS_test_exchange) {
+    std::cerr << "Only one of -test_put and -test_exchange can be given" << std::endl;
+    return 1;
+  }
+  auto method = arrow::flight::TestMethod::DoGet;
   if (FLAGS_test_put) {
-    std::cout << "DoPut";
-  } else {
-    std::cout << "DoGet";
+    method = arrow::flight::TestMethod::DoPut;
+  } else if (FLAGS_test_exchange) {
+    method = arrow::flight::TestMethod::DoExchange;
   }
-  std::cout << std::endl;
+  std::cout << "Testing method: " << arrow::flight::TestMethodName(method) << std::endl;
 
   arrow::flight::FlightCallOptions call_options;
+  auto options = arrow::flight::FlightClientOptions::Defaults();
   if (!FLAGS_compression.empty()) {
-    if (!FLAGS_test_put) {
-      std::cerr << "Compression is only useful for Put test now, "
-                   "please append \"-test_put\" to command line"
-                << std::endl;
-      std::abort();
-    }
 
     // "zstd"   -> name = "zstd", level = default
     // "zstd:7" -> name = "zstd", level = 7
@@ -439,10 +593,14 @@ int main(int argc, char** argv) {
     }
     std::cout << std::endl;
 
+    // Compress the data we send, and ask the server to compress what it sends
     call_options.write_options.codec = std::move(codec);
+    options.middleware.push_back(arrow::flight::GetCompressionFactory({type}));
   }
-  if (!FLAGS_data_file.empty() && !FLAGS_test_put) {
-    std::cerr << "A data file can only be specified with \"-test_put\"" << std::endl;
+  if (!FLAGS_data_file.empty() && method == arrow::flight::TestMethod::DoGet) {
+    std::cerr << "A data file can only be specified with \"-test_put\" or "
+                 "\"-test_exchange\""
+              << std::endl;
     return 1;
   }
 
@@ -451,7 +609,6 @@ int main(int argc, char** argv) {
   server_args.push_back("-transport");
   server_args.push_back(FLAGS_transport);
   arrow::flight::Location location;
-  auto options = arrow::flight::FlightClientOptions::Defaults();
   if (FLAGS_transport == "grpc") {
     if (FLAGS_test_unix || !FLAGS_server_unix.empty()) {
       if (FLAGS_server_unix == "") {
@@ -519,6 +676,25 @@ int main(int argc, char** argv) {
 #else
     std::cerr << "Not built with transport: " << FLAGS_transport << std::endl;
     return EXIT_FAILURE;
+#endif
+  } else if (FLAGS_transport == "shm") {
+#ifdef ARROW_FLIGHT_SHM
+    arrow::flight::transport::shm::InitializeFlightShm();
+    if (FLAGS_server_unix.empty()) {
+      FLAGS_server_unix = "/tmp/flight-bench-spawn-shm.sock";
+      std::cout << "Using spawned shared-memory server" << std::endl;
+      server.reset(
+          new arrow::flight::TestServer("arrow-flight-perf-server", FLAGS_server_unix));
+      server->Start(server_args);
+    } else {
+      std::cout << "Using standalone shared-memory server" << std::endl;
+    }
+    std::cout << "Server unix socket: " << FLAGS_server_unix << std::endl;
+    ARROW_CHECK_OK(
+        arrow::flight::Location::Parse("shm://" + FLAGS_server_unix).Value(&location));
+#else
+    std::cerr << "Not built with transport: " << FLAGS_transport << std::endl;
+    return EXIT_FAILURE;
 #endif
   } else {
     std::cerr << "Unknown transport: " << FLAGS_transport << std::endl;
@@ -556,8 +732,8 @@ int main(int argc, char** argv) {
   auto client = arrow::flight::FlightClient::Connect(location, options).ValueOrDie();
   ABORT_NOT_OK(arrow::flight::WaitForReady(client.get(), call_options));
 
-  arrow::Status s = arrow::flight::RunPerformanceTest(client.get(), options, call_options,
-                                                      FLAGS_test_put);
+  arrow::Status s = arrow::flight::RunPerformanceTest(
+      client.get(), options, call_options, method, location.ToString());
 
   if (server) {
     server->Stop();
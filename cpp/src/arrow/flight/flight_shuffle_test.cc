@@ -0,0 +1,195 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/test_util.h"
+#include "arrow/flight/api.h"
+#include "arrow/flight/shuffle.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace flight {
+
+using ::arrow::internal::checked_cast;
+using compute::Declaration;
+using compute::ExecBatch;
+using compute::ExecPlan;
+
+class TestFlightShuffle : public ::testing::Test {
+ public:
+  static constexpr int kNumPeers = 2;
+
+  void SetUp() override {
+    internal::InitializeShuffle();
+    for (int i = 0; i < kNumPeers; ++i) {
+      auto server = std::make_shared<ShuffleServer>();
+      ASSERT_OK_AND_ASSIGN(auto location, Location::ForGrpcTcp("localhost", 0));
+      FlightServerOptions options(location);
+      ASSERT_OK(server->Init(options));
+      ASSERT_OK_AND_ASSIGN(auto peer, Location::ForGrpcTcp("localhost", server->port()));
+      servers_.push_back(std::move(server));
+      peers_.push_back(std::move(peer));
+    }
+
+    schema_ = schema({field("k", int32()), field("v", utf8())});
+    input_ = compute::MakeBatchesFromString(
+        schema_, {R"([[1, "a"], [2, "b"], [3, "c"]])", R"([])",
+                  R"([[4, "d"], [1, "e"], [2, "f"], [5, "g"], [6, "h"]])"});
+  }
+
+  void TearDown() override {
+    for (auto& server : servers_) {
+      ASSERT_OK(server->Shutdown());
+    }
+  }
+
+  // Read one partition of the shuffle into a table
+  arrow::Result<std::shared_ptr<Table>> ReadPartition(int partition, int num_writers) {
+    ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make());
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    RETURN_NOT_OK(Declaration::Sequence(
+                      {
+                          {"flight_shuffle_source",
+                           ShuffleSourceNodeOptions{servers_[partition], "shuffle",
+                                                    partition, num_writers, schema_}},
+                          {"sink", compute::SinkNodeOptions{&sink_gen}},
+                      })
+                      .AddToPlan(plan.get()));
+    auto collected_fut = compute::StartAndCollect(plan.get(), sink_gen);
+    ARROW_ASSIGN_OR_RAISE(auto collected, collected_fut.result());
+    return compute::TableFromExecBatches(schema_, collected);
+  }
+
+  // Shuffle the input from a writer plan
+  Status WriteShuffle() {
+    ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make());
+    RETURN_NOT_OK(
+        Declaration::Sequence(
+            {
+                {"source", compute::SourceNodeOptions{input_.schema,
+                                                      input_.gen(/*parallel=*/true,
+                                                                 /*slow=*/false)}},
+                {"flight_shuffle_sink", ShuffleSinkNodeOptions{"shuffle", {"k"}, peers_}},
+            })
+            .AddToPlan(plan.get()));
+    RETURN_NOT_OK(plan->StartProducing());
+    auto finished = plan->finished();
+    return finished.status();
+  }
+
+ protected:
+  std::vector<std::shared_ptr<ShuffleServer>> servers_;
+  std::vector<Location> peers_;
+  std::shared_ptr<Schema> schema_;
+  compute::BatchesWithSchema input_;
+};
+
+constexpr int TestFlightShuffle::kNumPeers;
+
+TEST_F(TestFlightShuffle, PartitionsAcrossPeers) {
+  ASSERT_OK(WriteShuffle());
+
+  std::set<int32_t> seen_keys;
+  std::vector<std::shared_ptr<Table>> partitions;
+  for (int i = 0; i < kNumPeers; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto partition, ReadPartition(i, /*num_writers=*/1));
+    ASSERT_OK_AND_ASSIGN(auto combined, partition->CombineChunksToBatch());
+    const auto& keys = checked_cast<const Int32Array&>(*combined->column(0));
+    std::set<int32_t> partition_keys;
+    for (int64_t row = 0; row < keys.length(); ++row) {
+      partition_keys.insert(keys.Value(row));
+    }
+    // Equal keys are sent to the same peer
+    for (int32_t key : partition_keys) {
+      ASSERT_TRUE(seen_keys.insert(key).second) << key;
+    }
+    partitions.push_back(std::move(partition));
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto actual, ConcatenateTables(partitions));
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       compute::TableFromExecBatches(schema_, input_.batches));
+  ASSERT_OK_AND_ASSIGN(actual, compute::SortTableOnAllFields(actual));
+  ASSERT_OK_AND_ASSIGN(expected, compute::SortTableOnAllFields(expected));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST_F(TestFlightShuffle, ReadBeforeWrite) {
+  // Each peer waits for both writers
+  std::vector<Future<std::vector<ExecBatch>>> reads;
+  std::vector<std::shared_ptr<ExecPlan>> plans;
+  std::vector<AsyncGenerator<util::optional<ExecBatch>>> sink_gens(kNumPeers);
+  for (int i = 0; i < kNumPeers; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+    ASSERT_OK(Declaration::Sequence(
+                  {
+                      {"flight_shuffle_source",
+                       ShuffleSourceNodeOptions{servers_[i], "shuffle", i,
+                                                /*num_writers=*/2, schema_}},
+                      {"sink", compute::SinkNodeOptions{&sink_gens[i]}},
+                  })
+                  .AddToPlan(plan.get()));
+    reads.push_back(compute::StartAndCollect(plan.get(), sink_gens[i]));
+    plans.push_back(std::move(plan));
+  }
+  ASSERT_OK(WriteShuffle());
+  for (const auto& read : reads) {
+    ASSERT_FALSE(read.is_finished());
+  }
+  ASSERT_OK(WriteShuffle());
+
+  int64_t num_rows = 0;
+  for (const auto& read : reads) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, read);
+    for (const auto& batch : batches) {
+      num_rows += batch.length;
+    }
+  }
+  ASSERT_EQ(num_rows, 2 * 8);
+}
+
+TEST_F(TestFlightShuffle, Errors) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  compute::SourceNodeOptions source_options{input_.schema, input_.gen(false, false)};
+  ASSERT_OK_AND_ASSIGN(auto source,
+                       compute::MakeExecNode("source", plan.get(), {}, source_options));
+  ASSERT_RAISES(Invalid,
+                compute::MakeExecNode("flight_shuffle_sink", plan.get(), {source},
+                                      ShuffleSinkNodeOptions{"shuffle", {"k"}, {}}));
+  ASSERT_RAISES(Invalid,
+                compute::MakeExecNode("flight_shuffle_sink", plan.get(), {source},
+                                      ShuffleSinkNodeOptions{"shuffle", {}, peers_}));
+
+  ASSERT_OK(servers_[0]->ReadPartition("read_twice", 0, 1).status());
+  ASSERT_RAISES(Invalid, servers_[0]->ReadPartition("read_twice", 0, 1));
+  ASSERT_RAISES(Invalid, servers_[0]->ReadPartition("no_writers", 0, 0));
+}
+
+}  // namespace flight
+}  // namespace arrow
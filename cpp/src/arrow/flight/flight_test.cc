@@ -18,13 +18,16 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <thread>
@@ -33,10 +36,13 @@
 #include "arrow/flight/api.h"
 #include "arrow/ipc/test_common.h"
 #include "arrow/status.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/base64.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
 
@@ -1029,6 +1035,135 @@ TEST_F(TestFlightClient, Close) {
                                   client_->ListFlights());
 }
 
+FlightInfo MakeIntsFlightInfo(const std::vector<FlightEndpoint>& endpoints) {
+  FlightDescriptor descr{FlightDescriptor::PATH, "", {"examples", "ints"}};
+  FlightInfo::Data data;
+  ARROW_EXPECT_OK(MakeFlightInfo(*ExampleIntSchema(), descr, endpoints, -1, -1, &data));
+  return FlightInfo(data);
+}
+
+TEST_F(TestFlightClient, ReadEndpoints) {
+  ASSERT_OK_AND_ASSIGN(auto location, Location::ForGrpcTcp("localhost", server_->port()));
+  // Endpoints without a location are read with client_
+  auto info = MakeIntsFlightInfo({{{"ticket-ints-1"}, {location}},
+                                  {{"ticket-ints-1"}, {}},
+                                  {{"ticket-ints-1"}, {location}}});
+  RecordBatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+  const auto num_batches = expected_batches.size();
+
+  for (int max_concurrency : {1, 2, 8}) {
+    ARROW_SCOPED_TRACE("max_concurrency = ", max_concurrency);
+    auto options = FlightEndpointsReadOptions::Defaults();
+    options.max_concurrency = max_concurrency;
+
+    ASSERT_OK_AND_ASSIGN(auto reader, MakeEndpointsReader(client_.get(), info, options));
+    AssertSchemaEqual(*ExampleIntSchema(), *reader->schema());
+    ASSERT_OK_AND_ASSIGN(auto batches, reader->ToRecordBatches());
+    ASSERT_EQ(batches.size(), 3 * num_batches);
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected_batches[i % num_batches], *batches[i]);
+    }
+
+    // Unordered reads interleave the endpoints, but keep the order within each
+    options.ordered = false;
+    ASSERT_OK_AND_ASSIGN(auto gen, MakeEndpointsGenerator(client_.get(), info, options));
+    ASSERT_FINISHES_OK_AND_ASSIGN(batches, CollectAsyncGenerator(std::move(gen)));
+    ASSERT_EQ(batches.size(), 3 * num_batches);
+    for (const auto& batch : batches) {
+      ASSERT_TRUE(std::any_of(
+          expected_batches.begin(), expected_batches.end(),
+          [&](const std::shared_ptr<RecordBatch>& expected) {
+            return expected->Equals(*batch);
+          }));
+    }
+  }
+}
+
+TEST_F(TestFlightClient, ReadEndpointsErrors) {
+  ASSERT_OK_AND_ASSIGN(auto location, Location::ForGrpcTcp("localhost", server_->port()));
+
+  auto info = MakeIntsFlightInfo({{{"ticket-ints-1"}, {location}},
+                                  {{"ticket-unknown"}, {location}}});
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeEndpointsReader(client_.get(), info));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented,
+                                  ::testing::HasSubstr("no stream implemented"),
+                                  reader->ToRecordBatches());
+
+  info = MakeIntsFlightInfo({{{"ticket-ints-1"}, {}}});
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("no location"),
+                                  MakeEndpointsReader(nullptr, info));
+
+  auto options = FlightEndpointsReadOptions::Defaults();
+  options.max_concurrency = 0;
+  ASSERT_RAISES(Invalid, MakeEndpointsGenerator(client_.get(), info, options));
+}
+
+TEST_F(TestFlightClient, ClientPool) {
+  ASSERT_OK_AND_ASSIGN(auto location, Location::ForGrpcTcp("localhost", server_->port()));
+  auto pool_options = FlightClientPoolOptions::Defaults();
+  pool_options.clients_per_location = 2;
+  FlightClientPool pool(pool_options);
+
+  // Clients are handed out in turn
+  ASSERT_OK_AND_ASSIGN(auto client1, pool.GetClient(location));
+  ASSERT_OK_AND_ASSIGN(auto client2, pool.GetClient(location));
+  ASSERT_OK_AND_ASSIGN(auto client3, pool.GetClient(location));
+  ASSERT_NE(client1, client2);
+  ASSERT_EQ(client1, client3);
+  ASSERT_OK(client2->ListFlights());
+
+  // Clients with other options are pooled apart
+  auto client_options = FlightClientOptions::Defaults();
+  client_options.generic_options.emplace_back(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS, 50);
+  ASSERT_OK_AND_ASSIGN(auto client4, pool.GetClient(location, client_options));
+  ASSERT_NE(client1, client4);
+  ASSERT_NE(client2, client4);
+  ASSERT_EQ(pool.num_clients(), 3);
+
+  ASSERT_OK(pool.Close());
+  ASSERT_EQ(pool.num_clients(), 0);
+  // Clients in use are not closed
+  ASSERT_OK(client4->ListFlights());
+}
+
+TEST_F(TestFlightClient, ClientPoolReapIdleClients) {
+  ASSERT_OK_AND_ASSIGN(auto location, Location::ForGrpcTcp("localhost", server_->port()));
+  auto pool_options = FlightClientPoolOptions::Defaults();
+  pool_options.idle_timeout = TimeoutDuration(0);
+  FlightClientPool pool(pool_options);
+
+  ASSERT_OK_AND_ASSIGN(auto client, pool.GetClient(location));
+  ASSERT_EQ(pool.ReapIdleClients(), 0);
+  ASSERT_EQ(pool.num_clients(), 1);
+  client.reset();
+  ASSERT_EQ(pool.ReapIdleClients(), 1);
+  ASSERT_EQ(pool.num_clients(), 0);
+}
+
+TEST_F(TestFlightClient, ClientPoolHealthCheck) {
+  ASSERT_OK_AND_ASSIGN(auto location, Location::ForGrpcTcp("localhost", server_->port()));
+  int num_checks = 0;
+  auto pool_options = FlightClientPoolOptions::Defaults();
+  pool_options.health_check_interval = TimeoutDuration(0);
+  pool_options.health_check = [&](FlightClient* client) {
+    // Fail the first check
+    if (num_checks++ == 0) return Status::IOError("unhealthy");
+    return client->ListFlights().status();
+  };
+  FlightClientPool pool(pool_options);
+
+  ASSERT_OK_AND_ASSIGN(auto client1, pool.GetClient(location));
+  ASSERT_EQ(num_checks, 0);
+  ASSERT_OK_AND_ASSIGN(auto client2, pool.GetClient(location));
+  ASSERT_EQ(num_checks, 1);
+  ASSERT_NE(client1, client2);
+  ASSERT_OK_AND_ASSIGN(auto client3, pool.GetClient(location));
+  ASSERT_EQ(num_checks, 2);
+  ASSERT_EQ(client2, client3);
+  ASSERT_EQ(pool.num_clients(), 1);
+}
+
 TEST_F(TestAuthHandler, PassAuthenticatedCalls) {
   ASSERT_OK(client_->Authenticate(
       {},
@@ -1390,6 +1525,370 @@ TEST_F(TestBasicHeaderAuthMiddleware, ValidCredentials) { RunValidClientAuth();
 
 TEST_F(TestBasicHeaderAuthMiddleware, InvalidCredentials) { RunInvalidClientAuth(); }
 
+// Streams batches with the negotiated codec and echoes the metadata of uploads
+class CompressionTestServer : public FlightServerBase {
+  Status DoGet(const ServerCallContext& context, const Ticket& request,
+               std::unique_ptr<FlightDataStream>* data_stream) override {
+    RecordBatchVector batches;
+    RETURN_NOT_OK(ExampleIntBatches(&batches));
+    ARROW_ASSIGN_OR_RAISE(auto batch_reader, RecordBatchReader::Make(batches));
+    ARROW_ASSIGN_OR_RAISE(auto options, GetNegotiatedWriteOptions(context));
+    *data_stream = std::unique_ptr<FlightDataStream>(
+        new RecordBatchStream(batch_reader, options));
+    return Status::OK();
+  }
+
+  Status DoPut(const ServerCallContext& context,
+               std::unique_ptr<FlightMessageReader> reader,
+               std::unique_ptr<FlightMetadataWriter> writer) override {
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto chunk, reader->Next());
+      if (chunk.data == nullptr) break;
+      if (chunk.app_metadata != nullptr) {
+        RETURN_NOT_OK(writer->WriteMetadata(*chunk.app_metadata));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status DoAction(const ServerCallContext& context, const Action& action,
+                  std::unique_ptr<ResultStream>* result) override {
+    const ServerMiddleware* middleware = context.GetMiddleware(kCompressionMiddlewareKey);
+    if (middleware == nullptr) {
+      return Status::Invalid("No compression middleware");
+    }
+    const auto compression =
+        ((const ServerCompressionMiddleware*)middleware)->compression();
+    auto buf = Buffer::FromString(util::Codec::GetCodecAsString(compression));
+    *result = std::unique_ptr<ResultStream>(new SimpleResultStream({Result{buf}}));
+    return Status::OK();
+  }
+};
+
+class TestCompressionMiddleware : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(MakeServer<CompressionTestServer>(
+        &server_, &client_,
+        [](FlightServerOptions* options) {
+          options->middleware.push_back(
+              {kCompressionMiddlewareKey, GetServerCompressionFactory()});
+          return Status::OK();
+        },
+        [](FlightClientOptions* options) {
+          options->middleware.push_back(GetCompressionFactory());
+          return Status::OK();
+        }));
+  }
+
+  void TearDown() {
+    ASSERT_OK(client_->Close());
+    ASSERT_OK(server_->Shutdown());
+  }
+
+  arrow::Result<std::string> NegotiatedCodec(FlightClient* client) {
+    Action action{"codec", Buffer::FromString("")};
+    ARROW_ASSIGN_OR_RAISE(auto stream, client->DoAction(action));
+    ARROW_ASSIGN_OR_RAISE(auto result, stream->Next());
+    return result->body->ToString();
+  }
+
+  void CheckDoGet(FlightClient* client) {
+    RecordBatchVector expected_batches;
+    ASSERT_OK(ExampleIntBatches(&expected_batches));
+    ASSERT_OK_AND_ASSIGN(auto stream, client->DoGet(Ticket{""}));
+    ASSERT_OK_AND_ASSIGN(auto batches, stream->ToRecordBatches());
+    ASSERT_EQ(expected_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+    }
+  }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+};
+
+TEST_F(TestCompressionMiddleware, Negotiate) {
+  std::string expected = "uncompressed";
+  if (util::Codec::IsAvailable(Compression::ZSTD)) {
+    expected = "zstd";
+  } else if (util::Codec::IsAvailable(Compression::LZ4_FRAME)) {
+    expected = "lz4";
+  }
+  ASSERT_OK_AND_ASSIGN(auto codec, NegotiatedCodec(client_.get()));
+  ASSERT_EQ(expected, codec);
+  CheckDoGet(client_.get());
+
+  // Clients which don't advertise codecs get uncompressed streams
+  ASSERT_OK_AND_ASSIGN(auto plain_client, FlightClient::Connect(server_->location()));
+  ASSERT_OK_AND_ASSIGN(codec, NegotiatedCodec(plain_client.get()));
+  ASSERT_EQ("uncompressed", codec);
+  CheckDoGet(plain_client.get());
+  ASSERT_OK(plain_client->Close());
+}
+
+TEST_F(TestCompressionMiddleware, ClientPreference) {
+  if (!util::Codec::IsAvailable(Compression::LZ4_FRAME)) {
+    GTEST_SKIP() << "lz4 support not built";
+  }
+  auto client_options = FlightClientOptions::Defaults();
+  client_options.middleware.push_back(
+      GetCompressionFactory({Compression::LZ4_FRAME, Compression::ZSTD}));
+  ASSERT_OK_AND_ASSIGN(auto client,
+                       FlightClient::Connect(server_->location(), client_options));
+  ASSERT_OK_AND_ASSIGN(auto codec, NegotiatedCodec(client.get()));
+  ASSERT_EQ("lz4", codec);
+  CheckDoGet(client.get());
+  ASSERT_OK(client->Close());
+}
+
+TEST_F(TestCompressionMiddleware, LargeAppMetadata) {
+  // Large metadata is serialized without being copied into the message header
+  std::string metadata(1 << 16, 'x');
+  for (size_t i = 0; i < metadata.size(); i += 7) {
+    metadata[i] = static_cast<char>('a' + i % 26);
+  }
+  RecordBatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  ASSERT_OK_AND_ASSIGN(auto do_put_result,
+                       client_->DoPut(FlightDescriptor{}, batches[0]->schema()));
+  ASSERT_OK(do_put_result.writer->WriteWithMetadata(*batches[0],
+                                                    Buffer::FromString(metadata)));
+  std::shared_ptr<Buffer> echoed;
+  ASSERT_OK(do_put_result.reader->ReadMetadata(&echoed));
+  ASSERT_NE(nullptr, echoed);
+  ASSERT_EQ(metadata, echoed->ToString());
+  ASSERT_OK(do_put_result.writer->Close());
+}
+
+class TestStreamStats : public ::testing::Test {
+ public:
+  void SetUp() {
+    auto callback = [this](const CallStreamStats& stats) {
+      std::lock_guard<std::mutex> guard(mutex_);
+      calls_.push_back(stats);
+      cv_.notify_all();
+    };
+    ASSERT_OK(MakeServer<CompressionTestServer>(
+        &server_, &client_,
+        [callback](FlightServerOptions* options) {
+          options->middleware.push_back(
+              {kCompressionMiddlewareKey, GetServerCompressionFactory()});
+          options->middleware.push_back(
+              {kStreamStatsMiddlewareKey, GetServerStreamStatsFactory(callback)});
+          return Status::OK();
+        },
+        [](FlightClientOptions* options) {
+          options->middleware.push_back(GetCompressionFactory());
+          return Status::OK();
+        }));
+  }
+
+  void TearDown() {
+    ASSERT_OK(client_->Close());
+    ASSERT_OK(server_->Shutdown());
+  }
+
+  // The server reports the statistics once it is done with the streams,
+  // which may be after the client saw the end of the call
+  CallStreamStats WaitForCall() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    EXPECT_TRUE(cv_.wait_for(lock, std::chrono::seconds(10),
+                             [this] { return !calls_.empty(); }));
+    if (calls_.empty()) return CallStreamStats();
+    auto stats = calls_.front();
+    calls_.erase(calls_.begin());
+    return stats;
+  }
+
+  void CheckSameStream(const FlightStreamStats& sent, const FlightStreamStats& received) {
+    ASSERT_EQ(sent.num_messages, received.num_messages);
+    ASSERT_EQ(sent.num_record_batches, received.num_record_batches);
+    ASSERT_EQ(sent.serialized_body_bytes, received.serialized_body_bytes);
+    ASSERT_GT(sent.wire_bytes, sent.serialized_body_bytes);
+    ASSERT_GT(received.wire_bytes, received.serialized_body_bytes);
+    ASSERT_GT(sent.raw_body_bytes, 0);
+    ASSERT_GT(received.raw_body_bytes, 0);
+  }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<CallStreamStats> calls_;
+};
+
+TEST_F(TestStreamStats, DoGet) {
+  RecordBatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+  ASSERT_OK_AND_ASSIGN(auto stream, client_->DoGet(Ticket{""}));
+  ASSERT_OK_AND_ASSIGN(auto batches, stream->ToRecordBatches());
+  ASSERT_EQ(expected_batches.size(), batches.size());
+
+  const auto received = stream->stream_stats();
+  ASSERT_EQ(static_cast<int64_t>(batches.size()), received.num_record_batches);
+  // The schema comes first
+  ASSERT_EQ(received.num_record_batches + 1, received.num_messages);
+  ASSERT_GT(received.compression_ratio(), 0);
+  ASSERT_THAT(received.ToString(), ::testing::HasSubstr("record_batches="));
+
+  const auto call = WaitForCall();
+  ASSERT_EQ(FlightMethod::DoGet, call.info.method);
+  ASSERT_OK(call.status);
+  ASSERT_EQ(0, call.read.num_messages);
+  CheckSameStream(call.written, received);
+}
+
+TEST_F(TestStreamStats, DoPut) {
+  RecordBatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  ASSERT_OK_AND_ASSIGN(auto do_put_result,
+                       client_->DoPut(FlightDescriptor{}, batches[0]->schema()));
+  for (const auto& batch : batches) {
+    ASSERT_OK(do_put_result.writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(do_put_result.writer->WriteMetadata(Buffer::FromString("done")));
+  ASSERT_OK(do_put_result.writer->DoneWriting());
+  const auto sent = do_put_result.writer->stream_stats();
+  ASSERT_OK(do_put_result.writer->Close());
+  ASSERT_EQ(static_cast<int64_t>(batches.size()), sent.num_record_batches);
+  // The schema, the batches and the metadata-only message
+  ASSERT_EQ(sent.num_record_batches + 2, sent.num_messages);
+
+  const auto call = WaitForCall();
+  ASSERT_EQ(FlightMethod::DoPut, call.info.method);
+  ASSERT_OK(call.status);
+  ASSERT_EQ(0, call.written.num_messages);
+  CheckSameStream(sent, call.read);
+}
+
+// Streams batches produced asynchronously, by ticket
+class GeneratorTestServer : public FlightServerBase {
+  Status DoGet(const ServerCallContext& context, const Ticket& request,
+               std::unique_ptr<FlightDataStream>* data_stream) override {
+    RecordBatchVector batches;
+    if (request.ticket == "dicts") {
+      RETURN_NOT_OK(ExampleDictBatches(&batches));
+    } else {
+      RETURN_NOT_OK(ExampleIntBatches(&batches));
+    }
+    auto schema = batches[0]->schema();
+    auto generator = MakeVectorGenerator(std::move(batches));
+    if (request.ticket == "error") {
+      // Fail after a few batches
+      auto num_batches = std::make_shared<int>(0);
+      generator = [generator, num_batches]() -> Future<std::shared_ptr<RecordBatch>> {
+        if ((*num_batches)++ == 2) {
+          return Status::IOError("Producer failed");
+        }
+        return generator();
+      };
+    }
+    // A budget of a single byte is exhausted by every payload
+    const int64_t max_buffered_bytes = request.ticket == "unbuffered" ? 1 : 1 << 20;
+    *data_stream = arrow::internal::make_unique<RecordBatchGeneratorStream>(
+        schema, std::move(generator), ipc::IpcWriteOptions::Defaults(),
+        max_buffered_bytes);
+    return Status::OK();
+  }
+};
+
+class TestGeneratorStream : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(MakeServer<GeneratorTestServer>(
+        &server_, &client_, [](FlightServerOptions* options) { return Status::OK(); },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+  }
+
+  void TearDown() {
+    ASSERT_OK(client_->Close());
+    ASSERT_OK(server_->Shutdown());
+  }
+
+  void CheckDoGet(const std::string& ticket, const RecordBatchVector& expected_batches) {
+    ASSERT_OK_AND_ASSIGN(auto stream, client_->DoGet(Ticket{ticket}));
+    ASSERT_OK_AND_ASSIGN(auto batches, stream->ToRecordBatches());
+    ASSERT_EQ(expected_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+    }
+  }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+};
+
+TEST_F(TestGeneratorStream, DoGet) {
+  RecordBatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+  CheckDoGet("ints", expected_batches);
+  CheckDoGet("unbuffered", expected_batches);
+}
+
+TEST_F(TestGeneratorStream, Dictionaries) {
+  RecordBatchVector expected_batches;
+  ASSERT_OK(ExampleDictBatches(&expected_batches));
+  CheckDoGet("dicts", expected_batches);
+}
+
+TEST_F(TestGeneratorStream, ProducerError) {
+  ASSERT_OK_AND_ASSIGN(auto stream, client_->DoGet(Ticket{"error"}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(IOError, ::testing::HasSubstr("Producer failed"),
+                                  stream->ToRecordBatches());
+}
+
+TEST(RecordBatchGeneratorStream, ByteBudget) {
+  RecordBatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  const auto num_batches = batches.size();
+  auto schema = batches[0]->schema();
+  auto vector_generator = MakeVectorGenerator(std::move(batches));
+  auto num_pulled = std::make_shared<std::atomic<int>>(0);
+  auto generator = [vector_generator, num_pulled]() {
+    ++*num_pulled;
+    return vector_generator();
+  };
+
+  RecordBatchGeneratorStream stream(schema, generator, ipc::IpcWriteOptions::Defaults(),
+                                    /*max_buffered_bytes=*/1);
+  ASSERT_OK(stream.GetSchemaPayload());
+  // Production stops after a single payload
+  BusyWait(10, [&] { return num_pulled->load() == 1; });
+  SleepABit();
+  ASSERT_EQ(1, num_pulled->load());
+
+  // Consuming it resumes production
+  ASSERT_OK_AND_ASSIGN(auto payload, stream.Next());
+  ASSERT_NE(nullptr, payload.ipc_message.metadata);
+  BusyWait(10, [&] { return num_pulled->load() == 2; });
+  SleepABit();
+  ASSERT_EQ(2, num_pulled->load());
+
+  for (size_t i = 1; i < num_batches; ++i) {
+    ASSERT_OK_AND_ASSIGN(payload, stream.Next());
+    ASSERT_NE(nullptr, payload.ipc_message.metadata);
+  }
+  ASSERT_OK_AND_ASSIGN(payload, stream.Next());
+  ASSERT_EQ(nullptr, payload.ipc_message.metadata);
+  ASSERT_OK(stream.Close());
+}
+
+TEST(RecordBatchGeneratorStream, CloseEarly) {
+  RecordBatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  auto schema = batches[0]->schema();
+  RecordBatchGeneratorStream stream(schema, MakeVectorGenerator(std::move(batches)));
+  ASSERT_OK(stream.GetSchemaPayload());
+  ASSERT_OK(stream.Close());
+  // The stream ends once closed
+  ASSERT_OK_AND_ASSIGN(auto payload, stream.Next());
+  ASSERT_EQ(nullptr, payload.ipc_message.metadata);
+}
+
 class ForeverFlightListing : public FlightListing {
   arrow::Result<std::unique_ptr<FlightInfo>> Next() override {
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
@@ -20,6 +20,7 @@
 #include <signal.h>
 #include <cstdint>
 #include <cstdlib>
+#include <ctime>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -47,6 +48,9 @@
 #ifdef ARROW_WITH_UCX
 #include "arrow/flight/transport/ucx/ucx.h"
 #endif
+#ifdef ARROW_FLIGHT_SHM
+#include "arrow/flight/transport/shm/shm.h"
+#endif
 
 DEFINE_bool(cuda, false, "Allocate results in CUDA memory");
 DEFINE_string(transport, "grpc",
@@ -54,6 +58,9 @@ DEFINE_string(transport, "grpc",
 #ifdef ARROW_WITH_UCX
               ", \"ucx\""
 #endif  // ARROW_WITH_UCX
+#ifdef ARROW_FLIGHT_SHM
+              ", \"shm\" (requires a Unix socket path)"
+#endif  // ARROW_FLIGHT_SHM
               ".");
 DEFINE_string(server_host, "localhost", "Host where the server is running on");
 DEFINE_int32(port, 31337, "Server port to listen on");
@@ -79,7 +86,8 @@ namespace flight {
 class PerfDataStream : public FlightDataStream {
  public:
   PerfDataStream(bool verify, const int64_t start, const int64_t total_records,
-                 const std::shared_ptr<Schema>& schema, const ArrayVector& arrays)
+                 const std::shared_ptr<Schema>& schema, const ArrayVector& arrays,
+                 const ipc::IpcWriteOptions& ipc_options)
       : start_(start),
         verify_(verify),
         batch_length_(arrays[0]->length()),
@@ -87,6 +95,7 @@ class PerfDataStream : public FlightDataStream {
         records_sent_(0),
         schema_(schema),
         mapper_(*schema),
+        ipc_options_(ipc_options),
         arrays_(arrays) {
     batch_ = RecordBatch::Make(schema, batch_length_, arrays_);
   }
@@ -144,7 +153,8 @@ class PerfDataStream : public FlightDataStream {
 };
 
 Status GetPerfBatches(const perf::Token& token, const std::shared_ptr<Schema>& schema,
-                      bool use_verifier, std::unique_ptr<FlightDataStream>* data_stream) {
+                      bool use_verifier, const ipc::IpcWriteOptions& ipc_options,
+                      std::unique_ptr<FlightDataStream>* data_stream) {
   std::shared_ptr<ResizableBuffer> buffer;
   std::vector<std::shared_ptr<Array>> arrays;
 
@@ -159,7 +169,8 @@ Status GetPerfBatches(const perf::Token& token, const std::shared_ptr<Schema>& s
 
   *data_stream = std::unique_ptr<FlightDataStream>(
       new PerfDataStream(use_verifier, token.start(),
-                         token.definition().records_per_stream(), schema, arrays));
+                         token.definition().records_per_stream(), schema, arrays,
+                         ipc_options));
   return Status::OK();
 }
 
@@ -206,8 +217,11 @@ class FlightPerfServer : public FlightServerBase {
                std::unique_ptr<FlightDataStream>* data_stream) override {
     perf::Token token;
     CHECK_PARSE(token.ParseFromString(request.ticket));
+    // Use the compression negotiated with the client, if any
+    ARROW_ASSIGN_OR_RAISE(auto ipc_options, GetNegotiatedWriteOptions(context));
     // This must also be set in flight_benchmark.cc
-    return GetPerfBatches(token, perf_schema_, /*verify=*/false, data_stream);
+    return GetPerfBatches(token, perf_schema_, /*verify=*/false, ipc_options,
+                          data_stream);
   }
 
   Status DoPut(const ServerCallContext& context,
@@ -224,6 +238,25 @@ class FlightPerfServer : public FlightServerBase {
     return Status::OK();
   }
 
+  // Echo every batch back as soon as it is received
+  Status DoExchange(const ServerCallContext& context,
+                    std::unique_ptr<FlightMessageReader> reader,
+                    std::unique_ptr<FlightMessageWriter> writer) override {
+    ARROW_ASSIGN_OR_RAISE(auto ipc_options, GetNegotiatedWriteOptions(context));
+    bool started = false;
+    FlightStreamChunk chunk;
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(chunk, reader->Next());
+      if (!chunk.data) break;
+      if (!started) {
+        RETURN_NOT_OK(writer->Begin(chunk.data->schema(), ipc_options));
+        started = true;
+      }
+      RETURN_NOT_OK(writer->WriteRecordBatch(*chunk.data));
+    }
+    return Status::OK();
+  }
+
   Status DoAction(const ServerCallContext& context, const Action& action,
                   std::unique_ptr<ResultStream>* result) override {
     if (action.type == "ping") {
@@ -231,6 +264,14 @@ class FlightPerfServer : public FlightServerBase {
       *result = std::unique_ptr<ResultStream>(new SimpleResultStream({Result{buf}}));
       return Status::OK();
     }
+    if (action.type == "cpu_time") {
+      // The CPU time used by this process so far, in seconds
+      const double cpu_time =
+          static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+      std::shared_ptr<Buffer> buf = Buffer::FromString(std::to_string(cpu_time));
+      *result = std::unique_ptr<ResultStream>(new SimpleResultStream({Result{buf}}));
+      return Status::OK();
+    }
     return Status::NotImplemented(action.type);
   }
 
@@ -304,6 +345,25 @@ int main(int argc, char** argv) {
 #else
     std::cerr << "Not built with transport: " << FLAGS_transport << std::endl;
     return EXIT_FAILURE;
+#endif
+  } else if (FLAGS_transport == "shm") {
+#ifdef ARROW_FLIGHT_SHM
+    arrow::flight::transport::shm::InitializeFlightShm();
+    if (FLAGS_server_unix.empty()) {
+      std::cerr << "Transport requires a Unix socket path: " << FLAGS_transport
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (!FLAGS_cert_file.empty() || !FLAGS_key_file.empty()) {
+      std::cerr << "Transport does not support TLS: " << FLAGS_transport << std::endl;
+      return EXIT_FAILURE;
+    }
+    ARROW_CHECK_OK(arrow::flight::Location::Parse("shm://" + FLAGS_server_unix)
+                       .Value(&bind_location));
+    connect_location = bind_location;
+#else
+    std::cerr << "Not built with transport: " << FLAGS_transport << std::endl;
+    return EXIT_FAILURE;
 #endif
   } else {
     std::cerr << "Unknown transport: " << FLAGS_transport << std::endl;
@@ -321,6 +381,10 @@ int main(int argc, char** argv) {
     options.tls_certificates.push_back(arrow::flight::CertKeyPair{cert, key});
   }
 
+  // Compress the data sent to clients asking for it
+  options.middleware.push_back({arrow::flight::kCompressionMiddlewareKey,
+                                arrow::flight::GetServerCompressionFactory()});
+
   if (FLAGS_cuda) {
 #ifdef ARROW_CUDA
     arrow::cuda::CudaDeviceManager* manager = nullptr;
@@ -17,6 +17,7 @@
 
 #include "arrow/flight/serialization_internal.h"
 
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -256,6 +257,31 @@ Status ToPayload(const FlightDescriptor& descr, std::shared_ptr<Buffer>* out) {
   return Status::OK();
 }
 
+int64_t StatsClockNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+arrow::Result<bool> WriteDataWithStats(TransportDataStream* stream,
+                                       const FlightPayload& payload,
+                                       FlightStreamStats* stats) {
+  const int64_t start = StatsClockNanos();
+  auto result = stream->WriteData(payload);
+  stats->transport_nanos += StatsClockNanos() - start;
+  if (result.ok() && *result) {
+    ++stats->num_messages;
+    const auto& ipc_message = payload.ipc_message;
+    if (ipc_message.metadata) stats->wire_bytes += ipc_message.metadata->size();
+    if (payload.app_metadata) stats->wire_bytes += payload.app_metadata->size();
+    stats->wire_bytes += ipc_message.body_length;
+    stats->serialized_body_bytes += ipc_message.body_length;
+    stats->raw_body_bytes += ipc_message.raw_body_length;
+    if (ipc_message.type == ipc::MessageType::RECORD_BATCH) ++stats->num_record_batches;
+  }
+  return result;
+}
+
 }  // namespace internal
 }  // namespace flight
 }  // namespace arrow
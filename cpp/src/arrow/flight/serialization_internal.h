@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include "arrow/buffer.h"
 #include "arrow/flight/protocol_internal.h"  // IWYU pragma: keep
 #include "arrow/flight/transport.h"
 #include "arrow/flight/types.h"
@@ -71,6 +72,36 @@ Status ToProto(const BasicAuth& basic_auth, pb::BasicAuth* pb_basic_auth);
 
 Status ToPayload(const FlightDescriptor& descr, std::shared_ptr<Buffer>* out);
 
+/// \brief The monotonic clock of FlightStreamStats, in nanoseconds.
+ARROW_FLIGHT_EXPORT
+int64_t StatsClockNanos();
+
+/// \brief Write a payload to a stream, counting it in the statistics.
+ARROW_FLIGHT_EXPORT
+arrow::Result<bool> WriteDataWithStats(TransportDataStream* stream,
+                                       const FlightPayload& payload,
+                                       FlightStreamStats* stats);
+
+/// \brief Attribute the time spent in a scope to encoding or decoding,
+///   less the time spent in the transport meanwhile.
+class StreamStatsCodecTimer {
+ public:
+  explicit StreamStatsCodecTimer(FlightStreamStats* stats)
+      : stats_(stats),
+        start_(StatsClockNanos()),
+        transport_start_(stats->transport_nanos) {}
+
+  ~StreamStatsCodecTimer() {
+    stats_->codec_nanos += StatsClockNanos() - start_ -
+                           (stats_->transport_nanos - transport_start_);
+  }
+
+ private:
+  FlightStreamStats* stats_;
+  const int64_t start_;
+  const int64_t transport_start_;
+};
+
 // We want to reuse RecordBatchStreamReader's implementation while
 // (1) Adapting it to the Flight message format
 // (2) Allowing pure-metadata messages before data is sent
@@ -81,8 +112,11 @@ Status ToPayload(const FlightDescriptor& descr, std::shared_ptr<Buffer>* out);
 // message to RecordBatchStreamReader as appropriate.
 class PeekableFlightDataReader {
  public:
-  explicit PeekableFlightDataReader(TransportDataStream* stream)
-      : stream_(stream), peek_(), finished_(false), valid_(false) {}
+  /// \param[in] stream The stream to read from.
+  /// \param[in] stats Where to count the messages read, may be null.
+  explicit PeekableFlightDataReader(TransportDataStream* stream,
+                                    FlightStreamStats* stats = NULLPTR)
+      : stream_(stream), stats_(stats), peek_(), finished_(false), valid_(false) {}
 
   void Peek(internal::FlightData** out) {
     *out = nullptr;
@@ -123,16 +157,32 @@ class PeekableFlightDataReader {
       return valid_;
     }
 
+    const int64_t start = stats_ ? StatsClockNanos() : 0;
     if (!stream_->ReadData(&peek_)) {
       finished_ = true;
       valid_ = false;
     } else {
       valid_ = true;
     }
+    if (stats_) {
+      stats_->transport_nanos += StatsClockNanos() - start;
+      if (valid_) CountMessage();
+    }
     return valid_;
   }
 
+  void CountMessage() {
+    ++stats_->num_messages;
+    if (peek_.metadata) stats_->wire_bytes += peek_.metadata->size();
+    if (peek_.app_metadata) stats_->wire_bytes += peek_.app_metadata->size();
+    if (peek_.body) {
+      stats_->wire_bytes += peek_.body->size();
+      stats_->serialized_body_bytes += peek_.body->size();
+    }
+  }
+
   internal::TransportDataStream* stream_;
+  FlightStreamStats* stats_;
   internal::FlightData peek_;
   bool finished_;
   bool valid_;
@@ -26,20 +26,26 @@
 #include <atomic>
 #include <cerrno>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <utility>
 
+#include "arrow/buffer.h"
 #include "arrow/device.h"
 #include "arrow/flight/transport.h"
 #include "arrow/flight/transport/grpc/grpc_server.h"
 #include "arrow/flight/transport_server.h"
 #include "arrow/flight/types.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/uri.h"
 
 namespace arrow {
@@ -345,6 +351,8 @@ FlightMetadataWriter::~FlightMetadataWriter() = default;
 
 FlightDataStream::~FlightDataStream() {}
 
+Status FlightDataStream::Close() { return Status::OK(); }
+
 RecordBatchStream::RecordBatchStream(const std::shared_ptr<RecordBatchReader>& reader,
                                      const ipc::IpcWriteOptions& options) {
   impl_.reset(new RecordBatchStreamImpl(reader, options));
@@ -366,5 +374,217 @@ arrow::Result<FlightPayload> RecordBatchStream::Next() {
   return payload;
 }
 
+// ----------------------------------------------------------------------
+// Implement RecordBatchGeneratorStream
+
+class RecordBatchGeneratorStream::Impl : public std::enable_shared_from_this<Impl> {
+ public:
+  Impl(std::shared_ptr<Schema> schema,
+       std::function<Future<std::shared_ptr<RecordBatch>>()> generator,
+       const ipc::IpcWriteOptions& options, int64_t max_buffered_bytes,
+       ::arrow::internal::Executor* executor)
+      : schema_(std::move(schema)),
+        generator_(std::move(generator)),
+        mapper_(*schema_),
+        ipc_options_(options),
+        max_buffered_bytes_(max_buffered_bytes),
+        executor_(executor != nullptr ? executor
+                                      : ::arrow::internal::GetCpuThreadPool()) {}
+
+  std::shared_ptr<Schema> schema() { return schema_; }
+
+  arrow::Result<FlightPayload> GetSchemaPayload() {
+    FlightPayload payload;
+    RETURN_NOT_OK(
+        ipc::GetSchemaPayload(*schema_, ipc_options_, mapper_, &payload.ipc_message));
+    // Produce the first batches while the schema is being written out
+    StartProducing();
+    return payload;
+  }
+
+  arrow::Result<FlightPayload> Next() {
+    StartProducing();
+    FlightPayload payload;
+    bool resume;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this] { return !payloads_.empty() || done_; });
+      if (payloads_.empty()) {
+        RETURN_NOT_OK(status_);
+        // Signal that iteration is over
+        payload.ipc_message.metadata = nullptr;
+        return payload;
+      }
+      payload = std::move(payloads_.front());
+      payloads_.pop_front();
+      buffered_bytes_ -= PayloadSize(payload);
+      resume = ResumeUnlocked();
+    }
+    if (resume) ScheduleProduce();
+    return payload;
+  }
+
+  Status Close() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_ = true;
+    cv_.wait(lock, [this] { return !producing_; });
+    payloads_.clear();
+    buffered_bytes_ = 0;
+    return Status::OK();
+  }
+
+ private:
+  static int64_t PayloadSize(const FlightPayload& payload) {
+    return payload.ipc_message.metadata->size() + payload.ipc_message.body_length;
+  }
+
+  bool HasBudgetUnlocked() const {
+    return payloads_.empty() || buffered_bytes_ < max_buffered_bytes_;
+  }
+
+  // Whether the producer should be (re)started, in which case it is marked
+  // as running
+  bool ResumeUnlocked() {
+    if (producing_ || done_ || !HasBudgetUnlocked()) return false;
+    producing_ = true;
+    return true;
+  }
+
+  void StartProducing() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (started_) return;
+      started_ = true;
+      if (!ResumeUnlocked()) return;
+    }
+    ScheduleProduce();
+  }
+
+  void ScheduleProduce() {
+    auto self = shared_from_this();
+    auto st = executor_->Spawn([self] { self->Produce(); });
+    if (!st.ok()) Finish(st);
+  }
+
+  // Pull batches until out of budget, or until a batch is not ready yet
+  void Produce() {
+    while (true) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (done_ || !HasBudgetUnlocked()) {
+          producing_ = false;
+          cv_.notify_all();
+          return;
+        }
+      }
+      auto future = generator_();
+      if (!future.is_finished()) {
+        auto self = shared_from_this();
+        auto options = CallbackOptions::Defaults();
+        options.should_schedule = ShouldSchedule::Always;
+        options.executor = executor_;
+        future.AddCallback(
+            [self](const arrow::Result<std::shared_ptr<RecordBatch>>& batch) {
+              if (self->OnBatch(batch)) self->Produce();
+            },
+            options);
+        return;
+      }
+      if (!OnBatch(future.result())) return;
+    }
+  }
+
+  // Serialize a batch, returns whether to keep producing
+  bool OnBatch(const arrow::Result<std::shared_ptr<RecordBatch>>& maybe_batch) {
+    std::vector<FlightPayload> payloads;
+    Status st = maybe_batch.status();
+    if (st.ok()) {
+      if (*maybe_batch == nullptr) {
+        Finish(Status::OK());
+        return false;
+      }
+      st = Serialize(**maybe_batch, &payloads);
+    }
+    if (!st.ok()) {
+      Finish(st);
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& payload : payloads) {
+      buffered_bytes_ += PayloadSize(payload);
+      payloads_.push_back(std::move(payload));
+    }
+    cv_.notify_all();
+    return true;
+  }
+
+  Status Serialize(const RecordBatch& batch, std::vector<FlightPayload>* out) {
+    // TODO(ARROW-10787): Delta dictionaries
+    if (first_batch_) {
+      first_batch_ = false;
+      ARROW_ASSIGN_OR_RAISE(auto dictionaries, ipc::CollectDictionaries(batch, mapper_));
+      for (const auto& pair : dictionaries) {
+        FlightPayload payload;
+        RETURN_NOT_OK(ipc::GetDictionaryPayload(pair.first, pair.second, ipc_options_,
+                                                &payload.ipc_message));
+        out->push_back(std::move(payload));
+      }
+    }
+    FlightPayload payload;
+    RETURN_NOT_OK(ipc::GetRecordBatchPayload(batch, ipc_options_, &payload.ipc_message));
+    out->push_back(std::move(payload));
+    return Status::OK();
+  }
+
+  void Finish(const Status& st) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (status_.ok()) status_ = st;
+    done_ = true;
+    producing_ = false;
+    cv_.notify_all();
+  }
+
+  const std::shared_ptr<Schema> schema_;
+  const std::function<Future<std::shared_ptr<RecordBatch>>()> generator_;
+  const ipc::DictionaryFieldMapper mapper_;
+  const ipc::IpcWriteOptions ipc_options_;
+  const int64_t max_buffered_bytes_;
+  ::arrow::internal::Executor* const executor_;
+  // Only accessed by the producer, which runs once at a time
+  bool first_batch_ = true;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<FlightPayload> payloads_;
+  int64_t buffered_bytes_ = 0;
+  Status status_;
+  bool started_ = false;
+  bool producing_ = false;
+  // The generator is exhausted or failed, or the stream was closed
+  bool done_ = false;
+};
+
+constexpr int64_t RecordBatchGeneratorStream::kDefaultMaxBufferedBytes;
+
+RecordBatchGeneratorStream::RecordBatchGeneratorStream(
+    std::shared_ptr<Schema> schema,
+    std::function<Future<std::shared_ptr<RecordBatch>>()> generator,
+    const ipc::IpcWriteOptions& options, int64_t max_buffered_bytes,
+    ::arrow::internal::Executor* executor)
+    : impl_(std::make_shared<Impl>(std::move(schema), std::move(generator), options,
+                                   max_buffered_bytes, executor)) {}
+
+RecordBatchGeneratorStream::~RecordBatchGeneratorStream() { ARROW_UNUSED(Close()); }
+
+std::shared_ptr<Schema> RecordBatchGeneratorStream::schema() { return impl_->schema(); }
+
+arrow::Result<FlightPayload> RecordBatchGeneratorStream::GetSchemaPayload() {
+  return impl_->GetSchemaPayload();
+}
+
+arrow::Result<FlightPayload> RecordBatchGeneratorStream::Next() { return impl_->Next(); }
+
+Status RecordBatchGeneratorStream::Close() { return impl_->Close(); }
+
 }  // namespace flight
 }  // namespace arrow
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -34,6 +35,8 @@
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/options.h"
 #include "arrow/record_batch.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/type_fwd.h"
 
 namespace arrow {
 
@@ -64,6 +67,12 @@ class ARROW_FLIGHT_EXPORT FlightDataStream {
 
   ARROW_DEPRECATED("Deprecated in 8.0.0. Use Result-returning overload instead.")
   Status Next(FlightPayload* payload) { return Next().Value(payload); }
+
+  /// \brief Release the resources of the stream.
+  ///
+  /// Called by the server once the stream has been written out, or the
+  /// call ended early (e.g. the client went away).
+  virtual Status Close();
 };
 
 /// \brief A basic implementation of FlightDataStream that will provide
@@ -91,6 +100,51 @@ class ARROW_FLIGHT_EXPORT RecordBatchStream : public FlightDataStream {
   std::unique_ptr<RecordBatchStreamImpl> impl_;
 };
 
+/// \brief A FlightDataStream producing its payloads ahead of the writes.
+///
+/// Record batches are pulled from an asynchronous generator and serialized
+/// to IPC payloads on an executor, so that producing (and compressing) the
+/// next batches overlaps with the server writing the previous ones out.
+/// Production pauses once the serialized payloads not yet written out
+/// exceed a byte budget.  Production starts when the schema payload is
+/// requested.
+class ARROW_FLIGHT_EXPORT RecordBatchGeneratorStream : public FlightDataStream {
+ public:
+  /// \brief The default budget of serialized bytes produced ahead.
+  static constexpr int64_t kDefaultMaxBufferedBytes = 32 * 1024 * 1024;
+
+  /// \param[in] schema the schema of the record batches
+  /// \param[in] generator produces the record batches, then a null batch
+  /// \param[in] options IPC options for writing
+  /// \param[in] max_buffered_bytes the budget of serialized bytes produced
+  ///     ahead; at least one payload is always produced ahead
+  /// \param[in] executor where the payloads are serialized, the CPU thread
+  ///     pool if null
+  RecordBatchGeneratorStream(
+      std::shared_ptr<Schema> schema,
+      std::function<Future<std::shared_ptr<RecordBatch>>()> generator,
+      const ipc::IpcWriteOptions& options = ipc::IpcWriteOptions::Defaults(),
+      int64_t max_buffered_bytes = kDefaultMaxBufferedBytes,
+      ::arrow::internal::Executor* executor = NULLPTR);
+  ~RecordBatchGeneratorStream() override;
+
+  // inherit deprecated API
+  using FlightDataStream::GetSchemaPayload;
+  using FlightDataStream::Next;
+
+  std::shared_ptr<Schema> schema() override;
+  arrow::Result<FlightPayload> GetSchemaPayload() override;
+
+  arrow::Result<FlightPayload> Next() override;
+
+  /// \brief Stop producing, waiting for a pending batch if any.
+  Status Close() override;
+
+ private:
+  class Impl;
+  std::shared_ptr<Impl> impl_;
+};
+
 /// \brief A reader for IPC payloads uploaded by a client. Also allows
 /// reading application-defined metadata via the Flight protocol.
 class ARROW_FLIGHT_EXPORT FlightMessageReader : public MetadataRecordBatchReader {
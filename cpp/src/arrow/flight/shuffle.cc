@@ -0,0 +1,297 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/shuffle.h"
+
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/partition_util.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/value_parsing.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace flight {
+
+namespace {
+
+arrow::Result<int> ParsePartitionIndex(const std::string& value) {
+  int32_t partition;
+  if (!::arrow::internal::ParseValue<Int32Type>(value.data(), value.size(), &partition) ||
+      partition < 0) {
+    return Status::Invalid("Invalid shuffle partition index: ", value);
+  }
+  return partition;
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// ShuffleServer
+
+class ShuffleServer::Impl {
+ public:
+  using BatchGenerator = PushGenerator<util::optional<compute::ExecBatch>>;
+
+  // The batches received for one partition of a shuffle
+  struct Partition {
+    Partition() : producer(generator.producer()) {}
+
+    BatchGenerator generator;
+    BatchGenerator::Producer producer;
+    bool read = false;
+    // Unknown until the partition is read
+    int num_writers = -1;
+    int writers_finished = 0;
+  };
+
+  Status DoPut(std::unique_ptr<FlightMessageReader> reader) {
+    const FlightDescriptor& descriptor = reader->descriptor();
+    if (descriptor.type != FlightDescriptor::PATH || descriptor.path.size() != 2) {
+      return Status::Invalid("Shuffle uploads must be described by the path ",
+                             "{shuffle_id, partition}, got ", descriptor.ToString());
+    }
+    ARROW_ASSIGN_OR_RAISE(int index, ParsePartitionIndex(descriptor.path[1]));
+    std::shared_ptr<Partition> partition = GetPartition(descriptor.path[0], index);
+
+    while (true) {
+      auto maybe_chunk = reader->Next();
+      if (!maybe_chunk.ok()) {
+        // The readers of the partition would otherwise wait for the writer forever
+        partition->producer.Push(maybe_chunk.status());
+        return maybe_chunk.status();
+      }
+      if (!maybe_chunk->data) {
+        break;
+      }
+      partition->producer.Push(
+          util::make_optional(compute::ExecBatch(*maybe_chunk->data)));
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++partition->writers_finished;
+    if (partition->read && partition->writers_finished == partition->num_writers) {
+      partition->producer.Close();
+    }
+    return Status::OK();
+  }
+
+  arrow::Result<AsyncGenerator<util::optional<compute::ExecBatch>>> ReadPartition(
+      const std::string& shuffle_id, int index, int num_writers) {
+    if (num_writers < 1) {
+      return Status::Invalid("A shuffle needs at least one writer, got ", num_writers);
+    }
+    std::shared_ptr<Partition> partition = GetPartition(shuffle_id, index);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (partition->read) {
+      return Status::Invalid("Partition ", index, " of shuffle ", shuffle_id,
+                             " was already read");
+    }
+    partition->read = true;
+    partition->num_writers = num_writers;
+    if (partition->writers_finished >= num_writers) {
+      partition->producer.Close();
+    }
+    return AsyncGenerator<util::optional<compute::ExecBatch>>(partition->generator);
+  }
+
+ private:
+  std::shared_ptr<Partition> GetPartition(const std::string& shuffle_id, int index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& partition = partitions_[std::make_pair(shuffle_id, index)];
+    if (!partition) {
+      partition = std::make_shared<Partition>();
+    }
+    return partition;
+  }
+
+  std::mutex mutex_;
+  std::map<std::pair<std::string, int>, std::shared_ptr<Partition>> partitions_;
+};
+
+ShuffleServer::ShuffleServer() : impl_(::arrow::internal::make_unique<Impl>()) {}
+
+ShuffleServer::~ShuffleServer() = default;
+
+Status ShuffleServer::DoPut(const ServerCallContext& context,
+                            std::unique_ptr<FlightMessageReader> reader,
+                            std::unique_ptr<FlightMetadataWriter> writer) {
+  return impl_->DoPut(std::move(reader));
+}
+
+arrow::Result<AsyncGenerator<util::optional<compute::ExecBatch>>>
+ShuffleServer::ReadPartition(const std::string& shuffle_id, int partition,
+                             int num_writers) {
+  return impl_->ReadPartition(shuffle_id, partition, num_writers);
+}
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Shuffle sink
+
+// Uploads each partition of the consumed batches to its peer
+class ShuffleSinkNodeConsumer : public compute::SinkNodeConsumer {
+ public:
+  ShuffleSinkNodeConsumer(compute::ExecContext* exec_context,
+                          ShuffleSinkNodeOptions options)
+      : exec_context_(exec_context), options_(std::move(options)) {}
+
+  Status Init(const std::shared_ptr<Schema>& schema,
+              compute::BackpressureControl* backpressure_control) override {
+    schema_ = schema;
+    for (const auto& key : options_.keys) {
+      ARROW_ASSIGN_OR_RAISE(auto match, key.FindOne(*schema_));
+      if (match.indices().size() > 1) {
+        return Status::NotImplemented("Shuffling on nested keys, got ", key.ToString());
+      }
+      key_ids_.push_back(match[0]);
+    }
+
+    const int num_peers = static_cast<int>(options_.peers.size());
+    for (int i = 0; i < num_peers; ++i) {
+      peers_.push_back(::arrow::internal::make_unique<Peer>());
+      Peer& peer = *peers_.back();
+      ARROW_ASSIGN_OR_RAISE(
+          peer.client, FlightClient::Connect(options_.peers[i], options_.client_options));
+      auto descriptor = FlightDescriptor::Path({options_.shuffle_id, std::to_string(i)});
+      ARROW_ASSIGN_OR_RAISE(
+          auto put, peer.client->DoPut(options_.call_options, descriptor, schema_));
+      peer.writer = std::move(put.writer);
+      peer.metadata_reader = std::move(put.reader);
+    }
+    return Status::OK();
+  }
+
+  Status Consume(compute::ExecBatch batch) override {
+    ARROW_ASSIGN_OR_RAISE(
+        auto partitions,
+        compute::HashPartitionBatch(exec_context_, batch, key_ids_,
+                                    static_cast<int>(peers_.size())));
+    for (size_t i = 0; i < partitions.size(); ++i) {
+      if (partitions[i].length == 0) {
+        continue;
+      }
+      ARROW_ASSIGN_OR_RAISE(auto record_batch, partitions[i].ToRecordBatch(schema_));
+      Peer& peer = *peers_[i];
+      std::lock_guard<std::mutex> lock(peer.mutex);
+      RETURN_NOT_OK(peer.writer->WriteRecordBatch(*record_batch));
+    }
+    return Status::OK();
+  }
+
+  Future<> Finish() override {
+    Status status;
+    for (auto& peer : peers_) {
+      if (!peer->writer) {
+        // Init failed before the upload to this peer was started
+        continue;
+      }
+      status &= peer->writer->DoneWriting();
+      // Waits for the peer to have received the whole partition
+      status &= peer->writer->Close();
+      status &= peer->client->Close();
+    }
+    return Future<>::MakeFinished(std::move(status));
+  }
+
+ private:
+  struct Peer {
+    std::unique_ptr<FlightClient> client;
+    std::unique_ptr<FlightStreamWriter> writer;
+    std::unique_ptr<FlightMetadataReader> metadata_reader;
+    // Batches may be consumed from several threads at once
+    std::mutex mutex;
+  };
+
+  compute::ExecContext* exec_context_;
+  const ShuffleSinkNodeOptions options_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<int> key_ids_;
+  std::vector<std::unique_ptr<Peer>> peers_;
+};
+
+arrow::Result<compute::ExecNode*> MakeShuffleSinkNode(
+    compute::ExecPlan* plan, std::vector<compute::ExecNode*> inputs,
+    const compute::ExecNodeOptions& options) {
+  RETURN_NOT_OK(compute::ValidateExecNodeInputs(plan, inputs, 1, "ShuffleSinkNode"));
+  const auto& shuffle_options = checked_cast<const ShuffleSinkNodeOptions&>(options);
+  if (shuffle_options.peers.empty() ||
+      shuffle_options.peers.size() > static_cast<size_t>(1 << 15)) {
+    return Status::Invalid("ShuffleSinkNode needs between 1 and ", 1 << 15,
+                           " peers, got ", shuffle_options.peers.size());
+  }
+  if (shuffle_options.keys.empty()) {
+    return Status::Invalid("ShuffleSinkNode requires at least one key");
+  }
+  auto consumer =
+      std::make_shared<ShuffleSinkNodeConsumer>(plan->exec_context(), shuffle_options);
+  return compute::MakeExecNode("consuming_sink", plan, std::move(inputs),
+                               compute::ConsumingSinkNodeOptions{std::move(consumer)});
+}
+
+// ----------------------------------------------------------------------
+// Shuffle source
+
+arrow::Result<compute::ExecNode*> MakeShuffleSourceNode(
+    compute::ExecPlan* plan, std::vector<compute::ExecNode*> inputs,
+    const compute::ExecNodeOptions& options) {
+  RETURN_NOT_OK(compute::ValidateExecNodeInputs(plan, inputs, 0, "ShuffleSourceNode"));
+  const auto& shuffle_options = checked_cast<const ShuffleSourceNodeOptions&>(options);
+  if (!shuffle_options.server) {
+    return Status::Invalid("ShuffleSourceNode requires a ShuffleServer");
+  }
+  if (!shuffle_options.output_schema) {
+    return Status::Invalid("ShuffleSourceNode requires an output schema");
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      auto generator,
+      shuffle_options.server->ReadPartition(shuffle_options.shuffle_id,
+                                            shuffle_options.partition,
+                                            shuffle_options.num_writers));
+  return compute::MakeExecNode(
+      "source", plan, {},
+      compute::SourceNodeOptions{shuffle_options.output_schema, std::move(generator)});
+}
+
+}  // namespace
+
+namespace internal {
+
+void InitializeShuffle() {
+  static std::once_flag flag;
+  std::call_once(flag, [] {
+    auto registry = compute::default_exec_factory_registry();
+    if (registry) {
+      DCHECK_OK(registry->AddFactory("flight_shuffle_sink", MakeShuffleSinkNode));
+      DCHECK_OK(registry->AddFactory("flight_shuffle_source", MakeShuffleSourceNode));
+    }
+  });
+}
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,130 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Exec nodes shuffling the rows of a plan across Flight peers.
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/flight/client.h"
+#include "arrow/flight/server.h"
+#include "arrow/flight/types.h"
+#include "arrow/flight/visibility.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/optional.h"
+
+namespace arrow {
+namespace flight {
+
+/// \brief A Flight service receiving the partitions of shuffles sent to this peer
+///
+/// Writers (see ShuffleSinkNodeOptions) upload one stream per partition with DoPut,
+/// under a descriptor with the path {shuffle_id, partition index}.  The uploaded batches
+/// are buffered in memory until they are read by a local plan, with a
+/// "flight_shuffle_source" node (see ShuffleSourceNodeOptions).
+class ARROW_FLIGHT_EXPORT ShuffleServer : public FlightServerBase {
+ public:
+  ShuffleServer();
+  ~ShuffleServer() override;
+
+  Status DoPut(const ServerCallContext& context,
+               std::unique_ptr<FlightMessageReader> reader,
+               std::unique_ptr<FlightMetadataWriter> writer) override;
+
+  /// \brief Read a partition of a shuffle
+  ///
+  /// The returned generator yields the batches uploaded for the partition, in the order
+  /// they are received, and ends once `num_writers` uploads of it have completed.  If an
+  /// upload fails the generator yields its error.  A partition may only be read once,
+  /// but it may be read before, while or after it is uploaded.
+  arrow::Result<AsyncGenerator<util::optional<compute::ExecBatch>>> ReadPartition(
+      const std::string& shuffle_id, int partition, int num_writers);
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Make a sink node which hash partitions its input across Flight peers
+///
+/// The i-th peer receives partition i, so that rows with equal `keys` are sent to the
+/// same peer.  Each of the peers is expected to run a ShuffleServer, and to read
+/// its partition with a "flight_shuffle_source" node.  Batches are uploaded from the
+/// thread that delivers them to the node.
+class ARROW_FLIGHT_EXPORT ShuffleSinkNodeOptions : public compute::ExecNodeOptions {
+ public:
+  ShuffleSinkNodeOptions(
+      std::string shuffle_id, std::vector<FieldRef> keys, std::vector<Location> peers,
+      FlightClientOptions client_options = FlightClientOptions::Defaults(),
+      FlightCallOptions call_options = {})
+      : shuffle_id(std::move(shuffle_id)),
+        keys(std::move(keys)),
+        peers(std::move(peers)),
+        client_options(std::move(client_options)),
+        call_options(std::move(call_options)) {}
+
+  // identifies the shuffle on the peers, which may receive several at once
+  std::string shuffle_id;
+  // keys by which rows are partitioned
+  std::vector<FieldRef> keys;
+  // the peers to which partitions are sent, one per partition
+  std::vector<Location> peers;
+  FlightClientOptions client_options;
+  FlightCallOptions call_options;
+};
+
+/// \brief Make a source node which reads a partition received by a ShuffleServer
+///
+/// The node finishes once each of the `num_writers` sink nodes writing the shuffle has
+/// finished uploading the partition.
+class ARROW_FLIGHT_EXPORT ShuffleSourceNodeOptions : public compute::ExecNodeOptions {
+ public:
+  ShuffleSourceNodeOptions(std::shared_ptr<ShuffleServer> server, std::string shuffle_id,
+                           int partition, int num_writers,
+                           std::shared_ptr<Schema> output_schema)
+      : server(std::move(server)),
+        shuffle_id(std::move(shuffle_id)),
+        partition(partition),
+        num_writers(num_writers),
+        output_schema(std::move(output_schema)) {}
+
+  std::shared_ptr<ShuffleServer> server;
+  std::string shuffle_id;
+  int partition;
+  int num_writers;
+  // the schema of the shuffled rows, which must be known before any are received
+  std::shared_ptr<Schema> output_schema;
+};
+
+namespace internal {
+
+/// Register the "flight_shuffle_sink" and "flight_shuffle_source" exec nodes with the
+/// default exec node registry
+///
+/// This function must be called before using these ExecNode factories
+ARROW_FLIGHT_EXPORT void InitializeShuffle();
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
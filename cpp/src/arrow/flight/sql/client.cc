@@ -108,6 +108,59 @@ arrow::Result<int64_t> FlightSqlClient::ExecuteUpdate(const FlightCallOptions& o
   return result.record_count();
 }
 
+arrow::Result<int64_t> FlightSqlClient::ExecuteIngest(const FlightCallOptions& options,
+                                                      RecordBatchReader* reader,
+                                                      const std::string& table,
+                                                      const std::string* catalog,
+                                                      const std::string* db_schema) {
+  flight_sql_pb::CommandStatementIngest command;
+  command.set_table(table);
+  if (catalog != NULLPTR) {
+    command.set_catalog(*catalog);
+  }
+  if (db_schema != NULLPTR) {
+    command.set_db_schema(*db_schema);
+  }
+
+  const FlightDescriptor& descriptor = GetFlightDescriptorForCommand(command);
+
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightMetadataReader> metadata_reader;
+  ARROW_RETURN_NOT_OK(
+      DoPut(options, descriptor, reader->schema(), &writer, &metadata_reader));
+
+  auto write_all = [&]() -> Status {
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(reader->ReadNext(&batch));
+      if (!batch) break;
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    return writer->DoneWriting();
+  };
+  auto write_status = write_all();
+  if (!write_status.ok()) {
+    // The server's error explains a failed write better than the write itself
+    ARROW_RETURN_NOT_OK(writer->Close());
+    return write_status;
+  }
+
+  std::shared_ptr<Buffer> metadata;
+  auto read_status = metadata_reader->ReadMetadata(&metadata);
+  ARROW_RETURN_NOT_OK(writer->Close());
+  ARROW_RETURN_NOT_OK(read_status);
+  if (metadata == nullptr) {
+    return Status::IOError("Server did not return the ingested record count.");
+  }
+
+  flight_sql_pb::DoPutUpdateResult result;
+  if (!result.ParseFromArray(metadata->data(), static_cast<int>(metadata->size()))) {
+    return Status::Invalid("Unable to parse DoPutUpdateResult object.");
+  }
+
+  return result.record_count();
+}
+
 arrow::Result<std::unique_ptr<FlightInfo>> FlightSqlClient::GetCatalogs(
     const FlightCallOptions& options) {
   flight_sql_pb::CommandGetCatalogs command;
@@ -60,6 +60,21 @@ class ARROW_EXPORT FlightSqlClient {
   arrow::Result<int64_t> ExecuteUpdate(const FlightCallOptions& options,
                                        const std::string& query);
 
+  /// \brief Load record batches into a table on the server.
+  ///
+  /// The batches are streamed as they are read from `reader`.
+  /// \param[in] options      RPC-layer hints for this call.
+  /// \param[in] reader       The record batches to load.
+  /// \param[in] table        The table to load them into.
+  /// \param[in] catalog      The catalog of the table, or null for the default.
+  /// \param[in] db_schema    The schema of the table, or null for the default.
+  /// \return The quantity of rows ingested by the server.
+  arrow::Result<int64_t> ExecuteIngest(const FlightCallOptions& options,
+                                       RecordBatchReader* reader,
+                                       const std::string& table,
+                                       const std::string* catalog = NULLPTR,
+                                       const std::string* db_schema = NULLPTR);
+
   /// \brief Request a list of catalogs.
   /// \param[in] options      RPC-layer hints for this call.
   /// \return The FlightInfo describing where to access the dataset.
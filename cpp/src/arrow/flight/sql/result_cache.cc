@@ -0,0 +1,210 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/sql/result_cache.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/message.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace flight {
+namespace sql {
+
+namespace {
+
+int64_t PayloadSize(const ipc::IpcPayload& payload) {
+  return payload.metadata->size() + payload.body_length;
+}
+
+class MemoryResultCache : public ResultCache {
+ public:
+  explicit MemoryResultCache(int64_t capacity_bytes) : capacity_bytes_(capacity_bytes) {}
+
+  int64_t max_result_bytes() const override { return capacity_bytes_; }
+
+  arrow::Result<std::shared_ptr<const CachedResult>> Get(
+      const std::string& key) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return nullptr;
+    // Mark as most recently used
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->second;
+  }
+
+  Status Put(const std::string& key,
+             std::shared_ptr<const CachedResult> result) override {
+    const int64_t nbytes = result->nbytes();
+    std::lock_guard<std::mutex> lock(mutex_);
+    EraseUnlocked(key);
+    if (nbytes > capacity_bytes_) return Status::OK();
+    lru_.emplace_front(key, std::move(result));
+    entries_[key] = lru_.begin();
+    cached_bytes_ += nbytes;
+    while (cached_bytes_ > capacity_bytes_) {
+      EraseUnlocked(lru_.back().first);
+    }
+    return Status::OK();
+  }
+
+ private:
+  using Entry = std::pair<std::string, std::shared_ptr<const CachedResult>>;
+
+  void EraseUnlocked(const std::string& key) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return;
+    cached_bytes_ -= it->second->second->nbytes();
+    lru_.erase(it->second);
+    entries_.erase(it);
+  }
+
+  const int64_t capacity_bytes_;
+  std::mutex mutex_;
+  // Most recently used first
+  std::list<Entry> lru_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> entries_;
+  int64_t cached_bytes_ = 0;
+};
+
+// Files hold the length of the key and the key, followed by the IPC messages
+class FileResultCache : public ResultCache {
+ public:
+  FileResultCache(std::string directory, int64_t max_result_bytes)
+      : directory_(std::move(directory)), max_result_bytes_(max_result_bytes) {}
+
+  int64_t max_result_bytes() const override { return max_result_bytes_; }
+
+  arrow::Result<std::shared_ptr<const CachedResult>> Get(
+      const std::string& key) override {
+    ARROW_ASSIGN_OR_RAISE(auto path, PathOf(key));
+    ARROW_ASSIGN_OR_RAISE(auto exists, ::arrow::internal::FileExists(path));
+    if (!exists) return nullptr;
+    ARROW_ASSIGN_OR_RAISE(
+        auto file, io::MemoryMappedFile::Open(path.ToString(), io::FileMode::READ));
+
+    // Another key may hash to the same file
+    ARROW_ASSIGN_OR_RAISE(auto key_length_buffer, file->Read(sizeof(uint64_t)));
+    if (key_length_buffer->size() != sizeof(uint64_t)) return nullptr;
+    uint64_t key_length;
+    std::memcpy(&key_length, key_length_buffer->data(), sizeof(uint64_t));
+    if (::arrow::bit_util::FromLittleEndian(key_length) != key.size()) return nullptr;
+    ARROW_ASSIGN_OR_RAISE(auto stored_key, file->Read(key.size()));
+    if (stored_key->ToString() != key) return nullptr;
+
+    auto result = std::make_shared<CachedResult>();
+    auto reader = ipc::MessageReader::Open(file.get());
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto message, reader->ReadNextMessage());
+      if (message == nullptr) break;
+      if (result->payloads.empty()) {
+        ipc::DictionaryMemo memo;
+        ARROW_ASSIGN_OR_RAISE(result->schema, ipc::ReadSchema(*message, &memo));
+      }
+      ipc::IpcPayload payload;
+      payload.type = message->type();
+      payload.metadata = message->metadata();
+      payload.body_length = message->body_length();
+      if (message->body() != nullptr) {
+        payload.body_buffers.push_back(message->body());
+      }
+      result->payloads.push_back(std::move(payload));
+    }
+    if (result->payloads.empty()) {
+      return Status::IOError("Cached result without schema in ", path.ToString());
+    }
+    return result;
+  }
+
+  Status Put(const std::string& key,
+             std::shared_ptr<const CachedResult> result) override {
+    if (result->nbytes() > max_result_bytes_) return Status::OK();
+    ARROW_ASSIGN_OR_RAISE(auto path, PathOf(key));
+    // Write to a temporary file first so that readers never see partial results
+    const auto temp_path = path.ToString() + ".tmp" + std::to_string(++temp_counter_);
+    {
+      ARROW_ASSIGN_OR_RAISE(auto stream, io::FileOutputStream::Open(temp_path));
+      const uint64_t key_length =
+          ::arrow::bit_util::ToLittleEndian(static_cast<uint64_t>(key.size()));
+      RETURN_NOT_OK(stream->Write(&key_length, sizeof(uint64_t)));
+      RETURN_NOT_OK(stream->Write(key.data(), static_cast<int64_t>(key.size())));
+      const auto options = ipc::IpcWriteOptions::Defaults();
+      for (const auto& payload : result->payloads) {
+        int32_t metadata_length;
+        RETURN_NOT_OK(
+            ipc::WriteIpcPayload(payload, options, stream.get(), &metadata_length));
+      }
+      RETURN_NOT_OK(stream->Close());
+    }
+    if (std::rename(temp_path.c_str(), path.ToString().c_str()) != 0) {
+      ARROW_UNUSED(::arrow::internal::DeleteFile(
+          *::arrow::internal::PlatformFilename::FromString(temp_path)));
+      return Status::IOError("Failed to rename cached result to ", path.ToString());
+    }
+    return Status::OK();
+  }
+
+ private:
+  arrow::Result<::arrow::internal::PlatformFilename> PathOf(const std::string& key) {
+    std::stringstream ss;
+    ss << std::hex << std::hash<std::string>()(key) << ".arrows";
+    ARROW_ASSIGN_OR_RAISE(auto dir,
+                          ::arrow::internal::PlatformFilename::FromString(directory_));
+    return dir.Join(ss.str());
+  }
+
+  const std::string directory_;
+  const int64_t max_result_bytes_;
+  std::atomic<uint64_t> temp_counter_{0};
+};
+
+}  // namespace
+
+int64_t CachedResult::nbytes() const {
+  int64_t nbytes = 0;
+  for (const auto& payload : payloads) {
+    nbytes += PayloadSize(payload);
+  }
+  return nbytes;
+}
+
+std::shared_ptr<ResultCache> MakeMemoryResultCache(int64_t capacity_bytes) {
+  return std::make_shared<MemoryResultCache>(capacity_bytes);
+}
+
+std::shared_ptr<ResultCache> MakeFileResultCache(std::string directory,
+                                                 int64_t max_result_bytes) {
+  return std::make_shared<FileResultCache>(std::move(directory), max_result_bytes);
+}
+
+}  // namespace sql
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Caches of query results for Flight SQL servers. API should be considered
+// experimental for now
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/ipc/writer.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace flight {
+namespace sql {
+
+/// \brief The results of a query, as the IPC messages sent to clients.
+struct ARROW_EXPORT CachedResult {
+  /// \brief The schema of the results.
+  std::shared_ptr<Schema> schema;
+  /// \brief The schema message, then the dictionary and record batch messages.
+  std::vector<ipc::IpcPayload> payloads;
+
+  /// \brief The size of the IPC messages, in bytes.
+  int64_t nbytes() const;
+};
+
+/// \brief A cache of query results.
+///
+/// Keys are opaque strings.  Implementations must be thread-safe.
+class ARROW_EXPORT ResultCache {
+ public:
+  virtual ~ResultCache() = default;
+
+  /// \brief The largest result worth caching, in bytes.
+  ///
+  /// Larger results are not recorded at all.
+  virtual int64_t max_result_bytes() const = 0;
+
+  /// \brief Look up the results cached for a key.
+  /// \return the results, null if none are cached
+  virtual arrow::Result<std::shared_ptr<const CachedResult>> Get(
+      const std::string& key) = 0;
+
+  /// \brief Cache the results for a key, replacing any previous results.
+  virtual Status Put(const std::string& key,
+                     std::shared_ptr<const CachedResult> result) = 0;
+};
+
+/// \brief Make a cache keeping results in memory.
+///
+/// The least recently used results are evicted once the cached results
+/// exceed the given capacity.
+///
+/// \param[in] capacity_bytes the capacity of the cache, in bytes
+ARROW_EXPORT std::shared_ptr<ResultCache> MakeMemoryResultCache(int64_t capacity_bytes);
+
+/// \brief Make a cache keeping results in files of a directory.
+///
+/// Each result is stored as a stream of IPC messages, which are memory-mapped
+/// when served again.  Files are never evicted: clear the directory to
+/// reclaim space.
+///
+/// \param[in] directory an existing directory
+/// \param[in] max_result_bytes the largest result worth caching, in bytes
+ARROW_EXPORT std::shared_ptr<ResultCache> MakeFileResultCache(
+    std::string directory, int64_t max_result_bytes = 1LL << 30);
+
+}  // namespace sql
+}  // namespace flight
+}  // namespace arrow
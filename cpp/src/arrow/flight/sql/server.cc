@@ -22,12 +22,27 @@
 
 #include <google/protobuf/any.pb.h>
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
 #include "arrow/flight/sql/FlightSql.pb.h"
 #include "arrow/flight/sql/sql_info_internal.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/message.h"
+#include "arrow/ipc/reader.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/value_parsing.h"
 
 #define PROPERTY_TO_OPTIONAL(COMMAND, PROPERTY) \
   COMMAND.has_##PROPERTY() ? util::make_optional(COMMAND.PROPERTY()) : util::nullopt
@@ -223,6 +238,20 @@ arrow::Result<PreparedStatementUpdate> ParseCommandPreparedStatementUpdate(
   return result;
 }
 
+arrow::Result<StatementIngest> ParseCommandStatementIngest(
+    const google::protobuf::Any& any) {
+  pb::sql::CommandStatementIngest command;
+  if (!any.UnpackTo(&command)) {
+    return Status::Invalid("Unable to unpack CommandStatementIngest.");
+  }
+
+  StatementIngest result;
+  result.table = command.table();
+  result.catalog = PROPERTY_TO_OPTIONAL(command, catalog);
+  result.db_schema = PROPERTY_TO_OPTIONAL(command, db_schema);
+  return result;
+}
+
 arrow::Result<ActionCreatePreparedStatementRequest>
 ParseActionCreatePreparedStatementRequest(const google::protobuf::Any& any) {
   pb::sql::ActionCreatePreparedStatementRequest command;
@@ -265,6 +294,483 @@ arrow::Result<std::string> CreateStatementQueryTicket(
   return ticket_string;
 }
 
+// ----------------------------------------------------------------------
+// Result cache
+
+namespace {
+
+// Prefix of the statement handles of results served from the cache
+constexpr char kCachedResultHandlePrefix[] = "arrow.flight.sql.CachedResult:";
+
+// Concatenate strings, each prefixed by its length
+std::string EncodeFields(const std::vector<std::string>& fields) {
+  std::string encoded;
+  for (const auto& field : fields) {
+    encoded += std::to_string(field.size());
+    encoded += ':';
+    encoded += field;
+  }
+  return encoded;
+}
+
+arrow::Result<std::vector<std::string>> DecodeFields(util::string_view encoded) {
+  std::vector<std::string> fields;
+  while (!encoded.empty()) {
+    const auto colon = encoded.find(':');
+    uint64_t length = 0;
+    if (colon == util::string_view::npos ||
+        !::arrow::internal::ParseValue<UInt64Type>(encoded.data(), colon, &length) ||
+        length > encoded.size() - colon - 1) {
+      return Status::Invalid("Invalid cached result handle");
+    }
+    fields.emplace_back(encoded.substr(colon + 1, length));
+    encoded = encoded.substr(colon + 1 + length);
+  }
+  return fields;
+}
+
+std::string MakeResultCacheKey(const std::string& query, const std::string& parameters,
+                               const std::string& token) {
+  return EncodeFields({query, parameters, token});
+}
+
+// The statement handle of the single endpoint of a FlightInfo served by this server
+util::optional<std::string> GetSingleStatementHandle(const FlightInfo& info) {
+  if (info.endpoints().size() != 1 || !info.endpoints()[0].locations.empty()) {
+    return util::nullopt;
+  }
+  const auto& ticket = info.endpoints()[0].ticket.ticket;
+  google::protobuf::Any any;
+  if (!any.ParseFromArray(ticket.data(), static_cast<int>(ticket.size())) ||
+      !any.Is<pb::sql::TicketStatementQuery>()) {
+    return util::nullopt;
+  }
+  auto maybe_command = ParseStatementQueryTicket(any);
+  if (!maybe_command.ok()) return util::nullopt;
+  return maybe_command->statement_handle;
+}
+
+// Serves the IPC messages of cached results
+class CachedResultStream : public FlightDataStream {
+ public:
+  explicit CachedResultStream(std::shared_ptr<const CachedResult> result)
+      : result_(std::move(result)) {}
+
+  std::shared_ptr<Schema> schema() override { return result_->schema; }
+
+  arrow::Result<FlightPayload> GetSchemaPayload() override {
+    FlightPayload payload;
+    payload.ipc_message = result_->payloads[0];
+    return payload;
+  }
+
+  arrow::Result<FlightPayload> Next() override {
+    FlightPayload payload;
+    if (next_payload_ < result_->payloads.size()) {
+      payload.ipc_message = result_->payloads[next_payload_++];
+    }
+    // Otherwise, the null metadata signals that iteration is over
+    return payload;
+  }
+
+ private:
+  std::shared_ptr<const CachedResult> result_;
+  size_t next_payload_ = 1;
+};
+
+// Records the IPC messages of results, and caches them once all were sent
+class RecordingStream : public FlightDataStream {
+ public:
+  RecordingStream(std::unique_ptr<FlightDataStream> stream,
+                  std::shared_ptr<ResultCache> cache, std::string key)
+      : stream_(std::move(stream)),
+        cache_(std::move(cache)),
+        key_(std::move(key)),
+        result_(std::make_shared<CachedResult>()) {}
+
+  std::shared_ptr<Schema> schema() override { return stream_->schema(); }
+
+  arrow::Result<FlightPayload> GetSchemaPayload() override {
+    ARROW_ASSIGN_OR_RAISE(auto payload, stream_->GetSchemaPayload());
+    if (result_ != nullptr) {
+      ipc::DictionaryMemo memo;
+      auto maybe_schema = ipc::Message::Open(payload.ipc_message.metadata, nullptr)
+                              .Map([&](const std::unique_ptr<ipc::Message>& message) {
+                                return ipc::ReadSchema(*message, &memo);
+                              });
+      if (maybe_schema.ok()) {
+        result_->schema = maybe_schema.MoveValueUnsafe();
+      } else {
+        result_.reset();
+      }
+    }
+    Record(payload);
+    return payload;
+  }
+
+  arrow::Result<FlightPayload> Next() override {
+    ARROW_ASSIGN_OR_RAISE(auto payload, stream_->Next());
+    if (payload.ipc_message.metadata != nullptr) {
+      Record(payload);
+    } else if (result_ != nullptr) {
+      ARROW_WARN_NOT_OK(cache_->Put(key_, std::move(result_)),
+                        "Failed to cache Flight SQL results");
+      result_.reset();
+    }
+    return payload;
+  }
+
+  Status Close() override { return stream_->Close(); }
+
+ private:
+  void Record(const FlightPayload& payload) {
+    if (result_ == nullptr) return;
+    recorded_bytes_ +=
+        payload.ipc_message.metadata->size() + payload.ipc_message.body_length;
+    if (payload.app_metadata != nullptr || recorded_bytes_ > cache_->max_result_bytes()) {
+      // Not worth caching
+      result_.reset();
+      return;
+    }
+    // The buffers of the messages are shared, not copied
+    result_->payloads.push_back(payload.ipc_message);
+  }
+
+  std::unique_ptr<FlightDataStream> stream_;
+  std::shared_ptr<ResultCache> cache_;
+  const std::string key_;
+  std::shared_ptr<CachedResult> result_;
+  int64_t recorded_bytes_ = 0;
+};
+
+// Records the parameters bound to a prepared statement
+class ParameterRecordingReader : public FlightMessageReader {
+ public:
+  explicit ParameterRecordingReader(FlightMessageReader* reader) : reader_(reader) {}
+
+  const FlightDescriptor& descriptor() const override { return reader_->descriptor(); }
+
+  arrow::Result<std::shared_ptr<Schema>> GetSchema() override {
+    return reader_->GetSchema();
+  }
+
+  arrow::Result<FlightStreamChunk> Next() override {
+    ARROW_ASSIGN_OR_RAISE(auto chunk, reader_->Next());
+    if (chunk.data != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto buffer,
+          ipc::SerializeRecordBatch(*chunk.data, ipc::IpcWriteOptions::Defaults()));
+      parameters_ += buffer->ToString();
+    }
+    return chunk;
+  }
+
+  const std::string& parameters() const { return parameters_; }
+
+ private:
+  FlightMessageReader* reader_;
+  std::string parameters_;
+};
+
+// Reads the uploaded batches on the I/O thread pool, at most `readahead`
+// ahead of the consumer.
+class IngestReader : public RecordBatchReader {
+ public:
+  IngestReader(FlightMessageReader* reader, std::shared_ptr<Schema> schema,
+               int32_t readahead)
+      : reader_(reader), schema_(std::move(schema)), readahead_(readahead) {}
+
+  ~IngestReader() override { ARROW_WARN_NOT_OK(Close(), "Failed to close ingestion"); }
+
+  Status Start() {
+    ARROW_ASSIGN_OR_RAISE(producer_,
+                          io::internal::GetIOThreadPool()->Submit([this] { Produce(); }));
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    consumer_cv_.wait(lock, [this] { return !batches_.empty() || done_; });
+    if (batches_.empty()) {
+      *batch = nullptr;
+      return status_;
+    }
+    *batch = std::move(batches_.front());
+    batches_.pop_front();
+    producer_cv_.notify_one();
+    return Status::OK();
+  }
+
+  Status Close() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+      batches_.clear();
+    }
+    producer_cv_.notify_one();
+    // The producer uses the message reader, which the caller owns
+    if (producer_.is_valid()) producer_.Wait();
+    return Status::OK();
+  }
+
+ private:
+  void Produce() {
+    Status status;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        producer_cv_.wait(lock, [this] {
+          return closed_ || static_cast<int32_t>(batches_.size()) < readahead_;
+        });
+        if (closed_) break;
+      }
+      auto maybe_chunk = reader_->Next();
+      if (!maybe_chunk.ok()) {
+        status = maybe_chunk.status();
+        break;
+      }
+      if (maybe_chunk->data) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        batches_.push_back(std::move(maybe_chunk->data));
+        consumer_cv_.notify_one();
+      } else if (!maybe_chunk->app_metadata) {
+        // End of stream; metadata-only messages are skipped
+        break;
+      }
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    status_ = std::move(status);
+    done_ = true;
+    consumer_cv_.notify_one();
+  }
+
+  FlightMessageReader* reader_;
+  std::shared_ptr<Schema> schema_;
+  const int32_t readahead_;
+  Future<> producer_;
+
+  std::mutex mutex_;
+  std::condition_variable producer_cv_;
+  std::condition_variable consumer_cv_;
+  std::deque<std::shared_ptr<RecordBatch>> batches_;
+  bool closed_ = false;
+  bool done_ = false;
+  Status status_;
+};
+
+}  // namespace
+
+class FlightSqlServerBase::ResultCacheLayer {
+ public:
+  explicit ResultCacheLayer(std::shared_ptr<ResultCache> cache)
+      : cache_(std::move(cache)) {}
+
+  arrow::Result<std::unique_ptr<FlightInfo>> GetFlightInfoStatement(
+      FlightSqlServerBase* server, const ServerCallContext& context,
+      const StatementQuery& command, const FlightDescriptor& descriptor) {
+    ARROW_ASSIGN_OR_RAISE(auto token, server->GetResultCacheToken(context));
+    auto key = MakeResultCacheKey(command.query, "", token);
+    ARROW_ASSIGN_OR_RAISE(auto info, GetCachedFlightInfo(key, "", descriptor));
+    if (info != nullptr) return std::move(info);
+
+    ARROW_ASSIGN_OR_RAISE(info,
+                          server->GetFlightInfoStatement(context, command, descriptor));
+    auto handle = GetSingleStatementHandle(*info);
+    if (handle.has_value()) {
+      // Remember the key until the ticket is redeemed
+      std::lock_guard<std::mutex> lock(mutex_);
+      pending_statements_[*handle] = std::move(key);
+      pending_order_.push_back(std::move(*handle));
+      while (pending_order_.size() > kMaxPendingStatements) {
+        pending_statements_.erase(pending_order_.front());
+        pending_order_.pop_front();
+      }
+    }
+    return std::move(info);
+  }
+
+  arrow::Result<std::unique_ptr<FlightDataStream>> DoGetStatement(
+      FlightSqlServerBase* server, const ServerCallContext& context,
+      const StatementQueryTicket& command) {
+    const auto& handle = command.statement_handle;
+    const util::string_view prefix(kCachedResultHandlePrefix);
+    if (util::string_view(handle).starts_with(prefix)) {
+      return DoGetCachedResult(server, context,
+                               util::string_view(handle).substr(prefix.size()));
+    }
+
+    util::optional<std::string> key;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = pending_statements_.find(handle);
+      if (it != pending_statements_.end()) {
+        key = std::move(it->second);
+        pending_statements_.erase(it);
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto stream, server->DoGetStatement(context, command));
+    if (!key.has_value()) return std::move(stream);
+    return Record(std::move(stream), std::move(*key));
+  }
+
+  arrow::Result<std::unique_ptr<FlightInfo>> GetFlightInfoPreparedStatement(
+      FlightSqlServerBase* server, const ServerCallContext& context,
+      const PreparedStatementQuery& command, const FlightDescriptor& descriptor) {
+    ARROW_ASSIGN_OR_RAISE(auto key, GetPreparedStatementKey(server, context, command));
+    if (key.has_value()) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto info,
+          GetCachedFlightInfo(*key, command.prepared_statement_handle, descriptor));
+      if (info != nullptr) return std::move(info);
+    }
+    return server->GetFlightInfoPreparedStatement(context, command, descriptor);
+  }
+
+  arrow::Result<std::unique_ptr<FlightDataStream>> DoGetPreparedStatement(
+      FlightSqlServerBase* server, const ServerCallContext& context,
+      const PreparedStatementQuery& command) {
+    ARROW_ASSIGN_OR_RAISE(auto key, GetPreparedStatementKey(server, context, command));
+    if (key.has_value()) {
+      ARROW_ASSIGN_OR_RAISE(auto result, cache_->Get(*key));
+      if (result != nullptr) {
+        return std::unique_ptr<FlightDataStream>(
+            new CachedResultStream(std::move(result)));
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto stream, server->DoGetPreparedStatement(context, command));
+    if (!key.has_value()) return std::move(stream);
+    return Record(std::move(stream), std::move(*key));
+  }
+
+  void OnPreparedStatementCreated(const std::string& handle, const std::string& query) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    prepared_statements_[handle] = PreparedStatement{query, ""};
+  }
+
+  void OnPreparedStatementClosed(const std::string& handle) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    prepared_statements_.erase(handle);
+  }
+
+  Status DoPutPreparedStatementQuery(FlightSqlServerBase* server,
+                                     const ServerCallContext& context,
+                                     const PreparedStatementQuery& command,
+                                     FlightMessageReader* reader,
+                                     FlightMetadataWriter* writer) {
+    ParameterRecordingReader recording_reader(reader);
+    RETURN_NOT_OK(
+        server->DoPutPreparedStatementQuery(context, command, &recording_reader, writer));
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = prepared_statements_.find(command.prepared_statement_handle);
+    if (it != prepared_statements_.end()) {
+      it->second.parameters = recording_reader.parameters();
+    }
+    return Status::OK();
+  }
+
+ private:
+  struct PreparedStatement {
+    std::string query;
+    // The IPC bodies of the parameters bound last
+    std::string parameters;
+  };
+
+  // Bound the statement handles remembered if their tickets are never redeemed
+  static constexpr size_t kMaxPendingStatements = 1024;
+
+  // A FlightInfo redeemed by DoGetCachedResult if results are cached
+  arrow::Result<std::unique_ptr<FlightInfo>> GetCachedFlightInfo(
+      const std::string& key, const std::string& prepared_statement_handle,
+      const FlightDescriptor& descriptor) {
+    ARROW_ASSIGN_OR_RAISE(auto result, cache_->Get(key));
+    if (result == nullptr) return nullptr;
+    ARROW_ASSIGN_OR_RAISE(
+        auto ticket,
+        CreateStatementQueryTicket(kCachedResultHandlePrefix +
+                                   EncodeFields({prepared_statement_handle, key})));
+    std::vector<FlightEndpoint> endpoints{FlightEndpoint{{ticket}, {}}};
+    ARROW_ASSIGN_OR_RAISE(auto info, FlightInfo::Make(*result->schema, descriptor,
+                                                      endpoints, -1, result->nbytes()));
+    return std::unique_ptr<FlightInfo>(new FlightInfo(std::move(info)));
+  }
+
+  arrow::Result<std::unique_ptr<FlightDataStream>> DoGetCachedResult(
+      FlightSqlServerBase* server, const ServerCallContext& context,
+      util::string_view encoded) {
+    ARROW_ASSIGN_OR_RAISE(auto fields, DecodeFields(encoded));
+    if (fields.size() != 2) return Status::Invalid("Invalid cached result handle");
+    const auto& prepared_statement_handle = fields[0];
+    const auto& key = fields[1];
+    ARROW_ASSIGN_OR_RAISE(auto result, cache_->Get(key));
+    if (result != nullptr) {
+      return std::unique_ptr<FlightDataStream>(new CachedResultStream(std::move(result)));
+    }
+
+    // Evicted since GetFlightInfo: execute the query again
+    if (!prepared_statement_handle.empty()) {
+      return DoGetPreparedStatement(server, context, {prepared_statement_handle});
+    }
+    ARROW_ASSIGN_OR_RAISE(auto key_fields, DecodeFields(key));
+    if (key_fields.size() != 3) return Status::Invalid("Invalid cached result handle");
+    StatementQuery command{key_fields[0]};
+    pb::sql::CommandStatementQuery pb_command;
+    pb_command.set_query(command.query);
+    google::protobuf::Any any;
+    any.PackFrom(pb_command);
+    const auto descriptor = FlightDescriptor::Command(any.SerializeAsString());
+    ARROW_ASSIGN_OR_RAISE(auto token, server->GetResultCacheToken(context));
+    ARROW_ASSIGN_OR_RAISE(auto info,
+                          server->GetFlightInfoStatement(context, command, descriptor));
+    auto handle = GetSingleStatementHandle(*info);
+    if (!handle.has_value()) {
+      return Status::KeyError("Cached results expired, execute the query again");
+    }
+    ARROW_ASSIGN_OR_RAISE(auto stream, server->DoGetStatement(context, {*handle}));
+    return Record(std::move(stream), MakeResultCacheKey(command.query, "", token));
+  }
+
+  arrow::Result<util::optional<std::string>> GetPreparedStatementKey(
+      FlightSqlServerBase* server, const ServerCallContext& context,
+      const PreparedStatementQuery& command) {
+    PreparedStatement statement;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = prepared_statements_.find(command.prepared_statement_handle);
+      if (it == prepared_statements_.end()) return util::nullopt;
+      statement = it->second;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto token, server->GetResultCacheToken(context));
+    return MakeResultCacheKey(statement.query, statement.parameters, token);
+  }
+
+  std::unique_ptr<FlightDataStream> Record(std::unique_ptr<FlightDataStream> stream,
+                                           std::string key) {
+    return std::unique_ptr<FlightDataStream>(
+        new RecordingStream(std::move(stream), cache_, std::move(key)));
+  }
+
+  const std::shared_ptr<ResultCache> cache_;
+  std::mutex mutex_;
+  std::unordered_map<std::string, PreparedStatement> prepared_statements_;
+  // Keys of the statement handles issued, until their tickets are redeemed
+  std::unordered_map<std::string, std::string> pending_statements_;
+  std::deque<std::string> pending_order_;
+};
+
+constexpr size_t FlightSqlServerBase::ResultCacheLayer::kMaxPendingStatements;
+
+void FlightSqlServerBase::SetResultCache(std::shared_ptr<ResultCache> cache) {
+  result_cache_ =
+      cache == nullptr ? nullptr : std::make_shared<ResultCacheLayer>(std::move(cache));
+}
+
+arrow::Result<std::string> FlightSqlServerBase::GetResultCacheToken(
+    const ServerCallContext& context) {
+  return "";
+}
+
 Status FlightSqlServerBase::GetFlightInfo(const ServerCallContext& context,
                                           const FlightDescriptor& request,
                                           std::unique_ptr<FlightInfo>* info) {
@@ -276,12 +782,22 @@ Status FlightSqlServerBase::GetFlightInfo(const ServerCallContext& context,
   if (any.Is<pb::sql::CommandStatementQuery>()) {
     ARROW_ASSIGN_OR_RAISE(StatementQuery internal_command,
                           ParseCommandStatementQuery(any));
+    if (result_cache_ != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(*info, result_cache_->GetFlightInfoStatement(
+                                       this, context, internal_command, request));
+      return Status::OK();
+    }
     ARROW_ASSIGN_OR_RAISE(*info,
                           GetFlightInfoStatement(context, internal_command, request));
     return Status::OK();
   } else if (any.Is<pb::sql::CommandPreparedStatementQuery>()) {
     ARROW_ASSIGN_OR_RAISE(PreparedStatementQuery internal_command,
                           ParseCommandPreparedStatementQuery(any));
+    if (result_cache_ != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(*info, result_cache_->GetFlightInfoPreparedStatement(
+                                       this, context, internal_command, request));
+      return Status::OK();
+    }
     ARROW_ASSIGN_OR_RAISE(
         *info, GetFlightInfoPreparedStatement(context, internal_command, request));
     return Status::OK();
@@ -352,11 +868,21 @@ Status FlightSqlServerBase::DoGet(const ServerCallContext& context, const Ticket
 
   if (any.Is<pb::sql::TicketStatementQuery>()) {
     ARROW_ASSIGN_OR_RAISE(StatementQueryTicket command, ParseStatementQueryTicket(any));
+    if (result_cache_ != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(*stream,
+                            result_cache_->DoGetStatement(this, context, command));
+      return Status::OK();
+    }
     ARROW_ASSIGN_OR_RAISE(*stream, DoGetStatement(context, command));
     return Status::OK();
   } else if (any.Is<pb::sql::CommandPreparedStatementQuery>()) {
     ARROW_ASSIGN_OR_RAISE(PreparedStatementQuery internal_command,
                           ParseCommandPreparedStatementQuery(any));
+    if (result_cache_ != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(*stream, result_cache_->DoGetPreparedStatement(
+                                         this, context, internal_command));
+      return Status::OK();
+    }
     ARROW_ASSIGN_OR_RAISE(*stream, DoGetPreparedStatement(context, internal_command));
     return Status::OK();
   } else if (any.Is<pb::sql::CommandGetCatalogs>()) {
@@ -433,6 +959,10 @@ Status FlightSqlServerBase::DoPut(const ServerCallContext& context,
   } else if (any.Is<pb::sql::CommandPreparedStatementQuery>()) {
     ARROW_ASSIGN_OR_RAISE(PreparedStatementQuery internal_command,
                           ParseCommandPreparedStatementQuery(any));
+    if (result_cache_ != nullptr) {
+      return result_cache_->DoPutPreparedStatementQuery(
+          this, context, internal_command, reader.get(), writer.get());
+    }
     return DoPutPreparedStatementQuery(context, internal_command, reader.get(),
                                        writer.get());
   } else if (any.Is<pb::sql::CommandPreparedStatementUpdate>()) {
@@ -447,6 +977,19 @@ Status FlightSqlServerBase::DoPut(const ServerCallContext& context,
     const auto buffer = Buffer::FromString(result.SerializeAsString());
     ARROW_RETURN_NOT_OK(writer->WriteMetadata(*buffer));
 
+    return Status::OK();
+  } else if (any.Is<pb::sql::CommandStatementIngest>()) {
+    ARROW_ASSIGN_OR_RAISE(StatementIngest internal_command,
+                          ParseCommandStatementIngest(any));
+    ARROW_ASSIGN_OR_RAISE(auto record_count, DoPutCommandStatementIngest(
+                                                 context, internal_command, reader.get()))
+
+    pb::sql::DoPutUpdateResult result;
+    result.set_record_count(record_count);
+
+    const auto buffer = Buffer::FromString(result.SerializeAsString());
+    ARROW_RETURN_NOT_OK(writer->WriteMetadata(*buffer));
+
     return Status::OK();
   }
 
@@ -473,6 +1016,10 @@ Status FlightSqlServerBase::DoAction(const ServerCallContext& context,
     ARROW_ASSIGN_OR_RAISE(ActionCreatePreparedStatementRequest internal_command,
                           ParseActionCreatePreparedStatementRequest(any_command));
     ARROW_ASSIGN_OR_RAISE(auto result, CreatePreparedStatement(context, internal_command))
+    if (result_cache_ != nullptr) {
+      result_cache_->OnPreparedStatementCreated(result.prepared_statement_handle,
+                                                internal_command.query);
+    }
 
     pb::sql::ActionCreatePreparedStatementResult action_result;
     action_result.set_prepared_statement_handle(result.prepared_statement_handle);
@@ -504,6 +1051,10 @@ Status FlightSqlServerBase::DoAction(const ServerCallContext& context,
                           ParseActionClosePreparedStatementRequest(any));
 
     ARROW_RETURN_NOT_OK(ClosePreparedStatement(context, internal_command));
+    if (result_cache_ != nullptr) {
+      result_cache_->OnPreparedStatementClosed(
+          internal_command.prepared_statement_handle);
+    }
 
     // Need to instantiate a ResultStream, otherwise clients can not wait for completion.
     *result_stream = std::unique_ptr<ResultStream>(new SimpleResultStream({}));
@@ -721,6 +1272,24 @@ arrow::Result<int64_t> FlightSqlServerBase::DoPutCommandStatementUpdate(
   return Status::NotImplemented("DoPutCommandStatementUpdate not implemented");
 }
 
+arrow::Result<int64_t> FlightSqlServerBase::DoPutCommandStatementIngest(
+    const ServerCallContext& context, const StatementIngest& command,
+    FlightMessageReader* reader) {
+  return Status::NotImplemented("DoPutCommandStatementIngest not implemented");
+}
+
+arrow::Result<std::shared_ptr<RecordBatchReader>> MakeIngestReader(
+    FlightMessageReader* reader, int32_t readahead) {
+  if (readahead < 1) {
+    return Status::Invalid("Readahead must be at least 1, got ", readahead);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto schema, reader->GetSchema());
+  auto ingest_reader =
+      std::make_shared<IngestReader>(reader, std::move(schema), readahead);
+  RETURN_NOT_OK(ingest_reader->Start());
+  return ingest_reader;
+}
+
 std::shared_ptr<Schema> SqlSchema::GetCatalogsSchema() {
   return arrow::schema({field("catalog_name", utf8(), false)});
 }
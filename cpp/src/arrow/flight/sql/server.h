@@ -25,6 +25,7 @@
 #include <unordered_map>
 
 #include "arrow/flight/server.h"
+#include "arrow/flight/sql/result_cache.h"
 #include "arrow/flight/sql/server.h"
 #include "arrow/flight/sql/types.h"
 #include "arrow/util/optional.h"
@@ -68,6 +69,16 @@ struct PreparedStatementUpdate {
   std::string prepared_statement_handle;
 };
 
+/// \brief A request to load record batches into a table.
+struct StatementIngest {
+  /// \brief The table to load the record batches into.
+  std::string table;
+  /// \brief The catalog of the table, the default one if unset.
+  util::optional<std::string> catalog;
+  /// \brief The schema of the table, the default one if unset.
+  util::optional<std::string> db_schema;
+};
+
 /// \brief A request to fetch server metadata.
 struct GetSqlInfo {
   /// \brief A list of metadata IDs to fetch.
@@ -169,7 +180,10 @@ arrow::Result<std::string> CreateStatementQueryTicket(
 /// methods declared on this class.
 class ARROW_EXPORT FlightSqlServerBase : public FlightServerBase {
  private:
+  class ResultCacheLayer;
+
   SqlInfoResultMap sql_info_id_to_result_;
+  std::shared_ptr<ResultCacheLayer> result_cache_;
 
  public:
   /// \name Flight SQL methods
@@ -440,6 +454,30 @@ class ARROW_EXPORT FlightSqlServerBase : public FlightServerBase {
       const ServerCallContext& context, const PreparedStatementUpdate& command,
       FlightMessageReader* reader);
 
+  /// \brief Load the uploaded record batches into a table.
+  ///
+  /// The batches should be consumed as they arrive rather than
+  /// collected, e.g. by handing MakeIngestReader(reader) to an Acero
+  /// plan through compute::MakeReaderGenerator.
+  /// \param[in] context  The call context.
+  /// \param[in] command  The StatementIngest object naming the table.
+  /// \param[in] reader   A sequence of uploaded record batches.
+  /// \return             The ingested record count.
+  virtual arrow::Result<int64_t> DoPutCommandStatementIngest(
+      const ServerCallContext& context, const StatementIngest& command,
+      FlightMessageReader* reader);
+
+  /// \brief Get the token under which the results of a call are cached.
+  ///
+  /// Only used when a result cache is set.  Results cached under another
+  /// token are not served: e.g. return a version of the data bumped by
+  /// every update, along with the identity of the user if results depend
+  /// on it.
+  /// \param[in] context  The call context.
+  /// \return             The token, empty by default.
+  virtual arrow::Result<std::string> GetResultCacheToken(
+      const ServerCallContext& context);
+
   /// @}
 
   /// \name Utility methods
@@ -450,6 +488,22 @@ class ARROW_EXPORT FlightSqlServerBase : public FlightServerBase {
   /// \param[in] result the result.
   void RegisterSqlInfo(int32_t id, const SqlInfoResult& result);
 
+  /// \brief Serve the results of queries from a cache.
+  ///
+  /// Results of statements and prepared statements are keyed by the SQL
+  /// text, the parameters bound to the prepared statement, and the token
+  /// returned by GetResultCacheToken().  The IPC messages sent by the
+  /// first DoGet of a query are recorded; later executions are then served
+  /// the recorded messages without calling GetFlightInfoStatement,
+  /// GetFlightInfoPreparedStatement, DoGetStatement or
+  /// DoGetPreparedStatement.
+  ///
+  /// Results with application metadata, or whose FlightInfo has several
+  /// endpoints or locations, are not cached.  Must be called before
+  /// serving.
+  /// \param[in] cache the cache, null to disable caching.
+  void SetResultCache(std::shared_ptr<ResultCache> cache);
+
   /// @}
 
   /// \name Flight RPC handlers
@@ -487,6 +541,22 @@ class ARROW_EXPORT FlightSqlServerBase : public FlightServerBase {
   /// @}
 };
 
+/// \brief Read the record batches uploaded by a DoPut ahead of the consumer.
+///
+/// The batches are received and decoded on the I/O thread pool while the
+/// consumer processes the previous ones; compressed buffers are also
+/// decompressed in parallel.  At most `readahead` decoded batches are
+/// buffered: past that, the reader stops reading, and flow control in
+/// turn slows down the client.
+///
+/// The returned reader must be closed or destroyed before the DoPut
+/// handler returns, as it reads from `reader`.
+/// \param[in] reader     The uploaded record batches.
+/// \param[in] readahead  The maximum number of batches buffered.
+ARROW_EXPORT
+arrow::Result<std::shared_ptr<RecordBatchReader>> MakeIngestReader(
+    FlightMessageReader* reader, int32_t readahead = 8);
+
 /// \brief Auxiliary class containing all Schemas used on Flight SQL.
 class ARROW_EXPORT SqlSchema {
  public:
@@ -23,8 +23,11 @@
 
 #include <sqlite3.h>
 
+#include <atomic>
 #include <condition_variable>
+#include <mutex>
 #include <thread>
+#include <unordered_map>
 
 #include "arrow/flight/api.h"
 #include "arrow/flight/sql/api.h"
@@ -34,8 +37,12 @@
 #include "arrow/flight/sql/example/sqlite_type_info.h"
 #include "arrow/flight/test_util.h"
 #include "arrow/flight/types.h"
+#include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/message.h"
+#include "arrow/ipc/reader.h"
 #include "arrow/testing/builder.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
 
 using ::testing::_;
 using ::testing::Ref;
@@ -801,6 +808,341 @@ TEST_F(TestFlightSqlServer, TestCommandGetSqlInfoNoInfo) {
       sql_client->DoGet(call_options, flight_info->endpoints()[0].ticket));
 }
 
+// Serves the query text, its parameter and the number of the execution
+class CountingSqlServer : public FlightSqlServerBase {
+ public:
+  static std::shared_ptr<Schema> ResultSchema() {
+    return arrow::schema({arrow::field("query", utf8()), arrow::field("run", int64())});
+  }
+
+  arrow::Result<std::unique_ptr<FlightInfo>> GetFlightInfoStatement(
+      const ServerCallContext& context, const StatementQuery& command,
+      const FlightDescriptor& descriptor) override {
+    ARROW_ASSIGN_OR_RAISE(auto ticket, CreateStatementQueryTicket(command.query));
+    return MakeFlightInfo(ticket, descriptor);
+  }
+
+  arrow::Result<std::unique_ptr<FlightDataStream>> DoGetStatement(
+      const ServerCallContext& context, const StatementQueryTicket& command) override {
+    return MakeResults(command.statement_handle);
+  }
+
+  arrow::Result<ActionCreatePreparedStatementResult> CreatePreparedStatement(
+      const ServerCallContext& context,
+      const ActionCreatePreparedStatementRequest& request) override {
+    return ActionCreatePreparedStatementResult{
+        ResultSchema(), arrow::schema({arrow::field("param", utf8())}), request.query};
+  }
+
+  Status ClosePreparedStatement(
+      const ServerCallContext& context,
+      const ActionClosePreparedStatementRequest& request) override {
+    return Status::OK();
+  }
+
+  Status DoPutPreparedStatementQuery(const ServerCallContext& context,
+                                     const PreparedStatementQuery& command,
+                                     FlightMessageReader* reader,
+                                     FlightMetadataWriter* writer) override {
+    ARROW_ASSIGN_OR_RAISE(auto batches, reader->ToRecordBatches());
+    std::lock_guard<std::mutex> lock(mutex_);
+    parameters_[command.prepared_statement_handle] =
+        checked_cast<const StringArray&>(*batches[0]->column(0)).GetString(0);
+    return Status::OK();
+  }
+
+  arrow::Result<std::unique_ptr<FlightInfo>> GetFlightInfoPreparedStatement(
+      const ServerCallContext& context, const PreparedStatementQuery& command,
+      const FlightDescriptor& descriptor) override {
+    return MakeFlightInfo(descriptor.cmd, descriptor);
+  }
+
+  arrow::Result<std::unique_ptr<FlightDataStream>> DoGetPreparedStatement(
+      const ServerCallContext& context, const PreparedStatementQuery& command) override {
+    std::string parameter;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      parameter = parameters_[command.prepared_statement_handle];
+    }
+    return MakeResults(command.prepared_statement_handle + "/" + parameter);
+  }
+
+  arrow::Result<std::string> GetResultCacheToken(
+      const ServerCallContext& context) override {
+    return std::to_string(data_version.load());
+  }
+
+  std::atomic<int64_t> num_runs{0};
+  std::atomic<int> data_version{0};
+
+ private:
+  arrow::Result<std::unique_ptr<FlightInfo>> MakeFlightInfo(
+      const std::string& ticket, const FlightDescriptor& descriptor) {
+    std::vector<FlightEndpoint> endpoints{FlightEndpoint{{ticket}, {}}};
+    ARROW_ASSIGN_OR_RAISE(
+        auto info, FlightInfo::Make(*ResultSchema(), descriptor, endpoints, -1, -1));
+    return std::unique_ptr<FlightInfo>(new FlightInfo(info));
+  }
+
+  arrow::Result<std::unique_ptr<FlightDataStream>> MakeResults(
+      const std::string& query) {
+    const int64_t run = ++num_runs;
+    auto batch = RecordBatchFromJSON(
+        ResultSchema(), "[[\"" + query + "\", " + std::to_string(run) + "]]");
+    ARROW_ASSIGN_OR_RAISE(auto reader, RecordBatchReader::Make({batch}));
+    return std::unique_ptr<FlightDataStream>(new RecordBatchStream(reader));
+  }
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::string> parameters_;
+};
+
+class TestFlightSqlResultCache : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::unique_ptr<FlightServerBase> server;
+    std::unique_ptr<FlightClient> client;
+    ASSERT_OK(MakeServer<CountingSqlServer>(
+        &server, &client, [](FlightServerOptions* options) { return Status::OK(); },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+    server_.reset(checked_cast<CountingSqlServer*>(server.release()));
+    server_->SetResultCache(MakeMemoryResultCache(1 << 20));
+    sql_client_.reset(new FlightSqlClient(std::move(client)));
+  }
+
+  void TearDown() override {
+    ASSERT_OK(sql_client_->Close());
+    ASSERT_OK(server_->Shutdown());
+  }
+
+  // Check the results of a FlightInfo, and the execution they come from
+  void CheckResults(const FlightInfo& info, const std::string& query, int64_t run) {
+    ASSERT_EQ(1U, info.endpoints().size());
+    ASSERT_OK_AND_ASSIGN(auto stream, sql_client_->DoGet({}, info.endpoints()[0].ticket));
+    ASSERT_OK_AND_ASSIGN(auto table, stream->ToTable());
+    auto expected = TableFromJSON(CountingSqlServer::ResultSchema(),
+                                  {"[[\"" + query + "\", " + std::to_string(run) + "]]"});
+    AssertTablesEqual(*expected, *table);
+  }
+
+  void CheckStatement(const std::string& query, int64_t run) {
+    ASSERT_OK_AND_ASSIGN(auto info, sql_client_->Execute({}, query));
+    CheckResults(*info, query, run);
+  }
+
+  std::unique_ptr<CountingSqlServer> server_;
+  std::unique_ptr<FlightSqlClient> sql_client_;
+};
+
+TEST_F(TestFlightSqlResultCache, Statement) {
+  CheckStatement("SELECT 1", 1);
+  CheckStatement("SELECT 1", 1);
+  CheckStatement("SELECT 2", 2);
+  CheckStatement("SELECT 2", 2);
+  ASSERT_EQ(2, server_->num_runs.load());
+
+  // A new token invalidates the results
+  ++server_->data_version;
+  CheckStatement("SELECT 1", 3);
+  CheckStatement("SELECT 1", 3);
+  ASSERT_EQ(3, server_->num_runs.load());
+}
+
+TEST_F(TestFlightSqlResultCache, PreparedStatement) {
+  ASSERT_OK_AND_ASSIGN(auto statement, sql_client_->Prepare({}, "SELECT ?"));
+  auto parameter_schema = arrow::schema({arrow::field("param", utf8())});
+
+  ASSERT_OK(statement->SetParameters(RecordBatchFromJSON(parameter_schema, "[[\"a\"]]")));
+  ASSERT_OK_AND_ASSIGN(auto info, statement->Execute());
+  CheckResults(*info, "SELECT ?/a", 1);
+  ASSERT_OK_AND_ASSIGN(info, statement->Execute());
+  CheckResults(*info, "SELECT ?/a", 1);
+
+  ASSERT_OK(statement->SetParameters(RecordBatchFromJSON(parameter_schema, "[[\"b\"]]")));
+  ASSERT_OK_AND_ASSIGN(info, statement->Execute());
+  CheckResults(*info, "SELECT ?/b", 2);
+  ASSERT_OK_AND_ASSIGN(info, statement->Execute());
+  CheckResults(*info, "SELECT ?/b", 2);
+
+  ASSERT_OK(statement->SetParameters(RecordBatchFromJSON(parameter_schema, "[[\"a\"]]")));
+  ASSERT_OK_AND_ASSIGN(info, statement->Execute());
+  CheckResults(*info, "SELECT ?/a", 1);
+  ASSERT_EQ(2, server_->num_runs.load());
+  ASSERT_OK(statement->Close());
+}
+
+TEST_F(TestFlightSqlResultCache, Evicted) {
+  ASSERT_OK_AND_ASSIGN(auto info, sql_client_->Execute({}, "SELECT 1"));
+  CheckResults(*info, "SELECT 1", 1);
+  // A ticket for cached results
+  ASSERT_OK_AND_ASSIGN(info, sql_client_->Execute({}, "SELECT 1"));
+  server_->SetResultCache(MakeMemoryResultCache(1 << 20));
+  // The query is executed again
+  CheckResults(*info, "SELECT 1", 2);
+  CheckStatement("SELECT 1", 2);
+}
+
+class IngestSqlServer : public FlightSqlServerBase {
+ public:
+  arrow::Result<int64_t> DoPutCommandStatementIngest(
+      const ServerCallContext& context, const StatementIngest& command,
+      FlightMessageReader* reader) override {
+    ARROW_ASSIGN_OR_RAISE(auto ingest_reader, MakeIngestReader(reader, /*readahead=*/2));
+    int64_t num_rows = 0;
+    RecordBatchVector batches;
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(ingest_reader->ReadNext(&batch));
+      if (!batch) break;
+      if (command.table == "error") {
+        // Stop reading while the client is still sending
+        RETURN_NOT_OK(ingest_reader->Close());
+        return Status::Invalid("Cannot ingest into table");
+      }
+      num_rows += batch->num_rows();
+      batches.push_back(std::move(batch));
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    last_command = command;
+    ARROW_ASSIGN_OR_RAISE(last_table,
+                          Table::FromRecordBatches(ingest_reader->schema(), batches));
+    return num_rows;
+  }
+
+  std::mutex mutex_;
+  StatementIngest last_command;
+  std::shared_ptr<Table> last_table;
+};
+
+class TestFlightSqlIngest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::unique_ptr<FlightServerBase> server;
+    std::unique_ptr<FlightClient> client;
+    ASSERT_OK(MakeServer<IngestSqlServer>(
+        &server, &client, [](FlightServerOptions* options) { return Status::OK(); },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+    server_.reset(checked_cast<IngestSqlServer*>(server.release()));
+    sql_client_.reset(new FlightSqlClient(std::move(client)));
+  }
+
+  void TearDown() override {
+    ASSERT_OK(sql_client_->Close());
+    ASSERT_OK(server_->Shutdown());
+  }
+
+  std::shared_ptr<RecordBatchReader> MakeBatches(int num_batches) {
+    auto schema = arrow::schema({arrow::field("id", int64()), arrow::field("s", utf8())});
+    RecordBatchVector batches;
+    for (int i = 0; i < num_batches; i++) {
+      batches.push_back(RecordBatchFromJSON(
+          schema, "[[" + std::to_string(i) + ", \"a\"], [null, \"b\"]]"));
+    }
+    expected_ = *Table::FromRecordBatches(schema, batches);
+    return *RecordBatchReader::Make(batches, schema);
+  }
+
+  std::unique_ptr<IngestSqlServer> server_;
+  std::unique_ptr<FlightSqlClient> sql_client_;
+  std::shared_ptr<Table> expected_;
+};
+
+TEST_F(TestFlightSqlIngest, Ingest) {
+  auto reader = MakeBatches(16);
+  const std::string catalog = "main";
+  ASSERT_OK_AND_EQ(32, sql_client_->ExecuteIngest({}, reader.get(), "target", &catalog));
+  ASSERT_EQ("target", server_->last_command.table);
+  ASSERT_EQ(catalog, server_->last_command.catalog.value_or(""));
+  ASSERT_FALSE(server_->last_command.db_schema.has_value());
+  AssertTablesEqual(*expected_, *server_->last_table);
+
+  // An empty upload
+  reader = MakeBatches(0);
+  ASSERT_OK_AND_EQ(0, sql_client_->ExecuteIngest({}, reader.get(), "target"));
+  ASSERT_EQ(0, server_->last_table->num_rows());
+}
+
+TEST_F(TestFlightSqlIngest, ServerError) {
+  auto reader = MakeBatches(64);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("Cannot ingest"),
+                                  sql_client_->ExecuteIngest({}, reader.get(), "error"));
+  // The server is still usable
+  reader = MakeBatches(1);
+  ASSERT_OK_AND_EQ(2, sql_client_->ExecuteIngest({}, reader.get(), "target"));
+}
+
+TEST_F(TestFlightSqlIngest, NotImplemented) {
+  std::unique_ptr<FlightServerBase> server;
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(MakeServer<FlightSqlServerBase>(
+      &server, &client, [](FlightServerOptions* options) { return Status::OK(); },
+      [](FlightClientOptions* options) { return Status::OK(); }));
+  FlightSqlClient sql_client(std::move(client));
+  auto reader = MakeBatches(1);
+  ASSERT_RAISES(NotImplemented, sql_client.ExecuteIngest({}, reader.get(), "target"));
+  ASSERT_OK(sql_client.Close());
+  ASSERT_OK(server->Shutdown());
+}
+
+TEST(ResultCache, MemoryEviction) {
+  auto batch = RecordBatchFromJSON(CountingSqlServer::ResultSchema(), "[[\"a\", 1]]");
+  auto result = std::make_shared<CachedResult>();
+  result->schema = batch->schema();
+  ipc::IpcPayload payload;
+  ASSERT_OK(ipc::GetRecordBatchPayload(*batch, ipc::IpcWriteOptions::Defaults(),
+                                       &payload));
+  result->payloads.push_back(payload);
+  const int64_t nbytes = result->nbytes();
+
+  auto cache = MakeMemoryResultCache(2 * nbytes);
+  ASSERT_OK(cache->Put("a", result));
+  ASSERT_OK(cache->Put("b", result));
+  ASSERT_OK_AND_EQ(result, cache->Get("a"));
+  // "b" is the least recently used
+  ASSERT_OK(cache->Put("c", result));
+  ASSERT_OK_AND_EQ(nullptr, cache->Get("b"));
+  ASSERT_OK_AND_EQ(result, cache->Get("a"));
+  ASSERT_OK_AND_EQ(result, cache->Get("c"));
+}
+
+TEST(ResultCache, File) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir,
+                       ::arrow::internal::TemporaryDir::Make("flight-sql-result-cache-"));
+  auto cache = MakeFileResultCache(temp_dir->path().ToString());
+
+  auto batch = RecordBatchFromJSON(CountingSqlServer::ResultSchema(),
+                                   "[[\"a\", 1], [\"b\", 2], [null, 3]]");
+  auto result = std::make_shared<CachedResult>();
+  result->schema = batch->schema();
+  ipc::DictionaryFieldMapper mapper(*batch->schema());
+  ipc::IpcPayload payload;
+  ASSERT_OK(ipc::GetSchemaPayload(*batch->schema(), ipc::IpcWriteOptions::Defaults(),
+                                  mapper, &payload));
+  result->payloads.push_back(payload);
+  ASSERT_OK(ipc::GetRecordBatchPayload(*batch, ipc::IpcWriteOptions::Defaults(),
+                                       &payload));
+  result->payloads.push_back(payload);
+
+  ASSERT_OK_AND_EQ(nullptr, cache->Get("key"));
+  ASSERT_OK(cache->Put("key", result));
+  ASSERT_OK_AND_EQ(nullptr, cache->Get("other key"));
+  ASSERT_OK_AND_ASSIGN(auto cached, cache->Get("key"));
+  ASSERT_NE(nullptr, cached);
+  AssertSchemaEqual(*batch->schema(), *cached->schema);
+  ASSERT_EQ(2U, cached->payloads.size());
+
+  // The cached messages decode to the original batch
+  ASSERT_OK_AND_ASSIGN(
+      auto message, ipc::Message::Open(cached->payloads[1].metadata,
+                                       cached->payloads[1].body_buffers[0]));
+  ipc::DictionaryMemo memo;
+  ASSERT_OK_AND_ASSIGN(
+      auto read_batch,
+      ipc::ReadRecordBatch(*message, batch->schema(), &memo,
+                           ipc::IpcReadOptions::Defaults()));
+  AssertBatchesEqual(*batch, *read_batch);
+}
+
 }  // namespace sql
 }  // namespace flight
 }  // namespace arrow
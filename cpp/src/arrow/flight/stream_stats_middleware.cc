@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/stream_stats_middleware.h"
+
+#include <utility>
+
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace flight {
+
+namespace {
+
+class ServerStreamStatsMiddlewareFactory : public ServerMiddlewareFactory {
+ public:
+  explicit ServerStreamStatsMiddlewareFactory(StreamStatsCallback callback)
+      : callback_(std::move(callback)) {}
+
+  Status StartCall(const CallInfo& info, const CallHeaders& incoming_headers,
+                   std::shared_ptr<ServerMiddleware>* middleware) override {
+    switch (info.method) {
+      case FlightMethod::DoGet:
+      case FlightMethod::DoPut:
+      case FlightMethod::DoExchange:
+        *middleware = std::make_shared<ServerStreamStatsMiddleware>(info, callback_);
+        break;
+      default:
+        break;
+    }
+    return Status::OK();
+  }
+
+ private:
+  StreamStatsCallback callback_;
+};
+
+}  // namespace
+
+constexpr char const ServerStreamStatsMiddleware::kMiddlewareName[];
+
+ServerStreamStatsMiddleware::ServerStreamStatsMiddleware(CallInfo info,
+                                                         StreamStatsCallback callback)
+    : info_(info), callback_(std::move(callback)) {}
+
+void ServerStreamStatsMiddleware::StreamsCompleted(const FlightStreamStats& read,
+                                                   const FlightStreamStats& written,
+                                                   const Status& status) const {
+  if (!callback_) return;
+  CallStreamStats stats;
+  stats.info = info_;
+  stats.read = read;
+  stats.written = written;
+  stats.status = status;
+  callback_(stats);
+}
+
+std::shared_ptr<ServerMiddlewareFactory> GetServerStreamStatsFactory(
+    StreamStatsCallback callback) {
+  return std::make_shared<ServerStreamStatsMiddlewareFactory>(std::move(callback));
+}
+
+namespace internal {
+
+void ReportStreamStats(const ServerCallContext& context, const FlightStreamStats& read,
+                       const FlightStreamStats& written, const Status& status) {
+  auto middleware = context.GetMiddleware(kStreamStatsMiddlewareKey);
+  if (middleware == nullptr ||
+      middleware->name() != ServerStreamStatsMiddleware::kMiddlewareName) {
+    return;
+  }
+  ::arrow::internal::checked_cast<const ServerStreamStatsMiddleware*>(middleware)
+      ->StreamsCompleted(read, written, status);
+}
+
+}  // namespace internal
+
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Middleware exporting the statistics of the data streams of a server's
+// calls. API should be considered experimental for now.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "arrow/flight/server.h"
+#include "arrow/flight/server_middleware.h"
+#include "arrow/flight/types.h"
+#include "arrow/flight/visibility.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace flight {
+
+/// \brief The default key of the server stream statistics middleware.
+constexpr char kStreamStatsMiddlewareKey[] = "arrow-flight-stream-stats";
+
+/// \brief The statistics of the data streams of a completed call.
+struct ARROW_FLIGHT_EXPORT CallStreamStats {
+  /// \brief The call, one of DoGet, DoPut or DoExchange.
+  CallInfo info;
+  /// \brief The stream read from the client (DoPut, DoExchange).
+  FlightStreamStats read;
+  /// \brief The stream written to the client (DoGet, DoExchange).
+  FlightStreamStats written;
+  /// \brief The status the server returned.
+  Status status;
+};
+
+/// \brief Called once per call, from the thread of the call.
+using StreamStatsCallback = std::function<void(const CallStreamStats&)>;
+
+/// \brief The server side of the stream statistics of a call.
+class ARROW_FLIGHT_EXPORT ServerStreamStatsMiddleware : public ServerMiddleware {
+ public:
+  static constexpr char const kMiddlewareName[] = "arrow::flight::ServerStreamStats";
+
+  ServerStreamStatsMiddleware(CallInfo info, StreamStatsCallback callback);
+
+  std::string name() const override { return kMiddlewareName; }
+  void SendingHeaders(AddCallHeaders* outgoing_headers) override {}
+  void CallCompleted(const Status& status) override {}
+
+  /// \brief Pass the statistics of the call's streams to the callback.
+  ///
+  /// Called by the transports once the server is done with the streams.
+  void StreamsCompleted(const FlightStreamStats& read, const FlightStreamStats& written,
+                        const Status& status) const;
+
+ private:
+  CallInfo info_;
+  StreamStatsCallback callback_;
+};
+
+/// \brief Returns a ServerMiddlewareFactory reporting the statistics of
+///     the data streams of each DoGet, DoPut and DoExchange call.
+///
+/// Register it under kStreamStatsMiddlewareKey: the transports find it
+/// by that key.  The callback may be called concurrently for different
+/// calls.
+ARROW_FLIGHT_EXPORT std::shared_ptr<ServerMiddlewareFactory>
+GetServerStreamStatsFactory(StreamStatsCallback callback);
+
+namespace internal {
+
+/// \brief Report the statistics of a call's streams to its middleware,
+///   if registered.
+ARROW_FLIGHT_EXPORT
+void ReportStreamStats(const ServerCallContext& context, const FlightStreamStats& read,
+                       const FlightStreamStats& written, const Status& status);
+
+}  // namespace internal
+
+}  // namespace flight
+}  // namespace arrow
@@ -790,6 +790,7 @@ void DoPutTest::TestSizeLimit() {
   ASSERT_NE(nullptr, detail);
   ASSERT_EQ(size_limit, detail->limit());
   ASSERT_GT(detail->actual(), size_limit);
+  ASSERT_EQ(1, writer->stream_stats().num_oversized_writes);
 
   // But we can retry with smaller batches
   ASSERT_OK(writer->WriteRecordBatch(*batch1));
@@ -515,6 +515,8 @@ arrow::Result<FlightPayload> NumberingStream::Next() {
   return payload;
 }
 
+Status NumberingStream::Close() { return stream_->Close(); }
+
 std::shared_ptr<Schema> ExampleIntSchema() {
   auto f0 = field("f0", int8());
   auto f1 = field("f1", uint8());
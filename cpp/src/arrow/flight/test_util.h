@@ -145,6 +145,7 @@ class ARROW_FLIGHT_EXPORT NumberingStream : public FlightDataStream {
   std::shared_ptr<Schema> schema() override;
   arrow::Result<FlightPayload> GetSchemaPayload() override;
   arrow::Result<FlightPayload> Next() override;
+  Status Close() override;
 
  private:
   int counter_;
@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/flight/platform.h"
@@ -173,48 +174,41 @@ arrow::Result<::grpc::Slice> SliceFromBuffer(const std::shared_ptr<Buffer>& buf)
 
 static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
 
-// Update the sizes of our Protobuf fields based on the given IPC payload.
-::grpc::Status IpcMessageHeaderSize(const arrow::ipc::IpcPayload& ipc_msg, bool has_body,
-                                    size_t* header_size, int32_t* metadata_size) {
-  DCHECK_LE(ipc_msg.metadata->size(), kInt32Max);
-  *metadata_size = static_cast<int32_t>(ipc_msg.metadata->size());
+// Length-delimited fields at least this large are sent from their own slice,
+// referencing the Arrow buffer, rather than copied into the header slice
+static constexpr int64_t kMinZeroCopyFieldSize = 1024;
 
-  // 1 byte for metadata tag
-  *header_size += 1 + WireFormatLite::LengthDelimitedSize(*metadata_size);
+static bool IsZeroCopyField(const Buffer& data) {
+  return data.size() >= kMinZeroCopyFieldSize;
+}
 
-  // 2 bytes for body tag
-  if (has_body) {
-    // We write the body tag in the header but not the actual body data
-    *header_size += 2 + WireFormatLite::LengthDelimitedSize(ipc_msg.body_length) -
-                    ipc_msg.body_length;
+// Size of a length-delimited field in the header slice
+static size_t FieldHeaderSize(const Buffer& data) {
+  DCHECK_LE(data.size(), kInt32Max);
+  size_t size = 1 + WireFormatLite::LengthDelimitedSize(static_cast<size_t>(data.size()));
+  if (IsZeroCopyField(data)) {
+    size -= static_cast<size_t>(data.size());
   }
-
-  return ::grpc::Status::OK;
+  return size;
 }
 
 ::grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
                                    bool* own_buffer) {
   // Size of the IPC body (protobuf: data_body)
   size_t body_size = 0;
-  // Size of the Protobuf "header" (everything except for the body)
+  // Size of the Protobuf "header" (everything except for the body and the
+  // zero-copy fields)
   size_t header_size = 0;
-  // Size of IPC header metadata (protobuf: data_header)
-  int32_t metadata_size = 0;
 
   // Write the descriptor if present
-  int32_t descriptor_size = 0;
   if (msg.descriptor != nullptr) {
-    DCHECK_LE(msg.descriptor->size(), kInt32Max);
-    descriptor_size = static_cast<int32_t>(msg.descriptor->size());
-    header_size += 1 + WireFormatLite::LengthDelimitedSize(descriptor_size);
+    header_size += FieldHeaderSize(*msg.descriptor);
   }
 
   // App metadata tag if appropriate
-  int32_t app_metadata_size = 0;
-  if (msg.app_metadata && msg.app_metadata->size() > 0) {
-    DCHECK_LE(msg.app_metadata->size(), kInt32Max);
-    app_metadata_size = static_cast<int32_t>(msg.app_metadata->size());
-    header_size += 1 + WireFormatLite::LengthDelimitedSize(app_metadata_size);
+  const bool has_app_metadata = msg.app_metadata && msg.app_metadata->size() > 0;
+  if (has_app_metadata) {
+    header_size += FieldHeaderSize(*msg.app_metadata);
   }
 
   const arrow::ipc::IpcPayload& ipc_msg = msg.ipc_message;
@@ -224,51 +218,55 @@ static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
 
   if (has_ipc) {
     DCHECK(has_body || ipc_msg.body_length == 0);
-    GRPC_RETURN_NOT_GRPC_OK(
-        IpcMessageHeaderSize(ipc_msg, has_body, &header_size, &metadata_size));
+    header_size += FieldHeaderSize(*ipc_msg.metadata);
     body_size = static_cast<size_t>(ipc_msg.body_length);
+    if (has_body) {
+      // 2 bytes for body tag. We write the body tag in the header but not the
+      // actual body data
+      header_size += 2 + WireFormatLite::LengthDelimitedSize(body_size) - body_size;
+    }
   }
 
   // TODO(wesm): messages over 2GB unlikely to be yet supported
   // Validated in WritePayload since returning error here causes gRPC to fail an assertion
   DCHECK_LE(body_size, kInt32Max);
 
-  // Allocate and initialize slices
-  std::vector<::grpc::Slice> slices;
-  slices.emplace_back(header_size);
+  ::grpc::Slice header(header_size);
+  // The zero-copy fields, with the header offset they follow
+  std::vector<std::pair<size_t, std::shared_ptr<Buffer>>> zero_copy_fields;
 
   // Force the header_stream to be destructed, which actually flushes
   // the data into the slice.
   {
-    ArrayOutputStream header_writer(const_cast<uint8_t*>(slices[0].begin()),
-                                    static_cast<int>(slices[0].size()));
+    ArrayOutputStream header_writer(const_cast<uint8_t*>(header.begin()),
+                                    static_cast<int>(header.size()));
     CodedOutputStream header_stream(&header_writer);
 
+    auto write_field = [&](int field_number, const std::shared_ptr<Buffer>& data) {
+      WireFormatLite::WriteTag(field_number, WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+                               &header_stream);
+      header_stream.WriteVarint32(static_cast<uint32_t>(data->size()));
+      if (IsZeroCopyField(*data)) {
+        zero_copy_fields.emplace_back(static_cast<size_t>(header_stream.ByteCount()),
+                                      data);
+      } else {
+        header_stream.WriteRawMaybeAliased(data->data(), static_cast<int>(data->size()));
+      }
+    };
+
     // Write descriptor
     if (msg.descriptor != nullptr) {
-      WireFormatLite::WriteTag(pb::FlightData::kFlightDescriptorFieldNumber,
-                               WireFormatLite::WIRETYPE_LENGTH_DELIMITED, &header_stream);
-      header_stream.WriteVarint32(descriptor_size);
-      header_stream.WriteRawMaybeAliased(msg.descriptor->data(),
-                                         static_cast<int>(msg.descriptor->size()));
+      write_field(pb::FlightData::kFlightDescriptorFieldNumber, msg.descriptor);
     }
 
     // Write header
     if (has_ipc) {
-      WireFormatLite::WriteTag(pb::FlightData::kDataHeaderFieldNumber,
-                               WireFormatLite::WIRETYPE_LENGTH_DELIMITED, &header_stream);
-      header_stream.WriteVarint32(metadata_size);
-      header_stream.WriteRawMaybeAliased(ipc_msg.metadata->data(),
-                                         static_cast<int>(ipc_msg.metadata->size()));
+      write_field(pb::FlightData::kDataHeaderFieldNumber, ipc_msg.metadata);
     }
 
     // Write app metadata
-    if (app_metadata_size > 0) {
-      WireFormatLite::WriteTag(pb::FlightData::kAppMetadataFieldNumber,
-                               WireFormatLite::WIRETYPE_LENGTH_DELIMITED, &header_stream);
-      header_stream.WriteVarint32(app_metadata_size);
-      header_stream.WriteRawMaybeAliased(msg.app_metadata->data(),
-                                         static_cast<int>(msg.app_metadata->size()));
+    if (has_app_metadata) {
+      write_field(pb::FlightData::kAppMetadataFieldNumber, msg.app_metadata);
     }
 
     if (has_body) {
@@ -276,31 +274,53 @@ static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
       WireFormatLite::WriteTag(pb::FlightData::kDataBodyFieldNumber,
                                WireFormatLite::WIRETYPE_LENGTH_DELIMITED, &header_stream);
       header_stream.WriteVarint32(static_cast<uint32_t>(body_size));
+    }
 
-      // Enqueue body buffers for writing, without copying
-      for (const auto& buffer : ipc_msg.body_buffers) {
-        // Buffer may be null when the row length is zero, or when all
-        // entries are invalid.
-        if (!buffer) continue;
-
-        ::grpc::Slice slice;
-        auto status = SliceFromBuffer(buffer).Value(&slice);
-        if (ARROW_PREDICT_FALSE(!status.ok())) {
-          // This will likely lead to abort as gRPC cannot recover from an error here
-          return ToGrpcStatus(status);
-        }
-        slices.push_back(std::move(slice));
+    DCHECK_EQ(static_cast<int>(header_size), header_stream.ByteCount());
+  }
 
-        // Write padding if not multiple of 8
-        const auto remainder = static_cast<int>(
-            bit_util::RoundUpToMultipleOf8(buffer->size()) - buffer->size());
-        if (remainder) {
-          slices.push_back(::grpc::Slice(kPaddingBytes, remainder));
-        }
-      }
+  // Interleave the header pieces with the zero-copy fields
+  std::vector<::grpc::Slice> slices;
+  size_t header_offset = 0;
+  for (const auto& field : zero_copy_fields) {
+    slices.push_back(header.sub(header_offset, field.first));
+    header_offset = field.first;
+    ::grpc::Slice slice;
+    auto status = SliceFromBuffer(field.second).Value(&slice);
+    if (ARROW_PREDICT_FALSE(!status.ok())) {
+      return ToGrpcStatus(status);
     }
+    slices.push_back(std::move(slice));
+  }
+  if (header_offset == 0) {
+    slices.push_back(std::move(header));
+  } else if (header_offset < header_size) {
+    slices.push_back(header.sub(header_offset, header_size));
+  }
 
-    DCHECK_EQ(static_cast<int>(header_size), header_stream.ByteCount());
+  if (has_body) {
+    // Enqueue body buffers for writing, without copying
+    for (const auto& buffer : ipc_msg.body_buffers) {
+      // Buffer may be null when the row length is zero, or when all
+      // entries are invalid.
+      if (!buffer) continue;
+
+      ::grpc::Slice slice;
+      auto status = SliceFromBuffer(buffer).Value(&slice);
+      if (ARROW_PREDICT_FALSE(!status.ok())) {
+        // This will likely lead to abort as gRPC cannot recover from an error here
+        return ToGrpcStatus(status);
+      }
+      slices.push_back(std::move(slice));
+
+      // Write padding if not multiple of 8, referencing static memory
+      const auto remainder = static_cast<int>(
+          bit_util::RoundUpToMultipleOf8(buffer->size()) - buffer->size());
+      if (remainder) {
+        slices.push_back(::grpc::Slice(kPaddingBytes, static_cast<size_t>(remainder),
+                                       ::grpc::Slice::STATIC_SLICE));
+      }
+    }
   }
 
   // Hand off the slices to the returned ByteBuffer
@@ -0,0 +1,273 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "arrow/flight/client.h"
+#include "arrow/flight/server.h"
+#include "arrow/flight/test_util.h"
+#include "arrow/flight/transport/shm/shm.h"
+#include "arrow/flight/transport/shm/shm_internal.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/byte_size.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace flight {
+
+class ShmEnvironment : public ::testing::Environment {
+ public:
+  void SetUp() override { transport::shm::InitializeFlightShm(); }
+};
+
+testing::Environment* const kShmEnvironment =
+    testing::AddGlobalTestEnvironment(new ShmEnvironment());
+
+//------------------------------------------------------------
+// Shared memory internals tests
+
+namespace transport {
+namespace shm {
+
+TEST(Ring, ReserveAndRelease) {
+  ASSERT_OK_AND_ASSIGN(auto writer, RingWriter::Make(1024));
+  ASSERT_EQ(writer->capacity(), 1024);
+  ASSERT_OK_AND_ASSIGN(auto reader, RingReader::Map(writer->fd(), writer->capacity()));
+
+  uint64_t start, end;
+  ASSERT_TRUE(writer->Reserve(600, &start, &end));
+  ASSERT_EQ(start, 0U);
+  ASSERT_EQ(end, 640U);
+  std::memset(writer->data_at(start), 0x42, 600);
+
+  // Full until the reader releases the first body
+  uint64_t start2, end2;
+  ASSERT_FALSE(writer->Reserve(600, &start2, &end2));
+  ASSERT_FALSE(writer->Reserve(2048, &start2, &end2));
+
+  {
+    ASSERT_OK_AND_ASSIGN(auto body, reader->Get(start, 600, end));
+    ASSERT_EQ(body->size(), 600);
+    ASSERT_EQ(body->data()[0], 0x42);
+    ASSERT_EQ(body->data()[599], 0x42);
+  }
+
+  // The second body skips the end of the ring instead of wrapping
+  ASSERT_TRUE(writer->Reserve(600, &start2, &end2));
+  ASSERT_EQ(start2, 1024U);
+  ASSERT_EQ(end2, 1664U);
+  ASSERT_EQ(writer->data_at(start2), writer->data_at(0));
+}
+
+TEST(Ring, ReleaseInOrder) {
+  ASSERT_OK_AND_ASSIGN(auto writer, RingWriter::Make(1024));
+  ASSERT_OK_AND_ASSIGN(auto reader, RingReader::Map(writer->fd(), writer->capacity()));
+
+  uint64_t start1, end1, start2, end2, start3, end3;
+  ASSERT_TRUE(writer->Reserve(512, &start1, &end1));
+  ASSERT_TRUE(writer->Reserve(512, &start2, &end2));
+  ASSERT_OK_AND_ASSIGN(auto body1, reader->Get(start1, 512, end1));
+  ASSERT_OK_AND_ASSIGN(auto body2, reader->Get(start2, 512, end2));
+
+  // Releasing the newest body first does not free any space
+  body2.reset();
+  ASSERT_FALSE(writer->Reserve(512, &start3, &end3));
+  body1.reset();
+  ASSERT_TRUE(writer->Reserve(1024, &start3, &end3));
+}
+
+TEST(Ring, InvalidBody) {
+  ASSERT_OK_AND_ASSIGN(auto writer, RingWriter::Make(1024));
+  ASSERT_OK_AND_ASSIGN(auto reader, RingReader::Map(writer->fd(), writer->capacity()));
+  ASSERT_RAISES(IOError, reader->Get(0, 2048, 2048));
+  ASSERT_RAISES(IOError, reader->Get(0, 128, 64));
+  ASSERT_RAISES(IOError, reader->Get(960, 128, 1088));
+  ASSERT_RAISES(IOError, RingReader::Map(writer->fd(), 4096));
+}
+
+TEST(Headers, RoundTrip) {
+  ASSERT_OK_AND_ASSIGN(auto buffer,
+                       Headers::Make(Status::Invalid("Sentinel"), {{"x-foo", "bar"}}));
+  ASSERT_OK_AND_ASSIGN(auto headers, Headers::Parse(buffer));
+  ASSERT_OK_AND_ASSIGN(auto foo, headers.Get("x-foo"));
+  ASSERT_EQ(foo, "bar");
+  ASSERT_RAISES(KeyError, headers.Get("x-missing"));
+  Status status;
+  ASSERT_OK(headers.GetStatus(&status));
+  ASSERT_TRUE(status.IsInvalid());
+  ASSERT_THAT(status.message(), ::testing::HasSubstr("Sentinel"));
+
+  ASSERT_RAISES(Invalid, Headers::Parse(SliceBuffer(buffer, 0, 3)));
+}
+
+}  // namespace shm
+}  // namespace transport
+
+//------------------------------------------------------------
+// End-to-end tests
+
+class TestShm : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_, arrow::internal::TemporaryDir::Make("flight-shm-"));
+    path_ = temp_dir_->path().ToString() + "flight.sock";
+    ASSERT_OK(StartServer(""));
+    ASSERT_OK(Connect(""));
+  }
+
+  void TearDown() override {
+    if (client_) ASSERT_OK(client_->Close());
+    ASSERT_OK(StopServer());
+  }
+
+  // The query of each side's location sets the ring of that side
+  Status StartServer(const std::string& query) {
+    ARROW_ASSIGN_OR_RAISE(auto location, Location::Parse("shm://" + path_ + query));
+    server_ = ExampleTestServer();
+    return server_->Init(FlightServerOptions(location));
+  }
+
+  Status StopServer() {
+    if (!server_) return Status::OK();
+    RETURN_NOT_OK(server_->Shutdown());
+    RETURN_NOT_OK(server_->Wait());
+    server_.reset();
+    return Status::OK();
+  }
+
+  Status Connect(const std::string& query) {
+    if (client_) RETURN_NOT_OK(client_->Close());
+    ARROW_ASSIGN_OR_RAISE(auto location, Location::Parse("shm://" + path_ + query));
+    return FlightClient::Connect(location).Value(&client_);
+  }
+
+  void CheckDoGet(const std::string& ticket, MemoryPool* pool) {
+    FlightCallOptions options;
+    options.read_options.memory_pool = pool;
+    ASSERT_OK_AND_ASSIGN(auto stream, client_->DoGet(options, Ticket{ticket}));
+    ASSERT_OK_AND_ASSIGN(table_, stream->ToTable());
+    ASSERT_OK(table_->ValidateFull());
+
+    RecordBatchVector expected;
+    ASSERT_OK(ExampleLargeBatches(&expected));
+    ASSERT_OK_AND_ASSIGN(auto expected_table, Table::FromRecordBatches(expected));
+    AssertTablesEqual(*expected_table, *table_);
+  }
+
+ protected:
+  std::unique_ptr<arrow::internal::TemporaryDir> temp_dir_;
+  std::string path_;
+  std::unique_ptr<FlightServerBase> server_;
+  std::unique_ptr<FlightClient> client_;
+  std::shared_ptr<Table> table_;
+};
+
+TEST_F(TestShm, GetFlightInfo) {
+  auto descr = FlightDescriptor::Path({"examples", "ints"});
+  ASSERT_OK_AND_ASSIGN(auto info, client_->GetFlightInfo(descr));
+  ASSERT_EQ(info->descriptor(), descr);
+  ASSERT_EQ(info->endpoints().size(), 2U);
+
+  // Errors keep their status code
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      OutOfMemory, ::testing::HasSubstr("Sentinel"),
+      client_->GetFlightInfo(FlightDescriptor::Command("status-outofmemory")));
+  // The connection is still usable
+  ASSERT_OK_AND_ASSIGN(info, client_->GetFlightInfo(descr));
+}
+
+TEST_F(TestShm, DoGetZeroCopy) {
+  ProxyMemoryPool pool(default_memory_pool());
+  CheckDoGet("ticket-large-batch-1", &pool);
+  // The bodies point into the ring rather than the read pool
+  ASSERT_LT(pool.bytes_allocated(), util::TotalBufferSize(*table_));
+  table_.reset();
+
+  // Released bodies free up the ring for later calls
+  for (int i = 0; i < 3; i++) {
+    CheckDoGet("ticket-large-batch-1", &pool);
+    table_.reset();
+  }
+}
+
+TEST_F(TestShm, DoGetInline) {
+  ASSERT_OK(StopServer());
+  ASSERT_OK(StartServer("?ring_capacity=0"));
+  ASSERT_OK(Connect(""));
+  ProxyMemoryPool pool(default_memory_pool());
+  CheckDoGet("ticket-large-batch-1", &pool);
+  ASSERT_GE(pool.bytes_allocated(), util::TotalBufferSize(*table_));
+}
+
+TEST_F(TestShm, DoGetRingFull) {
+  // Bodies larger than the ring, or not fitting in it while the
+  // client holds on to earlier batches, are sent inline
+  ASSERT_OK(StopServer());
+  ASSERT_OK(StartServer("?ring_capacity=65536"));
+  ASSERT_OK(Connect(""));
+  CheckDoGet("ticket-large-batch-1", default_memory_pool());
+  CheckDoGet("ticket-large-batch-1", default_memory_pool());
+}
+
+TEST_F(TestShm, DoGetError) {
+  ASSERT_OK_AND_ASSIGN(auto stream, client_->DoGet(Ticket{"ARROW-5095-fail"}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(UnknownError, ::testing::HasSubstr("Server-side error"),
+                                  stream->ToTable());
+}
+
+TEST_F(TestShm, DoPut) {
+  RecordBatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  auto descr = FlightDescriptor::Path({"ints"});
+  // Through the client's ring, then inline
+  for (const std::string query : {"", "?ring_capacity=0"}) {
+    ASSERT_OK(Connect(query));
+    ASSERT_OK_AND_ASSIGN(auto result, client_->DoPut(descr, batches[0]->schema()));
+    for (const auto& batch : batches) {
+      ASSERT_OK(result.writer->WriteRecordBatch(*batch));
+    }
+    ASSERT_OK(result.writer->DoneWriting());
+    ASSERT_OK(result.writer->Close());
+  }
+}
+
+TEST_F(TestShm, DoExchange) {
+  RecordBatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  auto descr = FlightDescriptor::Command("get");
+  ASSERT_OK_AND_ASSIGN(auto result, client_->DoExchange(descr));
+  ASSERT_OK(result.writer->DoneWriting());
+  ASSERT_OK_AND_ASSIGN(auto table, result.reader->ToTable());
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches(batches));
+  AssertTablesEqual(*expected, *table);
+  ASSERT_OK(result.writer->Close());
+
+  ASSERT_OK_AND_ASSIGN(result, client_->DoExchange(FlightDescriptor::Command("error")));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented, ::testing::HasSubstr("Expected error"),
+                                  result.writer->Close());
+}
+
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,44 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Experimental shared-memory transport for Flight, for clients and
+// servers running on the same host.
+//
+// Locations take the form shm:///path/to/socket: calls are made over
+// the Unix socket at that path, and the bodies of the IPC messages are
+// placed in rings of shared memory, which the receiver reads without
+// copying. The capacity of the ring of each side of a connection can
+// be set with the ring_capacity query parameter (in bytes; 0 sends all
+// bodies over the socket). Only GetFlightInfo, DoGet, DoPut and
+// DoExchange are supported.
+
+#pragma once
+
+#include "arrow/flight/visibility.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace shm {
+
+ARROW_FLIGHT_EXPORT
+void InitializeFlightShm();
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
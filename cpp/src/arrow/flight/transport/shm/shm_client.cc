@@ -0,0 +1,305 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+/// The client-side implementation of a shared-memory transport for
+/// Flight.
+///
+/// As with the UCX transport, each connection supports one call at a
+/// time, so the client opens a connection per concurrent call and
+/// keeps a few idle ones for the following calls. Connecting is cheap
+/// (a Unix socket), but each connection maps its own pair of rings.
+
+#include "arrow/flight/transport/shm/shm_internal.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/client.h"
+#include "arrow/flight/transport.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/uri.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace shm {
+
+namespace {
+class ShmClientImpl;
+
+Status MergeStatuses(Status server_status, Status transport_status) {
+  if (server_status.ok()) {
+    if (transport_status.ok()) return server_status;
+    return transport_status;
+  } else if (transport_status.ok()) {
+    return server_status;
+  }
+  return Status::FromDetailAndArgs(server_status.code(), server_status.detail(),
+                                   server_status.message(),
+                                   ". Transport context: ", transport_status.ToString());
+}
+
+class ShmClientStream : public internal::ClientDataStream {
+ public:
+  ShmClientStream(ShmClientImpl* impl, std::unique_ptr<ShmConnection> conn)
+      : impl_(impl), conn_(std::move(conn)), writes_done_(false), finished_(false) {}
+
+  arrow::Result<bool> WriteData(const FlightPayload& payload) override {
+    if (finished_.load() || writes_done_) return false;
+    RETURN_NOT_OK(conn_->SendFlightPayload(payload));
+    return true;
+  }
+
+  Status WritesDone() override {
+    if (!writes_done_) {
+      writes_done_ = true;
+      // Signal end-of-stream to the server
+      ARROW_ASSIGN_OR_RAISE(auto headers, Headers::Make({}));
+      RETURN_NOT_OK(
+          conn_->SendFrame(FrameType::kHeaders, headers->data(), headers->size()));
+    }
+    return Status::OK();
+  }
+
+ protected:
+  Status DoFinish() override;
+
+  bool ReadDataImpl(internal::FlightData* data) {
+    if (finished_.load()) return false;
+    Frame trailers;
+    auto maybe_success = conn_->ReadFlightData(data, &trailers);
+    if (!maybe_success.ok()) {
+      io_status_ = maybe_success.status();
+      finished_.store(true);
+      return false;
+    }
+    if (!*maybe_success) {
+      HandleTrailers(trailers);
+      return false;
+    }
+    return true;
+  }
+
+  void HandleTrailers(const Frame& trailers) {
+    finished_.store(true);
+    Headers headers;
+    io_status_ = Headers::Parse(trailers.buffer).Value(&headers);
+    if (!io_status_.ok()) return;
+    io_status_ = headers.GetStatus(&server_status_);
+  }
+
+  ShmClientImpl* impl_;
+  std::unique_ptr<ShmConnection> conn_;
+  bool writes_done_;
+  // Set by the reader, checked by the writer
+  std::atomic<bool> finished_;
+  Status io_status_;
+  Status server_status_;
+};
+
+class GetClientStream : public ShmClientStream {
+ public:
+  GetClientStream(ShmClientImpl* impl, std::unique_ptr<ShmConnection> conn)
+      : ShmClientStream(impl, std::move(conn)) {
+    writes_done_ = true;
+  }
+
+  bool ReadData(internal::FlightData* data) override { return ReadDataImpl(data); }
+};
+
+class PutClientStream : public ShmClientStream {
+ public:
+  using ShmClientStream::ShmClientStream;
+
+  bool ReadPutMetadata(std::shared_ptr<Buffer>* out) override {
+    *out = nullptr;
+    if (finished_.load()) return false;
+    auto maybe_frame = conn_->ReadFrame();
+    if (!maybe_frame.ok()) {
+      io_status_ = maybe_frame.status();
+      finished_.store(true);
+      return false;
+    }
+    if (maybe_frame->type == FrameType::kBuffer) {
+      *out = std::move(maybe_frame->buffer);
+      return true;
+    }
+    if (maybe_frame->type == FrameType::kHeaders) {
+      // Trailers, stream is over
+      HandleTrailers(*maybe_frame);
+      return false;
+    }
+    io_status_ = Status::IOError("Unexpected frame type ",
+                                 static_cast<int>(maybe_frame->type));
+    finished_.store(true);
+    return false;
+  }
+};
+
+class ExchangeClientStream : public ShmClientStream {
+ public:
+  using ShmClientStream::ShmClientStream;
+
+  bool ReadData(internal::FlightData* data) override { return ReadDataImpl(data); }
+};
+
+class ShmClientImpl : public arrow::flight::internal::ClientTransport {
+ public:
+  ShmClientImpl() {}
+
+  Status Init(const FlightClientOptions& options, const Location& location,
+              const arrow::internal::Uri& uri) override {
+    path_ = uri.path();
+    if (path_.empty()) {
+      return Status::Invalid("No socket path in location: ", uri.ToString());
+    }
+    ARROW_ASSIGN_OR_RAISE(ring_capacity_, GetRingCapacity(uri));
+    return Status::OK();
+  }
+
+  Status Close() override {
+    std::lock_guard<std::mutex> guard(connections_mutex_);
+    connections_.clear();
+    return Status::OK();
+  }
+
+  Status GetFlightInfo(const FlightCallOptions& options,
+                       const FlightDescriptor& descriptor,
+                       std::unique_ptr<FlightInfo>* info) override {
+    ARROW_ASSIGN_OR_RAISE(auto conn, CheckoutConnection(options));
+
+    Status server_status;
+    auto impl = [&]() {
+      RETURN_NOT_OK(conn->StartCall(kMethodGetFlightInfo));
+      ARROW_ASSIGN_OR_RAISE(std::string payload, descriptor.SerializeToString());
+      RETURN_NOT_OK(conn->SendFrame(FrameType::kBuffer,
+                                    reinterpret_cast<const uint8_t*>(payload.data()),
+                                    static_cast<int64_t>(payload.size())));
+
+      ARROW_ASSIGN_OR_RAISE(auto frame, conn->ReadFrame());
+      if (frame.type == FrameType::kBuffer) {
+        ARROW_ASSIGN_OR_RAISE(*info, FlightInfo::Deserialize(frame.view()));
+        ARROW_ASSIGN_OR_RAISE(frame, conn->ReadFrame());
+      }
+      RETURN_NOT_OK(conn->ExpectFrameType(frame, FrameType::kHeaders));
+      ARROW_ASSIGN_OR_RAISE(auto headers, Headers::Parse(std::move(frame.buffer)));
+      return headers.GetStatus(&server_status);
+    };
+    auto status = impl();
+    // The state of the connection is unknown after an I/O error
+    if (status.ok()) ReturnConnection(std::move(conn));
+    return MergeStatuses(std::move(server_status), std::move(status));
+  }
+
+  Status DoExchange(const FlightCallOptions& options,
+                    std::unique_ptr<internal::ClientDataStream>* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto conn, CheckoutConnection(options));
+    RETURN_NOT_OK(conn->StartCall(kMethodDoExchange));
+    *out = arrow::internal::make_unique<ExchangeClientStream>(this, std::move(conn));
+    return Status::OK();
+  }
+
+  Status DoGet(const FlightCallOptions& options, const Ticket& ticket,
+               std::unique_ptr<internal::ClientDataStream>* stream) override {
+    ARROW_ASSIGN_OR_RAISE(auto conn, CheckoutConnection(options));
+    RETURN_NOT_OK(conn->StartCall(kMethodDoGet));
+    ARROW_ASSIGN_OR_RAISE(std::string payload, ticket.SerializeToString());
+    RETURN_NOT_OK(conn->SendFrame(FrameType::kBuffer,
+                                  reinterpret_cast<const uint8_t*>(payload.data()),
+                                  static_cast<int64_t>(payload.size())));
+    *stream = arrow::internal::make_unique<GetClientStream>(this, std::move(conn));
+    return Status::OK();
+  }
+
+  Status DoPut(const FlightCallOptions& options,
+               std::unique_ptr<internal::ClientDataStream>* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto conn, CheckoutConnection(options));
+    RETURN_NOT_OK(conn->StartCall(kMethodDoPut));
+    *out = arrow::internal::make_unique<PutClientStream>(this, std::move(conn));
+    return Status::OK();
+  }
+
+  arrow::Result<std::unique_ptr<ShmConnection>> CheckoutConnection(
+      const FlightCallOptions& options) {
+    std::unique_ptr<ShmConnection> conn;
+    {
+      std::lock_guard<std::mutex> guard(connections_mutex_);
+      if (!connections_.empty()) {
+        conn = std::move(connections_.back());
+        connections_.pop_back();
+      }
+    }
+    if (!conn) {
+      ARROW_ASSIGN_OR_RAISE(conn, ShmConnection::Connect(path_, ring_capacity_));
+    }
+    conn->set_read_memory_pool(options.read_options.memory_pool);
+    return std::move(conn);
+  }
+
+  void ReturnConnection(std::unique_ptr<ShmConnection> conn) {
+    std::lock_guard<std::mutex> guard(connections_mutex_);
+    // Else, the connection is closed (the server notices and frees
+    // its resources)
+    if (connections_.size() < kMaxIdleConnections) {
+      connections_.push_back(std::move(conn));
+    }
+  }
+
+ private:
+  static constexpr size_t kMaxIdleConnections = 3;
+
+  std::string path_;
+  int64_t ring_capacity_;
+  std::mutex connections_mutex_;
+  std::vector<std::unique_ptr<ShmConnection>> connections_;
+};
+
+Status ShmClientStream::DoFinish() {
+  auto status = WritesDone();
+  if (!finished_.load()) {
+    internal::FlightData message;
+    std::shared_ptr<Buffer> metadata;
+    while (ReadData(&message)) {
+    }
+    while (ReadPutMetadata(&metadata)) {
+    }
+    finished_.store(true);
+  }
+  if (impl_) {
+    // The state of the connection is unknown after an I/O error
+    if (status.ok() && io_status_.ok()) impl_->ReturnConnection(std::move(conn_));
+    conn_.reset();
+    impl_ = nullptr;
+  }
+  if (io_status_.ok()) io_status_ = std::move(status);
+  return MergeStatuses(server_status_, io_status_);
+}
+}  // namespace
+
+std::unique_ptr<arrow::flight::internal::ClientTransport> MakeShmClientImpl() {
+  return arrow::internal::make_unique<ShmClientImpl>();
+}
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
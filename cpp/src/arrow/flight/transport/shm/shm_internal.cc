@@ -0,0 +1,832 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/transport/shm/shm_internal.h"
+
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <new>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "arrow/flight/types.h"
+#include "arrow/ipc/message.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/optional.h"
+#include "arrow/util/uri.h"
+#include "arrow/util/value_parsing.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace shm {
+
+using ::arrow::internal::IOErrorFromErrno;
+
+namespace {
+
+/// The size of the control block at the start of a ring.
+constexpr int64_t kRingControlBytes = 64;
+/// The length of a field missing from a payload header (since
+/// zero-size fields are acceptable).
+constexpr uint32_t kMissingFieldSentinel = std::numeric_limits<uint32_t>::max();
+/// The most buffers sent by a single call to sendmsg().
+constexpr size_t kMaxIovecs = 64;
+
+#ifdef MSG_NOSIGNAL
+constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+constexpr int kSendFlags = 0;
+#endif
+
+#ifdef MSG_CMSG_CLOEXEC
+constexpr int kRecvFlags = MSG_CMSG_CLOEXEC;
+#else
+constexpr int kRecvFlags = 0;
+#endif
+
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t),
+              "The consumed counter of a ring must be a plain 64-bit integer");
+
+void PutUInt32(uint32_t value, uint8_t* out) {
+  value = bit_util::ToLittleEndian(value);
+  std::memcpy(out, &value, sizeof(value));
+}
+
+uint32_t GetUInt32(const uint8_t* data) {
+  uint32_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return bit_util::FromLittleEndian(value);
+}
+
+void PutUInt64(uint64_t value, uint8_t* out) {
+  value = bit_util::ToLittleEndian(value);
+  std::memcpy(out, &value, sizeof(value));
+}
+
+uint64_t GetUInt64(const uint8_t* data) {
+  uint64_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return bit_util::FromLittleEndian(value);
+}
+
+util::string_view ViewOf(const uint8_t* data, int64_t size) {
+  return util::string_view(reinterpret_cast<const char*>(data),
+                           static_cast<size_t>(size));
+}
+
+arrow::Result<int> CreateMemoryFile(int64_t size) {
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+  const int fd = memfd_create("arrow-flight-shm", MFD_CLOEXEC);
+  if (fd < 0) return IOErrorFromErrno(errno, "Failed to create memory file");
+#else
+  // Create a named object and remove the name right away
+  static std::atomic<int> counter{0};
+  const std::string name = "/arrow-flight-shm-" + std::to_string(getpid()) + "-" +
+                           std::to_string(counter++);
+  const int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0) return IOErrorFromErrno(errno, "Failed to create memory file");
+  shm_unlink(name.c_str());
+  fcntl(fd, F_SETFD, FD_CLOEXEC);
+#endif
+  if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+    const int errnum = errno;
+    close(fd);
+    return IOErrorFromErrno(errnum, "Failed to size memory file");
+  }
+  return fd;
+}
+
+arrow::Result<uint8_t*> MapMemoryFile(int fd, int64_t size) {
+  void* region = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, 0);
+  if (region == MAP_FAILED) return IOErrorFromErrno(errno, "Failed to map memory file");
+  return static_cast<uint8_t*>(region);
+}
+
+// The size of a body laid out as in an IPC stream: each buffer padded
+// to a multiple of 8 bytes
+int64_t PaddedBodySize(const FlightPayload& payload) {
+  int64_t size = 0;
+  for (const auto& buffer : payload.ipc_message.body_buffers) {
+    if (!buffer) continue;
+    size += bit_util::RoundUpToMultipleOf8(buffer->size());
+  }
+  return size;
+}
+
+//------------------------------------------------------------
+// Payload headers
+//
+// Each field is a little-endian 32-bit length followed by the
+// bytes: the descriptor, the application metadata, then the IPC
+// metadata.
+
+Status PackField(const std::string& field, const std::shared_ptr<Buffer>& data,
+                 std::string* out) {
+  uint8_t length[4];
+  if (!data) {
+    PutUInt32(kMissingFieldSentinel, length);
+    out->append(reinterpret_cast<const char*>(length), sizeof(length));
+    return Status::OK();
+  }
+  if (data->size() >= std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid(field, " must be less than 2 GiB, was: ", data->size());
+  }
+  PutUInt32(static_cast<uint32_t>(data->size()), length);
+  out->append(reinterpret_cast<const char*>(length), sizeof(length));
+  out->append(reinterpret_cast<const char*>(data->data()),
+              static_cast<size_t>(data->size()));
+  return Status::OK();
+}
+
+Status UnpackField(const std::shared_ptr<Buffer>& buffer, int64_t* offset,
+                   std::shared_ptr<Buffer>* out) {
+  if (buffer->size() - *offset < 4) {
+    return Status::IOError("Payload header is truncated");
+  }
+  const uint32_t size = GetUInt32(buffer->data() + *offset);
+  *offset += 4;
+  if (size == kMissingFieldSentinel) {
+    *out = nullptr;
+    return Status::OK();
+  }
+  if (buffer->size() - *offset < static_cast<int64_t>(size)) {
+    return Status::IOError("Payload header is truncated");
+  }
+  *out = SliceBuffer(buffer, *offset, size);
+  *offset += size;
+  return Status::OK();
+}
+
+arrow::Result<std::string> PackPayloadHeader(const FlightPayload& payload) {
+  std::string header;
+  RETURN_NOT_OK(PackField("descriptor", payload.descriptor, &header));
+  RETURN_NOT_OK(PackField("app_metadata", payload.app_metadata, &header));
+  RETURN_NOT_OK(PackField("ipc_message.metadata", payload.ipc_message.metadata, &header));
+  return header;
+}
+
+Status UnpackPayloadHeader(const std::shared_ptr<Buffer>& buffer,
+                           internal::FlightData* data) {
+  int64_t offset = 0;
+  std::shared_ptr<Buffer> descriptor;
+  RETURN_NOT_OK(UnpackField(buffer, &offset, &descriptor));
+  if (descriptor) {
+    data->descriptor.reset(new FlightDescriptor());
+    ARROW_ASSIGN_OR_RAISE(*data->descriptor,
+                          FlightDescriptor::Deserialize(util::string_view(*descriptor)));
+  } else {
+    data->descriptor = nullptr;
+  }
+  RETURN_NOT_OK(UnpackField(buffer, &offset, &data->app_metadata));
+  RETURN_NOT_OK(UnpackField(buffer, &offset, &data->metadata));
+  return Status::OK();
+}
+
+}  // namespace
+
+//------------------------------------------------------------
+// Shared Memory
+
+RingWriter::RingWriter(int fd, uint8_t* region, int64_t capacity)
+    : fd_(fd),
+      region_(region),
+      data_(region + kRingControlBytes),
+      capacity_(capacity),
+      consumed_(new (region) std::atomic<uint64_t>(0)) {}
+
+RingWriter::~RingWriter() {
+  munmap(region_, static_cast<size_t>(kRingControlBytes + capacity_));
+  CloseFile();
+}
+
+arrow::Result<std::unique_ptr<RingWriter>> RingWriter::Make(int64_t capacity) {
+  capacity = bit_util::RoundUpToMultipleOf64(capacity);
+  if (capacity <= 0) return Status::Invalid("Ring capacity must be positive");
+  ARROW_ASSIGN_OR_RAISE(const int fd, CreateMemoryFile(kRingControlBytes + capacity));
+  auto maybe_region = MapMemoryFile(fd, kRingControlBytes + capacity);
+  if (!maybe_region.ok()) {
+    close(fd);
+    return maybe_region.status();
+  }
+  std::unique_ptr<RingWriter> ring(new RingWriter(fd, *maybe_region, capacity));
+  // The peer updates the counter from another process
+  if (!ring->consumed_->is_lock_free()) {
+    return Status::NotImplemented("Lock-free 64-bit atomics are required");
+  }
+  return std::move(ring);
+}
+
+bool RingWriter::Reserve(int64_t size, uint64_t* start, uint64_t* end) {
+  const auto capacity = static_cast<uint64_t>(capacity_);
+  const auto length = static_cast<uint64_t>(bit_util::RoundUpToMultipleOf64(size));
+  if (length > capacity) return false;
+  uint64_t position = head_;
+  const uint64_t offset = position % capacity;
+  // Bodies never wrap around: skip the end of the ring instead
+  if (offset + length > capacity) position += capacity - offset;
+  if (position + length - consumed_->load(std::memory_order_acquire) > capacity) {
+    return false;
+  }
+  *start = position;
+  *end = head_ = position + length;
+  return true;
+}
+
+void RingWriter::CloseFile() {
+  if (fd_ >= 0) close(fd_);
+  fd_ = -1;
+}
+
+class RingReader::RingBuffer : public Buffer {
+ public:
+  RingBuffer(std::shared_ptr<RingReader> ring, const uint8_t* data, int64_t size,
+             uint64_t end)
+      : Buffer(data, size), ring_(std::move(ring)), end_(end) {}
+
+  ~RingBuffer() override { ring_->Release(end_); }
+
+ private:
+  std::shared_ptr<RingReader> ring_;
+  uint64_t end_;
+};
+
+RingReader::RingReader(uint8_t* region, int64_t capacity)
+    : region_(region),
+      data_(region + kRingControlBytes),
+      capacity_(capacity),
+      consumed_(reinterpret_cast<std::atomic<uint64_t>*>(region)) {}
+
+RingReader::~RingReader() {
+  munmap(region_, static_cast<size_t>(kRingControlBytes + capacity_));
+}
+
+arrow::Result<std::shared_ptr<RingReader>> RingReader::Map(int fd, int64_t capacity) {
+  if (capacity <= 0 || capacity % 64 != 0) {
+    return Status::IOError("Invalid ring capacity: ", capacity);
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    return IOErrorFromErrno(errno, "Failed to inspect memory file");
+  }
+  if (static_cast<int64_t>(file_stat.st_size) < kRingControlBytes + capacity) {
+    return Status::IOError("Ring of capacity ", capacity, " is too small: ",
+                           static_cast<int64_t>(file_stat.st_size), " bytes");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto region, MapMemoryFile(fd, kRingControlBytes + capacity));
+  return std::shared_ptr<RingReader>(new RingReader(region, capacity));
+}
+
+arrow::Result<std::shared_ptr<Buffer>> RingReader::Get(uint64_t start, int64_t size,
+                                                       uint64_t end) {
+  const auto capacity = static_cast<uint64_t>(capacity_);
+  const uint64_t offset = start % capacity;
+  if (size < 0 || end < start || end - start > capacity ||
+      static_cast<uint64_t>(size) > end - start ||
+      offset + static_cast<uint64_t>(size) > capacity) {
+    return Status::IOError("Invalid ring body: start ", start, ", size ", size, ", end ",
+                           end);
+  }
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    outstanding_.push_back({end, false});
+  }
+  return std::make_shared<RingBuffer>(shared_from_this(), data_ + offset, size, end);
+}
+
+void RingReader::Release(uint64_t end) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  for (auto& body : outstanding_) {
+    if (body.end == end) {
+      body.released = true;
+      break;
+    }
+  }
+  // Space is reclaimed in order, once all older bodies are released
+  while (!outstanding_.empty() && outstanding_.front().released) {
+    consumed_->store(outstanding_.front().end, std::memory_order_release);
+    outstanding_.pop_front();
+  }
+}
+
+//------------------------------------------------------------
+// Message Framing
+
+arrow::Result<Headers> Headers::Parse(std::shared_ptr<Buffer> buffer) {
+  Headers result;
+  const uint8_t* payload = buffer->data();
+  const uint8_t* end = payload + buffer->size();
+  if (ARROW_PREDICT_FALSE((end - payload) < 4)) {
+    return Status::Invalid("Buffer underflow, expected number of headers");
+  }
+  const uint32_t num_headers = GetUInt32(payload);
+  payload += 4;
+  for (uint32_t i = 0; i < num_headers; i++) {
+    if (ARROW_PREDICT_FALSE((end - payload) < 8)) {
+      return Status::Invalid("Buffer underflow, expected lengths of header ", i + 1);
+    }
+    const uint32_t key_length = GetUInt32(payload);
+    const uint32_t value_length = GetUInt32(payload + 4);
+    payload += 8;
+    if (ARROW_PREDICT_FALSE(static_cast<uint64_t>(end - payload) <
+                            static_cast<uint64_t>(key_length) + value_length)) {
+      return Status::Invalid("Buffer underflow, expected header ", i + 1, " to have ",
+                             key_length + value_length, " bytes, but only ",
+                             (end - payload), " bytes remain");
+    }
+    const util::string_view key(reinterpret_cast<const char*>(payload), key_length);
+    payload += key_length;
+    const util::string_view value(reinterpret_cast<const char*>(payload), value_length);
+    payload += value_length;
+    result.headers_.emplace_back(key, value);
+  }
+  result.buffer_ = std::move(buffer);
+  return result;
+}
+
+arrow::Result<std::shared_ptr<Buffer>> Headers::Make(
+    const std::vector<std::pair<std::string, std::string>>& headers) {
+  int64_t total_length = 4 /* # of headers */;
+  for (const auto& header : headers) {
+    total_length += 8 /* key and value lengths */ +
+                    static_cast<int64_t>(header.first.size() + header.second.size());
+  }
+
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer, AllocateBuffer(total_length));
+  uint8_t* payload = buffer->mutable_data();
+  PutUInt32(static_cast<uint32_t>(headers.size()), payload);
+  payload += 4;
+  for (const auto& header : headers) {
+    PutUInt32(static_cast<uint32_t>(header.first.size()), payload);
+    PutUInt32(static_cast<uint32_t>(header.second.size()), payload + 4);
+    payload += 8;
+    std::memcpy(payload, header.first.data(), header.first.size());
+    payload += header.first.size();
+    std::memcpy(payload, header.second.data(), header.second.size());
+    payload += header.second.size();
+  }
+  return buffer;
+}
+
+arrow::Result<std::shared_ptr<Buffer>> Headers::Make(
+    const Status& status,
+    const std::vector<std::pair<std::string, std::string>>& headers) {
+  auto all_headers = headers;
+
+  auto transport_status = internal::TransportStatus::FromStatus(status);
+  all_headers.emplace_back(kHeaderStatus,
+                           std::to_string(static_cast<int32_t>(transport_status.code)));
+  all_headers.emplace_back(kHeaderMessage, std::move(transport_status.message));
+  all_headers.emplace_back(kHeaderStatusCode,
+                           std::to_string(static_cast<int32_t>(status.code())));
+  all_headers.emplace_back(kHeaderStatusMessage, status.message());
+  if (status.detail()) {
+    all_headers.emplace_back(kHeaderStatusDetail, status.detail()->ToString());
+    auto fsd = FlightStatusDetail::UnwrapStatus(status);
+    if (fsd && !fsd->extra_info().empty()) {
+      all_headers.emplace_back(kHeaderStatusDetailBin, fsd->extra_info());
+    }
+  }
+  return Make(all_headers);
+}
+
+arrow::Result<util::string_view> Headers::Get(const std::string& key) const {
+  for (const auto& pair : headers_) {
+    if (pair.first == key) return pair.second;
+  }
+  return Status::KeyError(key);
+}
+
+Status Headers::GetStatus(Status* out) const {
+  static const std::string kUnknownMessage = "Server did not send status message header";
+  util::string_view code_str, message_str;
+  if (!Get(kHeaderStatus).Value(&code_str).ok()) {
+    return Status::KeyError("Server did not send status code header ", kHeaderStatus);
+  }
+  if (code_str == "0") {  // == std::to_string(TransportStatusCode::kOk)
+    *out = Status::OK();
+    return Status::OK();
+  }
+
+  if (!Get(kHeaderMessage).Value(&message_str).ok()) message_str = kUnknownMessage;
+  auto transport_status = internal::TransportStatus::FromCodeStringAndMessage(
+      std::string(code_str), std::string(message_str));
+  if (transport_status.code == internal::TransportStatusCode::kOk) {
+    *out = Status::OK();
+    return Status::OK();
+  }
+  *out = transport_status.ToStatus();
+
+  util::string_view detail_str, bin_str;
+  util::optional<std::string> message, detail_message, detail_bin;
+  if (!Get(kHeaderStatusCode).Value(&code_str).ok()) {
+    // No Arrow status sent, go with the transport status
+    return Status::OK();
+  }
+  if (Get(kHeaderStatusMessage).Value(&message_str).ok()) {
+    message = std::string(message_str);
+  }
+  if (Get(kHeaderStatusDetail).Value(&detail_str).ok()) {
+    detail_message = std::string(detail_str);
+  }
+  if (Get(kHeaderStatusDetailBin).Value(&bin_str).ok()) {
+    detail_bin = std::string(bin_str);
+  }
+  *out = internal::ReconstructStatus(std::string(code_str), *out, std::move(message),
+                                     std::move(detail_message), std::move(detail_bin),
+                                     FlightStatusDetail::UnwrapStatus(*out));
+  return Status::OK();
+}
+
+//------------------------------------------------------------
+// Connections
+
+Status SetUpSocket(int fd) {
+  if (fcntl(fd, F_SETFD, FD_CLOEXEC) != 0) {
+    return IOErrorFromErrno(errno, "Failed to set up socket");
+  }
+#ifdef SO_NOSIGPIPE
+  const int enable = 1;
+  if (setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable)) != 0) {
+    return IOErrorFromErrno(errno, "Failed to set up socket");
+  }
+#endif
+  return Status::OK();
+}
+
+arrow::Result<int64_t> GetRingCapacity(const arrow::internal::Uri& uri) {
+  ARROW_ASSIGN_OR_RAISE(auto items, uri.query_items());
+  for (const auto& item : items) {
+    if (item.first != kRingCapacityParameter) continue;
+    int64_t capacity;
+    if (!::arrow::internal::ParseValue<Int64Type>(item.second.data(), item.second.size(),
+                                                  &capacity) ||
+        capacity < 0) {
+      return Status::Invalid("Invalid ", kRingCapacityParameter, ": ", item.second);
+    }
+    return capacity;
+  }
+  return kDefaultRingCapacity;
+}
+
+ShmConnection::ShmConnection(int fd, int64_t ring_capacity, std::string peer)
+    : fd_(fd),
+      ring_capacity_(ring_capacity),
+      peer_(std::move(peer)),
+      read_memory_pool_(default_memory_pool()),
+      ring_failed_(ring_capacity <= 0) {}
+
+ShmConnection::~ShmConnection() {
+  for (const int fd : received_fds_) close(fd);
+  if (fd_ >= 0) close(fd_);
+}
+
+arrow::Result<std::unique_ptr<ShmConnection>> ShmConnection::Connect(
+    const std::string& path, int64_t ring_capacity) {
+  struct sockaddr_un addr;
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+    return Status::Invalid("Invalid socket path: '", path, "'");
+  }
+  std::memcpy(addr.sun_path, path.data(), path.size());
+
+  const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) return IOErrorFromErrno(errno, "Failed to create socket");
+  auto status = SetUpSocket(fd);
+  if (status.ok() &&
+      connect(fd, reinterpret_cast<const struct sockaddr*>(&addr), sizeof(addr)) != 0) {
+    status = IOErrorFromErrno(errno, "Failed to connect to ", path);
+  }
+  if (!status.ok()) {
+    close(fd);
+    return status;
+  }
+  return ::arrow::internal::make_unique<ShmConnection>(fd, ring_capacity, "shm:" + path);
+}
+
+Status ShmConnection::StartCall(const std::string& method) {
+  ARROW_ASSIGN_OR_RAISE(auto headers, Headers::Make({{":method:", method}}));
+  return SendFrame(FrameType::kHeaders, headers->data(), headers->size());
+}
+
+Status ShmConnection::SendFrame(FrameType frame_type, const uint8_t* data,
+                                int64_t size) {
+  std::lock_guard<std::mutex> guard(write_mutex_);
+  return SendFrameParts(frame_type, {ViewOf(data, size)});
+}
+
+Status ShmConnection::SendStatus(const Status& status) {
+  ARROW_ASSIGN_OR_RAISE(auto headers, Headers::Make(status, {}));
+  return SendFrame(FrameType::kHeaders, headers->data(), headers->size());
+}
+
+Status ShmConnection::SendFlightPayload(const FlightPayload& payload) {
+  static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+  ARROW_ASSIGN_OR_RAISE(auto header, PackPayloadHeader(payload));
+
+  std::lock_guard<std::mutex> guard(write_mutex_);
+  RETURN_NOT_OK(SendFrameParts(FrameType::kPayloadHeader, {header}));
+  if (!ipc::Message::HasBody(payload.ipc_message.type)) {
+    return Status::OK();
+  }
+  for (const auto& buffer : payload.ipc_message.body_buffers) {
+    if (buffer && !buffer->is_cpu()) {
+      return Status::NotImplemented(
+          "The shared-memory transport only sends buffers in CPU memory");
+    }
+  }
+
+  const int64_t body_size = PaddedBodySize(payload);
+  if (body_size > 0 && !ring_failed_ && !ring_writer_) {
+    RETURN_NOT_OK(SendRing());
+  }
+  uint64_t start, end;
+  if (body_size > 0 && ring_writer_ && ring_writer_->Reserve(body_size, &start, &end)) {
+    // Place the body in the ring, where the peer reads it without copying
+    uint8_t* out = ring_writer_->data_at(start);
+    for (const auto& buffer : payload.ipc_message.body_buffers) {
+      if (!buffer) continue;
+      const int64_t padding =
+          bit_util::RoundUpToMultipleOf8(buffer->size()) - buffer->size();
+      std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+      std::memset(out + buffer->size(), 0, static_cast<size_t>(padding));
+      out += buffer->size() + padding;
+    }
+    uint8_t location[24];
+    PutUInt64(start, location);
+    PutUInt64(static_cast<uint64_t>(body_size), location + 8);
+    PutUInt64(end, location + 16);
+    return SendFrameParts(FrameType::kRingBody, {ViewOf(location, sizeof(location))});
+  }
+
+  // The ring is full (or unavailable): send the body inline
+  std::vector<util::string_view> parts;
+  for (const auto& buffer : payload.ipc_message.body_buffers) {
+    if (!buffer) continue;
+    parts.push_back(ViewOf(buffer->data(), buffer->size()));
+    const int64_t padding =
+        bit_util::RoundUpToMultipleOf8(buffer->size()) - buffer->size();
+    if (padding > 0) parts.push_back(ViewOf(kPaddingBytes, padding));
+  }
+  return SendFrameParts(FrameType::kPayloadBody, std::move(parts));
+}
+
+Status ShmConnection::SendRing() {
+  auto maybe_ring = RingWriter::Make(ring_capacity_);
+  if (!maybe_ring.ok()) {
+    ARROW_LOG(WARNING) << "Sending bodies to " << peer_
+                       << " inline, could not create ring: "
+                       << maybe_ring.status().ToString();
+    ring_failed_ = true;
+    return Status::OK();
+  }
+  auto ring = maybe_ring.MoveValueUnsafe();
+  uint8_t capacity[8];
+  PutUInt64(static_cast<uint64_t>(ring->capacity()), capacity);
+  RETURN_NOT_OK(
+      SendFrameParts(FrameType::kRing, {ViewOf(capacity, sizeof(capacity))}, ring->fd()));
+  // The descriptor in flight keeps the file alive until the peer maps it
+  ring->CloseFile();
+  ring_writer_ = std::move(ring);
+  return Status::OK();
+}
+
+Status ShmConnection::SendFrameParts(FrameType frame_type,
+                                     std::vector<util::string_view> parts,
+                                     int fd_to_pass) {
+  int64_t size = 0;
+  for (const auto& part : parts) size += static_cast<int64_t>(part.size());
+  uint8_t header[Frame::kFrameHeaderBytes];
+  std::memset(header, 0, sizeof(header));
+  header[0] = Frame::kFrameVersion;
+  header[1] = static_cast<uint8_t>(frame_type);
+  PutUInt64(static_cast<uint64_t>(size), header + 4);
+  parts.insert(parts.begin(), ViewOf(header, sizeof(header)));
+
+  // The part and the offset in it to send next
+  size_t next = 0;
+  size_t offset = 0;
+  while (next < parts.size()) {
+    struct iovec iov[kMaxIovecs];
+    size_t num_iov = 0;
+    for (size_t i = next; i < parts.size() && num_iov < kMaxIovecs; ++i) {
+      const size_t skip = i == next ? offset : 0;
+      if (parts[i].size() == skip) continue;
+      iov[num_iov].iov_base = const_cast<char*>(parts[i].data() + skip);
+      iov[num_iov].iov_len = parts[i].size() - skip;
+      ++num_iov;
+    }
+    if (num_iov == 0) break;
+
+    struct msghdr msg;
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = num_iov;
+    union {
+      char buffer[CMSG_SPACE(sizeof(int))];
+      struct cmsghdr align;
+    } control;
+    if (fd_to_pass >= 0) {
+      std::memset(&control, 0, sizeof(control));
+      msg.msg_control = control.buffer;
+      msg.msg_controllen = sizeof(control.buffer);
+      struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+      cmsg->cmsg_level = SOL_SOCKET;
+      cmsg->cmsg_type = SCM_RIGHTS;
+      cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+      std::memcpy(CMSG_DATA(cmsg), &fd_to_pass, sizeof(int));
+    }
+
+    const ssize_t sent = sendmsg(fd_, &msg, kSendFlags);
+    if (sent < 0) {
+      if (errno == EINTR) continue;
+      return IOErrorFromErrno(errno, "Failed to send to ", peer_);
+    }
+    // The descriptor went with the first bytes
+    fd_to_pass = -1;
+    auto remaining = static_cast<size_t>(sent);
+    while (next < parts.size() && remaining >= parts[next].size() - offset) {
+      remaining -= parts[next].size() - offset;
+      ++next;
+      offset = 0;
+    }
+    offset += remaining;
+  }
+  return Status::OK();
+}
+
+Status ShmConnection::RecvAll(uint8_t* out, int64_t size, bool* eof) {
+  *eof = false;
+  int64_t received = 0;
+  while (received < size) {
+    struct iovec iov;
+    iov.iov_base = out + received;
+    iov.iov_len = static_cast<size_t>(size - received);
+    union {
+      char buffer[CMSG_SPACE(sizeof(int))];
+      struct cmsghdr align;
+    } control;
+    struct msghdr msg;
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buffer;
+    msg.msg_controllen = sizeof(control.buffer);
+
+    const ssize_t n = recvmsg(fd_, &msg, kRecvFlags);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return IOErrorFromErrno(errno, "Failed to receive from ", peer_);
+    }
+    for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+         cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+      if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) continue;
+      const size_t num_fds = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+      for (size_t i = 0; i < num_fds; ++i) {
+        int fd;
+        std::memcpy(&fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+        received_fds_.push_back(fd);
+      }
+    }
+    if (n == 0) {
+      if (received == 0) {
+        *eof = true;
+        return Status::OK();
+      }
+      return Status::IOError("Connection closed by ", peer_, " in the middle of a frame");
+    }
+    received += n;
+  }
+  return Status::OK();
+}
+
+arrow::Result<Frame> ShmConnection::ReadFrame() {
+  while (true) {
+    uint8_t header[Frame::kFrameHeaderBytes];
+    bool eof;
+    RETURN_NOT_OK(RecvAll(header, sizeof(header), &eof));
+    if (eof) return Status::Cancelled("Connection closed by ", peer_);
+    if (header[0] != Frame::kFrameVersion) {
+      return Status::IOError("Expected frame version ",
+                             static_cast<int>(Frame::kFrameVersion), " but got ",
+                             static_cast<int>(header[0]));
+    }
+    if (header[1] > static_cast<uint8_t>(FrameType::kMaxFrameType)) {
+      return Status::IOError("Unknown frame type ", static_cast<int>(header[1]));
+    }
+    const uint64_t size = GetUInt64(header + 4);
+    if (size > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+      return Status::IOError("Invalid frame size ", size);
+    }
+
+    Frame frame;
+    frame.type = static_cast<FrameType>(header[1]);
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                          AllocateBuffer(static_cast<int64_t>(size), read_memory_pool_));
+    RETURN_NOT_OK(RecvAll(buffer->mutable_data(), static_cast<int64_t>(size), &eof));
+    if (eof) {
+      return Status::IOError("Connection closed by ", peer_, " in the middle of a frame");
+    }
+    frame.buffer = std::move(buffer);
+
+    if (frame.type == FrameType::kRing) {
+      if (received_fds_.empty()) {
+        return Status::IOError("Received a ring without its file descriptor");
+      }
+      const int fd = received_fds_.front();
+      received_fds_.pop_front();
+      if (size != sizeof(uint64_t)) {
+        close(fd);
+        return Status::IOError("Invalid ring frame of ", size, " bytes");
+      }
+      auto maybe_ring = RingReader::Map(
+          fd, static_cast<int64_t>(GetUInt64(frame.buffer->data())));
+      // The mapping keeps the memory alive
+      close(fd);
+      ARROW_ASSIGN_OR_RAISE(ring_reader_, std::move(maybe_ring));
+      continue;
+    }
+    if (frame.type == FrameType::kRingBody) {
+      if (!ring_reader_) {
+        return Status::IOError("Received a ring body before the ring");
+      }
+      if (size != 3 * sizeof(uint64_t)) {
+        return Status::IOError("Invalid ring body frame of ", size, " bytes");
+      }
+      const uint8_t* location = frame.buffer->data();
+      ARROW_ASSIGN_OR_RAISE(
+          frame.buffer,
+          ring_reader_->Get(GetUInt64(location),
+                            static_cast<int64_t>(GetUInt64(location + 8)),
+                            GetUInt64(location + 16)));
+      frame.type = FrameType::kPayloadBody;
+    }
+    return frame;
+  }
+}
+
+arrow::Result<bool> ShmConnection::ReadFlightData(internal::FlightData* data,
+                                                  Frame* trailers) {
+  ARROW_ASSIGN_OR_RAISE(auto frame, ReadFrame());
+  if (frame.type == FrameType::kHeaders) {
+    *trailers = std::move(frame);
+    return false;
+  }
+  RETURN_NOT_OK(ExpectFrameType(frame, FrameType::kPayloadHeader));
+  RETURN_NOT_OK(UnpackPayloadHeader(frame.buffer, data));
+  data->body = nullptr;
+  if (data->metadata) {
+    ARROW_ASSIGN_OR_RAISE(auto message, ipc::Message::Open(data->metadata, nullptr));
+    if (ipc::Message::HasBody(message->type())) {
+      ARROW_ASSIGN_OR_RAISE(frame, ReadFrame());
+      RETURN_NOT_OK(ExpectFrameType(frame, FrameType::kPayloadBody));
+      data->body = std::move(frame.buffer);
+    }
+  }
+  return true;
+}
+
+Status ShmConnection::ExpectFrameType(const Frame& frame, FrameType type) const {
+  if (frame.type != type) {
+    return Status::IOError("Expected frame type ", static_cast<int>(type),
+                           ", but got frame type ", static_cast<int>(frame.type));
+  }
+  return Status::OK();
+}
+
+void ShmConnection::Shutdown() { shutdown(fd_, SHUT_RDWR); }
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,316 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Common implementation of the shared-memory transport primitives.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/server.h"
+#include "arrow/flight/transport.h"
+#include "arrow/flight/visibility.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/string_view.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace shm {
+
+//------------------------------------------------------------
+// Protocol Constants
+
+static constexpr char kMethodDoExchange[] = "DoExchange";
+static constexpr char kMethodDoGet[] = "DoGet";
+static constexpr char kMethodDoPut[] = "DoPut";
+static constexpr char kMethodGetFlightInfo[] = "GetFlightInfo";
+
+/// The header encoding the transport status.
+static constexpr char kHeaderStatus[] = "flight-status";
+/// The header encoding the transport status message.
+static constexpr char kHeaderMessage[] = "flight-message";
+/// The header encoding the C++ status.
+static constexpr char kHeaderStatusCode[] = "flight-status-code";
+/// The header encoding the C++ status message.
+static constexpr char kHeaderStatusMessage[] = "flight-status-message";
+/// The header encoding the C++ status detail message.
+static constexpr char kHeaderStatusDetail[] = "flight-status-detail";
+/// The header encoding the C++ status detail binary data.
+static constexpr char kHeaderStatusDetailBin[] = "flight-status-detail-bin";
+
+/// The location query parameter setting the capacity of the rings.
+static constexpr char kRingCapacityParameter[] = "ring_capacity";
+/// The default capacity of the rings, in bytes.
+static constexpr int64_t kDefaultRingCapacity = 64 << 20;
+
+//------------------------------------------------------------
+// Shared Memory
+
+/// \brief The sending side of a ring of shared memory.
+///
+/// Each side of a connection owns one ring, and places the bodies of
+/// the IPC messages it sends there. The ring is a memory file whose
+/// descriptor is passed to the peer over the Unix socket. Space is
+/// reclaimed in order: the peer advances a shared counter of consumed
+/// bytes once it has released the oldest bodies. When the ring is
+/// full, bodies are sent inline over the socket instead, so that a
+/// reader holding on to its batches never blocks the writer.
+///
+/// Layout: a 64-byte control block holding the consumed counter,
+/// followed by `capacity` bytes of data. Positions grow monotonically
+/// and wrap around the data modulo the capacity; a body never wraps,
+/// the end of the ring is skipped instead.
+class ARROW_FLIGHT_EXPORT RingWriter {
+ public:
+  ~RingWriter();
+
+  /// \brief Create a new ring of the given capacity.
+  static arrow::Result<std::unique_ptr<RingWriter>> Make(int64_t capacity);
+
+  /// \brief The memory file to pass to the peer.
+  int fd() const { return fd_; }
+  int64_t capacity() const { return capacity_; }
+
+  /// \brief Reserve space for a body.
+  ///
+  /// \param[in] size The size of the body.
+  /// \param[out] start The position of the body.
+  /// \param[out] end The position the peer releases once it is done.
+  /// \return false if the ring does not have enough free space.
+  bool Reserve(int64_t size, uint64_t* start, uint64_t* end);
+
+  /// \brief The memory at a position returned by Reserve().
+  uint8_t* data_at(uint64_t position) {
+    return data_ + static_cast<int64_t>(position % static_cast<uint64_t>(capacity_));
+  }
+
+  /// \brief Close the memory file, once the peer has mapped it.
+  void CloseFile();
+
+ private:
+  RingWriter(int fd, uint8_t* region, int64_t capacity);
+
+  int fd_;
+  uint8_t* region_;
+  uint8_t* data_;
+  const int64_t capacity_;
+  std::atomic<uint64_t>* consumed_;
+  uint64_t head_ = 0;
+};
+
+/// \brief The receiving side of a ring of shared memory.
+///
+/// Hands out the bodies as buffers pointing into the mapped ring, and
+/// advances the consumed counter as the oldest ones are destroyed.
+class ARROW_FLIGHT_EXPORT RingReader : public std::enable_shared_from_this<RingReader> {
+ public:
+  ~RingReader();
+
+  /// \brief Map a ring received from the peer.
+  static arrow::Result<std::shared_ptr<RingReader>> Map(int fd, int64_t capacity);
+
+  /// \brief Wrap a body placed by the peer, without copying it.
+  arrow::Result<std::shared_ptr<Buffer>> Get(uint64_t start, int64_t size,
+                                             uint64_t end);
+
+ private:
+  class RingBuffer;
+  struct Outstanding {
+    uint64_t end;
+    bool released;
+  };
+
+  RingReader(uint8_t* region, int64_t capacity);
+  void Release(uint64_t end);
+
+  uint8_t* region_;
+  const uint8_t* data_;
+  const int64_t capacity_;
+  std::atomic<uint64_t>* consumed_;
+  std::mutex mutex_;
+  // The bodies handed out, oldest first
+  std::deque<Outstanding> outstanding_;
+};
+
+//------------------------------------------------------------
+// Message Framing
+
+/// \brief The message type.
+enum class FrameType : uint8_t {
+  /// Key-value headers. Sent at the beginning (client->server) and
+  /// end (server->client) of a call. Also, for client-streaming calls
+  /// (e.g. DoPut), the client should send a headers frame to signal
+  /// end-of-stream.
+  kHeaders = 0,
+  /// Binary blob, does not contain Arrow data.
+  kBuffer,
+  /// Binary blob. Contains IPC metadata, app metadata.
+  kPayloadHeader,
+  /// Binary blob. Contains an IPC body sent inline.
+  kPayloadBody,
+  /// The location of an IPC body in the sender's ring: start, size
+  /// and end, as little-endian 64-bit integers.
+  kRingBody,
+  /// The capacity of the sender's ring, as a little-endian 64-bit
+  /// integer. Carries the ring's file descriptor as ancillary data.
+  kRing,
+  /// Keep at end.
+  kMaxFrameType = kRing,
+};
+
+/// \brief A single message received over the socket.
+///
+/// The header of a frame is 12 bytes: a version tag, the frame type,
+/// two reserved bytes, and the body size as a little-endian 64-bit
+/// integer.
+struct Frame {
+  static constexpr int64_t kFrameHeaderBytes = 12;
+  static constexpr uint8_t kFrameVersion = 0x01;
+
+  FrameType type;
+  std::shared_ptr<Buffer> buffer;
+
+  util::string_view view() const {
+    return util::string_view(reinterpret_cast<const char*>(buffer->data()),
+                             static_cast<size_t>(buffer->size()));
+  }
+};
+
+/// \brief A collection of key-value headers, stored in a kHeaders
+///   frame: the number of headers, then the length of each key and
+///   value followed by the key and value, as little-endian 32-bit
+///   lengths.
+class Headers {
+ public:
+  /// \brief Get a header value (or an error if it was not found)
+  arrow::Result<util::string_view> Get(const std::string& key) const;
+  /// \brief Extract the status sent by the peer.
+  Status GetStatus(Status* out) const;
+  /// \brief Parse the headers from the buffer.
+  static arrow::Result<Headers> Parse(std::shared_ptr<Buffer> buffer);
+  /// \brief Encode the given headers.
+  static arrow::Result<std::shared_ptr<Buffer>> Make(
+      const std::vector<std::pair<std::string, std::string>>& headers);
+  /// \brief Encode the given headers and the given status.
+  static arrow::Result<std::shared_ptr<Buffer>> Make(
+      const Status& status,
+      const std::vector<std::pair<std::string, std::string>>& headers);
+
+ private:
+  std::shared_ptr<Buffer> buffer_;
+  std::vector<std::pair<util::string_view, util::string_view>> headers_;
+};
+
+/// \brief Manage the state of a connection: the socket and the two
+///   rings.
+///
+/// Sending and reading may happen concurrently, from one thread each.
+class ARROW_FLIGHT_EXPORT ShmConnection {
+ public:
+  /// \param[in] fd The connected Unix socket, owned by the connection.
+  /// \param[in] ring_capacity The capacity of the ring of this side, 0 to
+  ///   send all bodies inline.
+  /// \param[in] peer A debug string naming the peer.
+  ShmConnection(int fd, int64_t ring_capacity, std::string peer);
+  ~ShmConnection();
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ShmConnection);
+
+  /// \brief Connect to the server listening on the given path.
+  static arrow::Result<std::unique_ptr<ShmConnection>> Connect(const std::string& path,
+                                                               int64_t ring_capacity);
+
+  /// \brief Start a call by sending a headers frame. Client side only.
+  Status StartCall(const std::string& method);
+  /// \brief Send a generic message with binary payload.
+  Status SendFrame(FrameType frame_type, const uint8_t* data, int64_t size);
+  /// \brief Send the status ending a call (server) or a stream (client).
+  Status SendStatus(const Status& status);
+  /// \brief Send a data message.
+  ///
+  /// The body is copied into the ring, or sent inline if the ring is
+  /// full.
+  Status SendFlightPayload(const FlightPayload& payload);
+
+  /// \brief Read the next frame.
+  ///
+  /// Bodies placed in the peer's ring are returned as kPayloadBody
+  /// frames pointing into the ring.
+  arrow::Result<Frame> ReadFrame();
+  /// \brief Read the next data message.
+  ///
+  /// \param[out] data The message.
+  /// \param[out] trailers The headers frame ending the stream instead.
+  /// \return false if the stream ended.
+  arrow::Result<bool> ReadFlightData(internal::FlightData* data, Frame* trailers);
+  /// \brief Validate that the frame is of the given type.
+  Status ExpectFrameType(const Frame& frame, FrameType type) const;
+
+  /// \brief Unblock any pending reads and writes, which then fail.
+  void Shutdown();
+
+  /// \brief Set memory pool for the bodies received inline.
+  void set_read_memory_pool(MemoryPool* memory_pool) { read_memory_pool_ = memory_pool; }
+  /// \brief Get a debug string naming the peer.
+  const std::string& peer() const { return peer_; }
+
+ private:
+  Status SendFrameParts(FrameType frame_type, std::vector<util::string_view> parts,
+                        int fd_to_pass = -1);
+  Status SendRing();
+  Status RecvAll(uint8_t* out, int64_t size, bool* eof);
+
+  int fd_;
+  const int64_t ring_capacity_;
+  std::string peer_;
+  MemoryPool* read_memory_pool_;
+
+  std::mutex write_mutex_;
+  std::unique_ptr<RingWriter> ring_writer_;
+  bool ring_failed_;
+
+  std::shared_ptr<RingReader> ring_reader_;
+  // Descriptors received as ancillary data, not yet claimed
+  std::deque<int> received_fds_;
+};
+
+/// \brief Set up a connected Unix socket.
+Status SetUpSocket(int fd);
+
+/// \brief Get the ring capacity set by a location, if any.
+arrow::Result<int64_t> GetRingCapacity(const arrow::internal::Uri& uri);
+
+ARROW_FLIGHT_EXPORT
+std::unique_ptr<arrow::flight::internal::ClientTransport> MakeShmClientImpl();
+
+ARROW_FLIGHT_EXPORT
+std::unique_ptr<arrow::flight::internal::ServerTransport> MakeShmServerImpl(
+    FlightServerBase* base, std::shared_ptr<MemoryManager> memory_manager);
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,468 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/transport/shm/shm_internal.h"
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <unordered_set>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/server.h"
+#include "arrow/flight/transport.h"
+#include "arrow/flight/transport_server.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/uri.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace shm {
+
+// Send an error to the client and return OK.
+// Statuses returned up to the main server loop close the connection instead.
+#define SERVER_RETURN_NOT_OK(conn, status)         \
+  do {                                             \
+    ::arrow::Status s = (status);                  \
+    if (!s.ok()) {                                 \
+      RETURN_NOT_OK((conn)->SendStatus(s));        \
+      return ::arrow::Status::OK();                \
+    }                                              \
+  } while (false)
+
+#define FLIGHT_LOG(LEVEL) (ARROW_LOG(LEVEL) << "[server] ")
+#define FLIGHT_LOG_PEER(LEVEL, PEER) \
+  (ARROW_LOG(LEVEL) << "[server]"    \
+                    << "[peer=" << (PEER) << "] ")
+
+namespace {
+class ShmServerCallContext : public flight::ServerCallContext {
+ public:
+  explicit ShmServerCallContext(const std::string& peer) : peer_(peer) {}
+
+  const std::string& peer_identity() const override { return peer_; }
+  const std::string& peer() const override { return peer_; }
+  ServerMiddleware* GetMiddleware(const std::string& key) const override {
+    return nullptr;
+  }
+  bool is_cancelled() const override { return false; }
+
+ private:
+  std::string peer_;
+};
+
+class ShmServerStream : public internal::ServerDataStream {
+ public:
+  explicit ShmServerStream(ShmConnection* conn) : conn_(conn), writes_done_(false) {}
+
+  Status WritesDone() override {
+    writes_done_ = true;
+    return Status::OK();
+  }
+
+ protected:
+  ShmConnection* conn_;
+  bool writes_done_;
+};
+
+class GetServerStream : public ShmServerStream {
+ public:
+  using ShmServerStream::ShmServerStream;
+
+  arrow::Result<bool> WriteData(const FlightPayload& payload) override {
+    if (writes_done_) return false;
+    RETURN_NOT_OK(conn_->SendFlightPayload(payload));
+    return true;
+  }
+};
+
+class PutServerStream : public ShmServerStream {
+ public:
+  explicit PutServerStream(ShmConnection* conn)
+      : ShmServerStream(conn), finished_(false) {}
+
+  bool ReadData(internal::FlightData* data) override {
+    if (finished_) return false;
+    Frame trailers;
+    auto maybe_success = conn_->ReadFlightData(data, &trailers);
+    if (!maybe_success.ok()) {
+      FLIGHT_LOG_PEER(WARNING, conn_->peer())
+          << "I/O error in DoPut: " << maybe_success.status().ToString();
+      io_status_ = maybe_success.status();
+      finished_ = true;
+      return false;
+    }
+    // Else, trailers: the client is done writing
+    if (!*maybe_success) finished_ = true;
+    return *maybe_success;
+  }
+
+  Status WritePutMetadata(const Buffer& payload) override {
+    if (!io_status_.ok()) return Status::OK();
+    return conn_->SendFrame(FrameType::kBuffer, payload.data(), payload.size());
+  }
+
+  /// \brief The I/O error which ended the client stream, if any.
+  const Status& io_status() const { return io_status_; }
+
+ private:
+  bool finished_;
+  Status io_status_;
+};
+
+class ExchangeServerStream : public PutServerStream {
+ public:
+  using PutServerStream::PutServerStream;
+
+  arrow::Result<bool> WriteData(const FlightPayload& payload) override {
+    if (writes_done_) return false;
+    RETURN_NOT_OK(conn_->SendFlightPayload(payload));
+    return true;
+  }
+  Status WritePutMetadata(const Buffer& payload) override {
+    return Status::NotImplemented("Not supported on this stream");
+  }
+};
+
+class ShmServerImpl : public arrow::flight::internal::ServerTransport {
+ public:
+  using arrow::flight::internal::ServerTransport::ServerTransport;
+
+  virtual ~ShmServerImpl() {
+    if (listening_.load()) {
+      ARROW_WARN_NOT_OK(Shutdown(), "Server did not shut down properly");
+    }
+    CloseSockets();
+  }
+
+  Status Init(const FlightServerOptions& options,
+              const arrow::internal::Uri& uri) override {
+    auto status = InitImpl(uri);
+    if (!status.ok()) CloseSockets();
+    return status;
+  }
+
+  Status Shutdown() override {
+    if (!listening_.load()) return Status::OK();
+    {
+      // Unblock the connections waiting for their next call; the others
+      // close once their current call is over
+      std::lock_guard<std::mutex> guard(connections_mutex_);
+      listening_.store(false);
+      for (auto* conn : idle_connections_) conn->Shutdown();
+    }
+    // Wake up the listener thread
+    const char byte = 0;
+    if (write(wake_fds_[1], &byte, 1) < 0) {
+      FLIGHT_LOG(WARNING) << ::arrow::internal::IOErrorFromErrno(
+                                 errno, "Failed to wake up listener")
+                                 .ToString();
+    }
+    Status status = Wait();
+    status &= rpc_pool_->Shutdown();
+    rpc_pool_.reset();
+    CloseSockets();
+    return status;
+  }
+
+  Status Shutdown(const std::chrono::system_clock::time_point& deadline) override {
+    // Calls in progress cannot be interrupted, so wait for them regardless
+    ARROW_UNUSED(deadline);
+    return Shutdown();
+  }
+
+  Status Wait() override {
+    std::lock_guard<std::mutex> guard(join_mutex_);
+    try {
+      listener_thread_.join();
+    } catch (const std::system_error& e) {
+      if (e.code() != std::errc::invalid_argument) {
+        return Status::UnknownError("Could not Wait(): ", e.what());
+      }
+      // Else, server wasn't running anyways
+    }
+    return Status::OK();
+  }
+
+  Location location() const override { return location_; }
+
+ private:
+  static constexpr int kMinThreads = 8;
+
+  Status InitImpl(const arrow::internal::Uri& uri) {
+    path_ = uri.path();
+    ARROW_ASSIGN_OR_RAISE(ring_capacity_, GetRingCapacity(uri));
+
+    struct sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path_.empty() || path_.size() >= sizeof(addr.sun_path)) {
+      return Status::Invalid("Invalid socket path: '", path_, "'");
+    }
+    std::memcpy(addr.sun_path, path_.data(), path_.size());
+
+    listen_fd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd_ < 0) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "Failed to create socket");
+    }
+    RETURN_NOT_OK(SetUpSocket(listen_fd_));
+    if (bind(listen_fd_, reinterpret_cast<const struct sockaddr*>(&addr), sizeof(addr)) !=
+        0) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "Failed to bind to ", path_);
+    }
+    bound_ = true;
+    if (listen(listen_fd_, SOMAXCONN) != 0) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "Failed to listen on ", path_);
+    }
+    if (pipe(wake_fds_) != 0) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "Failed to create pipe");
+    }
+    fcntl(wake_fds_[0], F_SETFD, FD_CLOEXEC);
+    fcntl(wake_fds_[1], F_SETFD, FD_CLOEXEC);
+
+    ARROW_ASSIGN_OR_RAISE(rpc_pool_, arrow::internal::ThreadPool::Make(kMinThreads));
+    ARROW_ASSIGN_OR_RAISE(location_, Location::Parse(uri.ToString()));
+    FLIGHT_LOG(DEBUG) << "Listening on " << path_;
+
+    listening_.store(true);
+    std::thread listener_thread(&ShmServerImpl::DriveConnections, this);
+    listener_thread_.swap(listener_thread);
+    return Status::OK();
+  }
+
+  void CloseSockets() {
+    if (listen_fd_ >= 0) close(listen_fd_);
+    listen_fd_ = -1;
+    for (int& fd : wake_fds_) {
+      if (fd >= 0) close(fd);
+      fd = -1;
+    }
+    if (bound_) unlink(path_.c_str());
+    bound_ = false;
+  }
+
+  Status HandleGetFlightInfo(ShmConnection* conn) {
+    ShmServerCallContext context(conn->peer());
+
+    ARROW_ASSIGN_OR_RAISE(auto frame, conn->ReadFrame());
+    SERVER_RETURN_NOT_OK(conn, conn->ExpectFrameType(frame, FrameType::kBuffer));
+    FlightDescriptor descriptor;
+    SERVER_RETURN_NOT_OK(conn,
+                         FlightDescriptor::Deserialize(frame.view()).Value(&descriptor));
+
+    std::unique_ptr<FlightInfo> info;
+    std::string response;
+    SERVER_RETURN_NOT_OK(conn, base_->GetFlightInfo(context, descriptor, &info));
+    SERVER_RETURN_NOT_OK(conn, info->SerializeToString().Value(&response));
+    RETURN_NOT_OK(conn->SendFrame(FrameType::kBuffer,
+                                  reinterpret_cast<const uint8_t*>(response.data()),
+                                  static_cast<int64_t>(response.size())));
+    return conn->SendStatus(Status::OK());
+  }
+
+  Status HandleDoGet(ShmConnection* conn) {
+    ShmServerCallContext context(conn->peer());
+
+    ARROW_ASSIGN_OR_RAISE(auto frame, conn->ReadFrame());
+    SERVER_RETURN_NOT_OK(conn, conn->ExpectFrameType(frame, FrameType::kBuffer));
+    Ticket ticket;
+    SERVER_RETURN_NOT_OK(conn, Ticket::Deserialize(frame.view()).Value(&ticket));
+
+    GetServerStream stream(conn);
+    auto status = DoGet(context, std::move(ticket), &stream);
+    return conn->SendStatus(status);
+  }
+
+  Status HandleDoPut(ShmConnection* conn) {
+    ShmServerCallContext context(conn->peer());
+
+    PutServerStream stream(conn);
+    auto status = DoPut(context, &stream);
+    RETURN_NOT_OK(conn->SendStatus(status));
+    // Must drain any unread messages, or the next call will get confused
+    internal::FlightData ignored;
+    while (stream.ReadData(&ignored)) {
+    }
+    return stream.io_status();
+  }
+
+  Status HandleDoExchange(ShmConnection* conn) {
+    ShmServerCallContext context(conn->peer());
+
+    ExchangeServerStream stream(conn);
+    auto status = DoExchange(context, &stream);
+    RETURN_NOT_OK(conn->SendStatus(status));
+    // Must drain any unread messages, or the next call will get confused
+    internal::FlightData ignored;
+    while (stream.ReadData(&ignored)) {
+    }
+    return stream.io_status();
+  }
+
+  Status HandleOneCall(ShmConnection* conn, Frame* frame) {
+    SERVER_RETURN_NOT_OK(conn, conn->ExpectFrameType(*frame, FrameType::kHeaders));
+    ARROW_ASSIGN_OR_RAISE(auto headers, Headers::Parse(std::move(frame->buffer)));
+    ARROW_ASSIGN_OR_RAISE(auto method, headers.Get(":method:"));
+    if (method == kMethodGetFlightInfo) {
+      return HandleGetFlightInfo(conn);
+    } else if (method == kMethodDoExchange) {
+      return HandleDoExchange(conn);
+    } else if (method == kMethodDoGet) {
+      return HandleDoGet(conn);
+    } else if (method == kMethodDoPut) {
+      return HandleDoPut(conn);
+    }
+    return conn->SendStatus(Status::NotImplemented(method));
+  }
+
+  void WorkerLoop(const std::shared_ptr<ShmConnection>& conn) {
+    const std::string& peer = conn->peer();
+    FLIGHT_LOG_PEER(DEBUG, peer) << "Connected";
+    while (true) {
+      {
+        std::lock_guard<std::mutex> guard(connections_mutex_);
+        if (!listening_.load()) break;
+        idle_connections_.insert(conn.get());
+      }
+      auto maybe_frame = conn->ReadFrame();
+      {
+        std::lock_guard<std::mutex> guard(connections_mutex_);
+        idle_connections_.erase(conn.get());
+      }
+      if (!maybe_frame.ok()) {
+        if (!maybe_frame.status().IsCancelled() && listening_.load()) {
+          FLIGHT_LOG_PEER(WARNING, peer)
+              << "Failed to read next message: " << maybe_frame.status().ToString();
+        }
+        break;
+      }
+
+      auto status = HandleOneCall(conn.get(), &*maybe_frame);
+      if (!status.ok()) {
+        FLIGHT_LOG_PEER(WARNING, peer) << "Call failed: " << status.ToString();
+        break;
+      }
+    }
+    {
+      std::lock_guard<std::mutex> guard(connections_mutex_);
+      --num_connections_;
+    }
+    FLIGHT_LOG_PEER(DEBUG, peer) << "Disconnected";
+  }
+
+  void DriveConnections() {
+    while (listening_.load()) {
+      struct pollfd fds[2];
+      fds[0].fd = listen_fd_;
+      fds[0].events = POLLIN;
+      fds[1].fd = wake_fds_[0];
+      fds[1].events = POLLIN;
+      if (poll(fds, 2, -1) < 0) {
+        if (errno == EINTR) continue;
+        FLIGHT_LOG(WARNING) << ::arrow::internal::IOErrorFromErrno(errno, "poll failed")
+                                   .ToString();
+        break;
+      }
+      // Check listening_ in case we're shutting down
+      if (!listening_.load()) break;
+      if (!(fds[0].revents & POLLIN)) continue;
+
+      const int fd = accept(listen_fd_, nullptr, nullptr);
+      if (fd < 0) {
+        if (errno != EINTR && errno != EAGAIN && errno != ECONNABORTED) {
+          FLIGHT_LOG(WARNING) << ::arrow::internal::IOErrorFromErrno(errno,
+                                                                     "accept failed")
+                                     .ToString();
+        }
+        continue;
+      }
+      auto status = SetUpSocket(fd);
+      if (!status.ok()) {
+        FLIGHT_LOG(WARNING) << status.ToString();
+        close(fd);
+        continue;
+      }
+      auto conn = std::make_shared<ShmConnection>(
+          fd, ring_capacity_, "shm:" + std::to_string(counter_++));
+
+      {
+        // Each connection occupies a thread while it is open
+        std::lock_guard<std::mutex> guard(connections_mutex_);
+        ++num_connections_;
+        if (num_connections_ > rpc_pool_->GetCapacity()) {
+          ARROW_WARN_NOT_OK(rpc_pool_->SetCapacity(num_connections_),
+                            "Failed to grow the thread pool");
+        }
+      }
+      auto submitted = rpc_pool_->Submit([this, conn]() { WorkerLoop(conn); });
+      ARROW_WARN_NOT_OK(submitted.status(), "Failed to submit task to handle client");
+    }
+  }
+
+  std::string path_;
+  int64_t ring_capacity_ = kDefaultRingCapacity;
+  int listen_fd_ = -1;
+  bool bound_ = false;
+  // Written to in order to wake up the listener thread
+  int wake_fds_[2] = {-1, -1};
+  Location location_;
+
+  // Counter for identifying peers
+  std::atomic<size_t> counter_{0};
+
+  std::shared_ptr<arrow::internal::ThreadPool> rpc_pool_;
+  std::atomic<bool> listening_{false};
+  std::thread listener_thread_;
+  // std::thread::join cannot be called concurrently
+  std::mutex join_mutex_;
+
+  std::mutex connections_mutex_;
+  int num_connections_ = 0;
+  // The connections waiting for their next call
+  std::unordered_set<ShmConnection*> idle_connections_;
+};
+}  // namespace
+
+std::unique_ptr<arrow::flight::internal::ServerTransport> MakeShmServerImpl(
+    FlightServerBase* base, std::shared_ptr<MemoryManager> memory_manager) {
+  return arrow::internal::make_unique<ShmServerImpl>(base, memory_manager);
+}
+
+#undef SERVER_RETURN_NOT_OK
+#undef FLIGHT_LOG
+#undef FLIGHT_LOG_PEER
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
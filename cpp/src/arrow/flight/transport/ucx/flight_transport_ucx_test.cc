@@ -18,6 +18,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <memory>
+
 #include "arrow/array/array_base.h"
 #include "arrow/flight/test_definitions.h"
 #include "arrow/flight/test_util.h"
@@ -223,6 +226,57 @@ TEST(HeadersFrame, Parse) {
         HeadersFrame::Parse(std::move(buffer)));
   }
 }
+
+TEST(UcpMappedBufferCache, ReuseBlocks) {
+  ucp_config_t* ucp_config;
+  ASSERT_OK(FromUcsStatus("ucp_config_read",
+                          ucp_config_read(nullptr, nullptr, &ucp_config)));
+  ucp_params_t ucp_params;
+  std::memset(&ucp_params, 0, sizeof(ucp_params));
+  ucp_params.field_mask = UCP_PARAM_FIELD_FEATURES;
+  ucp_params.features = UCP_FEATURE_AM;
+  ucp_context_h ucp_context;
+  auto status = ucp_init(&ucp_params, ucp_config, &ucp_context);
+  ucp_config_release(ucp_config);
+  ASSERT_OK(FromUcsStatus("ucp_init", status));
+  auto context = std::make_shared<UcpContext>(ucp_context);
+
+  ucp_worker_params_t worker_params;
+  std::memset(&worker_params, 0, sizeof(worker_params));
+  worker_params.field_mask = UCP_WORKER_PARAM_FIELD_THREAD_MODE;
+  worker_params.thread_mode = UCS_THREAD_MODE_SERIALIZED;
+  ucp_worker_h ucp_worker;
+  ASSERT_OK(FromUcsStatus("ucp_worker_create",
+                          ucp_worker_create(ucp_context, &worker_params, &ucp_worker)));
+  auto worker = std::make_shared<UcpWorker>(context, ucp_worker);
+
+  auto cache = std::make_shared<UcpMappedBufferCache>(worker, default_memory_pool(),
+                                                      /*max_cached_bytes=*/1 << 20);
+  const uint8_t* data = nullptr;
+  {
+    ASSERT_OK_AND_ASSIGN(auto buffer, cache->Allocate(300000));
+    ASSERT_EQ(300000, buffer->size());
+    ASSERT_TRUE(buffer->is_mutable());
+    std::memset(buffer->mutable_data(), 0xff, buffer->size());
+    data = buffer->data();
+    ASSERT_EQ(0, cache->cached_bytes());
+  }
+  // Released blocks are kept for messages of a similar size
+  ASSERT_EQ(1 << 19, cache->cached_bytes());
+  {
+    ASSERT_OK_AND_ASSIGN(auto buffer, cache->Allocate(400000));
+    ASSERT_EQ(data, buffer->data());
+    ASSERT_EQ(0, cache->cached_bytes());
+    ASSERT_OK_AND_ASSIGN(auto other, cache->Allocate(100000));
+    ASSERT_NE(data, other->data());
+  }
+  ASSERT_EQ((1 << 19) + (1 << 17), cache->cached_bytes());
+  {
+    // Blocks beyond the capacity of the cache are released
+    ASSERT_OK_AND_ASSIGN(auto buffer, cache->Allocate(1 << 20));
+  }
+  ASSERT_EQ((1 << 19) + (1 << 17), cache->cached_bytes());
+}
 }  // namespace ucx
 }  // namespace transport
 
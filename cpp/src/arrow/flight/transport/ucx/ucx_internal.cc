@@ -17,6 +17,7 @@
 
 #include "arrow/flight/transport/ucx/ucx_internal.h"
 
+#include <algorithm>
 #include <array>
 #include <limits>
 #include <mutex>
@@ -27,9 +28,11 @@
 #include "arrow/flight/types.h"
 #include "arrow/util/base64.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
 #include "arrow/util/uri.h"
+#include "arrow/util/value_parsing.h"
 
 namespace arrow {
 namespace flight {
@@ -47,7 +50,31 @@ using internal::TransportStatusCode;
 
 constexpr char kHeaderMethod[] = ":method:";
 
+// Payloads with a body at least this large are sent by rendezvous straight
+// from their registered buffers, and received into registered buffers. Can
+// be overridden with the ARROW_FLIGHT_UCX_ZERO_COPY_THRESHOLD environment
+// variable (in bytes, negative to disable).
+constexpr int64_t kDefaultZeroCopyThreshold = 1 << 20;
+// The capacity of the registered receive buffers kept for reuse by a call
+constexpr int64_t kMaxCachedMappedBytes = 64 << 20;
+
 namespace {
+int64_t GetDefaultZeroCopyThreshold() {
+  static const int64_t threshold = [] {
+    auto maybe_value =
+        arrow::internal::GetEnvVar("ARROW_FLIGHT_UCX_ZERO_COPY_THRESHOLD");
+    if (!maybe_value.ok()) return kDefaultZeroCopyThreshold;
+    int64_t value = 0;
+    if (!arrow::internal::ParseValue<Int64Type>(maybe_value->data(),
+                                                maybe_value->size(), &value)) {
+      ARROW_LOG(WARNING) << "Ignoring invalid ARROW_FLIGHT_UCX_ZERO_COPY_THRESHOLD: "
+                         << *maybe_value;
+      return kDefaultZeroCopyThreshold;
+    }
+    return value;
+  }();
+  return threshold;
+}
 Status SizeToUInt32BytesBe(const int64_t in, uint8_t* out) {
   if (ARROW_PREDICT_FALSE(in < 0)) {
     return Status::Invalid("Length cannot be negative");
@@ -116,6 +143,77 @@ class UcxDataBuffer : public Buffer {
 };
 };  // namespace
 
+/// \brief A buffer from a UcpMappedBufferCache, returning its block to
+///   the cache when destroyed.
+class UcpMappedBufferCache::MappedBuffer : public MutableBuffer {
+ public:
+  MappedBuffer(std::shared_ptr<UcpMappedBufferCache> cache, Block block, int64_t size)
+      : MutableBuffer(block.buffer->mutable_data(), size),
+        cache_(std::move(cache)),
+        block_(std::move(block)) {}
+
+  ~MappedBuffer() override { cache_->Release(std::move(block_)); }
+
+ private:
+  std::shared_ptr<UcpMappedBufferCache> cache_;
+  Block block_;
+};
+
+UcpMappedBufferCache::UcpMappedBufferCache(std::shared_ptr<UcpWorker> worker,
+                                           MemoryPool* memory_pool,
+                                           int64_t max_cached_bytes)
+    : worker_(std::move(worker)),
+      memory_pool_(memory_pool),
+      max_cached_bytes_(max_cached_bytes),
+      cached_bytes_(0) {}
+
+UcpMappedBufferCache::~UcpMappedBufferCache() {
+  for (auto& pair : free_blocks_) {
+    for (auto& block : pair.second) {
+      TryUnmapBuffer(worker_->context().get(), block.memh);
+    }
+  }
+}
+
+arrow::Result<std::unique_ptr<Buffer>> UcpMappedBufferCache::Allocate(int64_t size) {
+  // Round up so that messages of similar sizes share blocks
+  const int64_t capacity = bit_util::NextPower2(std::max<int64_t>(size, 1));
+  Block block;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = free_blocks_.find(capacity);
+    if (it != free_blocks_.end() && !it->second.empty()) {
+      block = std::move(it->second.back());
+      it->second.pop_back();
+      cached_bytes_ -= capacity;
+    }
+  }
+  if (!block.buffer) {
+    ARROW_ASSIGN_OR_RAISE(block.buffer, AllocateBuffer(capacity, memory_pool_));
+    TryMapBuffer(worker_->context().get(), *block.buffer, &block.memh);
+  }
+  return arrow::internal::make_unique<MappedBuffer>(shared_from_this(),
+                                                    std::move(block), size);
+}
+
+int64_t UcpMappedBufferCache::cached_bytes() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return cached_bytes_;
+}
+
+void UcpMappedBufferCache::Release(Block block) {
+  const int64_t capacity = block.buffer->size();
+  if (block.memh) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (cached_bytes_ + capacity <= max_cached_bytes_) {
+      free_blocks_[capacity].push_back(std::move(block));
+      cached_bytes_ += capacity;
+      return;
+    }
+  }
+  TryUnmapBuffer(worker_->context().get(), block.memh);
+}
+
 constexpr size_t FrameHeader::kFrameHeaderBytes;
 constexpr uint8_t FrameHeader::kFrameVersion;
 
@@ -419,6 +517,7 @@ class UcpCallDriver::Impl {
         read_memory_pool_(default_memory_pool()),
         write_memory_pool_(default_memory_pool()),
         memory_manager_(CPUDevice::Instance()->default_memory_manager()),
+        zero_copy_threshold_(GetDefaultZeroCopyThreshold()),
         name_("(unknown remote)"),
         counter_(0) {
 #if defined(ARROW_FLIGHT_UCX_SEND_IOV_MAP)
@@ -582,6 +681,11 @@ class UcpCallDriver::Impl {
     // as CONTIG, we can just send the metadata fields as part of the
     // IOV payload and avoid having to send two distinct messages.
 
+    // Large bodies are always sent by IOV and rendezvous, with their
+    // buffers registered, so that RDMA transports can read them
+    // straight from Arrow memory into the receiver's registered
+    // buffers without any bounce buffer.
+
     bool all_cpu = true;
     int32_t total_buffers = 0;
     for (const auto& buffer : payload.ipc_message.body_buffers) {
@@ -606,6 +710,12 @@ class UcpCallDriver::Impl {
     void* send_data = nullptr;
     size_t send_size = 0;
 
+    const bool zero_copy = all_cpu && zero_copy_threshold_ >= 0 &&
+                           payload.ipc_message.body_length >= zero_copy_threshold_;
+    if (zero_copy) {
+      request_param.flags |= UCP_AM_SEND_FLAG_RNDV;
+    }
+
     if (!all_cpu) {
       request_param.op_attr_mask =
           request_param.op_attr_mask | UCP_OP_ATTR_FIELD_MEMORY_TYPE;
@@ -614,7 +724,7 @@ class UcpCallDriver::Impl {
       request_param.memory_type = UCS_MEMORY_TYPE_CUDA;
     }
 
-    if (kEnableContigSend && all_cpu) {
+    if (kEnableContigSend && all_cpu && !zero_copy) {
       // CONTIG - concatenate buffers into one before sending
 
       // TODO(ARROW-16126): this needs to be pipelined since it can be expensive.
@@ -662,9 +772,11 @@ class UcpCallDriver::Impl {
       ucp_dt_iov_t* iov = pending_iov->iovs.data();
 #if defined(ARROW_FLIGHT_UCX_SEND_IOV_MAP)
       // XXX: this seems to have no benefits in tests so far
-      pending_iov->memh_ps.resize(total_buffers);
-      ucp_mem_h* memh_p = pending_iov->memh_ps.data();
+      constexpr bool kMapBuffers = true;
+#else
+      constexpr bool kMapBuffers = false;
 #endif
+      const bool map_buffers = kMapBuffers || zero_copy;
       for (const auto& buffer : payload.ipc_message.body_buffers) {
         if (!buffer || buffer->size() == 0) continue;
 
@@ -672,10 +784,11 @@ class UcpCallDriver::Impl {
         iov->length = buffer->size();
         ++iov;
 
-#if defined(ARROW_FLIGHT_UCX_SEND_IOV_MAP)
-        TryMapBuffer(worker_->context().get(), *buffer, memh_p);
-        memh_p++;
-#endif
+        if (map_buffers) {
+          ucp_mem_h memh_p = nullptr;
+          TryMapBuffer(worker_->context().get(), *buffer, &memh_p);
+          pending_iov->memh_ps.push_back(memh_p);
+        }
 
         const auto remainder = static_cast<int>(
             bit_util::RoundUpToMultipleOf8(buffer->size()) - buffer->size());
@@ -804,10 +917,12 @@ class UcpCallDriver::Impl {
   }
   void set_read_memory_pool(MemoryPool* pool) {
     read_memory_pool_ = pool ? pool : default_memory_pool();
+    mapped_buffers_.reset();
   }
   void set_write_memory_pool(MemoryPool* pool) {
     write_memory_pool_ = pool ? pool : default_memory_pool();
   }
+  void set_zero_copy_threshold(int64_t threshold) { zero_copy_threshold_ = threshold; }
   const std::string& peer() const { return name_; }
 
  private:
@@ -833,7 +948,6 @@ class UcpCallDriver::Impl {
    public:
     FlightPayload payload;
     std::vector<ucp_dt_iov_t> iovs;
-#if defined(ARROW_FLIGHT_UCX_SEND_IOV_MAP)
     std::vector<ucp_mem_h> memh_ps;
 
     virtual ~PendingIovSend() {
@@ -841,7 +955,6 @@ class UcpCallDriver::Impl {
         TryUnmapBuffer(driver->worker_->context().get(), memh_p);
       }
     }
-#endif
   };
 
   struct PendingAmRecv {
@@ -850,7 +963,7 @@ class UcpCallDriver::Impl {
     ucp_mem_h memh_p;
 
     PendingAmRecv(UcpCallDriver::Impl* driver_, std::shared_ptr<Frame> frame_)
-        : driver(driver_), frame(std::move(frame_)) {}
+        : driver(driver_), frame(std::move(frame_)), memh_p(nullptr) {}
 
     ~PendingAmRecv() { TryUnmapBuffer(driver->worker_->context().get(), memh_p); }
   };
@@ -926,7 +1039,19 @@ class UcpCallDriver::Impl {
       // UCS_INPROGRESS, kick off the allocation in the background,
       // and recv the data later (is it allowed to call
       // ucp_am_recv_data_nbx asynchronously?).
-      if (frame->type == FrameType::kPayloadBody) {
+      bool mapped = false;
+      if (frame->type == FrameType::kPayloadBody && memory_manager_->is_cpu() &&
+          zero_copy_threshold_ >= 0 &&
+          static_cast<int64_t>(data_length) >= zero_copy_threshold_) {
+        // Receive into registered memory, kept registered for reuse
+        if (!mapped_buffers_) {
+          mapped_buffers_ = std::make_shared<UcpMappedBufferCache>(
+              worker_, read_memory_pool_, kMaxCachedMappedBytes);
+        }
+        ARROW_ASSIGN_OR_RAISE(
+            frame->buffer, mapped_buffers_->Allocate(static_cast<int64_t>(data_length)));
+        mapped = true;
+      } else if (frame->type == FrameType::kPayloadBody) {
         ARROW_ASSIGN_OR_RAISE(frame->buffer,
                               memory_manager_->AllocateBuffer(data_length));
       } else {
@@ -935,8 +1060,10 @@ class UcpCallDriver::Impl {
       }
 
       PendingAmRecv* pending_recv = new PendingAmRecv(this, std::move(frame));
-      TryMapBuffer(worker_->context().get(), *pending_recv->frame->buffer,
-                   &pending_recv->memh_p);
+      if (!mapped) {
+        TryMapBuffer(worker_->context().get(), *pending_recv->frame->buffer,
+                     &pending_recv->memh_p);
+      }
 
       ucp_request_param_t recv_param;
       recv_param.op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK |
@@ -1016,6 +1143,9 @@ class UcpCallDriver::Impl {
   MemoryPool* read_memory_pool_;
   MemoryPool* write_memory_pool_;
   std::shared_ptr<MemoryManager> memory_manager_;
+  int64_t zero_copy_threshold_;
+  // Registered buffers for receiving large payload bodies, created on first use
+  std::shared_ptr<UcpMappedBufferCache> mapped_buffers_;
 
   // Internal name for logging/tracing
   std::string name_;
@@ -1096,6 +1226,9 @@ void UcpCallDriver::set_read_memory_pool(MemoryPool* pool) {
 void UcpCallDriver::set_write_memory_pool(MemoryPool* pool) {
   impl_->set_write_memory_pool(pool);
 }
+void UcpCallDriver::set_zero_copy_threshold(int64_t threshold) {
+  impl_->set_zero_copy_threshold(threshold);
+}
 const std::string& UcpCallDriver::peer() const { return impl_->peer(); }
 
 }  // namespace ucx
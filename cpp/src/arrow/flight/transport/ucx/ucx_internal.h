@@ -20,7 +20,10 @@
 #pragma once
 
 #include <array>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -111,6 +114,50 @@ class UcpWorker final {
   ucp_worker_h ucp_worker_;
 };
 
+/// \brief A cache of host buffers registered (mapped) with UCX.
+///
+/// Registering memory is expensive, but lets RDMA transports write
+/// into it directly. Large payload bodies are received into buffers
+/// from this cache, which return to it (still registered) once their
+/// last user releases them, so that following messages of a similar
+/// size reuse them instead of registering new memory.
+class ARROW_FLIGHT_EXPORT UcpMappedBufferCache
+    : public std::enable_shared_from_this<UcpMappedBufferCache> {
+ public:
+  /// \param[in] worker The worker whose context registers the buffers.
+  /// \param[in] memory_pool The pool allocating the buffers.
+  /// \param[in] max_cached_bytes The capacity of the unused buffers
+  ///   kept registered.
+  UcpMappedBufferCache(std::shared_ptr<UcpWorker> worker, MemoryPool* memory_pool,
+                       int64_t max_cached_bytes);
+  ~UcpMappedBufferCache();
+
+  /// \brief Get a registered buffer of the given size.
+  ///
+  /// Falls back to an unregistered buffer if registration fails.
+  arrow::Result<std::unique_ptr<Buffer>> Allocate(int64_t size);
+
+  /// \brief The capacity of the unused buffers currently cached.
+  int64_t cached_bytes() const;
+
+ private:
+  struct Block {
+    std::unique_ptr<Buffer> buffer;
+    ucp_mem_h memh = nullptr;
+  };
+  class MappedBuffer;
+
+  void Release(Block block);
+
+  std::shared_ptr<UcpWorker> worker_;
+  MemoryPool* memory_pool_;
+  const int64_t max_cached_bytes_;
+  mutable std::mutex mutex_;
+  int64_t cached_bytes_;
+  // Unused blocks by capacity (a power of two)
+  std::unordered_map<int64_t, std::vector<Block>> free_blocks_;
+};
+
 //------------------------------------------------------------
 // Message Framing
 
@@ -335,6 +382,9 @@ class UcpCallDriver {
   void set_read_memory_pool(MemoryPool* memory_pool);
   /// \brief Set memory pool for scratch space used during writing.
   void set_write_memory_pool(MemoryPool* memory_pool);
+  /// \brief Set the minimum body size of the payloads sent and received
+  ///   zero-copy, from and into registered memory (negative to disable).
+  void set_zero_copy_threshold(int64_t threshold);
   /// \brief Get a debug string naming the peer.
   const std::string& peer() const;
 
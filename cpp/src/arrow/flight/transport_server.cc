@@ -22,10 +22,12 @@
 #include "arrow/buffer.h"
 #include "arrow/flight/serialization_internal.h"
 #include "arrow/flight/server.h"
+#include "arrow/flight/stream_stats_middleware.h"
 #include "arrow/flight/types.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/byte_size.h"
 
 namespace arrow {
 namespace flight {
@@ -78,8 +80,10 @@ class TransportIpcMessageReader : public ipc::MessageReader {
 class TransportMessageReader final : public FlightMessageReader {
  public:
   TransportMessageReader(ServerDataStream* stream,
-                         std::shared_ptr<MemoryManager> memory_manager)
-      : peekable_reader_(new internal::PeekableFlightDataReader(stream)),
+                         std::shared_ptr<MemoryManager> memory_manager,
+                         std::shared_ptr<FlightStreamStats> stats)
+      : stats_(std::move(stats)),
+        peekable_reader_(new internal::PeekableFlightDataReader(stream, stats_.get())),
         memory_manager_(std::move(memory_manager)) {}
 
   Status Init() {
@@ -131,15 +135,25 @@ class TransportMessageReader final : public FlightMessageReader {
       // re-peek here since EnsureDataStarted() advances the stream
       return Next();
     }
-    RETURN_NOT_OK(batch_reader_->ReadNext(&out.data));
+    {
+      internal::StreamStatsCodecTimer timer(stats_.get());
+      RETURN_NOT_OK(batch_reader_->ReadNext(&out.data));
+    }
+    if (out.data) {
+      ++stats_->num_record_batches;
+      stats_->raw_body_bytes += util::TotalBufferSize(*out.data);
+    }
     out.app_metadata = std::move(app_metadata_);
     return out;
   }
 
+  FlightStreamStats stream_stats() const override { return *stats_; }
+
  private:
   /// Ensure we are set up to read data.
   Status EnsureDataStarted() {
     if (!batch_reader_) {
+      internal::StreamStatsCodecTimer timer(stats_.get());
       // peek() until we find the first data message; discard metadata
       if (!peekable_reader_->SkipToData()) {
         return Status::IOError("Client never sent a data message");
@@ -154,6 +168,7 @@ class TransportMessageReader final : public FlightMessageReader {
   }
 
   FlightDescriptor descriptor_;
+  std::shared_ptr<FlightStreamStats> stats_;
   std::shared_ptr<internal::PeekableFlightDataReader> peekable_reader_;
   std::shared_ptr<MemoryManager> memory_manager_;
   std::shared_ptr<RecordBatchReader> batch_reader_;
@@ -163,8 +178,11 @@ class TransportMessageReader final : public FlightMessageReader {
 // TODO(ARROW-10787): this should use the same writer/ipc trick as client
 class TransportMessageWriter final : public FlightMessageWriter {
  public:
-  explicit TransportMessageWriter(ServerDataStream* stream)
-      : stream_(stream), ipc_options_(::arrow::ipc::IpcWriteOptions::Defaults()) {}
+  TransportMessageWriter(ServerDataStream* stream,
+                         std::shared_ptr<FlightStreamStats> stream_stats)
+      : stream_(stream),
+        stream_stats_(std::move(stream_stats)),
+        ipc_options_(::arrow::ipc::IpcWriteOptions::Defaults()) {}
 
   Status Begin(const std::shared_ptr<Schema>& schema,
                const ipc::IpcWriteOptions& options) override {
@@ -194,6 +212,7 @@ class TransportMessageWriter final : public FlightMessageWriter {
   Status WriteWithMetadata(const RecordBatch& batch,
                            std::shared_ptr<Buffer> app_metadata) override {
     RETURN_NOT_OK(CheckStarted());
+    internal::StreamStatsCodecTimer timer(stream_stats_.get());
     RETURN_NOT_OK(EnsureDictionariesWritten(batch));
     FlightPayload payload{};
     if (app_metadata) {
@@ -212,9 +231,12 @@ class TransportMessageWriter final : public FlightMessageWriter {
 
   ipc::WriteStats stats() const override { return stats_; }
 
+  FlightStreamStats stream_stats() const override { return *stream_stats_; }
+
  private:
   Status WritePayload(const FlightPayload& payload) {
-    ARROW_ASSIGN_OR_RAISE(auto success, stream_->WriteData(payload));
+    ARROW_ASSIGN_OR_RAISE(auto success, internal::WriteDataWithStats(
+                                            stream_, payload, stream_stats_.get()));
     if (!success) {
       return MakeFlightError(FlightStatusCode::Internal,
                              "Could not write metadata to stream (client disconnect?)");
@@ -248,6 +270,7 @@ class TransportMessageWriter final : public FlightMessageWriter {
   }
 
   ServerDataStream* stream_;
+  std::shared_ptr<FlightStreamStats> stream_stats_;
   ::arrow::ipc::IpcWriteOptions ipc_options_;
   ipc::DictionaryFieldMapper mapper_;
   ipc::WriteStats stats_;
@@ -268,54 +291,80 @@ class TransportMetadataWriter final : public FlightMetadataWriter {
  private:
   ServerDataStream* stream_;
 };
-}  // namespace
-
-Status ServerTransport::DoGet(const ServerCallContext& context, const Ticket& ticket,
-                              ServerDataStream* stream) {
-  std::unique_ptr<FlightDataStream> data_stream;
-  RETURN_NOT_OK(base_->DoGet(context, ticket, &data_stream));
-
-  if (!data_stream) return Status::KeyError("No data in this flight");
 
+// Write out the payloads of a DoGet
+Status WriteDataStream(FlightDataStream* data_stream, ServerDataStream* stream,
+                       FlightStreamStats* stats) {
   // Write the schema as the first message in the stream
-  ARROW_ASSIGN_OR_RAISE(auto schema_payload, data_stream->GetSchemaPayload());
-  ARROW_ASSIGN_OR_RAISE(auto success, stream->WriteData(schema_payload));
+  FlightPayload schema_payload;
+  {
+    internal::StreamStatsCodecTimer timer(stats);
+    ARROW_ASSIGN_OR_RAISE(schema_payload, data_stream->GetSchemaPayload());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto success,
+                        internal::WriteDataWithStats(stream, schema_payload, stats));
   // Connection terminated
   if (!success) return Status::OK();
 
   // Consume data stream and write out payloads
   while (true) {
-    ARROW_ASSIGN_OR_RAISE(FlightPayload payload, data_stream->Next());
+    FlightPayload payload;
+    {
+      internal::StreamStatsCodecTimer timer(stats);
+      ARROW_ASSIGN_OR_RAISE(payload, data_stream->Next());
+    }
     // End of stream
     if (payload.ipc_message.metadata == nullptr) break;
-    ARROW_ASSIGN_OR_RAISE(auto success, stream->WriteData(payload));
+    ARROW_ASSIGN_OR_RAISE(auto success,
+                          internal::WriteDataWithStats(stream, payload, stats));
     // Connection terminated
     if (!success) return Status::OK();
   }
-  RETURN_NOT_OK(stream->WritesDone());
-  return Status::OK();
+  return stream->WritesDone();
+}
+}  // namespace
+
+Status ServerTransport::DoGet(const ServerCallContext& context, const Ticket& ticket,
+                              ServerDataStream* stream) {
+  std::unique_ptr<FlightDataStream> data_stream;
+  RETURN_NOT_OK(base_->DoGet(context, ticket, &data_stream));
+
+  if (!data_stream) return Status::KeyError("No data in this flight");
+
+  // Let streams producing ahead of the writes stop, also on early exits
+  FlightStreamStats written;
+  Status st = WriteDataStream(data_stream.get(), stream, &written);
+  st &= data_stream->Close();
+  ReportStreamStats(context, FlightStreamStats(), written, st);
+  return st;
 }
 
 Status ServerTransport::DoPut(const ServerCallContext& context,
                               ServerDataStream* stream) {
+  auto read = std::make_shared<FlightStreamStats>();
   std::unique_ptr<TransportMessageReader> reader(
-      new TransportMessageReader(stream, memory_manager_));
+      new TransportMessageReader(stream, memory_manager_, read));
   std::unique_ptr<FlightMetadataWriter> writer(new TransportMetadataWriter(stream));
-  RETURN_NOT_OK(reader->Init());
-  RETURN_NOT_OK(base_->DoPut(context, std::move(reader), std::move(writer)));
-  RETURN_NOT_OK(stream->WritesDone());
-  return Status::OK();
+  Status st = reader->Init();
+  if (st.ok()) st = base_->DoPut(context, std::move(reader), std::move(writer));
+  if (st.ok()) st = stream->WritesDone();
+  ReportStreamStats(context, *read, FlightStreamStats(), st);
+  return st;
 }
 
 Status ServerTransport::DoExchange(const ServerCallContext& context,
                                    ServerDataStream* stream) {
+  auto read = std::make_shared<FlightStreamStats>();
+  auto written = std::make_shared<FlightStreamStats>();
   std::unique_ptr<TransportMessageReader> reader(
-      new TransportMessageReader(stream, memory_manager_));
-  std::unique_ptr<FlightMessageWriter> writer(new TransportMessageWriter(stream));
-  RETURN_NOT_OK(reader->Init());
-  RETURN_NOT_OK(base_->DoExchange(context, std::move(reader), std::move(writer)));
-  RETURN_NOT_OK(stream->WritesDone());
-  return Status::OK();
+      new TransportMessageReader(stream, memory_manager_, read));
+  std::unique_ptr<FlightMessageWriter> writer(
+      new TransportMessageWriter(stream, written));
+  Status st = reader->Init();
+  if (st.ok()) st = base_->DoExchange(context, std::move(reader), std::move(writer));
+  if (st.ok()) st = stream->WritesDone();
+  ReportStreamStats(context, *read, *written, st);
+  return st;
 }
 
 }  // namespace internal
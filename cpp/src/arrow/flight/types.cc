@@ -369,6 +369,29 @@ bool ActionType::Equals(const ActionType& other) const {
 
 Status ResultStream::Next(std::unique_ptr<Result>* info) { return Next().Value(info); }
 
+double FlightStreamStats::compression_ratio() const {
+  if (serialized_body_bytes == 0) return 1.0;
+  return static_cast<double>(raw_body_bytes) / static_cast<double>(serialized_body_bytes);
+}
+
+std::string FlightStreamStats::ToString() const {
+  std::stringstream ss;
+  ss << "FlightStreamStats<messages=" << num_messages
+     << ", record_batches=" << num_record_batches << ", wire_bytes=" << wire_bytes
+     << ", compression_ratio=" << compression_ratio()
+     << ", codec_ms=" << static_cast<double>(codec_nanos) / 1e6
+     << ", transport_ms=" << static_cast<double>(transport_nanos) / 1e6;
+  if (num_oversized_writes > 0) {
+    ss << ", oversized_writes=" << num_oversized_writes;
+  }
+  ss << ">";
+  return ss.str();
+}
+
+FlightStreamStats MetadataRecordBatchReader::stream_stats() const {
+  return FlightStreamStats();
+}
+
 Status MetadataRecordBatchReader::Next(FlightStreamChunk* next) {
   return Next().Value(next);
 }
@@ -403,6 +426,10 @@ Status MetadataRecordBatchWriter::Begin(const std::shared_ptr<Schema>& schema) {
   return Begin(schema, ipc::IpcWriteOptions::Defaults());
 }
 
+FlightStreamStats MetadataRecordBatchWriter::stream_stats() const {
+  return FlightStreamStats();
+}
+
 namespace {
 class MetadataRecordBatchReaderAdapter : public RecordBatchReader {
  public:
@@ -523,11 +523,58 @@ struct ARROW_FLIGHT_EXPORT FlightStreamChunk {
   std::shared_ptr<Buffer> app_metadata;
 };
 
+/// \brief Statistics of one direction of a stream of Flight data.
+///
+/// Byte counts are those of the Flight messages (IPC metadata and
+/// body, and application metadata), not including the framing of the
+/// transport.  Comparing the time spent encoding or
+/// decoding with the time spent in the transport tells whether a
+/// slow transfer is bound by the CPU, or by the network and the peer.
+struct ARROW_FLIGHT_EXPORT FlightStreamStats {
+  /// \brief Number of messages, including metadata-only ones.
+  int64_t num_messages = 0;
+  /// \brief Number of record batches.
+  int64_t num_record_batches = 0;
+  /// \brief Total size of the messages.
+  int64_t wire_bytes = 0;
+  /// \brief Total size of the IPC bodies as sent, padded and possibly
+  ///   compressed.
+  int64_t serialized_body_bytes = 0;
+  /// \brief Total size of the IPC bodies before compression.
+  ///
+  /// Readers count the buffers of the decoded record batches.
+  int64_t raw_body_bytes = 0;
+  /// \brief Time spent encoding (writers) or decoding (readers) the
+  ///   messages, including compression, in nanoseconds.
+  ///
+  /// For DoGet, this includes the time the FlightDataStream takes to
+  /// produce its payloads.
+  int64_t codec_nanos = 0;
+  /// \brief Time spent in the transport, in nanoseconds.
+  ///
+  /// For writers, this includes the time writes are stalled by flow
+  /// control; for readers, the time waiting for the next message.
+  int64_t transport_nanos = 0;
+  /// \brief Number of writes rejected for exceeding the
+  ///   write_size_limit_bytes of the client.
+  int64_t num_oversized_writes = 0;
+
+  /// \brief The ratio of raw to serialized body sizes, 1 if nothing was sent.
+  double compression_ratio() const;
+
+  std::string ToString() const;
+};
+
 /// \brief An interface to read Flight data with metadata.
 class ARROW_FLIGHT_EXPORT MetadataRecordBatchReader {
  public:
   virtual ~MetadataRecordBatchReader() = default;
 
+  /// \brief Get the statistics of the stream read so far.
+  ///
+  /// Not thread-safe with concurrent reads.
+  virtual FlightStreamStats stream_stats() const;
+
   /// \brief Get the schema for this stream.
   virtual arrow::Result<std::shared_ptr<Schema>> GetSchema() = 0;
 
@@ -568,6 +615,11 @@ class ARROW_FLIGHT_EXPORT MetadataRecordBatchWriter : public ipc::RecordBatchWri
   virtual Status WriteMetadata(std::shared_ptr<Buffer> app_metadata) = 0;
   virtual Status WriteWithMetadata(const RecordBatch& batch,
                                    std::shared_ptr<Buffer> app_metadata) = 0;
+
+  /// \brief Get the statistics of the stream written so far.
+  ///
+  /// Not thread-safe with concurrent writes.
+  virtual FlightStreamStats stream_stats() const;
 };
 
 /// \brief A FlightListing implementation based on a vector of
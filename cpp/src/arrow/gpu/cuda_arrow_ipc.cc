@@ -18,10 +18,13 @@
 #include "arrow/gpu/cuda_arrow_ipc.h"
 
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <sstream>
+#include <utility>
 #include <vector>
 
+#include "arrow/array/data.h"
 #include "arrow/buffer.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
@@ -29,6 +32,7 @@
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/visibility.h"
 
 #include "generated/Message_generated.h"
@@ -65,5 +69,187 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
                               ipc::IpcReadOptions::Defaults());
 }
 
+namespace {
+
+// The alignment of the buffers packed in a staging buffer
+constexpr int64_t kStagingAlignment = 64;
+
+// Assign the offsets of the buffers of an array in a staging buffer, in the
+// order of RebuildOnDevice
+Status LayOutBuffers(const ArrayData& data, std::vector<int64_t>* offsets,
+                     int64_t* size) {
+  // The null counts are computed while the data is still on the host
+  data.GetNullCount();
+  for (const auto& buffer : data.buffers) {
+    if (buffer == nullptr) continue;
+    if (!buffer->is_cpu()) {
+      return Status::TypeError("Expected batches in CPU memory, got a buffer on ",
+                               buffer->device()->ToString());
+    }
+    *size = bit_util::RoundUp(*size, kStagingAlignment);
+    offsets->push_back(*size);
+    *size += buffer->size();
+  }
+  for (const auto& child : data.child_data) {
+    RETURN_NOT_OK(LayOutBuffers(*child, offsets, size));
+  }
+  if (data.dictionary != nullptr) {
+    RETURN_NOT_OK(LayOutBuffers(*data.dictionary, offsets, size));
+  }
+  return Status::OK();
+}
+
+void PackBuffers(const ArrayData& data, const std::vector<int64_t>& offsets,
+                 size_t* index, uint8_t* staging) {
+  for (const auto& buffer : data.buffers) {
+    if (buffer == nullptr) continue;
+    std::memcpy(staging + offsets[(*index)++], buffer->data(),
+                static_cast<size_t>(buffer->size()));
+  }
+  for (const auto& child : data.child_data) {
+    PackBuffers(*child, offsets, index, staging);
+  }
+  if (data.dictionary != nullptr) {
+    PackBuffers(*data.dictionary, offsets, index, staging);
+  }
+}
+
+// A copy of the array with its buffers sliced from the device copy of the
+// staging buffer
+std::shared_ptr<ArrayData> RebuildOnDevice(const ArrayData& data,
+                                           const std::shared_ptr<CudaBuffer>& device,
+                                           const std::vector<int64_t>& offsets,
+                                           size_t* index) {
+  auto out = std::make_shared<ArrayData>(data);
+  for (auto& buffer : out->buffers) {
+    if (buffer == nullptr) continue;
+    buffer = std::make_shared<CudaBuffer>(device, offsets[(*index)++], buffer->size());
+  }
+  for (auto& child : out->child_data) {
+    child = RebuildOnDevice(*child, device, offsets, index);
+  }
+  if (out->dictionary != nullptr) {
+    out->dictionary = RebuildOnDevice(*out->dictionary, device, offsets, index);
+  }
+  return out;
+}
+
+class DeviceRecordBatchReader : public RecordBatchReader {
+ public:
+  DeviceRecordBatchReader(std::shared_ptr<RecordBatchReader> reader,
+                          std::shared_ptr<CudaContext> ctx, int pipeline_depth)
+      : reader_(std::move(reader)), ctx_(std::move(ctx)), slots_(pipeline_depth) {}
+
+  ~DeviceRecordBatchReader() override {
+    // The staging buffers must outlive the copies in flight
+    for (int i = 0; i < num_in_flight_; ++i) {
+      const Slot& slot = slots_[(first_in_flight_ + i) % slots_.size()];
+      ARROW_WARN_NOT_OK(slot.stream->Synchronize(), "Failed to synchronize CUDA stream");
+    }
+  }
+
+  Status Init() {
+    for (auto& slot : slots_) {
+      ARROW_ASSIGN_OR_RAISE(slot.stream, ctx_->NewStream());
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return reader_->schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    // Keep the pipeline full: the next batches are read and packed while the
+    // copies of the previous ones are in flight
+    while (!input_finished_ && num_in_flight_ < static_cast<int>(slots_.size())) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(reader_->ReadNext(&batch));
+      if (batch == nullptr) {
+        input_finished_ = true;
+        break;
+      }
+      const size_t index = (first_in_flight_ + num_in_flight_) % slots_.size();
+      RETURN_NOT_OK(StartCopy(std::move(batch), &slots_[index]));
+      ++num_in_flight_;
+    }
+    if (num_in_flight_ == 0) {
+      *out = nullptr;
+      return Status::OK();
+    }
+
+    Slot& slot = slots_[first_in_flight_];
+    first_in_flight_ = (first_in_flight_ + 1) % slots_.size();
+    --num_in_flight_;
+    // The staging buffer may be reused once the copy is complete
+    RETURN_NOT_OK(slot.stream->Synchronize());
+
+    const RecordBatch& batch = *slot.host_batch;
+    std::vector<std::shared_ptr<ArrayData>> columns(batch.num_columns());
+    size_t index = 0;
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      columns[i] = RebuildOnDevice(*batch.column_data(i), slot.device, slot.offsets,
+                                   &index);
+    }
+    *out = RecordBatch::Make(batch.schema(), batch.num_rows(), std::move(columns));
+    slot.host_batch.reset();
+    slot.device.reset();
+    return Status::OK();
+  }
+
+ private:
+  struct Slot {
+    std::shared_ptr<CudaStream> stream;
+    std::shared_ptr<CudaHostBuffer> staging;
+    std::shared_ptr<RecordBatch> host_batch;
+    std::vector<int64_t> offsets;
+    std::shared_ptr<CudaBuffer> device;
+  };
+
+  Status StartCopy(std::shared_ptr<RecordBatch> batch, Slot* slot) {
+    slot->offsets.clear();
+    int64_t size = 0;
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      RETURN_NOT_OK(LayOutBuffers(*batch->column_data(i), &slot->offsets, &size));
+    }
+    if (slot->staging == nullptr || slot->staging->size() < size) {
+      slot->staging.reset();
+      ARROW_ASSIGN_OR_RAISE(slot->staging,
+                            AllocateCudaHostBuffer(ctx_->device_number(), size));
+    }
+    size_t index = 0;
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      PackBuffers(*batch->column_data(i), slot->offsets, &index,
+                  slot->staging->mutable_data());
+    }
+    ARROW_ASSIGN_OR_RAISE(slot->device, ctx_->Allocate(size));
+    if (size > 0) {
+      RETURN_NOT_OK(
+          slot->device->CopyFromHostAsync(0, slot->staging->data(), size, *slot->stream));
+    }
+    slot->host_batch = std::move(batch);
+    return Status::OK();
+  }
+
+  std::shared_ptr<RecordBatchReader> reader_;
+  std::shared_ptr<CudaContext> ctx_;
+  std::vector<Slot> slots_;
+  size_t first_in_flight_ = 0;
+  int num_in_flight_ = 0;
+  bool input_finished_ = false;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<RecordBatchReader>> MakeDeviceRecordBatchReader(
+    std::shared_ptr<RecordBatchReader> reader, std::shared_ptr<CudaContext> ctx,
+    int pipeline_depth) {
+  if (pipeline_depth < 1) {
+    return Status::Invalid("Pipeline depth must be at least 1, got ", pipeline_depth);
+  }
+  auto device_reader = std::make_shared<DeviceRecordBatchReader>(
+      std::move(reader), std::move(ctx), pipeline_depth);
+  RETURN_NOT_OK(device_reader->Init());
+  return device_reader;
+}
+
 }  // namespace cuda
 }  // namespace arrow
@@ -30,6 +30,7 @@ namespace arrow {
 
 class MemoryPool;
 class RecordBatch;
+class RecordBatchReader;
 class Schema;
 
 namespace ipc {
@@ -66,6 +67,28 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
     const std::shared_ptr<Schema>& schema, const ipc::DictionaryMemo* dictionary_memo,
     const std::shared_ptr<CudaBuffer>& buffer, MemoryPool* pool = default_memory_pool());
 
+/// \brief Copy the record batches of a reader to GPU device memory, pipelining
+/// the copies
+///
+/// Each batch is packed into a page-locked host staging buffer and copied to
+/// the device asynchronously, on a stream of its own. Up to `pipeline_depth`
+/// batches are in flight: the next batches are read from `reader` (e.g. decoded
+/// from an IPC stream or Flight) while the previous ones are being copied, and
+/// while the caller launches kernels on the batches already returned. The
+/// staging buffers are reused across batches.
+///
+/// The returned batches have the same layout as the input ones, with their
+/// buffers in device memory.
+///
+/// \param[in] reader the reader of the batches in CPU memory
+/// \param[in] ctx CudaContext to allocate device memory from
+/// \param[in] pipeline_depth the maximum number of batches being copied
+/// \return RecordBatchReader of the batches in device memory
+ARROW_EXPORT
+Result<std::shared_ptr<RecordBatchReader>> MakeDeviceRecordBatchReader(
+    std::shared_ptr<RecordBatchReader> reader, std::shared_ptr<CudaContext> ctx,
+    int pipeline_depth = 2);
+
 /// @}
 
 }  // namespace cuda
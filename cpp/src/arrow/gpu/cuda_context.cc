@@ -17,12 +17,15 @@
 
 #include "arrow/gpu/cuda_context.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -30,6 +33,7 @@
 
 #include "arrow/gpu/cuda_internal.h"
 #include "arrow/gpu/cuda_memory.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/make_unique.h"
 
@@ -66,6 +70,18 @@ struct DeviceProperties {
 
 const char kCudaDeviceTypeName[] = "arrow::cuda::CudaDevice";
 
+constexpr int64_t kMinCachedBlockSize = 512;
+
+// The size of the blocks cached for allocations of `nbytes`: four size classes
+// per power of two, so that at most a fifth of a block is wasted
+int64_t CachedBlockSize(int64_t nbytes) {
+  if (nbytes <= kMinCachedBlockSize) {
+    return kMinCachedBlockSize;
+  }
+  const int log2 = bit_util::NumRequiredBits(static_cast<uint64_t>(nbytes - 1)) - 1;
+  return bit_util::RoundUp(nbytes, int64_t(1) << (log2 - 2));
+}
+
 }  // namespace
 
 struct CudaDevice::Impl {
@@ -79,6 +95,12 @@ class CudaContext::Impl {
  public:
   Impl() : bytes_allocated_(0) {}
 
+  ~Impl() {
+    if (is_open_) {
+      ARROW_WARN_NOT_OK(ReleaseCachedMemory(), "Failed to release cached CUDA memory");
+    }
+  }
+
   Status Init(const std::shared_ptr<CudaDevice>& device) {
     mm_ = checked_pointer_cast<CudaMemoryManager>(device->default_memory_manager());
     props_ = &device->impl_->props;
@@ -99,6 +121,9 @@ class CudaContext::Impl {
   }
 
   Status Close() {
+    if (is_open_) {
+      RETURN_NOT_OK(ReleaseCachedMemory());
+    }
     if (is_open_ && own_context_) {
       CU_RETURN_NOT_OK("cuDevicePrimaryCtxRelease",
                        cuDevicePrimaryCtxRelease(props_->handle_));
@@ -109,16 +134,94 @@ class CudaContext::Impl {
 
   int64_t bytes_allocated() const { return bytes_allocated_.load(); }
 
+  int64_t max_memory() const {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    return max_memory_;
+  }
+
+  int64_t bytes_cached() const {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    return bytes_cached_;
+  }
+
+  int64_t memory_cache_limit() const {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    return cache_limit_;
+  }
+
+  Status SetMemoryCacheLimit(int64_t limit) {
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex_);
+      cache_limit_ = std::max<int64_t>(limit, 0);
+      if (bytes_cached_ <= cache_limit_) {
+        return Status::OK();
+      }
+    }
+    return ReleaseCachedMemory();
+  }
+
+  Status ReleaseCachedMemory() {
+    std::unordered_map<int64_t, std::vector<CUdeviceptr>> blocks;
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex_);
+      blocks.swap(cached_blocks_);
+      bytes_cached_ = 0;
+    }
+    if (blocks.empty()) {
+      return Status::OK();
+    }
+    ContextSaver set_temporary(context_);
+    Status st;
+    for (const auto& size_blocks : blocks) {
+      for (CUdeviceptr block : size_blocks.second) {
+        st &= internal::StatusFromCuda(cuMemFree(block), "cuMemFree");
+      }
+    }
+    return st;
+  }
+
   Status Allocate(int64_t nbytes, uint8_t** out) {
-    if (nbytes > 0) {
-      ContextSaver set_temporary(context_);
-      CUdeviceptr data;
-      CU_RETURN_NOT_OK("cuMemAlloc", cuMemAlloc(&data, static_cast<size_t>(nbytes)));
-      bytes_allocated_ += nbytes;
-      *out = reinterpret_cast<uint8_t*>(data);
-    } else {
+    if (nbytes <= 0) {
       *out = nullptr;
+      return Status::OK();
     }
+    int64_t alloc_size = nbytes;
+    bool by_size_class = false;
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex_);
+      if (cache_limit_ > 0) {
+        // Allocate whole blocks of a size class, so that they can be cached when freed
+        alloc_size = CachedBlockSize(nbytes);
+        by_size_class = true;
+        auto it = cached_blocks_.find(alloc_size);
+        if (it != cached_blocks_.end() && !it->second.empty()) {
+          CUdeviceptr data = it->second.back();
+          it->second.pop_back();
+          bytes_cached_ -= alloc_size;
+          cacheable_blocks_.insert(data);
+          RecordAllocation(nbytes);
+          *out = reinterpret_cast<uint8_t*>(data);
+          return Status::OK();
+        }
+      }
+    }
+    ContextSaver set_temporary(context_);
+    CUdeviceptr data;
+    CUresult res = cuMemAlloc(&data, static_cast<size_t>(alloc_size));
+    if (res == CUDA_ERROR_OUT_OF_MEMORY) {
+      // Retry once the cached blocks are returned to the device
+      RETURN_NOT_OK(ReleaseCachedMemory());
+      res = cuMemAlloc(&data, static_cast<size_t>(alloc_size));
+    }
+    CU_RETURN_NOT_OK("cuMemAlloc", res);
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex_);
+      if (by_size_class) {
+        cacheable_blocks_.insert(data);
+      }
+      RecordAllocation(nbytes);
+    }
+    *out = reinterpret_cast<uint8_t*>(data);
     return Status::OK();
   }
 
@@ -149,15 +252,53 @@ class CudaContext::Impl {
     return Status::OK();
   }
 
+  Status CopyHostToDeviceAsync(uintptr_t dst, const void* src, int64_t nbytes,
+                               CUstream stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK("cuMemcpyHtoDAsync",
+                     cuMemcpyHtoDAsync(dst, src, static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
+  Status CopyDeviceToHostAsync(void* dst, uintptr_t src, int64_t nbytes,
+                               CUstream stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK("cuMemcpyDtoHAsync",
+                     cuMemcpyDtoHAsync(dst, src, static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
   Status Synchronize(void) {
     ContextSaver set_temporary(context_);
     CU_RETURN_NOT_OK("cuCtxSynchronize", cuCtxSynchronize());
     return Status::OK();
   }
 
+  Result<CUstream> NewStream() {
+    ContextSaver set_temporary(context_);
+    CUstream stream;
+    CU_RETURN_NOT_OK("cuStreamCreate", cuStreamCreate(&stream, CU_STREAM_NON_BLOCKING));
+    return stream;
+  }
+
   Status Free(void* device_ptr, int64_t nbytes) {
-    CU_RETURN_NOT_OK("cuMemFree", cuMemFree(reinterpret_cast<CUdeviceptr>(device_ptr)));
-    bytes_allocated_ -= nbytes;
+    auto data = reinterpret_cast<CUdeviceptr>(device_ptr);
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex_);
+      bytes_allocated_ -= nbytes;
+      // Only the blocks allocated by size class may be cached: the others can be
+      // smaller than the blocks of their class.
+      if (cacheable_blocks_.erase(data) > 0) {
+        const int64_t block_size = CachedBlockSize(nbytes);
+        if (bytes_cached_ + block_size <= cache_limit_) {
+          cached_blocks_[block_size].push_back(data);
+          bytes_cached_ += block_size;
+          return Status::OK();
+        }
+      }
+    }
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK("cuMemFree", cuMemFree(data));
     return Status::OK();
   }
 
@@ -197,15 +338,30 @@ class CudaContext::Impl {
   void* context_handle() const { return reinterpret_cast<void*>(context_); }
 
  private:
+  // Must be called with cache_mutex_ held
+  void RecordAllocation(int64_t nbytes) {
+    bytes_allocated_ += nbytes;
+    max_memory_ = std::max(max_memory_, bytes_allocated_.load());
+  }
+
   std::shared_ptr<CudaMemoryManager> mm_;
   const DeviceProperties* props_;
   CUcontext context_;
-  bool is_open_;
+  bool is_open_ = false;
 
   // So that we can utilize a CUcontext that was created outside this library
   bool own_context_;
 
   std::atomic<int64_t> bytes_allocated_;
+
+  // The cache of freed device memory blocks, by size class
+  mutable std::mutex cache_mutex_;
+  int64_t max_memory_ = 0;
+  int64_t bytes_cached_ = 0;
+  int64_t cache_limit_ = 0;
+  std::unordered_map<int64_t, std::vector<CUdeviceptr>> cached_blocks_;
+  // The live blocks which were allocated by size class
+  std::unordered_set<CUdeviceptr> cacheable_blocks_;
 };
 
 // ----------------------------------------------------------------------
@@ -412,6 +568,27 @@ Result<std::shared_ptr<CudaMemoryManager>> AsCudaMemoryManager(
   }
 }
 
+// ----------------------------------------------------------------------
+// CudaStream implementation
+
+CudaStream::CudaStream(std::shared_ptr<CudaContext> context, void* stream)
+    : context_(std::move(context)), stream_(stream) {}
+
+CudaStream::~CudaStream() {
+  ContextSaver set_temporary(*context_);
+  ARROW_WARN_NOT_OK(internal::StatusFromCuda(
+                        cuStreamDestroy(reinterpret_cast<CUstream>(stream_)),
+                        "cuStreamDestroy"),
+                    "Failed to destroy CUDA stream");
+}
+
+Status CudaStream::Synchronize() {
+  ContextSaver set_temporary(*context_);
+  CU_RETURN_NOT_OK("cuStreamSynchronize",
+                   cuStreamSynchronize(reinterpret_cast<CUstream>(stream_)));
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // CudaDeviceManager implementation
 
@@ -593,14 +770,49 @@ Status CudaContext::CopyDeviceToAnotherDevice(const std::shared_ptr<CudaContext>
                                           reinterpret_cast<uintptr_t>(src), nbytes);
 }
 
+Status CudaContext::CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes,
+                                          const CudaStream& stream) {
+  if (stream.context().get() != this) {
+    return Status::Invalid("CUDA stream belongs to another context");
+  }
+  return impl_->CopyHostToDeviceAsync(reinterpret_cast<uintptr_t>(dst), src, nbytes,
+                                      reinterpret_cast<CUstream>(stream.handle()));
+}
+
+Status CudaContext::CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes,
+                                          const CudaStream& stream) {
+  if (stream.context().get() != this) {
+    return Status::Invalid("CUDA stream belongs to another context");
+  }
+  return impl_->CopyDeviceToHostAsync(dst, reinterpret_cast<uintptr_t>(src), nbytes,
+                                      reinterpret_cast<CUstream>(stream.handle()));
+}
+
 Status CudaContext::Synchronize(void) { return impl_->Synchronize(); }
 
+Result<std::shared_ptr<CudaStream>> CudaContext::NewStream() {
+  ARROW_ASSIGN_OR_RAISE(CUstream stream, impl_->NewStream());
+  return std::shared_ptr<CudaStream>(new CudaStream(shared_from_this(), stream));
+}
+
 Status CudaContext::Close() { return impl_->Close(); }
 
 Status CudaContext::Free(void* device_ptr, int64_t nbytes) {
   return impl_->Free(device_ptr, nbytes);
 }
 
+int64_t CudaContext::max_memory() const { return impl_->max_memory(); }
+
+int64_t CudaContext::bytes_cached() const { return impl_->bytes_cached(); }
+
+int64_t CudaContext::memory_cache_limit() const { return impl_->memory_cache_limit(); }
+
+Status CudaContext::SetMemoryCacheLimit(int64_t limit) {
+  return impl_->SetMemoryCacheLimit(limit);
+}
+
+Status CudaContext::ReleaseCachedMemory() { return impl_->ReleaseCachedMemory(); }
+
 Result<std::shared_ptr<CudaBuffer>> CudaContext::OpenIpcBuffer(
     const CudaIpcMemHandle& ipc_handle) {
   if (ipc_handle.memory_size() > 0) {
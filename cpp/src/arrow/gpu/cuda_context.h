@@ -36,6 +36,7 @@ class CudaBuffer;
 class CudaHostBuffer;
 class CudaIpcMemHandle;
 class CudaMemoryManager;
+class CudaStream;
 
 // XXX Should CudaContext be merged into CudaMemoryManager?
 
@@ -252,8 +253,41 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   /// \brief Block until the all device tasks are completed.
   Status Synchronize(void);
 
+  /// \brief Create a stream on which asynchronous operations of this context
+  /// can be ordered
+  ///
+  /// The stream doesn't synchronize with the legacy default stream, which the
+  /// synchronous copies of this library use.
+  Result<std::shared_ptr<CudaStream>> NewStream();
+
+  /// \brief The number of bytes of the live buffers allocated by this context
   int64_t bytes_allocated() const;
 
+  /// \brief The peak of bytes_allocated()
+  int64_t max_memory() const;
+
+  /// \brief The number of bytes of the freed device memory blocks kept for reuse
+  int64_t bytes_cached() const;
+
+  /// \brief The maximum number of bytes of freed device memory kept for reuse
+  ///
+  /// The cache is disabled (0) by default.
+  int64_t memory_cache_limit() const;
+
+  /// \brief Keep up to `limit` bytes of freed device memory for reuse
+  ///
+  /// When the cache is enabled, allocations are rounded up to size classes (by at
+  /// most a fifth), and the freed blocks are handed to later allocations of the same
+  /// class without calling the driver. Unlike cuMemFree, freeing a buffer into the
+  /// cache doesn't synchronize the device: the caller must ensure that any kernel
+  /// using a buffer has completed before the buffer is released.
+  ///
+  /// Blocks exceeding the new limit are returned to the device.
+  Status SetMemoryCacheLimit(int64_t limit);
+
+  /// \brief Return the cached device memory blocks to the device
+  Status ReleaseCachedMemory();
+
   /// \brief Expose CUDA context handle to other libraries
   void* handle() const;
 
@@ -289,6 +323,10 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   Status CopyHostToDevice(uintptr_t dst, const void* src, int64_t nbytes);
   Status CopyDeviceToHost(void* dst, const void* src, int64_t nbytes);
   Status CopyDeviceToHost(void* dst, uintptr_t src, int64_t nbytes);
+  Status CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes,
+                               const CudaStream& stream);
+  Status CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes,
+                               const CudaStream& stream);
   Status CopyDeviceToDevice(void* dst, const void* src, int64_t nbytes);
   Status CopyDeviceToDevice(uintptr_t dst, uintptr_t src, int64_t nbytes);
   Status CopyDeviceToAnotherDevice(const std::shared_ptr<CudaContext>& dst_ctx, void* dst,
@@ -310,5 +348,33 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   /// \endcond
 };
 
+/// \class CudaStream
+/// \brief A CUDA stream, on which asynchronous copies and kernel launches are
+/// executed in order
+///
+/// The operations of different streams may overlap, e.g. copies from host to
+/// device with kernels working on previously copied data.
+class ARROW_EXPORT CudaStream {
+ public:
+  ~CudaStream();
+
+  /// \brief Block until the operations enqueued on this stream are completed
+  Status Synchronize();
+
+  /// \brief Expose the CUstream handle to other libraries (e.g. to launch kernels)
+  void* handle() const { return stream_; }
+
+  /// \brief The context this stream belongs to
+  const std::shared_ptr<CudaContext>& context() const { return context_; }
+
+ private:
+  CudaStream(std::shared_ptr<CudaContext> context, void* stream);
+
+  std::shared_ptr<CudaContext> context_;
+  void* stream_;
+
+  friend class CudaContext;
+};
+
 }  // namespace cuda
 }  // namespace arrow
@@ -29,6 +29,7 @@ namespace cuda {
 
 class CudaContext;
 class CudaIpcMemHandle;
+class CudaStream;
 
 /// \class CudaBuffer
 /// \brief An Arrow buffer located on a GPU device
@@ -70,6 +71,31 @@ class ARROW_EXPORT CudaBuffer : public Buffer {
   /// \return Status
   Status CopyFromHost(const int64_t position, const void* data, int64_t nbytes);
 
+  /// \brief Enqueue a copy of memory from GPU device to CPU host on a stream
+  /// \param[in] position start position inside buffer to copy bytes from
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[out] out start address of the host memory area to copy to
+  /// \param[in] stream the stream to enqueue the copy on
+  /// \return Status
+  ///
+  /// \note The copy only runs asynchronously if the host memory is page-locked
+  /// (e.g. a CudaHostBuffer). `out` may be read once the stream is synchronized.
+  Status CopyToHostAsync(const int64_t position, const int64_t nbytes, void* out,
+                         const CudaStream& stream) const;
+
+  /// \brief Enqueue a copy of memory from CPU host to device at position on a stream
+  /// \param[in] position start position to copy bytes to
+  /// \param[in] data the host data to copy
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[in] stream the stream to enqueue the copy on
+  /// \return Status
+  ///
+  /// \note The copy only runs asynchronously if the host memory is page-locked
+  /// (e.g. a CudaHostBuffer). `data` must not be modified until the stream is
+  /// synchronized.
+  Status CopyFromHostAsync(const int64_t position, const void* data, int64_t nbytes,
+                           const CudaStream& stream);
+
   /// \brief Copy memory from device to device at position
   /// \param[in] position start position inside buffer to copy bytes to
   /// \param[in] data start address of the device memory area to copy from
@@ -255,6 +255,44 @@ TEST_F(TestCudaBuffer, Allocate) {
   ASSERT_FALSE(buffer->is_cpu());
 }
 
+TEST_F(TestCudaBuffer, CachedAllocate) {
+  const int64_t initial_allocated = context_->bytes_allocated();
+  ASSERT_EQ(0, context_->memory_cache_limit());
+  ASSERT_OK(context_->SetMemoryCacheLimit(1 << 20));
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, context_->Allocate(1000));
+  const uint8_t* address = buffer->data();
+  ASSERT_EQ(initial_allocated + 1000, context_->bytes_allocated());
+  ASSERT_GE(context_->max_memory(), context_->bytes_allocated());
+  buffer.reset();
+  ASSERT_EQ(initial_allocated, context_->bytes_allocated());
+  // 1000 bytes are allocated in a block of 1024
+  ASSERT_EQ(1024, context_->bytes_cached());
+
+  // An allocation of the same size class reuses the block
+  ASSERT_OK_AND_ASSIGN(buffer, context_->Allocate(1010));
+  ASSERT_EQ(address, buffer->data());
+  ASSERT_EQ(0, context_->bytes_cached());
+  ASSERT_OK(buffer->CopyFromHost(0, std::string(1010, 'x').data(), 1010));
+  buffer.reset();
+
+  // Blocks exceeding the limit aren't cached
+  ASSERT_OK_AND_ASSIGN(buffer, context_->Allocate(2 << 20));
+  buffer.reset();
+  ASSERT_EQ(1024, context_->bytes_cached());
+
+  ASSERT_OK(context_->ReleaseCachedMemory());
+  ASSERT_EQ(0, context_->bytes_cached());
+
+  // Buffers allocated while the cache is disabled are never cached
+  ASSERT_OK(context_->SetMemoryCacheLimit(0));
+  ASSERT_OK_AND_ASSIGN(buffer, context_->Allocate(1000));
+  ASSERT_OK(context_->SetMemoryCacheLimit(1 << 20));
+  buffer.reset();
+  ASSERT_EQ(0, context_->bytes_cached());
+  ASSERT_OK(context_->SetMemoryCacheLimit(0));
+}
+
 TEST_F(TestCudaBuffer, CopyFromHost) {
   const int64_t kSize = 1000;
   std::shared_ptr<CudaBuffer> device_buffer;
@@ -640,5 +678,100 @@ TEST_F(TestCudaArrowIpc, DictionaryWriteRead) {
   CompareBatch(*batch, *cpu_batch);
 }
 
+// Copy an array tree from device memory to CPU memory
+Result<std::shared_ptr<ArrayData>> CopyDataToCpu(
+    const ArrayData& data, const std::shared_ptr<MemoryManager>& mm) {
+  auto out = std::make_shared<ArrayData>(data);
+  for (auto& buffer : out->buffers) {
+    if (buffer == nullptr) continue;
+    if (!IsCudaDevice(*buffer->device())) {
+      return Status::Invalid("Buffer is not on the device");
+    }
+    ARROW_ASSIGN_OR_RAISE(buffer, Buffer::Copy(buffer, mm));
+  }
+  for (auto& child : out->child_data) {
+    ARROW_ASSIGN_OR_RAISE(child, CopyDataToCpu(*child, mm));
+  }
+  if (out->dictionary != nullptr) {
+    ARROW_ASSIGN_OR_RAISE(out->dictionary, CopyDataToCpu(*out->dictionary, mm));
+  }
+  return out;
+}
+
+TEST_F(TestCudaArrowIpc, DeviceRecordBatchReader) {
+  RecordBatchVector batches(5);
+  ASSERT_OK(ipc::test::MakeIntRecordBatch(&batches[0]));
+  ASSERT_OK(ipc::test::MakeIntRecordBatch(&batches[1]));
+  batches[1] = batches[1]->Slice(3, 10);
+  ASSERT_OK(ipc::test::MakeIntRecordBatch(&batches[2]));
+  batches[3] = batches[2]->Slice(0, 0);
+  ASSERT_OK(ipc::test::MakeIntRecordBatch(&batches[4]));
+
+  for (int pipeline_depth : {1, 2, 8}) {
+    ARROW_SCOPED_TRACE("pipeline_depth = ", pipeline_depth);
+    ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make(batches));
+    ASSERT_OK_AND_ASSIGN(auto device_reader,
+                         MakeDeviceRecordBatchReader(reader, context_, pipeline_depth));
+    AssertSchemaEqual(*batches[0]->schema(), *device_reader->schema());
+    for (const auto& batch : batches) {
+      std::shared_ptr<RecordBatch> device_batch;
+      ASSERT_OK(device_reader->ReadNext(&device_batch));
+      ASSERT_NE(device_batch, nullptr);
+      ASSERT_EQ(device_batch->num_rows(), batch->num_rows());
+
+      std::vector<std::shared_ptr<ArrayData>> columns;
+      for (const auto& column : device_batch->column_data()) {
+        ASSERT_OK_AND_ASSIGN(auto cpu_column, CopyDataToCpu(*column, cpu_mm_));
+        columns.push_back(std::move(cpu_column));
+      }
+      auto cpu_batch =
+          RecordBatch::Make(batch->schema(), batch->num_rows(), std::move(columns));
+      ASSERT_OK(cpu_batch->ValidateFull());
+      CompareBatch(*batch, *cpu_batch);
+    }
+    std::shared_ptr<RecordBatch> end;
+    ASSERT_OK(device_reader->ReadNext(&end));
+    ASSERT_EQ(end, nullptr);
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make(batches));
+  ASSERT_RAISES(Invalid, MakeDeviceRecordBatchReader(reader, context_, 0));
+}
+
+TEST_F(TestCudaArrowIpc, DeviceRecordBatchReaderDictionary) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::test::MakeDictionary(&batch));
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make({batch, batch}));
+  ASSERT_OK_AND_ASSIGN(auto device_reader, MakeDeviceRecordBatchReader(reader, context_));
+  for (int i = 0; i < 2; ++i) {
+    std::shared_ptr<RecordBatch> device_batch;
+    ASSERT_OK(device_reader->ReadNext(&device_batch));
+    std::vector<std::shared_ptr<ArrayData>> columns;
+    for (const auto& column : device_batch->column_data()) {
+      ASSERT_OK_AND_ASSIGN(auto cpu_column, CopyDataToCpu(*column, cpu_mm_));
+      columns.push_back(std::move(cpu_column));
+    }
+    CompareBatch(*batch, *RecordBatch::Make(batch->schema(), batch->num_rows(),
+                                            std::move(columns)));
+  }
+}
+
+TEST_F(TestCudaArrowIpc, AsyncCopies) {
+  const int64_t kSize = 1000;
+  ASSERT_OK_AND_ASSIGN(auto stream, context_->NewStream());
+  ASSERT_OK_AND_ASSIGN(auto host_buffer, AllocateCudaHostBuffer(kGpuNumber, kSize));
+  ASSERT_OK_AND_ASSIGN(auto other_host_buffer,
+                       AllocateCudaHostBuffer(kGpuNumber, kSize));
+  random_bytes(kSize, 0, host_buffer->mutable_data());
+  ASSERT_OK_AND_ASSIGN(auto device_buffer, context_->Allocate(kSize));
+  ASSERT_OK(device_buffer->CopyFromHostAsync(0, host_buffer->data(), kSize, *stream));
+  ASSERT_OK(device_buffer->CopyToHostAsync(0, kSize, other_host_buffer->mutable_data(),
+                                           *stream));
+  ASSERT_OK(stream->Synchronize());
+  AssertBufferEqual(*host_buffer, *other_host_buffer);
+  ASSERT_RAISES(Invalid, device_buffer->CopyFromHostAsync(1, host_buffer->data(), kSize,
+                                                          *stream));
+}
+
 }  // namespace cuda
 }  // namespace arrow
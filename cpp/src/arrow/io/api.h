@@ -23,3 +23,4 @@
 #include "arrow/io/hdfs.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/shared_memory.h"
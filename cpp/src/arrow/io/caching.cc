@@ -17,8 +17,12 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cmath>
 #include <mutex>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -35,15 +39,37 @@ namespace io {
 CacheOptions CacheOptions::Defaults() {
   return CacheOptions{internal::ReadRangeCache::kDefaultHoleSizeLimit,
                       internal::ReadRangeCache::kDefaultRangeSizeLimit,
-                      /*lazy=*/false};
+                      /*lazy=*/false, /*adaptive=*/false};
 }
 
 CacheOptions CacheOptions::LazyDefaults() {
   return CacheOptions{internal::ReadRangeCache::kDefaultHoleSizeLimit,
                       internal::ReadRangeCache::kDefaultRangeSizeLimit,
-                      /*lazy=*/true};
+                      /*lazy=*/true, /*adaptive=*/false};
 }
 
+namespace {
+
+CacheOptions MakeFromMetrics(double time_to_first_byte_sec,
+                             double transfer_bandwidth_bytes_per_sec,
+                             double ideal_bandwidth_utilization_frac,
+                             int64_t max_ideal_request_size_bytes) {
+  // hole_size_limit = TTFB * BW
+  const auto hole_size_limit = static_cast<int64_t>(
+      std::round(time_to_first_byte_sec * transfer_bandwidth_bytes_per_sec));
+
+  // range_size_limit = min(MAX_IDEAL_REQUEST_SIZE,
+  //                        hole_size_limit * BW_util_frac / (1 - BW_util_frac))
+  const int64_t range_size_limit = std::min(
+      max_ideal_request_size_bytes,
+      static_cast<int64_t>(std::round(hole_size_limit * ideal_bandwidth_utilization_frac /
+                                      (1 - ideal_bandwidth_utilization_frac))));
+
+  return {hole_size_limit, range_size_limit, /*lazy=*/false, /*adaptive=*/false};
+}
+
+}  // namespace
+
 CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_millis,
                                                   int64_t transfer_bandwidth_mib_per_sec,
                                                   double ideal_bandwidth_utilization_frac,
@@ -107,28 +133,77 @@ CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_mil
       << "Ideal bandwidth utilization fraction must be < 1";
   DCHECK_GT(max_ideal_request_size_mib, 0) << "Max Ideal request size must be > 0";
 
-  const double time_to_first_byte_sec = time_to_first_byte_millis / 1000.0;
-  const int64_t transfer_bandwidth_bytes_per_sec =
-      transfer_bandwidth_mib_per_sec * 1024 * 1024;
-  const int64_t max_ideal_request_size_bytes = max_ideal_request_size_mib * 1024 * 1024;
+  const CacheOptions options = MakeFromMetrics(
+      time_to_first_byte_millis / 1000.0,
+      static_cast<double>(transfer_bandwidth_mib_per_sec * 1024 * 1024),
+      ideal_bandwidth_utilization_frac, max_ideal_request_size_mib * 1024 * 1024);
+  DCHECK_GT(options.hole_size_limit, 0) << "Computed hole_size_limit must be > 0";
+  DCHECK_GT(options.range_size_limit, 0) << "Computed range_size_limit must be > 0";
+  return options;
+}
 
-  // hole_size_limit = TTFB * BW
-  const auto hole_size_limit = static_cast<int64_t>(
-      std::round(time_to_first_byte_sec * transfer_bandwidth_bytes_per_sec));
-  DCHECK_GT(hole_size_limit, 0) << "Computed hole_size_limit must be > 0";
+namespace internal {
 
-  // range_size_limit = min(MAX_IDEAL_REQUEST_SIZE,
-  //                        hole_size_limit * BW_util_frac / (1 - BW_util_frac))
-  const int64_t range_size_limit = std::min(
-      max_ideal_request_size_bytes,
-      static_cast<int64_t>(std::round(hole_size_limit * ideal_bandwidth_utilization_frac /
-                                      (1 - ideal_bandwidth_utilization_frac))));
-  DCHECK_GT(range_size_limit, 0) << "Computed range_size_limit must be > 0";
+constexpr int64_t ReadLatencyModel::kMinSamples;
+
+namespace {
+
+// The weight lost by past reads each time a read is recorded
+constexpr double kLatencyModelDecay = 0.05;
+
+// Bounds of adaptive coalescing limits, should the estimates be extreme
+constexpr int64_t kMinAdaptiveHoleSizeLimit = 1024;
+constexpr int64_t kMaxAdaptiveHoleSizeLimit = 8 * 1024 * 1024;
+
+constexpr double kBytesPerMiB = 1024 * 1024;
 
-  return {hole_size_limit, range_size_limit, false};
+}  // namespace
+
+void ReadLatencyModel::Record(int64_t nbytes, double seconds) {
+  const double x = nbytes / kBytesPerMiB;
+  std::lock_guard<std::mutex> lock(mutex_);
+  const double keep = 1 - kLatencyModelDecay;
+  sum_weights_ = sum_weights_ * keep + 1;
+  sum_x_ = sum_x_ * keep + x;
+  sum_y_ = sum_y_ * keep + seconds;
+  sum_xx_ = sum_xx_ * keep + x * x;
+  sum_xy_ = sum_xy_ * keep + x * seconds;
+  ++num_samples_;
 }
 
-namespace internal {
+bool ReadLatencyModel::Estimate(double* time_to_first_byte, double* bandwidth) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (num_samples_ < kMinSamples) {
+    return false;
+  }
+  const double mean_x = sum_x_ / sum_weights_;
+  const double mean_y = sum_y_ / sum_weights_;
+  const double var_x = sum_xx_ / sum_weights_ - mean_x * mean_x;
+  const double cov_xy = sum_xy_ / sum_weights_ - mean_x * mean_y;
+  // Sizes need to vary for the slope to be meaningful
+  if (!(var_x > 0.01 * mean_x * mean_x)) {
+    return false;
+  }
+  const double seconds_per_mib = cov_xy / var_x;
+  if (!(seconds_per_mib > 0)) {
+    return false;
+  }
+  *bandwidth = kBytesPerMiB / seconds_per_mib;
+  *time_to_first_byte = std::max(0.0, mean_y - seconds_per_mib * mean_x);
+  return true;
+}
+
+std::shared_ptr<ReadLatencyModel> ReadLatencyModel::ForFile(
+    const RandomAccessFile& file) {
+  static std::mutex mutex;
+  static std::unordered_map<std::type_index, std::shared_ptr<ReadLatencyModel>> models;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& model = models[std::type_index(typeid(file))];
+  if (!model) {
+    model = std::make_shared<ReadLatencyModel>();
+  }
+  return model;
+}
 
 struct RangeCacheEntry {
   ReadRange range;
@@ -152,8 +227,59 @@ struct ReadRangeCache::Impl {
   // Ordered by offset (so as to find a matching region by binary search)
   std::vector<RangeCacheEntry> entries;
 
+  // Set if the options are adaptive
+  std::shared_ptr<ReadLatencyModel> latency_model;
+
+  std::atomic<int64_t> num_hits{0};
+  std::atomic<int64_t> num_misses{0};
+  std::atomic<int64_t> num_reads{0};
+  std::atomic<int64_t> bytes_read{0};
+  std::atomic<int64_t> bytes_wasted{0};
+
   virtual ~Impl() = default;
 
+  // The options to coalesce new ranges with
+  CacheOptions CurrentOptions() const {
+    double time_to_first_byte, bandwidth;
+    if (!latency_model || !latency_model->Estimate(&time_to_first_byte, &bandwidth)) {
+      return options;
+    }
+    CacheOptions tuned =
+        MakeFromMetrics(time_to_first_byte, bandwidth,
+                        CacheOptions::kDefaultIdealBandwidthUtilizationFrac,
+                        CacheOptions::kDefaultMaxIdealRequestSizeMib * 1024 * 1024);
+    tuned.hole_size_limit =
+        std::min(std::max(tuned.hole_size_limit, kMinAdaptiveHoleSizeLimit),
+                 kMaxAdaptiveHoleSizeLimit);
+    tuned.range_size_limit = std::max(tuned.range_size_limit, 2 * tuned.hole_size_limit);
+    tuned.lazy = options.lazy;
+    tuned.adaptive = true;
+    return tuned;
+  }
+
+  // Account for reads issued to the file, timing them if the options are adaptive
+  void TrackReads(const std::vector<ReadRange>& ranges,
+                  const std::vector<Future<std::shared_ptr<Buffer>>>& futures) {
+    const auto start = std::chrono::steady_clock::now();
+    num_reads += static_cast<int64_t>(ranges.size());
+    for (const auto& range : ranges) {
+      bytes_read += range.length;
+    }
+    if (!latency_model) {
+      return;
+    }
+    auto model = latency_model;
+    for (const auto& future : futures) {
+      future.AddCallback([model, start](const Result<std::shared_ptr<Buffer>>& result) {
+        if (result.ok()) {
+          const std::chrono::duration<double> elapsed =
+              std::chrono::steady_clock::now() - start;
+          model->Record((*result)->size(), elapsed.count());
+        }
+      });
+    }
+  }
+
   // Get the future corresponding to a range
   virtual Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) {
     return entry->future;
@@ -162,18 +288,34 @@ struct ReadRangeCache::Impl {
   // Make cache entries for ranges
   virtual std::vector<RangeCacheEntry> MakeCacheEntries(
       const std::vector<ReadRange>& ranges) {
+    // Issue all reads at once, so that the file may batch them
+    auto futures = file->ReadManyAsync(ctx, ranges);
+    TrackReads(ranges, futures);
     std::vector<RangeCacheEntry> new_entries;
     new_entries.reserve(ranges.size());
-    for (const auto& range : ranges) {
-      new_entries.emplace_back(range, file->ReadAsync(ctx, range.offset, range.length));
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      new_entries.emplace_back(ranges[i], std::move(futures[i]));
     }
     return new_entries;
   }
 
   // Add the given ranges to the cache, coalescing them where possible
   virtual Status Cache(std::vector<ReadRange> ranges) {
-    ranges = internal::CoalesceReadRanges(std::move(ranges), options.hole_size_limit,
-                                          options.range_size_limit);
+    // Don't issue new reads once the context was cancelled
+    RETURN_NOT_OK(ctx.stop_token().Poll());
+    const CacheOptions current_options = CurrentOptions();
+    int64_t requested_bytes = 0;
+    for (const auto& range : ranges) {
+      requested_bytes += range.length;
+    }
+    ranges = internal::CoalesceReadRanges(std::move(ranges),
+                                          current_options.hole_size_limit,
+                                          current_options.range_size_limit);
+    int64_t coalesced_bytes = 0;
+    for (const auto& range : ranges) {
+      coalesced_bytes += range.length;
+    }
+    bytes_wasted += std::max<int64_t>(0, coalesced_bytes - requested_bytes);
     std::vector<RangeCacheEntry> new_entries = MakeCacheEntries(ranges);
     // Add new entries, themselves ordered by offset
     if (entries.size() > 0) {
@@ -202,6 +344,8 @@ struct ReadRangeCache::Impl {
           return entry.range.offset + entry.range.length < range.offset + range.length;
         });
     if (it != entries.end() && it->range.Contains(range)) {
+      const bool ready = it->future.is_valid() && it->future.is_finished();
+      ++(ready ? num_hits : num_misses);
       auto fut = MaybeRead(&*it);
       ARROW_ASSIGN_OR_RAISE(auto buf, fut.result());
       return SliceBuffer(std::move(buf), range.offset - it->range.offset, range.length);
@@ -252,7 +396,11 @@ struct ReadRangeCache::LazyImpl : public ReadRangeCache::Impl {
   Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) override {
     // Called by superclass Read()/WaitFor() so we have the lock
     if (!entry->future.is_valid()) {
+      if (ctx.stop_token().IsStopRequested()) {
+        return Future<std::shared_ptr<Buffer>>::MakeFinished(ctx.stop_token().Poll());
+      }
       entry->future = file->ReadAsync(ctx, entry->range.offset, entry->range.length);
+      TrackReads({entry->range}, {entry->future});
     }
     return entry->future;
   }
@@ -298,6 +446,9 @@ ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> owned_file,
   impl_->file = file;
   impl_->ctx = std::move(ctx);
   impl_->options = options;
+  if (options.adaptive) {
+    impl_->latency_model = ReadLatencyModel::ForFile(*file);
+  }
 }
 
 ReadRangeCache::~ReadRangeCache() = default;
@@ -316,6 +467,13 @@ Future<> ReadRangeCache::WaitFor(std::vector<ReadRange> ranges) {
   return impl_->WaitFor(std::move(ranges));
 }
 
+CacheOptions ReadRangeCache::options() const { return impl_->CurrentOptions(); }
+
+ReadRangeCache::Stats ReadRangeCache::stats() const {
+  return Stats{impl_->num_hits.load(), impl_->num_misses.load(), impl_->num_reads.load(),
+               impl_->bytes_read.load(), impl_->bytes_wasted.load()};
+}
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -43,10 +44,16 @@ struct ARROW_EXPORT CacheOptions {
   int64_t range_size_limit;
   /// \brief A lazy cache does not perform any I/O until requested.
   bool lazy;
+  /// \brief Retune hole_size_limit and range_size_limit from the time-to-first-byte
+  ///   and bandwidth observed for reads on files of the same kind (e.g. all S3
+  ///   files, or all local files).  The given limits are used until enough
+  ///   reads have been observed.
+  bool adaptive;
 
   bool operator==(const CacheOptions& other) const {
     return hole_size_limit == other.hole_size_limit &&
-           range_size_limit == other.range_size_limit && lazy == other.lazy;
+           range_size_limit == other.range_size_limit && lazy == other.lazy &&
+           adaptive == other.adaptive;
   }
 
   /// \brief Construct CacheOptions from network storage metrics (e.g. S3).
@@ -74,6 +81,40 @@ struct ARROW_EXPORT CacheOptions {
 
 namespace internal {
 
+/// \brief An online estimate of the latency model of reads on a kind of file
+///
+/// The latency of a read is modelled as TTFB + nbytes / bandwidth, fitted by
+/// least squares over the recently completed reads.  Older reads are given
+/// exponentially decaying weights, so that the estimate follows changes.
+class ARROW_EXPORT ReadLatencyModel {
+ public:
+  /// The number of reads needed before giving an estimate
+  static constexpr int64_t kMinSamples = 16;
+
+  /// \brief Record a completed read
+  void Record(int64_t nbytes, double seconds);
+
+  /// \brief Estimate the time-to-first-byte (in seconds) and bandwidth (in bytes
+  ///   per second)
+  ///
+  /// Returns false if the reads observed so far are too few, or too
+  /// uniformly sized, to tell latency from bandwidth.
+  bool Estimate(double* time_to_first_byte, double* bandwidth) const;
+
+  /// \brief The model shared by all files of the same dynamic type as `file`
+  static std::shared_ptr<ReadLatencyModel> ForFile(const RandomAccessFile& file);
+
+ private:
+  mutable std::mutex mutex_;
+  int64_t num_samples_ = 0;
+  // Weighted sums of sizes (in MiB) and latencies (in seconds)
+  double sum_weights_ = 0;
+  double sum_x_ = 0;
+  double sum_y_ = 0;
+  double sum_xx_ = 0;
+  double sum_xy_ = 0;
+};
+
 /// \brief A read cache designed to hide IO latencies when reading.
 ///
 /// This class takes multiple byte ranges that an application expects to read, and
@@ -132,6 +173,26 @@ class ARROW_EXPORT ReadRangeCache {
   /// \brief Wait until all given ranges have been cached.
   Future<> WaitFor(std::vector<ReadRange> ranges);
 
+  /// \brief The options Cache() currently coalesces ranges with
+  ///
+  /// These differ from the options given at construction if they are adaptive.
+  CacheOptions options() const;
+
+  struct Stats {
+    /// Read() calls served without waiting for I/O
+    int64_t num_hits;
+    /// Read() calls which had to wait for (or, if lazy, trigger) I/O
+    int64_t num_misses;
+    /// Reads issued to the file, after coalescing
+    int64_t num_reads;
+    int64_t bytes_read;
+    /// Bytes added to the cached ranges by coalescing them over holes
+    int64_t bytes_wasted;
+  };
+
+  /// \brief Return counters collected since construction
+  Stats stats() const;
+
  protected:
   struct Impl;
   struct LazyImpl;
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -29,7 +30,9 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -42,11 +45,59 @@ namespace io {
 // ----------------------------------------------------------------------
 // CompressedOutputStream implementation
 
+namespace {
+
+// Compress a block as a complete compressed stream
+Result<std::shared_ptr<Buffer>> CompressBlock(Codec* codec, std::shared_ptr<Buffer> block,
+                                              MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(auto compressor, codec->MakeCompressor());
+  ARROW_ASSIGN_OR_RAISE(auto compressed,
+                        AllocateResizableBuffer(block->size() / 2 + 1024, pool));
+  int64_t compressed_pos = 0;
+
+  const uint8_t* input = block->data();
+  int64_t input_len = block->size();
+  while (input_len > 0) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto result,
+        compressor->Compress(input_len, input, compressed->size() - compressed_pos,
+                             compressed->mutable_data() + compressed_pos));
+    input += result.bytes_read;
+    input_len -= result.bytes_read;
+    compressed_pos += result.bytes_written;
+    if (result.bytes_read == 0) {
+      // Need to enlarge output buffer
+      RETURN_NOT_OK(compressed->Resize(compressed->size() * 2));
+    }
+  }
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto result, compressor->End(compressed->size() - compressed_pos,
+                                     compressed->mutable_data() + compressed_pos));
+    compressed_pos += result.bytes_written;
+    if (!result.should_retry) {
+      break;
+    }
+    RETURN_NOT_OK(compressed->Resize(compressed->size() * 2));
+  }
+  RETURN_NOT_OK(compressed->Resize(compressed_pos));
+  return std::shared_ptr<Buffer>(std::move(compressed));
+}
+
+}  // namespace
+
 class CompressedOutputStream::Impl {
  public:
   Impl(MemoryPool* pool, const std::shared_ptr<OutputStream>& raw)
       : pool_(pool), raw_(raw), is_open_(false), compressed_pos_(0), total_pos_(0) {}
 
+  ~Impl() {
+    // Compression tasks refer to the codec and pool: wait for them
+    for (const auto& fut : pending_) {
+      fut.Wait();
+    }
+  }
+
   Status Init(Codec* codec) {
     ARROW_ASSIGN_OR_RAISE(compressor_, codec->MakeCompressor());
     ARROW_ASSIGN_OR_RAISE(compressed_, AllocateResizableBuffer(kChunkSize, pool_));
@@ -55,6 +106,32 @@ class CompressedOutputStream::Impl {
     return Status::OK();
   }
 
+  Status InitParallel(Codec* codec, int64_t block_size) {
+    switch (codec->compression_type()) {
+      case Compression::GZIP:
+      case Compression::ZSTD:
+      case Compression::LZ4_FRAME:
+      case Compression::BZ2:
+        break;
+      default:
+        return Status::NotImplemented(
+            "Parallel compression unsupported for codec '",
+            Codec::GetCodecAsString(codec->compression_type()), "'");
+    }
+    if (block_size <= 0) {
+      return Status::Invalid("Compression block size must be strictly positive");
+    }
+    // Fail early if the codec doesn't support streaming compression
+    RETURN_NOT_OK(codec->MakeCompressor());
+    codec_ = codec;
+    block_size_ = block_size;
+    executor_ = ::arrow::internal::GetCpuThreadPool();
+    // Keep all threads busy while the oldest block is being written out
+    max_pending_ = static_cast<size_t>(executor_->GetCapacity()) * 2;
+    is_open_ = true;
+    return Status::OK();
+  }
+
   Result<int64_t> Tell() const {
     std::lock_guard<std::mutex> guard(lock_);
     return total_pos_;
@@ -74,6 +151,9 @@ class CompressedOutputStream::Impl {
     std::lock_guard<std::mutex> guard(lock_);
 
     auto input = reinterpret_cast<const uint8_t*>(data);
+    if (codec_ != nullptr) {
+      return WriteParallel(input, nbytes);
+    }
     while (nbytes > 0) {
       int64_t input_len = nbytes;
       int64_t output_len = compressed_->size() - compressed_pos_;
@@ -111,6 +191,10 @@ class CompressedOutputStream::Impl {
   Status Flush() {
     std::lock_guard<std::mutex> guard(lock_);
 
+    if (codec_ != nullptr) {
+      RETURN_NOT_OK(SubmitBlock());
+      return WritePending(0);
+    }
     while (true) {
       // Flush compressor
       int64_t output_len = compressed_->size() - compressed_pos_;
@@ -132,6 +216,14 @@ class CompressedOutputStream::Impl {
   }
 
   Status FinalizeCompression() {
+    if (codec_ != nullptr) {
+      if (blocks_submitted_ == 0) {
+        // Emit a valid empty stream
+        ARROW_ASSIGN_OR_RAISE(block_, AllocateResizableBuffer(0, pool_));
+      }
+      RETURN_NOT_OK(SubmitBlock());
+      return WritePending(0);
+    }
     while (true) {
       // Try to end compressor
       int64_t output_len = compressed_->size() - compressed_pos_;
@@ -185,6 +277,51 @@ class CompressedOutputStream::Impl {
   // Write 64 KB compressed data at a time
   static const int64_t kChunkSize = 64 * 1024;
 
+  Status WriteParallel(const uint8_t* input, int64_t nbytes) {
+    while (nbytes > 0) {
+      if (!block_) {
+        ARROW_ASSIGN_OR_RAISE(block_, AllocateResizableBuffer(block_size_, pool_));
+        block_pos_ = 0;
+      }
+      const int64_t chunk = std::min(nbytes, block_size_ - block_pos_);
+      memcpy(block_->mutable_data() + block_pos_, input, chunk);
+      block_pos_ += chunk;
+      input += chunk;
+      nbytes -= chunk;
+      total_pos_ += chunk;
+      if (block_pos_ == block_size_) {
+        RETURN_NOT_OK(SubmitBlock());
+      }
+    }
+    return WritePending(max_pending_);
+  }
+
+  // Submit the current block for compression
+  Status SubmitBlock() {
+    if (!block_) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(block_->Resize(block_pos_));
+    std::shared_ptr<Buffer> block = std::move(block_);
+    block_pos_ = 0;
+    pending_.push_back(
+        DeferNotOk(executor_->Submit(CompressBlock, codec_, std::move(block), pool_)));
+    ++blocks_submitted_;
+    return Status::OK();
+  }
+
+  // Write out compressed blocks, in order, until at most `max_pending`
+  // remain in flight (finished blocks are written out regardless)
+  Status WritePending(size_t max_pending) {
+    while (!pending_.empty() &&
+           (pending_.size() > max_pending || pending_.front().is_finished())) {
+      ARROW_ASSIGN_OR_RAISE(auto compressed, pending_.front().result());
+      pending_.pop_front();
+      RETURN_NOT_OK(raw_->Write(compressed));
+    }
+    return Status::OK();
+  }
+
   MemoryPool* pool_;
   std::shared_ptr<OutputStream> raw_;
   bool is_open_;
@@ -194,6 +331,16 @@ class CompressedOutputStream::Impl {
   // Total number of bytes compressed
   int64_t total_pos_;
 
+  // Parallel compression state (codec_ is null in serial mode)
+  Codec* codec_ = nullptr;
+  int64_t block_size_ = 0;
+  ::arrow::internal::Executor* executor_ = nullptr;
+  size_t max_pending_ = 0;
+  std::shared_ptr<ResizableBuffer> block_;
+  int64_t block_pos_ = 0;
+  int64_t blocks_submitted_ = 0;
+  std::deque<Future<std::shared_ptr<Buffer>>> pending_;
+
   mutable std::mutex lock_;
 };
 
@@ -206,6 +353,16 @@ Result<std::shared_ptr<CompressedOutputStream>> CompressedOutputStream::Make(
   return res;
 }
 
+Result<std::shared_ptr<CompressedOutputStream>> CompressedOutputStream::MakeParallel(
+    util::Codec* codec, const std::shared_ptr<OutputStream>& raw, int64_t block_size,
+    MemoryPool* pool) {
+  // CAUTION: codec is not owned
+  std::shared_ptr<CompressedOutputStream> res(new CompressedOutputStream);
+  res->impl_.reset(new Impl(pool, std::move(raw)));
+  RETURN_NOT_OK(res->impl_->InitParallel(codec, block_size));
+  return res;
+}
+
 CompressedOutputStream::~CompressedOutputStream() { internal::CloseFromDestructor(this); }
 
 Status CompressedOutputStream::Close() { return impl_->Close(); }
@@ -48,6 +48,23 @@ class ARROW_EXPORT CompressedOutputStream : public OutputStream {
       util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
       MemoryPool* pool = default_memory_pool());
 
+  static constexpr int64_t kDefaultParallelBlockSize = 1 << 20;
+
+  /// \brief Create a compressed output stream compressing in parallel.
+  ///
+  /// The input is split into blocks of `block_size` bytes, which are
+  /// compressed independently on the CPU thread pool and written in order.
+  /// Each block forms a complete compressed stream (a gzip member, or a
+  /// zstd, lz4 or bz2 frame), and decompressors (including
+  /// CompressedInputStream) read their concatenation as a single stream.
+  /// Compression ratios are slightly worse than those of Make().
+  ///
+  /// Returns NotImplemented for codecs whose streams can't be concatenated.
+  static Result<std::shared_ptr<CompressedOutputStream>> MakeParallel(
+      util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
+      int64_t block_size = kDefaultParallelBlockSize,
+      MemoryPool* pool = default_memory_pool());
+
   // OutputStream interface
 
   /// \brief Close the compressed output stream.  This implicitly closes the
@@ -153,6 +153,34 @@ void CheckCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
   ASSERT_EQ(decompressed, data);
 }
 
+void CheckParallelCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
+                                         bool do_flush) {
+  ASSERT_OK_AND_ASSIGN(auto buffer_writer, BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto stream, CompressedOutputStream::MakeParallel(
+                                        codec, buffer_writer, /*block_size=*/10000));
+
+  const uint8_t* input = data.data();
+  int64_t input_len = data.size();
+  const int64_t chunk_size = 1111;
+  while (input_len > 0) {
+    int64_t nbytes = std::min(chunk_size, input_len);
+    ASSERT_OK(stream->Write(input, nbytes));
+    input += nbytes;
+    input_len -= nbytes;
+    if (do_flush && input_len % 7 == 0) {
+      ASSERT_OK(stream->Flush());
+    }
+  }
+  ASSERT_OK_AND_EQ(static_cast<int64_t>(data.size()), stream->Tell());
+  ASSERT_OK(stream->Close());
+
+  // The concatenated blocks decompress as a single stream
+  ASSERT_OK_AND_ASSIGN(auto compressed, buffer_writer->Finish());
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunCompressedInputStream(codec, compressed, &decompressed));
+  ASSERT_EQ(decompressed, data);
+}
+
 class CompressedInputStreamTest : public ::testing::TestWithParam<Compression::type> {
  protected:
   Compression::type GetCompression() { return GetParam(); }
@@ -252,6 +280,22 @@ TEST_P(CompressedOutputStreamTest, RandomData) {
   CheckCompressedOutputStream(codec.get(), data, true /* do_flush */);
 }
 
+TEST_P(CompressedOutputStreamTest, Parallel) {
+  auto codec = MakeCodec();
+  if (GetCompression() == Compression::BROTLI) {
+    std::shared_ptr<OutputStream> stream = std::make_shared<MockOutputStream>();
+    ASSERT_RAISES(NotImplemented,
+                  CompressedOutputStream::MakeParallel(codec.get(), stream));
+    return;
+  }
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  CheckParallelCompressedOutputStream(codec.get(), data, false /* do_flush */);
+  CheckParallelCompressedOutputStream(codec.get(), data, true /* do_flush */);
+  data = MakeRandomData(RANDOM_DATA_SIZE);
+  CheckParallelCompressedOutputStream(codec.get(), data, false /* do_flush */);
+  CheckParallelCompressedOutputStream(codec.get(), {}, false /* do_flush */);
+}
+
 // NOTES:
 // - Snappy doesn't support streaming decompression
 // - BZ2 doesn't support one-shot compression
@@ -47,11 +47,13 @@
 
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/io/util_internal.h"
 
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
@@ -214,6 +216,74 @@ class OSFile {
 // ----------------------------------------------------------------------
 // ReadableFile implementation
 
+namespace {
+
+Future<std::shared_ptr<Buffer>> FinishUringRead(Future<int64_t> bytes_read,
+                                                std::shared_ptr<ResizableBuffer> buffer,
+                                                std::shared_ptr<RandomAccessFile> file) {
+  // The file is kept alive (and open, barring misuse) until the read finishes
+  return bytes_read.Then(
+      [buffer, file](int64_t nbytes) -> Result<std::shared_ptr<Buffer>> {
+        if (nbytes < buffer->size()) {
+          RETURN_NOT_OK(buffer->Resize(nbytes));
+          buffer->ZeroPadding();
+        }
+        return std::shared_ptr<Buffer>(buffer);
+      });
+}
+
+// O_DIRECT requires offsets, lengths and addresses to be aligned on the
+// logical block size, which this is a multiple of on any common device
+constexpr int64_t kDirectIOAlignment = 4096;
+// Below the maximum read size on all platforms, and keeping reads aligned
+constexpr int64_t kMaxDirectIOChunkSize = int64_t(1) << 30;
+
+// A read widened to block boundaries, for a file opened with O_DIRECT
+struct DirectRead {
+  std::shared_ptr<Buffer> buffer;
+  // The aligned start of the read in `buffer`
+  uint8_t* data;
+  // The aligned range read from the file
+  int64_t offset;
+  int64_t length;
+  // The range requested
+  int64_t position;
+  int64_t nbytes;
+};
+
+Result<DirectRead> PrepareDirectRead(int64_t position, int64_t nbytes,
+                                     MemoryPool* pool) {
+  DirectRead read;
+  read.offset = bit_util::RoundDown(position, kDirectIOAlignment);
+  read.length = bit_util::RoundUp(position + nbytes, kDirectIOAlignment) - read.offset;
+  read.position = position;
+  read.nbytes = nbytes;
+  // Pools only guarantee 64-byte alignment, so make room to align the start
+  ARROW_ASSIGN_OR_RAISE(read.buffer,
+                        AllocateBuffer(read.length + kDirectIOAlignment, pool));
+  const auto address = reinterpret_cast<uintptr_t>(read.buffer->data());
+  const auto aligned = (address + kDirectIOAlignment - 1) &
+                       ~static_cast<uintptr_t>(kDirectIOAlignment - 1);
+  read.data = read.buffer->mutable_data() + (aligned - address);
+  return read;
+}
+
+// Return the requested range as a slice of the aligned buffer
+std::shared_ptr<Buffer> FinishDirectRead(const DirectRead& read, int64_t bytes_read) {
+  const int64_t skip = read.position - read.offset;
+  const int64_t length = std::max<int64_t>(0, std::min(read.nbytes, bytes_read - skip));
+  return SliceBuffer(read.buffer, (read.data - read.buffer->data()) + skip, length);
+}
+
+Future<std::shared_ptr<Buffer>> FinishUringDirectRead(
+    Future<int64_t> bytes_read, DirectRead read, std::shared_ptr<RandomAccessFile> file) {
+  return bytes_read.Then([read, file](int64_t nbytes) -> std::shared_ptr<Buffer> {
+    return FinishDirectRead(read, nbytes);
+  });
+}
+
+}  // namespace
+
 class ReadableFile::ReadableFileImpl : public OSFile {
  public:
   explicit ReadableFileImpl(MemoryPool* pool) : OSFile(), pool_(pool) {}
@@ -221,6 +291,25 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   Status Open(const std::string& path) { return OpenReadable(path); }
   Status Open(int fd) { return OpenReadable(fd); }
 
+  Status Open(const std::string& path, const ReadableFileOptions& options) {
+    RETURN_NOT_OK(OpenReadable(path));
+    if (options.use_io_uring) {
+      auto maybe_ring = internal::IoUring::GetInstance();
+      if (maybe_ring.ok()) {
+        ring_ = *std::move(maybe_ring);
+      }
+    }
+    if (options.use_direct_io) {
+      RETURN_NOT_OK(OpenDirect());
+    }
+    return Status::OK();
+  }
+
+  Status Close() {
+    RETURN_NOT_OK(direct_fd_.Close());
+    return OSFile::Close();
+  }
+
   Result<std::shared_ptr<Buffer>> ReadBuffer(int64_t nbytes) {
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
@@ -233,6 +322,9 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
   Result<std::shared_ptr<Buffer>> ReadBufferAt(int64_t position, int64_t nbytes) {
+    if (uses_direct_io() && nbytes > 0) {
+      return DirectReadBufferAt(position, nbytes);
+    }
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
@@ -262,6 +354,19 @@ class ReadableFile::ReadableFileImpl : public OSFile {
       return Status::OK();
     };
     RETURN_NOT_OK(CheckClosed());
+    if (ring_) {
+      // Submit all advice at once, without waiting for it
+      std::vector<internal::UringRead> advice;
+      advice.reserve(ranges.size());
+      for (const auto& range : ranges) {
+        RETURN_NOT_OK(internal::ValidateRange(range.offset, range.length));
+        if (range.length > 0) {
+          advice.push_back({fd_.fd(), range.offset, range.length, nullptr});
+        }
+      }
+      ring_->WillNeed(advice);
+      return Status::OK();
+    }
     for (const auto& range : ranges) {
       RETURN_NOT_OK(internal::ValidateRange(range.offset, range.length));
 #if defined(POSIX_FADV_WILLNEED)
@@ -284,10 +389,115 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     return Status::OK();
   }
 
+  bool uses_io_uring() const { return ring_ != nullptr; }
+
+  bool uses_direct_io() const { return !direct_fd_.closed(); }
+
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      std::shared_ptr<ReadableFile> self, const IOContext& ctx,
+      const std::vector<ReadRange>& ranges) {
+    std::vector<Future<std::shared_ptr<Buffer>>> futures(ranges.size());
+    // Either of these, depending on uses_direct_io()
+    std::vector<std::shared_ptr<ResizableBuffer>> buffers;
+    std::vector<DirectRead> direct_reads;
+    std::vector<internal::UringRead> reads;
+    std::vector<size_t> indices;
+    const Status status = [&]() -> Status {
+      RETURN_NOT_OK(CheckClosed());
+      RETURN_NOT_OK(ctx.stop_token().Poll());
+      for (size_t i = 0; i < ranges.size(); ++i) {
+        const ReadRange& range = ranges[i];
+        RETURN_NOT_OK(internal::ValidateRange(range.offset, range.length));
+        if (range.length == 0) {
+          ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(0, pool_));
+          futures[i] = Future<std::shared_ptr<Buffer>>::MakeFinished(std::move(buffer));
+          continue;
+        }
+        if (uses_direct_io()) {
+          ARROW_ASSIGN_OR_RAISE(auto read,
+                                PrepareDirectRead(range.offset, range.length, pool_));
+          reads.push_back({direct_fd_.fd(), read.offset, read.length, read.data,
+                           kDirectIOAlignment});
+          direct_reads.push_back(std::move(read));
+        } else {
+          ARROW_ASSIGN_OR_RAISE(auto buffer,
+                                AllocateResizableBuffer(range.length, pool_));
+          reads.push_back(
+              {fd_.fd(), range.offset, range.length, buffer->mutable_data(), 1});
+          buffers.push_back(std::shared_ptr<ResizableBuffer>(std::move(buffer)));
+        }
+        indices.push_back(i);
+      }
+      return Status::OK();
+    }();
+    if (!status.ok()) {
+      for (auto& future : futures) {
+        future = Future<std::shared_ptr<Buffer>>::MakeFinished(status);
+      }
+      return futures;
+    }
+
+    auto bytes_read = ring_->Read(reads);
+    for (size_t j = 0; j < indices.size(); ++j) {
+      futures[indices[j]] =
+          uses_direct_io()
+              ? FinishUringDirectRead(std::move(bytes_read[j]),
+                                      std::move(direct_reads[j]), self)
+              : FinishUringRead(std::move(bytes_read[j]), std::move(buffers[j]), self);
+    }
+    return futures;
+  }
+
  private:
+  Status OpenDirect() {
+#ifdef O_DIRECT
+    int fd = open(file_name_.ToNative().c_str(), O_RDONLY | O_DIRECT | O_CLOEXEC);
+    if (fd >= 0) {
+      direct_fd_ = FileDescriptor(fd);
+    } else if (errno != EINVAL) {
+      // EINVAL means the file system doesn't support direct IO
+      return IOErrorFromErrno(errno, "Failed to open local file '",
+                              file_name_.ToString(), "' for direct IO");
+    }
+#endif
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Buffer>> DirectReadBufferAt(int64_t position, int64_t nbytes) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(internal::ValidateRange(position, nbytes));
+    ARROW_ASSIGN_OR_RAISE(auto read, PrepareDirectRead(position, nbytes, pool_));
+    int64_t bytes_read = 0;
+#ifdef O_DIRECT
+    while (bytes_read < read.length) {
+      const int64_t chunk = std::min(read.length - bytes_read, kMaxDirectIOChunkSize);
+      const auto ret = pread(direct_fd_.fd(), read.data + bytes_read,
+                             static_cast<size_t>(chunk), read.offset + bytes_read);
+      if (ret == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return IOErrorFromErrno(errno, "Error reading bytes from file");
+      }
+      bytes_read += ret;
+      if (ret == 0 || ret % kDirectIOAlignment != 0) {
+        // End of file
+        break;
+      }
+    }
+#endif
+    return FinishDirectRead(read, bytes_read);
+  }
+
   MemoryPool* pool_;
+  // Set if reads are submitted to io_uring
+  std::shared_ptr<internal::IoUring> ring_;
+  // Open if reads bypass the page cache
+  FileDescriptor direct_fd_;
 };
 
+ReadableFileOptions ReadableFileOptions::Defaults() { return ReadableFileOptions(); }
+
 ReadableFile::ReadableFile(MemoryPool* pool) { impl_.reset(new ReadableFileImpl(pool)); }
 
 ReadableFile::~ReadableFile() { internal::CloseFromDestructor(this); }
@@ -305,6 +515,13 @@ Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(int fd, MemoryPool* poo
   return file;
 }
 
+Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(
+    const std::string& path, const ReadableFileOptions& options, MemoryPool* pool) {
+  auto file = std::shared_ptr<ReadableFile>(new ReadableFile(pool));
+  RETURN_NOT_OK(file->impl_->Open(path, options));
+  return file;
+}
+
 Status ReadableFile::DoClose() { return impl_->Close(); }
 
 bool ReadableFile::closed() const { return !impl_->is_open(); }
@@ -313,6 +530,24 @@ Status ReadableFile::WillNeed(const std::vector<ReadRange>& ranges) {
   return impl_->WillNeed(ranges);
 }
 
+Future<std::shared_ptr<Buffer>> ReadableFile::ReadAsync(const IOContext& ctx,
+                                                        int64_t position,
+                                                        int64_t nbytes) {
+  if (!impl_->uses_io_uring()) {
+    return RandomAccessFile::ReadAsync(ctx, position, nbytes);
+  }
+  return ReadManyAsync(ctx, {{position, nbytes}})[0];
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> ReadableFile::ReadManyAsync(
+    const IOContext& ctx, const std::vector<ReadRange>& ranges) {
+  if (!impl_->uses_io_uring()) {
+    return RandomAccessFile::ReadManyAsync(ctx, ranges);
+  }
+  return impl_->ReadManyAsync(
+      std::static_pointer_cast<ReadableFile>(shared_from_this()), ctx, ranges);
+}
+
 Result<int64_t> ReadableFile::DoTell() const { return impl_->Tell(); }
 
 Result<int64_t> ReadableFile::DoRead(int64_t nbytes, void* out) {
@@ -433,8 +668,10 @@ class MemoryMappedFile::MemoryMap
   }
 
   Status Open(const std::string& path, FileMode::type mode, const int64_t offset = 0,
-              const int64_t length = -1) {
+              const int64_t length = -1,
+              const MemoryMapOptions& options = MemoryMapOptions::Defaults()) {
     file_.reset(new OSFile());
+    options_ = options;
 
     if (mode != FileMode::READ) {
       // Memory mapping has permission failures if PROT_READ not set
@@ -569,12 +806,21 @@ class MemoryMappedFile::MemoryMap
       mmap_length = static_cast<size_t>(length);
     }
 
-    void* result = mmap(nullptr, mmap_length, prot_flags_, map_mode_, file_->fd(),
+    int map_flags = map_mode_;
+#ifdef MAP_POPULATE
+    if (options_.populate) {
+      map_flags |= MAP_POPULATE;
+    }
+#endif
+    void* result = mmap(nullptr, mmap_length, prot_flags_, map_flags, file_->fd(),
                         static_cast<off_t>(offset));
     if (result == MAP_FAILED) {
       return Status::IOError("Memory mapping file failed: ",
                              ::arrow::internal::ErrnoMessage(errno));
     }
+    if (options_.sequential) {
+      RETURN_NOT_OK(::arrow::internal::MemoryAdviseSequential({result, mmap_length}));
+    }
     map_len_ = mmap_length;
     offset_ = offset;
     region_ = std::make_shared<Region>(shared_from_this(), static_cast<uint8_t*>(result),
@@ -587,6 +833,7 @@ class MemoryMappedFile::MemoryMap
   std::unique_ptr<OSFile> file_;
   int prot_flags_;
   int map_mode_;
+  MemoryMapOptions options_;
 
   std::shared_ptr<Region> region_;
   int64_t file_size_;
@@ -596,6 +843,8 @@ class MemoryMappedFile::MemoryMap
   std::mutex resize_lock_;
 };
 
+MemoryMapOptions MemoryMapOptions::Defaults() { return MemoryMapOptions(); }
+
 MemoryMappedFile::MemoryMappedFile() {}
 
 MemoryMappedFile::~MemoryMappedFile() { internal::CloseFromDestructor(this); }
@@ -628,6 +877,16 @@ Result<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(const std::stri
   return result;
 }
 
+Result<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(
+    const std::string& path, FileMode::type mode, const MemoryMapOptions& options) {
+  std::shared_ptr<MemoryMappedFile> result(new MemoryMappedFile());
+
+  result->memory_map_.reset(new MemoryMap());
+  RETURN_NOT_OK(
+      result->memory_map_->Open(path, mode, /*offset=*/0, /*length=*/-1, options));
+  return result;
+}
+
 Result<int64_t> MemoryMappedFile::GetSize() {
   RETURN_NOT_OK(memory_map_->CheckClosed());
   return memory_map_->size();
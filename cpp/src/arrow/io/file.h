@@ -80,6 +80,26 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
   std::unique_ptr<FileOutputStreamImpl> impl_;
 };
 
+/// \brief Options for opening a ReadableFile
+///
+/// These are hints: they are ignored where the platform, kernel or file
+/// system doesn't support them.
+struct ARROW_EXPORT ReadableFileOptions {
+  /// Submit ReadAsync() and ReadManyAsync() reads to a process-wide io_uring
+  /// instance rather than blocking IO threads, and submit WillNeed() advice
+  /// in a single batch (Linux only).
+  bool use_io_uring = false;
+
+  /// Bypass the page cache (using O_DIRECT) for ReadAt() calls returning a
+  /// Buffer and for asynchronous reads.  Reads are widened to the device block
+  /// size and the requested range is returned as a slice of the block-aligned
+  /// buffer, without copying.  Prefer for large reads, such as coalesced ones
+  /// from ReadRangeCache, which would otherwise evict the page cache.
+  bool use_direct_io = false;
+
+  static ReadableFileOptions Defaults();
+};
+
 /// \brief An operating system file open in read-only mode.
 ///
 /// Reads through this implementation are unbuffered.  If many small reads
@@ -107,12 +127,28 @@ class ARROW_EXPORT ReadableFile
   static Result<std::shared_ptr<ReadableFile>> Open(
       int fd, MemoryPool* pool = default_memory_pool());
 
+  /// \brief Open a local file for reading
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] options how to issue reads
+  /// \param[in] pool a MemoryPool for memory allocations
+  /// \return ReadableFile instance
+  static Result<std::shared_ptr<ReadableFile>> Open(
+      const std::string& path, const ReadableFileOptions& options,
+      MemoryPool* pool = default_memory_pool());
+
   bool closed() const override;
 
   int file_descriptor() const;
 
   Status WillNeed(const std::vector<ReadRange>& ranges) override;
 
+  using RandomAccessFile::ReadAsync;
+  Future<std::shared_ptr<Buffer>> ReadAsync(const IOContext&, int64_t position,
+                                            int64_t nbytes) override;
+
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const IOContext&, const std::vector<ReadRange>& ranges) override;
+
  private:
   friend RandomAccessFileConcurrencyWrapper<ReadableFile>;
 
@@ -136,6 +172,22 @@ class ARROW_EXPORT ReadableFile
   std::unique_ptr<ReadableFileImpl> impl_;
 };
 
+/// \brief Options for opening a MemoryMappedFile
+///
+/// These are hints: they are ignored where the platform doesn't support them.
+struct ARROW_EXPORT MemoryMapOptions {
+  /// Fault in the whole mapping when it is created (MAP_POPULATE, Linux only),
+  /// so that later reads don't take page faults.  Opening a large file then
+  /// reads all of it from disk up front.
+  bool populate = false;
+
+  /// Advise the kernel that the mapping will be read sequentially
+  /// (MADV_SEQUENTIAL), enabling aggressive read-ahead.
+  bool sequential = false;
+
+  static MemoryMapOptions Defaults();
+};
+
 /// \brief A file interface that uses memory-mapped files for memory interactions
 ///
 /// This implementation supports zero-copy reads. The same class is used
@@ -161,6 +213,11 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
                                                         const int64_t offset,
                                                         const int64_t length);
 
+  // mmap() with whole file, applying the given mapping hints
+  static Result<std::shared_ptr<MemoryMappedFile>> Open(const std::string& path,
+                                                        FileMode::type mode,
+                                                        const MemoryMapOptions& options);
+
   Status Close() override;
 
   bool closed() const override;
@@ -37,8 +37,10 @@
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/test_common.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/future.h"
@@ -419,6 +421,117 @@ TEST_F(TestReadableFile, NonexistentFile) {
   ASSERT_NE(std::string::npos, message.find(path));
 }
 
+TEST_F(TestReadableFile, IoUring) {
+  if (!internal::IoUring::IsSupported()) {
+    GTEST_SKIP() << "io_uring not available";
+  }
+  MakeTestFile();
+  ReadableFileOptions options;
+  options.use_io_uring = true;
+  ASSERT_OK_AND_ASSIGN(file_, ReadableFile::Open(path_, options));
+
+  auto fut1 = file_->ReadAsync({}, 1, 10);
+  auto fut2 = file_->ReadAsync({}, 0, 4);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto buf1, fut1);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto buf2, fut2);
+  AssertBufferEqual(*buf1, "estdata");
+  AssertBufferEqual(*buf2, "test");
+
+  auto futures = file_->ReadManyAsync({}, {{4, 4}, {2, 0}, {20, 5}, {0, 8}});
+  ASSERT_EQ(4, futures.size());
+  std::vector<std::string> expected = {"data", "", "", "testdata"};
+  for (size_t i = 0; i < futures.size(); ++i) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto buffer, futures[i]);
+    AssertBufferEqual(*buffer, expected[i]);
+  }
+  ASSERT_FINISHES_AND_RAISES(Invalid, file_->ReadAsync({}, -1, 1));
+
+  ASSERT_OK(file_->WillNeed({{0, 3}, {4, 6}}));
+  ASSERT_OK(file_->WillNeed({{10, 0}}));
+  ASSERT_RAISES(Invalid, file_->WillNeed({{-1, -1}}));
+
+  ASSERT_OK(file_->Close());
+  ASSERT_FINISHES_AND_RAISES(Invalid, file_->ReadAsync({}, 0, 1));
+}
+
+TEST_F(TestReadableFile, IoUringBacklog) {
+  // More reads than the ring entries are queued and submitted as others finish
+  auto maybe_ring = internal::IoUring::Make(/*entries=*/4);
+  if (!maybe_ring.ok()) {
+    GTEST_SKIP() << "io_uring not available: " << maybe_ring.status().ToString();
+  }
+  auto ring = *maybe_ring;
+  MakeTestFile();
+  OpenFile();
+
+  const int num_reads = 100;
+  std::vector<std::string> outs(num_reads, std::string(8, '\0'));
+  std::vector<internal::UringRead> reads;
+  for (int i = 0; i < num_reads; ++i) {
+    reads.push_back({file_->file_descriptor(), i % 8, 8,
+                     reinterpret_cast<uint8_t*>(&outs[i][0]), /*alignment=*/1});
+  }
+  auto futures = ring->Read(reads);
+  for (int i = 0; i < num_reads; ++i) {
+    ASSERT_FINISHES_OK_AND_EQ(8 - i % 8, futures[i]);
+    ASSERT_EQ(std::string("testdata").substr(i % 8), outs[i].substr(0, 8 - i % 8));
+  }
+
+  // Reads issued from a completion callback are fine too
+  auto chained = ring->Read({reads[0]})[0].Then([&](int64_t) {
+    return ring->Read({reads[1]})[0];
+  });
+  ASSERT_FINISHES_OK_AND_EQ(7, chained);
+
+  reads[0].fd = -1;
+  auto failed = ring->Read({reads[0]});
+  ASSERT_FINISHES_AND_RAISES(IOError, failed[0]);
+}
+
+TEST_F(TestReadableFile, DirectIO) {
+  // Spans several blocks, and ends in the middle of one
+  std::string data(3 * 4096 + 100, '\0');
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<char>('a' + i % 26);
+  }
+  {
+    std::ofstream stream(path_.c_str(), std::ios::binary);
+    stream << data;
+  }
+  const int64_t size = static_cast<int64_t>(data.size());
+  const std::vector<ReadRange> ranges = {
+      {0, 10}, {4000, 200}, {4096, 4096}, {5, 3 * 4096}, {size - 50, 100},
+      {size, 10}, {12, 0}};
+  auto expected = [&](const ReadRange& range) {
+    return data.substr(std::min<size_t>(range.offset, data.size()), range.length);
+  };
+
+  for (bool use_io_uring : {false, true}) {
+    ARROW_SCOPED_TRACE("use_io_uring = ", use_io_uring);
+    ReadableFileOptions options;
+    options.use_direct_io = true;
+    options.use_io_uring = use_io_uring;
+    ASSERT_OK_AND_ASSIGN(file_, ReadableFile::Open(path_, options));
+
+    for (const auto& range : ranges) {
+      ASSERT_OK_AND_ASSIGN(auto buffer, file_->ReadAt(range.offset, range.length));
+      AssertBufferEqual(*buffer, expected(range));
+    }
+    auto futures = file_->ReadManyAsync({}, ranges);
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      ASSERT_FINISHES_OK_AND_ASSIGN(auto buffer, futures[i]);
+      AssertBufferEqual(*buffer, expected(ranges[i]));
+    }
+    // Reads into caller memory and implicitly positioned reads are buffered
+    ASSERT_OK(file_->Seek(1));
+    ASSERT_OK_AND_ASSIGN(auto buffer, file_->Read(5));
+    AssertBufferEqual(*buffer, data.substr(1, 5));
+    ASSERT_RAISES(Invalid, file_->ReadAt(-1, 1));
+    ASSERT_OK(file_->Close());
+    ASSERT_RAISES(Invalid, file_->ReadAt(0, 1));
+  }
+}
+
 class MyMemoryPool : public MemoryPool {
  public:
   MyMemoryPool() : num_allocations_(0) {}
@@ -936,6 +1049,31 @@ TEST_F(TestMemoryMappedFile, ReadOnly) {
   ASSERT_OK(rommap->Close());
 }
 
+TEST_F(TestMemoryMappedFile, ReadWithOptions) {
+  const int64_t buffer_size = 1024;
+  std::vector<uint8_t> buffer(buffer_size);
+  random_bytes(buffer_size, 0, buffer.data());
+
+  std::string path = TempFile("mmap-options-test");
+  ASSERT_OK_AND_ASSIGN(auto rwmmap, InitMemoryMap(buffer_size, path));
+  ASSERT_OK(rwmmap->Write(buffer.data(), buffer_size));
+  ASSERT_OK(rwmmap->Close());
+
+  for (const bool populate : {false, true}) {
+    for (const bool sequential : {false, true}) {
+      ARROW_SCOPED_TRACE("populate = ", populate, ", sequential = ", sequential);
+      MemoryMapOptions options;
+      options.populate = populate;
+      options.sequential = sequential;
+      ASSERT_OK_AND_ASSIGN(auto rommap,
+                           MemoryMappedFile::Open(path, FileMode::READ, options));
+      ASSERT_OK_AND_ASSIGN(auto out_buffer, rommap->ReadAt(0, buffer_size));
+      ASSERT_EQ(0, memcmp(out_buffer->data(), buffer.data(), buffer_size));
+      ASSERT_OK(rommap->Close());
+    }
+  }
+}
+
 TEST_F(TestMemoryMappedFile, LARGE_MEMORY_TEST(ReadWriteOver4GbFile)) {
   // ARROW-1096
   const int64_t buffer_size = 1000 * 1000;
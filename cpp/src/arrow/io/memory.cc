@@ -384,5 +384,107 @@ Status BufferReader::DoSeek(int64_t position) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// In-memory reader over a sequence of buffers
+
+ChunkedBufferReader::ChunkedBufferReader(BufferVector buffers, MemoryPool* pool)
+    : buffers_(std::move(buffers)), pool_(pool), position_(0), is_open_(true) {
+  offsets_.reserve(buffers_.size() + 1);
+  int64_t offset = 0;
+  for (const auto& buffer : buffers_) {
+    DCHECK(buffer->is_cpu());
+    offsets_.push_back(offset);
+    offset += buffer->size();
+  }
+  offsets_.push_back(offset);
+}
+
+Status ChunkedBufferReader::DoClose() {
+  is_open_ = false;
+  return Status::OK();
+}
+
+bool ChunkedBufferReader::closed() const { return !is_open_; }
+
+bool ChunkedBufferReader::supports_zero_copy() const { return true; }
+
+size_t ChunkedBufferReader::FindBuffer(int64_t position) const {
+  auto it = std::upper_bound(offsets_.begin(), offsets_.end() - 1, position);
+  return static_cast<size_t>(it - offsets_.begin()) - 1;
+}
+
+Result<int64_t> ChunkedBufferReader::DoTell() const {
+  RETURN_NOT_OK(CheckClosed());
+  return position_;
+}
+
+Result<int64_t> ChunkedBufferReader::DoReadAt(int64_t position, int64_t nbytes,
+                                              void* out) {
+  RETURN_NOT_OK(CheckClosed());
+
+  ARROW_ASSIGN_OR_RAISE(nbytes,
+                        internal::ValidateReadRange(position, nbytes, offsets_.back()));
+  int64_t copied = 0;
+  for (size_t i = nbytes > 0 ? FindBuffer(position) : 0; copied < nbytes; ++i) {
+    const int64_t offset_in_buffer = position + copied - offsets_[i];
+    const int64_t copy_size =
+        std::min(nbytes - copied, buffers_[i]->size() - offset_in_buffer);
+    memcpy(static_cast<uint8_t*>(out) + copied, buffers_[i]->data() + offset_in_buffer,
+           copy_size);
+    copied += copy_size;
+  }
+  return nbytes;
+}
+
+Result<std::shared_ptr<Buffer>> ChunkedBufferReader::DoReadAt(int64_t position,
+                                                              int64_t nbytes) {
+  RETURN_NOT_OK(CheckClosed());
+
+  ARROW_ASSIGN_OR_RAISE(nbytes,
+                        internal::ValidateReadRange(position, nbytes, offsets_.back()));
+  if (nbytes > 0) {
+    const size_t i = FindBuffer(position);
+    const int64_t offset_in_buffer = position - offsets_[i];
+    if (offset_in_buffer + nbytes <= buffers_[i]->size()) {
+      return SliceBuffer(buffers_[i], offset_in_buffer, nbytes);
+    }
+  }
+
+  // The range straddles several buffers
+  ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(nbytes, pool_));
+  RETURN_NOT_OK(DoReadAt(position, nbytes, buffer->mutable_data()));
+  return std::move(buffer);
+}
+
+Result<int64_t> ChunkedBufferReader::DoRead(int64_t nbytes, void* out) {
+  RETURN_NOT_OK(CheckClosed());
+  ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, DoReadAt(position_, nbytes, out));
+  position_ += bytes_read;
+  return bytes_read;
+}
+
+Result<std::shared_ptr<Buffer>> ChunkedBufferReader::DoRead(int64_t nbytes) {
+  RETURN_NOT_OK(CheckClosed());
+  ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(position_, nbytes));
+  position_ += buffer->size();
+  return buffer;
+}
+
+Result<int64_t> ChunkedBufferReader::DoGetSize() {
+  RETURN_NOT_OK(CheckClosed());
+  return offsets_.back();
+}
+
+Status ChunkedBufferReader::DoSeek(int64_t position) {
+  RETURN_NOT_OK(CheckClosed());
+
+  if (position < 0 || position > offsets_.back()) {
+    return Status::IOError("Seek out of bounds");
+  }
+
+  position_ = position;
+  return Status::OK();
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -193,5 +193,55 @@ class ARROW_EXPORT BufferReader
   bool is_open_;
 };
 
+/// \class ChunkedBufferReader
+/// \brief Random access reads on a sequence of CPU buffers, as if they were
+/// concatenated
+///
+/// Reads within a single buffer return zero-copy slices of it, only reads
+/// straddling several buffers are copied into a new buffer.
+class ARROW_EXPORT ChunkedBufferReader
+    : public internal::RandomAccessFileConcurrencyWrapper<ChunkedBufferReader> {
+ public:
+  explicit ChunkedBufferReader(BufferVector buffers,
+                               MemoryPool* pool = default_memory_pool());
+
+  bool closed() const override;
+
+  bool supports_zero_copy() const override;
+
+  const BufferVector& buffers() const { return buffers_; }
+
+ protected:
+  friend RandomAccessFileConcurrencyWrapper<ChunkedBufferReader>;
+
+  Status DoClose();
+
+  Result<int64_t> DoRead(int64_t nbytes, void* buffer);
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out);
+  Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes);
+
+  Result<int64_t> DoTell() const;
+  Status DoSeek(int64_t position);
+  Result<int64_t> DoGetSize();
+
+  Status CheckClosed() const {
+    if (!is_open_) {
+      return Status::Invalid("Operation forbidden on closed ChunkedBufferReader");
+    }
+    return Status::OK();
+  }
+
+  // The index of the last buffer starting at or before the given position
+  size_t FindBuffer(int64_t position) const;
+
+  BufferVector buffers_;
+  // The offset of each buffer, followed by the total size
+  std::vector<int64_t> offsets_;
+  MemoryPool* pool_;
+  int64_t position_;
+  bool is_open_;
+};
+
 }  // namespace io
 }  // namespace arrow
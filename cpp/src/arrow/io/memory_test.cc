@@ -41,6 +41,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/cancel.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
@@ -290,6 +291,48 @@ TEST(TestBufferReader, WillNeed) {
   }
 }
 
+TEST(TestChunkedBufferReader, Basics) {
+  auto first = Buffer::FromString("data");
+  auto second = Buffer::FromString("");
+  auto third = Buffer::FromString("123456");
+  ChunkedBufferReader reader({first, second, third});
+  ASSERT_OK_AND_EQ(10, reader.GetSize());
+
+  // Reads within a buffer are zero-copy
+  ASSERT_OK_AND_ASSIGN(auto buf, reader.ReadAt(1, 3));
+  AssertBufferEqual(*buf, "ata");
+  ASSERT_EQ(buf->data(), first->data() + 1);
+  ASSERT_OK_AND_ASSIGN(buf, reader.ReadAt(4, 6));
+  AssertBufferEqual(*buf, "123456");
+  ASSERT_EQ(buf->data(), third->data());
+
+  // Reads straddling buffers are copied
+  ASSERT_OK_AND_ASSIGN(buf, reader.ReadAt(2, 4));
+  AssertBufferEqual(*buf, "ta12");
+  uint8_t out[10];
+  ASSERT_OK_AND_EQ(10, reader.ReadAt(0, 20, out));
+  ASSERT_EQ(std::string(reinterpret_cast<const char*>(out), 10), "data123456");
+
+  // Reads are truncated at the end
+  ASSERT_OK_AND_ASSIGN(buf, reader.ReadAt(8, 5));
+  AssertBufferEqual(*buf, "56");
+  ASSERT_OK_AND_ASSIGN(buf, reader.ReadAt(10, 5));
+  ASSERT_EQ(buf->size(), 0);
+  ASSERT_RAISES(Invalid, reader.ReadAt(-1, 1));
+
+  ASSERT_OK_AND_ASSIGN(buf, reader.Read(3));
+  AssertBufferEqual(*buf, "dat");
+  ASSERT_OK_AND_ASSIGN(buf, reader.Read(3));
+  AssertBufferEqual(*buf, "a12");
+  ASSERT_OK_AND_EQ(6, reader.Tell());
+  ASSERT_OK(reader.Seek(10));
+  ASSERT_RAISES(IOError, reader.Seek(11));
+
+  ASSERT_OK(reader.Close());
+  ASSERT_TRUE(reader.closed());
+  ASSERT_RAISES(Invalid, reader.ReadAt(0, 1));
+}
+
 TEST(TestRandomAccessFile, GetStream) {
   std::string data = "data1data2data3data4data5";
 
@@ -845,6 +888,122 @@ TEST(RangeReadCache, Lazy) {
   ASSERT_EQ(3, file->read_count());
 }
 
+TEST(RangeReadCache, Cancelled) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<CountingBufferReader>(Buffer(data));
+  StopSource stop_source;
+  IOContext ctx(default_memory_pool(), stop_source.token());
+  internal::ReadRangeCache cache(file, ctx, CacheOptions::LazyDefaults());
+
+  ASSERT_OK(cache.Cache({{1, 2}, {10, 4}}));
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({1, 2}));
+  AssertBufferEqual(*buf, "bc");
+  ASSERT_EQ(1, file->read_count());
+
+  // Once stopped, no new reads are issued but already fetched ranges are served
+  stop_source.RequestStop();
+  ASSERT_RAISES(Cancelled, cache.Cache({{20, 2}}));
+  ASSERT_RAISES(Cancelled, cache.Read({10, 4}));
+  ASSERT_FINISHES_AND_RAISES(Cancelled, cache.WaitFor({{10, 4}}));
+  ASSERT_EQ(1, file->read_count());
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({1, 2}));
+  AssertBufferEqual(*buf, "bc");
+}
+
+TEST(RangeReadCache, Stats) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 10;
+
+  for (auto lazy : std::vector<bool>{false, true}) {
+    SCOPED_TRACE(lazy);
+    options.lazy = lazy;
+    auto file = std::make_shared<BufferReader>(Buffer(data));
+    internal::ReadRangeCache cache(file, {}, options);
+    ASSERT_EQ(options, cache.options());
+
+    // The first two ranges are coalesced over a 1-byte hole
+    ASSERT_OK(cache.Cache({{1, 2}, {4, 2}, {20, 2}}));
+    auto stats = cache.stats();
+    ASSERT_EQ(1, stats.bytes_wasted);
+    ASSERT_EQ(lazy ? 0 : 2, stats.num_reads);
+    ASSERT_EQ(lazy ? 0 : 7, stats.bytes_read);
+
+    // BufferReader reads synchronously, so a lazy cache only misses once
+    ASSERT_OK(cache.Read({1, 2}));
+    ASSERT_OK(cache.Read({4, 2}));
+    stats = cache.stats();
+    ASSERT_EQ(lazy ? 1 : 2, stats.num_hits);
+    ASSERT_EQ(lazy ? 1 : 0, stats.num_misses);
+    ASSERT_EQ(lazy ? 1 : 2, stats.num_reads);
+    ASSERT_EQ(lazy ? 5 : 7, stats.bytes_read);
+  }
+}
+
+TEST(ReadLatencyModel, Estimate) {
+  constexpr int64_t kMiB = 1024 * 1024;
+  double time_to_first_byte, bandwidth;
+
+  // TTFB = 10 ms, BW = 100 MiB/s
+  internal::ReadLatencyModel model;
+  for (int64_t i = 0; i < 100; ++i) {
+    ASSERT_EQ(i >= internal::ReadLatencyModel::kMinSamples,
+              model.Estimate(&time_to_first_byte, &bandwidth));
+    const int64_t nbytes = (1 + i % 4) * kMiB;
+    model.Record(nbytes, 0.01 + static_cast<double>(nbytes) / (100 * kMiB));
+  }
+  ASSERT_TRUE(model.Estimate(&time_to_first_byte, &bandwidth));
+  ASSERT_NEAR(0.01, time_to_first_byte, 1e-9);
+  ASSERT_NEAR(100 * kMiB, bandwidth, 1e-3);
+
+  // Uniformly sized reads can't tell latency from bandwidth
+  internal::ReadLatencyModel uniform_model;
+  for (int64_t i = 0; i < 100; ++i) {
+    uniform_model.Record(kMiB, 0.02);
+  }
+  ASSERT_FALSE(uniform_model.Estimate(&time_to_first_byte, &bandwidth));
+}
+
+TEST(RangeReadCache, Adaptive) {
+  // Latency models are shared by files of the same type
+  class AdaptiveBufferReader : public BufferReader {
+    using BufferReader::BufferReader;
+  };
+  constexpr int64_t kMiB = 1024 * 1024;
+  auto file = std::make_shared<AdaptiveBufferReader>(Buffer(std::string(4 * kMiB, 'x')));
+
+  CacheOptions options = CacheOptions::Defaults();
+  options.adaptive = true;
+  {
+    // Not enough reads observed yet
+    internal::ReadRangeCache cache(file, {}, options);
+    ASSERT_EQ(options, cache.options());
+  }
+
+  // TTFB = 10 ms, BW = 100 MiB/s
+  auto model = internal::ReadLatencyModel::ForFile(*file);
+  ASSERT_EQ(model, internal::ReadLatencyModel::ForFile(*file));
+  ASSERT_NE(model, internal::ReadLatencyModel::ForFile(BufferReader(Buffer(""))));
+  for (int64_t i = 0; i < 100; ++i) {
+    const int64_t nbytes = (1 + i % 4) * kMiB;
+    model->Record(nbytes, 0.01 + static_cast<double>(nbytes) / (100 * kMiB));
+  }
+
+  internal::ReadRangeCache cache(file, {}, options);
+  CacheOptions expected = CacheOptions::MakeFromNetworkMetrics(10, 100);
+  expected.adaptive = true;
+  ASSERT_EQ(expected, cache.options());
+
+  // A 512 KiB hole is now worth reading over
+  ASSERT_OK(cache.Cache({{0, kMiB}, {kMiB + kMiB / 2, kMiB}}));
+  ASSERT_EQ(1, cache.stats().num_reads);
+  ASSERT_EQ(kMiB / 2, cache.stats().bytes_wasted);
+  ASSERT_FINISHES_OK(cache.Wait());
+}
+
 TEST(CacheOptions, Basics) {
   auto check = [](const CacheOptions actual, const double expected_hole_size_limit_MiB,
                   const double expected_range_size_limit_MiB) -> void {
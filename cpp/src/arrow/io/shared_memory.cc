@@ -0,0 +1,392 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/shared_memory.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <set>
+#include <thread>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+namespace {
+
+// "ARROWRNG" in little endian
+constexpr uint64_t kRingMagic = 0x474e52574f525241ULL;
+
+// The header is followed by the data of the ring buffer. Positions are the numbers
+// of bytes written or released since the creation of the ring buffer, so that the
+// byte at position p is stored at p % capacity.
+//
+// The atomics are lock-free, hence address-free, so that they may be shared
+// between processes.
+struct RingHeader {
+  std::atomic<uint64_t> magic;
+  int64_t capacity;
+  // The end of the bytes written so far
+  std::atomic<int64_t> write_position;
+  // The end of the bytes the reader is done with, which may be overwritten
+  std::atomic<int64_t> release_position;
+  std::atomic<int32_t> writer_closed;
+  std::atomic<int32_t> reader_closed;
+};
+
+constexpr int64_t kHeaderSize = 64;
+static_assert(sizeof(RingHeader) <= kHeaderSize, "RingHeader doesn't fit");
+
+// Wait for the other side of the ring buffer, which may live in another process,
+// with an increasing backoff
+template <typename Predicate>
+void WaitUntil(Predicate&& predicate) {
+  int64_t sleep_us = 1;
+  for (int attempt = 0; !predicate(); ++attempt) {
+    if (attempt < 100) {
+      std::this_thread::yield();
+    } else {
+      std::this_thread::sleep_for(std::chrono::microseconds(sleep_us));
+      sleep_us = std::min<int64_t>(sleep_us * 2, 1000);
+    }
+  }
+}
+
+}  // namespace
+
+class SharedMemoryRing : public std::enable_shared_from_this<SharedMemoryRing> {
+ public:
+  static Result<std::shared_ptr<SharedMemoryRing>> Create(const std::string& path,
+                                                          int64_t capacity) {
+    if (capacity <= 0) {
+      return Status::Invalid("Ring buffer capacity must be positive, got ", capacity);
+    }
+    capacity = bit_util::RoundUpToMultipleOf64(capacity);
+    ARROW_ASSIGN_OR_RAISE(auto file,
+                          MemoryMappedFile::Create(path, kHeaderSize + capacity));
+    auto ring = std::shared_ptr<SharedMemoryRing>(new SharedMemoryRing());
+    RETURN_NOT_OK(ring->Map(std::move(file)));
+
+    auto header = new (ring->header_) RingHeader();
+    header->capacity = capacity;
+    header->write_position.store(0);
+    header->release_position.store(0);
+    header->writer_closed.store(0);
+    header->reader_closed.store(0);
+    if (!header->write_position.is_lock_free()) {
+      return Status::NotImplemented("Shared memory ring buffers need lock-free atomics");
+    }
+    // Publish the header to the reader last
+    header->magic.store(kRingMagic, std::memory_order_release);
+    ring->capacity_ = capacity;
+    return ring;
+  }
+
+  static Result<std::shared_ptr<SharedMemoryRing>> Open(const std::string& path) {
+    ARROW_ASSIGN_OR_RAISE(auto file, MemoryMappedFile::Open(path, FileMode::READWRITE));
+    ARROW_ASSIGN_OR_RAISE(auto size, file->GetSize());
+    if (size < kHeaderSize) {
+      return Status::Invalid("File '", path, "' is not a shared memory ring buffer");
+    }
+    auto ring = std::shared_ptr<SharedMemoryRing>(new SharedMemoryRing());
+    RETURN_NOT_OK(ring->Map(std::move(file)));
+
+    auto header = ring->header();
+    if (header->magic.load(std::memory_order_acquire) != kRingMagic ||
+        header->capacity != size - kHeaderSize) {
+      return Status::Invalid("File '", path, "' is not a shared memory ring buffer");
+    }
+    ring->capacity_ = header->capacity;
+    return ring;
+  }
+
+  ~SharedMemoryRing() { DCHECK(outstanding_reads_.empty()); }
+
+  // Writer side
+
+  int64_t write_position() const { return write_position_; }
+
+  Status Write(const uint8_t* data, int64_t nbytes) {
+    auto header = this->header();
+    while (nbytes > 0) {
+      int64_t release_position = 0;
+      WaitUntil([&] {
+        release_position = header->release_position.load(std::memory_order_acquire);
+        return header->reader_closed.load(std::memory_order_acquire) ||
+               write_position_ - release_position < capacity_;
+      });
+      if (header->reader_closed.load(std::memory_order_acquire)) {
+        return Status::IOError("Shared memory ring buffer was closed by the reader");
+      }
+
+      const int64_t offset = write_position_ % capacity_;
+      const int64_t free_space = capacity_ - (write_position_ - release_position);
+      const int64_t chunk_size = std::min({nbytes, free_space, capacity_ - offset});
+      std::memcpy(data_ + offset, data, static_cast<size_t>(chunk_size));
+      write_position_ += chunk_size;
+      header->write_position.store(write_position_, std::memory_order_release);
+      data += chunk_size;
+      nbytes -= chunk_size;
+    }
+    return Status::OK();
+  }
+
+  void CloseWriter() { header()->writer_closed.store(1, std::memory_order_release); }
+
+  // Reader side
+
+  int64_t read_position() const { return read_position_; }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) {
+    auto out_data = static_cast<uint8_t*>(out);
+    int64_t total_bytes_read = 0;
+    // Reads larger than the ring buffer are done in several steps, as the writer
+    // cannot write them at once
+    while (total_bytes_read < nbytes) {
+      const int64_t chunk_size = std::min(nbytes - total_bytes_read, capacity_);
+      ARROW_ASSIGN_OR_RAISE(auto bytes_read, WaitForData(chunk_size));
+      Copy(read_position_, bytes_read, out_data + total_bytes_read);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        read_position_ += bytes_read;
+        UpdateReleasePosition();
+      }
+      total_bytes_read += bytes_read;
+      if (bytes_read < chunk_size) {
+        break;
+      }
+    }
+    return total_bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes, MemoryPool* pool) {
+    if (nbytes > capacity_) {
+      ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool));
+      ARROW_ASSIGN_OR_RAISE(auto bytes_read, Read(nbytes, buffer->mutable_data()));
+      RETURN_NOT_OK(buffer->Resize(bytes_read, /*shrink_to_fit=*/false));
+      return std::move(buffer);
+    }
+    ARROW_ASSIGN_OR_RAISE(nbytes, WaitForData(nbytes));
+    const int64_t offset = read_position_ % capacity_;
+    if (nbytes == 0 || offset + nbytes > capacity_) {
+      // The bytes wrap around the end of the ring buffer
+      ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(nbytes, pool));
+      Copy(read_position_, nbytes, buffer->mutable_data());
+      std::lock_guard<std::mutex> lock(mutex_);
+      read_position_ += nbytes;
+      UpdateReleasePosition();
+      return std::move(buffer);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto buffer = std::make_shared<RingBuffer>(shared_from_this(), data_ + offset,
+                                               nbytes, read_position_);
+    outstanding_reads_.insert(read_position_);
+    read_position_ += nbytes;
+    return std::move(buffer);
+  }
+
+  void CloseReader() { header()->reader_closed.store(1, std::memory_order_release); }
+
+ private:
+  // A zero-copy read, whose bytes may only be overwritten once it is destroyed
+  class RingBuffer : public Buffer {
+   public:
+    RingBuffer(std::shared_ptr<SharedMemoryRing> ring, const uint8_t* data,
+               int64_t size, int64_t position)
+        : Buffer(data, size), ring_(std::move(ring)), position_(position) {}
+
+    ~RingBuffer() override { ring_->Release(position_); }
+
+   private:
+    std::shared_ptr<SharedMemoryRing> ring_;
+    int64_t position_;
+  };
+
+  SharedMemoryRing() = default;
+
+  Status Map(std::shared_ptr<MemoryMappedFile> file) {
+    ARROW_ASSIGN_OR_RAISE(auto size, file->GetSize());
+    ARROW_ASSIGN_OR_RAISE(mapping_, file->ReadAt(0, size));
+    file_ = std::move(file);
+    // The mapping is writable
+    header_ = const_cast<uint8_t*>(mapping_->data());
+    data_ = header_ + kHeaderSize;
+    return Status::OK();
+  }
+
+  RingHeader* header() const { return reinterpret_cast<RingHeader*>(header_); }
+
+  // Wait until nbytes can be read, or fewer at the end of the stream
+  Result<int64_t> WaitForData(int64_t nbytes) {
+    if (nbytes < 0) {
+      return Status::Invalid("Cannot read a negative number of bytes");
+    }
+    auto header = this->header();
+    int64_t available = 0;
+    WaitUntil([&] {
+      // Check for the end of the stream first, so that the write position is final
+      const bool writer_closed = header->writer_closed.load(std::memory_order_acquire);
+      available =
+          header->write_position.load(std::memory_order_acquire) - read_position_;
+      return writer_closed || available >= nbytes;
+    });
+    return std::min(nbytes, available);
+  }
+
+  void Copy(int64_t position, int64_t nbytes, uint8_t* out) const {
+    const int64_t offset = position % capacity_;
+    const int64_t first_size = std::min(nbytes, capacity_ - offset);
+    std::memcpy(out, data_ + offset, static_cast<size_t>(first_size));
+    std::memcpy(out + first_size, data_, static_cast<size_t>(nbytes - first_size));
+  }
+
+  void Release(int64_t position) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    outstanding_reads_.erase(outstanding_reads_.find(position));
+    UpdateReleasePosition();
+  }
+
+  // Let the writer reuse the bytes before the oldest outstanding zero-copy read.
+  // Must be called with mutex_ held.
+  void UpdateReleasePosition() {
+    const int64_t release_position =
+        outstanding_reads_.empty() ? read_position_ : *outstanding_reads_.begin();
+    header()->release_position.store(release_position, std::memory_order_release);
+  }
+
+  std::shared_ptr<MemoryMappedFile> file_;
+  std::shared_ptr<Buffer> mapping_;
+  uint8_t* header_ = NULLPTR;
+  uint8_t* data_ = NULLPTR;
+  int64_t capacity_ = 0;
+
+  int64_t write_position_ = 0;
+
+  // Protects read_position_ and outstanding_reads_, since zero-copy reads may be
+  // released from any thread
+  std::mutex mutex_;
+  int64_t read_position_ = 0;
+  // The positions of the zero-copy reads which weren't released yet
+  std::multiset<int64_t> outstanding_reads_;
+};
+
+}  // namespace internal
+
+// ----------------------------------------------------------------------
+// SharedMemoryOutputStream
+
+SharedMemoryOutputStream::SharedMemoryOutputStream(
+    std::shared_ptr<internal::SharedMemoryRing> ring)
+    : ring_(std::move(ring)), closed_(false) {}
+
+SharedMemoryOutputStream::~SharedMemoryOutputStream() { ARROW_UNUSED(Close()); }
+
+Result<std::shared_ptr<SharedMemoryOutputStream>> SharedMemoryOutputStream::Create(
+    const std::string& path, int64_t capacity) {
+  ARROW_ASSIGN_OR_RAISE(auto ring, internal::SharedMemoryRing::Create(path, capacity));
+  return std::shared_ptr<SharedMemoryOutputStream>(
+      new SharedMemoryOutputStream(std::move(ring)));
+}
+
+Status SharedMemoryOutputStream::Close() {
+  if (!closed_) {
+    ring_->CloseWriter();
+    closed_ = true;
+  }
+  return Status::OK();
+}
+
+bool SharedMemoryOutputStream::closed() const { return closed_; }
+
+Result<int64_t> SharedMemoryOutputStream::Tell() const {
+  if (closed_) {
+    return Status::IOError("OutputStream is closed");
+  }
+  return ring_->write_position();
+}
+
+Status SharedMemoryOutputStream::Write(const void* data, int64_t nbytes) {
+  if (closed_) {
+    return Status::IOError("OutputStream is closed");
+  }
+  return ring_->Write(static_cast<const uint8_t*>(data), nbytes);
+}
+
+// ----------------------------------------------------------------------
+// SharedMemoryInputStream
+
+SharedMemoryInputStream::SharedMemoryInputStream(
+    std::shared_ptr<internal::SharedMemoryRing> ring, MemoryPool* pool)
+    : ring_(std::move(ring)), pool_(pool), closed_(false) {}
+
+SharedMemoryInputStream::~SharedMemoryInputStream() { ARROW_UNUSED(Close()); }
+
+Result<std::shared_ptr<SharedMemoryInputStream>> SharedMemoryInputStream::Open(
+    const std::string& path, MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(auto ring, internal::SharedMemoryRing::Open(path));
+  return std::shared_ptr<SharedMemoryInputStream>(
+      new SharedMemoryInputStream(std::move(ring), pool));
+}
+
+Status SharedMemoryInputStream::Close() {
+  if (!closed_) {
+    ring_->CloseReader();
+    closed_ = true;
+  }
+  return Status::OK();
+}
+
+bool SharedMemoryInputStream::closed() const { return closed_; }
+
+Result<int64_t> SharedMemoryInputStream::Tell() const {
+  if (closed_) {
+    return Status::IOError("InputStream is closed");
+  }
+  return ring_->read_position();
+}
+
+bool SharedMemoryInputStream::supports_zero_copy() const { return true; }
+
+Result<int64_t> SharedMemoryInputStream::Read(int64_t nbytes, void* out) {
+  if (closed_) {
+    return Status::IOError("InputStream is closed");
+  }
+  return ring_->Read(nbytes, out);
+}
+
+Result<std::shared_ptr<Buffer>> SharedMemoryInputStream::Read(int64_t nbytes) {
+  if (closed_) {
+    return Status::IOError("InputStream is closed");
+  }
+  return ring_->Read(nbytes, pool_);
+}
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Streams over a ring buffer in shared memory, for passing data such as IPC
+// streams between processes of the same host
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+
+namespace internal {
+
+class SharedMemoryRing;
+
+}  // namespace internal
+
+/// \class SharedMemoryOutputStream
+/// \brief An output stream writing to a ring buffer in a memory-mapped file
+///
+/// The ring buffer is meant to be read by a single SharedMemoryInputStream, which
+/// may live in another process. The file should be on a memory-backed file
+/// system, such as /dev/shm on Linux. Writes block while the ring buffer is
+/// full, and fail once the input stream was closed.
+class ARROW_EXPORT SharedMemoryOutputStream : public OutputStream {
+ public:
+  ~SharedMemoryOutputStream() override;
+
+  /// \brief Create the file of a ring buffer and open it for writing
+  ///
+  /// \param[in] path the path of the file, which is created or truncated
+  /// \param[in] capacity the size of the ring buffer in bytes, rounded up to a
+  /// multiple of 64
+  static Result<std::shared_ptr<SharedMemoryOutputStream>> Create(
+      const std::string& path, int64_t capacity);
+
+  /// \brief Close the stream, signaling the end of the data to the reader
+  Status Close() override;
+  bool closed() const override;
+  Result<int64_t> Tell() const override;
+  Status Write(const void* data, int64_t nbytes) override;
+
+  /// \cond FALSE
+  using OutputStream::Write;
+  /// \endcond
+
+ private:
+  explicit SharedMemoryOutputStream(std::shared_ptr<internal::SharedMemoryRing> ring);
+
+  std::shared_ptr<internal::SharedMemoryRing> ring_;
+  bool closed_;
+};
+
+/// \class SharedMemoryInputStream
+/// \brief An input stream reading from the ring buffer of a SharedMemoryOutputStream
+///
+/// Reads block until the requested bytes were written or the output stream was
+/// closed. Read(nbytes) returns buffers pointing into the shared memory, unless
+/// the bytes wrap around the end of the ring buffer. The writer may only reuse
+/// the memory of such a buffer once it, and every buffer read before it, was
+/// destroyed: consumers holding on to their data, for example to record batches
+/// read from an IPC stream, must copy it or the writer eventually blocks.
+class ARROW_EXPORT SharedMemoryInputStream : public InputStream {
+ public:
+  ~SharedMemoryInputStream() override;
+
+  /// \brief Open the ring buffer file created by SharedMemoryOutputStream::Create
+  ///
+  /// \param[in] path the path of the file
+  /// \param[in] pool the memory pool for reads wrapping around the end of the
+  /// ring buffer
+  static Result<std::shared_ptr<SharedMemoryInputStream>> Open(
+      const std::string& path, MemoryPool* pool = default_memory_pool());
+
+  /// \brief Close the stream, making further writes fail
+  Status Close() override;
+  bool closed() const override;
+  Result<int64_t> Tell() const override;
+  bool supports_zero_copy() const override;
+  Result<int64_t> Read(int64_t nbytes, void* out) override;
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override;
+
+ private:
+  SharedMemoryInputStream(std::shared_ptr<internal::SharedMemoryRing> ring,
+                          MemoryPool* pool);
+
+  std::shared_ptr<internal::SharedMemoryRing> ring_;
+  MemoryPool* pool_;
+  bool closed_;
+};
+
+}  // namespace io
+}  // namespace arrow
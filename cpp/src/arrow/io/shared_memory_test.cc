@@ -0,0 +1,152 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/shared_memory.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+
+using internal::TemporaryDir;
+
+namespace io {
+
+class TestSharedMemoryStreams : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("shared-memory-test-"));
+    ASSERT_OK_AND_ASSIGN(auto path, temp_dir_->path().Join("ring"));
+    path_ = path.ToString();
+  }
+
+  void Open(int64_t capacity) {
+    ASSERT_OK_AND_ASSIGN(output_, SharedMemoryOutputStream::Create(path_, capacity));
+    ASSERT_OK_AND_ASSIGN(input_, SharedMemoryInputStream::Open(path_));
+  }
+
+ protected:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  std::string path_;
+  std::shared_ptr<SharedMemoryOutputStream> output_;
+  std::shared_ptr<SharedMemoryInputStream> input_;
+};
+
+TEST_F(TestSharedMemoryStreams, Roundtrip) {
+  // Much more data than the ring buffer holds, so that it wraps around many times
+  Open(/*capacity=*/256);
+  std::vector<uint8_t> data(100000);
+  random_bytes(data.size(), /*seed=*/0, data.data());
+
+  std::thread writer([&] {
+    size_t position = 0;
+    for (size_t size = 1; position < data.size(); size = (size * 7) % 1000 + 1) {
+      size = std::min(size, data.size() - position);
+      ASSERT_OK(output_->Write(data.data() + position, size));
+      position += size;
+    }
+    ASSERT_OK(output_->Close());
+  });
+
+  std::vector<uint8_t> read_data;
+  for (int64_t size = 1;; size = (size * 13) % 500 + 1) {
+    std::shared_ptr<Buffer> buffer;
+    if (size % 2 == 0) {
+      ASSERT_OK_AND_ASSIGN(buffer, input_->Read(size));
+    } else {
+      ASSERT_OK_AND_ASSIGN(buffer, AllocateBuffer(size));
+      ASSERT_OK_AND_ASSIGN(auto bytes_read,
+                           input_->Read(size, buffer->mutable_data()));
+      buffer = SliceBuffer(buffer, 0, bytes_read);
+    }
+    read_data.insert(read_data.end(), buffer->data(), buffer->data() + buffer->size());
+    if (buffer->size() < size) {
+      // End of stream
+      break;
+    }
+  }
+  writer.join();
+  ASSERT_EQ(read_data, data);
+  ASSERT_OK_AND_EQ(static_cast<int64_t>(data.size()), input_->Tell());
+  ASSERT_OK_AND_ASSIGN(auto buffer, input_->Read(10));
+  ASSERT_EQ(buffer->size(), 0);
+}
+
+TEST_F(TestSharedMemoryStreams, ZeroCopyReadsHoldSpace) {
+  Open(/*capacity=*/64);
+  const std::string data(64, 'x');
+  ASSERT_OK(output_->Write(data));
+
+  ASSERT_OK_AND_ASSIGN(auto first, input_->Read(32));
+  ASSERT_OK_AND_ASSIGN(auto second, input_->Read(32));
+  AssertBufferEqual(*first, std::string(32, 'x'));
+
+  // The ring buffer is full until the first read is released, even though
+  // everything was read
+  std::atomic<bool> written(false);
+  std::thread writer([&] {
+    ASSERT_OK(output_->Write(std::string(32, 'y')));
+    written = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ASSERT_FALSE(written);
+  second.reset();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ASSERT_FALSE(written);
+  first.reset();
+  writer.join();
+  ASSERT_TRUE(written);
+
+  ASSERT_OK_AND_ASSIGN(auto third, input_->Read(32));
+  AssertBufferEqual(*third, std::string(32, 'y'));
+}
+
+TEST_F(TestSharedMemoryStreams, ReaderClosed) {
+  Open(/*capacity=*/64);
+  ASSERT_OK(input_->Close());
+  ASSERT_RAISES(IOError, input_->Read(1));
+  ASSERT_RAISES(IOError, output_->Write(std::string(8, 'x')));
+}
+
+TEST_F(TestSharedMemoryStreams, NotARingBuffer) {
+  ASSERT_RAISES(Invalid, SharedMemoryOutputStream::Create(path_, 0));
+  // Not initialized by a writer
+  {
+    ASSERT_OK_AND_ASSIGN(auto file, FileOutputStream::Open(path_));
+    ASSERT_OK(file->Write(std::string(128, '\0')));
+    ASSERT_OK(file->Close());
+  }
+  ASSERT_RAISES(Invalid, SharedMemoryInputStream::Open(path_));
+}
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,434 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/uring_internal.h"
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define ARROW_WITH_IO_URING
+#endif
+#endif
+
+#ifdef ARROW_WITH_IO_URING
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "arrow/status.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+constexpr int IoUring::kDefaultEntries;
+
+#ifdef ARROW_WITH_IO_URING
+
+namespace {
+
+int SysIoUringSetup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int SysIoUringEnter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+}  // namespace
+
+class IoUring::Impl {
+ public:
+  ~Impl() {
+    if (ring_fd_ < 0) {
+      return;
+    }
+    if (reaper_.joinable()) {
+      DCHECK_NE(std::this_thread::get_id(), reaper_.get_id())
+          << "IoUring destroyed from a completion callback";
+      std::vector<Completion> failed;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        drained_.wait(lock, [this] { return inflight_ == 0 && backlog_.empty(); });
+        // A null operation tells the reaper to exit
+        PushLocked(nullptr);
+        FlushLocked(&failed);
+      }
+      DCHECK(failed.empty());
+      reaper_.join();
+    }
+    if (sqes_ != MAP_FAILED) {
+      munmap(sqes_, sqes_size_);
+    }
+    if (cq_ring_ != MAP_FAILED && cq_ring_ != sq_ring_) {
+      munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_ != MAP_FAILED) {
+      munmap(sq_ring_, sq_ring_size_);
+    }
+    close(ring_fd_);
+  }
+
+  Status Init(int entries) {
+    if (entries <= 0) {
+      return Status::Invalid("io_uring needs a positive number of entries");
+    }
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    ring_fd_ = SysIoUringSetup(static_cast<unsigned>(entries), &params);
+    if (ring_fd_ < 0) {
+      if (errno == ENOSYS) {
+        return Status::NotImplemented("io_uring is not supported by this kernel");
+      }
+      return ::arrow::internal::IOErrorFromErrno(errno, "io_uring_setup failed");
+    }
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+    sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+    if (sq_ring_ == MAP_FAILED) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "Failed to map io_uring");
+    }
+    cq_ring_ = single_mmap
+                   ? sq_ring_
+                   : mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+    if (cq_ring_ == MAP_FAILED) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "Failed to map io_uring");
+    }
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    sqes_ = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                 ring_fd_, IORING_OFF_SQES);
+    if (sqes_ == MAP_FAILED) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "Failed to map io_uring");
+    }
+
+    auto sq_ring = static_cast<uint8_t*>(sq_ring_);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq_ring + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned*>(sq_ring + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq_ring + params.sq_off.array);
+    auto cq_ring = static_cast<uint8_t*>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq_ring + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq_ring + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(cq_ring + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq_ring + params.cq_off.cqes);
+    tail_ = *sq_tail_;
+
+    // Bounding the operations in flight by the submission queue size ensures
+    // neither queue can overflow
+    capacity_ = std::min(params.sq_entries, params.cq_entries);
+    reaper_ = std::thread([this] { ReapLoop(); });
+    return Status::OK();
+  }
+
+  std::vector<Future<int64_t>> Read(const std::vector<UringRead>& reads) {
+    std::vector<Future<int64_t>> futures;
+    std::vector<Op*> ops;
+    futures.reserve(reads.size());
+    ops.reserve(reads.size());
+    for (const auto& read : reads) {
+      auto op = new Op{IORING_OP_READV, read, 0, {}, Future<int64_t>::Make()};
+      futures.push_back(op->future);
+      ops.push_back(op);
+    }
+    Submit(ops);
+    return futures;
+  }
+
+  void WillNeed(const std::vector<UringRead>& ranges) {
+    std::vector<Op*> ops;
+    ops.reserve(ranges.size());
+    for (const auto& range : ranges) {
+      ops.push_back(new Op{IORING_OP_FADVISE, range, 0, {}, {}});
+    }
+    Submit(ops);
+  }
+
+ private:
+  struct Op {
+    int opcode;
+    UringRead read;
+    int64_t bytes_done;
+    struct iovec iov;
+    // Invalid for operations whose outcome is ignored
+    Future<int64_t> future;
+  };
+
+  struct Completion {
+    Op* op;
+    Result<int64_t> result;
+  };
+
+  void Submit(const std::vector<Op*>& ops) {
+    std::vector<Completion> failed;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (Op* op : ops) {
+        // Excess operations are queued rather than waited for, as the caller
+        // may be a completion callback running on the reaper thread
+        if (inflight_ < capacity_ && backlog_.empty()) {
+          PushLocked(op);
+          ++inflight_;
+        } else {
+          backlog_.push_back(op);
+        }
+      }
+      FlushLocked(&failed);
+    }
+    Process({}, std::move(failed));
+  }
+
+  // Retire completed operations and resubmit unfinished ones
+  void Process(std::vector<Op*> resubmit, std::vector<Completion> done) {
+    while (!resubmit.empty() || !done.empty()) {
+      std::vector<Completion> failed;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        inflight_ -= static_cast<unsigned>(done.size());
+        for (Op* op : resubmit) {
+          PushLocked(op);
+        }
+        while (!backlog_.empty() && inflight_ < capacity_) {
+          PushLocked(backlog_.front());
+          backlog_.pop_front();
+          ++inflight_;
+        }
+        FlushLocked(&failed);
+        if (inflight_ == 0 && backlog_.empty()) {
+          drained_.notify_all();
+        }
+      }
+      for (auto& completion : done) {
+        if (completion.op->future.is_valid()) {
+          completion.op->future.MarkFinished(std::move(completion.result));
+        }
+        delete completion.op;
+      }
+      resubmit.clear();
+      done = std::move(failed);
+    }
+  }
+
+  void PushLocked(Op* op) {
+    const unsigned index = tail_ & sq_mask_;
+    io_uring_sqe* sqe = static_cast<io_uring_sqe*>(sqes_) + index;
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->user_data = reinterpret_cast<uint64_t>(op);
+    if (op == nullptr) {
+      sqe->opcode = IORING_OP_NOP;
+    } else if (op->opcode == IORING_OP_READV) {
+      op->iov.iov_base = op->read.out + op->bytes_done;
+      op->iov.iov_len = static_cast<size_t>(op->read.nbytes - op->bytes_done);
+      sqe->opcode = IORING_OP_READV;
+      sqe->fd = op->read.fd;
+      sqe->off = static_cast<uint64_t>(op->read.offset + op->bytes_done);
+      sqe->addr = reinterpret_cast<uint64_t>(&op->iov);
+      sqe->len = 1;
+    } else {
+      sqe->opcode = static_cast<uint8_t>(op->opcode);
+      sqe->fd = op->read.fd;
+      sqe->off = static_cast<uint64_t>(op->read.offset);
+      sqe->len = static_cast<uint32_t>(std::min<int64_t>(op->read.nbytes, UINT32_MAX));
+      sqe->fadvise_advice = POSIX_FADV_WILLNEED;
+    }
+    sq_array_[index] = index;
+    ++tail_;
+    ++to_submit_;
+  }
+
+  // Submit the pushed entries, failing them if the kernel refuses to
+  void FlushLocked(std::vector<Completion>* failed) {
+    if (to_submit_ == 0) {
+      return;
+    }
+    __atomic_store_n(sq_tail_, tail_, __ATOMIC_RELEASE);
+    while (to_submit_ > 0) {
+      int ret = SysIoUringEnter(ring_fd_, to_submit_, 0, 0);
+      if (ret > 0) {
+        to_submit_ -= static_cast<unsigned>(ret);
+        continue;
+      }
+      if (ret < 0 && (errno == EINTR || errno == EAGAIN)) {
+        continue;
+      }
+      const Status status =
+          ret < 0 ? ::arrow::internal::IOErrorFromErrno(errno, "io_uring_enter failed")
+                  : Status::IOError("io_uring_enter did not submit any entries");
+      // Take back the entries the kernel didn't consume
+      for (unsigned i = tail_ - to_submit_; i != tail_; ++i) {
+        const io_uring_sqe* sqe = static_cast<io_uring_sqe*>(sqes_) + (i & sq_mask_);
+        Op* op = reinterpret_cast<Op*>(sqe->user_data);
+        if (op != nullptr) {
+          failed->push_back({op, status});
+        }
+      }
+      tail_ -= to_submit_;
+      to_submit_ = 0;
+      __atomic_store_n(sq_tail_, tail_, __ATOMIC_RELEASE);
+    }
+  }
+
+  void ReapLoop() {
+    bool stop = false;
+    while (!stop) {
+      int ret = SysIoUringEnter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS);
+      if (ret < 0 && errno != EINTR) {
+        ARROW_LOG(WARNING) << ::arrow::internal::IOErrorFromErrno(
+                                  errno, "Failed waiting for io_uring completions")
+                                  .ToString();
+      }
+      std::vector<Op*> resubmit;
+      std::vector<Completion> done;
+      // Operations were last touched by submitters under the lock
+      std::unique_lock<std::mutex> lock(mutex_);
+      unsigned head = *cq_head_;
+      const unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+      for (; head != tail; ++head) {
+        const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+        Op* op = reinterpret_cast<Op*>(cqe.user_data);
+        if (op == nullptr) {
+          stop = true;
+        } else if (op->opcode != IORING_OP_READV) {
+          done.push_back({op, static_cast<int64_t>(cqe.res)});
+        } else if (cqe.res == -EINTR || cqe.res == -EAGAIN) {
+          resubmit.push_back(op);
+        } else if (cqe.res < 0) {
+          done.push_back({op, ::arrow::internal::IOErrorFromErrno(
+                                  -cqe.res, "io_uring read failed")});
+        } else {
+          // Continue short reads until end of file
+          op->bytes_done += cqe.res;
+          if (cqe.res > 0 && op->bytes_done < op->read.nbytes &&
+              op->bytes_done % op->read.alignment == 0) {
+            resubmit.push_back(op);
+          } else {
+            done.push_back({op, op->bytes_done});
+          }
+        }
+      }
+      __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+      lock.unlock();
+      Process(std::move(resubmit), std::move(done));
+    }
+  }
+
+  int ring_fd_ = -1;
+  void* sq_ring_ = MAP_FAILED;
+  void* cq_ring_ = MAP_FAILED;
+  void* sqes_ = MAP_FAILED;
+  size_t sq_ring_size_ = 0;
+  size_t cq_ring_size_ = 0;
+  size_t sqes_size_ = 0;
+
+  // Shared with the kernel
+  unsigned* sq_tail_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  io_uring_cqe* cqes_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned cq_mask_ = 0;
+
+  // Protected by mutex_
+  std::mutex mutex_;
+  std::condition_variable drained_;
+  unsigned tail_ = 0;
+  unsigned to_submit_ = 0;
+  unsigned inflight_ = 0;
+  unsigned capacity_ = 0;
+  std::deque<Op*> backlog_;
+
+  std::thread reaper_;
+};
+
+IoUring::IoUring() : impl_(new Impl()) {}
+
+IoUring::~IoUring() = default;
+
+Result<std::shared_ptr<IoUring>> IoUring::Make(int entries) {
+  std::shared_ptr<IoUring> ring(new IoUring());
+  RETURN_NOT_OK(ring->impl_->Init(entries));
+  return ring;
+}
+
+Result<std::shared_ptr<IoUring>> IoUring::GetInstance() {
+  static std::mutex mutex;
+  // Leaked, so that the ring outlives any static destructor issuing reads
+  static Result<std::shared_ptr<IoUring>>* instance = nullptr;
+  static pid_t instance_pid = 0;
+  std::lock_guard<std::mutex> lock(mutex);
+  if (instance == nullptr || instance_pid != getpid()) {
+    // The reaper thread doesn't survive a fork(), so a child gets its own ring
+    instance = new Result<std::shared_ptr<IoUring>>(Make());
+    instance_pid = getpid();
+  }
+  return *instance;
+}
+
+std::vector<Future<int64_t>> IoUring::Read(const std::vector<UringRead>& reads) {
+  return impl_->Read(reads);
+}
+
+void IoUring::WillNeed(const std::vector<UringRead>& ranges) {
+  impl_->WillNeed(ranges);
+}
+
+#else  // !ARROW_WITH_IO_URING
+
+class IoUring::Impl {};
+
+IoUring::IoUring() = default;
+
+IoUring::~IoUring() = default;
+
+Result<std::shared_ptr<IoUring>> IoUring::Make(int) {
+  return Status::NotImplemented("io_uring is not supported on this platform");
+}
+
+Result<std::shared_ptr<IoUring>> IoUring::GetInstance() { return Make(); }
+
+std::vector<Future<int64_t>> IoUring::Read(const std::vector<UringRead>&) { return {}; }
+
+void IoUring::WillNeed(const std::vector<UringRead>&) {}
+
+#endif  // ARROW_WITH_IO_URING
+
+bool IoUring::IsSupported() { return GetInstance().ok(); }
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/util/future.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+/// \brief A positional read request
+struct UringRead {
+  int fd;
+  int64_t offset;
+  int64_t nbytes;
+  uint8_t* out;
+  /// Short reads are continued while the bytes read are a multiple of this
+  /// (1 for regular files, the block size for files opened with O_DIRECT)
+  int64_t alignment;
+};
+
+/// \brief An io_uring instance for asynchronous file reads (Linux only)
+///
+/// Reads are submitted in batches, with a single system call per batch, and
+/// completed by a single thread reaping the ring.  Callbacks on the returned
+/// futures therefore run on that thread and should transfer any heavy work
+/// elsewhere.
+class ARROW_EXPORT IoUring {
+ public:
+  static constexpr int kDefaultEntries = 256;
+
+  ~IoUring();
+
+  /// \brief Create a ring with the given number of submission entries
+  ///
+  /// Returns NotImplemented if io_uring is not supported on this platform,
+  /// or an IOError if the kernel refuses to set up a ring.
+  static Result<std::shared_ptr<IoUring>> Make(int entries = kDefaultEntries);
+
+  /// \brief Return the process-wide ring, created on first use
+  static Result<std::shared_ptr<IoUring>> GetInstance();
+
+  /// \brief Whether io_uring can be used in this process
+  static bool IsSupported();
+
+  /// \brief Submit reads, returning the number of bytes read for each of them
+  ///
+  /// Fewer bytes than requested are only read at end of file.  The output
+  /// buffers must stay valid until the corresponding futures finish.
+  std::vector<Future<int64_t>> Read(const std::vector<UringRead>& reads);
+
+  /// \brief Submit POSIX_FADV_WILLNEED advice for the given reads' ranges
+  ///
+  /// This doesn't wait for the advice to be acted upon, and ignores errors
+  /// (the `out` pointers are unused).
+  void WillNeed(const std::vector<UringRead>& ranges);
+
+ private:
+  IoUring();
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -538,6 +538,7 @@ struct ArrayWriterV1 {
       is_nested_type<T>::value || is_null_type<T>::value || is_decimal_type<T>::value ||
           std::is_same<DictionaryType, T>::value || is_duration_type<T>::value ||
           is_interval_type<T>::value || is_fixed_size_binary_type<T>::value ||
+          is_binary_view_like_type<T>::value ||
           std::is_same<Date64Type, T>::value || std::is_same<Time64Type, T>::value ||
           std::is_same<ExtensionType, T>::value,
       Status>::type
@@ -815,6 +816,7 @@ Status WriteTable(const Table& table, io::OutputStream* dst,
     IpcWriteOptions ipc_options = IpcWriteOptions::Defaults();
     ipc_options.unify_dictionaries = true;
     ipc_options.allow_64bit = true;
+    ipc_options.write_statistics = properties.write_statistics;
     ARROW_ASSIGN_OR_RAISE(
         ipc_options.codec,
         util::Codec::Create(properties.compression, properties.compression_level));
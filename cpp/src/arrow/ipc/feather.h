@@ -139,6 +139,10 @@ struct ARROW_EXPORT WriteProperties {
 
   /// Compressor-specific compression level
   int compression_level = ::arrow::util::kUseDefaultCompressionLevel;
+
+  /// Whether to store the statistics of each chunk in the file footer, see
+  /// IpcWriteOptions::write_statistics
+  bool write_statistics = false;
 };
 
 ARROW_EXPORT
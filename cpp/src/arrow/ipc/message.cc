@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -28,6 +29,7 @@
 #include "arrow/buffer.h"
 #include "arrow/device.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
 #include "arrow/ipc/metadata_internal.h"
 #include "arrow/ipc/options.h"
 #include "arrow/ipc/reader.h"
@@ -53,6 +55,11 @@ class Message::MessageImpl {
   explicit MessageImpl(std::shared_ptr<Buffer> metadata, std::shared_ptr<Buffer> body)
       : metadata_(std::move(metadata)), message_(nullptr), body_(std::move(body)) {}
 
+  MessageImpl(std::shared_ptr<Buffer> metadata, BufferVector body_chunks)
+      : metadata_(std::move(metadata)),
+        message_(nullptr),
+        body_chunks_(std::move(body_chunks)) {}
+
   Status Open() {
     RETURN_NOT_OK(
         internal::VerifyMessage(metadata_->data(), metadata_->size(), &message_));
@@ -102,7 +109,27 @@ class Message::MessageImpl {
 
   int64_t body_length() const { return message_->bodyLength(); }
 
-  std::shared_ptr<Buffer> body() const { return body_; }
+  std::shared_ptr<Buffer> body() const {
+    std::lock_guard<std::mutex> lock(body_mutex_);
+    if (body_ == nullptr && !body_chunks_.empty()) {
+      // A concatenation failure is reported as a missing body
+      auto maybe_body = ConcatenateBuffers(body_chunks_);
+      if (maybe_body.ok()) {
+        body_ = maybe_body.MoveValueUnsafe();
+      }
+    }
+    return body_;
+  }
+
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenBody() const {
+    if (!body_chunks_.empty()) {
+      return std::make_shared<io::ChunkedBufferReader>(body_chunks_);
+    }
+    if (body_ == nullptr) {
+      return nullptr;
+    }
+    return Buffer::GetReader(body_);
+  }
 
   std::shared_ptr<Buffer> metadata() const { return metadata_; }
 
@@ -118,8 +145,10 @@ class Message::MessageImpl {
   // The reconstructed custom_metadata field from the Message Flatbuffer
   std::shared_ptr<const KeyValueMetadata> custom_metadata_;
 
-  // The message body, if any
-  std::shared_ptr<Buffer> body_;
+  // The message body, if any, concatenated on demand if it was received in chunks
+  mutable std::shared_ptr<Buffer> body_;
+  BufferVector body_chunks_;
+  mutable std::mutex body_mutex_;
 };
 
 Message::Message(std::shared_ptr<Buffer> metadata, std::shared_ptr<Buffer> body) {
@@ -133,10 +162,22 @@ Result<std::unique_ptr<Message>> Message::Open(std::shared_ptr<Buffer> metadata,
   return std::move(result);
 }
 
+Result<std::unique_ptr<Message>> Message::OpenChunked(std::shared_ptr<Buffer> metadata,
+                                                      BufferVector body_chunks) {
+  std::unique_ptr<Message> result(new Message());
+  result->impl_.reset(new MessageImpl(std::move(metadata), std::move(body_chunks)));
+  RETURN_NOT_OK(result->impl_->Open());
+  return std::move(result);
+}
+
 Message::~Message() {}
 
 std::shared_ptr<Buffer> Message::body() const { return impl_->body(); }
 
+Result<std::shared_ptr<io::RandomAccessFile>> Message::OpenBody() const {
+  return impl_->OpenBody();
+}
+
 int64_t Message::body_length() const { return impl_->body_length(); }
 
 std::shared_ptr<Buffer> Message::metadata() const { return impl_->metadata(); }
@@ -645,7 +686,10 @@ class MessageDecoder::MessageDecoderImpl {
       return Status::OK();
     }
 
-    chunks_.push_back(std::make_shared<Buffer>(data, size));
+    // Own the buffered data, since message bodies may be made of the buffered chunks
+    ARROW_ASSIGN_OR_RAISE(auto chunk, AllocateBuffer(size, pool_));
+    memcpy(chunk->mutable_data(), data, static_cast<size_t>(size));
+    chunks_.push_back(std::move(chunk));
     buffered_size_ += size;
     return ConsumeChunks();
   }
@@ -872,17 +916,22 @@ class MessageDecoder::MessageDecoderImpl {
       buffered_size_ -= used_size;
       return Status::OK();
     } else {
-      ARROW_ASSIGN_OR_RAISE(auto body, AllocateBuffer(next_required_size_, pool_));
-      RETURN_NOT_OK(ConsumeDataChunks(next_required_size_, body->mutable_data()));
-      std::shared_ptr<Buffer> shared_body(body.release());
-      return ConsumeBody(&shared_body);
+      // Hand the chunks over rather than copying them into a contiguous body, so
+      // that only the body buffers straddling two chunks get copied when read
+      ARROW_ASSIGN_OR_RAISE(auto body_chunks, TakeDataChunks(next_required_size_));
+      ARROW_ASSIGN_OR_RAISE(std::unique_ptr<Message> message,
+                            Message::OpenChunked(metadata_, std::move(body_chunks)));
+      return ConsumeMessage(std::move(message));
     }
   }
 
   Status ConsumeBody(std::shared_ptr<Buffer>* buffer) {
     ARROW_ASSIGN_OR_RAISE(std::unique_ptr<Message> message,
                           Message::Open(metadata_, *buffer));
+    return ConsumeMessage(std::move(message));
+  }
 
+  Status ConsumeMessage(std::unique_ptr<Message> message) {
     RETURN_NOT_OK(listener_->OnMessageDecoded(std::move(message)));
     state_ = State::INITIAL;
     next_required_size_ = kMessageDecoderNextRequiredSizeInitial;
@@ -932,6 +981,39 @@ class MessageDecoder::MessageDecoderImpl {
     return Status::OK();
   }
 
+  // Remove the first nbytes of the buffered data, returned as CPU buffers
+  Result<BufferVector> TakeDataChunks(int64_t nbytes) {
+    BufferVector taken;
+    size_t n_used_chunks = 0;
+    auto required_size = nbytes;
+    std::shared_ptr<Buffer> last_chunk;
+    for (auto& chunk : chunks_) {
+      if (!chunk->is_cpu()) {
+        ARROW_ASSIGN_OR_RAISE(
+            chunk, Buffer::ViewOrCopy(chunk, CPUDevice::memory_manager(pool_)));
+      }
+      auto data_size = chunk->size();
+      auto take_size = std::min(required_size, data_size);
+      n_used_chunks++;
+      required_size -= take_size;
+      if (take_size == data_size) {
+        taken.push_back(chunk);
+      } else {
+        taken.push_back(SliceBuffer(chunk, 0, take_size));
+        last_chunk = SliceBuffer(chunk, take_size);
+      }
+      if (required_size == 0) {
+        break;
+      }
+    }
+    chunks_.erase(chunks_.begin(), chunks_.begin() + n_used_chunks);
+    if (last_chunk.get() != nullptr) {
+      chunks_.insert(chunks_.begin(), std::move(last_chunk));
+    }
+    buffered_size_ -= nbytes;
+    return taken;
+  }
+
   std::shared_ptr<MessageDecoderListener> listener_;
   MemoryPool* pool_;
   State state_;
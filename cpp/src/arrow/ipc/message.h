@@ -61,6 +61,18 @@ class ARROW_EXPORT Message {
   static Result<std::unique_ptr<Message>> Open(std::shared_ptr<Buffer> metadata,
                                                std::shared_ptr<Buffer> body);
 
+  /// \brief Create and validate a Message instance whose body was received in
+  /// several chunks
+  ///
+  /// The chunks are only concatenated when body() is called. OpenBody() reads
+  /// them without copying, except for reads straddling several chunks.
+  ///
+  /// \param[in] metadata a buffer containing the Flatbuffer metadata
+  /// \param[in] body_chunks CPU buffers making up the message body
+  /// \return the created message
+  static Result<std::unique_ptr<Message>> OpenChunked(std::shared_ptr<Buffer> metadata,
+                                                      BufferVector body_chunks);
+
   /// \brief Read message body and create Message given Flatbuffer metadata
   /// \param[in] metadata containing a serialized Message flatbuffer
   /// \param[in] stream an InputStream
@@ -102,6 +114,13 @@ class ARROW_EXPORT Message {
   /// \return buffer is null if no body
   std::shared_ptr<Buffer> body() const;
 
+  /// \brief Open a reader of the Message body, if any
+  ///
+  /// Unlike body(), this doesn't concatenate a body received in several chunks.
+  ///
+  /// \return reader is null if no body
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenBody() const;
+
   /// \brief The expected body length according to the metadata, for
   /// verification purposes
   int64_t body_length() const;
@@ -132,6 +151,8 @@ class ARROW_EXPORT Message {
   }
 
  private:
+  Message() = default;
+
   // Hide serialization details from user API
   class MessageImpl;
   std::unique_ptr<MessageImpl> impl_;
@@ -25,6 +25,7 @@
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -38,6 +39,10 @@ namespace ipc {
 // maximum allowed recursion depth
 constexpr int kMaxNestingDepth = 64;
 
+/// \brief Key of the file footer custom metadata holding the statistics written
+/// when IpcWriteOptions::write_statistics is set
+constexpr char kBatchStatisticsKey[] = "ARROW:batch_statistics";
+
 /// \brief Options for writing Arrow IPC messages
 struct ARROW_EXPORT IpcWriteOptions {
   /// \brief If true, allow field lengths that don't fit in a signed 32-bit int.
@@ -64,9 +69,22 @@ struct ARROW_EXPORT IpcWriteOptions {
 
   /// \brief Compression codec to use for record batch body buffers
   ///
-  /// May only be UNCOMPRESSED, LZ4_FRAME and ZSTD.
+  /// May only be UNCOMPRESSED, LZ4_FRAME and ZSTD. The compression level is the
+  /// one the codec was created with, see util::Codec::Create().
   std::shared_ptr<util::Codec> codec;
 
+  /// \brief Minimum space savings for a body buffer to be stored compressed
+  ///
+  /// Space savings are 1 - compressed_size / uncompressed_size, so that 0.1
+  /// requires buffers to shrink by at least 10%. Buffers which compress worse
+  /// than this, such as already dense or random data and tiny buffers dominated
+  /// by the codec's framing overhead, are stored uncompressed, as allowed by the
+  /// format. This saves decompression time on the reader side.
+  ///
+  /// Must be between 0 and 1. If unset, every buffer is stored compressed. This
+  /// option is ignored if no codec is set.
+  util::optional<double> min_space_savings;
+
   /// \brief Use global CPU thread pool to parallelize any computational tasks
   /// like compression
   bool use_threads = true;
@@ -92,8 +110,11 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// dictionary in each record batch (or an extended dictionary + delta).
   ///
   /// If this option is true, RecordBatchWriter::WriteTable will attempt
-  /// to unify dictionaries across each table column.  If this option is
-  /// false, incompatible dictionaries across a table column will simply
+  /// to unify dictionaries across each table column, and
+  /// RecordBatchWriter::WriteRecordBatch will unify the dictionaries of each
+  /// top-level column with those of the previous record batches, writing
+  /// the values new to the unified dictionary as dictionary deltas.  If this
+  /// option is false, incompatible dictionaries across a table column will simply
   /// raise an error.
   ///
   /// Note that enabling this option has a runtime cost. Also, not all types
@@ -103,6 +124,24 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// and deltas.
   bool unify_dictionaries = false;
 
+  /// \brief Whether to store statistics of each record batch in the file footer
+  ///
+  /// The row count of each record batch and the minimum, maximum and null count
+  /// of each of its top-level columns are stored in the custom metadata of the
+  /// footer, under the kBatchStatisticsKey key. Readers may use them to skip
+  /// record batches, see RecordBatchFileReader::ReadStatistics(). Minimums and
+  /// maximums are only computed for boolean, numeric (except half-float),
+  /// temporal (except interval), binary and string columns.
+  ///
+  /// This option is ignored for IPC streams.
+  bool write_statistics = false;
+
+  /// \brief Maximum size of the messages an AsyncRecordBatchWriter queues for
+  /// writing before applying backpressure
+  ///
+  /// This option is ignored by other writers.
+  int64_t max_pending_write_bytes = 64 * 1024 * 1024;
+
   /// \brief Format version to use for IPC messages and their metadata.
   ///
   /// Presently using V5 version (readable by 1.0.0 and later).
@@ -133,6 +172,18 @@ struct ARROW_EXPORT IpcReadOptions {
   /// like decompression
   bool use_threads = true;
 
+  /// \brief Maximum size of the message bodies RecordBatchStreamReader reads ahead
+  ///
+  /// If positive, RecordBatchStreamReader reads record batch messages ahead of
+  /// the consumer until the bodies of the pending ones reach this many bytes,
+  /// and decompresses and byte-swaps them on the CPU thread pool while the next
+  /// messages are read. Record batches are still returned in stream order. At
+  /// least one record batch is read ahead, however large.
+  ///
+  /// If zero (the default), each record batch is read and decoded when
+  /// requested. This option is ignored if use_threads is false.
+  int64_t readahead_bytes = 0;
+
   /// \brief Whether to convert incoming data to platform-native endianness
   ///
   /// If the endianness of the received schema is not equal to platform-native
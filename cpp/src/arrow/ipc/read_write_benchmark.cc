@@ -17,10 +17,13 @@
 
 #include "benchmark/benchmark.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <sstream>
 #include <string>
 
+#include "arrow/array.h"
+#include "arrow/array/builder_binary.h"
 #include "arrow/buffer.h"
 #include "arrow/io/file.h"
 #include "arrow/io/memory.h"
@@ -30,6 +33,8 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/type.h"
+#include "arrow/util/byte_size.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/io_util.h"
 
 namespace arrow {
@@ -153,6 +158,13 @@ static void ReadStream(benchmark::State& state) {  // NOLINT non-const reference
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+// A listener discarding the decoded record batches
+class NullListener : public ipc::Listener {
+  Status OnRecordBatchDecoded(std::shared_ptr<RecordBatch> batch) override {
+    return Status::OK();
+  }
+};
+
 static void DecodeStream(benchmark::State& state) {  // NOLINT non-const reference
   // 1MB
   constexpr int64_t kTotalSize = 1 << 20;
@@ -171,18 +183,201 @@ static void DecodeStream(benchmark::State& state) {  // NOLINT non-const referen
 
   ipc::DictionaryMemo empty_memo;
   while (state.KeepRunning()) {
-    class NullListener : public ipc::Listener {
-      Status OnRecordBatchDecoded(std::shared_ptr<RecordBatch> batch) override {
-        return Status::OK();
-      }
-    } listener;
-    ipc::StreamDecoder decoder(std::shared_ptr<NullListener>(&listener, [](void*) {}),
+    ipc::StreamDecoder decoder(std::make_shared<NullListener>(),
                                ipc::IpcReadOptions::Defaults());
     ABORT_NOT_OK(decoder.Consume(buffer));
   }
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+std::shared_ptr<RecordBatch> MakeNestedRecordBatch(int64_t total_size) {
+  random::RandomArrayGenerator rand(0x4f32a908);
+  auto schema = arrow::schema(
+      {field("ints", list(int64())),
+       field("points", struct_({field("x", float64()), field("y", float64())})),
+       field("tags", list(struct_({field("key", utf8()), field("value", int32())})))});
+  // Roughly 100 bytes per row, most of them in the nested lists
+  const int64_t length = total_size / 100;
+  ArrayVector arrays;
+  for (const auto& field : schema->fields()) {
+    arrays.push_back(rand.ArrayOf(*field, length));
+  }
+  return RecordBatch::Make(schema, length, arrays);
+}
+
+// Batches of a dictionary-encoded column whose dictionary grows by
+// `values_per_batch` values at each batch
+RecordBatchVector MakeGrowingDictionaryBatches(int64_t num_batches, int64_t length,
+                                               int64_t values_per_batch) {
+  StringBuilder builder;
+  for (int64_t i = 0; i < num_batches * values_per_batch; ++i) {
+    ABORT_NOT_OK(builder.Append("value_" + std::to_string(i)));
+  }
+  std::shared_ptr<Array> all_values;
+  ABORT_NOT_OK(builder.Finish(&all_values));
+
+  random::RandomArrayGenerator rand(0x4f32a908);
+  auto type = dictionary(int32(), utf8());
+  auto schema = arrow::schema({field("dict", type)});
+  RecordBatchVector batches;
+  for (int64_t i = 0; i < num_batches; ++i) {
+    const int64_t dictionary_length = (i + 1) * values_per_batch;
+    auto indices = rand.Int32(length, 0, static_cast<int32_t>(dictionary_length - 1),
+                              /*null_probability=*/0.1);
+    ASSIGN_OR_ABORT(auto array,
+                    DictionaryArray::FromArrays(type, indices,
+                                                all_values->Slice(0, dictionary_length)));
+    batches.push_back(RecordBatch::Make(schema, length, {array}));
+  }
+  return batches;
+}
+
+std::shared_ptr<Buffer> WriteIpcStream(const RecordBatchVector& batches,
+                                       const ipc::IpcWriteOptions& options) {
+  std::shared_ptr<ResizableBuffer> buffer = *AllocateResizableBuffer(1024);
+  io::BufferOutputStream stream(buffer);
+  ASSIGN_OR_ABORT(auto writer,
+                  ipc::MakeStreamWriter(&stream, batches[0]->schema(), options));
+  for (const auto& batch : batches) {
+    ABORT_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ABORT_NOT_OK(writer->Close());
+  ABORT_NOT_OK(stream.Close());
+  return buffer;
+}
+
+void ReadIpcStream(const std::shared_ptr<Buffer>& buffer,
+                   const ipc::IpcReadOptions& options) {
+  io::BufferReader input(buffer);
+  ASSIGN_OR_ABORT(auto reader, ipc::RecordBatchStreamReader::Open(&input, options));
+  while (true) {
+    ASSIGN_OR_ABORT(auto batch, reader->Next());
+    if (batch == nullptr) {
+      break;
+    }
+  }
+}
+
+int64_t TotalBufferSize(const RecordBatchVector& batches) {
+  int64_t size = 0;
+  for (const auto& batch : batches) {
+    size += util::TotalBufferSize(*batch);
+  }
+  return size;
+}
+
+static void WriteNestedStream(benchmark::State& state) {  // NOLINT non-const reference
+  // 8MB
+  RecordBatchVector batches{MakeNestedRecordBatch(1 << 23)};
+  const auto options = ipc::IpcWriteOptions::Defaults();
+
+  for (auto _ : state) {
+    WriteIpcStream(batches, options);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * TotalBufferSize(batches));
+}
+
+static void ReadNestedStream(benchmark::State& state) {  // NOLINT non-const reference
+  // 8MB
+  RecordBatchVector batches{MakeNestedRecordBatch(1 << 23)};
+  auto buffer = WriteIpcStream(batches, ipc::IpcWriteOptions::Defaults());
+
+  for (auto _ : state) {
+    ReadIpcStream(buffer, ipc::IpcReadOptions::Defaults());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * TotalBufferSize(batches));
+}
+
+// Arguments: whether to emit dictionary deltas rather than replacements
+static void WriteDictStream(benchmark::State& state) {  // NOLINT non-const reference
+  auto batches = MakeGrowingDictionaryBatches(/*num_batches=*/64, /*length=*/1 << 14,
+                                              /*values_per_batch=*/1 << 10);
+  auto options = ipc::IpcWriteOptions::Defaults();
+  options.emit_dictionary_deltas = state.range(0);
+
+  for (auto _ : state) {
+    WriteIpcStream(batches, options);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * TotalBufferSize(batches));
+}
+
+static void ReadDictStream(benchmark::State& state) {  // NOLINT non-const reference
+  auto batches = MakeGrowingDictionaryBatches(/*num_batches=*/64, /*length=*/1 << 14,
+                                              /*values_per_batch=*/1 << 10);
+  auto options = ipc::IpcWriteOptions::Defaults();
+  options.emit_dictionary_deltas = state.range(0);
+  auto buffer = WriteIpcStream(batches, options);
+
+  for (auto _ : state) {
+    ReadIpcStream(buffer, ipc::IpcReadOptions::Defaults());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * TotalBufferSize(batches));
+}
+
+// Arguments: compression codec, whether to use threads
+static void WriteCompressed(benchmark::State& state) {  // NOLINT non-const reference
+  const auto codec_type = static_cast<Compression::type>(state.range(0));
+  if (!util::Codec::IsAvailable(codec_type)) {
+    state.SkipWithError("Codec not available");
+    return;
+  }
+  // 8MB
+  constexpr int64_t kTotalSize = 1 << 23;
+  RecordBatchVector batches{MakeRecordBatch(kTotalSize, /*num_fields=*/16)};
+  auto options = ipc::IpcWriteOptions::Defaults();
+  ASSIGN_OR_ABORT(options.codec, util::Codec::Create(codec_type));
+  options.use_threads = state.range(1);
+
+  for (auto _ : state) {
+    WriteIpcStream(batches, options);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
+}
+
+// Arguments: compression codec, whether to use threads
+static void ReadCompressed(benchmark::State& state) {  // NOLINT non-const reference
+  const auto codec_type = static_cast<Compression::type>(state.range(0));
+  if (!util::Codec::IsAvailable(codec_type)) {
+    state.SkipWithError("Codec not available");
+    return;
+  }
+  // 8MB
+  constexpr int64_t kTotalSize = 1 << 23;
+  RecordBatchVector batches{MakeRecordBatch(kTotalSize, /*num_fields=*/16)};
+  auto write_options = ipc::IpcWriteOptions::Defaults();
+  ASSIGN_OR_ABORT(write_options.codec, util::Codec::Create(codec_type));
+  auto buffer = WriteIpcStream(batches, write_options);
+  auto options = ipc::IpcReadOptions::Defaults();
+  options.use_threads = state.range(1);
+
+  for (auto _ : state) {
+    ReadIpcStream(buffer, options);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
+}
+
+// Arguments: size of the chunks fed to the decoder
+static void DecodeChunkedStream(benchmark::State& state) {  // NOLINT non-const reference
+  // 1MB in 16 batches
+  constexpr int64_t kTotalSize = 1 << 20;
+  const int64_t chunk_size = state.range(0);
+  RecordBatchVector batches;
+  for (int i = 0; i < 16; ++i) {
+    batches.push_back(MakeRecordBatch(kTotalSize / 16, /*num_fields=*/8));
+  }
+  auto buffer = WriteIpcStream(batches, ipc::IpcWriteOptions::Defaults());
+
+  for (auto _ : state) {
+    ipc::StreamDecoder decoder(std::make_shared<NullListener>(),
+                               ipc::IpcReadOptions::Defaults());
+    for (int64_t offset = 0; offset < buffer->size(); offset += chunk_size) {
+      ABORT_NOT_OK(decoder.Consume(SliceBuffer(
+          buffer, offset, std::min(chunk_size, buffer->size() - offset))));
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
+}
+
 #ifdef ARROW_WITH_ZSTD
 #define GENERATE_COMPRESSED_DATA_IN_MEMORY()                                      \
   constexpr int64_t kBatchSize = 1 << 20; /* 1 MB */                              \
@@ -370,5 +565,28 @@ BENCHMARK(WriteRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime(
 BENCHMARK(ReadRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(DecodeStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
+BENCHMARK(DecodeChunkedStream)
+    ->RangeMultiplier(16)
+    ->Range(1 << 6, 1 << 18)
+    ->ArgNames({"chunk_size"})
+    ->UseRealTime();
+
+BENCHMARK(WriteNestedStream)->UseRealTime();
+BENCHMARK(ReadNestedStream)->UseRealTime();
+BENCHMARK(WriteDictStream)->Arg(0)->Arg(1)->ArgNames({"deltas"})->UseRealTime();
+BENCHMARK(ReadDictStream)->Arg(0)->Arg(1)->ArgNames({"deltas"})->UseRealTime();
+
+const std::vector<std::string> kCompressionArgNames = {"codec", "use_threads"};
+const std::vector<std::vector<int64_t>> kCompressionArgs = {
+    {Compression::LZ4_FRAME, Compression::ZSTD}, {0, 1}};
+
+BENCHMARK(WriteCompressed)
+    ->ArgsProduct(kCompressionArgs)
+    ->ArgNames(kCompressionArgNames)
+    ->UseRealTime();
+BENCHMARK(ReadCompressed)
+    ->ArgsProduct(kCompressionArgs)
+    ->ArgNames(kCompressionArgNames)
+    ->UseRealTime();
 
 }  // namespace arrow
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <numeric>
@@ -40,6 +41,7 @@
 #include "arrow/ipc/test_common.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/testing/extension_type.h"
@@ -157,7 +159,7 @@ TEST_P(TestMessage, SerializeCustomMetadata) {
     ASSERT_OK(internal::WriteRecordBatchMessage(
         /*length=*/0, /*body_length=*/0, metadata,
         /*nodes=*/{},
-        /*buffers=*/{}, options_, &serialized));
+        /*buffers=*/{}, /*variadic_buffer_counts=*/{}, options_, &serialized));
     ASSERT_OK_AND_ASSIGN(std::unique_ptr<Message> message,
                          Message::Open(serialized, /*body=*/nullptr));
 
@@ -346,6 +348,8 @@ const std::vector<test::MakeRecordBatch*> kBatchCases = {
     &MakeStringTypesRecordBatchWithNulls,
     &MakeStruct,
     &MakeUnion,
+    &MakeRunEndEncoded,
+    &MakeBinaryViews,
     &MakeDictionary,
     &MakeNestedDictionary,
     &MakeMap,
@@ -566,6 +570,58 @@ TEST(TestMetadata, GetMetadataVersion) {
             ipc::internal::GetMetadataVersion(flatbuf::MetadataVersion::MAX));
 }
 
+TEST(TestReadBinaryView, SeveralVariadicBuffers) {
+  // Other implementations may spread the values of a binary view array over several
+  // variadic buffers, they are read into a single data buffer
+  using View = BinaryViewType::c_type;
+  const std::string data0 = "0123456789abcdef";
+  const std::string data1 = "xxxxhello, world!";
+  std::vector<View> views(4);
+  views[0].inlined.size = 6;
+  std::memcpy(views[0].inlined.data, "inline", 6);
+  views[1].ref = {16, {'0', '1', '2', '3'}, /*buffer_index=*/0, /*offset=*/0};
+  views[2].ref = {13, {'h', 'e', 'l', 'l'}, /*buffer_index=*/1, /*offset=*/4};
+  // The view of a null value is undefined
+  views[3].ref = {100, {'x', 'x', 'x', 'x'}, /*buffer_index=*/7, /*offset=*/-1};
+  const uint8_t validity = 0x07;
+
+  auto make_message = [&](std::vector<int64_t> variadic_buffer_counts)
+      -> Result<std::unique_ptr<Message>> {
+    std::string body(72, '\0');
+    body[0] = static_cast<char>(validity);
+    std::memcpy(&body[8], views.data(), views.size() * sizeof(View));
+    body += data0 + data1;
+    std::shared_ptr<Buffer> metadata;
+    RETURN_NOT_OK(internal::WriteRecordBatchMessage(
+        /*length=*/4, /*body_length=*/static_cast<int64_t>(body.size()),
+        /*custom_metadata=*/nullptr, /*nodes=*/{{4, 1, 0}},
+        /*buffers=*/{{0, 1}, {8, 64}, {72, 16}, {88, 17}}, variadic_buffer_counts,
+        IpcWriteOptions::Defaults(), &metadata));
+    return Message::Open(metadata, Buffer::FromString(std::move(body)));
+  };
+
+  auto schema = ::arrow::schema({field("f", utf8_view())});
+  DictionaryMemo memo;
+  ASSERT_OK_AND_ASSIGN(auto message, make_message({2}));
+  ASSERT_OK_AND_ASSIGN(auto batch, ReadRecordBatch(*message, schema, &memo,
+                                                   IpcReadOptions::Defaults()));
+  ASSERT_OK(batch->ValidateFull());
+  AssertArraysEqual(
+      *ArrayFromJSON(utf8_view(),
+                     R"(["inline", "0123456789abcdef", "hello, world!", null])"),
+      *batch->column(0));
+
+  // A view refers to a variadic buffer which is not in the body
+  ASSERT_OK_AND_ASSIGN(message, make_message({1}));
+  ASSERT_OK_AND_ASSIGN(batch, ReadRecordBatch(*message, schema, &memo,
+                                              IpcReadOptions::Defaults()));
+  ASSERT_RAISES(Invalid, batch->ValidateFull());
+  // The variadic buffer counts are missing
+  ASSERT_OK_AND_ASSIGN(message, make_message({}));
+  ASSERT_RAISES(IOError, ReadRecordBatch(*message, schema, &memo,
+                                         IpcReadOptions::Defaults()));
+}
+
 TEST_P(TestIpcRoundTrip, SliceRoundTrip) {
   std::shared_ptr<RecordBatch> batch;
   ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
@@ -735,6 +791,59 @@ TEST_F(TestWriteRecordBatch, WriteWithCompression) {
   }
 }
 
+TEST_F(TestWriteRecordBatch, WriteWithMinSpaceSavings) {
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  constexpr int64_t kLength = 1000;
+
+  // Random values can't be compressed by half, but constant ones can
+  Int64Builder constant_builder;
+  ASSERT_OK(constant_builder.AppendValues(std::vector<int64_t>(kLength, 42)));
+  ASSERT_OK_AND_ASSIGN(auto constant, constant_builder.Finish());
+  auto schema = ::arrow::schema({field("random", int64(), /*nullable=*/false),
+                                 field("constant", int64(), /*nullable=*/false)});
+  auto batch = RecordBatch::Make(
+      schema, kLength,
+      {rg.Int64(kLength, std::numeric_limits<int64_t>::min(),
+                std::numeric_limits<int64_t>::max(), /*null_probability=*/0),
+       constant});
+
+  // The uncompressed length prefixing each non-empty body buffer
+  auto buffer_prefixes = [&](const IpcWriteOptions& options) {
+    IpcPayload payload;
+    ARROW_EXPECT_OK(GetRecordBatchPayload(*batch, options, &payload));
+    std::vector<int64_t> prefixes;
+    for (const auto& buffer : payload.body_buffers) {
+      if (buffer->size() > 0) {
+        prefixes.push_back(
+            bit_util::FromLittleEndian(util::SafeLoadAs<int64_t>(buffer->data())));
+      }
+    }
+    return prefixes;
+  };
+
+  std::vector<Compression::type> codecs = {Compression::LZ4_FRAME, Compression::ZSTD};
+  for (auto codec : codecs) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    IpcWriteOptions write_options = IpcWriteOptions::Defaults();
+    ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(codec));
+    ASSERT_EQ(buffer_prefixes(write_options),
+              (std::vector<int64_t>{kLength * 8, kLength * 8}));
+
+    write_options.min_space_savings = 0.5;
+    ASSERT_EQ(buffer_prefixes(write_options), (std::vector<int64_t>{-1, kLength * 8}));
+    CheckRoundtrip(*batch, write_options);
+
+    write_options.min_space_savings = 1.0;
+    ASSERT_EQ(buffer_prefixes(write_options), (std::vector<int64_t>{-1, -1}));
+    CheckRoundtrip(*batch, write_options);
+
+    write_options.min_space_savings = 1.5;
+    ASSERT_RAISES(Invalid, SerializeRecordBatch(*batch, write_options));
+  }
+}
+
 TEST_F(TestWriteRecordBatch, SliceTruncatesBinaryOffsets) {
   // ARROW-6046
   std::shared_ptr<Array> array;
@@ -1778,6 +1887,64 @@ TEST(TestIpcFileFormat, FooterMetaData) {
   ASSERT_TRUE(out_metadata->Equals(*metadata));
 }
 
+TEST(TestIpcFileFormat, BatchStatistics) {
+  auto schema = ::arrow::schema({field("i", int32()), field("s", utf8()),
+                                 field("d", float64()), field("l", list(int32()))});
+  auto first = RecordBatchFromJSON(schema, R"([
+      {"i": 3, "s": "b", "d": 1.5, "l": [1]},
+      {"i": 1, "s": "a", "d": -2.0, "l": null},
+      {"i": null, "s": null, "d": null, "l": []}
+    ])");
+  auto second = RecordBatchFromJSON(schema, R"([
+      {"i": null, "s": "z", "d": null, "l": null},
+      {"i": null, "s": "y", "d": null, "l": null}
+    ])");
+  auto metadata = key_value_metadata({"ARROW:example"}, {"something"});
+
+  auto read_statistics = [&](const IpcWriteOptions& options)
+      -> Result<std::vector<RecordBatchStatistics>> {
+    FileWriterHelper helper;
+    RETURN_NOT_OK(helper.Init(schema, options, metadata));
+    RETURN_NOT_OK(helper.WriteBatch(first));
+    RETURN_NOT_OK(helper.WriteBatch(second));
+    RETURN_NOT_OK(helper.Finish());
+    auto buf_reader = std::make_shared<io::BufferReader>(helper.buffer_);
+    ARROW_ASSIGN_OR_RAISE(auto reader, RecordBatchFileReader::Open(
+                                           buf_reader.get(), helper.footer_offset_));
+    EXPECT_EQ(reader->metadata()->Get("ARROW:example").ValueOr(""), "something");
+    return reader->ReadStatistics();
+  };
+
+  ASSERT_OK_AND_ASSIGN(auto statistics, read_statistics(IpcWriteOptions::Defaults()));
+  ASSERT_TRUE(statistics.empty());
+
+  auto options = IpcWriteOptions::Defaults();
+  options.write_statistics = true;
+  ASSERT_OK_AND_ASSIGN(statistics, read_statistics(options));
+  ASSERT_EQ(statistics.size(), 2);
+
+  ASSERT_EQ(statistics[0].num_rows, 3);
+  ASSERT_EQ(statistics[0].columns.size(), 4);
+  AssertScalarsEqual(*MakeScalar(int32_t(1)), *statistics[0].columns[0].min);
+  AssertScalarsEqual(*MakeScalar(int32_t(3)), *statistics[0].columns[0].max);
+  ASSERT_EQ(statistics[0].columns[0].null_count, 1);
+  AssertScalarsEqual(*MakeScalar("a"), *statistics[0].columns[1].min);
+  AssertScalarsEqual(*MakeScalar("b"), *statistics[0].columns[1].max);
+  AssertScalarsEqual(*MakeScalar(-2.0), *statistics[0].columns[2].min);
+  AssertScalarsEqual(*MakeScalar(1.5), *statistics[0].columns[2].max);
+  // Lists have a null count but no bounds
+  ASSERT_EQ(statistics[0].columns[3].min, nullptr);
+  ASSERT_EQ(statistics[0].columns[3].null_count, 1);
+
+  ASSERT_EQ(statistics[1].num_rows, 2);
+  ASSERT_EQ(statistics[1].columns[0].min, nullptr);
+  ASSERT_EQ(statistics[1].columns[0].max, nullptr);
+  ASSERT_EQ(statistics[1].columns[0].null_count, 2);
+  AssertScalarsEqual(*MakeScalar("y"), *statistics[1].columns[1].min);
+  AssertScalarsEqual(*MakeScalar("z"), *statistics[1].columns[1].max);
+  ASSERT_EQ(statistics[1].columns[3].null_count, 2);
+}
+
 TEST_F(TestWriteRecordBatch, RawAndSerializedSizes) {
   // ARROW-8823: Recording total raw and serialized record batch sizes in WriteStats
   FileWriterHelper helper;
@@ -2072,6 +2239,131 @@ TEST(TestRecordBatchStreamReader, MalformedInput) {
   ASSERT_RAISES(Invalid, RecordBatchStreamReader::Open(&garbage_reader));
 }
 
+TEST(TestRecordBatchStreamReader, ReadAhead) {
+  auto type = dictionary(int8(), utf8());
+  auto schema = ::arrow::schema({field("dict", type), field("ints", int64())});
+  auto make_batch = [&](const std::string& indices, const std::string& dictionary,
+                        const std::string& ints) {
+    auto dict = DictArrayFromJSON(type, indices, dictionary);
+    return RecordBatch::Make(schema, dict->length(),
+                             {dict, ArrayFromJSON(int64(), ints)});
+  };
+  // The dictionary of the second batch is a delta, the one of the third a replacement
+  RecordBatchVector batches = {
+      make_batch("[0, 1, null]", R"(["foo", "bar"])", "[1, 2, 3]"),
+      make_batch("[2, 0]", R"(["foo", "bar", "quux"])", "[4, 5]"),
+      make_batch("[0, null, 0]", R"(["zzz"])", "[6, null, 7]"),
+      make_batch("[0]", R"(["zzz"])", "[8]")};
+
+  auto write_options = IpcWriteOptions::Defaults();
+  write_options.emit_dictionary_deltas = true;
+  if (util::Codec::IsAvailable(Compression::LZ4_FRAME)) {
+    ASSERT_OK_AND_ASSIGN(write_options.codec,
+                         util::Codec::Create(Compression::LZ4_FRAME));
+  }
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeStreamWriter(sink, schema, write_options));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  for (int64_t readahead_bytes : {1, 1 << 20}) {
+    ARROW_SCOPED_TRACE("readahead_bytes = ", readahead_bytes);
+    auto read_options = IpcReadOptions::Defaults();
+    read_options.readahead_bytes = readahead_bytes;
+    io::BufferReader buffer_reader(buffer);
+    ASSERT_OK_AND_ASSIGN(auto reader,
+                         RecordBatchStreamReader::Open(&buffer_reader, read_options));
+    for (const auto& expected : batches) {
+      ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+      ASSERT_NE(batch, nullptr);
+      AssertBatchesEqual(*expected, *batch);
+    }
+    ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+    ASSERT_EQ(batch, nullptr);
+    ASSERT_EQ(reader->stats().num_dictionary_deltas, 1);
+    ASSERT_EQ(reader->stats().num_replaced_dictionaries, 1);
+  }
+
+  // A truncated stream is reported after the record batches before the truncation
+  auto truncated = SliceBuffer(buffer, 0, buffer->size() - 16);
+  auto read_options = IpcReadOptions::Defaults();
+  read_options.readahead_bytes = 1 << 20;
+  io::BufferReader buffer_reader(truncated);
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       RecordBatchStreamReader::Open(&buffer_reader, read_options));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+    AssertBatchesEqual(*batches[i], *batch);
+  }
+  ASSERT_NOT_OK(reader->Next());
+}
+
+TEST(TestAsyncRecordBatchWriter, Roundtrip) {
+  auto schema = ::arrow::schema({field("ints", int64()), field("strs", utf8())});
+  RecordBatchVector batches;
+  for (int i = 0; i < 10; ++i) {
+    batches.push_back(RecordBatchFromJSON(
+        schema, R"([[1, "foo"], [null, "bar"], [)" + std::to_string(i) + R"(, null]])"));
+  }
+
+  auto write_options = IpcWriteOptions::Defaults();
+  // Apply backpressure after every record batch
+  write_options.max_pending_write_bytes = 1;
+
+  for (bool is_file_format : {false, true}) {
+    ARROW_SCOPED_TRACE("is_file_format = ", is_file_format);
+    ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+    std::shared_ptr<AsyncRecordBatchWriter> writer;
+    if (is_file_format) {
+      ASSERT_OK_AND_ASSIGN(writer, MakeAsyncFileWriter(sink, schema, write_options));
+    } else {
+      ASSERT_OK_AND_ASSIGN(writer, MakeAsyncStreamWriter(sink, schema, write_options));
+    }
+    for (const auto& batch : batches) {
+      ASSERT_FINISHES_OK(writer->WriteRecordBatch(*batch));
+    }
+    ASSERT_FINISHES_OK(writer->Close());
+    ASSERT_EQ(writer->stats().num_record_batches, 10);
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    io::BufferReader buffer_reader(buffer);
+    RecordBatchVector read_batches;
+    if (is_file_format) {
+      ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(&buffer_reader));
+      ASSERT_EQ(reader->num_record_batches(), 10);
+      for (int i = 0; i < reader->num_record_batches(); ++i) {
+        ASSERT_OK_AND_ASSIGN(auto batch, reader->ReadRecordBatch(i));
+        read_batches.push_back(std::move(batch));
+      }
+    } else {
+      ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchStreamReader::Open(&buffer_reader));
+      ASSERT_OK_AND_ASSIGN(read_batches, reader->ToRecordBatches());
+    }
+    ASSERT_EQ(read_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      AssertBatchesEqual(*batches[i], *read_batches[i]);
+    }
+  }
+}
+
+TEST(TestAsyncRecordBatchWriter, SinkError) {
+  auto schema = ::arrow::schema({field("ints", int64())});
+  auto batch = RecordBatchFromJSON(schema, "[[1], [2]]");
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK(sink->Close());
+
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeAsyncStreamWriter(sink, schema));
+  // Writing the batch may fail or not, depending on whether the write of the
+  // schema already failed in the background
+  auto written = writer->WriteRecordBatch(*batch);
+  written.Wait();
+  ASSERT_FINISHES_AND_RAISES(IOError, writer->Close());
+  ASSERT_FINISHES_AND_RAISES(IOError, writer->WriteRecordBatch(*batch));
+}
+
 TEST(TestStreamDecoder, NextRequiredSize) {
   auto listener = std::make_shared<CollectListener>();
   StreamDecoder decoder(listener);
@@ -2081,6 +2373,48 @@ TEST(TestStreamDecoder, NextRequiredSize) {
   ASSERT_EQ(next_required_size - 1, decoder.next_required_size());
 }
 
+TEST(TestStreamDecoder, ZeroCopyChunkedBody) {
+  // Two columns of 4000 bytes without validity bitmaps, so that the body is made
+  // of their data buffers only
+  constexpr int64_t kLength = 500;
+  std::vector<int64_t> values(kLength);
+  std::iota(values.begin(), values.end(), 0);
+  Int64Builder builder;
+  ASSERT_OK(builder.AppendValues(values));
+  ASSERT_OK_AND_ASSIGN(auto column, builder.Finish());
+  auto schema = ::arrow::schema({field("a", int64()), field("b", int64())});
+  auto batch = RecordBatch::Make(schema, kLength, {column, column});
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeStreamWriter(sink, schema));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto stream, sink->Finish());
+  // The body is followed by the end-of-stream marker
+  const int64_t body_end = stream->size() - 8;
+  const int64_t body_start = body_end - 2 * kLength * 8;
+
+  auto in_stream = [&](const std::shared_ptr<Array>& array) {
+    const uint8_t* data = array->data()->buffers[1]->data();
+    return data >= stream->data() && data < stream->data() + stream->size();
+  };
+
+  // Split the body between the columns, then in the middle of the first one
+  for (int64_t split : {body_start + kLength * 8, body_start + kLength * 4}) {
+    auto listener = std::make_shared<CollectListener>();
+    StreamDecoder decoder(listener);
+    ASSERT_OK(decoder.Consume(SliceBuffer(stream, 0, split)));
+    ASSERT_OK(decoder.Consume(SliceBuffer(stream, split)));
+    ASSERT_EQ(listener->record_batches().size(), 1);
+    auto decoded = listener->record_batches()[0];
+    AssertBatchesEqual(*batch, *decoded);
+
+    // Only the buffer straddling both chunks is copied
+    ASSERT_EQ(in_stream(decoded->column(0)), split == body_start + kLength * 8);
+    ASSERT_TRUE(in_stream(decoded->column(1)));
+  }
+}
+
 template <typename WriterHelperType>
 class TestDictionaryReplacement : public ::testing::Test {
  public:
@@ -2180,6 +2514,20 @@ class TestDictionaryReplacement : public ::testing::Test {
       EXPECT_EQ(read_stats_.num_dictionary_deltas, 2);
       CheckBatches(batches, actual);
     }
+
+    // IPC file format: WriteRecordBatch should unify dicts incrementally,
+    // writing the new values of the unified dicts as deltas
+    if (WriterHelper::kIsFileFormat) {
+      write_options_.emit_dictionary_deltas = false;
+      RecordBatchVector actual_unified;
+      ASSERT_OK(RoundTrip(batches, &actual_unified));
+      EXPECT_EQ(read_stats_.num_messages, 8);  // including schema message
+      EXPECT_EQ(read_stats_.num_record_batches, 4);
+      EXPECT_EQ(read_stats_.num_dictionary_batches, 3);
+      EXPECT_EQ(read_stats_.num_replaced_dictionaries, 0);
+      EXPECT_EQ(read_stats_.num_dictionary_deltas, 2);
+      CheckBatchesLogical(batches, actual_unified);
+    }
   }
 
   void TestSameDictValuesNested() {
@@ -2897,6 +3245,92 @@ TEST(TestRecordBatchFileReaderIo, ReadTwoContinousFieldsWithIoMerged) {
   GetReadRecordBatchReadRanges(64, {0, 1}, {8 + 64 * 4});
 }
 
+// A tracked file which, like a remote file, doesn't support zero-copy reads
+class TrackedNonZeroCopyFile : public TrackedRandomAccessFile {
+ public:
+  using TrackedRandomAccessFile::TrackedRandomAccessFile;
+
+  bool supports_zero_copy() const override { return false; }
+};
+
+TEST(TestRecordBatchFileReaderIo, ProjectionOfNonZeroCopyFile) {
+  constexpr int kNumRows = 10000;
+  auto buffer = MakeBooleanInt32Int64File(kNumRows, /*num_batches=*/2);
+  io::BufferReader buffer_reader(buffer);
+  ASSERT_OK_AND_ASSIGN(auto full_reader, RecordBatchFileReader::Open(&buffer_reader));
+
+  auto read_options = IpcReadOptions::Defaults();
+  read_options.included_fields = {0, 2};
+  // Keep the reads of the bool and int64 fields apart
+  read_options.pre_buffer_cache_options.hole_size_limit = 1024;
+
+  for (bool async : {false, true}) {
+    ARROW_SCOPED_TRACE("async = ", async);
+    TrackedNonZeroCopyFile tracked(&buffer_reader);
+    ASSERT_OK_AND_ASSIGN(auto reader,
+                         RecordBatchFileReader::Open(&tracked, read_options));
+    // Skip the reads of the footer
+    const auto num_footer_reads = tracked.num_reads();
+
+    std::shared_ptr<RecordBatch> batch;
+    if (async) {
+      ASSERT_FINISHES_OK_AND_ASSIGN(batch, reader->ReadRecordBatchAsync(1));
+    } else {
+      ASSERT_OK_AND_ASSIGN(batch, reader->ReadRecordBatch(1));
+    }
+    ASSERT_OK_AND_ASSIGN(auto expected, full_reader->ReadRecordBatch(1));
+    ASSERT_EQ(batch->num_columns(), 2);
+    AssertArraysEqual(*expected->column(0), *batch->column(0));
+    AssertArraysEqual(*expected->column(2), *batch->column(1));
+
+    // The metadata, then only the bool and int64 buffers
+    const auto& read_ranges = tracked.get_read_ranges();
+    ASSERT_EQ(read_ranges.size(), num_footer_reads + 3);
+    ASSERT_EQ(read_ranges[num_footer_reads + 1].length, kNumRows / 8);
+    ASSERT_EQ(read_ranges[num_footer_reads + 2].length, kNumRows * 8);
+  }
+}
+
+TEST(TestRecordBatchFileReaderIo, ProjectionOfNonZeroCopyFileCoalescesReads) {
+  // + 64 bool:  64 bits (8 bytes)
+  // + 64 int32: 64 * 4 bytes (256 bytes), skipped but small enough to be read through
+  // + 64 int64: 64 * 8 bytes (512 bytes)
+  constexpr int kNumRows = 64;
+  auto buffer = MakeBooleanInt32Int64File(kNumRows, /*num_batches=*/1);
+  io::BufferReader buffer_reader(buffer);
+  TrackedNonZeroCopyFile tracked(&buffer_reader);
+
+  auto read_options = IpcReadOptions::Defaults();
+  read_options.included_fields = {0, 2};
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(&tracked, read_options));
+  const auto num_footer_reads = tracked.num_reads();
+  ASSERT_OK_AND_ASSIGN(auto batch, reader->ReadRecordBatch(0));
+  ASSERT_EQ(batch->num_columns(), 2);
+
+  const auto& read_ranges = tracked.get_read_ranges();
+  ASSERT_EQ(read_ranges.size(), num_footer_reads + 2);
+  ASSERT_EQ(read_ranges.back().length, 8 + 256 + 512);
+}
+
+TEST(TestRecordBatchFileReader, CountRowsReadsMetadataOnly) {
+  // Large enough that the bodies are not coalesced with the metadata
+  constexpr int kNumRows = 10000;
+  auto buffer = MakeBooleanInt32Int64File(kNumRows, /*num_batches=*/3);
+
+  io::BufferReader buffer_reader(buffer);
+  TrackedRandomAccessFile tracked(&buffer_reader);
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(&tracked));
+  ASSERT_OK_AND_EQ(3 * kNumRows, reader->CountRows());
+  ASSERT_EQ(reader->stats().num_messages, 4);  // including schema message
+
+  // Skip the reads of the footer
+  const auto& read_ranges = tracked.get_read_ranges();
+  ASSERT_EQ(read_ranges.size(), 5u);
+  for (size_t i = 2; i < read_ranges.size(); ++i) {
+    ASSERT_LT(read_ranges[i].length, kNumRows);
+  }
+}
+
 constexpr static int kNumBatches = 10;
 // It can be difficult to know the exact size of the schema.  Instead we just make the
 // row data big enough that we can easily identify if a read is for a schema or for
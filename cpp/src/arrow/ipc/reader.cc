@@ -20,6 +20,8 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
+#include <limits>
 #include <numeric>
 #include <string>
 #include <type_traits>
@@ -41,10 +43,13 @@
 #include "arrow/ipc/reader_internal.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -53,6 +58,7 @@
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/parallel.h"
 #include "arrow/util/string.h"
 #include "arrow/util/thread_pool.h"
@@ -109,6 +115,17 @@ Status InvalidMessageType(MessageType expected, MessageType actual) {
     }                                                                   \
   } while (0)
 
+// A reader of the body of a message, which doesn't concatenate a body received in
+// several chunks
+Result<std::shared_ptr<io::RandomAccessFile>> GetBodyReader(const Message& message) {
+  ARROW_ASSIGN_OR_RAISE(auto reader, message.OpenBody());
+  if (reader == nullptr) {
+    return Status::IOError("Expected body in IPC message of type ",
+                           FormatMessageType(message.type()));
+  }
+  return reader;
+}
+
 }  // namespace
 
 // ----------------------------------------------------------------------
@@ -133,8 +150,8 @@ struct IpcReadContext {
 
   Compression::type compression;
 
-  /// \brief LoadRecordBatch() or LoadRecordBatchSubset() swaps endianness of elements
-  /// if this flag is true
+  /// \brief Record batches read with this context have the endianness of their
+  /// elements swapped if this flag is true
   const bool swap_endian;
 };
 
@@ -243,6 +260,20 @@ class ArrayLoader {
     }
   }
 
+  Result<int64_t> GetVariadicCount(int i) {
+    auto variadic_counts = metadata_->variadicBufferCounts();
+    CHECK_FLATBUFFERS_NOT_NULL(variadic_counts, "RecordBatch.variadicBufferCounts");
+    if (i >= static_cast<int>(variadic_counts->size())) {
+      return Status::IOError("variadic_count_index out of range.");
+    }
+    int64_t count = variadic_counts->Get(i);
+    if (count < 0 || count > std::numeric_limits<int32_t>::max()) {
+      return Status::IOError(
+          "variadic_count must be representable as a positive int32_t, got ", count, ".");
+    }
+    return count;
+  }
+
   Status GetFieldMetadata(int field_index, ArrayData* out) {
     auto nodes = metadata_->nodes();
     CHECK_FLATBUFFERS_NOT_NULL(nodes, "Table.nodes");
@@ -348,6 +379,23 @@ class ArrayLoader {
     return LoadBinary<T>(type.id());
   }
 
+  // Also matches StringViewType.  The variadic data buffers are loaded after the views
+  // and concatenated once the body is decompressed, see ConcatenateVariadicBuffers().
+  Status Visit(const BinaryViewType& type) {
+    out_->buffers.resize(2);
+
+    RETURN_NOT_OK(LoadCommon(type.id()));
+    RETURN_NOT_OK(GetBuffer(buffer_index_++, &out_->buffers[1]));
+
+    ARROW_ASSIGN_OR_RAISE(auto data_buffer_count,
+                          GetVariadicCount(variadic_count_index_++));
+    out_->buffers.resize(data_buffer_count + 2);
+    for (int64_t i = 0; i < data_buffer_count; ++i) {
+      RETURN_NOT_OK(GetBuffer(buffer_index_++, &out_->buffers[i + 2]));
+    }
+    return Status::OK();
+  }
+
   Status Visit(const FixedSizeBinaryType& type) {
     out_->buffers.resize(2);
     RETURN_NOT_OK(LoadCommon(type.id()));
@@ -416,6 +464,16 @@ class ArrayLoader {
     return LoadChildren(type.fields());
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    out_->buffers.resize(1);
+    RETURN_NOT_OK(LoadCommon(type.id()));
+    if (out_->null_count != 0) {
+      return Status::Invalid("Run-end encoded array should not have nulls, got ",
+                             out_->null_count);
+    }
+    return LoadChildren(type.fields());
+  }
+
   Status Visit(const DictionaryType& type) {
     // out_->dictionary will be filled later in ResolveDictionaries()
     return LoadType(*type.index_type());
@@ -433,6 +491,7 @@ class ArrayLoader {
   int max_recursion_depth_;
   int buffer_index_ = 0;
   int field_index_ = 0;
+  int variadic_count_index_ = 0;
   bool skip_io_ = false;
 
   BatchDataReadRequest read_request_;
@@ -456,6 +515,10 @@ Result<std::shared_ptr<Buffer>> DecompressBuffer(const std::shared_ptr<Buffer>&
   const uint8_t* data = buf->data();
   int64_t compressed_size = buf->size() - sizeof(int64_t);
   int64_t uncompressed_size = bit_util::FromLittleEndian(util::SafeLoadAs<int64_t>(data));
+  if (uncompressed_size == internal::kUncompressedBufferLength) {
+    // The writer stored the buffer uncompressed
+    return SliceBuffer(buf, sizeof(int64_t), compressed_size);
+  }
 
   ARROW_ASSIGN_OR_RAISE(auto uncompressed,
                         AllocateBuffer(uncompressed_size, options.memory_pool));
@@ -509,10 +572,117 @@ Status DecompressBuffers(Compression::type compression, const IpcReadOptions& op
       });
 }
 
-Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
-    const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
-    const std::vector<bool>* inclusion_mask, const IpcReadContext& context,
-    io::RandomAccessFile* file) {
+/// Binary view arrays of this library have a single data buffer, while IPC bodies may
+/// hold their values in any number of variadic buffers.  Concatenate them and rebase
+/// the views on the result.  Must run after decompression and byte-swapping, as it
+/// reads the views.
+Status ConcatenateVariadicBuffers(const IpcReadOptions& options, ArrayData* data) {
+  for (const auto& child : data->child_data) {
+    RETURN_NOT_OK(ConcatenateVariadicBuffers(options, child.get()));
+  }
+  const Type::type type_id = data->type->storage_id();
+  if (type_id != Type::BINARY_VIEW && type_id != Type::STRING_VIEW) {
+    return Status::OK();
+  }
+  if (data->buffers.size() == 2) {
+    data->buffers.emplace_back();
+    return AllocateBuffer(0, options.memory_pool).Value(&data->buffers[2]);
+  }
+  if (data->buffers.size() == 3) {
+    return Status::OK();
+  }
+
+  using View = BinaryViewType::c_type;
+  BufferVector data_buffers(data->buffers.begin() + 2, data->buffers.end());
+  std::vector<int64_t> data_buffer_offsets(data_buffers.size());
+  int64_t data_size = 0;
+  for (size_t i = 0; i < data_buffers.size(); ++i) {
+    data_buffer_offsets[i] = data_size;
+    data_size += data_buffers[i]->size();
+  }
+  if (data_size > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("Variadic buffers of ", data_size,
+                                 " bytes do not fit in a single binary view buffer");
+  }
+
+  const auto& views = data->buffers[1];
+  const int64_t num_views =
+      std::min(data->length, views->size() / static_cast<int64_t>(sizeof(View)));
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> rebased,
+                        AllocateBuffer(views->size(), options.memory_pool));
+  std::memcpy(rebased->mutable_data(), views->data(), static_cast<size_t>(views->size()));
+  auto rebased_views = reinterpret_cast<View*>(rebased->mutable_data());
+  const uint8_t* validity = data->null_count != 0 && data->buffers[0] != nullptr
+                                ? data->buffers[0]->data()
+                                : nullptr;
+  for (int64_t i = 0; i < num_views; ++i) {
+    View& view = rebased_views[i];
+    if (validity != nullptr && !bit_util::GetBit(validity, i)) {
+      // The views of null values are undefined
+      view = View{};
+      continue;
+    }
+    if (view.is_inline()) continue;
+    if (view.ref.buffer_index < 0 ||
+        view.ref.buffer_index >= static_cast<int32_t>(data_buffers.size())) {
+      return Status::Invalid("Binary view ", i, " refers to variadic buffer ",
+                             view.ref.buffer_index, " of ", data_buffers.size());
+    }
+    view.ref.offset += static_cast<int32_t>(data_buffer_offsets[view.ref.buffer_index]);
+    view.ref.buffer_index = 0;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto data_buffer,
+                        ConcatenateBuffers(data_buffers, options.memory_pool));
+  data->buffers = {data->buffers[0], std::move(rebased), std::move(data_buffer)};
+  return Status::OK();
+}
+
+Status ConcatenateVariadicBuffers(const IpcReadOptions& options,
+                                  const ArrayDataVector& fields) {
+  for (const auto& field : fields) {
+    RETURN_NOT_OK(ConcatenateVariadicBuffers(options, field.get()));
+  }
+  return Status::OK();
+}
+
+/// \brief A record batch whose columns are loaded and whose dictionaries are
+/// resolved, but whose buffers may still need decompressing and byte-swapping
+///
+/// Loading depends on the dictionaries read so far while finishing doesn't, so
+/// that record batches may be finished out of order on other threads.
+struct LoadedRecordBatch {
+  std::shared_ptr<Schema> schema;
+  int64_t length;
+  ArrayDataVector columns;
+  Compression::type compression;
+  bool swap_endian;
+  std::shared_ptr<KeyValueMetadata> custom_metadata;
+
+  Result<RecordBatchWithMetadata> Finish(const IpcReadOptions& options) && {
+    if (compression != Compression::UNCOMPRESSED) {
+      RETURN_NOT_OK(DecompressBuffers(compression, options, &columns));
+    }
+
+    // swap endian in a set of ArrayData if necessary (swap_endian == true)
+    if (swap_endian) {
+      for (int i = 0; i < static_cast<int>(columns.size()); ++i) {
+        ARROW_ASSIGN_OR_RAISE(columns[i],
+                              arrow::internal::SwapEndianArrayData(columns[i]));
+      }
+    }
+    RETURN_NOT_OK(ConcatenateVariadicBuffers(options, columns));
+    return RecordBatchWithMetadata{
+        RecordBatch::Make(std::move(schema), length, std::move(columns)),
+        std::move(custom_metadata)};
+  }
+};
+
+Result<LoadedRecordBatch> LoadRecordBatchSubset(const flatbuf::RecordBatch* metadata,
+                                                const std::shared_ptr<Schema>& schema,
+                                                const std::vector<bool>* inclusion_mask,
+                                                const IpcReadContext& context,
+                                                io::RandomAccessFile* file) {
   ArrayLoader loader(metadata, context.metadata_version, context.options, file);
 
   ArrayDataVector columns(schema->num_fields());
@@ -553,26 +723,16 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
     filtered_schema = schema;
     filtered_columns = std::move(columns);
   }
-  if (context.compression != Compression::UNCOMPRESSED) {
-    RETURN_NOT_OK(
-        DecompressBuffers(context.compression, context.options, &filtered_columns));
-  }
-
-  // swap endian in a set of ArrayData if necessary (swap_endian == true)
-  if (context.swap_endian) {
-    for (int i = 0; i < static_cast<int>(filtered_columns.size()); ++i) {
-      ARROW_ASSIGN_OR_RAISE(filtered_columns[i],
-                            arrow::internal::SwapEndianArrayData(filtered_columns[i]));
-    }
-  }
-  return RecordBatch::Make(std::move(filtered_schema), metadata->length(),
-                           std::move(filtered_columns));
+  return LoadedRecordBatch{std::move(filtered_schema), metadata->length(),
+                           std::move(filtered_columns), context.compression,
+                           context.swap_endian, /*custom_metadata=*/nullptr};
 }
 
-Result<std::shared_ptr<RecordBatch>> LoadRecordBatch(
-    const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
-    const std::vector<bool>& inclusion_mask, const IpcReadContext& context,
-    io::RandomAccessFile* file) {
+Result<LoadedRecordBatch> LoadRecordBatch(const flatbuf::RecordBatch* metadata,
+                                          const std::shared_ptr<Schema>& schema,
+                                          const std::vector<bool>& inclusion_mask,
+                                          const IpcReadContext& context,
+                                          io::RandomAccessFile* file) {
   if (inclusion_mask.size() > 0) {
     return LoadRecordBatchSubset(metadata, schema, &inclusion_mask, context, file);
   } else {
@@ -637,8 +797,7 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
     const IpcReadOptions& options, io::InputStream* file) {
   std::unique_ptr<Message> message;
   RETURN_NOT_OK(ReadContiguousPayload(file, &message));
-  CHECK_HAS_BODY(*message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(*message));
   return ReadRecordBatch(*message->metadata(), schema, dictionary_memo, options,
                          reader.get());
 }
@@ -647,16 +806,16 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
     const Message& message, const std::shared_ptr<Schema>& schema,
     const DictionaryMemo* dictionary_memo, const IpcReadOptions& options) {
   CHECK_MESSAGE_TYPE(MessageType::RECORD_BATCH, message.type());
-  CHECK_HAS_BODY(message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message.body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(message));
   return ReadRecordBatch(*message.metadata(), schema, dictionary_memo, options,
                          reader.get());
 }
 
-Result<RecordBatchWithMetadata> ReadRecordBatchInternal(
-    const Buffer& metadata, const std::shared_ptr<Schema>& schema,
-    const std::vector<bool>& inclusion_mask, IpcReadContext& context,
-    io::RandomAccessFile* file) {
+Result<LoadedRecordBatch> LoadRecordBatchInternal(const Buffer& metadata,
+                                                  const std::shared_ptr<Schema>& schema,
+                                                  const std::vector<bool>& inclusion_mask,
+                                                  IpcReadContext& context,
+                                                  io::RandomAccessFile* file) {
   const flatbuf::Message* message = nullptr;
   RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
   auto batch = message->header_as_RecordBatch();
@@ -681,9 +840,20 @@ Result<RecordBatchWithMetadata> ReadRecordBatchInternal(
     RETURN_NOT_OK(
         internal::GetKeyValueMetadata(message->custom_metadata(), &custom_metadata));
   }
-  ARROW_ASSIGN_OR_RAISE(auto record_batch,
+  ARROW_ASSIGN_OR_RAISE(auto loaded,
                         LoadRecordBatch(batch, schema, inclusion_mask, context, file));
-  return RecordBatchWithMetadata{record_batch, custom_metadata};
+  loaded.custom_metadata = std::move(custom_metadata);
+  return std::move(loaded);
+}
+
+Result<RecordBatchWithMetadata> ReadRecordBatchInternal(
+    const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+    const std::vector<bool>& inclusion_mask, IpcReadContext& context,
+    io::RandomAccessFile* file) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto loaded,
+      LoadRecordBatchInternal(metadata, schema, inclusion_mask, context, file));
+  return std::move(loaded).Finish(context.options);
 }
 
 // If we are selecting only certain fields, populate an inclusion mask for fast lookups.
@@ -815,6 +985,7 @@ Status ReadDictionary(const Buffer& metadata, const IpcReadContext& context,
   if (context.swap_endian) {
     ARROW_ASSIGN_OR_RAISE(dict_data, ::arrow::internal::SwapEndianArrayData(dict_data));
   }
+  RETURN_NOT_OK(ConcatenateVariadicBuffers(context.options, dict_data.get()));
 
   if (dictionary_batch->isDelta()) {
     if (kind != nullptr) {
@@ -834,8 +1005,7 @@ Status ReadDictionary(const Message& message, const IpcReadContext& context,
                       DictionaryKind* kind) {
   // Only invoke this method if we already know we have a dictionary message
   DCHECK_EQ(message.type(), MessageType::DICTIONARY_BATCH);
-  CHECK_HAS_BODY(message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message.body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(message));
   return ReadDictionary(*message.metadata(), context, kind, reader.get());
 }
 
@@ -844,10 +1014,20 @@ Status ReadDictionary(const Message& message, const IpcReadContext& context,
 
 class RecordBatchStreamReaderImpl : public RecordBatchStreamReader {
  public:
+  ~RecordBatchStreamReaderImpl() override {
+    // Record batches being finished on other threads refer to finish_options_
+    for (const auto& pending : pending_batches_) {
+      pending.batch.Wait();
+    }
+  }
+
   Status Open(std::unique_ptr<MessageReader> message_reader,
               const IpcReadOptions& options) {
     message_reader_ = std::move(message_reader);
     options_ = options;
+    // Each record batch is finished on a single thread of the CPU thread pool
+    finish_options_ = options;
+    finish_options_.use_threads = false;
 
     // Read schema
     ARROW_ASSIGN_OR_RAISE(std::unique_ptr<Message> message, ReadNextMessage());
@@ -879,6 +1059,31 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader {
       return batch_with_metadata;
     }
 
+    if (options_.readahead_bytes > 0 && options_.use_threads) {
+      return ReadNextAhead();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto loaded, LoadNextRecordBatch());
+    if (!loaded.has_value()) {
+      // End of stream
+      return batch_with_metadata;
+    }
+    return std::move(*loaded).Finish(options_);
+  }
+
+  std::shared_ptr<Schema> schema() const override { return out_schema_; }
+
+  ReadStats stats() const override { return stats_; }
+
+ private:
+  struct PendingRecordBatch {
+    Future<RecordBatchWithMetadata> batch;
+    int64_t body_length;
+  };
+
+  // Read the next record batch message, along with the dictionaries preceding it,
+  // and load its columns. Returns nothing at the end of the stream.
+  Result<util::optional<LoadedRecordBatch>> LoadNextRecordBatch() {
     // Continue to read other dictionaries, if any
     std::unique_ptr<Message> message;
     ARROW_ASSIGN_OR_RAISE(message, ReadNextMessage());
@@ -889,22 +1094,63 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader {
     }
 
     if (message == nullptr) {
-      // End of stream
-      return batch_with_metadata;
+      return util::nullopt;
     }
 
-    CHECK_HAS_BODY(*message);
-    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+    ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(*message));
     IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
-    return ReadRecordBatchInternal(*message->metadata(), schema_, field_inclusion_mask_,
-                                   context, reader.get());
+    ARROW_ASSIGN_OR_RAISE(auto loaded,
+                          LoadRecordBatchInternal(*message->metadata(), schema_,
+                                                  field_inclusion_mask_, context,
+                                                  reader.get()));
+    last_body_length_ = message->body_length();
+    return std::move(loaded);
+  }
+
+  // Read record batch messages ahead of the consumer, as long as the bodies of the
+  // pending record batches fit in options_.readahead_bytes, and finish them on the
+  // CPU thread pool. Dictionaries are still read in stream order, since loading a
+  // record batch resolves its dictionaries.
+  Status ReadAhead() {
+    auto executor = ::arrow::internal::GetCpuThreadPool();
+    while (!read_ahead_finished_ && (pending_batches_.empty() ||
+                                     pending_bytes_ < options_.readahead_bytes)) {
+      auto maybe_loaded = LoadNextRecordBatch();
+      if (!maybe_loaded.ok()) {
+        // Report the error once the record batches before it were consumed
+        read_ahead_finished_ = true;
+        pending_batches_.push_back(
+            {Future<RecordBatchWithMetadata>::MakeFinished(maybe_loaded.status()), 0});
+        break;
+      }
+      if (!maybe_loaded->has_value()) {
+        read_ahead_finished_ = true;
+        break;
+      }
+      auto loaded = std::make_shared<LoadedRecordBatch>(std::move(**maybe_loaded));
+      const IpcReadOptions* options = &finish_options_;
+      auto batch = DeferNotOk(executor->Submit(
+          [loaded, options]() { return std::move(*loaded).Finish(*options); }));
+      pending_batches_.push_back({std::move(batch), last_body_length_});
+      pending_bytes_ += last_body_length_;
+    }
+    return Status::OK();
   }
 
-  std::shared_ptr<Schema> schema() const override { return out_schema_; }
-
-  ReadStats stats() const override { return stats_; }
+  Result<RecordBatchWithMetadata> ReadNextAhead() {
+    RETURN_NOT_OK(ReadAhead());
+    if (pending_batches_.empty()) {
+      // End of stream
+      return RecordBatchWithMetadata{};
+    }
+    auto next = std::move(pending_batches_.front());
+    pending_batches_.pop_front();
+    pending_bytes_ -= next.body_length;
+    // Keep reading while the next record batch is being finished
+    RETURN_NOT_OK(ReadAhead());
+    return next.batch.result();
+  }
 
- private:
   Result<std::unique_ptr<Message>> ReadNextMessage() {
     ARROW_ASSIGN_OR_RAISE(auto message, message_reader_->ReadNextMessage());
     if (message) {
@@ -981,10 +1227,17 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader {
 
   std::unique_ptr<MessageReader> message_reader_;
   IpcReadOptions options_;
+  IpcReadOptions finish_options_;
   std::vector<bool> field_inclusion_mask_;
 
   bool have_read_initial_dictionaries_ = false;
 
+  // Record batches read ahead of the consumer, in stream order
+  std::deque<PendingRecordBatch> pending_batches_;
+  int64_t pending_bytes_ = 0;
+  int64_t last_body_length_ = 0;
+  bool read_ahead_finished_ = false;
+
   // Flag to set in case where we fail to observe all dictionaries in a stream,
   // and so the reader should not attempt to parse any messages
   bool empty_stream_ = false;
@@ -1157,18 +1410,12 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return Status::OK();
   }
 
-  Future<std::shared_ptr<RecordBatch>> ReadRecordBatchAsync(int i) {
+  Future<std::shared_ptr<RecordBatch>> ReadRecordBatchAsync(int i) override {
     DCHECK_GE(i, 0);
     DCHECK_LT(i, num_record_batches());
 
-    auto cached_metadata = cached_metadata_.find(i);
-    if (cached_metadata != cached_metadata_.end()) {
-      return ReadCachedRecordBatch(i, cached_metadata->second);
-    }
-
-    return Status::Invalid(
-        "Asynchronous record batch reading is only supported after a call to "
-        "PreBufferMetadata or PreBufferBatches");
+    ARROW_ASSIGN_OR_RAISE(auto cached_metadata, GetCachedMetadata(i));
+    return ReadCachedRecordBatch(i, std::move(cached_metadata));
   }
 
   Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(int i) override {
@@ -1180,7 +1427,15 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     DCHECK_GE(i, 0);
     DCHECK_LT(i, num_record_batches());
 
+    // When only some fields are read from a file which doesn't support zero-copy,
+    // such as a remote file, fetch the buffers of those fields only, coalesced
+    // through a ReadRangeCache
     auto cached_metadata = cached_metadata_.find(i);
+    if (cached_metadata == cached_metadata_.end() && !field_inclusion_mask_.empty() &&
+        !file_->supports_zero_copy()) {
+      RETURN_NOT_OK(DoPreBufferMetadata({i}));
+      cached_metadata = cached_metadata_.find(i);
+    }
     if (cached_metadata != cached_metadata_.end()) {
       auto result = ReadCachedRecordBatch(i, cached_metadata->second).result();
       ARROW_ASSIGN_OR_RAISE(auto batch, result);
@@ -1207,11 +1462,11 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
                                 read_options, file, schema, &inclusion_mask);
       };
     }
+    AdviseWillNeed(i + 1);
     ARROW_ASSIGN_OR_RAISE(auto message,
                           ReadMessageFromBlock(GetRecordBatchBlock(i), fields_loader));
 
-    CHECK_HAS_BODY(*message);
-    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+    ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(*message));
     IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
     ARROW_ASSIGN_OR_RAISE(
         auto batch_with_metadata,
@@ -1222,10 +1477,20 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   }
 
   Result<int64_t> CountRows() override {
+    // Only the metadata of the record batches is needed, so read it with coalesced
+    // I/O and leave the bodies alone
+    std::vector<io::ReadRange> ranges;
+    AddMetadataRanges(AllIndices(), &ranges);
+    RETURN_NOT_OK(metadata_cache_->Cache(std::move(ranges)));
     int64_t total = 0;
     for (int i = 0; i < num_record_batches(); i++) {
+      FileBlock block = GetRecordBatchBlock(i);
+      RETURN_NOT_OK(CheckAligned(block));
+      ARROW_ASSIGN_OR_RAISE(auto block_metadata,
+                            metadata_cache_->Read({block.offset, block.metadata_length}));
       ARROW_ASSIGN_OR_RAISE(auto outer_message,
-                            ReadMessageFromBlock(GetRecordBatchBlock(i)));
+                            ReadMessage(std::move(block_metadata), nullptr));
+      stats_.num_messages.fetch_add(1, std::memory_order_relaxed);
       auto metadata = outer_message->metadata();
       const flatbuf::Message* message = nullptr;
       RETURN_NOT_OK(
@@ -1394,10 +1659,32 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     }
   };
 
+  // The metadata of record batch i, read asynchronously if it was not pre-buffered
+  Result<Future<std::shared_ptr<Message>>> GetCachedMetadata(int i) {
+    auto cached_metadata = cached_metadata_.find(i);
+    if (cached_metadata == cached_metadata_.end()) {
+      RETURN_NOT_OK(DoPreBufferMetadata({i}));
+      cached_metadata = cached_metadata_.find(i);
+    }
+    return cached_metadata->second;
+  }
+
   FileBlock GetRecordBatchBlock(int i) const {
     return FileBlockFromFlatbuffer(footer_->recordBatches()->Get(i));
   }
 
+  // On zero-copy sources, such as memory-mapped files, ask the OS to start
+  // paging in record batch i so that it is resident by the time it is read.
+  // This is only a hint: invalid blocks are reported when they are read.
+  void AdviseWillNeed(int i) {
+    if (i >= num_record_batches() || !file_->supports_zero_copy()) {
+      return;
+    }
+    FileBlock block = GetRecordBatchBlock(i);
+    ARROW_UNUSED(
+        file_->WillNeed({{block.offset, block.metadata_length + block.body_length}}));
+  }
+
   FileBlock GetDictionaryBlock(int i) const {
     return FileBlockFromFlatbuffer(footer_->dictionaries()->Get(i));
   }
@@ -1422,8 +1709,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   }
 
   Status ReadOneDictionary(Message* message, const IpcReadContext& context) {
-    CHECK_HAS_BODY(*message);
-    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+    ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(*message));
     DictionaryKind kind;
     RETURN_NOT_OK(ReadDictionary(*message->metadata(), context, &kind, reader.get()));
     if (kind == DictionaryKind::Replacement) {
@@ -1461,6 +1747,11 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
 
   void EnsureDictionaryReadStarted() {
     if (!dictionary_load_finished_.is_valid()) {
+      if (read_dictionaries_) {
+        // Dictionaries were previously loaded synchronously
+        dictionary_load_finished_ = Future<>::MakeFinished();
+        return;
+      }
       read_dictionaries_ = true;
       std::vector<io::ReadRange> ranges;
       AddDictionaryRanges(&ranges);
@@ -1537,7 +1828,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
           owned_file(std::move(owned_file)),
           loader(batch, context.metadata_version, context.options, block_data_offset),
           columns(schema->num_fields()),
-          cache(file, file->io_context(), io::CacheOptions::LazyDefaults()),
+          cache(file, file->io_context(), this->context.options.pre_buffer_cache_options),
           length(batch->length()) {}
 
     Status CalculateLoadRequest() {
@@ -1608,6 +1899,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
                                                          filtered_columns[i]));
         }
       }
+      RETURN_NOT_OK(ConcatenateVariadicBuffers(context.options, filtered_columns));
       return RecordBatch::Make(std::move(filtered_schema), length,
                                std::move(filtered_columns));
     }
@@ -1746,6 +2038,60 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   bool swap_endian_;
 };
 
+Result<std::vector<RecordBatchStatistics>> RecordBatchFileReader::ReadStatistics() const {
+  std::vector<RecordBatchStatistics> statistics;
+  auto footer_metadata = metadata();
+  int key_index = footer_metadata ? footer_metadata->FindKey(kBatchStatisticsKey) : -1;
+  if (key_index < 0) return statistics;
+
+  auto encoded = std::make_shared<Buffer>(
+      ::arrow::util::base64_decode(footer_metadata->value(key_index)));
+  ARROW_ASSIGN_OR_RAISE(auto stream_reader, RecordBatchStreamReader::Open(
+                                                std::make_shared<io::BufferReader>(
+                                                    std::move(encoded))));
+  ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatchReader(stream_reader.get()));
+  ARROW_ASSIGN_OR_RAISE(table, table->CombineChunks());
+  const auto file_schema = schema();
+  if (table->num_rows() != num_record_batches() ||
+      table->num_columns() != file_schema->num_fields() + 1 ||
+      table->column(0)->type()->id() != Type::INT64) {
+    return Status::IOError("Invalid record batch statistics in file footer");
+  }
+  if (table->num_rows() == 0) return statistics;
+
+  statistics.resize(table->num_rows());
+  const auto& num_rows = checked_cast<const Int64Array&>(*table->column(0)->chunk(0));
+  for (int64_t i = 0; i < table->num_rows(); ++i) {
+    statistics[i].num_rows = num_rows.Value(i);
+    statistics[i].columns.resize(file_schema->num_fields());
+  }
+  for (int field_index = 0; field_index < file_schema->num_fields(); ++field_index) {
+    const auto& column = *table->column(field_index + 1)->chunk(0);
+    if (column.type_id() != Type::STRUCT) {
+      return Status::IOError("Invalid record batch statistics in file footer");
+    }
+    const auto& column_statistics = checked_cast<const StructArray&>(column);
+    auto min = column_statistics.GetFieldByName("min");
+    auto max = column_statistics.GetFieldByName("max");
+    auto null_count = column_statistics.GetFieldByName("null_count");
+    if (!min || !max || !null_count || null_count->type_id() != Type::INT64) {
+      return Status::IOError("Invalid record batch statistics in file footer");
+    }
+    // Bounds of fields whose type has no statistics are of the null type
+    const bool has_bounds =
+        min->type()->Equals(*file_schema->field(field_index)->type());
+    for (int64_t i = 0; i < table->num_rows(); ++i) {
+      auto* batch_column = &statistics[i].columns[field_index];
+      batch_column->null_count = checked_cast<const Int64Array&>(*null_count).Value(i);
+      if (has_bounds && min->IsValid(i) && max->IsValid(i)) {
+        ARROW_ASSIGN_OR_RAISE(batch_column->min, min->GetScalar(i));
+        ARROW_ASSIGN_OR_RAISE(batch_column->max, max->GetScalar(i));
+      }
+    }
+  }
+  return statistics;
+}
+
 Result<std::shared_ptr<RecordBatchFileReader>> RecordBatchFileReader::Open(
     io::RandomAccessFile* file, const IpcReadOptions& options) {
   ARROW_ASSIGN_OR_RAISE(int64_t footer_offset, file->GetSize());
@@ -1832,6 +2178,7 @@ WholeIpcFileRecordBatchGenerator::operator()() {
     return Future<Item>::MakeFinished(IterationTraits<Item>::End());
   }
   auto block = FileBlockFromFlatbuffer(state->footer_->recordBatches()->Get(index_++));
+  if (!cached_source_) state->AdviseWillNeed(index_);
   auto read_message = ReadBlock(block);
   auto read_messages = read_dictionaries_.Then([read_message]() { return read_message; });
   // Force transfer. This may be wasteful in some cases, but ensures we get off the
@@ -1879,8 +2226,7 @@ Status WholeIpcFileRecordBatchGenerator::ReadDictionaries(
 
 Result<std::shared_ptr<RecordBatch>> WholeIpcFileRecordBatchGenerator::ReadRecordBatch(
     RecordBatchFileReaderImpl* state, Message* message) {
-  CHECK_HAS_BODY(*message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(*message));
   IpcReadContext context(&state->dictionary_memo_, state->options_, state->swap_endian_);
   ARROW_ASSIGN_OR_RAISE(
       auto batch_with_metadata,
@@ -1987,8 +2333,7 @@ class StreamDecoder::StreamDecoderImpl : public MessageDecoderListener {
     if (message->type() == MessageType::DICTIONARY_BATCH) {
       return ReadDictionary(*message);
     } else {
-      CHECK_HAS_BODY(*message);
-      ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+      ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(*message));
       IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
       ARROW_ASSIGN_OR_RAISE(
           auto batch_with_metadata,
@@ -2459,8 +2804,7 @@ Result<std::shared_ptr<SparseTensor>> ReadSparseTensor(const Buffer& metadata,
 }
 
 Result<std::shared_ptr<SparseTensor>> ReadSparseTensor(const Message& message) {
-  CHECK_HAS_BODY(message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message.body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(message));
   return ReadSparseTensor(*message.metadata(), reader.get());
 }
 
@@ -2468,8 +2812,7 @@ Result<std::shared_ptr<SparseTensor>> ReadSparseTensor(io::InputStream* file) {
   std::unique_ptr<Message> message;
   RETURN_NOT_OK(ReadContiguousPayload(file, &message));
   CHECK_MESSAGE_TYPE(MessageType::SPARSE_TENSOR, message->type());
-  CHECK_HAS_BODY(*message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(*message));
   return ReadSparseTensor(*message->metadata(), reader.get());
 }
 
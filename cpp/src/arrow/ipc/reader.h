@@ -100,6 +100,21 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   virtual ReadStats stats() const = 0;
 };
 
+/// \brief Statistics of a record batch of a file, see
+/// IpcWriteOptions::write_statistics
+struct ARROW_EXPORT RecordBatchStatistics {
+  struct Column {
+    /// The smallest and largest non-null values, or nullptr if they are unknown or
+    /// the column only holds nulls
+    std::shared_ptr<Scalar> min, max;
+    int64_t null_count = 0;
+  };
+
+  int64_t num_rows = 0;
+  /// The statistics of each top-level field of the schema
+  std::vector<Column> columns;
+};
+
 /// \brief Reads the record batch file format
 class ARROW_EXPORT RecordBatchFileReader
     : public std::enable_shared_from_this<RecordBatchFileReader> {
@@ -183,6 +198,12 @@ class ARROW_EXPORT RecordBatchFileReader
   /// Footer
   virtual std::shared_ptr<const KeyValueMetadata> metadata() const = 0;
 
+  /// \brief Decode the statistics of each record batch stored in the file footer
+  ///
+  /// This doesn't read anything from the file. The result is empty if the file
+  /// was written without IpcWriteOptions::write_statistics.
+  Result<std::vector<RecordBatchStatistics>> ReadStatistics() const;
+
   /// \brief Read a particular record batch from the file. Does not copy memory
   /// if the input source supports zero-copy.
   ///
@@ -190,6 +211,17 @@ class ARROW_EXPORT RecordBatchFileReader
   /// \return the read batch
   virtual Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(int i) = 0;
 
+  /// \brief Read a particular record batch from the file asynchronously
+  ///
+  /// Only the buffers of the fields selected by IpcReadOptions::included_fields
+  /// are read, with nearby reads coalesced according to
+  /// IpcReadOptions::pre_buffer_cache_options. The metadata of the record batch
+  /// is read first unless it was loaded by PreBufferMetadata().
+  ///
+  /// \param[in] i the index of the record batch to return
+  /// \return a future of the read batch
+  virtual Future<std::shared_ptr<RecordBatch>> ReadRecordBatchAsync(int i) = 0;
+
   /// \brief Read a particular record batch along with its custom metadada from the file.
   /// Does not copy memory if the input source supports zero-copy.
   ///
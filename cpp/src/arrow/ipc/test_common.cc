@@ -591,6 +591,45 @@ Status MakeUnion(std::shared_ptr<RecordBatch>* out) {
   return Status::OK();
 }
 
+Status MakeRunEndEncoded(std::shared_ptr<RecordBatch>* out) {
+  const int64_t length = 7;
+  std::shared_ptr<Array> run_ends, values;
+  ArrayFromVector<Int32Type, int32_t>({2, 3, 6, 7}, &run_ends);
+  ArrayFromVector<StringType, std::string>({true, false, true, true},
+                                           {"foo", "", "bar", "baz"}, &values);
+  ARROW_ASSIGN_OR_RAISE(auto plain, RunEndEncodedArray::Make(length, run_ends, values));
+
+  // A sliced array, its logical offset is normalized away when writing
+  ArrayFromVector<Int16Type, int16_t>({3, 5, 9, 10}, &run_ends);
+  ARROW_ASSIGN_OR_RAISE(
+      auto sliced, RunEndEncodedArray::Make(length, run_ends, values, /*offset=*/2));
+
+  auto schema = ::arrow::schema(
+      {field("ree", plain->type()), field("sliced", sliced->type())});
+  *out = RecordBatch::Make(schema, length, {plain, sliced});
+  return Status::OK();
+}
+
+Status MakeBinaryViews(std::shared_ptr<RecordBatch>* out) {
+  // Values of up to 12 bytes are inlined in their views, longer ones are in the data
+  // buffer
+  auto strings = ArrayFromJSON(
+      utf8_view(), R"(["", "inlined", null, "not inlined in its view", "twelve bytes"])");
+  auto binaries = ArrayFromJSON(
+      binary_view(), R"(["abc", null, "0123456789abcdef", null, "0123456789abcdef"])");
+  // All values inlined, without a data buffer
+  auto inlined = ArrayFromJSON(utf8_view(), R"(["a", "b", null, "c", "d"])");
+  ARROW_ASSIGN_OR_RAISE(auto nested, StructArray::Make({strings, inlined},
+                                                        {field("s", utf8_view()),
+                                                         field("i", utf8_view())}));
+
+  auto schema = ::arrow::schema({field("strings", strings->type()),
+                                 field("binaries", binaries->type()),
+                                 field("nested", nested->type())});
+  *out = RecordBatch::Make(schema, strings->length(), {strings, binaries, nested});
+  return Status::OK();
+}
+
 Status MakeDictionary(std::shared_ptr<RecordBatch>* out) {
   const int64_t length = 6;
 
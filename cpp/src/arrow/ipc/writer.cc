@@ -18,9 +18,13 @@
 #include "arrow/ipc/writer.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <deque>
+#include <functional>
 #include <limits>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -29,6 +33,9 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/builder_base.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/device.h"
 #include "arrow/extension_type.h"
@@ -40,20 +47,24 @@
 #include "arrow/ipc/util.h"
 #include "arrow/record_batch.h"
 #include "arrow/result_internal.h"
+#include "arrow/scalar.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/endian.h"
+#include "arrow/util/future.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
 #include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visit_array_inline.h"
 #include "arrow/visit_type_inline.h"
 
@@ -173,7 +184,8 @@ class RecordBatchSerializer {
   // Override this for writing dictionary metadata
   virtual Status SerializeMetadata(int64_t num_rows) {
     return WriteRecordBatchMessage(num_rows, out_->body_length, custom_metadata_,
-                                   field_nodes_, buffer_meta_, options_, &out_->metadata);
+                                   field_nodes_, buffer_meta_, variadic_counts_, options_,
+                                   &out_->metadata);
   }
 
   Status CompressBuffer(const Buffer& buffer, util::Codec* codec,
@@ -186,6 +198,23 @@ class RecordBatchSerializer {
     ARROW_ASSIGN_OR_RAISE(actual_length,
                           codec->Compress(buffer.size(), buffer.data(), maximum_length,
                                           result->mutable_data() + sizeof(int64_t)));
+
+    if (options_.min_space_savings.has_value()) {
+      const double space_savings =
+          1.0 - static_cast<double>(actual_length) / static_cast<double>(buffer.size());
+      if (space_savings < *options_.min_space_savings) {
+        // Not worth it: an uncompressed length of -1 marks the buffer as stored
+        // uncompressed
+        ARROW_ASSIGN_OR_RAISE(result, AllocateBuffer(buffer.size() + sizeof(int64_t)));
+        *reinterpret_cast<int64_t*>(result->mutable_data()) =
+            bit_util::ToLittleEndian(internal::kUncompressedBufferLength);
+        std::memcpy(result->mutable_data() + sizeof(int64_t), buffer.data(),
+                    static_cast<size_t>(buffer.size()));
+        *out = std::move(result);
+        return Status::OK();
+      }
+    }
+
     *reinterpret_cast<int64_t*>(result->mutable_data()) =
         bit_util::ToLittleEndian(buffer.size());
     *out = SliceBuffer(std::move(result), /*offset=*/0, actual_length + sizeof(int64_t));
@@ -195,6 +224,11 @@ class RecordBatchSerializer {
   Status CompressBodyBuffers() {
     RETURN_NOT_OK(
         internal::CheckCompressionSupported(options_.codec->compression_type()));
+    if (options_.min_space_savings.has_value() &&
+        !(*options_.min_space_savings >= 0.0 && *options_.min_space_savings <= 1.0)) {
+      return Status::Invalid("min_space_savings must be between 0 and 1, got ",
+                             *options_.min_space_savings);
+    }
 
     auto CompressOne = [&](size_t i) {
       if (out_->body_buffers[i]->size() > 0) {
@@ -212,6 +246,7 @@ class RecordBatchSerializer {
     if (field_nodes_.size() > 0) {
       field_nodes_.clear();
       buffer_meta_.clear();
+      variadic_counts_.clear();
       out_->body_buffers.clear();
     }
 
@@ -388,6 +423,28 @@ class RecordBatchSerializer {
     return Status::OK();
   }
 
+  Status Visit(const BinaryViewArray& array) {
+    // Only the views are sliced, the data buffer is written whole as the
+    // views of a slice can refer to any part of it.  The data buffer is the
+    // only variadic buffer of the array, if it has one.
+    std::shared_ptr<Buffer> views = array.views();
+    const int64_t views_length = PaddedLength(array.length() * BinaryViewType::kSize);
+    if (NeedTruncate(array.offset(), views.get(), views_length)) {
+      const int64_t byte_offset = array.offset() * BinaryViewType::kSize;
+      const int64_t buffer_length =
+          std::min(views_length, views->size() - byte_offset);
+      views = SliceBuffer(views, byte_offset, buffer_length);
+    }
+    out_->body_buffers.emplace_back(std::move(views));
+    if (array.value_data() != nullptr) {
+      out_->body_buffers.emplace_back(array.value_data());
+      variadic_counts_.push_back(1);
+    } else {
+      variadic_counts_.push_back(0);
+    }
+    return Status::OK();
+  }
+
   Status Visit(const FixedSizeListArray& array) {
     --max_recursion_depth_;
     auto size = array.list_type()->list_size();
@@ -521,6 +578,23 @@ class RecordBatchSerializer {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedArray& array) {
+    // There is no logical offset in the IPC format: write sliced arrays with
+    // their runs rebased on the start of the slice
+    std::shared_ptr<Array> normalized;
+    const RunEndEncodedArray* ree_array = &array;
+    if (array.offset() != 0) {
+      ARROW_ASSIGN_OR_RAISE(normalized,
+                            Concatenate({MakeArray(array.data())}, options_.memory_pool));
+      ree_array = checked_cast<const RunEndEncodedArray*>(normalized.get());
+    }
+    --max_recursion_depth_;
+    RETURN_NOT_OK(VisitArray(*ree_array->run_ends()));
+    RETURN_NOT_OK(VisitArray(*ree_array->values()));
+    ++max_recursion_depth_;
+    return Status::OK();
+  }
+
   Status Visit(const DictionaryArray& array) {
     // Dictionary written out separately. Slice offset contained in the indices
     return VisitType(*array.indices());
@@ -538,6 +612,8 @@ class RecordBatchSerializer {
 
   std::vector<internal::FieldMetadata> field_nodes_;
   std::vector<internal::BufferMetadata> buffer_meta_;
+  // The number of variadic buffers of each field that has them, in field order
+  std::vector<int64_t> variadic_counts_;
 
   const IpcWriteOptions& options_;
   int64_t max_recursion_depth_;
@@ -554,8 +630,8 @@ class DictionarySerializer : public RecordBatchSerializer {
 
   Status SerializeMetadata(int64_t num_rows) override {
     return WriteDictionaryMessage(dictionary_id_, is_delta_, num_rows, out_->body_length,
-                                  custom_metadata_, field_nodes_, buffer_meta_, options_,
-                                  &out_->metadata);
+                                  custom_metadata_, field_nodes_, buffer_meta_,
+                                  variadic_counts_, options_, &out_->metadata);
   }
 
   Status Assemble(const std::shared_ptr<Array>& dictionary) {
@@ -951,6 +1027,8 @@ Status GetTensorSize(const Tensor& tensor, int64_t* size) {
 
 RecordBatchWriter::~RecordBatchWriter() {}
 
+AsyncRecordBatchWriter::~AsyncRecordBatchWriter() {}
+
 Status RecordBatchWriter::WriteTable(const Table& table, int64_t max_chunksize) {
   TableBatchReader reader(table);
 
@@ -981,23 +1059,187 @@ IpcPayloadWriter::~IpcPayloadWriter() {}
 
 Status IpcPayloadWriter::Start() { return Status::OK(); }
 
+namespace {
+
+template <typename T>
+using is_statistics_type = std::integral_constant<
+    bool, is_boolean_type<T>::value ||
+              (is_number_type<T>::value && !is_half_float_type<T>::value) ||
+              (is_temporal_type<T>::value && !is_interval_type<T>::value) ||
+              is_base_binary_type<T>::value>;
+
+struct StatisticsTypeChecker {
+  template <typename T>
+  Status Visit(const T&) {
+    supported = is_statistics_type<T>::value;
+    return Status::OK();
+  }
+
+  bool supported = false;
+};
+
+template <typename T>
+bool IsNaN(const T&) {
+  return false;
+}
+bool IsNaN(float value) { return std::isnan(value); }
+bool IsNaN(double value) { return std::isnan(value); }
+
+// Finds the positions of the smallest and largest non-null values of an array
+struct MinMaxFinder {
+  explicit MinMaxFinder(const Array& array) : array(array) {}
+
+  template <typename T>
+  enable_if_t<is_statistics_type<T>::value, Status> Visit(const T&) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    const auto& values = checked_cast<const ArrayType&>(array);
+    for (int64_t i = 0; i < values.length(); ++i) {
+      if (values.IsNull(i)) continue;
+      auto value = values.GetView(i);
+      if (IsNaN(value)) {
+        // NaNs aren't ordered, so no bounds hold for the array
+        has_nan = true;
+        return Status::OK();
+      }
+      if (min_index < 0 || value < values.GetView(min_index)) min_index = i;
+      if (max_index < 0 || values.GetView(max_index) < value) max_index = i;
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DataType&) { return Status::OK(); }
+
+  const Array& array;
+  bool has_nan = false;
+  int64_t min_index = -1;
+  int64_t max_index = -1;
+};
+
+}  // namespace
+
+// Accumulates the statistics of the record batches written to a file, see
+// IpcWriteOptions::write_statistics
+class BatchStatisticsCollector {
+ public:
+  BatchStatisticsCollector(std::shared_ptr<Schema> schema, MemoryPool* pool)
+      : schema_(std::move(schema)), pool_(pool), columns_(schema_->num_fields()) {
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      StatisticsTypeChecker checker;
+      DCHECK_OK(VisitTypeInline(*schema_->field(i)->type(), &checker));
+      columns_[i].supported = checker.supported;
+    }
+  }
+
+  Status Update(const RecordBatch& batch) {
+    num_rows_.push_back(batch.num_rows());
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      const Array& array = *batch.column(i);
+      Column* column = &columns_[i];
+      std::shared_ptr<Scalar> min, max;
+      if (column->supported) {
+        MinMaxFinder finder(array);
+        RETURN_NOT_OK(VisitTypeInline(*array.type(), &finder));
+        if (finder.min_index >= 0 && !finder.has_nan) {
+          ARROW_ASSIGN_OR_RAISE(min, array.GetScalar(finder.min_index));
+          ARROW_ASSIGN_OR_RAISE(max, array.GetScalar(finder.max_index));
+        }
+      }
+      column->mins.push_back(std::move(min));
+      column->maxes.push_back(std::move(max));
+      column->null_counts.push_back(array.null_count());
+    }
+    return Status::OK();
+  }
+
+  // Encode the statistics as an IPC stream of a single record batch with a row per
+  // written record batch. Its first column holds the row counts and the others a
+  // struct<min, max, null_count> per top-level field of the schema, where min and
+  // max are null for fields without bounds.
+  Result<std::string> Finish() {
+    const auto num_batches = static_cast<int64_t>(num_rows_.size());
+    FieldVector fields = {field("num_rows", int64())};
+    ArrayVector arrays(1);
+    Int64Builder num_rows_builder(pool_);
+    RETURN_NOT_OK(num_rows_builder.AppendValues(num_rows_));
+    RETURN_NOT_OK(num_rows_builder.Finish(&arrays[0]));
+
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      const Column& column = columns_[i];
+      auto value_type = column.supported ? schema_->field(i)->type() : null();
+      std::unique_ptr<ArrayBuilder> min_builder, max_builder;
+      RETURN_NOT_OK(MakeBuilder(pool_, value_type, &min_builder));
+      RETURN_NOT_OK(MakeBuilder(pool_, value_type, &max_builder));
+      for (int64_t j = 0; j < num_batches; ++j) {
+        if (column.mins[j]) {
+          RETURN_NOT_OK(min_builder->AppendScalar(*column.mins[j]));
+          RETURN_NOT_OK(max_builder->AppendScalar(*column.maxes[j]));
+        } else {
+          RETURN_NOT_OK(min_builder->AppendNull());
+          RETURN_NOT_OK(max_builder->AppendNull());
+        }
+      }
+      Int64Builder null_count_builder(pool_);
+      RETURN_NOT_OK(null_count_builder.AppendValues(column.null_counts));
+
+      ArrayVector children(3);
+      RETURN_NOT_OK(min_builder->Finish(&children[0]));
+      RETURN_NOT_OK(max_builder->Finish(&children[1]));
+      RETURN_NOT_OK(null_count_builder.Finish(&children[2]));
+      ARROW_ASSIGN_OR_RAISE(
+          auto statistics,
+          StructArray::Make(children, std::vector<std::string>{"min", "max",
+                                                               "null_count"}));
+      fields.push_back(field(schema_->field(i)->name(), statistics->type()));
+      arrays.push_back(std::move(statistics));
+    }
+
+    auto batch = RecordBatch::Make(::arrow::schema(std::move(fields)), num_batches,
+                                   std::move(arrays));
+    ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create(1024, pool_));
+    auto options = IpcWriteOptions::Defaults();
+    options.memory_pool = pool_;
+    ARROW_ASSIGN_OR_RAISE(auto writer, MakeStreamWriter(sink, batch->schema(), options));
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    RETURN_NOT_OK(writer->Close());
+    ARROW_ASSIGN_OR_RAISE(auto buffer, sink->Finish());
+    // Footer metadata values are flatbuffers strings, which should be valid UTF-8
+    return ::arrow::util::base64_encode(::arrow::util::string_view(*buffer));
+  }
+
+ private:
+  struct Column {
+    bool supported = false;
+    ScalarVector mins, maxes;
+    std::vector<int64_t> null_counts;
+  };
+
+  std::shared_ptr<Schema> schema_;
+  MemoryPool* pool_;
+  std::vector<Column> columns_;
+  std::vector<int64_t> num_rows_;
+};
+
 class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
  public:
   // A RecordBatchWriter implementation that writes to a IpcPayloadWriter.
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
                   const Schema& schema, const IpcWriteOptions& options,
-                  bool is_file_format)
+                  bool is_file_format,
+                  std::shared_ptr<BatchStatisticsCollector> statistics = NULLPTR)
       : payload_writer_(std::move(payload_writer)),
         schema_(schema),
         mapper_(schema),
         is_file_format_(is_file_format),
+        statistics_(std::move(statistics)),
         options_(options) {}
 
   // A Schema-owning constructor variant
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
                   const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options,
-                  bool is_file_format)
-      : IpcFormatWriter(std::move(payload_writer), *schema, options, is_file_format) {
+                  bool is_file_format,
+                  std::shared_ptr<BatchStatisticsCollector> statistics = NULLPTR)
+      : IpcFormatWriter(std::move(payload_writer), *schema, options, is_file_format,
+                        std::move(statistics)) {
     shared_schema_ = schema;
   }
 
@@ -1014,21 +1256,16 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
 
     RETURN_NOT_OK(CheckStarted());
 
-    RETURN_NOT_OK(WriteDictionaries(batch));
-
-    IpcPayload payload;
-    RETURN_NOT_OK(GetRecordBatchPayload(batch, custom_metadata, options_, &payload));
-    RETURN_NOT_OK(WritePayload(payload));
-    ++stats_.num_record_batches;
-
-    stats_.total_raw_body_size += payload.raw_body_length;
-    stats_.total_serialized_body_size += payload.body_length;
-
-    return Status::OK();
+    if (is_file_format_ && options_.unify_dictionaries) {
+      ARROW_ASSIGN_OR_RAISE(auto unified_batch, UnifyDictionaries(batch));
+      return DoWriteRecordBatch(*unified_batch, custom_metadata);
+    }
+    return DoWriteRecordBatch(batch, custom_metadata);
   }
 
   Status WriteTable(const Table& table, int64_t max_chunksize) override {
     if (is_file_format_ && options_.unify_dictionaries) {
+      // Unifying upfront avoids writing dictionary deltas
       ARROW_ASSIGN_OR_RAISE(auto unified_table,
                             DictionaryUnifier::UnifyTable(table, options_.memory_pool));
       return RecordBatchWriter::WriteTable(*unified_table, max_chunksize);
@@ -1045,6 +1282,9 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   Status Start() {
     started_ = true;
     RETURN_NOT_OK(payload_writer_->Start());
+    if (is_file_format_ && options_.unify_dictionaries) {
+      RETURN_NOT_OK(MakeUnifiers());
+    }
 
     IpcPayload payload;
     RETURN_NOT_OK(GetSchemaPayload(schema_, options_, mapper_, &payload));
@@ -1061,6 +1301,93 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  Status DoWriteRecordBatch(
+      const RecordBatch& batch,
+      const std::shared_ptr<const KeyValueMetadata>& custom_metadata) {
+    RETURN_NOT_OK(WriteDictionaries(batch));
+
+    IpcPayload payload;
+    RETURN_NOT_OK(GetRecordBatchPayload(batch, custom_metadata, options_, &payload));
+    RETURN_NOT_OK(WritePayload(payload));
+    ++stats_.num_record_batches;
+    if (statistics_) {
+      RETURN_NOT_OK(statistics_->Update(batch));
+    }
+
+    stats_.total_raw_body_size += payload.raw_body_length;
+    stats_.total_serialized_body_size += payload.body_length;
+
+    return Status::OK();
+  }
+
+  // Make a unifier for each top-level dictionary field whose value type supports
+  // unification
+  Status MakeUnifiers() {
+    unifiers_.resize(schema_.num_fields());
+    unified_dictionaries_.resize(schema_.num_fields());
+    for (int i = 0; i < schema_.num_fields(); ++i) {
+      const auto& type = schema_.field(i)->type();
+      if (type->id() != Type::DICTIONARY) {
+        continue;
+      }
+      const auto& dict_type = checked_cast<const DictionaryType&>(*type);
+      auto maybe_unifier =
+          DictionaryUnifier::Make(dict_type.value_type(), options_.memory_pool);
+      if (maybe_unifier.status().IsNotImplemented()) {
+        // Dictionaries of this field must not change across batches
+        continue;
+      }
+      ARROW_ASSIGN_OR_RAISE(unifiers_[i], std::move(maybe_unifier));
+    }
+    return Status::OK();
+  }
+
+  // Remap the dictionary columns of a batch onto dictionaries unified with those of
+  // the previous batches. As unified dictionaries only grow, they are written as
+  // deltas, whereas the IPC file format doesn't support dictionary replacements.
+  Result<std::shared_ptr<RecordBatch>> UnifyDictionaries(const RecordBatch& batch) {
+    auto columns = batch.columns();
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      if (unifiers_[i] == nullptr) {
+        continue;
+      }
+      const auto& column = checked_cast<const DictionaryArray&>(*columns[i]);
+      if (column.dictionary()->null_count() > 0) {
+        // Dictionaries with nulls can't be unified, write this one as is
+        continue;
+      }
+      const auto& dict_type = checked_cast<const DictionaryType&>(*column.type());
+      std::shared_ptr<Buffer> transpose;
+      RETURN_NOT_OK(unifiers_[i]->Unify(*column.dictionary(), &transpose));
+      const auto* transpose_map = reinterpret_cast<const int32_t*>(transpose->data());
+      const int64_t dictionary_length = column.dictionary()->length();
+
+      auto& unified_dictionary = unified_dictionaries_[i];
+      const int64_t unified_length =
+          unified_dictionary ? unified_dictionary->length() : 0;
+      bool identity = true;
+      bool grown = (unified_dictionary == nullptr);
+      for (int64_t j = 0; j < dictionary_length; ++j) {
+        identity &= (transpose_map[j] == j);
+        grown |= (transpose_map[j] >= unified_length);
+      }
+      if (grown) {
+        RETURN_NOT_OK(unifiers_[i]->GetResultWithIndexType(dict_type.index_type(),
+                                                           &unified_dictionary));
+      }
+      if (identity) {
+        // The indices are unchanged, e.g. if the dictionary extends the previous ones
+        columns[i] = std::make_shared<DictionaryArray>(column.type(), column.indices(),
+                                                       unified_dictionary);
+      } else {
+        ARROW_ASSIGN_OR_RAISE(columns[i],
+                              column.Transpose(column.type(), unified_dictionary,
+                                               transpose_map, options_.memory_pool));
+      }
+    }
+    return RecordBatch::Make(batch.schema(), batch.num_rows(), std::move(columns));
+  }
+
   Status WriteDictionaries(const RecordBatch& batch) {
     ARROW_ASSIGN_OR_RAISE(const auto dictionaries, CollectDictionaries(batch, mapper_));
     const auto equal_options = EqualOptions().nans_equal(true);
@@ -1090,7 +1417,9 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
         }
 
         // (the read path doesn't support outer dictionary deltas, don't emit them)
-        if (new_length > last_length && options_.emit_dictionary_deltas &&
+        const bool emit_deltas = options_.emit_dictionary_deltas ||
+                                 (is_file_format_ && options_.unify_dictionaries);
+        if (new_length > last_length && emit_deltas &&
             !HasNestedDict(*dictionary->data()) &&
             ((*last_dictionary)
                  ->RangeEquals(dictionary, 0, last_length, 0, equal_options))) {
@@ -1142,6 +1471,7 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   const Schema& schema_;
   const DictionaryFieldMapper mapper_;
   const bool is_file_format_;
+  std::shared_ptr<BatchStatisticsCollector> statistics_;
 
   // A map of last-written dictionaries by id.
   // This is required to avoid the same dictionary again and again,
@@ -1150,6 +1480,11 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   // The latter is also why we can't use weak_ptr.
   std::unordered_map<int64_t, std::shared_ptr<Array>> last_dictionaries_;
 
+  // When unifying dictionaries incrementally, the unifier and the current unified
+  // dictionary of each top-level field (null for fields which aren't unified)
+  std::vector<std::unique_ptr<DictionaryUnifier>> unifiers_;
+  std::vector<std::shared_ptr<Array>> unified_dictionaries_;
+
   bool started_ = false;
   IpcWriteOptions options_;
   WriteStats stats_;
@@ -1240,14 +1575,20 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
  public:
   PayloadFileWriter(const IpcWriteOptions& options, const std::shared_ptr<Schema>& schema,
                     const std::shared_ptr<const KeyValueMetadata>& metadata,
-                    io::OutputStream* sink)
-      : StreamBookKeeper(options, sink), schema_(schema), metadata_(metadata) {}
+                    io::OutputStream* sink,
+                    std::shared_ptr<BatchStatisticsCollector> statistics = NULLPTR)
+      : StreamBookKeeper(options, sink),
+        schema_(schema),
+        metadata_(metadata),
+        statistics_(std::move(statistics)) {}
   PayloadFileWriter(const IpcWriteOptions& options, const std::shared_ptr<Schema>& schema,
                     const std::shared_ptr<const KeyValueMetadata>& metadata,
-                    std::shared_ptr<io::OutputStream> sink)
+                    std::shared_ptr<io::OutputStream> sink,
+                    std::shared_ptr<BatchStatisticsCollector> statistics = NULLPTR)
       : StreamBookKeeper(options, std::move(sink)),
         schema_(schema),
-        metadata_(metadata) {}
+        metadata_(metadata),
+        statistics_(std::move(statistics)) {}
 
   ~PayloadFileWriter() override = default;
 
@@ -1294,11 +1635,21 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
     // Write 0 EOS message for compatibility with sequential readers
     RETURN_NOT_OK(WriteEOS());
 
+    auto metadata = metadata_;
+    if (statistics_) {
+      ARROW_ASSIGN_OR_RAISE(auto encoded_statistics, statistics_->Finish());
+      auto metadata_with_statistics =
+          metadata_ ? metadata_->Copy() : std::make_shared<KeyValueMetadata>();
+      RETURN_NOT_OK(metadata_with_statistics->Set(kBatchStatisticsKey,
+                                                  std::move(encoded_statistics)));
+      metadata = std::move(metadata_with_statistics);
+    }
+
     // Write file footer
     RETURN_NOT_OK(UpdatePosition());
     int64_t initial_position = position_;
     RETURN_NOT_OK(
-        WriteFileFooter(*schema_, dictionaries_, record_batches_, metadata_, sink_));
+        WriteFileFooter(*schema_, dictionaries_, record_batches_, metadata, sink_));
 
     // Write footer length
     RETURN_NOT_OK(UpdatePosition());
@@ -1318,12 +1669,177 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
  protected:
   std::shared_ptr<Schema> schema_;
   std::shared_ptr<const KeyValueMetadata> metadata_;
+  std::shared_ptr<BatchStatisticsCollector> statistics_;
   std::vector<FileBlock> dictionaries_;
   std::vector<FileBlock> record_batches_;
 };
 
+/// A IpcPayloadWriter implementation that queues payloads and writes them to
+/// another IpcPayloadWriter on an executor, in order
+class WriteBehindPayloadWriter : public IpcPayloadWriter {
+ public:
+  WriteBehindPayloadWriter(std::unique_ptr<IpcPayloadWriter> sink,
+                           int64_t max_pending_bytes,
+                           ::arrow::internal::Executor* executor)
+      : sink_(std::move(sink)),
+        max_pending_bytes_(max_pending_bytes),
+        executor_(executor) {}
+
+  ~WriteBehindPayloadWriter() override {
+    // The writing task refers to this object
+    Drained().Wait();
+  }
+
+  Status Start() override {
+    return Enqueue([this] { return sink_->Start(); }, /*size=*/0);
+  }
+
+  Status WritePayload(const IpcPayload& payload) override {
+    const int64_t size = payload.metadata->size() + payload.body_length;
+    return Enqueue([this, payload] { return sink_->WritePayload(payload); }, size);
+  }
+
+  Status Close() override {
+    return Enqueue([this] { return sink_->Close(); }, /*size=*/0);
+  }
+
+  /// \brief A future which completes once the pending payloads fit in the
+  /// maximum size, or fails if a payload couldn't be written
+  Future<> SpaceAvailable() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!status_.ok() || pending_bytes_ <= max_pending_bytes_) {
+      return Future<>::MakeFinished(status_);
+    }
+    if (!space_available_.is_valid()) {
+      space_available_ = Future<>::Make();
+    }
+    return space_available_;
+  }
+
+  /// \brief A future which completes once every queued payload was written
+  Future<> Drained() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!writing_) {
+      return Future<>::MakeFinished(status_);
+    }
+    return drained_;
+  }
+
+ private:
+  struct PendingWrite {
+    std::function<Status()> write;
+    int64_t size;
+  };
+
+  Status Enqueue(std::function<Status()> write, int64_t size) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(status_);
+    pending_.push_back({std::move(write), size});
+    pending_bytes_ += size;
+    if (writing_) {
+      return Status::OK();
+    }
+    writing_ = true;
+    drained_ = Future<>::Make();
+    lock.unlock();
+    return executor_->Spawn([this] { WritePending(); });
+  }
+
+  void WritePending() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!pending_.empty()) {
+      PendingWrite next = std::move(pending_.front());
+      pending_.pop_front();
+      lock.unlock();
+      Status st = next.write();
+      lock.lock();
+
+      pending_bytes_ -= next.size;
+      if (!st.ok()) {
+        // Drop the remaining payloads, the stream can't be written anymore
+        status_ = std::move(st);
+        pending_.clear();
+        pending_bytes_ = 0;
+      }
+      if (space_available_.is_valid() &&
+          (!status_.ok() || pending_bytes_ <= max_pending_bytes_)) {
+        auto space_available = std::move(space_available_);
+        space_available_ = Future<>();
+        auto status = status_;
+        lock.unlock();
+        space_available.MarkFinished(std::move(status));
+        lock.lock();
+      }
+    }
+    writing_ = false;
+    auto drained = std::move(drained_);
+    auto status = status_;
+    lock.unlock();
+    drained.MarkFinished(std::move(status));
+  }
+
+  std::unique_ptr<IpcPayloadWriter> sink_;
+  const int64_t max_pending_bytes_;
+  ::arrow::internal::Executor* executor_;
+
+  std::mutex mutex_;
+  std::deque<PendingWrite> pending_;
+  int64_t pending_bytes_ = 0;
+  // Whether a task is writing the pending payloads
+  bool writing_ = false;
+  Status status_;
+  Future<> space_available_;
+  Future<> drained_;
+};
+
+/// An AsyncRecordBatchWriter implementation serializing record batches with a
+/// IpcFormatWriter, which writes to a WriteBehindPayloadWriter
+class AsyncIpcFormatWriter : public AsyncRecordBatchWriter {
+ public:
+  AsyncIpcFormatWriter(std::unique_ptr<IpcPayloadWriter> sink,
+                       const std::shared_ptr<Schema>& schema,
+                       const IpcWriteOptions& options, bool is_file_format,
+                       std::shared_ptr<BatchStatisticsCollector> statistics = NULLPTR) {
+    auto write_behind = ::arrow::internal::make_unique<WriteBehindPayloadWriter>(
+        std::move(sink), options.max_pending_write_bytes,
+        io::default_io_context().executor());
+    write_behind_ = write_behind.get();
+    writer_ = ::arrow::internal::make_unique<IpcFormatWriter>(
+        std::move(write_behind), schema, options, is_file_format,
+        std::move(statistics));
+  }
+
+  Future<> WriteRecordBatch(const RecordBatch& batch) override {
+    RETURN_NOT_OK(writer_->WriteRecordBatch(batch));
+    return write_behind_->SpaceAvailable();
+  }
+
+  Future<> Close() override {
+    RETURN_NOT_OK(writer_->Close());
+    return write_behind_->Drained();
+  }
+
+  WriteStats stats() const override { return writer_->stats(); }
+
+ private:
+  // Owned by writer_
+  WriteBehindPayloadWriter* write_behind_;
+  std::unique_ptr<IpcFormatWriter> writer_;
+};
+
 }  // namespace internal
 
+namespace {
+
+std::shared_ptr<internal::BatchStatisticsCollector> MakeBatchStatisticsCollector(
+    const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options) {
+  if (!options.write_statistics) return NULLPTR;
+  return std::make_shared<internal::BatchStatisticsCollector>(schema,
+                                                              options.memory_pool);
+}
+
+}  // namespace
+
 Result<std::shared_ptr<RecordBatchWriter>> MakeStreamWriter(
     io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options) {
@@ -1351,20 +1867,42 @@ Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  auto statistics = MakeBatchStatisticsCollector(schema, options);
   return std::make_shared<internal::IpcFormatWriter>(
-      ::arrow::internal::make_unique<internal::PayloadFileWriter>(options, schema,
-                                                                  metadata, sink),
-      schema, options, /*is_file_format=*/true);
+      ::arrow::internal::make_unique<internal::PayloadFileWriter>(
+          options, schema, metadata, sink, statistics),
+      schema, options, /*is_file_format=*/true, statistics);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  auto statistics = MakeBatchStatisticsCollector(schema, options);
   return std::make_shared<internal::IpcFormatWriter>(
       ::arrow::internal::make_unique<internal::PayloadFileWriter>(
-          options, schema, metadata, std::move(sink)),
-      schema, options, /*is_file_format=*/true);
+          options, schema, metadata, std::move(sink), statistics),
+      schema, options, /*is_file_format=*/true, statistics);
+}
+
+Result<std::shared_ptr<AsyncRecordBatchWriter>> MakeAsyncStreamWriter(
+    std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
+    const IpcWriteOptions& options) {
+  return std::make_shared<internal::AsyncIpcFormatWriter>(
+      ::arrow::internal::make_unique<internal::PayloadStreamWriter>(std::move(sink),
+                                                                    options),
+      schema, options, /*is_file_format=*/false);
+}
+
+Result<std::shared_ptr<AsyncRecordBatchWriter>> MakeAsyncFileWriter(
+    std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
+    const IpcWriteOptions& options,
+    const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  auto statistics = MakeBatchStatisticsCollector(schema, options);
+  return std::make_shared<internal::AsyncIpcFormatWriter>(
+      ::arrow::internal::make_unique<internal::PayloadFileWriter>(
+          options, schema, metadata, std::move(sink), statistics),
+      schema, options, /*is_file_format=*/true, statistics);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> NewFileWriter(
@@ -129,6 +129,34 @@ class ARROW_EXPORT RecordBatchWriter {
   virtual WriteStats stats() const = 0;
 };
 
+/// \class AsyncRecordBatchWriter
+/// \brief Abstract interface for writing a stream of record batches without
+/// waiting for the sink
+///
+/// Record batches are serialized, and compressed if requested, on the calling
+/// thread, while the resulting messages are written to the sink in the
+/// background on the I/O thread pool. Methods must not be called concurrently.
+class ARROW_EXPORT AsyncRecordBatchWriter {
+ public:
+  virtual ~AsyncRecordBatchWriter();
+
+  /// \brief Serialize a record batch and queue it for writing
+  ///
+  /// \param[in] batch the record batch to write to the stream
+  /// \return a future which completes once the messages queued for writing fit
+  /// in IpcWriteOptions::max_pending_write_bytes again. Callers should wait for
+  /// it before writing more batches. It fails if a previous write failed.
+  virtual Future<> WriteRecordBatch(const RecordBatch& batch) = 0;
+
+  /// \brief Perform any logic necessary to finish the stream
+  ///
+  /// \return a future which completes once everything was written
+  virtual Future<> Close() = 0;
+
+  /// \brief Return current write statistics
+  virtual WriteStats stats() const = 0;
+};
+
 /// \defgroup record-batch-writer-factories Functions for creating RecordBatchWriter
 /// instances
 ///
@@ -184,6 +212,30 @@ Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     const IpcWriteOptions& options = IpcWriteOptions::Defaults(),
     const std::shared_ptr<const KeyValueMetadata>& metadata = NULLPTR);
 
+/// Create a new IPC stream writer which writes to the sink in the background
+///
+/// \param[in] sink output stream to write to
+/// \param[in] schema the schema of the record batches to be written
+/// \param[in] options options for serialization
+/// \return Result<std::shared_ptr<AsyncRecordBatchWriter>>
+ARROW_EXPORT
+Result<std::shared_ptr<AsyncRecordBatchWriter>> MakeAsyncStreamWriter(
+    std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
+    const IpcWriteOptions& options = IpcWriteOptions::Defaults());
+
+/// Create a new IPC file writer which writes to the sink in the background
+///
+/// \param[in] sink output stream to write to
+/// \param[in] schema the schema of the record batches to be written
+/// \param[in] options options for serialization, optional
+/// \param[in] metadata custom metadata for File Footer, optional
+/// \return Result<std::shared_ptr<AsyncRecordBatchWriter>>
+ARROW_EXPORT
+Result<std::shared_ptr<AsyncRecordBatchWriter>> MakeAsyncFileWriter(
+    std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
+    const IpcWriteOptions& options = IpcWriteOptions::Defaults(),
+    const std::shared_ptr<const KeyValueMetadata>& metadata = NULLPTR);
+
 /// @}
 
 /// \brief Low-level API for writing a record batch (without schema)
@@ -39,6 +39,14 @@ enum class UnexpectedFieldBehavior : char {
   InferType
 };
 
+enum class ParserBackend : char {
+  /// RapidJSON's SAX reader
+  RapidJSON,
+  /// simdjson, which indexes structural characters with SIMD instructions before
+  /// walking them (requires Arrow to be built with ARROW_WITH_SIMDJSON)
+  Simdjson
+};
+
 struct ARROW_EXPORT ParseOptions {
   // Parsing options
 
@@ -51,8 +59,18 @@ struct ARROW_EXPORT ParseOptions {
   bool newlines_in_values = false;
 
   /// How JSON fields outside of explicit_schema (if given) are treated
+  ///
+  /// Ignore together with an explicit_schema listing a few fields is the way to
+  /// extract those from wide records: values of other fields are skipped without
+  /// being stored.
   UnexpectedFieldBehavior unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
 
+  /// Which JSON parser tokenizes each block
+  ///
+  /// Both backends produce the same arrays. Simdjson is usually faster on long
+  /// blocks, but rejects invalid UTF-8 and objects nested deeper than 1024 levels.
+  ParserBackend backend = ParserBackend::RapidJSON;
+
   /// Create parsing options with default values
   static ParseOptions Defaults();
 };
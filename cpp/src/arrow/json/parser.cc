@@ -19,6 +19,7 @@
 
 #include <functional>
 #include <limits>
+#include <string>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -40,6 +41,10 @@
 #include "arrow/util/trie.h"
 #include "arrow/visit_type_inline.h"
 
+#ifdef ARROW_WITH_SIMDJSON
+#include "arrow/json/simdjson_internal.h"
+#endif
+
 namespace arrow {
 
 using internal::BitsetStack;
@@ -322,20 +327,16 @@ class RawArrayBuilder<Kind::kObject> {
  public:
   explicit RawArrayBuilder(MemoryPool* pool) : null_bitmap_builder_(pool) {}
 
-  Status Append() { return null_bitmap_builder_.Append(true); }
+  Status Append() {
+    next_key_ = 0;
+    return null_bitmap_builder_.Append(true);
+  }
 
   Status AppendNull() { return null_bitmap_builder_.Append(false); }
 
   Status AppendNull(int64_t count) { return null_bitmap_builder_.Append(count, false); }
 
-  std::string FieldName(int i) const {
-    for (const auto& name_index : name_to_index_) {
-      if (name_index.second == i) {
-        return name_index.first;
-      }
-    }
-    return "";
-  }
+  std::string FieldName(int i) const { return field_names_[i]; }
 
   int GetFieldIndex(const std::string& name) const {
     auto it = name_to_index_.find(name);
@@ -345,9 +346,33 @@ class RawArrayBuilder<Kind::kObject> {
     return it->second;
   }
 
+  /// \brief Look up the field index of the next key of the current object
+  ///
+  /// Objects in a block usually list the same keys in the same order, so the keys
+  /// of the previous object are remembered along with their field index (-1 for
+  /// keys without a field) and a key matching its predecessor is resolved without
+  /// hashing. This keeps unexpected keys cheap when they are ignored.
+  int GetNextKeyIndex(string_view name) {
+    auto ordinal = next_key_++;
+    if (ordinal == key_cache_.size()) {
+      key_cache_.emplace_back(std::string(name), GetFieldIndex(std::string(name)));
+      return key_cache_.back().second;
+    }
+    auto& cached = key_cache_[ordinal];
+    if (cached.first != name) {
+      cached.first.assign(name.data(), name.size());
+      cached.second = GetFieldIndex(cached.first);
+    }
+    return cached.second;
+  }
+
   int AddField(std::string name, BuilderPtr builder) {
     auto index = num_fields();
     field_builders_.push_back(builder);
+    field_names_.push_back(name);
+    for (auto& cached : key_cache_) {
+      if (cached.first == name) cached.second = index;
+    }
     name_to_index_.emplace(std::move(name), index);
     return index;
   }
@@ -365,18 +390,13 @@ class RawArrayBuilder<Kind::kObject> {
     std::shared_ptr<Buffer> null_bitmap;
     RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
 
-    std::vector<string_view> field_names(num_fields());
-    for (const auto& name_index : name_to_index_) {
-      field_names[name_index.second] = name_index.first;
-    }
-
     std::vector<std::shared_ptr<Field>> fields(num_fields());
     std::vector<std::shared_ptr<ArrayData>> child_data(num_fields());
     for (int i = 0; i < num_fields(); ++i) {
       std::shared_ptr<Array> field_values;
       RETURN_NOT_OK(finish_child(field_builders_[i], &field_values));
       child_data[i] = field_values->data();
-      fields[i] = field(std::string(field_names[i]), field_values->type(),
+      fields[i] = field(field_names_[i], field_values->type(),
                         field_builders_[i].nullable, Kind::Tag(field_builders_[i].kind));
     }
 
@@ -389,7 +409,10 @@ class RawArrayBuilder<Kind::kObject> {
 
  private:
   std::vector<BuilderPtr> field_builders_;
+  std::vector<std::string> field_names_;
   std::unordered_map<std::string, int> name_to_index_;
+  std::vector<std::pair<std::string, int>> key_cache_;
+  size_t next_key_ = 0;
   TypedBufferBuilder<bool> null_bitmap_builder_;
 };
 
@@ -575,8 +598,9 @@ class RawBuilderSet {
 class HandlerBase : public BlockParser,
                     public rj::BaseReaderHandler<rj::UTF8<>, HandlerBase> {
  public:
-  explicit HandlerBase(MemoryPool* pool)
+  HandlerBase(MemoryPool* pool, ParserBackend backend)
       : BlockParser(pool),
+        backend_(backend),
         builder_set_(pool),
         field_index_(-1),
         scalar_values_builder_(pool) {}
@@ -708,6 +732,12 @@ class HandlerBase : public BlockParser,
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
+#ifdef ARROW_WITH_SIMDJSON
+    if (backend_ == ParserBackend::Simdjson) {
+      internal::SimdjsonWalker<Handler> walker(&handler);
+      return walker.Parse(json->data(), json->size(), kMaxParserNumRows, &num_rows_);
+    }
+#endif
     rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
     using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
     return DoParse(handler, InputStream(ms));
@@ -749,7 +779,7 @@ class HandlerBase : public BlockParser,
   /// there is no field with that name
   bool SetFieldBuilder(string_view key, bool* duplicate_keys) {
     auto parent = Cast<Kind::kObject>(builder_stack_.back());
-    field_index_ = parent->GetFieldIndex(std::string(key));
+    field_index_ = parent->GetNextKeyIndex(key);
     if (ARROW_PREDICT_FALSE(field_index_ == -1)) {
       return false;
     }
@@ -841,6 +871,7 @@ class HandlerBase : public BlockParser,
   }
 
   Status status_;
+  ParserBackend backend_;
   RawBuilderSet builder_set_;
   BuilderPtr builder_;
   // top of this stack is the parent of builder_
@@ -1083,17 +1114,26 @@ Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
   DCHECK(options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType ||
          options.explicit_schema != nullptr);
 
+#ifndef ARROW_WITH_SIMDJSON
+  if (options.backend == ParserBackend::Simdjson) {
+    return Status::NotImplemented(
+        "The simdjson JSON parser backend requires Arrow to be built with "
+        "ARROW_WITH_SIMDJSON");
+  }
+#endif
+
   switch (options.unexpected_field_behavior) {
     case UnexpectedFieldBehavior::Ignore: {
-      *out = make_unique<Handler<UnexpectedFieldBehavior::Ignore>>(pool);
+      *out = make_unique<Handler<UnexpectedFieldBehavior::Ignore>>(pool, options.backend);
       break;
     }
     case UnexpectedFieldBehavior::Error: {
-      *out = make_unique<Handler<UnexpectedFieldBehavior::Error>>(pool);
+      *out = make_unique<Handler<UnexpectedFieldBehavior::Error>>(pool, options.backend);
       break;
     }
     case UnexpectedFieldBehavior::InferType:
-      *out = make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool);
+      *out =
+          make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool, options.backend);
       break;
   }
   return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema);
@@ -34,15 +34,25 @@ std::shared_ptr<Schema> TestSchema() {
   return schema({field("int", int32()), field("str", utf8())});
 }
 
+std::shared_ptr<Schema> WideTestSchema() {
+  FieldVector fields;
+  for (int i = 0; i < 32; ++i) {
+    fields.push_back(field("int" + std::to_string(i), int32()));
+    fields.push_back(field("str" + std::to_string(i), utf8()));
+  }
+  return schema(std::move(fields));
+}
+
 constexpr int seed = 0x432432;
 
-std::string TestJsonData(int num_rows, bool pretty = false) {
+std::string TestJsonData(int num_rows, bool pretty = false,
+                         const std::shared_ptr<Schema>& schema = TestSchema()) {
   std::default_random_engine engine(seed);
   std::string json;
   for (int i = 0; i < num_rows; ++i) {
     StringBuffer sb;
     Writer writer(sb);
-    ABORT_NOT_OK(Generate(TestSchema(), engine, &writer));
+    ABORT_NOT_OK(Generate(schema, engine, &writer));
     json += pretty ? PrettyPrint(sb.GetString()) : sb.GetString();
     json += "\n";
   }
@@ -91,8 +101,14 @@ static void ChunkJSONLineDelimited(
 static void BenchmarkJSONParsing(benchmark::State& state,  // NOLINT non-const reference
                                  const std::shared_ptr<Buffer>& json, int32_t num_rows,
                                  ParseOptions options) {
+  std::unique_ptr<BlockParser> parser;
+  auto status = BlockParser::Make(options, &parser);
+  if (status.IsNotImplemented()) {
+    state.SkipWithError(status.ToString().c_str());
+    return;
+  }
+
   for (auto _ : state) {
-    std::unique_ptr<BlockParser> parser;
     ABORT_NOT_OK(BlockParser::Make(options, &parser));
     ABORT_NOT_OK(parser->Parse(json));
 
@@ -102,20 +118,88 @@ static void BenchmarkJSONParsing(benchmark::State& state,  // NOLINT non-const r
   state.SetBytesProcessed(state.iterations() * json->size());
 }
 
-static void ParseJSONBlockWithSchema(
-    benchmark::State& state) {  // NOLINT non-const reference
+static void ParseJSONBlockWithSchema(benchmark::State& state,  // NOLINT non-const ref
+                                     ParserBackend backend) {
   const int32_t num_rows = 5000;
   auto options = ParseOptions::Defaults();
   options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
   options.explicit_schema = TestSchema();
+  options.backend = backend;
 
   auto json = TestJsonData(num_rows);
   BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
 }
 
+static void ParseJSONBlockInferType(benchmark::State& state,  // NOLINT non-const ref
+                                    ParserBackend backend) {
+  const int32_t num_rows = 5000;
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  options.backend = backend;
+
+  auto json = TestJsonData(num_rows);
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
+}
+
+static void ParseJSONPrettyPrintedBlock(benchmark::State& state,  // NOLINT non-const ref
+                                        ParserBackend backend) {
+  const int32_t num_rows = 5000;
+  auto options = ParseOptions::Defaults();
+  options.newlines_in_values = true;
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  options.explicit_schema = TestSchema();
+  options.backend = backend;
+
+  auto json = TestJsonData(num_rows, /*pretty=*/true);
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
+}
+
+static void ParseJSONWideBlockWithSchema(benchmark::State& state,  // NOLINT non-const ref
+                                         ParserBackend backend) {
+  const int32_t num_rows = 500;
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  options.explicit_schema = WideTestSchema();
+  options.backend = backend;
+
+  auto json = TestJsonData(num_rows, /*pretty=*/false, WideTestSchema());
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
+}
+
+static void ParseJSONWideBlockProjected(benchmark::State& state,  // NOLINT non-const ref
+                                        ParserBackend backend) {
+  const int32_t num_rows = 500;
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  options.explicit_schema = schema(
+      {field("int0", int32()), field("str7", utf8()), field("int31", int32())});
+  options.backend = backend;
+
+  auto json = TestJsonData(num_rows, /*pretty=*/false, WideTestSchema());
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
+}
+
+static void ParseJSONWideBlockInferType(benchmark::State& state,  // NOLINT non-const ref
+                                        ParserBackend backend) {
+  const int32_t num_rows = 500;
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  options.backend = backend;
+
+  auto json = TestJsonData(num_rows, /*pretty=*/false, WideTestSchema());
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
+}
+
 static void BenchmarkJSONReading(benchmark::State& state,  // NOLINT non-const reference
                                  const std::string& json, int32_t num_rows,
                                  ReadOptions read_options, ParseOptions parse_options) {
+  std::unique_ptr<BlockParser> parser;
+  auto status = BlockParser::Make(parse_options, &parser);
+  if (status.IsNotImplemented()) {
+    state.SkipWithError(status.ToString().c_str());
+    return;
+  }
+
   for (auto _ : state) {
     std::shared_ptr<io::InputStream> input;
     ABORT_NOT_OK(MakeStream(json, &input));
@@ -130,7 +214,8 @@ static void BenchmarkJSONReading(benchmark::State& state,  // NOLINT non-const r
 }
 
 static void BenchmarkReadJSONBlockWithSchema(
-    benchmark::State& state, bool use_threads) {  // NOLINT non-const reference
+    benchmark::State& state,  // NOLINT non-const reference
+    bool use_threads, ParserBackend backend = ParserBackend::RapidJSON) {
   const int32_t num_rows = 500000;
   auto read_options = ReadOptions::Defaults();
   read_options.use_threads = use_threads;
@@ -138,6 +223,7 @@ static void BenchmarkReadJSONBlockWithSchema(
   auto parse_options = ParseOptions::Defaults();
   parse_options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
   parse_options.explicit_schema = TestSchema();
+  parse_options.backend = backend;
 
   auto json = TestJsonData(num_rows);
   BenchmarkJSONReading(state, json, num_rows, read_options, parse_options);
@@ -153,12 +239,35 @@ static void ReadJSONBlockWithSchemaMultiThread(
   BenchmarkReadJSONBlockWithSchema(state, true);
 }
 
+static void ReadJSONBlockWithSchemaSingleThreadSimdjson(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadJSONBlockWithSchema(state, false, ParserBackend::Simdjson);
+}
+
+static void ReadJSONBlockWithSchemaMultiThreadSimdjson(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadJSONBlockWithSchema(state, true, ParserBackend::Simdjson);
+}
+
 BENCHMARK(ChunkJSONPrettyPrinted);
 BENCHMARK(ChunkJSONLineDelimited);
-BENCHMARK(ParseJSONBlockWithSchema);
+BENCHMARK_CAPTURE(ParseJSONBlockWithSchema, rapidjson, ParserBackend::RapidJSON);
+BENCHMARK_CAPTURE(ParseJSONBlockWithSchema, simdjson, ParserBackend::Simdjson);
+BENCHMARK_CAPTURE(ParseJSONBlockInferType, rapidjson, ParserBackend::RapidJSON);
+BENCHMARK_CAPTURE(ParseJSONBlockInferType, simdjson, ParserBackend::Simdjson);
+BENCHMARK_CAPTURE(ParseJSONPrettyPrintedBlock, rapidjson, ParserBackend::RapidJSON);
+BENCHMARK_CAPTURE(ParseJSONPrettyPrintedBlock, simdjson, ParserBackend::Simdjson);
+BENCHMARK_CAPTURE(ParseJSONWideBlockWithSchema, rapidjson, ParserBackend::RapidJSON);
+BENCHMARK_CAPTURE(ParseJSONWideBlockWithSchema, simdjson, ParserBackend::Simdjson);
+BENCHMARK_CAPTURE(ParseJSONWideBlockProjected, rapidjson, ParserBackend::RapidJSON);
+BENCHMARK_CAPTURE(ParseJSONWideBlockProjected, simdjson, ParserBackend::Simdjson);
+BENCHMARK_CAPTURE(ParseJSONWideBlockInferType, rapidjson, ParserBackend::RapidJSON);
+BENCHMARK_CAPTURE(ParseJSONWideBlockInferType, simdjson, ParserBackend::Simdjson);
 
 BENCHMARK(ReadJSONBlockWithSchemaSingleThread);
 BENCHMARK(ReadJSONBlockWithSchemaMultiThread)->UseRealTime();
+BENCHMARK(ReadJSONBlockWithSchemaSingleThreadSimdjson);
+BENCHMARK(ReadJSONBlockWithSchemaMultiThreadSimdjson)->UseRealTime();
 
 }  // namespace json
 }  // namespace arrow
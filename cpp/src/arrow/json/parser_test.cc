@@ -136,6 +136,21 @@ TEST(BlockParserWithSchema, SkipFieldsOutsideSchema) {
                       "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
 }
 
+TEST(BlockParserWithSchema, SkipFieldsInVaryingOrder) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema({field("a", int64()), field("c", utf8())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  AssertParseColumns(options, R"({"a": 1, "b": {"a": 9, "c": "x"}, "c": "one"}
+{"a": 2, "b": [{"c": "y"}], "c": "two"}
+{"c": "three", "a": 3, "d": true}
+{"b": null, "d": false, "a": 4}
+{"a": 5, "b": 0, "c": "five"}
+)",
+                     {field("a", utf8()), field("c", utf8())},
+                     {R"(["1", "2", "3", "4", "5"])",
+                      R"(["one", "two", "three", null, "five"])"});
+}
+
 class BlockParserTypeError : public ::testing::TestWithParam<UnexpectedFieldBehavior> {
  public:
   ParseOptions Options(std::shared_ptr<Schema> explicit_schema) {
@@ -261,5 +276,184 @@ TEST(BlockParser, AdHoc) {
        R"([{"c":true, "d": "1991-02-03"}, {"c":false, "d":"2019-04-01"}])"});
 }
 
+TEST(BlockParser, KeysInVaryingOrder) {
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  AssertParseColumns(options, R"({"a": 1, "b": true}
+{"c": "x", "a": 2}
+{"b": false, "c": "y", "a": 3}
+{"a": 4, "b": null, "c": "z"}
+)",
+                     {field("a", utf8()), field("b", boolean()), field("c", utf8())},
+                     {R"(["1", "2", "3", "4"])", "[true, null, false, null]",
+                      R"([null, "x", "y", "z"])"});
+}
+
+class BlockParserBackend : public ::testing::TestWithParam<ParserBackend> {
+ protected:
+  void SetUp() override {
+    std::unique_ptr<BlockParser> parser;
+    auto status = BlockParser::Make(Options(), &parser);
+    if (status.IsNotImplemented()) {
+      GTEST_SKIP() << status.ToString();
+    }
+    ASSERT_OK(status);
+  }
+
+  ParseOptions Options(UnexpectedFieldBehavior unexpected_field_behavior =
+                           UnexpectedFieldBehavior::InferType,
+                       std::shared_ptr<Schema> explicit_schema = nullptr) {
+    auto options = ParseOptions::Defaults();
+    options.backend = GetParam();
+    options.unexpected_field_behavior = unexpected_field_behavior;
+    options.explicit_schema = std::move(explicit_schema);
+    return options;
+  }
+
+  void AssertParseError(string_view src_str) {
+    std::shared_ptr<Array> parsed;
+    ASSERT_RAISES(Invalid, ParseFromString(Options(), src_str, &parsed)) << src_str;
+  }
+};
+
+TEST_P(BlockParserBackend, Basics) {
+  AssertParseColumns(
+      Options(), scalars_only_src(),
+      {field("hello", utf8()), field("world", boolean()), field("yo", utf8())},
+      {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]", "[false, null, null, true]",
+       "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
+}
+
+TEST_P(BlockParserBackend, Nested) {
+  AssertParseColumns(Options(), nested_src(),
+                     {field("yo", utf8()), field("arr", list(utf8())),
+                      field("nuf", struct_({field("ps", utf8())}))},
+                     {"[\"thing\", null, \"\xe5\xbf\x8d\", null]",
+                      R"([["1", "2", "3"], ["2"], [], null])",
+                      R"([{"ps":null}, {}, {"ps":"78"}, {"ps":"90"}])"});
+}
+
+TEST_P(BlockParserBackend, Null) {
+  AssertParseColumns(
+      Options(), null_src(),
+      {field("plain", null()), field("list1", list(null())), field("list2", list(null())),
+       field("struct", struct_({field("plain", null())}))},
+      {"[null, null]", "[[], []]", "[[], [null]]",
+       R"([{"plain": null}, {"plain": null}])"});
+}
+
+TEST_P(BlockParserBackend, NumbersAreKeptUnconverted) {
+  AssertParseColumns(Options(), R"({"a": 0}
+{"a": -12.5e-3 }
+{"a": 1E+300}
+{"a": NaN}
+{"a": -Infinity}
+{"a": Inf}
+)",
+                     {field("a", utf8())},
+                     {R"(["0", "-12.5e-3", "1E+300", "NaN", "-Infinity", "Inf"])"});
+}
+
+TEST_P(BlockParserBackend, EscapedStringsAndKeys) {
+  AssertParseColumns(Options(), R"({"a\tb": "\"quoted\"\n", "c": "\u00e9\/\\"}
+{"a\tb": "\ud83d\ude00"}
+)",
+                     {field("a\tb", utf8()), field("c", utf8())},
+                     {R"(["\"quoted\"\n", "\ud83d\ude00"])", R"(["\u00e9/\\", null])"});
+}
+
+TEST_P(BlockParserBackend, NewlinesInValues) {
+  AssertParseColumns(Options(), R"({
+  "a": [
+    1,
+    2
+  ],
+  "b": {"c": "d"}
+}
+{"a": [], "b": {}})",
+                     {field("a", list(utf8())),
+                      field("b", struct_({field("c", utf8())}))},
+                     {R"([["1", "2"], []])", R"([{"c": "d"}, {}])"});
+}
+
+TEST_P(BlockParserBackend, EmptyBlock) {
+  for (auto src_str : {"", "\n", " \r\n\t\n"}) {
+    std::unique_ptr<BlockParser> parser;
+    ASSERT_OK(BlockParser::Make(Options(), &parser));
+    ASSERT_OK(parser->Parse(std::make_shared<Buffer>(src_str)));
+    ASSERT_EQ(parser->num_rows(), 0);
+  }
+}
+
+TEST_P(BlockParserBackend, NumRows) {
+  std::unique_ptr<BlockParser> parser;
+  ASSERT_OK(BlockParser::Make(Options(), &parser));
+  ASSERT_OK(parser->Parse(std::make_shared<Buffer>(nested_src())));
+  ASSERT_EQ(parser->num_rows(), 4);
+}
+
+TEST_P(BlockParserBackend, InvalidJson) {
+  AssertParseError(R"({"a": 0, "b")");
+  AssertParseError("{\"a\": 0}\n{\"a\": 1");
+  AssertParseError(R"({"a": [1, 2}})");
+  AssertParseError(R"({"a": 1.2.3})");
+  AssertParseError(R"({"a": 01})");
+  AssertParseError(R"({"a": -})");
+  AssertParseError(R"({"a": NaNa})");
+  AssertParseError(R"({"a": tru})");
+  AssertParseError(R"({"a": nul})");
+  AssertParseError(R"({"a": "\x"})");
+  AssertParseError(R"({"a" 1})");
+}
+
+TEST_P(BlockParserBackend, HandlerErrors) {
+  std::shared_ptr<Array> parsed;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("changed from number to string in row 1"),
+      ParseFromString(Options(), "{\"a\": 1}\n{\"a\": \"x\"}\n", &parsed));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("unexpected field"),
+      ParseFromString(
+          Options(UnexpectedFieldBehavior::Error, schema({field("a", int32())})),
+          "{\"a\": 1, \"b\": 2}\n", &parsed));
+  ASSERT_RAISES(Invalid, ParseFromString(Options(), "[1, 2]\n", &parsed));
+}
+
+TEST_P(BlockParserBackend, SkipFieldsOutsideSchema) {
+  AssertParseColumns(
+      Options(UnexpectedFieldBehavior::Ignore, schema({field("b", boolean())})),
+      R"({"a": {"x": [1, {"y": null}]}, "b": true, "c": "skip"}
+{"c": [[], {}], "b": false}
+)",
+      {field("b", boolean())}, {"[true, false]"});
+}
+
+TEST_P(BlockParserBackend, MatchesRapidJSON) {
+  FieldVector fields = {
+      field("int", int32()), field("str", utf8()), field("bool", boolean()),
+      field("list", list(float64())),
+      field("struct", struct_({field("a", utf8()), field("b", int64())}))};
+  std::default_random_engine engine(0x432432);
+  std::string src_str;
+  for (int i = 0; i < 1000; ++i) {
+    StringBuffer sb;
+    Writer writer(sb);
+    ASSERT_OK(Generate(fields, engine, &writer));
+    src_str += sb.GetString();
+    src_str += "\n";
+  }
+
+  std::shared_ptr<StructArray> expected, actual;
+  auto options = Options();
+  ASSERT_OK(ParseFromString(options, src_str, &actual));
+  options.backend = ParserBackend::RapidJSON;
+  ASSERT_OK(ParseFromString(options, src_str, &expected));
+  AssertUnconvertedStructArraysEqual(*expected, *actual);
+}
+
+INSTANTIATE_TEST_SUITE_P(BlockParserBackend, BlockParserBackend,
+                         ::testing::Values(ParserBackend::RapidJSON,
+                                           ParserBackend::Simdjson));
+
 }  // namespace json
 }  // namespace arrow
@@ -17,6 +17,8 @@
 
 #include "arrow/json/reader.h"
 
+#include <algorithm>
+#include <atomic>
 #include <utility>
 #include <vector>
 
@@ -42,11 +44,290 @@ namespace arrow {
 using util::string_view;
 
 using internal::checked_cast;
+using internal::Executor;
 using internal::GetCpuThreadPool;
 using internal::TaskGroup;
 using internal::ThreadPool;
 
 namespace json {
+namespace {
+
+struct ChunkedBlock {
+  std::shared_ptr<Buffer> partial;
+  std::shared_ptr<Buffer> completion;
+  std::shared_ptr<Buffer> whole;
+  int64_t index;
+};
+
+struct DecodedBlock {
+  std::shared_ptr<RecordBatch> record_batch;
+  // The number of input bytes represented by this batch
+  int64_t num_bytes;
+};
+
+}  // namespace
+}  // namespace json
+
+template <>
+struct IterationTraits<json::ChunkedBlock> {
+  static json::ChunkedBlock End() { return json::ChunkedBlock{{}, {}, {}, -1}; }
+  static bool IsEnd(const json::ChunkedBlock& val) { return val.index < 0; }
+};
+
+template <>
+struct IterationTraits<json::DecodedBlock> {
+  static json::DecodedBlock End() { return json::DecodedBlock{nullptr, -1}; }
+  static bool IsEnd(const json::DecodedBlock& val) { return val.num_bytes < 0; }
+};
+
+namespace json {
+namespace {
+
+Result<std::shared_ptr<Array>> ParseBlock(const ChunkedBlock& block,
+                                          const ParseOptions& parse_options,
+                                          MemoryPool* pool) {
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::Make(pool, parse_options, &parser));
+  RETURN_NOT_OK(parser->ReserveScalarStorage(
+      block.partial->size() + block.completion->size() + block.whole->size()));
+
+  if (block.partial->size() != 0 || block.completion->size() != 0) {
+    std::shared_ptr<Buffer> straddling;
+    if (block.partial->size() == 0) {
+      straddling = block.completion;
+    } else if (block.completion->size() == 0) {
+      straddling = block.partial;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(straddling,
+                            ConcatenateBuffers({block.partial, block.completion}, pool));
+    }
+    RETURN_NOT_OK(parser->Parse(straddling));
+  }
+
+  if (block.whole->size() != 0) {
+    RETURN_NOT_OK(parser->Parse(block.whole));
+  }
+
+  std::shared_ptr<Array> parsed;
+  RETURN_NOT_OK(parser->Finish(&parsed));
+  return parsed;
+}
+
+// A callable delimiting blocks of whole JSON objects in the input buffers, for use
+// with MakeTransformedGenerator.  Like TableReaderImpl::Read, it works one buffer
+// behind so as to know which buffer is the last one.
+class BlockChunker {
+ public:
+  BlockChunker(std::unique_ptr<Chunker> chunker, std::shared_ptr<Buffer> first_buffer)
+      : chunker_(std::move(chunker)),
+        partial_(std::make_shared<Buffer>("")),
+        buffer_(std::move(first_buffer)) {}
+
+  Result<TransformFlow<ChunkedBlock>> operator()(std::shared_ptr<Buffer> next_buffer) {
+    if (buffer_ == nullptr) {
+      return TransformFinish();
+    }
+    std::shared_ptr<Buffer> whole, completion, next_partial;
+    if (next_buffer == nullptr) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(chunker_->ProcessFinal(partial_, buffer_, &completion, &whole));
+      next_partial = std::make_shared<Buffer>("");
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, buffer_, &completion,
+                                                 &starts_with_whole));
+      // Get all whole objects entirely inside the current buffer
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &whole, &next_partial));
+    }
+    ChunkedBlock block{std::move(partial_), std::move(completion), std::move(whole),
+                       block_index_++};
+    partial_ = std::move(next_partial);
+    buffer_ = std::move(next_buffer);
+    return TransformYield(std::move(block));
+  }
+
+ private:
+  std::unique_ptr<Chunker> chunker_;
+  std::shared_ptr<Buffer> partial_, buffer_;
+  int64_t block_index_ = 0;
+};
+
+// A callable parsing and converting a block of JSON objects to a record batch
+// (ChunkedBlock -> DecodedBlock).  It is stateless, so several blocks may be
+// decoded concurrently.
+class BlockDecoder {
+ public:
+  BlockDecoder(MemoryPool* pool, ParseOptions parse_options)
+      : pool_(pool), parse_options_(std::move(parse_options)) {}
+
+  Result<DecodedBlock> operator()(const ChunkedBlock& block) const {
+    ARROW_ASSIGN_OR_RAISE(auto parsed, ParseBlock(block, parse_options_, pool_));
+
+    auto type = parse_options_.explicit_schema
+                    ? struct_(parse_options_.explicit_schema->fields())
+                    : struct_({});
+    auto promotion_graph =
+        parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
+            ? GetPromotionGraph()
+            : nullptr;
+    std::shared_ptr<ChunkedArrayBuilder> builder;
+    RETURN_NOT_OK(MakeChunkedArrayBuilder(TaskGroup::MakeSerial(), pool_,
+                                          promotion_graph, type, &builder));
+    builder->Insert(0, field("", parsed->type()), parsed);
+    std::shared_ptr<ChunkedArray> converted_chunked;
+    RETURN_NOT_OK(builder->Finish(&converted_chunked));
+    const auto& converted =
+        checked_cast<const StructArray&>(*converted_chunked->chunk(0));
+
+    std::vector<std::shared_ptr<Array>> columns(converted.num_fields());
+    for (int i = 0; i < converted.num_fields(); ++i) {
+      columns[i] = converted.field(i);
+    }
+    auto batch = RecordBatch::Make(schema(converted.type()->fields()),
+                                   converted.length(), std::move(columns));
+    return DecodedBlock{std::move(batch), block.partial->size() +
+                                              block.completion->size() +
+                                              block.whole->size()};
+  }
+
+ private:
+  MemoryPool* pool_;
+  ParseOptions parse_options_;
+};
+
+class StreamingReaderImpl : public StreamingReader,
+                            public std::enable_shared_from_this<StreamingReaderImpl> {
+ public:
+  StreamingReaderImpl(io::IOContext io_context, Executor* cpu_executor,
+                      const ReadOptions& read_options, const ParseOptions& parse_options)
+      : io_context_(std::move(io_context)),
+        cpu_executor_(cpu_executor),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        bytes_read_(std::make_shared<std::atomic<int64_t>>(0)) {}
+
+  Future<> Init(std::shared_ptr<io::InputStream> input) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto istream_it,
+        io::MakeInputStreamIterator(std::move(input), read_options_.block_size));
+    ARROW_ASSIGN_OR_RAISE(auto bg_it, MakeBackgroundGenerator(std::move(istream_it),
+                                                              io_context_.executor()));
+    AsyncGenerator<std::shared_ptr<Buffer>> buffer_gen =
+        MakeTransferredGenerator(std::move(bg_it), cpu_executor_);
+
+    auto self = shared_from_this();
+    return buffer_gen().Then(
+        [self, buffer_gen](const std::shared_ptr<Buffer>& first_buffer) -> Future<> {
+          if (first_buffer == nullptr) {
+            return Status::Invalid("Empty JSON file");
+          }
+          auto chunker = std::make_shared<BlockChunker>(
+              MakeChunker(self->parse_options_), first_buffer);
+          Transformer<std::shared_ptr<Buffer>, ChunkedBlock> chunker_fn =
+              [chunker](std::shared_ptr<Buffer> next) {
+                return (*chunker)(std::move(next));
+              };
+          return self->InitFromBlocks(
+              MakeTransformedGenerator(std::move(buffer_gen), std::move(chunker_fn)),
+              /*prev_bytes_processed=*/0);
+        });
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  int64_t bytes_read() const override { return bytes_read_->load(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    auto next_fut = ReadNextAsync();
+    auto next_result = next_fut.result();
+    return std::move(next_result).Value(batch);
+  }
+
+  Future<std::shared_ptr<RecordBatch>> ReadNextAsync() override {
+    return record_batch_gen_();
+  }
+
+ private:
+  // Decode blocks serially until a non-empty one is found, to infer the schema from
+  Future<> InitFromBlocks(AsyncGenerator<ChunkedBlock> block_gen,
+                          int64_t prev_bytes_processed) {
+    auto self = shared_from_this();
+    return block_gen().Then([self, block_gen, prev_bytes_processed](
+                                const ChunkedBlock& block) -> Future<> {
+      if (IsIterationEnd(block)) {
+        // No JSON objects at all
+        self->schema_ = self->parse_options_.explicit_schema
+                            ? self->parse_options_.explicit_schema
+                            : ::arrow::schema({});
+        self->bytes_read_->fetch_add(prev_bytes_processed);
+        self->record_batch_gen_ = MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+        return Status::OK();
+      }
+      BlockDecoder decoder(self->io_context_.pool(), self->parse_options_);
+      ARROW_ASSIGN_OR_RAISE(auto decoded, decoder(block));
+      if (decoded.record_batch->num_rows() == 0) {
+        return self->InitFromBlocks(std::move(block_gen),
+                                    prev_bytes_processed + decoded.num_bytes);
+      }
+      return self->InitFromFirstBlock(std::move(decoded), std::move(block_gen),
+                                      prev_bytes_processed);
+    });
+  }
+
+  Status InitFromFirstBlock(DecodedBlock first_block,
+                            AsyncGenerator<ChunkedBlock> block_gen,
+                            int64_t prev_bytes_processed) {
+    schema_ = first_block.record_batch->schema();
+
+    // Freeze the schema for the following blocks
+    auto parse_options = parse_options_;
+    parse_options.explicit_schema = schema_;
+    if (parse_options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType) {
+      parse_options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+    }
+    BlockDecoder decoder(io_context_.pool(), std::move(parse_options));
+
+    AsyncGenerator<DecodedBlock> decoded_gen;
+    if (read_options_.use_threads) {
+      auto cpu_executor = cpu_executor_;
+      auto decode_async = [cpu_executor, decoder](const ChunkedBlock& block) {
+        return DeferNotOk(cpu_executor->Submit(decoder, block));
+      };
+      decoded_gen = MakeReadaheadGenerator(
+          MakeMappedGenerator(std::move(block_gen), std::move(decode_async)),
+          std::max(1, cpu_executor_->GetCapacity()));
+    } else {
+      decoded_gen = MakeMappedGenerator(std::move(block_gen), std::move(decoder));
+    }
+    decoded_gen =
+        MakeGeneratorStartsWith({std::move(first_block)}, std::move(decoded_gen));
+
+    auto bytes_read = bytes_read_;
+    auto unwrap_and_record_bytes =
+        [bytes_read, prev_bytes_processed](
+            const DecodedBlock& block) mutable -> Result<std::shared_ptr<RecordBatch>> {
+      bytes_read->fetch_add(block.num_bytes + prev_bytes_processed);
+      prev_bytes_processed = 0;
+      return block.record_batch;
+    };
+    auto unwrapped =
+        MakeMappedGenerator(std::move(decoded_gen), std::move(unwrap_and_record_bytes));
+    record_batch_gen_ = MakeCancellable(std::move(unwrapped), io_context_.stop_token());
+    return Status::OK();
+  }
+
+  io::IOContext io_context_;
+  Executor* cpu_executor_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  std::shared_ptr<Schema> schema_;
+  AsyncGenerator<std::shared_ptr<RecordBatch>> record_batch_gen_;
+  // bytes which have been decoded and asked for by the caller
+  std::shared_ptr<std::atomic<int64_t>> bytes_read_;
+};
+
+}  // namespace
 
 class TableReaderImpl : public TableReader,
                         public std::enable_shared_from_this<TableReaderImpl> {
@@ -183,6 +464,25 @@ Result<std::shared_ptr<TableReader>> TableReader::Make(
   return ptr;
 }
 
+Future<std::shared_ptr<StreamingReader>> StreamingReader::MakeAsync(
+    io::IOContext io_context, std::shared_ptr<io::InputStream> input,
+    Executor* cpu_executor, const ReadOptions& read_options,
+    const ParseOptions& parse_options) {
+  auto reader = std::make_shared<StreamingReaderImpl>(std::move(io_context), cpu_executor,
+                                                      read_options, parse_options);
+  return reader->Init(std::move(input)).Then([reader] {
+    return std::static_pointer_cast<StreamingReader>(reader);
+  });
+}
+
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    io::IOContext io_context, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options) {
+  auto reader_fut = MakeAsync(std::move(io_context), std::move(input),
+                              GetCpuThreadPool(), read_options, parse_options);
+  return reader_fut.result();
+}
+
 Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                               std::shared_ptr<Buffer> json) {
   std::unique_ptr<BlockParser> parser;
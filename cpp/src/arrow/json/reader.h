@@ -19,10 +19,14 @@
 
 #include <memory>
 
+#include "arrow/io/interfaces.h"
 #include "arrow/json/options.h"
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -57,6 +61,50 @@ class ARROW_EXPORT TableReader {
                                                    const ParseOptions&);
 };
 
+/// \brief A class that reads a JSON file incrementally
+///
+/// The file is expected to consist of individual line-separated JSON objects.
+/// It is read and chunked in blocks of `ReadOptions::block_size` bytes, each of
+/// them yielding one record batch.  If `ReadOptions::use_threads` is true,
+/// several blocks are parsed and converted in parallel on the CPU executor,
+/// with at most as many blocks in flight as the executor has threads.  Batches
+/// are always yielded in file order.
+///
+/// Caveats:
+/// - Unless an explicit schema is given, the schema is inferred from the first
+///   non-empty block and frozen afterwards.  Unexpected fields in later blocks
+///   are then rejected, as if `ParseOptions::unexpected_field_behavior` was
+///   `Error`, and later values must be convertible to the inferred types.  To
+///   make sure the right data types are inferred, either set
+///   `ReadOptions::block_size` to a large enough value, or use
+///   `ParseOptions::explicit_schema` to set the desired data types explicitly.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  virtual Future<std::shared_ptr<RecordBatch>> ReadNextAsync() = 0;
+
+  /// \brief Return the number of bytes which have been read and processed
+  ///
+  /// The returned number includes JSON bytes whose batches were returned by the
+  /// reader, but not bytes for which some processing is still ongoing.
+  virtual int64_t bytes_read() const = 0;
+
+  /// Create a StreamingReader instance
+  ///
+  /// This involves some I/O as the first batch must be loaded during the creation
+  /// process, so it is returned as a future
+  ///
+  /// The StreamingReader is not async-reentrant
+  static Future<std::shared_ptr<StreamingReader>> MakeAsync(
+      io::IOContext io_context, std::shared_ptr<io::InputStream> input,
+      arrow::internal::Executor* cpu_executor, const ReadOptions&, const ParseOptions&);
+
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      io::IOContext io_context, std::shared_ptr<io::InputStream> input,
+      const ReadOptions&, const ParseOptions&);
+};
+
 ARROW_EXPORT Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                                            std::shared_ptr<Buffer> json);
 
@@ -0,0 +1,201 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <memory>
+#include <random>
+#include <string>
+
+#include "arrow/buffer.h"
+#include "arrow/io/compressed.h"
+#include "arrow/io/memory.h"
+#include "arrow/json/options.h"
+#include "arrow/json/reader.h"
+#include "arrow/json/test_common.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace json {
+
+namespace {
+
+constexpr int kSeed = 0x432432;
+// Number of values in each generated JSON file, whatever the number of columns
+constexpr int64_t kNumValues = 1 << 19;
+
+// A schema cycling through integer, floating-point and string fields
+std::shared_ptr<Schema> MakeSchema(int num_cols) {
+  FieldVector fields;
+  for (int i = 0; i < num_cols; ++i) {
+    const auto name = "f" + std::to_string(i);
+    switch (i % 3) {
+      case 0:
+        fields.push_back(field(name, int64()));
+        break;
+      case 1:
+        fields.push_back(field(name, float64()));
+        break;
+      default:
+        fields.push_back(field(name, utf8()));
+    }
+  }
+  return schema(std::move(fields));
+}
+
+std::shared_ptr<Buffer> MakeJsonData(const std::shared_ptr<Schema>& schema) {
+  std::default_random_engine engine(kSeed);
+  const int64_t num_rows = kNumValues / schema->num_fields();
+  std::string json;
+  for (int64_t i = 0; i < num_rows; ++i) {
+    StringBuffer sb;
+    Writer writer(sb);
+    ABORT_NOT_OK(Generate(schema, engine, &writer));
+    json += sb.GetString();
+    json += "\n";
+  }
+  return Buffer::FromString(std::move(json));
+}
+
+std::shared_ptr<Buffer> Compress(const std::shared_ptr<Buffer>& data,
+                                 util::Codec* codec) {
+  auto sink = *io::BufferOutputStream::Create();
+  auto compressed = *io::CompressedOutputStream::Make(codec, sink);
+  ABORT_NOT_OK(compressed->Write(data));
+  ABORT_NOT_OK(compressed->Close());
+  return *sink->Finish();
+}
+
+// Run the benchmark body with the given number of CPU threads
+class ScopedCpuThreads {
+ public:
+  explicit ScopedCpuThreads(int num_threads)
+      : previous_(GetCpuThreadPoolCapacity()) {
+    ABORT_NOT_OK(SetCpuThreadPoolCapacity(num_threads));
+  }
+  ~ScopedCpuThreads() { ABORT_NOT_OK(SetCpuThreadPoolCapacity(previous_)); }
+
+ private:
+  int previous_;
+};
+
+enum class ReaderKind { Table, Streaming };
+
+int64_t ReadJson(ReaderKind kind, std::shared_ptr<io::InputStream> input,
+                 const ReadOptions& read_options, const ParseOptions& parse_options) {
+  if (kind == ReaderKind::Table) {
+    auto reader = *TableReader::Make(default_memory_pool(), std::move(input),
+                                     read_options, parse_options);
+    return (*reader->Read())->num_rows();
+  }
+  auto reader = *StreamingReader::Make(io::default_io_context(), std::move(input),
+                                       read_options, parse_options);
+  int64_t num_rows = 0;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    ABORT_NOT_OK(reader->ReadNext(&batch));
+    if (batch == nullptr) break;
+    num_rows += batch->num_rows();
+  }
+  return num_rows;
+}
+
+void BenchmarkReadJson(benchmark::State& state,  // NOLINT non-const reference
+                       ReaderKind kind, util::Codec* codec = nullptr) {
+  const auto num_cols = static_cast<int>(state.range(0));
+  const bool infer_types = state.range(1) != 0;
+  const auto num_threads = static_cast<int>(state.range(2));
+
+  auto schema = MakeSchema(num_cols);
+  auto data = MakeJsonData(schema);
+  auto input_data = codec != nullptr ? Compress(data, codec) : data;
+
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = num_threads > 1;
+  auto parse_options = ParseOptions::Defaults();
+  if (!infer_types) {
+    parse_options.explicit_schema = schema;
+  }
+
+  ScopedCpuThreads cpu_threads(num_threads);
+  int64_t num_rows = 0;
+  for (auto _ : state) {
+    std::shared_ptr<io::InputStream> input =
+        std::make_shared<io::BufferReader>(input_data);
+    if (codec != nullptr) {
+      input = *io::CompressedInputStream::Make(codec, input);
+    }
+    num_rows = ReadJson(kind, std::move(input), read_options, parse_options);
+  }
+  if (num_rows != kNumValues / num_cols) {
+    state.SkipWithError("Unexpected number of rows read");
+  }
+
+  // Report the uncompressed size
+  state.SetBytesProcessed(state.iterations() * data->size());
+  state.SetItemsProcessed(state.iterations() * num_rows * num_cols);
+}
+
+void ReadJsonTable(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadJson(state, ReaderKind::Table);
+}
+
+void ReadJsonStreaming(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadJson(state, ReaderKind::Streaming);
+}
+
+void ReadJsonTableGzip(benchmark::State& state) {  // NOLINT non-const reference
+  if (!util::Codec::IsAvailable(Compression::GZIP)) {
+    state.SkipWithError("gzip support not built");
+    return;
+  }
+  auto codec = *util::Codec::Create(Compression::GZIP);
+  BenchmarkReadJson(state, ReaderKind::Table, codec.get());
+}
+
+// Arguments: number of columns, type inference, number of threads
+void ReaderArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"cols", "infer", "threads"});
+  for (int num_cols : {3, 30, 300}) {
+    for (int infer : {0, 1}) {
+      bench->Args({num_cols, infer, 1});
+    }
+  }
+  for (int num_threads : {2, 4, 8}) {
+    bench->Args({30, 1, num_threads});
+  }
+}
+
+void CompressedReaderArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"cols", "infer", "threads"});
+  for (int num_threads : {1, 4}) {
+    bench->Args({30, 1, num_threads});
+  }
+}
+
+}  // namespace
+
+BENCHMARK(ReadJsonTable)->Apply(ReaderArgs)->UseRealTime();
+BENCHMARK(ReadJsonStreaming)->Apply(ReaderArgs)->UseRealTime();
+BENCHMARK(ReadJsonTableGzip)->Apply(CompressedReaderArgs)->UseRealTime();
+
+}  // namespace json
+}  // namespace arrow
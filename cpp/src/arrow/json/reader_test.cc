@@ -27,6 +27,7 @@
 #include "arrow/json/test_common.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace json {
@@ -274,5 +275,89 @@ TEST(ReaderTest, ListArrayWithFewValues) {
   AssertTablesEqual(*actual_table, *expected_table);
 }
 
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(thread_pool_, internal::ThreadPool::Make(4));
+    read_options_.use_threads = GetParam();
+  }
+
+  Result<std::shared_ptr<StreamingReader>> MakeReader(util::string_view json) {
+    RETURN_NOT_OK(MakeStream(json, &input_));
+    auto reader_fut =
+        StreamingReader::MakeAsync(io::default_io_context(), input_, thread_pool_.get(),
+                                   read_options_, parse_options_);
+    return reader_fut.result();
+  }
+
+  std::shared_ptr<internal::ThreadPool> thread_pool_;
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ReadOptions read_options_ = ReadOptions::Defaults();
+  std::shared_ptr<io::InputStream> input_;
+};
+
+INSTANTIATE_TEST_SUITE_P(StreamingReaderTest, StreamingReaderTest,
+                         ::testing::Values(false, true));
+
+TEST_P(StreamingReaderTest, Basics) {
+  const int num_rows = 2000;
+  std::string json, expected_json = "[";
+  for (int i = 0; i < num_rows; ++i) {
+    auto row = "{\"i\": " + std::to_string(i) + ", \"s\": \"row " + std::to_string(i) +
+               "\"}";
+    json += row + "\n";
+    expected_json += (i ? ", " : "") + row;
+  }
+  expected_json += "]";
+  read_options_.block_size = 1000;
+
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(json));
+  auto expected_schema = schema({field("i", int64()), field("s", utf8())});
+  AssertSchemaEqual(*expected_schema, *reader->schema());
+  // The first batch was read when creating the reader
+  ASSERT_EQ(0, reader->bytes_read());
+
+  ASSERT_OK_AND_ASSIGN(auto batches, reader->ToRecordBatches());
+  ASSERT_GT(batches.size(), 10U);
+  ASSERT_EQ(static_cast<int64_t>(json.size()), reader->bytes_read());
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(expected_schema, batches));
+  auto expected_table = TableFromJSON(expected_schema, {expected_json});
+  AssertTablesEqual(*expected_table, *table, /*same_chunk_layout=*/false);
+}
+
+TEST_P(StreamingReaderTest, SchemaFrozenAfterFirstBlock) {
+  std::string json;
+  for (int i = 0; i < 100; ++i) {
+    json += "{\"a\": 1}\n";
+  }
+  json += "{\"a\": 1, \"b\": 2}\n";
+  read_options_.block_size = 64;
+
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(json));
+  AssertSchemaEqual(*schema({field("a", int64())}), *reader->schema());
+  ASSERT_RAISES(Invalid, reader->ToRecordBatches());
+}
+
+TEST_P(StreamingReaderTest, ExplicitSchema) {
+  parse_options_.explicit_schema = schema({field("a", float64())});
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader("{\"a\": 1, \"b\": 2}\n{}\n"));
+  AssertSchemaEqual(*parse_options_.explicit_schema, *reader->schema());
+
+  ASSERT_OK_AND_ASSIGN(auto table, reader->ToTable());
+  auto expected_table =
+      TableFromJSON(parse_options_.explicit_schema, {R"([{"a": 1}, {"a": null}])"});
+  AssertTablesEqual(*expected_table, *table, /*same_chunk_layout=*/false);
+}
+
+TEST_P(StreamingReaderTest, Empty) {
+  ASSERT_RAISES(Invalid, MakeReader(""));
+
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader("\n\n"));
+  AssertSchemaEqual(*schema({}), *reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+  ASSERT_EQ(nullptr, batch);
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -0,0 +1,266 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Drives the BlockParser handlers with simdjson instead of RapidJSON.
+// Only include this file when ARROW_WITH_SIMDJSON is defined.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// simdjson bundles the same string_view backport as Arrow: include Arrow's first so
+// that both headers agree on its configuration
+#include "arrow/util/string_view.h"
+
+#include <simdjson.h>
+
+#include "arrow/status.h"
+#include "arrow/util/string_builder.h"
+
+namespace arrow {
+namespace json {
+namespace internal {
+
+/// \brief Whether a token is a JSON number, or one of the NaN and infinity
+/// spellings RapidJSON accepts with kParseNanAndInfFlag
+inline bool IsJsonNumberToken(util::string_view token) {
+  const char* p = token.data();
+  const char* end = p + token.size();
+  auto digits = [&]() {
+    const char* start = p;
+    while (p != end && *p >= '0' && *p <= '9') ++p;
+    return p != start;
+  };
+  auto rest_is = [&](const char* literal) {
+    auto length = static_cast<size_t>(end - p);
+    return length == std::strlen(literal) && std::memcmp(p, literal, length) == 0;
+  };
+
+  if (p != end && *p == '-') ++p;
+  if (p == end) return false;
+  if (*p == 'N') return rest_is("NaN");
+  if (*p == 'I') return rest_is("Inf") || rest_is("Infinity");
+  if (*p == '0') {
+    ++p;
+  } else if (!digits()) {
+    return false;
+  }
+  if (p != end && *p == '.') {
+    ++p;
+    if (!digits()) return false;
+  }
+  if (p != end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    if (p != end && (*p == '+' || *p == '-')) ++p;
+    if (!digits()) return false;
+  }
+  return p == end;
+}
+
+/// \brief Buffers reused by every simdjson parse on a thread
+///
+/// simdjson's parser keeps its structural index allocated between documents, and
+/// the input must be followed by SIMDJSON_PADDING readable bytes which Arrow
+/// buffers don't guarantee. Both are kept per thread so that parsing a block
+/// doesn't reallocate them.
+struct SimdjsonScratch {
+  simdjson::ondemand::parser parser;
+  std::vector<uint8_t> padded;
+
+  static SimdjsonScratch& ForThisThread() {
+    static thread_local SimdjsonScratch scratch;
+    return scratch;
+  }
+};
+
+/// \brief Feed a block of JSON documents to a RapidJSON-style SAX handler
+///
+/// simdjson first indexes the structural characters of the whole block with SIMD
+/// instructions, then its on-demand API walks that index. Every value is forwarded
+/// to the handler through the same calls rj::Reader makes, so both backends build
+/// identical arrays. As with kParseNumbersAsStringsFlag, numbers are passed
+/// unconverted to RawNumber.
+///
+/// Unlike RapidJSON, simdjson validates UTF-8 and limits nesting to 1024 levels.
+///
+/// simdjson hands out std::string_view, which it aliases to nonstd::string_view
+/// before C++17.
+template <typename Handler>
+class SimdjsonWalker {
+ public:
+  explicit SimdjsonWalker(Handler* handler) : handler_(handler) {}
+
+  /// \brief Parse every document of a block, counting them in *num_rows
+  ///
+  /// Errors raised by the handler are returned through handler->Error().
+  Status Parse(const uint8_t* data, int64_t size, int32_t max_num_rows,
+               int32_t* num_rows) {
+    if (std::all_of(data, data + size, IsWhitespace)) {
+      return Status::OK();
+    }
+    auto& scratch = SimdjsonScratch::ForThisThread();
+    const auto length = static_cast<size_t>(size);
+    scratch.padded.resize(length + simdjson::SIMDJSON_PADDING);
+    std::memcpy(scratch.padded.data(), data, length);
+
+    // A single batch covering the block lets documents be as large as the block
+    const size_t batch_size = std::max(length, simdjson::dom::MINIMAL_BATCH_SIZE);
+    simdjson::ondemand::document_stream stream;
+    RETURN_NOT_OK(Check(scratch.parser
+                            .iterate_many(scratch.padded.data(), length, batch_size)
+                            .get(stream),
+                        *num_rows));
+
+    for (auto it = stream.begin(); it != stream.end(); ++it, ++*num_rows) {
+      if (*num_rows == max_num_rows) {
+        return Status::Invalid("Exceeded maximum rows");
+      }
+      simdjson::ondemand::document_reference document;
+      RETURN_NOT_OK(Check((*it).get(document), *num_rows));
+      if (!Walk(document)) {
+        return Failure(*num_rows);
+      }
+    }
+    if (stream.truncated_bytes() != 0) {
+      return Status::Invalid("JSON parse error: The document is incomplete in row ",
+                             *num_rows);
+    }
+    return Status::OK();
+  }
+
+ private:
+  static bool IsWhitespace(uint8_t c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+  }
+
+  static Status Check(simdjson::error_code error, int32_t row) {
+    if (ARROW_PREDICT_TRUE(error == simdjson::SUCCESS)) {
+      return Status::OK();
+    }
+    return Status::Invalid("JSON parse error: ", simdjson::error_message(error),
+                           " in row ", row);
+  }
+
+  // Whether the walk stopped on a simdjson error (otherwise the handler failed)
+  Status Failure(int32_t row) {
+    if (error_ != simdjson::SUCCESS) {
+      return Check(error_, row);
+    }
+    return handler_->Error();
+  }
+
+  bool Ok(simdjson::error_code error) {
+    error_ = error;
+    return error == simdjson::SUCCESS;
+  }
+
+  // Walks either a document or a value nested in one: both expose the same getters
+  template <typename Value>
+  bool Walk(Value& value) {
+    simdjson::ondemand::json_type type;
+    if (ARROW_PREDICT_FALSE(value.type().get(type) != simdjson::SUCCESS)) {
+      // simdjson doesn't recognize NaN and Infinity, which RapidJSON accepts
+      return Number(value.raw_json_token());
+    }
+    switch (type) {
+      case simdjson::ondemand::json_type::object: {
+        simdjson::ondemand::object object;
+        return Ok(value.get_object().get(object)) && Walk(object);
+      }
+      case simdjson::ondemand::json_type::array: {
+        simdjson::ondemand::array array;
+        return Ok(value.get_array().get(array)) && Walk(array);
+      }
+      case simdjson::ondemand::json_type::string: {
+        std::string_view string;
+        return Ok(value.get_string().get(string)) &&
+               handler_->String(string.data(), Size(string), true);
+      }
+      case simdjson::ondemand::json_type::number:
+        return Number(value.raw_json_token());
+      case simdjson::ondemand::json_type::boolean: {
+        bool boolean;
+        return Ok(value.get_bool().get(boolean)) && handler_->Bool(boolean);
+      }
+      case simdjson::ondemand::json_type::null: {
+        bool is_null;
+        if (!Ok(value.is_null().get(is_null))) return false;
+        if (!is_null) return Ok(simdjson::N_ATOM_ERROR);
+        return handler_->Null();
+      }
+    }
+    return Ok(simdjson::TAPE_ERROR);
+  }
+
+  bool Walk(simdjson::ondemand::object& object) {
+    if (!handler_->StartObject()) return false;
+    uint32_t num_members = 0;
+    for (auto field_result : object) {
+      simdjson::ondemand::field field;
+      std::string_view key;
+      if (!Ok(std::move(field_result).get(field)) ||
+          !Ok(field.unescaped_key().get(key)) ||
+          !handler_->Key(key.data(), Size(key), true)) {
+        return false;
+      }
+      simdjson::ondemand::value value = field.value();
+      if (!Walk(value)) return false;
+      ++num_members;
+    }
+    return handler_->EndObject(num_members);
+  }
+
+  bool Walk(simdjson::ondemand::array& array) {
+    if (!handler_->StartArray()) return false;
+    uint32_t num_elements = 0;
+    for (auto element_result : array) {
+      simdjson::ondemand::value element;
+      if (!Ok(std::move(element_result).get(element)) || !Walk(element)) {
+        return false;
+      }
+      ++num_elements;
+    }
+    return handler_->EndArray(num_elements);
+  }
+
+  bool Number(simdjson::simdjson_result<std::string_view> token_result) {
+    std::string_view token;
+    if (!Ok(std::move(token_result).get(token))) return false;
+    // The raw token extends over any whitespace up to the next structural character
+    while (!token.empty() && IsWhitespace(static_cast<uint8_t>(token.back()))) {
+      token.remove_suffix(1);
+    }
+    if (!IsJsonNumberToken(util::string_view(token.data(), token.size()))) {
+      return Ok(simdjson::NUMBER_ERROR);
+    }
+    return handler_->RawNumber(token.data(), Size(token), false);
+  }
+
+  static uint32_t Size(std::string_view view) {
+    return static_cast<uint32_t>(view.size());
+  }
+
+  Handler* handler_;
+  simdjson::error_code error_ = simdjson::SUCCESS;
+};
+
+}  // namespace internal
+}  // namespace json
+}  // namespace arrow
@@ -19,12 +19,16 @@
 
 #include <algorithm>  // IWYU pragma: keep
 #include <atomic>
+#include <cerrno>
 #include <cstdlib>   // IWYU pragma: keep
 #include <cstring>   // IWYU pragma: keep
 #include <iostream>  // IWYU pragma: keep
 #include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #if defined(sun) || defined(__sun)
 #include <stdlib.h>
@@ -49,6 +53,13 @@
 #include <malloc.h>
 #endif
 
+#ifdef __linux__
+#include <sys/mman.h>
+#ifndef MAP_HUGE_2MB
+#define MAP_HUGE_2MB (21 << 26)
+#endif
+#endif
+
 #ifdef ARROW_MIMALLOC
 #include <mimalloc.h>
 #endif
@@ -69,6 +80,7 @@ namespace {
 
 constexpr char kDefaultBackendEnvVar[] = "ARROW_DEFAULT_MEMORY_POOL";
 constexpr char kDebugMemoryEnvVar[] = "ARROW_DEBUG_MEMORY_POOL";
+constexpr char kHugePagesEnvVar[] = "ARROW_MEMORY_POOL_HUGE_PAGES";
 
 enum class MemoryPoolBackend : uint8_t { System, Jemalloc, Mimalloc };
 
@@ -146,6 +158,32 @@ MemoryPoolBackend DefaultBackend() {
   return default_backend.backend;
 }
 
+// Return the HugePageMode selected by the user through the
+// ARROW_MEMORY_POOL_HUGE_PAGES environment variable, if any.
+util::optional<HugePageMode> UserSelectedHugePageMode() {
+  static auto user_selected_mode = []() -> util::optional<HugePageMode> {
+    auto maybe_value = internal::GetEnvVar(kHugePagesEnvVar);
+    if (!maybe_value.ok()) {
+      return {};
+    }
+    const auto value = *std::move(maybe_value);
+    if (value.empty()) {
+      return {};
+    }
+    if (value == "madvise") {
+      return HugePageMode::MADVISE;
+    }
+    if (value == "hugetlb") {
+      return HugePageMode::HUGETLB;
+    }
+    ARROW_LOG(WARNING) << "Invalid value for " << kHugePagesEnvVar << ": '" << value
+                       << "'. Valid values are 'madvise', 'hugetlb'.";
+    return {};
+  }();
+
+  return user_selected_mode;
+}
+
 using MemoryDebugHandler = std::function<void(uint8_t* ptr, int64_t size, const Status&)>;
 
 struct DebugState {
@@ -642,7 +680,9 @@ Status mimalloc_memory_pool(MemoryPool** out) {
 #endif
 }
 
-MemoryPool* default_memory_pool() {
+namespace {
+
+MemoryPool* DefaultBackendMemoryPool() {
   auto backend = DefaultBackend();
   switch (backend) {
     case MemoryPoolBackend::System:
@@ -661,6 +701,19 @@ MemoryPool* default_memory_pool() {
   }
 }
 
+}  // namespace
+
+MemoryPool* default_memory_pool() {
+  auto huge_page_mode = UserSelectedHugePageMode();
+  if (huge_page_mode.has_value()) {
+    // Never destroyed, as buffers may be freed during process exit
+    static auto huge_page_pool =
+        new HugePageMemoryPool(DefaultBackendMemoryPool(), *huge_page_mode);
+    return huge_page_pool;
+  }
+  return DefaultBackendMemoryPool();
+}
+
 #ifndef ARROW_JEMALLOC
 Status jemalloc_set_decay_ms(int ms) {
   return Status::Invalid("jemalloc support is not built");
@@ -763,6 +816,694 @@ int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
 
 std::string ProxyMemoryPool::backend_name() const { return impl_->backend_name(); }
 
+///////////////////////////////////////////////////////////////////////
+// NumaLocalMemoryPool implementation
+
+constexpr int64_t NumaLocalMemoryPool::kDefaultMinBindSize;
+
+NumaLocalMemoryPool::NumaLocalMemoryPool(MemoryPool* pool, int64_t min_bind_size)
+    : pool_(pool), min_bind_size_(min_bind_size) {}
+
+void NumaLocalMemoryPool::BindToCurrentNode(uint8_t* buffer, int64_t size) {
+  if (size < min_bind_size_ || !bind_supported_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  const int node = internal::GetCurrentNumaNode();
+  if (node < 0 || !internal::BindMemoryToNumaNode(buffer, size, node).ok()) {
+    // Not supported here (or forbidden, e.g. in a container), don't retry
+    bind_supported_.store(false, std::memory_order_relaxed);
+  }
+}
+
+Status NumaLocalMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  RETURN_NOT_OK(pool_->Allocate(size, out));
+  BindToCurrentNode(*out, size);
+  return Status::OK();
+}
+
+Status NumaLocalMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       uint8_t** ptr) {
+  RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+  BindToCurrentNode(*ptr, new_size);
+  return Status::OK();
+}
+
+void NumaLocalMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  pool_->Free(buffer, size);
+}
+
+int64_t NumaLocalMemoryPool::bytes_allocated() const { return pool_->bytes_allocated(); }
+
+int64_t NumaLocalMemoryPool::max_memory() const { return pool_->max_memory(); }
+
+std::string NumaLocalMemoryPool::backend_name() const { return pool_->backend_name(); }
+
+///////////////////////////////////////////////////////////////////////
+// LimitedMemoryPool implementation
+
+constexpr int64_t LimitedMemoryPool::kNoLimit;
+
+LimitedMemoryPool::LimitedMemoryPool(MemoryPool* pool, int64_t limit, std::string name)
+    : pool_(pool), name_(std::move(name)), limit_(limit) {}
+
+Status LimitedMemoryPool::Reserve(int64_t size) {
+  const int64_t limit = limit_.load();
+  int64_t allocated = bytes_allocated_.load();
+  do {
+    if (size > limit - allocated) {
+      return Status::OutOfMemory("Allocation of ", size,
+                                 " bytes would exceed the limit of ", limit,
+                                 " bytes of memory pool '", name_, "' (", allocated,
+                                 " bytes allocated)");
+    }
+  } while (!bytes_allocated_.compare_exchange_weak(allocated, allocated + size));
+  return Status::OK();
+}
+
+void LimitedMemoryPool::UpdatePeak() {
+  // Only once the ancestors accepted the allocation as well
+  const int64_t allocated = bytes_allocated_.load();
+  int64_t peak = max_memory_.load();
+  while (allocated > peak && !max_memory_.compare_exchange_weak(peak, allocated)) {
+  }
+}
+
+Status LimitedMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  RETURN_NOT_OK(Reserve(size));
+  Status st = pool_->Allocate(size, out);
+  if (!st.ok()) {
+    Release(size);
+    return st;
+  }
+  UpdatePeak();
+  return Status::OK();
+}
+
+Status LimitedMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                     uint8_t** ptr) {
+  const int64_t diff = new_size - old_size;
+  if (diff <= 0) {
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    Release(-diff);
+    return Status::OK();
+  }
+  RETURN_NOT_OK(Reserve(diff));
+  Status st = pool_->Reallocate(old_size, new_size, ptr);
+  if (!st.ok()) {
+    Release(diff);
+    return st;
+  }
+  UpdatePeak();
+  return Status::OK();
+}
+
+void LimitedMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  pool_->Free(buffer, size);
+  Release(size);
+}
+
+int64_t LimitedMemoryPool::bytes_allocated() const { return bytes_allocated_.load(); }
+
+int64_t LimitedMemoryPool::max_memory() const { return max_memory_.load(); }
+
+int64_t LimitedMemoryPool::bytes_available() const {
+  return std::max<int64_t>(0, limit_.load() - bytes_allocated_.load());
+}
+
+std::string LimitedMemoryPool::backend_name() const { return pool_->backend_name(); }
+
+///////////////////////////////////////////////////////////////////////
+// RecyclingMemoryPool implementation
+
+namespace {
+
+constexpr int64_t kMinSizeClass = 64;
+
+// Size classes are 64 bytes, then 4 classes per power of two:
+// 80, 96, 112, 128, 160, 192, 224, 256, 320...
+int SizeClassIndex(int64_t size) {
+  size = std::max(size, kMinSizeClass);
+  // 2**(bits - 1) < size <= 2**bits
+  const int bits = bit_util::NumRequiredBits(static_cast<uint64_t>(size - 1));
+  const int shift = bits - 3;
+  const int64_t steps = (size + (int64_t(1) << shift) - 1) >> shift;
+  return (bits - 6) * 4 + static_cast<int>(steps) - 8;
+}
+
+int64_t SizeClassSize(int index) {
+  if (index == 0) {
+    return kMinSizeClass;
+  }
+  const int bits = 7 + (index - 1) / 4;
+  const int64_t steps = 5 + (index - 1) % 4;
+  return steps << (bits - 3);
+}
+
+// The free lists of one thread for one pool
+struct RecyclingCache {
+  RecyclingCache(MemoryPool* pool, int num_size_classes)
+      : pool(pool), free_lists(num_size_classes) {}
+
+  // Return the cached buffers to the delegate pool
+  void Drain() {
+    for (size_t i = 0; i < free_lists.size(); ++i) {
+      const int64_t class_size = SizeClassSize(static_cast<int>(i));
+      for (uint8_t* buffer : free_lists[i]) {
+        pool.load()->Free(buffer, class_size);
+      }
+      free_lists[i].clear();
+    }
+    cached_bytes = 0;
+  }
+
+  std::mutex mutex;
+  // The delegate pool, null once the RecyclingMemoryPool is destroyed
+  std::atomic<MemoryPool*> pool;
+  std::atomic<bool> thread_exited{false};
+  std::vector<std::vector<uint8_t*>> free_lists;
+  int64_t cached_bytes = 0;
+};
+
+struct ThreadRecyclingCaches {
+  ~ThreadRecyclingCaches() {
+    for (const auto& entry : entries) {
+      RecyclingCache* cache = entry.second.get();
+      std::lock_guard<std::mutex> lock(cache->mutex);
+      if (cache->pool.load() != nullptr) {
+        cache->Drain();
+      }
+      cache->thread_exited.store(true);
+    }
+  }
+
+  // (pool id, cache) pairs.  Pool ids rather than addresses, as a new pool may
+  // reuse the address of a destroyed one.
+  using Entry = std::pair<uint64_t, std::shared_ptr<RecyclingCache>>;
+  std::vector<Entry> entries;
+};
+
+thread_local ThreadRecyclingCaches thread_recycling_caches;
+
+std::atomic<uint64_t> next_recycling_pool_id{0};
+
+}  // namespace
+
+constexpr int64_t RecyclingMemoryPool::kDefaultMaxCachedBytes;
+constexpr int64_t RecyclingMemoryPool::kDefaultMaxRecycledSize;
+
+class RecyclingMemoryPool::RecyclingMemoryPoolImpl {
+ public:
+  RecyclingMemoryPoolImpl(MemoryPool* pool, int64_t max_cached_bytes,
+                          int64_t max_recycled_size)
+      : pool_(pool),
+        max_cached_bytes_(max_cached_bytes),
+        max_recycled_size_(max_recycled_size),
+        num_size_classes_(max_recycled_size > 0 ? SizeClassIndex(max_recycled_size) + 1
+                                                : 0),
+        id_(next_recycling_pool_id.fetch_add(1)) {}
+
+  ~RecyclingMemoryPoolImpl() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& cache : caches_) {
+      std::lock_guard<std::mutex> cache_lock(cache->mutex);
+      if (!cache->thread_exited.load()) {
+        cache->Drain();
+      }
+      cache->pool.store(nullptr);
+    }
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (!IsRecycled(size)) {
+      RETURN_NOT_OK(pool_->Allocate(size, out));
+      stats_.UpdateAllocatedBytes(size);
+      return Status::OK();
+    }
+    const int index = SizeClassIndex(size);
+    RecyclingCache* cache = GetThreadCache();
+    {
+      std::lock_guard<std::mutex> lock(cache->mutex);
+      auto& free_list = cache->free_lists[index];
+      if (!free_list.empty()) {
+        *out = free_list.back();
+        free_list.pop_back();
+        cache->cached_bytes -= SizeClassSize(index);
+        stats_.UpdateAllocatedBytes(size);
+        return Status::OK();
+      }
+    }
+    RETURN_NOT_OK(pool_->Allocate(SizeClassSize(index), out));
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (!IsRecycled(old_size) && !IsRecycled(new_size)) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    if (IsRecycled(old_size) && IsRecycled(new_size) &&
+        SizeClassIndex(old_size) == SizeClassIndex(new_size)) {
+      // The buffer is large enough already
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    uint8_t* new_ptr;
+    RETURN_NOT_OK(Allocate(new_size, &new_ptr));
+    std::memcpy(new_ptr, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size);
+    *ptr = new_ptr;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    stats_.UpdateAllocatedBytes(-size);
+    if (!IsRecycled(size)) {
+      pool_->Free(buffer, size);
+      return;
+    }
+    const int index = SizeClassIndex(size);
+    const int64_t class_size = SizeClassSize(index);
+    RecyclingCache* cache = GetThreadCache();
+    {
+      std::lock_guard<std::mutex> lock(cache->mutex);
+      if (cache->cached_bytes + class_size <= max_cached_bytes_) {
+        cache->free_lists[index].push_back(buffer);
+        cache->cached_bytes += class_size;
+        return;
+      }
+    }
+    pool_->Free(buffer, class_size);
+  }
+
+  void ReleaseUnused() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto& cache : caches_) {
+        std::lock_guard<std::mutex> cache_lock(cache->mutex);
+        cache->Drain();
+      }
+    }
+    pool_->ReleaseUnused();
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+ private:
+  bool IsRecycled(int64_t size) const { return size > 0 && size <= max_recycled_size_; }
+
+  RecyclingCache* GetThreadCache() {
+    auto& entries = thread_recycling_caches.entries;
+    for (const auto& entry : entries) {
+      if (entry.first == id_) {
+        return entry.second.get();
+      }
+    }
+    // Forget the caches of destroyed pools
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                 [](const ThreadRecyclingCaches::Entry& entry) {
+                                   return entry.second->pool.load() == nullptr;
+                                 }),
+                  entries.end());
+    auto cache = std::make_shared<RecyclingCache>(pool_, num_size_classes_);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // Forget the caches of exited threads
+      caches_.erase(std::remove_if(caches_.begin(), caches_.end(),
+                                   [](const std::shared_ptr<RecyclingCache>& cache) {
+                                     return cache->thread_exited.load();
+                                   }),
+                    caches_.end());
+      caches_.push_back(cache);
+    }
+    entries.emplace_back(id_, cache);
+    return cache.get();
+  }
+
+  MemoryPool* pool_;
+  const int64_t max_cached_bytes_;
+  const int64_t max_recycled_size_;
+  const int num_size_classes_;
+  const uint64_t id_;
+  internal::MemoryPoolStats stats_;
+
+  std::mutex mutex_;
+  // The caches of all threads which used this pool
+  std::vector<std::shared_ptr<RecyclingCache>> caches_;
+};
+
+RecyclingMemoryPool::RecyclingMemoryPool(MemoryPool* pool, int64_t max_cached_bytes,
+                                         int64_t max_recycled_size)
+    : impl_(new RecyclingMemoryPoolImpl(pool, max_cached_bytes, max_recycled_size)) {}
+
+RecyclingMemoryPool::~RecyclingMemoryPool() {}
+
+Status RecyclingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status RecyclingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void RecyclingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+void RecyclingMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
+int64_t RecyclingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t RecyclingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string RecyclingMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+///////////////////////////////////////////////////////////////////////
+// HugePageMemoryPool implementation
+
+constexpr int64_t HugePageMemoryPool::kHugePageSize;
+
+HugePageMemoryPool::HugePageMemoryPool(MemoryPool* pool, HugePageMode mode,
+                                       int64_t min_size)
+    : pool_(pool), mode_(mode), min_size_(std::max<int64_t>(min_size, 1)) {}
+
+bool HugePageMemoryPool::IsHuge(int64_t size) const {
+#ifdef __linux__
+  return size >= min_size_;
+#else
+  return false;
+#endif
+}
+
+Status HugePageMemoryPool::MapHuge(int64_t size, uint8_t** out) {
+#ifdef __linux__
+  if (size > std::numeric_limits<int64_t>::max() - 2 * kHugePageSize) {
+    return Status::OutOfMemory("malloc size overflows size_t");
+  }
+  const int64_t mapped_size = bit_util::RoundUp(size, kHugePageSize);
+  void* addr = MAP_FAILED;
+  if (mode_ == HugePageMode::HUGETLB) {
+    addr = mmap(nullptr, static_cast<size_t>(mapped_size), PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_HUGE_2MB, -1, 0);
+    if (addr == MAP_FAILED) {
+      num_hugetlb_fallbacks_.fetch_add(1);
+    }
+  }
+  if (addr == MAP_FAILED) {
+    // Over-map by a huge page to align the mapping on a huge page boundary,
+    // as transparent huge pages only back aligned ranges
+    const int64_t padded_size = mapped_size + kHugePageSize;
+    void* padded = mmap(nullptr, static_cast<size_t>(padded_size),
+                        PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (padded == MAP_FAILED) {
+      return Status::OutOfMemory("mmap of size ", mapped_size, " failed");
+    }
+    const auto start = reinterpret_cast<uintptr_t>(padded);
+    const uintptr_t aligned = (start + kHugePageSize - 1) & ~(kHugePageSize - 1);
+    if (aligned > start) {
+      munmap(padded, aligned - start);
+    }
+    const uintptr_t end = aligned + static_cast<uintptr_t>(mapped_size);
+    const uintptr_t padded_end = start + static_cast<uintptr_t>(padded_size);
+    if (padded_end > end) {
+      munmap(reinterpret_cast<void*>(end), padded_end - end);
+    }
+    addr = reinterpret_cast<void*>(aligned);
+    // Not fatal: the kernel may have THP disabled
+    madvise(addr, static_cast<size_t>(mapped_size), MADV_HUGEPAGE);
+  }
+  *out = reinterpret_cast<uint8_t*>(addr);
+  huge_page_bytes_allocated_.fetch_add(mapped_size);
+  num_huge_page_allocations_.fetch_add(1);
+  return Status::OK();
+#else
+  return Status::NotImplemented("Huge pages are not supported on this platform");
+#endif
+}
+
+void HugePageMemoryPool::UnmapHuge(uint8_t* buffer, int64_t size) {
+#ifdef __linux__
+  const int64_t mapped_size = bit_util::RoundUp(size, kHugePageSize);
+  if (munmap(buffer, static_cast<size_t>(mapped_size)) != 0) {
+    ARROW_LOG(WARNING) << "munmap of huge page allocation failed: "
+                       << internal::ErrnoMessage(errno);
+  }
+  huge_page_bytes_allocated_.fetch_sub(mapped_size);
+#endif
+}
+
+Status HugePageMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  if (IsHuge(size)) {
+    RETURN_NOT_OK(MapHuge(size, out));
+  } else {
+    RETURN_NOT_OK(pool_->Allocate(size, out));
+  }
+  stats_.UpdateAllocatedBytes(size);
+  return Status::OK();
+}
+
+Status HugePageMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  if (!IsHuge(old_size) && !IsHuge(new_size)) {
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+  if (IsHuge(old_size) && IsHuge(new_size) &&
+      bit_util::RoundUp(old_size, kHugePageSize) ==
+          bit_util::RoundUp(new_size, kHugePageSize)) {
+    // Still fits in the mapped huge pages
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+  // Not using mremap(), which keeps neither the alignment nor hugetlb backing
+  uint8_t* new_ptr;
+  RETURN_NOT_OK(Allocate(new_size, &new_ptr));
+  std::memcpy(new_ptr, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+  Free(*ptr, old_size);
+  *ptr = new_ptr;
+  return Status::OK();
+}
+
+void HugePageMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  if (IsHuge(size)) {
+    UnmapHuge(buffer, size);
+  } else {
+    pool_->Free(buffer, size);
+  }
+  stats_.UpdateAllocatedBytes(-size);
+}
+
+int64_t HugePageMemoryPool::bytes_allocated() const { return stats_.bytes_allocated(); }
+
+int64_t HugePageMemoryPool::max_memory() const { return stats_.max_memory(); }
+
+std::string HugePageMemoryPool::backend_name() const { return pool_->backend_name(); }
+
+// -----------------------------------------------------------------------
+// ProfilingMemoryPool implementation
+
+namespace {
+
+thread_local const char* current_memory_tag = nullptr;
+
+}  // namespace
+
+MemoryTagScope::MemoryTagScope(const char* tag) : previous_(current_memory_tag) {
+  current_memory_tag = tag;
+}
+
+MemoryTagScope::~MemoryTagScope() { current_memory_tag = previous_; }
+
+const char* MemoryTagScope::current() { return current_memory_tag; }
+
+constexpr int64_t ProfilingMemoryPool::kDefaultSamplePeriod;
+
+class ProfilingMemoryPool::ProfilingMemoryPoolImpl {
+ public:
+  ProfilingMemoryPoolImpl(MemoryPool* pool, int64_t sample_period)
+      : pool_(pool), sample_period_(sample_period) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(pool_->Allocate(size, out));
+    stats_.UpdateAllocatedBytes(size);
+    MaybeSample(*out, size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    uint8_t* old_ptr = *ptr;
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    // Account for the reallocated buffer as a new allocation, attributed to the
+    // current tag
+    Untrack(old_ptr);
+    MaybeSample(*ptr, new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    Untrack(buffer);
+    pool_->Free(buffer, size);
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  void ReleaseUnused() { pool_->ReleaseUnused(); }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  std::vector<MemoryProfileEntry> GetProfile() const {
+    std::vector<MemoryProfileEntry> profile;
+    {
+      std::lock_guard<std::mutex> lock(tags_mutex_);
+      for (const auto& pair : tags_) {
+        const TagProfile& tag = pair.second;
+        profile.push_back({pair.first, tag.live_bytes.load(), tag.total_bytes.load(),
+                           tag.num_live_samples.load()});
+      }
+    }
+    std::stable_sort(profile.begin(), profile.end(),
+                     [](const MemoryProfileEntry& a, const MemoryProfileEntry& b) {
+                       return a.live_bytes > b.live_bytes;
+                     });
+    return profile;
+  }
+
+ private:
+  struct TagProfile {
+    std::atomic<int64_t> live_bytes{0};
+    std::atomic<int64_t> total_bytes{0};
+    std::atomic<int64_t> num_live_samples{0};
+  };
+
+  struct Sample {
+    TagProfile* tag;
+    int64_t weight;
+  };
+
+  // The sampled allocations, sharded by address to limit contention on Free
+  struct SampleShard {
+    std::mutex mutex;
+    std::unordered_map<uint8_t*, Sample> samples;
+  };
+
+  static constexpr int kNumShards = 16;
+
+  SampleShard& ShardFor(uint8_t* ptr) {
+    // Skip the bits made constant by alignment
+    return shards_[(reinterpret_cast<uintptr_t>(ptr) >> 6) % kNumShards];
+  }
+
+  // Return the number of bytes the allocation stands for if it is to be sampled,
+  // 0 otherwise
+  int64_t SampleWeight(int64_t size) {
+    if (sample_period_ <= 0) {
+      return size;
+    }
+    if (bytes_since_sample_.fetch_add(size) + size < sample_period_) {
+      return 0;
+    }
+    // Another thread may have taken the sample concurrently
+    return std::max(bytes_since_sample_.exchange(0), size);
+  }
+
+  TagProfile* GetTag() {
+    const char* tag = MemoryTagScope::current();
+    std::lock_guard<std::mutex> lock(tags_mutex_);
+    // std::map nodes are stable, so that the samples can keep pointers to them
+    return &tags_[tag != nullptr ? tag : ""];
+  }
+
+  void MaybeSample(uint8_t* ptr, int64_t size) {
+    const int64_t weight = SampleWeight(size);
+    if (weight == 0 || ptr == nullptr) {
+      return;
+    }
+    TagProfile* tag = GetTag();
+    tag->live_bytes += weight;
+    tag->total_bytes += weight;
+    ++tag->num_live_samples;
+    SampleShard& shard = ShardFor(ptr);
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.samples[ptr] = {tag, weight};
+    }
+    ++num_live_samples_;
+  }
+
+  void Untrack(uint8_t* ptr) {
+    if (num_live_samples_.load(std::memory_order_relaxed) == 0) {
+      return;
+    }
+    Sample sample{nullptr, 0};
+    SampleShard& shard = ShardFor(ptr);
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      auto it = shard.samples.find(ptr);
+      if (it == shard.samples.end()) {
+        return;
+      }
+      sample = it->second;
+      shard.samples.erase(it);
+    }
+    --num_live_samples_;
+    sample.tag->live_bytes -= sample.weight;
+    --sample.tag->num_live_samples;
+  }
+
+  MemoryPool* pool_;
+  const int64_t sample_period_;
+  internal::MemoryPoolStats stats_;
+  std::atomic<int64_t> bytes_since_sample_{0};
+  std::atomic<int64_t> num_live_samples_{0};
+  SampleShard shards_[kNumShards];
+
+  mutable std::mutex tags_mutex_;
+  std::map<std::string, TagProfile> tags_;
+};
+
+constexpr int ProfilingMemoryPool::ProfilingMemoryPoolImpl::kNumShards;
+
+ProfilingMemoryPool::ProfilingMemoryPool(MemoryPool* pool, int64_t sample_period)
+    : impl_(new ProfilingMemoryPoolImpl(pool, sample_period)) {}
+
+ProfilingMemoryPool::~ProfilingMemoryPool() {}
+
+Status ProfilingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ProfilingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ProfilingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+void ProfilingMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
+int64_t ProfilingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ProfilingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string ProfilingMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+std::vector<MemoryProfileEntry> ProfilingMemoryPool::GetProfile() const {
+  return impl_->GetProfile();
+}
+
 std::vector<std::string> SupportedMemoryBackendNames() {
   std::vector<std::string> supported;
   for (const auto backend : SupportedBackends()) {
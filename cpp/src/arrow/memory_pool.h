@@ -19,8 +19,10 @@
 
 #include <atomic>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
@@ -156,6 +158,288 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief A MemoryPool placing large allocations on the allocating thread's NUMA node
+///
+/// Allocation is delegated to another pool.  The memory pages of allocations of at
+/// least `min_bind_size` bytes are then bound to the NUMA node of the CPU the
+/// allocating thread runs on, so that they are backed by node-local memory even if
+/// first touched from another node.  Pages the delegate pool recycles from an earlier
+/// allocation keep their placement.
+///
+/// Together with a WorkStealingThreadPool whose workers are pinned to NUMA nodes this
+/// keeps the buffers a worker produces local to it.  Where binding is not supported
+/// (i.e. outside of Linux) this pool merely forwards to its delegate.
+class ARROW_EXPORT NumaLocalMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultMinBindSize = 1 << 20;
+
+  explicit NumaLocalMemoryPool(MemoryPool* pool,
+                               int64_t min_bind_size = kDefaultMinBindSize);
+  ~NumaLocalMemoryPool() override = default;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+ private:
+  void BindToCurrentNode(uint8_t* buffer, int64_t size);
+
+  MemoryPool* pool_;
+  const int64_t min_bind_size_;
+  std::atomic<bool> bind_supported_{true};
+};
+
+/// \brief A MemoryPool accounting for, and bounding, the memory allocated through it
+///
+/// Allocation is delegated to another pool.  The delegate may itself be a
+/// LimitedMemoryPool, so that pools form a tree (e.g. process, tenant, query,
+/// operator): an allocation is then accounted to a pool and all its ancestors, and
+/// fails with Status::OutOfMemory, leaving every level unchanged, if it would make
+/// any of them exceed its limit.
+///
+/// bytes_allocated() and max_memory() report the current and peak usage of this
+/// pool alone, i.e. of its subtree.  To spill before reaching the hard limit, make a
+/// compute::MemoryGovernor with a lower soft limit allocate from this pool.
+class ARROW_EXPORT LimitedMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kNoLimit = std::numeric_limits<int64_t>::max();
+
+  explicit LimitedMemoryPool(MemoryPool* pool, int64_t limit = kNoLimit,
+                             std::string name = "");
+  ~LimitedMemoryPool() override = default;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// \brief The pool allocations are delegated to
+  MemoryPool* parent() const { return pool_; }
+
+  const std::string& name() const { return name_; }
+
+  /// \brief The maximum number of bytes allocated through this pool at any time
+  int64_t limit() const { return limit_.load(); }
+
+  /// \brief Change the limit
+  ///
+  /// Lowering the limit below the current usage does not release anything, but
+  /// fails all growing allocations until enough memory has been freed.
+  void set_limit(int64_t limit) { limit_.store(limit); }
+
+  /// \brief The number of bytes which can still be allocated before reaching the limit
+  ///
+  /// This disregards the limits of the ancestors.
+  int64_t bytes_available() const;
+
+ private:
+  Status Reserve(int64_t size);
+  void UpdatePeak();
+  void Release(int64_t size) { bytes_allocated_.fetch_sub(size); }
+
+  MemoryPool* pool_;
+  const std::string name_;
+  std::atomic<int64_t> limit_;
+  std::atomic<int64_t> bytes_allocated_{0};
+  std::atomic<int64_t> max_memory_{0};
+};
+
+/// \brief A MemoryPool recycling freed buffers through thread-local free lists
+///
+/// Allocation is delegated to another pool.  Sizes up to `max_recycled_size` are
+/// rounded up to a size class (4 classes per power of two, i.e. at most 25%
+/// overhead), and freed buffers of such sizes are kept in free lists local to the
+/// freeing thread, from which later allocations of the same size class are served.
+/// This keeps pipelines which repeatedly allocate and free same-sized buffers
+/// (e.g. those of successive ExecBatches) away from the delegate allocator.
+///
+/// Each thread caches at most `max_cached_bytes`; the buffers freed beyond that are
+/// returned to the delegate.  ReleaseUnused() returns the cached buffers of all
+/// threads, as does destroying the pool or exiting a thread for its own buffers.
+///
+/// bytes_allocated() and max_memory() only count buffers in use, not cached ones.
+class ARROW_EXPORT RecyclingMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultMaxCachedBytes = 16 << 20;
+  static constexpr int64_t kDefaultMaxRecycledSize = 1 << 20;
+
+  explicit RecyclingMemoryPool(MemoryPool* pool,
+                               int64_t max_cached_bytes = kDefaultMaxCachedBytes,
+                               int64_t max_recycled_size = kDefaultMaxRecycledSize);
+  ~RecyclingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  void ReleaseUnused() override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+ private:
+  class RecyclingMemoryPoolImpl;
+  std::unique_ptr<RecyclingMemoryPoolImpl> impl_;
+};
+
+enum class HugePageMode : int8_t {
+  /// Map large allocations anonymously and advise the kernel to back them with
+  /// transparent huge pages (madvise(MADV_HUGEPAGE))
+  MADVISE,
+  /// Map large allocations from the reserved 2 MiB hugetlbfs pages (MAP_HUGETLB),
+  /// falling back to MADVISE when none are available
+  HUGETLB,
+};
+
+/// \brief A MemoryPool serving large allocations from huge pages
+///
+/// Allocations of at least `min_size` bytes are rounded up to a multiple of 2 MiB
+/// and mapped directly, aligned on a 2 MiB boundary, so that large hash tables and
+/// sort buffers take fewer TLB misses.  Smaller allocations are delegated to
+/// another pool.  Where huge pages are not supported (i.e. outside of Linux) this
+/// pool merely forwards to its delegate.
+///
+/// The default memory pool can be wrapped in such a pool by setting the
+/// ARROW_MEMORY_POOL_HUGE_PAGES environment variable to "madvise" or "hugetlb".
+class ARROW_EXPORT HugePageMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kHugePageSize = 2 << 20;
+
+  explicit HugePageMemoryPool(MemoryPool* pool,
+                              HugePageMode mode = HugePageMode::MADVISE,
+                              int64_t min_size = kHugePageSize);
+  ~HugePageMemoryPool() override = default;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  void ReleaseUnused() override { pool_->ReleaseUnused(); }
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  HugePageMode mode() const { return mode_; }
+
+  /// \brief The number of bytes currently mapped for large allocations
+  ///
+  /// This includes the rounding up to whole huge pages.
+  int64_t huge_page_bytes_allocated() const { return huge_page_bytes_allocated_.load(); }
+
+  /// \brief The total number of large allocations mapped
+  int64_t num_huge_page_allocations() const { return num_huge_page_allocations_.load(); }
+
+  /// \brief The number of large allocations HUGETLB mode had to map without
+  /// reserved huge pages
+  int64_t num_hugetlb_fallbacks() const { return num_hugetlb_fallbacks_.load(); }
+
+ private:
+  bool IsHuge(int64_t size) const;
+  Status MapHuge(int64_t size, uint8_t** out);
+  void UnmapHuge(uint8_t* buffer, int64_t size);
+
+  MemoryPool* pool_;
+  const HugePageMode mode_;
+  const int64_t min_size_;
+  internal::MemoryPoolStats stats_;
+  std::atomic<int64_t> huge_page_bytes_allocated_{0};
+  std::atomic<int64_t> num_huge_page_allocations_{0};
+  std::atomic<int64_t> num_hugetlb_fallbacks_{0};
+};
+
+/// \brief Attribute the allocations of the calling thread to a tag
+///
+/// While the scope is alive, the allocations a ProfilingMemoryPool samples on the
+/// calling thread are attributed to `tag` (e.g. "hash_join.build").  Scopes nest,
+/// the innermost one wins.  `tag` must outlive the scope; a string literal is
+/// typical.
+class ARROW_EXPORT MemoryTagScope {
+ public:
+  explicit MemoryTagScope(const char* tag);
+  ~MemoryTagScope();
+
+  /// \brief The tag of the innermost scope on the calling thread, or nullptr
+  static const char* current();
+
+ private:
+  const char* previous_;
+
+  MemoryTagScope(const MemoryTagScope&) = delete;
+  MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+};
+
+/// \brief The memory attributed to a tag by a ProfilingMemoryPool
+///
+/// Byte counts are estimates extrapolated from the sampled allocations.
+struct ARROW_EXPORT MemoryProfileEntry {
+  /// The allocation tag, empty for allocations made outside of any MemoryTagScope
+  std::string tag;
+  /// The bytes allocated and not freed yet
+  int64_t live_bytes;
+  /// The bytes allocated so far, including those freed since
+  int64_t total_bytes;
+  /// The number of sampled allocations not freed yet
+  int64_t num_live_samples;
+};
+
+/// \brief A MemoryPool attributing a sample of its allocations to tags
+///
+/// Allocation is delegated to another pool.  One allocation is sampled about every
+/// `sample_period` bytes allocated, and stands for all the bytes allocated since the
+/// previous sample; it is attributed to the MemoryTagScope current on the allocating
+/// thread and tracked until it is freed.  GetProfile() then tells which operators
+/// hold the memory of a running query, at a cost low enough for production use,
+/// unlike LoggingMemoryPool.  A `sample_period` of 0 samples every allocation.
+class ARROW_EXPORT ProfilingMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultSamplePeriod = 512 << 10;
+
+  explicit ProfilingMemoryPool(MemoryPool* pool,
+                               int64_t sample_period = kDefaultSamplePeriod);
+  ~ProfilingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  void ReleaseUnused() override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// \brief The memory attributed to each tag, by decreasing live bytes
+  std::vector<MemoryProfileEntry> GetProfile() const;
+
+ private:
+  class ProfilingMemoryPoolImpl;
+  std::unique_ptr<ProfilingMemoryPoolImpl> impl_;
+};
+
 /// \brief Return a process-wide memory pool based on the system allocator.
 ARROW_EXPORT MemoryPool* system_memory_pool();
 
@@ -15,6 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstdint>
+#include <vector>
+
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/util/logging.h"
@@ -47,6 +50,15 @@ struct Mimalloc {
 };
 #endif
 
+template <typename Alloc>
+struct Recycling {
+  static Result<MemoryPool*> GetAllocator() {
+    ARROW_ASSIGN_OR_RAISE(MemoryPool * backend, Alloc::GetAllocator());
+    static RecyclingMemoryPool pool(backend);
+    return &pool;
+  }
+};
+
 static void TouchCacheLines(uint8_t* data, int64_t nbytes) {
   uint8_t total = 0;
   while (nbytes > 0) {
@@ -105,6 +117,28 @@ static void AllocateTouchDeallocate(
   }
 }
 
+// Benchmark the allocations of an ExecBatch-like sequence of arrays: a validity
+// bitmap, offsets and data per column, all freed once the batch is consumed.
+template <typename Alloc>
+static void AllocateDeallocateBatch(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t num_rows = state.range(0);
+  constexpr int kNumColumns = 4;
+  MemoryPool* pool = *Alloc::GetAllocator();
+  const int64_t sizes[] = {(num_rows + 7) / 8, (num_rows + 1) * 4, num_rows * 8};
+  std::vector<uint8_t*> buffers(kNumColumns * 3);
+
+  for (auto _ : state) {
+    for (int i = 0; i < kNumColumns * 3; ++i) {
+      ARROW_CHECK_OK(pool->Allocate(sizes[i % 3], &buffers[i]));
+    }
+    for (int i = 0; i < kNumColumns * 3; ++i) {
+      pool->Free(buffers[i], sizes[i % 3]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kNumColumns * 3);
+}
+
 #define BENCHMARK_ALLOCATE_ARGS \
   ->RangeMultiplier(16)->Range(4096, 16 * 1024 * 1024)->ArgName("size")->UseRealTime()
 
@@ -113,17 +147,34 @@ static void AllocateTouchDeallocate(
 
 BENCHMARK(TouchArea) BENCHMARK_ALLOCATE_ARGS;
 
+#define BENCHMARK_BATCH(template_param)                                       \
+  BENCHMARK_TEMPLATE(AllocateDeallocateBatch, template_param)                 \
+      ->RangeMultiplier(8)                                                    \
+      ->Range(64, 32 * 1024)                                                  \
+      ->ArgName("rows")                                                       \
+      ->UseRealTime()
+
 BENCHMARK_ALLOCATE(AllocateDeallocate, SystemAlloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, SystemAlloc);
+BENCHMARK_BATCH(SystemAlloc);
+BENCHMARK_ALLOCATE(AllocateDeallocate, Recycling<SystemAlloc>);
+BENCHMARK_ALLOCATE(AllocateTouchDeallocate, Recycling<SystemAlloc>);
+BENCHMARK_BATCH(Recycling<SystemAlloc>);
 
 #ifdef ARROW_JEMALLOC
 BENCHMARK_ALLOCATE(AllocateDeallocate, Jemalloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, Jemalloc);
+BENCHMARK_BATCH(Jemalloc);
+BENCHMARK_ALLOCATE(AllocateDeallocate, Recycling<Jemalloc>);
+BENCHMARK_BATCH(Recycling<Jemalloc>);
 #endif
 
 #ifdef ARROW_MIMALLOC
 BENCHMARK_ALLOCATE(AllocateDeallocate, Mimalloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, Mimalloc);
+BENCHMARK_BATCH(Mimalloc);
+BENCHMARK_ALLOCATE(AllocateDeallocate, Recycling<Mimalloc>);
+BENCHMARK_BATCH(Recycling<Mimalloc>);
 #endif
 
 }  // namespace arrow
@@ -17,6 +17,9 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -56,6 +59,20 @@ struct MimallocMemoryPoolFactory {
 };
 #endif
 
+struct RecyclingMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static RecyclingMemoryPool pool(default_memory_pool());
+    return &pool;
+  }
+};
+
+struct ProfilingMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static ProfilingMemoryPool pool(default_memory_pool(), /*sample_period=*/0);
+    return &pool;
+  }
+};
+
 template <typename Factory>
 class TestMemoryPool : public ::arrow::TestMemoryPoolBase {
  public:
@@ -78,6 +95,8 @@ REGISTER_TYPED_TEST_SUITE_P(TestMemoryPool, MemoryTracking, OOM, Reallocate);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(Default, TestMemoryPool, DefaultMemoryPoolFactory);
 INSTANTIATE_TYPED_TEST_SUITE_P(System, TestMemoryPool, SystemMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(Recycling, TestMemoryPool, RecyclingMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(Profiling, TestMemoryPool, ProfilingMemoryPoolFactory);
 
 #ifdef ARROW_JEMALLOC
 INSTANTIATE_TYPED_TEST_SUITE_P(Jemalloc, TestMemoryPool, JemallocMemoryPoolFactory);
@@ -163,6 +182,294 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pp.bytes_allocated());
 }
 
+TEST(NumaLocalMemoryPool, Basics) {
+  auto pool = MemoryPool::CreateDefault();
+
+  // Small allocations are not bound, large ones are if the platform allows it
+  NumaLocalMemoryPool np(pool.get(), /*min_bind_size=*/4096);
+
+  uint8_t* data;
+  ASSERT_OK(np.Allocate(100, &data));
+  uint8_t* data2;
+  ASSERT_OK(np.Allocate(1 << 20, &data2));
+  std::memset(data2, 0xff, 1 << 20);
+  ASSERT_EQ(100 + (1 << 20), np.bytes_allocated());
+
+  ASSERT_OK(np.Reallocate(1 << 20, 2 << 20, &data2));
+  ASSERT_EQ(0xff, data2[(1 << 20) - 1]);
+  ASSERT_EQ(100 + (2 << 20), pool->bytes_allocated());
+  ASSERT_EQ(pool->backend_name(), np.backend_name());
+
+  np.Free(data, 100);
+  np.Free(data2, 2 << 20);
+  ASSERT_EQ(0, np.bytes_allocated());
+}
+
+TEST(LimitedMemoryPool, Basics) {
+  auto pool = MemoryPool::CreateDefault();
+  LimitedMemoryPool lp(pool.get(), /*limit=*/1000, "query");
+  ASSERT_EQ(1000, lp.limit());
+  ASSERT_EQ("query", lp.name());
+  ASSERT_EQ(pool.get(), lp.parent());
+  ASSERT_EQ(pool->backend_name(), lp.backend_name());
+
+  uint8_t* data;
+  ASSERT_OK(lp.Allocate(600, &data));
+  uint8_t* data2;
+  ASSERT_RAISES(OutOfMemory, lp.Allocate(500, &data2));
+  ASSERT_EQ(600, lp.bytes_allocated());
+  ASSERT_EQ(400, lp.bytes_available());
+  ASSERT_OK(lp.Allocate(400, &data2));
+  ASSERT_EQ(0, lp.bytes_available());
+
+  ASSERT_RAISES(OutOfMemory, lp.Reallocate(400, 401, &data2));
+  ASSERT_OK(lp.Reallocate(400, 100, &data2));
+  ASSERT_EQ(700, lp.bytes_allocated());
+  ASSERT_EQ(1000, lp.max_memory());
+
+  lp.Free(data, 600);
+  lp.Free(data2, 100);
+  ASSERT_EQ(0, lp.bytes_allocated());
+  ASSERT_EQ(0, pool->bytes_allocated());
+  ASSERT_EQ(1000, lp.max_memory());
+
+  // Lowering the limit affects later allocations only
+  ASSERT_OK(lp.Allocate(500, &data));
+  lp.set_limit(200);
+  ASSERT_EQ(0, lp.bytes_available());
+  ASSERT_RAISES(OutOfMemory, lp.Reallocate(500, 600, &data));
+  ASSERT_OK(lp.Reallocate(500, 100, &data));
+  ASSERT_OK(lp.Allocate(100, &data2));
+  lp.Free(data, 100);
+  lp.Free(data2, 100);
+}
+
+TEST(LimitedMemoryPool, Hierarchy) {
+  auto pool = MemoryPool::CreateDefault();
+  LimitedMemoryPool tenant(pool.get(), /*limit=*/1000, "tenant");
+  LimitedMemoryPool query1(&tenant, /*limit=*/800, "query1");
+  LimitedMemoryPool query2(&tenant);
+
+  uint8_t* data1;
+  ASSERT_OK(query1.Allocate(700, &data1));
+  uint8_t* data2;
+  // Within query2's (absent) limit, but over the tenant's
+  ASSERT_RAISES(OutOfMemory, query2.Allocate(400, &data2));
+  ASSERT_EQ(0, query2.bytes_allocated());
+  ASSERT_EQ(700, tenant.bytes_allocated());
+  ASSERT_OK(query2.Allocate(300, &data2));
+  ASSERT_EQ(1000, tenant.bytes_allocated());
+
+  // Within the tenant's limit after freeing, but over query1's
+  query2.Free(data2, 300);
+  ASSERT_RAISES(OutOfMemory, query1.Reallocate(700, 900, &data1));
+  ASSERT_EQ(700, query1.bytes_allocated());
+  ASSERT_EQ(700, tenant.bytes_allocated());
+
+  query1.Free(data1, 700);
+  ASSERT_EQ(0, tenant.bytes_allocated());
+  ASSERT_EQ(0, pool->bytes_allocated());
+  ASSERT_EQ(700, query1.max_memory());
+  ASSERT_EQ(300, query2.max_memory());
+  ASSERT_EQ(1000, tenant.max_memory());
+}
+
+TEST(RecyclingMemoryPool, Recycle) {
+  auto pool = MemoryPool::CreateDefault();
+  RecyclingMemoryPool rp(pool.get(), /*max_cached_bytes=*/4096,
+                         /*max_recycled_size=*/2048);
+  ASSERT_EQ(pool->backend_name(), rp.backend_name());
+
+  // Rounded up to the size class of 1024 bytes
+  uint8_t* data;
+  ASSERT_OK(rp.Allocate(1000, &data));
+  ASSERT_EQ(1000, rp.bytes_allocated());
+  ASSERT_EQ(1024, pool->bytes_allocated());
+  data[1023] = 42;
+  ASSERT_OK(rp.Reallocate(1000, 1024, &data));
+  ASSERT_EQ(42, data[1023]);
+  rp.Free(data, 1024);
+  ASSERT_EQ(0, rp.bytes_allocated());
+  ASSERT_EQ(1024, pool->bytes_allocated());
+
+  // Served from the cache
+  uint8_t* data2;
+  ASSERT_OK(rp.Allocate(900, &data2));
+  ASSERT_EQ(data, data2);
+  ASSERT_EQ(1024, pool->bytes_allocated());
+
+  // Moved to another size class, and beyond the recycled sizes
+  data2[899] = 43;
+  ASSERT_OK(rp.Reallocate(900, 1500, &data2));
+  ASSERT_EQ(43, data2[899]);
+  ASSERT_OK(rp.Reallocate(1500, 10000, &data2));
+  ASSERT_EQ(43, data2[899]);
+  ASSERT_EQ(10000, rp.bytes_allocated());
+  // Both buffers were in use while copying
+  ASSERT_EQ(11500, rp.max_memory());
+  rp.Free(data2, 10000);
+  ASSERT_EQ(1024 + 1536, pool->bytes_allocated());
+
+  rp.ReleaseUnused();
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(RecyclingMemoryPool, MaxCachedBytes) {
+  auto pool = MemoryPool::CreateDefault();
+  RecyclingMemoryPool rp(pool.get(), /*max_cached_bytes=*/2048);
+
+  std::vector<uint8_t*> buffers(4);
+  for (auto& buffer : buffers) {
+    ASSERT_OK(rp.Allocate(1024, &buffer));
+  }
+  for (auto buffer : buffers) {
+    rp.Free(buffer, 1024);
+  }
+  ASSERT_EQ(0, rp.bytes_allocated());
+  ASSERT_EQ(2048, pool->bytes_allocated());
+  rp.ReleaseUnused();
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(RecyclingMemoryPool, ThreadExit) {
+  auto pool = MemoryPool::CreateDefault();
+  RecyclingMemoryPool rp(pool.get());
+
+  uint8_t* data;
+  ASSERT_OK(rp.Allocate(100, &data));
+  std::thread([&] {
+    // Cached by this thread, then released on exit
+    rp.Free(data, 100);
+    ASSERT_EQ(112, pool->bytes_allocated());
+  }).join();
+  ASSERT_EQ(0, pool->bytes_allocated());
+
+  {
+    // The cache of this thread is released with the pool
+    RecyclingMemoryPool rp2(pool.get());
+    ASSERT_OK(rp2.Allocate(100, &data));
+    rp2.Free(data, 100);
+    ASSERT_EQ(112, pool->bytes_allocated());
+  }
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(HugePageMemoryPool, Basics) {
+  auto pool = MemoryPool::CreateDefault();
+  const int64_t kHugePageSize = HugePageMemoryPool::kHugePageSize;
+
+  for (auto mode : {HugePageMode::MADVISE, HugePageMode::HUGETLB}) {
+    ARROW_SCOPED_TRACE("mode = ", static_cast<int>(mode));
+    HugePageMemoryPool hp(pool.get(), mode, /*min_size=*/1 << 20);
+    ASSERT_EQ(mode, hp.mode());
+    ASSERT_EQ(pool->backend_name(), hp.backend_name());
+
+    uint8_t* data;
+    ASSERT_OK(hp.Allocate(100, &data));
+    uint8_t* data2;
+    ASSERT_OK(hp.Allocate(3 << 20, &data2));
+    std::memset(data2, 0xff, 3 << 20);
+    ASSERT_EQ(100 + (3 << 20), hp.bytes_allocated());
+#ifdef __linux__
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data2) % kHugePageSize);
+    ASSERT_EQ(100, pool->bytes_allocated());
+    ASSERT_EQ(2 * kHugePageSize, hp.huge_page_bytes_allocated());
+    ASSERT_EQ(1, hp.num_huge_page_allocations());
+#endif
+
+    // Within the mapped huge pages, then beyond them
+    ASSERT_OK(hp.Reallocate(3 << 20, 4 << 20, &data2));
+    ASSERT_OK(hp.Reallocate(4 << 20, 5 << 20, &data2));
+    ASSERT_EQ(0xff, data2[(3 << 20) - 1]);
+#ifdef __linux__
+    ASSERT_EQ(3 * kHugePageSize, hp.huge_page_bytes_allocated());
+    ASSERT_EQ(2, hp.num_huge_page_allocations());
+#endif
+    // Below the threshold
+    ASSERT_OK(hp.Reallocate(5 << 20, 1000, &data2));
+    ASSERT_EQ(0xff, data2[999]);
+    ASSERT_EQ(0, hp.huge_page_bytes_allocated());
+    ASSERT_EQ(1100, pool->bytes_allocated());
+
+    hp.Free(data, 100);
+    hp.Free(data2, 1000);
+    ASSERT_EQ(0, hp.bytes_allocated());
+    ASSERT_EQ(0, pool->bytes_allocated());
+    // Both buffers were in use while copying
+    ASSERT_EQ(100 + (4 << 20) + (5 << 20), hp.max_memory());
+  }
+}
+
+TEST(ProfilingMemoryPool, Tags) {
+  auto pool = MemoryPool::CreateDefault();
+  ProfilingMemoryPool pp(pool.get(), /*sample_period=*/0);
+  ASSERT_EQ(pool->backend_name(), pp.backend_name());
+  ASSERT_EQ(nullptr, MemoryTagScope::current());
+
+  uint8_t *data1, *data2, *data3;
+  ASSERT_OK(pp.Allocate(100, &data1));
+  {
+    MemoryTagScope outer("hash_join.build");
+    ASSERT_OK(pp.Allocate(200, &data2));
+    {
+      MemoryTagScope inner("parquet.decode");
+      ASSERT_STREQ("parquet.decode", MemoryTagScope::current());
+      ASSERT_OK(pp.Allocate(300, &data3));
+    }
+    ASSERT_STREQ("hash_join.build", MemoryTagScope::current());
+    // Attributed to the tag current when reallocating
+    ASSERT_OK(pp.Reallocate(300, 400, &data3));
+  }
+  ASSERT_EQ(nullptr, MemoryTagScope::current());
+  ASSERT_EQ(700, pp.bytes_allocated());
+  ASSERT_EQ(700, pool->bytes_allocated());
+
+  auto profile = pp.GetProfile();
+  ASSERT_EQ(3, profile.size());
+  ASSERT_EQ("hash_join.build", profile[0].tag);
+  ASSERT_EQ(600, profile[0].live_bytes);
+  ASSERT_EQ(600, profile[0].total_bytes);
+  ASSERT_EQ(2, profile[0].num_live_samples);
+  ASSERT_EQ("", profile[1].tag);
+  ASSERT_EQ(100, profile[1].live_bytes);
+  ASSERT_EQ("parquet.decode", profile[2].tag);
+  ASSERT_EQ(0, profile[2].live_bytes);
+  ASSERT_EQ(300, profile[2].total_bytes);
+  ASSERT_EQ(0, profile[2].num_live_samples);
+
+  pp.Free(data1, 100);
+  pp.Free(data2, 200);
+  pp.Free(data3, 400);
+  ASSERT_EQ(0, pp.bytes_allocated());
+  for (const auto& entry : pp.GetProfile()) {
+    ASSERT_EQ(0, entry.live_bytes);
+    ASSERT_EQ(0, entry.num_live_samples);
+  }
+}
+
+TEST(ProfilingMemoryPool, Sampling) {
+  auto pool = MemoryPool::CreateDefault();
+  ProfilingMemoryPool pp(pool.get(), /*sample_period=*/1000);
+  MemoryTagScope scope("test");
+
+  std::vector<uint8_t*> buffers(50);
+  for (auto& data : buffers) {
+    ASSERT_OK(pp.Allocate(100, &data));
+  }
+  // One allocation in ten is sampled, and stands for the nine others
+  auto profile = pp.GetProfile();
+  ASSERT_EQ(1, profile.size());
+  ASSERT_EQ(5000, profile[0].live_bytes);
+  ASSERT_EQ(5, profile[0].num_live_samples);
+
+  for (auto data : buffers) {
+    pp.Free(data, 100);
+  }
+  profile = pp.GetProfile();
+  ASSERT_EQ(0, profile[0].live_bytes);
+  ASSERT_EQ(5000, profile[0].total_bytes);
+}
+
 TEST(Jemalloc, SetDirtyPageDecayMillis) {
   // ARROW-6910
 #ifdef ARROW_JEMALLOC
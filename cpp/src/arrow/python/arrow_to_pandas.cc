@@ -1200,7 +1200,9 @@ struct ObjectWriterVisitor {
                   std::is_same<ExtensionType, Type>::value ||
                   (std::is_base_of<IntervalType, Type>::value &&
                    !std::is_same<MonthDayNanoIntervalType, Type>::value) ||
-                  std::is_base_of<UnionType, Type>::value,
+                  std::is_base_of<UnionType, Type>::value ||
+                  is_binary_view_like_type<Type>::value ||
+                  is_run_end_encoded_type<Type>::value,
               Status>
   Visit(const Type& type) {
     return Status::NotImplemented("No implemented conversion to object dtype: ",
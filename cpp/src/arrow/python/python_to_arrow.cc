@@ -569,7 +569,8 @@ struct PyConverterTrait;
 template <typename T>
 struct PyConverterTrait<
     T, enable_if_t<(!is_nested_type<T>::value && !is_interval_type<T>::value &&
-                    !is_extension_type<T>::value) ||
+                    !is_extension_type<T>::value &&
+                    !is_binary_view_like_type<T>::value) ||
                    std::is_same<T, MonthDayNanoIntervalType>::value>> {
   using type = PyPrimitiveConverter<T>;
 };
@@ -29,10 +29,12 @@
 #include "arrow/pretty_print.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/util/atomic_shared_ptr.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -223,6 +225,11 @@ Result<std::shared_ptr<StructArray>> RecordBatch::ToStructArray() const {
                                        /*offset=*/0);
 }
 
+Result<std::shared_ptr<Tensor>> RecordBatch::ToTensor(bool null_to_nan, bool row_major,
+                                                      MemoryPool* pool) const {
+  return internal::RecordBatchToTensor(*this, null_to_nan, row_major, pool);
+}
+
 const std::string& RecordBatch::column_name(int i) const {
   return schema_->field(i)->name();
 }
@@ -308,10 +315,25 @@ Status ValidateBatch(const RecordBatch& batch, bool full_validation) {
                              " type not match schema: ", array.type()->ToString(), " vs ",
                              schema_type->ToString());
     }
-    const auto st = full_validation ? internal::ValidateArrayFull(array)
-                                    : internal::ValidateArray(array);
-    if (!st.ok()) {
-      return Status::Invalid("In column ", i, ": ", st.ToString());
+  }
+  // Fully validate the columns of large batches in parallel
+  const bool use_threads =
+      full_validation &&
+      internal::ShouldUseCpuThreadPool(batch.num_columns(),
+                                       batch.num_rows() * batch.num_columns(),
+                                       internal::kMinParallelValidationLength);
+  std::vector<Status> statuses(batch.num_columns());
+  // Either way, the first invalid column is reported below
+  ARROW_UNUSED(internal::OptionalParallelFor(
+      use_threads, batch.num_columns(), [&](int i) {
+        const auto& array = *batch.column(i);
+        statuses[i] = full_validation ? internal::ValidateArrayFull(array)
+                                      : internal::ValidateArray(array);
+        return statuses[i];
+      }));
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    if (!statuses[i].ok()) {
+      return Status::Invalid("In column ", i, ": ", statuses[i].ToString());
     }
   }
   return Status::OK();
@@ -78,6 +78,22 @@ class ARROW_EXPORT RecordBatch {
   /// in the resulting struct array.
   Result<std::shared_ptr<StructArray>> ToStructArray() const;
 
+  /// \brief Convert record batch to a 2-D tensor of shape (num_rows, num_columns)
+  ///
+  /// All the columns must be of integer or floating point types; they are converted
+  /// to a common type as in NumPy.  A single column already of that type and without
+  /// nulls is shared without copying.  Large batches are converted in parallel on
+  /// the CPU thread pool.
+  ///
+  /// \param[in] null_to_nan if true, convert the columns to floating point and nulls
+  /// to NaN, otherwise nulls are an error
+  /// \param[in] row_major if true, the tensor is row-major (C order), otherwise
+  /// column-major (Fortran order)
+  /// \param[in] pool the pool for buffer allocations
+  Result<std::shared_ptr<Tensor>> ToTensor(
+      bool null_to_nan = false, bool row_major = true,
+      MemoryPool* pool = default_memory_pool()) const;
+
   /// \brief Construct record batch from struct array
   ///
   /// This constructs a record batch using the child arrays of the given
@@ -109,6 +109,11 @@ struct ScalarHashImpl {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedScalar& s) {
+    AccumulateHashFrom(*s.value);
+    return Status::OK();
+  }
+
   Status Visit(const UnionScalar& s) {
     // type_code is ignored when comparing for equality, so do not hash it either
     AccumulateHashFrom(*s.value);
@@ -221,6 +226,8 @@ struct ScalarValidateImpl {
 
   Status Visit(const LargeStringScalar& s) { return ValidateStringScalar(s); }
 
+  Status Visit(const StringViewScalar& s) { return ValidateStringScalar(s); }
+
   Status Visit(const FixedSizeBinaryScalar& s) {
     RETURN_NOT_OK(ValidateBinaryScalar(s));
     if (s.is_valid) {
@@ -362,6 +369,30 @@ struct ScalarValidateImpl {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedScalar& s) {
+    const auto& ree_type = checked_cast<const RunEndEncodedType&>(*s.type);
+    if (!s.value) {
+      return Status::Invalid(s.type->ToString(), " scalar doesn't have a value");
+    }
+    {
+      const auto st = Validate(*s.value);
+      if (!st.ok()) {
+        return st.WithMessage(s.type->ToString(),
+                              " scalar fails validation for its value: ", st.message());
+      }
+    }
+    if (!s.value->type->Equals(*ree_type.value_type())) {
+      return Status::Invalid(s.type->ToString(), " scalar should have a value of type ",
+                             ree_type.value_type()->ToString(), ", got ",
+                             s.value->type->ToString());
+    }
+    if (s.is_valid != s.value->is_valid) {
+      return Status::Invalid(s.type->ToString(),
+                             " scalar validity does not match the validity of its value");
+    }
+    return Status::OK();
+  }
+
   Status Visit(const UnionScalar& s) {
     RETURN_NOT_OK(ValidateOptionalValue(s));
     const int type_code = s.type_code;  // avoid 8-bit int types for printing
@@ -492,6 +523,12 @@ LargeBinaryScalar::LargeBinaryScalar(std::string s)
 LargeStringScalar::LargeStringScalar(std::string s)
     : LargeStringScalar(Buffer::FromString(std::move(s))) {}
 
+BinaryViewScalar::BinaryViewScalar(std::string s)
+    : BinaryViewScalar(Buffer::FromString(std::move(s))) {}
+
+StringViewScalar::StringViewScalar(std::string s)
+    : StringViewScalar(Buffer::FromString(std::move(s))) {}
+
 FixedSizeBinaryScalar::FixedSizeBinaryScalar(std::shared_ptr<Buffer> value,
                                              std::shared_ptr<DataType> type)
     : BinaryScalar(std::move(value), std::move(type)) {
@@ -629,6 +666,11 @@ std::shared_ptr<DictionaryScalar> DictionaryScalar::Make(std::shared_ptr<Scalar>
                                             std::move(type), is_valid);
 }
 
+RunEndEncodedScalar::RunEndEncodedScalar(const std::shared_ptr<DataType>& type)
+    : RunEndEncodedScalar(
+          MakeNullScalar(checked_cast<const RunEndEncodedType&>(*type).value_type()),
+          type) {}
+
 namespace {
 
 template <typename T>
@@ -699,6 +741,9 @@ std::string Scalar::ToString() const {
     return dict_scalar->value.dictionary->ToString() + "[" +
            dict_scalar->value.index->ToString() + "]";
   }
+  if (type->id() == Type::RUN_END_ENCODED) {
+    return checked_cast<const RunEndEncodedScalar*>(this)->value->ToString();
+  }
   auto maybe_repr = CastTo(utf8());
   if (maybe_repr.ok()) {
     return checked_cast<const StringScalar&>(*maybe_repr.ValueOrDie()).value->ToString();
@@ -720,6 +765,8 @@ struct ScalarParseImpl {
 
   Status Visit(const LargeBinaryType&) { return FinishWithBuffer(); }
 
+  Status Visit(const BinaryViewType&) { return FinishWithBuffer(); }
+
   Status Visit(const FixedSizeBinaryType&) { return FinishWithBuffer(); }
 
   Status Visit(const DictionaryType& t) {
@@ -909,6 +956,18 @@ Status CastImpl(const BinaryScalar& from, StringScalar* to) {
   return Status::OK();
 }
 
+// binary view to string
+Status CastImpl(const BinaryViewScalar& from, StringScalar* to) {
+  to->value = from.value;
+  return Status::OK();
+}
+
+// binary to binary view
+Status CastImpl(const BinaryScalar& from, BinaryViewScalar* to) {
+  to->value = from.value;
+  return Status::OK();
+}
+
 // formattable to string
 template <typename ScalarType, typename T = typename ScalarType::TypeClass,
           typename Formatter = internal::StringFormatter<T>,
@@ -988,6 +1047,7 @@ struct FromTypeVisitor : CastImplVisitor {
 
   Status Visit(const NullType&) { return NotImplemented(); }
   Status Visit(const DictionaryType&) { return NotImplemented(); }
+  Status Visit(const RunEndEncodedType&) { return NotImplemented(); }
   Status Visit(const ExtensionType&) { return NotImplemented(); }
 };
 
@@ -1015,6 +1075,11 @@ struct ToTypeVisitor : CastImplVisitor {
     return Int32Scalar(0).CastTo(dict_type.index_type()).Value(&out.index);
   }
 
+  Status Visit(const RunEndEncodedType& ree_type) {
+    auto& out = checked_cast<RunEndEncodedScalar*>(out_)->value;
+    return from_.CastTo(ree_type.value_type()).Value(&out);
+  }
+
   Status Visit(const ExtensionType&) { return NotImplemented(); }
 };
 
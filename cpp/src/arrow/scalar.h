@@ -308,6 +308,33 @@ struct ARROW_EXPORT LargeStringScalar : public LargeBinaryScalar {
   LargeStringScalar() : LargeStringScalar(large_utf8()) {}
 };
 
+struct ARROW_EXPORT BinaryViewScalar : public BaseBinaryScalar {
+  using BaseBinaryScalar::BaseBinaryScalar;
+  using TypeClass = BinaryViewType;
+
+  BinaryViewScalar(std::shared_ptr<Buffer> value, std::shared_ptr<DataType> type)
+      : BaseBinaryScalar(std::move(value), std::move(type)) {}
+
+  explicit BinaryViewScalar(std::shared_ptr<Buffer> value)
+      : BinaryViewScalar(std::move(value), binary_view()) {}
+
+  explicit BinaryViewScalar(std::string s);
+
+  BinaryViewScalar() : BinaryViewScalar(binary_view()) {}
+};
+
+struct ARROW_EXPORT StringViewScalar : public BinaryViewScalar {
+  using BinaryViewScalar::BinaryViewScalar;
+  using TypeClass = StringViewType;
+
+  explicit StringViewScalar(std::shared_ptr<Buffer> value)
+      : StringViewScalar(std::move(value), utf8_view()) {}
+
+  explicit StringViewScalar(std::string s);
+
+  StringViewScalar() : StringViewScalar(utf8_view()) {}
+};
+
 struct ARROW_EXPORT FixedSizeBinaryScalar : public BinaryScalar {
   using TypeClass = FixedSizeBinaryType;
 
@@ -544,6 +571,33 @@ struct ARROW_EXPORT DictionaryScalar : public internal::PrimitiveScalarBase {
   }
 };
 
+/// \brief A Scalar value for RunEndEncodedType
+///
+/// The value is a scalar of the value type, `is_valid` mirrors its validity.
+struct ARROW_EXPORT RunEndEncodedScalar : public Scalar {
+  using TypeClass = RunEndEncodedType;
+  using ValueType = std::shared_ptr<Scalar>;
+
+  ValueType value;
+
+  RunEndEncodedScalar(std::shared_ptr<Scalar> value, std::shared_ptr<DataType> type)
+      : Scalar(std::move(type), value->is_valid), value(std::move(value)) {}
+
+  /// \brief Constructs a null RunEndEncodedScalar
+  explicit RunEndEncodedScalar(const std::shared_ptr<DataType>& type);
+
+  const std::shared_ptr<DataType>& run_end_type() const {
+    return ree_type().run_end_type();
+  }
+
+  const std::shared_ptr<DataType>& value_type() const { return ree_type().value_type(); }
+
+ private:
+  const RunEndEncodedType& ree_type() const {
+    return internal::checked_cast<const RunEndEncodedType&>(*type);
+  }
+};
+
 /// \brief A Scalar value for ExtensionType
 ///
 /// The value is the underlying storage scalar.
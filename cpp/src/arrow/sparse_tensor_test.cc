@@ -397,6 +397,29 @@ TEST_F(TestSparseCOOTensor, CreationFromNonContiguousTensor) {
   ASSERT_TRUE(si->is_canonical());
 }
 
+TEST_F(TestSparseCOOTensor, CreationFromColumnMajorTensor) {
+  std::vector<int64_t> values(this->dense_values_.size());
+  for (int64_t i = 0; i < 2; ++i) {
+    for (int64_t j = 0; j < 3; ++j) {
+      for (int64_t k = 0; k < 4; ++k) {
+        values[i + 2 * j + 6 * k] = this->dense_values_[12 * i + 4 * j + k];
+      }
+    }
+  }
+  std::vector<int64_t> strides = {8, 16, 48};
+  Tensor tensor(int64(), Buffer::Wrap(values), this->shape_, strides);
+  ASSERT_TRUE(tensor.is_column_major());
+
+  std::shared_ptr<SparseCOOTensor> st;
+  ASSERT_OK_AND_ASSIGN(st, SparseCOOTensor::Make(tensor));
+
+  ASSERT_EQ(12, st->non_zero_length());
+  ASSERT_TRUE(st->Equals(*this->sparse_tensor_from_dense_));
+
+  auto si = internal::checked_pointer_cast<SparseCOOIndex>(st->sparse_index());
+  ASSERT_TRUE(si->is_canonical());
+}
+
 TEST_F(TestSparseCOOTensor, TestToTensor) {
   std::vector<int64_t> values = {1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
                                  0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4};
@@ -1676,4 +1699,69 @@ TEST(TestSparseCSFMatrixForUInt64Index, Make) {
   ASSERT_RAISES(Invalid, SparseCSFTensor::Make(dense_tensor, uint64()));
 }
 
+//-----------------------------------------------------------------------------
+// Conversions of tensors larger than a conversion block
+
+class TestLargeSparseTensorConversion : public ::testing::Test {
+ public:
+  void SetUp() {
+    shape_ = {300, 517};
+    values_.resize(shape_[0] * shape_[1]);
+    column_major_values_.resize(values_.size());
+    for (int64_t i = 0; i < shape_[0]; ++i) {
+      for (int64_t j = 0; j < shape_[1]; ++j) {
+        const int64_t n = i * shape_[1] + j;
+        const double value = n % 7 == 0 ? static_cast<double>(n + 1) : 0;
+        values_[n] = value;
+        column_major_values_[i + j * shape_[0]] = value;
+        non_zero_length_ += value != 0;
+      }
+    }
+    const int64_t elsize = sizeof(double);
+    tensor_ = std::make_shared<Tensor>(float64(), Buffer::Wrap(values_), shape_);
+    column_major_tensor_ =
+        std::make_shared<Tensor>(float64(), Buffer::Wrap(column_major_values_), shape_,
+                                 std::vector<int64_t>{elsize, shape_[0] * elsize});
+  }
+
+  template <typename SparseTensorType>
+  void CheckRoundTrip(const std::shared_ptr<DataType>& index_type) {
+    for (const auto& tensor : {tensor_, column_major_tensor_}) {
+      ASSERT_OK_AND_ASSIGN(auto sparse_tensor,
+                           SparseTensorType::Make(*tensor, index_type));
+      ASSERT_EQ(non_zero_length_, sparse_tensor->non_zero_length());
+      ASSERT_OK_AND_ASSIGN(auto dense_tensor, sparse_tensor->ToTensor());
+      ASSERT_TRUE(dense_tensor->Equals(*tensor_));
+    }
+  }
+
+ protected:
+  std::vector<int64_t> shape_;
+  std::vector<double> values_;
+  std::vector<double> column_major_values_;
+  int64_t non_zero_length_ = 0;
+  std::shared_ptr<Tensor> tensor_;
+  std::shared_ptr<Tensor> column_major_tensor_;
+};
+
+TEST_F(TestLargeSparseTensorConversion, COO) {
+  CheckRoundTrip<SparseCOOTensor>(int32());
+  CheckRoundTrip<SparseCOOTensor>(int64());
+}
+
+TEST_F(TestLargeSparseTensorConversion, CSR) {
+  CheckRoundTrip<SparseCSRMatrix>(int32());
+  CheckRoundTrip<SparseCSRMatrix>(int64());
+}
+
+TEST_F(TestLargeSparseTensorConversion, CSC) {
+  CheckRoundTrip<SparseCSCMatrix>(int32());
+  CheckRoundTrip<SparseCSCMatrix>(int64());
+}
+
+TEST_F(TestLargeSparseTensorConversion, CSF) {
+  CheckRoundTrip<SparseCSFTensor>(int32());
+  CheckRoundTrip<SparseCSFTensor>(int64());
+}
+
 }  // namespace arrow
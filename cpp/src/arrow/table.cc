@@ -29,16 +29,19 @@
 #include "arrow/array/array_nested.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/array/util.h"
+#include "arrow/array/validate.h"
 #include "arrow/chunked_array.h"
 #include "arrow/pretty_print.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -192,9 +195,18 @@ class SimpleTable : public Table {
 
   Status ValidateFull() const override {
     RETURN_NOT_OK(ValidateMeta());
+    // Validate the columns of large tables in parallel (a single column is
+    // validated by chunks in parallel instead)
+    const bool use_threads = internal::ShouldUseCpuThreadPool(
+        num_columns(), num_rows_ * num_columns(), internal::kMinParallelValidationLength);
+    std::vector<Status> statuses(num_columns());
+    // Either way, the first invalid column is reported below
+    ARROW_UNUSED(internal::OptionalParallelFor(use_threads, num_columns(), [&](int i) {
+      statuses[i] = columns_[i]->ValidateFull();
+      return statuses[i];
+    }));
     for (int i = 0; i < num_columns(); ++i) {
-      const ChunkedArray* col = columns_[i].get();
-      Status st = col->ValidateFull();
+      const Status& st = statuses[i];
       if (!st.ok()) {
         std::stringstream ss;
         ss << "Column " << i << ": " << st.message();
@@ -541,11 +553,15 @@ bool Table::Equals(const Table& other, bool check_metadata) const {
 Result<std::shared_ptr<Table>> Table::CombineChunks(MemoryPool* pool) const {
   const int ncolumns = num_columns();
   std::vector<std::shared_ptr<ChunkedArray>> compacted_columns(ncolumns);
-  for (int i = 0; i < ncolumns; ++i) {
+  // Combine the columns of large tables in parallel
+  constexpr int64_t kMinParallelLength = 1 << 16;
+  const bool use_threads = internal::ShouldUseCpuThreadPool(
+      ncolumns, num_rows_ * ncolumns, kMinParallelLength);
+  RETURN_NOT_OK(internal::OptionalParallelFor(use_threads, ncolumns, [&](int i) {
     const auto& col = column(i);
     if (col->num_chunks() <= 1) {
       compacted_columns[i] = col;
-      continue;
+      return Status::OK();
     }
 
     if (is_binary_like(col->type()->id())) {
@@ -572,7 +588,8 @@ Result<std::shared_ptr<Table>> Table::CombineChunks(MemoryPool* pool) const {
       ARROW_ASSIGN_OR_RAISE(auto compacted, Concatenate(col->chunks(), pool));
       compacted_columns[i] = std::make_shared<ChunkedArray>(compacted);
     }
-  }
+    return Status::OK();
+  }));
   return Table::Make(schema(), std::move(compacted_columns), num_rows_);
 }
 
@@ -584,6 +601,13 @@ Result<std::shared_ptr<RecordBatch>> Table::CombineChunksToBatch(MemoryPool* poo
   }
   return RecordBatch::Make(schema_, num_rows_, std::move(arrays));
 }
+
+Result<std::shared_ptr<Tensor>> Table::ToTensor(bool null_to_nan, bool row_major,
+                                                MemoryPool* pool) const {
+  ARROW_ASSIGN_OR_RAISE(auto batch, CombineChunksToBatch(pool));
+  return batch->ToTensor(null_to_nan, row_major, pool);
+}
+
 // ----------------------------------------------------------------------
 // Convert a table to a sequence of record batches
 
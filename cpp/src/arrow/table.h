@@ -227,6 +227,13 @@ class ARROW_EXPORT Table {
   Result<std::shared_ptr<RecordBatch>> CombineChunksToBatch(
       MemoryPool* pool = default_memory_pool()) const;
 
+  /// \brief Convert the table to a 2-D tensor of shape (num_rows, num_columns)
+  ///
+  /// See RecordBatch::ToTensor.
+  Result<std::shared_ptr<Tensor>> ToTensor(
+      bool null_to_nan = false, bool row_major = true,
+      MemoryPool* pool = default_memory_pool()) const;
+
  protected:
   Table();
 
@@ -21,18 +21,24 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
 #include <type_traits>
 #include <vector>
 
+#include "arrow/array/data.h"
+#include "arrow/buffer.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visit_type_inline.h"
 
 namespace arrow {
@@ -339,4 +345,222 @@ Result<int64_t> Tensor::CountNonZero() const {
   return counter.result;
 }
 
+namespace {
+
+// The rows converted by a task
+constexpr int64_t kTensorRowsPerTask = 1 << 14;
+// The minimum number of values to convert in parallel
+constexpr int64_t kMinParallelTensorValues = 1 << 16;
+// The size of the blocks of rows of a row-major tensor written at once: small enough to
+// stay in the L1 cache while the values of each column are interleaved into it
+constexpr int64_t kTensorBlockBytes = 1 << 15;
+
+// The common type of the columns, with the promotions of NumPy: integers of different
+// signedness are promoted to a signed integer wide enough for both (or float64), and
+// integers are converted to a float wide enough to represent them exactly
+Result<std::shared_ptr<DataType>> TensorTypeOf(const Schema& schema, bool null_to_nan) {
+  bool is_floating_result = null_to_nan;
+  int max_signed_width = 0;
+  int max_unsigned_width = 0;
+  int max_float_width = 0;
+  for (const auto& field : schema.fields()) {
+    const auto& type = *field->type();
+    if (!is_integer(type.id()) && !is_floating(type.id())) {
+      return Status::TypeError("DataType is not supported: ", type.ToString());
+    }
+    if (type.id() == Type::HALF_FLOAT) {
+      return Status::TypeError("DataType is not supported: ", type.ToString());
+    }
+    const int width = checked_cast<const FixedWidthType&>(type).bit_width();
+    if (is_floating(type.id())) {
+      is_floating_result = true;
+      max_float_width = std::max(max_float_width, width);
+    } else if (is_signed_integer(type.id())) {
+      max_signed_width = std::max(max_signed_width, width);
+    } else {
+      max_unsigned_width = std::max(max_unsigned_width, width);
+    }
+  }
+
+  const int max_int_width = std::max(max_signed_width, max_unsigned_width);
+  if (is_floating_result) {
+    return (max_float_width == 64 || max_int_width > 16) ? float64() : float32();
+  }
+  if (max_signed_width == 0) {
+    switch (max_unsigned_width) {
+      case 8:
+        return uint8();
+      case 16:
+        return uint16();
+      case 32:
+        return uint32();
+      default:
+        return uint64();
+    }
+  }
+  switch (std::max(max_signed_width, 2 * max_unsigned_width)) {
+    case 8:
+      return int8();
+    case 16:
+      return int16();
+    case 32:
+      return int32();
+    case 64:
+      return int64();
+    default:
+      return float64();
+  }
+}
+
+// Write rows [begin, end) of a numeric column to `out`, one value every `stride`
+template <typename Out>
+struct ColumnToTensor {
+  template <typename T>
+  enable_if_number<T, Status> Visit(const T&) {
+    using In = typename T::c_type;
+    const In* values = column.GetValues<In>(1) + begin;
+    const int64_t length = end - begin;
+    if (stride == 1) {
+      for (int64_t i = 0; i < length; ++i) {
+        out[i] = static_cast<Out>(values[i]);
+      }
+    } else {
+      for (int64_t i = 0; i < length; ++i) {
+        out[i * stride] = static_cast<Out>(values[i]);
+      }
+    }
+    if (null_to_nan && column.MayHaveNulls()) {
+      internal::BitRunReader reader(column.buffers[0]->data(), column.offset + begin,
+                                    length);
+      int64_t position = 0;
+      for (auto run = reader.NextRun(); run.length > 0; run = reader.NextRun()) {
+        if (!run.set) {
+          for (int64_t i = position; i < position + run.length; ++i) {
+            out[i * stride] = std::numeric_limits<Out>::quiet_NaN();
+          }
+        }
+        position += run.length;
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::TypeError("DataType is not supported: ", type.ToString());
+  }
+
+  const ArrayData& column;
+  const bool null_to_nan;
+  const int64_t begin;
+  const int64_t end;
+  Out* out;
+  const int64_t stride;
+};
+
+// Write rows [begin, end) of the batch to a row-major or column-major tensor
+struct BatchToTensor {
+  template <typename T>
+  enable_if_number<T, Status> Visit(const T&) {
+    using Out = typename T::c_type;
+    Out* data = reinterpret_cast<Out*>(out);
+    const int64_t num_rows = batch.num_rows();
+    const int num_columns = batch.num_columns();
+    if (!row_major) {
+      for (int i = 0; i < num_columns; ++i) {
+        ColumnToTensor<Out> converter{*batch.column_data(i), null_to_nan, begin, end,
+                                      data + i * num_rows + begin, /*stride=*/1};
+        RETURN_NOT_OK(VisitTypeInline(*batch.column_data(i)->type, &converter));
+      }
+      return Status::OK();
+    }
+    // Interleave the columns block by block, so that the rows being written stay in
+    // cache and each column is still read sequentially
+    const int64_t block_rows = std::max<int64_t>(
+        1, kTensorBlockBytes / (num_columns * static_cast<int64_t>(sizeof(Out))));
+    for (int64_t block_begin = begin; block_begin < end; block_begin += block_rows) {
+      const int64_t block_end = std::min(end, block_begin + block_rows);
+      for (int i = 0; i < num_columns; ++i) {
+        ColumnToTensor<Out> converter{*batch.column_data(i),
+                                      null_to_nan,
+                                      block_begin,
+                                      block_end,
+                                      data + block_begin * num_columns + i,
+                                      /*stride=*/num_columns};
+        RETURN_NOT_OK(VisitTypeInline(*batch.column_data(i)->type, &converter));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::TypeError("DataType is not supported: ", type.ToString());
+  }
+
+  const RecordBatch& batch;
+  const bool null_to_nan;
+  const bool row_major;
+  const int64_t begin;
+  const int64_t end;
+  uint8_t* out;
+};
+
+}  // namespace
+
+namespace internal {
+
+Result<std::shared_ptr<Tensor>> RecordBatchToTensor(const RecordBatch& batch,
+                                                    bool null_to_nan, bool row_major,
+                                                    MemoryPool* pool) {
+  if (batch.num_columns() == 0) {
+    return Status::TypeError(
+        "Conversion to Tensor for RecordBatches without columns/schema is not "
+        "supported.");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto type, TensorTypeOf(*batch.schema(), null_to_nan));
+  if (!null_to_nan) {
+    for (const auto& column : batch.column_data()) {
+      if (column->GetNullCount() > 0) {
+        return Status::TypeError(
+            "Can only convert a RecordBatch with no nulls. Set null_to_nan to true to "
+            "convert nulls to NaN");
+      }
+    }
+  }
+
+  const int64_t num_rows = batch.num_rows();
+  const int64_t num_columns = batch.num_columns();
+  const int64_t byte_width = checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+  std::vector<int64_t> shape = {num_rows, num_columns};
+  std::vector<int64_t> strides =
+      row_major ? std::vector<int64_t>{byte_width * num_columns, byte_width}
+                : std::vector<int64_t>{byte_width, byte_width * num_rows};
+
+  // A single column of the tensor type is its own (row-major and column-major) tensor
+  const ArrayData& first = *batch.column_data(0);
+  if (num_columns == 1 && first.type->Equals(*type) && first.GetNullCount() == 0) {
+    auto data = SliceBuffer(first.buffers[1], first.offset * byte_width,
+                            num_rows * byte_width);
+    return std::make_shared<Tensor>(type, std::move(data), std::move(shape),
+                                    std::move(strides));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> data,
+                        AllocateBuffer(num_rows * num_columns * byte_width, pool));
+  uint8_t* out = data->mutable_data();
+  const int num_tasks = static_cast<int>(
+      std::max<int64_t>(1, bit_util::CeilDiv(num_rows, kTensorRowsPerTask)));
+  const bool use_threads = ShouldUseCpuThreadPool(num_tasks, num_rows * num_columns,
+                                                  kMinParallelTensorValues);
+  RETURN_NOT_OK(OptionalParallelFor(use_threads, num_tasks, [&](int task) {
+    const int64_t begin = task * kTensorRowsPerTask;
+    const int64_t end = std::min(num_rows, begin + kTensorRowsPerTask);
+    BatchToTensor converter{batch, null_to_nan, row_major, begin, end, out};
+    return VisitTypeInline(*type, &converter);
+  }));
+  return std::make_shared<Tensor>(type, std::move(data), std::move(shape),
+                                  std::move(strides));
+}
+
+}  // namespace internal
+
 }  // namespace arrow
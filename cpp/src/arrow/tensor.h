@@ -77,6 +77,14 @@ Status ValidateTensorParameters(const std::shared_ptr<DataType>& type,
                                 const std::vector<int64_t>& strides,
                                 const std::vector<std::string>& dim_names);
 
+/// \brief Convert the numeric columns of a record batch to a 2-D tensor
+///
+/// See RecordBatch::ToTensor.
+ARROW_EXPORT
+Result<std::shared_ptr<Tensor>> RecordBatchToTensor(const RecordBatch& batch,
+                                                    bool null_to_nan, bool row_major,
+                                                    MemoryPool* pool);
+
 }  // namespace internal
 
 class ARROW_EXPORT Tensor {
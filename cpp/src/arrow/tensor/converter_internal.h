@@ -17,7 +17,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 #include "arrow/tensor/converter.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 
 #define DISPATCH(ACTION, index_elsize, value_elsize, ...) \
   switch (index_elsize) {                                 \
@@ -86,3 +93,75 @@
       }                                                   \
       break;                                              \
   }
+
+namespace arrow {
+namespace internal {
+
+// The number of elements of a dense tensor scanned by a task of the conversions
+constexpr int64_t kSparseConversionBlockSize = 1 << 16;
+
+// Convert the position of an element, in the iteration order of `axis_order` (with the
+// last axis varying fastest), to its coordinates
+inline void UnravelIndex(int64_t position, const std::vector<int64_t>& shape,
+                         const std::vector<int64_t>& axis_order,
+                         std::vector<int64_t>* coord) {
+  for (int64_t i = static_cast<int64_t>(axis_order.size()) - 1; i >= 0; --i) {
+    const int64_t d = axis_order[i];
+    (*coord)[d] = position % shape[d];
+    position /= shape[d];
+  }
+}
+
+// Call `visit(coord, value)` for each non-zero value of the elements of a tensor at
+// positions [begin, end) in the iteration order of `axis_order`.  Any strides are
+// supported; the elements along the innermost axis are read in a tight loop.
+template <typename c_value_type, typename Visitor>
+void VisitNonZero(const Tensor& tensor, const std::vector<int64_t>& axis_order,
+                  int64_t begin, int64_t end, Visitor&& visit) {
+  const auto& shape = tensor.shape();
+  const int64_t ndim = tensor.ndim();
+  std::vector<int64_t> coord(ndim);
+  UnravelIndex(begin, shape, axis_order, &coord);
+
+  constexpr c_value_type zero = 0;
+  const int64_t inner_axis = axis_order[ndim - 1];
+  const int64_t inner_stride = tensor.strides()[inner_axis];
+  int64_t position = begin;
+  while (position < end) {
+    const uint8_t* data = tensor.raw_data() + tensor.CalculateValueOffset(coord);
+    const int64_t run_begin = coord[inner_axis];
+    const int64_t run_end = std::min(shape[inner_axis], run_begin + (end - position));
+    for (int64_t j = run_begin; j < run_end; ++j, data += inner_stride) {
+      const c_value_type x = *reinterpret_cast<const c_value_type*>(data);
+      if (ARROW_PREDICT_FALSE(x != zero)) {
+        coord[inner_axis] = j;
+        visit(coord, x);
+      }
+    }
+    position += run_end - run_begin;
+
+    coord[inner_axis] = 0;
+    for (int64_t i = ndim - 2; i >= 0; --i) {
+      const int64_t d = axis_order[i];
+      if (++coord[d] < shape[d]) break;
+      coord[d] = 0;
+    }
+  }
+}
+
+// Call `func(block, begin, end)` for each block of `block_size` consecutive positions
+// among `size`, on the CPU thread pool when there is enough work
+template <typename Function>
+Status ParallelForBlocks(int64_t size, int64_t block_size, Function&& func) {
+  const auto num_blocks = static_cast<int>(bit_util::CeilDiv(size, block_size));
+  const bool use_threads =
+      ShouldUseCpuThreadPool(num_blocks, size, 2 * kSparseConversionBlockSize);
+  return OptionalParallelFor(use_threads, num_blocks, [&](int block) {
+    const int64_t begin = block * block_size;
+    func(block, begin, std::min(size, begin + block_size));
+    return Status::OK();
+  });
+}
+
+}  // namespace internal
+}  // namespace arrow
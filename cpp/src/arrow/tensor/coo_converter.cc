@@ -27,6 +27,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/macros.h"
 #include "arrow/visit_type_inline.h"
 
@@ -37,129 +38,63 @@ class MemoryPool;
 namespace internal {
 namespace {
 
-template <typename c_index_type>
-inline void IncrementRowMajorIndex(std::vector<c_index_type>& coord,
-                                   const std::vector<int64_t>& shape) {
-  const int64_t ndim = shape.size();
-  ++coord[ndim - 1];
-  if (coord[ndim - 1] == shape[ndim - 1]) {
-    int64_t d = ndim - 1;
-    while (d > 0 && coord[d] == shape[d]) {
-      coord[d] = 0;
-      ++coord[d - 1];
-      --d;
-    }
-  }
-}
-
-template <typename c_index_type, typename c_value_type>
-void ConvertRowMajorTensor(const Tensor& tensor, c_index_type* indices,
-                           c_value_type* values, const int64_t size) {
-  const auto ndim = tensor.ndim();
-  const auto& shape = tensor.shape();
-  const c_value_type* tensor_data =
-      reinterpret_cast<const c_value_type*>(tensor.raw_data());
-
-  constexpr c_value_type zero = 0;
-  std::vector<c_index_type> coord(ndim, 0);
-  for (int64_t n = tensor.size(); n > 0; --n) {
-    const c_value_type x = *tensor_data;
-    if (ARROW_PREDICT_FALSE(x != zero)) {
-      std::copy(coord.begin(), coord.end(), indices);
-      *values++ = x;
-      indices += ndim;
-    }
-
-    IncrementRowMajorIndex(coord, shape);
-    ++tensor_data;
-  }
-}
-
-template <typename c_index_type, typename c_value_type>
-void ConvertColumnMajorTensor(const Tensor& tensor, c_index_type* out_indices,
-                              c_value_type* out_values, const int64_t size) {
-  const auto ndim = tensor.ndim();
-  std::vector<c_index_type> indices(ndim * size);
-  std::vector<c_value_type> values(size);
-  ConvertRowMajorTensor(tensor, indices.data(), values.data(), size);
-
-  // transpose indices
-  for (int64_t i = 0; i < size; ++i) {
-    for (int j = 0; j < ndim / 2; ++j) {
-      std::swap(indices[i * ndim + j], indices[i * ndim + ndim - j - 1]);
-    }
-  }
-
-  // sort indices
-  std::vector<int64_t> order(size);
-  std::iota(order.begin(), order.end(), 0);
-  std::sort(order.begin(), order.end(), [&](const int64_t xi, const int64_t yi) {
-    const int64_t x_offset = xi * ndim;
-    const int64_t y_offset = yi * ndim;
-    for (int j = 0; j < ndim; ++j) {
-      const auto x = indices[x_offset + j];
-      const auto y = indices[y_offset + j];
-      if (x < y) return true;
-      if (x > y) return false;
-    }
-    return false;
-  });
-
-  // transfer result
-  const auto* indices_data = indices.data();
-  for (int64_t i = 0; i < size; ++i) {
-    out_values[i] = values[i];
-
-    std::copy_n(indices_data, ndim, out_indices);
-    indices_data += ndim;
-    out_indices += ndim;
-  }
-}
-
+// Convert a tensor with at least one dimension in two passes over blocks of its
+// elements, in row-major order: the first one counts the non-zero values of each block,
+// the second one writes them once the position of each block in the output is known.
 template <typename c_index_type, typename c_value_type>
-void ConvertStridedTensor(const Tensor& tensor, c_index_type* indices,
-                          c_value_type* values, const int64_t size) {
-  using ValueType = typename CTypeTraits<c_value_type>::ArrowType;
-  const auto& shape = tensor.shape();
-  const auto ndim = tensor.ndim();
-  std::vector<int64_t> coord(ndim, 0);
-
-  constexpr c_value_type zero = 0;
-  c_value_type x;
-  int64_t i;
-  for (int64_t n = tensor.size(); n > 0; --n) {
-    x = tensor.Value<ValueType>(coord);
-    if (ARROW_PREDICT_FALSE(x != zero)) {
-      *values++ = x;
-      for (i = 0; i < ndim; ++i) {
-        *indices++ = static_cast<c_index_type>(coord[i]);
-      }
-    }
-
-    IncrementRowMajorIndex(coord, shape);
-  }
+Status ConvertTensor(const Tensor& tensor, MemoryPool* pool, int64_t* out_nonzero_count,
+                     std::shared_ptr<Buffer>* out_indices,
+                     std::shared_ptr<Buffer>* out_values) {
+  const int64_t ndim = tensor.ndim();
+  const int64_t size = tensor.size();
+  std::vector<int64_t> axis_order(ndim);
+  std::iota(axis_order.begin(), axis_order.end(), 0);
+
+  std::vector<int64_t> offsets(
+      bit_util::CeilDiv(size, kSparseConversionBlockSize) + 1, 0);
+  RETURN_NOT_OK(ParallelForBlocks(
+      size, kSparseConversionBlockSize, [&](int block, int64_t begin, int64_t end) {
+        int64_t count = 0;
+        VisitNonZero<c_value_type>(tensor, axis_order, begin, end,
+                                   [&](const std::vector<int64_t>&, c_value_type) {
+                                     ++count;
+                                   });
+        offsets[block + 1] = count;
+      }));
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  const int64_t nonzero_count = offsets.back();
+
+  ARROW_ASSIGN_OR_RAISE(
+      *out_indices, AllocateBuffer(sizeof(c_index_type) * ndim * nonzero_count, pool));
+  ARROW_ASSIGN_OR_RAISE(*out_values,
+                        AllocateBuffer(sizeof(c_value_type) * nonzero_count, pool));
+  auto* indices = reinterpret_cast<c_index_type*>((*out_indices)->mutable_data());
+  auto* values = reinterpret_cast<c_value_type*>((*out_values)->mutable_data());
+  RETURN_NOT_OK(ParallelForBlocks(
+      size, kSparseConversionBlockSize, [&](int block, int64_t begin, int64_t end) {
+        int64_t i = offsets[block];
+        VisitNonZero<c_value_type>(
+            tensor, axis_order, begin, end,
+            [&](const std::vector<int64_t>& coord, c_value_type x) {
+              c_index_type* index = indices + i * ndim;
+              for (int64_t d = 0; d < ndim; ++d) {
+                index[d] = static_cast<c_index_type>(coord[d]);
+              }
+              values[i++] = x;
+            });
+      }));
+
+  *out_nonzero_count = nonzero_count;
+  return Status::OK();
 }
 
-#define CONVERT_TENSOR(func, index_type, value_type, indices, values, size)     \
-  func<index_type, value_type>(tensor_, reinterpret_cast<index_type*>(indices), \
-                               reinterpret_cast<value_type*>(values), size)
-
-// Using ARROW_EXPAND is necessary to expand __VA_ARGS__ correctly on VC++.
-#define CONVERT_ROW_MAJOR_TENSOR(index_type, value_type, ...) \
-  ARROW_EXPAND(CONVERT_TENSOR(ConvertRowMajorTensor, index_type, value_type, __VA_ARGS__))
-
-#define CONVERT_COLUMN_MAJOR_TENSOR(index_type, value_type, ...) \
-  ARROW_EXPAND(                                                  \
-      CONVERT_TENSOR(ConvertColumnMajorTensor, index_type, value_type, __VA_ARGS__))
-
-#define CONVERT_STRIDED_TENSOR(index_type, value_type, ...) \
-  ARROW_EXPAND(CONVERT_TENSOR(ConvertStridedTensor, index_type, value_type, __VA_ARGS__))
+#define CONVERT_TENSOR(index_type, value_type, ...) \
+  RETURN_NOT_OK((ConvertTensor<index_type, value_type>(__VA_ARGS__)))
 
 // ----------------------------------------------------------------------
 // SparseTensorConverter for SparseCOOIndex
 
 class SparseCOOTensorConverter : private SparseTensorConverterMixin {
-  using SparseTensorConverterMixin::AssignIndex;
   using SparseTensorConverterMixin::IsNonZero;
 
  public:
@@ -176,38 +111,20 @@ class SparseCOOTensorConverter : private SparseTensorConverterMixin {
     const int value_elsize = tensor_.type()->byte_width();
 
     const int64_t ndim = tensor_.ndim();
-    ARROW_ASSIGN_OR_RAISE(int64_t nonzero_count, tensor_.CountNonZero());
-
-    ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
-                          AllocateBuffer(index_elsize * ndim * nonzero_count, pool_));
-    uint8_t* indices = indices_buffer->mutable_data();
-
-    ARROW_ASSIGN_OR_RAISE(auto values_buffer,
-                          AllocateBuffer(value_elsize * nonzero_count, pool_));
-    uint8_t* values = values_buffer->mutable_data();
-
-    const uint8_t* tensor_data = tensor_.raw_data();
-    if (ndim <= 1) {
-      const int64_t count = ndim == 0 ? 1 : tensor_.shape()[0];
-      for (int64_t i = 0; i < count; ++i) {
-        if (std::any_of(tensor_data, tensor_data + value_elsize, IsNonZero)) {
-          AssignIndex(indices, i, index_elsize);
-          std::copy_n(tensor_data, value_elsize, values);
-
-          indices += index_elsize;
-          values += value_elsize;
-        }
-        tensor_data += value_elsize;
-      }
-    } else if (tensor_.is_row_major()) {
-      DISPATCH(CONVERT_ROW_MAJOR_TENSOR, index_elsize, value_elsize, indices, values,
-               nonzero_count);
-    } else if (tensor_.is_column_major()) {
-      DISPATCH(CONVERT_COLUMN_MAJOR_TENSOR, index_elsize, value_elsize, indices, values,
-               nonzero_count);
+    int64_t nonzero_count = 0;
+    std::shared_ptr<Buffer> indices_buffer;
+    std::shared_ptr<Buffer> values_buffer;
+    if (ndim == 0) {
+      const uint8_t* tensor_data = tensor_.raw_data();
+      nonzero_count = std::any_of(tensor_data, tensor_data + value_elsize, IsNonZero);
+      ARROW_ASSIGN_OR_RAISE(indices_buffer, AllocateBuffer(0, pool_));
+      ARROW_ASSIGN_OR_RAISE(values_buffer,
+                            AllocateBuffer(value_elsize * nonzero_count, pool_));
+      std::copy_n(tensor_data, value_elsize * nonzero_count,
+                  values_buffer->mutable_data());
     } else {
-      DISPATCH(CONVERT_STRIDED_TENSOR, index_elsize, value_elsize, indices, values,
-               nonzero_count);
+      DISPATCH(CONVERT_TENSOR, index_elsize, value_elsize, tensor_, pool_,
+               &nonzero_count, &indices_buffer, &values_buffer);
     }
 
     // make results
@@ -15,12 +15,13 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#include "arrow/tensor/converter.h"
+#include "arrow/tensor/converter_internal.h"
 
 #include <algorithm>
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 #include "arrow/buffer.h"
@@ -39,27 +40,64 @@ class MemoryPool;
 namespace internal {
 namespace {
 
-inline void IncrementIndex(std::vector<int64_t>& coord, const std::vector<int64_t>& shape,
-                           const std::vector<int64_t>& axis_order) {
-  const int64_t ndim = shape.size();
-  const int64_t last_axis = axis_order[ndim - 1];
-  ++coord[last_axis];
-  if (coord[last_axis] == shape[last_axis]) {
-    int64_t d = ndim - 1;
-    while (d > 0 && coord[axis_order[d]] == shape[axis_order[d]]) {
-      coord[axis_order[d]] = 0;
-      ++coord[axis_order[d - 1]];
-      --d;
-    }
-  }
+// Collect the coordinates of the non-zero values of a tensor, in the order of the
+// levels of the tree (`axis_order`), in two parallel passes over blocks of its elements.
+// The coordinates come out sorted, so the tree can be built with a single sequential
+// pass over them.
+template <typename c_index_type, typename c_value_type>
+Status CollectNonZero(const Tensor& tensor, const std::vector<int64_t>& axis_order,
+                      MemoryPool* pool, int64_t* out_nonzero_count,
+                      std::shared_ptr<Buffer>* out_coords,
+                      std::shared_ptr<Buffer>* out_values) {
+  const int64_t ndim = tensor.ndim();
+  const int64_t size = tensor.size();
+
+  std::vector<int64_t> offsets(
+      bit_util::CeilDiv(size, kSparseConversionBlockSize) + 1, 0);
+  RETURN_NOT_OK(ParallelForBlocks(
+      size, kSparseConversionBlockSize, [&](int block, int64_t begin, int64_t end) {
+        int64_t count = 0;
+        VisitNonZero<c_value_type>(tensor, axis_order, begin, end,
+                                   [&](const std::vector<int64_t>&, c_value_type) {
+                                     ++count;
+                                   });
+        offsets[block + 1] = count;
+      }));
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  const int64_t nonzero_count = offsets.back();
+
+  ARROW_ASSIGN_OR_RAISE(
+      *out_coords, AllocateBuffer(sizeof(c_index_type) * ndim * nonzero_count, pool));
+  ARROW_ASSIGN_OR_RAISE(*out_values,
+                        AllocateBuffer(sizeof(c_value_type) * nonzero_count, pool));
+  auto* coords = reinterpret_cast<c_index_type*>((*out_coords)->mutable_data());
+  auto* values = reinterpret_cast<c_value_type*>((*out_values)->mutable_data());
+  RETURN_NOT_OK(ParallelForBlocks(
+      size, kSparseConversionBlockSize, [&](int block, int64_t begin, int64_t end) {
+        int64_t i = offsets[block];
+        VisitNonZero<c_value_type>(
+            tensor, axis_order, begin, end,
+            [&](const std::vector<int64_t>& coord, c_value_type x) {
+              c_index_type* level_coords = coords + i * ndim;
+              for (int64_t level = 0; level < ndim; ++level) {
+                level_coords[level] = static_cast<c_index_type>(coord[axis_order[level]]);
+              }
+              values[i++] = x;
+            });
+      }));
+
+  *out_nonzero_count = nonzero_count;
+  return Status::OK();
 }
 
+#define COLLECT_NONZERO(index_type, value_type, ...) \
+  RETURN_NOT_OK((CollectNonZero<index_type, value_type>(__VA_ARGS__)))
+
 // ----------------------------------------------------------------------
 // SparseTensorConverter for SparseCSFIndex
 
 class SparseCSFTensorConverter : private SparseTensorConverterMixin {
   using SparseTensorConverterMixin::AssignIndex;
-  using SparseTensorConverterMixin::IsNonZero;
 
  public:
   SparseCSFTensorConverter(const Tensor& tensor,
@@ -78,58 +116,45 @@ class SparseCSFTensorConverter : private SparseTensorConverterMixin {
     // Axis order as ascending order of dimension size is a good heuristic but is not
     // necessarily optimal.
     std::vector<int64_t> axis_order = internal::ArgSort(tensor_.shape());
-    ARROW_ASSIGN_OR_RAISE(int64_t nonzero_count, tensor_.CountNonZero());
+    if (ndim <= 1) {
+      return Status::NotImplemented("TODO for ndim <= 1");
+    }
 
-    ARROW_ASSIGN_OR_RAISE(auto values_buffer,
-                          AllocateBuffer(value_elsize * nonzero_count, pool_));
-    auto* values = values_buffer->mutable_data();
+    int64_t nonzero_count = 0;
+    std::shared_ptr<Buffer> coords_buffer;
+    std::shared_ptr<Buffer> values_buffer;
+    DISPATCH(COLLECT_NONZERO, index_elsize, value_elsize, tensor_, axis_order, pool_,
+             &nonzero_count, &coords_buffer, &values_buffer);
 
     std::vector<int64_t> counts(ndim, 0);
-    std::vector<int64_t> coord(ndim, 0);
-    std::vector<int64_t> previous_coord(ndim, -1);
     std::vector<BufferBuilder> indptr_buffer_builders(ndim - 1);
     std::vector<BufferBuilder> indices_buffer_builders(ndim);
+    for (int64_t i = 0; i < ndim; ++i) {
+      RETURN_NOT_OK(indices_buffer_builders[i].Reserve(index_elsize * nonzero_count));
+      if (i < ndim - 1) {
+        RETURN_NOT_OK(
+            indptr_buffer_builders[i].Reserve(index_elsize * (nonzero_count + 1)));
+      }
+    }
 
-    const auto* tensor_data = tensor_.raw_data();
+    const uint8_t* coords = coords_buffer->data();
+    const int64_t coords_elsize = index_elsize * ndim;
     uint8_t index_buffer[sizeof(int64_t)];
-
-    if (ndim <= 1) {
-      return Status::NotImplemented("TODO for ndim <= 1");
-    } else {
-      const auto& shape = tensor_.shape();
-      for (int64_t n = tensor_.size(); n > 0; n--) {
-        const auto offset = tensor_.CalculateValueOffset(coord);
-        const auto xp = tensor_data + offset;
-
-        if (std::any_of(xp, xp + value_elsize, IsNonZero)) {
-          bool tree_split = false;
-
-          std::copy_n(xp, value_elsize, values);
-          values += value_elsize;
-
-          for (int64_t i = 0; i < ndim; ++i) {
-            int64_t dimension = axis_order[i];
-
-            tree_split = tree_split || (coord[dimension] != previous_coord[dimension]);
-            if (tree_split) {
-              if (i < ndim - 1) {
-                AssignIndex(index_buffer, counts[i + 1], index_elsize);
-                RETURN_NOT_OK(
-                    indptr_buffer_builders[i].Append(index_buffer, index_elsize));
-              }
-
-              AssignIndex(index_buffer, coord[dimension], index_elsize);
-              RETURN_NOT_OK(
-                  indices_buffer_builders[i].Append(index_buffer, index_elsize));
-
-              ++counts[i];
-            }
+    for (int64_t n = 0; n < nonzero_count; ++n) {
+      const uint8_t* coord = coords + n * coords_elsize;
+      bool tree_split = n == 0;
+      for (int64_t i = 0; i < ndim; ++i) {
+        const uint8_t* index = coord + i * index_elsize;
+        tree_split =
+            tree_split || !std::equal(index, index + index_elsize, index - coords_elsize);
+        if (tree_split) {
+          if (i < ndim - 1) {
+            AssignIndex(index_buffer, counts[i + 1], index_elsize);
+            indptr_buffer_builders[i].UnsafeAppend(index_buffer, index_elsize);
           }
-
-          previous_coord = coord;
+          indices_buffer_builders[i].UnsafeAppend(index, index_elsize);
+          ++counts[i];
         }
-
-        IncrementIndex(coord, shape, axis_order);
       }
     }
 
@@ -15,11 +15,13 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#include "arrow/tensor/converter.h"
+#include "arrow/tensor/converter_internal.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 #include "arrow/buffer.h"
@@ -35,13 +37,70 @@ class MemoryPool;
 namespace internal {
 namespace {
 
+// Convert a matrix in two passes over blocks of its major axis: the first one counts the
+// non-zero values of each major index, the second one writes them once the pointers to
+// the start of each major index are known.
+template <typename c_index_type, typename c_value_type>
+Status ConvertMatrix(SparseMatrixCompressedAxis axis, const Tensor& tensor,
+                     MemoryPool* pool, int64_t* out_nonzero_count,
+                     std::shared_ptr<Buffer>* out_indptr,
+                     std::shared_ptr<Buffer>* out_indices,
+                     std::shared_ptr<Buffer>* out_values) {
+  const int64_t major_axis = static_cast<int64_t>(axis);
+  const int64_t minor_axis = 1 - major_axis;
+  const int64_t n_major = tensor.shape()[major_axis];
+  const int64_t n_minor = tensor.shape()[minor_axis];
+  const std::vector<int64_t> axis_order = {major_axis, minor_axis};
+  // Blocks of whole major indices
+  const int64_t row_size = std::max<int64_t>(1, n_minor);
+  const int64_t block_size =
+      std::max<int64_t>(1, kSparseConversionBlockSize / row_size) * row_size;
+
+  ARROW_ASSIGN_OR_RAISE(*out_indptr,
+                        AllocateBuffer(sizeof(c_index_type) * (n_major + 1), pool));
+  auto* indptr = reinterpret_cast<c_index_type*>((*out_indptr)->mutable_data());
+  std::vector<int64_t> counts(n_major + 1, 0);
+  RETURN_NOT_OK(
+      ParallelForBlocks(tensor.size(), block_size, [&](int, int64_t begin, int64_t end) {
+        VisitNonZero<c_value_type>(tensor, axis_order, begin, end,
+                                   [&](const std::vector<int64_t>& coord, c_value_type) {
+                                     ++counts[coord[major_axis] + 1];
+                                   });
+      }));
+  std::partial_sum(counts.begin(), counts.end(), counts.begin());
+  for (int64_t i = 0; i <= n_major; ++i) {
+    indptr[i] = static_cast<c_index_type>(counts[i]);
+  }
+  const int64_t nonzero_count = counts.back();
+
+  ARROW_ASSIGN_OR_RAISE(*out_indices,
+                        AllocateBuffer(sizeof(c_index_type) * nonzero_count, pool));
+  ARROW_ASSIGN_OR_RAISE(*out_values,
+                        AllocateBuffer(sizeof(c_value_type) * nonzero_count, pool));
+  auto* indices = reinterpret_cast<c_index_type*>((*out_indices)->mutable_data());
+  auto* values = reinterpret_cast<c_value_type*>((*out_values)->mutable_data());
+  RETURN_NOT_OK(
+      ParallelForBlocks(tensor.size(), block_size, [&](int, int64_t begin, int64_t end) {
+        int64_t k = counts[begin / n_minor];
+        VisitNonZero<c_value_type>(
+            tensor, axis_order, begin, end,
+            [&](const std::vector<int64_t>& coord, c_value_type x) {
+              indices[k] = static_cast<c_index_type>(coord[minor_axis]);
+              values[k++] = x;
+            });
+      }));
+
+  *out_nonzero_count = nonzero_count;
+  return Status::OK();
+}
+
+#define CONVERT_MATRIX(index_type, value_type, ...) \
+  RETURN_NOT_OK((ConvertMatrix<index_type, value_type>(__VA_ARGS__)))
+
 // ----------------------------------------------------------------------
 // SparseTensorConverter for SparseCSRIndex
 
-class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
-  using SparseTensorConverterMixin::AssignIndex;
-  using SparseTensorConverterMixin::IsNonZero;
-
+class SparseCSXMatrixConverter {
  public:
   SparseCSXMatrixConverter(SparseMatrixCompressedAxis axis, const Tensor& tensor,
                            const std::shared_ptr<DataType>& index_value_type,
@@ -60,57 +119,16 @@ class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
       return Status::Invalid("Invalid tensor dimension");
     }
 
-    const int major_axis = static_cast<int>(axis_);
-    const int64_t n_major = tensor_.shape()[major_axis];
-    const int64_t n_minor = tensor_.shape()[1 - major_axis];
-    ARROW_ASSIGN_OR_RAISE(int64_t nonzero_count, tensor_.CountNonZero());
-
+    const int64_t n_major = tensor_.shape()[static_cast<int>(axis_)];
+    int64_t nonzero_count = 0;
     std::shared_ptr<Buffer> indptr_buffer;
     std::shared_ptr<Buffer> indices_buffer;
-
-    ARROW_ASSIGN_OR_RAISE(auto values_buffer,
-                          AllocateBuffer(value_elsize * nonzero_count, pool_));
-    auto* values = values_buffer->mutable_data();
-
-    const auto* tensor_data = tensor_.raw_data();
-
+    std::shared_ptr<Buffer> values_buffer;
     if (ndim <= 1) {
       return Status::NotImplemented("TODO for ndim <= 1");
     } else {
-      ARROW_ASSIGN_OR_RAISE(indptr_buffer,
-                            AllocateBuffer(index_elsize * (n_major + 1), pool_));
-      auto* indptr = indptr_buffer->mutable_data();
-
-      ARROW_ASSIGN_OR_RAISE(indices_buffer,
-                            AllocateBuffer(index_elsize * nonzero_count, pool_));
-      auto* indices = indices_buffer->mutable_data();
-
-      std::vector<int64_t> coords(2);
-      int64_t k = 0;
-      std::fill_n(indptr, index_elsize, 0);
-      indptr += index_elsize;
-      for (int64_t i = 0; i < n_major; ++i) {
-        for (int64_t j = 0; j < n_minor; ++j) {
-          if (axis_ == SparseMatrixCompressedAxis::ROW) {
-            coords = {i, j};
-          } else {
-            coords = {j, i};
-          }
-          const int64_t offset = tensor_.CalculateValueOffset(coords);
-          if (std::any_of(tensor_data + offset, tensor_data + offset + value_elsize,
-                          IsNonZero)) {
-            std::copy_n(tensor_data + offset, value_elsize, values);
-            values += value_elsize;
-
-            AssignIndex(indices, j, index_elsize);
-            indices += index_elsize;
-
-            k++;
-          }
-        }
-        AssignIndex(indptr, k, index_elsize);
-        indptr += index_elsize;
-      }
+      DISPATCH(CONVERT_MATRIX, index_elsize, value_elsize, axis_, tensor_, pool_,
+               &nonzero_count, &indptr_buffer, &indices_buffer, &values_buffer);
     }
 
     std::vector<int64_t> indptr_shape({n_major + 1});
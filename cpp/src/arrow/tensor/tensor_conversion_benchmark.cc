@@ -228,4 +228,30 @@ BENCHMARK_CONVERT_TENSOR(Tensor, CSF, Float, Int64);
 BENCHMARK_CONVERT_TENSOR(Tensor, CSF, Double, Int32);
 BENCHMARK_CONVERT_TENSOR(Tensor, CSF, Double, Int64);
 
+// A larger matrix, for which the conversions run on several threads
+template <typename SparseTensorType>
+static void ConvertLargeMatrix(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<int64_t> shape = {1 << 14, 1000};
+  std::vector<double> values(shape[0] * shape[1]);
+  std::default_random_engine rng(42);
+  std::uniform_int_distribution<int64_t> position(0, values.size() - 1);
+  for (int64_t i = 0; i < static_cast<int64_t>(values.size()) / 100; ++i) {
+    values[position(rng)] = static_cast<double>(i + 1);
+  }
+  Tensor tensor(float64(), Buffer::Wrap(values), shape);
+
+  std::shared_ptr<SparseTensorType> sparse_tensor;
+  for (auto _ : state) {
+    ABORT_NOT_OK(SparseTensorType::Make(tensor, int64()).Value(&sparse_tensor));
+  }
+  benchmark::DoNotOptimize(sparse_tensor);
+  state.SetItemsProcessed(state.iterations() * tensor.size());
+  state.SetBytesProcessed(state.iterations() * tensor.data()->size());
+}
+
+BENCHMARK_TEMPLATE(ConvertLargeMatrix, SparseCOOTensor)->UseRealTime();
+BENCHMARK_TEMPLATE(ConvertLargeMatrix, SparseCSRMatrix)->UseRealTime();
+BENCHMARK_TEMPLATE(ConvertLargeMatrix, SparseCSCMatrix)->UseRealTime();
+BENCHMARK_TEMPLATE(ConvertLargeMatrix, SparseCSFTensor)->UseRealTime();
+
 }  // namespace arrow
@@ -19,6 +19,7 @@
 
 #include <cmath>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -27,7 +28,10 @@
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 
+#include "arrow/array/array_primitive.h"
 #include "arrow/buffer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
@@ -752,4 +756,127 @@ TEST(TestNumericTensor, ElementAccessWithNonContiguousStrides) {
   ASSERT_EQ(11.1f, t_f32.Value({2, 2}));
 }
 
+template <typename CType>
+void AssertTensorFromBatch(const RecordBatch& batch, bool null_to_nan, bool row_major,
+                           const std::shared_ptr<DataType>& expected_type,
+                           std::vector<CType> row_major_values) {
+  ASSERT_OK_AND_ASSIGN(auto tensor, batch.ToTensor(null_to_nan, row_major));
+  ASSERT_OK(tensor->Validate());
+  AssertTypeEqual(*expected_type, *tensor->type());
+  ASSERT_EQ(tensor->shape(),
+            std::vector<int64_t>({batch.num_rows(), batch.num_columns()}));
+  ASSERT_EQ(tensor->is_row_major(), row_major);
+  ASSERT_EQ(tensor->is_column_major(), !row_major || batch.num_columns() == 1);
+  using ArrowType = typename CTypeTraits<CType>::ArrowType;
+  for (int64_t i = 0; i < batch.num_rows(); ++i) {
+    for (int64_t j = 0; j < batch.num_columns(); ++j) {
+      const CType expected = row_major_values[i * batch.num_columns() + j];
+      const CType actual = tensor->Value<ArrowType>({i, j});
+      if (std::isnan(static_cast<double>(expected))) {
+        ASSERT_TRUE(std::isnan(static_cast<double>(actual))) << i << ", " << j;
+      } else {
+        ASSERT_EQ(expected, actual) << i << ", " << j;
+      }
+    }
+  }
+}
+
+TEST(TestRecordBatchToTensor, SameType) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int32()), field("b", int32())}),
+                                   "[[1, 2], [3, 4], [5, 6]]");
+  for (bool row_major : {true, false}) {
+    AssertTensorFromBatch<int32_t>(*batch, /*null_to_nan=*/false, row_major, int32(),
+                                   {1, 2, 3, 4, 5, 6});
+  }
+  AssertTensorFromBatch<double>(*batch->Slice(1), /*null_to_nan=*/true,
+                                /*row_major=*/true, float64(), {3, 4, 5, 6});
+}
+
+TEST(TestRecordBatchToTensor, Promotion) {
+  auto check = [](const std::shared_ptr<DataType>& a, const std::shared_ptr<DataType>& b,
+                  const std::shared_ptr<DataType>& expected) {
+    ARROW_SCOPED_TRACE(a->ToString(), ", ", b->ToString());
+    auto batch = RecordBatchFromJSON(schema({field("a", a), field("b", b)}),
+                                     "[[1, 2], [3, 4]]");
+    ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor());
+    AssertTypeEqual(*expected, *tensor->type());
+  };
+  check(uint8(), uint16(), uint16());
+  check(int8(), int64(), int64());
+  check(uint8(), int8(), int16());
+  check(uint16(), int8(), int32());
+  check(uint32(), int16(), int64());
+  check(uint64(), int64(), float64());
+  check(int16(), float32(), float32());
+  check(int32(), float32(), float64());
+  check(float32(), float64(), float64());
+  check(uint8(), float32(), float32());
+}
+
+TEST(TestRecordBatchToTensor, Nulls) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int16()), field("b", float32())}),
+                                   "[[1, null], [null, 4], [5, 6]]");
+  ASSERT_RAISES(TypeError, batch->ToTensor());
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  for (bool row_major : {true, false}) {
+    AssertTensorFromBatch<float>(*batch, /*null_to_nan=*/true, row_major, float32(),
+                                 {1, nan, nan, 4, 5, 6});
+    AssertTensorFromBatch<float>(*batch->Slice(1), /*null_to_nan=*/true, row_major,
+                                 float32(), {nan, 4, 5, 6});
+  }
+}
+
+TEST(TestRecordBatchToTensor, ZeroCopy) {
+  auto batch = RecordBatchFromJSON(schema({field("a", float64())}), "[[1], [2], [3]]");
+  ASSERT_OK_AND_ASSIGN(auto tensor, batch->Slice(1)->ToTensor());
+  ASSERT_EQ(tensor->data()->data(),
+            batch->column_data(0)->buffers[1]->data() + sizeof(double));
+  AssertTensorFromBatch<double>(*batch->Slice(1), /*null_to_nan=*/false,
+                                /*row_major=*/true, float64(), {2, 3});
+}
+
+TEST(TestRecordBatchToTensor, Parallel) {
+  // Enough rows for several tasks and row blocks, with a remainder
+  constexpr int64_t kNumRows = (1 << 16) + 123;
+  std::vector<int32_t> a(kNumRows);
+  std::vector<double> b(kNumRows);
+  std::vector<uint8_t> c(kNumRows);
+  std::vector<double> expected;
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    a[i] = static_cast<int32_t>(i);
+    b[i] = 0.5 * static_cast<double>(i);
+    c[i] = static_cast<uint8_t>(i);
+    expected.insert(expected.end(), {static_cast<double>(a[i]), b[i],
+                                     static_cast<double>(c[i])});
+  }
+  auto batch = RecordBatch::Make(
+      schema({field("a", int32()), field("b", float64()), field("c", uint8())}),
+      kNumRows,
+      {std::make_shared<Int32Array>(kNumRows, Buffer::Wrap(a)),
+       std::make_shared<DoubleArray>(kNumRows, Buffer::Wrap(b)),
+       std::make_shared<UInt8Array>(kNumRows, Buffer::Wrap(c))});
+  for (bool row_major : {true, false}) {
+    AssertTensorFromBatch<double>(*batch, /*null_to_nan=*/false, row_major, float64(),
+                                  expected);
+  }
+}
+
+TEST(TestRecordBatchToTensor, Table) {
+  auto schema = arrow::schema({field("a", uint8()), field("b", int8())});
+  auto table = TableFromJSON(schema, {"[[1, 2]]", "[[3, -4], [5, 6]]"});
+  ASSERT_OK_AND_ASSIGN(auto tensor, table->ToTensor());
+  ASSERT_OK_AND_ASSIGN(auto batch, table->CombineChunksToBatch());
+  ASSERT_OK_AND_ASSIGN(auto expected, batch->ToTensor());
+  AssertTypeEqual(*int16(), *tensor->type());
+  ASSERT_TRUE(tensor->Equals(*expected));
+  ASSERT_EQ(tensor->Value<Int16Type>({1, 1}), -4);
+}
+
+TEST(TestRecordBatchToTensor, Errors) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int32()), field("b", utf8())}),
+                                   R"([[1, "x"]])");
+  ASSERT_RAISES(TypeError, batch->ToTensor());
+  ASSERT_RAISES(TypeError, RecordBatch::Make(schema({}), 1, ArrayVector{})->ToTensor());
+}
+
 }  // namespace arrow
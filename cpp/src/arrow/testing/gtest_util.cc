@@ -102,7 +102,10 @@ std::vector<Type::type> AllTypeIds() {
           Type::SPARSE_UNION,
           Type::DICTIONARY,
           Type::EXTENSION,
-          Type::INTERVAL_MONTH_DAY_NANO};
+          Type::INTERVAL_MONTH_DAY_NANO,
+          Type::RUN_END_ENCODED,
+          Type::BINARY_VIEW,
+          Type::STRING_VIEW};
 }
 
 template <typename T, typename CompareFunctor>
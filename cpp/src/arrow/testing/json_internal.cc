@@ -388,6 +388,7 @@ class SchemaWriter {
   Status Visit(const BinaryType& type) { return WriteVarBytes("binary", type); }
   Status Visit(const LargeStringType& type) { return WriteVarBytes("largeutf8", type); }
   Status Visit(const LargeBinaryType& type) { return WriteVarBytes("largebinary", type); }
+  Status Visit(const BinaryViewType& type) { return Status::NotImplemented(type.name()); }
   Status Visit(const FixedSizeBinaryType& type) {
     return WritePrimitive("fixedsizebinary", type);
   }
@@ -439,6 +440,10 @@ class SchemaWriter {
 
   Status Visit(const ExtensionType& type) { return Status::NotImplemented(type.name()); }
 
+  Status Visit(const RunEndEncodedType& type) {
+    return Status::NotImplemented(type.name());
+  }
+
  private:
   const Schema& schema_;
   const DictionaryFieldMapper& mapper_;
@@ -699,6 +704,10 @@ class ArrayWriter {
     return Status::OK();
   }
 
+  Status Visit(const BinaryViewArray& array) {
+    return Status::NotImplemented(array.type()->name());
+  }
+
   Status Visit(const DictionaryArray& array) {
     return VisitArrayValues(*array.indices());
   }
@@ -745,6 +754,10 @@ class ArrayWriter {
 
   Status Visit(const ExtensionArray& array) { return VisitArrayValues(*array.storage()); }
 
+  Status Visit(const RunEndEncodedArray& array) {
+    return Status::NotImplemented(array.type()->name());
+  }
+
  private:
   const std::string& name_;
   const Array& array_;
@@ -1320,6 +1333,10 @@ class ArrayReader {
     return FinishBuilder(&builder);
   }
 
+  Status Visit(const BinaryViewType& type) {
+    return Status::NotImplemented(type.name());
+  }
+
   Status Visit(const DayTimeIntervalType& type) {
     DayTimeIntervalBuilder builder(pool_);
 
@@ -1553,6 +1570,10 @@ class ArrayReader {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    return Status::NotImplemented(type.name());
+  }
+
   Status InitializeData(int num_buffers) {
     data_ = std::make_shared<ArrayData>(type_, length_);
     data_->buffers.resize(num_buffers);
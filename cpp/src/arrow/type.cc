@@ -63,6 +63,10 @@ constexpr Type::type StringType::type_id;
 
 constexpr Type::type LargeStringType::type_id;
 
+constexpr Type::type BinaryViewType::type_id;
+
+constexpr Type::type StringViewType::type_id;
+
 constexpr Type::type FixedSizeBinaryType::type_id;
 
 constexpr Type::type StructType::type_id;
@@ -95,6 +99,8 @@ constexpr Type::type DurationType::type_id;
 
 constexpr Type::type DictionaryType::type_id;
 
+constexpr Type::type RunEndEncodedType::type_id;
+
 namespace internal {
 
 struct TypeIdToTypeNameVisitor {
@@ -148,6 +154,8 @@ std::string ToString(Type::type id) {
     TO_STRING_CASE(BINARY)
     TO_STRING_CASE(LARGE_STRING)
     TO_STRING_CASE(LARGE_BINARY)
+    TO_STRING_CASE(BINARY_VIEW)
+    TO_STRING_CASE(STRING_VIEW)
     TO_STRING_CASE(FIXED_SIZE_BINARY)
     TO_STRING_CASE(STRUCT)
     TO_STRING_CASE(LIST)
@@ -157,6 +165,7 @@ std::string ToString(Type::type id) {
     TO_STRING_CASE(DENSE_UNION)
     TO_STRING_CASE(SPARSE_UNION)
     TO_STRING_CASE(DICTIONARY)
+    TO_STRING_CASE(RUN_END_ENCODED)
     TO_STRING_CASE(EXTENSION)
 
 #undef TO_STRING_CASE
@@ -504,6 +513,10 @@ std::string StringType::ToString() const { return "string"; }
 
 std::string LargeStringType::ToString() const { return "large_string"; }
 
+std::string BinaryViewType::ToString() const { return "binary_view"; }
+
+std::string StringViewType::ToString() const { return "string_view"; }
+
 int FixedSizeBinaryType::bit_width() const { return CHAR_BIT * byte_width(); }
 
 Result<std::shared_ptr<DataType>> FixedSizeBinaryType::Make(int32_t byte_width) {
@@ -920,6 +933,39 @@ std::string DictionaryType::ToString() const {
   return ss.str();
 }
 
+// ----------------------------------------------------------------------
+// Run-end encoded type
+
+RunEndEncodedType::RunEndEncodedType(std::shared_ptr<DataType> run_end_type,
+                                     std::shared_ptr<DataType> value_type)
+    : NestedType(Type::RUN_END_ENCODED) {
+  DCHECK(RunEndTypeValid(*run_end_type));
+  children_ = {std::make_shared<Field>("run_ends", std::move(run_end_type), false),
+               std::make_shared<Field>("values", std::move(value_type), true)};
+}
+
+Result<std::shared_ptr<DataType>> RunEndEncodedType::Make(
+    std::shared_ptr<DataType> run_end_type, std::shared_ptr<DataType> value_type) {
+  if (!RunEndTypeValid(*run_end_type)) {
+    return Status::TypeError("Run end type should be int16, int32 or int64, got ",
+                             run_end_type->ToString());
+  }
+  return std::make_shared<RunEndEncodedType>(std::move(run_end_type),
+                                             std::move(value_type));
+}
+
+bool RunEndEncodedType::RunEndTypeValid(const DataType& run_end_type) {
+  return run_end_type.id() == Type::INT16 || run_end_type.id() == Type::INT32 ||
+         run_end_type.id() == Type::INT64;
+}
+
+std::string RunEndEncodedType::ToString() const {
+  std::stringstream ss;
+  ss << this->name() << "<run_ends: " << run_end_type()->ToString()
+     << ", values: " << value_type()->ToString() << ">";
+  return ss.str();
+}
+
 // ----------------------------------------------------------------------
 // Null type
 
@@ -1999,6 +2045,8 @@ PARAMETER_LESS_FINGERPRINT(Binary)
 PARAMETER_LESS_FINGERPRINT(LargeBinary)
 PARAMETER_LESS_FINGERPRINT(String)
 PARAMETER_LESS_FINGERPRINT(LargeString)
+PARAMETER_LESS_FINGERPRINT(BinaryView)
+PARAMETER_LESS_FINGERPRINT(StringView)
 PARAMETER_LESS_FINGERPRINT(Date32)
 PARAMETER_LESS_FINGERPRINT(Date64)
 
@@ -2017,6 +2065,15 @@ std::string DictionaryType::ComputeFingerprint() const {
   return ordered_fingerprint;
 }
 
+std::string RunEndEncodedType::ComputeFingerprint() const {
+  const auto& run_end_fingerprint = run_end_type()->fingerprint();
+  const auto& value_fingerprint = value_type()->fingerprint();
+  if (!value_fingerprint.empty()) {
+    return TypeIdFingerprint(*this) + run_end_fingerprint + value_fingerprint;
+  }
+  return "";
+}
+
 std::string ListType::ComputeFingerprint() const {
   const auto& child_fingerprint = children_[0]->fingerprint();
   if (!child_fingerprint.empty()) {
@@ -2168,6 +2225,8 @@ TYPE_FACTORY(utf8, StringType)
 TYPE_FACTORY(large_utf8, LargeStringType)
 TYPE_FACTORY(binary, BinaryType)
 TYPE_FACTORY(large_binary, LargeBinaryType)
+TYPE_FACTORY(utf8_view, StringViewType)
+TYPE_FACTORY(binary_view, BinaryViewType)
 TYPE_FACTORY(date64, Date64Type)
 TYPE_FACTORY(date32, Date32Type)
 
@@ -2310,6 +2369,12 @@ std::shared_ptr<DataType> dictionary(const std::shared_ptr<DataType>& index_type
   return std::make_shared<DictionaryType>(index_type, dict_type, ordered);
 }
 
+std::shared_ptr<DataType> run_end_encoded(std::shared_ptr<DataType> run_end_type,
+                                          std::shared_ptr<DataType> value_type) {
+  return std::make_shared<RunEndEncodedType>(std::move(run_end_type),
+                                             std::move(value_type));
+}
+
 std::shared_ptr<Field> field(std::string name, std::shared_ptr<DataType> type,
                              bool nullable,
                              std::shared_ptr<const KeyValueMetadata> metadata) {
@@ -697,6 +697,81 @@ class ARROW_EXPORT LargeStringType : public LargeBinaryType {
   std::string ComputeFingerprint() const override;
 };
 
+/// \brief Concrete type class for variable-size binary view data
+///
+/// Each value is described by a 16-byte view holding its size.  Values of
+/// up to 12 bytes are stored entirely in the view; longer values keep their
+/// first 4 bytes in the view and point into the data buffer for the rest.
+/// Selecting values therefore only moves views, and comparisons can often
+/// be decided from the prefix alone.
+///
+/// Arrays have a validity bitmap, a views buffer and a single data buffer
+/// (which may be absent if all values are inlined).  The unused bytes of
+/// inlined views are zero, so that they can be compared bitwise.
+class ARROW_EXPORT BinaryViewType : public DataType {
+ public:
+  static constexpr Type::type type_id = Type::BINARY_VIEW;
+  static constexpr bool is_utf8 = false;
+  using PhysicalType = BinaryViewType;
+
+  static constexpr int kSize = 16;
+  static constexpr int kInlineSize = 12;
+  static constexpr int kPrefixSize = 4;
+
+  /// \brief The 16-byte view of a value
+  union c_type {
+    struct {
+      int32_t size;
+      uint8_t data[kInlineSize];
+    } inlined;
+    struct {
+      int32_t size;
+      uint8_t prefix[kPrefixSize];
+      int32_t buffer_index;
+      int32_t offset;
+    } ref;
+
+    int32_t size() const { return inlined.size; }
+    bool is_inline() const { return inlined.size <= kInlineSize; }
+  };
+
+  static constexpr const char* type_name() { return "binary_view"; }
+
+  BinaryViewType() : BinaryViewType(Type::BINARY_VIEW) {}
+
+  DataTypeLayout layout() const override {
+    return DataTypeLayout({DataTypeLayout::Bitmap(), DataTypeLayout::FixedWidth(kSize),
+                           DataTypeLayout::VariableWidth()});
+  }
+
+  std::string ToString() const override;
+  std::string name() const override { return "binary_view"; }
+
+ protected:
+  std::string ComputeFingerprint() const override;
+
+  // Allow subclasses like StringViewType to change the logical type.
+  explicit BinaryViewType(Type::type logical_type) : DataType(logical_type) {}
+};
+
+/// \brief Concrete type class for variable-size string view data, utf8-encoded
+class ARROW_EXPORT StringViewType : public BinaryViewType {
+ public:
+  static constexpr Type::type type_id = Type::STRING_VIEW;
+  static constexpr bool is_utf8 = true;
+  using PhysicalType = BinaryViewType;
+
+  static constexpr const char* type_name() { return "utf8_view"; }
+
+  StringViewType() : BinaryViewType(Type::STRING_VIEW) {}
+
+  std::string ToString() const override;
+  std::string name() const override { return "utf8_view"; }
+
+ protected:
+  std::string ComputeFingerprint() const override;
+};
+
 /// \brief Concrete type class for fixed-size binary data
 class ARROW_EXPORT FixedSizeBinaryType : public FixedWidthType, public ParametricType {
  public:
@@ -1523,6 +1598,48 @@ class ARROW_EXPORT DictionaryType : public FixedWidthType {
   bool ordered_;
 };
 
+// ----------------------------------------------------------------------
+// Run-end encoded type
+
+/// \brief Run-end encoded value type.
+///
+/// Consecutive equal values are stored once. The "run_ends" child holds, for
+/// each run, the logical index one past its last element, and the "values"
+/// child holds the value of each run. Run ends are represented by int16, int32
+/// or int64. Nulls are represented by null values, run-end encoded arrays
+/// have no validity bitmap of their own.
+class ARROW_EXPORT RunEndEncodedType : public NestedType {
+ public:
+  static constexpr Type::type type_id = Type::RUN_END_ENCODED;
+
+  static constexpr const char* type_name() { return "run_end_encoded"; }
+
+  RunEndEncodedType(std::shared_ptr<DataType> run_end_type,
+                    std::shared_ptr<DataType> value_type);
+
+  // A constructor variant that validates its input parameters
+  static Result<std::shared_ptr<DataType>> Make(std::shared_ptr<DataType> run_end_type,
+                                                std::shared_ptr<DataType> value_type);
+
+  DataTypeLayout layout() const override {
+    // Only the (always null) validity slot, the data lives in the children
+    return DataTypeLayout({DataTypeLayout::AlwaysNull()});
+  }
+
+  const std::shared_ptr<DataType>& run_end_type() const { return fields()[0]->type(); }
+  const std::shared_ptr<DataType>& value_type() const { return fields()[1]->type(); }
+
+  std::string ToString() const override;
+
+  std::string name() const override { return "run_end_encoded"; }
+
+  /// \brief Whether the given type can be used to represent run ends
+  static bool RunEndTypeValid(const DataType& run_end_type);
+
+ protected:
+  std::string ComputeFingerprint() const override;
+};
+
 // ----------------------------------------------------------------------
 // FieldRef
 
@@ -2046,6 +2163,7 @@ static inline bool HasValidityBitmap(Type::type id) {
     case Type::NA:
     case Type::DENSE_UNION:
     case Type::SPARSE_UNION:
+    case Type::RUN_END_ENCODED:
       return false;
     default:
       return true;
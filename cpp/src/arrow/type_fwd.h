@@ -91,6 +91,10 @@ class DictionaryType;
 class DictionaryArray;
 struct DictionaryScalar;
 
+class RunEndEncodedType;
+class RunEndEncodedArray;
+struct RunEndEncodedScalar;
+
 class NullType;
 class NullArray;
 class NullBuilder;
@@ -128,6 +132,16 @@ class LargeStringArray;
 class LargeStringBuilder;
 struct LargeStringScalar;
 
+class BinaryViewType;
+class BinaryViewArray;
+class BinaryViewBuilder;
+struct BinaryViewScalar;
+
+class StringViewType;
+class StringViewArray;
+class StringViewBuilder;
+struct StringViewScalar;
+
 class ListType;
 class ListArray;
 class ListBuilder;
@@ -405,6 +419,18 @@ struct Type {
     /// Calendar interval type with three fields.
     INTERVAL_MONTH_DAY_NANO,
 
+    /// Run-end encoded data: runs of equal values, stored once per run
+    /// along with the logical index at which each run ends
+    RUN_END_ENCODED,
+
+    /// Like BINARY, but with 16-byte views inlining short values and
+    /// prefixing the others
+    BINARY_VIEW,
+
+    /// Like STRING, but with 16-byte views inlining short values and
+    /// prefixing the others
+    STRING_VIEW,
+
     // Leave this at the end
     MAX_ID
   };
@@ -449,6 +475,10 @@ std::shared_ptr<DataType> ARROW_EXPORT large_utf8();
 std::shared_ptr<DataType> ARROW_EXPORT binary();
 /// \brief Return a LargeBinaryType instance
 std::shared_ptr<DataType> ARROW_EXPORT large_binary();
+/// \brief Return a StringViewType instance
+std::shared_ptr<DataType> ARROW_EXPORT utf8_view();
+/// \brief Return a BinaryViewType instance
+std::shared_ptr<DataType> ARROW_EXPORT binary_view();
 /// \brief Return a Date32Type instance
 std::shared_ptr<DataType> ARROW_EXPORT date32();
 /// \brief Return a Date64Type instance
@@ -574,6 +604,14 @@ std::shared_ptr<DataType> dictionary(const std::shared_ptr<DataType>& index_type
                                      const std::shared_ptr<DataType>& dict_type,
                                      bool ordered = false);
 
+/// \brief Create a RunEndEncodedType instance
+/// \param[in] run_end_type the type of the run ends (must be int16, int32
+/// or int64)
+/// \param[in] value_type the type of the run values
+ARROW_EXPORT
+std::shared_ptr<DataType> run_end_encoded(std::shared_ptr<DataType> run_end_type,
+                                          std::shared_ptr<DataType> value_type);
+
 /// @}
 
 /// \defgroup schema-factories Factory functions for fields and schemas
@@ -57,6 +57,8 @@ TYPE_ID_TRAIT(STRING, StringType)
 TYPE_ID_TRAIT(BINARY, BinaryType)
 TYPE_ID_TRAIT(LARGE_STRING, LargeStringType)
 TYPE_ID_TRAIT(LARGE_BINARY, LargeBinaryType)
+TYPE_ID_TRAIT(BINARY_VIEW, BinaryViewType)
+TYPE_ID_TRAIT(STRING_VIEW, StringViewType)
 TYPE_ID_TRAIT(FIXED_SIZE_BINARY, FixedSizeBinaryType)
 TYPE_ID_TRAIT(DATE32, Date32Type)
 TYPE_ID_TRAIT(DATE64, Date64Type)
@@ -77,6 +79,7 @@ TYPE_ID_TRAIT(MAP, MapType)
 TYPE_ID_TRAIT(DENSE_UNION, DenseUnionType)
 TYPE_ID_TRAIT(SPARSE_UNION, SparseUnionType)
 TYPE_ID_TRAIT(DICTIONARY, DictionaryType)
+TYPE_ID_TRAIT(RUN_END_ENCODED, RunEndEncodedType)
 TYPE_ID_TRAIT(EXTENSION, ExtensionType)
 
 #undef TYPE_ID_TRAIT
@@ -125,6 +128,16 @@ struct TypeTraits<BooleanType> {
   constexpr static bool is_parameter_free = true;
   static inline std::shared_ptr<DataType> type_singleton() { return boolean(); }
 };
+template <>
+struct TypeTraits<StringViewType> {
+  using ArrayType = StringViewArray;
+  using BuilderType = StringViewBuilder;
+  using ScalarType = StringViewScalar;
+  using CType = BinaryViewType::c_type;
+  constexpr static bool is_parameter_free = true;
+  static inline std::shared_ptr<DataType> type_singleton() { return utf8_view(); }
+};
+
 /// @}
 
 /// \addtogroup c-type-traits
@@ -351,6 +364,16 @@ struct TypeTraits<LargeBinaryType> {
   static inline std::shared_ptr<DataType> type_singleton() { return large_binary(); }
 };
 
+template <>
+struct TypeTraits<BinaryViewType> {
+  using ArrayType = BinaryViewArray;
+  using BuilderType = BinaryViewBuilder;
+  using ScalarType = BinaryViewScalar;
+  using CType = BinaryViewType::c_type;
+  constexpr static bool is_parameter_free = true;
+  static inline std::shared_ptr<DataType> type_singleton() { return binary_view(); }
+};
+
 template <>
 struct TypeTraits<FixedSizeBinaryType> {
   using ArrayType = FixedSizeBinaryArray;
@@ -492,6 +515,13 @@ struct TypeTraits<DictionaryType> {
   constexpr static bool is_parameter_free = false;
 };
 
+template <>
+struct TypeTraits<RunEndEncodedType> {
+  using ArrayType = RunEndEncodedArray;
+  using ScalarType = RunEndEncodedScalar;
+  constexpr static bool is_parameter_free = false;
+};
+
 template <>
 struct TypeTraits<ExtensionType> {
   using ArrayType = ExtensionArray;
@@ -605,6 +635,13 @@ using is_string_type =
 template <typename T, typename R = void>
 using enable_if_string = enable_if_t<is_string_type<T>::value, R>;
 
+// Binary view refers to BinaryView/StringView
+template <typename T>
+using is_binary_view_like_type = std::is_base_of<BinaryViewType, T>;
+
+template <typename T, typename R = void>
+using enable_if_binary_view_like = enable_if_t<is_binary_view_like_type<T>::value, R>;
+
 template <typename T>
 using is_string_like_type =
     std::integral_constant<bool, is_base_binary_type<T>::value && T::is_utf8>;
@@ -755,6 +792,12 @@ using is_dictionary_type = std::is_base_of<DictionaryType, T>;
 template <typename T, typename R = void>
 using enable_if_dictionary = enable_if_t<is_dictionary_type<T>::value, R>;
 
+template <typename T>
+using is_run_end_encoded_type = std::is_base_of<RunEndEncodedType, T>;
+
+template <typename T, typename R = void>
+using enable_if_run_end_encoded = enable_if_t<is_run_end_encoded_type<T>::value, R>;
+
 template <typename T>
 using is_extension_type = std::is_base_of<ExtensionType, T>;
 
@@ -782,6 +825,8 @@ using has_string_view =
                                      std::is_same<LargeBinaryType, T>::value ||
                                      std::is_same<StringType, T>::value ||
                                      std::is_same<LargeStringType, T>::value ||
+                                     std::is_same<BinaryViewType, T>::value ||
+                                     std::is_same<StringViewType, T>::value ||
                                      std::is_same<FixedSizeBinaryType, T>::value>;
 
 template <typename T, typename R = void>
@@ -977,10 +1022,25 @@ static inline bool is_large_binary_like(Type::type type_id) {
   return false;
 }
 
+static inline bool is_binary_view_like(Type::type type_id) {
+  switch (type_id) {
+    case Type::BINARY_VIEW:
+    case Type::STRING_VIEW:
+      return true;
+    default:
+      break;
+  }
+  return false;
+}
+
 static inline bool is_dictionary(Type::type type_id) {
   return type_id == Type::DICTIONARY;
 }
 
+static inline bool is_run_end_encoded(Type::type type_id) {
+  return type_id == Type::RUN_END_ENCODED;
+}
+
 static inline bool is_fixed_size_binary(Type::type type_id) {
   switch (type_id) {
     case Type::DECIMAL128:
@@ -1054,6 +1114,7 @@ static inline bool is_nested(Type::type type_id) {
     case Type::STRUCT:
     case Type::SPARSE_UNION:
     case Type::DENSE_UNION:
+    case Type::RUN_END_ENCODED:
       return true;
     default:
       break;
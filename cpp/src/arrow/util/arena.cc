@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/arena.h"
+
+#include <algorithm>
+
+#include "arrow/buffer.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace util {
+
+constexpr int64_t Arena::kDefaultChunkSize;
+constexpr int64_t Arena::kDefaultMaxRetainedSize;
+
+namespace {
+
+constexpr int64_t kArenaAlignment = 64;
+
+}  // namespace
+
+Arena::Arena(MemoryPool* pool, int64_t chunk_size, int64_t max_retained_size)
+    : pool_(pool),
+      chunk_size_(bit_util::RoundUp(std::max<int64_t>(chunk_size, 1), kArenaAlignment)),
+      max_retained_size_(max_retained_size) {}
+
+Arena::~Arena() = default;
+
+Status Arena::AddChunk(int64_t min_size) {
+  // Grow geometrically, up to the retained size, so that the chunks stay few
+  const int64_t chunk_size = std::max({min_size, chunk_size_,
+                                       std::min(capacity_, max_retained_size_),
+                                       coalesced_size_});
+  coalesced_size_ = 0;
+  ARROW_ASSIGN_OR_RAISE(auto chunk, AllocateBuffer(chunk_size, pool_));
+  const size_t index = chunks_.empty() ? 0 : current_ + 1;
+  chunks_.insert(chunks_.begin() + index, std::move(chunk));
+  capacity_ += chunk_size;
+  current_ = index;
+  offset_ = 0;
+  return Status::OK();
+}
+
+Result<uint8_t*> Arena::Allocate(int64_t size) {
+  if (ARROW_PREDICT_FALSE(size < 0)) {
+    return Status::Invalid("Negative arena allocation size: ", size);
+  }
+  // Keep all offsets aligned, chunks themselves are
+  size = bit_util::RoundUp(size, kArenaAlignment);
+  if (chunks_.empty() || offset_ + size > chunks_[current_]->size()) {
+    if (current_ + 1 < chunks_.size() && size <= chunks_[current_ + 1]->size()) {
+      // Reuse the next chunk, which was kept after a rewind
+      ++current_;
+      offset_ = 0;
+    } else {
+      RETURN_NOT_OK(AddChunk(size));
+    }
+  }
+  uint8_t* data = chunks_[current_]->mutable_data() + offset_;
+  offset_ += size;
+  bytes_allocated_ += size;
+  return data;
+}
+
+void Arena::Rewind(const Position& position) {
+  DCHECK_LE(position.bytes_allocated, bytes_allocated_);
+  current_ = position.chunk;
+  offset_ = position.offset;
+  bytes_allocated_ = position.bytes_allocated;
+  if (bytes_allocated_ == 0 && (chunks_.size() > 1 || capacity_ > max_retained_size_)) {
+    // Replace the chunks with a single one, up to the retained size,
+    // on the next allocation
+    coalesced_size_ = std::min(capacity_, max_retained_size_);
+    chunks_.clear();
+    capacity_ = 0;
+    current_ = 0;
+    offset_ = 0;
+  }
+}
+
+Arena* Arena::ThreadLocal() {
+  static thread_local Arena arena;
+  return &arena;
+}
+
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace util {
+
+/// \brief A bump allocator for short-lived scratch memory
+///
+/// Allocations are carved out of chunks allocated from a MemoryPool, and are all
+/// released at once by rewinding the arena to an earlier position, usually through
+/// an ArenaScope.  Chunks are kept across rewinds, and coalesced into a single one
+/// once the arena is empty, so that a steady-state workload (e.g. the temporaries
+/// of a kernel processing one batch after another) does not allocate at all.
+///
+/// An Arena is not thread-safe; ThreadLocal() returns one for the calling thread.
+class ARROW_EXPORT Arena {
+ public:
+  static constexpr int64_t kDefaultChunkSize = 64 << 10;
+  static constexpr int64_t kDefaultMaxRetainedSize = 16 << 20;
+
+  /// A point in the allocation history of an arena
+  struct Position {
+    size_t chunk;
+    int64_t offset;
+    int64_t bytes_allocated;
+  };
+
+  /// \param[in] pool the pool to allocate chunks from
+  /// \param[in] chunk_size the minimum size of a chunk
+  /// \param[in] max_retained_size the maximum capacity kept once the arena is empty
+  explicit Arena(MemoryPool* pool = default_memory_pool(),
+                 int64_t chunk_size = kDefaultChunkSize,
+                 int64_t max_retained_size = kDefaultMaxRetainedSize);
+  ~Arena();
+
+  /// \brief Allocate uninitialized memory, aligned on 64 bytes
+  Result<uint8_t*> Allocate(int64_t size);
+
+  /// \brief Allocate an uninitialized array of `length` values
+  template <typename T>
+  Result<T*> AllocateArray(int64_t length) {
+    ARROW_ASSIGN_OR_RAISE(uint8_t * data,
+                          Allocate(length * static_cast<int64_t>(sizeof(T))));
+    return reinterpret_cast<T*>(data);
+  }
+
+  Position position() const { return {current_, offset_, bytes_allocated_}; }
+
+  /// \brief Release all allocations made since `position` was taken
+  void Rewind(const Position& position);
+
+  /// \brief Release all allocations
+  void Reset() { Rewind({0, 0, 0}); }
+
+  /// \brief The number of bytes allocated and not released
+  int64_t bytes_allocated() const { return bytes_allocated_; }
+
+  /// \brief The total size of the chunks held
+  int64_t capacity() const { return capacity_; }
+
+  /// \brief Return the arena of the calling thread, allocating from the default pool
+  static Arena* ThreadLocal();
+
+ private:
+  Status AddChunk(int64_t min_size);
+
+  MemoryPool* pool_;
+  const int64_t chunk_size_;
+  const int64_t max_retained_size_;
+  std::vector<std::unique_ptr<Buffer>> chunks_;
+  size_t current_ = 0;
+  int64_t offset_ = 0;
+  int64_t bytes_allocated_ = 0;
+  int64_t capacity_ = 0;
+  // After coalescing, the size of the single chunk to allocate next
+  int64_t coalesced_size_ = 0;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(Arena);
+};
+
+/// \brief Scoped scratch allocations from an Arena
+///
+/// The memory allocated through the scope is released when it is destroyed.
+/// Scopes on the same arena must be destroyed in the reverse order of their
+/// creation, as is natural for local variables.
+class ArenaScope {
+ public:
+  explicit ArenaScope(Arena* arena = Arena::ThreadLocal())
+      : arena_(arena), position_(arena->position()) {}
+  ~ArenaScope() { arena_->Rewind(position_); }
+
+  Result<uint8_t*> Allocate(int64_t size) { return arena_->Allocate(size); }
+
+  template <typename T>
+  Result<T*> AllocateArray(int64_t length) {
+    return arena_->AllocateArray<T>(length);
+  }
+
+  Arena* arena() const { return arena_; }
+
+ private:
+  Arena* arena_;
+  const Arena::Position position_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ArenaScope);
+};
+
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "arrow/memory_pool.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/arena.h"
+
+namespace arrow {
+namespace util {
+
+TEST(Arena, Allocate) {
+  ProxyMemoryPool pool(default_memory_pool());
+  Arena arena(&pool, /*chunk_size=*/1024);
+  ASSERT_EQ(0, arena.capacity());
+
+  ASSERT_OK_AND_ASSIGN(uint8_t* a, arena.Allocate(100));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(a) % 64);
+  ASSERT_OK_AND_ASSIGN(uint8_t* b, arena.Allocate(1));
+  ASSERT_EQ(a + 128, b);
+  ASSERT_EQ(192, arena.bytes_allocated());
+  ASSERT_EQ(1024, arena.capacity());
+  ASSERT_EQ(1024, pool.bytes_allocated());
+
+  // Doesn't fit in the current chunk
+  ASSERT_OK_AND_ASSIGN(uint8_t* c, arena.Allocate(2000));
+  std::memset(c, 0, 2000);
+  ASSERT_EQ(1024 + 2048, arena.capacity());
+  ASSERT_OK_AND_ASSIGN(auto d, arena.AllocateArray<int64_t>(10));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(d) % 64);
+
+  ASSERT_RAISES(Invalid, arena.Allocate(-1));
+}
+
+TEST(Arena, Rewind) {
+  ProxyMemoryPool pool(default_memory_pool());
+  Arena arena(&pool, /*chunk_size=*/1024);
+
+  ASSERT_OK_AND_ASSIGN(uint8_t* a, arena.Allocate(512));
+  const auto position = arena.position();
+  ASSERT_OK_AND_ASSIGN(uint8_t* b, arena.Allocate(512));
+  ASSERT_OK_AND_ASSIGN(uint8_t* c, arena.Allocate(512));
+  ASSERT_EQ(1536, arena.bytes_allocated());
+
+  // Memory is handed out again, without allocating
+  arena.Rewind(position);
+  ASSERT_EQ(512, arena.bytes_allocated());
+  const int64_t capacity = arena.capacity();
+  ASSERT_OK_AND_ASSIGN(uint8_t* b2, arena.Allocate(512));
+  ASSERT_OK_AND_ASSIGN(uint8_t* c2, arena.Allocate(512));
+  ASSERT_EQ(b, b2);
+  ASSERT_EQ(c, c2);
+  ASSERT_EQ(capacity, arena.capacity());
+  ASSERT_NE(a, c);
+
+  // Once empty, the chunks are coalesced into one
+  arena.Reset();
+  ASSERT_EQ(0, arena.bytes_allocated());
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_OK(arena.Allocate(1500));
+  ASSERT_EQ(capacity, arena.capacity());
+  ASSERT_OK(arena.Allocate(500));
+  ASSERT_EQ(capacity, arena.capacity());
+  ASSERT_EQ(capacity, pool.bytes_allocated());
+}
+
+TEST(Arena, MaxRetainedSize) {
+  ProxyMemoryPool pool(default_memory_pool());
+  Arena arena(&pool, /*chunk_size=*/1024, /*max_retained_size=*/4096);
+
+  ASSERT_OK(arena.Allocate(100000));
+  arena.Reset();
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_OK(arena.Allocate(10));
+  ASSERT_EQ(4096, arena.capacity());
+}
+
+TEST(ArenaScope, Nested) {
+  Arena arena(default_memory_pool(), /*chunk_size=*/1024);
+  {
+    ArenaScope outer(&arena);
+    ASSERT_OK_AND_ASSIGN(auto a, outer.AllocateArray<int32_t>(100));
+    {
+      ArenaScope inner(&arena);
+      ASSERT_OK_AND_ASSIGN(auto b, inner.AllocateArray<int32_t>(1000));
+      ASSERT_NE(a, b);
+      ASSERT_EQ(448 + 4032, arena.bytes_allocated());
+    }
+    ASSERT_EQ(448, arena.bytes_allocated());
+  }
+  ASSERT_EQ(0, arena.bytes_allocated());
+}
+
+TEST(ArenaScope, ThreadLocal) {
+  Arena* arena = Arena::ThreadLocal();
+  ASSERT_EQ(arena, Arena::ThreadLocal());
+  Arena* other_arena = nullptr;
+  std::thread([&] { other_arena = Arena::ThreadLocal(); }).join();
+  ASSERT_NE(arena, other_arena);
+
+  ArenaScope scope;
+  ASSERT_EQ(arena, scope.arena());
+  ASSERT_OK(scope.Allocate(10));
+}
+
+}  // namespace util
+}  // namespace arrow
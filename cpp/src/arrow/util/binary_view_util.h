@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Helpers for working with binary view array data
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/type.h"
+#include "arrow/util/string_view.h"
+
+namespace arrow {
+namespace binary_view_util {
+
+using View = BinaryViewType::c_type;
+
+static_assert(sizeof(View) == BinaryViewType::kSize, "unexpected binary view size");
+
+/// \brief Make a view of a value, inlining it if it is short enough
+///
+/// `offset` is the position of the value in the data buffer; it is only
+/// recorded if the value is not inlined.  Unused bytes are zeroed, so that
+/// views of equal inlined values are bitwise equal.
+inline View MakeView(const uint8_t* data, int32_t size, int32_t offset) {
+  View view;
+  std::memset(&view, 0, sizeof(view));
+  view.inlined.size = size;
+  if (size <= BinaryViewType::kInlineSize) {
+    if (size > 0) {
+      std::memcpy(view.inlined.data, data, size);
+    }
+  } else {
+    std::memcpy(view.ref.prefix, data, BinaryViewType::kPrefixSize);
+    view.ref.buffer_index = 0;
+    view.ref.offset = offset;
+  }
+  return view;
+}
+
+/// \brief Get a pointer to the bytes of a value
+///
+/// `data` is the data buffer of the array (it is not accessed for inlined
+/// values).
+inline const uint8_t* ViewData(const View& view, const uint8_t* data) {
+  return view.is_inline() ? view.inlined.data : data + view.ref.offset;
+}
+
+/// \brief Get a value as a string_view
+///
+/// Note the returned string_view points into `view` for inlined values, and
+/// must not outlive it.
+inline util::string_view FromView(const View& view, const uint8_t* data) {
+  return util::string_view(reinterpret_cast<const char*>(ViewData(view, data)),
+                           view.size());
+}
+
+/// \brief Compare two values for equality
+///
+/// The sizes and prefixes are compared at once, the remaining bytes are
+/// only looked at when they match.
+inline bool EqualViews(const View& left, const uint8_t* left_data, const View& right,
+                       const uint8_t* right_data) {
+  const auto* left_words = reinterpret_cast<const uint64_t*>(&left);
+  const auto* right_words = reinterpret_cast<const uint64_t*>(&right);
+  if (left_words[0] != right_words[0]) {
+    return false;
+  }
+  if (left.is_inline()) {
+    return left_words[1] == right_words[1];
+  }
+  constexpr int kPrefixSize = BinaryViewType::kPrefixSize;
+  return std::memcmp(left_data + left.ref.offset + kPrefixSize,
+                     right_data + right.ref.offset + kPrefixSize,
+                     left.size() - kPrefixSize) == 0;
+}
+
+/// \brief Three-way compare two values in lexicographic byte order
+///
+/// Returns a negative value, zero or a positive value if `left` is
+/// respectively less than, equal to or greater than `right`.  The prefixes
+/// decide most comparisons without accessing the data buffers.
+inline int CompareViews(const View& left, const uint8_t* left_data, const View& right,
+                        const uint8_t* right_data) {
+  constexpr int kPrefixSize = BinaryViewType::kPrefixSize;
+  const int32_t min_size = std::min(left.size(), right.size());
+  // For either form, the first bytes of the value follow the size
+  const int prefix_size = std::min<int32_t>(min_size, kPrefixSize);
+  int cmp = std::memcmp(left.inlined.data, right.inlined.data, prefix_size);
+  if (cmp == 0 && min_size > kPrefixSize) {
+    cmp = std::memcmp(ViewData(left, left_data) + kPrefixSize,
+                      ViewData(right, right_data) + kPrefixSize, min_size - kPrefixSize);
+  }
+  if (cmp != 0) {
+    return cmp;
+  }
+  return left.size() < right.size() ? -1 : (left.size() > right.size() ? 1 : 0);
+}
+
+}  // namespace binary_view_util
+}  // namespace arrow
@@ -346,10 +346,7 @@ inline int BitReader::GetBatch(int num_bits, T* v, int batch_size) {
                            reinterpret_cast<uint32_t*>(v + i), batch_size - i, num_bits);
     i += num_unpacked;
     byte_offset += num_unpacked * num_bits / 8;
-  } else if (sizeof(T) == 8 && num_bits > 32) {
-    // Use unpack64 only if num_bits is larger than 32
-    // TODO (ARROW-13677): improve the performance of internal::unpack64
-    // and remove the restriction of num_bits
+  } else if (sizeof(T) == 8) {
     int num_unpacked =
         internal::unpack64(buffer + byte_offset, reinterpret_cast<uint64_t*>(v + i),
                            batch_size - i, num_bits);
@@ -24,6 +24,7 @@
 #include <cstring>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_primitive.h"
@@ -41,6 +42,7 @@
 #include "arrow/util/bitmap_reader.h"
 #include "arrow/util/bitmap_visit.h"
 #include "arrow/util/bitmap_writer.h"
+#include "arrow/util/bpacking.h"
 
 namespace arrow {
 namespace bit_util {
@@ -190,6 +192,86 @@ static void BenchmarkBitmapVisitUInt64And(benchmark::State& state) {
   });
 }
 
+static void BenchmarkBitmapOr(benchmark::State& state) {
+  BenchmarkAndImpl(state, [](const internal::Bitmap(&bitmaps)[2], internal::Bitmap* out) {
+    internal::BitmapOr(bitmaps[0].data(), bitmaps[0].offset(), bitmaps[1].data(),
+                       bitmaps[1].offset(), bitmaps[0].length(), 0, out->mutable_data());
+  });
+}
+
+static void BenchmarkBitmapAndNot(benchmark::State& state) {
+  BenchmarkAndImpl(state, [](const internal::Bitmap(&bitmaps)[2], internal::Bitmap* out) {
+    internal::BitmapAndNot(bitmaps[0].data(), bitmaps[0].offset(), bitmaps[1].data(),
+                           bitmaps[1].offset(), bitmaps[0].length(), 0,
+                           out->mutable_data());
+  });
+}
+
+static void BenchmarkBitmapKleeneAnd(benchmark::State& state) {
+  int64_t nbytes = state.range(0);
+  int64_t offset = state.range(1);
+
+  std::shared_ptr<Buffer> left_valid = CreateRandomBuffer(nbytes);
+  std::shared_ptr<Buffer> left_data = CreateRandomBuffer(nbytes);
+  std::shared_ptr<Buffer> right_valid = CreateRandomBuffer(nbytes);
+  std::shared_ptr<Buffer> right_data = CreateRandomBuffer(nbytes);
+  std::shared_ptr<Buffer> out_valid = CreateRandomBuffer(nbytes);
+  std::shared_ptr<Buffer> out_data = CreateRandomBuffer(nbytes);
+
+  const int64_t num_bits = nbytes * 8 - offset;
+
+  for (auto _ : state) {
+    internal::BitmapKleeneAnd(left_valid->data(), left_data->data(), 0,
+                              right_valid->data(), right_data->data(), offset, num_bits,
+                              0, out_valid->mutable_data(), out_data->mutable_data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * nbytes);
+}
+
+static void BenchmarkCountSetBits(benchmark::State& state) {
+  int64_t nbytes = state.range(0);
+  int64_t offset = state.range(1);
+
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(nbytes);
+  const int64_t num_bits = nbytes * 8 - offset;
+
+  for (auto _ : state) {
+    auto total = internal::CountSetBits(buffer->data(), offset, num_bits);
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetBytesProcessed(state.iterations() * nbytes);
+}
+
+static void BenchmarkUnpack32(benchmark::State& state) {
+  const int num_bits = static_cast<int>(state.range(0));
+  const int num_values = kBufferSize;
+
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(num_values * sizeof(uint32_t));
+  std::vector<uint32_t> out(num_values);
+
+  for (auto _ : state) {
+    auto unpacked = internal::unpack32(reinterpret_cast<const uint32_t*>(buffer->data()),
+                                       out.data(), num_values, num_bits);
+    benchmark::DoNotOptimize(unpacked);
+  }
+  state.SetItemsProcessed(state.iterations() * num_values);
+}
+
+static void BenchmarkUnpack64(benchmark::State& state) {
+  const int num_bits = static_cast<int>(state.range(0));
+  const int num_values = kBufferSize;
+
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(num_values * sizeof(uint64_t));
+  std::vector<uint64_t> out(num_values);
+
+  for (auto _ : state) {
+    auto unpacked = internal::unpack64(buffer->data(), out.data(), num_values, num_bits);
+    benchmark::DoNotOptimize(unpacked);
+  }
+  state.SetItemsProcessed(state.iterations() * num_values);
+}
+
 template <typename BitmapReaderType>
 static void BenchmarkBitmapReader(benchmark::State& state, int64_t nbytes) {
   std::shared_ptr<Buffer> buffer = CreateRandomBuffer(nbytes);
@@ -549,9 +631,17 @@ BENCHMARK(BitmapEqualsWithOffset)->Arg(kBufferSize);
     {kBufferSize * 4, kBufferSize * 16}, { 0, 2 } \
   }
 BENCHMARK(BenchmarkBitmapAnd)->Ranges(AND_BENCHMARK_RANGES);
+BENCHMARK(BenchmarkBitmapOr)->Ranges(AND_BENCHMARK_RANGES);
+BENCHMARK(BenchmarkBitmapAndNot)->Ranges(AND_BENCHMARK_RANGES);
+BENCHMARK(BenchmarkBitmapKleeneAnd)->Ranges(AND_BENCHMARK_RANGES);
+BENCHMARK(BenchmarkCountSetBits)->Ranges(AND_BENCHMARK_RANGES);
 BENCHMARK(BenchmarkBitmapVisitBitsetAnd)->Ranges(AND_BENCHMARK_RANGES);
 BENCHMARK(BenchmarkBitmapVisitUInt8And)->Ranges(AND_BENCHMARK_RANGES);
 BENCHMARK(BenchmarkBitmapVisitUInt64And)->Ranges(AND_BENCHMARK_RANGES);
 
+BENCHMARK(BenchmarkUnpack32)->Arg(1)->Arg(8)->Arg(13)->Arg(16)->Arg(24)->Arg(32);
+BENCHMARK(BenchmarkUnpack64)
+    ->Arg(1)->Arg(8)->Arg(13)->Arg(16)->Arg(32)->Arg(33)->Arg(48)->Arg(64);
+
 }  // namespace bit_util
 }  // namespace arrow
@@ -52,12 +52,16 @@
 #include "arrow/util/bitmap_writer.h"
 #include "arrow/util/bitset_stack.h"
 #include "arrow/util/endian.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/ubsan.h"
 
 namespace arrow {
 
 using internal::BitmapAnd;
 using internal::BitmapAndNot;
+using internal::BitmapKleeneAnd;
+using internal::BitmapKleeneAndNot;
+using internal::BitmapKleeneOr;
 using internal::BitmapOr;
 using internal::BitmapXor;
 using internal::BitsetStack;
@@ -1465,6 +1469,92 @@ TEST_F(BitmapOp, RandomXor) {
   }
 }
 
+class BitmapKleeneOp : public ::testing::Test {
+ protected:
+  // Compare a Kleene op over random bitmaps, with and without validity
+  // bitmaps, against a bit-by-bit evaluation of `expected`
+  template <typename KleeneFunc, typename ExpectedFunc>
+  void TestRandom(KleeneFunc&& kleene_func, ExpectedFunc&& expected) {
+    const int kBitCount = 3000;
+    const int kBytes = kBitCount / 8 + 2;
+    std::vector<uint8_t> left_valid(kBytes), left_data(kBytes), right_valid(kBytes),
+        right_data(kBytes);
+    random_bytes(kBytes, 0, left_valid.data());
+    random_bytes(kBytes, 1, left_data.data());
+    random_bytes(kBytes, 2, right_valid.data());
+    random_bytes(kBytes, 3, right_data.data());
+
+    for (const bool has_left_valid : {true, false}) {
+      for (const bool has_right_valid : {true, false}) {
+        const uint8_t* lv = has_left_valid ? left_valid.data() : nullptr;
+        const uint8_t* rv = has_right_valid ? right_valid.data() : nullptr;
+        for (const int64_t left_offset : {0, 3, 8}) {
+          for (const int64_t right_offset : {0, 5, 16}) {
+            for (const int64_t out_offset : {0, 1, 8}) {
+              for (const int64_t length : {0, 1, 63, 64, 1000, kBitCount - 16}) {
+                std::vector<uint8_t> out_valid(kBytes, 0xFF), out_data(kBytes, 0);
+                kleene_func(lv, left_data.data(), left_offset, rv, right_data.data(),
+                            right_offset, length, out_offset, out_valid.data(),
+                            out_data.data());
+                for (int64_t i = 0; i < length; ++i) {
+                  util::optional<bool> left, right;
+                  if (!lv || bit_util::GetBit(lv, left_offset + i)) {
+                    left = bit_util::GetBit(left_data.data(), left_offset + i);
+                  }
+                  if (!rv || bit_util::GetBit(rv, right_offset + i)) {
+                    right = bit_util::GetBit(right_data.data(), right_offset + i);
+                  }
+                  const util::optional<bool> result = expected(left, right);
+                  ASSERT_EQ(result.has_value(),
+                            bit_util::GetBit(out_valid.data(), out_offset + i))
+                      << "at " << i;
+                  if (result.has_value()) {
+                    ASSERT_EQ(*result, bit_util::GetBit(out_data.data(), out_offset + i))
+                        << "at " << i;
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+};
+
+TEST_F(BitmapKleeneOp, And) {
+  TestRandom(BitmapKleeneAnd, [](util::optional<bool> left, util::optional<bool> right) {
+    if ((left.has_value() && !*left) || (right.has_value() && !*right)) {
+      return util::optional<bool>(false);
+    }
+    if (left.has_value() && right.has_value()) return util::optional<bool>(true);
+    return util::optional<bool>();
+  });
+}
+
+TEST_F(BitmapKleeneOp, Or) {
+  TestRandom(BitmapKleeneOr, [](util::optional<bool> left, util::optional<bool> right) {
+    if ((left.has_value() && *left) || (right.has_value() && *right)) {
+      return util::optional<bool>(true);
+    }
+    if (left.has_value() && right.has_value()) return util::optional<bool>(false);
+    return util::optional<bool>();
+  });
+}
+
+TEST_F(BitmapKleeneOp, AndNot) {
+  TestRandom(BitmapKleeneAndNot,
+             [](util::optional<bool> left, util::optional<bool> right) {
+               if ((left.has_value() && !*left) || (right.has_value() && *right)) {
+                 return util::optional<bool>(false);
+               }
+               if (left.has_value() && right.has_value()) {
+                 return util::optional<bool>(true);
+               }
+               return util::optional<bool>();
+             });
+}
+
 static inline int64_t SlowCountBits(const uint8_t* data, int64_t bit_offset,
                                     int64_t length) {
   int64_t count = 0;
@@ -17,23 +17,79 @@
 
 #include "arrow/util/bitmap_ops.h"
 
+#include <array>
 #include <cstdint>
 #include <cstring>
 #include <functional>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/util/align_util.h"
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap.h"
+#include "arrow/util/bitmap_ops_internal.h"
 #include "arrow/util/bitmap_reader.h"
 #include "arrow/util/bitmap_writer.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
 namespace internal {
 
+namespace {
+
+int64_t CountSetBitsAligned(const uint8_t* data, int64_t nbytes) {
+  // popcount as much as possible with the widest possible count
+  const uint64_t* u64_data = reinterpret_cast<const uint64_t*>(data);
+  DCHECK_EQ(reinterpret_cast<size_t>(u64_data) & 7, 0);
+  const int64_t nwords = nbytes / 8;
+  const uint64_t* end = u64_data + nwords;
+
+  constexpr int64_t kCountUnrollFactor = 4;
+  const int64_t words_rounded = bit_util::RoundDown(nwords, kCountUnrollFactor);
+  int64_t count_unroll[kCountUnrollFactor] = {0};
+
+  // Unroll the loop for better performance
+  for (int64_t i = 0; i < words_rounded; i += kCountUnrollFactor) {
+    for (int64_t k = 0; k < kCountUnrollFactor; k++) {
+      count_unroll[k] += bit_util::PopCount(u64_data[k]);
+    }
+    u64_data += kCountUnrollFactor;
+  }
+  int64_t count = 0;
+  for (int64_t k = 0; k < kCountUnrollFactor; k++) {
+    count += count_unroll[k];
+  }
+
+  // The trailing part
+  for (; u64_data < end; ++u64_data) {
+    count += bit_util::PopCount(*u64_data);
+  }
+  return count;
+}
+
+struct CountSetBitsDynamicFunction {
+  using FunctionType = decltype(&CountSetBitsAligned);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      { DispatchLevel::NONE, CountSetBitsAligned }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { DispatchLevel::AVX2, CountSetBitsAvx2 }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , { DispatchLevel::AVX512, CountSetBitsAvx512 }
+#endif
+    };
+  }
+};
+
+}  // namespace
+
 int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
   constexpr int64_t pop_len = sizeof(uint64_t) * 8;
   DCHECK_GE(bit_offset, 0);
@@ -47,31 +103,8 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
   }
 
   if (p.aligned_words > 0) {
-    // popcount as much as possible with the widest possible count
-    const uint64_t* u64_data = reinterpret_cast<const uint64_t*>(p.aligned_start);
-    DCHECK_EQ(reinterpret_cast<size_t>(u64_data) & 7, 0);
-    const uint64_t* end = u64_data + p.aligned_words;
-
-    constexpr int64_t kCountUnrollFactor = 4;
-    const int64_t words_rounded =
-        bit_util::RoundDown(p.aligned_words, kCountUnrollFactor);
-    int64_t count_unroll[kCountUnrollFactor] = {0};
-
-    // Unroll the loop for better performance
-    for (int64_t i = 0; i < words_rounded; i += kCountUnrollFactor) {
-      for (int64_t k = 0; k < kCountUnrollFactor; k++) {
-        count_unroll[k] += bit_util::PopCount(u64_data[k]);
-      }
-      u64_data += kCountUnrollFactor;
-    }
-    for (int64_t k = 0; k < kCountUnrollFactor; k++) {
-      count += count_unroll[k];
-    }
-
-    // The trailing part
-    for (; u64_data < end; ++u64_data) {
-      count += bit_util::PopCount(*u64_data);
-    }
+    static DynamicDispatch<CountSetBitsDynamicFunction> dispatch;
+    count += dispatch.func(p.aligned_start, p.aligned_words * 8);
   }
 
   // Account for left over bits (in theory we could fall back to smaller
@@ -328,21 +361,92 @@ bool OptionalBitmapEquals(const std::shared_ptr<Buffer>& left, int64_t left_offs
 
 namespace {
 
+template <typename T>
+struct AndNotOp {
+  constexpr T operator()(const T& l, const T& r) const { return l & ~r; }
+};
+
+template <typename T>
+struct OrNotOp {
+  constexpr T operator()(const T& l, const T& r) const { return l | ~r; }
+};
+
+template <template <typename> class BitOp>
+struct BitOpKind;
+
+template <>
+struct BitOpKind<std::bit_and> {
+  static constexpr BitmapOpKind value = BitmapOpKind::AND;
+};
+template <>
+struct BitOpKind<std::bit_or> {
+  static constexpr BitmapOpKind value = BitmapOpKind::OR;
+};
+template <>
+struct BitOpKind<std::bit_xor> {
+  static constexpr BitmapOpKind value = BitmapOpKind::XOR;
+};
+template <>
+struct BitOpKind<AndNotOp> {
+  static constexpr BitmapOpKind value = BitmapOpKind::AND_NOT;
+};
+template <>
+struct BitOpKind<OrNotOp> {
+  static constexpr BitmapOpKind value = BitmapOpKind::OR_NOT;
+};
+
+template <template <typename> class BitOp>
+void AlignedBytesOp(const uint8_t* left, const uint8_t* right, uint8_t* out,
+                    int64_t nbytes) {
+  BitOp<uint8_t> op;
+  for (int64_t i = 0; i < nbytes; ++i) {
+    out[i] = op(left[i], right[i]);
+  }
+}
+
+void AlignedBitmapOpDefault(BitmapOpKind kind, const uint8_t* left, const uint8_t* right,
+                            uint8_t* out, int64_t nbytes) {
+  switch (kind) {
+    case BitmapOpKind::AND:
+      return AlignedBytesOp<std::bit_and>(left, right, out, nbytes);
+    case BitmapOpKind::OR:
+      return AlignedBytesOp<std::bit_or>(left, right, out, nbytes);
+    case BitmapOpKind::XOR:
+      return AlignedBytesOp<std::bit_xor>(left, right, out, nbytes);
+    case BitmapOpKind::AND_NOT:
+      return AlignedBytesOp<AndNotOp>(left, right, out, nbytes);
+    case BitmapOpKind::OR_NOT:
+      return AlignedBytesOp<OrNotOp>(left, right, out, nbytes);
+  }
+}
+
+struct AlignedBitmapOpDynamicFunction {
+  using FunctionType = decltype(&AlignedBitmapOpDefault);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      { DispatchLevel::NONE, AlignedBitmapOpDefault }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { DispatchLevel::AVX2, AlignedBitmapOpAvx2 }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , { DispatchLevel::AVX512, AlignedBitmapOpAvx512 }
+#endif
+    };
+  }
+};
+
 template <template <typename> class BitOp>
 void AlignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                      int64_t right_offset, uint8_t* out, int64_t out_offset,
                      int64_t length) {
-  BitOp<uint8_t> op;
   DCHECK_EQ(left_offset % 8, right_offset % 8);
   DCHECK_EQ(left_offset % 8, out_offset % 8);
 
   const int64_t nbytes = bit_util::BytesForBits(length + left_offset % 8);
-  left += left_offset / 8;
-  right += right_offset / 8;
-  out += out_offset / 8;
-  for (int64_t i = 0; i < nbytes; ++i) {
-    out[i] = op(left[i], right[i]);
-  }
+  static DynamicDispatch<AlignedBitmapOpDynamicFunction> dispatch;
+  dispatch.func(BitOpKind<BitOp>::value, left + left_offset / 8, right + right_offset / 8,
+                out + out_offset / 8, nbytes);
 }
 
 template <template <typename> class BitOp>
@@ -437,11 +541,6 @@ void BitmapXor(const uint8_t* left, int64_t left_offset, const uint8_t* right,
   BitmapOp<std::bit_xor>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
-template <typename T>
-struct AndNotOp {
-  constexpr T operator()(const T& l, const T& r) const { return l & ~r; }
-};
-
 Result<std::shared_ptr<Buffer>> BitmapAndNot(MemoryPool* pool, const uint8_t* left,
                                              int64_t left_offset, const uint8_t* right,
                                              int64_t right_offset, int64_t length,
@@ -456,11 +555,6 @@ void BitmapAndNot(const uint8_t* left, int64_t left_offset, const uint8_t* right
   BitmapOp<AndNotOp>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
-template <typename T>
-struct OrNotOp {
-  constexpr T operator()(const T& l, const T& r) const { return l | ~r; }
-};
-
 Result<std::shared_ptr<Buffer>> BitmapOrNot(MemoryPool* pool, const uint8_t* left,
                                             int64_t left_offset, const uint8_t* right,
                                             int64_t right_offset, int64_t length,
@@ -474,5 +568,219 @@ void BitmapOrNot(const uint8_t* left, int64_t left_offset, const uint8_t* right,
   BitmapOp<OrNotOp>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
+namespace {
+
+// The Kleene operations given the true and false bits of their operands
+struct KleeneAndOp {
+  static constexpr KleeneOpKind kind = KleeneOpKind::AND;
+
+  static void Call(uint64_t left_true, uint64_t left_false, uint64_t right_true,
+                   uint64_t right_false, uint64_t* valid, uint64_t* data) {
+    *data = left_true & right_true;
+    *valid = left_false | right_false | *data;
+  }
+};
+
+struct KleeneOrOp {
+  static constexpr KleeneOpKind kind = KleeneOpKind::OR;
+
+  static void Call(uint64_t left_true, uint64_t left_false, uint64_t right_true,
+                   uint64_t right_false, uint64_t* valid, uint64_t* data) {
+    *data = left_true | right_true;
+    *valid = *data | (left_false & right_false);
+  }
+};
+
+struct KleeneAndNotOp {
+  static constexpr KleeneOpKind kind = KleeneOpKind::AND_NOT;
+
+  static void Call(uint64_t left_true, uint64_t left_false, uint64_t right_true,
+                   uint64_t right_false, uint64_t* valid, uint64_t* data) {
+    *data = left_true & right_false;
+    *valid = left_false | right_true | *data;
+  }
+};
+
+template <typename Op>
+void KleeneWordOp(uint64_t left_valid, uint64_t left_data, uint64_t right_valid,
+                  uint64_t right_data, uint64_t* valid, uint64_t* data) {
+  Op::Call(left_valid & left_data, left_valid & ~left_data, right_valid & right_data,
+           right_valid & ~right_data, valid, data);
+}
+
+inline uint64_t LoadWord(const uint8_t* data) {
+  uint64_t word;
+  std::memcpy(&word, data, sizeof(word));
+  return word;
+}
+
+inline void StoreWord(uint8_t* data, uint64_t word) {
+  std::memcpy(data, &word, sizeof(word));
+}
+
+template <typename Op>
+void AlignedKleeneBytesOp(const uint8_t* left_valid, const uint8_t* left_data,
+                          const uint8_t* right_valid, const uint8_t* right_data,
+                          uint8_t* out_valid, uint8_t* out_data, int64_t nbytes) {
+  int64_t i = 0;
+  for (; i + 8 <= nbytes; i += 8) {
+    uint64_t valid, data;
+    KleeneWordOp<Op>(left_valid ? LoadWord(left_valid + i) : ~uint64_t(0),
+                     LoadWord(left_data + i),
+                     right_valid ? LoadWord(right_valid + i) : ~uint64_t(0),
+                     LoadWord(right_data + i), &valid, &data);
+    StoreWord(out_valid + i, valid);
+    StoreWord(out_data + i, data);
+  }
+  for (; i < nbytes; ++i) {
+    uint64_t valid, data;
+    KleeneWordOp<Op>(left_valid ? left_valid[i] : 0xFF, left_data[i],
+                     right_valid ? right_valid[i] : 0xFF, right_data[i], &valid, &data);
+    out_valid[i] = static_cast<uint8_t>(valid);
+    out_data[i] = static_cast<uint8_t>(data);
+  }
+}
+
+void AlignedKleeneOpDefault(KleeneOpKind kind, const uint8_t* left_valid,
+                            const uint8_t* left_data, const uint8_t* right_valid,
+                            const uint8_t* right_data, uint8_t* out_valid,
+                            uint8_t* out_data, int64_t nbytes) {
+  switch (kind) {
+    case KleeneOpKind::AND:
+      return AlignedKleeneBytesOp<KleeneAndOp>(left_valid, left_data, right_valid,
+                                               right_data, out_valid, out_data, nbytes);
+    case KleeneOpKind::OR:
+      return AlignedKleeneBytesOp<KleeneOrOp>(left_valid, left_data, right_valid,
+                                              right_data, out_valid, out_data, nbytes);
+    case KleeneOpKind::AND_NOT:
+      return AlignedKleeneBytesOp<KleeneAndNotOp>(left_valid, left_data, right_valid,
+                                                  right_data, out_valid, out_data,
+                                                  nbytes);
+  }
+}
+
+struct AlignedKleeneOpDynamicFunction {
+  using FunctionType = decltype(&AlignedKleeneOpDefault);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      { DispatchLevel::NONE, AlignedKleeneOpDefault }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { DispatchLevel::AVX2, AlignedKleeneOpAvx2 }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , { DispatchLevel::AVX512, AlignedKleeneOpAvx512 }
+#endif
+    };
+  }
+};
+
+template <typename Op>
+void UnalignedKleeneOp(const uint8_t* left_valid, const uint8_t* left_data,
+                       int64_t left_offset, const uint8_t* right_valid,
+                       const uint8_t* right_data, int64_t right_offset, int64_t length,
+                       int64_t out_offset, uint8_t* out_valid, uint8_t* out_data) {
+  Bitmap left_valid_bm{left_valid, left_offset, length};
+  Bitmap left_data_bm{left_data, left_offset, length};
+  Bitmap right_valid_bm{right_valid, right_offset, length};
+  Bitmap right_data_bm{right_data, right_offset, length};
+  std::array<Bitmap, 2> out_bms{Bitmap(out_valid, out_offset, length),
+                                Bitmap(out_data, out_offset, length)};
+
+  if (right_valid == nullptr) {
+    if (left_valid == nullptr) {
+      std::array<Bitmap, 2> in_bms{left_data_bm, right_data_bm};
+      Bitmap::VisitWordsAndWrite(
+          in_bms, &out_bms,
+          [](const std::array<uint64_t, 2>& in, std::array<uint64_t, 2>* out) {
+            KleeneWordOp<Op>(~uint64_t(0), in[0], ~uint64_t(0), in[1], &out->at(0),
+                             &out->at(1));
+          });
+      return;
+    }
+    std::array<Bitmap, 3> in_bms{left_valid_bm, left_data_bm, right_data_bm};
+    Bitmap::VisitWordsAndWrite(
+        in_bms, &out_bms,
+        [](const std::array<uint64_t, 3>& in, std::array<uint64_t, 2>* out) {
+          KleeneWordOp<Op>(in[0], in[1], ~uint64_t(0), in[2], &out->at(0), &out->at(1));
+        });
+    return;
+  }
+
+  if (left_valid == nullptr) {
+    std::array<Bitmap, 3> in_bms{left_data_bm, right_valid_bm, right_data_bm};
+    Bitmap::VisitWordsAndWrite(
+        in_bms, &out_bms,
+        [](const std::array<uint64_t, 3>& in, std::array<uint64_t, 2>* out) {
+          KleeneWordOp<Op>(~uint64_t(0), in[0], in[1], in[2], &out->at(0), &out->at(1));
+        });
+    return;
+  }
+
+  std::array<Bitmap, 4> in_bms{left_valid_bm, left_data_bm, right_valid_bm,
+                               right_data_bm};
+  Bitmap::VisitWordsAndWrite(
+      in_bms, &out_bms,
+      [](const std::array<uint64_t, 4>& in, std::array<uint64_t, 2>* out) {
+        KleeneWordOp<Op>(in[0], in[1], in[2], in[3], &out->at(0), &out->at(1));
+      });
+}
+
+template <typename Op>
+void KleeneBitmapOp(const uint8_t* left_valid, const uint8_t* left_data,
+                    int64_t left_offset, const uint8_t* right_valid,
+                    const uint8_t* right_data, int64_t right_offset, int64_t length,
+                    int64_t out_offset, uint8_t* out_valid, uint8_t* out_data) {
+  if (left_offset % 8 == 0 && right_offset % 8 == 0 && out_offset % 8 == 0) {
+    // Fast case: whole bytes are computed at once, the trailing bits below
+    const int64_t nbytes = length / 8;
+    auto byte_at = [](const uint8_t* bitmap, int64_t offset) {
+      return bitmap ? bitmap + offset / 8 : nullptr;
+    };
+    static DynamicDispatch<AlignedKleeneOpDynamicFunction> dispatch;
+    dispatch.func(Op::kind, byte_at(left_valid, left_offset),
+                  byte_at(left_data, left_offset), byte_at(right_valid, right_offset),
+                  byte_at(right_data, right_offset), out_valid + out_offset / 8,
+                  out_data + out_offset / 8, nbytes);
+    const int64_t done = nbytes * 8;
+    left_offset += done;
+    right_offset += done;
+    out_offset += done;
+    length -= done;
+    if (length == 0) return;
+  }
+  UnalignedKleeneOp<Op>(left_valid, left_data, left_offset, right_valid, right_data,
+                        right_offset, length, out_offset, out_valid, out_data);
+}
+
+}  // namespace
+
+void BitmapKleeneAnd(const uint8_t* left_valid, const uint8_t* left_data,
+                     int64_t left_offset, const uint8_t* right_valid,
+                     const uint8_t* right_data, int64_t right_offset, int64_t length,
+                     int64_t out_offset, uint8_t* out_valid, uint8_t* out_data) {
+  KleeneBitmapOp<KleeneAndOp>(left_valid, left_data, left_offset, right_valid,
+                              right_data, right_offset, length, out_offset, out_valid,
+                              out_data);
+}
+
+void BitmapKleeneOr(const uint8_t* left_valid, const uint8_t* left_data,
+                    int64_t left_offset, const uint8_t* right_valid,
+                    const uint8_t* right_data, int64_t right_offset, int64_t length,
+                    int64_t out_offset, uint8_t* out_valid, uint8_t* out_data) {
+  KleeneBitmapOp<KleeneOrOp>(left_valid, left_data, left_offset, right_valid,
+                             right_data, right_offset, length, out_offset, out_valid,
+                             out_data);
+}
+
+void BitmapKleeneAndNot(const uint8_t* left_valid, const uint8_t* left_data,
+                        int64_t left_offset, const uint8_t* right_valid,
+                        const uint8_t* right_data, int64_t right_offset, int64_t length,
+                        int64_t out_offset, uint8_t* out_valid, uint8_t* out_data) {
+  KleeneBitmapOp<KleeneAndNotOp>(left_valid, left_data, left_offset, right_valid,
+                                 right_data, right_offset, length, out_offset,
+                                 out_valid, out_data);
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -240,5 +240,33 @@ ARROW_EXPORT
 void BitmapOrNot(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                  int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out);
 
+/// \brief Do a Kleene "and" of the boolean values given by the validity and data
+/// bitmaps of left and right, starting at their respective bit-offsets for the
+/// given bit-length, and put the validity and data of the results in out_valid and
+/// out_data starting at the given bit-offset.
+///
+/// A null validity bitmap means that all values are valid.
+ARROW_EXPORT
+void BitmapKleeneAnd(const uint8_t* left_valid, const uint8_t* left_data,
+                     int64_t left_offset, const uint8_t* right_valid,
+                     const uint8_t* right_data, int64_t right_offset, int64_t length,
+                     int64_t out_offset, uint8_t* out_valid, uint8_t* out_data);
+
+/// \brief Do a Kleene "or" of the boolean values given by the validity and data
+/// bitmaps of left and right, see BitmapKleeneAnd.
+ARROW_EXPORT
+void BitmapKleeneOr(const uint8_t* left_valid, const uint8_t* left_data,
+                    int64_t left_offset, const uint8_t* right_valid,
+                    const uint8_t* right_data, int64_t right_offset, int64_t length,
+                    int64_t out_offset, uint8_t* out_valid, uint8_t* out_data);
+
+/// \brief Do a Kleene "and not" of the boolean values given by the validity and data
+/// bitmaps of left and right, see BitmapKleeneAnd.
+ARROW_EXPORT
+void BitmapKleeneAndNot(const uint8_t* left_valid, const uint8_t* left_data,
+                        int64_t left_offset, const uint8_t* right_valid,
+                        const uint8_t* right_data, int64_t right_offset, int64_t length,
+                        int64_t out_offset, uint8_t* out_valid, uint8_t* out_data);
+
 }  // namespace internal
 }  // namespace arrow
@@ -0,0 +1,256 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include <cstring>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops_internal.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+constexpr int64_t kVectorSize = 64;
+
+inline __m512i Load(const uint8_t* data) { return _mm512_loadu_si512(data); }
+
+inline void Store(uint8_t* data, __m512i value) { _mm512_storeu_si512(data, value); }
+
+inline __m512i And(__m512i a, __m512i b) { return _mm512_and_si512(a, b); }
+inline __m512i Or(__m512i a, __m512i b) { return _mm512_or_si512(a, b); }
+inline __m512i Xor(__m512i a, __m512i b) { return _mm512_xor_si512(a, b); }
+// a & ~b
+inline __m512i AndNot(__m512i a, __m512i b) { return _mm512_andnot_si512(b, a); }
+// a | ~b
+inline __m512i OrNot(__m512i a, __m512i b) {
+  return _mm512_ternarylogic_epi64(a, b, b, 0xF3);
+}
+// a | b | c
+inline __m512i Or3(__m512i a, __m512i b, __m512i c) {
+  return _mm512_ternarylogic_epi64(a, b, c, 0xFE);
+}
+// a | (b & c)
+inline __m512i OrAnd(__m512i a, __m512i b, __m512i c) {
+  return _mm512_ternarylogic_epi64(a, b, c, 0xF8);
+}
+
+inline uint8_t And(uint8_t a, uint8_t b) { return a & b; }
+inline uint8_t Or(uint8_t a, uint8_t b) { return a | b; }
+inline uint8_t Xor(uint8_t a, uint8_t b) { return a ^ b; }
+inline uint8_t AndNot(uint8_t a, uint8_t b) { return static_cast<uint8_t>(a & ~b); }
+inline uint8_t OrNot(uint8_t a, uint8_t b) { return static_cast<uint8_t>(a | ~b); }
+inline uint8_t Or3(uint8_t a, uint8_t b, uint8_t c) { return a | b | c; }
+inline uint8_t OrAnd(uint8_t a, uint8_t b, uint8_t c) { return a | (b & c); }
+
+struct AndOp {
+  template <typename V>
+  static V Call(V a, V b) {
+    return And(a, b);
+  }
+};
+
+struct OrOp {
+  template <typename V>
+  static V Call(V a, V b) {
+    return Or(a, b);
+  }
+};
+
+struct XorOp {
+  template <typename V>
+  static V Call(V a, V b) {
+    return Xor(a, b);
+  }
+};
+
+struct AndNotOp {
+  template <typename V>
+  static V Call(V a, V b) {
+    return AndNot(a, b);
+  }
+};
+
+struct OrNotOp {
+  template <typename V>
+  static V Call(V a, V b) {
+    return OrNot(a, b);
+  }
+};
+
+template <typename Op>
+void BitmapOpLoop(const uint8_t* left, const uint8_t* right, uint8_t* out,
+                  int64_t nbytes) {
+  int64_t i = 0;
+  for (; i + kVectorSize <= nbytes; i += kVectorSize) {
+    Store(out + i, Op::Call(Load(left + i), Load(right + i)));
+  }
+  for (; i < nbytes; ++i) {
+    out[i] = Op::Call(left[i], right[i]);
+  }
+}
+
+// The Kleene operations given the true and false bits of their operands
+struct KleeneAndOp {
+  template <typename V>
+  static void Call(V left_true, V left_false, V right_true, V right_false, V* valid,
+                   V* data) {
+    *data = And(left_true, right_true);
+    *valid = Or3(left_false, right_false, *data);
+  }
+};
+
+struct KleeneOrOp {
+  template <typename V>
+  static void Call(V left_true, V left_false, V right_true, V right_false, V* valid,
+                   V* data) {
+    *data = Or(left_true, right_true);
+    *valid = OrAnd(*data, left_false, right_false);
+  }
+};
+
+struct KleeneAndNotOp {
+  template <typename V>
+  static void Call(V left_true, V left_false, V right_true, V right_false, V* valid,
+                   V* data) {
+    *data = And(left_true, right_false);
+    *valid = Or3(left_false, right_true, *data);
+  }
+};
+
+template <typename Op, typename V>
+void KleeneOpStep(V left_valid, V left_data, V right_valid, V right_data, V* valid,
+                  V* data) {
+  Op::Call(And(left_valid, left_data), AndNot(left_valid, left_data),
+           And(right_valid, right_data), AndNot(right_valid, right_data), valid, data);
+}
+
+template <typename Op, bool kHasLeftValid, bool kHasRightValid>
+void KleeneOpLoop(const uint8_t* left_valid, const uint8_t* left_data,
+                  const uint8_t* right_valid, const uint8_t* right_data,
+                  uint8_t* out_valid, uint8_t* out_data, int64_t nbytes) {
+  const __m512i all_valid = _mm512_set1_epi8(-1);
+  int64_t i = 0;
+  for (; i + kVectorSize <= nbytes; i += kVectorSize) {
+    __m512i valid, data;
+    KleeneOpStep<Op>(kHasLeftValid ? Load(left_valid + i) : all_valid,
+                     Load(left_data + i),
+                     kHasRightValid ? Load(right_valid + i) : all_valid,
+                     Load(right_data + i), &valid, &data);
+    Store(out_valid + i, valid);
+    Store(out_data + i, data);
+  }
+  for (; i < nbytes; ++i) {
+    KleeneOpStep<Op>(kHasLeftValid ? left_valid[i] : uint8_t{0xFF}, left_data[i],
+                     kHasRightValid ? right_valid[i] : uint8_t{0xFF}, right_data[i],
+                     &out_valid[i], &out_data[i]);
+  }
+}
+
+template <typename Op>
+void KleeneOp(const uint8_t* left_valid, const uint8_t* left_data,
+              const uint8_t* right_valid, const uint8_t* right_data, uint8_t* out_valid,
+              uint8_t* out_data, int64_t nbytes) {
+  if (left_valid && right_valid) {
+    KleeneOpLoop<Op, true, true>(left_valid, left_data, right_valid, right_data,
+                                 out_valid, out_data, nbytes);
+  } else if (left_valid) {
+    KleeneOpLoop<Op, true, false>(left_valid, left_data, right_valid, right_data,
+                                  out_valid, out_data, nbytes);
+  } else if (right_valid) {
+    KleeneOpLoop<Op, false, true>(left_valid, left_data, right_valid, right_data,
+                                  out_valid, out_data, nbytes);
+  } else {
+    KleeneOpLoop<Op, false, false>(left_valid, left_data, right_valid, right_data,
+                                   out_valid, out_data, nbytes);
+  }
+}
+
+}  // namespace
+
+void AlignedBitmapOpAvx512(BitmapOpKind kind, const uint8_t* left, const uint8_t* right,
+                           uint8_t* out, int64_t nbytes) {
+  switch (kind) {
+    case BitmapOpKind::AND:
+      return BitmapOpLoop<AndOp>(left, right, out, nbytes);
+    case BitmapOpKind::OR:
+      return BitmapOpLoop<OrOp>(left, right, out, nbytes);
+    case BitmapOpKind::XOR:
+      return BitmapOpLoop<XorOp>(left, right, out, nbytes);
+    case BitmapOpKind::AND_NOT:
+      return BitmapOpLoop<AndNotOp>(left, right, out, nbytes);
+    case BitmapOpKind::OR_NOT:
+      return BitmapOpLoop<OrNotOp>(left, right, out, nbytes);
+  }
+}
+
+void AlignedKleeneOpAvx512(KleeneOpKind kind, const uint8_t* left_valid,
+                           const uint8_t* left_data, const uint8_t* right_valid,
+                           const uint8_t* right_data, uint8_t* out_valid,
+                           uint8_t* out_data, int64_t nbytes) {
+  switch (kind) {
+    case KleeneOpKind::AND:
+      return KleeneOp<KleeneAndOp>(left_valid, left_data, right_valid, right_data,
+                                   out_valid, out_data, nbytes);
+    case KleeneOpKind::OR:
+      return KleeneOp<KleeneOrOp>(left_valid, left_data, right_valid, right_data,
+                                  out_valid, out_data, nbytes);
+    case KleeneOpKind::AND_NOT:
+      return KleeneOp<KleeneAndNotOp>(left_valid, left_data, right_valid, right_data,
+                                      out_valid, out_data, nbytes);
+  }
+}
+
+// Count the bits of each byte by looking up its nibbles, the byte counts being
+// summed horizontally into 64-bit lanes once before they can overflow
+int64_t CountSetBitsAvx512(const uint8_t* data, int64_t nbytes) {
+  // Each byte count is at most 8, so that up to 31 of them fit in a byte
+  constexpr int kMaxByteSums = 31;
+  const __m512i lookup = _mm512_broadcast_i32x4(
+      _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4));
+  const __m512i low_nibbles = _mm512_set1_epi8(0x0F);
+  __m512i counts = _mm512_setzero_si512();
+  int64_t i = 0;
+  while (i + kVectorSize <= nbytes) {
+    __m512i byte_counts = _mm512_setzero_si512();
+    for (int k = 0; k < kMaxByteSums && i + kVectorSize <= nbytes;
+         ++k, i += kVectorSize) {
+      const __m512i bytes = Load(data + i);
+      const __m512i low = _mm512_shuffle_epi8(lookup, And(bytes, low_nibbles));
+      const __m512i high =
+          _mm512_shuffle_epi8(lookup, And(_mm512_srli_epi16(bytes, 4), low_nibbles));
+      byte_counts = _mm512_add_epi8(byte_counts, _mm512_add_epi8(low, high));
+    }
+    counts =
+        _mm512_add_epi64(counts, _mm512_sad_epu8(byte_counts, _mm512_setzero_si512()));
+  }
+  int64_t count = _mm512_reduce_add_epi64(counts);
+  for (; i + 8 <= nbytes; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, data + i, sizeof(word));
+    count += bit_util::PopCount(word);
+  }
+  for (; i < nbytes; ++i) {
+    count += bit_util::kBytePopcount[data[i]];
+  }
+  return count;
+}
+
+}  // namespace internal
+}  // namespace arrow
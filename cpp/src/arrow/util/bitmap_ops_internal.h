@@ -0,0 +1,52 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace arrow {
+namespace internal {
+
+// Bitwise operations of byte-aligned bitmaps, computed over whole bytes by the
+// SIMD implementations of bitmap_ops.cc
+
+enum class BitmapOpKind : int8_t { AND, OR, XOR, AND_NOT, OR_NOT };
+
+// Kleene logic of boolean values given by their validity and data bitmaps.
+// A null validity bitmap means all values are valid.
+enum class KleeneOpKind : int8_t { AND, OR, AND_NOT };
+
+void AlignedBitmapOpAvx2(BitmapOpKind kind, const uint8_t* left, const uint8_t* right,
+                         uint8_t* out, int64_t nbytes);
+void AlignedBitmapOpAvx512(BitmapOpKind kind, const uint8_t* left, const uint8_t* right,
+                           uint8_t* out, int64_t nbytes);
+
+void AlignedKleeneOpAvx2(KleeneOpKind kind, const uint8_t* left_valid,
+                         const uint8_t* left_data, const uint8_t* right_valid,
+                         const uint8_t* right_data, uint8_t* out_valid, uint8_t* out_data,
+                         int64_t nbytes);
+void AlignedKleeneOpAvx512(KleeneOpKind kind, const uint8_t* left_valid,
+                           const uint8_t* left_data, const uint8_t* right_valid,
+                           const uint8_t* right_data, uint8_t* out_valid,
+                           uint8_t* out_data, int64_t nbytes);
+
+int64_t CountSetBitsAvx2(const uint8_t* data, int64_t nbytes);
+int64_t CountSetBitsAvx512(const uint8_t* data, int64_t nbytes);
+
+}  // namespace internal
+}  // namespace arrow
@@ -385,11 +385,31 @@ int unpack64_default(const uint8_t* in, uint64_t* out, int batch_size, int num_b
   return batch_size;
 }
 
+struct Unpack64DynamicFunction {
+  using FunctionType = decltype(&unpack64_default);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      { DispatchLevel::NONE, unpack64_default }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { DispatchLevel::AVX2, unpack64_avx2 }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , { DispatchLevel::AVX512, unpack64_avx512 }
+#endif
+    };
+  }
+};
+
 }  // namespace
 
 int unpack64(const uint8_t* in, uint64_t* out, int batch_size, int num_bits) {
-  // TODO: unpack64_neon, unpack64_avx2 and unpack64_avx512
-  return unpack64_default(in, out, batch_size, num_bits);
+#if defined(ARROW_HAVE_NEON)
+  return unpack64_neon(in, out, batch_size, num_bits);
+#else
+  static DynamicDispatch<Unpack64DynamicFunction> dispatch;
+  return dispatch.func(in, out, batch_size, num_bits);
+#endif
 }
 
 }  // namespace internal
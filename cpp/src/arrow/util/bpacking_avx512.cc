@@ -27,5 +27,10 @@ int unpack32_avx512(const uint32_t* in, uint32_t* out, int batch_size, int num_b
                                                                     num_bits);
 }
 
+int unpack64_avx512(const uint8_t* in, uint64_t* out, int batch_size, int num_bits) {
+  return unpack64_specialized<UnpackBits512<DispatchLevel::AVX512>>(in, out, batch_size,
+                                                                    num_bits);
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -23,6 +23,7 @@ namespace arrow {
 namespace internal {
 
 int unpack32_avx512(const uint32_t* in, uint32_t* out, int batch_size, int num_bits);
+int unpack64_avx512(const uint8_t* in, uint64_t* out, int batch_size, int num_bits);
 
 }  // namespace internal
 }  // namespace arrow
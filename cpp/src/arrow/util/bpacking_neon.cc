@@ -27,5 +27,10 @@ int unpack32_neon(const uint32_t* in, uint32_t* out, int batch_size, int num_bit
                                                                   num_bits);
 }
 
+int unpack64_neon(const uint8_t* in, uint64_t* out, int batch_size, int num_bits) {
+  return unpack64_specialized<UnpackBits128<DispatchLevel::NEON>>(in, out, batch_size,
+                                                                  num_bits);
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -32,11 +32,13 @@ namespace internal {
 namespace {
 
 using ::arrow::util::SafeLoad;
+using ::arrow::util::SafeLoadAs;
 
 template <DispatchLevel level>
 struct UnpackBits512 {
 
 using simd_batch = xsimd::make_sized_batch_t<uint32_t, 16>;
+using simd_batch64 = xsimd::make_sized_batch_t<uint64_t, 8>;
 
 inline static const uint32_t* unpack0_32(const uint32_t* in, uint32_t* out) {
   memset(out, 0x0, 32 * sizeof(*out));
@@ -828,6 +830,2478 @@ inline static const uint32_t* unpack32_32(const uint32_t* in, uint32_t* out) {
   return in;
 }
 
+inline static const uint8_t* unpack0_64(const uint8_t* in, uint64_t* out) {
+  memset(out, 0x0, 32 * sizeof(*out));
+  out += 32;
+
+  return in;
+}
+
+inline static const uint8_t* unpack1_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x1;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 1-bit bundles 0 to 7
+  words = simd_batch64{ static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)) };
+  shifts = simd_batch64{ 0, 1, 2, 3, 4, 5, 6, 7 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 1-bit bundles 8 to 15
+  words = simd_batch64{ static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)) };
+  shifts = simd_batch64{ 8, 9, 10, 11, 12, 13, 14, 15 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 1-bit bundles 16 to 23
+  words = simd_batch64{ static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)) };
+  shifts = simd_batch64{ 16, 17, 18, 19, 20, 21, 22, 23 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 1-bit bundles 24 to 31
+  words = simd_batch64{ static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 0)) };
+  shifts = simd_batch64{ 24, 25, 26, 27, 28, 29, 30, 31 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 4;
+  return in;
+}
+
+inline static const uint8_t* unpack2_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x3;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 2-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) };
+  shifts = simd_batch64{ 0, 2, 4, 6, 8, 10, 12, 14 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 2-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) };
+  shifts = simd_batch64{ 16, 18, 20, 22, 24, 26, 28, 30 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 2-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) };
+  shifts = simd_batch64{ 32, 34, 36, 38, 40, 42, 44, 46 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 2-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) };
+  shifts = simd_batch64{ 48, 50, 52, 54, 56, 58, 60, 62 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 8;
+  return in;
+}
+
+inline static const uint8_t* unpack3_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x7;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 3-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) };
+  shifts = simd_batch64{ 0, 3, 6, 9, 12, 15, 18, 21 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 3-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) };
+  shifts = simd_batch64{ 24, 27, 30, 33, 36, 39, 42, 45 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 3-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 63 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 8)) << 1, static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 8)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 8)) };
+  shifts = simd_batch64{ 48, 51, 54, 57, 60, 0, 2, 5 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 3-bit bundles 24 to 31
+  words = simd_batch64{ static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 8)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 8)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 8)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 8)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 8)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 8)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 8)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 8)) };
+  shifts = simd_batch64{ 8, 11, 14, 17, 20, 23, 26, 29 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 12;
+  return in;
+}
+
+inline static const uint8_t* unpack4_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0xf;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 4-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) };
+  shifts = simd_batch64{ 0, 4, 8, 12, 16, 20, 24, 28 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 4-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) };
+  shifts = simd_batch64{ 32, 36, 40, 44, 48, 52, 56, 60 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 4-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) };
+  shifts = simd_batch64{ 0, 4, 8, 12, 16, 20, 24, 28 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 4-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) };
+  shifts = simd_batch64{ 32, 36, 40, 44, 48, 52, 56, 60 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 16;
+  return in;
+}
+
+inline static const uint8_t* unpack5_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x1f;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 5-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) };
+  shifts = simd_batch64{ 0, 5, 10, 15, 20, 25, 30, 35 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 5-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 60 | SafeLoadAs<uint64_t>(in + 8) << 4, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) };
+  shifts = simd_batch64{ 40, 45, 50, 55, 0, 1, 6, 11 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 5-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) };
+  shifts = simd_batch64{ 16, 21, 26, 31, 36, 41, 46, 51 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 5-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 61 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 16)) << 3, static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 16)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 16)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 16)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 16)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 16)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 16)) };
+  shifts = simd_batch64{ 56, 0, 2, 7, 12, 17, 22, 27 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 20;
+  return in;
+}
+
+inline static const uint8_t* unpack6_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x3f;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 6-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) };
+  shifts = simd_batch64{ 0, 6, 12, 18, 24, 30, 36, 42 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 6-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 60 | SafeLoadAs<uint64_t>(in + 8) << 4, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) };
+  shifts = simd_batch64{ 48, 54, 0, 2, 8, 14, 20, 26 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 6-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 62 | SafeLoadAs<uint64_t>(in + 16) << 2, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) };
+  shifts = simd_batch64{ 32, 38, 44, 50, 56, 0, 4, 10 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 6-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) };
+  shifts = simd_batch64{ 16, 22, 28, 34, 40, 46, 52, 58 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 24;
+  return in;
+}
+
+inline static const uint8_t* unpack7_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x7f;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 7-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) };
+  shifts = simd_batch64{ 0, 7, 14, 21, 28, 35, 42, 49 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 7-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 63 | SafeLoadAs<uint64_t>(in + 8) << 1, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) };
+  shifts = simd_batch64{ 56, 0, 6, 13, 20, 27, 34, 41 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 7-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 62 | SafeLoadAs<uint64_t>(in + 16) << 2, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) };
+  shifts = simd_batch64{ 48, 55, 0, 5, 12, 19, 26, 33 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 7-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 61 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 24)) << 3, static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 24)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 24)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 24)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 24)) };
+  shifts = simd_batch64{ 40, 47, 54, 0, 4, 11, 18, 25 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 28;
+  return in;
+}
+
+inline static const uint8_t* unpack8_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0xff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 8-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) };
+  shifts = simd_batch64{ 0, 8, 16, 24, 32, 40, 48, 56 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 8-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) };
+  shifts = simd_batch64{ 0, 8, 16, 24, 32, 40, 48, 56 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 8-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) };
+  shifts = simd_batch64{ 0, 8, 16, 24, 32, 40, 48, 56 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 8-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) };
+  shifts = simd_batch64{ 0, 8, 16, 24, 32, 40, 48, 56 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 32;
+  return in;
+}
+
+inline static const uint8_t* unpack9_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x1ff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 9-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 63 | SafeLoadAs<uint64_t>(in + 8) << 1 };
+  shifts = simd_batch64{ 0, 9, 18, 27, 36, 45, 54, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 9-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 62 | SafeLoadAs<uint64_t>(in + 16) << 2, SafeLoadAs<uint64_t>(in + 16) };
+  shifts = simd_batch64{ 8, 17, 26, 35, 44, 53, 0, 7 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 9-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 61 | SafeLoadAs<uint64_t>(in + 24) << 3, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) };
+  shifts = simd_batch64{ 16, 25, 34, 43, 52, 0, 6, 15 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 9-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 60 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 32)) << 4, static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 32)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 32)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 32)) };
+  shifts = simd_batch64{ 24, 33, 42, 51, 0, 5, 14, 23 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 36;
+  return in;
+}
+
+inline static const uint8_t* unpack10_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x3ff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 10-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 60 | SafeLoadAs<uint64_t>(in + 8) << 4, SafeLoadAs<uint64_t>(in + 8) };
+  shifts = simd_batch64{ 0, 10, 20, 30, 40, 50, 0, 6 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 10-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 56 | SafeLoadAs<uint64_t>(in + 16) << 8, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) };
+  shifts = simd_batch64{ 16, 26, 36, 46, 0, 2, 12, 22 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 10-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 62 | SafeLoadAs<uint64_t>(in + 24) << 2, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) };
+  shifts = simd_batch64{ 32, 42, 52, 0, 8, 18, 28, 38 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 10-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 58 | SafeLoadAs<uint64_t>(in + 32) << 6, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) };
+  shifts = simd_batch64{ 48, 0, 4, 14, 24, 34, 44, 54 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 40;
+  return in;
+}
+
+inline static const uint8_t* unpack11_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x7ff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 11-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 55 | SafeLoadAs<uint64_t>(in + 8) << 9, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) };
+  shifts = simd_batch64{ 0, 11, 22, 33, 44, 0, 2, 13 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 11-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 57 | SafeLoadAs<uint64_t>(in + 16) << 7, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) };
+  shifts = simd_batch64{ 24, 35, 46, 0, 4, 15, 26, 37 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 11-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 59 | SafeLoadAs<uint64_t>(in + 24) << 5, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 61 | SafeLoadAs<uint64_t>(in + 32) << 3 };
+  shifts = simd_batch64{ 48, 0, 6, 17, 28, 39, 50, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 11-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 63 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 40)) << 1, static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 40)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 40)) };
+  shifts = simd_batch64{ 8, 19, 30, 41, 52, 0, 10, 21 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 44;
+  return in;
+}
+
+inline static const uint8_t* unpack12_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0xfff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 12-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 60 | SafeLoadAs<uint64_t>(in + 8) << 4, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) };
+  shifts = simd_batch64{ 0, 12, 24, 36, 48, 0, 8, 20 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 12-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 56 | SafeLoadAs<uint64_t>(in + 16) << 8, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) };
+  shifts = simd_batch64{ 32, 44, 0, 4, 16, 28, 40, 52 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 12-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 60 | SafeLoadAs<uint64_t>(in + 32) << 4, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) };
+  shifts = simd_batch64{ 0, 12, 24, 36, 48, 0, 8, 20 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 12-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 56 | SafeLoadAs<uint64_t>(in + 40) << 8, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) };
+  shifts = simd_batch64{ 32, 44, 0, 4, 16, 28, 40, 52 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 48;
+  return in;
+}
+
+inline static const uint8_t* unpack13_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x1fff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 13-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 52 | SafeLoadAs<uint64_t>(in + 8) << 12, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) };
+  shifts = simd_batch64{ 0, 13, 26, 39, 0, 1, 14, 27 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 13-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 53 | SafeLoadAs<uint64_t>(in + 16) << 11, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 54 | SafeLoadAs<uint64_t>(in + 24) << 10, SafeLoadAs<uint64_t>(in + 24) };
+  shifts = simd_batch64{ 40, 0, 2, 15, 28, 41, 0, 3 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 13-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 55 | SafeLoadAs<uint64_t>(in + 32) << 9, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) };
+  shifts = simd_batch64{ 16, 29, 42, 0, 4, 17, 30, 43 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 13-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 32) >> 56 | SafeLoadAs<uint64_t>(in + 40) << 8, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 57 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 48)) << 7, static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 48)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 48)) };
+  shifts = simd_batch64{ 0, 5, 18, 31, 44, 0, 6, 19 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 52;
+  return in;
+}
+
+inline static const uint8_t* unpack14_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x3fff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 14-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 56 | SafeLoadAs<uint64_t>(in + 8) << 8, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) };
+  shifts = simd_batch64{ 0, 14, 28, 42, 0, 6, 20, 34 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 14-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 62 | SafeLoadAs<uint64_t>(in + 16) << 2, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 54 | SafeLoadAs<uint64_t>(in + 24) << 10, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) };
+  shifts = simd_batch64{ 48, 0, 12, 26, 40, 0, 4, 18 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 14-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 60 | SafeLoadAs<uint64_t>(in + 32) << 4, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 52 | SafeLoadAs<uint64_t>(in + 40) << 12, SafeLoadAs<uint64_t>(in + 40) };
+  shifts = simd_batch64{ 32, 46, 0, 10, 24, 38, 0, 2 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 14-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 58 | SafeLoadAs<uint64_t>(in + 48) << 6, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) };
+  shifts = simd_batch64{ 16, 30, 44, 0, 8, 22, 36, 50 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 56;
+  return in;
+}
+
+inline static const uint8_t* unpack15_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x7fff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 15-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 60 | SafeLoadAs<uint64_t>(in + 8) << 4, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) };
+  shifts = simd_batch64{ 0, 15, 30, 45, 0, 11, 26, 41 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 15-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 8) >> 56 | SafeLoadAs<uint64_t>(in + 16) << 8, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 52 | SafeLoadAs<uint64_t>(in + 24) << 12, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) };
+  shifts = simd_batch64{ 0, 7, 22, 37, 0, 3, 18, 33 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 15-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 63 | SafeLoadAs<uint64_t>(in + 32) << 1, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 59 | SafeLoadAs<uint64_t>(in + 40) << 5, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) };
+  shifts = simd_batch64{ 48, 0, 14, 29, 44, 0, 10, 25 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 15-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 55 | SafeLoadAs<uint64_t>(in + 48) << 9, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 51 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 56)) << 13, static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 56)), static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 56)) };
+  shifts = simd_batch64{ 40, 0, 6, 21, 36, 0, 2, 17 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 60;
+  return in;
+}
+
+inline static const uint8_t* unpack16_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0xffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 16-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) };
+  shifts = simd_batch64{ 0, 16, 32, 48, 0, 16, 32, 48 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 16-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) };
+  shifts = simd_batch64{ 0, 16, 32, 48, 0, 16, 32, 48 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 16-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) };
+  shifts = simd_batch64{ 0, 16, 32, 48, 0, 16, 32, 48 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 16-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) };
+  shifts = simd_batch64{ 0, 16, 32, 48, 0, 16, 32, 48 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 64;
+  return in;
+}
+
+inline static const uint8_t* unpack17_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x1ffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 17-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 51 | SafeLoadAs<uint64_t>(in + 8) << 13, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 55 | SafeLoadAs<uint64_t>(in + 16) << 9 };
+  shifts = simd_batch64{ 0, 17, 34, 0, 4, 21, 38, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 17-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 59 | SafeLoadAs<uint64_t>(in + 24) << 5, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 63 | SafeLoadAs<uint64_t>(in + 32) << 1 };
+  shifts = simd_batch64{ 8, 25, 42, 0, 12, 29, 46, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 17-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 50 | SafeLoadAs<uint64_t>(in + 40) << 14, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 54 | SafeLoadAs<uint64_t>(in + 48) << 10, SafeLoadAs<uint64_t>(in + 48) };
+  shifts = simd_batch64{ 16, 33, 0, 3, 20, 37, 0, 7 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 17-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 58 | SafeLoadAs<uint64_t>(in + 56) << 6, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 62 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 64)) << 2, static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 64)) };
+  shifts = simd_batch64{ 24, 41, 0, 11, 28, 45, 0, 15 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 68;
+  return in;
+}
+
+inline static const uint8_t* unpack18_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x3ffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 18-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 54 | SafeLoadAs<uint64_t>(in + 8) << 10, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 62 | SafeLoadAs<uint64_t>(in + 16) << 2 };
+  shifts = simd_batch64{ 0, 18, 36, 0, 8, 26, 44, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 18-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 52 | SafeLoadAs<uint64_t>(in + 24) << 12, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 60 | SafeLoadAs<uint64_t>(in + 32) << 4, SafeLoadAs<uint64_t>(in + 32) };
+  shifts = simd_batch64{ 16, 34, 0, 6, 24, 42, 0, 14 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 18-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 50 | SafeLoadAs<uint64_t>(in + 40) << 14, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 58 | SafeLoadAs<uint64_t>(in + 48) << 6, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) };
+  shifts = simd_batch64{ 32, 0, 4, 22, 40, 0, 12, 30 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 18-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 48) >> 48 | SafeLoadAs<uint64_t>(in + 56) << 16, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 56 | SafeLoadAs<uint64_t>(in + 64) << 8, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) };
+  shifts = simd_batch64{ 0, 2, 20, 38, 0, 10, 28, 46 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 72;
+  return in;
+}
+
+inline static const uint8_t* unpack19_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x7ffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 19-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 57 | SafeLoadAs<uint64_t>(in + 8) << 7, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 50 | SafeLoadAs<uint64_t>(in + 16) << 14, SafeLoadAs<uint64_t>(in + 16) };
+  shifts = simd_batch64{ 0, 19, 38, 0, 12, 31, 0, 5 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 19-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 62 | SafeLoadAs<uint64_t>(in + 24) << 2, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 55 | SafeLoadAs<uint64_t>(in + 32) << 9, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) };
+  shifts = simd_batch64{ 24, 43, 0, 17, 36, 0, 10, 29 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 19-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 32) >> 48 | SafeLoadAs<uint64_t>(in + 40) << 16, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 60 | SafeLoadAs<uint64_t>(in + 48) << 4, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 53 | SafeLoadAs<uint64_t>(in + 56) << 11 };
+  shifts = simd_batch64{ 0, 3, 22, 41, 0, 15, 34, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 19-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 46 | SafeLoadAs<uint64_t>(in + 64) << 18, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 58 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 72)) << 6, static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 72)) };
+  shifts = simd_batch64{ 8, 27, 0, 1, 20, 39, 0, 13 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 76;
+  return in;
+}
+
+inline static const uint8_t* unpack20_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0xfffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 20-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 60 | SafeLoadAs<uint64_t>(in + 8) << 4, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 56 | SafeLoadAs<uint64_t>(in + 16) << 8, SafeLoadAs<uint64_t>(in + 16) };
+  shifts = simd_batch64{ 0, 20, 40, 0, 16, 36, 0, 12 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 20-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 52 | SafeLoadAs<uint64_t>(in + 24) << 12, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 48 | SafeLoadAs<uint64_t>(in + 32) << 16, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) };
+  shifts = simd_batch64{ 32, 0, 8, 28, 0, 4, 24, 44 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 20-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 60 | SafeLoadAs<uint64_t>(in + 48) << 4, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 56 | SafeLoadAs<uint64_t>(in + 56) << 8, SafeLoadAs<uint64_t>(in + 56) };
+  shifts = simd_batch64{ 0, 20, 40, 0, 16, 36, 0, 12 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 20-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 52 | SafeLoadAs<uint64_t>(in + 64) << 12, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 48 | SafeLoadAs<uint64_t>(in + 72) << 16, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) };
+  shifts = simd_batch64{ 32, 0, 8, 28, 0, 4, 24, 44 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 80;
+  return in;
+}
+
+inline static const uint8_t* unpack21_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x1fffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 21-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 63 | SafeLoadAs<uint64_t>(in + 8) << 1, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 62 | SafeLoadAs<uint64_t>(in + 16) << 2, SafeLoadAs<uint64_t>(in + 16) };
+  shifts = simd_batch64{ 0, 21, 42, 0, 20, 41, 0, 19 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 21-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 61 | SafeLoadAs<uint64_t>(in + 24) << 3, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 60 | SafeLoadAs<uint64_t>(in + 32) << 4, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 59 | SafeLoadAs<uint64_t>(in + 40) << 5 };
+  shifts = simd_batch64{ 40, 0, 18, 39, 0, 17, 38, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 21-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 58 | SafeLoadAs<uint64_t>(in + 48) << 6, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 57 | SafeLoadAs<uint64_t>(in + 56) << 7, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) };
+  shifts = simd_batch64{ 16, 37, 0, 15, 36, 0, 14, 35 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 21-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 56) >> 56 | SafeLoadAs<uint64_t>(in + 64) << 8, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 55 | SafeLoadAs<uint64_t>(in + 72) << 9, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 54 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 80)) << 10, static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 80)) };
+  shifts = simd_batch64{ 0, 13, 34, 0, 12, 33, 0, 11 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 84;
+  return in;
+}
+
+inline static const uint8_t* unpack22_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x3fffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 22-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 44 | SafeLoadAs<uint64_t>(in + 8) << 20, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 46 | SafeLoadAs<uint64_t>(in + 16) << 18, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) };
+  shifts = simd_batch64{ 0, 22, 0, 2, 24, 0, 4, 26 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 22-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 16) >> 48 | SafeLoadAs<uint64_t>(in + 24) << 16, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 50 | SafeLoadAs<uint64_t>(in + 32) << 14, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 52 | SafeLoadAs<uint64_t>(in + 40) << 12, SafeLoadAs<uint64_t>(in + 40) };
+  shifts = simd_batch64{ 0, 6, 28, 0, 8, 30, 0, 10 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 22-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 54 | SafeLoadAs<uint64_t>(in + 48) << 10, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 56 | SafeLoadAs<uint64_t>(in + 56) << 8, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 58 | SafeLoadAs<uint64_t>(in + 64) << 6 };
+  shifts = simd_batch64{ 32, 0, 12, 34, 0, 14, 36, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 22-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 60 | SafeLoadAs<uint64_t>(in + 72) << 4, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 62 | SafeLoadAs<uint64_t>(in + 80) << 2, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) };
+  shifts = simd_batch64{ 16, 38, 0, 18, 40, 0, 20, 42 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 88;
+  return in;
+}
+
+inline static const uint8_t* unpack23_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x7fffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 23-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 46 | SafeLoadAs<uint64_t>(in + 8) << 18, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 51 | SafeLoadAs<uint64_t>(in + 16) << 13, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) };
+  shifts = simd_batch64{ 0, 23, 0, 5, 28, 0, 10, 33 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 23-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 16) >> 56 | SafeLoadAs<uint64_t>(in + 24) << 8, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 61 | SafeLoadAs<uint64_t>(in + 32) << 3, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 43 | SafeLoadAs<uint64_t>(in + 40) << 21, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) };
+  shifts = simd_batch64{ 0, 15, 38, 0, 20, 0, 2, 25 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 23-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 40) >> 48 | SafeLoadAs<uint64_t>(in + 48) << 16, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 53 | SafeLoadAs<uint64_t>(in + 56) << 11, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 58 | SafeLoadAs<uint64_t>(in + 64) << 6, SafeLoadAs<uint64_t>(in + 64) };
+  shifts = simd_batch64{ 0, 7, 30, 0, 12, 35, 0, 17 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 23-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 63 | SafeLoadAs<uint64_t>(in + 72) << 1, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 45 | SafeLoadAs<uint64_t>(in + 80) << 19, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 50 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 88)) << 14, static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 88)) };
+  shifts = simd_batch64{ 40, 0, 22, 0, 4, 27, 0, 9 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 92;
+  return in;
+}
+
+inline static const uint8_t* unpack24_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0xffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 24-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 48 | SafeLoadAs<uint64_t>(in + 8) << 16, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 56 | SafeLoadAs<uint64_t>(in + 16) << 8, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) };
+  shifts = simd_batch64{ 0, 24, 0, 8, 32, 0, 16, 40 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 24-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 48 | SafeLoadAs<uint64_t>(in + 32) << 16, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 56 | SafeLoadAs<uint64_t>(in + 40) << 8, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) };
+  shifts = simd_batch64{ 0, 24, 0, 8, 32, 0, 16, 40 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 24-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 48 | SafeLoadAs<uint64_t>(in + 56) << 16, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 56 | SafeLoadAs<uint64_t>(in + 64) << 8, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) };
+  shifts = simd_batch64{ 0, 24, 0, 8, 32, 0, 16, 40 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 24-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 48 | SafeLoadAs<uint64_t>(in + 80) << 16, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 56 | SafeLoadAs<uint64_t>(in + 88) << 8, SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) };
+  shifts = simd_batch64{ 0, 24, 0, 8, 32, 0, 16, 40 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 96;
+  return in;
+}
+
+inline static const uint8_t* unpack25_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x1ffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 25-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 50 | SafeLoadAs<uint64_t>(in + 8) << 14, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 61 | SafeLoadAs<uint64_t>(in + 16) << 3, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 47 | SafeLoadAs<uint64_t>(in + 24) << 17 };
+  shifts = simd_batch64{ 0, 25, 0, 11, 36, 0, 22, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 25-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 58 | SafeLoadAs<uint64_t>(in + 32) << 6, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 44 | SafeLoadAs<uint64_t>(in + 40) << 20, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 55 | SafeLoadAs<uint64_t>(in + 48) << 9 };
+  shifts = simd_batch64{ 8, 33, 0, 19, 0, 5, 30, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 25-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 41 | SafeLoadAs<uint64_t>(in + 56) << 23, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 52 | SafeLoadAs<uint64_t>(in + 64) << 12, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 63 | SafeLoadAs<uint64_t>(in + 72) << 1 };
+  shifts = simd_batch64{ 16, 0, 2, 27, 0, 13, 38, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 25-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 49 | SafeLoadAs<uint64_t>(in + 80) << 15, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 60 | SafeLoadAs<uint64_t>(in + 88) << 4, SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) >> 46 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 96)) << 18, static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 96)) };
+  shifts = simd_batch64{ 24, 0, 10, 35, 0, 21, 0, 7 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 100;
+  return in;
+}
+
+inline static const uint8_t* unpack26_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x3ffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 26-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 52 | SafeLoadAs<uint64_t>(in + 8) << 12, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 40 | SafeLoadAs<uint64_t>(in + 16) << 24, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 54 | SafeLoadAs<uint64_t>(in + 24) << 10 };
+  shifts = simd_batch64{ 0, 26, 0, 14, 0, 2, 28, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 26-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 42 | SafeLoadAs<uint64_t>(in + 32) << 22, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 56 | SafeLoadAs<uint64_t>(in + 40) << 8, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 44 | SafeLoadAs<uint64_t>(in + 48) << 20, SafeLoadAs<uint64_t>(in + 48) };
+  shifts = simd_batch64{ 16, 0, 4, 30, 0, 18, 0, 6 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 26-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 58 | SafeLoadAs<uint64_t>(in + 56) << 6, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 46 | SafeLoadAs<uint64_t>(in + 64) << 18, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 60 | SafeLoadAs<uint64_t>(in + 72) << 4, SafeLoadAs<uint64_t>(in + 72) };
+  shifts = simd_batch64{ 32, 0, 20, 0, 8, 34, 0, 22 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 26-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 72) >> 48 | SafeLoadAs<uint64_t>(in + 80) << 16, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 62 | SafeLoadAs<uint64_t>(in + 88) << 2, SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) >> 50 | SafeLoadAs<uint64_t>(in + 96) << 14, SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96) };
+  shifts = simd_batch64{ 0, 10, 36, 0, 24, 0, 12, 38 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 104;
+  return in;
+}
+
+inline static const uint8_t* unpack27_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x7ffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 27-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 54 | SafeLoadAs<uint64_t>(in + 8) << 10, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 44 | SafeLoadAs<uint64_t>(in + 16) << 20, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 61 | SafeLoadAs<uint64_t>(in + 24) << 3 };
+  shifts = simd_batch64{ 0, 27, 0, 17, 0, 7, 34, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 27-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 51 | SafeLoadAs<uint64_t>(in + 32) << 13, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 41 | SafeLoadAs<uint64_t>(in + 40) << 23, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 58 | SafeLoadAs<uint64_t>(in + 48) << 6, SafeLoadAs<uint64_t>(in + 48) };
+  shifts = simd_batch64{ 24, 0, 14, 0, 4, 31, 0, 21 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 27-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 48) >> 48 | SafeLoadAs<uint64_t>(in + 56) << 16, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 38 | SafeLoadAs<uint64_t>(in + 64) << 26, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 55 | SafeLoadAs<uint64_t>(in + 72) << 9, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 45 | SafeLoadAs<uint64_t>(in + 80) << 19 };
+  shifts = simd_batch64{ 0, 11, 0, 1, 28, 0, 18, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 27-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 62 | SafeLoadAs<uint64_t>(in + 88) << 2, SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) >> 52 | SafeLoadAs<uint64_t>(in + 96) << 12, SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96) >> 42 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 104)) << 22, static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 104)) };
+  shifts = simd_batch64{ 8, 35, 0, 25, 0, 15, 0, 5 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 108;
+  return in;
+}
+
+inline static const uint8_t* unpack28_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0xfffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 28-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 56 | SafeLoadAs<uint64_t>(in + 8) << 8, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 48 | SafeLoadAs<uint64_t>(in + 16) << 16, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 40 | SafeLoadAs<uint64_t>(in + 24) << 24, SafeLoadAs<uint64_t>(in + 24) };
+  shifts = simd_batch64{ 0, 28, 0, 20, 0, 12, 0, 4 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 28-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 60 | SafeLoadAs<uint64_t>(in + 32) << 4, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 52 | SafeLoadAs<uint64_t>(in + 40) << 12, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 44 | SafeLoadAs<uint64_t>(in + 48) << 20, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) };
+  shifts = simd_batch64{ 32, 0, 24, 0, 16, 0, 8, 36 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 28-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 56 | SafeLoadAs<uint64_t>(in + 64) << 8, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 48 | SafeLoadAs<uint64_t>(in + 72) << 16, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 40 | SafeLoadAs<uint64_t>(in + 80) << 24, SafeLoadAs<uint64_t>(in + 80) };
+  shifts = simd_batch64{ 0, 28, 0, 20, 0, 12, 0, 4 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 28-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 60 | SafeLoadAs<uint64_t>(in + 88) << 4, SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) >> 52 | SafeLoadAs<uint64_t>(in + 96) << 12, SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96) >> 44 | SafeLoadAs<uint64_t>(in + 104) << 20, SafeLoadAs<uint64_t>(in + 104), SafeLoadAs<uint64_t>(in + 104) };
+  shifts = simd_batch64{ 32, 0, 24, 0, 16, 0, 8, 36 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 112;
+  return in;
+}
+
+inline static const uint8_t* unpack29_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x1fffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 29-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 58 | SafeLoadAs<uint64_t>(in + 8) << 6, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 52 | SafeLoadAs<uint64_t>(in + 16) << 12, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 46 | SafeLoadAs<uint64_t>(in + 24) << 18, SafeLoadAs<uint64_t>(in + 24) };
+  shifts = simd_batch64{ 0, 29, 0, 23, 0, 17, 0, 11 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 29-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 24) >> 40 | SafeLoadAs<uint64_t>(in + 32) << 24, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 63 | SafeLoadAs<uint64_t>(in + 40) << 1, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 57 | SafeLoadAs<uint64_t>(in + 48) << 7, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 51 | SafeLoadAs<uint64_t>(in + 56) << 13 };
+  shifts = simd_batch64{ 0, 5, 34, 0, 28, 0, 22, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 29-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 45 | SafeLoadAs<uint64_t>(in + 64) << 19, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 39 | SafeLoadAs<uint64_t>(in + 72) << 25, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 62 | SafeLoadAs<uint64_t>(in + 80) << 2, SafeLoadAs<uint64_t>(in + 80) };
+  shifts = simd_batch64{ 16, 0, 10, 0, 4, 33, 0, 27 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 29-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 80) >> 56 | SafeLoadAs<uint64_t>(in + 88) << 8, SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) >> 50 | SafeLoadAs<uint64_t>(in + 96) << 14, SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96) >> 44 | SafeLoadAs<uint64_t>(in + 104) << 20, SafeLoadAs<uint64_t>(in + 104), SafeLoadAs<uint64_t>(in + 104) >> 38 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 112)) << 26, static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 112)) };
+  shifts = simd_batch64{ 0, 21, 0, 15, 0, 9, 0, 3 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 116;
+  return in;
+}
+
+inline static const uint8_t* unpack30_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x3fffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 30-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 60 | SafeLoadAs<uint64_t>(in + 8) << 4, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 56 | SafeLoadAs<uint64_t>(in + 16) << 8, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 52 | SafeLoadAs<uint64_t>(in + 24) << 12, SafeLoadAs<uint64_t>(in + 24) };
+  shifts = simd_batch64{ 0, 30, 0, 26, 0, 22, 0, 18 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 30-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 24) >> 48 | SafeLoadAs<uint64_t>(in + 32) << 16, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 44 | SafeLoadAs<uint64_t>(in + 40) << 20, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 40 | SafeLoadAs<uint64_t>(in + 48) << 24, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 36 | SafeLoadAs<uint64_t>(in + 56) << 28, SafeLoadAs<uint64_t>(in + 56) };
+  shifts = simd_batch64{ 0, 14, 0, 10, 0, 6, 0, 2 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 30-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 62 | SafeLoadAs<uint64_t>(in + 64) << 2, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 58 | SafeLoadAs<uint64_t>(in + 72) << 6, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 54 | SafeLoadAs<uint64_t>(in + 80) << 10, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 50 | SafeLoadAs<uint64_t>(in + 88) << 14 };
+  shifts = simd_batch64{ 32, 0, 28, 0, 24, 0, 20, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 30-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) >> 46 | SafeLoadAs<uint64_t>(in + 96) << 18, SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96) >> 42 | SafeLoadAs<uint64_t>(in + 104) << 22, SafeLoadAs<uint64_t>(in + 104), SafeLoadAs<uint64_t>(in + 104) >> 38 | SafeLoadAs<uint64_t>(in + 112) << 26, SafeLoadAs<uint64_t>(in + 112), SafeLoadAs<uint64_t>(in + 112) };
+  shifts = simd_batch64{ 16, 0, 12, 0, 8, 0, 4, 34 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 120;
+  return in;
+}
+
+inline static const uint8_t* unpack31_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x7fffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 31-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 62 | SafeLoadAs<uint64_t>(in + 8) << 2, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 60 | SafeLoadAs<uint64_t>(in + 16) << 4, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 58 | SafeLoadAs<uint64_t>(in + 24) << 6, SafeLoadAs<uint64_t>(in + 24) };
+  shifts = simd_batch64{ 0, 31, 0, 29, 0, 27, 0, 25 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 31-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 24) >> 56 | SafeLoadAs<uint64_t>(in + 32) << 8, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 54 | SafeLoadAs<uint64_t>(in + 40) << 10, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 52 | SafeLoadAs<uint64_t>(in + 48) << 12, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 50 | SafeLoadAs<uint64_t>(in + 56) << 14, SafeLoadAs<uint64_t>(in + 56) };
+  shifts = simd_batch64{ 0, 23, 0, 21, 0, 19, 0, 17 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 31-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 56) >> 48 | SafeLoadAs<uint64_t>(in + 64) << 16, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 46 | SafeLoadAs<uint64_t>(in + 72) << 18, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 44 | SafeLoadAs<uint64_t>(in + 80) << 20, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 42 | SafeLoadAs<uint64_t>(in + 88) << 22, SafeLoadAs<uint64_t>(in + 88) };
+  shifts = simd_batch64{ 0, 15, 0, 13, 0, 11, 0, 9 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 31-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 88) >> 40 | SafeLoadAs<uint64_t>(in + 96) << 24, SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96) >> 38 | SafeLoadAs<uint64_t>(in + 104) << 26, SafeLoadAs<uint64_t>(in + 104), SafeLoadAs<uint64_t>(in + 104) >> 36 | SafeLoadAs<uint64_t>(in + 112) << 28, SafeLoadAs<uint64_t>(in + 112), SafeLoadAs<uint64_t>(in + 112) >> 34 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 120)) << 30, static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 120)) };
+  shifts = simd_batch64{ 0, 7, 0, 5, 0, 3, 0, 1 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 124;
+  return in;
+}
+
+inline static const uint8_t* unpack32_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0xffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 32-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) };
+  shifts = simd_batch64{ 0, 32, 0, 32, 0, 32, 0, 32 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 32-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) };
+  shifts = simd_batch64{ 0, 32, 0, 32, 0, 32, 0, 32 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 32-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) };
+  shifts = simd_batch64{ 0, 32, 0, 32, 0, 32, 0, 32 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 32-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 104), SafeLoadAs<uint64_t>(in + 104), SafeLoadAs<uint64_t>(in + 112), SafeLoadAs<uint64_t>(in + 112), SafeLoadAs<uint64_t>(in + 120), SafeLoadAs<uint64_t>(in + 120) };
+  shifts = simd_batch64{ 0, 32, 0, 32, 0, 32, 0, 32 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 128;
+  return in;
+}
+
+inline static const uint8_t* unpack33_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x1ffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 33-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 33 | SafeLoadAs<uint64_t>(in + 8) << 31, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 35 | SafeLoadAs<uint64_t>(in + 16) << 29, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 37 | SafeLoadAs<uint64_t>(in + 24) << 27, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 39 | SafeLoadAs<uint64_t>(in + 32) << 25 };
+  shifts = simd_batch64{ 0, 0, 2, 0, 4, 0, 6, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 33-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 41 | SafeLoadAs<uint64_t>(in + 40) << 23, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 43 | SafeLoadAs<uint64_t>(in + 48) << 21, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 45 | SafeLoadAs<uint64_t>(in + 56) << 19, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 47 | SafeLoadAs<uint64_t>(in + 64) << 17 };
+  shifts = simd_batch64{ 8, 0, 10, 0, 12, 0, 14, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 33-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 49 | SafeLoadAs<uint64_t>(in + 72) << 15, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 51 | SafeLoadAs<uint64_t>(in + 80) << 13, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 53 | SafeLoadAs<uint64_t>(in + 88) << 11, SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) >> 55 | SafeLoadAs<uint64_t>(in + 96) << 9 };
+  shifts = simd_batch64{ 16, 0, 18, 0, 20, 0, 22, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 33-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96) >> 57 | SafeLoadAs<uint64_t>(in + 104) << 7, SafeLoadAs<uint64_t>(in + 104), SafeLoadAs<uint64_t>(in + 104) >> 59 | SafeLoadAs<uint64_t>(in + 112) << 5, SafeLoadAs<uint64_t>(in + 112), SafeLoadAs<uint64_t>(in + 112) >> 61 | SafeLoadAs<uint64_t>(in + 120) << 3, SafeLoadAs<uint64_t>(in + 120), SafeLoadAs<uint64_t>(in + 120) >> 63 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 128)) << 1 };
+  shifts = simd_batch64{ 24, 0, 26, 0, 28, 0, 30, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 132;
+  return in;
+}
+
+inline static const uint8_t* unpack34_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x3ffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 34-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 34 | SafeLoadAs<uint64_t>(in + 8) << 30, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 38 | SafeLoadAs<uint64_t>(in + 16) << 26, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 42 | SafeLoadAs<uint64_t>(in + 24) << 22, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 46 | SafeLoadAs<uint64_t>(in + 32) << 18 };
+  shifts = simd_batch64{ 0, 0, 4, 0, 8, 0, 12, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 34-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 50 | SafeLoadAs<uint64_t>(in + 40) << 14, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 54 | SafeLoadAs<uint64_t>(in + 48) << 10, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 58 | SafeLoadAs<uint64_t>(in + 56) << 6, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 62 | SafeLoadAs<uint64_t>(in + 64) << 2 };
+  shifts = simd_batch64{ 16, 0, 20, 0, 24, 0, 28, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 34-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 64) >> 32 | SafeLoadAs<uint64_t>(in + 72) << 32, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 36 | SafeLoadAs<uint64_t>(in + 80) << 28, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 40 | SafeLoadAs<uint64_t>(in + 88) << 24, SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) >> 44 | SafeLoadAs<uint64_t>(in + 96) << 20, SafeLoadAs<uint64_t>(in + 96) };
+  shifts = simd_batch64{ 0, 2, 0, 6, 0, 10, 0, 14 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 34-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 96) >> 48 | SafeLoadAs<uint64_t>(in + 104) << 16, SafeLoadAs<uint64_t>(in + 104), SafeLoadAs<uint64_t>(in + 104) >> 52 | SafeLoadAs<uint64_t>(in + 112) << 12, SafeLoadAs<uint64_t>(in + 112), SafeLoadAs<uint64_t>(in + 112) >> 56 | SafeLoadAs<uint64_t>(in + 120) << 8, SafeLoadAs<uint64_t>(in + 120), SafeLoadAs<uint64_t>(in + 120) >> 60 | SafeLoadAs<uint64_t>(in + 128) << 4, SafeLoadAs<uint64_t>(in + 128) };
+  shifts = simd_batch64{ 0, 18, 0, 22, 0, 26, 0, 30 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 136;
+  return in;
+}
+
+inline static const uint8_t* unpack35_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x7ffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 35-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 35 | SafeLoadAs<uint64_t>(in + 8) << 29, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 41 | SafeLoadAs<uint64_t>(in + 16) << 23, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 47 | SafeLoadAs<uint64_t>(in + 24) << 17, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 53 | SafeLoadAs<uint64_t>(in + 32) << 11 };
+  shifts = simd_batch64{ 0, 0, 6, 0, 12, 0, 18, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 35-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 59 | SafeLoadAs<uint64_t>(in + 40) << 5, SafeLoadAs<uint64_t>(in + 40) >> 30 | SafeLoadAs<uint64_t>(in + 48) << 34, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 36 | SafeLoadAs<uint64_t>(in + 56) << 28, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 42 | SafeLoadAs<uint64_t>(in + 64) << 22, SafeLoadAs<uint64_t>(in + 64) };
+  shifts = simd_batch64{ 24, 0, 0, 1, 0, 7, 0, 13 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 35-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 64) >> 48 | SafeLoadAs<uint64_t>(in + 72) << 16, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 54 | SafeLoadAs<uint64_t>(in + 80) << 10, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 60 | SafeLoadAs<uint64_t>(in + 88) << 4, SafeLoadAs<uint64_t>(in + 88) >> 31 | SafeLoadAs<uint64_t>(in + 96) << 33, SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96) >> 37 | SafeLoadAs<uint64_t>(in + 104) << 27 };
+  shifts = simd_batch64{ 0, 19, 0, 25, 0, 0, 2, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 35-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 104), SafeLoadAs<uint64_t>(in + 104) >> 43 | SafeLoadAs<uint64_t>(in + 112) << 21, SafeLoadAs<uint64_t>(in + 112), SafeLoadAs<uint64_t>(in + 112) >> 49 | SafeLoadAs<uint64_t>(in + 120) << 15, SafeLoadAs<uint64_t>(in + 120), SafeLoadAs<uint64_t>(in + 120) >> 55 | SafeLoadAs<uint64_t>(in + 128) << 9, SafeLoadAs<uint64_t>(in + 128), SafeLoadAs<uint64_t>(in + 128) >> 61 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 136)) << 3 };
+  shifts = simd_batch64{ 8, 0, 14, 0, 20, 0, 26, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 140;
+  return in;
+}
+
+inline static const uint8_t* unpack36_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0xfffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 36-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 36 | SafeLoadAs<uint64_t>(in + 8) << 28, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 44 | SafeLoadAs<uint64_t>(in + 16) << 20, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 52 | SafeLoadAs<uint64_t>(in + 24) << 12, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 60 | SafeLoadAs<uint64_t>(in + 32) << 4 };
+  shifts = simd_batch64{ 0, 0, 8, 0, 16, 0, 24, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 36-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 32) >> 32 | SafeLoadAs<uint64_t>(in + 40) << 32, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 40 | SafeLoadAs<uint64_t>(in + 48) << 24, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 48 | SafeLoadAs<uint64_t>(in + 56) << 16, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 56 | SafeLoadAs<uint64_t>(in + 64) << 8, SafeLoadAs<uint64_t>(in + 64) };
+  shifts = simd_batch64{ 0, 4, 0, 12, 0, 20, 0, 28 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 36-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 36 | SafeLoadAs<uint64_t>(in + 80) << 28, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 44 | SafeLoadAs<uint64_t>(in + 88) << 20, SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) >> 52 | SafeLoadAs<uint64_t>(in + 96) << 12, SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96) >> 60 | SafeLoadAs<uint64_t>(in + 104) << 4 };
+  shifts = simd_batch64{ 0, 0, 8, 0, 16, 0, 24, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 36-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 104) >> 32 | SafeLoadAs<uint64_t>(in + 112) << 32, SafeLoadAs<uint64_t>(in + 112), SafeLoadAs<uint64_t>(in + 112) >> 40 | SafeLoadAs<uint64_t>(in + 120) << 24, SafeLoadAs<uint64_t>(in + 120), SafeLoadAs<uint64_t>(in + 120) >> 48 | SafeLoadAs<uint64_t>(in + 128) << 16, SafeLoadAs<uint64_t>(in + 128), SafeLoadAs<uint64_t>(in + 128) >> 56 | SafeLoadAs<uint64_t>(in + 136) << 8, SafeLoadAs<uint64_t>(in + 136) };
+  shifts = simd_batch64{ 0, 4, 0, 12, 0, 20, 0, 28 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 144;
+  return in;
+}
+
+inline static const uint8_t* unpack37_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x1fffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 37-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 37 | SafeLoadAs<uint64_t>(in + 8) << 27, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 47 | SafeLoadAs<uint64_t>(in + 16) << 17, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 57 | SafeLoadAs<uint64_t>(in + 24) << 7, SafeLoadAs<uint64_t>(in + 24) >> 30 | SafeLoadAs<uint64_t>(in + 32) << 34, SafeLoadAs<uint64_t>(in + 32) };
+  shifts = simd_batch64{ 0, 0, 10, 0, 20, 0, 0, 3 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 37-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 32) >> 40 | SafeLoadAs<uint64_t>(in + 40) << 24, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 50 | SafeLoadAs<uint64_t>(in + 48) << 14, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 60 | SafeLoadAs<uint64_t>(in + 56) << 4, SafeLoadAs<uint64_t>(in + 56) >> 33 | SafeLoadAs<uint64_t>(in + 64) << 31, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 43 | SafeLoadAs<uint64_t>(in + 72) << 21 };
+  shifts = simd_batch64{ 0, 13, 0, 23, 0, 0, 6, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 37-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 53 | SafeLoadAs<uint64_t>(in + 80) << 11, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 63 | SafeLoadAs<uint64_t>(in + 88) << 1, SafeLoadAs<uint64_t>(in + 88) >> 36 | SafeLoadAs<uint64_t>(in + 96) << 28, SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96) >> 46 | SafeLoadAs<uint64_t>(in + 104) << 18, SafeLoadAs<uint64_t>(in + 104) };
+  shifts = simd_batch64{ 16, 0, 26, 0, 0, 9, 0, 19 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 37-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 104) >> 56 | SafeLoadAs<uint64_t>(in + 112) << 8, SafeLoadAs<uint64_t>(in + 112) >> 29 | SafeLoadAs<uint64_t>(in + 120) << 35, SafeLoadAs<uint64_t>(in + 120), SafeLoadAs<uint64_t>(in + 120) >> 39 | SafeLoadAs<uint64_t>(in + 128) << 25, SafeLoadAs<uint64_t>(in + 128), SafeLoadAs<uint64_t>(in + 128) >> 49 | SafeLoadAs<uint64_t>(in + 136) << 15, SafeLoadAs<uint64_t>(in + 136), SafeLoadAs<uint64_t>(in + 136) >> 59 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 144)) << 5 };
+  shifts = simd_batch64{ 0, 0, 2, 0, 12, 0, 22, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 148;
+  return in;
+}
+
+inline static const uint8_t* unpack38_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x3fffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 38-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 38 | SafeLoadAs<uint64_t>(in + 8) << 26, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 50 | SafeLoadAs<uint64_t>(in + 16) << 14, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 62 | SafeLoadAs<uint64_t>(in + 24) << 2, SafeLoadAs<uint64_t>(in + 24) >> 36 | SafeLoadAs<uint64_t>(in + 32) << 28, SafeLoadAs<uint64_t>(in + 32) };
+  shifts = simd_batch64{ 0, 0, 12, 0, 24, 0, 0, 10 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 38-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 32) >> 48 | SafeLoadAs<uint64_t>(in + 40) << 16, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 60 | SafeLoadAs<uint64_t>(in + 48) << 4, SafeLoadAs<uint64_t>(in + 48) >> 34 | SafeLoadAs<uint64_t>(in + 56) << 30, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 46 | SafeLoadAs<uint64_t>(in + 64) << 18, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 58 | SafeLoadAs<uint64_t>(in + 72) << 6 };
+  shifts = simd_batch64{ 0, 22, 0, 0, 8, 0, 20, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 38-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 72) >> 32 | SafeLoadAs<uint64_t>(in + 80) << 32, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 44 | SafeLoadAs<uint64_t>(in + 88) << 20, SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) >> 56 | SafeLoadAs<uint64_t>(in + 96) << 8, SafeLoadAs<uint64_t>(in + 96) >> 30 | SafeLoadAs<uint64_t>(in + 104) << 34, SafeLoadAs<uint64_t>(in + 104), SafeLoadAs<uint64_t>(in + 104) >> 42 | SafeLoadAs<uint64_t>(in + 112) << 22 };
+  shifts = simd_batch64{ 0, 6, 0, 18, 0, 0, 4, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 38-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 112), SafeLoadAs<uint64_t>(in + 112) >> 54 | SafeLoadAs<uint64_t>(in + 120) << 10, SafeLoadAs<uint64_t>(in + 120) >> 28 | SafeLoadAs<uint64_t>(in + 128) << 36, SafeLoadAs<uint64_t>(in + 128), SafeLoadAs<uint64_t>(in + 128) >> 40 | SafeLoadAs<uint64_t>(in + 136) << 24, SafeLoadAs<uint64_t>(in + 136), SafeLoadAs<uint64_t>(in + 136) >> 52 | SafeLoadAs<uint64_t>(in + 144) << 12, SafeLoadAs<uint64_t>(in + 144) };
+  shifts = simd_batch64{ 16, 0, 0, 2, 0, 14, 0, 26 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 152;
+  return in;
+}
+
+inline static const uint8_t* unpack39_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x7fffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 39-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 39 | SafeLoadAs<uint64_t>(in + 8) << 25, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 53 | SafeLoadAs<uint64_t>(in + 16) << 11, SafeLoadAs<uint64_t>(in + 16) >> 28 | SafeLoadAs<uint64_t>(in + 24) << 36, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 42 | SafeLoadAs<uint64_t>(in + 32) << 22, SafeLoadAs<uint64_t>(in + 32) };
+  shifts = simd_batch64{ 0, 0, 14, 0, 0, 3, 0, 17 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 39-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 32) >> 56 | SafeLoadAs<uint64_t>(in + 40) << 8, SafeLoadAs<uint64_t>(in + 40) >> 31 | SafeLoadAs<uint64_t>(in + 48) << 33, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 45 | SafeLoadAs<uint64_t>(in + 56) << 19, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 59 | SafeLoadAs<uint64_t>(in + 64) << 5, SafeLoadAs<uint64_t>(in + 64) >> 34 | SafeLoadAs<uint64_t>(in + 72) << 30, SafeLoadAs<uint64_t>(in + 72) };
+  shifts = simd_batch64{ 0, 0, 6, 0, 20, 0, 0, 9 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 39-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 72) >> 48 | SafeLoadAs<uint64_t>(in + 80) << 16, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 62 | SafeLoadAs<uint64_t>(in + 88) << 2, SafeLoadAs<uint64_t>(in + 88) >> 37 | SafeLoadAs<uint64_t>(in + 96) << 27, SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96) >> 51 | SafeLoadAs<uint64_t>(in + 104) << 13, SafeLoadAs<uint64_t>(in + 104) >> 26 | SafeLoadAs<uint64_t>(in + 112) << 38, SafeLoadAs<uint64_t>(in + 112) };
+  shifts = simd_batch64{ 0, 23, 0, 0, 12, 0, 0, 1 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 39-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 112) >> 40 | SafeLoadAs<uint64_t>(in + 120) << 24, SafeLoadAs<uint64_t>(in + 120), SafeLoadAs<uint64_t>(in + 120) >> 54 | SafeLoadAs<uint64_t>(in + 128) << 10, SafeLoadAs<uint64_t>(in + 128) >> 29 | SafeLoadAs<uint64_t>(in + 136) << 35, SafeLoadAs<uint64_t>(in + 136), SafeLoadAs<uint64_t>(in + 136) >> 43 | SafeLoadAs<uint64_t>(in + 144) << 21, SafeLoadAs<uint64_t>(in + 144), SafeLoadAs<uint64_t>(in + 144) >> 57 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 152)) << 7 };
+  shifts = simd_batch64{ 0, 15, 0, 0, 4, 0, 18, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 156;
+  return in;
+}
+
+inline static const uint8_t* unpack40_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0xffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 40-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 40 | SafeLoadAs<uint64_t>(in + 8) << 24, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 56 | SafeLoadAs<uint64_t>(in + 16) << 8, SafeLoadAs<uint64_t>(in + 16) >> 32 | SafeLoadAs<uint64_t>(in + 24) << 32, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 48 | SafeLoadAs<uint64_t>(in + 32) << 16, SafeLoadAs<uint64_t>(in + 32) };
+  shifts = simd_batch64{ 0, 0, 16, 0, 0, 8, 0, 24 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 40-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 40 | SafeLoadAs<uint64_t>(in + 48) << 24, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 56 | SafeLoadAs<uint64_t>(in + 56) << 8, SafeLoadAs<uint64_t>(in + 56) >> 32 | SafeLoadAs<uint64_t>(in + 64) << 32, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 48 | SafeLoadAs<uint64_t>(in + 72) << 16, SafeLoadAs<uint64_t>(in + 72) };
+  shifts = simd_batch64{ 0, 0, 16, 0, 0, 8, 0, 24 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 40-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 40 | SafeLoadAs<uint64_t>(in + 88) << 24, SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) >> 56 | SafeLoadAs<uint64_t>(in + 96) << 8, SafeLoadAs<uint64_t>(in + 96) >> 32 | SafeLoadAs<uint64_t>(in + 104) << 32, SafeLoadAs<uint64_t>(in + 104), SafeLoadAs<uint64_t>(in + 104) >> 48 | SafeLoadAs<uint64_t>(in + 112) << 16, SafeLoadAs<uint64_t>(in + 112) };
+  shifts = simd_batch64{ 0, 0, 16, 0, 0, 8, 0, 24 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 40-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 120), SafeLoadAs<uint64_t>(in + 120) >> 40 | SafeLoadAs<uint64_t>(in + 128) << 24, SafeLoadAs<uint64_t>(in + 128), SafeLoadAs<uint64_t>(in + 128) >> 56 | SafeLoadAs<uint64_t>(in + 136) << 8, SafeLoadAs<uint64_t>(in + 136) >> 32 | SafeLoadAs<uint64_t>(in + 144) << 32, SafeLoadAs<uint64_t>(in + 144), SafeLoadAs<uint64_t>(in + 144) >> 48 | SafeLoadAs<uint64_t>(in + 152) << 16, SafeLoadAs<uint64_t>(in + 152) };
+  shifts = simd_batch64{ 0, 0, 16, 0, 0, 8, 0, 24 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 160;
+  return in;
+}
+
+inline static const uint8_t* unpack41_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x1ffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 41-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 41 | SafeLoadAs<uint64_t>(in + 8) << 23, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 59 | SafeLoadAs<uint64_t>(in + 16) << 5, SafeLoadAs<uint64_t>(in + 16) >> 36 | SafeLoadAs<uint64_t>(in + 24) << 28, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 54 | SafeLoadAs<uint64_t>(in + 32) << 10, SafeLoadAs<uint64_t>(in + 32) >> 31 | SafeLoadAs<uint64_t>(in + 40) << 33 };
+  shifts = simd_batch64{ 0, 0, 18, 0, 0, 13, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 41-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 49 | SafeLoadAs<uint64_t>(in + 48) << 15, SafeLoadAs<uint64_t>(in + 48) >> 26 | SafeLoadAs<uint64_t>(in + 56) << 38, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 44 | SafeLoadAs<uint64_t>(in + 64) << 20, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 62 | SafeLoadAs<uint64_t>(in + 72) << 2, SafeLoadAs<uint64_t>(in + 72) >> 39 | SafeLoadAs<uint64_t>(in + 80) << 25 };
+  shifts = simd_batch64{ 8, 0, 0, 3, 0, 21, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 41-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 57 | SafeLoadAs<uint64_t>(in + 88) << 7, SafeLoadAs<uint64_t>(in + 88) >> 34 | SafeLoadAs<uint64_t>(in + 96) << 30, SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96) >> 52 | SafeLoadAs<uint64_t>(in + 104) << 12, SafeLoadAs<uint64_t>(in + 104) >> 29 | SafeLoadAs<uint64_t>(in + 112) << 35, SafeLoadAs<uint64_t>(in + 112), SafeLoadAs<uint64_t>(in + 112) >> 47 | SafeLoadAs<uint64_t>(in + 120) << 17 };
+  shifts = simd_batch64{ 16, 0, 0, 11, 0, 0, 6, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 41-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 120) >> 24 | SafeLoadAs<uint64_t>(in + 128) << 40, SafeLoadAs<uint64_t>(in + 128), SafeLoadAs<uint64_t>(in + 128) >> 42 | SafeLoadAs<uint64_t>(in + 136) << 22, SafeLoadAs<uint64_t>(in + 136), SafeLoadAs<uint64_t>(in + 136) >> 60 | SafeLoadAs<uint64_t>(in + 144) << 4, SafeLoadAs<uint64_t>(in + 144) >> 37 | SafeLoadAs<uint64_t>(in + 152) << 27, SafeLoadAs<uint64_t>(in + 152), SafeLoadAs<uint64_t>(in + 152) >> 55 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 160)) << 9 };
+  shifts = simd_batch64{ 0, 1, 0, 19, 0, 0, 14, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 164;
+  return in;
+}
+
+inline static const uint8_t* unpack42_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x3ffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 42-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 42 | SafeLoadAs<uint64_t>(in + 8) << 22, SafeLoadAs<uint64_t>(in + 8), SafeLoadAs<uint64_t>(in + 8) >> 62 | SafeLoadAs<uint64_t>(in + 16) << 2, SafeLoadAs<uint64_t>(in + 16) >> 40 | SafeLoadAs<uint64_t>(in + 24) << 24, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 60 | SafeLoadAs<uint64_t>(in + 32) << 4, SafeLoadAs<uint64_t>(in + 32) >> 38 | SafeLoadAs<uint64_t>(in + 40) << 26 };
+  shifts = simd_batch64{ 0, 0, 20, 0, 0, 18, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 42-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 58 | SafeLoadAs<uint64_t>(in + 48) << 6, SafeLoadAs<uint64_t>(in + 48) >> 36 | SafeLoadAs<uint64_t>(in + 56) << 28, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 56 | SafeLoadAs<uint64_t>(in + 64) << 8, SafeLoadAs<uint64_t>(in + 64) >> 34 | SafeLoadAs<uint64_t>(in + 72) << 30, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 54 | SafeLoadAs<uint64_t>(in + 80) << 10 };
+  shifts = simd_batch64{ 16, 0, 0, 14, 0, 0, 12, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 42-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 80) >> 32 | SafeLoadAs<uint64_t>(in + 88) << 32, SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) >> 52 | SafeLoadAs<uint64_t>(in + 96) << 12, SafeLoadAs<uint64_t>(in + 96) >> 30 | SafeLoadAs<uint64_t>(in + 104) << 34, SafeLoadAs<uint64_t>(in + 104), SafeLoadAs<uint64_t>(in + 104) >> 50 | SafeLoadAs<uint64_t>(in + 112) << 14, SafeLoadAs<uint64_t>(in + 112) >> 28 | SafeLoadAs<uint64_t>(in + 120) << 36, SafeLoadAs<uint64_t>(in + 120) };
+  shifts = simd_batch64{ 0, 10, 0, 0, 8, 0, 0, 6 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 42-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 120) >> 48 | SafeLoadAs<uint64_t>(in + 128) << 16, SafeLoadAs<uint64_t>(in + 128) >> 26 | SafeLoadAs<uint64_t>(in + 136) << 38, SafeLoadAs<uint64_t>(in + 136), SafeLoadAs<uint64_t>(in + 136) >> 46 | SafeLoadAs<uint64_t>(in + 144) << 18, SafeLoadAs<uint64_t>(in + 144) >> 24 | SafeLoadAs<uint64_t>(in + 152) << 40, SafeLoadAs<uint64_t>(in + 152), SafeLoadAs<uint64_t>(in + 152) >> 44 | SafeLoadAs<uint64_t>(in + 160) << 20, SafeLoadAs<uint64_t>(in + 160) };
+  shifts = simd_batch64{ 0, 0, 4, 0, 0, 2, 0, 22 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 168;
+  return in;
+}
+
+inline static const uint8_t* unpack43_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x7ffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 43-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 43 | SafeLoadAs<uint64_t>(in + 8) << 21, SafeLoadAs<uint64_t>(in + 8) >> 22 | SafeLoadAs<uint64_t>(in + 16) << 42, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 44 | SafeLoadAs<uint64_t>(in + 24) << 20, SafeLoadAs<uint64_t>(in + 24) >> 23 | SafeLoadAs<uint64_t>(in + 32) << 41, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 45 | SafeLoadAs<uint64_t>(in + 40) << 19 };
+  shifts = simd_batch64{ 0, 0, 0, 1, 0, 0, 2, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 43-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 40) >> 24 | SafeLoadAs<uint64_t>(in + 48) << 40, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 46 | SafeLoadAs<uint64_t>(in + 56) << 18, SafeLoadAs<uint64_t>(in + 56) >> 25 | SafeLoadAs<uint64_t>(in + 64) << 39, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 47 | SafeLoadAs<uint64_t>(in + 72) << 17, SafeLoadAs<uint64_t>(in + 72) >> 26 | SafeLoadAs<uint64_t>(in + 80) << 38, SafeLoadAs<uint64_t>(in + 80) };
+  shifts = simd_batch64{ 0, 3, 0, 0, 4, 0, 0, 5 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 43-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 80) >> 48 | SafeLoadAs<uint64_t>(in + 88) << 16, SafeLoadAs<uint64_t>(in + 88) >> 27 | SafeLoadAs<uint64_t>(in + 96) << 37, SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96) >> 49 | SafeLoadAs<uint64_t>(in + 104) << 15, SafeLoadAs<uint64_t>(in + 104) >> 28 | SafeLoadAs<uint64_t>(in + 112) << 36, SafeLoadAs<uint64_t>(in + 112), SafeLoadAs<uint64_t>(in + 112) >> 50 | SafeLoadAs<uint64_t>(in + 120) << 14, SafeLoadAs<uint64_t>(in + 120) >> 29 | SafeLoadAs<uint64_t>(in + 128) << 35 };
+  shifts = simd_batch64{ 0, 0, 6, 0, 0, 7, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 43-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 128), SafeLoadAs<uint64_t>(in + 128) >> 51 | SafeLoadAs<uint64_t>(in + 136) << 13, SafeLoadAs<uint64_t>(in + 136) >> 30 | SafeLoadAs<uint64_t>(in + 144) << 34, SafeLoadAs<uint64_t>(in + 144), SafeLoadAs<uint64_t>(in + 144) >> 52 | SafeLoadAs<uint64_t>(in + 152) << 12, SafeLoadAs<uint64_t>(in + 152) >> 31 | SafeLoadAs<uint64_t>(in + 160) << 33, SafeLoadAs<uint64_t>(in + 160), SafeLoadAs<uint64_t>(in + 160) >> 53 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 168)) << 11 };
+  shifts = simd_batch64{ 8, 0, 0, 9, 0, 0, 10, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 172;
+  return in;
+}
+
+inline static const uint8_t* unpack44_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0xfffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 44-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 44 | SafeLoadAs<uint64_t>(in + 8) << 20, SafeLoadAs<uint64_t>(in + 8) >> 24 | SafeLoadAs<uint64_t>(in + 16) << 40, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 48 | SafeLoadAs<uint64_t>(in + 24) << 16, SafeLoadAs<uint64_t>(in + 24) >> 28 | SafeLoadAs<uint64_t>(in + 32) << 36, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 52 | SafeLoadAs<uint64_t>(in + 40) << 12 };
+  shifts = simd_batch64{ 0, 0, 0, 4, 0, 0, 8, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 44-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 40) >> 32 | SafeLoadAs<uint64_t>(in + 48) << 32, SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 56 | SafeLoadAs<uint64_t>(in + 56) << 8, SafeLoadAs<uint64_t>(in + 56) >> 36 | SafeLoadAs<uint64_t>(in + 64) << 28, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 60 | SafeLoadAs<uint64_t>(in + 72) << 4, SafeLoadAs<uint64_t>(in + 72) >> 40 | SafeLoadAs<uint64_t>(in + 80) << 24, SafeLoadAs<uint64_t>(in + 80) };
+  shifts = simd_batch64{ 0, 12, 0, 0, 16, 0, 0, 20 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 44-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) >> 44 | SafeLoadAs<uint64_t>(in + 96) << 20, SafeLoadAs<uint64_t>(in + 96) >> 24 | SafeLoadAs<uint64_t>(in + 104) << 40, SafeLoadAs<uint64_t>(in + 104), SafeLoadAs<uint64_t>(in + 104) >> 48 | SafeLoadAs<uint64_t>(in + 112) << 16, SafeLoadAs<uint64_t>(in + 112) >> 28 | SafeLoadAs<uint64_t>(in + 120) << 36, SafeLoadAs<uint64_t>(in + 120), SafeLoadAs<uint64_t>(in + 120) >> 52 | SafeLoadAs<uint64_t>(in + 128) << 12 };
+  shifts = simd_batch64{ 0, 0, 0, 4, 0, 0, 8, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 44-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 128) >> 32 | SafeLoadAs<uint64_t>(in + 136) << 32, SafeLoadAs<uint64_t>(in + 136), SafeLoadAs<uint64_t>(in + 136) >> 56 | SafeLoadAs<uint64_t>(in + 144) << 8, SafeLoadAs<uint64_t>(in + 144) >> 36 | SafeLoadAs<uint64_t>(in + 152) << 28, SafeLoadAs<uint64_t>(in + 152), SafeLoadAs<uint64_t>(in + 152) >> 60 | SafeLoadAs<uint64_t>(in + 160) << 4, SafeLoadAs<uint64_t>(in + 160) >> 40 | SafeLoadAs<uint64_t>(in + 168) << 24, SafeLoadAs<uint64_t>(in + 168) };
+  shifts = simd_batch64{ 0, 12, 0, 0, 16, 0, 0, 20 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 176;
+  return in;
+}
+
+inline static const uint8_t* unpack45_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x1fffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 45-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 45 | SafeLoadAs<uint64_t>(in + 8) << 19, SafeLoadAs<uint64_t>(in + 8) >> 26 | SafeLoadAs<uint64_t>(in + 16) << 38, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 52 | SafeLoadAs<uint64_t>(in + 24) << 12, SafeLoadAs<uint64_t>(in + 24) >> 33 | SafeLoadAs<uint64_t>(in + 32) << 31, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 59 | SafeLoadAs<uint64_t>(in + 40) << 5 };
+  shifts = simd_batch64{ 0, 0, 0, 7, 0, 0, 14, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 45-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 40) >> 40 | SafeLoadAs<uint64_t>(in + 48) << 24, SafeLoadAs<uint64_t>(in + 48) >> 21 | SafeLoadAs<uint64_t>(in + 56) << 43, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 47 | SafeLoadAs<uint64_t>(in + 64) << 17, SafeLoadAs<uint64_t>(in + 64) >> 28 | SafeLoadAs<uint64_t>(in + 72) << 36, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 54 | SafeLoadAs<uint64_t>(in + 80) << 10, SafeLoadAs<uint64_t>(in + 80) >> 35 | SafeLoadAs<uint64_t>(in + 88) << 29 };
+  shifts = simd_batch64{ 0, 0, 2, 0, 0, 9, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 45-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) >> 61 | SafeLoadAs<uint64_t>(in + 96) << 3, SafeLoadAs<uint64_t>(in + 96) >> 42 | SafeLoadAs<uint64_t>(in + 104) << 22, SafeLoadAs<uint64_t>(in + 104) >> 23 | SafeLoadAs<uint64_t>(in + 112) << 41, SafeLoadAs<uint64_t>(in + 112), SafeLoadAs<uint64_t>(in + 112) >> 49 | SafeLoadAs<uint64_t>(in + 120) << 15, SafeLoadAs<uint64_t>(in + 120) >> 30 | SafeLoadAs<uint64_t>(in + 128) << 34, SafeLoadAs<uint64_t>(in + 128) };
+  shifts = simd_batch64{ 16, 0, 0, 0, 4, 0, 0, 11 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 45-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 128) >> 56 | SafeLoadAs<uint64_t>(in + 136) << 8, SafeLoadAs<uint64_t>(in + 136) >> 37 | SafeLoadAs<uint64_t>(in + 144) << 27, SafeLoadAs<uint64_t>(in + 144), SafeLoadAs<uint64_t>(in + 144) >> 63 | SafeLoadAs<uint64_t>(in + 152) << 1, SafeLoadAs<uint64_t>(in + 152) >> 44 | SafeLoadAs<uint64_t>(in + 160) << 20, SafeLoadAs<uint64_t>(in + 160) >> 25 | SafeLoadAs<uint64_t>(in + 168) << 39, SafeLoadAs<uint64_t>(in + 168), SafeLoadAs<uint64_t>(in + 168) >> 51 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 176)) << 13 };
+  shifts = simd_batch64{ 0, 0, 18, 0, 0, 0, 6, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 180;
+  return in;
+}
+
+inline static const uint8_t* unpack46_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x3fffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 46-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 46 | SafeLoadAs<uint64_t>(in + 8) << 18, SafeLoadAs<uint64_t>(in + 8) >> 28 | SafeLoadAs<uint64_t>(in + 16) << 36, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 56 | SafeLoadAs<uint64_t>(in + 24) << 8, SafeLoadAs<uint64_t>(in + 24) >> 38 | SafeLoadAs<uint64_t>(in + 32) << 26, SafeLoadAs<uint64_t>(in + 32) >> 20 | SafeLoadAs<uint64_t>(in + 40) << 44, SafeLoadAs<uint64_t>(in + 40) };
+  shifts = simd_batch64{ 0, 0, 0, 10, 0, 0, 0, 2 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 46-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 40) >> 48 | SafeLoadAs<uint64_t>(in + 48) << 16, SafeLoadAs<uint64_t>(in + 48) >> 30 | SafeLoadAs<uint64_t>(in + 56) << 34, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 58 | SafeLoadAs<uint64_t>(in + 64) << 6, SafeLoadAs<uint64_t>(in + 64) >> 40 | SafeLoadAs<uint64_t>(in + 72) << 24, SafeLoadAs<uint64_t>(in + 72) >> 22 | SafeLoadAs<uint64_t>(in + 80) << 42, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 50 | SafeLoadAs<uint64_t>(in + 88) << 14 };
+  shifts = simd_batch64{ 0, 0, 12, 0, 0, 0, 4, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 46-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 88) >> 32 | SafeLoadAs<uint64_t>(in + 96) << 32, SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96) >> 60 | SafeLoadAs<uint64_t>(in + 104) << 4, SafeLoadAs<uint64_t>(in + 104) >> 42 | SafeLoadAs<uint64_t>(in + 112) << 22, SafeLoadAs<uint64_t>(in + 112) >> 24 | SafeLoadAs<uint64_t>(in + 120) << 40, SafeLoadAs<uint64_t>(in + 120), SafeLoadAs<uint64_t>(in + 120) >> 52 | SafeLoadAs<uint64_t>(in + 128) << 12, SafeLoadAs<uint64_t>(in + 128) >> 34 | SafeLoadAs<uint64_t>(in + 136) << 30 };
+  shifts = simd_batch64{ 0, 14, 0, 0, 0, 6, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 46-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 136), SafeLoadAs<uint64_t>(in + 136) >> 62 | SafeLoadAs<uint64_t>(in + 144) << 2, SafeLoadAs<uint64_t>(in + 144) >> 44 | SafeLoadAs<uint64_t>(in + 152) << 20, SafeLoadAs<uint64_t>(in + 152) >> 26 | SafeLoadAs<uint64_t>(in + 160) << 38, SafeLoadAs<uint64_t>(in + 160), SafeLoadAs<uint64_t>(in + 160) >> 54 | SafeLoadAs<uint64_t>(in + 168) << 10, SafeLoadAs<uint64_t>(in + 168) >> 36 | SafeLoadAs<uint64_t>(in + 176) << 28, SafeLoadAs<uint64_t>(in + 176) };
+  shifts = simd_batch64{ 16, 0, 0, 0, 8, 0, 0, 18 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 184;
+  return in;
+}
+
+inline static const uint8_t* unpack47_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x7fffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 47-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 47 | SafeLoadAs<uint64_t>(in + 8) << 17, SafeLoadAs<uint64_t>(in + 8) >> 30 | SafeLoadAs<uint64_t>(in + 16) << 34, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 16) >> 60 | SafeLoadAs<uint64_t>(in + 24) << 4, SafeLoadAs<uint64_t>(in + 24) >> 43 | SafeLoadAs<uint64_t>(in + 32) << 21, SafeLoadAs<uint64_t>(in + 32) >> 26 | SafeLoadAs<uint64_t>(in + 40) << 38, SafeLoadAs<uint64_t>(in + 40) };
+  shifts = simd_batch64{ 0, 0, 0, 13, 0, 0, 0, 9 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 47-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 40) >> 56 | SafeLoadAs<uint64_t>(in + 48) << 8, SafeLoadAs<uint64_t>(in + 48) >> 39 | SafeLoadAs<uint64_t>(in + 56) << 25, SafeLoadAs<uint64_t>(in + 56) >> 22 | SafeLoadAs<uint64_t>(in + 64) << 42, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 52 | SafeLoadAs<uint64_t>(in + 72) << 12, SafeLoadAs<uint64_t>(in + 72) >> 35 | SafeLoadAs<uint64_t>(in + 80) << 29, SafeLoadAs<uint64_t>(in + 80) >> 18 | SafeLoadAs<uint64_t>(in + 88) << 46, SafeLoadAs<uint64_t>(in + 88) };
+  shifts = simd_batch64{ 0, 0, 0, 5, 0, 0, 0, 1 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 47-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 88) >> 48 | SafeLoadAs<uint64_t>(in + 96) << 16, SafeLoadAs<uint64_t>(in + 96) >> 31 | SafeLoadAs<uint64_t>(in + 104) << 33, SafeLoadAs<uint64_t>(in + 104), SafeLoadAs<uint64_t>(in + 104) >> 61 | SafeLoadAs<uint64_t>(in + 112) << 3, SafeLoadAs<uint64_t>(in + 112) >> 44 | SafeLoadAs<uint64_t>(in + 120) << 20, SafeLoadAs<uint64_t>(in + 120) >> 27 | SafeLoadAs<uint64_t>(in + 128) << 37, SafeLoadAs<uint64_t>(in + 128), SafeLoadAs<uint64_t>(in + 128) >> 57 | SafeLoadAs<uint64_t>(in + 136) << 7 };
+  shifts = simd_batch64{ 0, 0, 14, 0, 0, 0, 10, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 47-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 136) >> 40 | SafeLoadAs<uint64_t>(in + 144) << 24, SafeLoadAs<uint64_t>(in + 144) >> 23 | SafeLoadAs<uint64_t>(in + 152) << 41, SafeLoadAs<uint64_t>(in + 152), SafeLoadAs<uint64_t>(in + 152) >> 53 | SafeLoadAs<uint64_t>(in + 160) << 11, SafeLoadAs<uint64_t>(in + 160) >> 36 | SafeLoadAs<uint64_t>(in + 168) << 28, SafeLoadAs<uint64_t>(in + 168) >> 19 | SafeLoadAs<uint64_t>(in + 176) << 45, SafeLoadAs<uint64_t>(in + 176), SafeLoadAs<uint64_t>(in + 176) >> 49 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 184)) << 15 };
+  shifts = simd_batch64{ 0, 0, 6, 0, 0, 0, 2, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 188;
+  return in;
+}
+
+inline static const uint8_t* unpack48_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0xffffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 48-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 48 | SafeLoadAs<uint64_t>(in + 8) << 16, SafeLoadAs<uint64_t>(in + 8) >> 32 | SafeLoadAs<uint64_t>(in + 16) << 32, SafeLoadAs<uint64_t>(in + 16), SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 48 | SafeLoadAs<uint64_t>(in + 32) << 16, SafeLoadAs<uint64_t>(in + 32) >> 32 | SafeLoadAs<uint64_t>(in + 40) << 32, SafeLoadAs<uint64_t>(in + 40) };
+  shifts = simd_batch64{ 0, 0, 0, 16, 0, 0, 0, 16 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 48-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 48 | SafeLoadAs<uint64_t>(in + 56) << 16, SafeLoadAs<uint64_t>(in + 56) >> 32 | SafeLoadAs<uint64_t>(in + 64) << 32, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 48 | SafeLoadAs<uint64_t>(in + 80) << 16, SafeLoadAs<uint64_t>(in + 80) >> 32 | SafeLoadAs<uint64_t>(in + 88) << 32, SafeLoadAs<uint64_t>(in + 88) };
+  shifts = simd_batch64{ 0, 0, 0, 16, 0, 0, 0, 16 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 48-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96) >> 48 | SafeLoadAs<uint64_t>(in + 104) << 16, SafeLoadAs<uint64_t>(in + 104) >> 32 | SafeLoadAs<uint64_t>(in + 112) << 32, SafeLoadAs<uint64_t>(in + 112), SafeLoadAs<uint64_t>(in + 120), SafeLoadAs<uint64_t>(in + 120) >> 48 | SafeLoadAs<uint64_t>(in + 128) << 16, SafeLoadAs<uint64_t>(in + 128) >> 32 | SafeLoadAs<uint64_t>(in + 136) << 32, SafeLoadAs<uint64_t>(in + 136) };
+  shifts = simd_batch64{ 0, 0, 0, 16, 0, 0, 0, 16 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 48-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 144), SafeLoadAs<uint64_t>(in + 144) >> 48 | SafeLoadAs<uint64_t>(in + 152) << 16, SafeLoadAs<uint64_t>(in + 152) >> 32 | SafeLoadAs<uint64_t>(in + 160) << 32, SafeLoadAs<uint64_t>(in + 160), SafeLoadAs<uint64_t>(in + 168), SafeLoadAs<uint64_t>(in + 168) >> 48 | SafeLoadAs<uint64_t>(in + 176) << 16, SafeLoadAs<uint64_t>(in + 176) >> 32 | SafeLoadAs<uint64_t>(in + 184) << 32, SafeLoadAs<uint64_t>(in + 184) };
+  shifts = simd_batch64{ 0, 0, 0, 16, 0, 0, 0, 16 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 192;
+  return in;
+}
+
+inline static const uint8_t* unpack49_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x1ffffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 49-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 49 | SafeLoadAs<uint64_t>(in + 8) << 15, SafeLoadAs<uint64_t>(in + 8) >> 34 | SafeLoadAs<uint64_t>(in + 16) << 30, SafeLoadAs<uint64_t>(in + 16) >> 19 | SafeLoadAs<uint64_t>(in + 24) << 45, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 53 | SafeLoadAs<uint64_t>(in + 32) << 11, SafeLoadAs<uint64_t>(in + 32) >> 38 | SafeLoadAs<uint64_t>(in + 40) << 26, SafeLoadAs<uint64_t>(in + 40) >> 23 | SafeLoadAs<uint64_t>(in + 48) << 41 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 4, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 49-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 48), SafeLoadAs<uint64_t>(in + 48) >> 57 | SafeLoadAs<uint64_t>(in + 56) << 7, SafeLoadAs<uint64_t>(in + 56) >> 42 | SafeLoadAs<uint64_t>(in + 64) << 22, SafeLoadAs<uint64_t>(in + 64) >> 27 | SafeLoadAs<uint64_t>(in + 72) << 37, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 61 | SafeLoadAs<uint64_t>(in + 80) << 3, SafeLoadAs<uint64_t>(in + 80) >> 46 | SafeLoadAs<uint64_t>(in + 88) << 18, SafeLoadAs<uint64_t>(in + 88) >> 31 | SafeLoadAs<uint64_t>(in + 96) << 33 };
+  shifts = simd_batch64{ 8, 0, 0, 0, 12, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 49-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 96) >> 16 | SafeLoadAs<uint64_t>(in + 104) << 48, SafeLoadAs<uint64_t>(in + 104), SafeLoadAs<uint64_t>(in + 104) >> 50 | SafeLoadAs<uint64_t>(in + 112) << 14, SafeLoadAs<uint64_t>(in + 112) >> 35 | SafeLoadAs<uint64_t>(in + 120) << 29, SafeLoadAs<uint64_t>(in + 120) >> 20 | SafeLoadAs<uint64_t>(in + 128) << 44, SafeLoadAs<uint64_t>(in + 128), SafeLoadAs<uint64_t>(in + 128) >> 54 | SafeLoadAs<uint64_t>(in + 136) << 10, SafeLoadAs<uint64_t>(in + 136) >> 39 | SafeLoadAs<uint64_t>(in + 144) << 25 };
+  shifts = simd_batch64{ 0, 1, 0, 0, 0, 5, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 49-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 144) >> 24 | SafeLoadAs<uint64_t>(in + 152) << 40, SafeLoadAs<uint64_t>(in + 152), SafeLoadAs<uint64_t>(in + 152) >> 58 | SafeLoadAs<uint64_t>(in + 160) << 6, SafeLoadAs<uint64_t>(in + 160) >> 43 | SafeLoadAs<uint64_t>(in + 168) << 21, SafeLoadAs<uint64_t>(in + 168) >> 28 | SafeLoadAs<uint64_t>(in + 176) << 36, SafeLoadAs<uint64_t>(in + 176), SafeLoadAs<uint64_t>(in + 176) >> 62 | SafeLoadAs<uint64_t>(in + 184) << 2, SafeLoadAs<uint64_t>(in + 184) >> 47 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 192)) << 17 };
+  shifts = simd_batch64{ 0, 9, 0, 0, 0, 13, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 196;
+  return in;
+}
+
+inline static const uint8_t* unpack50_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x3ffffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 50-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 50 | SafeLoadAs<uint64_t>(in + 8) << 14, SafeLoadAs<uint64_t>(in + 8) >> 36 | SafeLoadAs<uint64_t>(in + 16) << 28, SafeLoadAs<uint64_t>(in + 16) >> 22 | SafeLoadAs<uint64_t>(in + 24) << 42, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 58 | SafeLoadAs<uint64_t>(in + 32) << 6, SafeLoadAs<uint64_t>(in + 32) >> 44 | SafeLoadAs<uint64_t>(in + 40) << 20, SafeLoadAs<uint64_t>(in + 40) >> 30 | SafeLoadAs<uint64_t>(in + 48) << 34 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 8, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 50-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 48) >> 16 | SafeLoadAs<uint64_t>(in + 56) << 48, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 52 | SafeLoadAs<uint64_t>(in + 64) << 12, SafeLoadAs<uint64_t>(in + 64) >> 38 | SafeLoadAs<uint64_t>(in + 72) << 26, SafeLoadAs<uint64_t>(in + 72) >> 24 | SafeLoadAs<uint64_t>(in + 80) << 40, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 60 | SafeLoadAs<uint64_t>(in + 88) << 4, SafeLoadAs<uint64_t>(in + 88) >> 46 | SafeLoadAs<uint64_t>(in + 96) << 18 };
+  shifts = simd_batch64{ 0, 2, 0, 0, 0, 10, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 50-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 96) >> 32 | SafeLoadAs<uint64_t>(in + 104) << 32, SafeLoadAs<uint64_t>(in + 104) >> 18 | SafeLoadAs<uint64_t>(in + 112) << 46, SafeLoadAs<uint64_t>(in + 112), SafeLoadAs<uint64_t>(in + 112) >> 54 | SafeLoadAs<uint64_t>(in + 120) << 10, SafeLoadAs<uint64_t>(in + 120) >> 40 | SafeLoadAs<uint64_t>(in + 128) << 24, SafeLoadAs<uint64_t>(in + 128) >> 26 | SafeLoadAs<uint64_t>(in + 136) << 38, SafeLoadAs<uint64_t>(in + 136), SafeLoadAs<uint64_t>(in + 136) >> 62 | SafeLoadAs<uint64_t>(in + 144) << 2 };
+  shifts = simd_batch64{ 0, 0, 4, 0, 0, 0, 12, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 50-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 144) >> 48 | SafeLoadAs<uint64_t>(in + 152) << 16, SafeLoadAs<uint64_t>(in + 152) >> 34 | SafeLoadAs<uint64_t>(in + 160) << 30, SafeLoadAs<uint64_t>(in + 160) >> 20 | SafeLoadAs<uint64_t>(in + 168) << 44, SafeLoadAs<uint64_t>(in + 168), SafeLoadAs<uint64_t>(in + 168) >> 56 | SafeLoadAs<uint64_t>(in + 176) << 8, SafeLoadAs<uint64_t>(in + 176) >> 42 | SafeLoadAs<uint64_t>(in + 184) << 22, SafeLoadAs<uint64_t>(in + 184) >> 28 | SafeLoadAs<uint64_t>(in + 192) << 36, SafeLoadAs<uint64_t>(in + 192) };
+  shifts = simd_batch64{ 0, 0, 0, 6, 0, 0, 0, 14 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 200;
+  return in;
+}
+
+inline static const uint8_t* unpack51_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x7ffffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 51-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 51 | SafeLoadAs<uint64_t>(in + 8) << 13, SafeLoadAs<uint64_t>(in + 8) >> 38 | SafeLoadAs<uint64_t>(in + 16) << 26, SafeLoadAs<uint64_t>(in + 16) >> 25 | SafeLoadAs<uint64_t>(in + 24) << 39, SafeLoadAs<uint64_t>(in + 24), SafeLoadAs<uint64_t>(in + 24) >> 63 | SafeLoadAs<uint64_t>(in + 32) << 1, SafeLoadAs<uint64_t>(in + 32) >> 50 | SafeLoadAs<uint64_t>(in + 40) << 14, SafeLoadAs<uint64_t>(in + 40) >> 37 | SafeLoadAs<uint64_t>(in + 48) << 27 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 12, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 51-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 48) >> 24 | SafeLoadAs<uint64_t>(in + 56) << 40, SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 62 | SafeLoadAs<uint64_t>(in + 64) << 2, SafeLoadAs<uint64_t>(in + 64) >> 49 | SafeLoadAs<uint64_t>(in + 72) << 15, SafeLoadAs<uint64_t>(in + 72) >> 36 | SafeLoadAs<uint64_t>(in + 80) << 28, SafeLoadAs<uint64_t>(in + 80) >> 23 | SafeLoadAs<uint64_t>(in + 88) << 41, SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) >> 61 | SafeLoadAs<uint64_t>(in + 96) << 3 };
+  shifts = simd_batch64{ 0, 11, 0, 0, 0, 0, 10, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 51-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 96) >> 48 | SafeLoadAs<uint64_t>(in + 104) << 16, SafeLoadAs<uint64_t>(in + 104) >> 35 | SafeLoadAs<uint64_t>(in + 112) << 29, SafeLoadAs<uint64_t>(in + 112) >> 22 | SafeLoadAs<uint64_t>(in + 120) << 42, SafeLoadAs<uint64_t>(in + 120), SafeLoadAs<uint64_t>(in + 120) >> 60 | SafeLoadAs<uint64_t>(in + 128) << 4, SafeLoadAs<uint64_t>(in + 128) >> 47 | SafeLoadAs<uint64_t>(in + 136) << 17, SafeLoadAs<uint64_t>(in + 136) >> 34 | SafeLoadAs<uint64_t>(in + 144) << 30, SafeLoadAs<uint64_t>(in + 144) >> 21 | SafeLoadAs<uint64_t>(in + 152) << 43 };
+  shifts = simd_batch64{ 0, 0, 0, 9, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 51-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 152), SafeLoadAs<uint64_t>(in + 152) >> 59 | SafeLoadAs<uint64_t>(in + 160) << 5, SafeLoadAs<uint64_t>(in + 160) >> 46 | SafeLoadAs<uint64_t>(in + 168) << 18, SafeLoadAs<uint64_t>(in + 168) >> 33 | SafeLoadAs<uint64_t>(in + 176) << 31, SafeLoadAs<uint64_t>(in + 176) >> 20 | SafeLoadAs<uint64_t>(in + 184) << 44, SafeLoadAs<uint64_t>(in + 184), SafeLoadAs<uint64_t>(in + 184) >> 58 | SafeLoadAs<uint64_t>(in + 192) << 6, SafeLoadAs<uint64_t>(in + 192) >> 45 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 200)) << 19 };
+  shifts = simd_batch64{ 8, 0, 0, 0, 0, 7, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 204;
+  return in;
+}
+
+inline static const uint8_t* unpack52_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0xfffffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 52-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 52 | SafeLoadAs<uint64_t>(in + 8) << 12, SafeLoadAs<uint64_t>(in + 8) >> 40 | SafeLoadAs<uint64_t>(in + 16) << 24, SafeLoadAs<uint64_t>(in + 16) >> 28 | SafeLoadAs<uint64_t>(in + 24) << 36, SafeLoadAs<uint64_t>(in + 24) >> 16 | SafeLoadAs<uint64_t>(in + 32) << 48, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 56 | SafeLoadAs<uint64_t>(in + 40) << 8, SafeLoadAs<uint64_t>(in + 40) >> 44 | SafeLoadAs<uint64_t>(in + 48) << 20 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 4, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 52-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 48) >> 32 | SafeLoadAs<uint64_t>(in + 56) << 32, SafeLoadAs<uint64_t>(in + 56) >> 20 | SafeLoadAs<uint64_t>(in + 64) << 44, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 60 | SafeLoadAs<uint64_t>(in + 72) << 4, SafeLoadAs<uint64_t>(in + 72) >> 48 | SafeLoadAs<uint64_t>(in + 80) << 16, SafeLoadAs<uint64_t>(in + 80) >> 36 | SafeLoadAs<uint64_t>(in + 88) << 28, SafeLoadAs<uint64_t>(in + 88) >> 24 | SafeLoadAs<uint64_t>(in + 96) << 40, SafeLoadAs<uint64_t>(in + 96) };
+  shifts = simd_batch64{ 0, 0, 8, 0, 0, 0, 0, 12 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 52-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 104), SafeLoadAs<uint64_t>(in + 104) >> 52 | SafeLoadAs<uint64_t>(in + 112) << 12, SafeLoadAs<uint64_t>(in + 112) >> 40 | SafeLoadAs<uint64_t>(in + 120) << 24, SafeLoadAs<uint64_t>(in + 120) >> 28 | SafeLoadAs<uint64_t>(in + 128) << 36, SafeLoadAs<uint64_t>(in + 128) >> 16 | SafeLoadAs<uint64_t>(in + 136) << 48, SafeLoadAs<uint64_t>(in + 136), SafeLoadAs<uint64_t>(in + 136) >> 56 | SafeLoadAs<uint64_t>(in + 144) << 8, SafeLoadAs<uint64_t>(in + 144) >> 44 | SafeLoadAs<uint64_t>(in + 152) << 20 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 4, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 52-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 152) >> 32 | SafeLoadAs<uint64_t>(in + 160) << 32, SafeLoadAs<uint64_t>(in + 160) >> 20 | SafeLoadAs<uint64_t>(in + 168) << 44, SafeLoadAs<uint64_t>(in + 168), SafeLoadAs<uint64_t>(in + 168) >> 60 | SafeLoadAs<uint64_t>(in + 176) << 4, SafeLoadAs<uint64_t>(in + 176) >> 48 | SafeLoadAs<uint64_t>(in + 184) << 16, SafeLoadAs<uint64_t>(in + 184) >> 36 | SafeLoadAs<uint64_t>(in + 192) << 28, SafeLoadAs<uint64_t>(in + 192) >> 24 | SafeLoadAs<uint64_t>(in + 200) << 40, SafeLoadAs<uint64_t>(in + 200) };
+  shifts = simd_batch64{ 0, 0, 8, 0, 0, 0, 0, 12 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 208;
+  return in;
+}
+
+inline static const uint8_t* unpack53_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x1fffffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 53-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 53 | SafeLoadAs<uint64_t>(in + 8) << 11, SafeLoadAs<uint64_t>(in + 8) >> 42 | SafeLoadAs<uint64_t>(in + 16) << 22, SafeLoadAs<uint64_t>(in + 16) >> 31 | SafeLoadAs<uint64_t>(in + 24) << 33, SafeLoadAs<uint64_t>(in + 24) >> 20 | SafeLoadAs<uint64_t>(in + 32) << 44, SafeLoadAs<uint64_t>(in + 32), SafeLoadAs<uint64_t>(in + 32) >> 62 | SafeLoadAs<uint64_t>(in + 40) << 2, SafeLoadAs<uint64_t>(in + 40) >> 51 | SafeLoadAs<uint64_t>(in + 48) << 13 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 9, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 53-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 48) >> 40 | SafeLoadAs<uint64_t>(in + 56) << 24, SafeLoadAs<uint64_t>(in + 56) >> 29 | SafeLoadAs<uint64_t>(in + 64) << 35, SafeLoadAs<uint64_t>(in + 64) >> 18 | SafeLoadAs<uint64_t>(in + 72) << 46, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 60 | SafeLoadAs<uint64_t>(in + 80) << 4, SafeLoadAs<uint64_t>(in + 80) >> 49 | SafeLoadAs<uint64_t>(in + 88) << 15, SafeLoadAs<uint64_t>(in + 88) >> 38 | SafeLoadAs<uint64_t>(in + 96) << 26, SafeLoadAs<uint64_t>(in + 96) >> 27 | SafeLoadAs<uint64_t>(in + 104) << 37 };
+  shifts = simd_batch64{ 0, 0, 0, 7, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 53-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 104) >> 16 | SafeLoadAs<uint64_t>(in + 112) << 48, SafeLoadAs<uint64_t>(in + 112), SafeLoadAs<uint64_t>(in + 112) >> 58 | SafeLoadAs<uint64_t>(in + 120) << 6, SafeLoadAs<uint64_t>(in + 120) >> 47 | SafeLoadAs<uint64_t>(in + 128) << 17, SafeLoadAs<uint64_t>(in + 128) >> 36 | SafeLoadAs<uint64_t>(in + 136) << 28, SafeLoadAs<uint64_t>(in + 136) >> 25 | SafeLoadAs<uint64_t>(in + 144) << 39, SafeLoadAs<uint64_t>(in + 144) >> 14 | SafeLoadAs<uint64_t>(in + 152) << 50, SafeLoadAs<uint64_t>(in + 152) };
+  shifts = simd_batch64{ 0, 5, 0, 0, 0, 0, 0, 3 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 53-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 152) >> 56 | SafeLoadAs<uint64_t>(in + 160) << 8, SafeLoadAs<uint64_t>(in + 160) >> 45 | SafeLoadAs<uint64_t>(in + 168) << 19, SafeLoadAs<uint64_t>(in + 168) >> 34 | SafeLoadAs<uint64_t>(in + 176) << 30, SafeLoadAs<uint64_t>(in + 176) >> 23 | SafeLoadAs<uint64_t>(in + 184) << 41, SafeLoadAs<uint64_t>(in + 184) >> 12 | SafeLoadAs<uint64_t>(in + 192) << 52, SafeLoadAs<uint64_t>(in + 192), SafeLoadAs<uint64_t>(in + 192) >> 54 | SafeLoadAs<uint64_t>(in + 200) << 10, SafeLoadAs<uint64_t>(in + 200) >> 43 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 208)) << 21 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 1, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 212;
+  return in;
+}
+
+inline static const uint8_t* unpack54_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x3fffffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 54-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 54 | SafeLoadAs<uint64_t>(in + 8) << 10, SafeLoadAs<uint64_t>(in + 8) >> 44 | SafeLoadAs<uint64_t>(in + 16) << 20, SafeLoadAs<uint64_t>(in + 16) >> 34 | SafeLoadAs<uint64_t>(in + 24) << 30, SafeLoadAs<uint64_t>(in + 24) >> 24 | SafeLoadAs<uint64_t>(in + 32) << 40, SafeLoadAs<uint64_t>(in + 32) >> 14 | SafeLoadAs<uint64_t>(in + 40) << 50, SafeLoadAs<uint64_t>(in + 40), SafeLoadAs<uint64_t>(in + 40) >> 58 | SafeLoadAs<uint64_t>(in + 48) << 6 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 4, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 54-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 48) >> 48 | SafeLoadAs<uint64_t>(in + 56) << 16, SafeLoadAs<uint64_t>(in + 56) >> 38 | SafeLoadAs<uint64_t>(in + 64) << 26, SafeLoadAs<uint64_t>(in + 64) >> 28 | SafeLoadAs<uint64_t>(in + 72) << 36, SafeLoadAs<uint64_t>(in + 72) >> 18 | SafeLoadAs<uint64_t>(in + 80) << 46, SafeLoadAs<uint64_t>(in + 80), SafeLoadAs<uint64_t>(in + 80) >> 62 | SafeLoadAs<uint64_t>(in + 88) << 2, SafeLoadAs<uint64_t>(in + 88) >> 52 | SafeLoadAs<uint64_t>(in + 96) << 12, SafeLoadAs<uint64_t>(in + 96) >> 42 | SafeLoadAs<uint64_t>(in + 104) << 22 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 8, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 54-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 104) >> 32 | SafeLoadAs<uint64_t>(in + 112) << 32, SafeLoadAs<uint64_t>(in + 112) >> 22 | SafeLoadAs<uint64_t>(in + 120) << 42, SafeLoadAs<uint64_t>(in + 120) >> 12 | SafeLoadAs<uint64_t>(in + 128) << 52, SafeLoadAs<uint64_t>(in + 128), SafeLoadAs<uint64_t>(in + 128) >> 56 | SafeLoadAs<uint64_t>(in + 136) << 8, SafeLoadAs<uint64_t>(in + 136) >> 46 | SafeLoadAs<uint64_t>(in + 144) << 18, SafeLoadAs<uint64_t>(in + 144) >> 36 | SafeLoadAs<uint64_t>(in + 152) << 28, SafeLoadAs<uint64_t>(in + 152) >> 26 | SafeLoadAs<uint64_t>(in + 160) << 38 };
+  shifts = simd_batch64{ 0, 0, 0, 2, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 54-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 160) >> 16 | SafeLoadAs<uint64_t>(in + 168) << 48, SafeLoadAs<uint64_t>(in + 168), SafeLoadAs<uint64_t>(in + 168) >> 60 | SafeLoadAs<uint64_t>(in + 176) << 4, SafeLoadAs<uint64_t>(in + 176) >> 50 | SafeLoadAs<uint64_t>(in + 184) << 14, SafeLoadAs<uint64_t>(in + 184) >> 40 | SafeLoadAs<uint64_t>(in + 192) << 24, SafeLoadAs<uint64_t>(in + 192) >> 30 | SafeLoadAs<uint64_t>(in + 200) << 34, SafeLoadAs<uint64_t>(in + 200) >> 20 | SafeLoadAs<uint64_t>(in + 208) << 44, SafeLoadAs<uint64_t>(in + 208) };
+  shifts = simd_batch64{ 0, 6, 0, 0, 0, 0, 0, 10 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 216;
+  return in;
+}
+
+inline static const uint8_t* unpack55_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x7fffffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 55-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 55 | SafeLoadAs<uint64_t>(in + 8) << 9, SafeLoadAs<uint64_t>(in + 8) >> 46 | SafeLoadAs<uint64_t>(in + 16) << 18, SafeLoadAs<uint64_t>(in + 16) >> 37 | SafeLoadAs<uint64_t>(in + 24) << 27, SafeLoadAs<uint64_t>(in + 24) >> 28 | SafeLoadAs<uint64_t>(in + 32) << 36, SafeLoadAs<uint64_t>(in + 32) >> 19 | SafeLoadAs<uint64_t>(in + 40) << 45, SafeLoadAs<uint64_t>(in + 40) >> 10 | SafeLoadAs<uint64_t>(in + 48) << 54, SafeLoadAs<uint64_t>(in + 48) };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 1 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 55-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 48) >> 56 | SafeLoadAs<uint64_t>(in + 56) << 8, SafeLoadAs<uint64_t>(in + 56) >> 47 | SafeLoadAs<uint64_t>(in + 64) << 17, SafeLoadAs<uint64_t>(in + 64) >> 38 | SafeLoadAs<uint64_t>(in + 72) << 26, SafeLoadAs<uint64_t>(in + 72) >> 29 | SafeLoadAs<uint64_t>(in + 80) << 35, SafeLoadAs<uint64_t>(in + 80) >> 20 | SafeLoadAs<uint64_t>(in + 88) << 44, SafeLoadAs<uint64_t>(in + 88) >> 11 | SafeLoadAs<uint64_t>(in + 96) << 53, SafeLoadAs<uint64_t>(in + 96), SafeLoadAs<uint64_t>(in + 96) >> 57 | SafeLoadAs<uint64_t>(in + 104) << 7 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 2, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 55-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 104) >> 48 | SafeLoadAs<uint64_t>(in + 112) << 16, SafeLoadAs<uint64_t>(in + 112) >> 39 | SafeLoadAs<uint64_t>(in + 120) << 25, SafeLoadAs<uint64_t>(in + 120) >> 30 | SafeLoadAs<uint64_t>(in + 128) << 34, SafeLoadAs<uint64_t>(in + 128) >> 21 | SafeLoadAs<uint64_t>(in + 136) << 43, SafeLoadAs<uint64_t>(in + 136) >> 12 | SafeLoadAs<uint64_t>(in + 144) << 52, SafeLoadAs<uint64_t>(in + 144), SafeLoadAs<uint64_t>(in + 144) >> 58 | SafeLoadAs<uint64_t>(in + 152) << 6, SafeLoadAs<uint64_t>(in + 152) >> 49 | SafeLoadAs<uint64_t>(in + 160) << 15 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 3, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 55-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 160) >> 40 | SafeLoadAs<uint64_t>(in + 168) << 24, SafeLoadAs<uint64_t>(in + 168) >> 31 | SafeLoadAs<uint64_t>(in + 176) << 33, SafeLoadAs<uint64_t>(in + 176) >> 22 | SafeLoadAs<uint64_t>(in + 184) << 42, SafeLoadAs<uint64_t>(in + 184) >> 13 | SafeLoadAs<uint64_t>(in + 192) << 51, SafeLoadAs<uint64_t>(in + 192), SafeLoadAs<uint64_t>(in + 192) >> 59 | SafeLoadAs<uint64_t>(in + 200) << 5, SafeLoadAs<uint64_t>(in + 200) >> 50 | SafeLoadAs<uint64_t>(in + 208) << 14, SafeLoadAs<uint64_t>(in + 208) >> 41 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 216)) << 23 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 4, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 220;
+  return in;
+}
+
+inline static const uint8_t* unpack56_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0xffffffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 56-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 56 | SafeLoadAs<uint64_t>(in + 8) << 8, SafeLoadAs<uint64_t>(in + 8) >> 48 | SafeLoadAs<uint64_t>(in + 16) << 16, SafeLoadAs<uint64_t>(in + 16) >> 40 | SafeLoadAs<uint64_t>(in + 24) << 24, SafeLoadAs<uint64_t>(in + 24) >> 32 | SafeLoadAs<uint64_t>(in + 32) << 32, SafeLoadAs<uint64_t>(in + 32) >> 24 | SafeLoadAs<uint64_t>(in + 40) << 40, SafeLoadAs<uint64_t>(in + 40) >> 16 | SafeLoadAs<uint64_t>(in + 48) << 48, SafeLoadAs<uint64_t>(in + 48) };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 8 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 56-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 56), SafeLoadAs<uint64_t>(in + 56) >> 56 | SafeLoadAs<uint64_t>(in + 64) << 8, SafeLoadAs<uint64_t>(in + 64) >> 48 | SafeLoadAs<uint64_t>(in + 72) << 16, SafeLoadAs<uint64_t>(in + 72) >> 40 | SafeLoadAs<uint64_t>(in + 80) << 24, SafeLoadAs<uint64_t>(in + 80) >> 32 | SafeLoadAs<uint64_t>(in + 88) << 32, SafeLoadAs<uint64_t>(in + 88) >> 24 | SafeLoadAs<uint64_t>(in + 96) << 40, SafeLoadAs<uint64_t>(in + 96) >> 16 | SafeLoadAs<uint64_t>(in + 104) << 48, SafeLoadAs<uint64_t>(in + 104) };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 8 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 56-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 112), SafeLoadAs<uint64_t>(in + 112) >> 56 | SafeLoadAs<uint64_t>(in + 120) << 8, SafeLoadAs<uint64_t>(in + 120) >> 48 | SafeLoadAs<uint64_t>(in + 128) << 16, SafeLoadAs<uint64_t>(in + 128) >> 40 | SafeLoadAs<uint64_t>(in + 136) << 24, SafeLoadAs<uint64_t>(in + 136) >> 32 | SafeLoadAs<uint64_t>(in + 144) << 32, SafeLoadAs<uint64_t>(in + 144) >> 24 | SafeLoadAs<uint64_t>(in + 152) << 40, SafeLoadAs<uint64_t>(in + 152) >> 16 | SafeLoadAs<uint64_t>(in + 160) << 48, SafeLoadAs<uint64_t>(in + 160) };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 8 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 56-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 168), SafeLoadAs<uint64_t>(in + 168) >> 56 | SafeLoadAs<uint64_t>(in + 176) << 8, SafeLoadAs<uint64_t>(in + 176) >> 48 | SafeLoadAs<uint64_t>(in + 184) << 16, SafeLoadAs<uint64_t>(in + 184) >> 40 | SafeLoadAs<uint64_t>(in + 192) << 24, SafeLoadAs<uint64_t>(in + 192) >> 32 | SafeLoadAs<uint64_t>(in + 200) << 32, SafeLoadAs<uint64_t>(in + 200) >> 24 | SafeLoadAs<uint64_t>(in + 208) << 40, SafeLoadAs<uint64_t>(in + 208) >> 16 | SafeLoadAs<uint64_t>(in + 216) << 48, SafeLoadAs<uint64_t>(in + 216) };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 8 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 224;
+  return in;
+}
+
+inline static const uint8_t* unpack57_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x1ffffffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 57-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 57 | SafeLoadAs<uint64_t>(in + 8) << 7, SafeLoadAs<uint64_t>(in + 8) >> 50 | SafeLoadAs<uint64_t>(in + 16) << 14, SafeLoadAs<uint64_t>(in + 16) >> 43 | SafeLoadAs<uint64_t>(in + 24) << 21, SafeLoadAs<uint64_t>(in + 24) >> 36 | SafeLoadAs<uint64_t>(in + 32) << 28, SafeLoadAs<uint64_t>(in + 32) >> 29 | SafeLoadAs<uint64_t>(in + 40) << 35, SafeLoadAs<uint64_t>(in + 40) >> 22 | SafeLoadAs<uint64_t>(in + 48) << 42, SafeLoadAs<uint64_t>(in + 48) >> 15 | SafeLoadAs<uint64_t>(in + 56) << 49 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 57-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 56) >> 8 | SafeLoadAs<uint64_t>(in + 64) << 56, SafeLoadAs<uint64_t>(in + 64), SafeLoadAs<uint64_t>(in + 64) >> 58 | SafeLoadAs<uint64_t>(in + 72) << 6, SafeLoadAs<uint64_t>(in + 72) >> 51 | SafeLoadAs<uint64_t>(in + 80) << 13, SafeLoadAs<uint64_t>(in + 80) >> 44 | SafeLoadAs<uint64_t>(in + 88) << 20, SafeLoadAs<uint64_t>(in + 88) >> 37 | SafeLoadAs<uint64_t>(in + 96) << 27, SafeLoadAs<uint64_t>(in + 96) >> 30 | SafeLoadAs<uint64_t>(in + 104) << 34, SafeLoadAs<uint64_t>(in + 104) >> 23 | SafeLoadAs<uint64_t>(in + 112) << 41 };
+  shifts = simd_batch64{ 0, 1, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 57-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 112) >> 16 | SafeLoadAs<uint64_t>(in + 120) << 48, SafeLoadAs<uint64_t>(in + 120) >> 9 | SafeLoadAs<uint64_t>(in + 128) << 55, SafeLoadAs<uint64_t>(in + 128), SafeLoadAs<uint64_t>(in + 128) >> 59 | SafeLoadAs<uint64_t>(in + 136) << 5, SafeLoadAs<uint64_t>(in + 136) >> 52 | SafeLoadAs<uint64_t>(in + 144) << 12, SafeLoadAs<uint64_t>(in + 144) >> 45 | SafeLoadAs<uint64_t>(in + 152) << 19, SafeLoadAs<uint64_t>(in + 152) >> 38 | SafeLoadAs<uint64_t>(in + 160) << 26, SafeLoadAs<uint64_t>(in + 160) >> 31 | SafeLoadAs<uint64_t>(in + 168) << 33 };
+  shifts = simd_batch64{ 0, 0, 2, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 57-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 168) >> 24 | SafeLoadAs<uint64_t>(in + 176) << 40, SafeLoadAs<uint64_t>(in + 176) >> 17 | SafeLoadAs<uint64_t>(in + 184) << 47, SafeLoadAs<uint64_t>(in + 184) >> 10 | SafeLoadAs<uint64_t>(in + 192) << 54, SafeLoadAs<uint64_t>(in + 192), SafeLoadAs<uint64_t>(in + 192) >> 60 | SafeLoadAs<uint64_t>(in + 200) << 4, SafeLoadAs<uint64_t>(in + 200) >> 53 | SafeLoadAs<uint64_t>(in + 208) << 11, SafeLoadAs<uint64_t>(in + 208) >> 46 | SafeLoadAs<uint64_t>(in + 216) << 18, SafeLoadAs<uint64_t>(in + 216) >> 39 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 224)) << 25 };
+  shifts = simd_batch64{ 0, 0, 0, 3, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 228;
+  return in;
+}
+
+inline static const uint8_t* unpack58_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x3ffffffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 58-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 58 | SafeLoadAs<uint64_t>(in + 8) << 6, SafeLoadAs<uint64_t>(in + 8) >> 52 | SafeLoadAs<uint64_t>(in + 16) << 12, SafeLoadAs<uint64_t>(in + 16) >> 46 | SafeLoadAs<uint64_t>(in + 24) << 18, SafeLoadAs<uint64_t>(in + 24) >> 40 | SafeLoadAs<uint64_t>(in + 32) << 24, SafeLoadAs<uint64_t>(in + 32) >> 34 | SafeLoadAs<uint64_t>(in + 40) << 30, SafeLoadAs<uint64_t>(in + 40) >> 28 | SafeLoadAs<uint64_t>(in + 48) << 36, SafeLoadAs<uint64_t>(in + 48) >> 22 | SafeLoadAs<uint64_t>(in + 56) << 42 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 58-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 56) >> 16 | SafeLoadAs<uint64_t>(in + 64) << 48, SafeLoadAs<uint64_t>(in + 64) >> 10 | SafeLoadAs<uint64_t>(in + 72) << 54, SafeLoadAs<uint64_t>(in + 72), SafeLoadAs<uint64_t>(in + 72) >> 62 | SafeLoadAs<uint64_t>(in + 80) << 2, SafeLoadAs<uint64_t>(in + 80) >> 56 | SafeLoadAs<uint64_t>(in + 88) << 8, SafeLoadAs<uint64_t>(in + 88) >> 50 | SafeLoadAs<uint64_t>(in + 96) << 14, SafeLoadAs<uint64_t>(in + 96) >> 44 | SafeLoadAs<uint64_t>(in + 104) << 20, SafeLoadAs<uint64_t>(in + 104) >> 38 | SafeLoadAs<uint64_t>(in + 112) << 26 };
+  shifts = simd_batch64{ 0, 0, 4, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 58-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 112) >> 32 | SafeLoadAs<uint64_t>(in + 120) << 32, SafeLoadAs<uint64_t>(in + 120) >> 26 | SafeLoadAs<uint64_t>(in + 128) << 38, SafeLoadAs<uint64_t>(in + 128) >> 20 | SafeLoadAs<uint64_t>(in + 136) << 44, SafeLoadAs<uint64_t>(in + 136) >> 14 | SafeLoadAs<uint64_t>(in + 144) << 50, SafeLoadAs<uint64_t>(in + 144) >> 8 | SafeLoadAs<uint64_t>(in + 152) << 56, SafeLoadAs<uint64_t>(in + 152), SafeLoadAs<uint64_t>(in + 152) >> 60 | SafeLoadAs<uint64_t>(in + 160) << 4, SafeLoadAs<uint64_t>(in + 160) >> 54 | SafeLoadAs<uint64_t>(in + 168) << 10 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 2, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 58-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 168) >> 48 | SafeLoadAs<uint64_t>(in + 176) << 16, SafeLoadAs<uint64_t>(in + 176) >> 42 | SafeLoadAs<uint64_t>(in + 184) << 22, SafeLoadAs<uint64_t>(in + 184) >> 36 | SafeLoadAs<uint64_t>(in + 192) << 28, SafeLoadAs<uint64_t>(in + 192) >> 30 | SafeLoadAs<uint64_t>(in + 200) << 34, SafeLoadAs<uint64_t>(in + 200) >> 24 | SafeLoadAs<uint64_t>(in + 208) << 40, SafeLoadAs<uint64_t>(in + 208) >> 18 | SafeLoadAs<uint64_t>(in + 216) << 46, SafeLoadAs<uint64_t>(in + 216) >> 12 | SafeLoadAs<uint64_t>(in + 224) << 52, SafeLoadAs<uint64_t>(in + 224) };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 6 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 232;
+  return in;
+}
+
+inline static const uint8_t* unpack59_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x7ffffffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 59-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 59 | SafeLoadAs<uint64_t>(in + 8) << 5, SafeLoadAs<uint64_t>(in + 8) >> 54 | SafeLoadAs<uint64_t>(in + 16) << 10, SafeLoadAs<uint64_t>(in + 16) >> 49 | SafeLoadAs<uint64_t>(in + 24) << 15, SafeLoadAs<uint64_t>(in + 24) >> 44 | SafeLoadAs<uint64_t>(in + 32) << 20, SafeLoadAs<uint64_t>(in + 32) >> 39 | SafeLoadAs<uint64_t>(in + 40) << 25, SafeLoadAs<uint64_t>(in + 40) >> 34 | SafeLoadAs<uint64_t>(in + 48) << 30, SafeLoadAs<uint64_t>(in + 48) >> 29 | SafeLoadAs<uint64_t>(in + 56) << 35 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 59-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 56) >> 24 | SafeLoadAs<uint64_t>(in + 64) << 40, SafeLoadAs<uint64_t>(in + 64) >> 19 | SafeLoadAs<uint64_t>(in + 72) << 45, SafeLoadAs<uint64_t>(in + 72) >> 14 | SafeLoadAs<uint64_t>(in + 80) << 50, SafeLoadAs<uint64_t>(in + 80) >> 9 | SafeLoadAs<uint64_t>(in + 88) << 55, SafeLoadAs<uint64_t>(in + 88), SafeLoadAs<uint64_t>(in + 88) >> 63 | SafeLoadAs<uint64_t>(in + 96) << 1, SafeLoadAs<uint64_t>(in + 96) >> 58 | SafeLoadAs<uint64_t>(in + 104) << 6, SafeLoadAs<uint64_t>(in + 104) >> 53 | SafeLoadAs<uint64_t>(in + 112) << 11 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 4, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 59-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 112) >> 48 | SafeLoadAs<uint64_t>(in + 120) << 16, SafeLoadAs<uint64_t>(in + 120) >> 43 | SafeLoadAs<uint64_t>(in + 128) << 21, SafeLoadAs<uint64_t>(in + 128) >> 38 | SafeLoadAs<uint64_t>(in + 136) << 26, SafeLoadAs<uint64_t>(in + 136) >> 33 | SafeLoadAs<uint64_t>(in + 144) << 31, SafeLoadAs<uint64_t>(in + 144) >> 28 | SafeLoadAs<uint64_t>(in + 152) << 36, SafeLoadAs<uint64_t>(in + 152) >> 23 | SafeLoadAs<uint64_t>(in + 160) << 41, SafeLoadAs<uint64_t>(in + 160) >> 18 | SafeLoadAs<uint64_t>(in + 168) << 46, SafeLoadAs<uint64_t>(in + 168) >> 13 | SafeLoadAs<uint64_t>(in + 176) << 51 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 59-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 176) >> 8 | SafeLoadAs<uint64_t>(in + 184) << 56, SafeLoadAs<uint64_t>(in + 184), SafeLoadAs<uint64_t>(in + 184) >> 62 | SafeLoadAs<uint64_t>(in + 192) << 2, SafeLoadAs<uint64_t>(in + 192) >> 57 | SafeLoadAs<uint64_t>(in + 200) << 7, SafeLoadAs<uint64_t>(in + 200) >> 52 | SafeLoadAs<uint64_t>(in + 208) << 12, SafeLoadAs<uint64_t>(in + 208) >> 47 | SafeLoadAs<uint64_t>(in + 216) << 17, SafeLoadAs<uint64_t>(in + 216) >> 42 | SafeLoadAs<uint64_t>(in + 224) << 22, SafeLoadAs<uint64_t>(in + 224) >> 37 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 232)) << 27 };
+  shifts = simd_batch64{ 0, 3, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 236;
+  return in;
+}
+
+inline static const uint8_t* unpack60_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0xfffffffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 60-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 60 | SafeLoadAs<uint64_t>(in + 8) << 4, SafeLoadAs<uint64_t>(in + 8) >> 56 | SafeLoadAs<uint64_t>(in + 16) << 8, SafeLoadAs<uint64_t>(in + 16) >> 52 | SafeLoadAs<uint64_t>(in + 24) << 12, SafeLoadAs<uint64_t>(in + 24) >> 48 | SafeLoadAs<uint64_t>(in + 32) << 16, SafeLoadAs<uint64_t>(in + 32) >> 44 | SafeLoadAs<uint64_t>(in + 40) << 20, SafeLoadAs<uint64_t>(in + 40) >> 40 | SafeLoadAs<uint64_t>(in + 48) << 24, SafeLoadAs<uint64_t>(in + 48) >> 36 | SafeLoadAs<uint64_t>(in + 56) << 28 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 60-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 56) >> 32 | SafeLoadAs<uint64_t>(in + 64) << 32, SafeLoadAs<uint64_t>(in + 64) >> 28 | SafeLoadAs<uint64_t>(in + 72) << 36, SafeLoadAs<uint64_t>(in + 72) >> 24 | SafeLoadAs<uint64_t>(in + 80) << 40, SafeLoadAs<uint64_t>(in + 80) >> 20 | SafeLoadAs<uint64_t>(in + 88) << 44, SafeLoadAs<uint64_t>(in + 88) >> 16 | SafeLoadAs<uint64_t>(in + 96) << 48, SafeLoadAs<uint64_t>(in + 96) >> 12 | SafeLoadAs<uint64_t>(in + 104) << 52, SafeLoadAs<uint64_t>(in + 104) >> 8 | SafeLoadAs<uint64_t>(in + 112) << 56, SafeLoadAs<uint64_t>(in + 112) };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 4 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 60-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 120), SafeLoadAs<uint64_t>(in + 120) >> 60 | SafeLoadAs<uint64_t>(in + 128) << 4, SafeLoadAs<uint64_t>(in + 128) >> 56 | SafeLoadAs<uint64_t>(in + 136) << 8, SafeLoadAs<uint64_t>(in + 136) >> 52 | SafeLoadAs<uint64_t>(in + 144) << 12, SafeLoadAs<uint64_t>(in + 144) >> 48 | SafeLoadAs<uint64_t>(in + 152) << 16, SafeLoadAs<uint64_t>(in + 152) >> 44 | SafeLoadAs<uint64_t>(in + 160) << 20, SafeLoadAs<uint64_t>(in + 160) >> 40 | SafeLoadAs<uint64_t>(in + 168) << 24, SafeLoadAs<uint64_t>(in + 168) >> 36 | SafeLoadAs<uint64_t>(in + 176) << 28 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 60-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 176) >> 32 | SafeLoadAs<uint64_t>(in + 184) << 32, SafeLoadAs<uint64_t>(in + 184) >> 28 | SafeLoadAs<uint64_t>(in + 192) << 36, SafeLoadAs<uint64_t>(in + 192) >> 24 | SafeLoadAs<uint64_t>(in + 200) << 40, SafeLoadAs<uint64_t>(in + 200) >> 20 | SafeLoadAs<uint64_t>(in + 208) << 44, SafeLoadAs<uint64_t>(in + 208) >> 16 | SafeLoadAs<uint64_t>(in + 216) << 48, SafeLoadAs<uint64_t>(in + 216) >> 12 | SafeLoadAs<uint64_t>(in + 224) << 52, SafeLoadAs<uint64_t>(in + 224) >> 8 | SafeLoadAs<uint64_t>(in + 232) << 56, SafeLoadAs<uint64_t>(in + 232) };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 4 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 240;
+  return in;
+}
+
+inline static const uint8_t* unpack61_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x1fffffffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 61-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 61 | SafeLoadAs<uint64_t>(in + 8) << 3, SafeLoadAs<uint64_t>(in + 8) >> 58 | SafeLoadAs<uint64_t>(in + 16) << 6, SafeLoadAs<uint64_t>(in + 16) >> 55 | SafeLoadAs<uint64_t>(in + 24) << 9, SafeLoadAs<uint64_t>(in + 24) >> 52 | SafeLoadAs<uint64_t>(in + 32) << 12, SafeLoadAs<uint64_t>(in + 32) >> 49 | SafeLoadAs<uint64_t>(in + 40) << 15, SafeLoadAs<uint64_t>(in + 40) >> 46 | SafeLoadAs<uint64_t>(in + 48) << 18, SafeLoadAs<uint64_t>(in + 48) >> 43 | SafeLoadAs<uint64_t>(in + 56) << 21 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 61-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 56) >> 40 | SafeLoadAs<uint64_t>(in + 64) << 24, SafeLoadAs<uint64_t>(in + 64) >> 37 | SafeLoadAs<uint64_t>(in + 72) << 27, SafeLoadAs<uint64_t>(in + 72) >> 34 | SafeLoadAs<uint64_t>(in + 80) << 30, SafeLoadAs<uint64_t>(in + 80) >> 31 | SafeLoadAs<uint64_t>(in + 88) << 33, SafeLoadAs<uint64_t>(in + 88) >> 28 | SafeLoadAs<uint64_t>(in + 96) << 36, SafeLoadAs<uint64_t>(in + 96) >> 25 | SafeLoadAs<uint64_t>(in + 104) << 39, SafeLoadAs<uint64_t>(in + 104) >> 22 | SafeLoadAs<uint64_t>(in + 112) << 42, SafeLoadAs<uint64_t>(in + 112) >> 19 | SafeLoadAs<uint64_t>(in + 120) << 45 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 61-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 120) >> 16 | SafeLoadAs<uint64_t>(in + 128) << 48, SafeLoadAs<uint64_t>(in + 128) >> 13 | SafeLoadAs<uint64_t>(in + 136) << 51, SafeLoadAs<uint64_t>(in + 136) >> 10 | SafeLoadAs<uint64_t>(in + 144) << 54, SafeLoadAs<uint64_t>(in + 144) >> 7 | SafeLoadAs<uint64_t>(in + 152) << 57, SafeLoadAs<uint64_t>(in + 152) >> 4 | SafeLoadAs<uint64_t>(in + 160) << 60, SafeLoadAs<uint64_t>(in + 160), SafeLoadAs<uint64_t>(in + 160) >> 62 | SafeLoadAs<uint64_t>(in + 168) << 2, SafeLoadAs<uint64_t>(in + 168) >> 59 | SafeLoadAs<uint64_t>(in + 176) << 5 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 1, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 61-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 176) >> 56 | SafeLoadAs<uint64_t>(in + 184) << 8, SafeLoadAs<uint64_t>(in + 184) >> 53 | SafeLoadAs<uint64_t>(in + 192) << 11, SafeLoadAs<uint64_t>(in + 192) >> 50 | SafeLoadAs<uint64_t>(in + 200) << 14, SafeLoadAs<uint64_t>(in + 200) >> 47 | SafeLoadAs<uint64_t>(in + 208) << 17, SafeLoadAs<uint64_t>(in + 208) >> 44 | SafeLoadAs<uint64_t>(in + 216) << 20, SafeLoadAs<uint64_t>(in + 216) >> 41 | SafeLoadAs<uint64_t>(in + 224) << 23, SafeLoadAs<uint64_t>(in + 224) >> 38 | SafeLoadAs<uint64_t>(in + 232) << 26, SafeLoadAs<uint64_t>(in + 232) >> 35 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 240)) << 29 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 244;
+  return in;
+}
+
+inline static const uint8_t* unpack62_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x3fffffffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 62-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 62 | SafeLoadAs<uint64_t>(in + 8) << 2, SafeLoadAs<uint64_t>(in + 8) >> 60 | SafeLoadAs<uint64_t>(in + 16) << 4, SafeLoadAs<uint64_t>(in + 16) >> 58 | SafeLoadAs<uint64_t>(in + 24) << 6, SafeLoadAs<uint64_t>(in + 24) >> 56 | SafeLoadAs<uint64_t>(in + 32) << 8, SafeLoadAs<uint64_t>(in + 32) >> 54 | SafeLoadAs<uint64_t>(in + 40) << 10, SafeLoadAs<uint64_t>(in + 40) >> 52 | SafeLoadAs<uint64_t>(in + 48) << 12, SafeLoadAs<uint64_t>(in + 48) >> 50 | SafeLoadAs<uint64_t>(in + 56) << 14 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 62-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 56) >> 48 | SafeLoadAs<uint64_t>(in + 64) << 16, SafeLoadAs<uint64_t>(in + 64) >> 46 | SafeLoadAs<uint64_t>(in + 72) << 18, SafeLoadAs<uint64_t>(in + 72) >> 44 | SafeLoadAs<uint64_t>(in + 80) << 20, SafeLoadAs<uint64_t>(in + 80) >> 42 | SafeLoadAs<uint64_t>(in + 88) << 22, SafeLoadAs<uint64_t>(in + 88) >> 40 | SafeLoadAs<uint64_t>(in + 96) << 24, SafeLoadAs<uint64_t>(in + 96) >> 38 | SafeLoadAs<uint64_t>(in + 104) << 26, SafeLoadAs<uint64_t>(in + 104) >> 36 | SafeLoadAs<uint64_t>(in + 112) << 28, SafeLoadAs<uint64_t>(in + 112) >> 34 | SafeLoadAs<uint64_t>(in + 120) << 30 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 62-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 120) >> 32 | SafeLoadAs<uint64_t>(in + 128) << 32, SafeLoadAs<uint64_t>(in + 128) >> 30 | SafeLoadAs<uint64_t>(in + 136) << 34, SafeLoadAs<uint64_t>(in + 136) >> 28 | SafeLoadAs<uint64_t>(in + 144) << 36, SafeLoadAs<uint64_t>(in + 144) >> 26 | SafeLoadAs<uint64_t>(in + 152) << 38, SafeLoadAs<uint64_t>(in + 152) >> 24 | SafeLoadAs<uint64_t>(in + 160) << 40, SafeLoadAs<uint64_t>(in + 160) >> 22 | SafeLoadAs<uint64_t>(in + 168) << 42, SafeLoadAs<uint64_t>(in + 168) >> 20 | SafeLoadAs<uint64_t>(in + 176) << 44, SafeLoadAs<uint64_t>(in + 176) >> 18 | SafeLoadAs<uint64_t>(in + 184) << 46 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 62-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 184) >> 16 | SafeLoadAs<uint64_t>(in + 192) << 48, SafeLoadAs<uint64_t>(in + 192) >> 14 | SafeLoadAs<uint64_t>(in + 200) << 50, SafeLoadAs<uint64_t>(in + 200) >> 12 | SafeLoadAs<uint64_t>(in + 208) << 52, SafeLoadAs<uint64_t>(in + 208) >> 10 | SafeLoadAs<uint64_t>(in + 216) << 54, SafeLoadAs<uint64_t>(in + 216) >> 8 | SafeLoadAs<uint64_t>(in + 224) << 56, SafeLoadAs<uint64_t>(in + 224) >> 6 | SafeLoadAs<uint64_t>(in + 232) << 58, SafeLoadAs<uint64_t>(in + 232) >> 4 | SafeLoadAs<uint64_t>(in + 240) << 60, SafeLoadAs<uint64_t>(in + 240) };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 2 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 248;
+  return in;
+}
+
+inline static const uint8_t* unpack63_64(const uint8_t* in, uint64_t* out) {
+  uint64_t mask = 0x7fffffffffffffff;
+
+  simd_batch64 masks(mask);
+  simd_batch64 words, shifts;
+  simd_batch64 results;
+
+  // extract 63-bit bundles 0 to 7
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 0), SafeLoadAs<uint64_t>(in + 0) >> 63 | SafeLoadAs<uint64_t>(in + 8) << 1, SafeLoadAs<uint64_t>(in + 8) >> 62 | SafeLoadAs<uint64_t>(in + 16) << 2, SafeLoadAs<uint64_t>(in + 16) >> 61 | SafeLoadAs<uint64_t>(in + 24) << 3, SafeLoadAs<uint64_t>(in + 24) >> 60 | SafeLoadAs<uint64_t>(in + 32) << 4, SafeLoadAs<uint64_t>(in + 32) >> 59 | SafeLoadAs<uint64_t>(in + 40) << 5, SafeLoadAs<uint64_t>(in + 40) >> 58 | SafeLoadAs<uint64_t>(in + 48) << 6, SafeLoadAs<uint64_t>(in + 48) >> 57 | SafeLoadAs<uint64_t>(in + 56) << 7 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 63-bit bundles 8 to 15
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 56) >> 56 | SafeLoadAs<uint64_t>(in + 64) << 8, SafeLoadAs<uint64_t>(in + 64) >> 55 | SafeLoadAs<uint64_t>(in + 72) << 9, SafeLoadAs<uint64_t>(in + 72) >> 54 | SafeLoadAs<uint64_t>(in + 80) << 10, SafeLoadAs<uint64_t>(in + 80) >> 53 | SafeLoadAs<uint64_t>(in + 88) << 11, SafeLoadAs<uint64_t>(in + 88) >> 52 | SafeLoadAs<uint64_t>(in + 96) << 12, SafeLoadAs<uint64_t>(in + 96) >> 51 | SafeLoadAs<uint64_t>(in + 104) << 13, SafeLoadAs<uint64_t>(in + 104) >> 50 | SafeLoadAs<uint64_t>(in + 112) << 14, SafeLoadAs<uint64_t>(in + 112) >> 49 | SafeLoadAs<uint64_t>(in + 120) << 15 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 63-bit bundles 16 to 23
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 120) >> 48 | SafeLoadAs<uint64_t>(in + 128) << 16, SafeLoadAs<uint64_t>(in + 128) >> 47 | SafeLoadAs<uint64_t>(in + 136) << 17, SafeLoadAs<uint64_t>(in + 136) >> 46 | SafeLoadAs<uint64_t>(in + 144) << 18, SafeLoadAs<uint64_t>(in + 144) >> 45 | SafeLoadAs<uint64_t>(in + 152) << 19, SafeLoadAs<uint64_t>(in + 152) >> 44 | SafeLoadAs<uint64_t>(in + 160) << 20, SafeLoadAs<uint64_t>(in + 160) >> 43 | SafeLoadAs<uint64_t>(in + 168) << 21, SafeLoadAs<uint64_t>(in + 168) >> 42 | SafeLoadAs<uint64_t>(in + 176) << 22, SafeLoadAs<uint64_t>(in + 176) >> 41 | SafeLoadAs<uint64_t>(in + 184) << 23 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  // extract 63-bit bundles 24 to 31
+  words = simd_batch64{ SafeLoadAs<uint64_t>(in + 184) >> 40 | SafeLoadAs<uint64_t>(in + 192) << 24, SafeLoadAs<uint64_t>(in + 192) >> 39 | SafeLoadAs<uint64_t>(in + 200) << 25, SafeLoadAs<uint64_t>(in + 200) >> 38 | SafeLoadAs<uint64_t>(in + 208) << 26, SafeLoadAs<uint64_t>(in + 208) >> 37 | SafeLoadAs<uint64_t>(in + 216) << 27, SafeLoadAs<uint64_t>(in + 216) >> 36 | SafeLoadAs<uint64_t>(in + 224) << 28, SafeLoadAs<uint64_t>(in + 224) >> 35 | SafeLoadAs<uint64_t>(in + 232) << 29, SafeLoadAs<uint64_t>(in + 232) >> 34 | SafeLoadAs<uint64_t>(in + 240) << 30, SafeLoadAs<uint64_t>(in + 240) >> 33 | static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + 248)) << 31 };
+  shifts = simd_batch64{ 0, 0, 0, 0, 0, 0, 0, 0 };
+  results = (words >> shifts) & masks;
+  results.store_unaligned(out);
+  out += 8;
+
+  in += 252;
+  return in;
+}
+
+inline static const uint8_t* unpack64_64(const uint8_t* in, uint64_t* out) {
+  memcpy(out, in, 32 * sizeof(*out));
+  in += 32 * sizeof(*out);
+  out += 32;
+
+  return in;
+}
+
 };  // struct UnpackBits512
 
 }  // namespace
@@ -120,6 +120,101 @@ class UnpackGenerator:
         print("}")
 
 
+class Unpack64Generator:
+
+    def __init__(self, simd_width):
+        self.simd_width = simd_width
+        if simd_width % 64 != 0:
+            raise("SIMD bit width should be a multiple of 64")
+        self.simd_byte_width = simd_width // 8
+
+    def print_unpack_bit0_func(self):
+        print(
+            "inline static const uint8_t* unpack0_64(const uint8_t* in, uint64_t* out) {")
+        print("  memset(out, 0x0, 32 * sizeof(*out));")
+        print("  out += 32;")
+        print("")
+        print("  return in;")
+        print("}")
+
+    def print_unpack_bit64_func(self):
+        print(
+            "inline static const uint8_t* unpack64_64(const uint8_t* in, uint64_t* out) {")
+        print("  memcpy(out, in, 32 * sizeof(*out));")
+        print("  in += 32 * sizeof(*out);")
+        print("  out += 32;")
+        print("")
+        print("  return in;")
+        print("}")
+
+    def print_unpack_bit_func(self, bit):
+        def p(code):
+            print(indent(code, prefix='  '))
+
+        shift = 0
+        shifts = []
+        in_index = 0
+        inls = []
+        mask = (1 << bit) - 1
+        # 32 values of `bit` bits take 4 * `bit` bytes, so the last word
+        # may only be 32 bits wide
+        in_bytes = 4 * bit
+
+        print(f"inline static const uint8_t* unpack{bit}_64(const uint8_t* in, uint64_t* out) {{")
+        p(dedent(f"""\
+            uint64_t mask = 0x{mask:0x};
+
+            simd_batch64 masks(mask);
+            simd_batch64 words, shifts;
+            simd_batch64 results;
+            """))
+
+        def safe_load(index):
+            if (index + 1) * 8 <= in_bytes:
+                return f"SafeLoadAs<uint64_t>(in + {index * 8})"
+            return f"static_cast<uint64_t>(SafeLoadAs<uint32_t>(in + {index * 8}))"
+
+        for i in range(32):
+            if shift + bit == 64:
+                shifts.append(shift)
+                inls.append(safe_load(in_index))
+                in_index += 1
+                shift = 0
+            elif shift + bit > 64:  # cross the boundary
+                inls.append(
+                    f"{safe_load(in_index)} >> {shift} | {safe_load(in_index + 1)} << {64 - shift}")
+                in_index += 1
+                shift = bit - (64 - shift)
+                shifts.append(0)  # zero shift
+            else:
+                shifts.append(shift)
+                inls.append(safe_load(in_index))
+                shift += bit
+
+        words_per_batch = self.simd_byte_width // 8
+
+        one_word_template = dedent("""\
+            words = simd_batch64{{ {words} }};
+            shifts = simd_batch64{{ {shifts} }};
+            results = (words >> shifts) & masks;
+            results.store_unaligned(out);
+            out += {words_per_batch};
+            """)
+
+        for start in range(0, 32, words_per_batch):
+            stop = start + words_per_batch;
+            p(f"""// extract {bit}-bit bundles {start} to {stop - 1}""")
+            p(one_word_template.format(
+                words=", ".join(inls[start:stop]),
+                shifts=", ".join(map(str, shifts[start:stop])),
+                words_per_batch=words_per_batch))
+
+        p(dedent(f"""\
+            in += {in_bytes};
+            return in;"""))
+        print("}")
+
+
 def print_copyright():
     print(dedent("""\
         // Licensed to the Apache Software Foundation (ASF) under one
@@ -172,11 +267,13 @@ def main(simd_width):
         namespace {{
 
         using ::arrow::util::SafeLoad;
+        using ::arrow::util::SafeLoadAs;
 
         template <DispatchLevel level>
         struct {struct_name} {{
 
         using simd_batch = xsimd::make_sized_batch_t<uint32_t, {simd_width//32}>;
+        using simd_batch64 = xsimd::make_sized_batch_t<uint64_t, {simd_width//64}>;
         """))
 
     gen = UnpackGenerator(simd_width)
@@ -188,6 +285,15 @@ def main(simd_width):
     gen.print_unpack_bit32_func()
     print()
 
+    gen64 = Unpack64Generator(simd_width)
+    gen64.print_unpack_bit0_func()
+    print()
+    for i in range(1, 64):
+        gen64.print_unpack_bit_func(i)
+        print()
+    gen64.print_unpack_bit64_func()
+    print()
+
     print(dedent(f"""\
         }};  // struct {struct_name}
 
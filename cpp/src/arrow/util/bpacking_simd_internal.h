@@ -134,5 +134,214 @@ static int unpack32_specialized(const uint32_t* in, uint32_t* out, int batch_siz
   return batch_size;
 }
 
+template <typename UnpackBits>
+static int unpack64_specialized(const uint8_t* in, uint64_t* out, int batch_size,
+                                int num_bits) {
+  batch_size = batch_size / 32 * 32;
+  int num_loops = batch_size / 32;
+
+  switch (num_bits) {
+    case 0:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack0_64(in, out + i * 32);
+      break;
+    case 1:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack1_64(in, out + i * 32);
+      break;
+    case 2:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack2_64(in, out + i * 32);
+      break;
+    case 3:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack3_64(in, out + i * 32);
+      break;
+    case 4:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack4_64(in, out + i * 32);
+      break;
+    case 5:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack5_64(in, out + i * 32);
+      break;
+    case 6:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack6_64(in, out + i * 32);
+      break;
+    case 7:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack7_64(in, out + i * 32);
+      break;
+    case 8:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack8_64(in, out + i * 32);
+      break;
+    case 9:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack9_64(in, out + i * 32);
+      break;
+    case 10:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack10_64(in, out + i * 32);
+      break;
+    case 11:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack11_64(in, out + i * 32);
+      break;
+    case 12:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack12_64(in, out + i * 32);
+      break;
+    case 13:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack13_64(in, out + i * 32);
+      break;
+    case 14:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack14_64(in, out + i * 32);
+      break;
+    case 15:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack15_64(in, out + i * 32);
+      break;
+    case 16:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack16_64(in, out + i * 32);
+      break;
+    case 17:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack17_64(in, out + i * 32);
+      break;
+    case 18:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack18_64(in, out + i * 32);
+      break;
+    case 19:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack19_64(in, out + i * 32);
+      break;
+    case 20:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack20_64(in, out + i * 32);
+      break;
+    case 21:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack21_64(in, out + i * 32);
+      break;
+    case 22:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack22_64(in, out + i * 32);
+      break;
+    case 23:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack23_64(in, out + i * 32);
+      break;
+    case 24:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack24_64(in, out + i * 32);
+      break;
+    case 25:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack25_64(in, out + i * 32);
+      break;
+    case 26:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack26_64(in, out + i * 32);
+      break;
+    case 27:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack27_64(in, out + i * 32);
+      break;
+    case 28:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack28_64(in, out + i * 32);
+      break;
+    case 29:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack29_64(in, out + i * 32);
+      break;
+    case 30:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack30_64(in, out + i * 32);
+      break;
+    case 31:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack31_64(in, out + i * 32);
+      break;
+    case 32:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack32_64(in, out + i * 32);
+      break;
+    case 33:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack33_64(in, out + i * 32);
+      break;
+    case 34:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack34_64(in, out + i * 32);
+      break;
+    case 35:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack35_64(in, out + i * 32);
+      break;
+    case 36:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack36_64(in, out + i * 32);
+      break;
+    case 37:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack37_64(in, out + i * 32);
+      break;
+    case 38:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack38_64(in, out + i * 32);
+      break;
+    case 39:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack39_64(in, out + i * 32);
+      break;
+    case 40:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack40_64(in, out + i * 32);
+      break;
+    case 41:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack41_64(in, out + i * 32);
+      break;
+    case 42:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack42_64(in, out + i * 32);
+      break;
+    case 43:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack43_64(in, out + i * 32);
+      break;
+    case 44:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack44_64(in, out + i * 32);
+      break;
+    case 45:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack45_64(in, out + i * 32);
+      break;
+    case 46:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack46_64(in, out + i * 32);
+      break;
+    case 47:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack47_64(in, out + i * 32);
+      break;
+    case 48:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack48_64(in, out + i * 32);
+      break;
+    case 49:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack49_64(in, out + i * 32);
+      break;
+    case 50:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack50_64(in, out + i * 32);
+      break;
+    case 51:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack51_64(in, out + i * 32);
+      break;
+    case 52:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack52_64(in, out + i * 32);
+      break;
+    case 53:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack53_64(in, out + i * 32);
+      break;
+    case 54:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack54_64(in, out + i * 32);
+      break;
+    case 55:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack55_64(in, out + i * 32);
+      break;
+    case 56:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack56_64(in, out + i * 32);
+      break;
+    case 57:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack57_64(in, out + i * 32);
+      break;
+    case 58:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack58_64(in, out + i * 32);
+      break;
+    case 59:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack59_64(in, out + i * 32);
+      break;
+    case 60:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack60_64(in, out + i * 32);
+      break;
+    case 61:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack61_64(in, out + i * 32);
+      break;
+    case 62:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack62_64(in, out + i * 32);
+      break;
+    case 63:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack63_64(in, out + i * 32);
+      break;
+    case 64:
+      for (int i = 0; i < num_loops; ++i) in = UnpackBits::unpack64_64(in, out + i * 32);
+      break;
+    default:
+      DCHECK(false) << "Unsupported num_bits";
+  }
+
+  return batch_size;
+}
+
 }  // namespace internal
 }  // namespace arrow
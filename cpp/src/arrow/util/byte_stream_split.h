@@ -621,6 +621,56 @@ void inline ByteStreamSplitDecode(const uint8_t* data, int64_t num_values, int64
 #endif
 }
 
+// Encode |num_values| values of |width| bytes each, as stored for
+// FIXED_LEN_BYTE_ARRAY.  Widths of 4 and 8 bytes use the SIMD kernels above.
+inline void ByteStreamSplitEncode(const uint8_t* raw_values, int width,
+                                  const int64_t num_values, uint8_t* output_buffer_raw) {
+  switch (width) {
+    case 2:
+      return ByteStreamSplitEncodeScalar<uint16_t>(raw_values, num_values,
+                                                   output_buffer_raw);
+    case 4:
+      return ByteStreamSplitEncode<uint32_t>(raw_values, num_values, output_buffer_raw);
+    case 8:
+      return ByteStreamSplitEncode<uint64_t>(raw_values, num_values, output_buffer_raw);
+    default:
+      break;
+  }
+  // Write each stream sequentially
+  for (int j = 0; j < width; ++j) {
+    uint8_t* stream = output_buffer_raw + j * num_values;
+    for (int64_t i = 0; i < num_values; ++i) {
+      stream[i] = raw_values[i * width + j];
+    }
+  }
+}
+
+// Decode |num_values| values of |width| bytes each into |out|, which must be
+// suitably aligned for widths of 2, 4 and 8 bytes.
+inline void ByteStreamSplitDecode(const uint8_t* data, int width, int64_t num_values,
+                                  int64_t stride, uint8_t* out) {
+  switch (width) {
+    case 2:
+      return ByteStreamSplitDecodeScalar(data, num_values, stride,
+                                         reinterpret_cast<uint16_t*>(out));
+    case 4:
+      return ByteStreamSplitDecode(data, num_values, stride,
+                                   reinterpret_cast<uint32_t*>(out));
+    case 8:
+      return ByteStreamSplitDecode(data, num_values, stride,
+                                   reinterpret_cast<uint64_t*>(out));
+    default:
+      break;
+  }
+  // Read each stream sequentially
+  for (int j = 0; j < width; ++j) {
+    const uint8_t* stream = data + j * stride;
+    for (int64_t i = 0; i < num_values; ++i) {
+      out[i * width + j] = stream[i];
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace util
 }  // namespace arrow
@@ -18,6 +18,9 @@
 #include "arrow/util/cancel.h"
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
 #include <mutex>
 #include <sstream>
 #include <utility>
@@ -41,11 +44,37 @@ using internal::SignalHandler;
 // NOTE: We care mainly about the making the common case (not cancelled) fast.
 
 struct StopSourceImpl {
+  static constexpr int64_t kNoDeadline = std::numeric_limits<int64_t>::max();
+
+  static int64_t Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  // Turn a passed deadline into a stop request, return whether a stop was requested
+  bool CheckDeadline() {
+    const int64_t deadline = deadline_.load();
+    if (deadline == kNoDeadline || Now() < deadline) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!requested_) {
+      cancel_error_ = Status::Cancelled("Deadline exceeded");
+      requested_ = -1;
+    }
+    return true;
+  }
+
   std::atomic<int> requested_{0};  // will be -1 or signal number if requested
+  // In nanoseconds of the steady clock
+  std::atomic<int64_t> deadline_{kNoDeadline};
   std::mutex mutex_;
   Status cancel_error_;
 };
 
+constexpr int64_t StopSourceImpl::kNoDeadline;
+
 StopSource::StopSource() : impl_(new StopSourceImpl) {}
 
 StopSource::~StopSource() = default;
@@ -66,9 +95,16 @@ void StopSource::RequestStopFromSignal(int signum) {
   impl_->requested_.store(signum);
 }
 
+void StopSource::RequestStopAt(std::chrono::steady_clock::time_point deadline) {
+  impl_->deadline_.store(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch())
+          .count());
+}
+
 void StopSource::Reset() {
   std::lock_guard<std::mutex> lock(impl_->mutex_);
   impl_->cancel_error_ = Status::OK();
+  impl_->deadline_.store(StopSourceImpl::kNoDeadline);
   impl_->requested_.store(0);
 }
 
@@ -78,14 +114,14 @@ bool StopToken::IsStopRequested() const {
   if (!impl_) {
     return false;
   }
-  return impl_->requested_.load() != 0;
+  return impl_->requested_.load() != 0 || impl_->CheckDeadline();
 }
 
 Status StopToken::Poll() const {
   if (!impl_) {
     return Status::OK();
   }
-  if (!impl_->requested_.load()) {
+  if (!impl_->requested_.load() && !impl_->CheckDeadline()) {
     return Status::OK();
   }
 
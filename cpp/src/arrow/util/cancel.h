@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <string>
@@ -44,6 +45,13 @@ class ARROW_EXPORT StopSource {
   void RequestStop(Status error);
   void RequestStopFromSignal(int signum);
 
+  /// \brief Request a stop once the given deadline has passed
+  ///
+  /// The deadline is observed by the tokens when they are checked, which then
+  /// report a Cancelled status.  It can be moved, but a stop that was already
+  /// requested is not undone.
+  void RequestStopAt(std::chrono::steady_clock::time_point deadline);
+
   StopToken token();
 
   // For internal use only
@@ -64,6 +72,9 @@ class ARROW_EXPORT StopToken {
   // A trivial token that never propagates any stop request
   static StopToken Unstoppable() { return StopToken(); }
 
+  // Whether a stop may ever be requested through this token
+  bool IsStoppable() const { return impl_ != NULLPTR; }
+
   // Producer API (the side that gets asked to stopped)
   Status Poll() const;
   bool IsStopRequested() const;
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <atomic>
+#include <chrono>
 #include <cmath>
 #include <sstream>
 #include <string>
@@ -23,6 +24,7 @@
 #include <utility>
 #include <vector>
 
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <signal.h>
@@ -94,8 +96,49 @@ TEST_F(CancelTest, RequestStopTwice) {
 
 TEST_F(CancelTest, Unstoppable) {
   StopToken token = StopToken::Unstoppable();
+  ASSERT_FALSE(token.IsStoppable());
   ASSERT_FALSE(token.IsStopRequested());
   ASSERT_OK(token.Poll());
+  ASSERT_TRUE(StopSource().token().IsStoppable());
+}
+
+TEST_F(CancelTest, Deadline) {
+  using Clock = std::chrono::steady_clock;
+  {
+    StopSource source;
+    StopToken token = source.token();
+    source.RequestStopAt(Clock::now() + std::chrono::hours(1));
+    ASSERT_FALSE(token.IsStopRequested());
+    ASSERT_OK(token.Poll());
+
+    // The deadline can be moved
+    source.RequestStopAt(Clock::now() - std::chrono::seconds(1));
+    ASSERT_TRUE(token.IsStopRequested());
+    EXPECT_RAISES_WITH_MESSAGE_THAT(Cancelled, ::testing::HasSubstr("Deadline exceeded"),
+                                    token.Poll());
+    // Once passed, it is not undone
+    source.RequestStopAt(Clock::now() + std::chrono::hours(1));
+    ASSERT_TRUE(token.IsStopRequested());
+
+    source.Reset();
+    ASSERT_FALSE(token.IsStopRequested());
+    ASSERT_OK(token.Poll());
+  }
+  {
+    // An earlier stop request takes precedence
+    StopSource source;
+    StopToken token = source.token();
+    source.RequestStop(Status::IOError("Operation cancelled"));
+    source.RequestStopAt(Clock::now() - std::chrono::seconds(1));
+    ASSERT_RAISES(IOError, token.Poll());
+  }
+  {
+    StopSource source;
+    StopToken token = source.token();
+    source.RequestStopAt(Clock::now() + std::chrono::milliseconds(20));
+    BusyWait(10, [&] { return token.IsStopRequested(); });
+    ASSERT_RAISES(Cancelled, token.Poll());
+  }
 }
 
 TEST_F(CancelTest, SourceVanishes) {
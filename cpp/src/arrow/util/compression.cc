@@ -39,12 +39,35 @@ Status CheckSupportsCompressionLevel(Compression::type type) {
   return Status::OK();
 }
 
+// A context for codecs without one-shot state of their own
+class StatelessCodecContext : public CodecContext {
+ public:
+  explicit StatelessCodecContext(Codec* codec) : codec_(codec) {}
+
+  Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
+                             int64_t output_buffer_len, uint8_t* output_buffer) override {
+    return codec_->Decompress(input_len, input, output_buffer_len, output_buffer);
+  }
+
+  Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
+                           int64_t output_buffer_len, uint8_t* output_buffer) override {
+    return codec_->Compress(input_len, input, output_buffer_len, output_buffer);
+  }
+
+ private:
+  Codec* codec_;
+};
+
 }  // namespace
 
 int Codec::UseDefaultCompressionLevel() { return kUseDefaultCompressionLevel; }
 
 Status Codec::Init() { return Status::OK(); }
 
+Result<std::unique_ptr<CodecContext>> Codec::MakeContext() {
+  return std::unique_ptr<CodecContext>(new StatelessCodecContext(this));
+}
+
 const std::string& Codec::GetCodecAsString(Compression::type t) {
   static const std::string uncompressed = "uncompressed", snappy = "snappy",
                            gzip = "gzip", lzo = "lzo", brotli = "brotli",
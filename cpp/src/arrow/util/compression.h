@@ -107,6 +107,29 @@ class ARROW_EXPORT Decompressor {
   // XXX add methods for buffer size heuristics?
 };
 
+/// \brief One-shot compression and decompression context
+///
+/// A context keeps the scratch state of a codec between one-shot calls, so that
+/// it isn't set up again for each input.  A context must not be used from several
+/// threads at once, nor outlive the codec that created it.
+///
+/// Codec::Compress() and Codec::Decompress() already reuse state cached per
+/// thread where the codec supports it; an explicit context ties that state to
+/// the caller instead.
+class ARROW_EXPORT CodecContext {
+ public:
+  virtual ~CodecContext() = default;
+
+  /// \brief One-shot decompression function, see Codec::Decompress()
+  virtual Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
+                                     int64_t output_buffer_len,
+                                     uint8_t* output_buffer) = 0;
+
+  /// \brief One-shot compression function, see Codec::Compress()
+  virtual Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
+                                   int64_t output_buffer_len, uint8_t* output_buffer) = 0;
+};
+
 /// \brief Compression codec
 class ARROW_EXPORT Codec {
  public:
@@ -184,6 +207,9 @@ class ARROW_EXPORT Codec {
   /// \brief Create a streaming compressor instance
   virtual Result<std::shared_ptr<Decompressor>> MakeDecompressor() = 0;
 
+  /// \brief Create a one-shot compression and decompression context
+  virtual Result<std::unique_ptr<CodecContext>> MakeContext();
+
   /// \brief This Codec's compression type
   virtual Compression::type compression_type() const = 0;
 
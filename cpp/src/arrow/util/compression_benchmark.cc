@@ -33,8 +33,6 @@
 namespace arrow {
 namespace util {
 
-#ifdef ARROW_WITH_BENCHMARKS_REFERENCE
-
 std::vector<uint8_t> MakeCompressibleData(int data_size) {
   // XXX This isn't a real-world corpus so doesn't really represent the
   // comparative qualities of the algorithms
@@ -64,6 +62,8 @@ std::vector<uint8_t> MakeCompressibleData(int data_size) {
   return data;
 }
 
+#ifdef ARROW_WITH_BENCHMARKS_REFERENCE
+
 int64_t StreamingCompress(Codec* codec, const std::vector<uint8_t>& data,
                           std::vector<uint8_t>* compressed_data = nullptr) {
   if (compressed_data != nullptr) {
@@ -197,5 +197,101 @@ BENCHMARK_TEMPLATE(ReferenceStreamingDecompression, Compression::LZ4_FRAME);
 
 #endif
 
+// One-shot calls on page-sized inputs, either through the codec (which reuses
+// per-thread state) or through a new context each time
+static void OneShotCompression(Compression::type compression, bool new_context,
+                               benchmark::State& state) {  // NOLINT non-const reference
+  auto data = MakeCompressibleData(static_cast<int>(state.range(0)));
+  auto codec = *Codec::Create(compression);
+  std::vector<uint8_t> compressed(codec->MaxCompressedLen(data.size(), data.data()));
+
+  for (auto _ : state) {
+    int64_t compressed_size;
+    if (new_context) {
+      auto context = *codec->MakeContext();
+      compressed_size = *context->Compress(data.size(), data.data(), compressed.size(),
+                                           compressed.data());
+    } else {
+      compressed_size = *codec->Compress(data.size(), data.data(), compressed.size(),
+                                         compressed.data());
+    }
+    benchmark::DoNotOptimize(compressed_size);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+static void OneShotDecompression(Compression::type compression, bool new_context,
+                                 benchmark::State& state) {  // NOLINT non-const reference
+  auto data = MakeCompressibleData(static_cast<int>(state.range(0)));
+  auto codec = *Codec::Create(compression);
+  std::vector<uint8_t> compressed(codec->MaxCompressedLen(data.size(), data.data()));
+  compressed.resize(
+      *codec->Compress(data.size(), data.data(), compressed.size(), compressed.data()));
+  std::vector<uint8_t> decompressed(data.size());
+
+  for (auto _ : state) {
+    int64_t decompressed_size;
+    if (new_context) {
+      auto context = *codec->MakeContext();
+      decompressed_size = *context->Decompress(compressed.size(), compressed.data(),
+                                               decompressed.size(), decompressed.data());
+    } else {
+      decompressed_size = *codec->Decompress(compressed.size(), compressed.data(),
+                                             decompressed.size(), decompressed.data());
+    }
+    ARROW_CHECK(decompressed_size == static_cast<int64_t>(data.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+template <Compression::type COMPRESSION>
+static void OneShotCompressionReused(
+    benchmark::State& state) {  // NOLINT non-const reference
+  OneShotCompression(COMPRESSION, /*new_context=*/false, state);
+}
+
+template <Compression::type COMPRESSION>
+static void OneShotCompressionNewContext(
+    benchmark::State& state) {  // NOLINT non-const reference
+  OneShotCompression(COMPRESSION, /*new_context=*/true, state);
+}
+
+template <Compression::type COMPRESSION>
+static void OneShotDecompressionReused(
+    benchmark::State& state) {  // NOLINT non-const reference
+  OneShotDecompression(COMPRESSION, /*new_context=*/false, state);
+}
+
+template <Compression::type COMPRESSION>
+static void OneShotDecompressionNewContext(
+    benchmark::State& state) {  // NOLINT non-const reference
+  OneShotDecompression(COMPRESSION, /*new_context=*/true, state);
+}
+
+static void OneShotArgs(benchmark::internal::Benchmark* bench) {
+  bench->RangeMultiplier(2)->Range(8 * 1024, 64 * 1024);
+}
+
+#ifdef ARROW_WITH_ZSTD
+BENCHMARK_TEMPLATE(OneShotCompressionReused, Compression::ZSTD)->Apply(OneShotArgs);
+BENCHMARK_TEMPLATE(OneShotCompressionNewContext, Compression::ZSTD)->Apply(OneShotArgs);
+BENCHMARK_TEMPLATE(OneShotDecompressionReused, Compression::ZSTD)->Apply(OneShotArgs);
+BENCHMARK_TEMPLATE(OneShotDecompressionNewContext, Compression::ZSTD)
+    ->Apply(OneShotArgs);
+#endif
+
+#ifdef ARROW_WITH_LZ4
+BENCHMARK_TEMPLATE(OneShotCompressionReused, Compression::LZ4)->Apply(OneShotArgs);
+BENCHMARK_TEMPLATE(OneShotCompressionNewContext, Compression::LZ4)->Apply(OneShotArgs);
+BENCHMARK_TEMPLATE(OneShotCompressionReused, Compression::LZ4_FRAME)
+    ->Apply(OneShotArgs);
+BENCHMARK_TEMPLATE(OneShotCompressionNewContext, Compression::LZ4_FRAME)
+    ->Apply(OneShotArgs);
+BENCHMARK_TEMPLATE(OneShotDecompressionReused, Compression::LZ4_FRAME)
+    ->Apply(OneShotArgs);
+BENCHMARK_TEMPLATE(OneShotDecompressionNewContext, Compression::LZ4_FRAME)
+    ->Apply(OneShotArgs);
+#endif
+
 }  // namespace util
 }  // namespace arrow
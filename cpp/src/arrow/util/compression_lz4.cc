@@ -248,42 +248,34 @@ class LZ4Compressor : public Compressor {
 };
 
 // ----------------------------------------------------------------------
-// Lz4 frame codec implementation
+// Lz4 frame one-shot state
 
-class Lz4FrameCodec : public Codec {
+// A compression context and a decompressor, created on first use and reused by
+// subsequent one-shot calls
+class Lz4FrameOneShotState {
  public:
-  explicit Lz4FrameCodec(int compression_level)
-      : compression_level_(compression_level == kUseDefaultCompressionLevel
-                               ? kLz4DefaultCompressionLevel
-                               : compression_level),
-        prefs_(PreferencesWithCompressionLevel(compression_level_)) {}
-
-  int64_t MaxCompressedLen(int64_t input_len,
-                           const uint8_t* ARROW_ARG_UNUSED(input)) override {
-    return static_cast<int64_t>(
-        LZ4F_compressFrameBound(static_cast<size_t>(input_len), &prefs_));
-  }
+  Lz4FrameOneShotState() = default;
 
-  Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
-                           int64_t output_buffer_len, uint8_t* output_buffer) override {
-    auto output_len =
-        LZ4F_compressFrame(output_buffer, static_cast<size_t>(output_buffer_len), input,
-                           static_cast<size_t>(input_len), &prefs_);
-    if (LZ4F_isError(output_len)) {
-      return LZ4Error(output_len, "Lz4 compression failure: ");
+  ~Lz4FrameOneShotState() {
+    if (cctx_ != nullptr) {
+      ARROW_UNUSED(LZ4F_freeCompressionContext(cctx_));
     }
-    return static_cast<int64_t>(output_len);
   }
 
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
-                             int64_t output_buffer_len, uint8_t* output_buffer) override {
-    ARROW_ASSIGN_OR_RAISE(auto decomp, MakeDecompressor());
+                             int64_t output_buffer_len, uint8_t* output_buffer) {
+    if (decompressor_ == nullptr) {
+      decompressor_.reset(new LZ4Decompressor);
+      RETURN_NOT_OK(decompressor_->Init());
+    } else {
+      RETURN_NOT_OK(decompressor_->Reset());
+    }
 
     int64_t total_bytes_written = 0;
-    while (!decomp->IsFinished() && input_len != 0) {
-      ARROW_ASSIGN_OR_RAISE(
-          auto res,
-          decomp->Decompress(input_len, input, output_buffer_len, output_buffer));
+    while (!decompressor_->IsFinished() && input_len != 0) {
+      ARROW_ASSIGN_OR_RAISE(auto res, decompressor_->Decompress(
+                                          input_len, input, output_buffer_len,
+                                          output_buffer));
       input += res.bytes_read;
       input_len -= res.bytes_read;
       output_buffer += res.bytes_written;
@@ -293,7 +285,7 @@ class Lz4FrameCodec : public Codec {
         return Status::IOError("Lz4 decompression buffer too small");
       }
     }
-    if (!decomp->IsFinished()) {
+    if (!decompressor_->IsFinished()) {
       return Status::IOError("Lz4 compressed input contains less than one frame");
     }
     if (input_len != 0) {
@@ -302,6 +294,100 @@ class Lz4FrameCodec : public Codec {
     return total_bytes_written;
   }
 
+  Result<int64_t> Compress(const LZ4F_preferences_t& prefs, int64_t input_len,
+                           const uint8_t* input, int64_t output_buffer_len,
+                           uint8_t* output_buffer) {
+    if (cctx_ == nullptr) {
+      auto ret = LZ4F_createCompressionContext(&cctx_, LZ4F_VERSION);
+      if (LZ4F_isError(ret)) {
+        cctx_ = nullptr;
+        return LZ4Error(ret, "LZ4 init failed: ");
+      }
+    }
+    // Same steps as LZ4F_compressFrame(), but on a reused context
+    LZ4F_preferences_t frame_prefs = prefs;
+    frame_prefs.autoFlush = 1;
+    auto dst = output_buffer;
+    auto dst_capacity = static_cast<size_t>(output_buffer_len);
+    auto ret = LZ4F_compressBegin(cctx_, dst, dst_capacity, &frame_prefs);
+    if (LZ4F_isError(ret)) {
+      return LZ4Error(ret, "Lz4 compression failure: ");
+    }
+    dst += ret;
+    dst_capacity -= ret;
+    ret = LZ4F_compressUpdate(cctx_, dst, dst_capacity, input,
+                              static_cast<size_t>(input_len), nullptr /* options */);
+    if (LZ4F_isError(ret)) {
+      return LZ4Error(ret, "Lz4 compression failure: ");
+    }
+    dst += ret;
+    dst_capacity -= ret;
+    ret = LZ4F_compressEnd(cctx_, dst, dst_capacity, nullptr /* options */);
+    if (LZ4F_isError(ret)) {
+      return LZ4Error(ret, "Lz4 compression failure: ");
+    }
+    dst += ret;
+    return static_cast<int64_t>(dst - output_buffer);
+  }
+
+  static Lz4FrameOneShotState* ThreadLocal() {
+    static thread_local Lz4FrameOneShotState state;
+    return &state;
+  }
+
+ private:
+  LZ4F_compressionContext_t cctx_ = nullptr;
+  std::unique_ptr<LZ4Decompressor> decompressor_;
+};
+
+class Lz4FrameCodecContext : public CodecContext {
+ public:
+  explicit Lz4FrameCodecContext(const LZ4F_preferences_t& prefs) : prefs_(prefs) {}
+
+  Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
+                             int64_t output_buffer_len, uint8_t* output_buffer) override {
+    return state_.Decompress(input_len, input, output_buffer_len, output_buffer);
+  }
+
+  Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
+                           int64_t output_buffer_len, uint8_t* output_buffer) override {
+    return state_.Compress(prefs_, input_len, input, output_buffer_len, output_buffer);
+  }
+
+ private:
+  const LZ4F_preferences_t prefs_;
+  Lz4FrameOneShotState state_;
+};
+
+// ----------------------------------------------------------------------
+// Lz4 frame codec implementation
+
+class Lz4FrameCodec : public Codec {
+ public:
+  explicit Lz4FrameCodec(int compression_level)
+      : compression_level_(compression_level == kUseDefaultCompressionLevel
+                               ? kLz4DefaultCompressionLevel
+                               : compression_level),
+        prefs_(PreferencesWithCompressionLevel(compression_level_)) {}
+
+  int64_t MaxCompressedLen(int64_t input_len,
+                           const uint8_t* ARROW_ARG_UNUSED(input)) override {
+    return static_cast<int64_t>(
+        LZ4F_compressFrameBound(static_cast<size_t>(input_len), &prefs_));
+  }
+
+  Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
+                           int64_t output_buffer_len, uint8_t* output_buffer) override {
+    return Lz4FrameOneShotState::ThreadLocal()->Compress(
+        prefs_, input_len, input, output_buffer_len, output_buffer);
+  }
+
+  Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
+                             int64_t output_buffer_len, uint8_t* output_buffer) override {
+    return Lz4FrameOneShotState::ThreadLocal()->Decompress(
+        input_len, input, output_buffer_len, output_buffer);
+  }
+
   Result<std::shared_ptr<Compressor>> MakeCompressor() override {
     auto ptr = std::make_shared<LZ4Compressor>(compression_level_);
     RETURN_NOT_OK(ptr->Init());
@@ -314,6 +400,10 @@ class Lz4FrameCodec : public Codec {
     return ptr;
   }
 
+  Result<std::unique_ptr<CodecContext>> MakeContext() override {
+    return std::unique_ptr<CodecContext>(new Lz4FrameCodecContext(prefs_));
+  }
+
   Compression::type compression_type() const override { return Compression::LZ4_FRAME; }
   int minimum_compression_level() const override { return kLz4MinCompressionLevel; }
 #if (defined(LZ4_VERSION_NUMBER) && LZ4_VERSION_NUMBER < 10800)
@@ -330,6 +420,88 @@ class Lz4FrameCodec : public Codec {
   const LZ4F_preferences_t prefs_;
 };
 
+// ----------------------------------------------------------------------
+// Lz4 "raw" one-shot state
+
+#ifdef LZ4HC_CLEVEL_MIN
+constexpr int kLz4MinHCCompressionLevel = LZ4HC_CLEVEL_MIN;
+#else  // For older versions of the lz4 library
+constexpr int kLz4MinHCCompressionLevel = 3;
+#endif
+
+// Compression state buffers, allocated on first use and reused by subsequent
+// one-shot calls.  Decompression doesn't need any state.
+class Lz4OneShotState {
+ public:
+  Result<int64_t> Compress(int compression_level, int64_t input_len,
+                           const uint8_t* input, int64_t output_buffer_len,
+                           uint8_t* output_buffer) {
+    int64_t output_len;
+    if (compression_level < kLz4MinHCCompressionLevel) {
+      if (state_ == nullptr) {
+        state_.reset(new char[LZ4_sizeofState()]);
+      }
+      output_len = LZ4_compress_fast_extState(
+          state_.get(), reinterpret_cast<const char*>(input),
+          reinterpret_cast<char*>(output_buffer), static_cast<int>(input_len),
+          static_cast<int>(output_buffer_len), /*acceleration=*/1);
+    } else {
+      if (state_hc_ == nullptr) {
+        state_hc_.reset(new char[LZ4_sizeofStateHC()]);
+      }
+      output_len = LZ4_compress_HC_extStateHC(
+          state_hc_.get(), reinterpret_cast<const char*>(input),
+          reinterpret_cast<char*>(output_buffer), static_cast<int>(input_len),
+          static_cast<int>(output_buffer_len), compression_level);
+    }
+    if (output_len == 0) {
+      return Status::IOError("Lz4 compression failure.");
+    }
+    return output_len;
+  }
+
+  static Lz4OneShotState* ThreadLocal() {
+    static thread_local Lz4OneShotState state;
+    return &state;
+  }
+
+ private:
+  std::unique_ptr<char[]> state_;
+  std::unique_ptr<char[]> state_hc_;
+};
+
+Result<int64_t> Lz4RawDecompress(int64_t input_len, const uint8_t* input,
+                                 int64_t output_buffer_len, uint8_t* output_buffer) {
+  int64_t decompressed_size = LZ4_decompress_safe(
+      reinterpret_cast<const char*>(input), reinterpret_cast<char*>(output_buffer),
+      static_cast<int>(input_len), static_cast<int>(output_buffer_len));
+  if (decompressed_size < 0) {
+    return Status::IOError("Corrupt Lz4 compressed data.");
+  }
+  return decompressed_size;
+}
+
+class Lz4CodecContext : public CodecContext {
+ public:
+  explicit Lz4CodecContext(int compression_level)
+      : compression_level_(compression_level) {}
+
+  Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
+                             int64_t output_buffer_len, uint8_t* output_buffer) override {
+    return Lz4RawDecompress(input_len, input, output_buffer_len, output_buffer);
+  }
+
+  Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
+                           int64_t output_buffer_len, uint8_t* output_buffer) override {
+    return state_.Compress(compression_level_, input_len, input, output_buffer_len,
+                           output_buffer);
+  }
+
+ private:
+  const int compression_level_;
+  Lz4OneShotState state_;
+};
+
 // ----------------------------------------------------------------------
 // Lz4 "raw" codec implementation
 
@@ -342,13 +514,7 @@ class Lz4Codec : public Codec {
 
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer) override {
-    int64_t decompressed_size = LZ4_decompress_safe(
-        reinterpret_cast<const char*>(input), reinterpret_cast<char*>(output_buffer),
-        static_cast<int>(input_len), static_cast<int>(output_buffer_len));
-    if (decompressed_size < 0) {
-      return Status::IOError("Corrupt Lz4 compressed data.");
-    }
-    return decompressed_size;
+    return Lz4RawDecompress(input_len, input, output_buffer_len, output_buffer);
   }
 
   int64_t MaxCompressedLen(int64_t input_len,
@@ -358,26 +524,8 @@ class Lz4Codec : public Codec {
 
   Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer) override {
-    int64_t output_len;
-#ifdef LZ4HC_CLEVEL_MIN
-    constexpr int min_hc_clevel = LZ4HC_CLEVEL_MIN;
-#else  // For older versions of the lz4 library
-    constexpr int min_hc_clevel = 3;
-#endif
-    if (compression_level_ < min_hc_clevel) {
-      output_len = LZ4_compress_default(
-          reinterpret_cast<const char*>(input), reinterpret_cast<char*>(output_buffer),
-          static_cast<int>(input_len), static_cast<int>(output_buffer_len));
-    } else {
-      output_len = LZ4_compress_HC(
-          reinterpret_cast<const char*>(input), reinterpret_cast<char*>(output_buffer),
-          static_cast<int>(input_len), static_cast<int>(output_buffer_len),
-          compression_level_);
-    }
-    if (output_len == 0) {
-      return Status::IOError("Lz4 compression failure.");
-    }
-    return output_len;
+    return Lz4OneShotState::ThreadLocal()->Compress(compression_level_, input_len, input,
+                                                    output_buffer_len, output_buffer);
   }
 
   Result<std::shared_ptr<Compressor>> MakeCompressor() override {
@@ -392,6 +540,10 @@ class Lz4Codec : public Codec {
         "Try using LZ4 frame format instead.");
   }
 
+  Result<std::unique_ptr<CodecContext>> MakeContext() override {
+    return std::unique_ptr<CodecContext>(new Lz4CodecContext(compression_level_));
+  }
+
   Compression::type compression_type() const override { return Compression::LZ4; }
   int minimum_compression_level() const override { return kLz4MinCompressionLevel; }
 #if (defined(LZ4_VERSION_NUMBER) && LZ4_VERSION_NUMBER < 10800)
@@ -463,6 +615,12 @@ class Lz4HadoopCodec : public Lz4Codec {
         "Try using LZ4 frame format instead.");
   }
 
+  Result<std::unique_ptr<CodecContext>> MakeContext() override {
+    // The Hadoop framing goes through Compress() and Decompress(), which
+    // already reuse the per-thread LZ4 state
+    return Codec::MakeContext();
+  }
+
   Compression::type compression_type() const override { return Compression::LZ4_HADOOP; }
 
  protected:
@@ -368,6 +368,52 @@ TEST_P(CodecTest, CodecRoundtrip) {
   }
 }
 
+TEST_P(CodecTest, ContextRoundtrip) {
+  const auto compression = GetCompression();
+  if (compression == Compression::BZ2) {
+    GTEST_SKIP() << "BZ2 does not support one-shot compression";
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto codec, Codec::Create(compression));
+  ASSERT_OK_AND_ASSIGN(auto context, codec->MakeContext());
+
+  // Reuse the context for several inputs, including after a failure
+  for (int data_size : {0, 10000, 100000, 10000}) {
+    for (const auto& data :
+         {MakeRandomData(data_size), MakeCompressibleData(data_size)}) {
+      const auto max_compressed_len = codec->MaxCompressedLen(data.size(), data.data());
+      std::vector<uint8_t> compressed(max_compressed_len);
+      std::vector<uint8_t> decompressed(data.size());
+
+      // Compress with the context, decompress with the codec
+      ASSERT_OK_AND_ASSIGN(auto compressed_size,
+                           context->Compress(data.size(), data.data(), max_compressed_len,
+                                             compressed.data()));
+      ASSERT_OK_AND_EQ(static_cast<int64_t>(data.size()),
+                       codec->Decompress(compressed_size, compressed.data(),
+                                         decompressed.size(), decompressed.data()));
+      ASSERT_EQ(data, decompressed);
+
+      // Compress with the codec, decompress with the context
+      ASSERT_OK_AND_ASSIGN(compressed_size,
+                           codec->Compress(data.size(), data.data(), max_compressed_len,
+                                           compressed.data()));
+      std::fill(decompressed.begin(), decompressed.end(), 0);
+      ASSERT_OK_AND_EQ(static_cast<int64_t>(data.size()),
+                       context->Decompress(compressed_size, compressed.data(),
+                                           decompressed.size(), decompressed.data()));
+      ASSERT_EQ(data, decompressed);
+
+      if (data_size > 0 && (compression == Compression::ZSTD ||
+                            compression == Compression::LZ4_FRAME)) {
+        // Truncated input, the next iteration checks the context is still usable
+        ASSERT_NOT_OK(context->Decompress(compressed_size / 2, compressed.data(),
+                                          decompressed.size(), decompressed.data()));
+      }
+    }
+  }
+}
+
 TEST(TestCodecMisc, SpecifyCompressionLevel) {
   struct CombinationOption {
     Compression::type codec;
@@ -169,17 +169,27 @@ class ZSTDCompressor : public Compressor {
 };
 
 // ----------------------------------------------------------------------
-// ZSTD codec implementation
+// ZSTD one-shot state
 
-class ZSTDCodec : public Codec {
+// Compression and decompression contexts, created on first use and reused by
+// subsequent one-shot calls
+class ZSTDOneShotState {
  public:
-  explicit ZSTDCodec(int compression_level)
-      : compression_level_(compression_level == kUseDefaultCompressionLevel
-                               ? kZSTDDefaultCompressionLevel
-                               : compression_level) {}
+  ZSTDOneShotState() = default;
+
+  ~ZSTDOneShotState() {
+    ZSTD_freeCCtx(cctx_);
+    ZSTD_freeDCtx(dctx_);
+  }
 
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
-                             int64_t output_buffer_len, uint8_t* output_buffer) override {
+                             int64_t output_buffer_len, uint8_t* output_buffer) {
+    if (dctx_ == nullptr) {
+      dctx_ = ZSTD_createDCtx();
+      if (dctx_ == nullptr) {
+        return Status::OutOfMemory("ZSTD failed to create a decompression context");
+      }
+    }
     if (output_buffer == nullptr) {
       // We may pass a NULL 0-byte output buffer but some zstd versions demand
       // a valid pointer: https://github.com/facebook/zstd/issues/1385
@@ -188,8 +198,9 @@ class ZSTDCodec : public Codec {
       output_buffer = &empty_buffer;
     }
 
-    size_t ret = ZSTD_decompress(output_buffer, static_cast<size_t>(output_buffer_len),
-                                 input, static_cast<size_t>(input_len));
+    size_t ret =
+        ZSTD_decompressDCtx(dctx_, output_buffer, static_cast<size_t>(output_buffer_len),
+                            input, static_cast<size_t>(input_len));
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD decompression failed: ");
     }
@@ -199,6 +210,71 @@ class ZSTDCodec : public Codec {
     return static_cast<int64_t>(ret);
   }
 
+  Result<int64_t> Compress(int compression_level, int64_t input_len,
+                           const uint8_t* input, int64_t output_buffer_len,
+                           uint8_t* output_buffer) {
+    if (cctx_ == nullptr) {
+      cctx_ = ZSTD_createCCtx();
+      if (cctx_ == nullptr) {
+        return Status::OutOfMemory("ZSTD failed to create a compression context");
+      }
+    }
+    size_t ret =
+        ZSTD_compressCCtx(cctx_, output_buffer, static_cast<size_t>(output_buffer_len),
+                          input, static_cast<size_t>(input_len), compression_level);
+    if (ZSTD_isError(ret)) {
+      return ZSTDError(ret, "ZSTD compression failed: ");
+    }
+    return static_cast<int64_t>(ret);
+  }
+
+  static ZSTDOneShotState* ThreadLocal() {
+    static thread_local ZSTDOneShotState state;
+    return &state;
+  }
+
+ private:
+  ZSTD_CCtx* cctx_ = nullptr;
+  ZSTD_DCtx* dctx_ = nullptr;
+};
+
+class ZSTDCodecContext : public CodecContext {
+ public:
+  explicit ZSTDCodecContext(int compression_level)
+      : compression_level_(compression_level) {}
+
+  Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
+                             int64_t output_buffer_len, uint8_t* output_buffer) override {
+    return state_.Decompress(input_len, input, output_buffer_len, output_buffer);
+  }
+
+  Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
+                           int64_t output_buffer_len, uint8_t* output_buffer) override {
+    return state_.Compress(compression_level_, input_len, input, output_buffer_len,
+                           output_buffer);
+  }
+
+ private:
+  const int compression_level_;
+  ZSTDOneShotState state_;
+};
+
+// ----------------------------------------------------------------------
+// ZSTD codec implementation
+
+class ZSTDCodec : public Codec {
+ public:
+  explicit ZSTDCodec(int compression_level)
+      : compression_level_(compression_level == kUseDefaultCompressionLevel
+                               ? kZSTDDefaultCompressionLevel
+                               : compression_level) {}
+
+  Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
+                             int64_t output_buffer_len, uint8_t* output_buffer) override {
+    return ZSTDOneShotState::ThreadLocal()->Decompress(input_len, input,
+                                                       output_buffer_len, output_buffer);
+  }
+
   int64_t MaxCompressedLen(int64_t input_len,
                            const uint8_t* ARROW_ARG_UNUSED(input)) override {
     DCHECK_GE(input_len, 0);
@@ -207,12 +283,8 @@ class ZSTDCodec : public Codec {
 
   Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer) override {
-    size_t ret = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len),
-                               input, static_cast<size_t>(input_len), compression_level_);
-    if (ZSTD_isError(ret)) {
-      return ZSTDError(ret, "ZSTD compression failed: ");
-    }
-    return static_cast<int64_t>(ret);
+    return ZSTDOneShotState::ThreadLocal()->Compress(
+        compression_level_, input_len, input, output_buffer_len, output_buffer);
   }
 
   Result<std::shared_ptr<Compressor>> MakeCompressor() override {
@@ -227,6 +299,10 @@ class ZSTDCodec : public Codec {
     return ptr;
   }
 
+  Result<std::unique_ptr<CodecContext>> MakeContext() override {
+    return std::unique_ptr<CodecContext>(new ZSTDCodecContext(compression_level_));
+  }
+
   Compression::type compression_type() const override { return Compression::ZSTD; }
   int minimum_compression_level() const override { return ZSTD_minCLevel(); }
   int maximum_compression_level() const override { return ZSTD_maxCLevel(); }
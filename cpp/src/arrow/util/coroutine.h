@@ -0,0 +1,306 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// C++20 coroutine support for Future and AsyncGenerator.
+//
+// Arrow itself is built as C++11, so this header is only usable from code
+// compiled with coroutine support, in which case ARROW_HAVE_COROUTINES is defined.
+//
+// - A coroutine returning Future<T> runs eagerly, like any Arrow async function,
+//   and finishes the future with what it co_returns (a T, Result<T> or Status).
+// - `co_await future` suspends until the future finishes and evaluates to its
+//   Result<T> (or Status for a Future<>).  The coroutine is resumed by the thread
+//   finishing the future, as a continuation would be.
+// - A coroutine returning CoroutineGenerator<T> is lazy: every call to the
+//   AsyncGenerator<T> obtained from it resumes the coroutine until its next
+//   co_yield.  co_return'ing Status::OK() ends the iteration, an error fails it.
+//
+// Coroutine frames are allocated from the default memory pool, or from the pool
+// given as the coroutine's first argument if it is a MemoryPool*.  If allocation
+// fails, the coroutine returns a future (or generator) failing with OutOfMemory.
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define ARROW_HAVE_COROUTINES
+#endif
+#endif
+
+#ifdef ARROW_HAVE_COROUTINES
+
+#include <coroutine>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/future.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace detail {
+
+/// Allocates coroutine frames from a MemoryPool
+class CoroutineFrameAllocator {
+ public:
+  static void* operator new(std::size_t size) noexcept {
+    return Allocate(size, default_memory_pool());
+  }
+
+  template <typename... Args>
+  static void* operator new(std::size_t size, MemoryPool* pool, Args&&...) noexcept {
+    return Allocate(size, pool);
+  }
+
+  static void operator delete(void* frame, std::size_t size) noexcept {
+    auto header = static_cast<uint8_t*>(frame) - kHeaderSize;
+    MemoryPool* pool = *reinterpret_cast<MemoryPool**>(header);
+    pool->Free(header, static_cast<int64_t>(size + kHeaderSize));
+  }
+
+ private:
+  // The pool is stored before the frame, keeping the frame suitably aligned
+  static constexpr std::size_t kHeaderSize = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+  static void* Allocate(std::size_t size, MemoryPool* pool) noexcept {
+    uint8_t* header;
+    if (!pool->Allocate(static_cast<int64_t>(size + kHeaderSize), &header).ok()) {
+      return nullptr;
+    }
+    *reinterpret_cast<MemoryPool**>(header) = pool;
+    return header + kHeaderSize;
+  }
+};
+
+template <typename T>
+class FuturePromiseBase : public CoroutineFrameAllocator {
+ public:
+  Future<T> get_return_object() { return future_; }
+
+  static Future<T> get_return_object_on_allocation_failure() {
+    return Future<T>::MakeFinished(
+        Status::OutOfMemory("Failed to allocate a coroutine frame"));
+  }
+
+  std::suspend_never initial_suspend() noexcept { return {}; }
+  std::suspend_never final_suspend() noexcept { return {}; }
+
+  void unhandled_exception() noexcept {
+    future_.MarkFinished(Status::UnknownError("Unhandled exception in coroutine"));
+  }
+
+ protected:
+  Future<T> future_ = Future<T>::Make();
+};
+
+template <typename T>
+class FuturePromise : public FuturePromiseBase<T> {
+ public:
+  void return_value(Result<T> result) { this->future_.MarkFinished(std::move(result)); }
+};
+
+template <>
+class FuturePromise<internal::Empty> : public FuturePromiseBase<internal::Empty> {
+ public:
+  void return_value(Status status) { this->future_.MarkFinished(std::move(status)); }
+};
+
+template <typename T>
+class FutureAwaiter {
+ public:
+  explicit FutureAwaiter(Future<T> future) : future_(std::move(future)) {}
+
+  bool await_ready() const { return future_.is_finished(); }
+
+  bool await_suspend(std::coroutine_handle<> handle) {
+    // If the future finished meanwhile, resume right away rather than from
+    // within the callback, so as not to grow the stack
+    return future_.TryAddCallback([handle] {
+      return [handle](const Result<T>&) { handle.resume(); };
+    });
+  }
+
+  typename Future<T>::SyncType await_resume() { return FutureToSync(future_); }
+
+ private:
+  Future<T> future_;
+};
+
+}  // namespace detail
+
+/// \brief Suspend a coroutine until `future` finishes, and return its result
+template <typename T>
+detail::FutureAwaiter<T> operator co_await(Future<T> future) {
+  return detail::FutureAwaiter<T>(std::move(future));
+}
+
+/// \brief The return type of a coroutine implementing an AsyncGenerator<T>
+///
+/// The coroutine starts suspended, and runs up to its next co_yield (or its end)
+/// every time the generator is called.  The generator must not be called again
+/// before the future it last returned has finished.
+template <typename T>
+class CoroutineGenerator {
+ public:
+  class promise_type;
+
+ private:
+  using Handle = std::coroutine_handle<promise_type>;
+  struct State;
+
+ public:
+  class promise_type : public detail::CoroutineFrameAllocator {
+   public:
+    CoroutineGenerator get_return_object() {
+      return CoroutineGenerator(std::make_shared<State>(Handle::from_promise(*this)));
+    }
+
+    static CoroutineGenerator get_return_object_on_allocation_failure() {
+      return CoroutineGenerator(
+          Status::OutOfMemory("Failed to allocate a coroutine frame"));
+    }
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    auto yield_value(T value) {
+      result_ = std::move(value);
+      return Publisher{this};
+    }
+
+    void return_value(Status status) {
+      result_ = status.ok() ? Result<T>(IterationTraits<T>::End())
+                            : Result<T>(std::move(status));
+    }
+
+    auto final_suspend() noexcept { return Publisher{this}; }
+
+    void unhandled_exception() noexcept {
+      result_ = Status::UnknownError("Unhandled exception in coroutine");
+    }
+
+   private:
+    friend struct State;
+
+    // Once the coroutine is suspended, finish the pending future with the
+    // yielded or final result
+    struct Publisher {
+      bool await_ready() const noexcept { return false; }
+
+      void await_suspend(Handle) noexcept {
+        // Finishing the future may run callbacks which resume the coroutine or
+        // destroy the generator: move everything needed out of the frame first
+        auto next = std::move(promise->next_);
+        auto keep_alive = std::move(promise->keep_alive_);
+        auto result = std::move(promise->result_);
+        next.MarkFinished(std::move(result));
+      }
+
+      void await_resume() const noexcept {}
+
+      promise_type* promise;
+    };
+
+    Result<T> result_;
+    Future<T> next_;
+    // The generator state, kept alive while the coroutine runs
+    std::shared_ptr<State> keep_alive_;
+  };
+
+  /// \brief Return the AsyncGenerator<T> driving the coroutine
+  std::function<Future<T>()> ToGenerator() && {
+    if (!state_) {
+      auto result = Future<T>::MakeFinished(std::move(status_));
+      return [result] { return result; };
+    }
+    auto state = std::move(state_);
+    return [state] { return state->Next(); };
+  }
+
+  operator std::function<Future<T>()>() && {  // NOLINT runtime/explicit
+    return std::move(*this).ToGenerator();
+  }
+
+ private:
+  struct State : public std::enable_shared_from_this<State> {
+    explicit State(Handle handle) : handle(handle) {}
+
+    ~State() { handle.destroy(); }
+
+    Future<T> Next() {
+      if (handle.done()) {
+        return Future<T>::MakeFinished(IterationTraits<T>::End());
+      }
+      promise_type& promise = handle.promise();
+      DCHECK(!promise.next_.is_valid()) << "CoroutineGenerator called re-entrantly";
+      auto next = Future<T>::Make();
+      promise.next_ = next;
+      promise.keep_alive_ = this->shared_from_this();
+      handle.resume();
+      return next;
+    }
+
+    Handle handle;
+  };
+
+  explicit CoroutineGenerator(std::shared_ptr<State> state) : state_(std::move(state)) {}
+  explicit CoroutineGenerator(Status status) : status_(std::move(status)) {}
+
+  std::shared_ptr<State> state_;
+  Status status_;
+};
+
+}  // namespace arrow
+
+namespace std {
+
+template <typename T, typename... Args>
+struct coroutine_traits<arrow::Future<T>, Args...> {
+  using promise_type = arrow::detail::FuturePromise<T>;
+};
+
+}  // namespace std
+
+/// \brief Coroutine counterpart of ARROW_RETURN_NOT_OK
+#define ARROW_CO_RETURN_NOT_OK(status)                                \
+  do {                                                                \
+    ::arrow::Status __s = ::arrow::internal::GenericToStatus(status); \
+    if (ARROW_PREDICT_FALSE(!__s.ok())) {                             \
+      co_return __s;                                                  \
+    }                                                                 \
+  } while (false)
+
+#define ARROW_CO_ASSIGN_OR_RAISE_IMPL(result_name, lhs, rexpr) \
+  auto&& result_name = (rexpr);                                \
+  if (ARROW_PREDICT_FALSE(!(result_name).ok())) {              \
+    co_return (result_name).status();                          \
+  }                                                            \
+  lhs = std::move(result_name).ValueUnsafe();
+
+/// \brief Coroutine counterpart of ARROW_ASSIGN_OR_RAISE
+///
+/// Example: ARROW_CO_ASSIGN_OR_RAISE(auto batch, co_await ReadNextBatch());
+#define ARROW_CO_ASSIGN_OR_RAISE(lhs, rexpr)                                       \
+  ARROW_CO_ASSIGN_OR_RAISE_IMPL(                                                   \
+      ARROW_ASSIGN_OR_RAISE_NAME(_error_or_value, __COUNTER__), lhs, rexpr);
+
+#endif  // ARROW_HAVE_COROUTINES
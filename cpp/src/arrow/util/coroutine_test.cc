@@ -0,0 +1,160 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/coroutine.h"
+
+// The tests are only built with coroutine support
+#ifdef ARROW_HAVE_COROUTINES
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/memory_pool.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/optional.h"
+
+namespace arrow {
+
+namespace {
+
+Future<int> AddOne(Future<int> future) {
+  ARROW_CO_ASSIGN_OR_RAISE(int value, co_await future);
+  co_return value + 1;
+}
+
+Future<> CheckPositive(Future<int> future) {
+  ARROW_CO_ASSIGN_OR_RAISE(int value, co_await AddOne(future));
+  if (value <= 1) {
+    co_return Status::Invalid("Not positive: ", value - 1);
+  }
+  co_return Status::OK();
+}
+
+Future<int> AddOneFrom(MemoryPool*, Future<int> future) {
+  return AddOne(std::move(future));
+}
+
+Future<int> AwaitFrom(MemoryPool*, Future<int> future) {
+  ARROW_CO_ASSIGN_OR_RAISE(int value, co_await future);
+  co_return value;
+}
+
+CoroutineGenerator<util::optional<int>> Count(std::vector<Future<int>> futures) {
+  for (auto& future : futures) {
+    ARROW_CO_ASSIGN_OR_RAISE(int value, co_await future);
+    co_yield value;
+  }
+  co_return Status::OK();
+}
+
+}  // namespace
+
+TEST(Coroutine, AwaitFinished) {
+  ASSERT_FINISHES_OK_AND_EQ(2, AddOne(Future<int>::MakeFinished(1)));
+  ASSERT_FINISHES_AND_RAISES(
+      Invalid, AddOne(Future<int>::MakeFinished(Status::Invalid("XYZ"))));
+  ASSERT_FINISHES_OK(CheckPositive(Future<int>::MakeFinished(1)));
+  ASSERT_FINISHES_AND_RAISES(Invalid, CheckPositive(Future<int>::MakeFinished(0)));
+}
+
+TEST(Coroutine, AwaitPending) {
+  auto future = Future<int>::Make();
+  auto result = CheckPositive(future);
+  AssertNotFinished(result);
+  std::thread([future]() mutable { future.MarkFinished(41); }).join();
+  ASSERT_FINISHES_OK(result);
+}
+
+TEST(Coroutine, FrameAllocation) {
+  ProxyMemoryPool pool(default_memory_pool());
+  auto future = Future<int>::Make();
+  auto result = AwaitFrom(&pool, future);
+  // The frame is alive while the coroutine is suspended
+  ASSERT_GT(pool.bytes_allocated(), 0);
+  future.MarkFinished(1);
+  ASSERT_FINISHES_OK_AND_EQ(1, result);
+  ASSERT_EQ(0, pool.bytes_allocated());
+
+  LimitedMemoryPool limited_pool(default_memory_pool(), /*limit=*/0);
+  ASSERT_FINISHES_AND_RAISES(OutOfMemory,
+                             AwaitFrom(&limited_pool, Future<int>::MakeFinished(1)));
+  // Not a coroutine itself, the wrapper allocates from the default pool
+  ASSERT_FINISHES_OK_AND_EQ(2, AddOneFrom(&limited_pool, Future<int>::MakeFinished(1)));
+}
+
+TEST(CoroutineGenerator, Basics) {
+  std::vector<Future<int>> futures = {Future<int>::MakeFinished(1), Future<int>::Make(),
+                                      Future<int>::MakeFinished(3)};
+  AsyncGenerator<util::optional<int>> gen = Count(futures);
+
+  ASSERT_FINISHES_OK_AND_EQ(util::make_optional(1), gen());
+  auto next = gen();
+  AssertNotFinished(next);
+  futures[1].MarkFinished(2);
+  ASSERT_FINISHES_OK_AND_EQ(util::make_optional(2), next);
+  ASSERT_FINISHES_OK_AND_EQ(util::make_optional(3), gen());
+  ASSERT_FINISHES_OK_AND_EQ(util::optional<int>(), gen());
+  ASSERT_FINISHES_OK_AND_EQ(util::optional<int>(), gen());
+}
+
+TEST(CoroutineGenerator, Collect) {
+  std::vector<Future<int>> futures;
+  for (int i = 0; i < 100; ++i) {
+    futures.push_back(i % 2 ? Future<int>::MakeFinished(i) : Future<int>::Make());
+  }
+  auto collected = CollectAsyncGenerator<util::optional<int>>(Count(futures));
+  std::thread([&] {
+    for (int i = 0; i < 100; i += 2) {
+      futures[i].MarkFinished(i);
+    }
+  }).join();
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto values, collected);
+  ASSERT_EQ(100, values.size());
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(i, *values[i]);
+  }
+}
+
+TEST(CoroutineGenerator, Error) {
+  AsyncGenerator<util::optional<int>> gen =
+      Count({Future<int>::MakeFinished(1), Future<int>::MakeFinished(Status::IOError("")),
+             Future<int>::MakeFinished(3)});
+  ASSERT_FINISHES_OK_AND_EQ(util::make_optional(1), gen());
+  ASSERT_FINISHES_AND_RAISES(IOError, gen());
+  ASSERT_FINISHES_OK_AND_EQ(util::optional<int>(), gen());
+}
+
+TEST(CoroutineGenerator, DestroyedUnfinished) {
+  auto future = Future<int>::Make();
+  Future<util::optional<int>> next;
+  {
+    AsyncGenerator<util::optional<int>> gen = Count({future, future});
+    next = gen();
+  }
+  // The coroutine is kept alive until it suspends at its next co_yield
+  future.MarkFinished(1);
+  ASSERT_FINISHES_OK_AND_EQ(util::make_optional(1), next);
+}
+
+}  // namespace arrow
+
+#endif  // ARROW_HAVE_COROUTINES
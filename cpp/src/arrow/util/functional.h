@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <tuple>
 #include <type_traits>
 
@@ -119,6 +121,9 @@ struct call_traits {
 /// Invoking it results in destruction of the lambda, freeing any state/references
 /// immediately. Invoking a default constructed FnOnce or one which has already been
 /// invoked will segfault.
+///
+/// Small callables (such as the continuations chained by Future::Then) are stored
+/// inline rather than on the heap.
 template <typename Signature>
 class FnOnce;
 
@@ -130,31 +135,124 @@ class FnOnce<R(A...)> {
   template <typename Fn,
             typename = typename std::enable_if<std::is_convertible<
                 decltype(std::declval<Fn&&>()(std::declval<A>()...)), R>::value>::type>
-  FnOnce(Fn fn) : impl_(new FnImpl<Fn>(std::move(fn))) {  // NOLINT runtime/explicit
+  FnOnce(Fn fn) {  // NOLINT runtime/explicit
+    Emplace(std::move(fn), std::integral_constant<bool, FitsInline<Fn>::value>{});
   }
 
-  explicit operator bool() const { return impl_ != NULLPTR; }
+  FnOnce(FnOnce&& other) noexcept { MoveFrom(&other); }
+
+  FnOnce& operator=(FnOnce&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      MoveFrom(&other);
+    }
+    return *this;
+  }
+
+  ~FnOnce() { Reset(); }
+
+  explicit operator bool() const { return ops_ != NULLPTR; }
 
   R operator()(A... a) && {
-    auto bye = std::move(impl_);
-    return bye->invoke(std::forward<A&&>(a)...);
+    // The callable is destroyed on return, even if it reassigns *this
+    FnOnce bye(std::move(*this));
+    return bye.ops_->invoke(&bye.storage_, std::forward<A&&>(a)...);
   }
 
  private:
-  struct Impl {
-    virtual ~Impl() = default;
-    virtual R invoke(A&&... a) = 0;
+  static constexpr size_t kInlineSize = 6 * sizeof(void*);
+  using Storage = typename std::aligned_storage<kInlineSize>::type;
+
+  template <typename Fn>
+  struct FitsInline
+      : std::integral_constant<bool, sizeof(Fn) <= kInlineSize &&
+                                         alignof(Fn) <= alignof(Storage) &&
+                                         std::is_nothrow_move_constructible<Fn>::value> {
+  };
+
+  struct Ops {
+    R (*invoke)(Storage*, A&&...);
+    // Move the callable to uninitialized storage, leaving the source destroyed
+    void (*relocate)(Storage* dest, Storage* source);
+    void (*destroy)(Storage*);
+  };
+
+  template <typename Fn>
+  struct InlineOps {
+    static Fn* Callable(Storage* storage) { return reinterpret_cast<Fn*>(storage); }
+
+    static R Invoke(Storage* storage, A&&... a) {
+      return std::move(*Callable(storage))(std::forward<A&&>(a)...);
+    }
+
+    static void Relocate(Storage* dest, Storage* source) {
+      new (dest) Fn(std::move(*Callable(source)));
+      Callable(source)->~Fn();
+    }
+
+    static void Destroy(Storage* storage) { Callable(storage)->~Fn(); }
+
+    static const Ops* Table() {
+      static const Ops ops = {&Invoke, &Relocate, &Destroy};
+      return &ops;
+    }
   };
 
   template <typename Fn>
-  struct FnImpl : Impl {
-    explicit FnImpl(Fn fn) : fn_(std::move(fn)) {}
-    R invoke(A&&... a) override { return std::move(fn_)(std::forward<A&&>(a)...); }
-    Fn fn_;
+  struct HeapOps {
+    static Fn*& Callable(Storage* storage) { return *reinterpret_cast<Fn**>(storage); }
+
+    static R Invoke(Storage* storage, A&&... a) {
+      return std::move(*Callable(storage))(std::forward<A&&>(a)...);
+    }
+
+    static void Relocate(Storage* dest, Storage* source) {
+      new (dest) Fn*(Callable(source));
+    }
+
+    static void Destroy(Storage* storage) { delete Callable(storage); }
+
+    static const Ops* Table() {
+      static const Ops ops = {&Invoke, &Relocate, &Destroy};
+      return &ops;
+    }
   };
 
-  std::unique_ptr<Impl> impl_;
+  template <typename Fn>
+  void Emplace(Fn&& fn, std::true_type /*fits_inline=*/) {
+    using Decayed = typename std::decay<Fn>::type;
+    new (&storage_) Decayed(std::forward<Fn>(fn));
+    ops_ = InlineOps<Decayed>::Table();
+  }
+
+  template <typename Fn>
+  void Emplace(Fn&& fn, std::false_type /*fits_inline=*/) {
+    using Decayed = typename std::decay<Fn>::type;
+    new (&storage_) Decayed*(new Decayed(std::forward<Fn>(fn)));
+    ops_ = HeapOps<Decayed>::Table();
+  }
+
+  void MoveFrom(FnOnce* other) {
+    if (other->ops_ != NULLPTR) {
+      other->ops_->relocate(&storage_, &other->storage_);
+      ops_ = other->ops_;
+      other->ops_ = NULLPTR;
+    }
+  }
+
+  void Reset() {
+    if (ops_ != NULLPTR) {
+      ops_->destroy(&storage_);
+      ops_ = NULLPTR;
+    }
+  }
+
+  const Ops* ops_ = NULLPTR;
+  Storage storage_;
 };
 
+template <typename R, typename... A>
+constexpr size_t FnOnce<R(A...)>::kInlineSize;
+
 }  // namespace internal
 }  // namespace arrow
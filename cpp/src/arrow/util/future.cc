@@ -242,7 +242,6 @@ class ConcreteFutureImpl : public FutureImpl {
 
   void AddCallback(Callback callback, CallbackOptions opts) {
     CheckOptions(opts);
-    std::unique_lock<std::mutex> lock(mutex_);
 #ifdef ARROW_WITH_OPENTELEMETRY
     struct SpanWrapper {
       void operator()(const FutureImpl& impl) {
@@ -257,13 +256,28 @@ class ConcreteFutureImpl : public FutureImpl {
     callback = std::move(wrapper);
 #endif
     CallbackRecord callback_record{std::move(callback), opts};
-    if (IsFutureFinished(state_)) {
-      lock.unlock();
-      RunOrScheduleCallback(shared_from_this(), std::move(callback_record),
-                            /*in_add_callback=*/true);
-    } else {
-      callbacks_.push_back(std::move(callback_record));
+    if (!IsFutureFinished(state_)) {
+      // Most futures get a single callback: hand it over to DoMarkFinishedOrFailed
+      // through first_callback_, without locking
+      int8_t slot_state = kSlotEmpty;
+      if (first_callback_state_.compare_exchange_strong(slot_state, kSlotWriting)) {
+        first_callback_ = std::move(callback_record);
+        slot_state = kSlotWriting;
+        if (first_callback_state_.compare_exchange_strong(slot_state, kSlotSet)) {
+          return;
+        }
+        // The future was marked finished meanwhile
+        callback_record = std::move(first_callback_);
+      } else if (slot_state != kSlotConsumed) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!IsFutureFinished(state_)) {
+          callbacks_.push_back(std::move(callback_record));
+          return;
+        }
+      }
     }
+    RunOrScheduleCallback(shared_from_this(), std::move(callback_record),
+                          /*in_add_callback=*/true);
   }
 
   bool TryAddCallback(const std::function<Callback()>& callback_factory,
@@ -331,6 +345,10 @@ class ConcreteFutureImpl : public FutureImpl {
     auto callbacks = std::move(callbacks_);
     auto self = shared_from_this();
 
+    if (first_callback_state_.exchange(kSlotConsumed) == kSlotSet) {
+      RunOrScheduleCallback(self, std::move(first_callback_), /*in_add_callback=*/false);
+    }
+
     // run callbacks, lock not needed since the future is finished by this
     // point so nothing else can modify the callbacks list and it is safe
     // to iterate.
@@ -360,6 +378,12 @@ class ConcreteFutureImpl : public FutureImpl {
   std::condition_variable cv_;
   FutureWaiter* waiter_ = nullptr;
   int waiter_arg_ = -1;
+
+  // The state of first_callback_: AddCallback claims it as kSlotWriting, then
+  // publishes it as kSlotSet, unless DoMarkFinishedOrFailed made it kSlotConsumed
+  enum : int8_t { kSlotEmpty, kSlotWriting, kSlotSet, kSlotConsumed };
+  std::atomic<int8_t> first_callback_state_{kSlotEmpty};
+  CallbackRecord first_callback_;
 };
 
 namespace {
@@ -370,14 +394,18 @@ ConcreteFutureImpl* GetConcreteFuture(FutureImpl* future) {
 
 }  // namespace
 
-std::unique_ptr<FutureImpl> FutureImpl::Make() {
-  return std::unique_ptr<FutureImpl>(new ConcreteFutureImpl());
+constexpr size_t FutureImpl::kInlineResultSize;
+
+std::shared_ptr<FutureImpl> FutureImpl::Make() {
+  return std::make_shared<ConcreteFutureImpl>();
 }
 
-std::unique_ptr<FutureImpl> FutureImpl::MakeFinished(FutureState state) {
-  std::unique_ptr<ConcreteFutureImpl> ptr(new ConcreteFutureImpl());
+std::shared_ptr<FutureImpl> FutureImpl::MakeFinished(FutureState state) {
+  auto ptr = std::make_shared<ConcreteFutureImpl>();
   ptr->state_ = state;
-  return std::move(ptr);
+  // Callbacks added from now on run immediately
+  ptr->first_callback_state_ = ConcreteFutureImpl::kSlotConsumed;
+  return ptr;
 }
 
 FutureImpl::FutureImpl() : state_(FutureState::PENDING) {}
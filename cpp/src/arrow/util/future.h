@@ -21,6 +21,7 @@
 #include <cmath>
 #include <functional>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -260,8 +261,8 @@ class ARROW_EXPORT FutureImpl : public std::enable_shared_from_this<FutureImpl>
 
   FutureState state() { return state_.load(); }
 
-  static std::unique_ptr<FutureImpl> Make();
-  static std::unique_ptr<FutureImpl> MakeFinished(FutureState state);
+  static std::shared_ptr<FutureImpl> Make();
+  static std::shared_ptr<FutureImpl> MakeFinished(FutureState state);
 
   // Future API
   void MarkFinished();
@@ -272,6 +273,16 @@ class ARROW_EXPORT FutureImpl : public std::enable_shared_from_this<FutureImpl>
   Result<ValueType>* CastResult() const {
     return static_cast<Result<ValueType>*>(result_.get());
   }
+  template <typename ValueType>
+  void SetResult(Result<ValueType> res) {
+    using ResultType = Result<ValueType>;
+    // Destroy any previous result before reusing the inline storage
+    result_.reset();
+    EmplaceResult(std::move(res),
+                  std::integral_constant<bool, sizeof(ResultType) <= kInlineResultSize &&
+                                                   alignof(ResultType) <=
+                                                       alignof(InlineResult)>{});
+  }
 
   using Callback = internal::FnOnce<void(const FutureImpl& impl)>;
   void AddCallback(Callback callback, CallbackOptions opts);
@@ -284,8 +295,11 @@ class ARROW_EXPORT FutureImpl : public std::enable_shared_from_this<FutureImpl>
 
   std::atomic<FutureState> state_{FutureState::PENDING};
 
-  // Type erased storage for arbitrary results
-  // XXX small objects could be stored inline instead of boxed in a pointer
+  // Type erased storage for arbitrary results.  Small results are constructed
+  // in inline_result_ rather than boxed in a separate allocation.
+  static constexpr size_t kInlineResultSize = 4 * sizeof(void*);
+  using InlineResult = typename std::aligned_storage<kInlineResultSize>::type;
+  InlineResult inline_result_;
   using Storage = std::unique_ptr<void, void (*)(void*)>;
   Storage result_{NULLPTR, NULLPTR};
 
@@ -294,6 +308,21 @@ class ARROW_EXPORT FutureImpl : public std::enable_shared_from_this<FutureImpl>
     CallbackOptions options;
   };
   std::vector<CallbackRecord> callbacks_;
+
+ private:
+  template <typename ResultType>
+  void EmplaceResult(ResultType&& res, std::true_type /*fits_inline=*/) {
+    using Decayed = typename std::decay<ResultType>::type;
+    result_ = {new (&inline_result_) Decayed(std::forward<ResultType>(res)),
+               [](void* p) { static_cast<Decayed*>(p)->~Decayed(); }};
+  }
+
+  template <typename ResultType>
+  void EmplaceResult(ResultType&& res, std::false_type /*fits_inline=*/) {
+    using Decayed = typename std::decay<ResultType>::type;
+    result_ = {new Decayed(std::forward<ResultType>(res)),
+               [](void* p) { delete static_cast<Decayed*>(p); }};
+  }
 };
 
 // An object that waits on multiple futures at once.  Only one waiter
@@ -700,10 +729,7 @@ class ARROW_MUST_USE_TYPE Future {
 
   Result<ValueType>* GetResult() const { return impl_->CastResult<ValueType>(); }
 
-  void SetResult(Result<ValueType> res) {
-    impl_->result_ = {new Result<ValueType>(std::move(res)),
-                      [](void* p) { delete static_cast<Result<ValueType>*>(p); }};
-  }
+  void SetResult(Result<ValueType> res) { impl_->SetResult(std::move(res)); }
 
   void DoMarkFinished(Result<ValueType> res) {
     SetResult(std::move(res));
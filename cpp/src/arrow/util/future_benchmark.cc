@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "arrow/status.h"
+#include "arrow/util/functional.h"
+#include "arrow/util/future.h"
+
+namespace arrow {
+
+static constexpr int64_t kChainLength = 100;
+
+static void MakeFinishedFuture(benchmark::State& state) {
+  for (auto _ : state) {
+    auto fut = Future<int64_t>::MakeFinished(42);
+    benchmark::DoNotOptimize(fut);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void MakeFinishedEmptyFuture(benchmark::State& state) {
+  for (auto _ : state) {
+    auto fut = Future<>::MakeFinished();
+    benchmark::DoNotOptimize(fut);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// The typical async step: a pending future gets a single continuation,
+// and is then marked finished
+static void ThenPendingFuture(benchmark::State& state) {
+  int64_t total = 0;
+  for (auto _ : state) {
+    auto fut = Future<int64_t>::Make();
+    auto next = fut.Then([&](const int64_t& value) { total += value; });
+    fut.MarkFinished(1);
+    benchmark::DoNotOptimize(next);
+  }
+  benchmark::DoNotOptimize(total);
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Continuations on an already finished future run inline
+static void ThenFinishedFutureChain(benchmark::State& state) {
+  for (auto _ : state) {
+    auto fut = Future<int64_t>::MakeFinished(0);
+    for (int64_t i = 0; i < kChainLength; ++i) {
+      fut = fut.Then([](const int64_t& value) { return value + 1; });
+    }
+    benchmark::DoNotOptimize(fut);
+  }
+  state.SetItemsProcessed(state.iterations() * kChainLength);
+}
+
+static void ThenPendingFutureChain(benchmark::State& state) {
+  for (auto _ : state) {
+    auto first = Future<int64_t>::Make();
+    auto fut = first;
+    for (int64_t i = 0; i < kChainLength; ++i) {
+      fut = fut.Then([](const int64_t& value) { return value + 1; });
+    }
+    first.MarkFinished(0);
+    benchmark::DoNotOptimize(fut);
+  }
+  state.SetItemsProcessed(state.iterations() * kChainLength);
+}
+
+static void FnOnceInvoke(benchmark::State& state) {
+  auto shared = std::make_shared<int64_t>(1);
+  int64_t total = 0;
+  for (auto _ : state) {
+    internal::FnOnce<void(int64_t)> fn = [shared, &total](int64_t value) {
+      total += *shared + value;
+    };
+    std::move(fn)(1);
+  }
+  benchmark::DoNotOptimize(total);
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(MakeFinishedFuture);
+BENCHMARK(MakeFinishedEmptyFuture);
+BENCHMARK(ThenPendingFuture);
+BENCHMARK(ThenFinishedFutureChain);
+BENCHMARK(ThenPendingFutureChain);
+BENCHMARK(FnOnceInvoke);
+
+}  // namespace arrow
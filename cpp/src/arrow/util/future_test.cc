@@ -19,6 +19,7 @@
 #include "arrow/util/future_iterator.h"
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <condition_variable>
 #include <memory>
@@ -290,6 +291,20 @@ TEST(FutureSyncTest, Empty) {
   }
 }
 
+TEST(FutureSyncTest, LargeResult) {
+  // Too large to be stored inline in the future
+  using Large = std::array<int64_t, 8>;
+  Large value{};
+  value[7] = 42;
+  auto fut = Future<Large>::Make();
+  fut.MarkFinished(value);
+  ASSERT_OK_AND_EQ(value, fut.result());
+  fut = Future<Large>::MakeFinished(value);
+  ASSERT_OK_AND_EQ(value, fut.result());
+  fut = Future<Large>::MakeFinished(Status::Invalid("XYZ"));
+  ASSERT_RAISES(Invalid, fut.result());
+}
+
 TEST(FutureSyncTest, GetStatusFuture) {
   {
     auto fut = Future<MoveOnlyDataType>::Make();
@@ -470,6 +485,23 @@ TEST(FutureStressTest, Callback) {
   }
 }
 
+TEST(FutureStressTest, FirstCallback) {
+  // A single callback racing with MarkFinished runs exactly once
+  for (unsigned int n = 0; n < 1000; n++) {
+    auto fut = Future<int>::Make();
+    std::atomic<int> count(0);
+    std::thread callback_adder([&] {
+      fut.AddCallback([&](const Result<int>& result) {
+        ASSERT_OK_AND_EQ(42, result);
+        count++;
+      });
+    });
+    fut.MarkFinished(42);
+    callback_adder.join();
+    ASSERT_EQ(1, count.load());
+  }
+}
+
 TEST(FutureStressTest, TryAddCallback) {
   for (unsigned int n = 0; n < 1; n++) {
     auto fut = Future<>::Make();
@@ -1750,6 +1782,42 @@ TEST(FnOnceTest, MoveOnlyDataType) {
   ASSERT_EQ(i1.moves, 0);
 }
 
+TEST(FnOnceTest, InlineAndHeapCallables) {
+  auto shared = std::make_shared<int>(1);
+  // Too large to be stored inline in the FnOnce
+  std::array<int64_t, 16> large{};
+  large[15] = 2;
+  FnOnce<int(int)> small_fn = [shared](int x) { return *shared + x; };
+  FnOnce<int(int)> large_fn = [shared, large](int x) {
+    return *shared + static_cast<int>(large[15]) + x;
+  };
+  ASSERT_EQ(3, shared.use_count());
+
+  FnOnce<int(int)> moved = std::move(small_fn);
+  ASSERT_FALSE(small_fn);
+  ASSERT_TRUE(moved);
+  small_fn = std::move(large_fn);
+  ASSERT_FALSE(large_fn);
+  ASSERT_EQ(3, shared.use_count());
+
+  // Invoking destroys the callable
+  ASSERT_EQ(2, std::move(moved)(1));
+  ASSERT_FALSE(moved);
+  ASSERT_EQ(2, shared.use_count());
+  ASSERT_EQ(4, std::move(small_fn)(1));
+  ASSERT_EQ(1, shared.use_count());
+}
+
+TEST(FnOnceTest, ReassignWhileInvoked) {
+  FnOnce<int()> fn;
+  fn = [&fn] {
+    fn = [] { return 2; };
+    return 1;
+  };
+  ASSERT_EQ(1, std::move(fn)());
+  ASSERT_EQ(2, std::move(fn)());
+}
+
 TEST(FutureTest, MatcherExamples) {
   EXPECT_THAT(Future<int>::MakeFinished(Status::Invalid("arbitrary error")),
               Finishes(Raises(StatusCode::Invalid)));
@@ -0,0 +1,151 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/hyperloglog.h"
+
+#include <cmath>
+#include <limits>
+
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// sigma and tau functions of Ertl's improved estimator, they correct the
+// contributions of the empty and of the saturated registers
+
+double Sigma(double x) {
+  if (x == 1) return std::numeric_limits<double>::infinity();
+  double y = 1;
+  double z = x;
+  double z_prev;
+  do {
+    x *= x;
+    z_prev = z;
+    z += x * y;
+    y += y;
+  } while (z != z_prev);
+  return z;
+}
+
+double Tau(double x) {
+  if (x == 0 || x == 1) return 0;
+  double y = 1;
+  double z = 1 - x;
+  double z_prev;
+  do {
+    x = std::sqrt(x);
+    z_prev = z;
+    y *= 0.5;
+    z -= (1 - x) * (1 - x) * y;
+  } while (z != z_prev);
+  return z / 3;
+}
+
+}  // namespace
+
+constexpr int HyperLogLog::kMinPrecision;
+constexpr int HyperLogLog::kMaxPrecision;
+
+HyperLogLog::HyperLogLog(int precision) : precision_(precision) {
+  DCHECK_OK(ValidatePrecision(precision));
+}
+
+Status HyperLogLog::ValidatePrecision(int precision) {
+  if (precision < kMinPrecision || precision > kMaxPrecision) {
+    return Status::Invalid("HyperLogLog precision must be between ", kMinPrecision,
+                           " and ", kMaxPrecision, ", got ", precision);
+  }
+  return Status::OK();
+}
+
+void HyperLogLog::CompactSparse() const {
+  std::sort(sparse_.begin(), sparse_.end());
+  // for equal indices, the last pair has the highest rank
+  size_t out = 0;
+  for (size_t i = 0; i < sparse_.size(); ++i) {
+    if (i + 1 < sparse_.size() && (sparse_[i] >> 8) == (sparse_[i + 1] >> 8)) {
+      continue;
+    }
+    sparse_[out++] = sparse_[i];
+  }
+  sparse_.resize(out);
+}
+
+void HyperLogLog::ToDense() {
+  registers_.assign(num_registers(), 0);
+  for (uint32_t pair : sparse_) {
+    uint8_t& reg = registers_[pair >> 8];
+    reg = std::max(reg, static_cast<uint8_t>(pair & 0xff));
+  }
+  sparse_.clear();
+  sparse_.shrink_to_fit();
+}
+
+void HyperLogLog::Merge(const HyperLogLog& other) {
+  DCHECK_EQ(precision_, other.precision_);
+  if (!other.registers_.empty() && registers_.empty()) {
+    ToDense();
+  }
+  if (registers_.empty()) {
+    for (uint32_t pair : other.sparse_) {
+      AddSparse(pair >> 8, static_cast<uint8_t>(pair & 0xff));
+      if (!registers_.empty()) break;
+    }
+    if (registers_.empty()) return;
+  }
+  for (size_t i = 0; i < other.registers_.size(); ++i) {
+    registers_[i] = std::max(registers_[i], other.registers_[i]);
+  }
+  for (uint32_t pair : other.sparse_) {
+    uint8_t& reg = registers_[pair >> 8];
+    reg = std::max(reg, static_cast<uint8_t>(pair & 0xff));
+  }
+}
+
+double HyperLogLog::Estimate() const {
+  if (is_empty()) return 0;
+  const int q = 64 - precision_;
+  const auto m = static_cast<double>(num_registers());
+
+  // histogram of the register values
+  std::vector<int64_t> counts(q + 2, 0);
+  if (registers_.empty()) {
+    CompactSparse();
+    counts[0] = static_cast<int64_t>(num_registers() - sparse_.size());
+    for (uint32_t pair : sparse_) {
+      ++counts[pair & 0xff];
+    }
+  } else {
+    for (uint8_t reg : registers_) {
+      ++counts[reg];
+    }
+  }
+
+  double z = m * Tau(1 - counts[q + 1] / m);
+  for (int k = q; k >= 1; --k) {
+    z = 0.5 * (z + counts[k]);
+  }
+  z += m * Sigma(counts[0] / m);
+  return m * m / (2 * std::log(2)) / z;
+}
+
+}  // namespace internal
+}  // namespace arrow
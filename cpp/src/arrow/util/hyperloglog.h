@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// approximate distinct counts from arbitrary length dataset with O(1) space
+// based on 'HyperLogLog in Practice' from Heule, Nunkesser & Hall (HyperLogLog++)
+// - https://research.google/pubs/pub40671/
+// with the estimator from 'New cardinality estimation algorithms for HyperLogLog
+// sketches' from Ertl, which needs no empirical bias correction
+// - https://arxiv.org/abs/1702.01284
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Status;
+
+namespace internal {
+
+class ARROW_EXPORT HyperLogLog {
+ public:
+  static constexpr int kMinPrecision = 4;
+  static constexpr int kMaxPrecision = 18;
+
+  // a sketch of 2^precision registers, the relative standard error of the
+  // estimate is about 1.04 / sqrt(2^precision)
+  explicit HyperLogLog(int precision = 14);
+
+  // validate the precision
+  static Status ValidatePrecision(int precision);
+
+  // add the hash of a value
+  // the hash is re-mixed, so hashes with poorly distributed high bits are fine
+  // this function is intensively called and performance critical
+  void Add(uint64_t hash) {
+    hash = Mix(hash);
+    const auto index = static_cast<uint32_t>(hash >> (64 - precision_));
+    const uint8_t rank = Rank(hash);
+    if (ARROW_PREDICT_FALSE(registers_.empty())) {
+      AddSparse(index, rank);
+    } else if (rank > registers_[index]) {
+      registers_[index] = rank;
+    }
+  }
+
+  // merge with another sketch of the same precision, called infrequently
+  void Merge(const HyperLogLog& other);
+
+  // estimate the number of distinct values added
+  double Estimate() const;
+
+  int precision() const { return precision_; }
+
+  // check if no value was added to this sketch
+  bool is_empty() const { return registers_.empty() && sparse_.empty(); }
+
+ private:
+  // murmur3 64-bit finalizer
+  static uint64_t Mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+  }
+
+  // position of the first set bit after the register index, starting at 1
+  uint8_t Rank(uint64_t hash) const {
+    const uint64_t w = hash << precision_;
+    return static_cast<uint8_t>(w == 0 ? 64 - precision_ + 1
+                                       : bit_util::CountLeadingZeros(w) + 1);
+  }
+
+  // small sketches keep (index, rank) pairs rather than all the registers
+  void AddSparse(uint32_t index, uint8_t rank) {
+    sparse_.push_back(index << 8 | rank);
+    if (ARROW_PREDICT_FALSE(sparse_.size() >= sparse_capacity())) {
+      CompactSparse();
+      if (sparse_.size() > num_registers() / 8) {
+        ToDense();
+      }
+    }
+  }
+  size_t sparse_capacity() const { return std::max<size_t>(16, num_registers() / 4); }
+  size_t num_registers() const { return size_t(1) << precision_; }
+
+  // sort the sparse pairs and keep the highest rank per index
+  void CompactSparse() const;
+  // switch to the dense representation, once the sparse one is no smaller
+  void ToDense();
+
+  int precision_;
+  // dense representation, empty while the sketch is sparse
+  std::vector<uint8_t> registers_;
+  // sparse representation, mutable so that it can be compacted when estimating
+  mutable std::vector<uint32_t> sparse_;
+};
+
+}  // namespace internal
+}  // namespace arrow
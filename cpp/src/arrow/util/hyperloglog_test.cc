@@ -0,0 +1,120 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/hyperloglog.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+uint64_t HashOf(int64_t value) { return ScalarHelper<int64_t>::ComputeHash(value); }
+
+// The estimates are deterministic, but the bound is left loose to not depend
+// on the exact hash function
+void AssertEstimateNear(const HyperLogLog& hll, int64_t expected) {
+  const double stderr_ = 1.04 / std::sqrt(static_cast<double>(1 << hll.precision()));
+  EXPECT_NEAR(hll.Estimate(), static_cast<double>(expected),
+              4 * stderr_ * static_cast<double>(expected) + 1)
+      << "precision = " << hll.precision();
+}
+
+}  // namespace
+
+TEST(HyperLogLogTest, Empty) {
+  HyperLogLog hll;
+  ASSERT_TRUE(hll.is_empty());
+  ASSERT_EQ(hll.Estimate(), 0);
+}
+
+TEST(HyperLogLogTest, ValidatePrecision) {
+  ASSERT_OK(HyperLogLog::ValidatePrecision(HyperLogLog::kMinPrecision));
+  ASSERT_OK(HyperLogLog::ValidatePrecision(HyperLogLog::kMaxPrecision));
+  ASSERT_RAISES(Invalid, HyperLogLog::ValidatePrecision(HyperLogLog::kMinPrecision - 1));
+  ASSERT_RAISES(Invalid, HyperLogLog::ValidatePrecision(HyperLogLog::kMaxPrecision + 1));
+}
+
+TEST(HyperLogLogTest, SmallCounts) {
+  // Few distinct values are counted almost exactly, whatever the number of repeats
+  HyperLogLog hll;
+  for (int repeat = 0; repeat < 10; ++repeat) {
+    for (int64_t i = 0; i < 10; ++i) {
+      hll.Add(HashOf(i));
+    }
+  }
+  ASSERT_FALSE(hll.is_empty());
+  ASSERT_EQ(std::llround(hll.Estimate()), 10);
+}
+
+TEST(HyperLogLogTest, LargeCounts) {
+  for (int precision : {HyperLogLog::kMinPrecision, 10, 14, HyperLogLog::kMaxPrecision}) {
+    for (int64_t num_distinct : {100, 10000, 1000000}) {
+      HyperLogLog hll(precision);
+      for (int64_t i = 0; i < num_distinct; ++i) {
+        hll.Add(HashOf(i));
+        hll.Add(HashOf(num_distinct - i - 1));
+      }
+      AssertEstimateNear(hll, num_distinct);
+    }
+  }
+}
+
+TEST(HyperLogLogTest, Merge) {
+  for (int64_t num_distinct : {50, 100000}) {
+    HyperLogLog all(12), left(12), right(12);
+    for (int64_t i = 0; i < num_distinct; ++i) {
+      all.Add(HashOf(i));
+      // Both halves overlap
+      (i % 3 == 0 ? left : right).Add(HashOf(i));
+      if (i % 5 == 0) left.Add(HashOf(i));
+    }
+    HyperLogLog merged(12);
+    merged.Merge(left);
+    merged.Merge(right);
+    // Merging is lossless
+    ASSERT_EQ(merged.Estimate(), all.Estimate());
+    AssertEstimateNear(merged, num_distinct);
+  }
+}
+
+TEST(HyperLogLogTest, MergeSparseIntoDense) {
+  HyperLogLog dense(8), sparse(8), all(8);
+  for (int64_t i = 0; i < 10000; ++i) {
+    dense.Add(HashOf(i));
+    all.Add(HashOf(i));
+  }
+  for (int64_t i = 0; i < 5; ++i) {
+    sparse.Add(HashOf(-i - 1));
+    all.Add(HashOf(-i - 1));
+  }
+  HyperLogLog merged(8);
+  merged.Merge(sparse);
+  merged.Merge(dense);
+  ASSERT_EQ(merged.Estimate(), all.Estimate());
+  dense.Merge(sparse);
+  ASSERT_EQ(dense.Estimate(), all.Estimate());
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -20,6 +20,8 @@
 #include <algorithm>
 #include <cstring>
 #include <limits>
+#include <utility>
+#include <vector>
 
 #include "arrow/array/data.h"
 #include "arrow/datum.h"
@@ -29,6 +31,8 @@
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/dispatch.h"
+#include "arrow/util/int_util_internal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/ubsan.h"
@@ -418,9 +422,11 @@ void UpcastInts(const int32_t* source, int64_t* dest, int64_t length) {
   CastIntsInternal(source, dest, length);
 }
 
+namespace {
+
 template <typename InputInt, typename OutputInt>
-void TransposeInts(const InputInt* src, OutputInt* dest, int64_t length,
-                   const int32_t* transpose_map) {
+void TransposeIntsScalar(const InputInt* src, OutputInt* dest, int64_t length,
+                         const int32_t* transpose_map) {
   while (length >= 4) {
     dest[0] = static_cast<OutputInt>(transpose_map[src[0]]);
     dest[1] = static_cast<OutputInt>(transpose_map[src[1]]);
@@ -436,6 +442,40 @@ void TransposeInts(const InputInt* src, OutputInt* dest, int64_t length,
   }
 }
 
+template <typename InputInt, typename OutputInt, typename Enable = void>
+struct TransposeIntsDynamicFunction {
+  using FunctionType = decltype(&TransposeIntsScalar<InputInt, OutputInt>);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, TransposeIntsScalar<InputInt, OutputInt>}};
+  }
+};
+
+// Narrow and 32-bit indices can look up the transpose map with AVX2 gathers
+template <typename InputInt, typename OutputInt>
+struct TransposeIntsDynamicFunction<
+    InputInt, OutputInt, enable_if_t<HasTransposeIntsAvx2<InputInt>::value>> {
+  using FunctionType = decltype(&TransposeIntsScalar<InputInt, OutputInt>);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      { DispatchLevel::NONE, TransposeIntsScalar<InputInt, OutputInt> }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { DispatchLevel::AVX2, TransposeIntsAvx2<InputInt, OutputInt> }
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+template <typename InputInt, typename OutputInt>
+void TransposeInts(const InputInt* src, OutputInt* dest, int64_t length,
+                   const int32_t* transpose_map) {
+  static DynamicDispatch<TransposeIntsDynamicFunction<InputInt, OutputInt>> dispatch;
+  dispatch.func(src, dest, length, transpose_map);
+}
+
 #define INSTANTIATE(SRC, DEST)              \
   template ARROW_EXPORT void TransposeInts( \
       const SRC* source, DEST* dest, int64_t length, const int32_t* transpose_map);
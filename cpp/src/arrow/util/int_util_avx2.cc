@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include <cstdint>
+
+#include "arrow/util/int_util_internal.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+constexpr int64_t kBatchSize = 8;
+
+// Load 8 indices, widened to 32 bits
+inline __m256i LoadIndices(const int8_t* src) {
+  return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+}
+inline __m256i LoadIndices(const uint8_t* src) {
+  return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+}
+inline __m256i LoadIndices(const int16_t* src) {
+  return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+}
+inline __m256i LoadIndices(const uint16_t* src) {
+  return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+}
+inline __m256i LoadIndices(const int32_t* src) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+}
+
+// Store 8 transposed values, converted to the output type
+template <typename OutputInt>
+inline void StoreValues(__m256i values, OutputInt* dest) {
+  alignas(32) int32_t buffer[kBatchSize];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(buffer), values);
+  for (int64_t i = 0; i < kBatchSize; ++i) {
+    dest[i] = static_cast<OutputInt>(buffer[i]);
+  }
+}
+inline void StoreValues(__m256i values, int32_t* dest) {
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), values);
+}
+inline void StoreValues(__m256i values, uint32_t* dest) {
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), values);
+}
+
+}  // namespace
+
+template <typename InputInt, typename OutputInt>
+void TransposeIntsAvx2(const InputInt* src, OutputInt* dest, int64_t length,
+                       const int32_t* transpose_map) {
+  const auto map = reinterpret_cast<const int*>(transpose_map);
+  while (length >= kBatchSize) {
+    const __m256i indices = LoadIndices(src);
+    StoreValues(_mm256_i32gather_epi32(map, indices, sizeof(int32_t)), dest);
+    length -= kBatchSize;
+    src += kBatchSize;
+    dest += kBatchSize;
+  }
+  while (length > 0) {
+    *dest++ = static_cast<OutputInt>(transpose_map[*src++]);
+    --length;
+  }
+}
+
+#define INSTANTIATE(SRC, DEST)                                                    \
+  template void TransposeIntsAvx2(const SRC* source, DEST* dest, int64_t length, \
+                                  const int32_t* transpose_map);
+
+#define INSTANTIATE_ALL_DEST(SRC) \
+  INSTANTIATE(SRC, uint8_t)       \
+  INSTANTIATE(SRC, int8_t)        \
+  INSTANTIATE(SRC, uint16_t)      \
+  INSTANTIATE(SRC, int16_t)       \
+  INSTANTIATE(SRC, uint32_t)      \
+  INSTANTIATE(SRC, int32_t)       \
+  INSTANTIATE(SRC, uint64_t)      \
+  INSTANTIATE(SRC, int64_t)
+
+INSTANTIATE_ALL_DEST(uint8_t)
+INSTANTIATE_ALL_DEST(int8_t)
+INSTANTIATE_ALL_DEST(uint16_t)
+INSTANTIATE_ALL_DEST(int16_t)
+INSTANTIATE_ALL_DEST(int32_t)
+
+#undef INSTANTIATE
+#undef INSTANTIATE_ALL_DEST
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,39 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+namespace arrow {
+namespace internal {
+
+// Whether TransposeIntsAvx2 is implemented for the input type: the indices must
+// widen to the 32-bit lanes of the AVX2 gathers
+template <typename InputInt>
+struct HasTransposeIntsAvx2
+    : std::integral_constant<bool, (sizeof(InputInt) < sizeof(int32_t) ||
+                                    std::is_same<InputInt, int32_t>::value)> {};
+
+// TransposeInts, looking up the transpose map with AVX2 gathers
+template <typename InputInt, typename OutputInt>
+void TransposeIntsAvx2(const InputInt* src, OutputInt* dest, int64_t length,
+                       const int32_t* transpose_map);
+
+}  // namespace internal
+}  // namespace arrow
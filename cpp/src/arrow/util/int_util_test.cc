@@ -388,6 +388,35 @@ TEST(TransposeInts, Int8ToInt64) {
   ASSERT_EQ(dest, std::vector<int64_t>({2222, 4444, 6666, 1111, 4444, 3333}));
 }
 
+template <typename InputInt, typename OutputInt>
+void CheckTransposeInts() {
+  // Exercise both the vectorized loop and the trailing values
+  std::vector<int32_t> transpose_map(100);
+  for (int32_t i = 0; i < 100; ++i) {
+    transpose_map[i] = 99 - i;
+  }
+  for (int64_t length = 0; length < 40; ++length) {
+    std::vector<InputInt> src(length);
+    std::vector<OutputInt> expected(length);
+    for (int64_t i = 0; i < length; ++i) {
+      src[i] = static_cast<InputInt>((i * 7) % 100);
+      expected[i] = static_cast<OutputInt>(99 - src[i]);
+    }
+    std::vector<OutputInt> dest(length);
+    TransposeInts(src.data(), dest.data(), length, transpose_map.data());
+    ASSERT_EQ(dest, expected);
+  }
+}
+
+TEST(TransposeInts, Lengths) {
+  CheckTransposeInts<uint8_t, int64_t>();
+  CheckTransposeInts<int8_t, int8_t>();
+  CheckTransposeInts<uint16_t, uint32_t>();
+  CheckTransposeInts<int16_t, int16_t>();
+  CheckTransposeInts<int32_t, int32_t>();
+  CheckTransposeInts<int64_t, uint8_t>();
+}
+
 void BoundsCheckPasses(const std::shared_ptr<DataType>& type,
                        const std::string& indices_json, uint64_t upper_limit) {
   auto indices = ArrayFromJSON(type, indices_json);
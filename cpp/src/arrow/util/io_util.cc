@@ -42,6 +42,7 @@
 #include <cstring>
 #include <iostream>
 #include <mutex>
+#include <numeric>
 #include <random>
 #include <sstream>
 #include <string>
@@ -109,6 +110,9 @@
 
 #elif __linux__
 #include <fstream>
+
+#include <sched.h>
+#include <sys/syscall.h>
 #endif
 
 namespace arrow {
@@ -1477,6 +1481,25 @@ Status MemoryAdviseWillNeed(const std::vector<MemoryRegion>& regions) {
 #endif
 }
 
+Status MemoryAdviseSequential(const MemoryRegion& region) {
+#if !defined(_WIN32) && defined(POSIX_MADV_SEQUENTIAL)
+  if (region.size == 0) {
+    return Status::OK();
+  }
+  const auto page_size = static_cast<uintptr_t>(GetPageSize());
+  const auto addr = reinterpret_cast<uintptr_t>(region.addr);
+  const auto aligned_addr = addr & ~(page_size - 1);
+  int err = posix_madvise(reinterpret_cast<void*>(aligned_addr),
+                          region.size + static_cast<size_t>(addr - aligned_addr),
+                          POSIX_MADV_SEQUENTIAL);
+  // See MemoryAdviseWillNeed() for EBADF
+  if (err != 0 && err != EBADF) {
+    return IOErrorFromErrno(err, "posix_madvise failed");
+  }
+#endif
+  return Status::OK();
+}
+
 //
 // Closing files
 //
@@ -2107,5 +2130,123 @@ int64_t GetCurrentRSS() {
 #endif
 }
 
+#ifdef __linux__
+namespace {
+
+// Parse a CPU or node list of the Linux sysfs such as "0-3,8,10-11"
+std::vector<int> ParseSysfsList(const std::string& list) {
+  std::vector<int> out;
+  std::stringstream ss(list);
+  std::string range;
+  while (std::getline(ss, range, ',')) {
+    int first, last;
+    const auto dash = range.find('-');
+    try {
+      first = std::stoi(range.substr(0, dash));
+      last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+    } catch (const std::exception&) {
+      continue;
+    }
+    for (int i = first; i <= last; ++i) {
+      out.push_back(i);
+    }
+  }
+  return out;
+}
+
+}  // namespace
+#endif
+
+std::vector<std::vector<int>> GetNumaNodeCpus() {
+#ifdef __linux__
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  const bool have_allowed = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+  std::vector<std::vector<int>> nodes;
+  std::string online;
+  std::ifstream online_file("/sys/devices/system/node/online");
+  if (std::getline(online_file, online)) {
+    for (int node : ParseSysfsList(online)) {
+      std::ifstream cpulist_file("/sys/devices/system/node/node" + std::to_string(node) +
+                                 "/cpulist");
+      std::string cpulist;
+      if (!std::getline(cpulist_file, cpulist)) continue;
+      if (static_cast<int>(nodes.size()) <= node) {
+        nodes.resize(node + 1);
+      }
+      for (int cpu : ParseSysfsList(cpulist)) {
+        if (!have_allowed || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed))) {
+          nodes[node].push_back(cpu);
+        }
+      }
+    }
+  }
+  if (!nodes.empty()) {
+    return nodes;
+  }
+#endif
+  std::vector<int> cpus(std::max(1U, std::thread::hardware_concurrency()));
+  std::iota(cpus.begin(), cpus.end(), 0);
+  return {std::move(cpus)};
+}
+
+int GetCurrentNumaNode() {
+#if defined(__linux__) && defined(SYS_getcpu)
+  unsigned cpu, node;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return static_cast<int>(node);
+  }
+#endif
+  return -1;
+}
+
+Status SetCurrentThreadAffinity(const std::vector<int>& cpus) {
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu : cpus) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+      return Status::Invalid("Invalid CPU number: ", cpu);
+    }
+    CPU_SET(cpu, &set);
+  }
+  if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+    return IOErrorFromErrno(errno, "Failed to set thread affinity");
+  }
+  return Status::OK();
+#else
+  return Status::NotImplemented("Setting thread affinity on this platform");
+#endif
+}
+
+Status BindMemoryToNumaNode(const void* addr, int64_t size, int node) {
+#if defined(__linux__) && defined(SYS_mbind)
+  // From <numaif.h>, which is not always installed
+  constexpr int kMpolPreferred = 1;
+  constexpr int kBitsPerWord = 8 * sizeof(unsigned long);  // NOLINT runtime/int
+
+  if (node < 0) {
+    return Status::Invalid("Invalid NUMA node: ", node);
+  }
+  const auto page_size = static_cast<uintptr_t>(GetPageSize());
+  const auto begin = reinterpret_cast<uintptr_t>(addr);
+  const uintptr_t first_page = (begin + page_size - 1) & ~(page_size - 1);
+  const uintptr_t last_page = (begin + static_cast<uintptr_t>(size)) & ~(page_size - 1);
+  if (first_page >= last_page) {
+    return Status::OK();
+  }
+  std::vector<unsigned long> node_mask(node / kBitsPerWord + 1);  // NOLINT runtime/int
+  node_mask[node / kBitsPerWord] = 1UL << (node % kBitsPerWord);
+  if (syscall(SYS_mbind, first_page, last_page - first_page, kMpolPreferred,
+              node_mask.data(), node_mask.size() * kBitsPerWord + 1, 0) != 0) {
+    return IOErrorFromErrno(errno, "Failed to bind memory to NUMA node ", node);
+  }
+  return Status::OK();
+#else
+  return Status::NotImplemented("Binding memory to NUMA nodes on this platform");
+#endif
+}
+
 }  // namespace internal
 }  // namespace arrow
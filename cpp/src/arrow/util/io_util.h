@@ -236,6 +236,10 @@ Status MemoryMapRemap(void* addr, size_t old_size, size_t new_size, int fildes,
                       void** new_addr);
 ARROW_EXPORT
 Status MemoryAdviseWillNeed(const std::vector<MemoryRegion>& regions);
+/// Advise the OS that the given region will be accessed sequentially, enabling
+/// aggressive read-ahead (no-op where unsupported)
+ARROW_EXPORT
+Status MemoryAdviseSequential(const MemoryRegion& region);
 
 ARROW_EXPORT
 Result<std::string> GetEnvVar(const char* name);
@@ -410,5 +414,31 @@ uint64_t GetThreadId();
 ARROW_EXPORT
 int64_t GetCurrentRSS();
 
+/// \brief Get the CPUs of each NUMA node, indexed by node id
+///
+/// Only CPUs the current process may run on are listed, such that some nodes may
+/// have no CPUs.  Where NUMA information is unavailable (i.e. outside of Linux), a
+/// single node with all CPUs is returned.
+ARROW_EXPORT
+std::vector<std::vector<int>> GetNumaNodeCpus();
+
+/// \brief Get the NUMA node of the CPU the current thread runs on, or -1 if unknown
+ARROW_EXPORT
+int GetCurrentNumaNode();
+
+/// \brief Restrict the current thread to run on the given CPUs
+///
+/// This function is only supported on Linux.
+ARROW_EXPORT
+Status SetCurrentThreadAffinity(const std::vector<int>& cpus);
+
+/// \brief Prefer allocating the physical pages of a memory range on a NUMA node
+///
+/// Only the pages lying entirely within the range are affected, and only when they
+/// are first touched: pages already backed by physical memory are not moved.
+/// This function is only supported on Linux.
+ARROW_EXPORT
+Status BindMemoryToNumaNode(const void* addr, int64_t size, int node);
+
 }  // namespace internal
 }  // namespace arrow
@@ -1023,6 +1023,56 @@ TEST(Memory, GetRSS) {
 #endif
 }
 
+TEST(Numa, NodeCpus) {
+  const auto nodes = GetNumaNodeCpus();
+  ASSERT_FALSE(nodes.empty());
+  int64_t num_cpus = 0;
+  for (const auto& cpus : nodes) {
+    num_cpus += static_cast<int64_t>(cpus.size());
+    for (int cpu : cpus) {
+      ASSERT_GE(cpu, 0);
+    }
+  }
+  ASSERT_GT(num_cpus, 0);
+  ASSERT_LT(GetCurrentNumaNode(), static_cast<int>(nodes.size()));
+}
+
+TEST(Numa, ThreadAffinity) {
+  const auto nodes = GetNumaNodeCpus();
+  std::vector<int> all_cpus;
+  for (const auto& cpus : nodes) {
+    all_cpus.insert(all_cpus.end(), cpus.begin(), cpus.end());
+  }
+  // Run in a separate thread so as not to affect the other tests
+  std::thread thread([&] {
+#ifdef __linux__
+    ASSERT_OK(SetCurrentThreadAffinity({all_cpus.front()}));
+    ASSERT_OK(SetCurrentThreadAffinity(all_cpus));
+    ASSERT_RAISES(Invalid, SetCurrentThreadAffinity({-1}));
+#else
+    ASSERT_RAISES(NotImplemented, SetCurrentThreadAffinity(all_cpus));
+#endif
+  });
+  thread.join();
+}
+
+TEST(Numa, BindMemory) {
+  std::vector<uint8_t> data(1 << 20);
+#ifdef __linux__
+  // May be forbidden in containers
+  Status st = BindMemoryToNumaNode(data.data(), static_cast<int64_t>(data.size()), 0);
+  if (!st.ok()) {
+    GTEST_SKIP() << "mbind() not permitted: " << st.ToString();
+  }
+  // Ranges not covering a whole page are accepted and left alone
+  ASSERT_OK(BindMemoryToNumaNode(data.data() + 1, 10, 0));
+  ASSERT_RAISES(Invalid, BindMemoryToNumaNode(data.data(), 10, -1));
+#else
+  ASSERT_RAISES(NotImplemented,
+                BindMemoryToNumaNode(data.data(), static_cast<int64_t>(data.size()), 0));
+#endif
+}
+
 // Some loose tests to check if the cpuinfo makes sense
 TEST(CpuInfo, Basic) {
   const CpuInfo* ci = CpuInfo::GetInstance();
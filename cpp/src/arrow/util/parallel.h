@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -61,6 +62,18 @@ Future<std::vector<R>> ParallelForAsync(
       });
 }
 
+// Whether `num_tasks` tasks amounting to `work_size` units of work are worth
+// spreading over the CPU thread pool from the calling thread. Work smaller than
+// `min_work_size` doesn't amortize the task overhead, and a worker thread of the
+// pool shouldn't block waiting for other tasks of the pool (which may deadlock
+// once every worker is waiting).
+inline bool ShouldUseCpuThreadPool(int num_tasks, int64_t work_size,
+                                   int64_t min_work_size) {
+  return num_tasks > 1 && work_size >= min_work_size &&
+         ::arrow::GetCpuThreadPoolCapacity() > 1 &&
+         !GetCpuThreadPool()->OwnsThisThread();
+}
+
 // A parallelizer that takes a `Status(int)` function and calls it with
 // arguments between 0 and `num_tasks - 1`, in sequence or in parallel,
 // depending on the input boolean.
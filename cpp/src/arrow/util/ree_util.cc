@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/ree_util.h"
+
+namespace arrow {
+namespace ree_util {
+
+namespace {
+
+template <typename RunEndCType>
+int64_t FindPhysicalOffsetImpl(const ArraySpan& span) {
+  return FindPhysicalIndex(RunEnds<RunEndCType>(span), RunEndsArray(span).length,
+                           span.offset);
+}
+
+template <typename RunEndCType>
+int64_t FindPhysicalLengthImpl(const ArraySpan& span) {
+  if (span.length == 0) {
+    return 0;
+  }
+  const RunEndCType* run_ends = RunEnds<RunEndCType>(span);
+  const int64_t num_run_ends = RunEndsArray(span).length;
+  const int64_t physical_offset = FindPhysicalIndex(run_ends, num_run_ends, span.offset);
+  // The run containing the last logical element
+  const int64_t physical_last =
+      FindPhysicalIndex(run_ends + physical_offset, num_run_ends - physical_offset,
+                        span.offset + span.length - 1) +
+      physical_offset;
+  return physical_last - physical_offset + 1;
+}
+
+template <typename RunEndCType>
+int64_t FindPhysicalIndexImpl(const ArraySpan& span, int64_t logical_index) {
+  return FindPhysicalIndex(RunEnds<RunEndCType>(span), RunEndsArray(span).length,
+                           span.offset + logical_index);
+}
+
+}  // namespace
+
+int64_t FindPhysicalIndex(const ArraySpan& span, int64_t logical_index) {
+  switch (RunEndsArray(span).type->id()) {
+    case Type::INT16:
+      return FindPhysicalIndexImpl<int16_t>(span, logical_index);
+    case Type::INT32:
+      return FindPhysicalIndexImpl<int32_t>(span, logical_index);
+    default:
+      DCHECK_EQ(RunEndsArray(span).type->id(), Type::INT64);
+      return FindPhysicalIndexImpl<int64_t>(span, logical_index);
+  }
+}
+
+int64_t FindPhysicalOffset(const ArraySpan& span) {
+  switch (RunEndsArray(span).type->id()) {
+    case Type::INT16:
+      return FindPhysicalOffsetImpl<int16_t>(span);
+    case Type::INT32:
+      return FindPhysicalOffsetImpl<int32_t>(span);
+    default:
+      DCHECK_EQ(RunEndsArray(span).type->id(), Type::INT64);
+      return FindPhysicalOffsetImpl<int64_t>(span);
+  }
+}
+
+int64_t FindPhysicalLength(const ArraySpan& span) {
+  switch (RunEndsArray(span).type->id()) {
+    case Type::INT16:
+      return FindPhysicalLengthImpl<int16_t>(span);
+    case Type::INT32:
+      return FindPhysicalLengthImpl<int32_t>(span);
+    default:
+      DCHECK_EQ(RunEndsArray(span).type->id(), Type::INT64);
+      return FindPhysicalLengthImpl<int64_t>(span);
+  }
+}
+
+}  // namespace ree_util
+}  // namespace arrow
@@ -0,0 +1,165 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Helpers for working with run-end encoded array data
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include "arrow/array/data.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace ree_util {
+
+/// \brief Get the child array holding the run ends from an REE array
+inline const ArraySpan& RunEndsArray(const ArraySpan& span) { return span.child_data[0]; }
+
+/// \brief Get the child array holding the data values from an REE array
+inline const ArraySpan& ValuesArray(const ArraySpan& span) { return span.child_data[1]; }
+
+/// \brief Get a pointer to the run ends of an REE array
+///
+/// The offset of the run ends child is applied, the logical offset of the
+/// REE array itself is not.
+template <typename RunEndCType>
+const RunEndCType* RunEnds(const ArraySpan& span) {
+  DCHECK_EQ(RunEndsArray(span).type->id(), CTypeTraits<RunEndCType>::ArrowType::type_id);
+  return RunEndsArray(span).GetValues<RunEndCType>(1);
+}
+
+/// \brief Find the index of the run that contains the given logical index
+///
+/// run_ends must be sorted in strictly increasing order and the logical
+/// index is relative to the start of run_ends (i.e. the array offset must
+/// already be added).
+template <typename RunEndCType>
+int64_t FindPhysicalIndex(const RunEndCType* run_ends, int64_t run_ends_size,
+                          int64_t logical_index) {
+  auto it = std::upper_bound(run_ends, run_ends + run_ends_size,
+                             static_cast<RunEndCType>(logical_index));
+  return static_cast<int64_t>(it - run_ends);
+}
+
+/// \brief Find the index of the run containing the given logical index,
+/// which is relative to the array offset
+ARROW_EXPORT int64_t FindPhysicalIndex(const ArraySpan& span, int64_t logical_index);
+
+/// \brief Find the physical index of the first run overlapping the logical
+/// range of the array, the logical offset taken into account
+ARROW_EXPORT int64_t FindPhysicalOffset(const ArraySpan& span);
+
+/// \brief Find the number of runs overlapping the logical range of the array
+ARROW_EXPORT int64_t FindPhysicalLength(const ArraySpan& span);
+
+/// \brief Iterate over the runs of an REE array restricted to its logical
+/// range, calling `visit(logical_begin, run_length, physical_index)` for every
+/// run. Logical positions are relative to the array offset. The visitor
+/// returns a Status; iteration stops at the first error.
+template <typename RunEndCType, typename Visitor>
+Status VisitRuns(const ArraySpan& span, Visitor&& visit) {
+  const RunEndCType* run_ends = RunEnds<RunEndCType>(span);
+  const int64_t num_run_ends = RunEndsArray(span).length;
+  const int64_t offset = span.offset;
+  const int64_t end = span.offset + span.length;
+  int64_t logical_pos = offset;
+  for (int64_t i = FindPhysicalIndex(run_ends, num_run_ends, offset); logical_pos < end;
+       ++i) {
+    DCHECK_LT(i, num_run_ends);
+    const int64_t run_end = std::min<int64_t>(run_ends[i], end);
+    ARROW_RETURN_NOT_OK(visit(logical_pos - offset, run_end - logical_pos, i));
+    logical_pos = run_end;
+  }
+  return Status::OK();
+}
+
+/// \brief Like VisitRuns, dispatching on the run end type of the array
+template <typename Visitor>
+Status VisitRuns(const ArraySpan& span, Visitor&& visit) {
+  switch (RunEndsArray(span).type->id()) {
+    case Type::INT16:
+      return VisitRuns<int16_t>(span, std::forward<Visitor>(visit));
+    case Type::INT32:
+      return VisitRuns<int32_t>(span, std::forward<Visitor>(visit));
+    default:
+      DCHECK_EQ(RunEndsArray(span).type->id(), Type::INT64);
+      return VisitRuns<int64_t>(span, std::forward<Visitor>(visit));
+  }
+}
+
+/// \brief Iterate over the runs two REE arrays of the same logical length
+/// have in common, calling `visit(logical_begin, run_length, left_physical_index,
+/// right_physical_index)` for every maximal segment over which neither side
+/// changes run.
+template <typename Visitor>
+Status VisitMergedRuns(const ArraySpan& left, const ArraySpan& right, Visitor&& visit) {
+  DCHECK_EQ(left.length, right.length);
+  // Both sides are walked in lockstep, stepping whichever run ends first
+  struct Cursor {
+    const ArraySpan& span;
+    int64_t physical_index;
+    int64_t run_end;  // relative to the array offset
+
+    explicit Cursor(const ArraySpan& span)
+        : span(span), physical_index(FindPhysicalOffset(span)), run_end(0) {
+      if (span.length > 0) {
+        run_end = RunEndAt(physical_index) - span.offset;
+      }
+    }
+
+    int64_t RunEndAt(int64_t i) const {
+      const ArraySpan& run_ends = RunEndsArray(span);
+      switch (run_ends.type->id()) {
+        case Type::INT16:
+          return run_ends.GetValues<int16_t>(1)[i];
+        case Type::INT32:
+          return run_ends.GetValues<int32_t>(1)[i];
+        default:
+          return run_ends.GetValues<int64_t>(1)[i];
+      }
+    }
+
+    void Advance(int64_t logical_pos) {
+      if (logical_pos == run_end && logical_pos < span.length) {
+        ++physical_index;
+        run_end = RunEndAt(physical_index) - span.offset;
+      }
+    }
+  };
+
+  Cursor l(left), r(right);
+  int64_t logical_pos = 0;
+  while (logical_pos < left.length) {
+    const int64_t segment_end = std::min({l.run_end, r.run_end, left.length});
+    ARROW_RETURN_NOT_OK(
+        visit(logical_pos, segment_end - logical_pos, l.physical_index, r.physical_index));
+    logical_pos = segment_end;
+    l.Advance(logical_pos);
+    r.Advance(logical_pos);
+  }
+  return Status::OK();
+}
+
+}  // namespace ree_util
+}  // namespace arrow
@@ -136,6 +136,40 @@ TEST(BitArray, TestValues) {
   }
 }
 
+// Writes 'num_vals' random values with width 'bit_width' and reads them back
+// in a batch of 64-bit integers.
+void TestBitArrayBatchValues64(int bit_width, int num_vals) {
+  int len = static_cast<int>(bit_util::BytesForBits(bit_width * num_vals));
+  const uint64_t mask = bit_width == 64 ? ~uint64_t(0) : (uint64_t(1) << bit_width) - 1;
+
+  std::default_random_engine gen(bit_width);
+  std::uniform_int_distribution<uint64_t> dist;
+  std::vector<uint64_t> values(num_vals);
+  // BitWriter only supports up to 32 bits, so pack the values by hand
+  std::vector<uint8_t> buffer(len);
+  int64_t bit_offset = 0;
+  for (auto& value : values) {
+    value = dist(gen) & mask;
+    for (int bit = 0; bit < bit_width; ++bit) {
+      bit_util::SetBitTo(buffer.data(), bit_offset++, (value >> bit) & 1);
+    }
+  }
+
+  bit_util::BitReader reader(buffer.data(), len);
+  std::vector<uint64_t> read_values(num_vals);
+  ASSERT_EQ(reader.GetBatch(bit_width, read_values.data(), num_vals), num_vals);
+  ASSERT_EQ(read_values, values);
+}
+
+TEST(BitArray, TestBatchValues64) {
+  for (int width = 1; width <= 64; ++width) {
+    TestBitArrayBatchValues64(width, 1);
+    TestBitArrayBatchValues64(width, 31);
+    TestBitArrayBatchValues64(width, 1024);
+    TestBitArrayBatchValues64(width, 1027);
+  }
+}
+
 // Test some mixed values
 TEST(BitArray, TestMixed) {
   const int len = 1024;
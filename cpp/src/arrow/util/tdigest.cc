@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <limits>
 #include <queue>
@@ -37,6 +38,55 @@ namespace {
 // but we are *approximating* the quantile, so let's keep it simple
 double Lerp(double a, double b, double t) { return a + t * (b - a); }
 
+// minimal input size sorted with RadixSort rather than std::sort
+constexpr size_t kRadixSortMinSize = 128;
+
+// sort data points (without NAN) with a LSD radix sort, one byte per pass, on their bit
+// patterns mapped to unsigned integers of the same order
+// passes on bytes shared by all data points, such as the sign and exponent bytes of
+// data points of similar magnitude, are skipped
+void RadixSort(std::vector<double>* values) {
+  constexpr uint64_t kSignBit = uint64_t(1) << 63;
+  const size_t n = values->size();
+  std::vector<uint64_t> keys(n), scratch(n);
+  uint32_t counts[8][256] = {};
+  for (size_t i = 0; i < n; ++i) {
+    uint64_t bits;
+    std::memcpy(&bits, &(*values)[i], sizeof(bits));
+    bits ^= (bits & kSignBit) ? ~uint64_t(0) : kSignBit;
+    keys[i] = bits;
+    for (int byte = 0; byte < 8; ++byte) {
+      ++counts[byte][(bits >> (8 * byte)) & 0xff];
+    }
+  }
+
+  uint64_t* in = keys.data();
+  uint64_t* out = scratch.data();
+  for (int byte = 0; byte < 8; ++byte) {
+    const int shift = 8 * byte;
+    uint32_t* offsets = counts[byte];
+    if (offsets[(in[0] >> shift) & 0xff] == n) {
+      continue;
+    }
+    uint32_t sum = 0;
+    for (int digit = 0; digit < 256; ++digit) {
+      const uint32_t count = offsets[digit];
+      offsets[digit] = sum;
+      sum += count;
+    }
+    for (size_t i = 0; i < n; ++i) {
+      out[offsets[(in[i] >> shift) & 0xff]++] = in[i];
+    }
+    std::swap(in, out);
+  }
+
+  for (size_t i = 0; i < n; ++i) {
+    uint64_t bits = in[i];
+    bits ^= (bits & kSignBit) ? kSignBit : ~uint64_t(0);
+    std::memcpy(&(*values)[i], &bits, sizeof(bits));
+  }
+}
+
 // histogram bin
 struct Centroid {
   double mean;
@@ -133,8 +183,6 @@ class TDigest::TDigestImpl {
  public:
   explicit TDigestImpl(uint32_t delta)
       : delta_(delta > 10 ? delta : 10), merger_(delta_) {
-    tdigests_[0].reserve(delta_);
-    tdigests_[1].reserve(delta_);
     Reset();
   }
 
@@ -186,6 +234,11 @@ class TDigest::TDigestImpl {
 
   // merge with other tdigests
   void Merge(const std::vector<const TDigestImpl*>& tdigest_impls) {
+    if (tdigest_impls.size() == 1) {
+      Merge(*tdigest_impls[0]);
+      return;
+    }
+
     // current and end iterator
     using CentroidIter = std::vector<Centroid>::const_iterator;
     using CentroidIterPair = std::pair<CentroidIter, CentroidIter>;
@@ -216,7 +269,7 @@ class TDigest::TDigestImpl {
       }
     }
 
-    merger_.Reset(total_weight_, &tdigests_[1 - current_]);
+    merger_.Reset(total_weight_, NextTDigest());
     CentroidIter current_iter, end_iter;
     // do k-way merge till one buffer left
     while (queue.size() > 1) {
@@ -239,16 +292,51 @@ class TDigest::TDigestImpl {
     current_ = 1 - current_;
   }
 
+  // merge with another tdigest, as a plain two-way merge
+  void Merge(const TDigestImpl& other) {
+    const auto& td = tdigests_[current_];
+    const auto& other_td = other.tdigests_[other.current_];
+    if (other_td.size() == 0) {
+      return;
+    }
+    total_weight_ += other.total_weight_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+
+    merger_.Reset(total_weight_, NextTDigest());
+    size_t index = 0, other_index = 0;
+    while (index < td.size() && other_index < other_td.size()) {
+      if (other_td[other_index].mean < td[index].mean) {
+        merger_.Add(other_td[other_index++]);
+      } else {
+        merger_.Add(td[index++]);
+      }
+    }
+    while (index < td.size()) {
+      merger_.Add(td[index++]);
+    }
+    while (other_index < other_td.size()) {
+      merger_.Add(other_td[other_index++]);
+    }
+    merger_.Reset(0, nullptr);
+
+    current_ = 1 - current_;
+  }
+
   // merge input data with current tdigest
   void MergeInput(std::vector<double>& input) {
     total_weight_ += input.size();
 
-    std::sort(input.begin(), input.end());
+    if (input.size() >= kRadixSortMinSize) {
+      RadixSort(&input);
+    } else {
+      std::sort(input.begin(), input.end());
+    }
     min_ = std::min(min_, input.front());
     max_ = std::max(max_, input.back());
 
     // pick next minimal centroid from input and tdigest, feed to merger
-    merger_.Reset(total_weight_, &tdigests_[1 - current_]);
+    merger_.Reset(total_weight_, NextTDigest());
     const auto& td = tdigests_[current_];
     uint32_t tdigest_index = 0, input_index = 0;
     while (tdigest_index < td.size() && input_index < input.size()) {
@@ -341,6 +429,14 @@ class TDigest::TDigestImpl {
   double total_weight() const { return total_weight_; }
 
  private:
+  // the inactive buffer, to merge into; buffers are allocated on first use so that
+  // many small tdigests stay compact
+  std::vector<Centroid>* NextTDigest() {
+    auto* td = &tdigests_[1 - current_];
+    td->reserve(delta_);
+    return td;
+  }
+
   // must be delcared before merger_, see constructor initialization list
   const uint32_t delta_;
 
@@ -354,8 +450,8 @@ class TDigest::TDigestImpl {
   int current_;
 };
 
-TDigest::TDigest(uint32_t delta, uint32_t buffer_size) : impl_(new TDigestImpl(delta)) {
-  input_.reserve(buffer_size);
+TDigest::TDigest(uint32_t delta, uint32_t buffer_size)
+    : buffer_size_(buffer_size > 0 ? buffer_size : 1), impl_(new TDigestImpl(delta)) {
   Reset();
 }
 
@@ -378,22 +474,44 @@ void TDigest::Dump() const {
   impl_->Dump();
 }
 
-void TDigest::Merge(const std::vector<TDigest>& others) {
-  MergeInput();
+void TDigest::Add(const double* values, int64_t length) {
+  while (length > 0) {
+    if (input_.size() == buffer_size_) {
+      MergeInput();
+    }
+    const int64_t batch_size =
+        std::min(length, static_cast<int64_t>(buffer_size_ - input_.size()));
+    input_.insert(input_.end(), values, values + batch_size);
+    values += batch_size;
+    length -= batch_size;
+  }
+}
 
+void TDigest::Merge(const std::vector<TDigest>& others) {
   std::vector<const TDigestImpl*> other_impls;
   other_impls.reserve(others.size());
   for (auto& other : others) {
-    other.MergeInput();
-    other_impls.push_back(other.impl_.get());
+    if (other.impl_->total_weight() == 0) {
+      Add(other.input_.data(), static_cast<int64_t>(other.input_.size()));
+    } else {
+      other.MergeInput();
+      other_impls.push_back(other.impl_.get());
+    }
+  }
+  MergeInput();
+  if (!other_impls.empty()) {
+    impl_->Merge(other_impls);
   }
-  impl_->Merge(other_impls);
 }
 
 void TDigest::Merge(const TDigest& other) {
+  if (other.impl_->total_weight() == 0) {
+    Add(other.input_.data(), static_cast<int64_t>(other.input_.size()));
+    return;
+  }
   MergeInput();
   other.MergeInput();
-  impl_->Merge({other.impl_.get()});
+  impl_->Merge(*other.impl_);
 }
 
 double TDigest::Quantile(double q) const {
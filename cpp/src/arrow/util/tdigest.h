@@ -22,7 +22,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -57,12 +59,16 @@ class ARROW_EXPORT TDigest {
   // call it only if you are sure no NAN exists in input data
   void Add(double value) {
     DCHECK(!std::isnan(value)) << "cannot add NAN";
-    if (ARROW_PREDICT_FALSE(input_.size() == input_.capacity())) {
+    if (ARROW_PREDICT_FALSE(input_.size() == buffer_size_)) {
       MergeInput();
     }
     input_.push_back(value);
   }
 
+  // buffer a batch of data points, consume internal buffer whenever full
+  // call it only if you are sure no NAN exists in input data
+  void Add(const double* values, int64_t length);
+
   // skip NAN on adding
   template <typename T>
   typename std::enable_if<std::is_floating_point<T>::value>::type NanAdd(T value) {
@@ -74,7 +80,31 @@ class ARROW_EXPORT TDigest {
     Add(static_cast<double>(value));
   }
 
+  // buffer a batch of data points, skipping NAN
+  template <typename T>
+  void NanAdd(const T* values, int64_t length) {
+    while (length > 0) {
+      if (input_.size() == buffer_size_) {
+        MergeInput();
+      }
+      const size_t size = input_.size();
+      const int64_t batch_size =
+          std::min(length, static_cast<int64_t>(buffer_size_ - size));
+      input_.resize(size + batch_size);
+      double* out = input_.data() + size;
+      int64_t out_size = 0;
+      for (int64_t i = 0; i < batch_size; ++i) {
+        out[out_size] = static_cast<double>(values[i]);
+        out_size += !std::isnan(out[out_size]);
+      }
+      input_.resize(size + out_size);
+      values += batch_size;
+      length -= batch_size;
+    }
+  }
+
   // merge with other t-digests, called infrequently
+  // t-digests which only buffered input data (e.g. of small groups) are merged as input
   void Merge(const std::vector<TDigest>& others);
   void Merge(const TDigest& other);
 
@@ -92,7 +122,9 @@ class ARROW_EXPORT TDigest {
   // merge input data with current tdigest
   void MergeInput() const;
 
-  // input buffer, size = buffer_size * sizeof(double)
+  // input buffer, grows up to buffer_size_ data points on demand so that many small
+  // t-digests stay compact
+  uint32_t buffer_size_;
   mutable std::vector<double> input_;
 
   // hide other members with pimpl
@@ -42,7 +42,51 @@ static void BenchmarkTDigest(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * items);
 }
 
+static void BenchmarkTDigestBatch(benchmark::State& state) {
+  const size_t items = state.range(0);
+  std::vector<double> values;
+  random_real(items, 0x11223344, -12345678.0, 12345678.0, &values);
+
+  for (auto _ : state) {
+    arrow::internal::TDigest td(kDelta, kBufferSize);
+    td.NanAdd(values.data(), static_cast<int64_t>(values.size()));
+    benchmark::DoNotOptimize(td.Quantile(0));
+  }
+  state.SetItemsProcessed(state.iterations() * items);
+}
+
+// A group by with many groups, each with a few data points: values are added to one
+// tdigest per group, in two thread-local states which are then merged
+static void BenchmarkTDigestGroupBy(benchmark::State& state) {
+  const size_t items = 1 << 20;
+  const int64_t num_groups = state.range(0);
+  std::vector<double> values;
+  random_real(items, 0x11223344, -12345678.0, 12345678.0, &values);
+  std::vector<int64_t> groups;
+  randint(items, int64_t(0), num_groups - 1, &groups);
+
+  for (auto _ : state) {
+    std::vector<arrow::internal::TDigest> states[2];
+    for (auto& tdigests : states) {
+      tdigests.reserve(num_groups);
+      for (int64_t g = 0; g < num_groups; ++g) {
+        tdigests.emplace_back(kDelta, kBufferSize);
+      }
+    }
+    for (size_t i = 0; i < items; ++i) {
+      states[i % 2][groups[i]].Add(values[i]);
+    }
+    for (int64_t g = 0; g < num_groups; ++g) {
+      states[0][g].Merge(states[1][g]);
+      benchmark::DoNotOptimize(states[0][g].Quantile(0.5));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * items);
+}
+
 BENCHMARK(BenchmarkTDigest)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BenchmarkTDigestBatch)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BenchmarkTDigestGroupBy)->Arg(1 << 4)->Arg(1 << 10)->Arg(1 << 16);
 
 }  // namespace util
 }  // namespace arrow
@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <numeric>
 #include <vector>
 
@@ -232,6 +233,64 @@ TEST(TDigestTest, MergeNonUniform) {
 #endif
 }
 
+TEST(TDigestTest, BatchAdd) {
+  std::vector<double> values;
+  random_real(10000, 0x11223344, -1000.0, 1000.0, &values);
+  values[0] = -0.0;
+  values[1] = 0.0;
+  values[2] = std::numeric_limits<double>::lowest();
+
+  // batches are buffered and merged exactly as single data points
+  TDigest td_single, td_batch, td_nan_batch;
+  std::vector<double> values_with_nan;
+  for (double value : values) {
+    td_single.Add(value);
+    values_with_nan.push_back(value);
+    values_with_nan.push_back(NAN);
+  }
+  td_batch.Add(values.data(), 1);
+  td_batch.Add(values.data() + 1, static_cast<int64_t>(values.size()) - 1);
+  td_nan_batch.NanAdd(values_with_nan.data(),
+                      static_cast<int64_t>(values_with_nan.size()));
+  ASSERT_OK(td_batch.Validate());
+  ASSERT_OK(td_nan_batch.Validate());
+  for (double q = 0; q <= 1; q += 0.05) {
+    EXPECT_EQ(td_single.Quantile(q), td_batch.Quantile(q)) << q;
+    EXPECT_EQ(td_single.Quantile(q), td_nan_batch.Quantile(q)) << q;
+  }
+
+  TDigest td_integer;
+  const std::vector<int32_t> integers = {5, -3, 8, 0};
+  td_integer.NanAdd(integers.data(), static_cast<int64_t>(integers.size()));
+  EXPECT_EQ(td_integer.Min(), -3);
+  EXPECT_EQ(td_integer.Max(), 8);
+}
+
+TEST(TDigestTest, MergeSmall) {
+  // tdigests of a few data points, as in a group by with many groups, are merged as
+  // buffered input data, as if the data points were added to a single tdigest
+  std::vector<TDigest> tds(100);
+  TDigest expected;
+  for (int i = 0; i < 100; ++i) {
+    tds[i].Add(i);
+    tds[i].Add(-i);
+    expected.Add(i);
+    expected.Add(-i);
+  }
+
+  TDigest td_vector, td_single;
+  td_vector.Merge(tds);
+  for (const auto& td : tds) {
+    td_single.Merge(td);
+  }
+  for (const TDigest* td : {&td_vector, &td_single}) {
+    ASSERT_OK(td->Validate());
+    for (double q = 0; q <= 1; q += 0.05) {
+      EXPECT_EQ(td->Quantile(q), expected.Quantile(q)) << q;
+    }
+  }
+}
+
 TEST(TDigestTest, Misc) {
   const size_t size = 100000;
   const double min = -1000, max = 1000;
@@ -18,9 +18,13 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
+#include <limits>
 #include <list>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -28,6 +32,7 @@
 
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
 #include "arrow/util/mutex.h"
 
 #include "arrow/util/tracing_internal.h"
@@ -50,6 +55,33 @@ struct Task {
   Executor::StopCallback stop_callback;
 };
 
+// Wrap the task to propagate a parent tracing span to it
+FnOnce<void()> WrapWithActiveSpan(FnOnce<void()> task) {
+#ifdef ARROW_WITH_OPENTELEMETRY
+  struct {
+    void operator()() {
+      auto scope = ::arrow::internal::tracing::GetTracer()->WithActiveSpan(activeSpan);
+      std::move(func)();
+    }
+    FnOnce<void()> func;
+    opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> activeSpan;
+  } wrapper{std::move(task), ::arrow::internal::tracing::GetTracer()->GetCurrentSpan()};
+  return std::move(wrapper);
+#else
+  return task;
+#endif
+}
+
+void RunTask(Task* task) {
+  if (!task->stop_token.IsStopRequested()) {
+    std::move(task->callable)();
+  } else {
+    if (task->stop_callback) {
+      std::move(task->stop_callback)(task->stop_token.Poll());
+    }
+  }
+}
+
 }  // namespace
 
 struct SerialExecutor::State {
@@ -194,7 +226,62 @@ struct ThreadPool::State {
   std::list<std::thread> workers_;
   // Trashcan for finished threads
   std::vector<std::thread> finished_workers_;
-  std::deque<Task> pending_tasks_;
+
+  // A task queue per TaskHints::priority
+  struct PriorityLevel {
+    std::deque<Task> tasks;
+    // Value of num_started_ when this level was last served or became non-empty
+    uint64_t last_served = 0;
+  };
+
+  // Run a level that was not served for this many task starts as if its priority
+  // was one more urgent, so that a stream of urgent tasks cannot starve the
+  // others indefinitely
+  static constexpr uint64_t kAgingInterval = 32;
+
+  // Pending tasks by priority
+  std::map<int32_t, PriorityLevel> pending_tasks_;
+  int64_t num_pending_ = 0;
+  // Number of tasks taken from pending_tasks_ so far
+  uint64_t num_started_ = 0;
+
+  void PushTaskUnlocked(int32_t priority, Task task) {
+    PriorityLevel& level = pending_tasks_[priority];
+    if (level.tasks.empty()) {
+      level.last_served = num_started_;
+    }
+    level.tasks.push_back(std::move(task));
+    ++num_pending_;
+  }
+
+  // Take the oldest task of the level with the most urgent priority once aged
+  Task PopTaskUnlocked() {
+    DCHECK_GT(num_pending_, 0);
+    auto best = pending_tasks_.end();
+    int64_t best_priority = std::numeric_limits<int64_t>::max();
+    for (auto it = pending_tasks_.begin(); it != pending_tasks_.end(); ++it) {
+      if (it->second.tasks.empty()) continue;
+      const auto age =
+          static_cast<int64_t>((num_started_ - it->second.last_served) / kAgingInterval);
+      const int64_t priority = static_cast<int64_t>(it->first) - age;
+      if (priority < best_priority) {
+        best = it;
+        best_priority = priority;
+      }
+    }
+    DCHECK(best != pending_tasks_.end());
+    PriorityLevel& level = best->second;
+    Task task = std::move(level.tasks.front());
+    level.tasks.pop_front();
+    level.last_served = ++num_started_;
+    // Keep the last level alive to avoid reallocating it in the common case
+    // where all tasks have the same priority
+    if (level.tasks.empty() && pending_tasks_.size() > 1) {
+      pending_tasks_.erase(best);
+    }
+    --num_pending_;
+    return task;
+  }
 
   // Desired number of threads
   int desired_capacity_ = 0;
@@ -230,7 +317,7 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
     // condition variable at the end of the loop.
 
     // Execute pending tasks if any
-    while (!state->pending_tasks_.empty() && !state->quick_shutdown_) {
+    while (state->num_pending_ > 0 && !state->quick_shutdown_) {
       // We check this opportunistically at each loop iteration since
       // it releases the lock below.
       if (should_secede()) {
@@ -239,8 +326,7 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
 
       DCHECK_GE(state->tasks_queued_or_running_, 0);
       {
-        Task task = std::move(state->pending_tasks_.front());
-        state->pending_tasks_.pop_front();
+        Task task = state->PopTaskUnlocked();
         StopToken* stop_token = &task.stop_token;
         lock.unlock();
         if (!stop_token->IsStopRequested()) {
@@ -345,7 +431,7 @@ Status ThreadPool::SetCapacity(int threads) {
 
   state_->desired_capacity_ = threads;
   // See if we need to increase or decrease the number of running threads
-  const int required = std::min(static_cast<int>(state_->pending_tasks_.size()),
+  const int required = std::min(static_cast<int>(state_->num_pending_),
                                 threads - static_cast<int>(state_->workers_.size()));
   if (required > 0) {
     // Some tasks are pending, spawn the number of needed threads immediately
@@ -387,9 +473,10 @@ Status ThreadPool::Shutdown(bool wait) {
   state_->cv_.notify_all();
   state_->cv_shutdown_.wait(lock, [this] { return state_->workers_.empty(); });
   if (!state_->quick_shutdown_) {
-    DCHECK_EQ(state_->pending_tasks_.size(), 0);
+    DCHECK_EQ(state_->num_pending_, 0);
   } else {
     state_->pending_tasks_.clear();
+    state_->num_pending_ = 0;
   }
   CollectFinishedWorkersUnlocked();
   return Status::OK();
@@ -424,22 +511,10 @@ Status ThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken sto
                              StopCallback&& stop_callback) {
   {
     ProtectAgainstFork();
-#ifdef ARROW_WITH_OPENTELEMETRY
-    // Wrap the task to propagate a parent tracing span to it
     // This task-wrapping needs to be done before we grab the mutex because the
     // first call to OT (whatever that happens to be) will attempt to grab this mutex
     // when calling KeepAlive to keep the OT infrastructure alive.
-    struct {
-      void operator()() {
-        auto scope = ::arrow::internal::tracing::GetTracer()->WithActiveSpan(activeSpan);
-        std::move(func)();
-      }
-      FnOnce<void()> func;
-      opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> activeSpan;
-    } wrapper{std::forward<FnOnce<void()>>(task),
-              ::arrow::internal::tracing::GetTracer()->GetCurrentSpan()};
-    task = std::move(wrapper);
-#endif
+    task = WrapWithActiveSpan(std::move(task));
     std::lock_guard<std::mutex> lock(state_->mutex_);
     if (state_->please_shutdown_) {
       return Status::Invalid("operation forbidden during or after shutdown");
@@ -451,8 +526,8 @@ Status ThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken sto
       // We can still spin up more workers so spin up a new worker
       LaunchWorkersUnlocked(/*threads=*/1);
     }
-    state_->pending_tasks_.push_back(
-        {std::move(task), std::move(stop_token), std::move(stop_callback)});
+    state_->PushTaskUnlocked(hints.priority, {std::move(task), std::move(stop_token),
+                                              std::move(stop_callback)});
   }
   state_->cv_.notify_one();
   return Status::OK();
@@ -535,6 +610,428 @@ ThreadPool* GetCpuThreadPool() {
   return singleton.get();
 }
 
+namespace {
+
+// A lock-free deque of tasks owned by a worker, after Chase and Lev, "Dynamic
+// Circular Work-Stealing Deque" (SPAA 2005).  The orderings follow Le et al.,
+// "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013), with
+// sequentially consistent accesses to top and bottom instead of fences, which
+// ThreadSanitizer does not understand.
+//
+// Only the owning worker may Push() and Pop(), at the bottom.  Other workers Steal()
+// from the top.
+class TaskDeque {
+ public:
+  TaskDeque() {
+    arrays_.emplace_back(new Array(kInitialCapacity));
+    array_.store(arrays_.back().get(), std::memory_order_relaxed);
+  }
+
+  ~TaskDeque() { Clear(); }
+
+  bool Empty() const {
+    const int64_t top = top_.load(std::memory_order_acquire);
+    return bottom_.load(std::memory_order_acquire) <= top;
+  }
+
+  void Push(std::unique_ptr<Task> task) {
+    const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    const int64_t top = top_.load(std::memory_order_acquire);
+    Array* array = array_.load(std::memory_order_relaxed);
+    if (bottom - top > array->mask()) {
+      array = Grow(array, top, bottom);
+    }
+    array->Put(bottom, task.release());
+    bottom_.store(bottom + 1, std::memory_order_release);
+  }
+
+  // Take the newest task, or null if the deque is empty
+  std::unique_ptr<Task> Pop() {
+    const int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Array* array = array_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_seq_cst);
+    int64_t top = top_.load(std::memory_order_seq_cst);
+    Task* task = nullptr;
+    if (top <= bottom) {
+      task = array->Get(bottom);
+      if (top == bottom) {
+        // Last task, race against thieves for it
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+          task = nullptr;
+        }
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+      }
+    } else {
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return std::unique_ptr<Task>(task);
+  }
+
+  // Take the oldest task, or null if the deque is empty or another worker took it
+  // meanwhile
+  std::unique_ptr<Task> Steal() {
+    int64_t top = top_.load(std::memory_order_seq_cst);
+    const int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+    if (top >= bottom) {
+      return nullptr;
+    }
+    Task* task = array_.load(std::memory_order_acquire)->Get(top);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return std::unique_ptr<Task>(task);
+  }
+
+  // Destroy all tasks, must not race with other operations
+  int64_t Clear() {
+    int64_t num_cleared = 0;
+    while (Pop() != nullptr) {
+      ++num_cleared;
+    }
+    return num_cleared;
+  }
+
+ private:
+  static constexpr int64_t kInitialCapacity = 256;
+
+  class Array {
+   public:
+    explicit Array(int64_t capacity)
+        : mask_(capacity - 1), slots_(new std::atomic<Task*>[capacity]) {}
+
+    int64_t mask() const { return mask_; }
+    Task* Get(int64_t i) const {
+      return slots_[i & mask_].load(std::memory_order_relaxed);
+    }
+    void Put(int64_t i, Task* task) {
+      slots_[i & mask_].store(task, std::memory_order_relaxed);
+    }
+
+   private:
+    const int64_t mask_;
+    std::unique_ptr<std::atomic<Task*>[]> slots_;
+  };
+
+  Array* Grow(Array* array, int64_t top, int64_t bottom) {
+    // Thieves may still read from the old array, which is only freed with the deque
+    arrays_.emplace_back(new Array(2 * (array->mask() + 1)));
+    Array* grown = arrays_.back().get();
+    for (int64_t i = top; i < bottom; ++i) {
+      grown->Put(i, array->Get(i));
+    }
+    array_.store(grown, std::memory_order_release);
+    return grown;
+  }
+
+  std::atomic<int64_t> top_{0};
+  std::atomic<int64_t> bottom_{0};
+  std::atomic<Array*> array_{nullptr};
+  // All arrays ever used, only accessed by the owner
+  std::vector<std::unique_ptr<Array>> arrays_;
+};
+
+constexpr int64_t TaskDeque::kInitialCapacity;
+
+}  // namespace
+
+struct WorkStealingThreadPool::State {
+  // Value of Queue::min_priority when the queue is empty
+  static constexpr int64_t kEmpty = std::numeric_limits<int64_t>::max();
+  // Priority of the tasks in the lock-free Queue::local deques
+  static constexpr int64_t kLocalPriority = 0;
+
+  struct Queue {
+    // Tasks of the default priority spawned by the worker itself, the common case
+    // for fine-grained tasks (parallel loops, future callbacks), need no locking
+    TaskDeque local;
+
+    std::mutex mutex;
+    // Other pending tasks by priority
+    std::map<int32_t, std::deque<Task>> tasks;
+    // Most urgent priority in `tasks`, readable without holding the mutex
+    std::atomic<int64_t> min_priority{kEmpty};
+  };
+
+  // Take a task from a queue's lock-free deque, the newest one if `lifo` is true
+  // (only allowed for the worker owning the queue) and the oldest one otherwise.
+  // Return false if the deque has been emptied meanwhile.
+  bool PopLocal(Queue* queue, bool lifo, Task* out) {
+    std::unique_ptr<Task> task = lifo ? queue->local.Pop() : queue->local.Steal();
+    if (task == nullptr) {
+      return false;
+    }
+    *out = std::move(*task);
+    --num_pending;
+    return true;
+  }
+
+  // Pop the most urgent task of a queue, the newest one if `lifo` is true and the
+  // oldest one otherwise.  Return false if the queue has been emptied meanwhile.
+  bool Pop(Queue* queue, bool lifo, Task* out) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    if (queue->tasks.empty()) {
+      return false;
+    }
+    auto it = queue->tasks.begin();
+    if (lifo) {
+      *out = std::move(it->second.back());
+      it->second.pop_back();
+    } else {
+      *out = std::move(it->second.front());
+      it->second.pop_front();
+    }
+    if (it->second.empty()) {
+      queue->tasks.erase(it);
+    }
+    queue->min_priority =
+        queue->tasks.empty() ? kEmpty : static_cast<int64_t>(queue->tasks.begin()->first);
+    --num_pending;
+    return true;
+  }
+
+  // Queue a task, `from_owner` telling whether this is called by the worker owning
+  // the queue
+  void Push(size_t index, bool from_owner, int32_t priority, Task task) {
+    Queue* queue = queues[index].get();
+    if (from_owner && priority == kLocalPriority) {
+      queue->local.Push(::arrow::internal::make_unique<Task>(std::move(task)));
+      ++num_pending;
+    } else {
+      std::lock_guard<std::mutex> lock(queue->mutex);
+      queue->tasks[priority].push_back(std::move(task));
+      if (priority < queue->min_priority.load()) {
+        queue->min_priority = priority;
+      }
+      ++num_pending;
+    }
+    if (num_sleeping.load() > 0) {
+      std::lock_guard<std::mutex> lock(mutex);
+      cv.notify_one();
+    }
+  }
+
+  // Take the most urgent task of all queues, preferring the worker's own queue
+  bool TryTake(size_t index, Task* out) {
+    size_t best = index;
+    bool best_local = false;
+    int64_t best_priority = kEmpty;
+    for (size_t victim : steal_orders[index]) {
+      const Queue& queue = *queues[victim];
+      if (kLocalPriority < best_priority && !queue.local.Empty()) {
+        best = victim;
+        best_local = true;
+        best_priority = kLocalPriority;
+      }
+      int64_t priority = queue.min_priority.load();
+      if (priority < best_priority) {
+        best = victim;
+        best_local = false;
+        best_priority = priority;
+      }
+    }
+    if (best_priority == kEmpty) {
+      return false;
+    }
+    if (best_local) {
+      return PopLocal(queues[best].get(), /*lifo=*/best == index, out);
+    }
+    return Pop(queues[best].get(), /*lifo=*/best == index, out);
+  }
+
+  // One queue per worker
+  std::vector<std::unique_ptr<Queue>> queues;
+  std::vector<std::thread> workers;
+  // For each worker, the queues it looks into in order: its own queue, those of
+  // the workers on the same NUMA node, then the others
+  std::vector<std::vector<size_t>> steal_orders;
+
+  // Protects sleeping and waking up of workers
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::condition_variable cv_idle;
+
+  std::atomic<int> num_pending{0};
+  std::atomic<int> num_sleeping{0};
+  // Total number of tasks that are either queued or running
+  std::atomic<int> tasks_queued_or_running{0};
+  // Queue receiving the next task spawned from outside of the pool
+  std::atomic<uint32_t> next_queue{0};
+
+  std::atomic<bool> please_shutdown{false};
+  std::atomic<bool> quick_shutdown{false};
+};
+
+constexpr int64_t WorkStealingThreadPool::State::kEmpty;
+constexpr int64_t WorkStealingThreadPool::State::kLocalPriority;
+
+namespace {
+
+thread_local WorkStealingThreadPool* current_work_stealing_pool_ = nullptr;
+thread_local size_t current_worker_index_ = 0;
+
+void WorkStealingWorkerLoop(WorkStealingThreadPool::State* state, size_t index) {
+  while (!state->quick_shutdown) {
+    Task task;
+    if (state->TryTake(index, &task)) {
+      RunTask(&task);
+      ARROW_UNUSED(std::move(task));  // release resources before signalling idleness
+      if (ARROW_PREDICT_FALSE(--state->tasks_queued_or_running == 0)) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->cv_idle.notify_all();
+      }
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(state->mutex);
+    // num_sleeping must be incremented before num_pending is checked, so that
+    // Push() either sees a sleeping worker or its task is seen here.
+    ++state->num_sleeping;
+    if (state->num_pending.load() == 0 && state->please_shutdown) {
+      --state->num_sleeping;
+      break;
+    }
+    state->cv.wait(lock, [&] {
+      return state->num_pending.load() > 0 || state->please_shutdown ||
+             state->quick_shutdown;
+    });
+    --state->num_sleeping;
+  }
+}
+
+}  // namespace
+
+WorkStealingThreadPool::WorkStealingThreadPool()
+    : state_(std::make_shared<WorkStealingThreadPool::State>()) {}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+  if (!state_->please_shutdown) {
+    ARROW_UNUSED(Shutdown(false /* wait */));
+  }
+}
+
+Result<std::shared_ptr<WorkStealingThreadPool>> WorkStealingThreadPool::Make(
+    int threads, WorkerAffinity affinity) {
+  if (threads <= 0) {
+    return Status::Invalid("WorkStealingThreadPool capacity must be > 0");
+  }
+  const auto num_workers = static_cast<size_t>(threads);
+
+  // Spread the workers over the NUMA nodes, and over the CPUs of each node
+  std::vector<int> worker_nodes(num_workers, 0);
+  std::vector<std::vector<int>> worker_cpus(num_workers);
+  if (affinity != WorkerAffinity::NONE) {
+    std::vector<std::vector<int>> node_cpus = GetNumaNodeCpus();
+    std::vector<int> nodes;
+    for (size_t node = 0; node < node_cpus.size(); ++node) {
+      if (!node_cpus[node].empty()) {
+        nodes.push_back(static_cast<int>(node));
+      }
+    }
+    for (size_t i = 0; i < num_workers && !nodes.empty(); ++i) {
+      const int node = nodes[i % nodes.size()];
+      const std::vector<int>& cpus = node_cpus[node];
+      worker_nodes[i] = node;
+      if (affinity == WorkerAffinity::CPU) {
+        worker_cpus[i] = {cpus[(i / nodes.size()) % cpus.size()]};
+      } else {
+        worker_cpus[i] = cpus;
+      }
+    }
+  }
+
+  auto pool = std::shared_ptr<WorkStealingThreadPool>(new WorkStealingThreadPool());
+  State* state = pool->state_.get();
+  for (size_t i = 0; i < num_workers; ++i) {
+    state->queues.push_back(::arrow::internal::make_unique<State::Queue>());
+    std::vector<size_t> order;
+    for (const bool same_node : {true, false}) {
+      for (size_t j = 0; j < num_workers; ++j) {
+        const size_t victim = (i + j) % num_workers;
+        if ((worker_nodes[victim] == worker_nodes[i]) == same_node) {
+          order.push_back(victim);
+        }
+      }
+    }
+    state->steal_orders.push_back(std::move(order));
+  }
+  WorkStealingThreadPool* self = pool.get();
+  for (size_t i = 0; i < num_workers; ++i) {
+    std::vector<int> cpus = std::move(worker_cpus[i]);
+    state->workers.emplace_back([self, state, i, cpus] {
+      if (!cpus.empty()) {
+        ARROW_WARN_NOT_OK(SetCurrentThreadAffinity(cpus), "Failed to pin worker thread");
+      }
+      current_work_stealing_pool_ = self;
+      current_worker_index_ = i;
+      WorkStealingWorkerLoop(state, i);
+    });
+  }
+  return pool;
+}
+
+int WorkStealingThreadPool::GetCapacity() {
+  return static_cast<int>(state_->queues.size());
+}
+
+bool WorkStealingThreadPool::OwnsThisThread() {
+  return current_work_stealing_pool_ == this;
+}
+
+int WorkStealingThreadPool::GetNumTasks() { return state_->tasks_queued_or_running; }
+
+Status WorkStealingThreadPool::Shutdown(bool wait) {
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (state_->please_shutdown) {
+      return Status::Invalid("Shutdown() already called");
+    }
+    state_->please_shutdown = true;
+    state_->quick_shutdown = !wait;
+    state_->cv.notify_all();
+  }
+  for (auto& worker : state_->workers) {
+    worker.join();
+  }
+  state_->workers.clear();
+  if (!wait) {
+    for (auto& queue : state_->queues) {
+      queue->local.Clear();
+      queue->tasks.clear();
+      queue->min_priority = State::kEmpty;
+    }
+    state_->num_pending = 0;
+  } else {
+    DCHECK_EQ(state_->num_pending.load(), 0);
+  }
+  return Status::OK();
+}
+
+void WorkStealingThreadPool::WaitForIdle() {
+  std::unique_lock<std::mutex> lock(state_->mutex);
+  state_->cv_idle.wait(lock, [this] { return state_->tasks_queued_or_running == 0; });
+}
+
+Status WorkStealingThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task,
+                                         StopToken stop_token,
+                                         StopCallback&& stop_callback) {
+  if (state_->please_shutdown) {
+    return Status::Invalid("operation forbidden during or after shutdown");
+  }
+  task = WrapWithActiveSpan(std::move(task));
+  const bool from_worker = current_work_stealing_pool_ == this;
+  size_t index;
+  if (from_worker) {
+    index = current_worker_index_;
+  } else {
+    index = state_->next_queue++ % state_->queues.size();
+  }
+  ++state_->tasks_queued_or_running;
+  state_->Push(index, from_worker, hints.priority,
+               {std::move(task), std::move(stop_token), std::move(stop_callback)});
+  return Status::OK();
+}
+
 }  // namespace internal
 
 int GetCpuThreadPoolCapacity() { return internal::GetCpuThreadPool()->GetCapacity(); }
@@ -67,7 +67,8 @@ ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 namespace internal {
 
 // Hints about a task that may be used by an Executor.
-// They are ignored by the provided ThreadPool implementation.
+// ThreadPool and WorkStealingThreadPool honor `priority`, the other hints are
+// ignored by the provided implementations.
 struct TaskHints {
   // The lower, the more urgent
   int32_t priority = 0;
@@ -402,8 +403,13 @@ class ARROW_EXPORT SerialExecutor : public Executor {
   }
 };
 
-/// An Executor implementation spawning tasks in FIFO manner on a fixed-size
-/// pool of worker threads.
+/// An Executor implementation spawning tasks on a fixed-size pool of worker threads.
+///
+/// Tasks are queued by TaskHints::priority and the most urgent (lowest priority
+/// value) ones run first, tasks of the same priority running in FIFO order.  Waiting
+/// queues age: for every 32 tasks started from other queues, a queue competes as if
+/// its priority was one more urgent.  A lasting stream of urgent tasks thus slows
+/// down the less urgent ones but does not starve them.
 ///
 /// Note: Any sort of nested parallelism will deadlock this executor.  Blocking waits are
 /// fine but if one task needs to wait for another task it must be expressed as an
@@ -491,6 +497,78 @@ class ARROW_EXPORT ThreadPool : public Executor {
 // Return the process-global thread pool for CPU-bound tasks.
 ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
+/// \brief Placement of the workers of a WorkStealingThreadPool on CPUs
+enum class WorkerAffinity : int8_t {
+  /// Let the operating system run workers on any CPU
+  NONE,
+  /// Restrict each worker to the CPUs of a NUMA node, the workers being spread
+  /// evenly over the nodes
+  NUMA_NODE,
+  /// Pin each worker to a single CPU, the workers being spread evenly over the
+  /// NUMA nodes
+  CPU,
+};
+
+/// \brief An executor with a fixed number of workers and one task queue per worker
+///
+/// Tasks spawned from a worker thread go to that worker's own queue and are
+/// executed in LIFO order, so that a worker keeps processing the data (morsel)
+/// it just produced while it is still hot in cache.  Tasks spawned from outside
+/// are distributed round-robin between workers.  A worker whose queue is empty
+/// steals the oldest task of another worker.
+///
+/// Tasks of the default priority spawned from a worker thread go to a lock-free
+/// deque, which its owner pushes to and pops from without synchronizing with other
+/// workers unless they steal from it.  Other tasks go to mutex-protected queues.
+///
+/// TaskHints::priority is honored: a worker always runs the most urgent (lowest
+/// priority value) task it can find, stealing it from another worker if needed.
+/// This lets a plan finish a pipeline breaker (e.g. a hash table build) before
+/// injecting more input.
+///
+/// Workers can be pinned to NUMA nodes or CPUs (see WorkerAffinity).  An idle
+/// worker then steals from the workers of its own node first, so that the tasks
+/// chained on a morsel (e.g. decoding, computing and aggregating it) tend to stay
+/// on the node holding its data.  See also NumaLocalMemoryPool.
+///
+/// Unlike ThreadPool, the capacity cannot be changed and the pool is not
+/// reinitialized after fork().
+class ARROW_EXPORT WorkStealingThreadPool : public Executor {
+ public:
+  static Result<std::shared_ptr<WorkStealingThreadPool>> Make(
+      int threads, WorkerAffinity affinity = WorkerAffinity::NONE);
+
+  // Destroy thread pool; the pool will first be shut down
+  ~WorkStealingThreadPool() override;
+
+  int GetCapacity() override;
+
+  bool OwnsThisThread() override;
+
+  // Return the number of tasks either running or in the queue.
+  int GetNumTasks();
+
+  // Shutdown the pool.  Once the pool starts shutting down, new tasks
+  // cannot be submitted anymore.
+  // If "wait" is true, shutdown waits for all pending tasks to be finished.
+  // If "wait" is false, workers are stopped as soon as currently executing
+  // tasks are finished.
+  Status Shutdown(bool wait = true);
+
+  // Wait for the thread pool to become idle
+  void WaitForIdle();
+
+  struct State;
+
+ protected:
+  WorkStealingThreadPool();
+
+  Status SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken,
+                   StopCallback&&) override;
+
+  std::shared_ptr<State> state_;
+};
+
 /// \brief Potentially run an async operation serially (if use_threads is false)
 /// \see RunSerially
 ///
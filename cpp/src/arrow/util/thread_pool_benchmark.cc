@@ -25,6 +25,7 @@
 #include <limits>
 #include <memory>
 #include <random>
+#include <thread>
 #include <vector>
 
 #include "arrow/status.h"
@@ -103,6 +104,77 @@ static void ThreadPoolSpawn(benchmark::State& state) {  // NOLINT non-const refe
   state.SetItemsProcessed(state.iterations() * nspawns);
 }
 
+// Benchmark WorkStealingThreadPool::Spawn from outside of the pool
+static void WorkStealingThreadPoolSpawn(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto workload_size = static_cast<int32_t>(state.range(1));
+
+  Workload workload(workload_size);
+
+  const int32_t nspawns = 200000000 / workload_size + 1;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto pool = *WorkStealingThreadPool::Make(nthreads);
+    state.ResumeTiming();
+
+    for (int32_t i = 0; i < nspawns; ++i) {
+      ABORT_NOT_OK(pool->Spawn(std::ref(workload)));
+    }
+
+    ABORT_NOT_OK(pool->Shutdown(true /* wait */));
+    state.PauseTiming();
+    pool.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * nspawns);
+}
+
+// Benchmark fine-grained tasks spawned by the pool's own workers, as parallel loops
+// and future callbacks do
+template <typename PoolType>
+static void SpawnFromWorkers(benchmark::State& state) {  // NOLINT non-const reference
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto workload_size = static_cast<int32_t>(state.range(1));
+
+  Workload workload(workload_size);
+
+  const int32_t nspawns_per_thread = (200000000 / workload_size + 1) / nthreads + 1;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto pool = *PoolType::Make(nthreads);
+    state.ResumeTiming();
+
+    for (int i = 0; i < nthreads; ++i) {
+      ABORT_NOT_OK(pool->Spawn([&] {
+        for (int32_t j = 0; j < nspawns_per_thread; ++j) {
+          ABORT_NOT_OK(pool->Spawn(std::ref(workload)));
+        }
+      }));
+    }
+
+    // Shutdown would forbid the spawns still to come
+    pool->WaitForIdle();
+    ABORT_NOT_OK(pool->Shutdown(true /* wait */));
+    state.PauseTiming();
+    pool.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * nspawns_per_thread * nthreads);
+}
+
+static void ThreadPoolSpawnFromWorkers(
+    benchmark::State& state) {  // NOLINT non-const reference
+  SpawnFromWorkers<ThreadPool>(state);
+}
+
+static void WorkStealingThreadPoolSpawnFromWorkers(
+    benchmark::State& state) {  // NOLINT non-const reference
+  SpawnFromWorkers<WorkStealingThreadPool>(state);
+}
+
 // Benchmark SerialExecutor::RunInSerialExecutor
 static void RunInSerialExecutor(benchmark::State& state) {  // NOLINT non-const reference
   const auto workload_size = static_cast<int32_t>(state.range(0));
@@ -218,6 +290,22 @@ static void ThreadPoolSpawn_Customize(benchmark::internal::Benchmark* b) {
   b->UseRealTime();
 }
 
+// Scale up to the number of hardware threads for the pools meant for many cores
+static void ThreadPoolScaling_Customize(benchmark::internal::Benchmark* b) {
+  const int max_threads =
+      std::max(8, static_cast<int>(std::thread::hardware_concurrency()));
+  for (const int32_t w : kWorkloadSizes) {
+    for (int nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+      b->Args({nthreads, w});
+    }
+    if ((max_threads & (max_threads - 1)) != 0) {
+      b->Args({max_threads, w});
+    }
+  }
+  b->ArgNames({"threads", "task_cost"});
+  b->UseRealTime();
+}
+
 #ifdef ARROW_WITH_BENCHMARKS_REFERENCE
 
 // This benchmark simply provides a baseline indicating the raw cost of our workload
@@ -241,6 +329,9 @@ BENCHMARK(ReferenceWorkloadCost)->Apply(WorkloadCost_Customize);
 BENCHMARK(SerialTaskGroup)->Apply(WorkloadCost_Customize);
 BENCHMARK(RunInSerialExecutor)->Apply(WorkloadCost_Customize);
 BENCHMARK(ThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK(WorkStealingThreadPoolSpawn)->Apply(ThreadPoolScaling_Customize);
+BENCHMARK(ThreadPoolSpawnFromWorkers)->Apply(ThreadPoolScaling_Customize);
+BENCHMARK(WorkStealingThreadPoolSpawnFromWorkers)->Apply(ThreadPoolScaling_Customize);
 BENCHMARK(ThreadedTaskGroup)->Apply(ThreadPoolSpawn_Customize);
 BENCHMARK(ThreadPoolSubmit)->Apply(ThreadPoolSpawn_Customize);
 
@@ -21,6 +21,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <functional>
@@ -98,7 +99,7 @@ class AddTester {
 
   AddTester(AddTester&&) = default;
 
-  void SpawnTasks(ThreadPool* pool, AddTaskFunc add_func) {
+  void SpawnTasks(Executor* pool, AddTaskFunc add_func) {
     for (int i = 0; i < nadds_; ++i) {
       ASSERT_OK(pool->Spawn([=] { add_func(xs_[i], ys_[i], &outs_[i]); }, stop_token_));
     }
@@ -744,6 +745,179 @@ TEST_F(TestThreadPool, SubmitWithStopTokenCancelled) {
   }
 }
 
+TEST_F(TestThreadPool, Priority) {
+  auto pool = this->MakeThreadPool(1);
+  // Keep the only worker busy until all other tasks are queued
+  auto started = Future<>::Make();
+  auto gate = Future<>::Make();
+  ASSERT_OK(pool->Spawn([&] {
+    started.MarkFinished();
+    gate.Wait();
+  }));
+  started.Wait();
+
+  std::mutex mutex;
+  std::vector<int> order;
+  const std::vector<int32_t> priorities = {0, 1, -1, 0, -2, 1};
+  for (int i = 0; i < static_cast<int>(priorities.size()); ++i) {
+    TaskHints hints;
+    hints.priority = priorities[i];
+    ASSERT_OK(pool->Spawn(hints, [&, i] {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(i);
+    }));
+  }
+  gate.MarkFinished();
+  ASSERT_OK(pool->Shutdown());
+  // By priority, then in FIFO order
+  ASSERT_EQ(order, std::vector<int>({4, 2, 0, 3, 1, 5}));
+}
+
+TEST_F(TestThreadPool, PriorityAging) {
+  auto pool = this->MakeThreadPool(1);
+  auto started = Future<>::Make();
+  auto gate = Future<>::Make();
+  ASSERT_OK(pool->Spawn([&] {
+    started.MarkFinished();
+    gate.Wait();
+  }));
+  started.Wait();
+
+  // A less urgent task eventually runs while more urgent tasks are still queued
+  constexpr int kNumUrgent = 1000;
+  std::vector<int32_t> order;
+  TaskHints urgent;
+  urgent.priority = -1;
+  for (int i = 0; i < kNumUrgent; ++i) {
+    ASSERT_OK(pool->Spawn(urgent, [&] { order.push_back(urgent.priority); }));
+  }
+  ASSERT_OK(pool->Spawn([&] { order.push_back(0); }));
+  gate.MarkFinished();
+  ASSERT_OK(pool->Shutdown());
+
+  ASSERT_EQ(order.size(), static_cast<size_t>(kNumUrgent + 1));
+  const auto position = std::find(order.begin(), order.end(), 0) - order.begin();
+  ASSERT_GT(position, 0);
+  ASSERT_LT(position, kNumUrgent / 2);
+}
+
+TEST(TestWorkStealingThreadPool, InvalidCapacity) {
+  ASSERT_RAISES(Invalid, WorkStealingThreadPool::Make(0));
+}
+
+TEST(TestWorkStealingThreadPool, StressSpawn) {
+  for (int threads : {1, 3, 8}) {
+    ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(threads));
+    ASSERT_EQ(pool->GetCapacity(), threads);
+    AddTester add_tester(1000);
+    add_tester.SpawnTasks(pool.get(), task_add<int>);
+    ASSERT_OK(pool->Shutdown());
+    add_tester.CheckResults();
+    ASSERT_RAISES(Invalid, pool->Spawn([] {}));
+  }
+}
+
+TEST(TestWorkStealingThreadPool, Affinity) {
+  for (auto affinity :
+       {WorkerAffinity::NONE, WorkerAffinity::NUMA_NODE, WorkerAffinity::CPU}) {
+    ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(3, affinity));
+    AddTester add_tester(1000);
+    add_tester.SpawnTasks(pool.get(), task_add<int>);
+    ASSERT_OK(pool->Shutdown());
+    add_tester.CheckResults();
+  }
+}
+
+TEST(TestWorkStealingThreadPool, SpawnNested) {
+  // Tasks spawned from a worker go to its own queue and get stolen by others
+  ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(4));
+  constexpr int kNumOuter = 20;
+  constexpr int kNumInner = 50;
+  std::atomic<int> count{0};
+  std::atomic<bool> owned{true};
+  for (int i = 0; i < kNumOuter; ++i) {
+    ASSERT_OK(pool->Spawn([&] {
+      for (int j = 0; j < kNumInner; ++j) {
+        ASSERT_OK(pool->Spawn([&] {
+          if (!pool->OwnsThisThread()) {
+            owned = false;
+          }
+          SleepFor(1e-4);
+          ++count;
+        }));
+      }
+    }));
+  }
+  pool->WaitForIdle();
+  ASSERT_EQ(pool->GetNumTasks(), 0);
+  ASSERT_EQ(count.load(), kNumOuter * kNumInner);
+  ASSERT_TRUE(owned.load());
+  ASSERT_FALSE(pool->OwnsThisThread());
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST(TestWorkStealingThreadPool, SpawnManyFromWorker) {
+  // Overflow the initial capacity of a worker's lock-free deque while others steal
+  ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(4));
+  constexpr int kNumTasks = 10000;
+  std::atomic<int> count{0};
+  ASSERT_OK(pool->Spawn([&] {
+    for (int i = 0; i < kNumTasks; ++i) {
+      ASSERT_OK(pool->Spawn([&] { ++count; }));
+    }
+  }));
+  pool->WaitForIdle();
+  ASSERT_EQ(count.load(), kNumTasks);
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST(TestWorkStealingThreadPool, Priority) {
+  ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(1));
+  // Keep the only worker busy until all other tasks are queued
+  auto started = Future<>::Make();
+  auto gate = Future<>::Make();
+  ASSERT_OK(pool->Spawn([&] {
+    started.MarkFinished();
+    gate.Wait();
+  }));
+  started.Wait();
+
+  std::mutex mutex;
+  std::vector<int32_t> order;
+  for (int32_t priority : {0, 1, -1, 0, -2, 1}) {
+    TaskHints hints;
+    hints.priority = priority;
+    ASSERT_OK(pool->Spawn(hints, [&, priority] {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(priority);
+    }));
+  }
+  gate.MarkFinished();
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(order, std::vector<int32_t>({-2, -1, 0, 0, 1, 1}));
+}
+
+TEST(TestWorkStealingThreadPool, QuickShutdown) {
+  AddTester add_tester(100);
+  {
+    ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(3));
+    add_tester.SpawnTasks(pool.get(), task_slow_add<int>{/*seconds=*/0.02});
+    ASSERT_OK(pool->Shutdown(false /* wait */));
+    add_tester.CheckNotAllComputed();
+  }
+  add_tester.CheckNotAllComputed();
+}
+
+TEST(TestWorkStealingThreadPool, SubmitWithStopToken) {
+  ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(2));
+  StopSource stop_source;
+  stop_source.RequestStop();
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(stop_source.token(), add<int>, 4, 5));
+  ASSERT_RAISES(Cancelled, fut.result());
+  ASSERT_OK_AND_ASSIGN(auto fut2, pool->Submit(add<int>, 4, 5));
+  ASSERT_OK_AND_EQ(9, fut2.result());
+}
+
 // Test fork safety on Unix
 
 #if !(defined(_WIN32) || defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER) || \
@@ -57,6 +57,7 @@ namespace util {
 class Compressor;
 class Decompressor;
 class Codec;
+class CodecContext;
 }  // namespace util
 
 }  // namespace arrow
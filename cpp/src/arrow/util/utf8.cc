@@ -20,10 +20,13 @@
 #include <mutex>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "arrow/result.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/utf8.h"
+#include "arrow/util/utf8_internal.h"
 #include "arrow/vendored/utfcpp/checked.h"
 
 // Can be defined by utfcpp
@@ -82,6 +85,34 @@ ARROW_EXPORT void CheckUTF8Initialized() {
       << "InitializeUTF8() must be called before calling UTF8 routines";
 }
 
+namespace {
+
+using ::arrow::internal::DispatchLevel;
+using ::arrow::internal::DynamicDispatch;
+
+struct ValidateUTF8DynamicFunction {
+  using FunctionType = decltype(&ValidateUTF8Inline);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      { DispatchLevel::NONE, ValidateUTF8Inline }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { DispatchLevel::AVX2, ValidateUTF8Avx2 }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , { DispatchLevel::AVX512, ValidateUTF8Avx512 }
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+bool ValidateUTF8Simd(const uint8_t* data, int64_t size) {
+  static DynamicDispatch<ValidateUTF8DynamicFunction> dispatch;
+  return dispatch.func(data, size);
+}
+
 }  // namespace internal
 
 static std::once_flag utf8_initialized;
@@ -92,7 +92,9 @@ ARROW_EXPORT void CheckUTF8Initialized();
 // This function needs to be called before doing UTF8 validation.
 ARROW_EXPORT void InitializeUTF8();
 
-static inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
+namespace internal {
+
+static inline bool ValidateUTF8Inline(const uint8_t* data, int64_t size) {
   static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
   static constexpr uint32_t high_bits_32 = 0x80808080UL;
   static constexpr uint16_t high_bits_16 = 0x8080U;
@@ -210,6 +212,23 @@ static inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
   return ARROW_PREDICT_TRUE(state == internal::kUTF8ValidateAccept);
 }
 
+// Below this size, the setup cost of the vectorized validation is not amortized
+static constexpr int64_t kUTF8ValidateSimdMinSize = 64;
+
+// Validate using the best vectorized implementation available at runtime
+ARROW_EXPORT bool ValidateUTF8Simd(const uint8_t* data, int64_t size);
+
+}  // namespace internal
+
+static inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
+#if defined(ARROW_HAVE_RUNTIME_AVX2) || defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (size >= internal::kUTF8ValidateSimdMinSize) {
+    return internal::ValidateUTF8Simd(data, size);
+  }
+#endif
+  return internal::ValidateUTF8Inline(data, size);
+}
+
 static inline bool ValidateUTF8(const util::string_view& str) {
   const uint8_t* data = reinterpret_cast<const uint8_t*>(str.data());
   const size_t length = str.size();
@@ -0,0 +1,137 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include <cstring>
+
+#include "arrow/util/utf8_internal.h"
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+namespace {
+
+using namespace utf8_simd;  // NOLINT
+
+constexpr int64_t kBlockSize = 32;
+
+inline __m256i LoadTable(const uint8_t* table) {
+  return _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+}
+
+// The input bytes shifted by N positions, with the last bytes of the previous
+// block shifted in
+template <int N>
+inline __m256i Prev(__m256i input, __m256i prev_input) {
+  return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev_input, input, 0x21),
+                            16 - N);
+}
+
+class Utf8Checker {
+ public:
+  Utf8Checker()
+      : byte_1_high_(LoadTable(kByte1High)),
+        byte_1_low_(LoadTable(kByte1Low)),
+        byte_2_high_(LoadTable(kByte2High)),
+        low_nibble_(_mm256_set1_epi8(0x0F)),
+        max_last_bytes_(MaxLastBytes()),
+        error_(_mm256_setzero_si256()),
+        prev_input_(_mm256_setzero_si256()),
+        prev_incomplete_(_mm256_setzero_si256()) {}
+
+  void CheckBlock(__m256i input) {
+    if (_mm256_movemask_epi8(input) == 0) {
+      // Pure ASCII, only a truncated sequence in the previous block is an error
+      error_ = _mm256_or_si256(error_, prev_incomplete_);
+      return;
+    }
+    const __m256i prev1 = Prev<1>(input, prev_input_);
+    const __m256i special_cases = _mm256_and_si256(
+        _mm256_and_si256(
+            Lookup(byte_1_high_, _mm256_srli_epi16(prev1, 4)),
+            _mm256_shuffle_epi8(byte_1_low_, _mm256_and_si256(prev1, low_nibble_))),
+        Lookup(byte_2_high_, _mm256_srli_epi16(input, 4)));
+    // Bytes which must be the 2nd continuation of a 3 byte sequence,
+    // or the 2nd or 3rd continuation of a 4 byte sequence
+    const __m256i is_third_byte = _mm256_subs_epu8(
+        Prev<2>(input, prev_input_), _mm256_set1_epi8(static_cast<char>(kThirdByteBias)));
+    const __m256i is_fourth_byte =
+        _mm256_subs_epu8(Prev<3>(input, prev_input_),
+                         _mm256_set1_epi8(static_cast<char>(kFourthByteBias)));
+    const __m256i must_be_2_3_continuation = _mm256_and_si256(
+        _mm256_or_si256(is_third_byte, is_fourth_byte),
+        _mm256_set1_epi8(static_cast<char>(0x80)));
+    // Such bytes must be flagged as two consecutive continuation bytes,
+    // and the other bytes must not
+    error_ = _mm256_or_si256(error_,
+                             _mm256_xor_si256(must_be_2_3_continuation, special_cases));
+    prev_incomplete_ = _mm256_subs_epu8(input, max_last_bytes_);
+    prev_input_ = input;
+  }
+
+  bool Finish() {
+    error_ = _mm256_or_si256(error_, prev_incomplete_);
+    return _mm256_testz_si256(error_, error_) != 0;
+  }
+
+ private:
+  // Look up the high nibbles of the given bytes
+  __m256i Lookup(__m256i table, __m256i shifted_bytes) const {
+    return _mm256_shuffle_epi8(table, _mm256_and_si256(shifted_bytes, low_nibble_));
+  }
+
+  static __m256i MaxLastBytes() {
+    uint8_t max_last_bytes[kBlockSize];
+    std::memset(max_last_bytes, 0xFF, kBlockSize);
+    max_last_bytes[kBlockSize - 3] = kMaxThirdToLastByte;
+    max_last_bytes[kBlockSize - 2] = kMaxSecondToLastByte;
+    max_last_bytes[kBlockSize - 1] = kMaxLastByte;
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(max_last_bytes));
+  }
+
+  const __m256i byte_1_high_;
+  const __m256i byte_1_low_;
+  const __m256i byte_2_high_;
+  const __m256i low_nibble_;
+  const __m256i max_last_bytes_;
+  __m256i error_;
+  __m256i prev_input_;
+  __m256i prev_incomplete_;
+};
+
+}  // namespace
+
+bool ValidateUTF8Avx2(const uint8_t* data, int64_t size) {
+  Utf8Checker checker;
+  for (; size >= kBlockSize; data += kBlockSize, size -= kBlockSize) {
+    checker.CheckBlock(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)));
+  }
+  if (size > 0) {
+    // Pad the tail with ASCII zeros, which terminate any truncated sequence
+    uint8_t tail[kBlockSize] = {};
+    std::memcpy(tail, data, static_cast<size_t>(size));
+    checker.CheckBlock(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(tail)));
+  }
+  return checker.Finish();
+}
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,138 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include <cstring>
+
+#include "arrow/util/utf8_internal.h"
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+namespace {
+
+using namespace utf8_simd;  // NOLINT
+
+constexpr int64_t kBlockSize = 64;
+
+inline __m512i LoadTable(const uint8_t* table) {
+  return _mm512_broadcast_i32x4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+}
+
+// The input bytes shifted by N positions, with the last bytes of the previous
+// block shifted in
+template <int N>
+inline __m512i Prev(__m512i input, __m512i prev_input) {
+  // Each 128-bit lane of `rotated` is the lane preceding it in the input
+  const __m512i lanes = _mm512_setr_epi32(28, 29, 30, 31, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+                                          10, 11);
+  const __m512i rotated = _mm512_permutex2var_epi32(input, lanes, prev_input);
+  return _mm512_alignr_epi8(input, rotated, 16 - N);
+}
+
+class Utf8Checker {
+ public:
+  Utf8Checker()
+      : byte_1_high_(LoadTable(kByte1High)),
+        byte_1_low_(LoadTable(kByte1Low)),
+        byte_2_high_(LoadTable(kByte2High)),
+        low_nibble_(_mm512_set1_epi8(0x0F)),
+        max_last_bytes_(MaxLastBytes()),
+        error_(_mm512_setzero_si512()),
+        prev_input_(_mm512_setzero_si512()),
+        prev_incomplete_(_mm512_setzero_si512()) {}
+
+  void CheckBlock(__m512i input) {
+    if (_mm512_movepi8_mask(input) == 0) {
+      // Pure ASCII, only a truncated sequence in the previous block is an error
+      error_ = _mm512_or_si512(error_, prev_incomplete_);
+      return;
+    }
+    const __m512i prev1 = Prev<1>(input, prev_input_);
+    const __m512i special_cases = _mm512_and_si512(
+        _mm512_and_si512(
+            Lookup(byte_1_high_, _mm512_srli_epi16(prev1, 4)),
+            _mm512_shuffle_epi8(byte_1_low_, _mm512_and_si512(prev1, low_nibble_))),
+        Lookup(byte_2_high_, _mm512_srli_epi16(input, 4)));
+    // Bytes which must be the 2nd continuation of a 3 byte sequence,
+    // or the 2nd or 3rd continuation of a 4 byte sequence
+    const __m512i is_third_byte = _mm512_subs_epu8(
+        Prev<2>(input, prev_input_), _mm512_set1_epi8(static_cast<char>(kThirdByteBias)));
+    const __m512i is_fourth_byte =
+        _mm512_subs_epu8(Prev<3>(input, prev_input_),
+                         _mm512_set1_epi8(static_cast<char>(kFourthByteBias)));
+    const __m512i must_be_2_3_continuation = _mm512_and_si512(
+        _mm512_or_si512(is_third_byte, is_fourth_byte),
+        _mm512_set1_epi8(static_cast<char>(0x80)));
+    // Such bytes must be flagged as two consecutive continuation bytes,
+    // and the other bytes must not
+    error_ = _mm512_or_si512(error_,
+                             _mm512_xor_si512(must_be_2_3_continuation, special_cases));
+    prev_incomplete_ = _mm512_subs_epu8(input, max_last_bytes_);
+    prev_input_ = input;
+  }
+
+  bool Finish() {
+    error_ = _mm512_or_si512(error_, prev_incomplete_);
+    return _mm512_test_epi8_mask(error_, error_) == 0;
+  }
+
+ private:
+  // Look up the high nibbles of the given bytes
+  __m512i Lookup(__m512i table, __m512i shifted_bytes) const {
+    return _mm512_shuffle_epi8(table, _mm512_and_si512(shifted_bytes, low_nibble_));
+  }
+
+  static __m512i MaxLastBytes() {
+    uint8_t max_last_bytes[kBlockSize];
+    std::memset(max_last_bytes, 0xFF, kBlockSize);
+    max_last_bytes[kBlockSize - 3] = kMaxThirdToLastByte;
+    max_last_bytes[kBlockSize - 2] = kMaxSecondToLastByte;
+    max_last_bytes[kBlockSize - 1] = kMaxLastByte;
+    return _mm512_loadu_si512(max_last_bytes);
+  }
+
+  const __m512i byte_1_high_;
+  const __m512i byte_1_low_;
+  const __m512i byte_2_high_;
+  const __m512i low_nibble_;
+  const __m512i max_last_bytes_;
+  __m512i error_;
+  __m512i prev_input_;
+  __m512i prev_incomplete_;
+};
+
+}  // namespace
+
+bool ValidateUTF8Avx512(const uint8_t* data, int64_t size) {
+  Utf8Checker checker;
+  for (; size >= kBlockSize; data += kBlockSize, size -= kBlockSize) {
+    checker.CheckBlock(_mm512_loadu_si512(data));
+  }
+  if (size > 0) {
+    // Mask the tail load, the zeroed bytes terminate any truncated sequence
+    const __mmask64 tail_mask = (~0ULL) >> (kBlockSize - size);
+    checker.CheckBlock(_mm512_maskz_loadu_epi8(tail_mask, data));
+  }
+  return checker.Finish();
+}
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
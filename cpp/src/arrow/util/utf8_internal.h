@@ -0,0 +1,147 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Vectorized UTF8 validation, based on 'Validating UTF-8 In Less Than One
+// Instruction Per Byte' from Keiser & Lemire
+// - https://arxiv.org/abs/2010.03090
+//
+// Every error is detected from a pair of consecutive bytes, by looking up
+// three tables indexed by the high and low nibbles of the first byte and by the
+// high nibble of the second byte: a bit set in all three lookups flags an error.
+// Only missing or extraneous 3rd and 4th continuation bytes are not caught this
+// way, they're checked from the bytes two and three positions earlier.
+
+#pragma once
+
+#include <cstdint>
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+namespace utf8_simd {
+
+// 11______ 0_______
+// 11______ 11______
+static constexpr uint8_t kTooShort = 1 << 0;
+// 0_______ 10______
+static constexpr uint8_t kTooLong = 1 << 1;
+// 11100000 100_____
+static constexpr uint8_t kOverlong3 = 1 << 2;
+// 11110100 1001____
+// 11110100 101_____
+// 11110101 1001____
+// 11110101 101_____
+// 1111011_ 1001____
+// 1111011_ 101_____
+// 11111___ 1001____
+// 11111___ 101_____
+static constexpr uint8_t kTooLarge = 1 << 3;
+// 11101101 101_____
+static constexpr uint8_t kSurrogate = 1 << 4;
+// 1100000_ 10______
+static constexpr uint8_t kOverlong2 = 1 << 5;
+// 11110101 1000____
+// 1111011_ 1000____
+// 11111___ 1000____
+static constexpr uint8_t kTooLarge1000 = 1 << 6;
+// 11110000 1000____
+static constexpr uint8_t kOverlong4 = 1 << 6;
+// 10______ 10______
+static constexpr uint8_t kTwoConts = 1 << 7;
+// The errors which only depend on the high nibble of the first byte
+static constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+// clang-format off
+static constexpr uint8_t kByte1High[16] = {
+  // 0_______ ________ <ASCII in byte 1>
+  kTooLong, kTooLong, kTooLong, kTooLong,
+  kTooLong, kTooLong, kTooLong, kTooLong,
+  // 10______ ________ <continuation in byte 1>
+  kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+  // 1100____ ________ <two byte lead in byte 1>
+  kTooShort | kOverlong2,
+  // 1101____ ________ <two byte lead in byte 1>
+  kTooShort,
+  // 1110____ ________ <three byte lead in byte 1>
+  kTooShort | kOverlong3 | kSurrogate,
+  // 1111____ ________ <four+ byte lead in byte 1>
+  kTooShort | kTooLarge | kTooLarge1000 | kOverlong4,
+};
+
+static constexpr uint8_t kByte1Low[16] = {
+  // ____0000 ________
+  kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+  // ____0001 ________
+  kCarry | kOverlong2,
+  // ____001_ ________
+  kCarry,
+  kCarry,
+  // ____0100 ________
+  kCarry | kTooLarge,
+  // ____0101 ________
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____011_ ________
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____1___ ________
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____1101 ________
+  kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+};
+
+static constexpr uint8_t kByte2High[16] = {
+  // ________ 0_______ <ASCII in byte 2>
+  kTooShort, kTooShort, kTooShort, kTooShort,
+  kTooShort, kTooShort, kTooShort, kTooShort,
+  // ________ 1000____
+  kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+  // ________ 1001____
+  kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+  // ________ 101_____
+  kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+  kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+  // ________ 11______ <lead in byte 2>
+  kTooShort, kTooShort, kTooShort, kTooShort,
+};
+// clang-format on
+
+// After subtracting these with saturation, a byte is >= 0x80 if and only if it
+// is the lead of a sequence of at least 3 (resp. 4) bytes
+static constexpr uint8_t kThirdByteBias = 0xE0 - 0x80;
+static constexpr uint8_t kFourthByteBias = 0xF0 - 0x80;
+
+// A buffer is truncated if one of its last three bytes is the lead of a sequence
+// longer than the remaining bytes, that is if it's larger than these
+static constexpr uint8_t kMaxLastByte = 0xC0 - 1;
+static constexpr uint8_t kMaxSecondToLastByte = 0xE0 - 1;
+static constexpr uint8_t kMaxThirdToLastByte = 0xF0 - 1;
+
+}  // namespace utf8_simd
+
+bool ValidateUTF8Avx2(const uint8_t* data, int64_t size);
+bool ValidateUTF8Avx512(const uint8_t* data, int64_t size);
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
@@ -120,6 +120,18 @@ static void ValidateSmallNonAscii(
   BenchmarkUTF8Validation(state, valid_non_ascii, true);
 }
 
+static void ValidateMediumAlmostAscii(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto s = MakeLargeString(valid_almost_ascii, 1000);
+  BenchmarkUTF8Validation(state, s, true);
+}
+
+static void ValidateMediumNonAscii(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto s = MakeLargeString(valid_non_ascii, 1000);
+  BenchmarkUTF8Validation(state, s, true);
+}
+
 static void ValidateLargeAscii(benchmark::State& state) {  // NOLINT non-const reference
   auto s = MakeLargeString(valid_ascii, 100000);
   BenchmarkASCIIValidation(state, s, true);
@@ -137,14 +149,32 @@ static void ValidateLargeNonAscii(
   BenchmarkUTF8Validation(state, s, true);
 }
 
+static void ValidateLargeAsciiAsUTF8(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto s = MakeLargeString(valid_ascii, 100000);
+  BenchmarkUTF8Validation(state, s, true);
+}
+
+static void ValidateLargeInvalid(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // A single invalid byte, near the end to not short-circuit the validation
+  auto s = MakeLargeString(valid_non_ascii, 100000);
+  s[s.size() - 10] = '\xff';
+  BenchmarkUTF8Validation(state, s, false);
+}
+
 BENCHMARK(ValidateTinyAscii);
 BENCHMARK(ValidateTinyNonAscii);
 BENCHMARK(ValidateSmallAscii);
 BENCHMARK(ValidateSmallAlmostAscii);
 BENCHMARK(ValidateSmallNonAscii);
+BENCHMARK(ValidateMediumAlmostAscii);
+BENCHMARK(ValidateMediumNonAscii);
 BENCHMARK(ValidateLargeAscii);
 BENCHMARK(ValidateLargeAlmostAscii);
 BENCHMARK(ValidateLargeNonAscii);
+BENCHMARK(ValidateLargeAsciiAsUTF8);
+BENCHMARK(ValidateLargeInvalid);
 
 }  // namespace util
 }  // namespace arrow
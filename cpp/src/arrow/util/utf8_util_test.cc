@@ -316,6 +316,38 @@ TEST_F(UTF8ValidationTest, RandomTruncated) {
   }
 }
 
+TEST_F(UTF8ValidationTest, LongStringOffsets) {
+  // Exercise the vectorized validation, with the sequence at all positions
+  // relative to the block boundaries
+  auto is_valid_simd = [](const std::string& s) {
+    return internal::ValidateUTF8Simd(reinterpret_cast<const uint8_t*>(s.data()),
+                                      s.size());
+  };
+  const int length = 200;
+  for (int offset = 0; offset < length - 4; ++offset) {
+    for (const auto& s : all_valid_sequences) {
+      std::string longer(offset, 'x');
+      longer += s;
+      longer.append(length - longer.size(), 'y');
+      AssertValidUTF8(longer);
+      ASSERT_TRUE(is_valid_simd(longer));
+      if (s.size() > 1) {
+        // Truncated at the end of the string
+        longer.resize(offset + s.size() - 1);
+        AssertInvalidUTF8(longer);
+        ASSERT_FALSE(is_valid_simd(longer));
+      }
+    }
+    for (const auto& s : all_invalid_sequences) {
+      std::string longer(offset, 'x');
+      longer += s;
+      longer.append(length - longer.size(), 'y');
+      AssertInvalidUTF8(longer);
+      ASSERT_FALSE(is_valid_simd(longer));
+    }
+  }
+}
+
 TEST(SkipUTF8BOM, Basics) {
   auto CheckOk = [](const std::string& s, size_t expected_offset) -> void {
     const uint8_t* data = reinterpret_cast<const uint8_t*>(s.data());
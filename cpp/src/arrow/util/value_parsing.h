@@ -23,6 +23,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
@@ -31,6 +32,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/time.h"
 #include "arrow/util/visibility.h"
@@ -166,6 +168,90 @@ struct StringConverter<DoubleType> {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+// SWAR ("SIMD within a register") digit parsing: eight characters are loaded
+// into a 64-bit word and validated and decoded at once, without a branch per
+// character.  See "Faster Integer Parsing" by Lemire & Muła.
+
+inline uint64_t LoadEightChars(const char* s) {
+  uint64_t v;
+  std::memcpy(&v, s, sizeof(v));
+  // The first character goes into the least significant byte
+  return bit_util::FromLittleEndian(v);
+}
+
+inline bool IsEightDigits(uint64_t v) {
+  // A byte is a digit iff its high nibble is 3, and is still 3 after adding 6
+  return ((v & 0xF0F0F0F0F0F0F0F0ULL) |
+          (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+         0x3333333333333333ULL;
+}
+
+// Decode eight decimal digits loaded with LoadEightChars
+inline bool DecodeEightDigits(uint64_t v, uint32_t* out) {
+  if (ARROW_PREDICT_FALSE(!IsEightDigits(v))) {
+    return false;
+  }
+  v -= 0x3030303030303030ULL;
+  // Combine adjacent digits into 2-digit numbers, then into 8-digit numbers
+  v = (v * 10) + (v >> 8);
+  v = (((v & 0x000000FF000000FFULL) * 0x000F424000000064ULL) +
+       (((v >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >>
+      32;
+  *out = static_cast<uint32_t>(v);
+  return true;
+}
+
+// Parse three 2-digit numbers separated by `sep`, such as "hh:mm:ss"
+inline bool ParseThreeTwoDigits(const char* s, char sep, uint8_t* first,
+                                uint8_t* second, uint8_t* third) {
+  constexpr uint64_t kSepMask = 0x0000FF0000FF0000ULL;
+  const uint64_t seps = 0x0000010000010000ULL * static_cast<uint8_t>(sep);
+  uint64_t v = LoadEightChars(s);
+  if (ARROW_PREDICT_FALSE((v & kSepMask) != seps)) {
+    return false;
+  }
+  // Turn the separators into '0' so as to check all bytes at once
+  v = (v & ~kSepMask) | (0x0000300000300000ULL);
+  if (ARROW_PREDICT_FALSE(!IsEightDigits(v))) {
+    return false;
+  }
+  v -= 0x3030303030303030ULL;
+  v = (v * 10) + (v >> 8);
+  *first = static_cast<uint8_t>(v);
+  *second = static_cast<uint8_t>(v >> 24);
+  *third = static_cast<uint8_t>(v >> 48);
+  return true;
+}
+
+// Parse a run of at least eight digits, eight at a time; the caller ensures
+// the result cannot overflow
+template <typename C_TYPE>
+inline bool ParseUnsignedEightAtATime(const char* s, size_t length, C_TYPE* out) {
+  C_TYPE result = 0;
+  uint32_t chunk;
+  const size_t head = length % 8;
+  if (head > 0) {
+    // Left-pad the leading digits with '0's, the eight bytes are readable
+    // since at least eight digits follow
+    const uint64_t v = (LoadEightChars(s) << (8 * (8 - head))) |
+                       (0x3030303030303030ULL >> (8 * head));
+    if (ARROW_PREDICT_FALSE(!DecodeEightDigits(v, &chunk))) {
+      return false;
+    }
+    result = chunk;
+    s += head;
+    length -= head;
+  }
+  for (; length > 0; s += 8, length -= 8) {
+    if (ARROW_PREDICT_FALSE(!DecodeEightDigits(LoadEightChars(s), &chunk))) {
+      return false;
+    }
+    result = static_cast<C_TYPE>(result * 100000000U + chunk);
+  }
+  *out = result;
+  return true;
+}
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -230,6 +316,10 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
+  // Up to 9 digits cannot overflow
+  if (length >= 8 && length <= 9) {
+    return ParseUnsignedEightAtATime(s, length, out);
+  }
   uint32_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -250,6 +340,10 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
+  // Up to 19 digits cannot overflow
+  if (length >= 8 && length <= 19) {
+    return ParseUnsignedEightAtATime(s, length, out);
+  }
   uint64_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint64_t);
@@ -444,21 +538,19 @@ using ts_type = TimestampType::c_type;
 
 template <typename Duration>
 static inline bool ParseYYYY_MM_DD(const char* s, Duration* since_epoch) {
-  uint16_t year = 0;
+  uint8_t century = 0;
+  uint8_t year_of_century = 0;
   uint8_t month = 0;
   uint8_t day = 0;
-  if (ARROW_PREDICT_FALSE(s[4] != '-') || ARROW_PREDICT_FALSE(s[7] != '-')) {
+  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 2, &century))) {
     return false;
   }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 4, &year))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 5, 2, &month))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 8, 2, &day))) {
+  // "YY-MM-DD"
+  if (ARROW_PREDICT_FALSE(
+          !ParseThreeTwoDigits(s + 2, '-', &year_of_century, &month, &day))) {
     return false;
   }
+  const int year = century * 100 + year_of_century;
   arrow_vendored::date::year_month_day ymd{arrow_vendored::date::year{year},
                                            arrow_vendored::date::month{month},
                                            arrow_vendored::date::day{day}};
@@ -532,16 +624,7 @@ static inline bool ParseHH_MM_SS(const char* s, Duration* out) {
   uint8_t hours = 0;
   uint8_t minutes = 0;
   uint8_t seconds = 0;
-  if (ARROW_PREDICT_FALSE(s[2] != ':') || ARROW_PREDICT_FALSE(s[5] != ':')) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 2, &hours))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 3, 2, &minutes))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 6, 2, &seconds))) {
+  if (ARROW_PREDICT_FALSE(!ParseThreeTwoDigits(s, ':', &hours, &minutes, &seconds))) {
     return false;
   }
   if (ARROW_PREDICT_FALSE(hours >= 24)) {
@@ -56,6 +56,20 @@ static std::vector<std::string> MakeIntStrings(int32_t num_items) {
   return strings;
 }
 
+// Runs of 8 or more digits, such as ids or epoch timestamps
+template <typename c_int>
+static std::vector<std::string> MakeLongIntStrings(int32_t num_items) {
+  const uint64_t min_value = 10000000;
+  const uint64_t range = static_cast<uint64_t>(std::numeric_limits<c_int>::max()) -
+                         min_value;
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    const uint64_t value = min_value + (static_cast<uint64_t>(i) * 829348153ULL) % range;
+    strings.push_back(std::to_string(value));
+  }
+  return strings;
+}
+
 template <typename c_int>
 static std::vector<std::string> MakeHexStrings(int32_t num_items) {
   int32_t num_bytes = sizeof(c_int);
@@ -87,6 +101,26 @@ static std::vector<std::string> MakeFloatStrings(int32_t num_items) {
   return strings;
 }
 
+static std::vector<std::string> MakeDateStrings(int32_t num_items) {
+  std::vector<std::string> base_strings = {"2018-11-13", "1970-01-01", "2016-02-29"};
+
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
+static std::vector<std::string> MakeTimeStrings(int32_t num_items) {
+  std::vector<std::string> base_strings = {"17:11:10", "11:22:33.123", "00:00:00"};
+
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
 static std::vector<std::string> MakeTimestampStrings(int32_t num_items) {
   std::vector<std::string> base_strings = {"2018-11-13 17:11:10", "2018-11-13 11:22:33",
                                            "2016-02-29 11:22:33"};
@@ -143,6 +177,25 @@ static void IntegerParsing(benchmark::State& state) {  // NOLINT non-const refer
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void LongIntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
+  auto strings = MakeLongIntStrings<C_TYPE>(1000);
+
+  while (state.KeepRunning()) {
+    C_TYPE total = 0;
+    for (const auto& s : strings) {
+      C_TYPE value;
+      if (!ParseValue<ARROW_TYPE>(s.data(), s.length(), &value)) {
+        std::cerr << "Conversion failed for '" << s << "'";
+        std::abort();
+      }
+      total = static_cast<C_TYPE>(total + value);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
 static void HexParsing(benchmark::State& state) {  // NOLINT non-const reference
   auto strings = MakeHexStrings<C_TYPE>(1000);
@@ -217,6 +270,33 @@ static void TimestampParsingStrptime(
   BenchTimestampParsing(state, UNIT, *parser);
 }
 
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void BenchTemporalParsing(benchmark::State& state,  // NOLINT non-const reference
+                                 const ARROW_TYPE& type,
+                                 const std::vector<std::string>& strings) {
+  for (auto _ : state) {
+    C_TYPE total = 0;
+    for (const auto& s : strings) {
+      C_TYPE value;
+      if (!ParseValue<ARROW_TYPE>(type, s.data(), s.length(), &value)) {
+        std::cerr << "Conversion failed for '" << s << "'";
+        std::abort();
+      }
+      total += value;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
+static void DateParsing(benchmark::State& state) {  // NOLINT non-const reference
+  BenchTemporalParsing(state, Date32Type(), MakeDateStrings(1000));
+}
+
+static void TimeParsing(benchmark::State& state) {  // NOLINT non-const reference
+  BenchTemporalParsing(state, Time64Type(TimeUnit::MICRO), MakeTimeStrings(1000));
+}
+
 struct DummyAppender {
   Status operator()(util::string_view v) {
     if (pos_ >= static_cast<int32_t>(v.size())) {
@@ -269,6 +349,11 @@ BENCHMARK_TEMPLATE(IntegerParsing, UInt16Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt32Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt64Type);
 
+BENCHMARK_TEMPLATE(LongIntegerParsing, Int32Type);
+BENCHMARK_TEMPLATE(LongIntegerParsing, Int64Type);
+BENCHMARK_TEMPLATE(LongIntegerParsing, UInt32Type);
+BENCHMARK_TEMPLATE(LongIntegerParsing, UInt64Type);
+
 BENCHMARK_TEMPLATE(HexParsing, Int8Type);
 BENCHMARK_TEMPLATE(HexParsing, Int16Type);
 BENCHMARK_TEMPLATE(HexParsing, Int32Type);
@@ -287,6 +372,9 @@ BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::MICRO);
 BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::NANO);
 BENCHMARK_TEMPLATE(TimestampParsingStrptime, TimeUnit::MILLI);
 
+BENCHMARK(DateParsing);
+BENCHMARK(TimeParsing);
+
 BENCHMARK_TEMPLATE(IntegerFormatting, Int8Type);
 BENCHMARK_TEMPLATE(IntegerFormatting, Int16Type);
 BENCHMARK_TEMPLATE(IntegerFormatting, Int32Type);
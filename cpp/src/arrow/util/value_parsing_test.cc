@@ -396,6 +396,37 @@ TEST(StringConversion, ToUInt64) {
   AssertConversionFails<UInt64Type>("0x23512ak");
 }
 
+TEST(StringConversion, IntegerDigitRuns) {
+  // Runs of eight digits or more are parsed eight at a time, check that
+  // a non-digit is caught at any position
+  std::string digits = "1234567890123456789";
+  for (size_t length = 1; length <= digits.size(); ++length) {
+    const std::string s = digits.substr(0, length);
+    ARROW_SCOPED_TRACE("s = ", s);
+    AssertConversion<UInt64Type>(s, std::stoull(s));
+    AssertConversion<Int64Type>(s, std::stoll(s));
+    AssertConversion<Int64Type>("-" + s, -std::stoll(s));
+    if (length <= 9) {
+      AssertConversion<UInt32Type>(s, static_cast<uint32_t>(std::stoul(s)));
+    }
+    for (size_t pos = 0; pos < length; ++pos) {
+      for (char c : {'/', ':', ' ', '.', 'a', '\x80', '\0'}) {
+        std::string bad = s;
+        bad[pos] = c;
+        AssertConversionFails<UInt64Type>(bad);
+        AssertConversionFails<Int64Type>(bad);
+        AssertConversionFails<UInt32Type>(bad);
+      }
+    }
+  }
+  AssertConversion<UInt64Type>("00000000000000000001", 1);
+  AssertConversion<UInt32Type>("000000001", 1);
+  AssertConversion<UInt32Type>("4294967295", 4294967295U);
+  AssertConversionFails<UInt32Type>("4294967296");
+  AssertConversion<Int64Type>("-9223372036854775808", INT64_MIN);
+  AssertConversionFails<Int64Type>("9223372036854775808");
+}
+
 TEST(StringConversion, ToDate32) {
   AssertConversion<Date32Type>("1970-01-01", 0);
   AssertConversion<Date32Type>("1970-01-02", 1);
@@ -410,6 +441,15 @@ TEST(StringConversion, ToDate32) {
   AssertConversionFails<Date32Type>("1970-01");
   AssertConversionFails<Date32Type>("1970-01-01 00:00:00");
   AssertConversionFails<Date32Type>("1970/01/01");
+  AssertConversionFails<Date32Type>("1970-01/01");
+  AssertConversionFails<Date32Type>("1970/01-01");
+  AssertConversionFails<Date32Type>("197a-01-01");
+  AssertConversionFails<Date32Type>("1970-0a-01");
+  AssertConversionFails<Date32Type>("1970-01-0:");
+
+  // Invalid date value
+  AssertConversionFails<Date32Type>("1970-13-01");
+  AssertConversionFails<Date32Type>("1970-02-30");
 }
 
 TEST(StringConversion, ToDate64) {
@@ -431,6 +471,11 @@ void AssertInvalidTimes(const T& type) {
   AssertConversionFails(type, "00:00:00:");
   AssertConversionFails(type, "000000");
   AssertConversionFails(type, "000000.000");
+  AssertConversionFails(type, "00-00:00");
+  AssertConversionFails(type, "00:00-00");
+  AssertConversionFails(type, "0a:00:00");
+  AssertConversionFails(type, "00:0/:00");
+  AssertConversionFails(type, "00:00:0:");
 
   // Invalid time value
   AssertConversionFails(type, "24:00:00");
@@ -49,6 +49,8 @@ ARRAY_VISITOR_DEFAULT(BinaryArray)
 ARRAY_VISITOR_DEFAULT(StringArray)
 ARRAY_VISITOR_DEFAULT(LargeBinaryArray)
 ARRAY_VISITOR_DEFAULT(LargeStringArray)
+ARRAY_VISITOR_DEFAULT(BinaryViewArray)
+ARRAY_VISITOR_DEFAULT(StringViewArray)
 ARRAY_VISITOR_DEFAULT(FixedSizeBinaryArray)
 ARRAY_VISITOR_DEFAULT(Date32Array)
 ARRAY_VISITOR_DEFAULT(Date64Array)
@@ -67,6 +69,7 @@ ARRAY_VISITOR_DEFAULT(StructArray)
 ARRAY_VISITOR_DEFAULT(SparseUnionArray)
 ARRAY_VISITOR_DEFAULT(DenseUnionArray)
 ARRAY_VISITOR_DEFAULT(DictionaryArray)
+ARRAY_VISITOR_DEFAULT(RunEndEncodedArray)
 ARRAY_VISITOR_DEFAULT(Decimal128Array)
 ARRAY_VISITOR_DEFAULT(Decimal256Array)
 ARRAY_VISITOR_DEFAULT(ExtensionArray)
@@ -98,6 +101,8 @@ TYPE_VISITOR_DEFAULT(StringType)
 TYPE_VISITOR_DEFAULT(BinaryType)
 TYPE_VISITOR_DEFAULT(LargeStringType)
 TYPE_VISITOR_DEFAULT(LargeBinaryType)
+TYPE_VISITOR_DEFAULT(StringViewType)
+TYPE_VISITOR_DEFAULT(BinaryViewType)
 TYPE_VISITOR_DEFAULT(FixedSizeBinaryType)
 TYPE_VISITOR_DEFAULT(Date64Type)
 TYPE_VISITOR_DEFAULT(Date32Type)
@@ -118,6 +123,7 @@ TYPE_VISITOR_DEFAULT(StructType)
 TYPE_VISITOR_DEFAULT(SparseUnionType)
 TYPE_VISITOR_DEFAULT(DenseUnionType)
 TYPE_VISITOR_DEFAULT(DictionaryType)
+TYPE_VISITOR_DEFAULT(RunEndEncodedType)
 TYPE_VISITOR_DEFAULT(ExtensionType)
 
 #undef TYPE_VISITOR_DEFAULT
@@ -148,6 +154,8 @@ SCALAR_VISITOR_DEFAULT(StringScalar)
 SCALAR_VISITOR_DEFAULT(BinaryScalar)
 SCALAR_VISITOR_DEFAULT(LargeStringScalar)
 SCALAR_VISITOR_DEFAULT(LargeBinaryScalar)
+SCALAR_VISITOR_DEFAULT(StringViewScalar)
+SCALAR_VISITOR_DEFAULT(BinaryViewScalar)
 SCALAR_VISITOR_DEFAULT(FixedSizeBinaryScalar)
 SCALAR_VISITOR_DEFAULT(Date64Scalar)
 SCALAR_VISITOR_DEFAULT(Date32Scalar)
@@ -166,6 +174,7 @@ SCALAR_VISITOR_DEFAULT(MapScalar)
 SCALAR_VISITOR_DEFAULT(FixedSizeListScalar)
 SCALAR_VISITOR_DEFAULT(StructScalar)
 SCALAR_VISITOR_DEFAULT(DictionaryScalar)
+SCALAR_VISITOR_DEFAULT(RunEndEncodedScalar)
 SCALAR_VISITOR_DEFAULT(SparseUnionScalar)
 SCALAR_VISITOR_DEFAULT(DenseUnionScalar)
 SCALAR_VISITOR_DEFAULT(ExtensionScalar)
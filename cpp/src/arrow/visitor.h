@@ -48,6 +48,8 @@ class ARROW_EXPORT ArrayVisitor {
   virtual Status Visit(const BinaryArray& array);
   virtual Status Visit(const LargeStringArray& array);
   virtual Status Visit(const LargeBinaryArray& array);
+  virtual Status Visit(const StringViewArray& array);
+  virtual Status Visit(const BinaryViewArray& array);
   virtual Status Visit(const FixedSizeBinaryArray& array);
   virtual Status Visit(const Date32Array& array);
   virtual Status Visit(const Date64Array& array);
@@ -68,6 +70,7 @@ class ARROW_EXPORT ArrayVisitor {
   virtual Status Visit(const SparseUnionArray& array);
   virtual Status Visit(const DenseUnionArray& array);
   virtual Status Visit(const DictionaryArray& array);
+  virtual Status Visit(const RunEndEncodedArray& array);
   virtual Status Visit(const ExtensionArray& array);
 };
 
@@ -96,6 +99,8 @@ class ARROW_EXPORT TypeVisitor {
   virtual Status Visit(const BinaryType& type);
   virtual Status Visit(const LargeStringType& type);
   virtual Status Visit(const LargeBinaryType& type);
+  virtual Status Visit(const StringViewType& type);
+  virtual Status Visit(const BinaryViewType& type);
   virtual Status Visit(const FixedSizeBinaryType& type);
   virtual Status Visit(const Date64Type& type);
   virtual Status Visit(const Date32Type& type);
@@ -116,6 +121,7 @@ class ARROW_EXPORT TypeVisitor {
   virtual Status Visit(const SparseUnionType& type);
   virtual Status Visit(const DenseUnionType& type);
   virtual Status Visit(const DictionaryType& type);
+  virtual Status Visit(const RunEndEncodedType& type);
   virtual Status Visit(const ExtensionType& type);
 };
 
@@ -144,6 +150,8 @@ class ARROW_EXPORT ScalarVisitor {
   virtual Status Visit(const BinaryScalar& scalar);
   virtual Status Visit(const LargeStringScalar& scalar);
   virtual Status Visit(const LargeBinaryScalar& scalar);
+  virtual Status Visit(const StringViewScalar& scalar);
+  virtual Status Visit(const BinaryViewScalar& scalar);
   virtual Status Visit(const FixedSizeBinaryScalar& scalar);
   virtual Status Visit(const Date64Scalar& scalar);
   virtual Status Visit(const Date32Scalar& scalar);
@@ -162,6 +170,7 @@ class ARROW_EXPORT ScalarVisitor {
   virtual Status Visit(const FixedSizeListScalar& scalar);
   virtual Status Visit(const StructScalar& scalar);
   virtual Status Visit(const DictionaryScalar& scalar);
+  virtual Status Visit(const RunEndEncodedScalar& scalar);
   virtual Status Visit(const SparseUnionScalar& scalar);
   virtual Status Visit(const DenseUnionScalar& scalar);
   virtual Status Visit(const ExtensionScalar& scalar);
@@ -43,6 +43,8 @@ namespace arrow {
   ACTION(Binary);                               \
   ACTION(LargeString);                          \
   ACTION(LargeBinary);                          \
+  ACTION(StringView);                           \
+  ACTION(BinaryView);                           \
   ACTION(FixedSizeBinary);                      \
   ACTION(Duration);                             \
   ACTION(Date32);                               \
@@ -63,6 +65,7 @@ namespace arrow {
   ACTION(SparseUnion);                          \
   ACTION(DenseUnion);                           \
   ACTION(Dictionary);                           \
+  ACTION(RunEndEncoded);                        \
   ACTION(Extension)
 
 }  // namespace arrow
@@ -68,8 +68,10 @@ void Annotator::PrepareBuffersForField(const FieldDescriptor& desc,
                                        EvalBatch* eval_batch, bool is_output) {
   int buffer_idx = 0;
 
-  // The validity buffer is optional. Use nullptr if it does not have one.
-  if (array_data.buffers[buffer_idx]) {
+  // The validity buffer is optional. Use nullptr if it does not have one, or if an
+  // input has no nulls.
+  if (array_data.buffers[buffer_idx] &&
+      (is_output || array_data.GetNullCount() != 0)) {
     uint8_t* validity_buf = const_cast<uint8_t*>(array_data.buffers[buffer_idx]->data());
     eval_batch->SetBuffer(desc.validity_idx(), validity_buf, array_data.offset);
   } else {
@@ -121,4 +123,13 @@ EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
   return eval_batch;
 }
 
+bool Annotator::InputsHaveNoNulls(const EvalBatch& eval_batch) const {
+  for (const auto& entry : in_name_to_desc_) {
+    if (eval_batch.GetBuffer(entry.second->validity_idx()) != nullptr) {
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace gandiva
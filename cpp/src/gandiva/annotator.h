@@ -60,6 +60,9 @@ class GANDIVA_EXPORT Annotator {
   EvalBatchPtr PrepareEvalBatch(const arrow::RecordBatch& record_batch,
                                 const ArrayDataVector& out_vector);
 
+  /// Whether the input fields of the eval batch have no nulls.
+  bool InputsHaveNoNulls(const EvalBatch& eval_batch) const;
+
   int buffer_count() { return buffer_count_; }
 
  private:
@@ -17,6 +17,7 @@
 
 #include "gandiva/annotator.h"
 
+#include <cstring>
 #include <memory>
 #include <utility>
 
@@ -28,13 +29,14 @@ namespace gandiva {
 
 class TestAnnotator : public ::testing::Test {
  protected:
-  ArrayPtr MakeInt32Array(int length);
+  ArrayPtr MakeInt32Array(int length, uint8_t validity_byte = 0x55);
 };
 
-ArrayPtr TestAnnotator::MakeInt32Array(int length) {
+ArrayPtr TestAnnotator::MakeInt32Array(int length, uint8_t validity_byte) {
   arrow::Status status;
 
   auto validity = *arrow::AllocateBuffer((length + 63) / 8);
+  memset(validity->mutable_data(), validity_byte, validity->size());
 
   auto values = *arrow::AllocateBuffer(length * sizeof(int32_t));
 
@@ -97,6 +99,18 @@ TEST_F(TestAnnotator, TestAdd) {
 
   auto bitmaps = batch->GetLocalBitMapArray();
   EXPECT_EQ(bitmaps, nullptr);
+  EXPECT_FALSE(annotator.InputsHaveNoNulls(*batch));
+
+  // The validity of the inputs without nulls is not passed
+  record_batch = arrow::RecordBatch::Make(
+      in_schema, num_records,
+      {MakeInt32Array(num_records, 0xff), MakeInt32Array(num_records, 0xff)});
+  batch = annotator.PrepareEvalBatch(*record_batch, {arrow_sum->data()});
+  buffers = batch->GetBufferArray();
+  EXPECT_EQ(buffers[desc_a->validity_idx()], nullptr);
+  EXPECT_EQ(buffers[desc_b->validity_idx()], nullptr);
+  EXPECT_EQ(buffers[desc_sum->validity_idx()], arrow_sum->data()->buffers.at(0)->data());
+  EXPECT_TRUE(annotator.InputsHaveNoNulls(*batch));
 }
 
 }  // namespace gandiva
@@ -0,0 +1,220 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/async_evaluator.h"
+
+#include <utility>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/exec.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/thread_pool.h"
+
+#include "gandiva/expression_translator.h"
+#include "gandiva/local_bitmaps_holder.h"
+
+namespace gandiva {
+
+namespace cp = arrow::compute;
+
+namespace {
+
+// Translate an expression tree, and bind it to the schema.
+arrow::Result<cp::Expression> TranslateAndBind(const Node& node,
+                                               const arrow::Schema& schema) {
+  ARROW_ASSIGN_OR_RAISE(auto expr, TranslateToCompute(node));
+  return expr.Bind(schema);
+}
+
+arrow::internal::Executor* ExecutorOrDefault(arrow::internal::Executor* executor) {
+  return executor != NULLPTR ? executor : arrow::internal::GetCpuThreadPool();
+}
+
+}  // namespace
+
+AsyncProjector::AsyncProjector(SchemaPtr schema, ExpressionVector exprs,
+                               std::vector<cp::Expression> interpreted,
+                               arrow::Future<std::shared_ptr<Projector>> compiled)
+    : schema_(std::move(schema)),
+      exprs_(std::move(exprs)),
+      interpreted_(std::move(interpreted)),
+      compiled_(std::move(compiled)) {}
+
+Status AsyncProjector::Make(SchemaPtr schema, const ExpressionVector& exprs,
+                            std::shared_ptr<Configuration> configuration,
+                            std::shared_ptr<AsyncProjector>* projector,
+                            arrow::internal::Executor* executor) {
+  ARROW_RETURN_IF(schema == nullptr, Status::Invalid("Schema cannot be null"));
+  ARROW_RETURN_IF(exprs.empty(), Status::Invalid("Expressions cannot be empty"));
+  ARROW_RETURN_IF(configuration == nullptr,
+                  Status::Invalid("Configuration cannot be null"));
+
+  ARROW_ASSIGN_OR_RAISE(
+      auto compiled,
+      ExecutorOrDefault(executor)->Submit(
+          [schema, exprs, configuration]() -> arrow::Result<std::shared_ptr<Projector>> {
+            std::shared_ptr<Projector> projector;
+            ARROW_RETURN_NOT_OK(
+                Projector::Make(schema, exprs, configuration, &projector));
+            return projector;
+          }));
+
+  std::vector<cp::Expression> interpreted;
+  for (const auto& expr : exprs) {
+    auto maybe_bound = TranslateAndBind(*expr->root(), *schema);
+    if (!maybe_bound.ok()) {
+      // Wait for the compiled code instead
+      interpreted.clear();
+      break;
+    }
+    interpreted.push_back(maybe_bound.MoveValueUnsafe());
+  }
+
+  *projector = std::shared_ptr<AsyncProjector>(new AsyncProjector(
+      schema, exprs, std::move(interpreted), std::move(compiled)));
+  return Status::OK();
+}
+
+Status AsyncProjector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                                arrow::ArrayVector* output) {
+  if (!interpretable() || compiled_.is_finished()) {
+    ARROW_ASSIGN_OR_RAISE(auto projector, compiled_.result());
+    return projector->Evaluate(batch, pool, output);
+  }
+  return EvaluateInterpreted(batch, pool, output);
+}
+
+Status AsyncProjector::EvaluateInterpreted(const arrow::RecordBatch& batch,
+                                           arrow::MemoryPool* pool,
+                                           arrow::ArrayVector* output) {
+  ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+  ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
+                  Status::Invalid("Schema in RecordBatch must match schema in Make()"));
+  ARROW_RETURN_IF(batch.num_rows() == 0,
+                  Status::Invalid("RecordBatch must be non-empty."));
+
+  cp::ExecContext ctx(pool);
+  cp::ExecBatch input(batch);
+  arrow::ArrayVector arrays;
+  for (size_t i = 0; i < interpreted_.size(); i++) {
+    ARROW_ASSIGN_OR_RAISE(auto datum,
+                          cp::ExecuteScalarExpression(interpreted_[i], input, &ctx));
+    std::shared_ptr<arrow::Array> array;
+    if (datum.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(
+          array, arrow::MakeArrayFromScalar(*datum.scalar(), batch.num_rows(), pool));
+    } else {
+      array = datum.make_array();
+    }
+    // The kernels may pick a wider type than the function registry
+    const auto& type = exprs_[i]->result()->type();
+    if (!array->type()->Equals(*type)) {
+      ARROW_ASSIGN_OR_RAISE(datum,
+                            cp::Cast(array, type, cp::CastOptions::Safe(), &ctx));
+      array = datum.make_array();
+    }
+    arrays.push_back(std::move(array));
+  }
+  output->insert(output->end(), arrays.begin(), arrays.end());
+  return Status::OK();
+}
+
+AsyncFilter::AsyncFilter(SchemaPtr schema, cp::Expression interpreted,
+                         arrow::Future<std::shared_ptr<Filter>> compiled)
+    : schema_(std::move(schema)),
+      interpreted_(std::move(interpreted)),
+      compiled_(std::move(compiled)) {}
+
+Status AsyncFilter::Make(SchemaPtr schema, ConditionPtr condition,
+                         std::shared_ptr<Configuration> configuration,
+                         std::shared_ptr<AsyncFilter>* filter,
+                         arrow::internal::Executor* executor) {
+  ARROW_RETURN_IF(schema == nullptr, Status::Invalid("Schema cannot be null"));
+  ARROW_RETURN_IF(condition == nullptr, Status::Invalid("Condition cannot be null"));
+  ARROW_RETURN_IF(configuration == nullptr,
+                  Status::Invalid("Configuration cannot be null"));
+
+  ARROW_ASSIGN_OR_RAISE(
+      auto compiled,
+      ExecutorOrDefault(executor)->Submit(
+          [schema, condition, configuration]() -> arrow::Result<std::shared_ptr<Filter>> {
+            std::shared_ptr<Filter> filter;
+            ARROW_RETURN_NOT_OK(Filter::Make(schema, condition, configuration, &filter));
+            return filter;
+          }));
+
+  cp::Expression interpreted;
+  auto maybe_bound = TranslateAndBind(*condition->root(), *schema);
+  if (maybe_bound.ok() && maybe_bound->type()->id() == arrow::Type::BOOL) {
+    interpreted = maybe_bound.MoveValueUnsafe();
+  }
+
+  *filter = std::shared_ptr<AsyncFilter>(
+      new AsyncFilter(schema, std::move(interpreted), std::move(compiled)));
+  return Status::OK();
+}
+
+Status AsyncFilter::Evaluate(const arrow::RecordBatch& batch,
+                             std::shared_ptr<SelectionVector> out_selection) {
+  if (!interpretable() || compiled_.is_finished()) {
+    ARROW_ASSIGN_OR_RAISE(auto filter, compiled_.result());
+    return filter->Evaluate(batch, std::move(out_selection));
+  }
+  return EvaluateInterpreted(batch, out_selection.get());
+}
+
+Status AsyncFilter::EvaluateInterpreted(const arrow::RecordBatch& batch,
+                                        SelectionVector* out_selection) {
+  const auto num_rows = batch.num_rows();
+  ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
+                  Status::Invalid("RecordBatch schema must expected filter schema"));
+  ARROW_RETURN_IF(num_rows == 0, Status::Invalid("RecordBatch must be non-empty."));
+  ARROW_RETURN_IF(out_selection == nullptr,
+                  Status::Invalid("out_selection must be non-null."));
+  ARROW_RETURN_IF(out_selection->GetMaxSlots() < num_rows,
+                  Status::Invalid("Output selection vector capacity too small"));
+
+  ARROW_ASSIGN_OR_RAISE(auto datum,
+                        cp::ExecuteScalarExpression(interpreted_, cp::ExecBatch(batch)));
+
+  // Rows with a null condition are not selected
+  LocalBitMapsHolder bitmaps(num_rows, 1 /*local_bitmaps*/);
+  uint8_t* result = bitmaps.GetLocalBitMap(0);
+  if (datum.is_scalar()) {
+    const auto& scalar = arrow::internal::checked_cast<const arrow::BooleanScalar&>(
+        *datum.scalar());
+    arrow::bit_util::SetBitsTo(result, 0, num_rows, scalar.is_valid && scalar.value);
+  } else {
+    const auto& data = *datum.array();
+    arrow::internal::CopyBitmap(data.buffers[1]->data(), data.offset, num_rows, result,
+                                0);
+    if (data.MayHaveNulls()) {
+      arrow::internal::BitmapAnd(result, 0, data.buffers[0]->data(), data.offset,
+                                 num_rows, 0, result);
+    }
+  }
+  return out_selection->PopulateFromBitMap(result, bitmaps.GetLocalBitMapSize(),
+                                           num_rows - 1);
+}
+
+}  // namespace gandiva
@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/exec/expression.h"
+#include "arrow/status.h"
+#include "arrow/util/future.h"
+#include "arrow/util/type_fwd.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/condition.h"
+#include "gandiva/configuration.h"
+#include "gandiva/expression.h"
+#include "gandiva/filter.h"
+#include "gandiva/projector.h"
+#include "gandiva/selection_vector.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Projector whose code is compiled in the background.
+///
+/// Make() returns at once and submits the build of a regular Projector to an
+/// executor. Until the build finishes, batches are evaluated with the Arrow
+/// compute kernels, if all the expressions can be translated to compute
+/// expressions (see TranslateToCompute); else, Evaluate waits for the build.
+/// Once the build finishes, batches are evaluated with the compiled code, or
+/// fail with the build error.
+class GANDIVA_EXPORT AsyncProjector {
+ public:
+  /// Start building a projector for the given schema to evaluate the vector of
+  /// expressions.
+  ///
+  /// \param[in] schema schema for the record batches, and the expressions.
+  /// \param[in] exprs vector of expressions.
+  /// \param[in] configuration run time configuration.
+  /// \param[out] projector the returned projector object
+  /// \param[in] executor the executor running the build, the CPU thread pool
+  ///            by default.
+  static Status Make(SchemaPtr schema, const ExpressionVector& exprs,
+                     std::shared_ptr<Configuration> configuration,
+                     std::shared_ptr<AsyncProjector>* projector,
+                     arrow::internal::Executor* executor = NULLPTR);
+
+  /// Evaluate the specified record batch, and return the allocated and populated output
+  /// arrays. The output arrays will be allocated from the memory pool 'pool', and added
+  /// to the vector 'output'.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] pool memory pool used to allocate output arrays (if required).
+  /// \param[out] output the vector of allocated/populated arrays.
+  Status Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                  arrow::ArrayVector* output);
+
+  /// Whether the expressions can be evaluated before the build finishes.
+  bool interpretable() const { return !interpreted_.empty(); }
+
+  /// The build of the compiled projector.
+  const arrow::Future<std::shared_ptr<Projector>>& compiled() const { return compiled_; }
+
+ private:
+  AsyncProjector(SchemaPtr schema, ExpressionVector exprs,
+                 std::vector<arrow::compute::Expression> interpreted,
+                 arrow::Future<std::shared_ptr<Projector>> compiled);
+
+  Status EvaluateInterpreted(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                             arrow::ArrayVector* output);
+
+  const SchemaPtr schema_;
+  const ExpressionVector exprs_;
+  // Bound to the schema, empty if any of the expressions is not translatable
+  const std::vector<arrow::compute::Expression> interpreted_;
+  const arrow::Future<std::shared_ptr<Projector>> compiled_;
+};
+
+/// \brief Filter whose code is compiled in the background.
+///
+/// The counterpart of AsyncProjector for a Filter.
+class GANDIVA_EXPORT AsyncFilter {
+ public:
+  /// Start building a filter for the given schema to evaluate the condition.
+  ///
+  /// \param[in] schema schema for the record batches, and the condition.
+  /// \param[in] condition filter condition.
+  /// \param[in] configuration run time configuration.
+  /// \param[out] filter the returned filter object
+  /// \param[in] executor the executor running the build, the CPU thread pool
+  ///            by default.
+  static Status Make(SchemaPtr schema, ConditionPtr condition,
+                     std::shared_ptr<Configuration> configuration,
+                     std::shared_ptr<AsyncFilter>* filter,
+                     arrow::internal::Executor* executor = NULLPTR);
+
+  /// Evaluate the specified record batch, and populate output selection vector.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in,out] out_selection the selection array with indices of rows that match
+  ///                the condition.
+  Status Evaluate(const arrow::RecordBatch& batch,
+                  std::shared_ptr<SelectionVector> out_selection);
+
+  /// Whether the condition can be evaluated before the build finishes.
+  bool interpretable() const { return interpreted_.IsBound(); }
+
+  /// The build of the compiled filter.
+  const arrow::Future<std::shared_ptr<Filter>>& compiled() const { return compiled_; }
+
+ private:
+  AsyncFilter(SchemaPtr schema, arrow::compute::Expression interpreted,
+              arrow::Future<std::shared_ptr<Filter>> compiled);
+
+  Status EvaluateInterpreted(const arrow::RecordBatch& batch,
+                             SelectionVector* out_selection);
+
+  const SchemaPtr schema_;
+  // Bound to the schema, unbound if the condition is not translatable
+  const arrow::compute::Expression interpreted_;
+  const arrow::Future<std::shared_ptr<Filter>> compiled_;
+};
+
+}  // namespace gandiva
@@ -17,6 +17,8 @@
 
 #include "gandiva/cache.h"
 
+#include <sstream>
+
 #include "arrow/result.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
@@ -28,6 +30,7 @@ static const size_t DEFAULT_CACHE_SIZE = 500000;
 #else
 static const size_t DEFAULT_CACHE_SIZE = 500;
 #endif
+static const size_t DEFAULT_CACHE_CAPACITY_BYTES = 256ULL << 20;
 
 int GetCapacity() {
   size_t capacity = DEFAULT_CACHE_SIZE;
@@ -46,8 +49,41 @@ int GetCapacity() {
   return static_cast<int>(capacity);
 }
 
+size_t GetCapacityBytes() {
+  size_t capacity = DEFAULT_CACHE_CAPACITY_BYTES;
+  auto maybe_env_capacity = ::arrow::internal::GetEnvVar("GANDIVA_CACHE_CAPACITY_BYTES");
+  if (maybe_env_capacity.ok()) {
+    const auto env_capacity = *std::move(maybe_env_capacity);
+    if (!env_capacity.empty()) {
+      const long long parsed = std::atoll(env_capacity.c_str());  // NOLINT
+      if (parsed <= 0) {
+        ARROW_LOG(WARNING) << "Invalid cache capacity provided in "
+                           << "GANDIVA_CACHE_CAPACITY_BYTES. Using default capacity: "
+                           << DEFAULT_CACHE_CAPACITY_BYTES;
+      } else {
+        capacity = static_cast<size_t>(parsed);
+      }
+    }
+  }
+  return capacity;
+}
+
 void LogCacheSize(size_t capacity) {
   ARROW_LOG(INFO) << "Creating gandiva cache with capacity of " << capacity;
 }
 
+void LogCacheSize(size_t capacity, size_t capacity_bytes) {
+  ARROW_LOG(INFO) << "Creating gandiva cache with capacity of " << capacity
+                  << " entries and " << capacity_bytes << " bytes";
+}
+
+std::string CacheStats::ToString() const {
+  std::stringstream ss;
+  ss << "CacheStats<entries=" << num_entries << ", bytes=" << size_bytes
+     << ", hits=" << hits << ", misses=" << misses << ", evictions=" << evictions
+     << ", compilations=" << num_compilations
+     << ", compile_ms=" << static_cast<double>(compile_nanos) / 1e6 << ">";
+  return ss.str();
+}
+
 }  // namespace gandiva
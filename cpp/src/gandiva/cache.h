@@ -17,8 +17,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstdlib>
 #include <mutex>
+#include <string>
 
 #include "gandiva/lru_cache.h"
 #include "gandiva/visibility.h"
@@ -28,30 +30,92 @@ namespace gandiva {
 GANDIVA_EXPORT
 int GetCapacity();
 
+/// \brief The capacity of the cache in bytes of object code, set by the
+/// GANDIVA_CACHE_CAPACITY_BYTES environment variable.
+GANDIVA_EXPORT
+size_t GetCapacityBytes();
+
 GANDIVA_EXPORT
 void LogCacheSize(size_t capacity);
 
+GANDIVA_EXPORT
+void LogCacheSize(size_t capacity, size_t capacity_bytes);
+
+/// \brief Statistics of the cache of compiled expressions.
+struct GANDIVA_EXPORT CacheStats {
+  /// \brief Number of cached objects.
+  int64_t num_entries = 0;
+  /// \brief Total size of the cached objects, in bytes.
+  int64_t size_bytes = 0;
+  /// \brief Number of builds which found their object in the cache.
+  int64_t hits = 0;
+  /// \brief Number of builds which did not, and either compiled their
+  ///   object or loaded it from the disk cache.
+  int64_t misses = 0;
+  /// \brief Number of objects evicted to make room for others.
+  int64_t evictions = 0;
+  /// \brief Number of compilations by LLVM.
+  int64_t num_compilations = 0;
+  /// \brief Time spent in the compilations, in nanoseconds.
+  int64_t compile_nanos = 0;
+
+  std::string ToString() const;
+};
+
+/// \brief Get the statistics of the cache used by Projector and Filter.
+GANDIVA_EXPORT
+CacheStats GetCacheStats();
+
 template <class KeyType, typename ValueType>
 class Cache {
  public:
   explicit Cache(size_t capacity) : cache_(capacity) { LogCacheSize(capacity); }
 
-  Cache() : Cache(GetCapacity()) {}
+  Cache(size_t capacity, size_t capacity_bytes) : cache_(capacity, capacity_bytes) {
+    LogCacheSize(capacity, capacity_bytes);
+  }
+
+  Cache() : Cache(GetCapacity(), GetCapacityBytes()) {}
 
   ValueType GetObjectCode(const KeyType& cache_key) {
     arrow::util::optional<ValueType> result;
     std::lock_guard<std::mutex> lock(mtx_);
     result = cache_.get(cache_key);
-    return result != arrow::util::nullopt ? *result : nullptr;
+    if (result != arrow::util::nullopt) {
+      ++stats_.hits;
+      return *result;
+    }
+    ++stats_.misses;
+    return nullptr;
+  }
+
+  /// \param[in] size the size of the object code, counted against the
+  ///   capacity in bytes
+  void PutObjectCode(const KeyType& cache_key, const ValueType& module,
+                     size_t size = 0) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    cache_.insert(cache_key, module, size);
+  }
+
+  /// \brief Account for the compilation of an object missing from the cache.
+  void RecordCompilation(int64_t nanos) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    ++stats_.num_compilations;
+    stats_.compile_nanos += nanos;
   }
 
-  void PutObjectCode(const KeyType& cache_key, const ValueType& module) {
+  CacheStats stats() {
     std::lock_guard<std::mutex> lock(mtx_);
-    cache_.insert(cache_key, module);
+    CacheStats stats = stats_;
+    stats.num_entries = static_cast<int64_t>(cache_.size());
+    stats.size_bytes = static_cast<int64_t>(cache_.total_size());
+    stats.evictions = cache_.num_evictions();
+    return stats;
   }
 
  private:
   LruCache<KeyType, ValueType> cache_;
+  CacheStats stats_;
   std::mutex mtx_;
 };
 }  // namespace gandiva
@@ -54,6 +54,15 @@ class CompiledExpr {
     return jit_functions_[static_cast<int>(mode)];
   }
 
+  void SetNullFreeJITFunction(SelectionVector::Mode mode, EvalFunc jit_function) {
+    null_free_jit_functions_[static_cast<int>(mode)] = jit_function;
+  }
+
+  /// The variant for inputs without nulls, null if not generated.
+  EvalFunc GetNullFreeJITFunction(SelectionVector::Mode mode) const {
+    return null_free_jit_functions_[static_cast<int>(mode)];
+  }
+
  private:
   // value & validities for the expression tree (root)
   ValueValidityPairPtr value_validity_;
@@ -66,6 +75,9 @@ class CompiledExpr {
 
   // JIT functions in the generated code (set after the module is optimised and finalized)
   std::array<EvalFunc, SelectionVector::kNumModes> jit_functions_;
+
+  // JIT functions of the variants for inputs without nulls
+  std::array<EvalFunc, SelectionVector::kNumModes> null_free_jit_functions_ = {};
 };
 
 }  // namespace gandiva
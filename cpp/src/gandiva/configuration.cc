@@ -29,11 +29,13 @@ std::size_t Configuration::Hash() const {
   size_t result = kHashSeed;
   arrow::internal::hash_combine(result, static_cast<size_t>(optimize_));
   arrow::internal::hash_combine(result, static_cast<size_t>(target_host_cpu_));
+  arrow::internal::hash_combine(result, static_cast<size_t>(null_free_variants_));
   return result;
 }
 
 bool Configuration::operator==(const Configuration& other) const {
-  return optimize_ == other.optimize_ && target_host_cpu_ == other.target_host_cpu_;
+  return optimize_ == other.optimize_ && target_host_cpu_ == other.target_host_cpu_ &&
+         null_free_variants_ == other.null_free_variants_;
 }
 
 bool Configuration::operator!=(const Configuration& other) const {
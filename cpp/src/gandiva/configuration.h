@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -34,8 +35,16 @@ class GANDIVA_EXPORT Configuration {
  public:
   friend class ConfigurationBuilder;
 
-  Configuration() : optimize_(true), target_host_cpu_(true) {}
-  explicit Configuration(bool optimize) : optimize_(optimize), target_host_cpu_(true) {}
+  Configuration()
+      : optimize_(true),
+        target_host_cpu_(true),
+        null_free_variants_(false),
+        parallel_slice_rows_(0) {}
+  explicit Configuration(bool optimize)
+      : optimize_(optimize),
+        target_host_cpu_(true),
+        null_free_variants_(false),
+        parallel_slice_rows_(0) {}
 
   std::size_t Hash() const;
   bool operator==(const Configuration& other) const;
@@ -43,13 +52,34 @@ class GANDIVA_EXPORT Configuration {
 
   bool optimize() const { return optimize_; }
   bool target_host_cpu() const { return target_host_cpu_; }
+  bool null_free_variants() const { return null_free_variants_; }
+  int64_t parallel_slice_rows() const { return parallel_slice_rows_; }
 
   void set_optimize(bool optimize) { optimize_ = optimize; }
   void target_host_cpu(bool target_host_cpu) { target_host_cpu_ = target_host_cpu; }
 
+  /// Also generate, for the expressions checking the validity of their inputs in
+  /// the evaluation loop, a variant used on the batches without nulls in the
+  /// inputs. The validity checks fold away in the variant, which lets the loop be
+  /// vectorized, at the cost of a longer compilation. Off by default.
+  void set_null_free_variants(bool null_free_variants) {
+    null_free_variants_ = null_free_variants;
+  }
+
+  /// Split the batches of more than the given number of rows into slices of
+  /// (about) that many rows, and evaluate the slices concurrently on the CPU
+  /// thread pool. 0, the default, evaluates the batches on the calling thread.
+  ///
+  /// Only applies to the evaluations without a selection vector. Expressions
+  /// using stateful functions (e.g. random) should not be evaluated in slices.
+  void set_parallel_slice_rows(int64_t rows) { parallel_slice_rows_ = rows; }
+
  private:
   bool optimize_;        /* optimise the generated llvm IR */
   bool target_host_cpu_; /* set the mcpu flag to host cpu while compiling llvm ir */
+  bool null_free_variants_; /* generate variants for inputs without nulls */
+  /* rows per slice evaluated concurrently, does not change the generated code */
+  int64_t parallel_slice_rows_;
 };
 
 /// \brief configuration builder for gandiva
@@ -0,0 +1,237 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/exec_nodes.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/expression.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/datum.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+#include "gandiva/configuration.h"
+#include "gandiva/expression_translator.h"
+#include "gandiva/filter.h"
+#include "gandiva/projector.h"
+#include "gandiva/selection_vector.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+namespace cp = arrow::compute;
+
+using arrow::internal::checked_cast;
+
+namespace {
+
+class GandivaProjectNode : public cp::MapNode {
+ public:
+  GandivaProjectNode(cp::ExecPlan* plan, std::vector<cp::ExecNode*> inputs,
+                     std::shared_ptr<arrow::Schema> output_schema,
+                     std::vector<cp::Expression> exprs,
+                     std::shared_ptr<Projector> projector, bool async_mode)
+      : MapNode(plan, std::move(inputs), std::move(output_schema), async_mode),
+        exprs_(std::move(exprs)),
+        projector_(std::move(projector)) {}
+
+  static arrow::Result<cp::ExecNode*> Make(cp::ExecPlan* plan,
+                                           std::vector<cp::ExecNode*> inputs,
+                                           const cp::ExecNodeOptions& options) {
+    ARROW_RETURN_NOT_OK(
+        cp::ValidateExecNodeInputs(plan, inputs, 1, "GandivaProjectNode"));
+    const auto& input_schema = inputs[0]->output_schema();
+
+    const auto& project_options = checked_cast<const cp::ProjectNodeOptions&>(options);
+    auto exprs = project_options.expressions;
+    auto names = project_options.names;
+    if (names.size() == 0) {
+      names.resize(exprs.size());
+      for (size_t i = 0; i < exprs.size(); ++i) {
+        names[i] = exprs[i].ToString();
+      }
+    }
+
+    arrow::FieldVector fields(exprs.size());
+    ExpressionVector trees(exprs.size());
+    for (size_t i = 0; i < exprs.size(); ++i) {
+      if (!exprs[i].IsBound()) {
+        ARROW_ASSIGN_OR_RAISE(exprs[i],
+                              exprs[i].Bind(*input_schema, plan->exec_context()));
+      }
+      fields[i] = arrow::field(std::move(names[i]), exprs[i].type());
+      ARROW_ASSIGN_OR_RAISE(auto root, TranslateFromCompute(exprs[i], *input_schema));
+      trees[i] = TreeExprBuilder::MakeExpression(std::move(root), fields[i]);
+    }
+
+    std::shared_ptr<Projector> projector;
+    ARROW_RETURN_NOT_OK(Projector::Make(
+        input_schema, trees, ConfigurationBuilder::DefaultConfiguration(), &projector));
+    return plan->EmplaceNode<GandivaProjectNode>(
+        plan, std::move(inputs), arrow::schema(std::move(fields)), std::move(exprs),
+        std::move(projector), project_options.async_mode);
+  }
+
+  const char* kind_name() const override { return "GandivaProjectNode"; }
+
+  arrow::Result<cp::ExecBatch> DoProject(const cp::ExecBatch& batch) {
+    auto pool = plan()->exec_context()->memory_pool();
+    std::vector<arrow::Datum> values;
+    if (batch.length == 0) {
+      // The projector rejects empty batches
+      for (const auto& field : output_schema_->fields()) {
+        ARROW_ASSIGN_OR_RAISE(auto empty, arrow::MakeEmptyArray(field->type(), pool));
+        values.emplace_back(std::move(empty));
+      }
+      return cp::ExecBatch{std::move(values), 0};
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto record_batch,
+                          batch.ToRecordBatch(inputs_[0]->output_schema(), pool));
+    arrow::ArrayVector outputs;
+    ARROW_RETURN_NOT_OK(projector_->Evaluate(*record_batch, pool, &outputs));
+    for (auto& output : outputs) {
+      values.emplace_back(std::move(output));
+    }
+    return cp::ExecBatch{std::move(values), batch.length};
+  }
+
+  void InputReceived(cp::ExecNode* input, cp::ExecBatch batch) override {
+    DCHECK_EQ(input, inputs_[0]);
+    auto func = [this](cp::ExecBatch batch) { return DoProject(std::move(batch)); };
+    this->SubmitTask(std::move(func), std::move(batch));
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    ss << "projection=[";
+    for (size_t i = 0; i < exprs_.size(); i++) {
+      if (i > 0) ss << ", ";
+      auto repr = exprs_[i].ToString();
+      const auto& name = output_schema_->field(static_cast<int>(i))->name();
+      if (repr != name) {
+        ss << '"' << name << "\": ";
+      }
+      ss << repr;
+    }
+    ss << ']';
+    return ss.str();
+  }
+
+ private:
+  std::vector<cp::Expression> exprs_;
+  std::shared_ptr<Projector> projector_;
+};
+
+class GandivaFilterNode : public cp::MapNode {
+ public:
+  GandivaFilterNode(cp::ExecPlan* plan, std::vector<cp::ExecNode*> inputs,
+                    std::shared_ptr<arrow::Schema> output_schema, cp::Expression filter,
+                    std::shared_ptr<Filter> gandiva_filter, bool async_mode)
+      : MapNode(plan, std::move(inputs), std::move(output_schema), async_mode),
+        filter_(std::move(filter)),
+        gandiva_filter_(std::move(gandiva_filter)) {}
+
+  static arrow::Result<cp::ExecNode*> Make(cp::ExecPlan* plan,
+                                           std::vector<cp::ExecNode*> inputs,
+                                           const cp::ExecNodeOptions& options) {
+    ARROW_RETURN_NOT_OK(cp::ValidateExecNodeInputs(plan, inputs, 1, "GandivaFilterNode"));
+    auto schema = inputs[0]->output_schema();
+
+    const auto& filter_options = checked_cast<const cp::FilterNodeOptions&>(options);
+    auto filter_expression = filter_options.filter_expression;
+    if (!filter_expression.IsBound()) {
+      ARROW_ASSIGN_OR_RAISE(filter_expression,
+                            filter_expression.Bind(*schema, plan->exec_context()));
+    }
+    if (filter_expression.type()->id() != arrow::Type::BOOL) {
+      return Status::TypeError("Filter expression must evaluate to bool, but ",
+                               filter_expression.ToString(), " evaluates to ",
+                               filter_expression.type()->ToString());
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto root, TranslateFromCompute(filter_expression, *schema));
+    std::shared_ptr<Filter> gandiva_filter;
+    ARROW_RETURN_NOT_OK(Filter::Make(schema, TreeExprBuilder::MakeCondition(root),
+                                     ConfigurationBuilder::DefaultConfiguration(),
+                                     &gandiva_filter));
+    return plan->EmplaceNode<GandivaFilterNode>(
+        plan, std::move(inputs), std::move(schema), std::move(filter_expression),
+        std::move(gandiva_filter), filter_options.async_mode);
+  }
+
+  const char* kind_name() const override { return "GandivaFilterNode"; }
+
+  // As the "filter" node, the rows passing the filter are selected by the
+  // selection vector of the output batch.
+  arrow::Result<cp::ExecBatch> DoFilter(const cp::ExecBatch& target) {
+    if (target.length == 0) {
+      return target;
+    }
+    auto pool = plan()->exec_context()->memory_pool();
+    ARROW_ASSIGN_OR_RAISE(auto record_batch, target.ToRecordBatch(output_schema_, pool));
+    std::shared_ptr<SelectionVector> selection;
+    ARROW_RETURN_NOT_OK(SelectionVector::MakeInt32(target.length, pool, &selection));
+    ARROW_RETURN_NOT_OK(gandiva_filter_->Evaluate(*record_batch, selection));
+    if (selection->GetNumSlots() == target.length) {
+      return target;
+    }
+
+    // The uint32 slots are the int32 indices of the selection vector
+    auto indices = selection->ToArray()->data()->Copy();
+    indices->type = arrow::int32();
+    cp::ExecBatch out = target;
+    out.selection_vector = std::make_shared<cp::SelectionVector>(std::move(indices));
+    out.length = out.selection_vector->length();
+    return out;
+  }
+
+  void InputReceived(cp::ExecNode* input, cp::ExecBatch batch) override {
+    DCHECK_EQ(input, inputs_[0]);
+    auto func = [this](cp::ExecBatch batch) { return DoFilter(std::move(batch)); };
+    this->SubmitTask(std::move(func), std::move(batch));
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    return "filter=" + filter_.ToString();
+  }
+
+ private:
+  cp::Expression filter_;
+  std::shared_ptr<Filter> gandiva_filter_;
+};
+
+}  // namespace
+
+Status RegisterExecNodes(cp::ExecFactoryRegistry* registry) {
+  ARROW_RETURN_NOT_OK(registry->AddFactory("gandiva_project", GandivaProjectNode::Make));
+  return registry->AddFactory("gandiva_filter", GandivaFilterNode::Make);
+}
+
+}  // namespace gandiva
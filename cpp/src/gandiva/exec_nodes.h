@@ -0,0 +1,41 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/status.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Register the "gandiva_project" and "gandiva_filter" exec nodes.
+///
+/// The nodes take the same options as the "project" and "filter" nodes
+/// (ProjectNodeOptions and FilterNodeOptions), translate the expressions to
+/// expression trees (see TranslateFromCompute), and evaluate them with a
+/// Projector or a Filter, whose code is built when the node is made. Making a
+/// node fails if an expression cannot be translated.
+///
+/// The filter node emits batches with a selection vector, as the "filter" node.
+GANDIVA_EXPORT
+Status RegisterExecNodes(arrow::compute::ExecFactoryRegistry* registry =
+                             arrow::compute::default_exec_factory_registry());
+
+}  // namespace gandiva
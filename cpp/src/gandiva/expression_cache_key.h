@@ -19,6 +19,8 @@
 
 #include <stddef.h>
 
+#include <sstream>
+#include <string>
 #include <thread>
 
 #include "arrow/util/hash_util.h"
@@ -67,6 +69,18 @@ class ExpressionCacheKey {
     hash_code_ = result;
   }
 
+  ExpressionCacheKey(SchemaPtr schema, std::shared_ptr<Configuration> configuration,
+                     Expression& condition, ExpressionVector expression_vector,
+                     SelectionVector::Mode mode)
+      : ExpressionCacheKey(schema, configuration, expression_vector, mode) {
+    // Distinct from the keys of projectors with the condition as first expression
+    std::string condition_as_string = "condition " + condition.ToString();
+    expressions_as_strings_.insert(expressions_as_strings_.begin(), condition_as_string);
+    UpdateUniqifier(condition_as_string);
+    arrow::internal::hash_combine(hash_code_, condition_as_string);
+    arrow::internal::hash_combine(hash_code_, uniqifier_);
+  }
+
   void UpdateUniqifier(const std::string& expr) {
     if (uniqifier_ == 0) {
       // caching of expressions with re2 patterns causes lock contention. So, use
@@ -79,6 +93,23 @@ class ExpressionCacheKey {
 
   size_t Hash() const { return hash_code_; }
 
+  /// \brief A description of the key which is the same in every process,
+  /// for persistent caches.
+  ///
+  /// The uniqifier is left out: it only spreads the in-memory entries.
+  std::string ToStableString() const {
+    std::stringstream ss;
+    const std::string schema = schema_->ToString(/*show_metadata=*/true);
+    ss << "mode:" << static_cast<int>(mode_) << ";optimize:" << configuration_->optimize()
+       << ";target_host_cpu:" << configuration_->target_host_cpu()
+       << ";null_free_variants:" << configuration_->null_free_variants() << ";schema:"
+       << schema.size() << ":" << schema;
+    for (const auto& expr : expressions_as_strings_) {
+      ss << ";expr:" << expr.size() << ":" << expr;
+    }
+    return ss.str();
+  }
+
   bool operator==(const ExpressionCacheKey& other) const {
     if (hash_code_ != other.hash_code_) {
       return false;
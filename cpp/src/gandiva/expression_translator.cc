@@ -0,0 +1,325 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/expression_translator.h"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/api_scalar.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+#include "gandiva/node.h"
+#include "gandiva/node_visitor.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+namespace cp = arrow::compute;
+
+using arrow::internal::checked_cast;
+
+namespace {
+
+// Gandiva function name -> (arrow compute function name, arity)
+const std::unordered_map<std::string, std::pair<std::string, size_t>>& FunctionMap() {
+  static const std::unordered_map<std::string, std::pair<std::string, size_t>> map = {
+      {"add", {"add", 2}},
+      {"subtract", {"subtract", 2}},
+      {"multiply", {"multiply", 2}},
+      {"divide", {"divide", 2}},
+      {"negative", {"negate", 1}},
+      {"abs", {"abs", 1}},
+      {"equal", {"equal", 2}},
+      {"not_equal", {"not_equal", 2}},
+      {"less_than", {"less", 2}},
+      {"less_than_or_equal_to", {"less_equal", 2}},
+      {"greater_than", {"greater", 2}},
+      {"greater_than_or_equal_to", {"greater_equal", 2}},
+      {"not", {"invert", 1}},
+      {"isnull", {"is_null", 1}},
+      {"isnotnull", {"is_valid", 1}},
+  };
+  return map;
+}
+
+// Converts the value of a literal to a scalar of the literal's type.
+struct LiteralToScalar {
+  template <typename T>
+  arrow::Result<std::shared_ptr<arrow::Scalar>> operator()(const T& value) {
+    return arrow::MakeScalar(type, value);
+  }
+
+  arrow::Result<std::shared_ptr<arrow::Scalar>> operator()(const std::string& value) {
+    return arrow::MakeScalar(type, arrow::Buffer::FromString(value));
+  }
+
+  arrow::Result<std::shared_ptr<arrow::Scalar>> operator()(const DecimalScalar128&) {
+    return Status::NotImplemented("Translation of decimal literals");
+  }
+
+  const DataTypePtr& type;
+};
+
+class ComputeTranslator : public NodeVisitor {
+ public:
+  arrow::Result<cp::Expression> Translate(const Node& node) {
+    ARROW_RETURN_NOT_OK(node.Accept(*this));
+    return std::move(result_);
+  }
+
+  Status Visit(const FieldNode& node) override {
+    result_ = cp::field_ref(node.field()->name());
+    return Status::OK();
+  }
+
+  Status Visit(const LiteralNode& node) override {
+    if (node.is_null()) {
+      result_ = cp::literal(arrow::MakeNullScalar(node.return_type()));
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto scalar, arrow::util::visit(
+                                           LiteralToScalar{node.return_type()},
+                                           node.holder()));
+    result_ = cp::literal(std::move(scalar));
+    return Status::OK();
+  }
+
+  Status Visit(const FunctionNode& node) override {
+    const auto& name = node.descriptor()->name();
+    auto it = FunctionMap().find(name);
+    if (it == FunctionMap().end() || it->second.second != node.children().size()) {
+      return Status::NotImplemented("Translation of function ", name);
+    }
+    // Gandiva fails on a float division by zero, the kernels return infinity
+    if (name == "divide" && !arrow::is_integer(node.return_type()->id())) {
+      return Status::NotImplemented("Translation of non-integer divisions");
+    }
+    ARROW_ASSIGN_OR_RAISE(auto args, TranslateAll(node.children()));
+    result_ = cp::call(it->second.first, std::move(args));
+    return Status::OK();
+  }
+
+  Status Visit(const IfNode& node) override {
+    ARROW_ASSIGN_OR_RAISE(auto condition, Translate(*node.condition()));
+    ARROW_ASSIGN_OR_RAISE(auto then_expr, Translate(*node.then_node()));
+    ARROW_ASSIGN_OR_RAISE(auto else_expr, Translate(*node.else_node()));
+    // A null condition selects the else branch
+    result_ = cp::call("if_else", {cp::call("coalesce", {std::move(condition),
+                                                         cp::literal(false)}),
+                                   std::move(then_expr), std::move(else_expr)});
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanNode& node) override {
+    ARROW_ASSIGN_OR_RAISE(auto args, TranslateAll(node.children()));
+    const char* function =
+        node.expr_type() == BooleanNode::AND ? "and_kleene" : "or_kleene";
+    cp::Expression expr = std::move(args[0]);
+    for (size_t i = 1; i < args.size(); i++) {
+      expr = cp::call(function, {std::move(expr), std::move(args[i])});
+    }
+    result_ = std::move(expr);
+    return Status::OK();
+  }
+
+  Status Visit(const InExpressionNode<int32_t>&) override { return InNotImplemented(); }
+  Status Visit(const InExpressionNode<int64_t>&) override { return InNotImplemented(); }
+  Status Visit(const InExpressionNode<float>&) override { return InNotImplemented(); }
+  Status Visit(const InExpressionNode<double>&) override { return InNotImplemented(); }
+  Status Visit(const InExpressionNode<DecimalScalar128>&) override {
+    return InNotImplemented();
+  }
+  Status Visit(const InExpressionNode<std::string>&) override {
+    return InNotImplemented();
+  }
+
+ private:
+  arrow::Result<std::vector<cp::Expression>> TranslateAll(const NodeVector& nodes) {
+    std::vector<cp::Expression> out;
+    for (const auto& node : nodes) {
+      ARROW_ASSIGN_OR_RAISE(auto expr, Translate(*node));
+      out.push_back(std::move(expr));
+    }
+    return out;
+  }
+
+  Status InNotImplemented() {
+    return Status::NotImplemented("Translation of IN clauses");
+  }
+
+  cp::Expression result_;
+};
+
+// Arrow compute function name -> Gandiva function name, for the functions computing
+// the same values in both.
+const std::unordered_map<std::string, std::string>& InverseFunctionMap() {
+  static const std::unordered_map<std::string, std::string> map = {
+      {"add", "add"},
+      {"subtract", "subtract"},
+      {"multiply", "multiply"},
+      {"negate", "negative"},
+      {"equal", "equal"},
+      {"not_equal", "not_equal"},
+      {"less", "less_than"},
+      {"less_equal", "less_than_or_equal_to"},
+      {"greater", "greater_than"},
+      {"greater_equal", "greater_than_or_equal_to"},
+      {"invert", "not"},
+      {"is_valid", "isnotnull"},
+      {"utf8_upper", "upper"},
+      {"utf8_lower", "lower"},
+  };
+  return map;
+}
+
+arrow::Result<NodePtr> ScalarToLiteral(const arrow::Scalar& scalar) {
+  if (!scalar.is_valid) {
+    return TreeExprBuilder::MakeNull(scalar.type);
+  }
+  switch (scalar.type->id()) {
+    case arrow::Type::BOOL:
+      return TreeExprBuilder::MakeLiteral(
+          checked_cast<const arrow::BooleanScalar&>(scalar).value);
+#define LITERAL_CASE(TYPE_ID, SCALAR_TYPE) \
+  case arrow::Type::TYPE_ID:               \
+    return TreeExprBuilder::MakeLiteral(checked_cast<const SCALAR_TYPE&>(scalar).value);
+      LITERAL_CASE(INT8, arrow::Int8Scalar)
+      LITERAL_CASE(INT16, arrow::Int16Scalar)
+      LITERAL_CASE(INT32, arrow::Int32Scalar)
+      LITERAL_CASE(INT64, arrow::Int64Scalar)
+      LITERAL_CASE(UINT8, arrow::UInt8Scalar)
+      LITERAL_CASE(UINT16, arrow::UInt16Scalar)
+      LITERAL_CASE(UINT32, arrow::UInt32Scalar)
+      LITERAL_CASE(UINT64, arrow::UInt64Scalar)
+      LITERAL_CASE(FLOAT, arrow::FloatScalar)
+      LITERAL_CASE(DOUBLE, arrow::DoubleScalar)
+#undef LITERAL_CASE
+    case arrow::Type::STRING:
+      return TreeExprBuilder::MakeStringLiteral(
+          checked_cast<const arrow::StringScalar&>(scalar).value->ToString());
+    case arrow::Type::BINARY:
+      return TreeExprBuilder::MakeBinaryLiteral(
+          checked_cast<const arrow::BinaryScalar&>(scalar).value->ToString());
+    default:
+      return Status::NotImplemented("Translation of literals of type ",
+                                    scalar.type->ToString());
+  }
+}
+
+class GandivaTranslator {
+ public:
+  explicit GandivaTranslator(const arrow::Schema& schema) : schema_(schema) {}
+
+  arrow::Result<NodePtr> Translate(const cp::Expression& expr) {
+    if (auto literal = expr.literal()) {
+      if (!literal->is_scalar()) {
+        return Status::NotImplemented("Translation of non-scalar literals");
+      }
+      return ScalarToLiteral(*literal->scalar());
+    }
+    if (auto parameter = expr.parameter()) {
+      return TranslateField(*parameter);
+    }
+    return TranslateCall(*expr.call(), expr.type());
+  }
+
+ private:
+  arrow::Result<NodePtr> TranslateField(const cp::Expression::Parameter& parameter) {
+    if (parameter.indices.size() != 1) {
+      return Status::NotImplemented("Translation of nested field references");
+    }
+    int index = parameter.indices[0];
+    const auto& field = schema_.field(index);
+    if (schema_.GetFieldIndex(field->name()) != index) {
+      return Status::NotImplemented("Translation of the duplicated field name ",
+                                    field->name());
+    }
+    return TreeExprBuilder::MakeField(field);
+  }
+
+  arrow::Result<NodePtr> TranslateCall(const cp::Expression::Call& call,
+                                       const DataTypePtr& type) {
+    ARROW_ASSIGN_OR_RAISE(auto args, TranslateAll(call.arguments));
+    const auto& name = call.function_name;
+    if (name == "and_kleene") {
+      return TreeExprBuilder::MakeAnd(args);
+    }
+    if (name == "or_kleene") {
+      return TreeExprBuilder::MakeOr(args);
+    }
+    if (name == "if_else") {
+      // A null condition gives a null, while Gandiva selects the else branch
+      auto is_null = TreeExprBuilder::MakeFunction("isnull", {args[0]}, arrow::boolean());
+      return TreeExprBuilder::MakeIf(
+          is_null, TreeExprBuilder::MakeNull(type),
+          TreeExprBuilder::MakeIf(args[0], args[1], args[2], type), type);
+    }
+    if (name == "is_null") {
+      if (call.options != nullptr &&
+          checked_cast<const cp::NullOptions&>(*call.options).nan_is_null) {
+        return Status::NotImplemented("Translation of is_null with nan_is_null");
+      }
+      return TreeExprBuilder::MakeFunction("isnull", args, type);
+    }
+    if (name == "divide") {
+      // Gandiva fails on a float division by zero, the kernels return infinity
+      if (!arrow::is_integer(type->id())) {
+        return Status::NotImplemented("Translation of non-integer divisions");
+      }
+      return TreeExprBuilder::MakeFunction("divide", args, type);
+    }
+    auto it = InverseFunctionMap().find(name);
+    if (it == InverseFunctionMap().end()) {
+      return Status::NotImplemented("Translation of function ", name);
+    }
+    return TreeExprBuilder::MakeFunction(it->second, args, type);
+  }
+
+  arrow::Result<NodeVector> TranslateAll(const std::vector<cp::Expression>& exprs) {
+    NodeVector out;
+    for (const auto& expr : exprs) {
+      ARROW_ASSIGN_OR_RAISE(auto node, Translate(expr));
+      out.push_back(std::move(node));
+    }
+    return out;
+  }
+
+  const arrow::Schema& schema_;
+};
+
+}  // namespace
+
+arrow::Result<cp::Expression> TranslateToCompute(const Node& node) {
+  ComputeTranslator translator;
+  return translator.Translate(node);
+}
+
+arrow::Result<NodePtr> TranslateFromCompute(const cp::Expression& expr,
+                                            const arrow::Schema& schema) {
+  if (!expr.IsBound()) {
+    return Status::Invalid("Cannot translate an unbound expression: ", expr.ToString());
+  }
+  GandivaTranslator translator(schema);
+  return translator.Translate(expr);
+}
+
+}  // namespace gandiva
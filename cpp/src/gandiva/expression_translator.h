@@ -0,0 +1,49 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/compute/exec/expression.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+
+#include "gandiva/gandiva_aliases.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Translate an expression tree to an Arrow compute expression.
+///
+/// Only fields, literals, if-else, boolean and/or and the common arithmetic,
+/// comparison and null-check functions are supported; other nodes return
+/// NotImplemented. The result is unbound, and computes the same values as
+/// the compiled code for the supported functions (a null if-else condition
+/// selects the else branch, as in Gandiva).
+GANDIVA_EXPORT
+arrow::Result<arrow::compute::Expression> TranslateToCompute(const Node& node);
+
+/// \brief Translate a bound Arrow compute expression to an expression tree.
+///
+/// The inverse of TranslateToCompute, for the expressions which compute the same
+/// values with both (e.g. only integer divisions, since Gandiva fails on a float
+/// division by zero). Other expressions return NotImplemented. The fields are
+/// referred to by name, so the referenced names must be unique in the schema.
+GANDIVA_EXPORT
+arrow::Result<NodePtr> TranslateFromCompute(const arrow::compute::Expression& expr,
+                                            const arrow::Schema& schema);
+
+}  // namespace gandiva
@@ -25,6 +25,7 @@
 #include "gandiva/condition.h"
 #include "gandiva/expr_validator.h"
 #include "gandiva/llvm_generator.h"
+#include "gandiva/parallel_slices.h"
 #include "gandiva/selection_vector_impl.h"
 
 namespace gandiva {
@@ -52,18 +53,11 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
 
   ExpressionCacheKey cache_key(schema, configuration, conditionToKey);
 
-  bool is_cached = false;
-
-  std::shared_ptr<llvm::MemoryBuffer> prev_cached_obj;
-  prev_cached_obj = cache->GetObjectCode(cache_key);
-
-  // Verify if previous filter obj code was cached
-  if (prev_cached_obj != nullptr) {
-    is_cached = true;
-  }
-
   GandivaObjectCache obj_cache(cache, cache_key);
 
+  // Verify if previous filter obj code was cached, in memory or on disk
+  bool is_cached = obj_cache.HasObject();
+
   // Build LLVM generator, and generate code for the specified expression
   std::unique_ptr<LLVMGenerator> llvm_gen;
   ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, is_cached, &llvm_gen));
@@ -103,12 +97,30 @@ Status Filter::Evaluate(const arrow::RecordBatch& batch,
   LocalBitMapsHolder bitmaps(num_rows, 3 /*local_bitmaps*/);
   int64_t bitmap_size = bitmaps.GetLocalBitMapSize();
 
-  auto validity = std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(0), bitmap_size);
-  auto value = std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(1), bitmap_size);
-  auto array_data = arrow::ArrayData::Make(arrow::boolean(), num_rows, {validity, value});
-
-  // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(llvm_generator_->Execute(batch, {array_data}));
+  auto slice_rows = GetSliceRows(*configuration_, num_rows);
+  if (slice_rows > 0) {
+    // Execute the expression(s) over slices, each writing its range of the bitmaps.
+    ARROW_RETURN_NOT_OK(ParallelForSlices(
+        num_rows, slice_rows, [&](int, int64_t offset, int64_t length) -> Status {
+          int64_t slice_bitmap_size = arrow::bit_util::BytesForBits(length);
+          auto validity = std::make_shared<arrow::Buffer>(
+              bitmaps.GetLocalBitMap(0) + offset / 8, slice_bitmap_size);
+          auto value = std::make_shared<arrow::Buffer>(
+              bitmaps.GetLocalBitMap(1) + offset / 8, slice_bitmap_size);
+          auto array_data =
+              arrow::ArrayData::Make(arrow::boolean(), length, {validity, value});
+          return llvm_generator_->Execute(*batch.Slice(offset, length), {array_data});
+        }));
+  } else {
+    auto validity =
+        std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(0), bitmap_size);
+    auto value = std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(1), bitmap_size);
+    auto array_data =
+        arrow::ArrayData::Make(arrow::boolean(), num_rows, {validity, value});
+
+    // Execute the expression(s).
+    ARROW_RETURN_NOT_OK(llvm_generator_->Execute(batch, {array_data}));
+  }
 
   // Compute the intersection of the value and validity.
   auto result = bitmaps.GetLocalBitMap(2);
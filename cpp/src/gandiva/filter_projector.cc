@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/filter_projector.h"
+
+#include <utility>
+#include <vector>
+
+#include "gandiva/cache.h"
+#include "gandiva/expr_validator.h"
+#include "gandiva/llvm_generator.h"
+#include "gandiva/projector.h"
+#include "gandiva/selection_vector.h"
+
+namespace gandiva {
+
+FilterProjector::FilterProjector(std::unique_ptr<LLVMGenerator> llvm_generator,
+                                 SchemaPtr schema, FieldVector output_fields,
+                                 bool built_from_cache)
+    : llvm_generator_(std::move(llvm_generator)),
+      schema_(std::move(schema)),
+      output_fields_(std::move(output_fields)),
+      built_from_cache_(built_from_cache) {}
+
+FilterProjector::~FilterProjector() {}
+
+Status FilterProjector::Make(SchemaPtr schema, ConditionPtr condition,
+                             const ExpressionVector& exprs,
+                             std::shared_ptr<Configuration> configuration,
+                             std::shared_ptr<FilterProjector>* filter_projector) {
+  ARROW_RETURN_IF(schema == nullptr, Status::Invalid("Schema cannot be null"));
+  ARROW_RETURN_IF(condition == nullptr, Status::Invalid("Condition cannot be null"));
+  ARROW_RETURN_IF(exprs.empty(), Status::Invalid("Expressions cannot be empty"));
+  ARROW_RETURN_IF(configuration == nullptr,
+                  Status::Invalid("Configuration cannot be null"));
+
+  // The positions of the matching records fit in 32 bits for any batch.
+  const auto mode = SelectionVector::Mode::MODE_UINT32;
+
+  std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>> cache =
+      LLVMGenerator::GetCache();
+
+  ExpressionCacheKey cache_key(schema, configuration, *condition, exprs, mode);
+
+  GandivaObjectCache obj_cache(cache, cache_key);
+
+  // Verify if previous obj code was cached, in memory or on disk
+  bool is_cached = obj_cache.HasObject();
+
+  // Build LLVM generator, and generate code for the condition and expressions
+  std::unique_ptr<LLVMGenerator> llvm_gen;
+  ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, is_cached, &llvm_gen));
+
+  if (!is_cached) {
+    ExprValidator expr_validator(llvm_gen->types(), schema);
+    ARROW_RETURN_NOT_OK(expr_validator.Validate(condition));
+    for (auto& expr : exprs) {
+      ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
+    }
+  }
+
+  // Set the object cache for LLVM
+  llvm_gen->SetLLVMObjectCache(obj_cache);
+
+  ARROW_RETURN_NOT_OK(llvm_gen->Build(condition, exprs, mode));
+
+  FieldVector output_fields;
+  output_fields.reserve(exprs.size());
+  for (auto& expr : exprs) {
+    output_fields.push_back(expr->result());
+  }
+
+  *filter_projector = std::shared_ptr<FilterProjector>(new FilterProjector(
+      std::move(llvm_gen), schema, std::move(output_fields), is_cached));
+  return Status::OK();
+}
+
+Status FilterProjector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                                 arrow::ArrayVector* output) {
+  const auto num_rows = batch.num_rows();
+  ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
+                  Status::Invalid("Schema in RecordBatch must match schema in Make()"));
+  ARROW_RETURN_IF(num_rows == 0, Status::Invalid("RecordBatch must be non-empty."));
+  ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  ARROW_RETURN_NOT_OK(SelectionVector::MakeInt32(num_rows, pool, &selection_vector));
+
+  // The number of matching records is only known after the condition, so allocate
+  // the outputs for all the records.
+  ArrayDataVector output_data_vecs;
+  for (auto& field : output_fields_) {
+    ArrayDataPtr output_data;
+    ARROW_RETURN_NOT_OK(
+        Projector::AllocArrayData(field->type(), num_rows, pool, &output_data));
+    output_data_vecs.push_back(std::move(output_data));
+  }
+
+  ARROW_RETURN_NOT_OK(
+      llvm_generator_->ExecuteFiltered(batch, selection_vector.get(), output_data_vecs));
+
+  output->clear();
+  for (auto& array_data : output_data_vecs) {
+    array_data->length = selection_vector->GetNumSlots();
+    output->push_back(arrow::MakeArray(array_data));
+  }
+  return Status::OK();
+}
+
+std::string FilterProjector::DumpIR() { return llvm_generator_->DumpIR(); }
+
+}  // namespace gandiva
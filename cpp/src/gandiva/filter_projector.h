@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "arrow/status.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/condition.h"
+#include "gandiva/configuration.h"
+#include "gandiva/expression.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+class LLVMGenerator;
+
+/// \brief Evaluate expressions on the records matching a condition.
+///
+/// The combination of a Filter and of a Projector built for a selection vector,
+/// generated in a single module. Evaluate() runs the condition, and the expressions
+/// on the matching records only, writing the outputs compacted.
+class GANDIVA_EXPORT FilterProjector {
+ public:
+  // Inline dtor will attempt to resolve the destructor for
+  // LLVMGenerator on MSVC, so we compile the dtor in the object code
+  ~FilterProjector();
+
+  /// Build a filter-projector for the given schema, with the default configuration.
+  ///
+  /// \param[in] schema schema for the record batches, the condition and expressions.
+  /// \param[in] condition filter condition.
+  /// \param[in] exprs vector of expressions evaluated on the matching records.
+  /// \param[out] filter_projector the returned filter-projector object
+  static Status Make(SchemaPtr schema, ConditionPtr condition,
+                     const ExpressionVector& exprs,
+                     std::shared_ptr<FilterProjector>* filter_projector) {
+    return Make(schema, condition, exprs, ConfigurationBuilder::DefaultConfiguration(),
+                filter_projector);
+  }
+
+  /// \brief Build a filter-projector for the given schema.
+  /// Customize the filter-projector with runtime configuration.
+  ///
+  /// \param[in] schema schema for the record batches, the condition and expressions.
+  /// \param[in] condition filter condition.
+  /// \param[in] exprs vector of expressions evaluated on the matching records.
+  /// \param[in] configuration run time configuration.
+  /// \param[out] filter_projector the returned filter-projector object
+  static Status Make(SchemaPtr schema, ConditionPtr condition,
+                     const ExpressionVector& exprs,
+                     std::shared_ptr<Configuration> configuration,
+                     std::shared_ptr<FilterProjector>* filter_projector);
+
+  /// Evaluate the specified record batch, and return the allocated and populated
+  /// output arrays, with one entry per record matching the condition. The output
+  /// arrays will be allocated from the memory pool 'pool', and added to the vector
+  /// 'output'.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] pool memory pool used to allocate output arrays.
+  /// \param[out] output the vector of allocated/populated arrays.
+  Status Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                  arrow::ArrayVector* output);
+
+  std::string DumpIR();
+
+  bool GetBuiltFromCache() const { return built_from_cache_; }
+
+ private:
+  FilterProjector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
+                  FieldVector output_fields, bool built_from_cache);
+
+  std::unique_ptr<LLVMGenerator> llvm_generator_;
+  const SchemaPtr schema_;
+  const FieldVector output_fields_;
+  const bool built_from_cache_;
+};
+
+}  // namespace gandiva
@@ -17,35 +17,122 @@
 
 #include "gandiva/gandiva_object_cache.h"
 
+#include <algorithm>
+#include <string>
 #include <utility>
+#include <vector>
+
+#include <llvm/ADT/StringMap.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/Host.h>
+
+#include "arrow/buffer.h"
+#include "arrow/util/logging.h"
 
 namespace gandiva {
 
+namespace {
+
+// The target the object code is compiled for: objects compiled by another
+// version of LLVM or for other CPU features are not loaded.
+const std::string& TargetDescription() {
+  static const std::string description = [] {
+    std::string out = "llvm:" LLVM_VERSION_STRING ";triple:" +
+                      llvm::sys::getProcessTriple() +
+                      ";cpu:" + llvm::sys::getHostCPUName().str() + ";features:";
+    llvm::StringMap<bool> host_features;
+    if (llvm::sys::getHostCPUFeatures(host_features)) {
+      std::vector<std::string> features;
+      for (auto& f : host_features) {
+        features.push_back((f.second ? "+" : "-") + f.first().str());
+      }
+      std::sort(features.begin(), features.end());
+      for (const auto& feature : features) {
+        out += feature + ",";
+      }
+    }
+    return out;
+  }();
+  return description;
+}
+
+// Object code mapped from the on-disk cache
+class MappedObjectBuffer : public llvm::MemoryBuffer {
+ public:
+  explicit MappedObjectBuffer(std::shared_ptr<arrow::Buffer> buffer)
+      : buffer_(std::move(buffer)) {
+    const auto data = reinterpret_cast<const char*>(buffer_->data());
+    init(data, data + buffer_->size(), /*RequiresNullTerminator=*/false);
+  }
+
+  BufferKind getBufferKind() const override { return MemoryBuffer_MMap; }
+
+ private:
+  std::shared_ptr<arrow::Buffer> buffer_;
+};
+
+}  // namespace
+
 GandivaObjectCache::GandivaObjectCache(
     std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>>&
         cache,
     ExpressionCacheKey key)
-    : cache_key_(std::move(key)) {
+    : cache_key_(std::move(key)), disk_cache_(ObjectCodeDiskCache::GetDefault()) {
   cache_ = cache;
 }
 
+std::string GandivaObjectCache::DiskCacheKey() const {
+  return TargetDescription() + ";" + cache_key_.ToStableString();
+}
+
 void GandivaObjectCache::notifyObjectCompiled(const llvm::Module* M,
                                               llvm::MemoryBufferRef Obj) {
   std::unique_ptr<llvm::MemoryBuffer> obj_buffer =
       llvm::MemoryBuffer::getMemBufferCopy(Obj.getBuffer(), Obj.getBufferIdentifier());
   std::shared_ptr<llvm::MemoryBuffer> obj_code = std::move(obj_buffer);
 
-  cache_->PutObjectCode(cache_key_, obj_code);
+  cache_->PutObjectCode(cache_key_, obj_code, obj_code->getBufferSize());
+
+  if (disk_cache_ != nullptr) {
+    auto status = disk_cache_->Put(
+        DiskCacheKey(), reinterpret_cast<const uint8_t*>(obj_code->getBufferStart()),
+        static_cast<int64_t>(obj_code->getBufferSize()));
+    if (!status.ok()) {
+      ARROW_LOG(WARNING) << "Failed to store object code in the disk cache: "
+                         << status.ToString();
+    }
+  }
 }
 
 std::unique_ptr<llvm::MemoryBuffer> GandivaObjectCache::getObject(const llvm::Module* M) {
-  std::shared_ptr<llvm::MemoryBuffer> cached_obj = cache_->GetObjectCode(cache_key_);
-  if (cached_obj != nullptr) {
-    std::unique_ptr<llvm::MemoryBuffer> cached_buffer = cached_obj->getMemBufferCopy(
-        cached_obj->getBuffer(), cached_obj->getBufferIdentifier());
+  if (cached_obj_ != nullptr) {
+    std::unique_ptr<llvm::MemoryBuffer> cached_buffer = cached_obj_->getMemBufferCopy(
+        cached_obj_->getBuffer(), cached_obj_->getBufferIdentifier());
     return cached_buffer;
   }
   return nullptr;
 }
 
+bool GandivaObjectCache::HasObject() {
+  cached_obj_ = cache_->GetObjectCode(cache_key_);
+  if (cached_obj_ != nullptr) {
+    return true;
+  }
+  if (disk_cache_ == nullptr) {
+    return false;
+  }
+  auto maybe_buffer = disk_cache_->Get(DiskCacheKey());
+  if (!maybe_buffer.ok()) {
+    ARROW_LOG(WARNING) << "Failed to load object code from the disk cache: "
+                       << maybe_buffer.status().ToString();
+    return false;
+  }
+  if (*maybe_buffer == nullptr) {
+    return false;
+  }
+  cached_obj_ = std::make_shared<MappedObjectBuffer>(*std::move(maybe_buffer));
+  cache_->PutObjectCode(cache_key_, cached_obj_, cached_obj_->getBufferSize());
+  return true;
+}
+
 }  // namespace gandiva
@@ -31,6 +31,7 @@
 
 #include "gandiva/cache.h"
 #include "gandiva/expression_cache_key.h"
+#include "gandiva/object_code_disk_cache.h"
 
 namespace gandiva {
 /// Class that enables the LLVM to use a custom rule to deal with the object code.
@@ -47,8 +48,21 @@ class GandivaObjectCache : public llvm::ObjectCache {
 
   std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* M);
 
+  /// Check whether the object code of the key was already compiled, in which
+  /// case getObject() returns it.
+  ///
+  /// Objects found in the on-disk cache, if enabled, are added to the in-memory
+  /// cache.
+  bool HasObject();
+
  private:
+  // The key of the on-disk cache, also covering the target of the object code
+  std::string DiskCacheKey() const;
+
   ExpressionCacheKey cache_key_;
   std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>> cache_;
+  std::shared_ptr<ObjectCodeDiskCache> disk_cache_;
+  // The object found by HasObject(), kept in case the cache evicts it meanwhile
+  std::shared_ptr<llvm::MemoryBuffer> cached_obj_;
 };
 }  // namespace gandiva
@@ -19,6 +19,7 @@
 
 #include <utf8proc.h>
 
+#include <algorithm>
 #include <boost/crc.hpp>
 #include <string>
 #include <vector>
@@ -128,9 +129,18 @@ int32_t gdv_fn_populate_varlen_vector(int64_t context_ptr, int8_t* data_ptr,
                                       const char* entry_buf, int32_t entry_len) {
   auto buffer = reinterpret_cast<arrow::ResizableBuffer*>(data_ptr);
   int32_t offset = static_cast<int32_t>(buffer->size());
+  int64_t new_size = static_cast<int64_t>(offset) + entry_len;
+
+  // Grow the capacity geometrically, the buffers only round it up to 64 bytes.
+  arrow::Status status;
+  if (new_size > buffer->capacity()) {
+    status = buffer->Reserve(std::max(new_size, 2 * buffer->capacity()));
+  }
 
   // This also sets the size in the buffer.
-  auto status = buffer->Resize(offset + entry_len, false /*shrink*/);
+  if (status.ok()) {
+    status = buffer->Resize(new_size, false /*shrink*/);
+  }
   if (!status.ok()) {
     gandiva::ExecutionContext* context =
         reinterpret_cast<gandiva::ExecutionContext*>(context_ptr);
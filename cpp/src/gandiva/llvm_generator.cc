@@ -17,11 +17,13 @@
 
 #include "gandiva/llvm_generator.h"
 
+#include <chrono>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "gandiva/bitmap_accumulator.h"
+#include "gandiva/condition.h"
 #include "gandiva/decimal_ir.h"
 #include "gandiva/dex.h"
 #include "gandiva/expr_decomposer.h"
@@ -30,16 +32,24 @@
 
 namespace gandiva {
 
+// The suffix of the functions generated for inputs without nulls.
+static const char kNullFreeSuffix[] = "_null_free";
+
 #define ADD_TRACE(...)     \
   if (enable_ir_traces_) { \
     AddTrace(__VA_ARGS__); \
   }
 
-LLVMGenerator::LLVMGenerator(bool cached) : cached_(cached), enable_ir_traces_(false) {}
+LLVMGenerator::LLVMGenerator(bool cached, bool null_free_variants)
+    : cached_(cached),
+      has_condition_(false),
+      null_free_variants_(null_free_variants),
+      enable_ir_traces_(false) {}
 
 Status LLVMGenerator::Make(std::shared_ptr<Configuration> config, bool cached,
                            std::unique_ptr<LLVMGenerator>* llvm_generator) {
-  std::unique_ptr<LLVMGenerator> llvmgen_obj(new LLVMGenerator(cached));
+  std::unique_ptr<LLVMGenerator> llvmgen_obj(
+      new LLVMGenerator(cached, config->null_free_variants()));
 
   ARROW_RETURN_NOT_OK(Engine::Make(config, cached, &(llvmgen_obj->engine_)));
   *llvm_generator = std::move(llvmgen_obj);
@@ -56,11 +66,14 @@ LLVMGenerator::GetCache() {
   return shared_cache;
 }
 
+CacheStats GetCacheStats() { return LLVMGenerator::GetCache()->stats(); }
+
 void LLVMGenerator::SetLLVMObjectCache(GandivaObjectCache& object_cache) {
   engine_->SetLLVMObjectCache(object_cache);
 }
 
-Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr output) {
+Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr output,
+                          SelectionVector::Mode mode) {
   int idx = static_cast<int>(compiled_exprs_.size());
   // decompose the expression to separate out value and validities.
   ExprDecomposer decomposer(function_registry_, annotator_);
@@ -69,14 +82,21 @@ Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr out
   // Generate the IR function for the decomposed expression.
   std::unique_ptr<CompiledExpr> compiled_expr(new CompiledExpr(value_validity, output));
   std::string fn_name = "expr_" + std::to_string(idx) + "_" +
-                        std::to_string(static_cast<int>(selection_vector_mode_));
+                        std::to_string(static_cast<int>(mode));
   if (!cached_) {
     ARROW_RETURN_NOT_OK(engine_->LoadFunctionIRs());
+    bool reads_input_validity = false;
     ARROW_RETURN_NOT_OK(CodeGenExprValue(value_validity->value_expr(),
                                          annotator_.buffer_count(), output, idx, fn_name,
-                                         selection_vector_mode_));
+                                         mode, false, &reads_input_validity));
+    if (null_free_variants_ && reads_input_validity) {
+      std::string null_free_fn_name = fn_name + kNullFreeSuffix;
+      ARROW_RETURN_NOT_OK(CodeGenExprValue(value_validity->value_expr(),
+                                           annotator_.buffer_count(), output, idx,
+                                           null_free_fn_name, mode, true));
+    }
   }
-  compiled_expr->SetFunctionName(selection_vector_mode_, fn_name);
+  compiled_expr->SetFunctionName(mode, fn_name);
   compiled_exprs_.push_back(std::move(compiled_expr));
   return Status::OK();
 }
@@ -84,21 +104,48 @@ Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr out
 /// \brief Build the code for the expression trees for default mode with a LLVM
 /// ObjectCache. Each element in the vector represents an expression tree
 Status LLVMGenerator::Build(const ExpressionVector& exprs, SelectionVector::Mode mode) {
+  return Build(NULLPTR, exprs, mode);
+}
+
+/// \brief Build the code for an optional filter condition, and for the expression
+/// trees in the given mode.
+Status LLVMGenerator::Build(const ConditionPtr& condition, const ExpressionVector& exprs,
+                            SelectionVector::Mode mode) {
   selection_vector_mode_ = mode;
+  const auto start = std::chrono::steady_clock::now();
 
+  // The condition is evaluated on all the records, so in the default mode.
+  if (condition != nullptr) {
+    auto output = annotator_.AddOutputFieldDescriptor(condition->result());
+    ARROW_RETURN_NOT_OK(Add(condition, output, SelectionVector::Mode::MODE_NONE));
+    has_condition_ = true;
+  }
   for (auto& expr : exprs) {
     auto output = annotator_.AddOutputFieldDescriptor(expr->result());
-    ARROW_RETURN_NOT_OK(Add(expr, output));
+    ARROW_RETURN_NOT_OK(Add(expr, output, mode));
   }
 
   // Compile and inject into the process' memory the generated function.
   ARROW_RETURN_NOT_OK(engine_->FinalizeModule());
+  if (!cached_) {
+    GetCache()->RecordCompilation(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                      std::chrono::steady_clock::now() - start)
+                                      .count());
+  }
 
   // setup the jit functions for each expression.
-  for (auto& compiled_expr : compiled_exprs_) {
-    auto fn_name = compiled_expr->GetFunctionName(mode);
+  for (size_t i = 0; i < compiled_exprs_.size(); ++i) {
+    auto expr_mode = (has_condition_ && i == 0) ? SelectionVector::Mode::MODE_NONE : mode;
+    auto fn_name = compiled_exprs_[i]->GetFunctionName(expr_mode);
     auto jit_fn = reinterpret_cast<EvalFunc>(engine_->CompiledFunction(fn_name));
-    compiled_expr->SetJITFunction(selection_vector_mode_, jit_fn);
+    compiled_exprs_[i]->SetJITFunction(expr_mode, jit_fn);
+    if (null_free_variants_) {
+      // Only generated for the expressions reading the validity of the inputs
+      auto null_free_fn_name = fn_name + kNullFreeSuffix;
+      auto null_free_jit_fn =
+          reinterpret_cast<EvalFunc>(engine_->CompiledFunction(null_free_fn_name));
+      compiled_exprs_[i]->SetNullFreeJITFunction(expr_mode, null_free_jit_fn);
+    }
   }
 
   return Status::OK();
@@ -122,6 +169,8 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                               const SelectionVector* selection_vector,
                               const ArrayDataVector& output_vector) {
   DCHECK_GT(record_batch.num_rows(), 0);
+  ARROW_RETURN_IF(has_condition_,
+                  Status::Invalid("llvm expression built with a filter condition"));
 
   auto eval_batch = annotator_.PrepareEvalBatch(record_batch, output_vector);
   DCHECK_GT(eval_batch->GetNumBuffers(), 0);
@@ -136,29 +185,84 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
   }
 
   for (auto& compiled_expr : compiled_exprs_) {
-    // generate data/offset vectors.
-    const uint8_t* selection_buffer = nullptr;
-    auto num_output_rows = record_batch.num_rows();
-    if (selection_vector != nullptr) {
-      selection_buffer = selection_vector->GetBuffer().data();
-      num_output_rows = selection_vector->GetNumSlots();
-    }
+    ARROW_RETURN_NOT_OK(ExecuteExpr(*compiled_expr, *eval_batch, selection_vector));
+  }
+
+  return Status::OK();
+}
+
+/// Execute the compiled condition, and the compiled expressions on the records
+/// matching it.
+Status LLVMGenerator::ExecuteFiltered(const arrow::RecordBatch& record_batch,
+                                      SelectionVector* selection_vector,
+                                      const ArrayDataVector& output_vector) {
+  const auto num_rows = record_batch.num_rows();
+  DCHECK_GT(num_rows, 0);
+  ARROW_RETURN_IF(!has_condition_,
+                  Status::Invalid("llvm expression built without a filter condition"));
+  if (selection_vector->GetMode() != selection_vector_mode_) {
+    return Status::Invalid("llvm expression built for selection vector mode ",
+                           selection_vector_mode_, " received vector with mode ",
+                           selection_vector->GetMode());
+  }
+
+  // The condition goes to local bitmaps for the validity and the value, and their
+  // intersection gives the matching records.
+  LocalBitMapsHolder bitmaps(num_rows, 3 /*local_bitmaps*/);
+  int64_t bitmap_size = bitmaps.GetLocalBitMapSize();
+  ArrayDataVector all_outputs = {arrow::ArrayData::Make(
+      arrow::boolean(), num_rows,
+      {std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(0), bitmap_size),
+       std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(1), bitmap_size)})};
+  all_outputs.insert(all_outputs.end(), output_vector.begin(), output_vector.end());
+
+  auto eval_batch = annotator_.PrepareEvalBatch(record_batch, all_outputs);
+  ARROW_RETURN_NOT_OK(ExecuteExpr(*compiled_exprs_[0], *eval_batch, NULLPTR));
+
+  auto result = bitmaps.GetLocalBitMap(2);
+  BitMapAccumulator::IntersectBitMaps(
+      result, {bitmaps.GetLocalBitMap(0), bitmaps.GetLocalBitMap(1)}, {0, 0}, num_rows);
+  ARROW_RETURN_NOT_OK(
+      selection_vector->PopulateFromBitMap(result, bitmap_size, num_rows - 1));
+  if (selection_vector->GetNumSlots() == 0) {
+    return Status::OK();
+  }
 
-    EvalFunc jit_function = compiled_expr->GetJITFunction(mode);
-    jit_function(eval_batch->GetBufferArray(), eval_batch->GetBufferOffsetArray(),
-                 eval_batch->GetLocalBitMapArray(), annotator_.GetHolderPointersArray(),
-                 selection_buffer, (int64_t)eval_batch->GetExecutionContext(),
-                 num_output_rows);
+  for (size_t i = 1; i < compiled_exprs_.size(); ++i) {
+    ARROW_RETURN_NOT_OK(ExecuteExpr(*compiled_exprs_[i], *eval_batch, selection_vector));
+  }
+  return Status::OK();
+}
 
-    // check for execution errors
-    ARROW_RETURN_IF(
-        eval_batch->GetExecutionContext()->has_error(),
-        Status::ExecutionError(eval_batch->GetExecutionContext()->get_error()));
+Status LLVMGenerator::ExecuteExpr(const CompiledExpr& compiled_expr,
+                                  const EvalBatch& eval_batch,
+                                  const SelectionVector* selection_vector) {
+  // generate data/offset vectors.
+  auto mode = SelectionVector::MODE_NONE;
+  const uint8_t* selection_buffer = nullptr;
+  auto num_output_rows = eval_batch.num_records();
+  if (selection_vector != nullptr) {
+    mode = selection_vector->GetMode();
+    selection_buffer = selection_vector->GetBuffer().data();
+    num_output_rows = selection_vector->GetNumSlots();
+  }
 
-    // generate validity vectors.
-    ComputeBitMapsForExpr(*compiled_expr, *eval_batch, selection_vector);
+  EvalFunc jit_function = compiled_expr.GetJITFunction(mode);
+  EvalFunc null_free_jit_function = compiled_expr.GetNullFreeJITFunction(mode);
+  if (null_free_jit_function != nullptr && annotator_.InputsHaveNoNulls(eval_batch)) {
+    jit_function = null_free_jit_function;
   }
+  jit_function(eval_batch.GetBufferArray(), eval_batch.GetBufferOffsetArray(),
+               eval_batch.GetLocalBitMapArray(), annotator_.GetHolderPointersArray(),
+               selection_buffer, (int64_t)eval_batch.GetExecutionContext(),
+               num_output_rows);
+
+  // check for execution errors
+  ARROW_RETURN_IF(eval_batch.GetExecutionContext()->has_error(),
+                  Status::ExecutionError(eval_batch.GetExecutionContext()->get_error()));
 
+  // generate validity vectors.
+  ComputeBitMapsForExpr(compiled_expr, eval_batch, selection_vector);
   return Status::OK();
 }
 
@@ -268,7 +372,9 @@ llvm::Value* LLVMGenerator::GetLocalBitMapReference(llvm::Value* arg_bitmaps, in
 Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
                                        FieldDescriptorPtr output, int suffix_idx,
                                        std::string& fn_name,
-                                       SelectionVector::Mode selection_vector_mode) {
+                                       SelectionVector::Mode selection_vector_mode,
+                                       bool null_free_inputs,
+                                       bool* reads_input_validity) {
   llvm::IRBuilder<>* builder = ir_builder();
   // Create fn prototype :
   //   int expr_1 (long **addrs, long *offsets, long **bitmaps,
@@ -359,9 +465,12 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
 
   // The visitor can add code to both the entry/loop blocks.
   Visitor visitor(this, fn, loop_entry, arg_addrs, arg_local_bitmaps, arg_holder_ptrs,
-                  slice_offsets, arg_context_ptr, position_var);
+                  slice_offsets, arg_context_ptr, position_var, null_free_inputs);
   value_expr->Accept(visitor);
   LValuePtr output_value = visitor.result();
+  if (reads_input_validity != nullptr) {
+    *reads_input_validity = visitor.reads_input_validity();
+  }
 
   // The "current" block may have changed due to code generation in the visitor.
   llvm::BasicBlock* loop_body_tail = builder->GetInsertBlock();
@@ -548,7 +657,8 @@ LLVMGenerator::Visitor::Visitor(LLVMGenerator* generator, llvm::Function* functi
                                 llvm::Value* arg_local_bitmaps,
                                 llvm::Value* arg_holder_ptrs,
                                 std::vector<llvm::Value*> slice_offsets,
-                                llvm::Value* arg_context_ptr, llvm::Value* loop_var)
+                                llvm::Value* arg_context_ptr, llvm::Value* loop_var,
+                                bool null_free_inputs)
     : generator_(generator),
       function_(function),
       entry_block_(entry_block),
@@ -558,7 +668,9 @@ LLVMGenerator::Visitor::Visitor(LLVMGenerator* generator, llvm::Function* functi
       slice_offsets_(slice_offsets),
       arg_context_ptr_(arg_context_ptr),
       loop_var_(loop_var),
-      has_arena_allocs_(false) {
+      has_arena_allocs_(false),
+      null_free_inputs_(null_free_inputs),
+      reads_input_validity_(false) {
   ADD_VISITOR_TRACE("Iteration %T", loop_var);
 }
 
@@ -628,6 +740,13 @@ void LLVMGenerator::Visitor::Visit(const VectorReadVarLenValueDex& dex) {
 }
 
 void LLVMGenerator::Visitor::Visit(const VectorReadValidityDex& dex) {
+  reads_input_validity_ = true;
+  if (null_free_inputs_) {
+    // All valid, the checks of the validity fold away.
+    result_.reset(new LValue(generator_->types()->true_constant()));
+    return;
+  }
+
   llvm::IRBuilder<>* builder = ir_builder();
   llvm::Value* slot_ref =
       GetBufferReference(dex.ValidityIdx(), kBufferTypeValidity, dex.Field());
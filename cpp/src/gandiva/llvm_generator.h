@@ -65,6 +65,12 @@ class GANDIVA_EXPORT LLVMGenerator {
   /// element in the vector represents an expression tree
   Status Build(const ExpressionVector& exprs);
 
+  /// \brief Build the code for a filter condition, evaluated on all the records, and
+  /// for the expression trees, evaluated on the records matching the condition with
+  /// a selection vector of the given mode.
+  Status Build(const ConditionPtr& condition, const ExpressionVector& exprs,
+               SelectionVector::Mode mode);
+
   /// \brief Execute the built expression against the provided arguments for
   /// default mode.
   Status Execute(const arrow::RecordBatch& record_batch,
@@ -76,13 +82,20 @@ class GANDIVA_EXPORT LLVMGenerator {
                  const SelectionVector* selection_vector,
                  const ArrayDataVector& output_vector);
 
+  /// \brief Execute the built condition, populate the selection vector with the
+  /// matching records, and execute the built expressions on these records. The
+  /// outputs are compacted, but must have the capacity for all the records.
+  Status ExecuteFiltered(const arrow::RecordBatch& record_batch,
+                         SelectionVector* selection_vector,
+                         const ArrayDataVector& output_vector);
+
   SelectionVector::Mode selection_vector_mode() { return selection_vector_mode_; }
   LLVMTypes* types() { return engine_->types(); }
   llvm::Module* module() { return engine_->module(); }
   std::string DumpIR() { return engine_->DumpIR(); }
 
  private:
-  explicit LLVMGenerator(bool cached);
+  LLVMGenerator(bool cached, bool null_free_variants);
 
   FRIEND_TEST(TestLLVMGenerator, VerifyPCFunctions);
   FRIEND_TEST(TestLLVMGenerator, TestAdd);
@@ -98,7 +111,7 @@ class GANDIVA_EXPORT LLVMGenerator {
             llvm::BasicBlock* entry_block, llvm::Value* arg_addrs,
             llvm::Value* arg_local_bitmaps, llvm::Value* arg_holder_ptrs,
             std::vector<llvm::Value*> slice_offsets, llvm::Value* arg_context_ptr,
-            llvm::Value* loop_var);
+            llvm::Value* loop_var, bool null_free_inputs);
 
     void Visit(const VectorReadValidityDex& dex) override;
     void Visit(const VectorReadFixedLenValueDex& dex) override;
@@ -126,6 +139,8 @@ class GANDIVA_EXPORT LLVMGenerator {
 
     bool has_arena_allocs() { return has_arena_allocs_; }
 
+    bool reads_input_validity() { return reads_input_validity_; }
+
    private:
     enum BufferType { kBufferTypeValidity = 0, kBufferTypeData, kBufferTypeOffsets };
 
@@ -176,11 +191,20 @@ class GANDIVA_EXPORT LLVMGenerator {
     llvm::Value* arg_context_ptr_;
     llvm::Value* loop_var_;
     bool has_arena_allocs_;
+    // Whether the inputs are known to have no nulls, so are all valid
+    bool null_free_inputs_;
+    bool reads_input_validity_;
   };
 
   // Generate the code for one expression for default mode, with the output of
   // the expression going to 'output'.
-  Status Add(const ExpressionPtr expr, const FieldDescriptorPtr output);
+  Status Add(const ExpressionPtr expr, const FieldDescriptorPtr output,
+             SelectionVector::Mode mode);
+
+  // Execute the code of one expression, on the records in the selection vector if
+  // not null.
+  Status ExecuteExpr(const CompiledExpr& compiled_expr, const EvalBatch& eval_batch,
+                     const SelectionVector* selection_vector);
 
   /// Generate code to load the vector at specified index in the 'arg_addrs' array.
   llvm::Value* LoadVectorAtIndex(llvm::Value* arg_addrs, int idx,
@@ -198,10 +222,14 @@ class GANDIVA_EXPORT LLVMGenerator {
   /// Generate code to load the vector at specified index and cast it as buffer pointer.
   llvm::Value* GetDataBufferPtrReference(llvm::Value* arg_addrs, int idx, FieldPtr field);
 
-  /// Generate code for the value array of one expression.
+  /// Generate code for the value array of one expression, assuming that the inputs
+  /// have no nulls if 'null_free_inputs'. Sets 'reads_input_validity' (if not null)
+  /// if the code reads the validity of an input.
   Status CodeGenExprValue(DexPtr value_expr, int num_buffers, FieldDescriptorPtr output,
                           int suffix_idx, std::string& fn_name,
-                          SelectionVector::Mode selection_vector_mode);
+                          SelectionVector::Mode selection_vector_mode,
+                          bool null_free_inputs = false,
+                          bool* reads_input_validity = NULLPTR);
 
   /// Generate code to load the local bitmap specified index and cast it as bitmap.
   llvm::Value* GetLocalBitMapReference(llvm::Value* arg_bitmaps, int idx);
@@ -253,6 +281,10 @@ class GANDIVA_EXPORT LLVMGenerator {
   FunctionRegistry function_registry_;
   Annotator annotator_;
   SelectionVector::Mode selection_vector_mode_;
+  // Whether the first compiled expression is a filter condition
+  bool has_condition_;
+  // Whether to generate variants of the expressions for inputs without nulls
+  bool null_free_variants_;
 
   // used for debug
   bool enable_ir_traces_;
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <limits>
 #include <list>
 #include <unordered_map>
 #include <utility>
@@ -26,13 +28,15 @@
 // modified from boost LRU cache -> the boost cache supported only an
 // ordered map.
 namespace gandiva {
-// a cache which evicts the least recently used item when it is full
+// a cache which evicts the least recently used item when it is full, either
+// by number of items or by total size of the items
 template <class Key, class Value>
 class LruCache {
  public:
   using key_type = Key;
   using value_type = Value;
-  using list_type = std::list<key_type>;
+  // the keys, most recently used first, and the size of their item
+  using list_type = std::list<std::pair<key_type, size_t>>;
   struct hasher {
     template <typename I>
     std::size_t operator()(const I& i) const {
@@ -43,7 +47,9 @@ class LruCache {
       std::unordered_map<key_type, std::pair<value_type, typename list_type::iterator>,
                          hasher>;
 
-  explicit LruCache(size_t capacity) : cache_capacity_(capacity) {}
+  explicit LruCache(size_t capacity,
+                    size_t size_capacity = std::numeric_limits<size_t>::max())
+      : cache_capacity_(capacity), size_capacity_(size_capacity) {}
 
   ~LruCache() {}
 
@@ -51,22 +57,33 @@ class LruCache {
 
   size_t capacity() const { return cache_capacity_; }
 
+  // the total size of the items
+  size_t total_size() const { return total_size_; }
+
+  size_t size_capacity() const { return size_capacity_; }
+
+  // the number of items evicted so far
+  int64_t num_evictions() const { return num_evictions_; }
+
   bool empty() const { return map_.empty(); }
 
   bool contains(const key_type& key) { return map_.find(key) != map_.end(); }
 
-  void insert(const key_type& key, const value_type& value) {
+  // items larger than the size capacity are not inserted
+  void insert(const key_type& key, const value_type& value, size_t value_size = 0) {
     typename map_type::iterator i = map_.find(key);
-    if (i == map_.end()) {
+    if (i == map_.end() && value_size <= size_capacity_) {
       // insert item into the cache, but first check if it is full
-      if (size() >= cache_capacity_) {
+      while (!empty() && (size() >= cache_capacity_ ||
+                          total_size_ > size_capacity_ - value_size)) {
         // cache is full, evict the least recently used item
         evict();
       }
 
       // insert the new item
-      lru_list_.push_front(key);
+      lru_list_.push_front(std::make_pair(key, value_size));
       map_[key] = std::make_pair(value, lru_list_.begin());
+      total_size_ += value_size;
     }
   }
 
@@ -82,17 +99,12 @@ class LruCache {
     // recently used list
     typename list_type::iterator position_in_lru_list = value_for_key->second.second;
     if (position_in_lru_list != lru_list_.begin()) {
-      // move item to the front of the most recently used list
-      lru_list_.erase(position_in_lru_list);
-      lru_list_.push_front(key);
-
-      // update iterator in map
-      position_in_lru_list = lru_list_.begin();
-      const value_type& value = value_for_key->second.first;
-      map_[key] = std::make_pair(value, position_in_lru_list);
+      // move item to the front of the most recently used list, which keeps
+      // the iterator in the map valid
+      lru_list_.splice(lru_list_.begin(), lru_list_, position_in_lru_list);
 
       // return the value
-      return value;
+      return value_for_key->second.first;
     } else {
       // the item is already at the front of the most recently
       // used list so just return it
@@ -103,19 +115,25 @@ class LruCache {
   void clear() {
     map_.clear();
     lru_list_.clear();
+    total_size_ = 0;
   }
 
  private:
   void evict() {
     // evict item from the end of most recently used list
     typename list_type::iterator i = --lru_list_.end();
-    map_.erase(*i);
+    map_.erase(i->first);
+    total_size_ -= i->second;
     lru_list_.erase(i);
+    ++num_evictions_;
   }
 
  private:
   map_type map_;
   list_type lru_list_;
   size_t cache_capacity_;
+  size_t size_capacity_;
+  size_t total_size_ = 0;
+  int64_t num_evictions_ = 0;
 };
 }  // namespace gandiva
@@ -61,4 +61,30 @@ TEST_F(TestLruCache, TestLruBehavior) {
   // should have evicted key 2.
   ASSERT_EQ(*cache_.get(TestCacheKey(1)), "hello");
 }
+
+TEST_F(TestLruCache, TestEvictBySize) {
+  LruCache<TestCacheKey, std::string> cache(10, 100);
+  cache.insert(TestCacheKey(1), "hello", 40);
+  cache.insert(TestCacheKey(2), "hello", 40);
+  ASSERT_EQ(80, cache.total_size());
+  cache.get(TestCacheKey(1));
+  // should evict key 2 only
+  cache.insert(TestCacheKey(3), "hello", 50);
+  ASSERT_EQ(2, cache.size());
+  ASSERT_EQ(90, cache.total_size());
+  ASSERT_EQ(1, cache.num_evictions());
+  ASSERT_EQ(cache.get(TestCacheKey(2)), arrow::util::nullopt);
+  ASSERT_EQ(*cache.get(TestCacheKey(1)), "hello");
+
+  // too large to be cached
+  cache.insert(TestCacheKey(4), "hello", 101);
+  ASSERT_EQ(cache.get(TestCacheKey(4)), arrow::util::nullopt);
+  ASSERT_EQ(2, cache.size());
+
+  // evicts everything else
+  cache.insert(TestCacheKey(5), "hello", 100);
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(100, cache.total_size());
+  ASSERT_EQ(3, cache.num_evictions());
+}
 }  // namespace gandiva
@@ -0,0 +1,261 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/object_code_disk_cache.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <sys/stat.h>
+#include <sys/utime.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#endif
+
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
+#include "arrow/result.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string.h"
+
+namespace gandiva {
+
+using arrow::internal::PlatformFilename;
+
+namespace {
+
+static const int64_t DEFAULT_DISK_CACHE_SIZE = 256LL << 20;
+
+// An object file holds the magic, the length of the key, the key, and the
+// object code, aligned on 16 bytes.
+constexpr char kMagic[] = "GDVOBJ01";
+constexpr int64_t kMagicLength = 8;
+constexpr int64_t kObjectAlignment = 16;
+constexpr char kObjectSuffix[] = ".o";
+
+int64_t ObjectOffset(int64_t key_length) {
+  return arrow::bit_util::RoundUp(kMagicLength + 8 + key_length, kObjectAlignment);
+}
+
+struct FileStat {
+  int64_t size;
+  int64_t mtime_ns;
+};
+
+// Return false if the file does not exist
+Result<bool> StatFile(const PlatformFilename& path, FileStat* out) {
+#ifdef _WIN32
+  struct _stat64 st;
+  const int ret = _wstat64(path.ToNative().c_str(), &st);
+#else
+  struct stat st;
+  const int ret = stat(path.ToNative().c_str(), &st);
+#endif
+  if (ret != 0) {
+    if (errno == ENOENT) return false;
+    return arrow::internal::IOErrorFromErrno(errno, "Failed to stat '", path.ToString(),
+                                             "'");
+  }
+  out->size = static_cast<int64_t>(st.st_size);
+#if defined(_WIN32)
+  out->mtime_ns = static_cast<int64_t>(st.st_mtime) * 1000000000LL;
+#elif defined(__APPLE__)
+  out->mtime_ns = static_cast<int64_t>(st.st_mtimespec.tv_sec) * 1000000000LL +
+                  st.st_mtimespec.tv_nsec;
+#else
+  out->mtime_ns =
+      static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000LL + st.st_mtim.tv_nsec;
+#endif
+  return true;
+}
+
+// Mark the file as recently used
+void TouchFile(const PlatformFilename& path) {
+#ifdef _WIN32
+  _wutime64(path.ToNative().c_str(), nullptr);
+#else
+  utimensat(AT_FDCWD, path.ToNative().c_str(), nullptr, 0);
+#endif
+}
+
+std::shared_ptr<ObjectCodeDiskCache> MakeDefaultDiskCache() {
+  auto maybe_path = ::arrow::internal::GetEnvVar("GANDIVA_DISK_CACHE_PATH");
+  if (!maybe_path.ok() || maybe_path->empty()) {
+    return nullptr;
+  }
+  int64_t capacity = DEFAULT_DISK_CACHE_SIZE;
+  auto maybe_env_size = ::arrow::internal::GetEnvVar("GANDIVA_DISK_CACHE_SIZE");
+  if (maybe_env_size.ok() && !maybe_env_size->empty()) {
+    capacity = std::atoll(maybe_env_size->c_str());
+    if (capacity <= 0) {
+      ARROW_LOG(WARNING) << "Invalid cache size provided in GANDIVA_DISK_CACHE_SIZE. "
+                         << "Using default disk cache size: " << DEFAULT_DISK_CACHE_SIZE;
+      capacity = DEFAULT_DISK_CACHE_SIZE;
+    }
+  }
+  ARROW_LOG(INFO) << "Creating gandiva disk cache in " << *maybe_path
+                  << " with capacity of " << capacity << " bytes";
+  return std::make_shared<ObjectCodeDiskCache>(*std::move(maybe_path), capacity);
+}
+
+}  // namespace
+
+ObjectCodeDiskCache::ObjectCodeDiskCache(std::string directory, int64_t capacity)
+    : directory_(std::move(directory)), capacity_(capacity) {}
+
+std::shared_ptr<ObjectCodeDiskCache> ObjectCodeDiskCache::GetDefault() {
+  static std::shared_ptr<ObjectCodeDiskCache> disk_cache = MakeDefaultDiskCache();
+  return disk_cache;
+}
+
+std::string ObjectCodeDiskCache::FileName(const std::string& key) const {
+  // Two independent hashes make collisions unlikely; they are detected
+  // anyway by comparing the stored key
+  const uint64_t hashes[2] = {
+      arrow::bit_util::ToLittleEndian(arrow::internal::ComputeStringHash<0>(
+          key.data(), static_cast<int64_t>(key.size()))),
+      arrow::bit_util::ToLittleEndian(arrow::internal::ComputeStringHash<1>(
+          key.data(), static_cast<int64_t>(key.size())))};
+  return arrow::HexEncode(reinterpret_cast<const uint8_t*>(hashes), sizeof(hashes)) +
+         kObjectSuffix;
+}
+
+Result<std::shared_ptr<arrow::Buffer>> ObjectCodeDiskCache::Get(const std::string& key) {
+  ARROW_ASSIGN_OR_RAISE(auto dir, PlatformFilename::FromString(directory_));
+  ARROW_ASSIGN_OR_RAISE(auto path, dir.Join(FileName(key)));
+  auto maybe_file =
+      arrow::io::MemoryMappedFile::Open(path.ToString(), arrow::io::FileMode::READ);
+  if (!maybe_file.ok()) {
+    // Not compiled yet, or evicted
+    ARROW_ASSIGN_OR_RAISE(bool exists, arrow::internal::FileExists(path));
+    if (!exists) return nullptr;
+    return maybe_file.status();
+  }
+  auto file = *std::move(maybe_file);
+  ARROW_ASSIGN_OR_RAISE(auto size, file->GetSize());
+  ARROW_ASSIGN_OR_RAISE(auto contents, file->ReadAt(0, size));
+  RETURN_NOT_OK(file->Close());
+
+  if (size < kMagicLength + 8 || std::memcmp(contents->data(), kMagic, kMagicLength)) {
+    return Status::IOError("Invalid object file '", path.ToString(), "'");
+  }
+  uint64_t key_length;
+  std::memcpy(&key_length, contents->data() + kMagicLength, sizeof(key_length));
+  key_length = arrow::bit_util::FromLittleEndian(key_length);
+  if (key_length > static_cast<uint64_t>(size) ||
+      ObjectOffset(static_cast<int64_t>(key_length)) > size) {
+    return Status::IOError("Invalid object file '", path.ToString(), "'");
+  }
+  if (key_length != key.size() ||
+      std::memcmp(contents->data() + kMagicLength + 8, key.data(), key.size())) {
+    // Hash collision
+    return nullptr;
+  }
+  TouchFile(path);
+  const int64_t offset = ObjectOffset(static_cast<int64_t>(key_length));
+  return arrow::SliceBuffer(std::move(contents), offset, size - offset);
+}
+
+Status ObjectCodeDiskCache::Put(const std::string& key, const uint8_t* data,
+                                int64_t size) {
+  ARROW_ASSIGN_OR_RAISE(auto dir, PlatformFilename::FromString(directory_));
+  RETURN_NOT_OK(arrow::internal::CreateDirTree(dir));
+  const auto name = FileName(key);
+  ARROW_ASSIGN_OR_RAISE(auto path, dir.Join(name));
+  // Write to a name of our own, so that concurrent writers of the same
+  // object don't interleave
+  ARROW_ASSIGN_OR_RAISE(
+      auto temp_path,
+      dir.Join(name + ".tmp-" + std::to_string(arrow::internal::GetRandomSeed())));
+
+  auto write = [&]() -> Status {
+    ARROW_ASSIGN_OR_RAISE(auto out,
+                          arrow::io::FileOutputStream::Open(temp_path.ToString()));
+    const uint64_t key_length =
+        arrow::bit_util::ToLittleEndian(static_cast<uint64_t>(key.size()));
+    const int64_t offset = ObjectOffset(static_cast<int64_t>(key.size()));
+    const std::vector<uint8_t> padding(
+        static_cast<size_t>(offset - kMagicLength - 8 - key.size()), 0);
+    RETURN_NOT_OK(out->Write(kMagic, kMagicLength));
+    RETURN_NOT_OK(out->Write(&key_length, sizeof(key_length)));
+    RETURN_NOT_OK(out->Write(key.data(), static_cast<int64_t>(key.size())));
+    RETURN_NOT_OK(out->Write(padding.data(), static_cast<int64_t>(padding.size())));
+    RETURN_NOT_OK(out->Write(data, size));
+    return out->Close();
+  };
+  auto status = write();
+  if (status.ok() && std::rename(temp_path.ToString().c_str(), path.ToString().c_str())) {
+    status = arrow::internal::IOErrorFromErrno(errno, "Failed to rename '",
+                                               temp_path.ToString(), "'");
+  }
+  if (!status.ok()) {
+    ARROW_UNUSED(arrow::internal::DeleteFile(temp_path));
+    return status;
+  }
+  return Evict();
+}
+
+Status ObjectCodeDiskCache::Evict() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ARROW_ASSIGN_OR_RAISE(auto dir, PlatformFilename::FromString(directory_));
+  ARROW_ASSIGN_OR_RAISE(auto names, arrow::internal::ListDir(dir));
+
+  std::vector<std::pair<FileStat, PlatformFilename>> objects;
+  int64_t total_size = 0;
+  for (const auto& name : names) {
+    const auto name_string = name.ToString();
+    if (name_string.size() < sizeof(kObjectSuffix) - 1 ||
+        name_string.compare(name_string.size() - sizeof(kObjectSuffix) + 1,
+                            std::string::npos, kObjectSuffix) != 0) {
+      continue;
+    }
+    auto path = dir.Join(name);
+    FileStat stat;
+    ARROW_ASSIGN_OR_RAISE(bool exists, StatFile(path, &stat));
+    // Evicted by another process meanwhile
+    if (!exists) continue;
+    total_size += stat.size;
+    objects.emplace_back(stat, std::move(path));
+  }
+  if (total_size <= capacity_) return Status::OK();
+
+  std::sort(objects.begin(), objects.end(),
+            [](const std::pair<FileStat, PlatformFilename>& left,
+               const std::pair<FileStat, PlatformFilename>& right) {
+              return left.first.mtime_ns < right.first.mtime_ns;
+            });
+  // Mapped objects stay valid once their file is deleted
+  for (const auto& object : objects) {
+    if (total_size <= capacity_) break;
+    RETURN_NOT_OK(arrow::internal::DeleteFile(object.second));
+    total_size -= object.first.size;
+  }
+  return Status::OK();
+}
+
+}  // namespace gandiva
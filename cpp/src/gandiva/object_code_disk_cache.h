@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "gandiva/arrow.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief A directory of compiled object code, shared by the processes
+/// pointing at it.
+///
+/// Each object is stored in a file named by a hash of its key, along with
+/// the key itself so that hash collisions are detected. Objects are
+/// loaded by mapping their file. Files are written to a temporary name
+/// and renamed into place, so readers never see partial objects. Reads
+/// update the modification time of the files, and writes evict the least
+/// recently used objects once the directory exceeds its budget.
+///
+/// Errors are returned to the caller, which should fall back to compiling.
+class GANDIVA_EXPORT ObjectCodeDiskCache {
+ public:
+  /// \param[in] directory the directory of the objects, created if needed
+  /// \param[in] capacity the size budget of the directory, in bytes
+  ObjectCodeDiskCache(std::string directory, int64_t capacity);
+
+  /// \brief The cache set up by the GANDIVA_DISK_CACHE_PATH and
+  ///   GANDIVA_DISK_CACHE_SIZE environment variables, or null if the
+  ///   former is unset.
+  static std::shared_ptr<ObjectCodeDiskCache> GetDefault();
+
+  /// \brief Get the object code stored under the key.
+  ///
+  /// \return a buffer mapping the file, null if there is no such object
+  Result<std::shared_ptr<arrow::Buffer>> Get(const std::string& key);
+
+  /// \brief Store the object code under the key, then evict the least
+  ///   recently used objects beyond the budget.
+  Status Put(const std::string& key, const uint8_t* data, int64_t size);
+
+  const std::string& directory() const { return directory_; }
+  int64_t capacity() const { return capacity_; }
+
+ private:
+  std::string FileName(const std::string& key) const;
+  Status Evict();
+
+  const std::string directory_;
+  const int64_t capacity_;
+  // Serializes the evictions of this process
+  std::mutex mutex_;
+};
+
+}  // namespace gandiva
@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/object_code_disk_cache.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace gandiva {
+
+class TestObjectCodeDiskCache : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_,
+                         arrow::internal::TemporaryDir::Make("gandiva-disk-cache-"));
+    directory_ = temp_dir_->path().ToString() + "objects";
+  }
+
+  void Put(ObjectCodeDiskCache* cache, const std::string& key, const std::string& code) {
+    ASSERT_OK(cache->Put(key, reinterpret_cast<const uint8_t*>(code.data()),
+                         static_cast<int64_t>(code.size())));
+  }
+
+  void AssertObject(ObjectCodeDiskCache* cache, const std::string& key,
+                    const std::string& expected) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, cache->Get(key));
+    ASSERT_NE(buffer, nullptr);
+    ASSERT_EQ(buffer->ToString(), expected);
+  }
+
+  void AssertNoObject(ObjectCodeDiskCache* cache, const std::string& key) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, cache->Get(key));
+    ASSERT_EQ(buffer, nullptr);
+  }
+
+ protected:
+  std::unique_ptr<arrow::internal::TemporaryDir> temp_dir_;
+  std::string directory_;
+};
+
+TEST_F(TestObjectCodeDiskCache, RoundTrip) {
+  ObjectCodeDiskCache cache(directory_, 1 << 20);
+  AssertNoObject(&cache, "expr-1");
+  Put(&cache, "expr-1", "object code 1");
+  Put(&cache, "expr-2", std::string(1000, 'x'));
+  AssertObject(&cache, "expr-1", "object code 1");
+  AssertObject(&cache, "expr-2", std::string(1000, 'x'));
+
+  // Shared with other instances, e.g. in other processes
+  ObjectCodeDiskCache other(directory_, 1 << 20);
+  AssertObject(&other, "expr-1", "object code 1");
+  Put(&other, "expr-1", "object code 1 bis");
+  AssertObject(&cache, "expr-1", "object code 1 bis");
+}
+
+TEST_F(TestObjectCodeDiskCache, MappedObjectOutlivesFile) {
+  ObjectCodeDiskCache cache(directory_, 1 << 20);
+  Put(&cache, "expr-1", "object code 1");
+  ASSERT_OK_AND_ASSIGN(auto buffer, cache.Get("expr-1"));
+  ASSERT_OK(arrow::internal::DeleteDirTree(
+                *arrow::internal::PlatformFilename::FromString(directory_))
+                .status());
+  AssertNoObject(&cache, "expr-1");
+  ASSERT_EQ(buffer->ToString(), "object code 1");
+}
+
+TEST_F(TestObjectCodeDiskCache, EvictLeastRecentlyUsed) {
+#ifdef _WIN32
+  GTEST_SKIP() << "Modification times have a resolution of a second";
+#endif
+  // Room for two objects
+  const std::string code(1000, 'x');
+  ObjectCodeDiskCache cache(directory_, 2500);
+  // Let the modification times differ
+  auto tick = [] { std::this_thread::sleep_for(std::chrono::milliseconds(20)); };
+
+  Put(&cache, "expr-1", code);
+  tick();
+  Put(&cache, "expr-2", code);
+  tick();
+  AssertObject(&cache, "expr-1", code);
+  tick();
+  Put(&cache, "expr-3", code);
+
+  AssertObject(&cache, "expr-1", code);
+  AssertNoObject(&cache, "expr-2");
+  AssertObject(&cache, "expr-3", code);
+}
+
+}  // namespace gandiva
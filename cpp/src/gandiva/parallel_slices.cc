@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/parallel_slices.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+
+namespace gandiva {
+
+int64_t GetSliceRows(const Configuration& configuration, int64_t num_rows) {
+  int64_t slice_rows = configuration.parallel_slice_rows();
+  if (slice_rows <= 0) {
+    return 0;
+  }
+  slice_rows = arrow::bit_util::RoundUp(slice_rows, 64);
+  if (num_rows <= slice_rows || arrow::internal::GetCpuThreadPool()->OwnsThisThread()) {
+    return 0;
+  }
+  return slice_rows;
+}
+
+Status ParallelForSlices(
+    int64_t num_rows, int64_t slice_rows,
+    const std::function<Status(int index, int64_t offset, int64_t length)>& fn) {
+  return arrow::internal::ParallelFor(
+      NumSlices(num_rows, slice_rows), [&](int index) -> Status {
+        int64_t offset = index * slice_rows;
+        return fn(index, offset, std::min(slice_rows, num_rows - offset));
+      });
+}
+
+ArrayDataPtr SliceFixedWidthOutput(const arrow::ArrayData& array, int64_t offset,
+                                   int64_t length) {
+  DCHECK_EQ(array.offset, 0);
+  DCHECK_EQ(offset % 8, 0);
+  const auto& type = arrow::internal::checked_cast<const arrow::FixedWidthType&>(
+      *array.type);
+  auto validity = arrow::SliceMutableBuffer(array.buffers[0], offset / 8,
+                                            arrow::bit_util::BytesForBits(length));
+  auto data = arrow::SliceMutableBuffer(
+      array.buffers[1], offset * type.bit_width() / 8,
+      arrow::bit_util::BytesForBits(length * type.bit_width()));
+  return arrow::ArrayData::Make(array.type, length,
+                                {std::move(validity), std::move(data)});
+}
+
+}  // namespace gandiva
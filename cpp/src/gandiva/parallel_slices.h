@@ -0,0 +1,56 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "arrow/status.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/configuration.h"
+
+namespace gandiva {
+
+/// \brief Get the number of rows of the slices a batch is evaluated in.
+///
+/// Returns 0 if the batch should be evaluated whole on the calling thread:
+/// slicing is disabled, the batch is not larger than a slice, or the calling
+/// thread belongs to the CPU thread pool (which waiting on the slices could
+/// deadlock). Else, a multiple of 64, so that the bitmaps of the slices start
+/// at 8-byte boundaries and no two slices write to the same byte.
+int64_t GetSliceRows(const Configuration& configuration, int64_t num_rows);
+
+/// \brief Call fn(index, offset, length) for the slices of num_rows rows,
+/// concurrently on the CPU thread pool.
+Status ParallelForSlices(
+    int64_t num_rows, int64_t slice_rows,
+    const std::function<Status(int index, int64_t offset, int64_t length)>& fn);
+
+/// \brief Get the number of slices of num_rows rows.
+inline int NumSlices(int64_t num_rows, int64_t slice_rows) {
+  return static_cast<int>((num_rows + slice_rows - 1) / slice_rows);
+}
+
+/// \brief View rows of a fixed-width array as an array with a zero offset.
+///
+/// The array must have a zero offset, and offset must be a multiple of 8.
+ArrayDataPtr SliceFixedWidthOutput(const arrow::ArrayData& array, int64_t offset,
+                                   int64_t length);
+
+}  // namespace gandiva
@@ -17,15 +17,19 @@
 
 #include "gandiva/projector.h"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/util/logging.h"
 
 #include "gandiva/cache.h"
 #include "gandiva/expr_validator.h"
 #include "gandiva/llvm_generator.h"
+#include "gandiva/parallel_slices.h"
 
 namespace gandiva {
 
@@ -35,7 +39,8 @@ Projector::Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr sc
     : llvm_generator_(std::move(llvm_generator)),
       schema_(schema),
       output_fields_(output_fields),
-      configuration_(configuration) {}
+      configuration_(configuration),
+      varlen_output_stats_(new VarlenOutputStats[output_fields.size()]) {}
 
 Projector::~Projector() {}
 
@@ -67,18 +72,11 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
 
   ExpressionCacheKey cache_key(schema, configuration, exprs, selection_vector_mode);
 
-  bool is_cached = false;
-
-  std::shared_ptr<llvm::MemoryBuffer> prev_cached_obj;
-  prev_cached_obj = cache->GetObjectCode(cache_key);
-
-  // Verify if previous projector obj code was cached
-  if (prev_cached_obj != nullptr) {
-    is_cached = true;
-  }
-
   GandivaObjectCache obj_cache(cache, cache_key);
 
+  // Verify if previous projector obj code was cached, in memory or on disk
+  bool is_cached = obj_cache.HasObject();
+
   // Build LLVM generator, and generate code for the specified expressions
   std::unique_ptr<LLVMGenerator> llvm_gen;
   ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, is_cached, &llvm_gen));
@@ -162,18 +160,29 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
 
   auto num_rows =
       selection_vector == nullptr ? batch.num_rows() : selection_vector->GetNumSlots();
+  auto slice_rows =
+      selection_vector == nullptr ? GetSliceRows(*configuration_, num_rows) : 0;
   // Allocate the output data vecs.
   ArrayDataVector output_data_vecs;
   for (auto& field : output_fields_) {
     ArrayDataPtr output_data;
 
-    ARROW_RETURN_NOT_OK(AllocArrayData(field->type(), num_rows, pool, &output_data));
+    // The varlen outputs of slices are built separately.
+    if (slice_rows == 0 || !arrow::is_binary_like(field->type()->id())) {
+      ARROW_RETURN_NOT_OK(
+          AllocArrayData(field->type(), num_rows, pool, &output_data,
+                         EstimateVarlenDataLen(output_data_vecs.size(), num_rows)));
+    }
     output_data_vecs.push_back(output_data);
   }
 
   // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(
-      llvm_generator_->Execute(batch, selection_vector, output_data_vecs));
+  if (slice_rows > 0) {
+    ARROW_RETURN_NOT_OK(ExecuteSlices(batch, slice_rows, pool, &output_data_vecs));
+  } else {
+    ARROW_RETURN_NOT_OK(
+        llvm_generator_->Execute(batch, selection_vector, output_data_vecs));
+  }
 
   // Create and return array arrays.
   output->clear();
@@ -183,9 +192,58 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
   return Status::OK();
 }
 
+Status Projector::ExecuteSlices(const arrow::RecordBatch& batch, int64_t slice_rows,
+                                arrow::MemoryPool* pool,
+                                ArrayDataVector* output_data_vecs) {
+  const int num_slices = NumSlices(batch.num_rows(), slice_rows);
+  // The varlen outputs of each slice, by output field.
+  std::vector<arrow::ArrayVector> varlen_slices(output_fields_.size());
+  for (size_t i = 0; i < output_fields_.size(); ++i) {
+    if ((*output_data_vecs)[i] == nullptr) {
+      varlen_slices[i].resize(num_slices);
+    }
+  }
+
+  ARROW_RETURN_NOT_OK(ParallelForSlices(
+      batch.num_rows(), slice_rows,
+      [&](int index, int64_t offset, int64_t length) -> Status {
+        ArrayDataVector slice_data_vecs;
+        for (size_t i = 0; i < output_fields_.size(); ++i) {
+          ArrayDataPtr slice_data;
+          if ((*output_data_vecs)[i] == nullptr) {
+            ARROW_RETURN_NOT_OK(AllocArrayData(output_fields_[i]->type(), length, pool,
+                                               &slice_data,
+                                               EstimateVarlenDataLen(i, length)));
+          } else {
+            slice_data = SliceFixedWidthOutput(*(*output_data_vecs)[i], offset, length);
+          }
+          slice_data_vecs.push_back(std::move(slice_data));
+        }
+
+        ARROW_RETURN_NOT_OK(
+            llvm_generator_->Execute(*batch.Slice(offset, length), slice_data_vecs));
+
+        for (size_t i = 0; i < output_fields_.size(); ++i) {
+          if (!varlen_slices[i].empty()) {
+            varlen_slices[i][index] = arrow::MakeArray(slice_data_vecs[i]);
+          }
+        }
+        return Status::OK();
+      }));
+
+  for (size_t i = 0; i < output_fields_.size(); ++i) {
+    if (!varlen_slices[i].empty()) {
+      ARROW_ASSIGN_OR_RAISE(auto array, arrow::Concatenate(varlen_slices[i], pool));
+      (*output_data_vecs)[i] = array->data();
+    }
+  }
+  return Status::OK();
+}
+
 // TODO : handle complex vectors (list/map/..)
 Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
-                                 arrow::MemoryPool* pool, ArrayDataPtr* array_data) {
+                                 arrow::MemoryPool* pool, ArrayDataPtr* array_data,
+                                 int64_t varlen_data_len) {
   arrow::Status astatus;
   std::vector<std::shared_ptr<arrow::Buffer>> buffers;
 
@@ -209,12 +267,17 @@ Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
     const auto& fw_type = dynamic_cast<const arrow::FixedWidthType&>(*type);
     data_len = arrow::bit_util::BytesForBits(num_records * fw_type.bit_width());
   } else if (arrow::is_binary_like(type_id)) {
-    // we don't know the expected size for varlen output vectors.
+    // we don't know the exact size for varlen output vectors, the buffer grows as the
+    // entries are added.
     data_len = 0;
   } else {
     return Status::Invalid("Unsupported output data type " + type->ToString());
   }
   ARROW_ASSIGN_OR_RAISE(auto data_buffer, arrow::AllocateResizableBuffer(data_len, pool));
+  if (varlen_data_len > 0 && arrow::is_binary_like(type_id)) {
+    // Start with the expected capacity, to avoid growing the buffer.
+    ARROW_RETURN_NOT_OK(data_buffer->Reserve(varlen_data_len));
+  }
 
   // This is not strictly required but valgrind gets confused and detects this
   // as uninitialized memory access. See arrow::util::SetBitTo().
@@ -227,6 +290,32 @@ Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
   return Status::OK();
 }
 
+int64_t Projector::EstimateVarlenDataLen(size_t idx, int64_t num_records) const {
+  if (!arrow::is_binary_like(output_fields_[idx]->type()->id())) {
+    return 0;
+  }
+  const auto& stats = varlen_output_stats_[idx];
+  int64_t data_bytes = stats.data_bytes.load();
+  int64_t stats_records = stats.num_records.load();
+  if (stats_records == 0) {
+    return 0;
+  }
+  // The average size per record, rounded up, and capped by the 32-bit offsets.
+  int64_t bytes_per_record = (data_bytes + stats_records - 1) / stats_records;
+  return std::min<int64_t>(bytes_per_record * num_records,
+                           std::numeric_limits<int32_t>::max());
+}
+
+void Projector::RecordVarlenDataLens(const ArrayDataVector& output_data_vecs) {
+  for (size_t i = 0; i < output_fields_.size(); ++i) {
+    const auto& array_data = output_data_vecs[i];
+    if (arrow::is_binary_like(output_fields_[i]->type()->id())) {
+      varlen_output_stats_[i].data_bytes += array_data->buffers[2]->size();
+      varlen_output_stats_[i].num_records += array_data->length;
+    }
+  }
+}
+
 Status Projector::ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch) {
   ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
                   Status::Invalid("Schema in RecordBatch must match schema in Make()"));
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -127,9 +128,20 @@ class GANDIVA_EXPORT Projector {
   Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
             const FieldVector& output_fields, std::shared_ptr<Configuration>);
 
-  /// Allocate an ArrowData of length 'length'.
-  Status AllocArrayData(const DataTypePtr& type, int64_t num_records,
-                        arrow::MemoryPool* pool, ArrayDataPtr* array_data);
+  friend class FilterProjector;
+
+  /// Allocate an ArrowData of length 'length', with a data buffer of 'varlen_data_len'
+  /// bytes for a varlen type.
+  static Status AllocArrayData(const DataTypePtr& type, int64_t num_records,
+                               arrow::MemoryPool* pool, ArrayDataPtr* array_data,
+                               int64_t varlen_data_len = 0);
+
+  /// Estimate the data buffer size of the varlen output 'idx' for 'num_records'
+  /// records, from the sizes of the previous outputs.
+  int64_t EstimateVarlenDataLen(size_t idx, int64_t num_records) const;
+
+  /// Record the data buffer sizes of the varlen outputs.
+  void RecordVarlenDataLens(const ArrayDataVector& output_data_vecs);
 
   /// Validate that the ArrayData has sufficient capacity to accommodate 'num_records'.
   Status ValidateArrayDataCapacity(const arrow::ArrayData& array_data,
@@ -138,11 +150,24 @@ class GANDIVA_EXPORT Projector {
   /// Validate the common args for Evaluate() APIs.
   Status ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch);
 
+  /// Execute the expression(s) over slices of 'slice_rows' rows of the batch,
+  /// concurrently. The fixed-width outputs are allocated by the caller, the varlen
+  /// outputs (null on input) are built per slice and concatenated.
+  Status ExecuteSlices(const arrow::RecordBatch& batch, int64_t slice_rows,
+                       arrow::MemoryPool* pool, ArrayDataVector* output_data_vecs);
+
   std::unique_ptr<LLVMGenerator> llvm_generator_;
   SchemaPtr schema_;
   FieldVector output_fields_;
   std::shared_ptr<Configuration> configuration_;
   bool built_from_cache_;
+
+  // The data bytes and records of the varlen outputs evaluated so far, by output field.
+  struct VarlenOutputStats {
+    std::atomic<int64_t> data_bytes{0};
+    std::atomic<int64_t> num_records{0};
+  };
+  std::unique_ptr<VarlenOutputStats[]> varlen_output_stats_;
 };
 
 }  // namespace gandiva
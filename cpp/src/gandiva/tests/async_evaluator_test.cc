@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/async_evaluator.h"
+
+#include <gtest/gtest.h>
+
+#include "arrow/memory_pool.h"
+#include "arrow/testing/executor_util.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "gandiva/tests/test_util.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+using arrow::boolean;
+using arrow::int32;
+using arrow::int64;
+
+class TestAsyncEvaluator : public ::testing::Test {
+ public:
+  void SetUp() {
+    pool_ = arrow::default_memory_pool();
+    field0_ = field("f0", int32());
+    field1_ = field("f1", int32());
+    schema_ = arrow::schema({field0_, field1_});
+
+    int num_records = 5;
+    auto array0 =
+        MakeArrowArrayInt32({1, 2, 3, 4, 5}, {true, true, true, true, false});
+    auto array1 =
+        MakeArrowArrayInt32({10, 0, 30, 1, 50}, {true, false, true, true, true});
+    batch_ = arrow::RecordBatch::Make(schema_, num_records, {array0, array1});
+  }
+
+  // Runs the builds captured by the executor.
+  void FinishBuilds() {
+    for (auto& task : executor_.captured_tasks) {
+      std::move(task)();
+    }
+    executor_.captured_tasks.clear();
+  }
+
+ protected:
+  arrow::MemoryPool* pool_;
+  FieldPtr field0_;
+  FieldPtr field1_;
+  SchemaPtr schema_;
+  std::shared_ptr<arrow::RecordBatch> batch_;
+  arrow::DelayedExecutor executor_;
+};
+
+TEST_F(TestAsyncEvaluator, TestProjectBeforeAndAfterBuild) {
+  // sum = f0 + f1, if (f0 < f1) then f1 else f0, isnull(f1)
+  auto node_f0 = TreeExprBuilder::MakeField(field0_);
+  auto node_f1 = TreeExprBuilder::MakeField(field1_);
+  auto sum = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("add", {node_f0, node_f1}, int32()),
+      field("sum", int32()));
+  auto less_than =
+      TreeExprBuilder::MakeFunction("less_than", {node_f0, node_f1}, boolean());
+  auto max = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeIf(less_than, node_f1, node_f0, int32()),
+      field("max", int32()));
+  auto is_null = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("isnull", {node_f1}, boolean()),
+      field("is_null", boolean()));
+
+  std::shared_ptr<AsyncProjector> projector;
+  ASSERT_OK(AsyncProjector::Make(schema_, {sum, max, is_null}, TestConfiguration(),
+                                 &projector, &executor_));
+  ASSERT_TRUE(projector->interpretable());
+  ASSERT_FALSE(projector->compiled().is_finished());
+
+  auto exp_sum = MakeArrowArrayInt32({11, 0, 33, 5, 0}, {true, false, true, true, false});
+  // A null condition selects the else branch
+  auto exp_max = MakeArrowArrayInt32({10, 2, 30, 4, 5}, {true, true, true, true, false});
+  auto exp_is_null = MakeArrowArrayBool({false, true, false, false, false});
+
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*batch_, pool_, &outputs));
+  ASSERT_EQ(outputs.size(), 3U);
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_max, outputs.at(1));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_is_null, outputs.at(2));
+
+  FinishBuilds();
+  ASSERT_FINISHES_OK(projector->compiled());
+  outputs.clear();
+  ASSERT_OK(projector->Evaluate(*batch_, pool_, &outputs));
+  ASSERT_EQ(outputs.size(), 3U);
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_max, outputs.at(1));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_is_null, outputs.at(2));
+}
+
+TEST_F(TestAsyncEvaluator, TestProjectWaitsForBuild) {
+  // No translation for castBIGINT, evaluations wait for the build
+  auto node_f0 = TreeExprBuilder::MakeField(field0_);
+  auto expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("castBIGINT", {node_f0}, int64()),
+      field("cast", int64()));
+
+  std::shared_ptr<AsyncProjector> projector;
+  ASSERT_OK(AsyncProjector::Make(schema_, {expr}, TestConfiguration(), &projector));
+  ASSERT_FALSE(projector->interpretable());
+
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*batch_, pool_, &outputs));
+  ASSERT_TRUE(projector->compiled().is_finished());
+  EXPECT_ARROW_ARRAY_EQUALS(
+      MakeArrowArrayInt64({1, 2, 3, 4, 0}, {true, true, true, true, false}),
+      outputs.at(0));
+}
+
+TEST_F(TestAsyncEvaluator, TestProjectBuildError) {
+  auto node_f0 = TreeExprBuilder::MakeField(field0_);
+  auto expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("no_such_function", {node_f0}, int32()),
+      field("out", int32()));
+
+  std::shared_ptr<AsyncProjector> projector;
+  ASSERT_OK(AsyncProjector::Make(schema_, {expr}, TestConfiguration(), &projector,
+                                 &executor_));
+  FinishBuilds();
+  arrow::ArrayVector outputs;
+  ASSERT_RAISES(ExpressionValidationError,
+                projector->Evaluate(*batch_, pool_, &outputs));
+}
+
+TEST_F(TestAsyncEvaluator, TestFilterBeforeAndAfterBuild) {
+  // f0 < f1 and not isnull(f0)
+  auto node_f0 = TreeExprBuilder::MakeField(field0_);
+  auto node_f1 = TreeExprBuilder::MakeField(field1_);
+  auto less_than =
+      TreeExprBuilder::MakeFunction("less_than", {node_f0, node_f1}, boolean());
+  auto not_null = TreeExprBuilder::MakeFunction("isnotnull", {node_f0}, boolean());
+  auto condition =
+      TreeExprBuilder::MakeCondition(TreeExprBuilder::MakeAnd({less_than, not_null}));
+
+  std::shared_ptr<AsyncFilter> filter;
+  ASSERT_OK(
+      AsyncFilter::Make(schema_, condition, TestConfiguration(), &filter, &executor_));
+  ASSERT_TRUE(filter->interpretable());
+
+  // Rows with a null condition are not selected
+  auto exp = MakeArrowArrayUint16({0, 2});
+  std::shared_ptr<SelectionVector> selection_vector;
+  ASSERT_OK(SelectionVector::MakeInt16(batch_->num_rows(), pool_, &selection_vector));
+  ASSERT_OK(filter->Evaluate(*batch_, selection_vector));
+  EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
+
+  FinishBuilds();
+  ASSERT_FINISHES_OK(filter->compiled());
+  ASSERT_OK(SelectionVector::MakeInt16(batch_->num_rows(), pool_, &selection_vector));
+  ASSERT_OK(filter->Evaluate(*batch_, selection_vector));
+  EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
+}
+
+}  // namespace gandiva
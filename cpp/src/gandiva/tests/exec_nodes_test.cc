@@ -0,0 +1,120 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/exec_nodes.h"
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/expression.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "gandiva/tests/test_util.h"
+
+namespace gandiva {
+
+namespace cp = arrow::compute;
+
+class TestExecNodes : public ::testing::Test {
+ public:
+  static void SetUpTestSuite() { ASSERT_OK(RegisterExecNodes()); }
+
+  void SetUp() {
+    schema_ = arrow::schema({field("a", arrow::int32()), field("b", arrow::int32()),
+                             field("s", arrow::utf8())});
+    table_ = arrow::TableFromJSON(schema_, {R"([
+      [1, 10, "one"], [2, null, "two"], [3, 30, null], [null, 40, "four"],
+      [5, 50, "five"], [6, 6, "six"], [7, 70, "seven"], [8, 8, "eight"]
+    ])"});
+  }
+
+  // Runs source -> [filter ->] project -> sink, with the nodes of the
+  // given factory name prefix ("" or "gandiva_").
+  Status Run(const std::string& prefix, const cp::Expression* filter,
+             const std::vector<cp::Expression>& exprs,
+             std::shared_ptr<arrow::Table>* out) {
+    ARROW_ASSIGN_OR_RAISE(auto plan, cp::ExecPlan::Make());
+    // A single batch, so that the output is in order
+    std::vector<cp::Declaration> decls = {
+        cp::Declaration("table_source", cp::TableSourceNodeOptions(table_, 1024))};
+    if (filter != nullptr) {
+      decls.emplace_back(prefix + "filter", cp::FilterNodeOptions(*filter));
+    }
+    decls.emplace_back(prefix + "project", cp::ProjectNodeOptions(exprs));
+    decls.emplace_back("table_sink", cp::TableSinkNodeOptions(out));
+    ARROW_RETURN_NOT_OK(
+        cp::Declaration::Sequence(std::move(decls)).AddToPlan(plan.get()).status());
+    ARROW_RETURN_NOT_OK(plan->StartProducing());
+    return plan->finished().status();
+  }
+
+  void CheckSameAsKernels(const cp::Expression* filter,
+                          const std::vector<cp::Expression>& exprs,
+                          int64_t expected_rows) {
+    std::shared_ptr<arrow::Table> expected, actual;
+    ASSERT_OK(Run("", filter, exprs, &expected));
+    ASSERT_OK(Run("gandiva_", filter, exprs, &actual));
+    ASSERT_EQ(actual->num_rows(), expected_rows);
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+
+ protected:
+  SchemaPtr schema_;
+  std::shared_ptr<arrow::Table> table_;
+};
+
+TEST_F(TestExecNodes, TestFilterProject) {
+  auto filter = cp::and_(cp::greater(cp::field_ref("b"), cp::field_ref("a")),
+                         cp::call("is_valid", {cp::field_ref("s")}));
+  std::vector<cp::Expression> exprs = {
+      cp::call("add", {cp::field_ref("a"), cp::call("multiply", {cp::field_ref("b"),
+                                                                  cp::literal(2)})}),
+      cp::call("if_else", {cp::less(cp::field_ref("a"), cp::literal(3)),
+                           cp::field_ref("a"), cp::field_ref("b")}),
+      cp::call("utf8_upper", {cp::field_ref("s")}),
+      cp::call("divide", {cp::field_ref("b"), cp::field_ref("a")}),
+  };
+
+  CheckSameAsKernels(&filter, exprs, 3);
+}
+
+TEST_F(TestExecNodes, TestProjectNulls) {
+  // The kernels give a null for a null if-else condition, as the translated tree
+  std::vector<cp::Expression> exprs = {
+      cp::call("if_else", {cp::less(cp::field_ref("a"), cp::field_ref("b")),
+                           cp::field_ref("a"), cp::field_ref("b")}),
+      cp::call("is_null", {cp::field_ref("b")}),
+      cp::and_(cp::less(cp::field_ref("a"), cp::literal(4)),
+               cp::greater(cp::field_ref("b"), cp::literal(20))),
+      cp::call("subtract", {cp::field_ref("a"), cp::literal(arrow::MakeNullScalar(
+                                                    arrow::int32()))}),
+  };
+  CheckSameAsKernels(nullptr, exprs, 8);
+}
+
+TEST_F(TestExecNodes, TestUntranslatable) {
+  ASSERT_OK_AND_ASSIGN(auto plan, cp::ExecPlan::Make());
+  auto decl = cp::Declaration::Sequence({
+      {"table_source", cp::TableSourceNodeOptions(table_, 1024)},
+      {"gandiva_project",
+       cp::ProjectNodeOptions({cp::call("utf8_reverse", {cp::field_ref("s")})})},
+  });
+  ASSERT_RAISES(NotImplemented, decl.AddToPlan(plan.get()));
+}
+
+}  // namespace gandiva
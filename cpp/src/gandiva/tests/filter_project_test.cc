@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 #include "arrow/memory_pool.h"
 #include "gandiva/filter.h"
+#include "gandiva/filter_projector.h"
 #include "gandiva/projector.h"
 #include "gandiva/selection_vector.h"
 #include "gandiva/tests/test_util.h"
@@ -28,6 +29,7 @@ namespace gandiva {
 using arrow::boolean;
 using arrow::float32;
 using arrow::int32;
+using arrow::utf8;
 
 class TestFilterProject : public ::testing::Test {
  public:
@@ -273,4 +275,64 @@ TEST_F(TestFilterProject, TestSimpleIf) {
   // Validate results
   EXPECT_ARROW_ARRAY_EQUALS(exp, outputs.at(0));
 }
+
+TEST_F(TestFilterProject, TestFilterProjector) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto field2 = field("f2", utf8());
+  auto schema = arrow::schema({field0, field1, field2});
+
+  // condition f0 < f1, and f1 / f0, upper(f2) on the matching records
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto node_f1 = TreeExprBuilder::MakeField(field1);
+  auto node_f2 = TreeExprBuilder::MakeField(field2);
+  auto condition = TreeExprBuilder::MakeCondition(
+      TreeExprBuilder::MakeFunction("less_than", {node_f0, node_f1}, boolean()));
+  auto div_expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("divide", {node_f1, node_f0}, int32()),
+      field("div", int32()));
+  auto upper_expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("upper", {node_f2}, utf8()), field("upper", utf8()));
+
+  std::shared_ptr<FilterProjector> filter_projector;
+  ASSERT_OK(FilterProjector::Make(schema, condition, {div_expr, upper_expr},
+                                  TestConfiguration(), &filter_projector));
+
+  // The division by zero is on a record not matching the condition
+  int num_records = 6;
+  auto array0 =
+      MakeArrowArrayInt32({1, 0, 4, 5, 2, 3}, {true, true, true, false, true, true});
+  auto array1 =
+      MakeArrowArrayInt32({10, -1, 12, 50, 9, 30}, {true, true, true, true, true, true});
+  auto array2 = MakeArrowArrayUtf8({"a", "b", "c", "d", "", "f"},
+                                   {true, true, true, true, false, true});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1, array2});
+
+  auto exp_div = MakeArrowArrayInt32({10, 3, 4, 10}, {true, true, true, true});
+  auto exp_upper = MakeArrowArrayUtf8({"A", "C", "", "F"}, {true, true, false, true});
+
+  arrow::ArrayVector outputs;
+  ASSERT_OK(filter_projector->Evaluate(*in_batch, pool_, &outputs));
+  ASSERT_EQ(outputs.size(), 2U);
+  ASSERT_OK(outputs.at(1)->ValidateFull());
+  EXPECT_ARROW_ARRAY_EQUALS(exp_div, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_upper, outputs.at(1));
+
+  // No matching records
+  auto no_match = arrow::RecordBatch::Make(schema, 2,
+                                           {MakeArrowArrayInt32({5, 6}, {true, true}),
+                                            MakeArrowArrayInt32({1, 2}, {true, true}),
+                                            array2->Slice(0, 2)});
+  ASSERT_OK(filter_projector->Evaluate(*no_match, pool_, &outputs));
+  ASSERT_EQ(outputs.size(), 2U);
+  EXPECT_EQ(outputs.at(0)->length(), 0);
+  EXPECT_EQ(outputs.at(1)->length(), 0);
+
+  // A projector is not built from the same code
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {div_expr, upper_expr}, SelectionVector::MODE_UINT32,
+                            TestConfiguration(), &projector));
+  EXPECT_FALSE(projector->GetBuiltFromCache());
+}
+
 }  // namespace gandiva
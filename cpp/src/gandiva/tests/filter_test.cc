@@ -416,4 +416,42 @@ TEST_F(TestFilter, TestLike) {
   EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
 }
 
+TEST_F(TestFilter, TestEvaluateInParallelSlices) {
+  auto field0 = field("f0", arrow::int64());
+  auto schema = arrow::schema({field0});
+
+  // Build condition f0 % 3 == 0
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto mod_func = TreeExprBuilder::MakeFunction(
+      "mod", {node_f0, TreeExprBuilder::MakeLiteral((int32_t)3)}, int32());
+  auto equal_func = TreeExprBuilder::MakeFunction(
+      "equal", {mod_func, TreeExprBuilder::MakeLiteral((int32_t)0)}, boolean());
+  auto condition = TreeExprBuilder::MakeCondition(equal_func);
+
+  // Slices of 64 rows, the last one shorter
+  auto configuration = std::make_shared<Configuration>(*TestConfiguration());
+  configuration->set_parallel_slice_rows(64);
+  std::shared_ptr<Filter> filter;
+  ASSERT_OK(Filter::Make(schema, condition, configuration, &filter));
+
+  int num_records = 1000;
+  std::vector<int64_t> values;
+  std::vector<bool> validity;
+  std::vector<uint16_t> expected;
+  for (int i = 0; i < num_records; i++) {
+    values.push_back(i);
+    validity.push_back(i % 5 != 0);
+    if (i % 3 == 0 && i % 5 != 0) {
+      expected.push_back(static_cast<uint16_t>(i));
+    }
+  }
+  auto array0 = MakeArrowArrayInt64(values, validity);
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0});
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  ASSERT_OK(SelectionVector::MakeInt16(num_records, pool_, &selection_vector));
+  ASSERT_OK(filter->Evaluate(*in_batch, selection_vector));
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayUint16(expected), selection_vector->ToArray());
+}
+
 }  // namespace gandiva
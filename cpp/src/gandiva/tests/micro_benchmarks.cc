@@ -321,6 +321,43 @@ static void TimedTestInExpr(benchmark::State& state) {
   ASSERT_OK(status);
 }
 
+static void DoNullFreeMin(benchmark::State& state, bool null_free_variants) {
+  // schema for input fields
+  auto field0 = field("f0", int64());
+  auto field1 = field("f1", int64());
+  auto schema = arrow::schema({field0, field1});
+  auto pool_ = arrow::default_memory_pool();
+
+  // if (f0 < f1) then f0 else f1, on inputs without nulls
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto node_f1 = TreeExprBuilder::MakeField(field1);
+  auto less_than =
+      TreeExprBuilder::MakeFunction("less_than", {node_f0, node_f1}, boolean());
+  auto expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeIf(less_than, node_f0, node_f1, int64()),
+      field("min", int64()));
+
+  auto configuration = std::make_shared<Configuration>(*TestConfiguration());
+  configuration->set_null_free_variants(null_free_variants);
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {expr}, configuration, &projector));
+
+  Int64DataGenerator data_generator;
+  ProjectEvaluator evaluator(projector);
+
+  Status status = TimedEvaluate<arrow::Int64Type, int64_t>(
+      schema, evaluator, data_generator, pool_, 1 * MILLION, 16 * THOUSAND, state);
+  ASSERT_OK(status);
+}
+
+static void TimedTestNullFreeMin(benchmark::State& state) {
+  DoNullFreeMin(state, /*null_free_variants=*/false);
+}
+
+static void TimedTestNullFreeMinVariant(benchmark::State& state) {
+  DoNullFreeMin(state, /*null_free_variants=*/true);
+}
+
 static void DoDecimalAdd3(benchmark::State& state, int32_t precision, int32_t scale,
                           bool large = false) {
   // schema for input fields
@@ -444,6 +481,8 @@ BENCHMARK(TimedTestCastIntFromString)->MinTime(1.0)->Unit(benchmark::kMicrosecon
 BENCHMARK(TimedTestAllocs)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestMultiOr)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestInExpr)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(TimedTestNullFreeMin)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(TimedTestNullFreeMinVariant)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(DecimalAdd2Fast)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(DecimalAdd2LeadingZeroes)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(DecimalAdd2LeadingZeroesWithDiv)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
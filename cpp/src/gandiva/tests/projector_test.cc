@@ -26,6 +26,7 @@
 #include <cmath>
 
 #include "arrow/memory_pool.h"
+#include "gandiva/cache.h"
 #include "gandiva/literal_holder.h"
 #include "gandiva/node.h"
 #include "gandiva/tests/test_util.h"
@@ -38,6 +39,27 @@ using arrow::float32;
 using arrow::int32;
 using arrow::int64;
 
+// Counts the reallocations of the buffers.
+class ReallocationCountingPool : public arrow::MemoryPool {
+ public:
+  Status Allocate(int64_t size, uint8_t** out) override {
+    return pool_->Allocate(size, out);
+  }
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override {
+    ++num_reallocations_;
+    return pool_->Reallocate(old_size, new_size, ptr);
+  }
+  void Free(uint8_t* buffer, int64_t size) override { pool_->Free(buffer, size); }
+  int64_t bytes_allocated() const override { return pool_->bytes_allocated(); }
+  std::string backend_name() const override { return pool_->backend_name(); }
+
+  int64_t num_reallocations() const { return num_reallocations_; }
+
+ private:
+  arrow::MemoryPool* pool_ = arrow::default_memory_pool();
+  int64_t num_reallocations_ = 0;
+};
+
 class TestProjector : public ::testing::Test {
  public:
   void SetUp() {
@@ -102,6 +124,31 @@ TEST_F(TestProjector, TestProjectCache) {
   EXPECT_TRUE(cached_projector->GetBuiltFromCache());
 }
 
+TEST_F(TestProjector, TestProjectCacheStats) {
+  auto field0 = field("cache_stats_f0", int32());
+  auto schema = arrow::schema({field0});
+  auto field_sum = field("add", int32());
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field0}, field_sum);
+  auto configuration = TestConfiguration();
+
+  const auto before = GetCacheStats();
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, configuration, &projector));
+  EXPECT_FALSE(projector->GetBuiltFromCache());
+  const auto compiled = GetCacheStats();
+  EXPECT_EQ(compiled.misses, before.misses + 1);
+  EXPECT_EQ(compiled.num_compilations, before.num_compilations + 1);
+  EXPECT_GT(compiled.compile_nanos, before.compile_nanos);
+  EXPECT_GT(compiled.size_bytes, 0);
+
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, configuration, &projector));
+  EXPECT_TRUE(projector->GetBuiltFromCache());
+  const auto cached = GetCacheStats();
+  EXPECT_EQ(cached.hits, compiled.hits + 1);
+  EXPECT_EQ(cached.num_compilations, compiled.num_compilations);
+  EXPECT_EQ(cached.compile_nanos, compiled.compile_nanos);
+}
+
 TEST_F(TestProjector, TestProjectCacheFieldNames) {
   // schema for input fields
   auto field0 = field("f0", int32());
@@ -2907,4 +2954,139 @@ TEST_F(TestProjector, TestTranslate) {
   // Validate results
   EXPECT_ARROW_ARRAY_EQUALS(exp_translate, outputs.at(0));
 }
+TEST_F(TestProjector, TestEvaluateInParallelSlices) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", arrow::utf8());
+  auto schema = arrow::schema({field0, field1});
+
+  auto add_expr = TreeExprBuilder::MakeExpression(
+      "add", {field0, field0}, field("add", int32()));
+  auto less_expr = TreeExprBuilder::MakeExpression(
+      "less_than", {field0, field0}, field("less", boolean()));
+  auto ucase_expr =
+      TreeExprBuilder::MakeExpression("ucase", {field1}, field("ucase", arrow::utf8()));
+  ExpressionVector exprs = {add_expr, less_expr, ucase_expr};
+
+  // Slices of 128 rows, the last one shorter
+  auto configuration = std::make_shared<Configuration>(*TestConfiguration());
+  configuration->set_parallel_slice_rows(100);
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, exprs, configuration, &projector));
+  std::shared_ptr<Projector> serial_projector;
+  ASSERT_OK(Projector::Make(schema, exprs, TestConfiguration(), &serial_projector));
+
+  int num_records = 1000;
+  std::vector<int32_t> values;
+  std::vector<std::string> strings;
+  std::vector<bool> validity;
+  for (int i = 0; i < num_records; i++) {
+    values.push_back(i);
+    strings.push_back("row" + std::to_string(i));
+    validity.push_back(i % 7 != 0);
+  }
+  auto array0 = MakeArrowArrayInt32(values, validity);
+  auto array1 = MakeArrowArrayUtf8(strings, validity);
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // Also with a sliced input
+  for (const auto& batch : {in_batch, in_batch->Slice(3, 900)}) {
+    arrow::ArrayVector outputs;
+    ASSERT_OK(projector->Evaluate(*batch, pool_, &outputs));
+    arrow::ArrayVector expected;
+    ASSERT_OK(serial_projector->Evaluate(*batch, pool_, &expected));
+    ASSERT_EQ(outputs.size(), expected.size());
+    for (size_t i = 0; i < outputs.size(); i++) {
+      ASSERT_OK(outputs[i]->ValidateFull());
+      EXPECT_ARROW_ARRAY_EQUALS(expected[i], outputs[i]);
+    }
+  }
+}
+
+TEST_F(TestProjector, TestVarlenOutputSizing) {
+  auto field0 = field("f0", arrow::utf8());
+  auto schema = arrow::schema({field0});
+  auto ucase_expr =
+      TreeExprBuilder::MakeExpression("ucase", {field0}, field("ucase", arrow::utf8()));
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {ucase_expr}, TestConfiguration(), &projector));
+
+  int num_records = 1000;
+  std::vector<std::string> strings(num_records, "abcdefghijklmnop");
+  std::vector<bool> validity(num_records, true);
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records,
+                                           {MakeArrowArrayUtf8(strings, validity)});
+
+  // The data buffer grows geometrically on the first batch
+  ReallocationCountingPool pool;
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*in_batch, &pool, &outputs));
+  ASSERT_OK(outputs.at(0)->ValidateFull());
+  EXPECT_LT(pool.num_reallocations(), 20);
+
+  // and is allocated from the size of the previous ones on the next batches
+  auto num_reallocations = pool.num_reallocations();
+  ASSERT_OK(projector->Evaluate(*in_batch, &pool, &outputs));
+  ASSERT_OK(outputs.at(0)->ValidateFull());
+  EXPECT_EQ(pool.num_reallocations(), num_reallocations);
+}
+
+TEST_F(TestProjector, TestNullFreeVariants) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // if (f0 < f1) then f0 else f1, isnull(f0), f0 + f1
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto node_f1 = TreeExprBuilder::MakeField(field1);
+  auto less_than =
+      TreeExprBuilder::MakeFunction("less_than", {node_f0, node_f1}, boolean());
+  auto min_expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeIf(less_than, node_f0, node_f1, int32()),
+      field("min", int32()));
+  auto isnull_expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("isnull", {node_f0}, boolean()),
+      field("isnull", boolean()));
+  auto add_expr =
+      TreeExprBuilder::MakeExpression("add", {field0, field1}, field("add", int32()));
+
+  auto configuration = std::make_shared<Configuration>(*TestConfiguration());
+  configuration->set_null_free_variants(true);
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {min_expr, isnull_expr, add_expr}, configuration,
+                            &projector));
+  // Only for the expressions reading the validity of the inputs in the loop
+  auto ir = projector->DumpIR();
+  EXPECT_NE(ir.find("expr_0_0_null_free"), std::string::npos);
+  EXPECT_NE(ir.find("expr_1_0_null_free"), std::string::npos);
+  EXPECT_EQ(ir.find("expr_2_0_null_free"), std::string::npos);
+
+  int num_records = 4;
+  auto null_free_batch = arrow::RecordBatch::Make(
+      schema, num_records,
+      {MakeArrowArrayInt32({1, 5, 3, 8}, {true, true, true, true}),
+       MakeArrowArrayInt32({4, 2, 3, 9}, {true, true, true, true})});
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*null_free_batch, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayInt32({1, 2, 3, 8}, {true, true, true, true}),
+                            outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayBool({false, false, false, false}),
+                            outputs.at(1));
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayInt32({5, 7, 6, 17}, {true, true, true, true}),
+                            outputs.at(2));
+
+  // A null condition selects the else branch
+  auto batch = arrow::RecordBatch::Make(
+      schema, num_records,
+      {MakeArrowArrayInt32({1, 5, 3, 8}, {true, false, true, true}),
+       MakeArrowArrayInt32({4, 2, 3, 9}, {true, true, false, true})});
+  ASSERT_OK(projector->Evaluate(*batch, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayInt32({1, 2, 0, 8}, {true, true, false, true}),
+                            outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayBool({false, true, false, false}),
+                            outputs.at(1));
+  EXPECT_ARROW_ARRAY_EQUALS(
+      MakeArrowArrayInt32({5, 0, 0, 17}, {true, false, false, true}), outputs.at(2));
+}
+
 }  // namespace gandiva
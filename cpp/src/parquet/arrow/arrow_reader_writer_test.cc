@@ -30,6 +30,7 @@
 #include <vector>
 
 #include "arrow/array/builder_binary.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/array/builder_decimal.h"
 #include "arrow/array/builder_dict.h"
 #include "arrow/array/builder_nested.h"
@@ -2201,6 +2202,35 @@ TEST(TestArrowReadWrite, MultithreadedRead) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, MultithreadedWrite) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+  // Nested columns span several leaf columns, exercising the leaf offsets
+  auto nested_type = ::arrow::struct_(
+      {::arrow::field("a", ::arrow::list(::arrow::int32())),
+       ::arrow::field("b", ::arrow::utf8())});
+  auto nested = ArrayFromJSON(nested_type, R"([{"a": [1, 2], "b": "x"}, null,
+                                              {"a": null, "b": null}])");
+  ASSERT_OK_AND_ASSIGN(nested, ::arrow::Concatenate(std::vector<std::shared_ptr<Array>>(
+                                                       num_rows / 2, nested)));
+  nested = nested->Slice(0, num_rows);
+  ASSERT_OK_AND_ASSIGN(table, table->AddColumn(1, ::arrow::field("nested", nested_type),
+                                               std::make_shared<ChunkedArray>(nested)));
+
+  auto arrow_properties = ArrowWriterProperties::Builder().set_use_threads(true)->build();
+  for (int64_t row_group_size : {num_rows, num_rows / 3}) {
+    ARROW_SCOPED_TRACE("row_group_size = ", row_group_size);
+    std::shared_ptr<Table> result;
+    ASSERT_NO_FATAL_FAILURE(DoSimpleRoundtrip(table, /*use_threads=*/false,
+                                              row_group_size, {}, &result,
+                                              arrow_properties));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
+  }
+}
+
 TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   const int num_columns = 10;
   const int num_rows = 100;
@@ -2237,6 +2267,251 @@ TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   AssertTablesEqual(*table, *concatenated, /*same_chunk_layout=*/false);
 }
 
+TEST(TestArrowReadWrite, ReadRowGroupSelection) {
+  const int64_t num_rows = 5000;
+  ::arrow::random::RandomArrayGenerator rand(/*seed=*/42);
+  auto schema = ::arrow::schema({::arrow::field("i", ::arrow::int64(), false),
+                                 ::arrow::field("s", ::arrow::utf8()),
+                                 ::arrow::field("l", ::arrow::list(::arrow::int32()))});
+  auto table = Table::Make(
+      schema, {rand.Int64(num_rows, 0, 1000, /*null_probability=*/0),
+               rand.String(num_rows, 0, 10, /*null_probability=*/0.2),
+               rand.ArrayOf(::arrow::list(::arrow::int32()), num_rows, 0.2)});
+
+  // Small pages, so that selections start and end in different pages
+  auto sink = CreateOutputStream();
+  auto write_props =
+      WriterProperties::Builder().data_pagesize(512)->write_batch_size(100)->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink, num_rows,
+                                write_props, default_arrow_writer_properties()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  ASSERT_EQ(1, reader->num_row_groups());
+
+  auto check_selection = [&](const RowSelection& selection) {
+    std::vector<std::shared_ptr<Table>> slices;
+    for (const auto& range : selection.ranges()) {
+      slices.push_back(table->Slice(range.offset, range.length));
+    }
+    std::shared_ptr<Table> expected = table->Slice(0, 0);
+    if (!slices.empty()) {
+      ASSERT_OK_AND_ASSIGN(expected, ::arrow::ConcatenateTables(slices));
+    }
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadRowGroup(0, {0, 1, 2}, selection, &result));
+    ASSERT_OK(result->ValidateFull());
+    AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false);
+  };
+
+  ASSERT_NO_FATAL_FAILURE(check_selection(RowSelection()));
+  ASSERT_OK_AND_ASSIGN(auto selection, RowSelection::Make({{0, num_rows}}));
+  ASSERT_NO_FATAL_FAILURE(check_selection(selection));
+  ASSERT_OK_AND_ASSIGN(
+      selection, RowSelection::Make({{0, 10}, {100, 1}, {1500, 900}, {4990, 10}}));
+  ASSERT_NO_FATAL_FAILURE(check_selection(selection));
+  ASSERT_OK_AND_ASSIGN(selection, RowSelection::Make({{4999, 1}}));
+  ASSERT_NO_FATAL_FAILURE(check_selection(selection));
+
+  // Late materialization: select rows on one column, then read the others
+  std::shared_ptr<Table> predicate_table;
+  ASSERT_OK_NO_THROW(reader->ReadRowGroup(0, {0}, &predicate_table));
+  ASSERT_OK_AND_ASSIGN(
+      Datum mask, ::arrow::compute::CallFunction(
+                      "less", {predicate_table->column(0), Datum(int64_t(10))}));
+  ASSERT_OK_AND_ASSIGN(auto mask_array,
+                       ::arrow::Concatenate(mask.chunked_array()->chunks()));
+  selection =
+      RowSelection::FromMask(checked_cast<const ::arrow::BooleanArray&>(*mask_array));
+  ASSERT_GT(selection.num_rows(), 0);
+  ASSERT_LT(selection.num_rows(), num_rows / 10);
+  ASSERT_NO_FATAL_FAILURE(check_selection(selection));
+
+  // Selection past the end of the row group
+  ASSERT_OK_AND_ASSIGN(selection, RowSelection::Make({{4990, 11}}));
+  std::shared_ptr<Table> result;
+  ASSERT_RAISES(Invalid, reader->ReadRowGroup(0, {0}, selection, &result));
+}
+
+TEST(TestArrowReadWrite, PagePrefetch) {
+  const int64_t num_rows = 5000;
+  ::arrow::random::RandomArrayGenerator rand(/*seed=*/42);
+  auto schema = ::arrow::schema({::arrow::field("i", ::arrow::int64(), false),
+                                 ::arrow::field("s", ::arrow::utf8()),
+                                 ::arrow::field("l", ::arrow::list(::arrow::int32()))});
+  auto table = Table::Make(
+      schema, {rand.Int64(num_rows, 0, 1000, /*null_probability=*/0),
+               rand.String(num_rows, 0, 10, /*null_probability=*/0.2),
+               rand.ArrayOf(::arrow::list(::arrow::int32()), num_rows, 0.2)});
+
+  // Many small pages over several row groups
+  auto sink = CreateOutputStream();
+  auto write_props =
+      WriterProperties::Builder().data_pagesize(512)->write_batch_size(100)->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                num_rows / 3, write_props,
+                                default_arrow_writer_properties()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  for (bool use_threads : {false, true}) {
+    ARROW_SCOPED_TRACE("use_threads = ", use_threads);
+    ReaderProperties properties;
+    properties.enable_page_prefetch();
+    ArrowReaderProperties arrow_properties;
+    arrow_properties.set_use_threads(use_threads);
+    arrow_properties.set_batch_size(700);
+
+    FileReaderBuilder builder;
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(builder.Open(std::make_shared<BufferReader>(buffer), properties));
+    ASSERT_OK(builder.properties(arrow_properties)->Build(&reader));
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_OK(result->ValidateFull());
+    AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+
+    // Readers dropped with a page still being prefetched
+    std::shared_ptr<::arrow::RecordBatchReader> batch_reader;
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1, 2}, &batch_reader));
+    std::shared_ptr<::arrow::RecordBatch> batch;
+    ASSERT_OK(batch_reader->ReadNext(&batch));
+    ASSERT_EQ(700, batch->num_rows());
+  }
+}
+
+TEST(TestArrowReadWrite, RowGroupsSizedInBytes) {
+  // Rows get ten times wider halfway through the table
+  ::arrow::random::RandomArrayGenerator rand(/*seed=*/42);
+  ASSERT_OK_AND_ASSIGN(
+      auto strings,
+      ::arrow::Concatenate({rand.String(20000, 10, 10, /*null_probability=*/0),
+                            rand.String(20000, 100, 100, /*null_probability=*/0)}));
+  const int64_t num_rows = strings->length();
+  auto schema = ::arrow::schema({::arrow::field("i", ::arrow::int64(), false),
+                                 ::arrow::field("s", ::arrow::utf8(), false)});
+  auto table = Table::Make(
+      schema, {rand.Int64(num_rows, 0, 1000, /*null_probability=*/0), strings});
+
+  const int64_t target_bytes = 256 * 1024;
+  for (bool use_threads : {false, true}) {
+    ARROW_SCOPED_TRACE("use_threads = ", use_threads);
+    auto write_props = WriterProperties::Builder()
+                           .max_row_group_bytes(target_bytes)
+                           ->disable_dictionary()
+                           ->data_pagesize(16 * 1024)
+                           ->build();
+    auto arrow_write_props = ArrowWriterProperties::Builder()
+                                 .set_use_threads(use_threads)
+                                 ->build();
+    auto sink = CreateOutputStream();
+    ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                  num_rows, write_props, arrow_write_props));
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(), &reader));
+    auto metadata = reader->parquet_reader()->metadata();
+    ASSERT_GT(metadata->num_row_groups(), 5);
+    // Narrow rows are packed into row groups with more rows, and all but the
+    // last row group are close to the target size
+    EXPECT_GT(metadata->RowGroup(0)->num_rows(),
+              metadata->RowGroup(metadata->num_row_groups() - 2)->num_rows());
+    for (int i = 0; i < metadata->num_row_groups() - 1; i++) {
+      ARROW_SCOPED_TRACE("row group ", i);
+      EXPECT_GE(metadata->RowGroup(i)->total_byte_size(), target_bytes * 3 / 4);
+      EXPECT_LE(metadata->RowGroup(i)->total_byte_size(), target_bytes * 3 / 2);
+    }
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_OK(result->ValidateFull());
+    AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+  }
+}
+
+
+TEST(TestArrowReadWrite, ZeroCopyValues) {
+  const int num_rows = 5000;
+  ::arrow::random::RandomArrayGenerator rand(/*seed=*/42);
+  auto schema = ::arrow::schema({::arrow::field("a", ::arrow::int64(), false),
+                                 ::arrow::field("b", ::arrow::float64(), false),
+                                 ::arrow::field("c", ::arrow::int32()),
+                                 ::arrow::field("d", ::arrow::int32(), false)});
+  auto table = Table::Make(schema, {rand.Int64(num_rows, 0, 1000, 0),
+                                    rand.Float64(num_rows, 0, 1, 0),
+                                    rand.Int32(num_rows, 0, 1000, 0.2),
+                                    rand.Int32(num_rows, 0, 10, 0)});
+
+  // Small PLAIN pages for "a" and "b", dictionary-encoded pages for "d".
+  // Decompressed pages are always aligned, uncompressed ones depend on the
+  // size of the page headers.
+#ifdef ARROW_WITH_SNAPPY
+  const auto codec = Compression::SNAPPY;
+#else
+  const auto codec = Compression::UNCOMPRESSED;
+#endif
+  auto write_props = WriterProperties::Builder()
+                         .data_pagesize(1024)
+                         ->write_batch_size(100)
+                         ->compression(codec)
+                         ->disable_dictionary("a")
+                         ->disable_dictionary("b")
+                         ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                num_rows / 2, write_props,
+                                default_arrow_writer_properties()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_zero_copy_values(true);
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_OK(result->ValidateFull());
+  AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+#ifdef ARROW_WITH_SNAPPY
+  // One chunk per data page
+  ASSERT_GT(result->column(0)->num_chunks(), 2);
+  ASSERT_GT(result->column(1)->num_chunks(), 2);
+#endif
+  // Nullable or dictionary-encoded columns are copied as usual
+  ASSERT_EQ(1, result->column(2)->num_chunks());
+  ASSERT_EQ(1, result->column(3)->num_chunks());
+
+  // Record batches are split at page boundaries
+  std::unique_ptr<::arrow::RecordBatchReader> batch_reader;
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, &batch_reader));
+  ASSERT_OK_AND_ASSIGN(auto batched_table,
+                       ::arrow::Table::FromRecordBatchReader(batch_reader.get()));
+  ASSERT_OK(batched_table->ValidateFull());
+  AssertTablesEqual(*table, *batched_table, /*same_chunk_layout=*/false);
+}
+
+TEST(TestArrowReadWrite, RowSelectionMake) {
+  ASSERT_RAISES(Invalid, RowSelection::Make({{10, 5}, {0, 5}}));
+  ASSERT_RAISES(Invalid, RowSelection::Make({{0, 5}, {4, 5}}));
+  ASSERT_RAISES(Invalid, RowSelection::Make({{0, 0}}));
+
+  auto mask = ArrayFromJSON(::arrow::boolean(), "[true, true, null, false, true, false]");
+  auto selection =
+      RowSelection::FromMask(checked_cast<const ::arrow::BooleanArray&>(*mask));
+  ASSERT_EQ(2, selection.ranges().size());
+  ASSERT_EQ(0, selection.ranges()[0].offset);
+  ASSERT_EQ(2, selection.ranges()[0].length);
+  ASSERT_EQ(4, selection.ranges()[1].offset);
+  ASSERT_EQ(1, selection.ranges()[1].length);
+  ASSERT_EQ(3, selection.num_rows());
+}
+
 //  Exercise reading table manually with nested RowGroup and Column loops, i.e.
 //
 //  for (int i = 0; i < n_row_groups; i++)
@@ -2346,6 +2621,20 @@ TEST(TestArrowReadWrite, CoalescedReads) {
   TestGetRecordBatchReader(arrow_properties);
 }
 
+// Same as the test above, but decoding row groups ahead on the thread pool.
+TEST(TestArrowReadWrite, RowGroupReadahead) {
+  ArrowReaderProperties arrow_properties = default_arrow_reader_properties();
+  arrow_properties.set_row_group_readahead(4);
+  TestGetRecordBatchReader(arrow_properties);
+
+  // A budget smaller than any row group still reads one row group ahead
+  arrow_properties.set_row_group_readahead_bytes(1);
+  TestGetRecordBatchReader(arrow_properties);
+
+  arrow_properties.set_pre_buffer(true);
+  TestGetRecordBatchReader(arrow_properties);
+}
+
 // Use coalesced reads, and explicitly wait for I/O to complete.
 TEST(TestArrowReadWrite, WaitCoalescedReads) {
   ArrowReaderProperties properties = default_arrow_reader_properties();
@@ -2379,6 +2668,44 @@ TEST(TestArrowReadWrite, WaitCoalescedReads) {
   ASSERT_EQ(actual_batch->num_rows(), num_rows);
 }
 
+TEST(TestArrowReadWrite, ReaderMetrics) {
+  const int num_rows = 10;
+  const int num_columns = 5;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(table, num_rows, default_arrow_writer_properties(), &buffer));
+
+  std::vector<int64_t> bytes_requested;
+  for (bool pre_buffer : {false, true}) {
+    auto metrics = std::make_shared<ReaderMetrics>();
+    ReaderProperties reader_properties;
+    reader_properties.set_metrics(metrics);
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_pre_buffer(pre_buffer);
+
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer), reader_properties));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+    ASSERT_EQ(reader->parquet_reader()->metrics(), metrics);
+
+    std::shared_ptr<Table> actual;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+    ::arrow::AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+
+    ASSERT_GT(metrics->bytes_requested.load(), 0);
+    ASSERT_GT(metrics->decode_ns.load(), 0);
+    // The data is not compressed
+    ASSERT_EQ(metrics->decompression_ns.load(), 0);
+    bytes_requested.push_back(metrics->bytes_requested.load());
+  }
+  ASSERT_EQ(bytes_requested[0], bytes_requested[1]);
+}
+
 TEST(TestArrowReadWrite, GetRecordBatchReaderNoColumns) {
   ArrowReaderProperties properties = default_arrow_reader_properties();
   const int num_rows = 10;
@@ -2408,7 +2735,6 @@ TEST(TestArrowReadWrite, GetRecordBatchReaderNoColumns) {
 }
 
 TEST(TestArrowReadWrite, GetRecordBatchGenerator) {
-  ArrowReaderProperties properties = default_arrow_reader_properties();
   const int num_rows = 1024;
   const int row_group_size = 512;
   const int num_columns = 2;
@@ -2420,50 +2746,56 @@ TEST(TestArrowReadWrite, GetRecordBatchGenerator) {
   ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, row_group_size,
                                              default_arrow_writer_properties(), &buffer));
 
-  std::shared_ptr<FileReader> reader;
-  {
-    std::unique_ptr<FileReader> unique_reader;
-    FileReaderBuilder builder;
-    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
-    ASSERT_OK(builder.properties(properties)->Build(&unique_reader));
-    reader = std::move(unique_reader);
-  }
+  // With pre-buffering, columns are decoded as their column chunks arrive
+  for (bool pre_buffer : {false, true}) {
+    ARROW_SCOPED_TRACE("pre_buffer = ", pre_buffer);
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_pre_buffer(pre_buffer);
+    std::shared_ptr<FileReader> reader;
+    {
+      std::unique_ptr<FileReader> unique_reader;
+      FileReaderBuilder builder;
+      ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+      ASSERT_OK(builder.properties(properties)->Build(&unique_reader));
+      reader = std::move(unique_reader);
+    }
 
-  auto check_batches = [](const std::shared_ptr<::arrow::RecordBatch>& batch,
-                          int num_columns, int num_rows) {
-    ASSERT_NE(batch, nullptr);
-    ASSERT_EQ(batch->num_columns(), num_columns);
-    ASSERT_EQ(batch->num_rows(), num_rows);
-  };
-  {
-    ASSERT_OK_AND_ASSIGN(auto batch_generator,
-                         reader->GetRecordBatchGenerator(reader, {0, 1}, {0, 1}));
-    auto fut1 = batch_generator();
-    auto fut2 = batch_generator();
-    auto fut3 = batch_generator();
-    ASSERT_OK_AND_ASSIGN(auto batch1, fut1.result());
-    ASSERT_OK_AND_ASSIGN(auto batch2, fut2.result());
-    ASSERT_OK_AND_ASSIGN(auto batch3, fut3.result());
-    ASSERT_EQ(batch3, nullptr);
-    check_batches(batch1, num_columns, row_group_size);
-    check_batches(batch2, num_columns, row_group_size);
-    ASSERT_OK_AND_ASSIGN(auto actual, ::arrow::Table::FromRecordBatches(
-                                          batch1->schema(), {batch1, batch2}));
-    AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
-  }
-  {
-    // No columns case
-    ASSERT_OK_AND_ASSIGN(auto batch_generator,
-                         reader->GetRecordBatchGenerator(reader, {0, 1}, {}));
-    auto fut1 = batch_generator();
-    auto fut2 = batch_generator();
-    auto fut3 = batch_generator();
-    ASSERT_OK_AND_ASSIGN(auto batch1, fut1.result());
-    ASSERT_OK_AND_ASSIGN(auto batch2, fut2.result());
-    ASSERT_OK_AND_ASSIGN(auto batch3, fut3.result());
-    ASSERT_EQ(batch3, nullptr);
-    check_batches(batch1, 0, row_group_size);
-    check_batches(batch2, 0, row_group_size);
+    auto check_batches = [](const std::shared_ptr<::arrow::RecordBatch>& batch,
+                            int num_columns, int num_rows) {
+      ASSERT_NE(batch, nullptr);
+      ASSERT_EQ(batch->num_columns(), num_columns);
+      ASSERT_EQ(batch->num_rows(), num_rows);
+    };
+    {
+      ASSERT_OK_AND_ASSIGN(auto batch_generator,
+                           reader->GetRecordBatchGenerator(reader, {0, 1}, {0, 1}));
+      auto fut1 = batch_generator();
+      auto fut2 = batch_generator();
+      auto fut3 = batch_generator();
+      ASSERT_OK_AND_ASSIGN(auto batch1, fut1.result());
+      ASSERT_OK_AND_ASSIGN(auto batch2, fut2.result());
+      ASSERT_OK_AND_ASSIGN(auto batch3, fut3.result());
+      ASSERT_EQ(batch3, nullptr);
+      check_batches(batch1, num_columns, row_group_size);
+      check_batches(batch2, num_columns, row_group_size);
+      ASSERT_OK_AND_ASSIGN(auto actual, ::arrow::Table::FromRecordBatches(
+                                            batch1->schema(), {batch1, batch2}));
+      AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+    }
+    {
+      // No columns case
+      ASSERT_OK_AND_ASSIGN(auto batch_generator,
+                           reader->GetRecordBatchGenerator(reader, {0, 1}, {}));
+      auto fut1 = batch_generator();
+      auto fut2 = batch_generator();
+      auto fut3 = batch_generator();
+      ASSERT_OK_AND_ASSIGN(auto batch1, fut1.result());
+      ASSERT_OK_AND_ASSIGN(auto batch2, fut2.result());
+      ASSERT_OK_AND_ASSIGN(auto batch3, fut3.result());
+      ASSERT_EQ(batch3, nullptr);
+      check_batches(batch1, 0, row_group_size);
+      check_batches(batch2, 0, row_group_size);
+    }
   }
 }
 
@@ -3227,6 +3559,51 @@ TEST(TestArrowReadWrite, NonUniqueDictionaryValues) {
   }
 }
 
+TEST(TestArrowReadWrite, ChangingDictionariesStayDictionaryEncoded) {
+  auto dict_type = ::arrow::dictionary(::arrow::int8(), ::arrow::utf8());
+  auto chunk = [&](const std::string& indices, const std::string& dictionary) {
+    return ::arrow::DictionaryArray::FromArrays(
+               dict_type, ArrayFromJSON(::arrow::int8(), indices),
+               ArrayFromJSON(::arrow::utf8(), dictionary))
+        .ValueOrDie();
+  };
+  // Dictionaries that change, overlap, grow and repeat values
+  ::arrow::ArrayVector chunks = {chunk("[0, 1, 2, null, 1]", R"(["a", "b", "c"])"),
+                                 chunk("[2, 0, null, 1, 0]", R"(["c", "d", "a"])"),
+                                 chunk("[3, 1, 0]", R"(["a", "b", "c", "e"])"),
+                                 chunk("[0, 1, 2]", R"(["f", "f", "a"])")};
+  auto table = Table::Make(::arrow::schema({::arrow::field("d", dict_type)}),
+                           {std::make_shared<ChunkedArray>(chunks)});
+
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                table->num_rows(), default_writer_properties(),
+                                default_arrow_writer_properties()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  // No fallback to PLAIN data pages
+  auto file_reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+  auto column_metadata = file_reader->metadata()->RowGroup(0)->ColumnChunk(0);
+  ASSERT_TRUE(column_metadata->has_dictionary_page());
+  for (const auto& stats : column_metadata->encoding_stats()) {
+    if (stats.page_type == PageType::DATA_PAGE) {
+      ASSERT_TRUE(stats.encoding == Encoding::PLAIN_DICTIONARY ||
+                  stats.encoding == Encoding::RLE_DICTIONARY);
+    }
+  }
+
+  auto expected = ArrayFromJSON(::arrow::utf8(), R"(["a", "b", "c", null, "b",
+                                                     "a", "c", null, "d", "c",
+                                                     "e", "b", "a", "f", "f", "a"])");
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_OK(result->ValidateFull());
+  ::arrow::AssertChunkedEqual(ChunkedArray({expected}), *result->column(0));
+}
+
 TEST(TestArrowWrite, CheckChunkSize) {
   const int num_columns = 2;
   const int num_rows = 128;
@@ -4312,6 +4689,128 @@ INSTANTIATE_TEST_SUITE_P(
     ReadDictionary, TestArrowReadDictionary,
     ::testing::ValuesIn(TestArrowReadDictionary::null_probabilities()));
 
+// Low-cardinality columns of all fixed-width types that can be read as dictionaries
+std::shared_ptr<Table> MakeFixedWidthDictionaryTable(int64_t num_rows) {
+  ::arrow::random::RandomArrayGenerator rag(0);
+  auto indices = rag.Int32(num_rows, 0, 9, /*null_probability=*/0.2);
+  std::vector<std::shared_ptr<Array>> dictionaries = {
+      ArrayFromJSON(::arrow::int32(), "[1, 2, 3, 5, 8, 13, 21, 34, 55, 89]"),
+      ArrayFromJSON(::arrow::int64(), "[-1, -2, -3, -5, -8, -13, -21, -34, -55, -89]"),
+      ArrayFromJSON(::arrow::float32(), "[0, 0.5, 1, 1.5, 2, 2.5, 3, 3.5, 4, 4.5]"),
+      ArrayFromJSON(::arrow::float64(), "[0, 0.25, 1, 1.25, 2, 2.25, 3, 3.25, 4, 4.25]"),
+      ArrayFromJSON(::arrow::fixed_size_binary(3),
+                    R"(["aaa", "bbb", "ccc", "ddd", "eee",
+                        "fff", "ggg", "hhh", "iii", "jjj"])")};
+  ::arrow::FieldVector fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  for (const auto& dictionary : dictionaries) {
+    fields.push_back(::arrow::field(dictionary->type()->ToString(), dictionary->type()));
+    columns.push_back(::arrow::compute::Take(*dictionary, *indices).ValueOrDie());
+  }
+  return Table::Make(::arrow::schema(fields), columns);
+}
+
+// Expand dictionary-encoded chunks back to their values
+std::shared_ptr<ChunkedArray> DecodeDictionaryChunks(const ChunkedArray& column) {
+  ::arrow::ArrayVector chunks;
+  for (const auto& chunk : column.chunks()) {
+    const auto& dict_chunk = checked_cast<const ::arrow::DictionaryArray&>(*chunk);
+    chunks.push_back(
+        ::arrow::compute::Take(*dict_chunk.dictionary(), *dict_chunk.indices())
+            .ValueOrDie());
+  }
+  const auto& dict_type = checked_cast<const ::arrow::DictionaryType&>(*column.type());
+  return std::make_shared<ChunkedArray>(std::move(chunks), dict_type.value_type());
+}
+
+TEST(TestArrowReadDictionaries, FixedWidthTypes) {
+  constexpr int64_t num_rows = 1000;
+  constexpr int num_row_groups = 4;
+  auto expected = MakeFixedWidthDictionaryTable(num_rows);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(expected, num_rows / num_row_groups,
+                                             default_arrow_writer_properties(),
+                                             &buffer));
+
+  for (bool unify : {false, true}) {
+    ARROW_SCOPED_TRACE("unify_dictionaries = ", unify);
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    for (int i = 0; i < expected->num_columns(); ++i) {
+      properties.set_read_dictionary(i, true);
+    }
+    properties.set_unify_dictionaries(unify);
+
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+    std::shared_ptr<Table> actual;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+    ASSERT_OK(actual->ValidateFull());
+
+    for (int i = 0; i < expected->num_columns(); ++i) {
+      const auto& column = *actual->column(i);
+      ASSERT_EQ(::arrow::Type::DICTIONARY, column.type()->id());
+      ::arrow::AssertChunkedEqual(*expected->column(i), *DecodeDictionaryChunks(column));
+
+      // Each row group has its own dictionary page
+      ASSERT_EQ(num_row_groups, column.num_chunks());
+      const auto& first = checked_cast<const ::arrow::DictionaryArray&>(*column.chunk(0));
+      if (unify) {
+        ASSERT_EQ(10, first.dictionary()->length());
+        for (const auto& chunk : column.chunks()) {
+          const auto& dict_chunk = checked_cast<const ::arrow::DictionaryArray&>(*chunk);
+          ASSERT_EQ(first.data()->dictionary, dict_chunk.data()->dictionary);
+        }
+      }
+    }
+  }
+}
+
+TEST(TestArrowReadDictionaries, UnifiedDictionariesGrowAcrossBatches) {
+  constexpr int64_t num_rows = 1000;
+  auto expected = MakeFixedWidthDictionaryTable(num_rows);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(expected, num_rows / 4,
+                                             default_arrow_writer_properties(),
+                                             &buffer));
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_read_dictionary(1, true);
+  properties.set_unify_dictionaries(true);
+  properties.set_batch_size(num_rows / 10);
+
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+  std::unique_ptr<::arrow::RecordBatchReader> batch_reader;
+  ASSERT_OK_NO_THROW(
+      reader->GetRecordBatchReader(::arrow::internal::Iota(4), {1}, &batch_reader));
+
+  ::arrow::ArrayVector values;
+  std::shared_ptr<Array> previous_dictionary;
+  std::shared_ptr<::arrow::RecordBatch> batch;
+  while (true) {
+    ASSERT_OK(batch_reader->ReadNext(&batch));
+    if (batch == nullptr) break;
+    const auto& dict_column =
+        checked_cast<const ::arrow::DictionaryArray&>(*batch->column(0));
+    const auto& dictionary = dict_column.dictionary();
+    if (previous_dictionary != nullptr) {
+      // Earlier dictionaries are a prefix of later ones
+      ASSERT_GE(dictionary->length(), previous_dictionary->length());
+      ASSERT_TRUE(dictionary->RangeEquals(0, previous_dictionary->length(), 0,
+                                          *previous_dictionary));
+    }
+    previous_dictionary = dictionary;
+    values.push_back(
+        ::arrow::compute::Take(*dictionary, *dict_column.indices()).ValueOrDie());
+  }
+  ::arrow::AssertChunkedEqual(*expected->column(1),
+                              ChunkedArray(values, ::arrow::int64()));
+}
+
 TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   constexpr int num_unique = 50;
   constexpr int repeat = 10000;
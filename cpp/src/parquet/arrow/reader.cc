@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -38,6 +39,7 @@
 #include "arrow/util/make_unique.h"
 #include "arrow/util/parallel.h"
 #include "arrow/util/range.h"
+#include "arrow/util/stopwatch.h"
 #include "arrow/util/tracing_internal.h"
 #include "parquet/arrow/reader_internal.h"
 #include "parquet/column_reader.h"
@@ -116,9 +118,17 @@ class ColumnReaderImpl : public ColumnReader {
 
   virtual ::arrow::Status LoadBatch(int64_t num_records) = 0;
 
+  // Load the rows of selection, counted from the current position, skipping
+  // the others
+  virtual ::arrow::Status LoadSelection(const RowSelection& selection) = 0;
+
   virtual ::arrow::Status BuildArray(int64_t length_upper_bound,
                                      std::shared_ptr<::arrow::ChunkedArray>* out) = 0;
   virtual bool IsOrHasRepeatedChild() const = 0;
+
+  // Allow returning values sliced from data pages, in several chunks.  Only
+  // called on top-level readers, as nested readers need single chunks.
+  virtual void EnableZeroCopyValues() {}
 };
 
 namespace {
@@ -209,7 +219,12 @@ class FileReaderImpl : public FileReader {
     ctx->iterator_factory = SomeRowGroupsFactory(row_groups);
     ctx->filter_leaves = true;
     ctx->included_leaves = included_leaves;
-    return GetReader(manifest_.schema_fields[i], ctx, out);
+    ctx->unify_dictionaries = reader_properties_.unify_dictionaries();
+    RETURN_NOT_OK(GetReader(manifest_.schema_fields[i], ctx, out));
+    if (*out != nullptr && reader_properties_.zero_copy_values()) {
+      (*out)->EnableZeroCopyValues();
+    }
+    return Status::OK();
   }
 
   Status GetFieldReaders(const std::vector<int>& column_indices,
@@ -282,7 +297,12 @@ class FileReaderImpl : public FileReader {
                 {"parquet.arrow.physicaltype", phys_type},
                 {"parquet.arrow.records_to_read", records_to_read}});
 #endif
-    return reader->NextBatch(records_to_read, out);
+    const auto& metrics = reader_->metrics();
+    ::arrow::internal::StopWatch watch;
+    if (metrics) watch.Start();
+    Status status = reader->NextBatch(records_to_read, out);
+    if (metrics) metrics->decode_ns += static_cast<int64_t>(watch.Stop());
+    return status;
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
@@ -312,6 +332,13 @@ class FileReaderImpl : public FileReader {
       std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
       const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor);
 
+  // Like DecodeRowGroups, but each column is decoded as soon as its column chunks
+  // are pre-buffered, rather than once all of them are.  PreBuffer must have been
+  // called for the row groups and columns.
+  Future<std::shared_ptr<Table>> DecodeRowGroupsWhenBuffered(
+      std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
+      const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor);
+
   Status ReadRowGroups(const std::vector<int>& row_groups,
                        std::shared_ptr<Table>* table) override {
     return ReadRowGroups(row_groups, Iota(reader_->metadata()->num_columns()), table);
@@ -326,6 +353,10 @@ class FileReaderImpl : public FileReader {
     return ReadRowGroup(i, Iota(reader_->metadata()->num_columns()), table);
   }
 
+  Status ReadRowGroup(int i, const std::vector<int>& column_indices,
+                      const RowSelection& selection,
+                      std::shared_ptr<Table>* out) override;
+
   Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
                               const std::vector<int>& column_indices,
                               std::unique_ptr<RecordBatchReader>* out) override;
@@ -448,7 +479,8 @@ class LeafReader : public ColumnReaderImpl {
         input_(std::move(input)),
         descr_(input_->descr()) {
     record_reader_ = RecordReader::Make(
-        descr_, leaf_info, ctx_->pool, field_->type()->id() == ::arrow::Type::DICTIONARY);
+        descr_, leaf_info, ctx_->pool, field_->type()->id() == ::arrow::Type::DICTIONARY,
+        ctx_->unify_dictionaries);
     NextRowGroup();
   }
 
@@ -472,15 +504,23 @@ class LeafReader : public ColumnReaderImpl {
     record_reader_->Reset();
     // Pre-allocation gives much better performance for flat columns
     record_reader_->Reserve(records_to_read);
-    while (records_to_read > 0) {
-      if (!record_reader_->HasMoreData()) {
-        break;
-      }
-      int64_t records_read = record_reader_->ReadRecords(records_to_read);
-      records_to_read -= records_read;
-      if (records_read == 0) {
-        NextRowGroup();
-      }
+    ReadRecords(records_to_read);
+    RETURN_NOT_OK(
+        TransferColumnData(record_reader_.get(), field_, descr_, ctx_->pool, &out_));
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  Status LoadSelection(const RowSelection& selection) final {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    out_ = nullptr;
+    record_reader_->Reset();
+    record_reader_->Reserve(selection.num_rows());
+    int64_t position = 0;
+    for (const RowSelection::Range& range : selection.ranges()) {
+      SkipRecords(range.offset - position);
+      ReadRecords(range.length);
+      position = range.offset + range.length;
     }
     RETURN_NOT_OK(
         TransferColumnData(record_reader_.get(), field_, descr_, ctx_->pool, &out_));
@@ -496,6 +536,24 @@ class LeafReader : public ColumnReaderImpl {
 
   const std::shared_ptr<Field> field() override { return field_; }
 
+  void EnableZeroCopyValues() final {
+    // Only types transferred by TransferZeroCopy handle several value buffers
+    if (field_->nullable()) return;
+    switch (field_->type()->id()) {
+      case ::arrow::Type::INT32:
+      case ::arrow::Type::INT64:
+      case ::arrow::Type::FLOAT:
+      case ::arrow::Type::DOUBLE:
+        break;
+      case ::arrow::Type::TIMESTAMP:
+        if (descr_->physical_type() == ::parquet::Type::INT64) break;
+        return;
+      default:
+        return;
+    }
+    record_reader_->EnableZeroCopyValues();
+  }
+
  private:
   std::shared_ptr<ChunkedArray> out_;
   void NextRowGroup() {
@@ -503,6 +561,32 @@ class LeafReader : public ColumnReaderImpl {
     record_reader_->SetPageReader(std::move(page_reader));
   }
 
+  void ReadRecords(int64_t records_to_read) {
+    while (records_to_read > 0) {
+      if (!record_reader_->HasMoreData()) {
+        break;
+      }
+      int64_t records_read = record_reader_->ReadRecords(records_to_read);
+      records_to_read -= records_read;
+      if (records_read == 0) {
+        NextRowGroup();
+      }
+    }
+  }
+
+  void SkipRecords(int64_t records_to_skip) {
+    while (records_to_skip > 0) {
+      if (!record_reader_->HasMoreData()) {
+        break;
+      }
+      int64_t records_skipped = record_reader_->SkipRecords(records_to_skip);
+      records_to_skip -= records_skipped;
+      if (records_skipped == 0) {
+        NextRowGroup();
+      }
+    }
+  }
+
   std::shared_ptr<ReaderContext> ctx_;
   std::shared_ptr<Field> field_;
   std::unique_ptr<FileColumnIterator> input_;
@@ -529,6 +613,10 @@ class ExtensionReader : public ColumnReaderImpl {
     return storage_reader_->LoadBatch(number_of_records);
   }
 
+  Status LoadSelection(const RowSelection& selection) final {
+    return storage_reader_->LoadSelection(selection);
+  }
+
   Status BuildArray(int64_t length_upper_bound,
                     std::shared_ptr<ChunkedArray>* out) override {
     std::shared_ptr<ChunkedArray> storage;
@@ -573,6 +661,10 @@ class ListReader : public ColumnReaderImpl {
     return item_reader_->LoadBatch(number_of_records);
   }
 
+  Status LoadSelection(const RowSelection& selection) final {
+    return item_reader_->LoadSelection(selection);
+  }
+
   virtual ::arrow::Result<std::shared_ptr<ChunkedArray>> AssembleArray(
       std::shared_ptr<ArrayData> data) {
     if (field_->type()->id() == ::arrow::Type::MAP) {
@@ -706,6 +798,12 @@ class PARQUET_NO_EXPORT StructReader : public ColumnReaderImpl {
     }
     return Status::OK();
   }
+  Status LoadSelection(const RowSelection& selection) override {
+    for (const std::unique_ptr<ColumnReaderImpl>& reader : children_) {
+      RETURN_NOT_OK(reader->LoadSelection(selection));
+    }
+    return Status::OK();
+  }
   Status BuildArray(int64_t length_upper_bound,
                     std::shared_ptr<ChunkedArray>* out) override;
   Status GetDefLevels(const int16_t** data, int64_t* length) override;
@@ -959,6 +1057,105 @@ Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>&
 
 }  // namespace
 
+/// Decodes row groups ahead of the consumer on the CPU thread pool, within the
+/// limits set by ArrowReaderProperties, and returns their tables in order.
+class RowGroupReadahead {
+ public:
+  RowGroupReadahead(FileReaderImpl* reader, std::vector<int> row_groups,
+                    std::vector<int> column_indices)
+      : reader_(reader),
+        row_groups_(std::move(row_groups)),
+        column_indices_(std::move(column_indices)) {}
+
+  ~RowGroupReadahead() {
+    // The tasks use the reader, so they must not outlive us
+    for (auto& pending : pending_) {
+      pending.table.Wait();
+    }
+  }
+
+  /// \brief Return the table of the next row group, or null at the end.
+  ::arrow::Result<std::shared_ptr<Table>> Next() {
+    RETURN_NOT_OK(FillReadahead());
+    if (pending_.empty()) {
+      return nullptr;
+    }
+    PendingRowGroup pending = std::move(pending_.front());
+    pending_.pop_front();
+    bytes_pending_ -= pending.num_bytes;
+    // Start decoding the following row groups before waiting for this one
+    RETURN_NOT_OK(FillReadahead());
+    return pending.table.MoveResult();
+  }
+
+ private:
+  struct PendingRowGroup {
+    Future<std::shared_ptr<Table>> table;
+    int64_t num_bytes;
+  };
+
+  Status FillReadahead() {
+    const ArrowReaderProperties& properties = reader_->properties();
+    while (next_row_group_ < row_groups_.size() &&
+           static_cast<int64_t>(pending_.size()) < properties.row_group_readahead()) {
+      const int row_group = row_groups_[next_row_group_];
+      const int64_t num_bytes = EstimateDecodedSize(row_group);
+      if (!pending_.empty() &&
+          bytes_pending_ + num_bytes > properties.row_group_readahead_bytes()) {
+        break;
+      }
+      FileReaderImpl* reader = reader_;
+      std::vector<int> column_indices = column_indices_;
+      ARROW_ASSIGN_OR_RAISE(
+          auto table, ::arrow::internal::GetCpuThreadPool()->Submit(
+                          [reader, row_group, column_indices] {
+                            return DecodeRowGroup(reader, row_group, column_indices);
+                          }));
+      pending_.push_back({std::move(table), num_bytes});
+      bytes_pending_ += num_bytes;
+      ++next_row_group_;
+    }
+    return Status::OK();
+  }
+
+  int64_t EstimateDecodedSize(int row_group) const {
+    auto metadata = reader_->parquet_reader()->metadata()->RowGroup(row_group);
+    int64_t num_bytes = 0;
+    for (int i : column_indices_) {
+      num_bytes += metadata->ColumnChunk(i)->total_uncompressed_size();
+    }
+    return num_bytes;
+  }
+
+  // Decode the columns one after the other: the parallelism comes from
+  // decoding several row groups at once, and this runs on a pool thread
+  // which must not wait for other pool tasks.
+  static ::arrow::Result<std::shared_ptr<Table>> DecodeRowGroup(
+      FileReaderImpl* reader, int row_group, const std::vector<int>& column_indices) {
+    std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
+    std::shared_ptr<::arrow::Schema> schema;
+    RETURN_NOT_OK(
+        reader->GetFieldReaders(column_indices, {row_group}, &readers, &schema));
+    ::arrow::ChunkedArrayVector columns(readers.size());
+    for (size_t i = 0; i < readers.size(); ++i) {
+      RETURN_NOT_OK(reader->ReadColumn(static_cast<int>(i), {row_group},
+                                       readers[i].get(), &columns[i]));
+    }
+    const int64_t num_rows =
+        reader->parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+    auto table = Table::Make(std::move(schema), std::move(columns), num_rows);
+    RETURN_NOT_OK(table->Validate());
+    return table;
+  }
+
+  FileReaderImpl* reader_;
+  const std::vector<int> row_groups_;
+  const std::vector<int> column_indices_;
+  size_t next_row_group_ = 0;
+  std::deque<PendingRowGroup> pending_;
+  int64_t bytes_pending_ = 0;
+};
+
 Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
                                             const std::vector<int>& column_indices,
                                             std::unique_ptr<RecordBatchReader>* out) {
@@ -1000,13 +1197,35 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
     return Status::OK();
   }
 
+  using ::arrow::RecordBatchIterator;
+
+  if (reader_properties_.row_group_readahead() > 0) {
+    // As below, `this` must outlive the RecordBatchReader.
+    auto readahead =
+        std::make_shared<RowGroupReadahead>(this, row_groups, column_indices);
+    const int64_t batch_size = properties().batch_size();
+    ::arrow::Iterator<RecordBatchIterator> batches = ::arrow::MakeFunctionIterator(
+        [readahead, batch_size]() -> ::arrow::Result<RecordBatchIterator> {
+          ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> table, readahead->Next());
+          if (table == nullptr) {
+            return ::arrow::IterationTraits<RecordBatchIterator>::End();
+          }
+          auto table_reader = std::make_shared<::arrow::TableBatchReader>(*table);
+          table_reader->set_chunksize(batch_size);
+          return ::arrow::MakeFunctionIterator(
+              [table, table_reader] { return table_reader->Next(); });
+        });
+
+    *out = ::arrow::internal::make_unique<RowGroupRecordBatchReader>(
+        ::arrow::MakeFlattenIterator(std::move(batches)), std::move(batch_schema));
+    return Status::OK();
+  }
+
   int64_t num_rows = 0;
   for (int row_group : row_groups) {
     num_rows += parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
   }
 
-  using ::arrow::RecordBatchIterator;
-
   // NB: This lambda will be invoked outside the scope of this call to
   // `GetRecordBatchReader()`, so it must capture `readers` and `batch_schema` by value.
   // `this` is a non-owning pointer so we are relying on the parent FileReader outliving
@@ -1106,12 +1325,19 @@ class RowGroupGenerator {
     ::arrow::Future<RecordBatchGenerator> row_group_read;
     if (!reader->properties().pre_buffer()) {
       row_group_read = SubmitRead(cpu_executor_, reader, row_group, column_indices);
+    } else if (column_indices.empty()) {
+      row_group_read = ReadOneRowGroup(cpu_executor_, reader, row_group, column_indices);
     } else {
-      auto ready = reader->parquet_reader()->WhenBuffered({row_group}, column_indices);
-      if (cpu_executor_) ready = cpu_executor_->TransferAlways(ready);
-      row_group_read = ready.Then([=]() -> ::arrow::Future<RecordBatchGenerator> {
-        return ReadOneRowGroup(cpu_executor_, reader, row_group, column_indices);
-      });
+      // Decode each column as soon as its column chunk arrives, so that decoding
+      // overlaps with fetching the other columns and the row groups read ahead
+      const int64_t batch_size = reader->properties().batch_size();
+      row_group_read =
+          reader
+              ->DecodeRowGroupsWhenBuffered(reader, {row_group}, column_indices,
+                                            cpu_executor_)
+              .Then([batch_size](const std::shared_ptr<Table>& table) {
+                return TableToBatchGenerator(*table, batch_size);
+              });
     }
     in_flight_reads_.push({std::move(row_group_read), num_rows});
   }
@@ -1138,15 +1364,19 @@ class RowGroupGenerator {
     // Skips bound checks/pre-buffering, since we've done that already
     const int64_t batch_size = self->properties().batch_size();
     return self->DecodeRowGroups(self, {row_group}, column_indices, cpu_executor)
-        .Then([batch_size](const std::shared_ptr<Table>& table)
-                  -> ::arrow::Result<RecordBatchGenerator> {
-          ::arrow::TableBatchReader table_reader(*table);
-          table_reader.set_chunksize(batch_size);
-          ARROW_ASSIGN_OR_RAISE(auto batches, table_reader.ToRecordBatches());
-          return ::arrow::MakeVectorGenerator(std::move(batches));
+        .Then([batch_size](const std::shared_ptr<Table>& table) {
+          return TableToBatchGenerator(*table, batch_size);
         });
   }
 
+  static ::arrow::Result<RecordBatchGenerator> TableToBatchGenerator(
+      const Table& table, int64_t batch_size) {
+    ::arrow::TableBatchReader table_reader(table);
+    table_reader.set_chunksize(batch_size);
+    ARROW_ASSIGN_OR_RAISE(auto batches, table_reader.ToRecordBatches());
+    return ::arrow::MakeVectorGenerator(std::move(batches));
+  }
+
   std::shared_ptr<FileReaderImpl> arrow_reader_;
   ::arrow::internal::Executor* cpu_executor_;
   std::vector<int> row_groups_;
@@ -1192,8 +1422,12 @@ Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_facto
   ctx->pool = pool_;
   ctx->iterator_factory = iterator_factory;
   ctx->filter_leaves = false;
+  ctx->unify_dictionaries = reader_properties_.unify_dictionaries();
   std::unique_ptr<ColumnReaderImpl> result;
   RETURN_NOT_OK(GetReader(manifest_.schema_fields[i], ctx, &result));
+  if (result != nullptr && reader_properties_.zero_copy_values()) {
+    result->EnableZeroCopyValues();
+  }
   out->reset(result.release());
   return Status::OK();
 }
@@ -1257,10 +1491,140 @@ Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroups(
       .Then(std::move(make_table));
 }
 
+Status FileReaderImpl::ReadRowGroup(int i, const std::vector<int>& column_indices,
+                                    const RowSelection& selection,
+                                    std::shared_ptr<Table>* out) {
+  RETURN_NOT_OK(BoundsCheck({i}, column_indices));
+  const int64_t num_rows = reader_->metadata()->RowGroup(i)->num_rows();
+  if (!selection.ranges().empty()) {
+    const RowSelection::Range& last = selection.ranges().back();
+    if (last.offset + last.length > num_rows) {
+      return Status::Invalid("Row selection ends at row ", last.offset + last.length,
+                             " but row group ", i, " only has ", num_rows, " rows");
+    }
+  }
+
+  if (reader_properties_.pre_buffer()) {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    parquet_reader()->PreBuffer({i}, column_indices, reader_properties_.io_context(),
+                                reader_properties_.cache_options());
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
+  std::shared_ptr<::arrow::Schema> result_schema;
+  RETURN_NOT_OK(GetFieldReaders(column_indices, {i}, &readers, &result_schema));
+
+  ::arrow::ChunkedArrayVector columns(readers.size());
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      reader_properties_.use_threads(), static_cast<int>(readers.size()), [&](int j) {
+        RETURN_NOT_OK(readers[j]->LoadSelection(selection));
+        RETURN_NOT_OK(readers[j]->BuildArray(selection.num_rows(), &columns[j]));
+        for (const auto& chunk : columns[j]->chunks()) {
+          RETURN_NOT_OK(chunk->Validate());
+        }
+        return Status::OK();
+      }));
+
+  auto table = Table::Make(std::move(result_schema), std::move(columns),
+                           selection.num_rows());
+  RETURN_NOT_OK(table->Validate());
+  *out = std::move(table);
+  return Status::OK();
+}
+
+Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroupsWhenBuffered(
+    std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
+    const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor) {
+  std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
+  std::shared_ptr<::arrow::Schema> result_schema;
+  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &result_schema));
+  ARROW_ASSIGN_OR_RAISE(std::vector<int> field_indices,
+                        manifest_.GetFieldIndices(column_indices));
+
+  // The leaves of each field, whose column chunks must be buffered to decode it
+  const SchemaDescriptor* descr = manifest_.descr;
+  std::vector<std::vector<int>> field_leaves(field_indices.size());
+  for (int column_index : column_indices) {
+    const int field_index = descr->group_node()->FieldIndex(
+        *descr->GetColumnRoot(column_index));
+    const auto it = std::find(field_indices.begin(), field_indices.end(), field_index);
+    field_leaves[it - field_indices.begin()].push_back(column_index);
+  }
+
+  // Decoding a column waits for its column chunks asynchronously
+  std::shared_ptr<ReaderMetrics> metrics = parquet_reader()->metrics();
+  ::arrow::internal::StopWatch watch;
+  if (metrics) watch.Start();
+
+  std::vector<Future<std::shared_ptr<ChunkedArray>>> columns(readers.size());
+  for (size_t i = 0; i < readers.size(); ++i) {
+    auto ready = parquet_reader()->WhenBuffered(row_groups, field_leaves[i]);
+    if (cpu_executor) ready = cpu_executor->TransferAlways(ready);
+    std::shared_ptr<ColumnReaderImpl> reader = readers[i];
+    columns[i] = ready.Then(
+        [i, row_groups, reader, self, metrics, watch,
+         this]() mutable -> ::arrow::Result<std::shared_ptr<ChunkedArray>> {
+          if (metrics) metrics->io_wait_ns += static_cast<int64_t>(watch.Stop());
+          std::shared_ptr<ChunkedArray> column;
+          RETURN_NOT_OK(
+              ReadColumn(static_cast<int>(i), row_groups, reader.get(), &column));
+          return column;
+        });
+  }
+  return ::arrow::All(std::move(columns))
+      .Then([result_schema, self](
+                const std::vector<::arrow::Result<std::shared_ptr<ChunkedArray>>>&
+                    results) -> ::arrow::Result<std::shared_ptr<Table>> {
+        ARROW_ASSIGN_OR_RAISE(auto columns, ::arrow::internal::UnwrapOrRaise(results));
+        DCHECK(!columns.empty());
+        const int64_t num_rows = columns[0]->length();
+        auto table = Table::Make(std::move(result_schema), std::move(columns), num_rows);
+        RETURN_NOT_OK(table->Validate());
+        return table;
+      });
+}
+
 std::shared_ptr<RowGroupReader> FileReaderImpl::RowGroup(int row_group_index) {
   return std::make_shared<RowGroupReaderImpl>(this, row_group_index);
 }
 
+// ----------------------------------------------------------------------
+// RowSelection
+
+::arrow::Result<RowSelection> RowSelection::Make(std::vector<Range> ranges) {
+  RowSelection selection;
+  int64_t end = 0;
+  for (const Range& range : ranges) {
+    if (range.offset < end || range.length <= 0) {
+      return Status::Invalid(
+          "Row selection ranges must be sorted, non-empty and non-overlapping");
+    }
+    end = range.offset + range.length;
+    selection.num_rows_ += range.length;
+  }
+  selection.ranges_ = std::move(ranges);
+  return selection;
+}
+
+RowSelection RowSelection::FromMask(const BooleanArray& mask) {
+  RowSelection selection;
+  int64_t i = 0;
+  while (i < mask.length()) {
+    if (!mask.IsValid(i) || !mask.Value(i)) {
+      ++i;
+      continue;
+    }
+    const int64_t start = i;
+    while (i < mask.length() && mask.IsValid(i) && mask.Value(i)) {
+      ++i;
+    }
+    selection.ranges_.push_back({start, i - start});
+    selection.num_rows_ += i - start;
+  }
+  return selection;
+}
+
 // ----------------------------------------------------------------------
 // Public factory functions
 
@@ -29,6 +29,7 @@
 
 namespace arrow {
 
+class BooleanArray;
 class ChunkedArray;
 class KeyValueMetadata;
 class RecordBatchReader;
@@ -51,6 +52,40 @@ class ColumnReader;
 struct SchemaManifest;
 class RowGroupReader;
 
+/// \brief Rows to read from a row group, as ranges of row indices relative to
+/// the start of the row group
+///
+/// Ranges are sorted, non-empty and non-overlapping.
+class PARQUET_EXPORT RowSelection {
+ public:
+  struct Range {
+    int64_t offset;
+    int64_t length;
+  };
+
+  /// \brief Select no rows
+  RowSelection() = default;
+
+  /// \brief Select the given ranges
+  ///
+  /// \returns error Status if the ranges are not sorted, empty or overlap
+  static ::arrow::Result<RowSelection> Make(std::vector<Range> ranges);
+
+  /// \brief Select the rows which are true in mask
+  ///
+  /// Null entries are not selected, like the compute "filter" function does.
+  static RowSelection FromMask(const ::arrow::BooleanArray& mask);
+
+  const std::vector<Range>& ranges() const { return ranges_; }
+
+  /// \brief The number of selected rows
+  int64_t num_rows() const { return num_rows_; }
+
+ private:
+  std::vector<Range> ranges_;
+  int64_t num_rows_ = 0;
+};
+
 /// \brief Arrow read adapter class for deserializing Parquet files as Arrow row batches.
 ///
 /// This interfaces caters for different use cases and thus provides different
@@ -214,6 +249,19 @@ class PARQUET_EXPORT FileReader {
 
   virtual ::arrow::Status ReadRowGroup(int i, std::shared_ptr<::arrow::Table>* out) = 0;
 
+  /// \brief Read the rows of row group i selected by selection
+  ///
+  /// The other rows are skipped without being materialized.  Together with
+  /// RowSelection::FromMask this allows late materialization: read the columns
+  /// a filter depends on, evaluate the filter, then read the remaining columns
+  /// only for the rows which passed it.
+  ///
+  /// \returns error Status if i or column_indices contain an invalid index, or
+  ///     selection extends past the end of the row group
+  virtual ::arrow::Status ReadRowGroup(int i, const std::vector<int>& column_indices,
+                                       const RowSelection& selection,
+                                       std::shared_ptr<::arrow::Table>* out) = 0;
+
   virtual ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                         const std::vector<int>& column_indices,
                                         std::shared_ptr<::arrow::Table>* out) = 0;
@@ -341,20 +341,29 @@ Status TransferInt(RecordReader* reader, MemoryPool* pool,
   return Status::OK();
 }
 
-std::shared_ptr<Array> TransferZeroCopy(RecordReader* reader,
-                                        const std::shared_ptr<Field>& field) {
-  std::shared_ptr<::arrow::ArrayData> data;
+Datum TransferZeroCopy(RecordReader* reader, const std::shared_ptr<Field>& field) {
   if (field->nullable()) {
     std::vector<std::shared_ptr<Buffer>> buffers = {reader->ReleaseIsValid(),
                                                     reader->ReleaseValues()};
-    data = std::make_shared<::arrow::ArrayData>(field->type(), reader->values_written(),
-                                                std::move(buffers), reader->null_count());
-  } else {
-    std::vector<std::shared_ptr<Buffer>> buffers = {nullptr, reader->ReleaseValues()};
-    data = std::make_shared<::arrow::ArrayData>(field->type(), reader->values_written(),
-                                                std::move(buffers), /*null_count=*/0);
-  }
-  return ::arrow::MakeArray(data);
+    auto data = std::make_shared<::arrow::ArrayData>(
+        field->type(), reader->values_written(), std::move(buffers),
+        reader->null_count());
+    return ::arrow::MakeArray(data);
+  }
+  // Without nulls, values may have been sliced from several data pages
+  const int64_t byte_width =
+      checked_cast<const ::arrow::FixedWidthType&>(*field->type()).bit_width() / 8;
+  ::arrow::ArrayVector chunks;
+  for (auto& values : reader->ReleaseValueChunks()) {
+    const int64_t length = values->size() / byte_width;
+    std::vector<std::shared_ptr<Buffer>> buffers = {nullptr, std::move(values)};
+    chunks.push_back(::arrow::MakeArray(std::make_shared<::arrow::ArrayData>(
+        field->type(), length, std::move(buffers), /*null_count=*/0)));
+  }
+  if (chunks.size() == 1) {
+    return chunks[0];
+  }
+  return std::make_shared<ChunkedArray>(std::move(chunks), field->type());
 }
 
 Status TransferBool(RecordReader* reader, bool nullable, MemoryPool* pool, Datum* out) {
@@ -453,8 +453,20 @@ struct SchemaTreeContext {
 };
 
 bool IsDictionaryReadSupported(const ArrowType& type) {
-  // Only supported currently for BYTE_ARRAY types
-  return type.id() == ::arrow::Type::BINARY || type.id() == ::arrow::Type::STRING;
+  // Supported for types whose storage maps directly to a physical type
+  // (BOOLEAN and INT96 have no dictionary record reader)
+  switch (type.id()) {
+    case ::arrow::Type::BINARY:
+    case ::arrow::Type::STRING:
+    case ::arrow::Type::INT32:
+    case ::arrow::Type::INT64:
+    case ::arrow::Type::FLOAT:
+    case ::arrow::Type::DOUBLE:
+    case ::arrow::Type::FIXED_SIZE_BINARY:
+      return true;
+    default:
+      return false;
+  }
 }
 
 // ----------------------------------------------------------------------
@@ -929,7 +941,7 @@ Result<bool> ApplyOriginalStorageMetadata(const Field& origin_field,
   if (origin_type->id() == ::arrow::Type::DICTIONARY &&
       inferred_type->id() != ::arrow::Type::DICTIONARY &&
       IsDictionaryReadSupported(*inferred_type)) {
-    // Direct dictionary reads are only suppored for a couple primitive types,
+    // Direct dictionary reads are only supported for primitive types,
     // so no need to recurse on value types.
     const auto& dict_origin_type =
         checked_cast<const ::arrow::DictionaryType&>(*origin_type);
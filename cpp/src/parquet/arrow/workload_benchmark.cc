@@ -0,0 +1,431 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Read and write benchmarks over tables shaped like real workloads, as
+// opposed to the single-column synthetic cases of reader_writer_benchmark.cc.
+//
+// The amount of data is set through the PARQUET_BENCHMARK_SCALE environment
+// variable, as a TPC-H scale factor (default 0.01, i.e. 60000 lineitem rows).
+// Other datasets are sized relative to it.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/memory.h"
+#include "arrow/io/slow.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/byte_size.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/key_value_metadata.h"
+#include "arrow/util/thread_pool.h"
+#include "parquet/arrow/reader.h"
+#include "parquet/arrow/schema.h"
+#include "parquet/arrow/writer.h"
+#include "parquet/file_reader.h"
+#include "parquet/platform.h"
+#include "parquet/properties.h"
+#include "parquet/schema.h"
+
+using ::arrow::field;
+using ::arrow::key_value_metadata;
+
+namespace parquet {
+namespace benchmark {
+
+enum Dataset { kLineitem, kWideSparse, kNested, kStrings };
+
+const char* DatasetName(int64_t dataset) {
+  switch (dataset) {
+    case kLineitem:
+      return "lineitem";
+    case kWideSparse:
+      return "wide_sparse";
+    case kNested:
+      return "nested";
+    case kStrings:
+      return "strings";
+    default:
+      return "unknown";
+  }
+}
+
+// How the columns are encoded.  kDelta uses DELTA_BINARY_PACKED for integer
+// columns and DELTA_BYTE_ARRAY for binary columns, and PLAIN for the others.
+enum EncodingChoice { kPlain, kDictionary, kDelta };
+
+const char* EncodingName(int64_t encoding) {
+  switch (encoding) {
+    case kPlain:
+      return "plain";
+    case kDictionary:
+      return "dictionary";
+    case kDelta:
+      return "delta";
+    default:
+      return "unknown";
+  }
+}
+
+double ScaleFactor() {
+  const char* scale = std::getenv("PARQUET_BENCHMARK_SCALE");
+  if (scale == nullptr) {
+    return 0.01;
+  }
+  return std::atof(scale);
+}
+
+std::shared_ptr<::arrow::KeyValueMetadata> IntRange(int64_t min, int64_t max,
+                                                    double null_probability = 0) {
+  return key_value_metadata(
+      {"min", "max", "null_probability"},
+      {std::to_string(min), std::to_string(max), std::to_string(null_probability)});
+}
+
+std::shared_ptr<::arrow::KeyValueMetadata> Nulls(double null_probability) {
+  return key_value_metadata({"null_probability"}, {std::to_string(null_probability)});
+}
+
+std::shared_ptr<::arrow::KeyValueMetadata> Lengths(int32_t min_length,
+                                                   int32_t max_length,
+                                                   double null_probability = 0,
+                                                   int32_t unique = -1) {
+  return key_value_metadata({"min_length", "max_length", "null_probability", "unique"},
+                            {std::to_string(min_length), std::to_string(max_length),
+                             std::to_string(null_probability), std::to_string(unique)});
+}
+
+// The TPC-H lineitem table, with value ranges and cardinalities close to
+// those of dbgen.
+::arrow::FieldVector LineitemFields(int64_t num_rows) {
+  const auto price = ::arrow::decimal128(15, 2);
+  // Days since the epoch for 1992-01-01 and 1998-12-31
+  const int64_t first_day = 8035;
+  const int64_t last_day = 10591;
+  return {
+      field("l_orderkey", ::arrow::int64(), false, IntRange(1, num_rows * 4)),
+      field("l_partkey", ::arrow::int64(), false, IntRange(1, num_rows / 30 + 1)),
+      field("l_suppkey", ::arrow::int64(), false, IntRange(1, num_rows / 600 + 1)),
+      field("l_linenumber", ::arrow::int32(), false, IntRange(1, 7)),
+      field("l_quantity", price, false),
+      field("l_extendedprice", price, false),
+      field("l_discount", price, false),
+      field("l_tax", price, false),
+      field("l_returnflag", ::arrow::utf8(), false, Lengths(1, 1, 0, 3)),
+      field("l_linestatus", ::arrow::utf8(), false, Lengths(1, 1, 0, 2)),
+      field("l_shipdate", ::arrow::date32(), false, IntRange(first_day, last_day)),
+      field("l_commitdate", ::arrow::date32(), false, IntRange(first_day, last_day)),
+      field("l_receiptdate", ::arrow::date32(), false, IntRange(first_day, last_day)),
+      field("l_shipinstruct", ::arrow::utf8(), false, Lengths(7, 17, 0, 4)),
+      field("l_shipmode", ::arrow::utf8(), false, Lengths(3, 7, 0, 7)),
+      field("l_comment", ::arrow::utf8(), false, Lengths(10, 43)),
+  };
+}
+
+// Many nullable columns, most values of which are null
+::arrow::FieldVector WideSparseFields() {
+  const int kNumColumns = 500;
+  const double kNullProbability = 0.95;
+  ::arrow::FieldVector fields;
+  for (int i = 0; i < kNumColumns; ++i) {
+    const std::string name = "c" + std::to_string(i);
+    switch (i % 3) {
+      case 0:
+        fields.push_back(field(name, ::arrow::int64(), true,
+                               IntRange(0, 1 << 20, kNullProbability)));
+        break;
+      case 1:
+        fields.push_back(field(name, ::arrow::float64(), true,
+                               IntRange(0, 1000, kNullProbability)));
+        break;
+      default:
+        fields.push_back(
+            field(name, ::arrow::utf8(), true, Lengths(4, 32, kNullProbability)));
+        break;
+    }
+  }
+  return fields;
+}
+
+// Four levels of lists and structs, as found in event and document data
+::arrow::FieldVector NestedFields() {
+  auto tags = field("tags", ::arrow::list(field("item", ::arrow::utf8(), true,
+                                                Lengths(3, 12, 0.1, 1000))),
+                    true, Lengths(0, 4, 0.1));
+  auto measure = field("item", ::arrow::float64(), true, IntRange(0, 100));
+  auto measures =
+      field("measures", ::arrow::list(measure), true, Lengths(0, 8, 0.05));
+  auto event = field(
+      "item",
+      ::arrow::struct_({field("kind", ::arrow::int32(), false, IntRange(0, 20)),
+                        field("ts", ::arrow::int64(), false, IntRange(0, 1LL << 40)),
+                        tags, measures}),
+      true, Nulls(0.02));
+  auto events = field("events", ::arrow::list(event), true, Lengths(0, 6, 0.05));
+  auto session = field(
+      "session",
+      ::arrow::struct_({field("id", ::arrow::int64(), false, IntRange(0, 1LL << 40)),
+                        field("agent", ::arrow::utf8(), true, Lengths(20, 80, 0.1, 200)),
+                        events}),
+      true, Nulls(0.01));
+  return {
+      field("user_id", ::arrow::int64(), false, IntRange(0, 1 << 24)),
+      session,
+  };
+}
+
+// Columns of strings of various lengths and cardinalities
+::arrow::FieldVector StringFields() {
+  return {
+      field("country", ::arrow::utf8(), false, Lengths(2, 2, 0, 200)),
+      field("city", ::arrow::utf8(), true, Lengths(4, 20, 0.05, 10000)),
+      field("uuid", ::arrow::utf8(), false, Lengths(36, 36)),
+      field("url", ::arrow::utf8(), true, Lengths(20, 120, 0.1)),
+      field("title", ::arrow::utf8(), true, Lengths(10, 80, 0.2, 50000)),
+      field("body", ::arrow::utf8(), true, Lengths(100, 1000, 0.3)),
+  };
+}
+
+std::shared_ptr<::arrow::Table> MakeDataset(int64_t dataset) {
+  static std::map<int64_t, std::shared_ptr<::arrow::Table>> datasets;
+  auto it = datasets.find(dataset);
+  if (it != datasets.end()) {
+    return it->second;
+  }
+
+  const int64_t lineitem_rows = static_cast<int64_t>(6000000 * ScaleFactor());
+  ::arrow::FieldVector fields;
+  int64_t num_rows = 0;
+  switch (dataset) {
+    case kLineitem:
+      fields = LineitemFields(lineitem_rows);
+      num_rows = lineitem_rows;
+      break;
+    case kWideSparse:
+      fields = WideSparseFields();
+      num_rows = lineitem_rows / 10;
+      break;
+    case kNested:
+      fields = NestedFields();
+      num_rows = lineitem_rows / 4;
+      break;
+    default:
+      fields = StringFields();
+      num_rows = lineitem_rows;
+      break;
+  }
+  auto batch = ::arrow::random::GenerateBatch(fields, num_rows, /*seed=*/42);
+  auto table = ::arrow::Table::FromRecordBatches({batch}).ValueOrDie();
+  datasets[dataset] = table;
+  return table;
+}
+
+std::shared_ptr<WriterProperties> MakeWriterProperties(const ::arrow::Schema& schema,
+                                                       int64_t encoding,
+                                                       Compression::type codec,
+                                                       int64_t page_size) {
+  WriterProperties::Builder builder;
+  builder.compression(codec)->data_pagesize(page_size);
+  if (encoding == kDictionary) {
+    return builder.build();
+  }
+  builder.disable_dictionary();
+  if (encoding == kDelta) {
+    std::shared_ptr<SchemaDescriptor> descr;
+    ABORT_NOT_OK(
+        ::parquet::arrow::ToParquetSchema(&schema, *builder.build(), &descr));
+    for (int i = 0; i < descr->num_columns(); ++i) {
+      const ColumnDescriptor* column = descr->Column(i);
+      switch (column->physical_type()) {
+        case Type::INT32:
+        case Type::INT64:
+          builder.encoding(column->path(), Encoding::DELTA_BINARY_PACKED);
+          break;
+        case Type::BYTE_ARRAY:
+          builder.encoding(column->path(), Encoding::DELTA_BYTE_ARRAY);
+          break;
+        default:
+          break;
+      }
+    }
+  }
+  return builder.build();
+}
+
+std::shared_ptr<Buffer> WriteDataset(const ::arrow::Table& table,
+                                     const std::shared_ptr<WriterProperties>& properties,
+                                     bool use_threads) {
+  auto arrow_properties = ArrowWriterProperties::Builder().set_use_threads(use_threads);
+  auto sink = CreateOutputStream();
+  ABORT_NOT_OK(::parquet::arrow::WriteTable(table, ::arrow::default_memory_pool(), sink,
+                                            /*chunk_size=*/128 * 1024, properties,
+                                            arrow_properties->build()));
+  ASSIGN_OR_ABORT(auto buffer, sink->Finish());
+  return buffer;
+}
+
+// Argument names and values of a benchmark run, in the order below
+struct WorkloadArgs {
+  int64_t dataset;
+  int64_t encoding;
+  Compression::type codec;
+  int64_t page_size;
+  int threads;
+  // Average read latency in microseconds, to simulate object stores
+  int64_t latency_us;
+
+  explicit WorkloadArgs(const ::benchmark::State& state)
+      : dataset(state.range(0)),
+        encoding(state.range(1)),
+        codec(static_cast<Compression::type>(state.range(2))),
+        page_size(state.range(3)),
+        threads(static_cast<int>(state.range(4))),
+        latency_us(state.range(5)) {}
+};
+
+// Sets the CPU thread pool capacity for the duration of a benchmark
+class ScopedCpuThreads {
+ public:
+  explicit ScopedCpuThreads(int threads)
+      : previous_(::arrow::GetCpuThreadPoolCapacity()) {
+    ABORT_NOT_OK(::arrow::SetCpuThreadPoolCapacity(threads));
+  }
+  ~ScopedCpuThreads() { ABORT_NOT_OK(::arrow::SetCpuThreadPoolCapacity(previous_)); }
+
+ private:
+  int previous_;
+};
+
+bool SkipUnavailableCodec(::benchmark::State& state, Compression::type codec) {
+  if (!::arrow::util::Codec::IsAvailable(codec)) {
+    state.SkipWithError("Codec not available in this build");
+    return true;
+  }
+  return false;
+}
+
+void SetLabel(::benchmark::State& state, const WorkloadArgs& args) {
+  state.SetLabel(std::string(DatasetName(args.dataset)) + "/" +
+                 EncodingName(args.encoding) + "/" +
+                 ::arrow::util::Codec::GetCodecAsString(args.codec));
+}
+
+static void BM_WriteWorkload(::benchmark::State& state) {
+  const WorkloadArgs args(state);
+  if (SkipUnavailableCodec(state, args.codec)) return;
+  ScopedCpuThreads threads(args.threads);
+
+  auto table = MakeDataset(args.dataset);
+  auto properties =
+      MakeWriterProperties(*table->schema(), args.encoding, args.codec, args.page_size);
+  int64_t file_size = 0;
+  for (auto _ : state) {
+    file_size = WriteDataset(*table, properties, args.threads > 1)->size();
+  }
+  SetLabel(state, args);
+  state.counters["file_size"] = static_cast<double>(file_size);
+  state.SetItemsProcessed(state.iterations() * table->num_rows());
+  state.SetBytesProcessed(state.iterations() * ::arrow::util::TotalBufferSize(*table));
+}
+
+static void BM_ReadWorkload(::benchmark::State& state) {
+  const WorkloadArgs args(state);
+  if (SkipUnavailableCodec(state, args.codec)) return;
+  ScopedCpuThreads threads(args.threads);
+
+  auto table = MakeDataset(args.dataset);
+  auto buffer = WriteDataset(
+      *table,
+      MakeWriterProperties(*table->schema(), args.encoding, args.codec, args.page_size),
+      /*use_threads=*/true);
+
+  ArrowReaderProperties arrow_properties;
+  arrow_properties.set_use_threads(args.threads > 1);
+  if (args.latency_us > 0) {
+    // Coalesce reads as one would against an object store
+    arrow_properties.set_pre_buffer(true);
+  }
+  for (auto _ : state) {
+    std::shared_ptr<::arrow::io::RandomAccessFile> source =
+        std::make_shared<::arrow::io::BufferReader>(buffer);
+    if (args.latency_us > 0) {
+      source = std::make_shared<::arrow::io::SlowRandomAccessFile>(
+          source, args.latency_us * 1e-6, /*seed=*/42);
+    }
+    std::unique_ptr<::parquet::arrow::FileReader> reader;
+    ::parquet::arrow::FileReaderBuilder builder;
+    ABORT_NOT_OK(builder.Open(source));
+    ABORT_NOT_OK(builder.properties(arrow_properties)->Build(&reader));
+    std::shared_ptr<::arrow::Table> result;
+    ABORT_NOT_OK(reader->ReadTable(&result));
+  }
+  SetLabel(state, args);
+  state.counters["file_size"] = static_cast<double>(buffer->size());
+  state.SetItemsProcessed(state.iterations() * table->num_rows());
+  state.SetBytesProcessed(state.iterations() * ::arrow::util::TotalBufferSize(*table));
+}
+
+constexpr int64_t kDefaultPageSize = 1024 * 1024;
+
+// Rather than the full cross product, each parameter is varied on its own
+// around a default of dictionary encoding, Snappy, 1 MiB pages, one thread
+// and no latency.
+static void AddWorkloadArgs(::benchmark::internal::Benchmark* bench, bool with_latency) {
+  bench->ArgNames({"dataset", "encoding", "codec", "page_size", "threads", "latency_us"});
+  const int64_t snappy = Compression::SNAPPY;
+  for (int64_t dataset : {kLineitem, kWideSparse, kNested, kStrings}) {
+    for (int64_t encoding : {kPlain, kDictionary, kDelta}) {
+      bench->Args({dataset, encoding, snappy, kDefaultPageSize, 1, 0});
+    }
+    for (int64_t codec : {Compression::UNCOMPRESSED, Compression::LZ4,
+                          Compression::ZSTD, Compression::GZIP}) {
+      bench->Args({dataset, kDictionary, codec, kDefaultPageSize, 1, 0});
+    }
+    for (int64_t page_size : {64 * 1024, 8 * 1024 * 1024}) {
+      bench->Args({dataset, kDictionary, snappy, page_size, 1, 0});
+    }
+    for (int64_t threads : {4, 8}) {
+      bench->Args({dataset, kDictionary, snappy, kDefaultPageSize, threads, 0});
+    }
+    if (with_latency) {
+      // Roughly the first-byte latency of S3, with and without threads
+      for (int64_t threads : {1, 8}) {
+        bench->Args({dataset, kDictionary, snappy, kDefaultPageSize, threads, 20000});
+      }
+    }
+  }
+}
+
+static void WriteWorkloadArgs(::benchmark::internal::Benchmark* bench) {
+  AddWorkloadArgs(bench, /*with_latency=*/false);
+}
+
+static void ReadWorkloadArgs(::benchmark::internal::Benchmark* bench) {
+  AddWorkloadArgs(bench, /*with_latency=*/true);
+}
+
+BENCHMARK(BM_WriteWorkload)->Apply(WriteWorkloadArgs)->UseRealTime();
+BENCHMARK(BM_ReadWorkload)->Apply(ReadWorkloadArgs)->UseRealTime();
+
+}  // namespace benchmark
+}  // namespace parquet
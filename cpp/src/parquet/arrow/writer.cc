@@ -34,6 +34,7 @@
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
 
 #include "parquet/arrow/path_internal.h"
 #include "parquet/arrow/reader_internal.h"
@@ -112,21 +113,32 @@ class ArrowColumnWriterV2 {
   // A ChunkedArray).
   // level_builders should contain one MultipathLevelBuilder per chunk of the
   // Arrow-column to write.
+  // If |leaf_column_index| is non-negative the RowGroupWriter is expected to be
+  // buffered and leaves are written to the columns starting at that index.
   ArrowColumnWriterV2(std::vector<std::unique_ptr<MultipathLevelBuilder>> level_builders,
-                      int leaf_count, RowGroupWriter* row_group_writer)
+                      int leaf_count, RowGroupWriter* row_group_writer,
+                      int leaf_column_index = -1)
       : level_builders_(std::move(level_builders)),
         leaf_count_(leaf_count),
-        row_group_writer_(row_group_writer) {}
+        row_group_writer_(row_group_writer),
+        leaf_column_index_(leaf_column_index) {}
 
   // Writes out all leaf parquet columns to the RowGroupWriter that this
   // object was constructed with.  Each leaf column is written fully before
-  // the next column is written (i.e. no buffering is assumed).
+  // the next column is written.  Unless the row group is buffered, each leaf
+  // column is also closed once written.
   //
   // Columns are written in DFS order.
   Status Write(ArrowWriteContext* ctx) {
+    const bool buffered = leaf_column_index_ >= 0;
     for (int leaf_idx = 0; leaf_idx < leaf_count_; leaf_idx++) {
       ColumnWriter* column_writer;
-      PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->NextColumn());
+      if (buffered) {
+        const int column_index = leaf_column_index_ + leaf_idx;
+        PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->column(column_index));
+      } else {
+        PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->NextColumn());
+      }
       for (auto& level_builder : level_builders_) {
         RETURN_NOT_OK(level_builder->Write(
             leaf_idx, ctx, [&](const MultipathLevelBuilderResult& result) {
@@ -146,7 +158,11 @@ class ArrowColumnWriterV2 {
             }));
       }
 
-      PARQUET_CATCH_NOT_OK(column_writer->Close());
+      // Buffered column chunks are serialized in order when the row group is
+      // closed.
+      if (!buffered) {
+        PARQUET_CATCH_NOT_OK(column_writer->Close());
+      }
     }
     return Status::OK();
   }
@@ -159,16 +175,20 @@ class ArrowColumnWriterV2 {
   // chunks are created which need to be tracked across each leaf column-write.
   // This decision could potentially be revisited if we wanted to use "buffered"
   // RowGroupWriters (we could construct each builder on demand in that case).
+  //
+  // |leaf_column_index| is the index of the first leaf column of |data| when
+  // writing to a buffered RowGroupWriter, and -1 otherwise.
   static ::arrow::Result<std::unique_ptr<ArrowColumnWriterV2>> Make(
       const ChunkedArray& data, int64_t offset, const int64_t size,
-      const SchemaManifest& schema_manifest, RowGroupWriter* row_group_writer) {
+      const SchemaManifest& schema_manifest, RowGroupWriter* row_group_writer,
+      int leaf_column_index = -1) {
     int64_t absolute_position = 0;
     int chunk_index = 0;
     int64_t chunk_offset = 0;
     if (data.length() == 0) {
       return ::arrow::internal::make_unique<ArrowColumnWriterV2>(
           std::vector<std::unique_ptr<MultipathLevelBuilder>>{},
-          CalculateLeafCount(data.type().get()), row_group_writer);
+          CalculateLeafCount(data.type().get()), row_group_writer, leaf_column_index);
     }
     while (chunk_index < data.num_chunks() && absolute_position < offset) {
       const int64_t chunk_length = data.chunk(chunk_index)->length();
@@ -193,7 +213,8 @@ class ArrowColumnWriterV2 {
     bool is_nullable = false;
     // The row_group_writer hasn't been advanced yet so add 1 to the current
     // which is the one this instance will start writing for.
-    int column_index = row_group_writer->current_column() + 1;
+    int column_index = leaf_column_index >= 0 ? leaf_column_index
+                                              : row_group_writer->current_column() + 1;
     for (int leaf_offset = 0; leaf_offset < leaf_count; ++leaf_offset) {
       const SchemaField* schema_field = nullptr;
       RETURN_NOT_OK(
@@ -240,7 +261,7 @@ class ArrowColumnWriterV2 {
       values_written += chunk_write_size;
     }
     return ::arrow::internal::make_unique<ArrowColumnWriterV2>(
-        std::move(builders), leaf_count, row_group_writer);
+        std::move(builders), leaf_count, row_group_writer, leaf_column_index);
   }
 
  private:
@@ -248,6 +269,7 @@ class ArrowColumnWriterV2 {
   std::vector<std::unique_ptr<MultipathLevelBuilder>> level_builders_;
   int leaf_count_;
   RowGroupWriter* row_group_writer_;
+  int leaf_column_index_;
 };
 
 }  // namespace
@@ -331,7 +353,26 @@ class FileWriterImpl : public FileWriter {
       chunk_size = this->properties().max_row_group_length();
     }
 
+    // Encryptors may be shared between columns, so encrypted files are always
+    // written one column at a time.
+    const bool use_threads = arrow_properties_->use_threads() &&
+                             properties().file_encryption_properties() == nullptr;
+    // A byte target needs buffered row groups, which can grow a slice at a time
+    const bool by_bytes = properties().max_row_group_bytes() > 0;
+    std::vector<int> leaf_column_indices;
+    if (use_threads || by_bytes) {
+      int leaf_column_index = 0;
+      for (const auto& field : table.schema()->fields()) {
+        leaf_column_indices.push_back(leaf_column_index);
+        leaf_column_index += CalculateLeafCount(field->type().get());
+      }
+    }
+
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (use_threads) {
+        RETURN_NOT_OK(NewBufferedRowGroup());
+        return WriteBufferedRows(table, offset, size, leaf_column_indices, use_threads);
+      }
       RETURN_NOT_OK(NewRowGroup(size));
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -345,6 +386,13 @@ class FileWriterImpl : public FileWriter {
       return Status::OK();
     }
 
+    if (by_bytes) {
+      RETURN_NOT_OK_ELSE(
+          WriteRowGroupsBySize(table, chunk_size, leaf_column_indices, use_threads),
+          PARQUET_IGNORE_NOT_OK(Close()));
+      return Status::OK();
+    }
+
     for (int chunk = 0; chunk * chunk_size < table.num_rows(); chunk++) {
       int64_t offset = chunk * chunk_size;
       RETURN_NOT_OK_ELSE(
@@ -367,6 +415,83 @@ class FileWriterImpl : public FileWriter {
  private:
   friend class FileWriter;
 
+  Status NewBufferedRowGroup() {
+    if (row_group_writer_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+    return Status::OK();
+  }
+
+  // Append the rows [offset, offset + size) of |table| to the current buffered
+  // row group.  With |use_threads| every column chunk is encoded in parallel;
+  // each task then uses its own ArrowWriteContext since those hold scratch
+  // buffers.  The encoded chunks are written to the sink in order when the row
+  // group is closed.
+  Status WriteBufferedRows(const Table& table, int64_t offset, int64_t size,
+                           const std::vector<int>& leaf_column_indices,
+                           bool use_threads) {
+    auto WriteColumn = [&](int i, ArrowWriteContext* ctx) {
+      ARROW_ASSIGN_OR_RAISE(
+          std::unique_ptr<ArrowColumnWriterV2> writer,
+          ArrowColumnWriterV2::Make(*table.column(i), offset, size, schema_manifest_,
+                                    row_group_writer_, leaf_column_indices[i]));
+      return writer->Write(ctx);
+    };
+    if (!use_threads) {
+      for (int i = 0; i < table.num_columns(); i++) {
+        RETURN_NOT_OK(WriteColumn(i, &column_write_context_));
+      }
+      return Status::OK();
+    }
+    return ::arrow::internal::OptionalParallelFor(
+        /*use_threads=*/true, table.num_columns(), [&](int i) {
+          ArrowWriteContext ctx(memory_pool(), arrow_properties_.get());
+          return WriteColumn(i, &ctx);
+        });
+  }
+
+  // Write |table| to row groups closed once their estimated encoded size
+  // reaches WriterProperties::max_row_group_bytes, or once they hold
+  // |max_rows| rows.  Row groups are filled a slice at a time.  Each slice
+  // covers half of the rows estimated to fill the remaining byte budget, from
+  // the encoded bytes per row observed so far, so that rows getting wider do
+  // not overshoot the target by much.
+  Status WriteRowGroupsBySize(const Table& table, int64_t max_rows,
+                              const std::vector<int>& leaf_column_indices,
+                              bool use_threads) {
+    const int64_t target_bytes = properties().max_row_group_bytes();
+    const int64_t min_slice_rows = std::max<int64_t>(properties().write_batch_size(), 1);
+    // Start with one write batch, before anything is known about the data
+    int64_t slice_rows = min_slice_rows;
+    int64_t offset = 0;
+    while (offset < table.num_rows()) {
+      RETURN_NOT_OK(NewBufferedRowGroup());
+      int64_t group_rows = 0;
+      while (group_rows < max_rows && offset < table.num_rows()) {
+        const int64_t size =
+            std::min({slice_rows, max_rows - group_rows, table.num_rows() - offset});
+        RETURN_NOT_OK(
+            WriteBufferedRows(table, offset, size, leaf_column_indices, use_threads));
+        offset += size;
+        group_rows += size;
+
+        const int64_t group_bytes = row_group_writer_->estimated_encoded_bytes();
+        if (group_bytes >= target_bytes) break;
+        const double bytes_per_row =
+            std::max(static_cast<double>(group_bytes) / group_rows, 1.0);
+        const int64_t remaining_rows = std::max<int64_t>(
+            static_cast<int64_t>((target_bytes - group_bytes) / bytes_per_row), 1);
+        slice_rows = remaining_rows <= min_slice_rows
+                         ? remaining_rows
+                         : std::max(remaining_rows / 2, min_slice_rows);
+      }
+      // Start the next row group with a quarter of this one
+      slice_rows = std::max<int64_t>(group_rows / 4, 1);
+    }
+    return Status::OK();
+  }
+
   std::shared_ptr<::arrow::Schema> schema_;
 
   SchemaManifest schema_manifest_;
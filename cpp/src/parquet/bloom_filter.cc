@@ -23,6 +23,8 @@
 #include "parquet/bloom_filter.h"
 #include "parquet/exception.h"
 #include "parquet/murmur3.h"
+#include "parquet/thrift_internal.h"
+#include "parquet/xxhasher.h"
 
 namespace parquet {
 constexpr uint32_t BlockSplitBloomFilter::SALT[kBitsSetPerBlock];
@@ -68,6 +70,12 @@ void BlockSplitBloomFilter::Init(const uint8_t* bitset, uint32_t num_bytes) {
   this->hasher_.reset(new MurmurHash3());
 }
 
+void BlockSplitBloomFilter::InitXxHash(uint32_t num_bytes) {
+  Init(num_bytes);
+  hash_strategy_ = HashStrategy::XXHASH;
+  this->hasher_.reset(new XxHasher());
+}
+
 BlockSplitBloomFilter BlockSplitBloomFilter::Deserialize(ArrowInputStream* input) {
   uint32_t len, hash, algorithm;
   int64_t bytes_available;
@@ -100,9 +108,66 @@ BlockSplitBloomFilter BlockSplitBloomFilter::Deserialize(ArrowInputStream* input
   return bloom_filter;
 }
 
+BlockSplitBloomFilter BlockSplitBloomFilter::Deserialize(
+    const ReaderProperties& properties, ArrowInputStream* input) {
+  // The header is small, so read it along with the start of the bitset
+  PARQUET_ASSIGN_OR_THROW(auto header_buf, input->Read(kBloomFilterHeaderSizeGuess));
+  uint32_t header_size = static_cast<uint32_t>(header_buf->size());
+  format::BloomFilterHeader header;
+  ThriftDeserializer deserializer(properties);
+  deserializer.DeserializeMessage(header_buf->data(), &header_size, &header);
+
+  if (!header.algorithm.__isset.BLOCK) {
+    throw ParquetException("Unsupported Bloom filter algorithm");
+  }
+  if (!header.hash.__isset.XXHASH) {
+    throw ParquetException("Unsupported Bloom filter hash strategy");
+  }
+  if (!header.compression.__isset.UNCOMPRESSED) {
+    throw ParquetException("Unsupported Bloom filter compression");
+  }
+  const int64_t bitset_size = header.numBytes;
+  if (bitset_size <= 0 || bitset_size > kMaximumBloomFilterBytes) {
+    throw ParquetException("Invalid Bloom filter size");
+  }
+
+  std::shared_ptr<Buffer> bitset;
+  const int64_t prefetched = header_buf->size() - header_size;
+  if (prefetched >= bitset_size) {
+    bitset = SliceBuffer(header_buf, header_size, bitset_size);
+  } else {
+    PARQUET_ASSIGN_OR_THROW(auto remaining, input->Read(bitset_size - prefetched));
+    if (remaining->size() != bitset_size - prefetched) {
+      throw ParquetException("Failed to deserialize from input stream");
+    }
+    PARQUET_ASSIGN_OR_THROW(auto combined, ::arrow::AllocateBuffer(bitset_size));
+    memcpy(combined->mutable_data(), header_buf->data() + header_size, prefetched);
+    memcpy(combined->mutable_data() + prefetched, remaining->data(), remaining->size());
+    bitset = std::move(combined);
+  }
+
+  BlockSplitBloomFilter bloom_filter;
+  bloom_filter.Init(bitset->data(), static_cast<uint32_t>(bitset_size));
+  bloom_filter.hash_strategy_ = HashStrategy::XXHASH;
+  bloom_filter.hasher_.reset(new XxHasher());
+  return bloom_filter;
+}
+
 void BlockSplitBloomFilter::WriteTo(ArrowOutputStream* sink) const {
   DCHECK(sink != nullptr);
 
+  if (hash_strategy_ == HashStrategy::XXHASH) {
+    format::BloomFilterHeader header;
+    header.__set_numBytes(static_cast<int32_t>(num_bytes_));
+    header.algorithm.__set_BLOCK(format::SplitBlockAlgorithm());
+    header.hash.__set_XXHASH(format::XxHash());
+    header.compression.__set_UNCOMPRESSED(format::Uncompressed());
+    ThriftSerializer serializer;
+    serializer.Serialize(&header, sink);
+    PARQUET_THROW_NOT_OK(sink->Write(data_->data(), num_bytes_));
+    return;
+  }
+
   PARQUET_THROW_NOT_OK(
       sink->Write(reinterpret_cast<const uint8_t*>(&num_bytes_), sizeof(num_bytes_)));
   PARQUET_THROW_NOT_OK(sink->Write(reinterpret_cast<const uint8_t*>(&hash_strategy_),
@@ -112,6 +177,12 @@ void BlockSplitBloomFilter::WriteTo(ArrowOutputStream* sink) const {
   PARQUET_THROW_NOT_OK(sink->Write(data_->mutable_data(), num_bytes_));
 }
 
+void BlockSplitBloomFilter::InsertHashes(const uint64_t* hashes, int num_values) {
+  for (int i = 0; i < num_values; ++i) {
+    InsertHash(hashes[i]);
+  }
+}
+
 void BlockSplitBloomFilter::SetMask(uint32_t key, BlockMask& block_mask) const {
   for (int i = 0; i < kBitsSetPerBlock; ++i) {
     block_mask.item[i] = key * SALT[i];
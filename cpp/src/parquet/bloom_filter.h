@@ -29,6 +29,8 @@
 
 namespace parquet {
 
+class ReaderProperties;
+
 // A Bloom filter is a compact structure to indicate whether an item is not in a set or
 // probably in a set. The Bloom filter usually consists of a bit set that represents a
 // set of elements, a hash strategy and a Bloom filter algorithm.
@@ -49,9 +51,17 @@ class PARQUET_EXPORT BloomFilter {
   /// @param hash the hash of value to insert into Bloom filter.
   virtual void InsertHash(uint64_t hash) = 0;
 
+  /// Insert a batch of elements to set represented by Bloom filter bitset.
+  /// @param hashes the hashes of values to insert into Bloom filter.
+  /// @param num_values the number of hashes.
+  virtual void InsertHashes(const uint64_t* hashes, int num_values) = 0;
+
   /// Write this Bloom filter to an output stream. A Bloom filter structure should
   /// include bitset length, hash strategy, algorithm, and bitset.
   ///
+  /// Bloom filters hashing with XXH64 are written as specified by the Parquet
+  /// format: a Thrift BloomFilterHeader followed by the bitset.
+  ///
   /// @param sink the output stream to write
   virtual void WriteTo(ArrowOutputStream* sink) const = 0;
 
@@ -101,11 +111,26 @@ class PARQUET_EXPORT BloomFilter {
   /// @return hash result.
   virtual uint64_t Hash(const FLBA* value, uint32_t len) const = 0;
 
+  /// Compute hashes of a batch of values by using their plain encoding result.
+  ///
+  /// @param values the values to hash.
+  /// @param num_values the number of values.
+  /// @param hashes the output, with room for num_values hashes.
+  virtual void Hashes(const int32_t* values, int num_values, uint64_t* hashes) const = 0;
+  virtual void Hashes(const int64_t* values, int num_values, uint64_t* hashes) const = 0;
+  virtual void Hashes(const float* values, int num_values, uint64_t* hashes) const = 0;
+  virtual void Hashes(const double* values, int num_values, uint64_t* hashes) const = 0;
+  virtual void Hashes(const Int96* values, int num_values, uint64_t* hashes) const = 0;
+  virtual void Hashes(const ByteArray* values, int num_values,
+                      uint64_t* hashes) const = 0;
+  virtual void Hashes(const FLBA* values, uint32_t len, int num_values,
+                      uint64_t* hashes) const = 0;
+
   virtual ~BloomFilter() {}
 
  protected:
   // Hash strategy available for Bloom filter.
-  enum class HashStrategy : uint32_t { MURMUR3_X64_128 = 0 };
+  enum class HashStrategy : uint32_t { MURMUR3_X64_128 = 0, XXHASH = 1 };
 
   // Bloom filter algorithm.
   enum class Algorithm : uint32_t { BLOCK = 0 };
@@ -140,6 +165,13 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
   /// @param num_bytes  The number of bytes of given bitset.
   void Init(const uint8_t* bitset, uint32_t num_bytes);
 
+  /// Initialize the BlockSplitBloomFilter like Init(num_bytes), but hashing with
+  /// XXH64 as specified by the Parquet format. This is used when writing a Bloom
+  /// filter to a parquet file.
+  ///
+  /// @param num_bytes The number of bytes to store Bloom filter bitset.
+  void InitXxHash(uint32_t num_bytes);
+
   // Minimum Bloom filter size, it sets to 32 bytes to fit a tiny Bloom filter.
   static constexpr uint32_t kMinimumBloomFilterBytes = 32;
 
@@ -182,6 +214,7 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
 
   bool FindHash(uint64_t hash) const override;
   void InsertHash(uint64_t hash) override;
+  void InsertHashes(const uint64_t* hashes, int num_values) override;
   void WriteTo(ArrowOutputStream* sink) const override;
   uint32_t GetBitsetSize() const override { return num_bytes_; }
 
@@ -195,6 +228,30 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
     return hasher_->Hash(value, len);
   }
 
+  void Hashes(const int32_t* values, int num_values, uint64_t* hashes) const override {
+    hasher_->Hashes(values, num_values, hashes);
+  }
+  void Hashes(const int64_t* values, int num_values, uint64_t* hashes) const override {
+    hasher_->Hashes(values, num_values, hashes);
+  }
+  void Hashes(const float* values, int num_values, uint64_t* hashes) const override {
+    hasher_->Hashes(values, num_values, hashes);
+  }
+  void Hashes(const double* values, int num_values, uint64_t* hashes) const override {
+    hasher_->Hashes(values, num_values, hashes);
+  }
+  void Hashes(const Int96* values, int num_values, uint64_t* hashes) const override {
+    hasher_->Hashes(values, num_values, hashes);
+  }
+  void Hashes(const ByteArray* values, int num_values,
+              uint64_t* hashes) const override {
+    hasher_->Hashes(values, num_values, hashes);
+  }
+  void Hashes(const FLBA* values, uint32_t len, int num_values,
+              uint64_t* hashes) const override {
+    hasher_->Hashes(values, len, num_values, hashes);
+  }
+
   /// Deserialize the Bloom filter from an input stream. It is used when reconstructing
   /// a Bloom filter from a parquet filter.
   ///
@@ -202,6 +259,20 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
   /// @return The BlockSplitBloomFilter.
   static BlockSplitBloomFilter Deserialize(ArrowInputStream* input_stream);
 
+  /// Deserialize a Bloom filter stored in a Parquet file, as specified by the
+  /// Parquet format: a Thrift BloomFilterHeader followed by the bitset, hashed
+  /// with XXH64.
+  ///
+  /// @param properties The reader properties, bounding the Thrift header size.
+  /// @param input_stream The input stream positioned at the start of the header.
+  /// @return The BlockSplitBloomFilter.
+  static BlockSplitBloomFilter Deserialize(const ReaderProperties& properties,
+                                           ArrowInputStream* input_stream);
+
+  // Upper bound of the size of a serialized BloomFilterHeader, read ahead of the
+  // bitset since its actual size is only known once it is parsed.
+  static constexpr int64_t kBloomFilterHeaderSizeGuess = 256;
+
  private:
   // Bytes in a tiny Bloom filter block.
   static constexpr int kBytesPerFilterBlock = 32;
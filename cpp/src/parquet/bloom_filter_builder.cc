@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/bloom_filter_builder.h"
+
+#include <utility>
+
+#include "arrow/util/logging.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/exception.h"
+#include "parquet/schema.h"
+
+namespace parquet {
+
+namespace {
+
+class BloomFilterBuilderImpl : public BloomFilterBuilder {
+ public:
+  BloomFilterBuilderImpl(const SchemaDescriptor* schema,
+                         const WriterProperties* properties)
+      : schema_(schema), properties_(properties) {}
+
+  void AppendRowGroup() override {
+    bloom_filters_.emplace_back(schema_->num_columns());
+  }
+
+  BloomFilter* GetOrCreateBloomFilter(int i) override {
+    DCHECK(!bloom_filters_.empty());
+    std::unique_ptr<BloomFilter>& bloom_filter = bloom_filters_.back().at(i);
+    if (bloom_filter == nullptr) {
+      const ColumnDescriptor* descr = schema_->Column(i);
+      if (descr->physical_type() == Type::BOOLEAN ||
+          !properties_->bloom_filter_enabled(descr->path())) {
+        return nullptr;
+      }
+      const BloomFilterOptions& options =
+          properties_->bloom_filter_options(descr->path());
+      std::unique_ptr<BlockSplitBloomFilter> block_split_bloom_filter(
+          new BlockSplitBloomFilter());
+      block_split_bloom_filter->InitXxHash(
+          BlockSplitBloomFilter::OptimalNumOfBits(static_cast<uint32_t>(options.ndv),
+                                                  options.fpp) /
+          8);
+      bloom_filter = std::move(block_split_bloom_filter);
+    }
+    return bloom_filter.get();
+  }
+
+  void WriteTo(ArrowOutputStream* sink, BloomFilterLocation* location) const override {
+    location->bloom_filter_offset.resize(bloom_filters_.size());
+    for (size_t row_group = 0; row_group < bloom_filters_.size(); ++row_group) {
+      std::vector<int64_t>& offsets = location->bloom_filter_offset[row_group];
+      for (const auto& bloom_filter : bloom_filters_[row_group]) {
+        if (bloom_filter == nullptr) {
+          offsets.push_back(-1);
+          continue;
+        }
+        PARQUET_ASSIGN_OR_THROW(int64_t offset, sink->Tell());
+        bloom_filter->WriteTo(sink);
+        offsets.push_back(offset);
+      }
+    }
+  }
+
+ private:
+  const SchemaDescriptor* schema_;
+  const WriterProperties* properties_;
+  std::vector<std::vector<std::unique_ptr<BloomFilter>>> bloom_filters_;
+};
+
+}  // namespace
+
+std::unique_ptr<BloomFilterBuilder> BloomFilterBuilder::Make(
+    const SchemaDescriptor* schema, const WriterProperties* properties) {
+  return std::unique_ptr<BloomFilterBuilder>(
+      new BloomFilterBuilderImpl(schema, properties));
+}
+
+}  // namespace parquet
@@ -0,0 +1,64 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "parquet/platform.h"
+#include "parquet/properties.h"
+
+namespace parquet {
+
+class BloomFilter;
+class SchemaDescriptor;
+
+/// \brief Offsets of the serialized Bloom filters, by row group then column.
+///
+/// A negative offset marks a column chunk without a Bloom filter.
+struct PARQUET_EXPORT BloomFilterLocation {
+  std::vector<std::vector<int64_t>> bloom_filter_offset;
+};
+
+/// \brief Accumulates the Bloom filters of a whole file while it is written
+///
+/// Filters are created, sized according to WriterProperties, for the columns
+/// which enable them, except BOOLEAN ones.
+class PARQUET_EXPORT BloomFilterBuilder {
+ public:
+  static std::unique_ptr<BloomFilterBuilder> Make(const SchemaDescriptor* schema,
+                                                  const WriterProperties* properties);
+
+  virtual ~BloomFilterBuilder() = default;
+
+  /// \brief Start the filters of a new row group
+  virtual void AppendRowGroup() = 0;
+
+  /// \brief The Bloom filter of column i of the current row group, or nullptr
+  /// if the column has none
+  virtual BloomFilter* GetOrCreateBloomFilter(int i) = 0;
+
+  /// \brief Serialize all Bloom filters
+  ///
+  /// Must be called after all column chunks have been closed.  Offsets of
+  /// the written filters are stored in location.
+  virtual void WriteTo(ArrowOutputStream* sink, BloomFilterLocation* location) const = 0;
+};
+
+}  // namespace parquet
@@ -0,0 +1,228 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/bloom_filter_reader.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <utility>
+
+#include "arrow/io/memory.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/exception.h"
+#include "parquet/metadata.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+namespace {
+
+class BloomFilterReaderImpl;
+
+class RowGroupBloomFilterReaderImpl : public RowGroupBloomFilterReader {
+ public:
+  RowGroupBloomFilterReaderImpl(std::shared_ptr<BloomFilterReaderImpl> file_reader,
+                                int row_group)
+      : file_reader_(std::move(file_reader)), row_group_(row_group) {}
+
+  std::shared_ptr<BloomFilter> GetColumnBloomFilter(int i) override;
+
+ private:
+  std::shared_ptr<BloomFilterReaderImpl> file_reader_;
+  int row_group_;
+};
+
+class BloomFilterReaderImpl : public BloomFilterReader,
+                              public std::enable_shared_from_this<BloomFilterReaderImpl> {
+ public:
+  BloomFilterReaderImpl(std::shared_ptr<ArrowInputFile> source,
+                        std::shared_ptr<FileMetaData> file_metadata,
+                        const ReaderProperties& properties)
+      : source_(std::move(source)),
+        file_metadata_(std::move(file_metadata)),
+        properties_(properties) {}
+
+  std::shared_ptr<RowGroupBloomFilterReader> RowGroup(int i) override {
+    if (i < 0 || i >= file_metadata_->num_row_groups()) {
+      std::stringstream ss;
+      ss << "Invalid row group index " << i << " for Bloom filters of a file with "
+         << file_metadata_->num_row_groups() << " row groups";
+      throw ParquetException(ss.str());
+    }
+    return std::make_shared<RowGroupBloomFilterReaderImpl>(shared_from_this(), i);
+  }
+
+  std::shared_ptr<BloomFilter> GetColumnBloomFilter(int row_group, int column) {
+    const Key key{row_group, column};
+    const auto offset = GetBloomFilterOffset(key);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = filters_.find(key);
+    if (it != filters_.end()) {
+      return it->second;
+    }
+    std::shared_ptr<BloomFilter> filter;
+    if (offset.has_value()) {
+      const int64_t source_size = GetSourceSize();
+      CheckOffset(*offset, source_size);
+      auto stream = ::arrow::io::RandomAccessFile::GetStream(source_, *offset,
+                                                             source_size - *offset);
+      filter = std::make_shared<BlockSplitBloomFilter>(
+          BlockSplitBloomFilter::Deserialize(properties_, stream.get()));
+    }
+    filters_.emplace(key, filter);
+    return filter;
+  }
+
+  void WillNeed(const std::vector<int>& row_groups,
+                const std::vector<int>& column_indices,
+                const ::arrow::io::IOContext& ctx,
+                const ::arrow::io::CacheOptions& options) override {
+    std::vector<std::pair<Key, int64_t>> pending;
+    for (int row_group : row_groups) {
+      if (row_group < 0 || row_group >= file_metadata_->num_row_groups()) {
+        std::stringstream ss;
+        ss << "Invalid row group index " << row_group
+           << " for Bloom filters of a file with " << file_metadata_->num_row_groups()
+           << " row groups";
+        throw ParquetException(ss.str());
+      }
+      for (int column : column_indices) {
+        const Key key{row_group, column};
+        if (auto offset = GetBloomFilterOffset(key)) {
+          pending.emplace_back(key, *offset);
+        }
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending.erase(std::remove_if(pending.begin(), pending.end(),
+                                 [&](const std::pair<Key, int64_t>& entry) {
+                                   return filters_.count(entry.first) > 0;
+                                 }),
+                  pending.end());
+    if (pending.empty()) {
+      return;
+    }
+    const int64_t source_size = GetSourceSize();
+
+    // Headers first, as the size of a filter is only known once its header is parsed
+    std::vector<::arrow::io::ReadRange> header_ranges;
+    for (const auto& entry : pending) {
+      CheckOffset(entry.second, source_size);
+      header_ranges.push_back(
+          {entry.second, std::min(BlockSplitBloomFilter::kBloomFilterHeaderSizeGuess,
+                                  source_size - entry.second)});
+    }
+    ::arrow::io::internal::ReadRangeCache header_cache(source_, ctx, options);
+    PARQUET_THROW_NOT_OK(header_cache.Cache(header_ranges));
+
+    std::vector<std::shared_ptr<Buffer>> buffers(pending.size());
+    std::vector<::arrow::io::ReadRange> filter_ranges;
+    for (size_t i = 0; i < pending.size(); ++i) {
+      PARQUET_ASSIGN_OR_THROW(buffers[i], header_cache.Read(header_ranges[i]));
+      const int64_t filter_size = GetSerializedSize(*buffers[i]);
+      if (filter_size > source_size - pending[i].second) {
+        throw ParquetException("Bloom filter extends beyond the end of the file");
+      }
+      if (filter_size > buffers[i]->size()) {
+        // Small filters were read along with their header
+        buffers[i].reset();
+        filter_ranges.push_back({pending[i].second, filter_size});
+      }
+    }
+
+    ::arrow::io::internal::ReadRangeCache filter_cache(source_, ctx, options);
+    PARQUET_THROW_NOT_OK(filter_cache.Cache(filter_ranges));
+    for (size_t i = 0, next_range = 0; i < pending.size(); ++i) {
+      if (!buffers[i]) {
+        PARQUET_ASSIGN_OR_THROW(buffers[i],
+                                filter_cache.Read(filter_ranges[next_range++]));
+      }
+      ::arrow::io::BufferReader stream(buffers[i]);
+      filters_[pending[i].first] = std::make_shared<BlockSplitBloomFilter>(
+          BlockSplitBloomFilter::Deserialize(properties_, &stream));
+    }
+  }
+
+ private:
+  using Key = std::pair<int, int>;
+
+  ::arrow::util::optional<int64_t> GetBloomFilterOffset(const Key& key) const {
+    auto row_group_metadata = file_metadata_->RowGroup(key.first);
+    if (key.second < 0 || key.second >= row_group_metadata->num_columns()) {
+      std::stringstream ss;
+      ss << "Invalid column index " << key.second
+         << " for Bloom filters of a row group with "
+         << row_group_metadata->num_columns() << " columns";
+      throw ParquetException(ss.str());
+    }
+    return row_group_metadata->ColumnChunk(key.second)->bloom_filter_offset();
+  }
+
+  // Size of a serialized filter, header included, given a buffer starting with it
+  int64_t GetSerializedSize(const Buffer& buffer) const {
+    uint32_t header_size = static_cast<uint32_t>(buffer.size());
+    format::BloomFilterHeader header;
+    ThriftDeserializer deserializer(properties_);
+    deserializer.DeserializeMessage(buffer.data(), &header_size, &header);
+    if (header.numBytes <= 0) {
+      throw ParquetException("Invalid Bloom filter size");
+    }
+    return header_size + static_cast<int64_t>(header.numBytes);
+  }
+
+  static void CheckOffset(int64_t offset, int64_t source_size) {
+    if (offset < 0 || offset >= source_size) {
+      throw ParquetException("Invalid Bloom filter offset");
+    }
+  }
+
+  // Must be called with mutex_ held
+  int64_t GetSourceSize() {
+    if (source_size_ < 0) {
+      PARQUET_ASSIGN_OR_THROW(source_size_, source_->GetSize());
+    }
+    return source_size_;
+  }
+
+  std::shared_ptr<ArrowInputFile> source_;
+  std::shared_ptr<FileMetaData> file_metadata_;
+  const ReaderProperties properties_;
+
+  std::mutex mutex_;
+  int64_t source_size_ = -1;
+  // Loaded filters, including nullptr for column chunks without one
+  std::map<Key, std::shared_ptr<BloomFilter>> filters_;
+};
+
+std::shared_ptr<BloomFilter> RowGroupBloomFilterReaderImpl::GetColumnBloomFilter(int i) {
+  return file_reader_->GetColumnBloomFilter(row_group_, i);
+}
+
+}  // namespace
+
+std::shared_ptr<BloomFilterReader> BloomFilterReader::Make(
+    std::shared_ptr<ArrowInputFile> source, std::shared_ptr<FileMetaData> file_metadata,
+    const ReaderProperties& properties) {
+  return std::make_shared<BloomFilterReaderImpl>(std::move(source),
+                                                 std::move(file_metadata), properties);
+}
+
+}  // namespace parquet
@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/io/caching.h"
+#include "parquet/platform.h"
+#include "parquet/properties.h"
+
+namespace parquet {
+
+class BloomFilter;
+class FileMetaData;
+
+/// \brief Reads the Bloom filters of the column chunks of one row group
+class PARQUET_EXPORT RowGroupBloomFilterReader {
+ public:
+  virtual ~RowGroupBloomFilterReader() = default;
+
+  /// \brief The Bloom filter of column i, or nullptr if it has none
+  ///
+  /// \throws ParquetException if i is out of bounds or the filter is corrupt
+  virtual std::shared_ptr<BloomFilter> GetColumnBloomFilter(int i) = 0;
+};
+
+/// \brief Reads the Bloom filters of a Parquet file
+///
+/// Filters are cached once loaded, so that looking up the same column chunk
+/// again costs no I/O. Thread-safe.
+class PARQUET_EXPORT BloomFilterReader {
+ public:
+  static std::shared_ptr<BloomFilterReader> Make(
+      std::shared_ptr<ArrowInputFile> source, std::shared_ptr<FileMetaData> file_metadata,
+      const ReaderProperties& properties);
+
+  virtual ~BloomFilterReader() = default;
+
+  /// \brief The Bloom filter reader of row group i
+  ///
+  /// \throws ParquetException if i is out of bounds
+  virtual std::shared_ptr<RowGroupBloomFilterReader> RowGroup(int i) = 0;
+
+  /// \brief Load the Bloom filters of the given columns in the given row groups
+  ///
+  /// Reads of neighbouring filters are coalesced according to the cache options,
+  /// in two rounds: headers first, then the bitsets whose size they give.
+  /// Afterwards, GetColumnBloomFilter() for these column chunks doesn't block.
+  ///
+  /// \throws ParquetException on I/O error or if a filter is corrupt
+  virtual void WillNeed(const std::vector<int>& row_groups,
+                        const std::vector<int>& column_indices,
+                        const ::arrow::io::IOContext& ctx,
+                        const ::arrow::io::CacheOptions& options) = 0;
+};
+
+}  // namespace parquet
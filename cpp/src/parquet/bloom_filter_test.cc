@@ -26,6 +26,7 @@
 
 #include "arrow/buffer.h"
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 
@@ -34,7 +35,9 @@
 #include "parquet/murmur3.h"
 #include "parquet/platform.h"
 #include "parquet/test_util.h"
+#include "parquet/thrift_internal.h"
 #include "parquet/types.h"
+#include "parquet/xxhasher.h"
 
 namespace parquet {
 namespace test {
@@ -242,6 +245,73 @@ TEST(OptimalValueTest, TestBloomFilter) {
       UINT32_C(1073741824));
 }
 
+TEST(XxHashTest, TestBloomFilter) {
+  XxHasher hasher;
+  const ByteArray empty(0, nullptr);
+  // Reference value of XXH64 for an empty input and a seed of 0
+  EXPECT_EQ(hasher.Hash(&empty), UINT64_C(0xEF46DB3751D8E999));
+
+  const int32_t value = 42;
+  const ByteArray value_bytes(sizeof(value), reinterpret_cast<const uint8_t*>(&value));
+  EXPECT_EQ(hasher.Hash(value), hasher.Hash(&value_bytes));
+}
+
+// Serialize a Bloom filter as specified by the Parquet format
+std::shared_ptr<Buffer> SerializeSpecBloomFilter(const uint8_t* bitset,
+                                                 int32_t num_bytes) {
+  format::BloomFilterHeader header;
+  header.__set_numBytes(num_bytes);
+  header.algorithm.__set_BLOCK(format::SplitBlockAlgorithm());
+  header.hash.__set_XXHASH(format::XxHash());
+  header.compression.__set_UNCOMPRESSED(format::Uncompressed());
+
+  auto sink = CreateOutputStream();
+  ThriftSerializer serializer;
+  serializer.Serialize(&header, sink.get());
+  PARQUET_THROW_NOT_OK(sink->Write(bitset, num_bytes));
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  return buffer;
+}
+
+TEST(SpecFormatTest, TestBloomFilter) {
+  for (int32_t num_bytes : {32, 1024}) {
+    ARROW_SCOPED_TRACE("num_bytes = ", num_bytes);
+    std::vector<uint8_t> empty_bitset(num_bytes, 0);
+    auto empty_buffer = SerializeSpecBloomFilter(empty_bitset.data(), num_bytes);
+    ::arrow::io::BufferReader empty_source(empty_buffer);
+    BlockSplitBloomFilter bloom_filter =
+        BlockSplitBloomFilter::Deserialize(default_reader_properties(), &empty_source);
+    ASSERT_EQ(static_cast<uint32_t>(num_bytes), bloom_filter.GetBitsetSize());
+
+    // Filters in the Parquet format hash with XXH64
+    XxHasher hasher;
+    for (int64_t i = 0; i < 10; i++) {
+      ASSERT_EQ(hasher.Hash(i), bloom_filter.Hash(i));
+      bloom_filter.InsertHash(bloom_filter.Hash(i));
+    }
+
+    // Extract the bitset from the legacy serialization, after its 12-byte header
+    auto sink = CreateOutputStream();
+    bloom_filter.WriteTo(sink.get());
+    ASSERT_OK_AND_ASSIGN(auto legacy_buffer, sink->Finish());
+    auto buffer = SerializeSpecBloomFilter(legacy_buffer->data() + 12, num_bytes);
+
+    ::arrow::io::BufferReader source(buffer);
+    BlockSplitBloomFilter de_bloom =
+        BlockSplitBloomFilter::Deserialize(default_reader_properties(), &source);
+    for (int64_t i = 0; i < 10; i++) {
+      EXPECT_TRUE(de_bloom.FindHash(de_bloom.Hash(i)));
+    }
+  }
+
+  // Truncated bitset
+  std::vector<uint8_t> bitset(1024, 0);
+  auto buffer = SerializeSpecBloomFilter(bitset.data(), 1024);
+  ::arrow::io::BufferReader source(SliceBuffer(buffer, 0, buffer->size() - 1));
+  EXPECT_THROW(BlockSplitBloomFilter::Deserialize(default_reader_properties(), &source),
+               ParquetException);
+}
+
 }  // namespace test
 
 }  // namespace parquet
@@ -18,11 +18,13 @@
 #include "parquet/column_reader.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
 #include <exception>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -32,8 +34,11 @@
 #include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_dict.h"
 #include "arrow/array/builder_primitive.h"
+#include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
+#include "arrow/memory_pool.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
@@ -41,6 +46,8 @@
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "arrow/util/stopwatch.h"
+#include "arrow/util/thread_pool.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption/encryption_internal.h"
@@ -234,6 +241,16 @@ class SerializedPageReader : public PageReader {
         decryption_buffer_(AllocateBuffer(properties_.memory_pool(), 0)) {
     if (crypto_ctx != nullptr) {
       crypto_ctx_ = *crypto_ctx;
+      // The AAD is updated for every page, so keep it private to this reader
+      // while sharing the underlying AES decryptors
+      if (crypto_ctx_.meta_decryptor != nullptr) {
+        crypto_ctx_.meta_decryptor =
+            std::make_shared<Decryptor>(*crypto_ctx_.meta_decryptor);
+      }
+      if (crypto_ctx_.data_decryptor != nullptr) {
+        crypto_ctx_.data_decryptor =
+            std::make_shared<Decryptor>(*crypto_ctx_.data_decryptor);
+      }
       InitDecryption();
     }
     max_page_header_size_ = kDefaultMaxPageHeaderSize;
@@ -245,6 +262,11 @@ class SerializedPageReader : public PageReader {
 
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
 
+  bool RetainPageBuffers() override {
+    retain_page_buffers_ = true;
+    return true;
+  }
+
  private:
   void UpdateDecryption(const std::shared_ptr<Decryptor>& decryptor, int8_t module_type,
                         const std::string& page_aad);
@@ -294,6 +316,9 @@ class SerializedPageReader : public PageReader {
   std::string data_page_header_aad_;
   // Encryption
   std::shared_ptr<ResizableBuffer> decryption_buffer_;
+
+  // Allocate new decompression and decryption buffers for every page
+  bool retain_page_buffers_ = false;
 };
 
 void SerializedPageReader::InitDecryption() {
@@ -392,6 +417,9 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
 
     // Decrypt it if we need to
     if (crypto_ctx_.data_decryptor != nullptr) {
+      if (retain_page_buffers_) {
+        decryption_buffer_ = AllocateBuffer(properties_.memory_pool(), 0);
+      }
       PARQUET_THROW_NOT_OK(decryption_buffer_->Resize(
           compressed_len - crypto_ctx_.data_decryptor->CiphertextSizeDelta(), false));
       compressed_len = crypto_ctx_.data_decryptor->Decrypt(
@@ -491,7 +519,9 @@ std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
   }
 
   // Grow the uncompressed buffer if we need to.
-  if (uncompressed_len > static_cast<int>(decompression_buffer_->size())) {
+  if (retain_page_buffers_) {
+    decompression_buffer_ = AllocateBuffer(properties_.memory_pool(), uncompressed_len);
+  } else if (uncompressed_len > static_cast<int>(decompression_buffer_->size())) {
     PARQUET_THROW_NOT_OK(decompression_buffer_->Resize(uncompressed_len, false));
   }
 
@@ -502,23 +532,142 @@ std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
   }
 
   // Decompress the values
+  ::arrow::internal::StopWatch watch;
+  const auto& metrics = properties_.metrics();
+  if (metrics) watch.Start();
   PARQUET_THROW_NOT_OK(decompressor_->Decompress(
       compressed_len - levels_byte_len, page_buffer->data() + levels_byte_len,
       uncompressed_len - levels_byte_len,
       decompression_buffer_->mutable_data() + levels_byte_len));
+  if (metrics) metrics->decompression_ns += static_cast<int64_t>(watch.Stop());
 
   return decompression_buffer_;
 }
 
 }  // namespace
 
+// Prepares the next page of a column chunk on the CPU thread pool while the
+// caller decodes the current one, overlapping I/O, decryption and
+// decompression with decoding.
+//
+// The fetch of the next page is claimed by whichever side gets to it first:
+// the pool task, or the caller's following NextPage() call.  This keeps
+// callers that themselves run on the CPU thread pool from waiting on a task
+// queued behind them.
+class PrefetchingPageReader : public PageReader {
+ public:
+  explicit PrefetchingPageReader(std::unique_ptr<PageReader> reader)
+      : state_(std::make_shared<State>(std::move(reader))) {}
+
+  ~PrefetchingPageReader() override {
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    if (state_->status == kQueued) state_->status = kIdle;
+    state_->cv.wait(lock, [this] { return state_->status != kRunning; });
+  }
+
+  std::shared_ptr<Page> NextPage() override {
+    std::shared_ptr<Page> page;
+    if (!state_->TakeFetched(&page)) {
+      page = state_->reader->NextPage();
+    }
+    if (page != nullptr) ScheduleFetch();
+    return page;
+  }
+
+  void set_max_page_header_size(uint32_t size) override {
+    state_->Settle();
+    state_->reader->set_max_page_header_size(size);
+  }
+
+  bool RetainPageBuffers() override { return true; }
+
+ private:
+  enum Status { kIdle, kQueued, kRunning, kDone };
+
+  struct State {
+    explicit State(std::unique_ptr<PageReader> reader) : reader(std::move(reader)) {}
+
+    // Fetch the next page if the fetch is queued and unclaimed
+    void RunIfQueued() {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (status != kQueued) return;
+        status = kRunning;
+      }
+      std::shared_ptr<Page> next;
+      std::exception_ptr next_error;
+      try {
+        next = reader->NextPage();
+      } catch (...) {
+        next_error = std::current_exception();
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        page = std::move(next);
+        error = std::move(next_error);
+        status = kDone;
+      }
+      cv.notify_all();
+    }
+
+    // Complete an outstanding fetch, if any
+    void Settle() {
+      RunIfQueued();
+      std::unique_lock<std::mutex> lock(mutex);
+      cv.wait(lock, [this] { return status != kRunning; });
+    }
+
+    // Complete an outstanding fetch and return its page.  Returns false if no
+    // fetch was outstanding.
+    bool TakeFetched(std::shared_ptr<Page>* out) {
+      Settle();
+      std::lock_guard<std::mutex> lock(mutex);
+      if (status != kDone) return false;
+      status = kIdle;
+      if (error) {
+        std::exception_ptr fetch_error = std::move(error);
+        error = nullptr;
+        std::rethrow_exception(fetch_error);
+      }
+      *out = std::move(page);
+      return true;
+    }
+
+    std::unique_ptr<PageReader> reader;
+    std::mutex mutex;
+    std::condition_variable cv;
+    Status status = kIdle;
+    std::shared_ptr<Page> page;
+    std::exception_ptr error;
+  };
+
+  void ScheduleFetch() {
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      state_->status = kQueued;
+    }
+    // If the task cannot be spawned, the next NextPage() call runs the fetch
+    std::shared_ptr<State> state = state_;
+    ARROW_UNUSED(::arrow::internal::GetCpuThreadPool()->Spawn(
+        [state] { state->RunIfQueued(); }));
+  }
+
+  // Shared with the pool task, which may outlive this reader
+  std::shared_ptr<State> state_;
+};
+
 std::unique_ptr<PageReader> PageReader::Open(std::shared_ptr<ArrowInputStream> stream,
                                              int64_t total_num_rows,
                                              Compression::type codec,
                                              const ReaderProperties& properties,
                                              const CryptoContext* ctx) {
-  return std::unique_ptr<PageReader>(new SerializedPageReader(
+  std::unique_ptr<PageReader> reader(new SerializedPageReader(
       std::move(stream), total_num_rows, codec, properties, ctx));
+  // Prefetched pages must not share buffers with the page being decoded
+  if (properties.is_page_prefetch_enabled() && reader->RetainPageBuffers()) {
+    return std::unique_ptr<PageReader>(new PrefetchingPageReader(std::move(reader)));
+  }
+  return reader;
 }
 
 std::unique_ptr<PageReader> PageReader::Open(std::shared_ptr<ArrowInputStream> stream,
@@ -817,6 +966,7 @@ class ColumnReaderImplBase {
       }
     }
     current_encoding_ = encoding;
+    current_values_offset_ = levels_byte_size;
     current_decoder_->SetData(static_cast<int>(num_buffered_values_), buffer,
                               static_cast<int>(data_size));
   }
@@ -852,6 +1002,9 @@ class ColumnReaderImplBase {
   DecoderType* current_decoder_;
   Encoding::type current_encoding_;
 
+  // Offset of the encoded values in the current data page
+  int64_t current_values_offset_ = 0;
+
   /// Flag to signal when a new dictionary has been set, for the benefit of
   /// DictionaryRecordReader
   bool new_dictionary_;
@@ -1011,6 +1164,7 @@ template <typename DType>
 int64_t TypedColumnReaderImpl<DType>::ReadBatch(int64_t batch_size, int16_t* def_levels,
                                                 int16_t* rep_levels, T* values,
                                                 int64_t* values_read) {
+  ::arrow::MemoryTagScope memory_tag("parquet.decode");
   // HasNext invokes ReadNewPage
   if (!HasNext()) {
     *values_read = 0;
@@ -1249,6 +1403,7 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   }
 
   int64_t ReadRecords(int64_t num_records) override {
+    ::arrow::MemoryTagScope memory_tag("parquet.decode");
     // Delimit records, then read values at the end
     int64_t records_read = 0;
 
@@ -1317,6 +1472,61 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return records_read;
   }
 
+  int64_t SkipRecords(int64_t num_records) override {
+    if (num_records == 0) {
+      return 0;
+    }
+    // Skip the records whose levels were already decoded by ReadRecords
+    int64_t records_skipped = 0;
+    if (levels_position_ < levels_written_) {
+      records_skipped += SkipRecordsInBuffer(num_records);
+    }
+
+    while (!at_record_start_ || records_skipped < num_records) {
+      if (!this->HasNextInternal()) {
+        if (!at_record_start_) {
+          // The last record of the row group
+          ++records_skipped;
+          at_record_start_ = true;
+        }
+        break;
+      }
+      const int64_t available = available_values_current_page();
+      if (this->max_rep_level_ == 0 && num_records - records_skipped >= available) {
+        // One level per record: the rest of the page can be dropped without
+        // decoding its levels or values
+        records_skipped += available;
+        this->ConsumeBufferedValues(available);
+        continue;
+      }
+
+      if (this->max_def_level_ > 0) {
+        const int64_t batch_size = std::min(kMinLevelBatchSize, available);
+        ReserveLevels(batch_size);
+        int16_t* def_levels = this->def_levels() + levels_written_;
+        int16_t* rep_levels = this->rep_levels() + levels_written_;
+        const int64_t levels_read = this->ReadDefinitionLevels(batch_size, def_levels);
+        if (this->max_rep_level_ > 0 &&
+            this->ReadRepetitionLevels(batch_size, rep_levels) != levels_read) {
+          throw ParquetException("Number of decoded rep / def levels did not match");
+        }
+        if (levels_read == 0) {
+          // Exhausted column chunk
+          break;
+        }
+        levels_written_ += levels_read;
+        records_skipped += SkipRecordsInBuffer(num_records - records_skipped);
+      } else {
+        // No repetition or definition levels: one value per record
+        const int64_t values_to_skip = num_records - records_skipped;
+        SkipValues(values_to_skip);
+        this->ConsumeBufferedValues(values_to_skip);
+        records_skipped += values_to_skip;
+      }
+    }
+    return records_skipped;
+  }
+
   // We may outwardly have the appearance of having exhausted a column chunk
   // when in fact we are in the middle of processing the last batch
   bool has_values_to_process() const { return levels_position_ < levels_written_; }
@@ -1333,6 +1543,26 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     }
   }
 
+  void EnableZeroCopyValues() override {
+    const Type::type type = this->descr_->physical_type();
+    zero_copy_values_ = this->max_def_level_ == 0 && this->max_rep_level_ == 0 &&
+                        (type == Type::INT32 || type == Type::INT64 ||
+                         type == Type::FLOAT || type == Type::DOUBLE);
+    // A page being read may still share its buffer with the next pages
+    page_buffers_retained_ = zero_copy_values_ && this->pager_ != nullptr &&
+                             available_values_current_page() == 0 &&
+                             this->pager_->RetainPageBuffers();
+  }
+
+  std::vector<std::shared_ptr<Buffer>> ReleaseValueChunks() override {
+    std::vector<std::shared_ptr<Buffer>> chunks = std::move(value_chunks_);
+    value_chunks_.clear();
+    if (chunks.empty() || values_written_ > 0) {
+      chunks.push_back(ReleaseValues());
+    }
+    return chunks;
+  }
+
   std::shared_ptr<ResizableBuffer> ReleaseIsValid() override {
     if (leaf_info_.HasNullableValues()) {
       auto result = valid_bits_;
@@ -1459,6 +1689,7 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
 
   void Reset() override {
     ResetValues();
+    value_chunks_.clear();
 
     if (levels_written_ > 0) {
       const int64_t levels_remaining = levels_written_ - levels_position_;
@@ -1490,6 +1721,8 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   void SetPageReader(std::unique_ptr<PageReader> reader) override {
     at_record_start_ = true;
     this->pager_ = std::move(reader);
+    page_buffers_retained_ = zero_copy_values_ && this->pager_ != nullptr &&
+                             this->pager_->RetainPageBuffers();
     ResetDecoders();
   }
 
@@ -1514,8 +1747,102 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     CheckNumberDecoded(num_decoded, values_to_read);
   }
 
+  // Skip up to num_records records of the decoded levels which were not
+  // consumed yet, dropping those levels from the level buffers
+  //
+  // \return Number of records skipped
+  int64_t SkipRecordsInBuffer(int64_t num_records) {
+    const int64_t start_levels_position = levels_position_;
+
+    int64_t values_to_skip = 0;
+    int64_t records_skipped = 0;
+    if (this->max_rep_level_ > 0) {
+      records_skipped = DelimitRecords(num_records, &values_to_skip);
+    } else {
+      records_skipped = std::min(levels_written_ - levels_position_, num_records);
+      const int16_t* def_levels = this->def_levels() + levels_position_;
+      for (int64_t i = 0; i < records_skipped; ++i) {
+        values_to_skip += def_levels[i] == this->max_def_level_;
+      }
+      levels_position_ += records_skipped;
+    }
+    SkipValues(values_to_skip);
+
+    const int64_t levels_skipped = levels_position_ - start_levels_position;
+    this->ConsumeBufferedValues(levels_skipped);
+
+    // Shift the remaining levels over the skipped ones
+    int16_t* def_data = def_levels();
+    std::copy(def_data + levels_position_, def_data + levels_written_,
+              def_data + start_levels_position);
+    if (this->max_rep_level_ > 0) {
+      int16_t* rep_data = rep_levels();
+      std::copy(rep_data + levels_position_, rep_data + levels_written_,
+                rep_data + start_levels_position);
+    }
+    levels_written_ -= levels_skipped;
+    levels_position_ = start_levels_position;
+    return records_skipped;
+  }
+
+  // Decode and discard the next num_values values of the current page
+  void SkipValues(int64_t num_values) {
+    if (this->max_def_level_ == 0 && CanSliceValues()) {
+      // The decoder is not used for this page, see SliceValues
+      return;
+    }
+    constexpr int64_t kSkipBatchSize = 1024;
+    if (num_values > 0 && skip_scratch_ == nullptr) {
+      skip_scratch_ = AllocateBuffer(this->pool_, kSkipBatchSize * sizeof(T));
+    }
+    while (num_values > 0) {
+      const int64_t batch_size = std::min(kSkipBatchSize, num_values);
+      const int64_t num_decoded = this->current_decoder_->Decode(
+          reinterpret_cast<T*>(skip_scratch_->mutable_data()),
+          static_cast<int>(batch_size));
+      CheckNumberDecoded(num_decoded, batch_size);
+      num_values -= batch_size;
+    }
+  }
+
+  // Whether the values of the current data page can be sliced from its buffer.
+  // This holds for the whole page, so that its decoder is either used for all
+  // values or for none.
+  bool CanSliceValues() const {
+    if (!page_buffers_retained_ || this->current_page_ == nullptr ||
+        this->current_encoding_ != Encoding::PLAIN) {
+      return false;
+    }
+    const Page& page = *this->current_page_;
+    const uint8_t* values = page.data() + this->current_values_offset_;
+    return page.size() - this->current_values_offset_ >=
+               bytes_for_values(this->num_buffered_values_) &&
+           reinterpret_cast<uintptr_t>(values) % alignof(T) == 0;
+  }
+
+  // Slice the next num_values values of a required, non-repeated column from
+  // the current data page
+  void SliceValues(int64_t num_values) {
+    if (values_written_ > 0) {
+      // Values copied from previous pages come first
+      value_chunks_.push_back(ReleaseValues());
+      values_written_ = 0;
+    }
+    const int64_t offset =
+        this->current_values_offset_ + bytes_for_values(this->num_decoded_values_);
+    value_chunks_.push_back(::arrow::SliceBuffer(this->current_page_->buffer(), offset,
+                                                 bytes_for_values(num_values)));
+    this->ConsumeBufferedValues(num_values);
+  }
+
   // Return number of logical records read
   int64_t ReadRecordData(int64_t num_records) {
+    if (this->max_def_level_ == 0 && CanSliceValues()) {
+      // One value per record
+      SliceValues(num_records);
+      return num_records;
+    }
+
     // Conservative upper bound
     const int64_t possible_num_values =
         std::max(num_records, levels_written_ - levels_position_);
@@ -1615,6 +1942,15 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return reinterpret_cast<T*>(values_->mutable_data()) + values_written_;
   }
   LevelInfo leaf_info_;
+  // Values decoded by SkipRecords, discarded
+  std::shared_ptr<ResizableBuffer> skip_scratch_;
+  // Set by EnableZeroCopyValues for eligible columns
+  bool zero_copy_values_ = false;
+  // Whether the pages of the current page reader own their buffers
+  bool page_buffers_retained_ = false;
+  // Values sliced from data pages, or copied before such slices, preceding
+  // the values in values_
+  std::vector<std::shared_ptr<Buffer>> value_chunks_;
 };
 
 class FLBARecordReader : public TypedRecordReader<FLBAType>,
@@ -1712,19 +2048,47 @@ class ByteArrayChunkedRecordReader : public TypedRecordReader<ByteArrayType>,
   typename EncodingTraits<ByteArrayType>::Accumulator accumulator_;
 };
 
-class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
-                                        virtual public DictionaryRecordReader {
+// The value type of the Arrow dictionaries built for a column
+template <typename DType>
+std::shared_ptr<::arrow::DataType> DictionaryValueType(const ColumnDescriptor* descr) {
+  using ArrowType = typename EncodingTraits<DType>::ArrowType;
+  return ::arrow::TypeTraits<ArrowType>::type_singleton();
+}
+
+template <>
+std::shared_ptr<::arrow::DataType> DictionaryValueType<FLBAType>(
+    const ColumnDescriptor* descr) {
+  return ::arrow::fixed_size_binary(descr->type_length());
+}
+
+template <typename DType>
+class TypedDictionaryRecordReader : public TypedRecordReader<DType>,
+                                    virtual public DictionaryRecordReader {
  public:
-  ByteArrayDictionaryRecordReader(const ColumnDescriptor* descr, LevelInfo leaf_info,
-                                  ::arrow::MemoryPool* pool)
-      : TypedRecordReader<ByteArrayType>(descr, leaf_info, pool), builder_(pool) {
+  using BASE = TypedRecordReader<DType>;
+  using DictBuilder = typename EncodingTraits<DType>::DictAccumulator;
+
+  TypedDictionaryRecordReader(const ColumnDescriptor* descr, LevelInfo leaf_info,
+                              ::arrow::MemoryPool* pool, bool unify_dictionaries)
+      : BASE(descr, leaf_info, pool),
+        value_type_(DictionaryValueType<DType>(descr)),
+        builder_(value_type_, pool) {
     this->read_dictionary_ = true;
+    // Values are decoded straight into the builder
+    this->uses_values_ = false;
+    if (unify_dictionaries) {
+      PARQUET_ASSIGN_OR_THROW(unifier_,
+                              ::arrow::DictionaryUnifier::Make(value_type_, pool));
+    }
   }
 
   std::shared_ptr<::arrow::ChunkedArray> GetResult() override {
     FlushBuilder();
     std::vector<std::shared_ptr<::arrow::Array>> result;
     std::swap(result, result_chunks_);
+    if (unifier_) {
+      SetUnifiedDictionary(&result);
+    }
     return std::make_shared<::arrow::ChunkedArray>(std::move(result), builder_.type());
   }
 
@@ -1732,6 +2096,9 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
     if (builder_.length() > 0) {
       std::shared_ptr<::arrow::Array> chunk;
       PARQUET_THROW_NOT_OK(builder_.Finish(&chunk));
+      if (unifier_) {
+        chunk = TransposeToUnified(*chunk);
+      }
       result_chunks_.emplace_back(std::move(chunk));
 
       // Also clears the dictionary memo table
@@ -1745,7 +2112,7 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
       /// insert the new dictionary values
       FlushBuilder();
       builder_.ResetFull();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       decoder->InsertDictionary(&builder_);
       this->new_dictionary_ = false;
     }
@@ -1753,44 +2120,91 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
 
   void ReadValuesDense(int64_t values_to_read) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndices(static_cast<int>(values_to_read), &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrowNonNull(
           static_cast<int>(values_to_read), &builder_);
 
       /// Flush values since they have been copied into the builder
-      ResetValues();
+      this->ResetValues();
     }
     CheckNumberDecoded(num_decoded, values_to_read);
   }
 
   void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndicesSpaced(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrow(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
 
       /// Flush values since they have been copied into the builder
-      ResetValues();
+      this->ResetValues();
     }
     DCHECK_EQ(num_decoded, values_to_read - null_count);
   }
 
  private:
-  using BinaryDictDecoder = DictDecoder<ByteArrayType>;
+  // Rewrite the indices of a finished chunk to refer to the unified dictionary.
+  // The chunk's dictionary is replaced in GetResult, once all dictionaries
+  // seen so far have been unified.
+  std::shared_ptr<::arrow::Array> TransposeToUnified(const ::arrow::Array& chunk) {
+    const auto& dict_chunk = checked_cast<const ::arrow::DictionaryArray&>(chunk);
+    std::shared_ptr<Buffer> transpose_map;
+    PARQUET_THROW_NOT_OK(unifier_->Unify(*dict_chunk.dictionary(), &transpose_map));
+    const auto* transpose = reinterpret_cast<const int32_t*>(transpose_map->data());
+
+    const auto& indices = checked_cast<const ::arrow::Int32Array&>(*dict_chunk.indices());
+    PARQUET_ASSIGN_OR_THROW(
+        auto transposed,
+        ::arrow::AllocateBuffer(indices.length() * sizeof(int32_t), this->pool_));
+    auto out = reinterpret_cast<int32_t*>(transposed->mutable_data());
+    for (int64_t i = 0; i < indices.length(); ++i) {
+      // Null slots may hold arbitrary indices
+      out[i] = indices.IsValid(i) ? transpose[indices.Value(i)] : 0;
+    }
+
+    // Freshly finished, so the validity bitmap is not offset either
+    DCHECK_EQ(indices.offset(), 0);
+    auto data = indices.data()->Copy();
+    data->type = builder_.type();
+    data->buffers[1] = std::move(transposed);
+    data->dictionary = dict_chunk.dictionary()->data();
+    return ::arrow::MakeArray(std::move(data));
+  }
+
+  void SetUnifiedDictionary(std::vector<std::shared_ptr<::arrow::Array>>* chunks) {
+    std::shared_ptr<::arrow::Array> dictionary;
+    PARQUET_THROW_NOT_OK(
+        unifier_->GetResultWithIndexType(::arrow::int32(), &dictionary));
+    for (auto& chunk : *chunks) {
+      auto data = chunk->data()->Copy();
+      data->dictionary = dictionary->data();
+      chunk = ::arrow::MakeArray(std::move(data));
+    }
+
+    // The unifier cannot be reused, so seed a new one with the dictionary
+    // returned so far: later batches then extend it and keep earlier
+    // indices valid.
+    PARQUET_ASSIGN_OR_THROW(unifier_,
+                            ::arrow::DictionaryUnifier::Make(value_type_, this->pool_));
+    PARQUET_THROW_NOT_OK(unifier_->Unify(*dictionary));
+  }
 
-  ::arrow::BinaryDictionary32Builder builder_;
+  std::shared_ptr<::arrow::DataType> value_type_;
+  DictBuilder builder_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
+  // Only set when dictionaries are unified across row groups
+  std::unique_ptr<::arrow::DictionaryUnifier> unifier_;
 };
 
 // TODO(wesm): Implement these to some satisfaction
@@ -1806,35 +2220,61 @@ void TypedRecordReader<FLBAType>::DebugPrintState() {}
 std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor* descr,
                                                         LevelInfo leaf_info,
                                                         ::arrow::MemoryPool* pool,
-                                                        bool read_dictionary) {
+                                                        bool read_dictionary,
+                                                        bool unify_dictionaries) {
   if (read_dictionary) {
-    return std::make_shared<ByteArrayDictionaryRecordReader>(descr, leaf_info, pool);
+    return std::make_shared<TypedDictionaryRecordReader<ByteArrayType>>(
+        descr, leaf_info, pool, unify_dictionaries);
   } else {
     return std::make_shared<ByteArrayChunkedRecordReader>(descr, leaf_info, pool);
   }
 }
 
+template <typename DType>
+std::shared_ptr<RecordReader> MakeFixedWidthRecordReader(const ColumnDescriptor* descr,
+                                                         LevelInfo leaf_info,
+                                                         ::arrow::MemoryPool* pool,
+                                                         bool read_dictionary,
+                                                         bool unify_dictionaries) {
+  if (read_dictionary) {
+    return std::make_shared<TypedDictionaryRecordReader<DType>>(descr, leaf_info, pool,
+                                                                unify_dictionaries);
+  } else {
+    return std::make_shared<TypedRecordReader<DType>>(descr, leaf_info, pool);
+  }
+}
+
 }  // namespace
 
 std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
                                                  LevelInfo leaf_info, MemoryPool* pool,
-                                                 const bool read_dictionary) {
+                                                 const bool read_dictionary,
+                                                 const bool unify_dictionaries) {
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, leaf_info, pool);
     case Type::INT32:
-      return std::make_shared<TypedRecordReader<Int32Type>>(descr, leaf_info, pool);
+      return MakeFixedWidthRecordReader<Int32Type>(descr, leaf_info, pool,
+                                                   read_dictionary, unify_dictionaries);
     case Type::INT64:
-      return std::make_shared<TypedRecordReader<Int64Type>>(descr, leaf_info, pool);
+      return MakeFixedWidthRecordReader<Int64Type>(descr, leaf_info, pool,
+                                                   read_dictionary, unify_dictionaries);
     case Type::INT96:
       return std::make_shared<TypedRecordReader<Int96Type>>(descr, leaf_info, pool);
     case Type::FLOAT:
-      return std::make_shared<TypedRecordReader<FloatType>>(descr, leaf_info, pool);
+      return MakeFixedWidthRecordReader<FloatType>(descr, leaf_info, pool,
+                                                   read_dictionary, unify_dictionaries);
     case Type::DOUBLE:
-      return std::make_shared<TypedRecordReader<DoubleType>>(descr, leaf_info, pool);
+      return MakeFixedWidthRecordReader<DoubleType>(descr, leaf_info, pool,
+                                                    read_dictionary, unify_dictionaries);
     case Type::BYTE_ARRAY:
-      return MakeByteArrayRecordReader(descr, leaf_info, pool, read_dictionary);
+      return MakeByteArrayRecordReader(descr, leaf_info, pool, read_dictionary,
+                                       unify_dictionaries);
     case Type::FIXED_LEN_BYTE_ARRAY:
+      if (read_dictionary) {
+        return std::make_shared<TypedDictionaryRecordReader<FLBAType>>(
+            descr, leaf_info, pool, unify_dictionaries);
+      }
       return std::make_shared<FLBARecordReader>(descr, leaf_info, pool);
     default: {
       // PARQUET-1481: This can occur if the file is corrupt
@@ -117,6 +117,14 @@ class PARQUET_EXPORT PageReader {
   virtual std::shared_ptr<Page> NextPage() = 0;
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
+
+  /// \brief Make the pages returned by subsequent NextPage() calls own their
+  /// buffers, instead of sharing decompression or decryption buffers that are
+  /// overwritten by the next page
+  ///
+  /// This lets readers keep slices of page buffers.
+  /// \return false if this page reader does not support it
+  virtual bool RetainPageBuffers() { return false; }
 };
 
 class PARQUET_EXPORT ColumnReader {
@@ -260,10 +268,13 @@ namespace internal {
 /// \since 1.3.0
 class RecordReader {
  public:
+  /// \param[in] unify_dictionaries when reading dictionaries, transpose the
+  /// indices of every dictionary page into a single dictionary that only grows
+  /// across row groups, rather than emitting one dictionary per page
   static std::shared_ptr<RecordReader> Make(
       const ColumnDescriptor* descr, LevelInfo leaf_info,
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
-      const bool read_dictionary = false);
+      const bool read_dictionary = false, const bool unify_dictionaries = false);
 
   virtual ~RecordReader() = default;
 
@@ -271,6 +282,13 @@ class RecordReader {
   /// \return number of records read
   virtual int64_t ReadRecords(int64_t num_records) = 0;
 
+  /// \brief Skip the indicated number of records from column chunk
+  ///
+  /// Values and levels already read are kept; the skipped records are not
+  /// materialized, and whole data pages are skipped for non-repeated columns.
+  /// \return number of records skipped
+  virtual int64_t SkipRecords(int64_t num_records) = 0;
+
   /// \brief Pre-allocate space for data. Results in better flat read performance
   virtual void Reserve(int64_t num_values) = 0;
 
@@ -286,6 +304,23 @@ class RecordReader {
   /// be allocated in subsequent ReadRecords calls
   virtual std::shared_ptr<ResizableBuffer> ReleaseIsValid() = 0;
 
+  /// \brief Slice values from the data page buffers instead of copying them,
+  /// when the column layout allows it
+  ///
+  /// This applies to required, non-repeated INT32, INT64, FLOAT and DOUBLE
+  /// columns whose data pages are PLAIN-encoded, suitably aligned and owned by
+  /// the page reader (see PageReader::RetainPageBuffers).  Sliced values are
+  /// only returned by ReleaseValueChunks().
+  virtual void EnableZeroCopyValues() {}
+
+  /// \brief Transfer the buffers holding the values read so far, in order
+  ///
+  /// This is the buffer returned by ReleaseValues(), preceded by the values
+  /// sliced from data pages if EnableZeroCopyValues() was called.
+  virtual std::vector<std::shared_ptr<Buffer>> ReleaseValueChunks() {
+    return {ReleaseValues()};
+  }
+
   /// \brief Return true if the record reader has more internal data yet to
   /// process
   virtual bool HasMoreData() const = 0;
@@ -361,7 +396,7 @@ class BinaryRecordReader : virtual public RecordReader {
 };
 
 /// \brief Read records directly to dictionary-encoded Arrow form (int32
-/// indices). Only valid for BYTE_ARRAY columns
+/// indices). Valid for all physical types except BOOLEAN and INT96
 class DictionaryRecordReader : virtual public RecordReader {
  public:
   virtual std::shared_ptr<::arrow::ChunkedArray> GetResult() = 0;
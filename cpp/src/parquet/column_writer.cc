@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -33,6 +34,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
@@ -42,12 +44,14 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
 #include "arrow/visit_array_inline.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption/encryption_internal.h"
 #include "parquet/encryption/internal_file_encryptor.h"
 #include "parquet/level_conversion.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -129,6 +133,9 @@ struct ValueBufferSlicer {
   NOT_IMPLEMENTED_VISIT(FixedSizeList);
   NOT_IMPLEMENTED_VISIT(Dictionary);
   NOT_IMPLEMENTED_VISIT(Extension);
+  NOT_IMPLEMENTED_VISIT(BinaryView);
+  NOT_IMPLEMENTED_VISIT(StringView);
+  NOT_IMPLEMENTED_VISIT(RunEndEncoded);
 
 #undef NOT_IMPLEMENTED_VISIT
 
@@ -249,7 +256,9 @@ class SerializedPageWriter : public PageWriter {
                        int16_t row_group_ordinal, int16_t column_chunk_ordinal,
                        MemoryPool* pool = ::arrow::default_memory_pool(),
                        std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                       std::shared_ptr<Encryptor> data_encryptor = nullptr)
+                       std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                       ColumnIndexBuilder* column_index_builder = nullptr,
+                       OffsetIndexBuilder* offset_index_builder = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
         pool_(pool),
@@ -263,7 +272,9 @@ class SerializedPageWriter : public PageWriter {
         column_ordinal_(column_chunk_ordinal),
         meta_encryptor_(std::move(meta_encryptor)),
         data_encryptor_(std::move(data_encryptor)),
-        encryption_buffer_(AllocateBuffer(pool, 0)) {
+        encryption_buffer_(AllocateBuffer(pool, 0)),
+        column_index_builder_(column_index_builder),
+        offset_index_builder_(offset_index_builder) {
     if (data_encryptor_ != nullptr || meta_encryptor_ != nullptr) {
       InitEncryption();
     }
@@ -337,6 +348,16 @@ class SerializedPageWriter : public PageWriter {
                       meta_encryptor_);
     // Write metadata at end of column chunk
     metadata_->WriteTo(sink_.get());
+    FinishPageIndex(/*final_position=*/0);
+  }
+
+  void FinishPageIndex(int64_t final_position) {
+    if (column_index_builder_ != nullptr) {
+      column_index_builder_->Finish();
+    }
+    if (offset_index_builder_ != nullptr) {
+      offset_index_builder_->Finish(final_position);
+    }
   }
 
   /**
@@ -402,6 +423,19 @@ class SerializedPageWriter : public PageWriter {
         thrift_serializer_->Serialize(&page_header, sink_.get(), meta_encryptor_);
     PARQUET_THROW_NOT_OK(sink_->Write(output_data_buffer, output_data_len));
 
+    if (column_index_builder_ != nullptr) {
+      column_index_builder_->AddPage(page.statistics(), page.num_values());
+    }
+    if (offset_index_builder_ != nullptr) {
+      const int64_t page_size = header_size + output_data_len;
+      if (page_size > std::numeric_limits<int32_t>::max()) {
+        throw ParquetException("Data page size overflows INT32_MAX in the OffsetIndex");
+      }
+      DCHECK_GE(page.first_row_index(), 0);
+      offset_index_builder_->AddPage(start_pos, static_cast<int32_t>(page_size),
+                                     page.first_row_index());
+    }
+
     total_uncompressed_size_ += uncompressed_size + header_size;
     total_compressed_size_ += output_data_len + header_size;
     num_values_ += page.num_values();
@@ -535,6 +569,9 @@ class SerializedPageWriter : public PageWriter {
 
   std::map<Encoding::type, int32_t> dict_encoding_stats_;
   std::map<Encoding::type, int32_t> data_encoding_stats_;
+
+  ColumnIndexBuilder* column_index_builder_;
+  OffsetIndexBuilder* offset_index_builder_;
 };
 
 // This implementation of the PageWriter writes to the final sink on Close .
@@ -545,13 +582,15 @@ class BufferedPageWriter : public PageWriter {
                      int16_t row_group_ordinal, int16_t current_column_ordinal,
                      MemoryPool* pool = ::arrow::default_memory_pool(),
                      std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                     std::shared_ptr<Encryptor> data_encryptor = nullptr)
+                     std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                     ColumnIndexBuilder* column_index_builder = nullptr,
+                     OffsetIndexBuilder* offset_index_builder = nullptr)
       : final_sink_(std::move(sink)), metadata_(metadata), has_dictionary_pages_(false) {
     in_memory_sink_ = CreateOutputStream(pool);
-    pager_ = std::unique_ptr<SerializedPageWriter>(
-        new SerializedPageWriter(in_memory_sink_, codec, compression_level, metadata,
-                                 row_group_ordinal, current_column_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    pager_ = std::unique_ptr<SerializedPageWriter>(new SerializedPageWriter(
+        in_memory_sink_, codec, compression_level, metadata, row_group_ordinal,
+        current_column_ordinal, pool, std::move(meta_encryptor),
+        std::move(data_encryptor), column_index_builder, offset_index_builder));
   }
 
   int64_t WriteDictionaryPage(const DictionaryPage& page) override {
@@ -577,6 +616,9 @@ class BufferedPageWriter : public PageWriter {
     // Write metadata at end of column chunk
     metadata_->WriteTo(in_memory_sink_.get());
 
+    // Page offsets were recorded relative to the start of the in-memory sink
+    pager_->FinishPageIndex(final_position);
+
     // flush everything to the serialized sink
     PARQUET_ASSIGN_OR_THROW(auto buffer, in_memory_sink_->Finish());
     PARQUET_THROW_NOT_OK(final_sink_->Write(buffer));
@@ -605,17 +647,18 @@ std::unique_ptr<PageWriter> PageWriter::Open(
     int compression_level, ColumnChunkMetaDataBuilder* metadata,
     int16_t row_group_ordinal, int16_t column_chunk_ordinal, MemoryPool* pool,
     bool buffered_row_group, std::shared_ptr<Encryptor> meta_encryptor,
-    std::shared_ptr<Encryptor> data_encryptor) {
+    std::shared_ptr<Encryptor> data_encryptor, ColumnIndexBuilder* column_index_builder,
+    OffsetIndexBuilder* offset_index_builder) {
   if (buffered_row_group) {
-    return std::unique_ptr<PageWriter>(
-        new BufferedPageWriter(std::move(sink), codec, compression_level, metadata,
-                               row_group_ordinal, column_chunk_ordinal, pool,
-                               std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new BufferedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor), std::move(data_encryptor),
+        column_index_builder, offset_index_builder));
   } else {
-    return std::unique_ptr<PageWriter>(
-        new SerializedPageWriter(std::move(sink), codec, compression_level, metadata,
-                                 row_group_ordinal, column_chunk_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new SerializedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor), std::move(data_encryptor),
+        column_index_builder, offset_index_builder));
   }
 }
 
@@ -644,6 +687,7 @@ class ColumnWriterImpl {
         num_buffered_values_(0),
         num_buffered_encoded_values_(0),
         rows_written_(0),
+        page_first_row_index_(0),
         total_bytes_written_(0),
         total_compressed_bytes_(0),
         closed_(false),
@@ -750,6 +794,9 @@ class ColumnWriterImpl {
   // Total number of rows written with this ColumnWriter
   int64_t rows_written_;
 
+  // Index of the first row of the buffered data page, for the OffsetIndex
+  int64_t page_first_row_index_;
+
   // Records the total number of uncompressed bytes written by the serializer
   int64_t total_bytes_written_;
 
@@ -855,6 +902,7 @@ void ColumnWriterImpl::AddDataPage() {
   InitSinks();
   num_buffered_values_ = 0;
   num_buffered_encoded_values_ = 0;
+  page_first_row_index_ = rows_written_;
 }
 
 void ColumnWriterImpl::BuildDataPageV1(int64_t definition_levels_rle_size,
@@ -888,14 +936,15 @@ void ColumnWriterImpl::BuildDataPageV1(int64_t definition_levels_rle_size,
         compressed_data->CopySlice(0, compressed_data->size(), allocator_));
     std::unique_ptr<DataPage> page_ptr(new DataPageV1(
         compressed_data_copy, static_cast<int32_t>(num_buffered_values_), encoding_,
-        Encoding::RLE, Encoding::RLE, uncompressed_size, page_stats));
+        Encoding::RLE, Encoding::RLE, uncompressed_size, page_stats,
+        page_first_row_index_));
     total_compressed_bytes_ += page_ptr->size() + sizeof(format::PageHeader);
 
     data_pages_.push_back(std::move(page_ptr));
   } else {  // Eagerly write pages
     DataPageV1 page(compressed_data, static_cast<int32_t>(num_buffered_values_),
                     encoding_, Encoding::RLE, Encoding::RLE, uncompressed_size,
-                    page_stats);
+                    page_stats, page_first_row_index_);
     WriteDataPage(page);
   }
 }
@@ -939,13 +988,14 @@ void ColumnWriterImpl::BuildDataPageV2(int64_t definition_levels_rle_size,
                             combined->CopySlice(0, combined->size(), allocator_));
     std::unique_ptr<DataPage> page_ptr(new DataPageV2(
         combined, num_values, null_count, num_values, encoding_, def_levels_byte_length,
-        rep_levels_byte_length, uncompressed_size, pager_->has_compressor(), page_stats));
+        rep_levels_byte_length, uncompressed_size, pager_->has_compressor(), page_stats,
+        page_first_row_index_));
     total_compressed_bytes_ += page_ptr->size() + sizeof(format::PageHeader);
     data_pages_.push_back(std::move(page_ptr));
   } else {
     DataPageV2 page(combined, num_values, null_count, num_values, encoding_,
                     def_levels_byte_length, rep_levels_byte_length, uncompressed_size,
-                    pager_->has_compressor(), page_stats);
+                    pager_->has_compressor(), page_stats, page_first_row_index_);
     WriteDataPage(page);
   }
 }
@@ -1008,6 +1058,60 @@ bool DictionaryDirectWriteSupported(const ::arrow::Array& array) {
   return ::arrow::is_base_binary_like(dict_type.value_type()->id());
 }
 
+template <typename IndexType>
+void RemapIndices(const ArrayData& indices, const std::vector<int32_t>& mapping,
+                  int32_t* out) {
+  using c_type = typename IndexType::c_type;
+  const c_type* values = indices.GetValues<c_type>(1);
+  ::arrow::internal::VisitSetBitRunsVoid(
+      indices.buffers[0], indices.offset, indices.length,
+      [&](int64_t position, int64_t length) {
+        for (int64_t i = position; i < position + length; ++i) {
+          out[i] = mapping[static_cast<size_t>(values[i])];
+        }
+      });
+}
+
+// Rewrite dictionary indices through a lookup table. Null slots are set to 0.
+Result<std::shared_ptr<Array>> RemapDictionaryIndices(const Array& indices,
+                                                      const std::vector<int32_t>& mapping,
+                                                      MemoryPool* pool) {
+  const ArrayData& data = *indices.data();
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> remapped,
+                        ::arrow::AllocateBuffer(data.length * sizeof(int32_t), pool));
+  auto out = reinterpret_cast<int32_t*>(remapped->mutable_data());
+  std::memset(out, 0, data.length * sizeof(int32_t));
+  switch (indices.type_id()) {
+    case ::arrow::Type::UINT8:
+    case ::arrow::Type::INT8:
+      RemapIndices<::arrow::UInt8Type>(data, mapping, out);
+      break;
+    case ::arrow::Type::UINT16:
+    case ::arrow::Type::INT16:
+      RemapIndices<::arrow::UInt16Type>(data, mapping, out);
+      break;
+    case ::arrow::Type::UINT32:
+    case ::arrow::Type::INT32:
+      RemapIndices<::arrow::UInt32Type>(data, mapping, out);
+      break;
+    case ::arrow::Type::UINT64:
+    case ::arrow::Type::INT64:
+      RemapIndices<::arrow::UInt64Type>(data, mapping, out);
+      break;
+    default:
+      return Status::TypeError("Invalid dictionary index type: ", *indices.type());
+  }
+  std::shared_ptr<Buffer> null_bitmap;
+  if (data.MayHaveNulls()) {
+    ARROW_ASSIGN_OR_RAISE(null_bitmap,
+                          ::arrow::internal::CopyBitmap(pool, data.buffers[0]->data(),
+                                                        data.offset, data.length));
+  }
+  return ::arrow::MakeArray(ArrayData::Make(::arrow::int32(), data.length,
+                                            {std::move(null_bitmap), std::move(remapped)},
+                                            data.null_count));
+}
+
 Status ConvertDictionaryToDense(const ::arrow::Array& array, MemoryPool* pool,
                                 std::shared_ptr<::arrow::Array>* out) {
   const ::arrow::DictionaryType& dict_type =
@@ -1025,6 +1129,74 @@ static inline bool IsDictionaryEncoding(Encoding::type encoding) {
   return encoding == Encoding::PLAIN_DICTIONARY;
 }
 
+namespace {
+
+// Values are hashed into Bloom filters in batches of this size, bounding the
+// scratch space on the stack
+constexpr int kBloomFilterHashBatchSize = 256;
+
+template <typename T>
+void HashBloomFilterBatch(const BloomFilter& bloom_filter, const ColumnDescriptor*,
+                          const T* values, int num_values, uint64_t* hashes) {
+  bloom_filter.Hashes(values, num_values, hashes);
+}
+
+void HashBloomFilterBatch(const BloomFilter& bloom_filter, const ColumnDescriptor* descr,
+                          const FLBA* values, int num_values, uint64_t* hashes) {
+  bloom_filter.Hashes(values, static_cast<uint32_t>(descr->type_length()), num_values,
+                      hashes);
+}
+
+// BOOLEAN columns don't have Bloom filters
+void HashBloomFilterBatch(const BloomFilter&, const ColumnDescriptor*, const bool*, int,
+                          uint64_t*) {
+  DCHECK(false);
+}
+
+template <typename T>
+void UpdateBloomFilter(BloomFilter* bloom_filter, const ColumnDescriptor* descr,
+                       const T* values, int64_t num_values) {
+  uint64_t hashes[kBloomFilterHashBatchSize];
+  for (int64_t i = 0; i < num_values; i += kBloomFilterHashBatchSize) {
+    const int batch_size = static_cast<int>(
+        std::min<int64_t>(kBloomFilterHashBatchSize, num_values - i));
+    HashBloomFilterBatch(*bloom_filter, descr, values + i, batch_size, hashes);
+    bloom_filter->InsertHashes(hashes, batch_size);
+  }
+}
+
+template <typename ArrayType>
+void UpdateBloomFilterWithBinary(BloomFilter* bloom_filter, const ArrayType& array) {
+  ByteArray values[kBloomFilterHashBatchSize];
+  uint64_t hashes[kBloomFilterHashBatchSize];
+  int batch_size = 0;
+  auto flush = [&]() {
+    bloom_filter->Hashes(values, batch_size, hashes);
+    bloom_filter->InsertHashes(hashes, batch_size);
+    batch_size = 0;
+  };
+  for (int64_t i = 0; i < array.length(); ++i) {
+    if (array.IsNull(i)) continue;
+    values[batch_size++] = ByteArray(array.GetView(i));
+    if (batch_size == kBloomFilterHashBatchSize) flush();
+  }
+  if (batch_size > 0) flush();
+}
+
+// Insert the non-null values of a binary-like array into a Bloom filter
+void UpdateBloomFilterWithBinary(BloomFilter* bloom_filter, const ::arrow::Array& array) {
+  if (::arrow::is_binary_like(array.type_id())) {
+    UpdateBloomFilterWithBinary(bloom_filter,
+                                checked_cast<const ::arrow::BinaryArray&>(array));
+  } else {
+    DCHECK(::arrow::is_large_binary_like(array.type_id()));
+    UpdateBloomFilterWithBinary(bloom_filter,
+                                checked_cast<const ::arrow::LargeBinaryArray&>(array));
+  }
+}
+
+}  // namespace
+
 template <typename DType>
 class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<DType> {
  public:
@@ -1032,9 +1204,11 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
 
   TypedColumnWriterImpl(ColumnChunkMetaDataBuilder* metadata,
                         std::unique_ptr<PageWriter> pager, const bool use_dictionary,
-                        Encoding::type encoding, const WriterProperties* properties)
+                        Encoding::type encoding, const WriterProperties* properties,
+                        BloomFilter* bloom_filter)
       : ColumnWriterImpl(metadata, std::move(pager), use_dictionary, encoding,
-                         properties) {
+                         properties),
+        bloom_filter_(bloom_filter) {
     current_encoder_ = MakeEncoder(DType::type_num, encoding, use_dictionary, descr_,
                                    properties->memory_pool());
     // We have to dynamic_cast as some compilers don't want to static_cast
@@ -1218,12 +1392,27 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   DictEncoder<DType>* current_dict_encoder_;
   std::shared_ptr<TypedStats> page_statistics_;
   std::shared_ptr<TypedStats> chunk_statistics_;
+  // Not owned, null unless the column has a Bloom filter
+  BloomFilter* bloom_filter_;
 
   // If writing a sequence of ::arrow::DictionaryArray to the writer, we keep the
   // dictionary passed to DictEncoder<T>::PutDictionary so we can check
-  // subsequent array chunks to see either if materialization is required (in
-  // which case we call back to the dense write path)
+  // subsequent array chunks to see whether their indices need remapping
   std::shared_ptr<::arrow::Array> preserved_dictionary_;
+  // Encoder dictionary index of each value of preserved_dictionary_, empty if
+  // its indices can be written unchanged
+  std::vector<int32_t> dictionary_mapping_;
+
+  void SetDictionaryMapping(const ::arrow::Array& dictionary) {
+    current_dict_encoder_->MapDictionary(dictionary, &dictionary_mapping_);
+    bool identity = true;
+    for (size_t i = 0; i < dictionary_mapping_.size() && identity; ++i) {
+      identity = dictionary_mapping_[i] == static_cast<int32_t>(i);
+    }
+    if (identity) {
+      dictionary_mapping_.clear();
+    }
+  }
 
   int64_t WriteLevels(int64_t num_values, const int16_t* def_levels,
                       const int16_t* rep_levels) {
@@ -1397,6 +1586,9 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      UpdateBloomFilter(bloom_filter_, descr_, values, num_values);
+    }
   }
 
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
@@ -1413,6 +1605,17 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset,
                                      num_spaced_values, num_values, num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      if (num_values != num_spaced_values) {
+        ::arrow::internal::VisitSetBitRunsVoid(
+            valid_bits, valid_bits_offset, num_spaced_values,
+            [&](int64_t position, int64_t length) {
+              UpdateBloomFilter(bloom_filter_, descr_, values + position, length);
+            });
+      } else {
+        UpdateBloomFilter(bloom_filter_, descr_, values, num_values);
+      }
+    }
   }
 };
 
@@ -1481,19 +1684,7 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(
     value_offset += batch_num_spaced_values;
   };
 
-  // Handle seeing dictionary for the first time
-  if (!preserved_dictionary_) {
-    // It's a new dictionary. Call PutDictionary and keep track of it
-    PARQUET_CATCH_NOT_OK(dict_encoder->PutDictionary(*dictionary));
-
-    // If there were duplicate value in the dictionary, the encoder's memo table
-    // will be out of sync with the indices in the Arrow array.
-    // The easiest solution for this uncommon case is to fallback to plain encoding.
-    if (dict_encoder->num_entries() != dictionary->length()) {
-      PARQUET_CATCH_NOT_OK(FallbackToPlainEncoding());
-      return WriteDense();
-    }
-
+  auto UpdateStatistics = [&] {
     if (page_statistics_ != nullptr) {
       // TODO(PARQUET-2068) This approach may make two copies.  First, a copy of the
       // indices array to a (hopefully smaller) referenced indices array.  Second, a copy
@@ -1521,11 +1712,41 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(
       page_statistics_->IncrementNumValues(non_null_count);
       page_statistics_->Update(*referenced_dictionary, /*update_counts=*/false);
     }
+    if (bloom_filter_ != nullptr) {
+      // All values of the dictionary, referenced or not, which covers the
+      // following chunks as long as they share it
+      UpdateBloomFilterWithBinary(bloom_filter_, *dictionary);
+    }
+  };
+
+  // Handle seeing dictionary for the first time
+  if (!preserved_dictionary_) {
+    // It's a new dictionary. Call PutDictionary and keep track of it
+    PARQUET_CATCH_NOT_OK(dict_encoder->PutDictionary(*dictionary));
+
+    // If there were duplicate value in the dictionary, the encoder's memo table
+    // will be out of sync with the indices in the Arrow array, which then have
+    // to be remapped.
+    if (dict_encoder->num_entries() != dictionary->length()) {
+      PARQUET_CATCH_NOT_OK(SetDictionaryMapping(*dictionary));
+    }
+    UpdateStatistics();
     preserved_dictionary_ = dictionary;
   } else if (!dictionary->Equals(*preserved_dictionary_)) {
-    // Dictionary has changed
-    PARQUET_CATCH_NOT_OK(FallbackToPlainEncoding());
-    return WriteDense();
+    // Dictionary has changed. Rather than re-hashing the dense values, add the
+    // new dictionary values to the encoder and remap the indices.
+    PARQUET_CATCH_NOT_OK(SetDictionaryMapping(*dictionary));
+    PARQUET_CATCH_NOT_OK(CheckDictionarySizeLimit());
+    if (!IsDictionaryEncoding(current_encoder_->encoding())) {
+      return WriteDense();
+    }
+    UpdateStatistics();
+    preserved_dictionary_ = dictionary;
+  }
+
+  if (!dictionary_mapping_.empty()) {
+    PARQUET_ASSIGN_OR_THROW(
+        indices, RemapDictionaryIndices(*indices, dictionary_mapping_, ctx->memory_pool));
   }
 
   PARQUET_CATCH_NOT_OK(
@@ -1938,6 +2159,9 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(
       page_statistics_->IncrementNullCount(batch_size - non_null);
       page_statistics_->IncrementNumValues(non_null);
     }
+    if (bloom_filter_ != nullptr) {
+      UpdateBloomFilterWithBinary(bloom_filter_, *data_slice);
+    }
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
@@ -2061,7 +2285,8 @@ Status TypedColumnWriterImpl<FLBAType>::WriteArrowDense(
 
 std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* metadata,
                                                  std::unique_ptr<PageWriter> pager,
-                                                 const WriterProperties* properties) {
+                                                 const WriterProperties* properties,
+                                                 BloomFilter* bloom_filter) {
   const ColumnDescriptor* descr = metadata->descr();
   const bool use_dictionary = properties->dictionary_enabled(descr->path()) &&
                               descr->physical_type() != Type::BOOLEAN;
@@ -2072,28 +2297,36 @@ std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* met
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedColumnWriterImpl<BooleanType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::INT32:
       return std::make_shared<TypedColumnWriterImpl<Int32Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::INT64:
       return std::make_shared<TypedColumnWriterImpl<Int64Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::INT96:
       return std::make_shared<TypedColumnWriterImpl<Int96Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::FLOAT:
       return std::make_shared<TypedColumnWriterImpl<FloatType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::DOUBLE:
       return std::make_shared<TypedColumnWriterImpl<DoubleType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::BYTE_ARRAY:
       return std::make_shared<TypedColumnWriterImpl<ByteArrayType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::FIXED_LEN_BYTE_ARRAY:
       return std::make_shared<TypedColumnWriterImpl<FLBAType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     default:
       ParquetException::NYI("type reader not implemented");
   }
@@ -554,6 +554,8 @@ class DictEncoderImpl : public EncoderImpl, virtual public DictEncoder<DType> {
 
   void Put(const ::arrow::Array& values) override;
   void PutDictionary(const ::arrow::Array& values) override;
+  void MapDictionary(const ::arrow::Array& values,
+                     std::vector<int32_t>* memo_indices) override;
 
   template <typename ArrowType, typename T = typename ArrowType::c_type>
   void PutIndicesTyped(const ::arrow::Array& data) {
@@ -642,6 +644,26 @@ class DictEncoderImpl : public EncoderImpl, virtual public DictEncoder<DType> {
     }
   }
 
+  template <typename ArrayType>
+  void MapBinaryDictionaryArray(const ArrayType& array,
+                                std::vector<int32_t>* memo_indices) {
+    DCHECK_EQ(array.null_count(), 0);
+    auto on_found = [](int32_t memo_index) {};
+    for (int64_t i = 0; i < array.length(); i++) {
+      auto v = array.GetView(i);
+      if (ARROW_PREDICT_FALSE(v.size() > kMaxByteArraySize)) {
+        throw ParquetException("Parquet cannot store strings with size 2GB or more");
+      }
+      auto on_not_found = [&](int32_t memo_index) {
+        dict_encoded_size_ += static_cast<int>(v.size() + sizeof(uint32_t));
+      };
+      PARQUET_THROW_NOT_OK(memo_table_.GetOrInsert(v.data(),
+                                                   static_cast<int32_t>(v.size()),
+                                                   on_found, on_not_found,
+                                                   &(*memo_indices)[i]));
+    }
+  }
+
   /// The number of bytes needed to encode the dictionary.
   int dict_encoded_size_;
 
@@ -843,6 +865,71 @@ void DictEncoderImpl<ByteArrayType>::PutDictionary(const ::arrow::Array& values)
   }
 }
 
+template <>
+void DictEncoderImpl<Int96Type>::MapDictionary(const ::arrow::Array& values,
+                                               std::vector<int32_t>* memo_indices) {
+  ParquetException::NYI("Direct put to Int96");
+}
+
+template <typename DType>
+void DictEncoderImpl<DType>::MapDictionary(const ::arrow::Array& values,
+                                           std::vector<int32_t>* memo_indices) {
+  if (values.null_count() > 0) {
+    throw ParquetException("Inserted dictionary cannot contain nulls");
+  }
+
+  using ArrayType = typename ::arrow::CTypeTraits<typename DType::c_type>::ArrayType;
+  const auto& data = checked_cast<const ArrayType&>(values);
+
+  auto on_found = [](int32_t memo_index) {};
+  auto on_not_found = [this](int32_t memo_index) {
+    dict_encoded_size_ += static_cast<int>(sizeof(T));
+  };
+  memo_indices->resize(data.length());
+  for (int64_t i = 0; i < data.length(); i++) {
+    PARQUET_THROW_NOT_OK(memo_table_.GetOrInsert(data.Value(i), on_found, on_not_found,
+                                                 &(*memo_indices)[i]));
+  }
+}
+
+template <>
+void DictEncoderImpl<FLBAType>::MapDictionary(const ::arrow::Array& values,
+                                              std::vector<int32_t>* memo_indices) {
+  AssertFixedSizeBinary(values, type_length_);
+  if (values.null_count() > 0) {
+    throw ParquetException("Inserted dictionary cannot contain nulls");
+  }
+
+  const auto& data = checked_cast<const ::arrow::FixedSizeBinaryArray&>(values);
+
+  auto on_found = [](int32_t memo_index) {};
+  auto on_not_found = [this](int32_t memo_index) { dict_encoded_size_ += type_length_; };
+  memo_indices->resize(data.length());
+  for (int64_t i = 0; i < data.length(); i++) {
+    PARQUET_THROW_NOT_OK(memo_table_.GetOrInsert(data.Value(i), type_length_, on_found,
+                                                 on_not_found, &(*memo_indices)[i]));
+  }
+}
+
+template <>
+void DictEncoderImpl<ByteArrayType>::MapDictionary(const ::arrow::Array& values,
+                                                   std::vector<int32_t>* memo_indices) {
+  AssertBaseBinary(values);
+  if (values.null_count() > 0) {
+    throw ParquetException("Inserted dictionary cannot contain nulls");
+  }
+
+  memo_indices->resize(values.length());
+  if (::arrow::is_binary_like(values.type_id())) {
+    MapBinaryDictionaryArray(checked_cast<const ::arrow::BinaryArray&>(values),
+                             memo_indices);
+  } else {
+    DCHECK(::arrow::is_large_binary_like(values.type_id()));
+    MapBinaryDictionaryArray(checked_cast<const ::arrow::LargeBinaryArray&>(values),
+                             memo_indices);
+  }
+}
+
 // ----------------------------------------------------------------------
 // ByteStreamSplitEncoder<T> implementations
 
@@ -878,6 +965,8 @@ class ByteStreamSplitEncoder : public EncoderImpl, virtual public TypedEncoder<D
 
   ::arrow::BufferBuilder sink_;
   int64_t num_values_in_buffer_;
+  // Number of byte streams
+  const int byte_width_;
 };
 
 template <typename DType>
@@ -885,7 +974,9 @@ ByteStreamSplitEncoder<DType>::ByteStreamSplitEncoder(const ColumnDescriptor* de
                                                       ::arrow::MemoryPool* pool)
     : EncoderImpl(descr, Encoding::BYTE_STREAM_SPLIT, pool),
       sink_{pool},
-      num_values_in_buffer_{0} {}
+      num_values_in_buffer_{0},
+      byte_width_(std::is_same<DType, FLBAType>::value ? descr->type_length()
+                                                       : static_cast<int>(sizeof(T))) {}
 
 template <typename DType>
 int64_t ByteStreamSplitEncoder<DType>::EstimatedDataEncodedSize() {
@@ -898,8 +989,8 @@ std::shared_ptr<Buffer> ByteStreamSplitEncoder<DType>::FlushValues() {
       AllocateBuffer(this->memory_pool(), EstimatedDataEncodedSize());
   uint8_t* output_buffer_raw = output_buffer->mutable_data();
   const uint8_t* raw_values = sink_.data();
-  ::arrow::util::internal::ByteStreamSplitEncode<T>(raw_values, num_values_in_buffer_,
-                                                    output_buffer_raw);
+  ::arrow::util::internal::ByteStreamSplitEncode(
+      raw_values, byte_width_, num_values_in_buffer_, output_buffer_raw);
   sink_.Reset();
   num_values_in_buffer_ = 0;
   return std::move(output_buffer);
@@ -913,6 +1004,28 @@ void ByteStreamSplitEncoder<DType>::Put(const T* buffer, int num_values) {
   }
 }
 
+template <>
+void ByteStreamSplitEncoder<FLBAType>::Put(const FixedLenByteArray* buffer,
+                                           int num_values) {
+  if (num_values > 0) {
+    PARQUET_THROW_NOT_OK(sink_.Reserve(num_values * byte_width_));
+    for (int i = 0; i < num_values; ++i) {
+      sink_.UnsafeAppend(buffer[i].ptr, byte_width_);
+    }
+    num_values_in_buffer_ += num_values;
+  }
+}
+
+template <>
+void ByteStreamSplitEncoder<Int32Type>::Put(const ::arrow::Array& values) {
+  PutImpl<::arrow::Int32Type>(values);
+}
+
+template <>
+void ByteStreamSplitEncoder<Int64Type>::Put(const ::arrow::Array& values) {
+  PutImpl<::arrow::Int64Type>(values);
+}
+
 template <>
 void ByteStreamSplitEncoder<FloatType>::Put(const ::arrow::Array& values) {
   PutImpl<::arrow::FloatType>(values);
@@ -923,6 +1036,32 @@ void ByteStreamSplitEncoder<DoubleType>::Put(const ::arrow::Array& values) {
   PutImpl<::arrow::DoubleType>(values);
 }
 
+template <>
+void ByteStreamSplitEncoder<FLBAType>::Put(const ::arrow::Array& values) {
+  if (values.type_id() != ::arrow::Type::FIXED_SIZE_BINARY) {
+    throw ParquetException("Only FixedSizeBinaryArray and subclasses supported");
+  }
+  const auto& data = checked_cast<const ::arrow::FixedSizeBinaryArray&>(values);
+  if (data.byte_width() != byte_width_) {
+    throw ParquetException("Size mismatch: FixedSizeBinaryArray of width ",
+                           data.byte_width(), " for FIXED_LEN_BYTE_ARRAY of length ",
+                           byte_width_);
+  }
+  if (data.null_count() == 0) {
+    // No nulls, just dump the data
+    PARQUET_THROW_NOT_OK(sink_.Append(data.raw_values(), data.length() * byte_width_));
+    num_values_in_buffer_ += data.length();
+    return;
+  }
+  PARQUET_THROW_NOT_OK(sink_.Reserve((data.length() - data.null_count()) * byte_width_));
+  for (int64_t i = 0; i < data.length(); ++i) {
+    if (data.IsValid(i)) {
+      sink_.UnsafeAppend(data.GetValue(i), byte_width_);
+      ++num_values_in_buffer_;
+    }
+  }
+}
+
 template <typename DType>
 void ByteStreamSplitEncoder<DType>::PutSpaced(const T* src, int num_values,
                                               const uint8_t* valid_bits,
@@ -939,6 +1078,408 @@ void ByteStreamSplitEncoder<DType>::PutSpaced(const T* src, int num_values,
   }
 }
 
+// ----------------------------------------------------------------------
+// DeltaBitPackEncoder
+
+// Bit-pack values of bit_width bits each, least significant bits first: the
+// layout which BitReader::GetBatch unpacks.  The total number of bits must be a
+// multiple of 8, as is the case for whole miniblocks.
+template <typename UT>
+void PackBits(const UT* values, int num_values, int bit_width, uint8_t* out) {
+  uint64_t buffered_values = 0;
+  int buffered_bits = 0;
+  for (int i = 0; i < num_values; ++i) {
+    const uint64_t value = static_cast<uint64_t>(values[i]);
+    buffered_values |= value << buffered_bits;
+    buffered_bits += bit_width;
+    if (buffered_bits >= 64) {
+      buffered_values = bit_util::ToLittleEndian(buffered_values);
+      memcpy(out, &buffered_values, sizeof(uint64_t));
+      out += sizeof(uint64_t);
+      buffered_bits -= 64;
+      // The high bits of value which didn't fit
+      buffered_values = buffered_bits == 0 ? 0 : value >> (bit_width - buffered_bits);
+    }
+  }
+  DCHECK_EQ(buffered_bits % 8, 0);
+  buffered_values = bit_util::ToLittleEndian(buffered_values);
+  memcpy(out, &buffered_values, buffered_bits / 8);
+}
+
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
+  using TypedEncoder<DType>::Put;
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr,
+                               MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool), sink_(pool) {
+    if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
+      throw ParquetException("Delta bit pack encoding should only be for integer data.");
+    }
+    // The page header is only known once all values were put, so leave room for it
+    PARQUET_THROW_NOT_OK(sink_.Advance(kMaxPageHeaderSize));
+  }
+
+  int64_t EstimatedDataEncodedSize() override {
+    return sink_.length() + values_current_block_ * sizeof(T);
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  void Put(const T* buffer, int num_values) override;
+  void Put(const ::arrow::Array& values) override;
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override;
+
+ private:
+  static constexpr uint32_t kValuesPerBlock = 128;
+  static constexpr uint32_t kMiniBlocksPerBlock = 4;
+  static constexpr uint32_t kValuesPerMiniBlock = kValuesPerBlock / kMiniBlocksPerBlock;
+  // Block size, number of miniblocks and value count as ULEB128, first value
+  // as zigzag ULEB128
+  static constexpr int kMaxPageHeaderSize = 3 * 5 + 10;
+
+  void FlushBlock();
+
+  ::arrow::BufferBuilder sink_;
+  uint32_t total_value_count_ = 0;
+  T first_value_ = 0;
+  T current_value_ = 0;
+  uint32_t values_current_block_ = 0;
+  // Deltas of the current block, then their excess over the minimum delta
+  T deltas_[kValuesPerBlock];
+  UT excess_[kValuesPerBlock];
+};
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const T* src, int num_values) {
+  if (num_values == 0) {
+    return;
+  }
+  int idx = 0;
+  if (total_value_count_ == 0) {
+    first_value_ = current_value_ = src[0];
+    idx = 1;
+  }
+  total_value_count_ += num_values;
+  while (idx < num_values) {
+    const T value = src[idx++];
+    // Wrapping subtraction, as the decoder wraps when adding deltas back
+    deltas_[values_current_block_++] =
+        static_cast<T>(static_cast<UT>(value) - static_cast<UT>(current_value_));
+    current_value_ = value;
+    if (values_current_block_ == kValuesPerBlock) {
+      FlushBlock();
+    }
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::FlushBlock() {
+  if (values_current_block_ == 0) {
+    return;
+  }
+  const T min_delta = *std::min_element(deltas_, deltas_ + values_current_block_);
+  const uint32_t num_mini_blocks = static_cast<uint32_t>(
+      bit_util::CeilDiv(values_current_block_, kValuesPerMiniBlock));
+
+  // Unused miniblocks have a zero bit width and no data
+  uint8_t bit_widths[kMiniBlocksPerBlock] = {};
+  int64_t packed_size = 0;
+  for (uint32_t i = 0; i < num_mini_blocks; ++i) {
+    const uint32_t start = i * kValuesPerMiniBlock;
+    const uint32_t end = std::min(start + kValuesPerMiniBlock, values_current_block_);
+    UT excess_bits = 0;
+    for (uint32_t j = start; j < end; ++j) {
+      excess_[j] = static_cast<UT>(deltas_[j]) - static_cast<UT>(min_delta);
+      excess_bits |= excess_[j];
+    }
+    // The last miniblock is padded to its full size
+    std::fill(excess_ + end, excess_ + start + kValuesPerMiniBlock, UT{0});
+    bit_widths[i] = static_cast<uint8_t>(bit_util::NumRequiredBits(excess_bits));
+    packed_size += kValuesPerMiniBlock * bit_widths[i] / 8;
+  }
+
+  uint8_t min_delta_data[10];
+  ::arrow::bit_util::BitWriter min_delta_writer(min_delta_data, sizeof(min_delta_data));
+  min_delta_writer.PutZigZagVlqInt(min_delta);
+  min_delta_writer.Flush();
+
+  PARQUET_THROW_NOT_OK(sink_.Reserve(min_delta_writer.bytes_written() +
+                                     kMiniBlocksPerBlock + packed_size));
+  sink_.UnsafeAppend(min_delta_data, min_delta_writer.bytes_written());
+  sink_.UnsafeAppend(bit_widths, kMiniBlocksPerBlock);
+  for (uint32_t i = 0; i < num_mini_blocks; ++i) {
+    const int64_t mini_block_size = kValuesPerMiniBlock * bit_widths[i] / 8;
+    PackBits(excess_ + i * kValuesPerMiniBlock, kValuesPerMiniBlock, bit_widths[i],
+             sink_.mutable_data() + sink_.length());
+    sink_.UnsafeAdvance(mini_block_size);
+  }
+  values_current_block_ = 0;
+}
+
+template <typename DType>
+std::shared_ptr<Buffer> DeltaBitPackEncoder<DType>::FlushValues() {
+  FlushBlock();
+
+  uint8_t header_data[kMaxPageHeaderSize];
+  ::arrow::bit_util::BitWriter header_writer(header_data, kMaxPageHeaderSize);
+  if (!header_writer.PutVlqInt(kValuesPerBlock) ||
+      !header_writer.PutVlqInt(kMiniBlocksPerBlock) ||
+      !header_writer.PutVlqInt(total_value_count_) ||
+      !header_writer.PutZigZagVlqInt(first_value_)) {
+    throw ParquetException("header writing error");
+  }
+  header_writer.Flush();
+
+  // Write the header right before the data, in the room left for it
+  const int header_size = header_writer.bytes_written();
+  const int64_t offset = kMaxPageHeaderSize - header_size;
+  memcpy(sink_.mutable_data() + offset, header_data, header_size);
+
+  std::shared_ptr<Buffer> buffer;
+  PARQUET_THROW_NOT_OK(sink_.Finish(&buffer));
+  total_value_count_ = 0;
+  first_value_ = current_value_ = 0;
+  PARQUET_THROW_NOT_OK(sink_.Advance(kMaxPageHeaderSize));
+  return SliceBuffer(buffer, offset);
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::PutSpaced(const T* src, int num_values,
+                                           const uint8_t* valid_bits,
+                                           int64_t valid_bits_offset) {
+  if (valid_bits != NULLPTR) {
+    PARQUET_ASSIGN_OR_THROW(auto buffer, ::arrow::AllocateBuffer(num_values * sizeof(T),
+                                                                 this->memory_pool()));
+    T* data = reinterpret_cast<T*>(buffer->mutable_data());
+    int num_valid_values = ::arrow::util::internal::SpacedCompress<T>(
+        src, num_values, valid_bits, valid_bits_offset, data);
+    Put(data, num_valid_values);
+  } else {
+    Put(src, num_values);
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const ::arrow::Array& values) {
+  using ArrowType =
+      typename std::conditional<std::is_same<T, int32_t>::value, ::arrow::Int32Type,
+                                ::arrow::Int64Type>::type;
+  if (values.type_id() != ArrowType::type_id) {
+    throw ParquetException(std::string() + "direct put to " + ArrowType::type_name() +
+                           " from " + values.type()->ToString() + " not supported");
+  }
+  const auto& data = *values.data();
+  if (values.null_count() == 0) {
+    Put(data.GetValues<T>(1), static_cast<int>(data.length));
+  } else {
+    PutSpaced(data.GetValues<T>(1), static_cast<int>(data.length),
+              data.GetValues<uint8_t>(0, 0), data.offset);
+  }
+}
+
+// Call visit on batches of the non-null values of a binary-like array
+template <typename ArrayType, typename VisitBatch>
+void VisitTypedByteArrayBatches(const ArrayType& array, VisitBatch&& visit) {
+  constexpr int kBatchSize = 256;
+  ByteArray batch[kBatchSize];
+  int batch_size = 0;
+  for (int64_t i = 0; i < array.length(); ++i) {
+    if (array.IsNull(i)) continue;
+    const string_view view = array.GetView(i);
+    if (ARROW_PREDICT_FALSE(view.size() > kMaxByteArraySize)) {
+      throw ParquetException("Parquet cannot store strings with size 2GB or more");
+    }
+    batch[batch_size++] = ByteArray(view);
+    if (batch_size == kBatchSize) {
+      visit(batch, batch_size);
+      batch_size = 0;
+    }
+  }
+  if (batch_size > 0) {
+    visit(batch, batch_size);
+  }
+}
+
+template <typename VisitBatch>
+void VisitByteArrayBatches(const ::arrow::Array& values, VisitBatch&& visit) {
+  if (::arrow::is_binary_like(values.type_id())) {
+    VisitTypedByteArrayBatches(checked_cast<const ::arrow::BinaryArray&>(values),
+                               std::forward<VisitBatch>(visit));
+  } else if (::arrow::is_large_binary_like(values.type_id())) {
+    VisitTypedByteArrayBatches(checked_cast<const ::arrow::LargeBinaryArray&>(values),
+                               std::forward<VisitBatch>(visit));
+  } else {
+    throw ParquetException("Only BaseBinaryArray and subclasses supported");
+  }
+}
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY encoder
+
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr,
+                                       MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        sink_(pool),
+        length_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return sink_.length() + length_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    // The lengths, then all values back to back
+    std::shared_ptr<Buffer> lengths = length_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(this->memory_pool(), lengths->size() + sink_.length());
+    memcpy(buffer->mutable_data(), lengths->data(), lengths->size());
+    memcpy(buffer->mutable_data() + lengths->size(), sink_.data(), sink_.length());
+    sink_.Reset();
+    return std::move(buffer);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    int32_t lengths[kLengthBatchSize];
+    int64_t total_length = 0;
+    for (int i = 0; i < num_values; ++i) total_length += src[i].len;
+    PARQUET_THROW_NOT_OK(sink_.Reserve(total_length));
+    for (int start = 0; start < num_values; start += kLengthBatchSize) {
+      const int batch_size = std::min(kLengthBatchSize, num_values - start);
+      for (int i = 0; i < batch_size; ++i) {
+        const ByteArray& value = src[start + i];
+        lengths[i] = static_cast<int32_t>(value.len);
+        sink_.UnsafeAppend(value.ptr, value.len);
+      }
+      length_encoder_.Put(lengths, batch_size);
+    }
+  }
+
+  void Put(const ::arrow::Array& values) override {
+    VisitByteArrayBatches(values, [this](const ByteArray* batch, int batch_size) {
+      Put(batch, batch_size);
+    });
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    if (valid_bits != NULLPTR) {
+      PARQUET_ASSIGN_OR_THROW(
+          auto buffer,
+          ::arrow::AllocateBuffer(num_values * sizeof(ByteArray), this->memory_pool()));
+      auto data = reinterpret_cast<ByteArray*>(buffer->mutable_data());
+      int num_valid_values = ::arrow::util::internal::SpacedCompress<ByteArray>(
+          src, num_values, valid_bits, valid_bits_offset, data);
+      Put(data, num_valid_values);
+    } else {
+      Put(src, num_values);
+    }
+  }
+
+ private:
+  static constexpr int kLengthBatchSize = 256;
+
+  ::arrow::BufferBuilder sink_;
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+};
+
+// ----------------------------------------------------------------------
+// DELTA_BYTE_ARRAY encoder
+
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr,
+                                 MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    // The prefix lengths, then the suffixes as DELTA_LENGTH_BYTE_ARRAY
+    std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer = AllocateBuffer(
+        this->memory_pool(), prefix_lengths->size() + suffixes->size());
+    memcpy(buffer->mutable_data(), prefix_lengths->data(), prefix_lengths->size());
+    memcpy(buffer->mutable_data() + prefix_lengths->size(), suffixes->data(),
+           suffixes->size());
+    // Each page starts from an empty previous value
+    last_value_.clear();
+    return std::move(buffer);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    if (num_values == 0) {
+      return;
+    }
+    int32_t prefix_lengths[kBatchSize];
+    ByteArray suffixes[kBatchSize];
+    string_view previous = last_value_;
+    for (int start = 0; start < num_values; start += kBatchSize) {
+      const int batch_size = std::min(kBatchSize, num_values - start);
+      for (int i = 0; i < batch_size; ++i) {
+        const ByteArray& value = src[start + i];
+        const string_view view(reinterpret_cast<const char*>(value.ptr), value.len);
+        const size_t max_prefix = std::min(previous.size(), view.size());
+        size_t prefix = 0;
+        while (prefix < max_prefix && previous[prefix] == view[prefix]) ++prefix;
+        prefix_lengths[i] = static_cast<int32_t>(prefix);
+        suffixes[i] = ByteArray(static_cast<uint32_t>(value.len - prefix),
+                                value.ptr + prefix);
+        previous = view;
+      }
+      prefix_length_encoder_.Put(prefix_lengths, batch_size);
+      suffix_encoder_.Put(suffixes, batch_size);
+    }
+    // The values may not outlive this call
+    last_value_.assign(previous.data(), previous.size());
+  }
+
+  void Put(const ::arrow::Array& values) override {
+    VisitByteArrayBatches(values, [this](const ByteArray* batch, int batch_size) {
+      Put(batch, batch_size);
+    });
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    if (valid_bits != NULLPTR) {
+      PARQUET_ASSIGN_OR_THROW(
+          auto buffer,
+          ::arrow::AllocateBuffer(num_values * sizeof(ByteArray), this->memory_pool()));
+      auto data = reinterpret_cast<ByteArray*>(buffer->mutable_data());
+      int num_valid_values = ::arrow::util::internal::SpacedCompress<ByteArray>(
+          src, num_values, valid_bits, valid_bits_offset, data);
+      Put(data, num_valid_values);
+    } else {
+      Put(src, num_values);
+    }
+  }
+
+ private:
+  static constexpr int kBatchSize = 256;
+
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  std::string last_value_;
+};
+
 class DecoderImpl : virtual public Decoder {
  public:
   void SetData(int num_values, const uint8_t* data, int len) override {
@@ -1264,6 +1805,13 @@ struct ArrowBinaryHelper {
 
   Status AppendNull() { return builder->AppendNull(); }
 
+  // Append a run of values given as offsets into contiguous data
+  Status AppendValues(const int32_t* offsets, const uint8_t* data, int64_t length,
+                      const uint8_t* valid_bits, int64_t valid_bits_offset) {
+    chunk_space_remaining -= offsets[length] - offsets[0];
+    return builder->AppendValues(offsets, data, length, valid_bits, valid_bits_offset);
+  }
+
   typename EncodingTraits<ByteArrayType>::Accumulator* out;
   ::arrow::BinaryBuilder* builder;
   int64_t chunk_space_remaining;
@@ -1370,6 +1918,28 @@ class PlainByteArrayDecoder : public PlainDecoder<ByteArrayType>,
     ArrowBinaryHelper helper(out);
     int values_decoded = 0;
 
+    // First pass: validate the lengths of the non-null values.  If they all fit
+    // in the current chunk, the data is reserved exactly and copied in a second
+    // pass without any per-value checks.
+    int64_t total_length = 0;
+    RETURN_NOT_OK(ValidateLengths(num_values - null_count, &total_length));
+    if (helper.CanFit(total_length)) {
+      RETURN_NOT_OK(helper.builder->Reserve(num_values));
+      RETURN_NOT_OK(helper.builder->ReserveData(total_length));
+      const int values_to_decode = num_values - null_count;
+      auto append_valid = [&]() {
+        const auto value_len = ::arrow::util::SafeLoadAs<int32_t>(data_);
+        helper.UnsafeAppend(data_ + 4, value_len);
+        data_ += value_len + 4;
+      };
+      VisitNullBitmapInline(valid_bits, valid_bits_offset, num_values, null_count,
+                            append_valid, [&]() { helper.UnsafeAppendNull(); });
+      len_ -= static_cast<int>(total_length + 4 * values_to_decode);
+      num_values_ -= values_to_decode;
+      *out_values_decoded = values_to_decode;
+      return Status::OK();
+    }
+
     RETURN_NOT_OK(helper.builder->Reserve(num_values));
     RETURN_NOT_OK(helper.builder->ReserveData(
         std::min<int64_t>(len_, helper.chunk_space_remaining)));
@@ -1414,6 +1984,32 @@ class PlainByteArrayDecoder : public PlainDecoder<ByteArrayType>,
     return Status::OK();
   }
 
+  // Check that the next |num_values| length-prefixed values are well formed and
+  // lie within the page, and compute their total length (excluding prefixes).
+  Status ValidateLengths(int num_values, int64_t* total_length) const {
+    const uint8_t* data = data_;
+    int64_t remaining = len_;
+    int64_t length = 0;
+    for (int i = 0; i < num_values; ++i) {
+      if (ARROW_PREDICT_FALSE(remaining < 4)) {
+        ParquetException::EofException();
+      }
+      const auto value_len = ::arrow::util::SafeLoadAs<int32_t>(data);
+      if (ARROW_PREDICT_FALSE(value_len < 0 || value_len > INT32_MAX - 4)) {
+        return Status::Invalid("Invalid or corrupted value_len '", value_len, "'");
+      }
+      const int64_t increment = static_cast<int64_t>(value_len) + 4;
+      if (ARROW_PREDICT_FALSE(remaining < increment)) {
+        ParquetException::EofException();
+      }
+      data += increment;
+      remaining -= increment;
+      length += value_len;
+    }
+    *total_length = length;
+    return Status::OK();
+  }
+
   template <typename BuilderType>
   Status DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                      int64_t valid_bits_offset, BuilderType* builder,
@@ -1458,6 +2054,21 @@ class PlainFLBADecoder : public PlainDecoder<FLBAType>, virtual public FLBADecod
 // ----------------------------------------------------------------------
 // Dictionary encoding and decoding
 
+// Append dictionary indices to the Dictionary32Builder for the physical type
+template <typename DType>
+void AppendDictIndices(::arrow::ArrayBuilder* builder, const int32_t* indices,
+                       int64_t length, const uint8_t* valid_bytes = NULLPTR) {
+  auto dict_builder =
+      checked_cast<typename EncodingTraits<DType>::DictAccumulator*>(builder);
+  PARQUET_THROW_NOT_OK(dict_builder->AppendIndices(indices, length, valid_bytes));
+}
+
+template <>
+void AppendDictIndices<Int96Type>(::arrow::ArrayBuilder* builder, const int32_t* indices,
+                                  int64_t length, const uint8_t* valid_bytes) {
+  ParquetException::NYI("Dictionary indices for INT96");
+}
+
 template <typename Type>
 class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
  public:
@@ -1553,9 +2164,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
         valid_bits, valid_bits_offset, num_values, null_count,
         [&]() { valid_bytes[i++] = 1; }, [&]() { ++i; });
 
-    auto binary_builder = checked_cast<::arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(
-        binary_builder->AppendIndices(indices_buffer, num_values, valid_bytes.data()));
+    AppendDictIndices<Type>(builder, indices_buffer, num_values, valid_bytes.data());
     num_values_ -= num_values - null_count;
     return num_values - null_count;
   }
@@ -1574,8 +2183,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     if (num_values != idx_decoder_.GetBatch(indices_buffer, num_values)) {
       ParquetException::EofException();
     }
-    auto binary_builder = checked_cast<::arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(binary_builder->AppendIndices(indices_buffer, num_values));
+    AppendDictIndices<Type>(builder, indices_buffer, num_values);
     num_values_ -= num_values;
     return num_values;
   }
@@ -1626,7 +2234,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
   std::shared_ptr<ResizableBuffer> byte_array_offsets_;
 
   // Reusable buffer for decoding dictionary indices to be appended to a
-  // BinaryDictionary32Builder
+  // Dictionary32Builder
   std::shared_ptr<ResizableBuffer> indices_scratch_space_;
 
   ::arrow::util::RleDecoder idx_decoder_;
@@ -1835,7 +2443,29 @@ int DictDecoderImpl<Type>::DecodeArrow(
 
 template <typename Type>
 void DictDecoderImpl<Type>::InsertDictionary(::arrow::ArrayBuilder* builder) {
-  ParquetException::NYI("InsertDictionary only implemented for BYTE_ARRAY types");
+  using ArrowType = typename EncodingTraits<Type>::ArrowType;
+  auto dict_builder =
+      checked_cast<typename EncodingTraits<Type>::DictAccumulator*>(builder);
+
+  // Make a primitive array referencing the internal dictionary data
+  ::arrow::NumericArray<ArrowType> arr(dictionary_length_, dictionary_);
+  PARQUET_THROW_NOT_OK(dict_builder->InsertMemoValues(arr));
+}
+
+template <>
+void DictDecoderImpl<Int96Type>::InsertDictionary(::arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("InsertDictionary not implemented for INT96 types");
+}
+
+template <>
+void DictDecoderImpl<FLBAType>::InsertDictionary(::arrow::ArrayBuilder* builder) {
+  auto flba_builder =
+      checked_cast<::arrow::Dictionary32Builder<::arrow::FixedSizeBinaryType>*>(builder);
+
+  // Make a FixedSizeBinaryArray referencing the contiguous dictionary data
+  ::arrow::FixedSizeBinaryArray arr(::arrow::fixed_size_binary(descr_->type_length()),
+                                    dictionary_length_, byte_array_data_);
+  PARQUET_THROW_NOT_OK(flba_builder->InsertMemoValues(arr));
 }
 
 template <>
@@ -1894,6 +2524,8 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
     int values_decoded = 0;
     int num_indices = 0;
     int pos_indices = 0;
+    // Whether the values of the current batch of indices have been reserved
+    bool batch_reserved = false;
 
     auto visit_valid = [&](int64_t position) -> Status {
       if (num_indices == pos_indices) {
@@ -1905,23 +2537,33 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
           return Status::Invalid("Invalid number of indices: ", num_indices);
         }
         pos_indices = 0;
+        int64_t total_length = 0;
+        RETURN_NOT_OK(GatherLengths(indices, num_indices, &total_length));
+        batch_reserved = helper.CanFit(total_length);
+        if (ARROW_PREDICT_TRUE(batch_reserved)) {
+          RETURN_NOT_OK(helper.builder->ReserveData(total_length));
+        }
       }
-      const auto index = indices[pos_indices++];
-      RETURN_NOT_OK(IndexInBounds(index));
-      const auto& val = dict_values[index];
-      if (ARROW_PREDICT_FALSE(!helper.CanFit(val.len))) {
-        RETURN_NOT_OK(helper.PushChunk());
+      const auto& val = dict_values[indices[pos_indices++]];
+      if (ARROW_PREDICT_FALSE(!batch_reserved)) {
+        if (ARROW_PREDICT_FALSE(!helper.CanFit(val.len))) {
+          RETURN_NOT_OK(helper.PushChunk());
+          RETURN_NOT_OK(helper.builder->Reserve(num_values - position));
+        }
+        RETURN_NOT_OK(helper.builder->ReserveData(val.len));
       }
-      RETURN_NOT_OK(helper.Append(val.ptr, static_cast<int32_t>(val.len)));
+      helper.UnsafeAppend(val.ptr, static_cast<int32_t>(val.len));
       ++values_decoded;
       return Status::OK();
     };
 
     auto visit_null = [&]() -> Status {
-      RETURN_NOT_OK(helper.AppendNull());
+      helper.UnsafeAppendNull();
       return Status::OK();
     };
 
+    RETURN_NOT_OK(helper.builder->Reserve(num_values));
+
     ::arrow::internal::BitBlockCounter bit_blocks(valid_bits, valid_bits_offset,
                                                   num_values);
     int64_t position = 0;
@@ -1964,14 +2606,24 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
       int32_t batch_size = std::min<int32_t>(kBufferSize, num_values - values_decoded);
       int num_indices = idx_decoder_.GetBatch(indices, batch_size);
       if (num_indices == 0) ParquetException::EofException();
-      for (int i = 0; i < num_indices; ++i) {
-        auto idx = indices[i];
-        RETURN_NOT_OK(IndexInBounds(idx));
-        const auto& val = dict_values[idx];
-        if (ARROW_PREDICT_FALSE(!helper.CanFit(val.len))) {
-          RETURN_NOT_OK(helper.PushChunk());
+      int64_t total_length = 0;
+      RETURN_NOT_OK(GatherLengths(indices, num_indices, &total_length));
+      if (ARROW_PREDICT_TRUE(helper.CanFit(total_length))) {
+        // The output size is known, so copy the whole batch without checks
+        RETURN_NOT_OK(helper.builder->Reserve(num_indices));
+        RETURN_NOT_OK(helper.builder->ReserveData(total_length));
+        for (int i = 0; i < num_indices; ++i) {
+          const auto& val = dict_values[indices[i]];
+          helper.UnsafeAppend(val.ptr, static_cast<int32_t>(val.len));
+        }
+      } else {
+        for (int i = 0; i < num_indices; ++i) {
+          const auto& val = dict_values[indices[i]];
+          if (ARROW_PREDICT_FALSE(!helper.CanFit(val.len))) {
+            RETURN_NOT_OK(helper.PushChunk());
+          }
+          RETURN_NOT_OK(helper.Append(val.ptr, static_cast<int32_t>(val.len)));
         }
-        RETURN_NOT_OK(helper.Append(val.ptr, static_cast<int32_t>(val.len)));
       }
       values_decoded += num_indices;
     }
@@ -1979,6 +2631,28 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
     return Status::OK();
   }
 
+  // Check that all |indices| are within the dictionary and compute the total
+  // length of the values they refer to.
+  Status GatherLengths(const int32_t* indices, int num_indices, int64_t* total_length) {
+    auto dict_values = reinterpret_cast<const ByteArray*>(dictionary_->data());
+    int32_t min_index = 0;
+    int32_t max_index = 0;
+    for (int i = 0; i < num_indices; ++i) {
+      min_index = std::min(min_index, indices[i]);
+      max_index = std::max(max_index, indices[i]);
+    }
+    if (num_indices > 0) {
+      RETURN_NOT_OK(IndexInBounds(min_index));
+      RETURN_NOT_OK(IndexInBounds(max_index));
+    }
+    int64_t length = 0;
+    for (int i = 0; i < num_indices; ++i) {
+      length += dict_values[indices[i]].len;
+    }
+    *total_length = length;
+    return Status::OK();
+  }
+
   template <typename BuilderType>
   Status DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                      int64_t valid_bits_offset, BuilderType* builder,
@@ -2319,7 +2993,10 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    int result = 0;
+    PARQUET_THROW_NOT_OK(DecodeArrowDense(num_values, null_count, valid_bits,
+                                          valid_bits_offset, out, &result));
+    return result;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
@@ -2329,6 +3006,54 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
   }
 
  private:
+  Status DecodeArrowDense(int num_values, int null_count, const uint8_t* valid_bits,
+                          int64_t valid_bits_offset,
+                          typename EncodingTraits<ByteArrayType>::Accumulator* out,
+                          int* out_num_values) {
+    ArrowBinaryHelper helper(out);
+
+    std::vector<ByteArray> values(num_values - null_count);
+    const int num_valid_values = Decode(values.data(), num_values - null_count);
+    if (ARROW_PREDICT_FALSE(num_valid_values != num_values - null_count)) {
+      ParquetException::EofException();
+    }
+
+    // The decoded values are contiguous in buffered_data_, so when they fit in the
+    // current chunk they are appended in one call, with nulls as empty slots.
+    std::vector<int32_t> offsets(num_values + 1);
+    int value_idx = 0;
+    int32_t data_size = 0;
+    int i = 0;
+    offsets[0] = 0;
+    VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() {
+          data_size += static_cast<int32_t>(values[value_idx++].len);
+          offsets[++i] = data_size;
+        },
+        [&]() { offsets[++i] = data_size; });
+    if (helper.CanFit(data_size)) {
+      RETURN_NOT_OK(helper.AppendValues(offsets.data(), buffered_data_->data(),
+                                        num_values, valid_bits, valid_bits_offset));
+      *out_num_values = num_valid_values;
+      return Status::OK();
+    }
+
+    value_idx = 0;
+    RETURN_NOT_OK(VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() {
+          const auto& val = values[value_idx++];
+          if (ARROW_PREDICT_FALSE(!helper.CanFit(val.len))) {
+            RETURN_NOT_OK(helper.PushChunk());
+          }
+          return helper.Append(val.ptr, static_cast<int32_t>(val.len));
+        },
+        [&]() { return helper.AppendNull(); }));
+    *out_num_values = num_valid_values;
+    return Status::OK();
+  }
+
   // Decode all the encoded lengths. The decoder_ will be at the start of the encoded data
   // after that.
   void DecodeLengths() {
@@ -2637,9 +3362,62 @@ template <typename DType>
 int ByteStreamSplitDecoder<DType>::DecodeArrow(
     int num_values, int null_count, const uint8_t* valid_bits, int64_t valid_bits_offset,
     typename EncodingTraits<DType>::DictAccumulator* builder) {
-  ParquetException::NYI("DecodeArrow for ByteStreamSplitDecoder");
+  constexpr int value_size = static_cast<int>(kNumStreams);
+  int values_decoded = num_values - null_count;
+  if (ARROW_PREDICT_FALSE(len_ < value_size * values_decoded)) {
+    ParquetException::EofException();
+  }
+
+  PARQUET_THROW_NOT_OK(builder->Reserve(num_values));
+
+  const int num_decoded_previously = num_values_in_buffer_ - num_values_;
+  T* decode_out = EnsureDecodeBuffer(values_decoded);
+  ::arrow::util::internal::ByteStreamSplitDecode<T>(data_ + num_decoded_previously,
+                                                    values_decoded, num_values_in_buffer_,
+                                                    decode_out);
+  int offset = 0;
+  VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() {
+        PARQUET_THROW_NOT_OK(builder->Append(decode_out[offset]));
+        ++offset;
+      },
+      [&]() { PARQUET_THROW_NOT_OK(builder->AppendNull()); });
+
+  num_values_ -= values_decoded;
+  len_ -= sizeof(T) * values_decoded;
+  return values_decoded;
 }
 
+// The byte streams of a FIXED_LEN_BYTE_ARRAY page are transposed back to
+// plain values as a whole when the page is set, which are then read like
+// PLAIN-encoded ones.  The decoded values live as long as the page.
+class ByteStreamSplitFLBADecoder : public PlainFLBADecoder {
+ public:
+  explicit ByteStreamSplitFLBADecoder(const ColumnDescriptor* descr)
+      : PlainFLBADecoder(descr) {}
+
+  Encoding::type encoding() const override { return Encoding::BYTE_STREAM_SPLIT; }
+
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    const int width = descr_->type_length();
+    const int64_t size = static_cast<int64_t>(num_values) * width;
+    if (size > len) {
+      throw ParquetException(
+          "Data size too small for number of values (corrupted file?)");
+    }
+    PARQUET_ASSIGN_OR_THROW(decoded_values_, ::arrow::AllocateBuffer(size));
+    ::arrow::util::internal::ByteStreamSplitDecode(data, width, num_values,
+                                                   /*stride=*/num_values,
+                                                   decoded_values_->mutable_data());
+    PlainFLBADecoder::SetData(num_values, decoded_values_->data(),
+                              static_cast<int>(size));
+  }
+
+ private:
+  std::shared_ptr<Buffer> decoded_values_;
+};
+
 }  // namespace
 
 // ----------------------------------------------------------------------
@@ -2692,16 +3470,47 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
     }
   } else if (encoding == Encoding::BYTE_STREAM_SPLIT) {
     switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(
+            new ByteStreamSplitEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(
+            new ByteStreamSplitEncoder<Int64Type>(descr, pool));
       case Type::FLOAT:
         return std::unique_ptr<Encoder>(
             new ByteStreamSplitEncoder<FloatType>(descr, pool));
       case Type::DOUBLE:
         return std::unique_ptr<Encoder>(
             new ByteStreamSplitEncoder<DoubleType>(descr, pool));
+      case Type::FIXED_LEN_BYTE_ARRAY:
+        return std::unique_ptr<Encoder>(
+            new ByteStreamSplitEncoder<FLBAType>(descr, pool));
+      default:
+        throw ParquetException(
+            "BYTE_STREAM_SPLIT only supports INT32, INT64, FLOAT, DOUBLE and "
+            "FIXED_LEN_BYTE_ARRAY");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
       default:
-        throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
         break;
     }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -2734,12 +3543,20 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
     }
   } else if (encoding == Encoding::BYTE_STREAM_SPLIT) {
     switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new ByteStreamSplitDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new ByteStreamSplitDecoder<Int64Type>(descr));
       case Type::FLOAT:
         return std::unique_ptr<Decoder>(new ByteStreamSplitDecoder<FloatType>(descr));
       case Type::DOUBLE:
         return std::unique_ptr<Decoder>(new ByteStreamSplitDecoder<DoubleType>(descr));
+      case Type::FIXED_LEN_BYTE_ARRAY:
+        return std::unique_ptr<Decoder>(new ByteStreamSplitFLBADecoder(descr));
       default:
-        throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
+        throw ParquetException(
+            "BYTE_STREAM_SPLIT only supports INT32, INT64, FLOAT, DOUBLE and "
+            "FIXED_LEN_BYTE_ARRAY");
         break;
     }
   } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
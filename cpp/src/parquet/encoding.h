@@ -245,6 +245,16 @@ class DictEncoder : virtual public TypedEncoder<DType> {
   /// \param[in] values the dictionary values. Only valid for certain
   /// Parquet/Arrow type combinations, like BYTE_ARRAY/BinaryArray
   virtual void PutDictionary(const ::arrow::Array& values) = 0;
+
+  /// \brief EXPERIMENTAL: Insert the values of an Arrow dictionary into the
+  /// encoder's dictionary, which may already contain values, and return the
+  /// index of each of them in the encoder's dictionary. Indices referencing
+  /// `values` can then be remapped through `memo_indices` and appended with
+  /// PutIndices, without hashing each value again
+  /// \param[in] values the dictionary values, which must not contain nulls
+  /// \param[out] memo_indices the index of each value in the encoder's dictionary
+  virtual void MapDictionary(const ::arrow::Array& values,
+                             std::vector<int32_t>* memo_indices) = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -32,6 +32,7 @@
 
 #include <cmath>
 #include <random>
+#include <string>
 
 using arrow::default_memory_pool;
 using arrow::MemoryPool;
@@ -452,6 +453,216 @@ BENCHMARK(BM_ByteStreamSplitEncode_Float_Avx512)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_ByteStreamSplitEncode_Double_Avx512)->Range(MIN_RANGE, MAX_RANGE);
 #endif
 
+// Integer columns go through the same kernels as floating-point columns of the
+// same width, picked at runtime
+static void BM_ByteStreamSplitDecode_Int32(benchmark::State& state) {
+  BM_ByteStreamSplitDecode<int32_t>(
+      state, ::arrow::util::internal::ByteStreamSplitDecode<int32_t>);
+}
+
+static void BM_ByteStreamSplitDecode_Int64(benchmark::State& state) {
+  BM_ByteStreamSplitDecode<int64_t>(
+      state, ::arrow::util::internal::ByteStreamSplitDecode<int64_t>);
+}
+
+static void BM_ByteStreamSplitEncode_Int32(benchmark::State& state) {
+  BM_ByteStreamSplitEncode<int32_t>(
+      state, ::arrow::util::internal::ByteStreamSplitEncode<int32_t>);
+}
+
+static void BM_ByteStreamSplitEncode_Int64(benchmark::State& state) {
+  BM_ByteStreamSplitEncode<int64_t>(
+      state, ::arrow::util::internal::ByteStreamSplitEncode<int64_t>);
+}
+
+BENCHMARK(BM_ByteStreamSplitDecode_Int32)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_ByteStreamSplitDecode_Int64)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_ByteStreamSplitEncode_Int32)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_ByteStreamSplitEncode_Int64)->Range(MIN_RANGE, MAX_RANGE);
+
+static void ByteStreamSplitFLBAArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"num_values", "byte_width"});
+  for (int64_t num_values : {MIN_RANGE, MAX_RANGE}) {
+    for (int64_t byte_width : {2, 3, 4, 8, 16}) {
+      bench->Args({num_values, byte_width});
+    }
+  }
+}
+
+// Arguments: number of values, and FIXED_LEN_BYTE_ARRAY width
+static void BM_ByteStreamSplitDecode_FLBA(benchmark::State& state) {
+  const int64_t num_values = state.range(0);
+  const int width = static_cast<int>(state.range(1));
+  std::vector<uint8_t> values(num_values * width, 64);
+  std::vector<uint64_t> output((num_values * width + 7) / 8, 0);
+
+  for (auto _ : state) {
+    ::arrow::util::internal::ByteStreamSplitDecode(
+        values.data(), width, num_values, num_values,
+        reinterpret_cast<uint8_t*>(output.data()));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * values.size());
+}
+
+static void BM_ByteStreamSplitEncode_FLBA(benchmark::State& state) {
+  const int64_t num_values = state.range(0);
+  const int width = static_cast<int>(state.range(1));
+  std::vector<uint8_t> values(num_values * width, 64);
+  std::vector<uint8_t> output(num_values * width, 0);
+
+  for (auto _ : state) {
+    ::arrow::util::internal::ByteStreamSplitEncode(values.data(), width, num_values,
+                                                   output.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * values.size());
+}
+
+BENCHMARK(BM_ByteStreamSplitDecode_FLBA)->Apply(ByteStreamSplitFLBAArgs);
+BENCHMARK(BM_ByteStreamSplitEncode_FLBA)->Apply(ByteStreamSplitFLBAArgs);
+
+// Sorted values with random gaps, as in timestamp or id columns
+template <typename T>
+static std::vector<T> MakeDeltaBitPackValues(int64_t num_values, int64_t max_gap = 100) {
+  std::default_random_engine gen(1234);
+  std::uniform_int_distribution<int64_t> gap(0, max_gap);
+  std::vector<T> values(num_values);
+  T value = 0;
+  for (auto& v : values) {
+    value += static_cast<T>(gap(gen));
+    v = value;
+  }
+  return values;
+}
+
+template <typename DType>
+static void BM_DeltaBitPackEncoding(benchmark::State& state) {
+  using T = typename DType::c_type;
+  std::vector<T> values = MakeDeltaBitPackValues<T>(state.range(0));
+  auto encoder = MakeTypedEncoder<DType>(Encoding::DELTA_BINARY_PACKED);
+  for (auto _ : state) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    encoder->FlushValues();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename DType>
+static void BM_DeltaBitPackDecoding(benchmark::State& state, int64_t max_gap = 100) {
+  using T = typename DType::c_type;
+  std::vector<T> values = MakeDeltaBitPackValues<T>(state.range(0), max_gap);
+  auto encoder = MakeTypedEncoder<DType>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  for (auto _ : state) {
+    auto decoder = MakeTypedDecoder<DType>(Encoding::DELTA_BINARY_PACKED);
+    decoder->SetData(static_cast<int>(values.size()), buf->data(),
+                     static_cast<int>(buf->size()));
+    decoder->Decode(values.data(), static_cast<int>(values.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+static void BM_DeltaBitPackEncodingInt32(benchmark::State& state) {
+  BM_DeltaBitPackEncoding<Int32Type>(state);
+}
+
+static void BM_DeltaBitPackEncodingInt64(benchmark::State& state) {
+  BM_DeltaBitPackEncoding<Int64Type>(state);
+}
+
+static void BM_DeltaBitPackDecodingInt32(benchmark::State& state) {
+  BM_DeltaBitPackDecoding<Int32Type>(state);
+}
+
+static void BM_DeltaBitPackDecodingInt64(benchmark::State& state) {
+  BM_DeltaBitPackDecoding<Int64Type>(state);
+}
+
+// Gaps too wide for 32-bit deltas
+static void BM_DeltaBitPackDecodingInt64Wide(benchmark::State& state) {
+  BM_DeltaBitPackDecoding<Int64Type>(state, /*max_gap=*/int64_t(1) << 40);
+}
+
+BENCHMARK(BM_DeltaBitPackEncodingInt32)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackEncodingInt64)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackDecodingInt32)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackDecodingInt64)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackDecodingInt64Wide)->Range(MIN_RANGE, MAX_RANGE);
+
+// Strings sharing long prefixes with their predecessor, as in sorted keys or URLs
+static std::vector<std::string> MakeDeltaByteArrayStrings(int64_t num_values) {
+  std::vector<std::string> strings(num_values);
+  for (int64_t i = 0; i < num_values; ++i) {
+    strings[i] = "https://example.com/items/" + std::to_string(1000000 + i * 3);
+  }
+  return strings;
+}
+
+static std::vector<ByteArray> ToByteArrays(const std::vector<std::string>& strings) {
+  std::vector<ByteArray> values;
+  values.reserve(strings.size());
+  for (const auto& s : strings) {
+    values.emplace_back(static_cast<uint32_t>(s.size()),
+                        reinterpret_cast<const uint8_t*>(s.data()));
+  }
+  return values;
+}
+
+static void EncodeDeltaByteArray(benchmark::State& state, Encoding::type encoding) {
+  const auto strings = MakeDeltaByteArrayStrings(state.range(0));
+  const auto values = ToByteArrays(strings);
+  int64_t total_size = 0;
+  for (const auto& value : values) total_size += value.len;
+  auto encoder = MakeTypedEncoder<ByteArrayType>(encoding);
+  for (auto _ : state) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    encoder->FlushValues();
+  }
+  state.SetBytesProcessed(state.iterations() * total_size);
+}
+
+static void DecodeDeltaByteArray(benchmark::State& state, Encoding::type encoding) {
+  const auto strings = MakeDeltaByteArrayStrings(state.range(0));
+  auto values = ToByteArrays(strings);
+  int64_t total_size = 0;
+  for (const auto& value : values) total_size += value.len;
+  auto encoder = MakeTypedEncoder<ByteArrayType>(encoding);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  for (auto _ : state) {
+    auto decoder = MakeTypedDecoder<ByteArrayType>(encoding);
+    decoder->SetData(static_cast<int>(values.size()), buf->data(),
+                     static_cast<int>(buf->size()));
+    decoder->Decode(values.data(), static_cast<int>(values.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * total_size);
+}
+
+static void BM_DeltaLengthByteArrayEncoding(benchmark::State& state) {
+  EncodeDeltaByteArray(state, Encoding::DELTA_LENGTH_BYTE_ARRAY);
+}
+
+static void BM_DeltaLengthByteArrayDecoding(benchmark::State& state) {
+  DecodeDeltaByteArray(state, Encoding::DELTA_LENGTH_BYTE_ARRAY);
+}
+
+static void BM_DeltaByteArrayEncoding(benchmark::State& state) {
+  EncodeDeltaByteArray(state, Encoding::DELTA_BYTE_ARRAY);
+}
+
+static void BM_DeltaByteArrayDecoding(benchmark::State& state) {
+  DecodeDeltaByteArray(state, Encoding::DELTA_BYTE_ARRAY);
+}
+
+BENCHMARK(BM_DeltaLengthByteArrayEncoding)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaLengthByteArrayDecoding)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaByteArrayEncoding)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaByteArrayDecoding)->Range(MIN_RANGE, MAX_RANGE);
+
 template <typename Type>
 static void DecodeDict(std::vector<typename Type::c_type>& values,
                        benchmark::State& state) {
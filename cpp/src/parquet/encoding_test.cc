@@ -21,6 +21,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -567,6 +568,27 @@ TEST_F(PlainEncoding, CheckDecodeArrowNonNullDictBuilder) {
   this->CheckDecodeArrowNonNullUsingDictBuilder();
 }
 
+TEST(PlainEncodingAdHoc, DecodeArrowTruncatedByteArray) {
+  // Values are validated before being copied, so truncated pages must still
+  // be detected
+  std::vector<ByteArray> values = {ByteArray("foo"), ByteArray("barbaz"),
+                                   ByteArray("")};
+  auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::PLAIN);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  auto buffer = encoder->FlushValues();
+
+  for (int64_t truncated = 1; truncated <= 4; ++truncated) {
+    auto decoder = MakeTypedDecoder<ByteArrayType>(Encoding::PLAIN);
+    decoder->SetData(static_cast<int>(values.size()), buffer->data(),
+                     static_cast<int>(buffer->size() - 4 - truncated));
+    typename EncodingTraits<ByteArrayType>::Accumulator acc;
+    acc.builder.reset(new ::arrow::BinaryBuilder);
+    ASSERT_THROW(decoder->DecodeArrow(static_cast<int>(values.size()), 0, nullptr, 0,
+                                      &acc),
+                 ParquetException);
+  }
+}
+
 TEST(PlainEncodingAdHoc, ArrowBinaryDirectPut) {
   // Implemented as part of ARROW-3246
 
@@ -675,8 +697,7 @@ class EncodingAdHocTyped : public ::testing::Test {
   }
 
   void ByteStreamSplit(int seed) {
-    if (!std::is_same<ParquetType, FloatType>::value &&
-        !std::is_same<ParquetType, DoubleType>::value) {
+    if (std::is_same<ParquetType, BooleanType>::value) {
       return;
     }
     auto values = GetValues(seed);
@@ -1170,6 +1191,48 @@ void TestByteStreamSplitEncoding<DoubleType>::CheckEncode() {
               expected_output, sizeof(expected_output));
 }
 
+template <>
+void TestByteStreamSplitEncoding<Int32Type>::CheckDecode() {
+  const uint8_t data[] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66,
+                          0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC};
+  const auto expected_output =
+      ToLittleEndian<uint32_t>({0xAA774411U, 0xBB885522U, 0xCC996633U});
+  CheckDecode(data, static_cast<int64_t>(sizeof(data)),
+              reinterpret_cast<const int32_t*>(expected_output.data()),
+              static_cast<int>(sizeof(data) / sizeof(int32_t)));
+}
+
+template <>
+void TestByteStreamSplitEncoding<Int64Type>::CheckDecode() {
+  const uint8_t data[] = {0xDE, 0xC0, 0x37, 0x13, 0x11, 0x22, 0x33, 0x44,
+                          0xAA, 0xBB, 0xCC, 0xDD, 0x55, 0x66, 0x77, 0x88};
+  const auto expected_output =
+      ToLittleEndian<uint64_t>({0x7755CCAA331137DEULL, 0x8866DDBB442213C0ULL});
+  CheckDecode(data, static_cast<int64_t>(sizeof(data)),
+              reinterpret_cast<const int64_t*>(expected_output.data()),
+              static_cast<int>(sizeof(data) / sizeof(int64_t)));
+}
+
+template <>
+void TestByteStreamSplitEncoding<Int32Type>::CheckEncode() {
+  const auto data = ToLittleEndian<uint32_t>({0xaabbccdd, 0x11223344});
+  const uint8_t expected_output[8] = {0xdd, 0x44, 0xcc, 0x33, 0xbb, 0x22, 0xaa, 0x11};
+  CheckEncode(reinterpret_cast<const int32_t*>(data.data()),
+              static_cast<int>(data.size()), expected_output, sizeof(expected_output));
+}
+
+template <>
+void TestByteStreamSplitEncoding<Int64Type>::CheckEncode() {
+  const auto data = ToLittleEndian<uint64_t>(
+      {0x4142434445464748ULL, 0x0102030405060708ULL, 0xb1b2b3b4b5b6b7b8ULL});
+  const uint8_t expected_output[24] = {
+      0x48, 0x08, 0xb8, 0x47, 0x07, 0xb7, 0x46, 0x06, 0xb6, 0x45, 0x05, 0xb5,
+      0x44, 0x04, 0xb4, 0x43, 0x03, 0xb3, 0x42, 0x02, 0xb2, 0x41, 0x01, 0xb1,
+  };
+  CheckEncode(reinterpret_cast<const int64_t*>(data.data()),
+              static_cast<int>(data.size()), expected_output, sizeof(expected_output));
+}
+
 template <>
 void TestByteStreamSplitEncoding<FloatType>::CheckEncode() {
   const auto data = ToLittleEndian<uint32_t>({0xaabbccdd, 0x11223344});
@@ -1178,7 +1241,8 @@ void TestByteStreamSplitEncoding<FloatType>::CheckEncode() {
               expected_output, sizeof(expected_output));
 }
 
-typedef ::testing::Types<FloatType, DoubleType> ByteStreamSplitTypes;
+typedef ::testing::Types<Int32Type, Int64Type, FloatType, DoubleType>
+    ByteStreamSplitTypes;
 TYPED_TEST_SUITE(TestByteStreamSplitEncoding, ByteStreamSplitTypes);
 
 TYPED_TEST(TestByteStreamSplitEncoding, BasicRoundTrip) {
@@ -1219,31 +1283,287 @@ TYPED_TEST(TestByteStreamSplitEncoding, CheckOnlyEncode) {
 
 TEST(ByteStreamSplitEncodeDecode, InvalidDataTypes) {
   // First check encoders.
-  ASSERT_THROW(MakeTypedEncoder<Int32Type>(Encoding::BYTE_STREAM_SPLIT),
-               ParquetException);
-  ASSERT_THROW(MakeTypedEncoder<Int64Type>(Encoding::BYTE_STREAM_SPLIT),
-               ParquetException);
   ASSERT_THROW(MakeTypedEncoder<Int96Type>(Encoding::BYTE_STREAM_SPLIT),
                ParquetException);
   ASSERT_THROW(MakeTypedEncoder<BooleanType>(Encoding::BYTE_STREAM_SPLIT),
                ParquetException);
   ASSERT_THROW(MakeTypedEncoder<ByteArrayType>(Encoding::BYTE_STREAM_SPLIT),
                ParquetException);
-  ASSERT_THROW(MakeTypedEncoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT), ParquetException);
 
   // Then check decoders.
-  ASSERT_THROW(MakeTypedDecoder<Int32Type>(Encoding::BYTE_STREAM_SPLIT),
-               ParquetException);
-  ASSERT_THROW(MakeTypedDecoder<Int64Type>(Encoding::BYTE_STREAM_SPLIT),
-               ParquetException);
   ASSERT_THROW(MakeTypedDecoder<Int96Type>(Encoding::BYTE_STREAM_SPLIT),
                ParquetException);
   ASSERT_THROW(MakeTypedDecoder<BooleanType>(Encoding::BYTE_STREAM_SPLIT),
                ParquetException);
   ASSERT_THROW(MakeTypedDecoder<ByteArrayType>(Encoding::BYTE_STREAM_SPLIT),
                ParquetException);
-  ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT), ParquetException);
 }
 
+TEST(ByteStreamSplitEncodeDecode, FLBARoundTrip) {
+  for (int type_length : {1, 2, 3, 4, 7, 8, 16}) {
+    ARROW_SCOPED_TRACE("type_length = ", type_length);
+    auto node = schema::PrimitiveNode::Make("name", Repetition::OPTIONAL,
+                                            Type::FIXED_LEN_BYTE_ARRAY,
+                                            ConvertedType::NONE, type_length);
+    ColumnDescriptor descr(node, 0, 0);
+    for (int num_values : {0, 1, 7, 64, 1000}) {
+      ARROW_SCOPED_TRACE("num_values = ", num_values);
+      std::vector<uint8_t> heap(num_values * type_length);
+      std::vector<FLBA> draws(num_values);
+      random_fixed_byte_array(num_values, /*seed=*/num_values, heap.data(), type_length,
+                              draws.data());
+
+      auto encoder = MakeTypedEncoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT,
+                                                /*use_dictionary=*/false, &descr);
+      auto decoder = MakeTypedDecoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT, &descr);
+      encoder->Put(draws.data(), num_values);
+      auto buffer = encoder->FlushValues();
+      ASSERT_EQ(static_cast<int64_t>(num_values) * type_length, buffer->size());
+
+      decoder->SetData(num_values, buffer->data(), static_cast<int>(buffer->size()));
+      std::vector<FLBA> decoded(num_values);
+      // Decode in uneven steps to check that the values stay valid across calls
+      int offset = 0;
+      while (offset < num_values) {
+        int num_decoded = decoder->Decode(decoded.data() + offset, 5);
+        ASSERT_GT(num_decoded, 0);
+        offset += num_decoded;
+      }
+      ASSERT_EQ(0, decoder->values_left());
+      for (int i = 0; i < num_values; ++i) {
+        ASSERT_EQ(0, memcmp(draws[i].ptr, decoded[i].ptr, type_length)) << "at " << i;
+      }
+    }
+  }
+}
+
+TEST(ByteStreamSplitEncodeDecode, FLBAEncodeLayout) {
+  auto node = schema::PrimitiveNode::Make("name", Repetition::REQUIRED,
+                                          Type::FIXED_LEN_BYTE_ARRAY,
+                                          ConvertedType::NONE, /*length=*/3);
+  ColumnDescriptor descr(node, 0, 0);
+  const uint8_t data[] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66};
+  const FLBA values[] = {FLBA(data), FLBA(data + 3)};
+  auto encoder = MakeTypedEncoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT,
+                                            /*use_dictionary=*/false, &descr);
+  encoder->Put(values, 2);
+  auto buffer = encoder->FlushValues();
+  const uint8_t expected[] = {0x11, 0x44, 0x22, 0x55, 0x33, 0x66};
+  ASSERT_EQ(static_cast<int64_t>(sizeof(expected)), buffer->size());
+  ASSERT_EQ(0, memcmp(expected, buffer->data(), sizeof(expected)));
+}
+
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encoding tests
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public TestEncodingBase<Type> {
+ public:
+  using c_type = typename Type::c_type;
+  static constexpr int TYPE = Type::type_num;
+
+  void CheckRoundtrip() override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    // Encode twice to check the encoder is reset by FlushValues
+    for (int i = 0; i < 2; ++i) {
+      encoder->Put(draws_, num_values_);
+      encode_buffer_ = encoder->FlushValues();
+
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      int values_decoded = decoder->Decode(decode_buf_, num_values_);
+      ASSERT_EQ(num_values_, values_decoded);
+      ASSERT_NO_FATAL_FAILURE(VerifyResults<c_type>(decode_buf_, draws_, num_values_));
+    }
+  }
+
+  void CheckRoundtripSpaced(const uint8_t* valid_bits,
+                            int64_t valid_bits_offset) override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    int null_count = 0;
+    for (auto i = 0; i < num_values_; i++) {
+      if (!bit_util::GetBit(valid_bits, valid_bits_offset + i)) {
+        null_count++;
+      }
+    }
+
+    encoder->PutSpaced(draws_, num_values_, valid_bits, valid_bits_offset);
+    encode_buffer_ = encoder->FlushValues();
+    decoder->SetData(num_values_ - null_count, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    auto values_decoded = decoder->DecodeSpaced(decode_buf_, num_values_, null_count,
+                                                valid_bits, valid_bits_offset);
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_NO_FATAL_FAILURE(VerifyResultsSpaced<c_type>(decode_buf_, draws_, num_values_,
+                                                        valid_bits, valid_bits_offset));
+  }
+
+  void ExecuteExtremes(int nvalues) {
+    this->InitData(nvalues, 1);
+    // Alternate between the extremes, so deltas wrap around and need all bits
+    for (int i = 0; i < num_values_; ++i) {
+      draws_[i] = i % 3 == 0   ? std::numeric_limits<c_type>::min()
+                  : i % 3 == 1 ? std::numeric_limits<c_type>::max()
+                               : static_cast<c_type>(i);
+    }
+    CheckRoundtrip();
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackTypes;
+TYPED_TEST_SUITE(TestDeltaBitPackEncoding, DeltaBitPackTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, BasicRoundTrip) {
+  // Around the miniblock (32 values) and block (128 values) boundaries
+  for (int values : {1, 2, 31, 32, 33, 127, 128, 129, 200, 257}) {
+    ASSERT_NO_FATAL_FAILURE(this->Execute(values, 1));
+  }
+  ASSERT_NO_FATAL_FAILURE(this->Execute(10000, 1));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(1000, 10));
+
+  for (auto null_prob : {0.001, 0.1, 0.5, 0.9, 0.999}) {
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 0, null_prob));
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 33, null_prob));
+  }
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, RoundTripExtremeValues) {
+  for (int values : {1, 2, 3, 33, 129, 1000}) {
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteExtremes(values));
+  }
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, SortedValuesAreCompact) {
+  using c_type = typename TypeParam::c_type;
+  std::vector<c_type> values(1024);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<c_type>(1000 + 3 * i);
+  }
+  auto encoder = MakeTypedEncoder<TypeParam>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  auto buffer = encoder->FlushValues();
+  // Constant deltas need no bits beyond the block headers
+  ASSERT_LT(buffer->size(), 128);
+}
+
+TEST(DeltaBitPackEncodeDecode, InvalidDataTypes) {
+  ASSERT_THROW(MakeTypedEncoder<BooleanType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<Int96Type>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<DoubleType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<Int32Type>(Encoding::DELTA_BYTE_ARRAY),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<FLBAType>(Encoding::DELTA_LENGTH_BYTE_ARRAY),
+               ParquetException);
+}
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY encoding tests
+
+class TestDeltaByteArrayEncoding : public ::testing::TestWithParam<Encoding::type> {
+ protected:
+  void CheckRoundtrip(const std::vector<std::string>& strings) {
+    std::vector<ByteArray> values;
+    for (const auto& s : strings) {
+      values.emplace_back(static_cast<uint32_t>(s.size()),
+                          reinterpret_cast<const uint8_t*>(s.data()));
+    }
+    const int num_values = static_cast<int>(values.size());
+    auto encoder = MakeTypedEncoder<ByteArrayType>(GetParam());
+    auto decoder = MakeTypedDecoder<ByteArrayType>(GetParam());
+    // Encode twice to check the encoder is reset by FlushValues
+    for (int i = 0; i < 2; ++i) {
+      // Put in two calls, to check prefixes are computed across calls
+      encoder->Put(values.data(), num_values / 2);
+      encoder->Put(values.data() + num_values / 2, num_values - num_values / 2);
+      auto buffer = encoder->FlushValues();
+
+      std::vector<ByteArray> decoded(num_values);
+      decoder->SetData(num_values, buffer->data(), static_cast<int>(buffer->size()));
+      ASSERT_EQ(num_values, decoder->Decode(decoded.data(), num_values));
+      for (int j = 0; j < num_values; ++j) {
+        ASSERT_EQ(values[j], decoded[j]) << "at index " << j;
+      }
+    }
+  }
+};
+
+TEST_P(TestDeltaByteArrayEncoding, BasicRoundTrip) {
+  ASSERT_NO_FATAL_FAILURE(CheckRoundtrip({"a"}));
+  ASSERT_NO_FATAL_FAILURE(CheckRoundtrip({"", "", "abc", ""}));
+  ASSERT_NO_FATAL_FAILURE(
+      CheckRoundtrip({"axis", "axle", "babble", "babyhood", "babyhood", "bab"}));
+
+  std::vector<std::string> strings;
+  for (int i = 0; i < 1000; ++i) {
+    strings.push_back("prefix/" + std::to_string(i * 7) + std::string(i % 13, 'x'));
+  }
+  ASSERT_NO_FATAL_FAILURE(CheckRoundtrip(strings));
+}
+
+TEST_P(TestDeltaByteArrayEncoding, ArrowDirectPut) {
+  auto values = ::arrow::ArrayFromJSON(
+      ::arrow::utf8(), R"(["apple", null, "applesauce", "banana", null])");
+  auto encoder = MakeTypedEncoder<ByteArrayType>(GetParam());
+  auto decoder = MakeTypedDecoder<ByteArrayType>(GetParam());
+  ASSERT_NO_THROW(encoder->Put(*values));
+  auto buffer = encoder->FlushValues();
+
+  // Nulls are skipped
+  const std::vector<std::string> expected = {"apple", "applesauce", "banana"};
+  const int num_values = static_cast<int>(expected.size());
+  std::vector<ByteArray> decoded(num_values);
+  decoder->SetData(num_values, buffer->data(), static_cast<int>(buffer->size()));
+  ASSERT_EQ(num_values, decoder->Decode(decoded.data(), num_values));
+  for (int i = 0; i < num_values; ++i) {
+    ASSERT_EQ(expected[i], ByteArrayToString(decoded[i]));
+  }
+}
+
+TEST_P(TestDeltaByteArrayEncoding, DecodeArrow) {
+  ::arrow::random::RandomArrayGenerator rag(0);
+  for (double null_probability : {0.0, 0.3}) {
+    auto values = rag.String(1000, 0, 20, null_probability);
+    auto encoder = MakeTypedEncoder<ByteArrayType>(GetParam());
+    auto decoder = MakeTypedDecoder<ByteArrayType>(GetParam());
+    ASSERT_NO_THROW(encoder->Put(*values));
+    auto buffer = encoder->FlushValues();
+
+    const int num_values = static_cast<int>(values->length() - values->null_count());
+    decoder->SetData(num_values, buffer->data(), static_cast<int>(buffer->size()));
+    typename EncodingTraits<ByteArrayType>::Accumulator acc;
+    acc.builder.reset(new ::arrow::StringBuilder);
+    // Decode in two calls, to check the second one appends after the first
+    const int64_t half = values->length() / 2;
+    int decoded = 0;
+    for (const auto& slice : {values->Slice(0, half), values->Slice(half)}) {
+      decoded += decoder->DecodeArrow(
+          static_cast<int>(slice->length()), static_cast<int>(slice->null_count()),
+          slice->null_bitmap_data(), slice->offset(), &acc);
+    }
+    ASSERT_EQ(num_values, decoded);
+
+    std::shared_ptr<::arrow::Array> result;
+    ASSERT_OK(acc.builder->Finish(&result));
+    ASSERT_OK(result->ValidateFull());
+    ::arrow::AssertArraysEqual(*values, *result);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(DeltaEncodings, TestDeltaByteArrayEncoding,
+                         ::testing::Values(Encoding::DELTA_LENGTH_BYTE_ARRAY,
+                                           Encoding::DELTA_BYTE_ARRAY));
+
 }  // namespace test
 }  // namespace parquet
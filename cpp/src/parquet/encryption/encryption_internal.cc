@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -315,36 +316,65 @@ class AesDecryptor::AesDecryptorImpl {
   explicit AesDecryptorImpl(ParquetCipher::type alg_id, int key_len, bool metadata,
                             bool contains_length);
 
-  ~AesDecryptorImpl() {
-    if (nullptr != ctx_) {
-      EVP_CIPHER_CTX_free(ctx_);
-      ctx_ = nullptr;
-    }
-  }
-
   int Decrypt(const uint8_t* ciphertext, int ciphertext_len, const uint8_t* key,
               int key_len, const uint8_t* aad, int aad_len, uint8_t* plaintext);
 
   void WipeOut() {
-    if (nullptr != ctx_) {
-      EVP_CIPHER_CTX_free(ctx_);
-      ctx_ = nullptr;
-    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    contexts_.clear();
+    wiped_out_ = true;
   }
 
   int ciphertext_size_delta() { return ciphertext_size_delta_; }
 
  private:
-  EVP_CIPHER_CTX* ctx_;
+  // A cipher context together with the key last expanded into it. Pages of a
+  // column chunk share their key, so a reused context only needs a new IV and
+  // the AES key schedule is computed once per context rather than once per page.
+  struct CipherContext {
+    ~CipherContext() {
+      EVP_CIPHER_CTX_free(ctx);
+      std::fill(key.begin(), key.end(), '\0');
+    }
+    EVP_CIPHER_CTX* ctx = nullptr;
+    std::string key;
+  };
+
+  // Returns an idle context to its pool when it goes out of scope.
+  class ScopedContext {
+   public:
+    ScopedContext(AesDecryptorImpl* impl, std::unique_ptr<CipherContext> context)
+        : impl_(impl), context_(std::move(context)) {}
+    ~ScopedContext() { impl_->ReleaseContext(std::move(context_)); }
+    CipherContext* get() const { return context_.get(); }
+
+   private:
+    AesDecryptorImpl* impl_;
+    std::unique_ptr<CipherContext> context_;
+  };
+
+  std::unique_ptr<CipherContext> NewContext();
+  std::unique_ptr<CipherContext> AcquireContext();
+  void ReleaseContext(std::unique_ptr<CipherContext> context);
+  // Set the IV, and the key unless the context already holds it
+  void InitContext(CipherContext* context, const uint8_t* key, int key_len,
+                   const uint8_t* iv);
+
+  const EVP_CIPHER* cipher_ = nullptr;
+  // Idle contexts, shared by all threads decrypting with this decryptor
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<CipherContext>> contexts_;
+  bool wiped_out_ = false;
   int aes_mode_;
   int key_length_;
   int ciphertext_size_delta_;
   int length_buffer_length_;
-  int GcmDecrypt(const uint8_t* ciphertext, int ciphertext_len, const uint8_t* key,
-                 int key_len, const uint8_t* aad, int aad_len, uint8_t* plaintext);
+  int GcmDecrypt(CipherContext* context, const uint8_t* ciphertext, int ciphertext_len,
+                 const uint8_t* key, int key_len, const uint8_t* aad, int aad_len,
+                 uint8_t* plaintext);
 
-  int CtrDecrypt(const uint8_t* ciphertext, int ciphertext_len, const uint8_t* key,
-                 int key_len, uint8_t* plaintext);
+  int CtrDecrypt(CipherContext* context, const uint8_t* ciphertext, int ciphertext_len,
+                 const uint8_t* key, int key_len, uint8_t* plaintext);
 };
 
 int AesDecryptor::Decrypt(const uint8_t* plaintext, int plaintext_len, const uint8_t* key,
@@ -359,7 +389,6 @@ AesDecryptor::~AesDecryptor() {}
 
 AesDecryptor::AesDecryptorImpl::AesDecryptorImpl(ParquetCipher::type alg_id, int key_len,
                                                  bool metadata, bool contains_length) {
-  ctx_ = nullptr;
   length_buffer_length_ = contains_length ? kBufferSizeLength : 0;
   ciphertext_size_delta_ = length_buffer_length_ + kNonceLength;
   if (metadata || (ParquetCipher::AES_GCM_V1 == alg_id)) {
@@ -377,30 +406,78 @@ AesDecryptor::AesDecryptorImpl::AesDecryptorImpl(ParquetCipher::type alg_id, int
 
   key_length_ = key_len;
 
-  ctx_ = EVP_CIPHER_CTX_new();
-  if (nullptr == ctx_) {
-    throw ParquetException("Couldn't init cipher context");
-  }
-
   if (kGcmMode == aes_mode_) {
     // Init AES-GCM with specified key length
     if (16 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_128_gcm());
+      cipher_ = EVP_aes_128_gcm();
     } else if (24 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_192_gcm());
+      cipher_ = EVP_aes_192_gcm();
     } else if (32 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_256_gcm());
+      cipher_ = EVP_aes_256_gcm();
     }
   } else {
     // Init AES-CTR with specified key length
     if (16 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_128_ctr());
+      cipher_ = EVP_aes_128_ctr();
     } else if (24 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_192_ctr());
+      cipher_ = EVP_aes_192_ctr();
     } else if (32 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_256_ctr());
+      cipher_ = EVP_aes_256_ctr();
+    }
+  }
+
+  contexts_.push_back(NewContext());
+}
+
+std::unique_ptr<AesDecryptor::AesDecryptorImpl::CipherContext>
+AesDecryptor::AesDecryptorImpl::NewContext() {
+  std::unique_ptr<CipherContext> context(new CipherContext());
+  context->ctx = EVP_CIPHER_CTX_new();
+  if (nullptr == context->ctx) {
+    throw ParquetException("Couldn't init cipher context");
+  }
+  DECRYPT_INIT(context->ctx, cipher_);
+  return context;
+}
+
+std::unique_ptr<AesDecryptor::AesDecryptorImpl::CipherContext>
+AesDecryptor::AesDecryptorImpl::AcquireContext() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (wiped_out_) {
+      throw ParquetException("Decryptor was used after its keys were wiped out");
+    }
+    if (!contexts_.empty()) {
+      auto context = std::move(contexts_.back());
+      contexts_.pop_back();
+      return context;
     }
   }
+  return NewContext();
+}
+
+void AesDecryptor::AesDecryptorImpl::ReleaseContext(
+    std::unique_ptr<CipherContext> context) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!wiped_out_) {
+    contexts_.push_back(std::move(context));
+  }
+}
+
+void AesDecryptor::AesDecryptorImpl::InitContext(CipherContext* context,
+                                                 const uint8_t* key, int key_len,
+                                                 const uint8_t* iv) {
+  const auto* cached_key = reinterpret_cast<const uint8_t*>(context->key.data());
+  const bool same_key = context->key.size() == static_cast<size_t>(key_len) &&
+                        std::equal(key, key + key_len, cached_key);
+  if (1 != EVP_DecryptInit_ex(context->ctx, nullptr, nullptr, same_key ? nullptr : key,
+                              iv)) {
+    context->key.clear();
+    throw ParquetException("Couldn't set key and IV");
+  }
+  if (!same_key) {
+    context->key.assign(reinterpret_cast<const char*>(key), key_len);
+  }
 }
 
 AesEncryptor* AesEncryptor::Make(ParquetCipher::type alg_id, int key_len, bool metadata,
@@ -445,10 +522,12 @@ std::shared_ptr<AesDecryptor> AesDecryptor::Make(
 
 int AesDecryptor::CiphertextSizeDelta() { return impl_->ciphertext_size_delta(); }
 
-int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
+int AesDecryptor::AesDecryptorImpl::GcmDecrypt(CipherContext* context,
+                                               const uint8_t* ciphertext,
                                                int ciphertext_len, const uint8_t* key,
                                                int key_len, const uint8_t* aad,
                                                int aad_len, uint8_t* plaintext) {
+  EVP_CIPHER_CTX* ctx = context->ctx;
   int len;
   int plaintext_len;
 
@@ -481,18 +560,16 @@ int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
             tag);
 
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, nonce)) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+  InitContext(context, key, key_len, nonce);
 
   // Setting additional authenticated data
-  if ((nullptr != aad) && (1 != EVP_DecryptUpdate(ctx_, nullptr, &len, aad, aad_len))) {
+  if ((nullptr != aad) && (1 != EVP_DecryptUpdate(ctx, nullptr, &len, aad, aad_len))) {
     throw ParquetException("Couldn't set AAD");
   }
 
   // Decryption
   if (!EVP_DecryptUpdate(
-          ctx_, plaintext, &len, ciphertext + length_buffer_length_ + kNonceLength,
+          ctx, plaintext, &len, ciphertext + length_buffer_length_ + kNonceLength,
           ciphertext_len - length_buffer_length_ - kNonceLength - kGcmTagLength)) {
     throw ParquetException("Failed decryption update");
   }
@@ -500,12 +577,12 @@ int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
   plaintext_len = len;
 
   // Checking the tag (authentication)
-  if (!EVP_CIPHER_CTX_ctrl(ctx_, EVP_CTRL_GCM_SET_TAG, kGcmTagLength, tag)) {
+  if (!EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, kGcmTagLength, tag)) {
     throw ParquetException("Failed authentication");
   }
 
   // Finalization
-  if (1 != EVP_DecryptFinal_ex(ctx_, plaintext + len, &len)) {
+  if (1 != EVP_DecryptFinal_ex(ctx, plaintext + len, &len)) {
     throw ParquetException("Failed decryption finalization");
   }
 
@@ -513,9 +590,11 @@ int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
   return plaintext_len;
 }
 
-int AesDecryptor::AesDecryptorImpl::CtrDecrypt(const uint8_t* ciphertext,
+int AesDecryptor::AesDecryptorImpl::CtrDecrypt(CipherContext* context,
+                                               const uint8_t* ciphertext,
                                                int ciphertext_len, const uint8_t* key,
                                                int key_len, uint8_t* plaintext) {
+  EVP_CIPHER_CTX* ctx = context->ctx;
   int len;
   int plaintext_len;
 
@@ -549,12 +628,10 @@ int AesDecryptor::AesDecryptorImpl::CtrDecrypt(const uint8_t* ciphertext,
   iv[kCtrIvLength - 1] = 1;
 
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, iv)) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+  InitContext(context, key, key_len, iv);
 
   // Decryption
-  if (!EVP_DecryptUpdate(ctx_, plaintext, &len,
+  if (!EVP_DecryptUpdate(ctx, plaintext, &len,
                          ciphertext + length_buffer_length_ + kNonceLength,
                          ciphertext_len - kNonceLength)) {
     throw ParquetException("Failed decryption update");
@@ -563,7 +640,7 @@ int AesDecryptor::AesDecryptorImpl::CtrDecrypt(const uint8_t* ciphertext,
   plaintext_len = len;
 
   // Finalization
-  if (1 != EVP_DecryptFinal_ex(ctx_, plaintext + len, &len)) {
+  if (1 != EVP_DecryptFinal_ex(ctx, plaintext + len, &len)) {
     throw ParquetException("Failed decryption finalization");
   }
 
@@ -581,11 +658,13 @@ int AesDecryptor::AesDecryptorImpl::Decrypt(const uint8_t* ciphertext, int ciphe
     throw ParquetException(ss.str());
   }
 
+  ScopedContext context(this, AcquireContext());
   if (kGcmMode == aes_mode_) {
-    return GcmDecrypt(ciphertext, ciphertext_len, key, key_len, aad, aad_len, plaintext);
+    return GcmDecrypt(context.get(), ciphertext, ciphertext_len, key, key_len, aad,
+                      aad_len, plaintext);
   }
 
-  return CtrDecrypt(ciphertext, ciphertext_len, key, key_len, plaintext);
+  return CtrDecrypt(context.get(), ciphertext, ciphertext_len, key, key_len, plaintext);
 }
 
 static std::string ShortToBytesLe(int16_t input) {
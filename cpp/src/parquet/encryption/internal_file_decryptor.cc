@@ -108,6 +108,7 @@ std::shared_ptr<Decryptor> InternalFileDecryptor::GetFooterDecryptorForColumnDat
 
 std::shared_ptr<Decryptor> InternalFileDecryptor::GetFooterDecryptor(
     const std::string& aad, bool metadata) {
+  std::lock_guard<std::mutex> lock(mutex_);
   if (metadata) {
     if (footer_metadata_decryptor_ != nullptr) return footer_metadata_decryptor_;
   } else {
@@ -166,20 +167,17 @@ std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnDataDecryptor(
 std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnDecryptor(
     const std::string& column_path, const std::string& column_key_metadata,
     const std::string& aad, bool metadata) {
+  std::lock_guard<std::mutex> lock(mutex_);
   std::string column_key;
-  // first look if we already got the decryptor from before
-  if (metadata) {
-    if (column_metadata_map_.find(column_path) != column_metadata_map_.end()) {
-      auto res(column_metadata_map_.at(column_path));
-      res->UpdateAad(aad);
-      return res;
-    }
-  } else {
-    if (column_data_map_.find(column_path) != column_data_map_.end()) {
-      auto res(column_data_map_.at(column_path));
-      res->UpdateAad(aad);
-      return res;
-    }
+  // first look if we already got the decryptor from before. Readers of different
+  // row groups may run concurrently, so each gets its own copy carrying its AAD;
+  // the copies share the underlying AES decryptor and its cipher contexts.
+  auto& decryptor_map = metadata ? column_metadata_map_ : column_data_map_;
+  auto it = decryptor_map.find(column_path);
+  if (it != decryptor_map.end()) {
+    auto res = std::make_shared<Decryptor>(*it->second);
+    res->UpdateAad(aad);
+    return res;
   }
 
   column_key = properties_->column_key(column_path);
@@ -211,8 +209,7 @@ std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnDecryptor(
   column_data_map_[column_path] =
       std::make_shared<Decryptor>(aes_data_decryptor, column_key, file_aad_, aad, pool_);
 
-  if (metadata) return column_metadata_map_[column_path];
-  return column_data_map_[column_path];
+  return std::make_shared<Decryptor>(*decryptor_map[column_path]);
 }
 
 }  // namespace parquet
@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <memory>
+#include <string>
+
+#include "arrow/io/memory.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "parquet/arrow/reader.h"
+#include "parquet/arrow/writer.h"
+#include "parquet/encryption/encryption.h"
+#include "parquet/file_reader.h"
+#include "parquet/platform.h"
+#include "parquet/properties.h"
+
+namespace parquet {
+namespace benchmark {
+
+// 16 bytes, for AES-128
+const char kFooterKey[] = "0123456789012345";
+
+constexpr int64_t kNumValues = 4 * 1024 * 1024;
+
+std::shared_ptr<Buffer> WriteInt64File(bool encrypted) {
+  ::arrow::random::RandomArrayGenerator rag(/*seed=*/42);
+  auto values = rag.Int64(kNumValues, /*min=*/0, /*max=*/1 << 20, /*null_prob=*/0.0);
+  auto table = ::arrow::Table::Make(
+      ::arrow::schema({::arrow::field("a", ::arrow::int64(), false)}), {values});
+
+  WriterProperties::Builder builder;
+  builder.compression(Compression::SNAPPY)->disable_dictionary();
+  if (encrypted) {
+    builder.encryption(FileEncryptionProperties::Builder(kFooterKey).build());
+  }
+  auto sink = CreateOutputStream();
+  ABORT_NOT_OK(::parquet::arrow::WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                            kNumValues / 4, builder.build()));
+  ASSIGN_OR_ABORT(auto buffer, sink->Finish());
+  return buffer;
+}
+
+// Arguments: whether the file is encrypted, and whether page prefetching is
+// enabled
+static void BM_ReadInt64Column(::benchmark::State& state) {
+  const bool encrypted = state.range(0) != 0;
+  const bool prefetch = state.range(1) != 0;
+  auto buffer = WriteInt64File(encrypted);
+
+  for (auto _ : state) {
+    ReaderProperties properties;
+    if (encrypted) {
+      // Decryption properties with explicit keys are good for a single file
+      properties.file_decryption_properties(
+          FileDecryptionProperties::Builder().footer_key(kFooterKey)->build());
+    }
+    if (prefetch) {
+      properties.enable_page_prefetch();
+    }
+    ::parquet::arrow::FileReaderBuilder builder;
+    ABORT_NOT_OK(
+        builder.Open(std::make_shared<::arrow::io::BufferReader>(buffer), properties));
+    std::unique_ptr<::parquet::arrow::FileReader> reader;
+    ABORT_NOT_OK(builder.Build(&reader));
+    std::shared_ptr<::arrow::Table> table;
+    ABORT_NOT_OK(reader->ReadTable(&table));
+  }
+  state.SetItemsProcessed(kNumValues * state.iterations());
+  state.SetBytesProcessed(kNumValues * state.iterations() * sizeof(int64_t));
+}
+
+BENCHMARK(BM_ReadInt64Column)
+    ->ArgNames({"encrypted", "prefetch"})
+    ->Args({0, 0})
+    ->Args({1, 0})
+    ->Args({0, 1})
+    ->Args({1, 1});
+
+}  // namespace benchmark
+}  // namespace parquet
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -32,7 +33,10 @@
 #include "arrow/util/future.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/stopwatch.h"
 #include "arrow/util/ubsan.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/bloom_filter_reader.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_scanner.h"
 #include "parquet/encryption/encryption_internal.h"
@@ -40,6 +44,7 @@
 #include "parquet/exception.h"
 #include "parquet/file_writer.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -116,6 +121,16 @@ std::shared_ptr<ColumnReader> RowGroupReader::ColumnWithExposeEncoding(
   return reader;
 }
 
+std::shared_ptr<BloomFilter> RowGroupReader::GetColumnBloomFilter(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnBloomFilter(i);
+}
+
 std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   if (i >= metadata()->num_columns()) {
     std::stringstream ss;
@@ -175,14 +190,16 @@ class SerializedRowGroup : public RowGroupReader::Contents {
                      std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source,
                      int64_t source_size, FileMetaData* file_metadata,
                      int row_group_number, const ReaderProperties& props,
-                     std::shared_ptr<InternalFileDecryptor> file_decryptor = nullptr)
+                     std::shared_ptr<InternalFileDecryptor> file_decryptor = nullptr,
+                     std::shared_ptr<BloomFilterReader> bloom_filter_reader = nullptr)
       : source_(std::move(source)),
         cached_source_(std::move(cached_source)),
         source_size_(source_size),
         file_metadata_(file_metadata),
         properties_(props),
         row_group_ordinal_(row_group_number),
-        file_decryptor_(file_decryptor) {
+        file_decryptor_(file_decryptor),
+        bloom_filter_reader_(std::move(bloom_filter_reader)) {
     row_group_metadata_ = file_metadata->RowGroup(row_group_number);
   }
 
@@ -190,6 +207,13 @@ class SerializedRowGroup : public RowGroupReader::Contents {
 
   const ReaderProperties* properties() const override { return &properties_; }
 
+  std::shared_ptr<BloomFilter> GetColumnBloomFilter(int i) override {
+    if (!bloom_filter_reader_) {
+      return nullptr;
+    }
+    return bloom_filter_reader_->RowGroup(row_group_ordinal_)->GetColumnBloomFilter(i);
+  }
+
   std::unique_ptr<PageReader> GetColumnPageReader(int i) override {
     // Read column chunk from the file
     auto col = row_group_metadata_->ColumnChunk(i);
@@ -197,21 +221,32 @@ class SerializedRowGroup : public RowGroupReader::Contents {
     ::arrow::io::ReadRange col_range =
         ComputeColumnChunkRange(file_metadata_, source_size_, row_group_ordinal_, i);
     std::shared_ptr<ArrowInputStream> stream;
+    const auto& metrics = properties_.metrics();
+    ::arrow::internal::StopWatch watch;
+    if (metrics) watch.Start();
     if (cached_source_) {
       // PARQUET-1698: if read coalescing is enabled, read from pre-buffered
       // segments.
       PARQUET_ASSIGN_OR_THROW(auto buffer, cached_source_->Read(col_range));
       stream = std::make_shared<::arrow::io::BufferReader>(buffer);
     } else {
+      if (source_->supports_zero_copy()) {
+        // Ask the OS to page in the whole column chunk (e.g. of a memory-mapped
+        // file) ahead of the page reads; errors are reported by the reads.
+        ARROW_UNUSED(source_->WillNeed({col_range}));
+      }
       stream = properties_.GetStream(source_, col_range.offset, col_range.length);
+      // Pre-buffered column chunks were counted when they were cached
+      if (metrics) metrics->bytes_requested += col_range.length;
     }
+    if (metrics) metrics->io_wait_ns += static_cast<int64_t>(watch.Stop());
 
     std::unique_ptr<ColumnCryptoMetaData> crypto_metadata = col->crypto_metadata();
 
     // Column is encrypted only if crypto_metadata exists.
     if (!crypto_metadata) {
       return PageReader::Open(stream, col->num_values(), col->compression(),
-                              properties_.memory_pool());
+                              properties_);
     }
 
     if (file_decryptor_ == nullptr) {
@@ -233,7 +268,7 @@ class SerializedRowGroup : public RowGroupReader::Contents {
       CryptoContext ctx(col->has_dictionary_page(), row_group_ordinal_,
                         static_cast<int16_t>(i), meta_decryptor, data_decryptor);
       return PageReader::Open(stream, col->num_values(), col->compression(),
-                              properties_.memory_pool(), &ctx);
+                              properties_, &ctx);
     }
 
     // The column is encrypted with its own key
@@ -247,8 +282,8 @@ class SerializedRowGroup : public RowGroupReader::Contents {
 
     CryptoContext ctx(col->has_dictionary_page(), row_group_ordinal_,
                       static_cast<int16_t>(i), meta_decryptor, data_decryptor);
-    return PageReader::Open(stream, col->num_values(), col->compression(),
-                            properties_.memory_pool(), &ctx);
+    return PageReader::Open(stream, col->num_values(), col->compression(), properties_,
+                            &ctx);
   }
 
  private:
@@ -261,6 +296,7 @@ class SerializedRowGroup : public RowGroupReader::Contents {
   ReaderProperties properties_;
   int row_group_ordinal_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
+  std::shared_ptr<BloomFilterReader> bloom_filter_reader_;
 };
 
 // ----------------------------------------------------------------------
@@ -289,9 +325,9 @@ class SerializedFile : public ParquetFileReader::Contents {
   }
 
   std::shared_ptr<RowGroupReader> GetRowGroup(int i) override {
-    std::unique_ptr<SerializedRowGroup> contents(
-        new SerializedRowGroup(source_, cached_source_, source_size_,
-                               file_metadata_.get(), i, properties_, file_decryptor_));
+    std::unique_ptr<SerializedRowGroup> contents(new SerializedRowGroup(
+        source_, cached_source_, source_size_, file_metadata_.get(), i, properties_,
+        file_decryptor_, GetBloomFilterReader()));
     return std::make_shared<RowGroupReader>(std::move(contents));
   }
 
@@ -301,6 +337,33 @@ class SerializedFile : public ParquetFileReader::Contents {
     file_metadata_ = std::move(metadata);
   }
 
+  std::shared_ptr<PageIndexReader> GetPageIndexReader() {
+    if (file_decryptor_) {
+      // Page indexes are never written for encrypted files
+      return nullptr;
+    }
+    if (!page_index_reader_) {
+      page_index_reader_ = PageIndexReader::Make(source_, file_metadata_, properties_);
+    }
+    return page_index_reader_;
+  }
+
+  const std::shared_ptr<ReaderMetrics>& metrics() const { return properties_.metrics(); }
+
+  std::shared_ptr<BloomFilterReader> GetBloomFilterReader() {
+    if (file_decryptor_) {
+      // Bloom filters of encrypted files are encrypted as well, which isn't
+      // supported yet
+      return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(bloom_filter_reader_mutex_);
+    if (!bloom_filter_reader_) {
+      bloom_filter_reader_ =
+          BloomFilterReader::Make(source_, file_metadata_, properties_);
+    }
+    return bloom_filter_reader_;
+  }
+
   void PreBuffer(const std::vector<int>& row_groups,
                  const std::vector<int>& column_indices,
                  const ::arrow::io::IOContext& ctx,
@@ -314,7 +377,15 @@ class SerializedFile : public ParquetFileReader::Contents {
             ComputeColumnChunkRange(file_metadata_.get(), source_size_, row, col));
       }
     }
+    int64_t bytes_requested = 0;
+    for (const auto& range : ranges) {
+      bytes_requested += range.length;
+    }
     PARQUET_THROW_NOT_OK(cached_source_->Cache(ranges));
+    if (const auto& metrics = properties_.metrics()) {
+      metrics->bytes_requested += bytes_requested;
+      metrics->bytes_wasted += cached_source_->stats().bytes_wasted;
+    }
   }
 
   ::arrow::Future<> WhenBuffered(const std::vector<int>& row_groups,
@@ -516,6 +587,9 @@ class SerializedFile : public ParquetFileReader::Contents {
   ReaderProperties properties_;
 
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
+  std::shared_ptr<PageIndexReader> page_index_reader_;
+  std::mutex bloom_filter_reader_mutex_;
+  std::shared_ptr<BloomFilterReader> bloom_filter_reader_;
 
   // \return The true length of the metadata in bytes
   uint32_t ParseUnencryptedFileMetadata(const std::shared_ptr<Buffer>& footer_buffer,
@@ -796,6 +870,27 @@ void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
   file->PreBuffer(row_groups, column_indices, ctx, options);
 }
 
+std::shared_ptr<BloomFilterReader> ParquetFileReader::GetBloomFilterReader() {
+  // Access private methods here
+  SerializedFile* file =
+      ::arrow::internal::checked_cast<SerializedFile*>(contents_.get());
+  return file->GetBloomFilterReader();
+}
+
+const std::shared_ptr<ReaderMetrics>& ParquetFileReader::metrics() const {
+  // Access private methods here
+  const SerializedFile* file =
+      ::arrow::internal::checked_cast<const SerializedFile*>(contents_.get());
+  return file->metrics();
+}
+
+std::shared_ptr<PageIndexReader> ParquetFileReader::GetPageIndexReader() {
+  // Access private methods here
+  SerializedFile* file =
+      ::arrow::internal::checked_cast<SerializedFile*>(contents_.get());
+  return file->GetPageIndexReader();
+}
+
 ::arrow::Future<> ParquetFileReader::WhenBuffered(
     const std::vector<int>& row_groups, const std::vector<int>& column_indices) const {
   // Access private methods here
@@ -30,8 +30,11 @@
 
 namespace parquet {
 
+class BloomFilter;
+class BloomFilterReader;
 class ColumnReader;
 class FileMetaData;
+class PageIndexReader;
 class PageReader;
 class RowGroupMetaData;
 
@@ -43,6 +46,7 @@ class PARQUET_EXPORT RowGroupReader {
   struct Contents {
     virtual ~Contents() {}
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
+    virtual std::shared_ptr<BloomFilter> GetColumnBloomFilter(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
   };
@@ -72,6 +76,11 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Returns the Bloom filter of the column chunk, or nullptr if it has none.
+  // Filters are cached by the ParquetFileReader, so this only reads the file
+  // on first access.
+  std::shared_ptr<BloomFilter> GetColumnBloomFilter(int i);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -133,6 +142,24 @@ class PARQUET_EXPORT ParquetFileReader {
   // Returns the file metadata. Only one instance is ever created
   std::shared_ptr<FileMetaData> metadata() const;
 
+  /// Return the reader of the page index (ColumnIndex and OffsetIndex) of
+  /// the file, or nullptr if the file is encrypted.
+  ///
+  /// Indexes are only read from the file when first accessed, so this is
+  /// cheap to call. Row groups written without a page index yield nullptr
+  /// from PageIndexReader::RowGroup().
+  std::shared_ptr<PageIndexReader> GetPageIndexReader();
+
+  /// Return the reader of the Bloom filters of the file, or nullptr if the
+  /// file is encrypted.
+  ///
+  /// Filters are only read from the file when first accessed, and are cached.
+  std::shared_ptr<BloomFilterReader> GetBloomFilterReader();
+
+  /// Return the metrics given by the ReaderProperties the file was opened with, or
+  /// nullptr if there are none.
+  const std::shared_ptr<ReaderMetrics>& metrics() const;
+
   /// Pre-buffer the specified column indices in all row groups.
   ///
   /// Readers can optionally call this to cache the necessary slices
@@ -18,12 +18,18 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <numeric>
+
 #include "arrow/testing/gtest_compat.h"
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
 #include "parquet/file_reader.h"
 #include "parquet/file_writer.h"
+#include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/test_util.h"
 #include "parquet/types.h"
@@ -425,6 +431,229 @@ TEST(TestBufferedRowGroupWriter, MultiPageDisabledDictionary) {
   }
 }
 
+class TestPageIndexRoundtrip : public ::testing::TestWithParam<bool> {};
+
+TEST_P(TestPageIndexRoundtrip, Int32Column) {
+  constexpr int kValueCount = 10000;
+  constexpr int kPageSize = 4096;
+  const bool buffered = GetParam();
+  auto sink = CreateOutputStream();
+  auto writer_props = parquet::WriterProperties::Builder()
+                          .disable_dictionary()
+                          ->data_pagesize(kPageSize)
+                          ->write_batch_size(256)
+                          ->enable_write_page_index()
+                          ->build();
+  schema::NodeVector fields;
+  fields.push_back(
+      PrimitiveNode::Make("col", parquet::Repetition::REQUIRED, parquet::Type::INT32));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  auto file_writer = parquet::ParquetFileWriter::Open(sink, schema, writer_props);
+  std::vector<int32_t> values(kValueCount);
+  std::iota(values.begin(), values.end(), 0);
+  for (int r = 0; r < 2; ++r) {
+    auto rg_writer =
+        buffered ? file_writer->AppendBufferedRowGroup() : file_writer->AppendRowGroup();
+    auto col_writer = static_cast<Int32Writer*>(buffered ? rg_writer->column(0)
+                                                         : rg_writer->NextColumn());
+    col_writer->WriteBatch(kValueCount, nullptr, nullptr, values.data());
+    rg_writer->Close();
+  }
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto source = std::make_shared<::arrow::io::BufferReader>(buffer);
+  auto file_reader = ParquetFileReader::Open(source);
+  auto page_index_reader = file_reader->GetPageIndexReader();
+  ASSERT_NE(page_index_reader, nullptr);
+  for (int r = 0; r < file_reader->metadata()->num_row_groups(); ++r) {
+    auto column_chunk = file_reader->metadata()->RowGroup(r)->ColumnChunk(0);
+    ASSERT_TRUE(column_chunk->GetColumnIndexLocation().has_value());
+    ASSERT_TRUE(column_chunk->GetOffsetIndexLocation().has_value());
+
+    auto rg_index_reader = page_index_reader->RowGroup(r);
+    ASSERT_NE(rg_index_reader, nullptr);
+    auto offset_index = rg_index_reader->GetOffsetIndex(0);
+    auto column_index = rg_index_reader->GetColumnIndex(0);
+    ASSERT_NE(offset_index, nullptr);
+    ASSERT_NE(column_index, nullptr);
+
+    const auto& locations = offset_index->page_locations();
+    ASSERT_GT(locations.size(), 1u);
+    ASSERT_EQ(static_cast<int>(locations.size()), column_index->num_pages());
+    EXPECT_EQ(column_chunk->data_page_offset(), locations[0].offset);
+    EXPECT_EQ(0, locations[0].first_row_index);
+    int64_t total_size = 0;
+    for (size_t i = 0; i < locations.size(); ++i) {
+      if (i > 0) {
+        EXPECT_EQ(locations[i - 1].offset + locations[i - 1].compressed_page_size,
+                  locations[i].offset);
+        EXPECT_GT(locations[i].first_row_index, locations[i - 1].first_row_index);
+      }
+      total_size += locations[i].compressed_page_size;
+
+      // Values are increasing, so the first row of a page is its minimum
+      ASSERT_FALSE(column_index->null_pages()[i]);
+      int32_t min_value, max_value;
+      ASSERT_EQ(sizeof(int32_t), column_index->encoded_min_values()[i].size());
+      ASSERT_EQ(sizeof(int32_t), column_index->encoded_max_values()[i].size());
+      std::memcpy(&min_value, column_index->encoded_min_values()[i].data(),
+                  sizeof(int32_t));
+      std::memcpy(&max_value, column_index->encoded_max_values()[i].data(),
+                  sizeof(int32_t));
+      EXPECT_EQ(locations[i].first_row_index, min_value);
+      const int64_t next_first_row = i + 1 < locations.size()
+                                         ? locations[i + 1].first_row_index
+                                         : kValueCount;
+      EXPECT_EQ(next_first_row - 1, max_value);
+      ASSERT_TRUE(column_index->has_null_counts());
+      EXPECT_EQ(0, column_index->null_counts()[i]);
+    }
+    EXPECT_EQ(column_chunk->total_compressed_size(), total_size);
+  }
+}
+
+TEST_P(TestPageIndexRoundtrip, Disabled) {
+  auto sink = CreateOutputStream();
+  schema::NodeVector fields;
+  fields.push_back(
+      PrimitiveNode::Make("col", parquet::Repetition::REQUIRED, parquet::Type::INT32));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  auto file_writer = parquet::ParquetFileWriter::Open(sink, schema);
+  auto rg_writer = GetParam() ? file_writer->AppendBufferedRowGroup()
+                              : file_writer->AppendRowGroup();
+  auto col_writer = static_cast<Int32Writer*>(GetParam() ? rg_writer->column(0)
+                                                         : rg_writer->NextColumn());
+  int32_t value = 42;
+  col_writer->WriteBatch(1, nullptr, nullptr, &value);
+  rg_writer->Close();
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto column_chunk = file_reader->metadata()->RowGroup(0)->ColumnChunk(0);
+  ASSERT_FALSE(column_chunk->GetColumnIndexLocation().has_value());
+  ASSERT_FALSE(column_chunk->GetOffsetIndexLocation().has_value());
+  ASSERT_EQ(file_reader->GetPageIndexReader()->RowGroup(0), nullptr);
+}
+
+INSTANTIATE_TEST_SUITE_P(Buffered, TestPageIndexRoundtrip, ::testing::Bool());
+
+class TestBloomFilterRoundtrip : public ::testing::TestWithParam<bool> {};
+
+TEST_P(TestBloomFilterRoundtrip, Columns) {
+  constexpr int kValueCount = 1000;
+  const bool buffered = GetParam();
+  auto sink = CreateOutputStream();
+  auto writer_props = parquet::WriterProperties::Builder()
+                          .write_batch_size(64)
+                          ->enable_bloom_filter("ints", BloomFilterOptions{100, 0.01})
+                          ->enable_bloom_filter("strings")
+                          ->build();
+  schema::NodeVector fields;
+  fields.push_back(
+      PrimitiveNode::Make("ints", parquet::Repetition::OPTIONAL, parquet::Type::INT32));
+  fields.push_back(PrimitiveNode::Make("strings", parquet::Repetition::REQUIRED,
+                                       parquet::Type::BYTE_ARRAY));
+  fields.push_back(PrimitiveNode::Make("no_filter", parquet::Repetition::REQUIRED,
+                                       parquet::Type::INT64));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  auto file_writer = parquet::ParquetFileWriter::Open(sink, schema, writer_props);
+
+  // Every third int is null, so that spaced writes skip them
+  std::vector<int32_t> ints(kValueCount);
+  std::vector<int16_t> def_levels(kValueCount);
+  std::vector<uint8_t> valid_bits(kValueCount / 8 + 1, 0);
+  std::vector<std::string> strings(kValueCount);
+  std::vector<ByteArray> byte_arrays(kValueCount);
+  std::vector<int64_t> int64s(kValueCount, 0);
+  for (int i = 0; i < kValueCount; ++i) {
+    ints[i] = i;
+    def_levels[i] = i % 3 == 0 ? 0 : 1;
+    if (def_levels[i]) ::arrow::bit_util::SetBit(valid_bits.data(), i);
+    strings[i] = "value" + std::to_string(i);
+    byte_arrays[i] = ByteArray(strings[i]);
+  }
+
+  auto rg_writer =
+      buffered ? file_writer->AppendBufferedRowGroup() : file_writer->AppendRowGroup();
+  auto next_column = [&](int i) {
+    return buffered ? rg_writer->column(i) : rg_writer->NextColumn();
+  };
+  static_cast<Int32Writer*>(next_column(0))
+      ->WriteBatchSpaced(kValueCount, def_levels.data(), nullptr, valid_bits.data(), 0,
+                         ints.data());
+  static_cast<ByteArrayWriter*>(next_column(1))
+      ->WriteBatch(kValueCount, nullptr, nullptr, byte_arrays.data());
+  static_cast<Int64Writer*>(next_column(2))
+      ->WriteBatch(kValueCount, nullptr, nullptr, int64s.data());
+  rg_writer->Close();
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto row_group_metadata = file_reader->metadata()->RowGroup(0);
+  ASSERT_TRUE(row_group_metadata->ColumnChunk(0)->bloom_filter_offset().has_value());
+  ASSERT_TRUE(row_group_metadata->ColumnChunk(1)->bloom_filter_offset().has_value());
+  ASSERT_FALSE(row_group_metadata->ColumnChunk(2)->bloom_filter_offset().has_value());
+
+  auto row_group_reader = file_reader->RowGroup(0);
+  ASSERT_EQ(nullptr, row_group_reader->GetColumnBloomFilter(2));
+  auto int_filter = row_group_reader->GetColumnBloomFilter(0);
+  auto string_filter = row_group_reader->GetColumnBloomFilter(1);
+  ASSERT_NE(nullptr, int_filter);
+  ASSERT_NE(nullptr, string_filter);
+  // Sized by the options, rather than the default NDV
+  EXPECT_EQ(BlockSplitBloomFilter::OptimalNumOfBits(100, 0.01) / 8,
+            int_filter->GetBitsetSize());
+  for (int i = 0; i < kValueCount; ++i) {
+    if (def_levels[i]) {
+      EXPECT_TRUE(int_filter->FindHash(int_filter->Hash(ints[i]))) << i;
+    }
+    EXPECT_TRUE(string_filter->FindHash(string_filter->Hash(&byte_arrays[i]))) << i;
+  }
+  // A sparse filter has few false positives
+  int false_positives = 0;
+  for (int i = kValueCount; i < 2 * kValueCount; ++i) {
+    const std::string absent = "value" + std::to_string(i);
+    ByteArray value(absent);
+    false_positives += string_filter->FindHash(string_filter->Hash(&value));
+  }
+  EXPECT_LT(false_positives, kValueCount / 100);
+}
+
+TEST_P(TestBloomFilterRoundtrip, Disabled) {
+  auto sink = CreateOutputStream();
+  schema::NodeVector fields;
+  fields.push_back(
+      PrimitiveNode::Make("col", parquet::Repetition::REQUIRED, parquet::Type::INT32));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  auto file_writer = parquet::ParquetFileWriter::Open(sink, schema);
+  auto rg_writer = GetParam() ? file_writer->AppendBufferedRowGroup()
+                              : file_writer->AppendRowGroup();
+  auto col_writer = static_cast<Int32Writer*>(GetParam() ? rg_writer->column(0)
+                                                         : rg_writer->NextColumn());
+  int32_t value = 42;
+  col_writer->WriteBatch(1, nullptr, nullptr, &value);
+  rg_writer->Close();
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto column_chunk = file_reader->metadata()->RowGroup(0)->ColumnChunk(0);
+  ASSERT_FALSE(column_chunk->bloom_filter_offset().has_value());
+  ASSERT_EQ(nullptr, file_reader->RowGroup(0)->GetColumnBloomFilter(0));
+}
+
+INSTANTIATE_TEST_SUITE_P(Buffered, TestBloomFilterRoundtrip, ::testing::Bool());
+
 TEST(ParquetRoundtrip, AllNulls) {
   auto primitive_node =
       PrimitiveNode::Make("nulls", Repetition::OPTIONAL, nullptr, Type::INT32);
@@ -27,6 +27,8 @@
 #include "parquet/encryption/encryption_internal.h"
 #include "parquet/encryption/internal_file_encryptor.h"
 #include "parquet/exception.h"
+#include "parquet/bloom_filter_builder.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
@@ -61,6 +63,10 @@ int64_t RowGroupWriter::total_bytes_written() const {
   return contents_->total_bytes_written();
 }
 
+int64_t RowGroupWriter::estimated_encoded_bytes() const {
+  return contents_->estimated_encoded_bytes();
+}
+
 int RowGroupWriter::current_column() { return contents_->current_column(); }
 
 int RowGroupWriter::num_columns() const { return contents_->num_columns(); }
@@ -82,7 +88,9 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   RowGroupSerializer(std::shared_ptr<ArrowOutputStream> sink,
                      RowGroupMetaDataBuilder* metadata, int16_t row_group_ordinal,
                      const WriterProperties* properties, bool buffered_row_group = false,
-                     InternalFileEncryptor* file_encryptor = nullptr)
+                     InternalFileEncryptor* file_encryptor = nullptr,
+                     PageIndexBuilder* page_index_builder = nullptr,
+                     BloomFilterBuilder* bloom_filter_builder = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
         properties_(properties),
@@ -92,7 +100,9 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
         next_column_index_(0),
         num_rows_(0),
         buffered_row_group_(buffered_row_group),
-        file_encryptor_(file_encryptor) {
+        file_encryptor_(file_encryptor),
+        page_index_builder_(page_index_builder),
+        bloom_filter_builder_(bloom_filter_builder) {
     if (buffered_row_group) {
       InitColumns();
     } else {
@@ -134,11 +144,14 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     auto data_encryptor =
         file_encryptor_ ? file_encryptor_->GetColumnDataEncryptor(path->ToDotString())
                         : nullptr;
+    const int column_ordinal = next_column_index_ - 1;
     std::unique_ptr<PageWriter> pager = PageWriter::Open(
         sink_, properties_->compression(path), properties_->compression_level(path),
-        col_meta, row_group_ordinal_, static_cast<int16_t>(next_column_index_ - 1),
-        properties_->memory_pool(), false, meta_encryptor, data_encryptor);
-    column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_);
+        col_meta, row_group_ordinal_, static_cast<int16_t>(column_ordinal),
+        properties_->memory_pool(), false, meta_encryptor, data_encryptor,
+        GetColumnIndexBuilder(column_ordinal), GetOffsetIndexBuilder(column_ordinal));
+    column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_,
+                                            GetBloomFilter(column_ordinal));
     return column_writers_[0].get();
   }
 
@@ -176,6 +189,19 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     return total_bytes_written;
   }
 
+  int64_t estimated_encoded_bytes() const override {
+    // Columns already closed in unbuffered mode are in total_bytes_written_
+    int64_t estimated_bytes = total_bytes_written_;
+    for (const auto& column_writer : column_writers_) {
+      if (column_writer) {
+        estimated_bytes += column_writer->total_bytes_written() +
+                           column_writer->total_compressed_bytes() +
+                           column_writer->EstimatedBufferedValueBytes();
+      }
+    }
+    return estimated_bytes;
+  }
+
   void Close() override {
     if (!closed_) {
       closed_ = true;
@@ -207,6 +233,23 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   mutable int64_t num_rows_;
   bool buffered_row_group_;
   InternalFileEncryptor* file_encryptor_;
+  PageIndexBuilder* page_index_builder_;
+  BloomFilterBuilder* bloom_filter_builder_;
+
+  ColumnIndexBuilder* GetColumnIndexBuilder(int column_ordinal) const {
+    if (page_index_builder_ == nullptr) return nullptr;
+    return page_index_builder_->GetColumnIndexBuilder(column_ordinal);
+  }
+
+  OffsetIndexBuilder* GetOffsetIndexBuilder(int column_ordinal) const {
+    if (page_index_builder_ == nullptr) return nullptr;
+    return page_index_builder_->GetOffsetIndexBuilder(column_ordinal);
+  }
+
+  BloomFilter* GetBloomFilter(int column_ordinal) const {
+    if (bloom_filter_builder_ == nullptr) return nullptr;
+    return bloom_filter_builder_->GetOrCreateBloomFilter(column_ordinal);
+  }
 
   void CheckRowsWritten() const {
     // verify when only one column is written at a time
@@ -240,13 +283,16 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
       auto data_encryptor =
           file_encryptor_ ? file_encryptor_->GetColumnDataEncryptor(path->ToDotString())
                           : nullptr;
+      const int column_ordinal = next_column_index_++;
       std::unique_ptr<PageWriter> pager = PageWriter::Open(
           sink_, properties_->compression(path), properties_->compression_level(path),
           col_meta, static_cast<int16_t>(row_group_ordinal_),
-          static_cast<int16_t>(next_column_index_++), properties_->memory_pool(),
-          buffered_row_group_, meta_encryptor, data_encryptor);
-      column_writers_.push_back(
-          ColumnWriter::Make(col_meta, std::move(pager), properties_));
+          static_cast<int16_t>(column_ordinal), properties_->memory_pool(),
+          buffered_row_group_, meta_encryptor, data_encryptor,
+          GetColumnIndexBuilder(column_ordinal), GetOffsetIndexBuilder(column_ordinal));
+      column_writers_.push_back(ColumnWriter::Make(col_meta, std::move(pager),
+                                                   properties_,
+                                                   GetBloomFilter(column_ordinal)));
     }
   }
 
@@ -287,6 +333,8 @@ class FileSerializer : public ParquetFileWriter::Contents {
       auto file_encryption_properties = properties_->file_encryption_properties();
 
       if (file_encryption_properties == nullptr) {  // Non encrypted file.
+        WriteBloomFilter();
+        WritePageIndex();
         file_metadata_ = metadata_->Finish();
         WriteFileMetaData(*file_metadata_, sink_.get());
       } else {  // Encrypted file
@@ -311,9 +359,16 @@ class FileSerializer : public ParquetFileWriter::Contents {
     }
     num_row_groups_++;
     auto rg_metadata = metadata_->AppendRowGroup();
+    if (page_index_builder_) {
+      page_index_builder_->AppendRowGroup();
+    }
+    if (bloom_filter_builder_) {
+      bloom_filter_builder_->AppendRowGroup();
+    }
     std::unique_ptr<RowGroupWriter::Contents> contents(new RowGroupSerializer(
         sink_, rg_metadata, static_cast<int16_t>(num_row_groups_ - 1), properties_.get(),
-        buffered_row_group, file_encryptor_.get()));
+        buffered_row_group, file_encryptor_.get(), page_index_builder_.get(),
+        bloom_filter_builder_.get()));
     row_group_writer_.reset(new RowGroupWriter(std::move(contents)));
     return row_group_writer_.get();
   }
@@ -347,6 +402,33 @@ class FileSerializer : public ParquetFileWriter::Contents {
     } else {
       throw ParquetException("Appending to file not implemented.");
     }
+    // The page index is not encrypted, so don't leak statistics of encrypted files
+    if (properties_->page_index_enabled() &&
+        properties_->file_encryption_properties() == nullptr) {
+      page_index_builder_ = PageIndexBuilder::Make(&schema_);
+    }
+    // Likewise, Bloom filters are not encrypted
+    if (properties_->file_encryption_properties() == nullptr) {
+      bloom_filter_builder_ = BloomFilterBuilder::Make(&schema_, properties_.get());
+    }
+  }
+
+  // Write the Bloom filters between the last row group and the page index
+  void WriteBloomFilter() {
+    if (bloom_filter_builder_ != nullptr) {
+      BloomFilterLocation bloom_filter_location;
+      bloom_filter_builder_->WriteTo(sink_.get(), &bloom_filter_location);
+      metadata_->SetBloomFilterLocation(bloom_filter_location);
+    }
+  }
+
+  // Write the page index between the last row group and the footer
+  void WritePageIndex() {
+    if (page_index_builder_ != nullptr) {
+      PageIndexLocation page_index_location;
+      page_index_builder_->WriteTo(sink_.get(), &page_index_location);
+      metadata_->SetPageIndexLocation(page_index_location);
+    }
   }
 
   void CloseEncryptedFile(FileEncryptionProperties* file_encryption_properties) {
@@ -388,6 +470,8 @@ class FileSerializer : public ParquetFileWriter::Contents {
   std::unique_ptr<RowGroupWriter> row_group_writer_;
 
   std::unique_ptr<InternalFileEncryptor> file_encryptor_;
+  std::unique_ptr<PageIndexBuilder> page_index_builder_;
+  std::unique_ptr<BloomFilterBuilder> bloom_filter_builder_;
 
   void StartFile() {
     auto file_encryption_properties = properties_->file_encryption_properties();
@@ -56,6 +56,8 @@ class PARQUET_EXPORT RowGroupWriter {
     virtual int64_t total_bytes_written() const = 0;
     // total bytes still compressed but not written
     virtual int64_t total_compressed_bytes() const = 0;
+    // estimated encoded size of all the rows written so far
+    virtual int64_t estimated_encoded_bytes() const = 0;
   };
 
   explicit RowGroupWriter(std::unique_ptr<Contents> contents);
@@ -91,6 +93,13 @@ class PARQUET_EXPORT RowGroupWriter {
   int64_t total_bytes_written() const;
   int64_t total_compressed_bytes() const;
 
+  /// \brief Estimated encoded size of the rows written to this row group so
+  /// far, across all columns
+  ///
+  /// This counts the pages already written or buffered and the values that
+  /// are not in a page yet, but not a pending dictionary page.
+  int64_t estimated_encoded_bytes() const;
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
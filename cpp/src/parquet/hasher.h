@@ -66,6 +66,41 @@ class Hasher {
   /// @param len the value length.
   virtual uint64_t Hash(const FLBA* value, uint32_t len) const = 0;
 
+  /// Compute hashes of a batch of values, as Hash() does for each of them.
+  ///
+  /// @param values the values to hash.
+  /// @param num_values the number of values.
+  /// @param hashes the output, with room for num_values hashes.
+  virtual void Hashes(const int32_t* values, int num_values, uint64_t* hashes) const {
+    for (int i = 0; i < num_values; ++i) hashes[i] = Hash(values[i]);
+  }
+
+  virtual void Hashes(const int64_t* values, int num_values, uint64_t* hashes) const {
+    for (int i = 0; i < num_values; ++i) hashes[i] = Hash(values[i]);
+  }
+
+  virtual void Hashes(const float* values, int num_values, uint64_t* hashes) const {
+    for (int i = 0; i < num_values; ++i) hashes[i] = Hash(values[i]);
+  }
+
+  virtual void Hashes(const double* values, int num_values, uint64_t* hashes) const {
+    for (int i = 0; i < num_values; ++i) hashes[i] = Hash(values[i]);
+  }
+
+  virtual void Hashes(const Int96* values, int num_values, uint64_t* hashes) const {
+    for (int i = 0; i < num_values; ++i) hashes[i] = Hash(&values[i]);
+  }
+
+  virtual void Hashes(const ByteArray* values, int num_values, uint64_t* hashes) const {
+    for (int i = 0; i < num_values; ++i) hashes[i] = Hash(&values[i]);
+  }
+
+  /// @param len the length of each fixed byte array value.
+  virtual void Hashes(const FLBA* values, uint32_t len, int num_values,
+                      uint64_t* hashes) const {
+    for (int i = 0; i < num_values; ++i) hashes[i] = Hash(&values[i], len);
+  }
+
   virtual ~Hasher() = default;
 };
 
@@ -38,6 +38,47 @@ namespace {
 using ::arrow::internal::CpuInfo;
 using ::arrow::util::optional;
 
+// Number of levels converted at a time by DefRepLevelsToListBlock.
+constexpr int64_t kListBlockSize = 64;
+
+// Branch-free conversion of kListBlockSize levels.  |*current_offset| is the
+// current (cumulative) list offset and |*num_lists| the number of lists started
+// so far; offsets[*num_lists] is kept equal to |*current_offset|.  Returns the
+// validity bits of the lists started in this block.
+//
+// The caller guarantees that neither the offset type nor the output bound can
+// overflow within the block, so no checks are performed.
+template <bool kHasOffsets, typename OffsetType>
+uint64_t DefRepLevelsToListBlock(const int16_t* def_levels, const int16_t* rep_levels,
+                                 const LevelInfo& level_info, OffsetType* offsets,
+                                 OffsetType* current_offset, int64_t* num_lists) {
+  uint64_t validity = 0;
+  int64_t lists = *num_lists;
+  int64_t block_lists = 0;
+  OffsetType current = *current_offset;
+  for (int64_t x = 0; x < kListBlockSize; x++) {
+    // Items belonging to empty or null ancestor lists and further nested lists
+    // are skipped.
+    const bool included = (def_levels[x] >= level_info.repeated_ancestor_def_level) &
+                          (rep_levels[x] <= level_info.rep_level);
+    const bool starts_list = included & (rep_levels[x] < level_info.rep_level);
+    const bool continues_list = included & (rep_levels[x] == level_info.rep_level);
+    const bool has_element = def_levels[x] >= level_info.def_level;
+    const bool is_valid = def_levels[x] >= level_info.def_level - 1;
+
+    validity |= static_cast<uint64_t>(starts_list & is_valid) << block_lists;
+    block_lists += starts_list;
+    if (kHasOffsets) {
+      lists += starts_list;
+      current += static_cast<OffsetType>(continues_list | (starts_list & has_element));
+      offsets[lists] = current;
+    }
+  }
+  *num_lists += block_lists;
+  *current_offset = current;
+  return validity;
+}
+
 template <typename OffsetType>
 void DefRepLevelsToListInfo(const int16_t* def_levels, const int16_t* rep_levels,
                             int64_t num_def_levels, LevelInfo level_info,
@@ -48,7 +89,39 @@ void DefRepLevelsToListInfo(const int16_t* def_levels, const int16_t* rep_levels
     valid_bits_writer.emplace(output->valid_bits, output->valid_bits_offset,
                               output->values_read_upper_bound);
   }
-  for (int x = 0; x < num_def_levels; x++) {
+
+  // Convert whole blocks without branches as long as no block can exceed the
+  // output bound or overflow the offsets, then finish with the checked loop.
+  int64_t x = 0;
+  int64_t num_lists = 0;
+  OffsetType current_offset = offsets != nullptr ? *offsets : 0;
+  while (num_def_levels - x >= kListBlockSize &&
+         num_lists + kListBlockSize <= output->values_read_upper_bound &&
+         std::numeric_limits<OffsetType>::max() - current_offset >= kListBlockSize) {
+    const int64_t block_start_lists = num_lists;
+    uint64_t validity;
+    if (offsets != nullptr) {
+      validity = DefRepLevelsToListBlock</*kHasOffsets=*/true>(
+          def_levels + x, rep_levels + x, level_info, orig_pos, &current_offset,
+          &num_lists);
+    } else {
+      validity = DefRepLevelsToListBlock</*kHasOffsets=*/false>(
+          def_levels + x, rep_levels + x, level_info, orig_pos, &current_offset,
+          &num_lists);
+    }
+    if (valid_bits_writer.has_value()) {
+      const int64_t block_lists = num_lists - block_start_lists;
+      output->null_count +=
+          block_lists - static_cast<int64_t>(::arrow::bit_util::PopCount(validity));
+      valid_bits_writer->AppendWord(validity, block_lists);
+    }
+    x += kListBlockSize;
+  }
+  if (offsets != nullptr) {
+    offsets = orig_pos + num_lists;
+  }
+
+  for (; x < num_def_levels; x++) {
     // Skip items that belong to empty or null ancestor lists and further nested lists.
     if (def_levels[x] < level_info.repeated_ancestor_def_level ||
         rep_levels[x] > level_info.rep_level) {
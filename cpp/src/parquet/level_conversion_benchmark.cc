@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <random>
 #include <vector>
 
 #include "benchmark/benchmark.h"
@@ -78,3 +79,45 @@ void BM_DefinitionLevelsToBitmapRepeatedMostPresent(::benchmark::State& state) {
 }
 
 BENCHMARK(BM_DefinitionLevelsToBitmapRepeatedMostPresent);
+
+// Converts the levels of a nullable list<nullable int> column whose lists hold
+// |average_list_length| elements on average.
+void BM_DefRepLevelsToList(::benchmark::State& state) {
+  const int64_t average_list_length = state.range(0);
+  std::default_random_engine gen(/*seed=*/42);
+  std::uniform_int_distribution<int64_t> starts_list(0, average_list_length - 1);
+  std::uniform_int_distribution<int> def_level(0, 9);
+
+  std::vector<int16_t> def_levels(kLevelCount);
+  std::vector<int16_t> rep_levels(kLevelCount);
+  for (int64_t x = 0; x < kLevelCount; x++) {
+    rep_levels[x] = (x == 0 || starts_list(gen) == 0) ? 0 : kHasRepeatedElements;
+    // Mostly present elements, with the occasional null list or element.
+    const int level = def_level(gen);
+    if (level == 0 && rep_levels[x] == 0) {
+      def_levels[x] = 0;
+    } else {
+      def_levels[x] = level == 1 ? 2 : 3;
+    }
+  }
+
+  parquet::internal::LevelInfo info;
+  info.rep_level = 1;
+  info.def_level = 2;
+  info.repeated_ancestor_def_level = 0;
+  std::vector<uint8_t> bitmap(/*count=*/kLevelCount / 8 + 1, 0);
+  std::vector<int32_t> offsets(/*count=*/kLevelCount + 1, 0);
+  for (auto _ : state) {
+    parquet::internal::ValidityBitmapInputOutput validity_io;
+    validity_io.values_read_upper_bound = kLevelCount;
+    validity_io.valid_bits = bitmap.data();
+    parquet::internal::DefRepLevelsToList(def_levels.data(), rep_levels.data(),
+                                          kLevelCount, info, &validity_io,
+                                          offsets.data());
+    ::benchmark::DoNotOptimize(validity_io.values_read);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kLevelCount * 2 *
+                          sizeof(int16_t));
+}
+
+BENCHMARK(BM_DefRepLevelsToList)->Arg(1)->Arg(4)->Arg(32);
@@ -315,6 +315,60 @@ TYPED_TEST(NestedListTest, SimpleLongList) {
             "1");
 }
 
+TYPED_TEST(NestedListTest, LongInputMatchesLevelByLevel) {
+  // Long inputs are converted in branch-free blocks; converting one level at a
+  // time only uses the checked loop, so both must agree.
+  using OffsetsType = typename TypeParam::OffsetsType;
+  constexpr int kRepeats = 50;
+  MultiLevelTestData test_data;
+  for (int i = 0; i < kRepeats; i++) {
+    MultiLevelTestData row = TriplyNestedList();
+    test_data.def_levels.insert(test_data.def_levels.end(), row.def_levels.begin(),
+                                row.def_levels.end());
+    test_data.rep_levels.insert(test_data.rep_levels.end(), row.rep_levels.begin(),
+                                row.rep_levels.end());
+  }
+
+  struct Case {
+    int16_t rep_level;
+    int16_t def_level;
+    int16_t repeated_ancestor_def_level;
+    int num_lists;
+  };
+  for (const Case& c : {Case{1, 2, 0, 4}, Case{2, 4, 2, 7}, Case{3, 6, 4, 6}}) {
+    LevelInfo level_info;
+    level_info.rep_level = c.rep_level;
+    level_info.def_level = c.def_level;
+    level_info.repeated_ancestor_def_level = c.repeated_ancestor_def_level;
+    const int length = c.num_lists * kRepeats;
+
+    this->validity_io_ = ValidityBitmapInputOutput();
+    this->InitForLength(length);
+    this->Run(test_data, level_info);
+    EXPECT_EQ(this->validity_io_.values_read, length);
+
+    std::vector<uint8_t> expected_bits(length, 0);
+    std::vector<OffsetsType> expected_offsets(length + 1, 0);
+    ValidityBitmapInputOutput expected_io;
+    expected_io.valid_bits = expected_bits.data();
+    int64_t values_read = 0;
+    for (size_t x = 0; x < test_data.def_levels.size(); x++) {
+      expected_io.valid_bits_offset = values_read;
+      expected_io.values_read_upper_bound = length - values_read;
+      DefRepLevelsToList(&test_data.def_levels[x], &test_data.rep_levels[x],
+                         /*num_def_levels=*/1, level_info, &expected_io,
+                         expected_offsets.data() + values_read);
+      values_read += expected_io.values_read;
+    }
+
+    ASSERT_EQ(values_read, length);
+    EXPECT_EQ(this->validity_io_.null_count, expected_io.null_count);
+    EXPECT_THAT(this->offsets_, ElementsAreArray(expected_offsets));
+    EXPECT_EQ(BitmapToString(this->validity_bits_, length),
+              BitmapToString(expected_bits, length));
+  }
+}
+
 TYPED_TEST(NestedListTest, TestOverflow) {
   LevelInfo level_info;
   level_info.rep_level = 1;
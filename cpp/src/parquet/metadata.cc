@@ -19,8 +19,11 @@
 
 #include <algorithm>
 #include <cinttypes>
+#include <list>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -294,6 +297,36 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
     return column_metadata_->total_uncompressed_size;
   }
 
+  ::arrow::util::optional<IndexLocation> GetColumnIndexLocation() const {
+    if (column_->__isset.column_index_offset && column_->__isset.column_index_length) {
+      return MakeIndexLocation(column_->column_index_offset,
+                               column_->column_index_length);
+    }
+    return ::arrow::util::nullopt;
+  }
+
+  ::arrow::util::optional<IndexLocation> GetOffsetIndexLocation() const {
+    if (column_->__isset.offset_index_offset && column_->__isset.offset_index_length) {
+      return MakeIndexLocation(column_->offset_index_offset,
+                               column_->offset_index_length);
+    }
+    return ::arrow::util::nullopt;
+  }
+
+  ::arrow::util::optional<int64_t> bloom_filter_offset() const {
+    if (column_metadata_->__isset.bloom_filter_offset) {
+      return column_metadata_->bloom_filter_offset;
+    }
+    return ::arrow::util::nullopt;
+  }
+
+  static IndexLocation MakeIndexLocation(int64_t offset, int32_t length) {
+    if (offset < 0 || length <= 0) {
+      throw ParquetException("Invalid page index location");
+    }
+    return {offset, length};
+  }
+
   inline std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const {
     if (column_->__isset.crypto_metadata) {
       return ColumnCryptoMetaData::Make(
@@ -411,10 +444,326 @@ std::unique_ptr<ColumnCryptoMetaData> ColumnChunkMetaData::crypto_metadata() con
   return impl_->crypto_metadata();
 }
 
+::arrow::util::optional<IndexLocation> ColumnChunkMetaData::GetColumnIndexLocation()
+    const {
+  return impl_->GetColumnIndexLocation();
+}
+
+::arrow::util::optional<IndexLocation> ColumnChunkMetaData::GetOffsetIndexLocation()
+    const {
+  return impl_->GetOffsetIndexLocation();
+}
+
+::arrow::util::optional<int64_t> ColumnChunkMetaData::bloom_filter_offset() const {
+  return impl_->bloom_filter_offset();
+}
+
 bool ColumnChunkMetaData::Equals(const ColumnChunkMetaData& other) const {
   return impl_->Equals(*other.impl_);
 }
 
+namespace {
+
+// Thrift compact protocol type ids
+constexpr uint8_t kCompactBooleanTrue = 1;
+constexpr uint8_t kCompactBooleanFalse = 2;
+constexpr uint8_t kCompactByte = 3;
+constexpr uint8_t kCompactI16 = 4;
+constexpr uint8_t kCompactI32 = 5;
+constexpr uint8_t kCompactI64 = 6;
+constexpr uint8_t kCompactDouble = 7;
+constexpr uint8_t kCompactBinary = 8;
+constexpr uint8_t kCompactList = 9;
+constexpr uint8_t kCompactSet = 10;
+constexpr uint8_t kCompactMap = 11;
+constexpr uint8_t kCompactStruct = 12;
+
+// Field ids of the lists that are decoded lazily
+constexpr int16_t kFileMetaDataRowGroupsField = 4;
+constexpr int16_t kRowGroupColumnsField = 1;
+
+// Walks a struct serialized with the Thrift compact protocol without
+// deserializing it, so that nested structs can be located and decoded later.
+class ThriftCompactScanner {
+ public:
+  ThriftCompactScanner(const uint8_t* data, uint32_t size) : data_(data), size_(size) {}
+
+  uint32_t position() const { return position_; }
+
+  // Read the header of the next field of the current struct.  Returns false
+  // when the end of the struct is reached.
+  bool ReadFieldHeader(int16_t* field_id, uint8_t* type) {
+    const uint8_t header = ReadByte();
+    if (header == 0) {
+      return false;
+    }
+    *type = header & 0x0F;
+    const int16_t delta = header >> 4;
+    if (delta != 0) {
+      *field_id = static_cast<int16_t>(*field_id + delta);
+    } else {
+      const uint64_t zigzag = ReadVarint();
+      *field_id = static_cast<int16_t>((zigzag >> 1) ^ (~(zigzag & 1) + 1));
+    }
+    return true;
+  }
+
+  // Read the header of a list or set, returning its number of elements
+  int64_t ReadListHeader(uint8_t* element_type) {
+    const uint8_t header = ReadByte();
+    *element_type = header & 0x0F;
+    uint64_t size = header >> 4;
+    if (size == 15) {
+      size = ReadVarint();
+    }
+    // Every element takes at least one byte
+    if (size > size_ - position_) {
+      Fail("list size exceeds the remaining bytes");
+    }
+    return static_cast<int64_t>(size);
+  }
+
+  void Skip(uint8_t type, bool in_container = false, int depth = 0) {
+    if (depth > kMaxDepth) {
+      Fail("maximum nesting depth exceeded");
+    }
+    switch (type) {
+      case kCompactBooleanTrue:
+      case kCompactBooleanFalse:
+        // Booleans are stored in the field header, but take a byte in containers
+        if (in_container) Advance(1);
+        return;
+      case kCompactByte:
+        Advance(1);
+        return;
+      case kCompactI16:
+      case kCompactI32:
+      case kCompactI64:
+        ReadVarint();
+        return;
+      case kCompactDouble:
+        Advance(8);
+        return;
+      case kCompactBinary:
+        Advance(ReadVarint());
+        return;
+      case kCompactList:
+      case kCompactSet: {
+        uint8_t element_type;
+        const int64_t size = ReadListHeader(&element_type);
+        for (int64_t i = 0; i < size; ++i) {
+          Skip(element_type, true, depth + 1);
+        }
+        return;
+      }
+      case kCompactMap: {
+        const uint64_t size = ReadVarint();
+        if (size == 0) return;
+        const uint8_t types = ReadByte();
+        if (size > size_ - position_) {
+          Fail("map size exceeds the remaining bytes");
+        }
+        for (uint64_t i = 0; i < size; ++i) {
+          Skip(types >> 4, true, depth + 1);
+          Skip(types & 0x0F, true, depth + 1);
+        }
+        return;
+      }
+      case kCompactStruct: {
+        int16_t field_id = 0;
+        uint8_t field_type;
+        while (ReadFieldHeader(&field_id, &field_type)) {
+          Skip(field_type, false, depth + 1);
+        }
+        return;
+      }
+      default:
+        Fail("unknown type");
+    }
+  }
+
+ private:
+  static constexpr int kMaxDepth = 64;
+
+  [[noreturn]] static void Fail(const char* message) {
+    throw ParquetException("Couldn't deserialize thrift: ", message);
+  }
+
+  void Advance(uint64_t length) {
+    if (length > size_ - position_) {
+      Fail("unexpected end of buffer");
+    }
+    position_ += static_cast<uint32_t>(length);
+  }
+
+  uint8_t ReadByte() {
+    if (position_ >= size_) {
+      Fail("unexpected end of buffer");
+    }
+    return data_[position_++];
+  }
+
+  uint64_t ReadVarint() {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      const uint8_t byte = ReadByte();
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        return value;
+      }
+    }
+    Fail("variable-length integer is too long");
+  }
+
+  const uint8_t* data_;
+  const uint32_t size_;
+  uint32_t position_ = 0;
+};
+
+// Location of the elements of a list<struct> field in a serialized struct
+struct ThriftListLocation {
+  bool found = false;
+  // Offsets of the list header and of the end of its last element
+  uint32_t begin = 0;
+  uint32_t end = 0;
+  // Offset and length of each element
+  std::vector<std::pair<uint32_t, uint32_t>> elements;
+};
+
+// Scan the struct serialized at the start of `data` and locate the elements of
+// its list<struct> field `field_id`.  Returns the serialized length of the struct.
+uint32_t LocateStructList(const uint8_t* data, uint32_t size, int16_t field_id,
+                          int32_t container_size_limit, ThriftListLocation* out) {
+  ThriftCompactScanner scanner(data, size);
+  int16_t current_id = 0;
+  uint8_t type;
+  while (scanner.ReadFieldHeader(&current_id, &type)) {
+    if (current_id != field_id || type != kCompactList || out->found) {
+      scanner.Skip(type);
+      continue;
+    }
+    out->found = true;
+    out->begin = scanner.position();
+    uint8_t element_type;
+    const int64_t num_elements = scanner.ReadListHeader(&element_type);
+    if (element_type != kCompactStruct || num_elements > container_size_limit) {
+      throw ParquetException("Couldn't deserialize thrift: invalid list of structs");
+    }
+    out->elements.reserve(static_cast<size_t>(num_elements));
+    for (int64_t i = 0; i < num_elements; ++i) {
+      const uint32_t element_begin = scanner.position();
+      scanner.Skip(kCompactStruct);
+      out->elements.emplace_back(element_begin, scanner.position() - element_begin);
+    }
+    out->end = scanner.position();
+  }
+  return scanner.position();
+}
+
+// Copy a serialized struct, replacing the located list by an empty one so that
+// the struct can be deserialized without decoding the list elements.
+std::string WithEmptyList(const uint8_t* data, uint32_t size,
+                          const ThriftListLocation& list) {
+  const char* chars = reinterpret_cast<const char*>(data);
+  std::string out;
+  out.reserve(size - (list.end - list.begin) + 1);
+  out.append(chars, list.begin);
+  // Compact list header of an empty list<struct>
+  out.push_back(static_cast<char>(kCompactStruct));
+  out.append(chars + list.end, size - list.end);
+  return out;
+}
+
+// A RowGroup of a lazily decoded footer.  Its own fields are decoded on first
+// access, and each of its ColumnChunks only once it is requested.  The
+// serialized bytes must outlive this object.
+class LazyRowGroup {
+ public:
+  LazyRowGroup(const uint8_t* data, uint32_t size, const ReaderProperties& properties)
+      : data_(data),
+        size_(size),
+        container_size_limit_(properties.thrift_container_size_limit()),
+        deserializer_(properties) {}
+
+  // The RowGroup with default-constructed ColumnChunks for those not decoded yet
+  const format::RowGroup* row_group() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DecodeRowGroup();
+    return &row_group_;
+  }
+
+  const format::ColumnChunk* column(int i) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DecodeRowGroup();
+    DecodeColumn(i);
+    return &row_group_.columns[i];
+  }
+
+  // Decode all ColumnChunks and return the complete RowGroup
+  const format::RowGroup& Decode() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DecodeRowGroup();
+    for (int i = 0; i < static_cast<int>(row_group_.columns.size()); ++i) {
+      DecodeColumn(i);
+    }
+    return row_group_;
+  }
+
+  void set_file_path(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DecodeRowGroup();
+    for (int i = 0; i < static_cast<int>(row_group_.columns.size()); ++i) {
+      DecodeColumn(i);
+      row_group_.columns[i].__set_file_path(path);
+    }
+  }
+
+ private:
+  void DecodeRowGroup() {
+    if (decoded_) return;
+    if (!LocateColumns()) {
+      // Malformed row group, let the regular decoder report it
+      uint32_t len = size_;
+      deserializer_.DeserializeMessage(data_, &len, &row_group_);
+      column_decoded_.assign(row_group_.columns.size(), true);
+    }
+    decoded_ = true;
+  }
+
+  bool LocateColumns() {
+    LocateStructList(data_, size_, kRowGroupColumnsField, container_size_limit_,
+                     &columns_);
+    if (!columns_.found) return false;
+    const std::string stripped = WithEmptyList(data_, size_, columns_);
+    uint32_t len = static_cast<uint32_t>(stripped.size());
+    deserializer_.DeserializeMessage(reinterpret_cast<const uint8_t*>(stripped.data()),
+                                     &len, &row_group_);
+    row_group_.columns.resize(columns_.elements.size());
+    column_decoded_.assign(columns_.elements.size(), false);
+    return true;
+  }
+
+  void DecodeColumn(int i) {
+    if (column_decoded_[i]) return;
+    uint32_t len = columns_.elements[i].second;
+    deserializer_.DeserializeMessage(data_ + columns_.elements[i].first, &len,
+                                     &row_group_.columns[i]);
+    column_decoded_[i] = true;
+  }
+
+  const uint8_t* data_;
+  const uint32_t size_;
+  const int32_t container_size_limit_;
+  ThriftDeserializer deserializer_;
+  std::mutex mutex_;
+  bool decoded_ = false;
+  format::RowGroup row_group_;
+  ThriftListLocation columns_;
+  std::vector<bool> column_decoded_;
+};
+
+}  // namespace
+
 // row-group metadata
 class RowGroupMetaData::RowGroupMetaDataImpl {
  public:
@@ -430,6 +779,8 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
         file_decryptor_(std::move(file_decryptor)) {}
 
   bool Equals(const RowGroupMetaDataImpl& other) const {
+    if (lazy_row_group_ != nullptr) lazy_row_group_->Decode();
+    if (other.lazy_row_group_ != nullptr) other.lazy_row_group_->Decode();
     return *row_group_ == *other.row_group_;
   }
 
@@ -449,7 +800,10 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
 
   std::unique_ptr<ColumnChunkMetaData> ColumnChunk(int i) {
     if (i < num_columns()) {
-      return ColumnChunkMetaData::Make(&row_group_->columns[i], schema_->Column(i),
+      const format::ColumnChunk* column = lazy_row_group_ != nullptr
+                                              ? lazy_row_group_->column(i)
+                                              : &row_group_->columns[i];
+      return ColumnChunkMetaData::Make(column, schema_->Column(i),
                                        properties_, writer_version_, row_group_->ordinal,
                                        static_cast<int16_t>(i), file_decryptor_);
     }
@@ -457,12 +811,18 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
                            " columns, requested metadata for column: ", i);
   }
 
+  void set_lazy_row_group(LazyRowGroup* lazy_row_group) {
+    lazy_row_group_ = lazy_row_group;
+  }
+
  private:
   const format::RowGroup* row_group_;
   const SchemaDescriptor* schema_;
   const ReaderProperties properties_;
   const ApplicationVersion* writer_version_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
+  // Set when row_group_ belongs to a lazily decoded footer
+  LazyRowGroup* lazy_row_group_ = nullptr;
 };
 
 std::unique_ptr<RowGroupMetaData> RowGroupMetaData::Make(
@@ -539,8 +899,13 @@ class FileMetaData::FileMetaDataImpl {
         file_decryptor_ != nullptr ? file_decryptor->GetFooterDecryptor() : nullptr;
 
     ThriftDeserializer deserializer(properties_);
-    deserializer.DeserializeMessage(reinterpret_cast<const uint8_t*>(metadata),
-                                    metadata_len, metadata_.get(), footer_decryptor);
+    if (footer_decryptor == nullptr && properties_.is_lazy_metadata_decoding_enabled()) {
+      DeserializeLazily(reinterpret_cast<const uint8_t*>(metadata), metadata_len,
+                        &deserializer);
+    } else {
+      deserializer.DeserializeMessage(reinterpret_cast<const uint8_t*>(metadata),
+                                      metadata_len, metadata_.get(), footer_decryptor);
+    }
     metadata_len_ = *metadata_len;
 
     if (metadata_->__isset.created_by) {
@@ -563,7 +928,9 @@ class FileMetaData::FileMetaDataImpl {
     uint8_t* serialized_data;
     uint32_t serialized_len = metadata_len_;
     ThriftSerializer serializer;
-    serializer.SerializeToBuffer(metadata_.get(), &serialized_len, &serialized_data);
+    std::unique_ptr<format::FileMetaData> decoded;
+    serializer.SerializeToBuffer(DecodedMetaData(&decoded), &serialized_len,
+                                 &serialized_data);
 
     // encrypt with nonce
     auto nonce = const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(signature));
@@ -596,7 +963,8 @@ class FileMetaData::FileMetaDataImpl {
   inline int num_columns() const { return schema_.num_columns(); }
   inline int64_t num_rows() const { return metadata_->num_rows; }
   inline int num_row_groups() const {
-    return static_cast<int>(metadata_->row_groups.size());
+    return static_cast<int>(lazy_ ? lazy_row_groups_.size()
+                                  : metadata_->row_groups.size());
   }
   inline int32_t version() const { return metadata_->version; }
   inline const std::string& created_by() const { return metadata_->created_by; }
@@ -619,12 +987,14 @@ class FileMetaData::FileMetaDataImpl {
   void WriteTo(::arrow::io::OutputStream* dst,
                const std::shared_ptr<Encryptor>& encryptor) const {
     ThriftSerializer serializer;
+    std::unique_ptr<format::FileMetaData> decoded;
+    const format::FileMetaData* metadata = DecodedMetaData(&decoded);
     // Only in encrypted files with plaintext footers the
     // encryption_algorithm is set in footer
     if (is_encryption_algorithm_set()) {
       uint8_t* serialized_data;
       uint32_t serialized_len;
-      serializer.SerializeToBuffer(metadata_.get(), &serialized_len, &serialized_data);
+      serializer.SerializeToBuffer(metadata, &serialized_len, &serialized_data);
 
       // encrypt the footer key
       std::vector<uint8_t> encrypted_data(encryptor->CiphertextSizeDelta() +
@@ -642,7 +1012,7 @@ class FileMetaData::FileMetaDataImpl {
                      encryption::kGcmTagLength));
     } else {  // either plaintext file (when encryptor is null)
       // or encrypted file with encrypted footer
-      serializer.Serialize(metadata_.get(), dst, encryptor);
+      serializer.Serialize(metadata, dst, encryptor);
     }
   }
 
@@ -653,12 +1023,20 @@ class FileMetaData::FileMetaDataImpl {
          << " row groups, requested metadata for row group: " << i;
       throw ParquetException(ss.str());
     }
+    if (lazy_) {
+      LazyRowGroup* lazy_row_group = lazy_row_groups_[i].get();
+      auto out = RowGroupMetaData::Make(lazy_row_group->row_group(), &schema_,
+                                        properties_, &writer_version_, file_decryptor_);
+      out->impl_->set_lazy_row_group(lazy_row_group);
+      return out;
+    }
     return RowGroupMetaData::Make(&metadata_->row_groups[i], &schema_, properties_,
                                   &writer_version_, file_decryptor_);
   }
 
   bool Equals(const FileMetaDataImpl& other) const {
-    return *metadata_ == *other.metadata_;
+    std::unique_ptr<format::FileMetaData> decoded, other_decoded;
+    return *DecodedMetaData(&decoded) == *other.DecodedMetaData(&other_decoded);
   }
 
   const SchemaDescriptor* schema() const { return &schema_; }
@@ -668,6 +1046,12 @@ class FileMetaData::FileMetaDataImpl {
   }
 
   void set_file_path(const std::string& path) {
+    if (lazy_) {
+      for (const auto& lazy_row_group : lazy_row_groups_) {
+        lazy_row_group->set_file_path(path);
+      }
+      return;
+    }
     for (format::RowGroup& row_group : metadata_->row_groups) {
       for (format::ColumnChunk& chunk : row_group.columns) {
         chunk.__set_file_path(path);
@@ -675,8 +1059,11 @@ class FileMetaData::FileMetaDataImpl {
     }
   }
 
-  format::RowGroup& row_group(int i) {
+  const format::RowGroup& row_group(int i) {
     DCHECK_LT(i, num_row_groups());
+    if (lazy_) {
+      return lazy_row_groups_[i]->Decode();
+    }
     return metadata_->row_groups[i];
   }
 
@@ -685,6 +1072,7 @@ class FileMetaData::FileMetaDataImpl {
       throw ParquetException("AppendRowGroups requires equal schemas.");
     }
 
+    DecodeRowGroups();
     // ARROW-13654: `other` may point to self, be careful not to enter an infinite loop
     const int n = other->num_row_groups();
     // ARROW-16613: do not use reserve() as that may suppress overallocation
@@ -746,12 +1134,70 @@ class FileMetaData::FileMetaDataImpl {
   friend FileMetaDataBuilder;
   uint32_t metadata_len_ = 0;
   std::unique_ptr<format::FileMetaData> metadata_;
+  // When decoding lazily, metadata_ has no row groups: they are decoded on
+  // demand from the serialized footer.
+  bool lazy_ = false;
+  std::string serialized_footer_;
+  std::vector<std::unique_ptr<LazyRowGroup>> lazy_row_groups_;
   SchemaDescriptor schema_;
   ApplicationVersion writer_version_;
   std::shared_ptr<const KeyValueMetadata> key_value_metadata_;
   const ReaderProperties properties_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
 
+  void DeserializeLazily(const uint8_t* data, uint32_t* len,
+                         ThriftDeserializer* deserializer) {
+    ThriftListLocation row_groups;
+    const uint32_t footer_len =
+        LocateStructList(data, *len, kFileMetaDataRowGroupsField,
+                         properties_.thrift_container_size_limit(), &row_groups);
+    if (!row_groups.found) {
+      // Malformed footer, let the regular decoder report it
+      deserializer->DeserializeMessage(data, len, metadata_.get());
+      return;
+    }
+    const std::string stripped = WithEmptyList(data, footer_len, row_groups);
+    uint32_t stripped_len = static_cast<uint32_t>(stripped.size());
+    deserializer->DeserializeMessage(reinterpret_cast<const uint8_t*>(stripped.data()),
+                                     &stripped_len, metadata_.get());
+
+    serialized_footer_.assign(reinterpret_cast<const char*>(data), footer_len);
+    const auto* footer = reinterpret_cast<const uint8_t*>(serialized_footer_.data());
+    lazy_row_groups_.reserve(row_groups.elements.size());
+    for (const auto& element : row_groups.elements) {
+      lazy_row_groups_.emplace_back(
+          new LazyRowGroup(footer + element.first, element.second, properties_));
+    }
+    lazy_ = true;
+    *len = footer_len;
+  }
+
+  // Return the thrift metadata including all row groups.  If the footer is
+  // decoded lazily, a complete copy is made in `decoded`.
+  const format::FileMetaData* DecodedMetaData(
+      std::unique_ptr<format::FileMetaData>* decoded) const {
+    if (!lazy_) {
+      return metadata_.get();
+    }
+    decoded->reset(new format::FileMetaData(*metadata_));
+    (*decoded)->row_groups.reserve(lazy_row_groups_.size());
+    for (const auto& lazy_row_group : lazy_row_groups_) {
+      (*decoded)->row_groups.push_back(lazy_row_group->Decode());
+    }
+    return decoded->get();
+  }
+
+  // Decode all row groups into metadata_ before it is modified.  The lazy row
+  // groups are kept alive for the RowGroupMetaData still referencing them.
+  void DecodeRowGroups() {
+    if (!lazy_) return;
+    metadata_->row_groups.reserve(lazy_row_groups_.size());
+    for (const auto& lazy_row_group : lazy_row_groups_) {
+      metadata_->row_groups.push_back(lazy_row_group->Decode());
+    }
+    lazy_ = false;
+  }
+
   void InitSchema() {
     if (metadata_->schema.empty()) {
       throw ParquetException("Empty file schema (no root)");
@@ -1709,6 +2155,43 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
     return current_row_group_builder_.get();
   }
 
+  void SetPageIndexLocation(const PageIndexLocation& location) {
+    auto set_locations = [this](const std::vector<std::vector<IndexLocation>>& locations,
+                                bool column_index) {
+      DCHECK_LE(locations.size(), row_groups_.size());
+      for (size_t i = 0; i < locations.size(); ++i) {
+        auto& columns = row_groups_[i].columns;
+        DCHECK_LE(locations[i].size(), columns.size());
+        for (size_t j = 0; j < locations[i].size(); ++j) {
+          const IndexLocation& index_location = locations[i][j];
+          if (index_location.offset < 0) continue;
+          if (column_index) {
+            columns[j].__set_column_index_offset(index_location.offset);
+            columns[j].__set_column_index_length(index_location.length);
+          } else {
+            columns[j].__set_offset_index_offset(index_location.offset);
+            columns[j].__set_offset_index_length(index_location.length);
+          }
+        }
+      }
+    };
+    set_locations(location.column_index_location, /*column_index=*/true);
+    set_locations(location.offset_index_location, /*column_index=*/false);
+  }
+
+  void SetBloomFilterLocation(const BloomFilterLocation& location) {
+    const auto& offsets = location.bloom_filter_offset;
+    DCHECK_LE(offsets.size(), row_groups_.size());
+    for (size_t i = 0; i < offsets.size(); ++i) {
+      auto& columns = row_groups_[i].columns;
+      DCHECK_LE(offsets[i].size(), columns.size());
+      for (size_t j = 0; j < offsets[i].size(); ++j) {
+        if (offsets[i][j] < 0) continue;
+        columns[j].meta_data.__set_bloom_filter_offset(offsets[i][j]);
+      }
+    }
+  }
+
   std::unique_ptr<FileMetaData> Finish() {
     int64_t total_rows = 0;
     for (auto row_group : row_groups_) {
@@ -1834,10 +2317,123 @@ RowGroupMetaDataBuilder* FileMetaDataBuilder::AppendRowGroup() {
   return impl_->AppendRowGroup();
 }
 
+void FileMetaDataBuilder::SetPageIndexLocation(const PageIndexLocation& location) {
+  impl_->SetPageIndexLocation(location);
+}
+
+void FileMetaDataBuilder::SetBloomFilterLocation(const BloomFilterLocation& location) {
+  impl_->SetBloomFilterLocation(location);
+}
+
 std::unique_ptr<FileMetaData> FileMetaDataBuilder::Finish() { return impl_->Finish(); }
 
 std::unique_ptr<FileCryptoMetaData> FileMetaDataBuilder::GetCryptoMetaData() {
   return impl_->BuildFileCryptoMetaData();
 }
 
+// ----------------------------------------------------------------------
+// FileMetaDataCache
+
+class FileMetaDataCache::Impl {
+ public:
+  explicit Impl(int64_t capacity_bytes) : capacity_bytes_(capacity_bytes) {}
+
+  std::shared_ptr<FileMetaData> Get(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) {
+      return nullptr;
+    }
+    // Move the entry to the front of the list
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->metadata;
+  }
+
+  void Put(const std::string& key, std::shared_ptr<FileMetaData> metadata) {
+    const int64_t size = metadata->size();
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it != map_.end()) {
+      Erase(it);
+    }
+    if (size > capacity_bytes_) {
+      return;
+    }
+    while (size_bytes_ + size > capacity_bytes_) {
+      Erase(map_.find(entries_.back().key));
+    }
+    entries_.push_front(Entry{key, std::move(metadata), size});
+    map_.emplace(key, entries_.begin());
+    size_bytes_ += size;
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.clear();
+    entries_.clear();
+    size_bytes_ = 0;
+  }
+
+  int64_t capacity_bytes() const { return capacity_bytes_; }
+
+  int64_t size_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_bytes_;
+  }
+
+  int64_t num_entries() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int64_t>(map_.size());
+  }
+
+ private:
+  struct Entry {
+    std::string key;
+    std::shared_ptr<FileMetaData> metadata;
+    int64_t size;
+  };
+  using EntryList = std::list<Entry>;
+  using EntryMap = std::unordered_map<std::string, EntryList::iterator>;
+
+  void Erase(EntryMap::iterator it) {
+    size_bytes_ -= it->second->size;
+    entries_.erase(it->second);
+    map_.erase(it);
+  }
+
+  const int64_t capacity_bytes_;
+  mutable std::mutex mutex_;
+  // In most to least recently used order
+  EntryList entries_;
+  EntryMap map_;
+  int64_t size_bytes_ = 0;
+};
+
+FileMetaDataCache::FileMetaDataCache(int64_t capacity_bytes)
+    : impl_(new Impl(capacity_bytes)) {}
+
+FileMetaDataCache::~FileMetaDataCache() = default;
+
+std::shared_ptr<FileMetaData> FileMetaDataCache::Get(const std::string& key) {
+  return impl_->Get(key);
+}
+
+void FileMetaDataCache::Put(const std::string& key,
+                            std::shared_ptr<FileMetaData> metadata) {
+  impl_->Put(key, std::move(metadata));
+}
+
+void FileMetaDataCache::Clear() { impl_->Clear(); }
+
+int64_t FileMetaDataCache::capacity_bytes() const { return impl_->capacity_bytes(); }
+
+int64_t FileMetaDataCache::size_bytes() const { return impl_->size_bytes(); }
+
+int64_t FileMetaDataCache::num_entries() const { return impl_->num_entries(); }
+
+std::shared_ptr<FileMetaDataCache> default_file_metadata_cache() {
+  static auto cache = std::make_shared<FileMetaDataCache>(64 << 20);
+  return cache;
+}
+
 }  // namespace parquet
@@ -24,6 +24,9 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/util/optional.h"
+#include "parquet/bloom_filter_builder.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -169,6 +172,12 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t total_compressed_size() const;
   int64_t total_uncompressed_size() const;
   std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const;
+  /// \brief Location of the ColumnIndex of this column chunk, if it has one
+  ::arrow::util::optional<IndexLocation> GetColumnIndexLocation() const;
+  /// \brief Location of the OffsetIndex of this column chunk, if it has one
+  ::arrow::util::optional<IndexLocation> GetOffsetIndexLocation() const;
+  /// \brief File offset of the Bloom filter of this column chunk, if it has one
+  ::arrow::util::optional<int64_t> bloom_filter_offset() const;
 
  private:
   explicit ColumnChunkMetaData(
@@ -245,6 +254,7 @@ class PARQUET_EXPORT RowGroupMetaData {
       const ReaderProperties& properties,
       const ApplicationVersion* writer_version = NULLPTR,
       std::shared_ptr<InternalFileDecryptor> file_decryptor = NULLPTR);
+  friend class FileMetaData;
   // PIMPL Idiom
   class RowGroupMetaDataImpl;
   std::unique_ptr<RowGroupMetaDataImpl> impl_;
@@ -496,6 +506,12 @@ class PARQUET_EXPORT FileMetaDataBuilder {
   // The prior RowGroupMetaDataBuilder (if any) is destroyed
   RowGroupMetaDataBuilder* AppendRowGroup();
 
+  // Record the locations of the written page index in the column chunks
+  void SetPageIndexLocation(const PageIndexLocation& location);
+
+  // Record the offsets of the written Bloom filters in the column chunks
+  void SetBloomFilterLocation(const BloomFilterLocation& location);
+
   // Complete the Thrift structure
   std::unique_ptr<FileMetaData> Finish();
 
@@ -511,6 +527,43 @@ class PARQUET_EXPORT FileMetaDataBuilder {
   std::unique_ptr<FileMetaDataBuilderImpl> impl_;
 };
 
+/// \brief A thread-safe LRU cache of parsed FileMetaData, bounded in memory.
+///
+/// Keys are opaque strings, which should identify the file contents (e.g. its
+/// path, size and modification time) so that a modified file never gets stale
+/// metadata.  The memory used by an entry is approximated by the size of its
+/// serialized footer.
+class PARQUET_EXPORT FileMetaDataCache {
+ public:
+  explicit FileMetaDataCache(int64_t capacity_bytes);
+  ~FileMetaDataCache();
+
+  /// \brief Return the metadata cached for key, or nullptr.
+  std::shared_ptr<FileMetaData> Get(const std::string& key);
+
+  /// \brief Cache the metadata for key, evicting the least recently used
+  /// entries to stay within the capacity.
+  ///
+  /// Metadata larger than the whole capacity is not cached.
+  void Put(const std::string& key, std::shared_ptr<FileMetaData> metadata);
+
+  void Clear();
+
+  int64_t capacity_bytes() const;
+  /// \brief The sum of the serialized sizes of the cached metadata.
+  int64_t size_bytes() const;
+  int64_t num_entries() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Return the process-wide FileMetaDataCache, holding up to 64 MiB of
+/// footers.
+PARQUET_EXPORT
+std::shared_ptr<FileMetaDataCache> default_file_metadata_cache();
+
 PARQUET_EXPORT std::string ParquetVersionToString(ParquetVersion::type ver);
 
 }  // namespace parquet
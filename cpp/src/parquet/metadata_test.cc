@@ -292,6 +292,110 @@ TEST(Metadata, TestKeyValueMetadata) {
   EXPECT_TRUE(f_accessor->key_value_metadata()->Equals(*kvmeta));
 }
 
+TEST(Metadata, TestLazyDecoding) {
+  parquet::schema::NodeVector fields;
+  parquet::SchemaDescriptor schema;
+  fields.push_back(parquet::schema::Int32("int_col", Repetition::REQUIRED));
+  fields.push_back(parquet::schema::Float("float_col", Repetition::REQUIRED));
+  schema.Init(parquet::schema::GroupNode::Make("schema", Repetition::REPEATED, fields));
+  auto props = WriterProperties::Builder().build();
+
+  int64_t nrows = 1000;
+  int32_t int_min = 100, int_max = 200;
+  EncodedStatistics stats_int;
+  stats_int.set_null_count(0)
+      .set_min(std::string(reinterpret_cast<const char*>(&int_min), 4))
+      .set_max(std::string(reinterpret_cast<const char*>(&int_max), 4));
+  EncodedStatistics stats_float;
+  auto expected = GenerateTableMetaData(schema, props, nrows, stats_int, stats_float);
+  const std::string serialized = expected->SerializeToString();
+
+  ReaderProperties reader_props;
+  reader_props.enable_lazy_metadata_decoding();
+  // Trailing bytes are not part of the footer
+  uint32_t metadata_len = static_cast<uint32_t>(serialized.size() + 4);
+  const std::string buffer = serialized + "PAR1";
+  auto lazy = FileMetaData::Make(buffer.data(), &metadata_len, reader_props);
+  ASSERT_EQ(serialized.size(), metadata_len);
+
+  ASSERT_EQ(nrows, lazy->num_rows());
+  ASSERT_EQ(2, lazy->num_row_groups());
+  ASSERT_EQ(2, lazy->num_columns());
+  auto rg2 = lazy->RowGroup(1);
+  ASSERT_EQ(nrows / 2, rg2->num_rows());
+  ASSERT_EQ(1024, rg2->total_byte_size());
+  ASSERT_EQ(2, rg2->num_columns());
+  auto rg2_column2 = rg2->ColumnChunk(1);
+  ASSERT_EQ(16, rg2_column2->dictionary_page_offset());
+  ASSERT_EQ(26, rg2_column2->data_page_offset());
+  ASSERT_THROW(rg2->ColumnChunk(2), ParquetException);
+  auto rg1_column1 = lazy->RowGroup(0)->ColumnChunk(0);
+  ASSERT_TRUE(rg1_column1->is_stats_set());
+  ASSERT_EQ(stats_int.min(), rg1_column1->statistics()->EncodeMin());
+
+  ASSERT_TRUE(lazy->RowGroup(1)->Equals(*expected->RowGroup(1)));
+  ASSERT_TRUE(lazy->Equals(*expected));
+  ASSERT_EQ(serialized, lazy->SerializeToString());
+  ASSERT_TRUE(lazy->Subset({1})->Equals(*expected->Subset({1})));
+
+  lazy->set_file_path("/foo/bar/bar.parquet");
+  ASSERT_EQ("/foo/bar/bar.parquet", rg2_column2->file_path());
+  ASSERT_EQ("/foo/bar/bar.parquet", lazy->RowGroup(0)->ColumnChunk(1)->file_path());
+
+  lazy->AppendRowGroups(*expected);
+  ASSERT_EQ(4, lazy->num_row_groups());
+  ASSERT_EQ(nrows * 2, lazy->num_rows());
+  ASSERT_EQ(26, lazy->RowGroup(3)->ColumnChunk(1)->data_page_offset());
+  ASSERT_EQ(16, rg2_column2->dictionary_page_offset());
+}
+
+TEST(FileMetaDataCache, EvictsLeastRecentlyUsed) {
+  parquet::schema::NodeVector fields;
+  fields.push_back(parquet::schema::Int32("int_col", Repetition::REQUIRED));
+  parquet::SchemaDescriptor schema;
+  schema.Init(parquet::schema::GroupNode::Make("schema", Repetition::REPEATED, fields));
+  auto f_builder = FileMetaDataBuilder::Make(&schema, default_writer_properties());
+  const std::string serialized = f_builder->Finish()->SerializeToString();
+  // Round-trip the metadata so that it knows its serialized size
+  uint32_t metadata_len = static_cast<uint32_t>(serialized.size());
+  std::shared_ptr<FileMetaData> metadata =
+      FileMetaData::Make(serialized.data(), &metadata_len);
+  const int64_t size = metadata->size();
+  ASSERT_GT(size, 0);
+
+  FileMetaDataCache cache(3 * size);
+  ASSERT_EQ(nullptr, cache.Get("a"));
+  cache.Put("a", metadata);
+  cache.Put("b", metadata);
+  cache.Put("c", metadata);
+  ASSERT_EQ(3, cache.num_entries());
+  ASSERT_EQ(3 * size, cache.size_bytes());
+
+  // "b" is now the least recently used entry
+  ASSERT_EQ(metadata, cache.Get("a"));
+  cache.Put("d", metadata);
+  ASSERT_EQ(nullptr, cache.Get("b"));
+  ASSERT_EQ(metadata, cache.Get("a"));
+  ASSERT_EQ(metadata, cache.Get("c"));
+  ASSERT_EQ(metadata, cache.Get("d"));
+
+  // Replacing an entry doesn't evict others
+  cache.Put("d", metadata);
+  ASSERT_EQ(3, cache.num_entries());
+  ASSERT_EQ(3 * size, cache.size_bytes());
+
+  cache.Clear();
+  ASSERT_EQ(0, cache.num_entries());
+  ASSERT_EQ(0, cache.size_bytes());
+  ASSERT_EQ(nullptr, cache.Get("a"));
+
+  // Metadata larger than the capacity is never cached
+  FileMetaDataCache small_cache(size - 1);
+  small_cache.Put("a", metadata);
+  ASSERT_EQ(0, small_cache.num_entries());
+  ASSERT_EQ(nullptr, small_cache.Get("a"));
+}
+
 TEST(ApplicationVersion, Basics) {
   ApplicationVersion version("parquet-mr version 1.7.9");
   ApplicationVersion version1("parquet-mr version 1.8.0");
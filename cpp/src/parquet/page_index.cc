@@ -0,0 +1,380 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <utility>
+
+#include "arrow/util/logging.h"
+#include "parquet/exception.h"
+#include "parquet/metadata.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+namespace {
+
+// Read range [begin, end) of all indexes of one kind in a row group
+struct IndexRange {
+  int64_t begin = std::numeric_limits<int64_t>::max();
+  int64_t end = 0;
+
+  void Add(const IndexLocation& location) {
+    begin = std::min(begin, location.offset);
+    end = std::max(end, location.offset + location.length);
+  }
+
+  bool empty() const { return end <= begin; }
+};
+
+class RowGroupPageIndexReaderImpl : public RowGroupPageIndexReader {
+ public:
+  RowGroupPageIndexReaderImpl(std::shared_ptr<ArrowInputFile> source,
+                              std::unique_ptr<RowGroupMetaData> row_group_metadata,
+                              const ReaderProperties& properties)
+      : source_(std::move(source)),
+        row_group_metadata_(std::move(row_group_metadata)),
+        properties_(properties) {}
+
+  std::shared_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto location = GetColumnChunk(i)->GetColumnIndexLocation();
+    if (!location.has_value()) {
+      return nullptr;
+    }
+    if (!column_index_buffer_) {
+      column_index_buffer_ = ReadAll(&ColumnChunkMetaData::GetColumnIndexLocation,
+                                     &column_index_base_);
+    }
+    const uint8_t* data = column_index_buffer_->data() +
+                          (location->offset - column_index_base_);
+    return ColumnIndex::Make(data, static_cast<uint32_t>(location->length), properties_);
+  }
+
+  std::shared_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto location = GetColumnChunk(i)->GetOffsetIndexLocation();
+    if (!location.has_value()) {
+      return nullptr;
+    }
+    if (!offset_index_buffer_) {
+      offset_index_buffer_ = ReadAll(&ColumnChunkMetaData::GetOffsetIndexLocation,
+                                     &offset_index_base_);
+    }
+    const uint8_t* data = offset_index_buffer_->data() +
+                          (location->offset - offset_index_base_);
+    return OffsetIndex::Make(data, static_cast<uint32_t>(location->length), properties_);
+  }
+
+ private:
+  using LocationGetter =
+      ::arrow::util::optional<IndexLocation> (ColumnChunkMetaData::*)() const;
+
+  std::unique_ptr<ColumnChunkMetaData> GetColumnChunk(int i) const {
+    if (i < 0 || i >= row_group_metadata_->num_columns()) {
+      std::stringstream ss;
+      ss << "Invalid column index " << i << " for page index of a row group with "
+         << row_group_metadata_->num_columns() << " columns";
+      throw ParquetException(ss.str());
+    }
+    return row_group_metadata_->ColumnChunk(i);
+  }
+
+  // Indexes of one kind are written contiguously, so fetch those of all
+  // columns at once rather than issuing one small read per column.
+  std::shared_ptr<Buffer> ReadAll(LocationGetter get_location, int64_t* base) {
+    IndexRange range;
+    for (int i = 0; i < row_group_metadata_->num_columns(); ++i) {
+      auto location = (row_group_metadata_->ColumnChunk(i).get()->*get_location)();
+      if (location.has_value()) {
+        range.Add(*location);
+      }
+    }
+    DCHECK(!range.empty());
+    PARQUET_ASSIGN_OR_THROW(auto buffer,
+                            source_->ReadAt(range.begin, range.end - range.begin));
+    if (buffer->size() != range.end - range.begin) {
+      throw ParquetException("Page index extends beyond the end of the file");
+    }
+    *base = range.begin;
+    return buffer;
+  }
+
+  std::shared_ptr<ArrowInputFile> source_;
+  std::unique_ptr<RowGroupMetaData> row_group_metadata_;
+  const ReaderProperties properties_;
+
+  std::shared_ptr<Buffer> column_index_buffer_;
+  int64_t column_index_base_ = 0;
+  std::shared_ptr<Buffer> offset_index_buffer_;
+  int64_t offset_index_base_ = 0;
+};
+
+class PageIndexReaderImpl : public PageIndexReader {
+ public:
+  PageIndexReaderImpl(std::shared_ptr<ArrowInputFile> source,
+                      std::shared_ptr<FileMetaData> file_metadata,
+                      const ReaderProperties& properties)
+      : source_(std::move(source)),
+        file_metadata_(std::move(file_metadata)),
+        properties_(properties) {}
+
+  std::shared_ptr<RowGroupPageIndexReader> RowGroup(int i) override {
+    if (i < 0 || i >= file_metadata_->num_row_groups()) {
+      std::stringstream ss;
+      ss << "Invalid row group index " << i << " for page index of a file with "
+         << file_metadata_->num_row_groups() << " row groups";
+      throw ParquetException(ss.str());
+    }
+    auto row_group_metadata = file_metadata_->RowGroup(i);
+    bool has_page_index = false;
+    for (int col = 0; col < row_group_metadata->num_columns(); ++col) {
+      auto column_chunk = row_group_metadata->ColumnChunk(col);
+      if (column_chunk->GetColumnIndexLocation().has_value() ||
+          column_chunk->GetOffsetIndexLocation().has_value()) {
+        has_page_index = true;
+        break;
+      }
+    }
+    if (!has_page_index) {
+      return nullptr;
+    }
+    return std::make_shared<RowGroupPageIndexReaderImpl>(
+        source_, std::move(row_group_metadata), properties_);
+  }
+
+ private:
+  std::shared_ptr<ArrowInputFile> source_;
+  std::shared_ptr<FileMetaData> file_metadata_;
+  const ReaderProperties properties_;
+};
+
+class ColumnIndexBuilderImpl : public ColumnIndexBuilder {
+ public:
+  void AddPage(const EncodedStatistics& stats, int64_t num_values) override {
+    DCHECK(!finished_);
+    if (discarded_) {
+      return;
+    }
+    if (!stats.has_null_count) {
+      discarded_ = true;
+      return;
+    }
+    const bool null_page = stats.null_count == num_values;
+    if (!null_page && !(stats.has_min && stats.has_max)) {
+      // Statistics were disabled or the values exceeded the statistics size limit
+      discarded_ = true;
+      return;
+    }
+    index_.null_pages.push_back(null_page);
+    // Null pages have empty min and max values, as required by the spec
+    index_.min_values.push_back(null_page ? std::string() : stats.min());
+    index_.max_values.push_back(null_page ? std::string() : stats.max());
+    index_.null_counts.push_back(stats.null_count);
+  }
+
+  void Finish() override {
+    DCHECK(!finished_);
+    finished_ = true;
+    if (index_.null_pages.empty()) {
+      discarded_ = true;
+      return;
+    }
+    // Deciding the boundary order needs typed comparisons of the plain-encoded
+    // values.  UNORDERED is always valid; readers then scan all pages.
+    index_.__set_boundary_order(format::BoundaryOrder::UNORDERED);
+    index_.__isset.null_counts = true;
+  }
+
+  int64_t WriteTo(ArrowOutputStream* sink) const override {
+    DCHECK(finished_);
+    if (discarded_) {
+      return 0;
+    }
+    ThriftSerializer serializer;
+    return serializer.Serialize(&index_, sink);
+  }
+
+ private:
+  format::ColumnIndex index_;
+  bool discarded_ = false;
+  bool finished_ = false;
+};
+
+class OffsetIndexBuilderImpl : public OffsetIndexBuilder {
+ public:
+  void AddPage(int64_t offset, int32_t compressed_page_size,
+               int64_t first_row_index) override {
+    DCHECK(!finished_);
+    format::PageLocation location;
+    location.__set_offset(offset);
+    location.__set_compressed_page_size(compressed_page_size);
+    location.__set_first_row_index(first_row_index);
+    index_.page_locations.push_back(std::move(location));
+  }
+
+  void Finish(int64_t final_position) override {
+    DCHECK(!finished_);
+    finished_ = true;
+    if (final_position != 0) {
+      for (auto& location : index_.page_locations) {
+        location.__set_offset(location.offset + final_position);
+      }
+    }
+  }
+
+  int64_t WriteTo(ArrowOutputStream* sink) const override {
+    DCHECK(finished_);
+    if (index_.page_locations.empty()) {
+      return 0;
+    }
+    ThriftSerializer serializer;
+    return serializer.Serialize(&index_, sink);
+  }
+
+ private:
+  format::OffsetIndex index_;
+  bool finished_ = false;
+};
+
+class PageIndexBuilderImpl : public PageIndexBuilder {
+ public:
+  explicit PageIndexBuilderImpl(const SchemaDescriptor* schema) : schema_(schema) {}
+
+  void AppendRowGroup() override {
+    column_index_builders_.emplace_back();
+    offset_index_builders_.emplace_back();
+    for (int i = 0; i < schema_->num_columns(); ++i) {
+      column_index_builders_.back().push_back(ColumnIndexBuilder::Make());
+      offset_index_builders_.back().push_back(OffsetIndexBuilder::Make());
+    }
+  }
+
+  ColumnIndexBuilder* GetColumnIndexBuilder(int i) override {
+    DCHECK(!column_index_builders_.empty());
+    return column_index_builders_.back().at(i).get();
+  }
+
+  OffsetIndexBuilder* GetOffsetIndexBuilder(int i) override {
+    DCHECK(!offset_index_builders_.empty());
+    return offset_index_builders_.back().at(i).get();
+  }
+
+  void WriteTo(ArrowOutputStream* sink, PageIndexLocation* location) const override {
+    location->column_index_location = SerializeIndexes(column_index_builders_, sink);
+    location->offset_index_location = SerializeIndexes(offset_index_builders_, sink);
+  }
+
+ private:
+  template <typename Builder>
+  static std::vector<std::vector<IndexLocation>> SerializeIndexes(
+      const std::vector<std::vector<std::unique_ptr<Builder>>>& builders,
+      ArrowOutputStream* sink) {
+    std::vector<std::vector<IndexLocation>> locations(builders.size());
+    for (size_t row_group = 0; row_group < builders.size(); ++row_group) {
+      for (const auto& builder : builders[row_group]) {
+        PARQUET_ASSIGN_OR_THROW(int64_t offset, sink->Tell());
+        const int64_t length = builder->WriteTo(sink);
+        if (length > 0) {
+          locations[row_group].push_back({offset, static_cast<int32_t>(length)});
+        } else {
+          locations[row_group].push_back({-1, 0});
+        }
+      }
+    }
+    return locations;
+  }
+
+  const SchemaDescriptor* schema_;
+  std::vector<std::vector<std::unique_ptr<ColumnIndexBuilder>>> column_index_builders_;
+  std::vector<std::vector<std::unique_ptr<OffsetIndexBuilder>>> offset_index_builders_;
+};
+
+}  // namespace
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const void* serialized_index,
+                                               uint32_t index_len,
+                                               const ReaderProperties& properties) {
+  format::ColumnIndex index;
+  ThriftDeserializer deserializer(properties);
+  deserializer.DeserializeMessage(reinterpret_cast<const uint8_t*>(serialized_index),
+                                  &index_len, &index);
+  const size_t num_pages = index.null_pages.size();
+  if (index.min_values.size() != num_pages || index.max_values.size() != num_pages ||
+      (index.__isset.null_counts && index.null_counts.size() != num_pages)) {
+    throw ParquetException("Invalid ColumnIndex: inconsistent number of pages");
+  }
+
+  std::unique_ptr<ColumnIndex> result(new ColumnIndex());
+  result->null_pages_ = std::move(index.null_pages);
+  result->min_values_ = std::move(index.min_values);
+  result->max_values_ = std::move(index.max_values);
+  switch (index.boundary_order) {
+    case format::BoundaryOrder::ASCENDING:
+      result->boundary_order_ = BoundaryOrder::ASCENDING;
+      break;
+    case format::BoundaryOrder::DESCENDING:
+      result->boundary_order_ = BoundaryOrder::DESCENDING;
+      break;
+    default:
+      result->boundary_order_ = BoundaryOrder::UNORDERED;
+      break;
+  }
+  result->has_null_counts_ = index.__isset.null_counts;
+  result->null_counts_ = std::move(index.null_counts);
+  return result;
+}
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
+                                               uint32_t index_len,
+                                               const ReaderProperties& properties) {
+  format::OffsetIndex index;
+  ThriftDeserializer deserializer(properties);
+  deserializer.DeserializeMessage(reinterpret_cast<const uint8_t*>(serialized_index),
+                                  &index_len, &index);
+  std::unique_ptr<OffsetIndex> result(new OffsetIndex());
+  result->page_locations_.reserve(index.page_locations.size());
+  for (const auto& location : index.page_locations) {
+    result->page_locations_.push_back(
+        {location.offset, location.compressed_page_size, location.first_row_index});
+  }
+  return result;
+}
+
+std::shared_ptr<PageIndexReader> PageIndexReader::Make(
+    std::shared_ptr<ArrowInputFile> source, std::shared_ptr<FileMetaData> file_metadata,
+    const ReaderProperties& properties) {
+  return std::make_shared<PageIndexReaderImpl>(std::move(source),
+                                               std::move(file_metadata), properties);
+}
+
+std::unique_ptr<ColumnIndexBuilder> ColumnIndexBuilder::Make() {
+  return std::unique_ptr<ColumnIndexBuilder>(new ColumnIndexBuilderImpl());
+}
+
+std::unique_ptr<OffsetIndexBuilder> OffsetIndexBuilder::Make() {
+  return std::unique_ptr<OffsetIndexBuilder>(new OffsetIndexBuilderImpl());
+}
+
+std::unique_ptr<PageIndexBuilder> PageIndexBuilder::Make(const SchemaDescriptor* schema) {
+  return std::unique_ptr<PageIndexBuilder>(new PageIndexBuilderImpl(schema));
+}
+
+}  // namespace parquet
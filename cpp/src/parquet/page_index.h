@@ -0,0 +1,218 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/platform.h"
+#include "parquet/properties.h"
+#include "parquet/types.h"
+
+namespace parquet {
+
+class EncodedStatistics;
+class FileMetaData;
+class SchemaDescriptor;
+
+struct BoundaryOrder {
+  enum type { UNORDERED = 0, ASCENDING = 1, DESCENDING = 2 };
+};
+
+/// \brief Location of a data page within the file (format::PageLocation)
+struct PARQUET_EXPORT PageLocation {
+  /// File offset of the page, starting at its page header
+  int64_t offset;
+  /// Size of the page, including its header
+  int32_t compressed_page_size;
+  /// Index of the first row of the page within its row group
+  int64_t first_row_index;
+};
+
+/// \brief Position of a serialized ColumnIndex or OffsetIndex within the file
+struct PARQUET_EXPORT IndexLocation {
+  int64_t offset;
+  int32_t length;
+};
+
+/// \brief Per-page statistics of a column chunk (format::ColumnIndex)
+///
+/// Min and max values are plain-encoded, like those of EncodedStatistics.
+/// They are meaningless for pages with null_pages()[i] set, which only
+/// contain nulls.
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  /// \brief Deserialize a ColumnIndex
+  ///
+  /// \throws ParquetException if the index is corrupt
+  static std::unique_ptr<ColumnIndex> Make(
+      const void* serialized_index, uint32_t index_len,
+      const ReaderProperties& properties = default_reader_properties());
+
+  int num_pages() const { return static_cast<int>(null_pages_.size()); }
+
+  const std::vector<bool>& null_pages() const { return null_pages_; }
+  const std::vector<std::string>& encoded_min_values() const { return min_values_; }
+  const std::vector<std::string>& encoded_max_values() const { return max_values_; }
+  BoundaryOrder::type boundary_order() const { return boundary_order_; }
+
+  bool has_null_counts() const { return has_null_counts_; }
+  const std::vector<int64_t>& null_counts() const { return null_counts_; }
+
+ private:
+  ColumnIndex() = default;
+
+  std::vector<bool> null_pages_;
+  std::vector<std::string> min_values_;
+  std::vector<std::string> max_values_;
+  BoundaryOrder::type boundary_order_ = BoundaryOrder::UNORDERED;
+  bool has_null_counts_ = false;
+  std::vector<int64_t> null_counts_;
+};
+
+/// \brief Locations of the data pages of a column chunk (format::OffsetIndex)
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  /// \brief Deserialize an OffsetIndex
+  ///
+  /// \throws ParquetException if the index is corrupt
+  static std::unique_ptr<OffsetIndex> Make(
+      const void* serialized_index, uint32_t index_len,
+      const ReaderProperties& properties = default_reader_properties());
+
+  const std::vector<PageLocation>& page_locations() const { return page_locations_; }
+
+ private:
+  OffsetIndex() = default;
+
+  std::vector<PageLocation> page_locations_;
+};
+
+/// \brief Reads the page index of the column chunks of one row group
+///
+/// The serialized indexes of all columns are fetched with one read per index
+/// kind, on first access.  Not thread-safe.
+class PARQUET_EXPORT RowGroupPageIndexReader {
+ public:
+  virtual ~RowGroupPageIndexReader() = default;
+
+  /// \brief The ColumnIndex of column i, or nullptr if it has none
+  ///
+  /// \throws ParquetException if i is out of bounds or the index is corrupt
+  virtual std::shared_ptr<ColumnIndex> GetColumnIndex(int i) = 0;
+
+  /// \brief The OffsetIndex of column i, or nullptr if it has none
+  ///
+  /// \throws ParquetException if i is out of bounds or the index is corrupt
+  virtual std::shared_ptr<OffsetIndex> GetOffsetIndex(int i) = 0;
+};
+
+/// \brief Reads the page index of a Parquet file
+class PARQUET_EXPORT PageIndexReader {
+ public:
+  static std::shared_ptr<PageIndexReader> Make(
+      std::shared_ptr<ArrowInputFile> source, std::shared_ptr<FileMetaData> file_metadata,
+      const ReaderProperties& properties);
+
+  virtual ~PageIndexReader() = default;
+
+  /// \brief The page index reader of row group i, or nullptr if none of its
+  /// column chunks has a page index
+  ///
+  /// \throws ParquetException if i is out of bounds
+  virtual std::shared_ptr<RowGroupPageIndexReader> RowGroup(int i) = 0;
+};
+
+/// \brief Accumulates the ColumnIndex of a column chunk while it is written
+class PARQUET_EXPORT ColumnIndexBuilder {
+ public:
+  static std::unique_ptr<ColumnIndexBuilder> Make();
+
+  virtual ~ColumnIndexBuilder() = default;
+
+  /// \brief Add the statistics of the next data page, holding num_values
+  /// values (including nulls)
+  ///
+  /// The index is discarded if a page lacks a null count, or min and max
+  /// values while holding non-null values.
+  virtual void AddPage(const EncodedStatistics& stats, int64_t num_values) = 0;
+
+  /// \brief Complete the index; no more pages may be added
+  virtual void Finish() = 0;
+
+  /// \brief Serialize the index, returning the number of bytes written
+  ///
+  /// Nothing is written, and 0 returned, if the index was discarded.
+  virtual int64_t WriteTo(ArrowOutputStream* sink) const = 0;
+};
+
+/// \brief Accumulates the OffsetIndex of a column chunk while it is written
+class PARQUET_EXPORT OffsetIndexBuilder {
+ public:
+  static std::unique_ptr<OffsetIndexBuilder> Make();
+
+  virtual ~OffsetIndexBuilder() = default;
+
+  /// \brief Add the location of the next data page
+  virtual void AddPage(int64_t offset, int32_t compressed_page_size,
+                       int64_t first_row_index) = 0;
+
+  /// \brief Complete the index; no more pages may be added
+  ///
+  /// \param[in] final_position added to all page offsets, for column chunks
+  /// which were buffered in memory before being written to the file
+  virtual void Finish(int64_t final_position) = 0;
+
+  /// \brief Serialize the index, returning the number of bytes written
+  virtual int64_t WriteTo(ArrowOutputStream* sink) const = 0;
+};
+
+/// \brief Locations of the serialized page index, by row group then column.
+///
+/// A negative offset marks a column chunk without that index.
+struct PARQUET_EXPORT PageIndexLocation {
+  std::vector<std::vector<IndexLocation>> column_index_location;
+  std::vector<std::vector<IndexLocation>> offset_index_location;
+};
+
+/// \brief Accumulates the page index of a whole file while it is written
+class PARQUET_EXPORT PageIndexBuilder {
+ public:
+  static std::unique_ptr<PageIndexBuilder> Make(const SchemaDescriptor* schema);
+
+  virtual ~PageIndexBuilder() = default;
+
+  /// \brief Start the builders for a new row group
+  virtual void AppendRowGroup() = 0;
+
+  /// \brief The ColumnIndex builder of column i of the current row group
+  virtual ColumnIndexBuilder* GetColumnIndexBuilder(int i) = 0;
+
+  /// \brief The OffsetIndex builder of column i of the current row group
+  virtual OffsetIndexBuilder* GetOffsetIndexBuilder(int i) = 0;
+
+  /// \brief Serialize all column indexes, then all offset indexes
+  ///
+  /// Must be called after all column chunks have been closed.  Locations of
+  /// the written indexes are stored in location.
+  virtual void WriteTo(ArrowOutputStream* sink, PageIndexLocation* location) const = 0;
+};
+
+}  // namespace parquet
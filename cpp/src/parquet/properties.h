@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -55,6 +56,25 @@ constexpr int32_t kDefaultThriftStringSizeLimit = 100 * 1000 * 1000;
 // kDefaultStringSizeLimit.
 constexpr int32_t kDefaultThriftContainerSizeLimit = 1000 * 1000;
 
+/// \brief Counters of the work done by the readers whose ReaderProperties share them
+///
+/// Times are in nanoseconds and are summed over the threads doing the work, so they
+/// may exceed the wall clock time of a parallel read.
+struct PARQUET_EXPORT ReaderMetrics {
+  /// Bytes of the column chunks read or pre-buffered
+  std::atomic<int64_t> bytes_requested{0};
+  /// Bytes read in addition to bytes_requested because pre-buffered reads were
+  /// coalesced over the holes between column chunks (see ::arrow::io::CacheOptions)
+  std::atomic<int64_t> bytes_wasted{0};
+  /// Time spent waiting for column chunks to be read
+  std::atomic<int64_t> io_wait_ns{0};
+  /// Time spent decompressing pages
+  std::atomic<int64_t> decompression_ns{0};
+  /// Time spent decoding columns into Arrow arrays, including the decompression and
+  /// the blocking reads it involves
+  std::atomic<int64_t> decode_ns{0};
+};
+
 class PARQUET_EXPORT ReaderProperties {
  public:
   explicit ReaderProperties(MemoryPool* pool = ::arrow::default_memory_pool())
@@ -87,6 +107,23 @@ class PARQUET_EXPORT ReaderProperties {
     thrift_container_size_limit_ = size;
   }
 
+  /// Lazy metadata decoding defers the deserialization of the row groups stored
+  /// in the file footer until they are accessed, and then only decodes the
+  /// ColumnChunk entries requested through RowGroupMetaData::ColumnChunk.  This
+  /// makes opening files with very wide schemas much cheaper when only a few
+  /// columns are read.  Encrypted footers are always decoded eagerly.
+  bool is_lazy_metadata_decoding_enabled() const { return lazy_metadata_decoding_; }
+  void enable_lazy_metadata_decoding() { lazy_metadata_decoding_ = true; }
+  void disable_lazy_metadata_decoding() { lazy_metadata_decoding_ = false; }
+
+  /// Page prefetching reads, decrypts and decompresses the next page of a
+  /// column chunk on the CPU thread pool while the current page is decoded.
+  /// This mostly helps encrypted or compressed columns, whose page preparation
+  /// then overlaps with decoding.  Page buffers are allocated per page.
+  bool is_page_prefetch_enabled() const { return page_prefetch_enabled_; }
+  void enable_page_prefetch() { page_prefetch_enabled_ = true; }
+  void disable_page_prefetch() { page_prefetch_enabled_ = false; }
+
   void file_decryption_properties(std::shared_ptr<FileDecryptionProperties> decryption) {
     file_decryption_properties_ = std::move(decryption);
   }
@@ -95,13 +132,23 @@ class PARQUET_EXPORT ReaderProperties {
     return file_decryption_properties_;
   }
 
+  /// Metrics, if set, are updated as files are read with these properties.  The
+  /// updates are a few atomic additions per column chunk and page.
+  void set_metrics(std::shared_ptr<ReaderMetrics> metrics) {
+    metrics_ = std::move(metrics);
+  }
+  const std::shared_ptr<ReaderMetrics>& metrics() const { return metrics_; }
+
  private:
   MemoryPool* pool_;
   int64_t buffer_size_ = kDefaultBufferSize;
   int32_t thrift_string_size_limit_ = kDefaultThriftStringSizeLimit;
   int32_t thrift_container_size_limit_ = kDefaultThriftContainerSizeLimit;
   bool buffered_stream_enabled_ = false;
+  bool lazy_metadata_decoding_ = false;
+  bool page_prefetch_enabled_ = false;
   std::shared_ptr<FileDecryptionProperties> file_decryption_properties_;
+  std::shared_ptr<ReaderMetrics> metrics_;
 };
 
 ReaderProperties PARQUET_EXPORT default_reader_properties();
@@ -111,12 +158,24 @@ static constexpr bool DEFAULT_IS_DICTIONARY_ENABLED = true;
 static constexpr int64_t DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT = kDefaultDataPageSize;
 static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 64 * 1024 * 1024;
+static constexpr int64_t DEFAULT_MAX_ROW_GROUP_BYTES = 0;
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::PLAIN;
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
 
+/// \brief Sizing of the Bloom filter written for each chunk of a column
+struct PARQUET_EXPORT BloomFilterOptions {
+  BloomFilterOptions() = default;
+  BloomFilterOptions(int32_t ndv, double fpp) : ndv(ndv), fpp(fpp) {}
+
+  /// Expected number of distinct values in a column chunk
+  int32_t ndv = 1 << 20;
+  /// False positive probability, within (0, 1)
+  double fpp = 0.05;
+};
+
 class PARQUET_EXPORT ColumnProperties {
  public:
   ColumnProperties(Encoding::type encoding = DEFAULT_ENCODING,
@@ -151,6 +210,14 @@ class PARQUET_EXPORT ColumnProperties {
     compression_level_ = compression_level;
   }
 
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
+  void set_bloom_filter_options(const BloomFilterOptions& bloom_filter_options) {
+    bloom_filter_options_ = bloom_filter_options;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -163,6 +230,10 @@ class PARQUET_EXPORT ColumnProperties {
 
   int compression_level() const { return compression_level_; }
 
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
+  const BloomFilterOptions& bloom_filter_options() const { return bloom_filter_options_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -170,6 +241,8 @@ class PARQUET_EXPORT ColumnProperties {
   bool statistics_enabled_;
   size_t max_stats_size_;
   int compression_level_;
+  bool bloom_filter_enabled_ = false;
+  BloomFilterOptions bloom_filter_options_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -181,10 +254,12 @@ class PARQUET_EXPORT WriterProperties {
           dictionary_pagesize_limit_(DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT),
           write_batch_size_(DEFAULT_WRITE_BATCH_SIZE),
           max_row_group_length_(DEFAULT_MAX_ROW_GROUP_LENGTH),
+          max_row_group_bytes_(DEFAULT_MAX_ROW_GROUP_BYTES),
           pagesize_(kDefaultDataPageSize),
           version_(ParquetVersion::PARQUET_2_4),
           data_page_version_(ParquetDataPageVersion::V1),
-          created_by_(DEFAULT_CREATED_BY) {}
+          created_by_(DEFAULT_CREATED_BY),
+          page_index_enabled_(false) {}
     virtual ~Builder() {}
 
     /// Specify the memory pool for the writer. Default default_memory_pool.
@@ -247,6 +322,16 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// Specify the target encoded size of a row group, in bytes.  The Arrow
+    /// writer closes a row group once the estimated encoded size of the rows
+    /// written to it reaches this target, so that row groups of tables with
+    /// varying row widths come out evenly sized.  max_row_group_length still
+    /// applies.  Default 0 (no byte target).
+    Builder* max_row_group_bytes(int64_t max_row_group_bytes) {
+      max_row_group_bytes_ = max_row_group_bytes;
+      return this;
+    }
+
     /// Specify the data page size.
     /// Default 1MB.
     Builder* data_pagesize(int64_t pg_size) {
@@ -435,6 +520,58 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// Write a page index (ColumnIndex and OffsetIndex) for every column
+    /// chunk, allowing readers to skip pages using per-page statistics.
+    /// The page index is not written for encrypted files.
+    /// Default disabled.
+    Builder* enable_write_page_index() {
+      page_index_enabled_ = true;
+      return this;
+    }
+
+    /// Disable writing the page index.
+    /// Default disabled.
+    Builder* disable_write_page_index() {
+      page_index_enabled_ = false;
+      return this;
+    }
+
+    /// Write a Bloom filter for every chunk of the column specified by `path`,
+    /// sized for `options`.  Bloom filters are not written for BOOLEAN columns
+    /// nor for encrypted files.
+    /// Default disabled.
+    Builder* enable_bloom_filter(const std::string& path,
+                                 const BloomFilterOptions& options = {}) {
+      if (options.ndv <= 0) {
+        throw ParquetException("Bloom filter NDV must be positive");
+      }
+      if (!(options.fpp > 0.0 && options.fpp < 1.0)) {
+        throw ParquetException("Bloom filter FPP must be within (0, 1)");
+      }
+      bloom_filter_options_[path] = options;
+      return this;
+    }
+
+    /// Write a Bloom filter for every chunk of the column specified by `path`.
+    /// Default disabled.
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path,
+                                 const BloomFilterOptions& options = {}) {
+      return this->enable_bloom_filter(path->ToDotString(), options);
+    }
+
+    /// Disable Bloom filters for the column specified by `path`.
+    /// Default disabled.
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_options_.erase(path);
+      return this;
+    }
+
+    /// Disable Bloom filters for the column specified by `path`.
+    /// Default disabled.
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
     /// \brief Build the WriterProperties with the builder parameters.
     /// \return The WriterProperties defined by the builder.
     std::shared_ptr<WriterProperties> build() {
@@ -455,11 +592,18 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : bloom_filter_options_) {
+        ColumnProperties& column = get(item.first);
+        column.set_bloom_filter_enabled(true);
+        column.set_bloom_filter_options(item.second);
+      }
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
-          pagesize_, version_, created_by_, std::move(file_encryption_properties_),
-          default_column_properties_, column_properties, data_page_version_));
+          max_row_group_bytes_, pagesize_, version_, created_by_,
+          std::move(file_encryption_properties_),
+          default_column_properties_, column_properties, data_page_version_,
+          page_index_enabled_));
     }
 
    private:
@@ -467,10 +611,12 @@ class PARQUET_EXPORT WriterProperties {
     int64_t dictionary_pagesize_limit_;
     int64_t write_batch_size_;
     int64_t max_row_group_length_;
+    int64_t max_row_group_bytes_;
     int64_t pagesize_;
     ParquetVersion::type version_;
     ParquetDataPageVersion data_page_version_;
     std::string created_by_;
+    bool page_index_enabled_;
 
     std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -481,6 +627,7 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, BloomFilterOptions> bloom_filter_options_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -491,6 +638,8 @@ class PARQUET_EXPORT WriterProperties {
 
   inline int64_t max_row_group_length() const { return max_row_group_length_; }
 
+  inline int64_t max_row_group_bytes() const { return max_row_group_bytes_; }
+
   inline int64_t data_pagesize() const { return pagesize_; }
 
   inline ParquetDataPageVersion data_page_version() const {
@@ -501,6 +650,8 @@ class PARQUET_EXPORT WriterProperties {
 
   inline std::string created_by() const { return parquet_created_by_; }
 
+  inline bool page_index_enabled() const { return page_index_enabled_; }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -548,6 +699,15 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled();
+  }
+
+  const BloomFilterOptions& bloom_filter_options(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_options();
+  }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
@@ -564,20 +724,22 @@ class PARQUET_EXPORT WriterProperties {
  private:
   explicit WriterProperties(
       MemoryPool* pool, int64_t dictionary_pagesize_limit, int64_t write_batch_size,
-      int64_t max_row_group_length, int64_t pagesize, ParquetVersion::type version,
-      const std::string& created_by,
+      int64_t max_row_group_length, int64_t max_row_group_bytes, int64_t pagesize,
+      ParquetVersion::type version, const std::string& created_by,
       std::shared_ptr<FileEncryptionProperties> file_encryption_properties,
       const ColumnProperties& default_column_properties,
       const std::unordered_map<std::string, ColumnProperties>& column_properties,
-      ParquetDataPageVersion data_page_version)
+      ParquetDataPageVersion data_page_version, bool page_index_enabled)
       : pool_(pool),
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
         write_batch_size_(write_batch_size),
         max_row_group_length_(max_row_group_length),
+        max_row_group_bytes_(max_row_group_bytes),
         pagesize_(pagesize),
         parquet_data_page_version_(data_page_version),
         parquet_version_(version),
         parquet_created_by_(created_by),
+        page_index_enabled_(page_index_enabled),
         file_encryption_properties_(file_encryption_properties),
         default_column_properties_(default_column_properties),
         column_properties_(column_properties) {}
@@ -586,10 +748,12 @@ class PARQUET_EXPORT WriterProperties {
   int64_t dictionary_pagesize_limit_;
   int64_t write_batch_size_;
   int64_t max_row_group_length_;
+  int64_t max_row_group_bytes_;
   int64_t pagesize_;
   ParquetDataPageVersion parquet_data_page_version_;
   ParquetVersion::type parquet_version_;
   std::string parquet_created_by_;
+  bool page_index_enabled_;
 
   std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -607,14 +771,21 @@ static constexpr bool kArrowDefaultUseThreads = false;
 // Default number of rows to read when using ::arrow::RecordBatchReader
 static constexpr int64_t kArrowDefaultBatchSize = 64 * 1024;
 
+// Default bound on the decoded size of row groups read ahead by a RecordBatchReader
+static constexpr int64_t kArrowDefaultRowGroupReadaheadBytes = 256 * 1024 * 1024;
+
 /// EXPERIMENTAL: Properties for configuring FileReader behavior.
 class PARQUET_EXPORT ArrowReaderProperties {
  public:
   explicit ArrowReaderProperties(bool use_threads = kArrowDefaultUseThreads)
       : use_threads_(use_threads),
         read_dict_indices_(),
+        unify_dictionaries_(false),
         batch_size_(kArrowDefaultBatchSize),
+        row_group_readahead_(0),
+        row_group_readahead_bytes_(kArrowDefaultRowGroupReadaheadBytes),
         pre_buffer_(false),
+        zero_copy_values_(false),
         cache_options_(::arrow::io::CacheOptions::Defaults()),
         coerce_int96_timestamp_unit_(::arrow::TimeUnit::NANO) {}
 
@@ -637,10 +808,45 @@ class PARQUET_EXPORT ArrowReaderProperties {
     }
   }
 
+  /// Unify the dictionaries of columns read as dictionaries.
+  ///
+  /// By default, each dictionary page of the file (usually one per row group)
+  /// produces a chunk with its own dictionary.  When enabled, the values of
+  /// each new dictionary are merged into a dictionary shared by all chunks of
+  /// the column, and indices are transposed as they are read.
+  void set_unify_dictionaries(bool unify_dictionaries) {
+    unify_dictionaries_ = unify_dictionaries;
+  }
+
+  bool unify_dictionaries() const { return unify_dictionaries_; }
+
   void set_batch_size(int64_t batch_size) { batch_size_ = batch_size; }
 
   int64_t batch_size() const { return batch_size_; }
 
+  /// Decode up to this many row groups ahead when reading through a
+  /// RecordBatchReader (default 0, disabled).
+  ///
+  /// Each row group is then decoded as a whole by a task on the CPU thread
+  /// pool, concurrently with the following ones, and batches are still
+  /// returned in order.  This lets narrow tables, for which use_threads has
+  /// few columns to spread over, use all cores.
+  void set_row_group_readahead(int32_t num_row_groups) {
+    row_group_readahead_ = num_row_groups;
+  }
+
+  int32_t row_group_readahead() const { return row_group_readahead_; }
+
+  /// Bound the estimated decoded size of the row groups read ahead at once.
+  ///
+  /// The estimate is the uncompressed size of the column chunks read.  The
+  /// next row group is always read ahead, however large it is.
+  void set_row_group_readahead_bytes(int64_t num_bytes) {
+    row_group_readahead_bytes_ = num_bytes;
+  }
+
+  int64_t row_group_readahead_bytes() const { return row_group_readahead_bytes_; }
+
   /// Enable read coalescing.
   ///
   /// When enabled, the Arrow reader will pre-buffer necessary regions
@@ -650,6 +856,19 @@ class PARQUET_EXPORT ArrowReaderProperties {
 
   bool pre_buffer() const { return pre_buffer_; }
 
+  /// Slice the values of required INT32, INT64, FLOAT and DOUBLE columns
+  /// straight from PLAIN-encoded data pages instead of copying them.
+  ///
+  /// This mostly benefits uncompressed and memory-mapped files.  Such columns
+  /// are then returned with one chunk per data page (so record batches may be
+  /// smaller than the batch size), and their arrays keep the buffers read from
+  /// the file alive.
+  void set_zero_copy_values(bool zero_copy_values) {
+    zero_copy_values_ = zero_copy_values;
+  }
+
+  bool zero_copy_values() const { return zero_copy_values_; }
+
   /// Set options for read coalescing. This can be used to tune the
   /// implementation for characteristics of different filesystems.
   void set_cache_options(::arrow::io::CacheOptions options) { cache_options_ = options; }
@@ -674,8 +893,12 @@ class PARQUET_EXPORT ArrowReaderProperties {
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
+  bool unify_dictionaries_;
   int64_t batch_size_;
+  int32_t row_group_readahead_;
+  int64_t row_group_readahead_bytes_;
   bool pre_buffer_;
+  bool zero_copy_values_;
   ::arrow::io::IOContext io_context_;
   ::arrow::io::CacheOptions cache_options_;
   ::arrow::TimeUnit::type coerce_int96_timestamp_unit_;
@@ -701,7 +924,8 @@ class PARQUET_EXPORT ArrowWriterProperties {
           store_schema_(false),
           // TODO: At some point we should flip this.
           compliant_nested_types_(false),
-          engine_version_(V2) {}
+          engine_version_(V2),
+          use_threads_(kArrowDefaultUseThreads) {}
     virtual ~Builder() = default;
 
     Builder* disable_deprecated_int96_timestamps() {
@@ -753,11 +977,19 @@ class PARQUET_EXPORT ArrowWriterProperties {
       return this;
     }
 
+    /// \brief Encode and compress the column chunks of a row group in parallel.
+    ///
+    /// Only applies to FileWriter::WriteTable. See use_threads().
+    Builder* set_use_threads(bool use_threads) {
+      use_threads_ = use_threads;
+      return this;
+    }
+
     std::shared_ptr<ArrowWriterProperties> build() {
       return std::shared_ptr<ArrowWriterProperties>(new ArrowWriterProperties(
           write_timestamps_as_int96_, coerce_timestamps_enabled_, coerce_timestamps_unit_,
           truncated_timestamps_allowed_, store_schema_, compliant_nested_types_,
-          engine_version_));
+          engine_version_, use_threads_));
     }
 
    private:
@@ -770,6 +1002,7 @@ class PARQUET_EXPORT ArrowWriterProperties {
     bool store_schema_;
     bool compliant_nested_types_;
     EngineVersion engine_version_;
+    bool use_threads_;
   };
 
   bool support_deprecated_int96_timestamps() const { return write_timestamps_as_int96_; }
@@ -796,20 +1029,30 @@ class PARQUET_EXPORT ArrowWriterProperties {
   /// place in case there are bugs detected in V2.
   EngineVersion engine_version() const { return engine_version_; }
 
+  /// \brief Whether FileWriter::WriteTable encodes column chunks in parallel.
+  ///
+  /// When enabled, each row group is written as a buffered row group: every
+  /// column chunk is encoded and compressed into memory on the CPU thread pool,
+  /// and the chunks are then serialized to the sink in column order. Memory use
+  /// is bounded by one encoded row group, so lower the chunk size passed to
+  /// WriteTable (or WriterProperties::max_row_group_length) to reduce it.
+  bool use_threads() const { return use_threads_; }
+
  private:
   explicit ArrowWriterProperties(bool write_nanos_as_int96,
                                  bool coerce_timestamps_enabled,
                                  ::arrow::TimeUnit::type coerce_timestamps_unit,
                                  bool truncated_timestamps_allowed, bool store_schema,
                                  bool compliant_nested_types,
-                                 EngineVersion engine_version)
+                                 EngineVersion engine_version, bool use_threads)
       : write_timestamps_as_int96_(write_nanos_as_int96),
         coerce_timestamps_enabled_(coerce_timestamps_enabled),
         coerce_timestamps_unit_(coerce_timestamps_unit),
         truncated_timestamps_allowed_(truncated_timestamps_allowed),
         store_schema_(store_schema),
         compliant_nested_types_(compliant_nested_types),
-        engine_version_(engine_version) {}
+        engine_version_(engine_version),
+        use_threads_(use_threads) {}
 
   const bool write_timestamps_as_int96_;
   const bool coerce_timestamps_enabled_;
@@ -818,6 +1061,7 @@ class PARQUET_EXPORT ArrowWriterProperties {
   const bool store_schema_;
   const bool compliant_nested_types_;
   const EngineVersion engine_version_;
+  const bool use_threads_;
 };
 
 /// \brief State object used for writing Arrow data directly to a Parquet
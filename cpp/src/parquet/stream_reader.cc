@@ -17,12 +17,13 @@
 
 #include "parquet/stream_reader.h"
 
+#include <algorithm>
 #include <set>
 #include <utility>
 
 namespace parquet {
 
-constexpr int64_t StreamReader::kBatchSizeOne;
+constexpr int64_t StreamReader::kBatchSize;
 
 // The converted type expected by the stream reader does not always
 // exactly match with the schema in the Parquet file.  The following
@@ -43,16 +44,46 @@ static const std::set<std::pair<ConvertedType::type, ConvertedType::type> >
                                  {ConvertedType::UTF8, ConvertedType::NONE}};
 
 StreamReader::StreamReader(std::unique_ptr<ParquetFileReader> reader)
-    : file_reader_{std::move(reader)}, eof_{false} {
+    : StreamReader(std::move(reader), std::vector<int>{}) {}
+
+StreamReader::StreamReader(std::unique_ptr<ParquetFileReader> reader,
+                           const std::vector<int>& column_indices)
+    : file_reader_{std::move(reader)}, column_indices_(column_indices), eof_{false} {
   file_metadata_ = file_reader_->metadata();
 
   auto schema = file_metadata_->schema();
   auto group_node = schema->group_node();
 
-  nodes_.resize(schema->num_columns());
+  if (column_indices_.empty()) {
+    column_indices_.resize(schema->num_columns());
+    for (auto i = 0; i < schema->num_columns(); ++i) {
+      column_indices_[i] = i;
+    }
+  }
 
-  for (auto i = 0; i < schema->num_columns(); ++i) {
-    nodes_[i] = std::static_pointer_cast<schema::PrimitiveNode>(group_node->field(i));
+  nodes_.resize(column_indices_.size());
+  column_buffers_.resize(column_indices_.size());
+
+  for (std::size_t i = 0; i < column_indices_.size(); ++i) {
+    const int index = column_indices_[i];
+    if (index < 0 || index >= schema->num_columns()) {
+      throw ParquetException("Column index " + std::to_string(index) +
+                             " is invalid for " +
+                             std::to_string(schema->num_columns()) + " columns");
+    }
+    nodes_[i] =
+        std::static_pointer_cast<schema::PrimitiveNode>(group_node->field(index));
+
+    const ColumnDescriptor* descr = schema->Column(index);
+    int value_size = GetTypeByteSize(descr->physical_type());
+    if (descr->physical_type() == Type::BOOLEAN) {
+      value_size = static_cast<int>(sizeof(bool));
+    }
+    auto& buffer = column_buffers_[i];
+    buffer.max_def_level = descr->max_definition_level();
+    buffer.def_levels.resize(kBatchSize);
+    buffer.rep_levels.resize(kBatchSize);
+    buffer.values.resize(kBatchSize * value_size);
   }
   NextRowGroup();
 }
@@ -60,7 +91,7 @@ StreamReader::StreamReader(std::unique_ptr<ParquetFileReader> reader)
 int StreamReader::num_columns() const {
   // Check for file metadata i.e. object is not default constructed.
   if (file_metadata_) {
-    return file_metadata_->num_columns();
+    return static_cast<int>(column_indices_.size());
   }
   return 0;
 }
@@ -284,66 +315,67 @@ void StreamReader::ReadFixedLength(char* ptr, int len) {
 
 void StreamReader::Read(ByteArray* v) {
   const auto& node = nodes_[column_index_];
-  auto reader = static_cast<ByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
+  if (!NextValue(v)) {
+    ThrowReadFailedException(node);
+  }
+}
 
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
+bool StreamReader::ReadOptional(ByteArray* v) { return NextValue(v); }
 
-  if (values_read != 1) {
+void StreamReader::Read(FixedLenByteArray* v) {
+  const auto& node = nodes_[column_index_];
+  if (!NextValue(v)) {
     ThrowReadFailedException(node);
   }
 }
 
-bool StreamReader::ReadOptional(ByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader = static_cast<ByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
+bool StreamReader::ReadOptional(FixedLenByteArray* v) { return NextValue(v); }
 
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
+template <typename DType>
+bool StreamReader::NextTypedValue(typename DType::c_type* v) {
+  using c_type = typename DType::c_type;
+
+  const auto& node = nodes_[column_index_];
+  auto& buffer = column_buffers_[column_index_];
+  auto values = reinterpret_cast<c_type*>(buffer.values.data());
+
+  if (buffer.levels_position == buffer.levels_buffered) {
+    auto reader =
+        static_cast<TypedColumnReader<DType>*>(column_readers_[column_index_].get());
+    int64_t values_read;
+    buffer.levels_buffered =
+        reader->ReadBatch(kBatchSize, buffer.def_levels.data(), buffer.rep_levels.data(),
+                          values, &values_read);
+    buffer.levels_position = 0;
+    buffer.values_position = 0;
+    if (buffer.levels_buffered == 0) {
+      ThrowReadFailedException(node);
+    }
+  }
+  ++column_index_;
 
-  if (values_read == 1) {
-    return true;
-  } else if ((values_read == 0) && (def_level == 0)) {
+  const int64_t level = buffer.levels_position++;
+  if (buffer.max_def_level > 0 && buffer.def_levels[level] < buffer.max_def_level) {
     return false;
   }
-  ThrowReadFailedException(node);
+  *v = values[buffer.values_position++];
+  return true;
 }
 
-void StreamReader::Read(FixedLenByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader =
-      static_cast<FixedLenByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
+bool StreamReader::NextValue(bool* v) { return NextTypedValue<BooleanType>(v); }
 
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
+bool StreamReader::NextValue(int32_t* v) { return NextTypedValue<Int32Type>(v); }
 
-  if (values_read != 1) {
-    ThrowReadFailedException(node);
-  }
-}
+bool StreamReader::NextValue(int64_t* v) { return NextTypedValue<Int64Type>(v); }
 
-bool StreamReader::ReadOptional(FixedLenByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader =
-      static_cast<FixedLenByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
+bool StreamReader::NextValue(float* v) { return NextTypedValue<FloatType>(v); }
 
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
+bool StreamReader::NextValue(double* v) { return NextTypedValue<DoubleType>(v); }
 
-  if (values_read == 1) {
-    return true;
-  } else if ((values_read == 0) && (def_level == 0)) {
-    return false;
-  }
-  ThrowReadFailedException(node);
+bool StreamReader::NextValue(ByteArray* v) { return NextTypedValue<ByteArrayType>(v); }
+
+bool StreamReader::NextValue(FixedLenByteArray* v) {
+  return NextTypedValue<FLBAType>(v);
 }
 
 void StreamReader::EndRow() {
@@ -357,7 +389,7 @@ void StreamReader::EndRow() {
   column_index_ = 0;
   ++current_row_;
 
-  if (!column_readers_[0]->HasNext()) {
+  if (current_row_ - row_group_row_offset_ >= row_group_reader_->metadata()->num_rows()) {
     NextRowGroup();
   }
 }
@@ -368,12 +400,14 @@ void StreamReader::NextRowGroup() {
     row_group_reader_ = file_reader_->RowGroup(row_group_index_);
     ++row_group_index_;
 
-    column_readers_.resize(file_metadata_->num_columns());
+    column_readers_.resize(column_indices_.size());
 
-    for (int i = 0; i < file_metadata_->num_columns(); ++i) {
-      column_readers_[i] = row_group_reader_->Column(i);
+    for (std::size_t i = 0; i < column_indices_.size(); ++i) {
+      column_readers_[i] = row_group_reader_->Column(column_indices_[i]);
+      auto& buffer = column_buffers_[i];
+      buffer.levels_buffered = buffer.levels_position = buffer.values_position = 0;
     }
-    if (column_readers_[0]->HasNext()) {
+    if (row_group_reader_->metadata()->num_rows() > 0) {
       row_group_row_offset_ = current_row_;
       return;
     }
@@ -389,6 +423,7 @@ void StreamReader::SetEof() {
   file_reader_.reset();
   row_group_reader_.reset();
   column_readers_.clear();
+  column_buffers_.clear();
   nodes_.clear();
 }
 
@@ -401,11 +436,11 @@ int64_t StreamReader::SkipRows(int64_t num_rows_to_skip) {
   while (!eof_ && (num_rows_remaining_to_skip > 0)) {
     int64_t num_rows_in_row_group = row_group_reader_->metadata()->num_rows();
     int64_t num_rows_remaining_in_row_group =
-        num_rows_in_row_group - current_row_ - row_group_row_offset_;
+        num_rows_in_row_group - (current_row_ - row_group_row_offset_);
 
     if (num_rows_remaining_in_row_group > num_rows_remaining_to_skip) {
-      for (auto reader : column_readers_) {
-        SkipRowsInColumn(reader.get(), num_rows_remaining_to_skip);
+      for (std::size_t i = 0; i < column_readers_.size(); ++i) {
+        SkipRowsInColumn(static_cast<int>(i), num_rows_remaining_to_skip);
       }
       current_row_ += num_rows_remaining_to_skip;
       num_rows_remaining_to_skip = 0;
@@ -425,14 +460,35 @@ int64_t StreamReader::SkipColumns(int64_t num_columns_to_skip) {
     for (; (num_columns_to_skip > num_columns_skipped) &&
            static_cast<std::size_t>(column_index_) < nodes_.size();
          ++column_index_) {
-      SkipRowsInColumn(column_readers_[column_index_].get(), 1);
+      SkipRowsInColumn(column_index_, 1);
       ++num_columns_skipped;
     }
   }
   return num_columns_skipped;
 }
 
-void StreamReader::SkipRowsInColumn(ColumnReader* reader, int64_t num_rows_to_skip) {
+void StreamReader::SkipRowsInColumn(int column, int64_t num_rows_to_skip) {
+  ColumnReader* reader = column_readers_[column].get();
+  auto& buffer = column_buffers_[column];
+
+  // Consume buffered rows first
+  const int64_t num_buffered = std::min(
+      num_rows_to_skip, buffer.levels_buffered - buffer.levels_position);
+  if (buffer.max_def_level == 0) {
+    buffer.values_position += num_buffered;
+  } else {
+    for (int64_t i = 0; i < num_buffered; ++i) {
+      if (buffer.def_levels[buffer.levels_position + i] == buffer.max_def_level) {
+        ++buffer.values_position;
+      }
+    }
+  }
+  buffer.levels_position += num_buffered;
+  num_rows_to_skip -= num_buffered;
+  if (num_rows_to_skip == 0) {
+    return;
+  }
+
   int64_t num_skipped = 0;
 
   switch (reader->type()) {
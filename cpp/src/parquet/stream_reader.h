@@ -55,6 +55,9 @@ namespace parquet {
 ///
 /// Currently there is no support for repeated fields.
 ///
+/// Values are decoded a batch at a time for each column and then
+/// served one row at a time from those buffers.
+///
 class PARQUET_EXPORT StreamReader {
  public:
   template <typename T>
@@ -67,6 +70,15 @@ class PARQUET_EXPORT StreamReader {
 
   explicit StreamReader(std::unique_ptr<ParquetFileReader> reader);
 
+  /// \brief Read only the given columns, in the given order.
+  ///
+  /// Columns which are not listed are not decoded.  Each row then
+  /// consists of the listed columns only, i.e. current_column() and
+  /// num_columns() refer to the projection and not the file schema.
+  /// An empty list of columns reads all columns.
+  StreamReader(std::unique_ptr<ParquetFileReader> reader,
+               const std::vector<int>& column_indices);
+
   ~StreamReader() = default;
 
   bool eof() const { return eof_; }
@@ -208,14 +220,7 @@ class PARQUET_EXPORT StreamReader {
   template <typename ReaderType, typename T>
   void Read(T* v) {
     const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
-    int64_t values_read;
-
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
-
-    if (values_read != 1) {
+    if (!NextValue(v)) {
       ThrowReadFailedException(node);
     }
   }
@@ -223,15 +228,8 @@ class PARQUET_EXPORT StreamReader {
   template <typename ReaderType, typename ReadType, typename T>
   void Read(T* v) {
     const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
     ReadType tmp;
-    int64_t values_read;
-
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, &tmp, &values_read);
-
-    if (values_read == 1) {
+    if (NextValue(&tmp)) {
       *v = tmp;
     } else {
       ThrowReadFailedException(node);
@@ -240,24 +238,25 @@ class PARQUET_EXPORT StreamReader {
 
   template <typename ReaderType, typename ReadType = typename ReaderType::T, typename T>
   void ReadOptional(optional<T>* v) {
-    const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
     ReadType tmp;
-    int64_t values_read;
-
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, &tmp, &values_read);
-
-    if (values_read == 1) {
+    if (NextValue(&tmp)) {
       *v = T(tmp);
-    } else if ((values_read == 0) && (def_level == 0)) {
-      v->reset();
     } else {
-      ThrowReadFailedException(node);
+      v->reset();
     }
   }
 
+  /// \brief Take the next value of the current column from its buffer,
+  /// decoding another batch if needed, and advance to the next column.
+  /// \return false if the value is null.
+  bool NextValue(bool* v);
+  bool NextValue(int32_t* v);
+  bool NextValue(int64_t* v);
+  bool NextValue(float* v);
+  bool NextValue(double* v);
+  bool NextValue(ByteArray* v);
+  bool NextValue(FixedLenByteArray* v);
+
   void ReadFixedLength(char* ptr, int len);
 
   void Read(ByteArray* v);
@@ -273,16 +272,37 @@ class PARQUET_EXPORT StreamReader {
   void CheckColumn(Type::type physical_type, ConvertedType::type converted_type,
                    int length = 0);
 
-  void SkipRowsInColumn(ColumnReader* reader, int64_t num_rows_to_skip);
+  void SkipRowsInColumn(int column, int64_t num_rows_to_skip);
 
   void SetEof();
 
+  /// \brief Levels and values decoded ahead for one column.
+  ///
+  /// Since repeated fields are not supported, each level is one row
+  /// and values are only present for rows that are not null.
+  struct ColumnBuffer {
+    std::vector<int16_t> def_levels;
+    std::vector<int16_t> rep_levels;
+    // Storage for kBatchSize values of the column's physical type
+    std::vector<uint8_t> values;
+    int16_t max_def_level{0};
+    int64_t levels_buffered{0};
+    int64_t levels_position{0};
+    int64_t values_position{0};
+  };
+
+  template <typename DType>
+  bool NextTypedValue(typename DType::c_type* v);
+
  private:
   std::unique_ptr<ParquetFileReader> file_reader_;
   std::shared_ptr<FileMetaData> file_metadata_;
   std::shared_ptr<RowGroupReader> row_group_reader_;
   std::vector<std::shared_ptr<ColumnReader>> column_readers_;
+  std::vector<ColumnBuffer> column_buffers_;
   std::vector<std::shared_ptr<schema::PrimitiveNode>> nodes_;
+  // Indices in the file schema of the columns read, in reading order
+  std::vector<int> column_indices_;
 
   bool eof_{true};
   int row_group_index_{0};
@@ -290,7 +310,7 @@ class PARQUET_EXPORT StreamReader {
   int64_t current_row_{0};
   int64_t row_group_row_offset_{0};
 
-  static constexpr int64_t kBatchSizeOne = 1;
+  static constexpr int64_t kBatchSize = 1024;
 };  // namespace parquet
 
 PARQUET_EXPORT
@@ -583,6 +583,132 @@ TEST_F(TestStreamReader, SkipColumns) {
   EXPECT_EQ(0, reader_.SkipColumns(100));
 }
 
+TEST_F(TestStreamReader, ColumnProjection) {
+  PARQUET_ASSIGN_OR_THROW(auto infile, ::arrow::io::ReadableFile::Open(GetDataFile()));
+  // Read double_field, string_field and int32_field only
+  StreamReader reader{parquet::ParquetFileReader::Open(infile), {10, 1, 6}};
+
+  EXPECT_EQ(3, reader.num_columns());
+  EXPECT_EQ(TestData::num_rows, reader.num_rows());
+
+  bool b;
+  double d;
+  std::string str;
+  int32_t int32;
+
+  int i;
+
+  for (i = 0; !reader.eof(); ++i) {
+    EXPECT_EQ(i, reader.current_row());
+
+    // Column types are checked against the projection.
+    EXPECT_THROW(reader >> b, ParquetException);
+
+    reader >> d;
+    reader >> str;
+    if (i % 5 == 0) {
+      EXPECT_EQ(1, reader.SkipColumns(10)) << "index: " << i;
+    } else {
+      reader >> int32;
+      EXPECT_EQ(int32, TestData::GetInt32(i)) << "index: " << i;
+    }
+    EXPECT_EQ(3, reader.current_column()) << "index: " << i;
+    reader >> EndRow;
+
+    EXPECT_DOUBLE_EQ(d, TestData::GetDouble(i)) << "index: " << i;
+    EXPECT_EQ(str, TestData::GetString(i)) << "index: " << i;
+  }
+  EXPECT_EQ(i, TestData::num_rows);
+  EXPECT_EQ(reader.current_row(), TestData::num_rows);
+  EXPECT_EQ(3, reader.num_columns());
+}
+
+TEST_F(TestStreamReader, InvalidColumnProjection) {
+  PARQUET_ASSIGN_OR_THROW(auto infile, ::arrow::io::ReadableFile::Open(GetDataFile()));
+  EXPECT_THROW(StreamReader(parquet::ParquetFileReader::Open(infile), {0, 11}),
+               ParquetException);
+}
+
+class TestMultipleRowGroups : public ::testing::Test {
+ public:
+  // Larger than the internal batch size, and not a multiple of it
+  static constexpr int kRowsPerRowGroup = 1500;
+  static constexpr int kNumRowGroups = 3;
+
+ protected:
+  const char* GetDataFile() const { return "stream_reader_row_groups_test.parquet"; }
+
+  void SetUp() {
+    createTestFile();
+    PARQUET_ASSIGN_OR_THROW(auto infile, ::arrow::io::ReadableFile::Open(GetDataFile()));
+    reader_ = StreamReader{parquet::ParquetFileReader::Open(infile)};
+  }
+
+  void TearDown() { reader_ = StreamReader{}; }
+
+  static int32_t GetInt32(int i) { return i * 3; }
+
+  static optional<std::string> GetOptString(int i) {
+    if (i % 4 == 0) {
+      return {};
+    }
+    return std::to_string(i);
+  }
+
+  void createTestFile() {
+    schema::NodeVector fields;
+    fields.push_back(schema::PrimitiveNode::Make("int32_field", Repetition::REQUIRED,
+                                                 Type::INT32, ConvertedType::INT_32));
+    fields.push_back(schema::PrimitiveNode::Make("string_field", Repetition::OPTIONAL,
+                                                 Type::BYTE_ARRAY, ConvertedType::UTF8));
+    auto schema = std::static_pointer_cast<schema::GroupNode>(
+        schema::GroupNode::Make("schema", Repetition::REQUIRED, fields));
+
+    PARQUET_ASSIGN_OR_THROW(auto outfile,
+                            ::arrow::io::FileOutputStream::Open(GetDataFile()));
+    StreamWriter os{ParquetFileWriter::Open(outfile, schema)};
+
+    for (int i = 0; i < kRowsPerRowGroup * kNumRowGroups; ++i) {
+      os << GetInt32(i) << GetOptString(i) << EndRow;
+      if ((i + 1) % kRowsPerRowGroup == 0) {
+        os << EndRowGroup;
+      }
+    }
+  }
+
+  StreamReader reader_;
+};
+
+constexpr int TestMultipleRowGroups::kRowsPerRowGroup;
+constexpr int TestMultipleRowGroups::kNumRowGroups;
+
+TEST_F(TestMultipleRowGroups, ReadAndSkipRows) {
+  const int num_rows = kRowsPerRowGroup * kNumRowGroups;
+  EXPECT_EQ(num_rows, reader_.num_rows());
+
+  int32_t int32;
+  optional<std::string> str;
+
+  int i = 0;
+  while (!reader_.eof()) {
+    EXPECT_EQ(i, reader_.current_row());
+
+    reader_ >> int32 >> str >> EndRow;
+    EXPECT_EQ(int32, GetInt32(i)) << "index: " << i;
+    EXPECT_EQ(str, GetOptString(i)) << "index: " << i;
+    ++i;
+
+    // Skips which end inside buffered values, past them and across
+    // row groups.
+    const int64_t num_rows_to_skip = (i % 3 == 0) ? 1 : 700;
+    const int64_t num_rows_skipped = reader_.SkipRows(num_rows_to_skip);
+    EXPECT_EQ(std::min<int64_t>(num_rows_to_skip, num_rows - i), num_rows_skipped);
+    i += static_cast<int>(num_rows_skipped);
+  }
+  EXPECT_EQ(num_rows, i);
+  EXPECT_EQ(num_rows, reader_.current_row());
+}
+
 class TestOptionalFields : public ::testing::Test {
  public:
   TestOptionalFields() { createTestFile(); }
@@ -72,6 +72,7 @@ class FileMetaData;
 class SchemaDescriptor;
 
 class ReaderProperties;
+struct ReaderMetrics;
 class ArrowReaderProperties;
 
 class WriterProperties;
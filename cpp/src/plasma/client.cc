@@ -225,7 +225,7 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   Status Create(const ObjectID& object_id, int64_t data_size, const uint8_t* metadata,
                 int64_t metadata_size, std::shared_ptr<Buffer>* data, int device_num = 0,
-                bool evict_if_full = true);
+                bool evict_if_full = true, double cost = 0);
 
   Status CreateAndSeal(const ObjectID& object_id, const std::string& data,
                        const std::string& metadata, bool evict_if_full = true);
@@ -419,13 +419,16 @@ arrow::Result<std::shared_ptr<CudaContext>> PlasmaClient::Impl::GetCudaContext(
 Status PlasmaClient::Impl::Create(const ObjectID& object_id, int64_t data_size,
                                   const uint8_t* metadata, int64_t metadata_size,
                                   std::shared_ptr<Buffer>* data, int device_num,
-                                  bool evict_if_full) {
+                                  bool evict_if_full, double cost) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
+  if (!(cost >= 0)) {
+    return Status::Invalid("The cost of an object cannot be negative, got ", cost);
+  }
   ARROW_LOG(DEBUG) << "called plasma_create on conn " << store_conn_ << " with size "
                    << data_size << " and metadata size " << metadata_size;
   RETURN_NOT_OK(SendCreateRequest(store_conn_, object_id, evict_if_full, data_size,
-                                  metadata_size, device_num));
+                                  metadata_size, device_num, cost));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaCreateReply, &buffer));
   ObjectID id;
@@ -1136,9 +1139,9 @@ Status PlasmaClient::SetClientOptions(const std::string& client_name,
 Status PlasmaClient::Create(const ObjectID& object_id, int64_t data_size,
                             const uint8_t* metadata, int64_t metadata_size,
                             std::shared_ptr<Buffer>* data, int device_num,
-                            bool evict_if_full) {
+                            bool evict_if_full, double cost) {
   return impl_->Create(object_id, data_size, metadata, metadata_size, data, device_num,
-                       evict_if_full);
+                       evict_if_full, cost);
 }
 
 Status PlasmaClient::CreateAndSeal(const ObjectID& object_id, const std::string& data,
@@ -91,13 +91,17 @@ class ARROW_EXPORT PlasmaClient {
   ///        device_num = 2 corresponds to GPU1, etc.
   /// \param evict_if_full Whether to evict other objects to make space for
   ///        this object.
+  /// \param cost The cost of reconstructing the object, e.g. the time it took
+  ///        to compute it, in any unit common to all the objects. It is only
+  ///        used by the cost-aware eviction policy of the store (-p cost).
+  ///        0 keeps the default cost of 1.
   /// \return The return status.
   ///
   /// The returned object must be released once it is done with.  It must also
   /// be either sealed or aborted.
   Status Create(const ObjectID& object_id, int64_t data_size, const uint8_t* metadata,
                 int64_t metadata_size, std::shared_ptr<Buffer>* data, int device_num = 0,
-                bool evict_if_full = true);
+                bool evict_if_full = true, double cost = 0);
 
   /// Create and seal an object in the object store. This is an optimization
   /// which allows small objects to be created quickly with fewer messages to
@@ -0,0 +1,146 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/cost_aware_policy.h"
+#include "plasma/plasma_allocator.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace plasma {
+
+CostAwarePolicy::CostAwarePolicy(PlasmaStoreInfo* store_info, int64_t max_size)
+    : EvictionPolicy(store_info, max_size),
+      inflation_(0),
+      evictable_bytes_(0),
+      num_evictions_total_(0),
+      bytes_evicted_total_(0) {}
+
+void CostAwarePolicy::AddEvictable(const ObjectID& object_id, ObjectStats* stats) {
+  ARROW_CHECK(!stats->evictable);
+  // Count empty objects as one byte
+  auto size = static_cast<double>(std::max<int64_t>(stats->size, 1));
+  double priority =
+      inflation_ + static_cast<double>(stats->num_accesses) * stats->cost / size;
+  // Inserted after the objects of equal priority
+  stats->position = queue_.emplace(priority, object_id);
+  stats->evictable = true;
+  evictable_bytes_ += stats->size;
+}
+
+void CostAwarePolicy::RemoveEvictable(ObjectStats* stats) {
+  if (stats->evictable) {
+    queue_.erase(stats->position);
+    stats->evictable = false;
+    evictable_bytes_ -= stats->size;
+  }
+}
+
+void CostAwarePolicy::SetObjectCost(const ObjectID& object_id, double cost) {
+  ARROW_CHECK(cost > 0) << "the cost of an object must be positive";
+  auto it = objects_.find(object_id);
+  if (it == objects_.end()) {
+    return;
+  }
+  auto& stats = it->second;
+  stats.cost = cost;
+  if (stats.evictable) {
+    RemoveEvictable(&stats);
+    AddEvictable(object_id, &stats);
+  }
+}
+
+void CostAwarePolicy::ObjectCreated(const ObjectID& object_id, Client* client,
+                                    bool is_create) {
+  auto& stats = objects_[object_id];
+  RemoveEvictable(&stats);
+  stats.size = GetObjectSize(object_id);
+  // The creation counts as the first access
+  stats.num_accesses = 1;
+  stats.cost = 1;
+  AddEvictable(object_id, &stats);
+}
+
+void CostAwarePolicy::BeginObjectAccess(const ObjectID& object_id) {
+  auto it = objects_.find(object_id);
+  ARROW_CHECK(it != objects_.end());
+  RemoveEvictable(&it->second);
+  pinned_memory_bytes_ += it->second.size;
+}
+
+void CostAwarePolicy::EndObjectAccess(const ObjectID& object_id) {
+  auto it = objects_.find(object_id);
+  ARROW_CHECK(it != objects_.end());
+  auto& stats = it->second;
+  pinned_memory_bytes_ -= stats.size;
+  stats.num_accesses++;
+  AddEvictable(object_id, &stats);
+}
+
+int64_t CostAwarePolicy::ChooseObjectsToEvict(int64_t num_bytes_required,
+                                              std::vector<ObjectID>* objects_to_evict) {
+  int64_t bytes_evicted = 0;
+  while (bytes_evicted < num_bytes_required && !queue_.empty()) {
+    auto first = queue_.begin();
+    // Age the remaining objects
+    inflation_ = first->first;
+    auto it = objects_.find(first->second);
+    bytes_evicted += it->second.size;
+    objects_to_evict->push_back(it->first);
+    RemoveEvictable(&it->second);
+    objects_.erase(it);
+    num_evictions_total_++;
+  }
+  bytes_evicted_total_ += bytes_evicted;
+  return bytes_evicted;
+}
+
+void CostAwarePolicy::RemoveObject(const ObjectID& object_id) {
+  auto it = objects_.find(object_id);
+  if (it != objects_.end()) {
+    RemoveEvictable(&it->second);
+    objects_.erase(it);
+  }
+}
+
+void CostAwarePolicy::RefreshObjects(const std::vector<ObjectID>& object_ids) {
+  for (const auto& object_id : object_ids) {
+    auto it = objects_.find(object_id);
+    if (it != objects_.end() && it->second.evictable) {
+      auto& stats = it->second;
+      RemoveEvictable(&stats);
+      stats.num_accesses++;
+      AddEvictable(object_id, &stats);
+    }
+  }
+}
+
+std::string CostAwarePolicy::DebugString() const {
+  std::stringstream result;
+  result << "allocated bytes: " << PlasmaAllocator::Allocated();
+  result << "\nallocation limit: " << PlasmaAllocator::GetFootprintLimit();
+  result << "\npinned bytes: " << pinned_memory_bytes_;
+  result << "\nnum objects: " << objects_.size();
+  result << "\nnum evictable objects: " << queue_.size();
+  result << "\nevictable bytes: " << evictable_bytes_;
+  result << "\npriority floor: " << inflation_;
+  result << "\nnum evictions: " << num_evictions_total_;
+  result << "\nbytes evicted: " << bytes_evicted_total_;
+  return result.str();
+}
+
+}  // namespace plasma
@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "plasma/common.h"
+#include "plasma/eviction_policy.h"
+#include "plasma/plasma.h"
+
+namespace plasma {
+
+/// An eviction policy weighing the size, the access frequency and the cost of
+/// the objects, instead of only their recency (GreedyDual-Size-Frequency).
+///
+/// Each unpinned object has the priority L + accesses * cost / size, where L
+/// is the priority of the last evicted object, and the objects of lowest
+/// priority are evicted first. Large objects which are rarely read, or cheap
+/// to recompute, are thus evicted before small and hot ones; as L grows with
+/// every eviction, objects which are not read anymore age out eventually.
+/// Objects of equal priority are evicted in insertion order.
+///
+/// The cost of an object is 1 unless its creator passed another one to
+/// PlasmaClient::Create. Memory quotas are not supported.
+class CostAwarePolicy : public EvictionPolicy {
+ public:
+  /// Construct a cost-aware eviction policy.
+  ///
+  /// \param store_info Information about the Plasma store that is exposed
+  ///        to the eviction policy.
+  /// \param max_size Max size in bytes total of objects to store.
+  explicit CostAwarePolicy(PlasmaStoreInfo* store_info, int64_t max_size);
+
+  void ObjectCreated(const ObjectID& object_id, Client* client, bool is_create) override;
+  void SetObjectCost(const ObjectID& object_id, double cost) override;
+  void BeginObjectAccess(const ObjectID& object_id) override;
+  void EndObjectAccess(const ObjectID& object_id) override;
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+  void RemoveObject(const ObjectID& object_id) override;
+  void RefreshObjects(const std::vector<ObjectID>& object_ids) override;
+  std::string DebugString() const override;
+
+ private:
+  using PriorityQueue = std::multimap<double, ObjectID>;
+
+  struct ObjectStats {
+    int64_t size = 0;
+    int64_t num_accesses = 0;
+    double cost = 1;
+    /// The position in the queue, if the object is not pinned.
+    PriorityQueue::iterator position;
+    bool evictable = false;
+  };
+
+  /// Add an object to the queue with its current priority.
+  void AddEvictable(const ObjectID& object_id, ObjectStats* stats);
+  /// Remove an object from the queue, if it is there.
+  void RemoveEvictable(ObjectStats* stats);
+
+  /// The priority of the last evicted object.
+  double inflation_;
+  /// The objects in the store.
+  std::unordered_map<ObjectID, ObjectStats> objects_;
+  /// The unpinned objects by priority.
+  PriorityQueue queue_;
+  /// The number of bytes of the unpinned objects.
+  int64_t evictable_bytes_;
+  /// The number of objects evicted.
+  int64_t num_evictions_total_;
+  /// The number of bytes evicted.
+  int64_t bytes_evicted_total_;
+};
+
+}  // namespace plasma
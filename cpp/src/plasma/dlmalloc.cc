@@ -23,8 +23,14 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
 
+#include <algorithm>
 #include <cerrno>
 #include <string>
 #include <vector>
@@ -63,6 +69,9 @@ int fake_munmap(void*, int64_t);
 
 constexpr int GRANULARITY_MULTIPLIER = 2;
 
+// The NUMA node to place the memory on, or -1 for the default placement.
+static int numa_node = -1;
+
 static void* pointer_advance(void* p, ptrdiff_t n) { return (unsigned char*)p + n; }
 
 static void* pointer_retreat(void* p, ptrdiff_t n) { return (unsigned char*)p - n; }
@@ -105,6 +114,41 @@ int create_buffer(int64_t size) {
   return fd;
 }
 
+Status BindToNumaNode(void* pointer, size_t size, int node) {
+#ifdef __linux__
+  if (node < 0) {
+    return Status::Invalid("NUMA nodes are numbered from 0, got ", node);
+  }
+  const size_t bits_per_word = 8 * sizeof(unsigned long);  // NOLINT
+  std::vector<unsigned long> node_mask(node / bits_per_word + 1, 0);  // NOLINT
+  node_mask[node / bits_per_word] |= 1UL << (node % bits_per_word);
+  // The kernel ignores the last bit of the mask. The policy is shared by the
+  // clients mapping the same file.
+  if (syscall(SYS_mbind, pointer, size, MPOL_PREFERRED, node_mask.data(),
+              node_mask.size() * bits_per_word + 1, 0) != 0) {
+    return Status::IOError("mbind to NUMA node ", node, " failed: ", strerror(errno));
+  }
+  return Status::OK();
+#else
+  return Status::NotImplemented("NUMA placement is only supported on Linux");
+#endif
+}
+
+// Fault the pages of a mapping in, so that the clients do not stall on the
+// page faults of their first accesses.
+static void prefault(void* pointer, size_t size, int fd) {
+  struct stat file_stat;
+  // Huge page file systems report the huge page size
+  int64_t page_size = sysconf(_SC_PAGESIZE);
+  if (fstat(fd, &file_stat) == 0) {
+    page_size = std::max<int64_t>(page_size, file_stat.st_blksize);
+  }
+  volatile uint8_t* data = reinterpret_cast<uint8_t*>(pointer);
+  for (size_t i = 0; i < size; i += page_size) {
+    data[i] = 0;
+  }
+}
+
 void* fake_mmap(size_t size) {
   // Add kMmapRegionsGap so that the returned pointer is deliberately not
   // page-aligned. This ensures that the segments of memory returned by
@@ -125,6 +169,17 @@ void* fake_mmap(size_t size) {
     }
     return pointer;
   }
+  if (numa_node >= 0) {
+    // SetMallocNumaNode checked the node, so this only fails on a change of the
+    // machine's NUMA configuration; the memory is still usable without the policy
+    Status s = BindToNumaNode(pointer, size, numa_node);
+    if (!s.ok()) {
+      ARROW_LOG(WARNING) << s.ToString();
+    }
+  }
+  if (plasma_config->hugepages_enabled) {
+    prefault(pointer, size, fd);
+  }
 
   // Increase dlmalloc's allocation granularity directly.
   mparams.granularity *= GRANULARITY_MULTIPLIER;
@@ -163,4 +218,20 @@ int fake_munmap(void* addr, int64_t size) {
 
 void SetMallocGranularity(int value) { change_mparam(M_GRANULARITY, value); }
 
+Status SetMallocNumaNode(int node) {
+  if (node >= 0) {
+    const size_t page_size = sysconf(_SC_PAGESIZE);
+    void* pointer =
+        mmap(NULL, page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (pointer == MAP_FAILED) {
+      return Status::IOError("mmap failed: ", strerror(errno));
+    }
+    Status s = BindToNumaNode(pointer, page_size, node);
+    munmap(pointer, page_size);
+    RETURN_NOT_OK(s);
+  }
+  numa_node = node;
+  return Status::OK();
+}
+
 }  // namespace plasma
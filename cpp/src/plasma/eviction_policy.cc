@@ -109,6 +109,8 @@ void EvictionPolicy::ObjectCreated(const ObjectID& object_id, Client* client,
   cache_.Add(object_id, GetObjectSize(object_id));
 }
 
+void EvictionPolicy::SetObjectCost(const ObjectID& object_id, double cost) {}
+
 bool EvictionPolicy::SetClientQuota(Client* client, int64_t output_memory_quota) {
   return false;
 }
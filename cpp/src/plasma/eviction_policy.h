@@ -112,6 +112,13 @@ class EvictionPolicy {
   /// \param is_create Whether we are creating a new object (vs reading an object).
   virtual void ObjectCreated(const ObjectID& object_id, Client* client, bool is_create);
 
+  /// Set the cost of reconstructing an object, as given by the client that
+  /// created it. Policies which do not weigh costs ignore it.
+  ///
+  /// \param object_id The ID of the object, which must be in the store.
+  /// \param cost The positive cost of the object.
+  virtual void SetObjectCost(const ObjectID& object_id, double cost);
+
   /// Set quota for a client.
   ///
   /// \param client The pointer to the client.
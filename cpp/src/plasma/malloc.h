@@ -22,8 +22,12 @@
 
 #include <unordered_map>
 
+#include "arrow/status.h"
+
 namespace plasma {
 
+using arrow::Status;
+
 /// Gap between two consecutive mmap regions allocated by fake_mmap.
 /// This ensures that the segments of memory returned by
 /// fake_mmap are never contiguous and dlmalloc does not coalesce it
@@ -48,4 +52,23 @@ struct MmapRecord {
 /// and size.
 extern std::unordered_map<void*, MmapRecord> mmap_records;
 
+/// Make the pages of a mapping prefer the memory of a NUMA node.
+///
+/// \param pointer The start of the mapping, which must be page-aligned.
+/// \param size The size of the mapping.
+/// \param node The NUMA node.
+/// \return An IOError if the kernel rejects the node, e.g. because it is not
+/// online, and NotImplemented outside of Linux.
+Status BindToNumaNode(void* pointer, size_t size, int node);
+
+/// Place the memory mapped from now on on a NUMA node.
+///
+/// The node is first tried on a scratch mapping, so that an invalid node is
+/// reported here instead of being ignored on every later mapping.
+///
+/// \param node The NUMA node, or -1 for the default placement.
+/// \return The error of BindToNumaNode if the node cannot be used, in which
+/// case the placement is left unchanged.
+Status SetMallocNumaNode(int node);
+
 }  // namespace plasma
@@ -184,17 +184,18 @@ Status ReadGetDebugStringReply(const uint8_t* data, size_t size,
 // Create messages.
 
 Status SendCreateRequest(int sock, ObjectID object_id, bool evict_if_full,
-                         int64_t data_size, int64_t metadata_size, int device_num) {
+                         int64_t data_size, int64_t metadata_size, int device_num,
+                         double cost) {
   flatbuffers::FlatBufferBuilder fbb;
-  auto message =
-      fb::CreatePlasmaCreateRequest(fbb, fbb.CreateString(object_id.binary()),
-                                    evict_if_full, data_size, metadata_size, device_num);
+  auto message = fb::CreatePlasmaCreateRequest(fbb, fbb.CreateString(object_id.binary()),
+                                               evict_if_full, data_size, metadata_size,
+                                               device_num, cost);
   return PlasmaSend(sock, MessageType::PlasmaCreateRequest, &fbb, message);
 }
 
 Status ReadCreateRequest(const uint8_t* data, size_t size, ObjectID* object_id,
                          bool* evict_if_full, int64_t* data_size, int64_t* metadata_size,
-                         int* device_num) {
+                         int* device_num, double* cost) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaCreateRequest>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
@@ -203,6 +204,7 @@ Status ReadCreateRequest(const uint8_t* data, size_t size, ObjectID* object_id,
   *metadata_size = message->metadata_size();
   *object_id = ObjectID::from_binary(message->object_id()->str());
   *device_num = message->device_num();
+  *cost = message->cost();
   return Status::OK();
 }
 
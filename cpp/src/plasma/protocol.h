@@ -78,11 +78,12 @@ Status ReadGetDebugStringReply(const uint8_t* data, size_t size,
 /* Plasma Create message functions. */
 
 Status SendCreateRequest(int sock, ObjectID object_id, bool evict_if_full,
-                         int64_t data_size, int64_t metadata_size, int device_num);
+                         int64_t data_size, int64_t metadata_size, int device_num,
+                         double cost);
 
 Status ReadCreateRequest(const uint8_t* data, size_t size, ObjectID* object_id,
                          bool* evict_if_full, int64_t* data_size, int64_t* metadata_size,
-                         int* device_num);
+                         int* device_num, double* cost);
 
 Status SendCreateReply(int sock, ObjectID object_id, PlasmaObject* object,
                        PlasmaError error, int64_t mmap_size);
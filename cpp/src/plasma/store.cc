@@ -61,11 +61,13 @@
 
 #include "plasma/common.h"
 #include "plasma/common_generated.h"
+#include "plasma/cost_aware_policy.h"
 #include "plasma/fling.h"
 #include "plasma/io.h"
 #include "plasma/malloc.h"
 #include "plasma/plasma_allocator.h"
 #include "plasma/protocol.h"
+#include "plasma/quota_aware_policy.h"
 
 #ifdef PLASMA_CUDA
 #include "arrow/gpu/cuda_api.h"
@@ -117,10 +119,18 @@ Client::Client(int fd) : fd(fd), notification_fd(-1) {}
 
 PlasmaStore::PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
                          const std::string& socket_name,
-                         std::shared_ptr<ExternalStore> external_store)
-    : loop_(loop),
-      eviction_policy_(&store_info_, PlasmaAllocator::GetFootprintLimit()),
-      external_store_(external_store) {
+                         std::shared_ptr<ExternalStore> external_store,
+                         const std::string& eviction_policy)
+    : loop_(loop), external_store_(external_store) {
+  if (eviction_policy == "cost") {
+    eviction_policy_.reset(
+        new CostAwarePolicy(&store_info_, PlasmaAllocator::GetFootprintLimit()));
+  } else {
+    ARROW_CHECK(eviction_policy == "lru")
+        << "unknown eviction policy " << eviction_policy;
+    eviction_policy_.reset(
+        new QuotaAwarePolicy(&store_info_, PlasmaAllocator::GetFootprintLimit()));
+  }
   store_info_.directory = directory;
   store_info_.hugepages_enabled = hugepages_enabled;
 }
@@ -142,7 +152,7 @@ void PlasmaStore::AddToClientObjectIds(const ObjectID& object_id, ObjectTableEnt
   // that the object is being used.
   if (entry->ref_count == 0) {
     // Tell the eviction policy that this object is being used.
-    eviction_policy_.BeginObjectAccess(object_id);
+    eviction_policy_->BeginObjectAccess(object_id);
   }
   // Increase reference count.
   entry->ref_count++;
@@ -158,7 +168,7 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, bool evict_if_full, int* fd,
   // First free up space from the client's LRU queue if quota enforcement is on.
   if (evict_if_full) {
     std::vector<ObjectID> client_objects_to_evict;
-    bool quota_ok = eviction_policy_.EnforcePerClientQuota(client, size, is_create,
+    bool quota_ok = eviction_policy_->EnforcePerClientQuota(client, size, is_create,
                                                            &client_objects_to_evict);
     if (!quota_ok) {
       return nullptr;
@@ -185,7 +195,7 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, bool evict_if_full, int* fd,
     }
     // Tell the eviction policy how much space we need to create this object.
     std::vector<ObjectID> objects_to_evict;
-    bool success = eviction_policy_.RequireSpace(size, &objects_to_evict);
+    bool success = eviction_policy_->RequireSpace(size, &objects_to_evict);
     EvictObjects(objects_to_evict);
     // Return an error to the client if not enough space could be freed to
     // create the object.
@@ -298,7 +308,7 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, bool evict_if_f
   // Notify the eviction policy that this object was created. This must be done
   // immediately before the call to AddToClientObjectIds so that the
   // eviction policy does not have an opportunity to evict the object.
-  eviction_policy_.ObjectCreated(object_id, client, true);
+  eviction_policy_->ObjectCreated(object_id, client, true);
   // Record that this client is using this object.
   AddToClientObjectIds(object_id, store_info_.objects[object_id].get(), client);
   return PlasmaError::OK;
@@ -476,7 +486,7 @@ void PlasmaStore::ProcessGetRequest(Client* client,
       if (entry->pointer) {
         entry->state = ObjectState::PLASMA_CREATED;
         entry->create_time = std::time(nullptr);
-        eviction_policy_.ObjectCreated(object_id, client, false);
+        eviction_policy_->ObjectCreated(object_id, client, false);
         AddToClientObjectIds(object_id, store_info_.objects[object_id].get(), client);
         evicted_ids.push_back(object_id);
         evicted_entries.push_back(entry);
@@ -550,7 +560,7 @@ int PlasmaStore::RemoveFromClientObjectIds(const ObjectID& object_id,
     if (entry->ref_count == 0) {
       if (deletion_cache_.count(object_id) == 0) {
         // Tell the eviction policy that this object is no longer being used.
-        eviction_policy_.EndObjectAccess(object_id);
+        eviction_policy_->EndObjectAccess(object_id);
       } else {
         // Above code does not really delete an object. Instead, it just put an
         // object to LRU cache which will be cleaned when the memory is not enough.
@@ -668,7 +678,7 @@ PlasmaError PlasmaStore::DeleteObject(ObjectID& object_id) {
     return PlasmaError::ObjectInUse;
   }
 
-  eviction_policy_.RemoveObject(object_id);
+  eviction_policy_->RemoveObject(object_id);
   EraseFromObjectTable(object_id);
   // Inform all subscribers that the object has been deleted.
   fb::ObjectInfoT notification;
@@ -754,7 +764,7 @@ void PlasmaStore::DisconnectClient(int client_fd) {
   ARROW_LOG(INFO) << "Disconnecting client on fd " << client_fd;
   // Release all the objects that the client was using.
   auto client = it->second.get();
-  eviction_policy_.ClientDisconnected(client);
+  eviction_policy_->ClientDisconnected(client);
   std::unordered_map<ObjectID, ObjectTableEntry*> sealed_objects;
   for (const auto& object_id : client->object_ids) {
     auto it = store_info_.objects.find(object_id);
@@ -946,10 +956,14 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       int64_t data_size;
       int64_t metadata_size;
       int device_num;
+      double cost;
       RETURN_NOT_OK(ReadCreateRequest(input, input_size, &object_id, &evict_if_full,
-                                      &data_size, &metadata_size, &device_num));
+                                      &data_size, &metadata_size, &device_num, &cost));
       PlasmaError error_code = CreateObject(object_id, evict_if_full, data_size,
                                             metadata_size, device_num, client, &object);
+      if (error_code == PlasmaError::OK && cost > 0) {
+        eviction_policy_->SetObjectCost(object_id, cost);
+      }
       int64_t mmap_size = 0;
       if (error_code == PlasmaError::OK && device_num == 0) {
         mmap_size = GetMmapSize(object.store_fd);
@@ -1100,14 +1114,14 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       RETURN_NOT_OK(ReadEvictRequest(input, input_size, &num_bytes));
       std::vector<ObjectID> objects_to_evict;
       int64_t num_bytes_evicted =
-          eviction_policy_.ChooseObjectsToEvict(num_bytes, &objects_to_evict);
+          eviction_policy_->ChooseObjectsToEvict(num_bytes, &objects_to_evict);
       EvictObjects(objects_to_evict);
       HANDLE_SIGPIPE(SendEvictReply(client->fd, num_bytes_evicted), client->fd);
     } break;
     case fb::MessageType::PlasmaRefreshLRURequest: {
       std::vector<ObjectID> object_ids;
       RETURN_NOT_OK(ReadRefreshLRURequest(input, input_size, &object_ids));
-      eviction_policy_.RefreshObjects(object_ids);
+      eviction_policy_->RefreshObjects(object_ids);
       HANDLE_SIGPIPE(SendRefreshLRUReply(client->fd), client->fd);
     } break;
     case fb::MessageType::PlasmaSubscribeRequest:
@@ -1127,13 +1141,13 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       RETURN_NOT_OK(
           ReadSetOptionsRequest(input, input_size, &client_name, &output_memory_quota));
       client->name = client_name;
-      bool success = eviction_policy_.SetClientQuota(client, output_memory_quota);
+      bool success = eviction_policy_->SetClientQuota(client, output_memory_quota);
       HANDLE_SIGPIPE(SendSetOptionsReply(client->fd, success ? PlasmaError::OK
                                                              : PlasmaError::OutOfMemory),
                      client->fd);
     } break;
     case fb::MessageType::PlasmaGetDebugStringRequest: {
-      HANDLE_SIGPIPE(SendGetDebugStringReply(client->fd, eviction_policy_.DebugString()),
+      HANDLE_SIGPIPE(SendGetDebugStringReply(client->fd, eviction_policy_->DebugString()),
                      client->fd);
     } break;
     default:
@@ -1148,11 +1162,12 @@ class PlasmaStoreRunner {
   PlasmaStoreRunner() {}
 
   void Start(char* socket_name, std::string directory, bool hugepages_enabled,
-             std::shared_ptr<ExternalStore> external_store) {
+             std::shared_ptr<ExternalStore> external_store,
+             const std::string& eviction_policy) {
     // Create the event loop.
     loop_.reset(new EventLoop);
     store_.reset(new PlasmaStore(loop_.get(), directory, hugepages_enabled, socket_name,
-                                 external_store));
+                                 external_store, eviction_policy));
     plasma_config = store_->GetPlasmaStoreInfo();
 
     // We are using a single memory-mapped file by mallocing and freeing a single
@@ -1202,14 +1217,16 @@ void HandleSignal(int signal) {
 }
 
 void StartServer(char* socket_name, std::string plasma_directory, bool hugepages_enabled,
-                 std::shared_ptr<ExternalStore> external_store) {
+                 std::shared_ptr<ExternalStore> external_store,
+                 const std::string& eviction_policy) {
   // Ignore SIGPIPE signals. If we don't do this, then when we attempt to write
   // to a client that has already died, the store could die.
   signal(SIGPIPE, SIG_IGN);
 
   g_runner.reset(new PlasmaStoreRunner());
   signal(SIGTERM, HandleSignal);
-  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store);
+  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store,
+                  eviction_policy);
 }
 
 // Function to use (instead of ARROW_LOG(FATAL)) for usage, etc. errors before
@@ -1237,6 +1254,10 @@ DEFINE_bool(h, false, "whether to enable hugepage support");
 DEFINE_string(s, "",
               "socket name where the Plasma store will listen for requests, required");
 DEFINE_string(m, "", "amount of memory in bytes to use for Plasma store, required");
+DEFINE_int32(n, -1, "NUMA node to place the shared memory on, optional (Linux only)");
+DEFINE_string(p, "lru",
+              "eviction policy: lru (least recently used objects first, with client "
+              "quotas) or cost (weighing size, frequency and cost of objects)");
 
 int main(int argc, char* argv[]) {
   ArrowLog::StartArrowLog(argv[0], ArrowLogLevel::ARROW_INFO);
@@ -1288,6 +1309,9 @@ int main(int argc, char* argv[]) {
     plasma::ExitWithUsageError(
         "please specify the amount of memory (in bytes) to use with -m");
   }
+  if (FLAGS_p != "lru" && FLAGS_p != "cost") {
+    plasma::ExitWithUsageError("-p switch takes an eviction policy, lru or cost");
+  }
   if (hugepages_enabled && plasma_directory.empty()) {
     plasma::ExitWithUsageError(
         "if you want to use hugepages, please specify path to huge pages "
@@ -1325,6 +1349,14 @@ int main(int argc, char* argv[]) {
     plasma::SetMallocGranularity(1024 * 1024 * 1024);  // 1 GiB
   }
 #endif
+  if (FLAGS_n >= 0) {
+    arrow::Status s = plasma::SetMallocNumaNode(FLAGS_n);
+    if (!s.ok()) {
+      std::string error_msg = "-n switch takes an online NUMA node: " + s.message();
+      plasma::ExitWithUsageError(error_msg.c_str());
+    }
+    ARROW_LOG(INFO) << "Placing the shared memory on NUMA node " << FLAGS_n;
+  }
 
   // Get external store
   std::shared_ptr<plasma::ExternalStore> external_store{nullptr};
@@ -1343,7 +1375,8 @@ int main(int argc, char* argv[]) {
   }
 
   ARROW_LOG(DEBUG) << "starting server listening on " << socket_name;
-  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store);
+  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store,
+                      FLAGS_p);
   plasma::g_runner->Shutdown();
   plasma::g_runner = nullptr;
 
@@ -26,10 +26,10 @@
 
 #include "plasma/common.h"
 #include "plasma/events.h"
+#include "plasma/eviction_policy.h"
 #include "plasma/external_store.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
-#include "plasma/quota_aware_policy.h"
 
 namespace arrow {
 class Status;
@@ -58,9 +58,14 @@ class PlasmaStore {
   using NotificationMap = std::unordered_map<int, NotificationQueue>;
 
   // TODO: PascalCase PlasmaStore methods.
+  ///
+  /// \param eviction_policy The name of the eviction policy: "lru" for the
+  ///        least recently used objects first, with client quotas, or "cost"
+  ///        for the CostAwarePolicy.
   PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
               const std::string& socket_name,
-              std::shared_ptr<ExternalStore> external_store);
+              std::shared_ptr<ExternalStore> external_store,
+              const std::string& eviction_policy = "lru");
 
   ~PlasmaStore();
 
@@ -219,7 +224,7 @@ class PlasmaStore {
   /// to the eviction policy.
   PlasmaStoreInfo store_info_;
   /// The state that is managed by the eviction policy.
-  QuotaAwarePolicy eviction_policy_;
+  std::unique_ptr<EvictionPolicy> eviction_policy_;
   /// Input buffer. This is allocated only once to avoid mallocs for every
   /// call to process_message.
   std::vector<uint8_t> input_buffer_;
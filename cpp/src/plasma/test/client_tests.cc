@@ -61,8 +61,9 @@ class TestPlasmaStore : public ::testing::Test {
     std::string plasma_directory =
         test_executable.substr(0, test_executable.find_last_of("/"));
     std::string plasma_command =
-        plasma_directory + "/plasma-store-server -m 10000000 -s " + store_socket_name_ +
-        " 1> /dev/null 2> /dev/null & " + "echo $! > " + store_socket_name_ + ".pid";
+        plasma_directory + "/plasma-store-server -m 10000000 " + store_flags_ + " -s " +
+        store_socket_name_ + " 1> /dev/null 2> /dev/null & " + "echo $! > " +
+        store_socket_name_ + ".pid";
     PLASMA_CHECK_SYSTEM(system(plasma_command.c_str()));
     ARROW_CHECK_OK(client_.Connect(store_socket_name_, ""));
     ARROW_CHECK_OK(client2_.Connect(store_socket_name_, ""));
@@ -101,12 +102,41 @@ class TestPlasmaStore : public ::testing::Test {
   }
 
  protected:
+  /// Extra command-line flags of the store.
+  std::string store_flags_;
   PlasmaClient client_;
   PlasmaClient client2_;
   std::unique_ptr<TemporaryDir> temp_dir_;
   std::string store_socket_name_;
 };
 
+class TestPlasmaStoreCostAwarePolicy : public TestPlasmaStore {
+ public:
+  TestPlasmaStoreCostAwarePolicy() { store_flags_ = "-p cost"; }
+};
+
+/// Run the store in the foreground and return its exit status.
+int RunStore(const std::string& flags) {
+  EXPECT_OK_AND_ASSIGN(auto temp_dir, TemporaryDir::Make("cli-test-"));
+  std::string plasma_directory =
+      test_executable.substr(0, test_executable.find_last_of("/"));
+  std::string plasma_command = plasma_directory + "/plasma-store-server -m 10000000 -s " +
+                               temp_dir->path().ToString() + "store " + flags +
+                               " 1> /dev/null 2> /dev/null";
+  int status = system(plasma_command.c_str());
+  EXPECT_TRUE(WIFEXITED(status));
+  return WEXITSTATUS(status);
+}
+
+TEST(TestPlasmaStoreFlags, UnknownEvictionPolicy) {
+  ASSERT_EQ(RunStore("-p fifo"), 1);
+}
+
+TEST(TestPlasmaStoreFlags, InvalidNumaNode) {
+  // The store refuses to start instead of ignoring the node on every mapping
+  ASSERT_EQ(RunStore("-n 1048576"), 1);
+}
+
 TEST_F(TestPlasmaStore, NewSubscriberTest) {
   PlasmaClient local_client, local_client2;
 
@@ -500,6 +530,54 @@ TEST_F(TestPlasmaStore, RefreshLRUTest) {
   ASSERT_FALSE(has_object);
 }
 
+TEST_F(TestPlasmaStore, EvictsLeastRecentlyUsedObjectsFirst) {
+  std::vector<uint8_t> data(2 * 1000 * 1000, 1);
+  ObjectID read = random_object_id();
+  ObjectID unread = random_object_id();
+  CreateObject(client_, read, {}, data);
+  CreateObject(client_, unread, {}, data);
+  std::vector<ObjectBuffer> object_buffers;
+  // The object is released when its buffers go out of scope
+  ASSERT_OK(client_.Get({read}, 0, &object_buffers));
+  object_buffers.clear();
+
+  // Making room for this object evicts 20% of the capacity, i.e. one object
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(client_.Create(random_object_id(), 7 * 1000 * 1000, nullptr, 0, &buffer));
+  bool has_object;
+  ASSERT_OK(client_.Contains(unread, &has_object));
+  ASSERT_FALSE(has_object);
+  ASSERT_OK(client_.Contains(read, &has_object));
+  ASSERT_TRUE(has_object);
+}
+
+TEST_F(TestPlasmaStoreCostAwarePolicy, EvictsCheapObjectsFirst) {
+  std::vector<uint8_t> data(2 * 1000 * 1000, 1);
+  ObjectID costly = random_object_id();
+  ObjectID cheap = random_object_id();
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(client_.Create(costly, data.size(), nullptr, 0, &buffer, /*device_num=*/0,
+                           /*evict_if_full=*/true, /*cost=*/100));
+  ASSERT_OK(client_.Seal(costly));
+  ASSERT_OK(client_.Release(costly));
+  CreateObject(client_, cheap, {}, data);
+
+  // The default policy would evict the least recently used object instead
+  ASSERT_OK(client_.Create(random_object_id(), 7 * 1000 * 1000, nullptr, 0, &buffer));
+  bool has_object;
+  ASSERT_OK(client_.Contains(cheap, &has_object));
+  ASSERT_FALSE(has_object);
+  ASSERT_OK(client_.Contains(costly, &has_object));
+  ASSERT_TRUE(has_object);
+}
+
+TEST_F(TestPlasmaStoreCostAwarePolicy, NegativeCost) {
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_RAISES(Invalid, client_.Create(random_object_id(), 100, nullptr, 0, &buffer,
+                                        /*device_num=*/0, /*evict_if_full=*/true,
+                                        /*cost=*/-1));
+}
+
 TEST_F(TestPlasmaStore, DeleteTest) {
   ObjectID object_id = random_object_id();
 
@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "plasma/common.h"
+#include "plasma/cost_aware_policy.h"
+#include "plasma/plasma.h"
+#include "plasma/test_util.h"
+
+namespace plasma {
+
+class TestCostAwarePolicy : public ::testing::Test {
+ public:
+  TestCostAwarePolicy() : policy_(&store_info_, /*max_size=*/1 << 20) {}
+
+  /// Add an object to the store like PlasmaStore::CreateObject, with the cost
+  /// given to PlasmaClient::Create (0 for the default).
+  ObjectID Create(int64_t size, double cost = 0) {
+    ObjectID object_id = random_object_id();
+    std::unique_ptr<ObjectTableEntry> entry(new ObjectTableEntry());
+    entry->data_size = size;
+    entry->metadata_size = 0;
+    store_info_.objects[object_id] = std::move(entry);
+    policy_.ObjectCreated(object_id, /*client=*/nullptr, /*is_create=*/true);
+    if (cost > 0) {
+      policy_.SetObjectCost(object_id, cost);
+    }
+    return object_id;
+  }
+
+  /// Read an object once, like a Get followed by a Release.
+  void Access(const ObjectID& object_id) {
+    policy_.BeginObjectAccess(object_id);
+    policy_.EndObjectAccess(object_id);
+  }
+
+  /// Evict objects like the store does, removing them from the object table.
+  std::vector<ObjectID> Evict(int64_t num_bytes, int64_t expected_bytes_evicted) {
+    std::vector<ObjectID> objects_to_evict;
+    EXPECT_EQ(expected_bytes_evicted,
+              policy_.ChooseObjectsToEvict(num_bytes, &objects_to_evict));
+    for (const auto& object_id : objects_to_evict) {
+      store_info_.objects.erase(object_id);
+    }
+    return objects_to_evict;
+  }
+
+ protected:
+  PlasmaStoreInfo store_info_;
+  CostAwarePolicy policy_;
+};
+
+TEST_F(TestCostAwarePolicy, EvictsLargeObjectsFirst) {
+  ObjectID medium = Create(100);
+  ObjectID large = Create(1000);
+  ObjectID small = Create(10);
+
+  ASSERT_EQ(Evict(1, 1000), std::vector<ObjectID>({large}));
+  ASSERT_EQ(Evict(1, 100), std::vector<ObjectID>({medium}));
+  ASSERT_EQ(Evict(1, 10), std::vector<ObjectID>({small}));
+  ASSERT_EQ(Evict(1, 0), std::vector<ObjectID>());
+}
+
+TEST_F(TestCostAwarePolicy, EvictsUntilEnoughBytesAreFreed) {
+  ObjectID first = Create(100);
+  ObjectID second = Create(100);
+  ObjectID third = Create(100);
+
+  // Objects of equal priority go in creation order
+  ASSERT_EQ(Evict(150, 200), std::vector<ObjectID>({first, second}));
+  ASSERT_EQ(Evict(1000, 100), std::vector<ObjectID>({third}));
+}
+
+TEST_F(TestCostAwarePolicy, CostlyObjectsAreKept) {
+  ObjectID costly = Create(100, /*cost=*/50);
+  ObjectID cheap = Create(10);
+
+  // 50 / 100 > 1 / 10
+  ASSERT_EQ(Evict(1, 10), std::vector<ObjectID>({cheap}));
+  ASSERT_EQ(Evict(1, 100), std::vector<ObjectID>({costly}));
+}
+
+TEST_F(TestCostAwarePolicy, SetObjectCostReordersEvictableObjects) {
+  ObjectID first = Create(100);
+  ObjectID second = Create(100);
+
+  policy_.SetObjectCost(first, 2);
+  ASSERT_EQ(Evict(1, 100), std::vector<ObjectID>({second}));
+  ASSERT_EQ(Evict(1, 100), std::vector<ObjectID>({first}));
+}
+
+TEST_F(TestCostAwarePolicy, AccessesRaisePriority) {
+  ObjectID read = Create(100);
+  ObjectID unread = Create(100);
+  ObjectID refreshed = Create(100);
+
+  Access(read);
+  Access(read);
+  policy_.RefreshObjects({refreshed});
+  ASSERT_EQ(Evict(1, 100), std::vector<ObjectID>({unread}));
+  ASSERT_EQ(Evict(1, 100), std::vector<ObjectID>({refreshed}));
+  ASSERT_EQ(Evict(1, 100), std::vector<ObjectID>({read}));
+}
+
+TEST_F(TestCostAwarePolicy, PinnedObjectsAreNotEvicted) {
+  ObjectID pinned = Create(100);
+  ObjectID unpinned = Create(1000);
+
+  policy_.BeginObjectAccess(pinned);
+  ASSERT_EQ(Evict(2000, 1000), std::vector<ObjectID>({unpinned}));
+  ASSERT_EQ(Evict(2000, 0), std::vector<ObjectID>());
+
+  policy_.EndObjectAccess(pinned);
+  ASSERT_EQ(Evict(2000, 100), std::vector<ObjectID>({pinned}));
+}
+
+TEST_F(TestCostAwarePolicy, EvictionsAgeRemainingObjects) {
+  // Priority 1.5 / 100
+  ObjectID old_object = Create(100, /*cost=*/1.5);
+  // Priority 1 / 100
+  ObjectID victim = Create(100);
+  ASSERT_EQ(Evict(1, 100), std::vector<ObjectID>({victim}));
+
+  // Objects queued from now on start from the priority of the victim, so a new
+  // object of cost 1 (priority 1 / 100 + 1 / 100) outlives the old object even
+  // though the old one is costlier
+  ObjectID new_object = Create(100);
+  ASSERT_EQ(Evict(1, 100), std::vector<ObjectID>({old_object}));
+  ASSERT_EQ(Evict(1, 100), std::vector<ObjectID>({new_object}));
+}
+
+TEST_F(TestCostAwarePolicy, RemoveObject) {
+  ObjectID removed = Create(1000);
+  ObjectID kept = Create(100);
+
+  policy_.RemoveObject(removed);
+  store_info_.objects.erase(removed);
+  // Removing an unknown object is a no-op
+  policy_.RemoveObject(random_object_id());
+  ASSERT_EQ(Evict(2000, 100), std::vector<ObjectID>({kept}));
+}
+
+TEST_F(TestCostAwarePolicy, ObjectCreatedResetsStatistics) {
+  ObjectID restored = Create(100, /*cost=*/10);
+  ObjectID other = Create(100);
+  Access(restored);
+
+  // An object read back from an external store is created again: it forgets its
+  // accesses and cost, and its size is read again
+  store_info_.objects[restored]->data_size = 1000;
+  policy_.ObjectCreated(restored, /*client=*/nullptr, /*is_create=*/false);
+  ASSERT_EQ(Evict(1, 1000), std::vector<ObjectID>({restored}));
+  ASSERT_EQ(Evict(1, 100), std::vector<ObjectID>({other}));
+  ASSERT_EQ(Evict(1, 0), std::vector<ObjectID>());
+}
+
+}  // namespace plasma
@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+
+#include "plasma/malloc.h"
+
+namespace plasma {
+
+// Far above the number of nodes any kernel supports
+constexpr int kInvalidNumaNode = 1 << 20;
+
+class TestNumaNode : public ::testing::Test {
+ public:
+  void SetUp() override {
+    page_size_ = sysconf(_SC_PAGESIZE);
+    pointer_ = mmap(NULL, page_size_, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(pointer_, MAP_FAILED);
+  }
+
+  void TearDown() override {
+    munmap(pointer_, page_size_);
+    ASSERT_OK(SetMallocNumaNode(-1));
+  }
+
+ protected:
+  size_t page_size_;
+  void* pointer_;
+};
+
+TEST_F(TestNumaNode, DefaultPlacement) { ASSERT_OK(SetMallocNumaNode(-1)); }
+
+TEST_F(TestNumaNode, InvalidNode) {
+  // Also on hosts without NUMA support, where the kernel rejects every node
+  ASSERT_NOT_OK(BindToNumaNode(pointer_, page_size_, kInvalidNumaNode));
+  ASSERT_NOT_OK(BindToNumaNode(pointer_, page_size_, -2));
+  ASSERT_NOT_OK(SetMallocNumaNode(kInvalidNumaNode));
+}
+
+TEST_F(TestNumaNode, FirstNode) {
+#ifdef __linux__
+  // Node 0 exists on every Linux host, unless the kernel was built without NUMA
+  Status s = BindToNumaNode(pointer_, page_size_, 0);
+  if (!s.ok()) {
+    GTEST_SKIP() << "NUMA is not supported: " << s.ToString();
+  }
+  ASSERT_OK(SetMallocNumaNode(0));
+#else
+  ASSERT_RAISES(NotImplemented, BindToNumaNode(pointer_, page_size_, 0));
+  ASSERT_RAISES(NotImplemented, SetMallocNumaNode(0));
+#endif
+}
+
+}  // namespace plasma
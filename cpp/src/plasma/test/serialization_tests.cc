@@ -97,8 +97,9 @@ TEST_F(TestPlasmaSerialization, CreateRequest) {
   int64_t data_size1 = 42;
   int64_t metadata_size1 = 11;
   int device_num1 = 0;
+  double cost1 = 2.5;
   ASSERT_OK(SendCreateRequest(fd, object_id1, /*evict_if_full=*/true, data_size1,
-                              metadata_size1, device_num1));
+                              metadata_size1, device_num1, cost1));
   std::vector<uint8_t> data =
       read_message_from_file(fd, MessageType::PlasmaCreateRequest);
   ObjectID object_id2;
@@ -106,13 +107,15 @@ TEST_F(TestPlasmaSerialization, CreateRequest) {
   int64_t data_size2;
   int64_t metadata_size2;
   int device_num2;
+  double cost2;
   ASSERT_OK(ReadCreateRequest(data.data(), data.size(), &object_id2, &evict_if_full,
-                              &data_size2, &metadata_size2, &device_num2));
+                              &data_size2, &metadata_size2, &device_num2, &cost2));
   ASSERT_TRUE(evict_if_full);
   ASSERT_EQ(data_size1, data_size2);
   ASSERT_EQ(metadata_size1, metadata_size2);
   ASSERT_EQ(object_id1, object_id2);
   ASSERT_EQ(device_num1, device_num2);
+  ASSERT_EQ(cost1, cost2);
   close(fd);
 }
 
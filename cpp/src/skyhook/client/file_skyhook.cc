@@ -57,9 +57,17 @@ class SkyhookFileFormat::Impl {
       return arrow::Status::Invalid("Unsupported file format ", file_format_);
     }
 
+    std::shared_ptr<SkyhookFragmentScanOptions> pushdown;
+    if (options->fragment_scan_options &&
+        options->fragment_scan_options->type_name() == "skyhook") {
+      pushdown = arrow::internal::checked_pointer_cast<SkyhookFragmentScanOptions>(
+          options->fragment_scan_options);
+      RETURN_NOT_OK(pushdown->MergeAggregates().status());
+    }
+
     auto fut = arrow::DeferNotOk(options->io_context.executor()->Submit(
-        [file, file_format, format,
-         options]() -> arrow::Result<arrow::RecordBatchGenerator> {
+        [file, file_format, format, options,
+         pushdown]() -> arrow::Result<arrow::RecordBatchGenerator> {
           auto self = format->impl_.get();
 
           /// Retrieve the size of the file using POSIX `stat`.
@@ -74,6 +82,11 @@ class SkyhookFileFormat::Impl {
           req.dataset_schema = options->dataset_schema;
           req.file_size = st.st_size;
           req.file_format = file_format;
+          if (pushdown) {
+            req.aggregates = pushdown->aggregates;
+            req.group_by = pushdown->group_by;
+            req.limit = pushdown->limit;
+          }
 
           /// Serialize the ScanRequest into a ceph bufferlist.
           ceph::bufferlist request;
@@ -121,6 +134,18 @@ class SkyhookFileFormat::Impl {
   std::string file_format_;
 };
 
+arrow::Result<std::vector<arrow::compute::Aggregate>>
+SkyhookFragmentScanOptions::MergeAggregates() const {
+  std::vector<arrow::compute::Aggregate> merge_aggregates;
+  for (const auto& aggregate : aggregates) {
+    ARROW_ASSIGN_OR_RAISE(auto function,
+                          skyhook::MergeAggregateFunction(aggregate.function));
+    merge_aggregates.push_back({std::move(function), nullptr,
+                                arrow::FieldRef(aggregate.name), aggregate.name});
+  }
+  return merge_aggregates;
+}
+
 arrow::Result<std::shared_ptr<SkyhookFileFormat>> SkyhookFileFormat::Make(
     std::shared_ptr<RadosConnCtx> ctx, std::string file_format) {
   auto format =
@@ -18,7 +18,9 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "arrow/compute/api_aggregate.h"
 #include "arrow/dataset/file_parquet.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/dataset/type_fwd.h"
@@ -51,6 +53,33 @@ struct RadosConnCtx {
         ceph_cls_name(std::move(ceph_cls_name)) {}
 };
 
+/// \class SkyhookFragmentScanOptions
+/// \brief Options pushing aggregations and a limit down to the Ceph OSDs.
+///
+/// With aggregates, each OSD returns the partial results of the aggregations over the
+/// rows of its object which pass the filter, instead of the rows themselves: one
+/// column per group_by field, followed by one column per aggregation named after it.
+/// As these batches do not match the dataset schema they are to be read from the
+/// fragments (Fragment::ScanBatchesAsync) rather than through a Scanner, and merged by
+/// aggregating them with MergeAggregates(), grouped by group_by.
+class SkyhookFragmentScanOptions : public arrow::dataset::FragmentScanOptions {
+ public:
+  std::string type_name() const override { return "skyhook"; }
+
+  /// The aggregations computed by the OSDs.  Only count, sum, min and max, and their
+  /// hash_ counterparts when grouped, are supported as only their partial results can
+  /// be merged.
+  std::vector<arrow::compute::Aggregate> aggregates;
+  /// The names of the fields the aggregations are grouped by
+  std::vector<std::string> group_by;
+  /// The maximum number of rows each OSD returns, or -1 for all of them.  Ignored with
+  /// aggregates.
+  int64_t limit = -1;
+
+  /// \brief The aggregations merging the partial results returned by the OSDs
+  arrow::Result<std::vector<arrow::compute::Aggregate>> MergeAggregates() const;
+};
+
 /// \class SkyhookFileFormat
 /// \brief A FileFormat implementation that offloads fragment
 /// scan operations to the Ceph OSDs. For more details, see the
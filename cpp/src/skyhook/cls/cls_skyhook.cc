@@ -16,14 +16,18 @@
 // under the License.
 #include <rados/objclass.h>
 
+#include <algorithm>
 #include <memory>
 
+#include "arrow/compute/exec/exec_plan.h"
 #include "arrow/compute/exec/expression.h"
+#include "arrow/compute/exec/options.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/file_ipc.h"
 #include "arrow/dataset/file_parquet.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/result.h"
+#include "arrow/table.h"
 #include "arrow/util/logging.h"
 
 #include "skyhook/protocol/skyhook_protocol.h"
@@ -143,6 +147,53 @@ class RandomAccessObject : public arrow::io::RandomAccessFile {
   std::vector<std::shared_ptr<ceph::bufferlist>> chunks_;
 };
 
+/// \brief The top-level columns to scan for the aggregations of a scan request.
+/// \param[in] req The scan request received from the client.
+/// \return Column names.
+arrow::Result<std::vector<std::string>> AggregatedColumns(
+    const skyhook::ScanRequest& req) {
+  std::vector<std::string> columns = req.group_by;
+  for (const auto& aggregate : req.aggregates) {
+    RETURN_NOT_OK(skyhook::MergeAggregateFunction(aggregate.function).status());
+    ARROW_ASSIGN_OR_RAISE(auto path, aggregate.target.FindOne(*req.dataset_schema));
+    const auto& name = req.dataset_schema->field(path[0])->name();
+    if (std::find(columns.begin(), columns.end(), name) == columns.end()) {
+      columns.push_back(name);
+    }
+  }
+  return columns;
+}
+
+/// \brief Compute the partial aggregations of a scan request over the scanned rows.
+/// \param[in] table The scanned rows.
+/// \param[in] req The scan request received from the client.
+/// \return Table with the group_by columns followed by one column per aggregation.
+arrow::Result<std::shared_ptr<arrow::Table>> DoAggregate(
+    std::shared_ptr<arrow::Table> table, const skyhook::ScanRequest& req) {
+  arrow::compute::ExecContext exec_context;
+  ARROW_ASSIGN_OR_RAISE(auto plan, arrow::compute::ExecPlan::Make(&exec_context));
+  arrow::AsyncGenerator<arrow::util::optional<arrow::compute::ExecBatch>> sink_gen;
+  std::vector<arrow::FieldRef> keys(req.group_by.begin(), req.group_by.end());
+  ARROW_ASSIGN_OR_RAISE(
+      auto sink,
+      arrow::compute::Declaration::Sequence(
+          {
+              {"table_source", arrow::compute::TableSourceNodeOptions{
+                                   std::move(table), /*max_batch_size=*/1 << 20}},
+              {"aggregate", arrow::compute::AggregateNodeOptions{req.aggregates, keys}},
+              {"sink", arrow::compute::SinkNodeOptions{&sink_gen}},
+          })
+          .AddToPlan(plan.get()));
+
+  auto reader = arrow::compute::MakeGeneratorReader(
+      sink->inputs()[0]->output_schema(), std::move(sink_gen),
+      exec_context.memory_pool());
+  RETURN_NOT_OK(plan->StartProducing());
+  ARROW_ASSIGN_OR_RAISE(auto result, arrow::Table::FromRecordBatchReader(reader.get()));
+  RETURN_NOT_OK(plan->finished().status());
+  return result;
+}
+
 /// \brief Driver function to execute the Scan operations.
 /// \param[in] hctx RADOS object context.
 /// \param[in] req The scan request received from the client.
@@ -163,11 +214,24 @@ arrow::Result<std::shared_ptr<arrow::Table>> DoScan(
       req.dataset_schema, std::move(fragment), std::move(options));
 
   ARROW_RETURN_NOT_OK(builder->Filter(req.filter_expression));
-  ARROW_RETURN_NOT_OK(builder->Project(req.projection_schema->field_names()));
+  if (req.aggregates.empty()) {
+    ARROW_RETURN_NOT_OK(builder->Project(req.projection_schema->field_names()));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(auto columns, AggregatedColumns(req));
+    ARROW_RETURN_NOT_OK(builder->Project(std::move(columns)));
+  }
   ARROW_RETURN_NOT_OK(builder->UseThreads(true));
   ARROW_RETURN_NOT_OK(builder->FragmentScanOptions(fragment_scan_options));
 
   ARROW_ASSIGN_OR_RAISE(auto scanner, builder->Finish());
+  if (!req.aggregates.empty()) {
+    // Only the partial aggregations are sent back, to be merged by the client
+    ARROW_ASSIGN_OR_RAISE(auto table, scanner->ToTable());
+    return DoAggregate(std::move(table), req);
+  }
+  if (req.limit >= 0) {
+    return scanner->Head(req.limit);
+  }
   ARROW_ASSIGN_OR_RAISE(auto table, scanner->ToTable());
   return table;
 }
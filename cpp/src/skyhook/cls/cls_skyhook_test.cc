@@ -16,13 +16,18 @@
 // under the License.
 #include "skyhook/client/file_skyhook.h"
 
+#include <cmath>
+
+#include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/exec/expression.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/filesystem/api.h"
 #include "arrow/io/api.h"
 #include "arrow/table.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "gtest/gtest.h"
@@ -206,3 +211,51 @@ TEST(TestSkyhookCLS, SelectRowsAndColumnsOnlyOnPartitionKey) {
   ASSERT_EQ(table_parquet->Equals(*table_skyhook_parquet), 1);
   ASSERT_EQ(table_parquet->num_rows(), table_skyhook_parquet->num_rows());
 }
+
+TEST(TestSkyhookCLS, AggregateFewRows) {
+  std::string path;
+  auto fs = GetFileSystemFromUri("file:///mnt/cephfs/nyc", &path);
+  std::vector<std::string> columns = {"total_amount"};
+  auto filter = arrow::compute::greater(arrow::compute::field_ref("payment_type"),
+                                        arrow::compute::literal(2));
+
+  auto parquet_format = GetParquetFormat();
+  auto dataset = GetDatasetFromPath(fs, parquet_format, path);
+  auto scanner = GetScannerFromDataset(dataset, columns, filter, true);
+  EXPECT_OK_AND_ASSIGN(auto table_parquet, scanner->ToTable());
+  auto total_amount = table_parquet->GetColumnByName("total_amount");
+  ASSERT_OK_AND_ASSIGN(auto expected_sum, arrow::compute::Sum(total_amount));
+
+  auto pushdown = std::make_shared<skyhook::SkyhookFragmentScanOptions>();
+  pushdown->aggregates = {{"count", nullptr, "total_amount", "count"},
+                          {"sum", nullptr, "total_amount", "sum"}};
+  auto skyhook_format = GetSkyhookFormat();
+  dataset = GetDatasetFromPath(fs, skyhook_format, path);
+  scanner = GetScannerFromDataset(dataset, columns, filter, true);
+  auto options = std::make_shared<arrow::dataset::ScanOptions>(*scanner->options());
+  options->fragment_scan_options = pushdown;
+
+  // Each object only returns a row of partial results, which are merged here
+  ASSERT_OK_AND_ASSIGN(auto fragments, dataset->GetFragments(options->filter));
+  arrow::RecordBatchVector partials;
+  for (const auto& maybe_fragment : fragments) {
+    ASSERT_OK_AND_ASSIGN(auto fragment, maybe_fragment);
+    ASSERT_OK_AND_ASSIGN(auto batch_gen, fragment->ScanBatchesAsync(options));
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, arrow::CollectAsyncGenerator(batch_gen));
+    partials.insert(partials.end(), batches.begin(), batches.end());
+  }
+  ASSERT_OK_AND_ASSIGN(auto partial_table, arrow::Table::FromRecordBatches(partials));
+  ASSERT_OK_AND_ASSIGN(auto merge_aggregates, pushdown->MergeAggregates());
+  ASSERT_EQ(merge_aggregates[0].function, "sum");
+  ASSERT_EQ(merge_aggregates[1].function, "sum");
+
+  ASSERT_OK_AND_ASSIGN(auto count,
+                       arrow::compute::Sum(partial_table->GetColumnByName("count")));
+  ASSERT_EQ(count.scalar_as<arrow::Int64Scalar>().value,
+            total_amount->length() - total_amount->null_count());
+  ASSERT_OK_AND_ASSIGN(auto sum,
+                       arrow::compute::Sum(partial_table->GetColumnByName("sum")));
+  double expected = expected_sum.scalar_as<arrow::DoubleScalar>().value;
+  ASSERT_NEAR(sum.scalar_as<arrow::DoubleScalar>().value, expected,
+              1e-9 * std::abs(expected));
+}
@@ -11,8 +11,119 @@ namespace apache {
 namespace arrow {
 namespace flatbuf {
 
+struct ScanAggregate;
+
 struct ScanRequest;
 
+/// An aggregation computed on the storage node, see arrow::compute::Aggregate
+struct ScanAggregate FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_FUNCTION = 4,
+    VT_OPTIONS_TYPE = 6,
+    VT_OPTIONS = 8,
+    VT_TARGET = 10,
+    VT_NAME = 12
+  };
+  const flatbuffers::String *function() const {
+    return GetPointer<const flatbuffers::String *>(VT_FUNCTION);
+  }
+  /// The type name and serialization of the FunctionOptions, if any
+  const flatbuffers::String *options_type() const {
+    return GetPointer<const flatbuffers::String *>(VT_OPTIONS_TYPE);
+  }
+  const flatbuffers::Vector<uint8_t> *options() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_OPTIONS);
+  }
+  /// The dot path of the target field
+  const flatbuffers::String *target() const {
+    return GetPointer<const flatbuffers::String *>(VT_TARGET);
+  }
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_FUNCTION) &&
+           verifier.VerifyString(function()) &&
+           VerifyOffset(verifier, VT_OPTIONS_TYPE) &&
+           verifier.VerifyString(options_type()) &&
+           VerifyOffset(verifier, VT_OPTIONS) &&
+           verifier.VerifyVector(options()) &&
+           VerifyOffset(verifier, VT_TARGET) &&
+           verifier.VerifyString(target()) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ScanAggregateBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_function(flatbuffers::Offset<flatbuffers::String> function) {
+    fbb_.AddOffset(ScanAggregate::VT_FUNCTION, function);
+  }
+  void add_options_type(flatbuffers::Offset<flatbuffers::String> options_type) {
+    fbb_.AddOffset(ScanAggregate::VT_OPTIONS_TYPE, options_type);
+  }
+  void add_options(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> options) {
+    fbb_.AddOffset(ScanAggregate::VT_OPTIONS, options);
+  }
+  void add_target(flatbuffers::Offset<flatbuffers::String> target) {
+    fbb_.AddOffset(ScanAggregate::VT_TARGET, target);
+  }
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(ScanAggregate::VT_NAME, name);
+  }
+  explicit ScanAggregateBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ScanAggregateBuilder &operator=(const ScanAggregateBuilder &);
+  flatbuffers::Offset<ScanAggregate> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ScanAggregate>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ScanAggregate> CreateScanAggregate(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> function = 0,
+    flatbuffers::Offset<flatbuffers::String> options_type = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> options = 0,
+    flatbuffers::Offset<flatbuffers::String> target = 0,
+    flatbuffers::Offset<flatbuffers::String> name = 0) {
+  ScanAggregateBuilder builder_(_fbb);
+  builder_.add_name(name);
+  builder_.add_target(target);
+  builder_.add_options(options);
+  builder_.add_options_type(options_type);
+  builder_.add_function(function);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ScanAggregate> CreateScanAggregateDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *function = nullptr,
+    const char *options_type = nullptr,
+    const std::vector<uint8_t> *options = nullptr,
+    const char *target = nullptr,
+    const char *name = nullptr) {
+  auto function__ = function ? _fbb.CreateString(function) : 0;
+  auto options_type__ = options_type ? _fbb.CreateString(options_type) : 0;
+  auto options__ = options ? _fbb.CreateVector<uint8_t>(*options) : 0;
+  auto target__ = target ? _fbb.CreateString(target) : 0;
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  return org::apache::arrow::flatbuf::CreateScanAggregate(
+      _fbb,
+      function__,
+      options_type__,
+      options__,
+      target__,
+      name__);
+}
+
 struct ScanRequest FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_FILE_SIZE = 4,
@@ -20,7 +131,10 @@ struct ScanRequest FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_FILTER = 8,
     VT_PARTITION = 10,
     VT_DATASET_SCHEMA = 12,
-    VT_PROJECTION_SCHEMA = 14
+    VT_PROJECTION_SCHEMA = 14,
+    VT_AGGREGATES = 16,
+    VT_GROUP_BY = 18,
+    VT_LIMIT = 20
   };
   int64_t file_size() const {
     return GetField<int64_t>(VT_FILE_SIZE, 0);
@@ -40,6 +154,18 @@ struct ScanRequest FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<uint8_t> *projection_schema() const {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_PROJECTION_SCHEMA);
   }
+  /// If not empty, the partial aggregations to return instead of the scanned rows
+  const flatbuffers::Vector<flatbuffers::Offset<org::apache::arrow::flatbuf::ScanAggregate>> *aggregates() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<org::apache::arrow::flatbuf::ScanAggregate>> *>(VT_AGGREGATES);
+  }
+  /// The names of the fields the aggregations are grouped by
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *group_by() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_GROUP_BY);
+  }
+  /// The maximum number of rows to return, or -1 for all of them
+  int64_t limit() const {
+    return GetField<int64_t>(VT_LIMIT, -1LL);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int64_t>(verifier, VT_FILE_SIZE) &&
@@ -52,6 +178,13 @@ struct ScanRequest FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyVector(dataset_schema()) &&
            VerifyOffset(verifier, VT_PROJECTION_SCHEMA) &&
            verifier.VerifyVector(projection_schema()) &&
+           VerifyOffset(verifier, VT_AGGREGATES) &&
+           verifier.VerifyVector(aggregates()) &&
+           verifier.VerifyVectorOfTables(aggregates()) &&
+           VerifyOffset(verifier, VT_GROUP_BY) &&
+           verifier.VerifyVector(group_by()) &&
+           verifier.VerifyVectorOfStrings(group_by()) &&
+           VerifyField<int64_t>(verifier, VT_LIMIT) &&
            verifier.EndTable();
   }
 };
@@ -77,6 +210,15 @@ struct ScanRequestBuilder {
   void add_projection_schema(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> projection_schema) {
     fbb_.AddOffset(ScanRequest::VT_PROJECTION_SCHEMA, projection_schema);
   }
+  void add_aggregates(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<org::apache::arrow::flatbuf::ScanAggregate>>> aggregates) {
+    fbb_.AddOffset(ScanRequest::VT_AGGREGATES, aggregates);
+  }
+  void add_group_by(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> group_by) {
+    fbb_.AddOffset(ScanRequest::VT_GROUP_BY, group_by);
+  }
+  void add_limit(int64_t limit) {
+    fbb_.AddElement<int64_t>(ScanRequest::VT_LIMIT, limit, -1LL);
+  }
   explicit ScanRequestBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -96,9 +238,15 @@ inline flatbuffers::Offset<ScanRequest> CreateScanRequest(
     flatbuffers::Offset<flatbuffers::Vector<uint8_t>> filter = 0,
     flatbuffers::Offset<flatbuffers::Vector<uint8_t>> partition = 0,
     flatbuffers::Offset<flatbuffers::Vector<uint8_t>> dataset_schema = 0,
-    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> projection_schema = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> projection_schema = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<org::apache::arrow::flatbuf::ScanAggregate>>> aggregates = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> group_by = 0,
+    int64_t limit = -1LL) {
   ScanRequestBuilder builder_(_fbb);
+  builder_.add_limit(limit);
   builder_.add_file_size(file_size);
+  builder_.add_group_by(group_by);
+  builder_.add_aggregates(aggregates);
   builder_.add_projection_schema(projection_schema);
   builder_.add_dataset_schema(dataset_schema);
   builder_.add_partition(partition);
@@ -114,11 +262,16 @@ inline flatbuffers::Offset<ScanRequest> CreateScanRequestDirect(
     const std::vector<uint8_t> *filter = nullptr,
     const std::vector<uint8_t> *partition = nullptr,
     const std::vector<uint8_t> *dataset_schema = nullptr,
-    const std::vector<uint8_t> *projection_schema = nullptr) {
+    const std::vector<uint8_t> *projection_schema = nullptr,
+    const std::vector<flatbuffers::Offset<org::apache::arrow::flatbuf::ScanAggregate>> *aggregates = nullptr,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *group_by = nullptr,
+    int64_t limit = -1LL) {
   auto filter__ = filter ? _fbb.CreateVector<uint8_t>(*filter) : 0;
   auto partition__ = partition ? _fbb.CreateVector<uint8_t>(*partition) : 0;
   auto dataset_schema__ = dataset_schema ? _fbb.CreateVector<uint8_t>(*dataset_schema) : 0;
   auto projection_schema__ = projection_schema ? _fbb.CreateVector<uint8_t>(*projection_schema) : 0;
+  auto aggregates__ = aggregates ? _fbb.CreateVector<flatbuffers::Offset<org::apache::arrow::flatbuf::ScanAggregate>>(*aggregates) : 0;
+  auto group_by__ = group_by ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*group_by) : 0;
   return org::apache::arrow::flatbuf::CreateScanRequest(
       _fbb,
       file_size,
@@ -126,7 +279,10 @@ inline flatbuffers::Offset<ScanRequest> CreateScanRequestDirect(
       filter__,
       partition__,
       dataset_schema__,
-      projection_schema__);
+      projection_schema__,
+      aggregates__,
+      group_by__,
+      limit);
 }
 
 inline const org::apache::arrow::flatbuf::ScanRequest *GetScanRequest(const void *buf) {
@@ -18,6 +18,8 @@
 
 #include <flatbuffers/flatbuffers.h>
 
+#include <unordered_map>
+
 #include "ScanRequest_generated.h"
 #include "arrow/io/api.h"
 #include "arrow/ipc/api.h"
@@ -48,9 +50,28 @@ arrow::Status SerializeScanRequest(ScanRequest& req, ceph::bufferlist* bl) {
   auto dataset_schema_vector =
       builder.CreateVector(dataset_schema->data(), dataset_schema->size());
 
+  std::vector<flatbuffers::Offset<flatbuf::ScanAggregate>> aggregates;
+  for (const auto& aggregate : req.aggregates) {
+    flatbuffers::Offset<flatbuffers::String> options_type = 0;
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> options = 0;
+    if (aggregate.options) {
+      ARROW_ASSIGN_OR_RAISE(auto serialized_options, aggregate.options->Serialize());
+      options_type = builder.CreateString(aggregate.options->type_name());
+      options =
+          builder.CreateVector(serialized_options->data(), serialized_options->size());
+    }
+    aggregates.push_back(flatbuf::CreateScanAggregate(
+        builder, builder.CreateString(aggregate.function), options_type, options,
+        builder.CreateString(aggregate.target.ToDotPath()),
+        builder.CreateString(aggregate.name)));
+  }
+  auto aggregates_vector = builder.CreateVector(aggregates);
+  auto group_by_vector = builder.CreateVectorOfStrings(req.group_by);
+
   auto request = flatbuf::CreateScanRequest(
       builder, req.file_size, static_cast<int>(req.file_format), filter_expression_vector,
-      partition_expression_vector, dataset_schema_vector, projected_schema_vector);
+      partition_expression_vector, dataset_schema_vector, projected_schema_vector,
+      aggregates_vector, group_by_vector, req.limit);
   builder.Finish(request);
   uint8_t* buf = builder.GetBufferPointer();
   int size = builder.GetSize();
@@ -85,6 +106,31 @@ arrow::Status DeserializeScanRequest(ceph::bufferlist& bl, ScanRequest* req) {
 
   req->file_size = request->file_size();
   req->file_format = (SkyhookFileType::type)request->file_format();
+
+  req->aggregates.clear();
+  if (request->aggregates()) {
+    for (const auto* aggregate : *request->aggregates()) {
+      arrow::compute::Aggregate out;
+      out.function = aggregate->function()->str();
+      if (aggregate->options_type()) {
+        arrow::Buffer options(aggregate->options()->data(), aggregate->options()->size());
+        ARROW_ASSIGN_OR_RAISE(out.options,
+                              arrow::compute::FunctionOptions::Deserialize(
+                                  aggregate->options_type()->str(), options));
+      }
+      ARROW_ASSIGN_OR_RAISE(out.target,
+                            arrow::FieldRef::FromDotPath(aggregate->target()->str()));
+      out.name = aggregate->name()->str();
+      req->aggregates.push_back(std::move(out));
+    }
+  }
+  req->group_by.clear();
+  if (request->group_by()) {
+    for (const auto* name : *request->group_by()) {
+      req->group_by.push_back(name->str());
+    }
+  }
+  req->limit = request->limit();
   return arrow::Status::OK();
 }
 
@@ -120,6 +166,21 @@ arrow::Status DeserializeTable(ceph::bufferlist& bl, bool use_threads,
   return arrow::Status::OK();
 }
 
+arrow::Result<std::string> MergeAggregateFunction(const std::string& function) {
+  // Counts are merged by summing them, the other partial results by aggregating them
+  // again
+  static const std::unordered_map<std::string, std::string> kMergeFunctions = {
+      {"count", "sum"}, {"hash_count", "hash_sum"}, {"sum", "sum"},
+      {"hash_sum", "hash_sum"}, {"min", "min"}, {"hash_min", "hash_min"},
+      {"max", "max"}, {"hash_max", "hash_max"}};
+  auto it = kMergeFunctions.find(function);
+  if (it == kMergeFunctions.end()) {
+    return arrow::Status::Invalid("The partial results of the aggregation ", function,
+                                  " can not be merged");
+  }
+  return it->second;
+}
+
 arrow::Status ExecuteObjectClassFn(const std::shared_ptr<rados::RadosConn>& connection,
                                    const std::string& oid, const std::string& fn,
                                    ceph::bufferlist& in, ceph::bufferlist& out) {
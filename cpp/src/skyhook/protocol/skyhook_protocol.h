@@ -21,6 +21,7 @@
 #include <sys/stat.h>
 #include <sstream>
 
+#include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/exec/expression.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
@@ -52,6 +53,14 @@ struct ScanRequest {
   std::shared_ptr<arrow::Schema> dataset_schema;
   int64_t file_size;
   SkyhookFileType::type file_format;
+  /// If not empty, the cls returns the results of these aggregations, grouped by
+  /// `group_by`, over the scanned rows instead of the rows themselves.  Only
+  /// aggregations whose partial results can be merged are supported, see
+  /// SkyhookFragmentScanOptions.
+  std::vector<arrow::compute::Aggregate> aggregates;
+  std::vector<std::string> group_by;
+  /// The maximum number of rows to return, or -1 for all of them
+  int64_t limit = -1;
 };
 
 /// Utility functions to serialize and deserialize scan requests and result Arrow tables.
@@ -62,6 +71,10 @@ arrow::Status SerializeTable(const std::shared_ptr<arrow::Table>& table,
 arrow::Status DeserializeTable(ceph::bufferlist& bl, bool use_threads,
                                arrow::RecordBatchVector* batches);
 
+/// Return the aggregate function which merges the partial results of `function`
+/// returned by the cls, or Invalid if they can not be merged.
+arrow::Result<std::string> MergeAggregateFunction(const std::string& function);
+
 /// Utility function to invoke a RADOS object class function on an RADOS object.
 arrow::Status ExecuteObjectClassFn(const std::shared_ptr<rados::RadosConn>& connection,
                                    const std::string& oid, const std::string& fn,
@@ -58,6 +58,46 @@ TEST(TestSkyhookProtocol, SerDeserScanRequest) {
   ASSERT_EQ(req.file_format, req_.file_format);
 }
 
+TEST(TestSkyhookProtocol, SerDeserScanRequestWithAggregates) {
+  ceph::bufferlist bl;
+  skyhook::ScanRequest req;
+  req.filter_expression = arrow::compute::literal(true);
+  req.partition_expression = arrow::compute::literal(true);
+  req.projection_schema = arrow::schema({arrow::field("a", arrow::int64())});
+  req.dataset_schema = arrow::schema(
+      {arrow::field("a", arrow::int64()), arrow::field("b", arrow::utf8())});
+  req.file_size = 1000000;
+  req.file_format = skyhook::SkyhookFileType::type::PARQUET;
+  req.aggregates = {
+      {"hash_count",
+       std::make_shared<arrow::compute::CountOptions>(
+           arrow::compute::CountOptions::ALL),
+       "a", "count_a"},
+      {"hash_max", nullptr, "a", "max_a"}};
+  req.group_by = {"b"};
+  req.limit = 10;
+  ASSERT_OK(skyhook::SerializeScanRequest(req, &bl));
+
+  skyhook::ScanRequest req_;
+  ASSERT_OK(skyhook::DeserializeScanRequest(bl, &req_));
+  ASSERT_EQ(req_.aggregates.size(), 2);
+  ASSERT_EQ(req_.aggregates[0].function, "hash_count");
+  ASSERT_NE(req_.aggregates[0].options, nullptr);
+  ASSERT_TRUE(req_.aggregates[0].options->Equals(*req.aggregates[0].options));
+  ASSERT_EQ(req_.aggregates[0].target, arrow::FieldRef("a"));
+  ASSERT_EQ(req_.aggregates[0].name, "count_a");
+  ASSERT_EQ(req_.aggregates[1].function, "hash_max");
+  ASSERT_EQ(req_.aggregates[1].options, nullptr);
+  ASSERT_EQ(req_.group_by, req.group_by);
+  ASSERT_EQ(req_.limit, 10);
+}
+
+TEST(TestSkyhookProtocol, MergeAggregateFunction) {
+  ASSERT_OK_AND_EQ("hash_sum", skyhook::MergeAggregateFunction("hash_count"));
+  ASSERT_OK_AND_EQ("min", skyhook::MergeAggregateFunction("min"));
+  ASSERT_RAISES(Invalid, skyhook::MergeAggregateFunction("mean"));
+}
+
 TEST(TestSkyhookProtocol, SerDeserTable) {
   std::shared_ptr<arrow::Table> table = CreateTable();
   ceph::bufferlist bl;